@@ -6,6 +6,7 @@
  */
 
 #include "arguments.h"
+#include <cstdlib>
 #include <iostream>
 extern "C" {
 #include <getopt.h>
@@ -16,7 +17,20 @@ struct option long_options[] = {
 	{"grayscale", no_argument,       0,  'g' },
 	{"alpha",     no_argument,       0,  'a' },
 	{"icon",      no_argument,       0,  'i' },
+	{"rle",       no_argument,       0,  'r' },
 	{"16bpp",     no_argument,       0,  '1' },
+	{"format",    required_argument, 0,  'f' },
+	{"indexed",   required_argument, 0,  'x' },
+	{"dither",    no_argument,       0,  'd' },
+	{"mip",       no_argument,       0,  'm' },
+	{"sizes",     required_argument, 0,  's' },
+	{"pack",      required_argument, 0,  'p' },
+	{"name",      required_argument, 0,  'n' },
+	{"font",      no_argument,       0,  'F' },
+	{"batch",     no_argument,       0,  'b' },
+	{"out",       required_argument, 0,  'o' },
+	{"jobs",      required_argument, 0,  'j' },
+	{"cache",     required_argument, 0,  'c' },
 	{0,           0,                 0,   0  }
 };
 
@@ -30,6 +44,9 @@ void arguments::arg_parse_loop()
 	int opt = 0;
 	int long_index = 0;
 
+	/* From the start, batch jobs parse their own arguments after the command line's. */
+	optind = 0;
+
 	while ((opt = getopt_long_only(argc, argv, "", long_options, &long_index)) != -1)
 	{
 		if (opt == 'h')
@@ -40,8 +57,34 @@ void arguments::arg_parse_loop()
 			alph = true;
 		if (opt == 'i')
 			icon = true;
+		if (opt == 'r')
+			rle = true;
 		if (opt == '1')
 			bpp16 = true;
+		if (opt == 'f')
+			format = optarg;
+		if (opt == 'x')
+			indexed = atoi(optarg);
+		if (opt == 'd')
+			dither = true;
+		if (opt == 'm')
+			mip = true;
+		if (opt == 's')
+			sizes = optarg;
+		if (opt == 'p')
+			pack = optarg;
+		if (opt == 'n')
+			name = optarg;
+		if (opt == 'F')
+			font = true;
+		if (opt == 'b')
+			batch = true;
+		if (opt == 'o')
+			out = optarg;
+		if (opt == 'j')
+			jobs = atoi(optarg);
+		if (opt == 'c')
+			cache = optarg;
 	}
 }
 
@@ -53,6 +96,20 @@ arguments::arguments(int main_argc, char * const *main_argv)
 	gray = false;
 	alph = false;
 	icon = false;
+	rle = false;
+	bpp16 = false;
+	format = NULL;
+	indexed = 0;
+	dither = false;
+	mip = false;
+	sizes = NULL;
+	pack = NULL;
+	name = NULL;
+	font = false;
+	batch = false;
+	out = NULL;
+	jobs = 0;
+	cache = NULL;
 	filename = argv[1];
 
 	arg_parse_loop();
@@ -99,8 +156,54 @@ void arguments::print_help()
 	std::cout << " -icon         Generate an Icon. Icons has support of " << std::endl;
 	std::cout << "               pseudo antialiasing." << std::endl;
 	std::cout << "" << std::endl;
+	std::cout << " -rle          With -icon, encode the alpha in runs of" << std::endl;
+	std::cout << "               transparent, opaque and partial pixels." << std::endl;
+	std::cout << "" << std::endl;
 	std::cout << " -16bpp        Generate an Image of 16bpp." << std::endl;
 	std::cout << "" << std::endl;
+	std::cout << " -format F     With -16bpp, generate the pixels in the framebuffer" << std::endl;
+	std::cout << "               format F: rgb565, rgb888, argb8888, l8 or indexed8." << std::endl;
+	std::cout << "               The library must be built with the same format." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -indexed N    Generate an Image of indices into a palette of" << std::endl;
+	std::cout << "               N colors, 4 bits a pixel up to 16, 8 up to 256." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -dither       With -indexed, diffuse the color error." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -mip          With -icon or -16bpp, generate the image at its size" << std::endl;
+	std::cout << "               and each half size down to one pixel, in one file." << std::endl;
+	std::cout << "               The library draws the smallest size covering the" << std::endl;
+	std::cout << "               drawn one, never shrinking it by more than 2x." << std::endl;
+	std::cout << "               Not with -pack." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -sizes L      Same as -mip with the sizes of the list L instead," << std::endl;
+	std::cout << "               as 24,32,48 for widths or 24x20,48x40." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -pack P       Add the -icon, -16bpp or -indexed output to the asset" << std::endl;
+	std::cout << "               pack P instead of a C file, creating P or replacing" << std::endl;
+	std::cout << "               the asset of the same name in it. -format sets the" << std::endl;
+	std::cout << "               format of -16bpp pixels and of -indexed palettes." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -name N       Name of the asset in the pack, the file name" << std::endl;
+	std::cout << "               without its extension by default." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -font         With -pack, the input is a font compiled in as C" << std::endl;
+	std::cout << "               arrays, as marsh/src/font_data/ubuntu_16.c." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -batch        The input is a manifest, a line per image of its path" << std::endl;
+	std::cout << "               and options added to the command line's, or a" << std::endl;
+	std::cout << "               directory of images all converted alike. Images" << std::endl;
+	std::cout << "               unchanged since the last run, with the same options," << std::endl;
+	std::cout << "               are skipped." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -out D        With -batch, write the C files in the directory D." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -jobs N       With -batch, convert on N threads, one a processor" << std::endl;
+	std::cout << "               by default." << std::endl;
+	std::cout << "" << std::endl;
+	std::cout << " -cache F      With -batch, keep the content hashes in F instead of" << std::endl;
+	std::cout << "               D/image_processor.cache, or P.cache with -pack P." << std::endl;
+	std::cout << "" << std::endl;
 }
 
 
@@ -136,6 +239,24 @@ bool arguments::op_16bpp()
 	return false;
 }
 
+const char * arguments::op_format()
+{
+	return format;
+}
+
+int arguments::op_indexed()
+{
+	return indexed;
+}
+
+bool arguments::op_dither()
+{
+	if (dither)
+		return true;
+
+	return false;
+}
+
 bool arguments::op_icon()
 {
 	if (icon)
@@ -143,3 +264,65 @@ bool arguments::op_icon()
 
 	return false;
 }
+
+bool arguments::op_rle()
+{
+	if (rle)
+		return true;
+
+	return false;
+}
+
+bool arguments::op_mip()
+{
+	if (mip)
+		return true;
+
+	return false;
+}
+
+const char * arguments::op_sizes()
+{
+	return sizes;
+}
+
+const char * arguments::op_pack()
+{
+	return pack;
+}
+
+const char * arguments::op_name()
+{
+	return name;
+}
+
+bool arguments::op_font()
+{
+	if (font)
+		return true;
+
+	return false;
+}
+
+bool arguments::op_batch()
+{
+	if (batch)
+		return true;
+
+	return false;
+}
+
+const char * arguments::op_out()
+{
+	return out;
+}
+
+int arguments::op_jobs()
+{
+	return jobs;
+}
+
+const char * arguments::op_cache()
+{
+	return cache;
+}
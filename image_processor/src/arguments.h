@@ -16,7 +16,31 @@ public:
 	bool op_grayscale();
 	bool op_alpha();
 	bool op_icon();
+	/* Icons in runs, see c_code_image::generate_icon_rle. */
+	bool op_rle();
 	bool op_16bpp();
+	/* Framebuffer pixel format of -16bpp images, NULL for RGB565 with a 16BPP bitmap. */
+	const char * op_format();
+	/* Colors of an indexed image, 0 when not asked for. */
+	int op_indexed();
+	bool op_dither();
+	/* Size variants, halving down to one pixel or the sizes listed, NULL when not asked for. */
+	bool op_mip();
+	const char * op_sizes();
+	/* Asset pack the output goes to instead of a C file, NULL for a C file. */
+	const char * op_pack();
+	/* Name of the asset in the pack, NULL for the file name without directory and extension. */
+	const char * op_name();
+	/* The input is a font in C arrays to pack. */
+	bool op_font();
+	/* The input is a manifest or a directory of images, see batch.h. */
+	bool op_batch();
+	/* Directory of the C files of -batch, the current one by default. */
+	const char * op_out();
+	/* Threads of -batch, 0 for one a processor. */
+	int op_jobs();
+	/* Content hashes of the last -batch run, NULL for the default file. */
+	const char * op_cache();
 
 	char * op_filename();
 
@@ -29,7 +53,20 @@ private:
 	bool gray;
 	bool alph;
 	bool icon;
+	bool rle;
 	bool bpp16;
+	const char * format;
+	int indexed;
+	bool dither;
+	bool mip;
+	const char * sizes;
+	const char * pack;
+	const char * name;
+	bool font;
+	bool batch;
+	const char * out;
+	int jobs;
+	const char * cache;
 };
 
 #endif /* ARGUMENTS_H_ */
@@ -0,0 +1,273 @@
+/*
+ * asset_pack.cpp
+ *
+ *  Asset pack layout, see marsh/src/asset_pack.h.
+ */
+
+#include "asset_pack.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+using namespace std;
+
+#define MAGIC       "MPAK"
+#define BYTE_ORDER_MARK 0x01020304u
+#define VERSION     1
+#define HEADER_SIZE 32
+#define ENTRY_SIZE  48
+#define ALIGN       16
+#define PAGE        4096
+
+#define KIND_BITMAP 1
+#define KIND_FONT   2
+#define SINGLE_CHANNEL 0x0001
+
+static unsigned name_hash(const string & name)
+{
+	unsigned h = 2166136261u;
+
+	for (size_t i = 0; i < name.size(); i++)
+		h = (h ^ (unsigned char)name[i]) * 16777619u;
+
+	return h & 0xFFFFFFFFu;
+}
+
+/* Little endian fields. */
+static void put(vector<unsigned char> & out, size_t at, unsigned value, int bytes)
+{
+	for (int i = 0; i < bytes; i++)
+		out[at + i] = (unsigned char)(value >> (8 * i));
+}
+
+static unsigned get(const vector<unsigned char> & in, size_t at, int bytes)
+{
+	unsigned value = 0;
+
+	for (int i = 0; i < bytes; i++)
+		value |= (unsigned)in[at + i] << (8 * i);
+
+	return value;
+}
+
+/* size bytes at offset of the pack, false past its end. */
+static bool slice(const vector<unsigned char> & pack, unsigned offset, unsigned size, vector<unsigned char> & out)
+{
+	if (offset > pack.size() || size > pack.size() - offset)
+		return false;
+
+	out.assign(pack.begin() + offset, pack.begin() + offset + size);
+	return true;
+}
+
+static bool by_hash(const pair<unsigned, size_t> & a, const pair<unsigned, size_t> & b)
+{
+	return a.first < b.first;
+}
+
+/* Appends a payload where the library may read it in place, returns its offset. */
+static unsigned place(vector<unsigned char> & pack, const vector<unsigned char> & payload)
+{
+	const size_t align = payload.size() >= PAGE ? PAGE : ALIGN;
+	const size_t offset = (pack.size() + align - 1) / align * align;
+
+	pack.resize(offset);
+	pack.insert(pack.end(), payload.begin(), payload.end());
+
+	return (unsigned)offset;
+}
+
+void asset_pack_writer::add(const asset & added)
+{
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		if (assets[i].name == added.name && assets[i].kind == added.kind)
+		{
+			assets[i] = added;
+			return;
+		}
+	}
+
+	assets.push_back(added);
+}
+
+void asset_pack_writer::add_bitmap(const char * name, int layout, int pixel_format, bool single_channel, int width, int height,
+		const vector<unsigned char> & data, const vector<unsigned char> & palette)
+{
+	asset added;
+
+	added.name = name;
+	added.kind = KIND_BITMAP;
+	added.layout = layout;
+	added.pixel_format = pixel_format;
+	added.flags = single_channel ? SINGLE_CHANNEL : 0;
+	added.width = width;
+	added.height = height;
+	added.data = data;
+	added.table = palette;
+	add(added);
+}
+
+void asset_pack_writer::add_font(const char * name, int layout, int height, const vector<unsigned char> & bitmap,
+		const vector<unsigned short> & index, const vector<unsigned char> & widths)
+{
+	asset added;
+
+	added.name = name;
+	added.kind = KIND_FONT;
+	added.layout = layout;
+	added.pixel_format = PACK_ANY_FORMAT;
+	added.flags = 0;
+	added.width = 0;
+	added.height = height;
+	added.data = bitmap;
+	added.widths = widths;
+	added.table.resize(index.size() * 2);
+	for (size_t i = 0; i < index.size(); i++)
+		put(added.table, i * 2, index[i], 2);
+	add(added);
+}
+
+void asset_pack_writer::merge(const asset_pack_writer & other)
+{
+	for (size_t i = 0; i < other.assets.size(); i++)
+		add(other.assets[i]);
+}
+
+void asset_pack_writer::merge(const asset_pack_writer & other, const string & name)
+{
+	for (size_t i = 0; i < other.assets.size(); i++)
+		if (other.assets[i].name == name)
+			add(other.assets[i]);
+}
+
+bool asset_pack_writer::contains(const string & name) const
+{
+	for (size_t i = 0; i < assets.size(); i++)
+		if (assets[i].name == name)
+			return true;
+
+	return false;
+}
+
+bool asset_pack_writer::load(const char * path)
+{
+	ifstream file(path, ios::binary);
+	vector<unsigned char> pack;
+
+	if (!file)
+		return true;
+
+	pack.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+
+	if (pack.size() < HEADER_SIZE || memcmp(&pack[0], MAGIC, 4) || get(pack, 4, 4) != BYTE_ORDER_MARK
+			|| get(pack, 8, 2) != VERSION || get(pack, 10, 2) != ENTRY_SIZE)
+	{
+		cout << path << " is not an asset pack of this version" << endl;
+		return false;
+	}
+
+	const unsigned count = get(pack, 12, 4), entries = get(pack, 16, 4);
+
+	for (unsigned i = 0; i < count; i++)
+	{
+		const size_t at = entries + (size_t)i * ENTRY_SIZE;
+		asset loaded;
+
+		if (at + ENTRY_SIZE > pack.size() || get(pack, at + 4, 4) >= pack.size())
+		{
+			cout << path << " is truncated" << endl;
+			return false;
+		}
+
+		loaded.name.assign((const char *)&pack[get(pack, at + 4, 4)], strnlen((const char *)&pack[get(pack, at + 4, 4)],
+				pack.size() - get(pack, at + 4, 4)));
+		loaded.kind = get(pack, at + 8, 2);
+		loaded.layout = get(pack, at + 10, 2);
+		loaded.pixel_format = get(pack, at + 12, 2);
+		loaded.flags = get(pack, at + 14, 2);
+		loaded.width = get(pack, at + 16, 4);
+		loaded.height = get(pack, at + 20, 4);
+		if (!slice(pack, get(pack, at + 24, 4), get(pack, at + 28, 4), loaded.data)
+				|| !slice(pack, get(pack, at + 32, 4), get(pack, at + 36, 4), loaded.table)
+				|| !slice(pack, get(pack, at + 40, 4), get(pack, at + 44, 4), loaded.widths))
+		{
+			cout << path << " is truncated" << endl;
+			return false;
+		}
+		assets.push_back(loaded);
+	}
+
+	return true;
+}
+
+bool asset_pack_writer::write(const char * path)
+{
+	vector<pair<unsigned, size_t> > order;
+	vector<unsigned char> pack(HEADER_SIZE + assets.size() * ENTRY_SIZE, 0);
+	vector<unsigned> names;
+
+	/* Sorted for the binary search of the lookups. */
+	for (size_t i = 0; i < assets.size(); i++)
+		order.push_back(make_pair(name_hash(assets[i].name), i));
+	stable_sort(order.begin(), order.end(), by_hash);
+
+	memcpy(&pack[0], MAGIC, 4);
+	put(pack, 4, BYTE_ORDER_MARK, 4);
+	put(pack, 8, VERSION, 2);
+	put(pack, 10, ENTRY_SIZE, 2);
+	put(pack, 12, (unsigned)assets.size(), 4);
+	put(pack, 16, HEADER_SIZE, 4);
+	put(pack, 20, (unsigned)pack.size(), 4);
+
+	/* Names next to the entries, the pages lookups read. */
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		names.push_back((unsigned)pack.size());
+		pack.insert(pack.end(), assets[order[i].second].name.begin(), assets[order[i].second].name.end());
+		pack.push_back(0);
+	}
+
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		const asset & a = assets[order[i].second];
+		const size_t at = HEADER_SIZE + i * ENTRY_SIZE;
+
+		put(pack, at, order[i].first, 4);
+		put(pack, at + 4, names[i], 4);
+		put(pack, at + 8, a.kind, 2);
+		put(pack, at + 10, a.layout, 2);
+		put(pack, at + 12, a.pixel_format, 2);
+		put(pack, at + 14, a.flags, 2);
+		put(pack, at + 16, a.width, 4);
+		put(pack, at + 20, a.height, 4);
+		put(pack, at + 24, place(pack, a.data), 4);
+		put(pack, at + 28, (unsigned)a.data.size(), 4);
+		if (!a.table.empty())
+		{
+			put(pack, at + 32, place(pack, a.table), 4);
+			put(pack, at + 36, (unsigned)a.table.size(), 4);
+		}
+		if (!a.widths.empty())
+		{
+			put(pack, at + 40, place(pack, a.widths), 4);
+			put(pack, at + 44, (unsigned)a.widths.size(), 4);
+		}
+	}
+
+	put(pack, 24, (unsigned)pack.size(), 4);
+
+	ofstream file(path, ios::binary);
+	file.write((const char *)&pack[0], pack.size());
+	if (!file)
+	{
+		cout << "Can't write " << path << endl;
+		return false;
+	}
+
+	cout << path << ": " << assets.size() << " assets, " << pack.size() << " bytes" << endl;
+
+	return true;
+}
@@ -0,0 +1,59 @@
+/*
+ * asset_pack.h
+ *
+ *  Writes the asset packs marsh/src/asset_pack.h maps, bitmaps and fonts with
+ *  their payloads as the library reads them.
+ */
+
+#ifndef ASSET_PACK_H_
+#define ASSET_PACK_H_
+
+#include <string>
+#include <vector>
+
+/* Layouts as marsh/src/bitmap_data/bitmap_data.h and font_data/font_data.h number them. */
+enum { PACK_1BPP, PACK_8BPP, PACK_16BPP, PACK_NATIVE, PACK_8BPP_RLE, PACK_INDEXED4, PACK_INDEXED8 };
+enum { PACK_FONT_8BITS, PACK_FONT_16BITS };
+
+/* Payloads every MARSH_PIXEL_FORMAT reads the same. */
+#define PACK_ANY_FORMAT 0xFFFF
+
+class asset_pack_writer
+{
+public:
+	/* Takes the assets of the pack at path, if there is one, so each run adds to it. */
+	bool load(const char * path);
+	/* Replaces an asset of the same name and kind. */
+	void add_bitmap(const char * name, int layout, int pixel_format, bool single_channel, int width, int height,
+			const std::vector<unsigned char> & data, const std::vector<unsigned char> & palette);
+	void add_font(const char * name, int layout, int height, const std::vector<unsigned char> & bitmap,
+			const std::vector<unsigned short> & index, const std::vector<unsigned char> & widths);
+	bool write(const char * path);
+	/* Adds the assets of other as add_bitmap and add_font do, for packs built apart. */
+	void merge(const asset_pack_writer & other);
+	/* The same with only the assets of other named name. */
+	void merge(const asset_pack_writer & other, const std::string & name);
+	/* Whether an asset of any kind is named name. */
+	bool contains(const std::string & name) const;
+
+private:
+	struct asset
+	{
+		std::string name;
+		unsigned kind;
+		unsigned layout;
+		unsigned pixel_format;
+		unsigned flags;
+		unsigned width;
+		unsigned height;
+		std::vector<unsigned char> data;
+		std::vector<unsigned char> table;
+		std::vector<unsigned char> widths;
+	};
+
+	std::vector<asset> assets;
+
+	void add(const asset & added);
+};
+
+#endif /* ASSET_PACK_H_ */
@@ -0,0 +1,409 @@
+/*
+ * batch.cpp
+ *
+ *  Jobs parsed on the main thread, getopt not being reentrant, then hashed and
+ *  converted by the pool. Packs are built a job apart and merged at the end with
+ *  the last run's assets of the skipped jobs.
+ */
+
+#include "batch.h"
+#include "arguments.h"
+#include "asset_pack.h"
+#include "convert.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+extern "C" {
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+using namespace std;
+
+/* In every hash, a new version rebuilds what the last one generated. */
+#define CACHE_VERSION "image_processor cache 1"
+
+struct job
+{
+	string input;
+	/* The strings argv points to, args parses argv. */
+	vector<string> words;
+	vector<char *> argv;
+	arguments * args;
+	string name;
+	/* The C file, or the pack and the asset name, the cache key. */
+	string output;
+	string hash;
+	bool skipped;
+	bool done;
+	asset_pack_writer pack;
+};
+
+struct pool
+{
+	vector<job *> * jobs;
+	size_t next;
+	pthread_mutex_t lock;
+	const map<string, string> * cache;
+	string directory;
+	bool packed;
+	/* The pack of the last run, whose assets skipped jobs keep. */
+	const asset_pack_writer * previous;
+};
+
+static bool image_file(const string & file)
+{
+	static const char * const extensions[] = {"png", "jpg", "jpeg", "bmp", "gif", "ppm", "pgm", "pnm", "tif", "tiff"};
+	const size_t dot = file.find_last_of('.');
+	string extension;
+
+	if (dot == string::npos || dot == 0)
+		return false;
+
+	extension = file.substr(dot + 1);
+	for (size_t i = 0; i < extension.size(); i++)
+		extension[i] = tolower((unsigned char)extension[i]);
+
+	for (size_t i = 0; i < sizeof(extensions) / sizeof(extensions[0]); i++)
+		if (extension == extensions[i])
+			return true;
+
+	return false;
+}
+
+/* The images of the directory, sorted, a line without options each. */
+static bool list_directory(const string & path, vector<vector<string> > & lines)
+{
+	DIR * dir = opendir(path.c_str());
+	struct dirent * entry;
+	vector<string> files;
+
+	if (!dir)
+	{
+		cout << path << ": cannot open the directory" << endl;
+		return false;
+	}
+
+	while ((entry = readdir(dir)) != NULL)
+		if (image_file(entry->d_name))
+			files.push_back(path + "/" + entry->d_name);
+	closedir(dir);
+
+	sort(files.begin(), files.end());
+
+	for (size_t i = 0; i < files.size(); i++)
+		lines.push_back(vector<string>(1, files[i]));
+
+	return true;
+}
+
+static bool read_manifest(const string & path, vector<vector<string> > & lines)
+{
+	ifstream manifest(path.c_str());
+	string directory, line, word;
+
+	if (!manifest)
+	{
+		cout << path << ": cannot open the manifest" << endl;
+		return false;
+	}
+
+	if (path.find_last_of('/') != string::npos)
+		directory = path.substr(0, path.find_last_of('/') + 1);
+
+	while (getline(manifest, line))
+	{
+		istringstream words(line);
+		vector<string> entry;
+
+		while (words >> word && word[0] != '#')
+			entry.push_back(word);
+		if (entry.empty())
+			continue;
+
+		if (entry[0][0] != '/')
+			entry[0].insert(0, directory);
+		lines.push_back(entry);
+	}
+
+	return true;
+}
+
+/* The asset name as a C identifier. */
+static string c_name(const string & name)
+{
+	string symbol = name;
+
+	for (size_t i = 0; i < symbol.size(); i++)
+		if (!isalnum((unsigned char)symbol[i]) && symbol[i] != '_')
+			symbol[i] = '_';
+
+	if (symbol.empty() || isdigit((unsigned char)symbol[0]))
+		symbol.insert(0, "_");
+
+	return symbol;
+}
+
+static uint64_t fnv1a(uint64_t hash, const char * data, size_t size)
+{
+	for (size_t i = 0; i < size; i++)
+		hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+
+	return hash;
+}
+
+/* FNV-1a 64 of the version, the options, the output and the input bytes, empty when
+ * the input cannot be read. */
+static string content_hash(const job & job)
+{
+	static const string version = CACHE_VERSION;
+	uint64_t hash = 14695981039346656037ULL;
+	ifstream input(job.input.c_str(), ios::binary);
+	char buffer[65536];
+	char text[17];
+
+	if (!input)
+		return "";
+
+	hash = fnv1a(hash, version.c_str(), version.size() + 1);
+	for (size_t i = 1; i < job.words.size(); i++)
+		hash = fnv1a(hash, job.words[i].c_str(), job.words[i].size() + 1);
+	hash = fnv1a(hash, job.output.c_str(), job.output.size() + 1);
+
+	while (input.read(buffer, sizeof(buffer)) || input.gcount())
+		hash = fnv1a(hash, buffer, input.gcount());
+
+	snprintf(text, sizeof(text), "%016llx", (unsigned long long)hash);
+	return text;
+}
+
+static bool exists(const string & path)
+{
+	struct stat info;
+
+	return stat(path.c_str(), &info) == 0;
+}
+
+static void run(const struct pool & pool, job & job)
+{
+	map<string, string>::const_iterator cached;
+
+	job.hash = content_hash(job);
+	cached = pool.cache->find(job.output);
+
+	if (!job.hash.empty() && cached != pool.cache->end() && cached->second == job.hash
+			&& (pool.packed ? pool.previous->contains(job.name) : exists(job.output)))
+	{
+		job.skipped = true;
+		job.done = true;
+		return;
+	}
+
+	job.done = convert(*job.args, job.name, pool.directory, pool.packed ? &job.pack : NULL, false);
+}
+
+static void * work(void * data)
+{
+	struct pool * pool = (struct pool *)data;
+
+	for (;;)
+	{
+		size_t next;
+
+		pthread_mutex_lock(&pool->lock);
+		next = pool->next++;
+		pthread_mutex_unlock(&pool->lock);
+
+		if (next >= pool->jobs->size())
+			return NULL;
+
+		run(*pool, *(*pool->jobs)[next]);
+	}
+}
+
+/* Lines of a hash and the output it was generated to. */
+static void load_cache(const string & path, map<string, string> & cache)
+{
+	ifstream file(path.c_str());
+	string hash, output;
+
+	while (file >> hash && getline(file >> ws, output))
+		cache[output] = hash;
+}
+
+/* Through a temporary file, an interrupted run leaving the last cache. */
+static bool save_cache(const string & path, const vector<job *> & jobs)
+{
+	const string temporary = path + ".tmp";
+	ofstream file(temporary.c_str());
+
+	for (size_t i = 0; i < jobs.size(); i++)
+		if (jobs[i]->done && !jobs[i]->hash.empty())
+			file << jobs[i]->hash << " " << jobs[i]->output << "\n";
+
+	file.close();
+	if (!file || rename(temporary.c_str(), path.c_str()) != 0)
+	{
+		cout << path << ": cannot write the cache" << endl;
+		return false;
+	}
+
+	return true;
+}
+
+bool batch_run(arguments & args, int argc, char * const * argv)
+{
+	const string directory = args.op_out() ? args.op_out() : ".";
+	const char * pack = args.op_pack();
+	string cache_path;
+	vector<vector<string> > lines;
+	vector<job *> jobs;
+	map<string, string> outputs, cache;
+	vector<pthread_t> workers;
+	asset_pack_writer previous;
+	struct pool pool;
+	struct stat info;
+	size_t converted = 0, unchanged = 0, failed = 0;
+	long threads;
+	bool ok = true;
+
+	if (stat(args.op_filename(), &info) != 0)
+	{
+		cout << args.op_filename() << ": no such manifest or directory" << endl;
+		return false;
+	}
+	if (S_ISDIR(info.st_mode) ? !list_directory(args.op_filename(), lines) : !read_manifest(args.op_filename(), lines))
+		return false;
+
+	if (!pack && mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST)
+	{
+		cout << directory << ": cannot create the directory" << endl;
+		return false;
+	}
+
+	if (args.op_cache())
+		cache_path = args.op_cache();
+	else if (pack)
+		cache_path = string(pack) + ".cache";
+	else
+		cache_path = directory + "/image_processor.cache";
+
+	/* The command line but the program and the batch input, then the line's options. */
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		job * added = new job;
+
+		added->input = lines[i][0];
+		added->words.push_back(argv[0]);
+		added->words.push_back(lines[i][0]);
+		for (int arg = 1; arg < argc; arg++)
+			if (argv[arg] != args.op_filename())
+				added->words.push_back(argv[arg]);
+		added->words.insert(added->words.end(), lines[i].begin() + 1, lines[i].end());
+
+		for (size_t word = 0; word < added->words.size(); word++)
+			added->argv.push_back(&added->words[word][0]);
+		added->argv.push_back(NULL);
+
+		added->args = new arguments(added->argv.size() - 1, &added->argv[0]);
+		added->name = pack ? asset_name(*added->args) : c_name(asset_name(*added->args));
+		added->output = pack ? string(pack) + ":" + added->name : convert_output(*added->args, added->name, directory);
+		added->skipped = false;
+		added->done = false;
+		jobs.push_back(added);
+
+		if (outputs.count(added->output))
+		{
+			cout << outputs[added->output] << " and " << added->input << " both generate " << added->output << endl;
+			ok = false;
+		}
+		outputs[added->output] = added->input;
+	}
+
+	if (ok)
+	{
+		load_cache(cache_path, cache);
+		if (pack && !previous.load(pack))
+		{
+			cout << pack << ": converting every asset again" << endl;
+			previous = asset_pack_writer();
+		}
+
+		pool.jobs = &jobs;
+		pool.next = 0;
+		pthread_mutex_init(&pool.lock, NULL);
+		pool.cache = &cache;
+		pool.directory = directory;
+		pool.packed = pack != NULL;
+		pool.previous = &previous;
+
+		threads = args.op_jobs() > 0 ? args.op_jobs() : sysconf(_SC_NPROCESSORS_ONLN);
+		threads = max(1L, min(threads, (long)jobs.size()));
+
+		/* This thread being the last worker. */
+		workers.resize(threads - 1);
+		for (size_t i = 0; i < workers.size(); i++)
+		{
+			if (pthread_create(&workers[i], NULL, work, &pool) != 0)
+			{
+				workers.resize(i);
+				break;
+			}
+		}
+		work(&pool);
+		for (size_t i = 0; i < workers.size(); i++)
+			pthread_join(workers[i], NULL);
+		pthread_mutex_destroy(&pool.lock);
+
+		for (size_t i = 0; i < jobs.size(); i++)
+		{
+			if (!jobs[i]->done)
+			{
+				cout << jobs[i]->input << ": failed" << endl;
+				failed++;
+			}
+			else if (jobs[i]->skipped)
+				unchanged++;
+			else
+				converted++;
+		}
+
+		/* Built again from the jobs, assets no line generates any more leaving the pack. */
+		if (pack && (converted || failed || cache.size() != unchanged))
+		{
+			asset_pack_writer merged;
+
+			for (size_t i = 0; i < jobs.size(); i++)
+			{
+				if (jobs[i]->skipped)
+					merged.merge(previous, jobs[i]->name);
+				else if (jobs[i]->done)
+					merged.merge(jobs[i]->pack);
+			}
+			ok = merged.write(pack);
+		}
+
+		if (ok && (converted || failed || cache.size() != unchanged))
+			ok = save_cache(cache_path, jobs);
+
+		cout << converted << " converted, " << unchanged << " unchanged, " << failed << " failed" << endl;
+	}
+
+	for (size_t i = 0; i < jobs.size(); i++)
+	{
+		delete jobs[i]->args;
+		delete jobs[i];
+	}
+
+	return ok && !failed;
+}
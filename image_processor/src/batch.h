@@ -0,0 +1,26 @@
+/*
+ * batch.h
+ *
+ *  -batch: the images of a manifest or a directory converted on a pool of
+ *  threads. A manifest line is a path, relative to the manifest, and options
+ *  added to the command line's for that image, # starting a comment:
+ *
+ *      icons/wifi.png -icon -alpha -rle
+ *      photos/lena.jpg -indexed 64 -dither -name lena
+ *
+ *  A cache file keeps a hash of each input's bytes and options. Jobs whose hash
+ *  is the same and whose output is there are skipped, so a run over unchanged
+ *  assets only reads them. With -pack the pack is built again from the lines,
+ *  skipped jobs keeping their assets of the last run and assets no line generates
+ *  any more leaving it.
+ */
+
+#ifndef BATCH_H_
+#define BATCH_H_
+
+class arguments;
+
+/* argv is the command line args was parsed from, its options apply to every image. */
+bool batch_run(arguments & args, int argc, char * const * argv);
+
+#endif /* BATCH_H_ */
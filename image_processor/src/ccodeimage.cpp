@@ -6,13 +6,46 @@
  */
 
 #include "ccodeimage.h"
+#include "asset_pack.h"
 #include "image.h"
+#include "quantizer.h"
 #include <CImg.h>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <iostream>
+#include <vector>
 
 using namespace std;
 using namespace cimg_library;
 
+/* "0x", digits upper case hex digits of value and ", ", snprintf's "0x%0*X, " without
+ * its parsing, rows being built in a string and written at once. */
+static void append_hex(string & row, unsigned value, int digits)
+{
+	static const char hex[] = "0123456789ABCDEF";
+	char text[16] = {'0', 'x'};
+
+	for (int i = 0; i < digits; i++)
+		text[2 + i] = hex[value >> (4 * (digits - 1 - i)) & 0x0F];
+	text[2 + digits] = ',';
+	text[3 + digits] = ' ';
+	row.append(text, 4 + digits);
+}
+
+/* Closes the C file, false when it could not be written. */
+static bool close_code(ofstream & code, const char * path)
+{
+	code.close();
+	if (!code)
+	{
+		cout << "Can't write " << path << endl;
+		return false;
+	}
+
+	return true;
+}
+
 c_code_image::c_code_image(const image & image)
 {
 	processed_img = &image;
@@ -22,7 +55,25 @@ c_code_image::~c_code_image()
 {
 }
 
-void c_code_image::generate_icon(const char * filename, const char* path_to_output_c)
+/* Array rows of the first channel, ending the array. */
+static void write_alpha(ofstream & code, CImg<unsigned char> & img)
+{
+	string line;
+
+	for (int row = 0; row < img.height(); row ++)
+	{
+		line = "\n\t";
+
+		for (int col = 0; col < img.width(); col++)
+			append_hex(line, *img.data(col, row, 0, 0), 2);
+
+		code << line;
+	}
+
+	code << endl << "};" << endl << endl;
+}
+
+bool c_code_image::generate_icon(const char * filename, const char* path_to_output_c)
 {
 	ofstream code;
 	code.open(path_to_output_c);
@@ -32,62 +83,259 @@ void c_code_image::generate_icon(const char * filename, const char* path_to_outp
 
 	CImg<unsigned char> &img = processed_img->get_CImg();
 
+	write_alpha(code, img);
+
+	code << "const struct s_bitmap _" << filename << " =" << endl;
+	code << "{" << endl;
+	code << "\t_" <<  filename << "_data," << endl;
+	code << "\t" << img.width() << "," << endl;
+	code << "\t" << img.height() << "," << endl;
+	code << "\tTRUE," << endl;
+	code << "\tBITMAP_BUFFER_8BPP," << endl;
+	code << "\tNULL," << endl;
+	code << "};" << endl;
+
+	code << endl;
+
+	code << "const bitmap_t *"<< filename <<"_bitmap = &_" << filename << ";" << endl;
+
+	return close_code(code, path_to_output_c);
+}
+
+/* Runs as marsh/src/bitmap_data/bitmap_data.h reads them. */
+#define RLE_TRANSPARENT 0x00
+#define RLE_OPAQUE      0x40
+#define RLE_PARTIAL     0x80
+#define RLE_MAX_LENGTH  64
+
+static unsigned char rle_kind(unsigned char alpha)
+{
+	if (alpha == 0x00)
+		return RLE_TRANSPARENT;
+	if (alpha == 0xFF)
+		return RLE_OPAQUE;
+	return RLE_PARTIAL;
+}
+
+static void rle_encode_row(const unsigned char * alpha, int width, vector<unsigned char> & runs)
+{
+	unsigned char kind;
+	int start, length;
+
+	for (start = 0; start < width; start += length)
+	{
+		kind = rle_kind(alpha[start]);
+		for (length = 1; start + length < width && length < RLE_MAX_LENGTH && rle_kind(alpha[start + length]) == kind; length++)
+			;
+
+		runs.push_back(kind | (length - 1));
+		if (kind == RLE_PARTIAL)
+			runs.insert(runs.end(), alpha + start, alpha + start + length);
+	}
+}
+
+bool c_code_image::generate_icon_rle(const char * filename, const char* path_to_output_c)
+{
+	CImg<unsigned char> &img = processed_img->get_CImg();
+	vector<unsigned char> runs;
+	size_t encoded = 0;
+	ofstream code;
+
+	code.open(path_to_output_c);
+
+	code << "#include \"bitmap_data.h\"" << endl << endl;
+	code << "/* " << img.width() * img.height() << " bytes as 8BPP alpha. */" << endl;
+	code << "static const uint8_t _" << filename << "_data[] =" << endl << "{";
+
+	/* A line per row. */
 	for (int row = 0; row < img.height(); row ++)
 	{
-		code << endl << "\t";
+		string line = "\n\t";
 
-		for (int col = 0; col < img.width(); col++)
-		{
-			char ch[10];
-			snprintf(ch, 10, "0x%02X, ", *img.data(col, row, 0, 0));
-			code << ch;
-		}
+		runs.clear();
+		rle_encode_row(img.data(0, row, 0, 0), img.width(), runs);
+		encoded += runs.size();
+
+		for (size_t i = 0; i < runs.size(); i++)
+			append_hex(line, runs[i], 2);
+
+		code << line;
 	}
 
 	code << endl << "};" << endl << endl;
 
-	code << "const struct s_bitmap _" << filename << " =" << endl;
+	code << "static const struct s_bitmap _" << filename << " =" << endl;
 	code << "{" << endl;
 	code << "\t_" <<  filename << "_data," << endl;
 	code << "\t" << img.width() << "," << endl;
 	code << "\t" << img.height() << "," << endl;
-	code << "\tTRUE," << endl;
-	code << "\tBITMAP_BUFFER_8BPP," << endl;
+	code << "\ttrue," << endl;
+	code << "\tBITMAP_BUFFER_8BPP_RLE," << endl;
+	code << "\tNULL," << endl;
 	code << "};" << endl;
 
 	code << endl;
 
 	code << "const bitmap_t *"<< filename <<"_bitmap = &_" << filename << ";" << endl;
 
-	code.close();
+	if (!close_code(code, path_to_output_c))
+		return false;
+
+	cout << filename << ": " << encoded << " bytes, " << img.width() * img.height() << " uncompressed" << endl;
+
+	return true;
+}
+
+/* Same packing as marsh/src/pixel_format.h. */
+struct pixel_format
+{
+	const char * name;
+	const char * macro;
+	/* PIXEL_FORMAT_* value. */
+	int id;
+	int digits;
+	unsigned (*pack)(unsigned red, unsigned green, unsigned blue);
+};
+
+static unsigned pack_rgb565(unsigned red, unsigned green, unsigned blue)
+{
+	return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
+}
+
+static unsigned pack_rgb888(unsigned red, unsigned green, unsigned blue)
+{
+	return (red << 16) | (green << 8) | blue;
+}
+
+static unsigned pack_argb8888(unsigned red, unsigned green, unsigned blue)
+{
+	return 0xFF000000u | pack_rgb888(red, green, blue);
+}
+
+static unsigned pack_l8(unsigned red, unsigned green, unsigned blue)
+{
+	return (red * 77 + green * 150 + blue * 29) >> 8;
+}
+
+static unsigned pack_indexed8(unsigned red, unsigned green, unsigned blue)
+{
+	return (red & 0xE0) | ((green >> 3) & 0x1C) | (blue >> 6);
+}
+
+static const pixel_format pixel_formats[] =
+{
+	{"rgb565", "PIXEL_FORMAT_RGB565", 0, 4, pack_rgb565},
+	{"rgb888", "PIXEL_FORMAT_RGB888", 1, 8, pack_rgb888},
+	{"argb8888", "PIXEL_FORMAT_ARGB8888", 2, 8, pack_argb8888},
+	{"l8", "PIXEL_FORMAT_L8", 3, 2, pack_l8},
+	{"indexed8", "PIXEL_FORMAT_INDEXED8", 4, 2, pack_indexed8},
+};
+
+static const pixel_format * find_pixel_format(const char * format)
+{
+	for (size_t i = 0; i < sizeof(pixel_formats) / sizeof(pixel_formats[0]); i++)
+		if (strcmp(format, pixel_formats[i].name) == 0)
+			return &pixel_formats[i];
+
+	cout << "Unknown pixel format " << format << endl;
+	return NULL;
 }
 
-void c_code_image::generate_16bpp(const char* filename, const char* path_to_output_c)
+/* A pixel_t of the format in native order, for the packs of little endian targets. */
+static void append_pixel(vector<unsigned char> & out, const pixel_format * format, unsigned red, unsigned green, unsigned blue)
 {
+	const unsigned pixel = format->pack(red, green, blue);
+
+	for (int i = 0; i < format->digits / 2; i++)
+		out.push_back((unsigned char)(pixel >> (8 * i)));
+}
+
+bool c_code_image::generate_native(const char* filename, const char* path_to_output_c, const char * format)
+{
+	const pixel_format * selected = find_pixel_format(format);
+
+	if (!selected)
+		return false;
+
 	ofstream code;
 	code.open(path_to_output_c);
 
 	code << "#include \"bitmap_data.h\"" << endl << endl;
-	code << "static const uint16_t _" << filename << "_data[] =" << endl << "{";
+	code << "#if MARSH_PIXEL_FORMAT != " << selected->macro << endl;
+	code << "#error \"" << filename << " holds " << selected->name << " pixels, regenerate it for this MARSH_PIXEL_FORMAT\"" << endl;
+	code << "#endif" << endl << endl;
+	code << "static const pixel_t _" << filename << "_data[] =" << endl << "{";
 
 	CImg<unsigned char> &img = processed_img->get_CImg();
 
 	for (int row = 0; row < img.height(); row ++)
 	{
-		code << endl << "\t";
+		string line = "\n\t";
+
+		for (int col = 0; col < img.width(); col++)
+		{
+			unsigned char red = *img.data(col, row, 0, 0);
+			unsigned char green = *img.data(col, row, 0, 1);
+			unsigned char blue = *img.data(col, row, 0, 2);
+			append_hex(line, selected->pack(red, green, blue), selected->digits);
+		}
+
+		code << line;
+	}
+
+	code << endl << "};" << endl << endl;
+
+	code << "const struct s_bitmap _" << filename << " =" << endl;
+	code << "{" << endl;
+	code << "\t_" <<  filename << "_data," << endl;
+	code << "\t" << img.width() << "," << endl;
+	code << "\t" << img.height() << "," << endl;
+	code << "\tFALSE," << endl;
+	code << "\tBITMAP_BUFFER_NATIVE," << endl;
+	code << "\tNULL," << endl;
+	code << "};" << endl;
+
+	code << endl;
+
+	code << "const bitmap_t *"<< filename <<"_bitmap = &_" << filename << ";" << endl;
+
+	return close_code(code, path_to_output_c);
+}
+
+/* Array rows of RGB565 pixels, ending the array. */
+static void write_565(ofstream & code, CImg<unsigned char> & img)
+{
+	string line;
+
+	for (int row = 0; row < img.height(); row ++)
+	{
+		line = "\n\t";
 
 		for (int col = 0; col < img.width(); col++)
 		{
-			char ch[10];
 			unsigned char red = *img.data(col, row, 0, 0);
 			unsigned char green = *img.data(col, row, 0, 1);
 			unsigned char blue = *img.data(col, row, 0, 2);
-			snprintf(ch, 10, "0x%04X, ", (((red>>3)<<11) | ((green>>2)<<5) | ((blue)>>3)));
-			code << ch;
+			append_hex(line, pack_rgb565(red, green, blue), 4);
 		}
+
+		code << line;
 	}
 
 	code << endl << "};" << endl << endl;
+}
+
+bool c_code_image::generate_16bpp(const char* filename, const char* path_to_output_c)
+{
+	ofstream code;
+	code.open(path_to_output_c);
+
+	code << "#include \"bitmap_data.h\"" << endl << endl;
+	code << "static const uint16_t _" << filename << "_data[] =" << endl << "{";
+
+	CImg<unsigned char> &img = processed_img->get_CImg();
+
+	write_565(code, img);
 
 	code << "const struct s_bitmap _" << filename << " =" << endl;
 	code << "{" << endl;
@@ -96,11 +344,218 @@ void c_code_image::generate_16bpp(const char* filename, const char* path_to_outp
 	code << "\t" << img.height() << "," << endl;
 	code << "\tFALSE," << endl;
 	code << "\tBITMAP_BUFFER_16BPP," << endl;
+	code << "\tNULL," << endl;
 	code << "};" << endl;
 
 	code << endl;
 
 	code << "const bitmap_t *"<< filename <<"_bitmap = &_" << filename << ";" << endl;
 
-	code.close();
+	return close_code(code, path_to_output_c);
+}
+
+/* Palette and indices row after row, INDEXED4 rows two indices a byte, the first in
+ * the high nibble, and starting on a byte. */
+static bool quantize(CImg<unsigned char> & img, int colors, bool dither, vector<rgb> & palette, vector<unsigned char> & data)
+{
+	const int bits = colors <= 16 ? 4 : 8;
+	vector<rgb> pixels;
+
+	if (colors < 2 || colors > 256)
+	{
+		cout << "Indexed images take 2 to 256 colors" << endl;
+		return false;
+	}
+
+	for (int row = 0; row < img.height(); row ++)
+	{
+		for (int col = 0; col < img.width(); col++)
+		{
+			rgb pixel = {*img.data(col, row, 0, 0), *img.data(col, row, 0, 1), *img.data(col, row, 0, 2)};
+			pixels.push_back(pixel);
+		}
+	}
+
+	palette = quantize_median_cut(pixels, colors);
+	vector<unsigned char> indices = quantize_map(pixels, img.width(), img.height(), palette, dither);
+
+	data.clear();
+	for (int row = 0; row < img.height(); row ++)
+	{
+		for (int col = 0; col < img.width(); col += 8 / bits)
+		{
+			const unsigned char * index = &indices[row * img.width() + col];
+			data.push_back(bits == 8 ? index[0] : index[0] << 4 | (col + 1 < img.width() ? index[1] : 0));
+		}
+	}
+
+	return true;
+}
+
+bool c_code_image::generate_indexed(const char* filename, const char* path_to_output_c, int colors, bool dither)
+{
+	CImg<unsigned char> &img = processed_img->get_CImg();
+	const int bits = colors <= 16 ? 4 : 8;
+	const int palette_size = 1 << bits;
+	const int row_bytes = bits == 8 ? img.width() : (img.width() + 1) / 2;
+	vector<unsigned char> data;
+	vector<rgb> palette;
+
+	if (!quantize(img, colors, dither, palette, data))
+		return false;
+
+	ofstream code;
+	code.open(path_to_output_c);
+
+	code << "#include \"bitmap_data.h\"" << endl;
+	code << "#include \"pixel_format.h\"" << endl << endl;
+	code << "/* " << palette.size() << " colors by median cut" << (dither ? ", dithered" : "") << ". */" << endl;
+	code << "static const pixel_t _" << filename << "_palette[" << palette_size << "] =" << endl << "{";
+
+	for (size_t i = 0; i < palette.size(); i++)
+	{
+		char ch[40];
+		snprintf(ch, sizeof(ch), "PIXEL_PACK(0x%02X, 0x%02X, 0x%02X),", palette[i].red, palette[i].green, palette[i].blue);
+		code << (i % 4 ? " " : "\n\t") << ch;
+	}
+
+	code << endl << "};" << endl << endl;
+	code << "static const uint8_t _" << filename << "_data[] =" << endl << "{";
+
+	for (int row = 0; row < img.height(); row ++)
+	{
+		string line = "\n\t";
+
+		for (int col = 0; col < row_bytes; col++)
+			append_hex(line, data[row * row_bytes + col], 2);
+
+		code << line;
+	}
+
+	code << endl << "};" << endl << endl;
+
+	code << "static const struct s_bitmap _" << filename << " =" << endl;
+	code << "{" << endl;
+	code << "\t_" <<  filename << "_data," << endl;
+	code << "\t" << img.width() << "," << endl;
+	code << "\t" << img.height() << "," << endl;
+	code << "\tfalse," << endl;
+	code << "\tBITMAP_BUFFER_INDEXED" << bits << "," << endl;
+	code << "\t_" << filename << "_palette," << endl;
+	code << "};" << endl;
+
+	code << endl;
+
+	code << "const bitmap_t *"<< filename <<"_bitmap = &_" << filename << ";" << endl;
+
+	return close_code(code, path_to_output_c);
+}
+
+bool c_code_image::generate_levels(const char * filename, const char * path_to_output_c, vector<CImg<unsigned char> > & levels, bool icon)
+{
+	ofstream code;
+	code.open(path_to_output_c);
+
+	code << "#include \"bitmap_data.h\"" << endl << endl;
+	code << "/* " << levels.size() << " sizes by Lanczos-3, largest first. */" << endl << endl;
+
+	for (size_t i = 0; i < levels.size(); i++)
+	{
+		CImg<unsigned char> &img = levels[i];
+		char level[80];
+
+		snprintf(level, sizeof(level), "_%s_%dx%d", filename, img.width(), img.height());
+
+		code << "static const " << (icon ? "uint8_t " : "uint16_t ") << level << "_data[] =" << endl << "{";
+		if (icon)
+			write_alpha(code, img);
+		else
+			write_565(code, img);
+
+		code << "static const struct s_bitmap " << level << " =" << endl;
+		code << "{" << endl;
+		code << "\t" << level << "_data," << endl;
+		code << "\t" << img.width() << "," << endl;
+		code << "\t" << img.height() << "," << endl;
+		code << "\t" << (icon ? "true" : "false") << "," << endl;
+		code << "\t" << (icon ? "BITMAP_BUFFER_8BPP" : "BITMAP_BUFFER_16BPP") << "," << endl;
+		code << "\tNULL," << endl;
+		code << "};" << endl << endl;
+	}
+
+	code << "static const bitmap_t * const _" << filename << "_list[] =" << endl << "{" << endl;
+	for (size_t i = 0; i < levels.size(); i++)
+		code << "\t&_" << filename << "_" << levels[i].width() << "x" << levels[i].height() << "," << endl;
+	code << "};" << endl << endl;
+
+	code << "static const struct s_bitmap_levels _" << filename << " =" << endl;
+	code << "{" << endl;
+	code << "\t_" << filename << "_list," << endl;
+	code << "\t" << levels.size() << "," << endl;
+	code << "};" << endl;
+
+	code << endl;
+
+	code << "const bitmap_levels_t *" << filename << " = &_" << filename << ";" << endl;
+
+	return close_code(code, path_to_output_c);
+}
+
+void c_code_image::pack_icon(asset_pack_writer & pack, const char * name, bool rle)
+{
+	CImg<unsigned char> &img = processed_img->get_CImg();
+	vector<unsigned char> data;
+
+	for (int row = 0; row < img.height(); row ++)
+	{
+		if (rle)
+			rle_encode_row(img.data(0, row, 0, 0), img.width(), data);
+		else
+			data.insert(data.end(), img.data(0, row, 0, 0), img.data(0, row, 0, 0) + img.width());
+	}
+
+	pack.add_bitmap(name, rle ? PACK_8BPP_RLE : PACK_8BPP, PACK_ANY_FORMAT, true, img.width(), img.height(), data,
+			vector<unsigned char>());
+}
+
+bool c_code_image::pack_pixels(asset_pack_writer & pack, const char * name, const char * format)
+{
+	CImg<unsigned char> &img = processed_img->get_CImg();
+	const pixel_format * selected = find_pixel_format(format ? format : "rgb565");
+	vector<unsigned char> data;
+
+	if (!selected)
+		return false;
+
+	for (int row = 0; row < img.height(); row ++)
+		for (int col = 0; col < img.width(); col++)
+			append_pixel(data, selected, *img.data(col, row, 0, 0), *img.data(col, row, 0, 1), *img.data(col, row, 0, 2));
+
+	if (format)
+		pack.add_bitmap(name, PACK_NATIVE, selected->id, false, img.width(), img.height(), data, vector<unsigned char>());
+	else
+		pack.add_bitmap(name, PACK_16BPP, PACK_ANY_FORMAT, false, img.width(), img.height(), data, vector<unsigned char>());
+
+	return true;
+}
+
+bool c_code_image::pack_indexed(asset_pack_writer & pack, const char * name, int colors, bool dither, const char * format)
+{
+	CImg<unsigned char> &img = processed_img->get_CImg();
+	const pixel_format * selected = find_pixel_format(format ? format : "rgb565");
+	vector<unsigned char> data, packed_palette;
+	vector<rgb> palette;
+
+	if (!selected || !quantize(img, colors, dither, palette, data))
+		return false;
+
+	/* All 16 or 256 colors, the unused ones zero. */
+	for (size_t i = 0; i < palette.size(); i++)
+		append_pixel(packed_palette, selected, palette[i].red, palette[i].green, palette[i].blue);
+	packed_palette.resize((colors <= 16 ? 16 : 256) * (selected->digits / 2), 0);
+
+	pack.add_bitmap(name, colors <= 16 ? PACK_INDEXED4 : PACK_INDEXED8, selected->id, false, img.width(), img.height(), data,
+			packed_palette);
+
+	return true;
 }
@@ -8,7 +8,11 @@
 #ifndef CCODEIMAGE_H_
 #define CCODEIMAGE_H_
 
+#include <CImg.h>
+#include <vector>
+
 class image;
+class asset_pack_writer;
 
 class c_code_image
 {
@@ -16,8 +20,29 @@ public:
 	c_code_image(const image & rgb_image);
 	virtual ~c_code_image();
 
-	void generate_icon(const char * filename, const char * path_to_output);
-	void generate_16bpp(const char * filename, const char * path_to_output);
+	/* The generate_ writers return false when the options are bad or the C file
+	 * can't be written. */
+	bool generate_icon(const char * filename, const char * path_to_output);
+	/* Same alpha in transparent, opaque and partial runs, BITMAP_BUFFER_8BPP_RLE. */
+	bool generate_icon_rle(const char * filename, const char * path_to_output);
+	bool generate_16bpp(const char * filename, const char * path_to_output);
+	/* Pixels in a framebuffer format, rgb565, rgb888, argb8888, l8 or indexed8, for a
+	 * library built with the matching MARSH_PIXEL_FORMAT. */
+	bool generate_native(const char * filename, const char * path_to_output, const char * format);
+	/* Indices into a palette of colors, quantized by median cut, BITMAP_BUFFER_INDEXED4
+	 * up to 16 colors and INDEXED8 up to 256. The palette is packed by the library build
+	 * so the file suits any MARSH_PIXEL_FORMAT. */
+	bool generate_indexed(const char * filename, const char * path_to_output, int colors, bool dither);
+	/* The same picture at each size of levels, largest first, 8BPP alpha icons or 16BPP
+	 * images, and the bitmap_levels_t named filename listing them. */
+	bool generate_levels(const char * filename, const char * path_to_output,
+			std::vector<cimg_library::CImg<unsigned char> > & levels, bool icon);
+
+	/* The same into an asset pack, see asset_pack.h. Pixels and palettes are in format,
+	 * RGB565 without it, for a library built with the matching MARSH_PIXEL_FORMAT. */
+	void pack_icon(asset_pack_writer & pack, const char * name, bool rle);
+	bool pack_pixels(asset_pack_writer & pack, const char * name, const char * format);
+	bool pack_indexed(asset_pack_writer & pack, const char * name, int colors, bool dither, const char * format);
 
 private:
 	const image * processed_img;
@@ -0,0 +1,227 @@
+/*
+ * convert.cpp
+ *
+ *  The icon, indexed and 16bpp flows of image_processor.
+ */
+
+#include "convert.h"
+#include "arguments.h"
+#include "asset_pack.h"
+#include "font_source.h"
+#include "image.h"
+#include "ccodeimage.h"
+#include "resampler.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace cimg_library;
+
+static bool larger(const CImg<unsigned char> & a, const CImg<unsigned char> & b)
+{
+	return a.width() * a.height() > b.width() * b.height();
+}
+
+/* The picture at the sizes of -mip or -sizes, largest first. */
+static bool resize_levels(arguments & args, image & image, vector<CImg<unsigned char> > & levels)
+{
+	CImg<unsigned char> & source = image.get_CImg();
+	int width = source.width(), height = source.height();
+
+	if (args.op_mip())
+	{
+		for (;;)
+		{
+			levels.push_back(resample_lanczos(source, width, height));
+			if (width == 1 && height == 1)
+				break;
+			width = width > 1 ? width / 2 : 1;
+			height = height > 1 ? height / 2 : 1;
+		}
+		return true;
+	}
+
+	for (const char * size = args.op_sizes(); size; size = strchr(size, ','))
+	{
+		size += *size == ',';
+		if (sscanf(size, "%dx%d", &width, &height) != 2)
+		{
+			if (sscanf(size, "%d", &width) != 1)
+				break;
+			height = (source.height() * width + source.width() / 2) / source.width();
+		}
+		if (width < 1 || height < 1)
+			break;
+		levels.push_back(resample_lanczos(source, width, height));
+	}
+
+	if (levels.empty())
+	{
+		cout << "Bad size list " << args.op_sizes() << endl;
+		return false;
+	}
+
+	sort(levels.begin(), levels.end(), larger);
+
+	for (size_t i = 1; i < levels.size(); i++)
+		if (levels[i - 1].width() > 2 * levels[i].width() || levels[i - 1].height() > 2 * levels[i].height())
+			cout << "Warning: " << levels[i - 1].width() << "x" << levels[i - 1].height() << " is more than twice "
+					<< levels[i].width() << "x" << levels[i].height() << ", sizes between shrink it by more than 2x" << endl;
+
+	return true;
+}
+
+string asset_name(arguments & args)
+{
+	string name = args.op_filename();
+
+	if (args.op_name())
+		return args.op_name();
+
+	if (name.find_last_of('/') != string::npos)
+		name.erase(0, name.find_last_of('/') + 1);
+	if (name.find('.') != string::npos)
+		name.erase(name.find('.'));
+
+	return name;
+}
+
+/* Whether the options ask for sizes the flows below generate. */
+static bool levels(arguments & args)
+{
+	if (!args.op_mip() && !args.op_sizes())
+		return false;
+
+	return (args.op_alpha() && args.op_icon()) || (!args.op_indexed() && args.op_16bpp());
+}
+
+string convert_output(arguments & args, const string & name, const string & directory)
+{
+	string file = levels(args) ? name + "_levels.c" : name + ".c";
+
+	if (directory.empty())
+		return file;
+
+	return directory + "/" + file;
+}
+
+static bool pack_font(arguments & args, asset_pack_writer & pack)
+{
+	font_source font;
+
+	if (!font_source_load(args.op_filename(), font))
+		return false;
+
+	pack.add_font(args.op_name() ? args.op_name() : font.name.c_str(), font.row_bits == 16 ? PACK_FONT_16BITS : PACK_FONT_8BITS,
+			font.height, font.bitmap, font.index, font.widths);
+
+	return true;
+}
+
+bool convert(arguments & args, const string & name, const string & directory, asset_pack_writer * pack,
+		bool interactive)
+{
+	const string output = convert_output(args, name, directory);
+	const string symbol = levels(args) ? name + "_levels" : name;
+
+	if (pack && (args.op_mip() || args.op_sizes()))
+	{
+		cout << "-mip and -sizes don't take -pack" << endl;
+		return false;
+	}
+
+	if (args.op_font())
+	{
+		if (!pack)
+		{
+			cout << "-font takes -pack" << endl;
+			return false;
+		}
+		return pack_font(args, *pack);
+	}
+
+	if (!(args.op_alpha() && args.op_icon()) && !args.op_indexed() && !args.op_16bpp())
+	{
+		cout << args.op_filename() << ": nothing to generate, takes -icon -alpha, -indexed or -16bpp" << endl;
+		return false;
+	}
+
+	image image;
+
+	try
+	{
+		image.load(args.op_filename(), interactive);
+	}
+	catch (CImgException & e)
+	{
+		cout << args.op_filename() << ": " << e.what() << endl;
+		return false;
+	}
+
+	if (args.op_grayscale())
+	{
+		image.merge();
+	}
+
+	if (args.op_alpha() && args.op_icon())
+	{
+		if (interactive)
+			image.display("Original");
+		image.create_icon_from_alpha();
+		if (interactive)
+			image.display("Result");
+
+		c_code_image output_image(image);
+		if (pack)
+		{
+			output_image.pack_icon(*pack, name.c_str(), args.op_rle());
+			return true;
+		}
+		if (levels(args))
+		{
+			vector<CImg<unsigned char> > sizes;
+			if (!resize_levels(args, image, sizes))
+				return false;
+			return output_image.generate_levels(symbol.c_str(), output.c_str(), sizes, true);
+		}
+		if (args.op_rle())
+			return output_image.generate_icon_rle(symbol.c_str(), output.c_str());
+		return output_image.generate_icon(symbol.c_str(), output.c_str());
+	}
+
+	if (args.op_indexed())
+	{
+		if (interactive)
+			image.display("Result");
+
+		c_code_image output_image(image);
+		if (pack)
+			return output_image.pack_indexed(*pack, name.c_str(), args.op_indexed(), args.op_dither(), args.op_format());
+		return output_image.generate_indexed(symbol.c_str(), output.c_str(), args.op_indexed(), args.op_dither());
+	}
+
+	if (args.op_16bpp())
+	{
+		if (interactive)
+			image.display("Result");
+
+		c_code_image output_image(image);
+		if (pack)
+			return output_image.pack_pixels(*pack, name.c_str(), args.op_format());
+		if (levels(args))
+		{
+			vector<CImg<unsigned char> > sizes;
+			if (!resize_levels(args, image, sizes))
+				return false;
+			return output_image.generate_levels(symbol.c_str(), output.c_str(), sizes, false);
+		}
+		if (args.op_format())
+			return output_image.generate_native(symbol.c_str(), output.c_str(), args.op_format());
+		return output_image.generate_16bpp(symbol.c_str(), output.c_str());
+	}
+
+	return false;
+}
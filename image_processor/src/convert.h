@@ -0,0 +1,26 @@
+/*
+ * convert.h
+ *
+ *  One input to its C file or asset pack entry, as the options of args ask, for
+ *  single runs and batch jobs alike.
+ */
+
+#ifndef CONVERT_H_
+#define CONVERT_H_
+
+#include <string>
+
+class arguments;
+class asset_pack_writer;
+
+/* Converts the input of args to the C file convert_output names, or to pack when
+ * there is one. name is the C array or the asset name. interactive displays the
+ * picture and reports the steps, batch jobs run quiet on their threads. */
+bool convert(arguments & args, const std::string & name, const std::string & directory,
+		asset_pack_writer * pack, bool interactive);
+/* The C file convert writes in directory, the current one when empty. */
+std::string convert_output(arguments & args, const std::string & name, const std::string & directory);
+/* -name, or the input file name without directory and extension. */
+std::string asset_name(arguments & args);
+
+#endif /* CONVERT_H_ */
@@ -0,0 +1,184 @@
+/*
+ * font_source.cpp
+ *
+ *  C font arrays parsing, see font_source.h.
+ */
+
+#include "font_source.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+using namespace std;
+
+/* The source without its comments. */
+static string strip_comments(const string & source)
+{
+	string code;
+
+	for (size_t i = 0; i < source.size(); i++)
+	{
+		if (source.compare(i, 2, "/*") == 0)
+		{
+			i = source.find("*/", i + 2);
+			if (i == string::npos)
+				break;
+			i++;
+			code += ' ';
+		}
+		else if (source.compare(i, 2, "//") == 0)
+		{
+			i = source.find('\n', i);
+			if (i == string::npos)
+				break;
+			code += '\n';
+		}
+		else
+			code += source[i];
+	}
+
+	return code;
+}
+
+/* Comma separated values between the braces after the first "name[] =" or "name =". */
+static bool initializer(const string & code, const string & name, vector<string> & values)
+{
+	size_t at = 0, open, close;
+
+	for (;;)
+	{
+		at = code.find(name, at);
+		if (at == string::npos)
+			return false;
+		at += name.size();
+		if (code.find_first_not_of(" \t\r\n[]", at) != string::npos && code[code.find_first_not_of(" \t\r\n[]", at)] == '=')
+			break;
+	}
+
+	open = code.find('{', at);
+	close = code.find('}', open);
+	if (open == string::npos || close == string::npos)
+		return false;
+
+	values.clear();
+	for (size_t start = open + 1; start < close;)
+	{
+		size_t end = code.find(',', start);
+		if (end == string::npos || end > close)
+			end = close;
+
+		string value = code.substr(start, end - start);
+		value.erase(0, value.find_first_not_of(" \t\r\n"));
+		value.erase(value.find_last_not_of(" \t\r\n") + 1);
+		if (!value.empty())
+			values.push_back(value);
+		start = end + 1;
+	}
+
+	return true;
+}
+
+/* A number, or a byte drawn with _ and X. */
+static bool byte_value(const string & value, unsigned & byte)
+{
+	char * end;
+
+	if (value.size() == 8 && value.find_first_not_of("_X") == string::npos)
+	{
+		byte = 0;
+		for (size_t i = 0; i < 8; i++)
+			byte = byte << 1 | (value[i] == 'X');
+		return true;
+	}
+
+	byte = strtoul(value.c_str(), &end, 0);
+
+	return *end == '\0';
+}
+
+bool font_source_load(const char * path, font_source & font)
+{
+	ifstream file(path);
+	vector<string> fields, values;
+	unsigned value;
+	size_t at;
+
+	if (!file)
+	{
+		cout << "Can't read " << path << endl;
+		return false;
+	}
+
+	const string code = strip_comments(string(istreambuf_iterator<char>(file), istreambuf_iterator<char>()));
+
+	/* struct s_font name = {bitmap, index, width, height, layout}; */
+	at = code.find("struct s_font");
+	if (at == string::npos)
+	{
+		cout << "No struct s_font in " << path << endl;
+		return false;
+	}
+	at += strlen("struct s_font");
+	const size_t name_start = code.find_first_not_of(" \t\r\n", at);
+	const size_t name_end = code.find_first_of(" \t\r\n=", name_start);
+	const string data_name = code.substr(name_start, name_end - name_start);
+
+	if (!initializer(code, data_name, fields) || fields.size() != 5)
+	{
+		cout << "Unexpected struct s_font in " << path << endl;
+		return false;
+	}
+
+	/* font_t *name = &data_name; */
+	at = code.find("&" + data_name);
+	font.name = data_name;
+	if (at != string::npos)
+	{
+		const size_t equal = code.rfind('=', at), star = code.rfind('*', equal);
+		string variable = code.substr(star + 1, equal - star - 1);
+		variable.erase(0, variable.find_first_not_of(" \t\r\n"));
+		variable.erase(variable.find_last_not_of(" \t\r\n") + 1);
+		font.name = variable;
+	}
+
+	font.height = atoi(fields[3].c_str());
+	font.row_bits = fields[4] == "FONT_BUFFER_16BITS" ? 16 : 8;
+
+	font.bitmap.clear();
+	font.index.clear();
+	font.widths.clear();
+
+	if (!initializer(code, fields[0], values))
+		return false;
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		if (!byte_value(values[i], value))
+		{
+			cout << "Bad glyph byte " << values[i] << endl;
+			return false;
+		}
+		font.bitmap.push_back((unsigned char)value);
+	}
+
+	if (!initializer(code, fields[1], values))
+		return false;
+	for (size_t i = 0; i < values.size(); i++)
+		font.index.push_back((unsigned short)strtoul(values[i].c_str(), NULL, 0));
+
+	if (!initializer(code, fields[2], values))
+		return false;
+	for (size_t i = 0; i < values.size(); i++)
+		font.widths.push_back((unsigned char)strtoul(values[i].c_str(), NULL, 0));
+
+	if (font.index.size() != 256 || font.height <= 0)
+	{
+		cout << "Unexpected font in " << path << endl;
+		return false;
+	}
+
+	cout << font.name << ": " << font.widths.size() << " glyphs of " << font.height << " rows" << endl;
+
+	return true;
+}
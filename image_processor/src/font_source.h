@@ -0,0 +1,30 @@
+/*
+ * font_source.h
+ *
+ *  Reads back a font compiled in as C arrays, as marsh/src/font_data/ubuntu_16.c,
+ *  to move it into an asset pack.
+ */
+
+#ifndef FONT_SOURCE_H_
+#define FONT_SOURCE_H_
+
+#include <string>
+#include <vector>
+
+struct font_source
+{
+	/* The font_t variable. */
+	std::string name;
+	int height;
+	/* 8 or 16 bit glyph rows. */
+	int row_bits;
+	std::vector<unsigned char> bitmap;
+	std::vector<unsigned short> index;
+	std::vector<unsigned char> widths;
+};
+
+/* Takes the struct s_font initializer and the three arrays it names, bytes written as
+ * numbers or as the ____X__X names of font_data.h. */
+bool font_source_load(const char * path, font_source & font);
+
+#endif /* FONT_SOURCE_H_ */
@@ -16,6 +16,7 @@ using namespace std;
 image::image()
 {
 	img = NULL;
+	report = true;
 }
 
 image::~image()
@@ -23,9 +24,13 @@ image::~image()
 	if (img) delete img;
 }
 
-void image::load(const char* path_to_image)
+void image::load(const char* path_to_image, bool report)
 {
 	img = new CImg<unsigned char>(path_to_image);
+	this->report = report;
+
+	if (!report)
+		return;
 
 	cout << "Image Width: " << img->width() << endl;
 	cout << "Image Height: " << img->height() << endl;
@@ -50,7 +55,8 @@ void image::merge()
 {
 	if (img->depth() > 1)
 	{
-		cout << "Merging Channels..." << endl;
+		if (report)
+			cout << "Merging Channels..." << endl;
 		CImg<unsigned char> original_img(*img);
 		delete img;
 		img = new CImg<unsigned char>(original_img.width(), original_img.height(), 1, 1, 0);
@@ -62,7 +68,8 @@ void image::create_icon_from_alpha()
 {
 	check();
 
-	cout << "Getting Icon from Alpha Channel" << endl;
+	if (report)
+		cout << "Getting Icon from Alpha Channel" << endl;
 
 	CImg<unsigned char> white(img->width(),img->height(), 1, 1, 255);
 
@@ -15,7 +15,8 @@ class image
 public:
 	image();
 	virtual ~image();
-	void load(const char * path_to_image);
+	/* report prints the size and the steps, batch jobs run quiet. */
+	void load(const char * path_to_image, bool report = true);
 	void create_icon_from_alpha();
 	void display(const char * title = NULL);
 	void merge();
@@ -24,6 +25,7 @@ public:
 
 protected:
 	cimg_library::CImg<unsigned char> *img;
+	bool report;
 
 private:
 	void check();
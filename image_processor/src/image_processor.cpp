@@ -1,7 +1,11 @@
 #include "arguments.h"
-#include "image.h"
-#include "ccodeimage.h"
+#include "asset_pack.h"
+#include "batch.h"
+#include "convert.h"
 #include <cstdlib>
+#include <iostream>
+
+using namespace std;
 
 int main(int argc, char * const * argv)
 {
@@ -10,39 +14,28 @@ int main(int argc, char * const * argv)
 	if (!args.check())
 		exit(-1);
 
-	image image;
-	image.load(args.op_filename());
-
 	if (args.op_help())
 	{
 		args.print_help();
 		exit (0);
 	}
 
-	if (args.op_grayscale())
-	{
-		image.merge();
-	}
+	if (args.op_batch())
+		exit(batch_run(args, argc, argv) ? 0 : -1);
 
-	if (args.op_alpha() && args.op_icon())
+	if (args.op_pack())
 	{
-		image.display("Original");
-		image.create_icon_from_alpha();
-		image.display("Result");
-
-		c_code_image output(image);
-		output.generate_icon("wifi_icon", "wifi_icon.c");
-		exit (0);
+		asset_pack_writer pack;
+		if (!pack.load(args.op_pack()) || !convert(args, asset_name(args), "", &pack, true))
+			exit(-1);
+		exit(pack.write(args.op_pack()) ? 0 : -1);
 	}
 
-	if (args.op_16bpp())
+	if (args.op_font())
 	{
-		image.display("Result");
-
-		c_code_image output(image);
-		output.generate_16bpp("lena", "lena.c");
-		exit (0);
+		cout << "-font takes -pack" << endl;
+		exit(-1);
 	}
 
-	return 0;
+	exit(convert(args, args.op_alpha() && args.op_icon() ? "wifi_icon" : "lena", "", NULL, true) ? 0 : -1);
 }
@@ -0,0 +1,183 @@
+/*
+ * quantizer.cpp
+ *
+ *  Median cut palette and nearest color mapping, see quantizer.h.
+ */
+
+#include "quantizer.h"
+#include <algorithm>
+
+using namespace std;
+
+/* Pixels [begin, end) of the working copy. */
+struct box
+{
+	size_t begin;
+	size_t end;
+};
+
+static unsigned char channel(const rgb & pixel, int c)
+{
+	return c == 0 ? pixel.red : c == 1 ? pixel.green : pixel.blue;
+}
+
+struct channel_less
+{
+	int c;
+	channel_less(int c) : c(c) {}
+	bool operator()(const rgb & a, const rgb & b) const { return channel(a, c) < channel(b, c); }
+};
+
+/* Widest channel of a box, and its range. */
+static int widest_channel(const vector<rgb> & pixels, const box & b, int * range)
+{
+	unsigned char low[3] = {255, 255, 255}, high[3] = {0, 0, 0};
+	int widest = 0;
+
+	for (size_t i = b.begin; i < b.end; i++)
+	{
+		for (int c = 0; c < 3; c++)
+		{
+			low[c] = min(low[c], channel(pixels[i], c));
+			high[c] = max(high[c], channel(pixels[i], c));
+		}
+	}
+
+	for (int c = 1; c < 3; c++)
+		if (high[c] - low[c] > high[widest] - low[widest])
+			widest = c;
+
+	*range = high[widest] - low[widest];
+	return widest;
+}
+
+vector<rgb> quantize_median_cut(const vector<rgb> & pixels, size_t colors)
+{
+	vector<rgb> sorted(pixels);
+	vector<box> boxes;
+	vector<rgb> palette;
+	box whole = {0, sorted.size()};
+
+	if (sorted.empty() || colors == 0)
+		return palette;
+
+	boxes.push_back(whole);
+
+	while (boxes.size() < colors)
+	{
+		size_t split = boxes.size();
+		int split_channel = 0, split_range = 0, range, c;
+
+		/* The widest box of more than one pixel goes next. */
+		for (size_t i = 0; i < boxes.size(); i++)
+		{
+			if (boxes[i].end - boxes[i].begin < 2)
+				continue;
+			c = widest_channel(sorted, boxes[i], &range);
+			if (range > split_range)
+			{
+				split = i;
+				split_channel = c;
+				split_range = range;
+			}
+		}
+
+		/* Fewer distinct colors than asked for. */
+		if (split == boxes.size())
+			break;
+
+		box & b = boxes[split];
+		size_t median = b.begin + (b.end - b.begin) / 2;
+
+		nth_element(sorted.begin() + b.begin, sorted.begin() + median, sorted.begin() + b.end, channel_less(split_channel));
+
+		box upper = {median, b.end};
+		b.end = median;
+		boxes.push_back(upper);
+	}
+
+	for (size_t i = 0; i < boxes.size(); i++)
+	{
+		unsigned long sum[3] = {0, 0, 0};
+		size_t count = boxes[i].end - boxes[i].begin;
+
+		for (size_t j = boxes[i].begin; j < boxes[i].end; j++)
+			for (int c = 0; c < 3; c++)
+				sum[c] += channel(sorted[j], c);
+
+		rgb mean = {(unsigned char)((sum[0] + count / 2) / count), (unsigned char)((sum[1] + count / 2) / count),
+				(unsigned char)((sum[2] + count / 2) / count)};
+		palette.push_back(mean);
+	}
+
+	return palette;
+}
+
+static size_t nearest(const vector<rgb> & palette, int red, int green, int blue)
+{
+	size_t best = 0;
+	long best_distance = -1;
+
+	for (size_t i = 0; i < palette.size(); i++)
+	{
+		long dr = red - palette[i].red, dg = green - palette[i].green, db = blue - palette[i].blue;
+		long distance = dr * dr + dg * dg + db * db;
+
+		if (best_distance < 0 || distance < best_distance)
+		{
+			best = i;
+			best_distance = distance;
+		}
+	}
+
+	return best;
+}
+
+static int clamp(int value)
+{
+	return value < 0 ? 0 : value > 255 ? 255 : value;
+}
+
+vector<unsigned char> quantize_map(const vector<rgb> & pixels, int width, int height, const vector<rgb> & palette, bool dither)
+{
+	vector<unsigned char> indices(pixels.size());
+	/* Error carried to this row and the next, in 16ths, with a column of margin on
+	 * each side. */
+	vector<int> error(2 * 3 * (width + 2), 0);
+	int * current = &error[0], * next = &error[3 * (width + 2)];
+
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			const rgb & pixel = pixels[y * width + x];
+			int * carried = current + 3 * (x + 1);
+			int wanted[3] = {pixel.red, pixel.green, pixel.blue};
+
+			if (dither)
+				for (int c = 0; c < 3; c++)
+					wanted[c] = clamp(wanted[c] + carried[c] / 16);
+
+			size_t index = nearest(palette, wanted[0], wanted[1], wanted[2]);
+			indices[y * width + x] = (unsigned char)index;
+
+			if (!dither)
+				continue;
+
+			for (int c = 0; c < 3; c++)
+			{
+				int e = wanted[c] - channel(palette[index], c);
+
+				carried[3 + c] += e * 7;
+				next[3 * x + c] += e * 3;
+				next[3 * (x + 1) + c] += e * 5;
+				next[3 * (x + 2) + c] += e;
+			}
+		}
+
+		swap(current, next);
+		fill(next, next + 3 * (width + 2), 0);
+	}
+
+	return indices;
+}
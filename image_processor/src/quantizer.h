@@ -0,0 +1,30 @@
+/*
+ * quantizer.h
+ *
+ *  Reduces the colors of an image to a palette, for the indexed bitmaps of
+ *  marsh/src/bitmap_data/bitmap_data.h.
+ */
+
+#ifndef QUANTIZER_H_
+#define QUANTIZER_H_
+
+#include <cstddef>
+#include <vector>
+
+struct rgb
+{
+	unsigned char red;
+	unsigned char green;
+	unsigned char blue;
+};
+
+/* Median cut: the box of pixels with the widest channel is split at the median of
+ * that channel until there are colors boxes, each giving its mean color. */
+std::vector<rgb> quantize_median_cut(const std::vector<rgb> & pixels, size_t colors);
+
+/* Index of the nearest palette color of each pixel, row after row. With dither the
+ * error of each pixel is diffused to the next ones, Floyd-Steinberg. */
+std::vector<unsigned char> quantize_map(const std::vector<rgb> & pixels, int width, int height,
+		const std::vector<rgb> & palette, bool dither);
+
+#endif /* QUANTIZER_H_ */
@@ -0,0 +1,116 @@
+/*
+ * resampler.cpp
+ *
+ *  Separable Lanczos-3 resizing, see resampler.h.
+ */
+
+#include "resampler.h"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace cimg_library;
+
+#define LOBES 3
+
+static double sinc(double x)
+{
+	x *= M_PI;
+	return x == 0.0 ? 1.0 : sin(x) / x;
+}
+
+static double lanczos(double x)
+{
+	return fabs(x) < LOBES ? sinc(x) * sinc(x / LOBES) : 0.0;
+}
+
+/* Source pixels and their normalized weights for each destination pixel of a row or a
+ * column, the edge pixels repeating outward. */
+struct taps
+{
+	vector<int> first;
+	vector<int> count;
+	vector<int> pixels;
+	vector<double> weights;
+};
+
+static void filter_taps(int source_size, int size, taps & t)
+{
+	const double ratio = (double)source_size / size;
+	const double widen = ratio > 1.0 ? ratio : 1.0;
+	const double support = LOBES * widen;
+
+	for (int i = 0; i < size; i++)
+	{
+		const double center = (i + 0.5) * ratio - 0.5;
+		const int low = (int)ceil(center - support), high = (int)floor(center + support);
+		const size_t first = t.weights.size();
+		double sum = 0.0;
+
+		for (int j = low; j <= high; j++)
+		{
+			const double weight = lanczos((j - center) / widen);
+
+			if (weight == 0.0)
+				continue;
+
+			t.pixels.push_back(j < 0 ? 0 : j >= source_size ? source_size - 1 : j);
+			t.weights.push_back(weight);
+			sum += weight;
+		}
+
+		for (size_t k = first; k < t.weights.size(); k++)
+			t.weights[k] /= sum;
+
+		t.first.push_back((int)first);
+		t.count.push_back((int)(t.weights.size() - first));
+	}
+}
+
+static unsigned char clamp_channel(double value)
+{
+	return value <= 0.0 ? 0 : value >= 255.0 ? 255 : (unsigned char)(value + 0.5);
+}
+
+CImg<unsigned char> resample_lanczos(CImg<unsigned char> & source, int width, int height)
+{
+	const int source_width = source.width(), source_height = source.height(), channels = source.spectrum();
+	CImg<unsigned char> result(width, height, 1, channels, 0);
+	vector<double> rows((size_t)width * source_height);
+	taps horizontal, vertical;
+
+	filter_taps(source_width, width, horizontal);
+	filter_taps(source_height, height, vertical);
+
+	for (int c = 0; c < channels; c++)
+	{
+		/* Rows to the new width, kept unrounded for the columns. */
+		for (int y = 0; y < source_height; y++)
+		{
+			const unsigned char * line = source.data(0, y, 0, c);
+
+			for (int x = 0; x < width; x++)
+			{
+				double value = 0.0;
+
+				for (int k = horizontal.first[x]; k < horizontal.first[x] + horizontal.count[x]; k++)
+					value += line[horizontal.pixels[k]] * horizontal.weights[k];
+				rows[(size_t)y * width + x] = value;
+			}
+		}
+
+		for (int y = 0; y < height; y++)
+		{
+			for (int x = 0; x < width; x++)
+			{
+				double value = 0.0;
+
+				for (int k = vertical.first[y]; k < vertical.first[y] + vertical.count[y]; k++)
+					value += rows[(size_t)vertical.pixels[k] * width + x] * vertical.weights[k];
+				*result.data(x, y, 0, c) = clamp_channel(value);
+			}
+		}
+	}
+
+	return result;
+}
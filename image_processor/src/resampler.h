@@ -0,0 +1,18 @@
+/*
+ * resampler.h
+ *
+ *  Resizes images with a windowed sinc filter, for the size variants of
+ *  marsh/src/bitmap_data/bitmap_data.h.
+ */
+
+#ifndef RESAMPLER_H_
+#define RESAMPLER_H_
+
+#include <CImg.h>
+
+/* All channels of source resized to width by height, rows then columns, by Lanczos-3.
+ * Shrinking widens the filter by the ratio so every source pixel counts, the same
+ * size gives the source back. */
+cimg_library::CImg<unsigned char> resample_lanczos(cimg_library::CImg<unsigned char> & source, int width, int height);
+
+#endif /* RESAMPLER_H_ */
@@ -0,0 +1,60 @@
+ifeq (1,${V})
+	SILENT =
+else
+	SILENT = @  
+endif
+
+CC=gcc
+
+CFLAGS= -I src -I platform_src/benchmark \
+		-std=gnu99 -O2 -fno-strict-aliasing -c -Wall
+
+LDFLAGS= -O2 -lm -lpthread
+
+PROJECT = marsh_bench
+
+OBJDIR = obj_bench
+SRCFILES = platform_src/test_mocks/framebuffer.c
+SRCDIRS = \
+	platform_src/benchmark \
+	src \
+	src/helper \
+	src/font_data \
+	src/bitmap_data \
+
+
+get_src_from_dir  = $(wildcard $1/*.c)
+get_src_from_dir_list = $(foreach dir, $1, $(call get_src_from_dir,$(dir)))
+SRCS += $(call get_src_from_dir_list, $(SRCDIRS)) $(SRCFILES)
+
+src_to_o = $(addprefix $(OBJDIR)/,$(subst .c,.o,$1))
+OBJS = $(call src_to_o,$(SRCS))
+
+all: $(PROJECT)
+
+$(PROJECT): buildrepo $(OBJS)
+	@echo
+	@echo Linking $(PROJECT)
+	$(SILENT)$(CC) $(OBJS) $(LDFLAGS) -o $@
+
+$(OBJDIR)/%.o: %.c
+	@echo Compiling $(notdir $<)
+	$(SILENT)$(CC) $(CFLAGS) -c $< -o $@
+
+run: $(PROJECT)
+	./$(PROJECT)
+
+clean:
+	rm $(PROJECT) $(OBJDIR) -Rf
+
+buildrepo:
+	@$(call make-repo)
+
+# Create obj directory structure
+define make-repo
+	mkdir -p $(OBJDIR)
+	for dir in $(SRCDIRS) platform_src/test_mocks; \
+	do \
+		mkdir -p $(OBJDIR)/$$dir; \
+	done
+endef
@@ -35,6 +35,9 @@ CPPUTEST_CFLAGS += -g3
 CPPUTEST_CFLAGS += -O0 
 CPPUTEST_CPPFLAGS += -DSYSTEM_UNIT_TEST=1
 
+LD_LIBRARIES += -lm
+LD_LIBRARIES += -lpthread
+
 SRC_DIRS = \
 	src \
 	src/* \
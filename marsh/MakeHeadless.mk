@@ -0,0 +1,64 @@
+ifeq (1,${V})
+	SILENT =
+else
+	SILENT = @  
+endif
+
+CC=gcc
+
+# Native format of the framebuffer: RGB565, RGB888, ARGB8888, L8 or INDEXED8.
+PIXEL_FORMAT ?= RGB565
+
+CFLAGS= -I src -I platform_src/headless \
+		-DMARSH_PIXEL_FORMAT=PIXEL_FORMAT_$(PIXEL_FORMAT) \
+		-std=gnu99 -O2 -fno-strict-aliasing -c -Wall
+
+LDFLAGS= -O2 -lm -lpthread
+
+PROJECT = marsh_headless
+
+OBJDIR = obj_headless/$(PIXEL_FORMAT)
+SRCFILES =
+SRCDIRS = \
+	platform_src/headless \
+	src \
+	src/helper \
+	src/font_data \
+	src/bitmap_data \
+
+
+get_src_from_dir  = $(wildcard $1/*.c)
+get_src_from_dir_list = $(foreach dir, $1, $(call get_src_from_dir,$(dir)))
+SRCS += $(call get_src_from_dir_list, $(SRCDIRS)) $(SRCFILES)
+
+src_to_o = $(addprefix $(OBJDIR)/,$(subst .c,.o,$1))
+OBJS = $(call src_to_o,$(SRCS))
+
+all: $(PROJECT)
+
+$(PROJECT): buildrepo $(OBJS)
+	@echo
+	@echo Linking $(PROJECT)
+	$(SILENT)$(CC) $(OBJS) $(LDFLAGS) -o $@
+
+$(OBJDIR)/%.o: %.c
+	@echo Compiling $(notdir $<)
+	$(SILENT)$(CC) $(CFLAGS) -c $< -o $@
+
+run: $(PROJECT)
+	./$(PROJECT)
+
+clean:
+	rm $(PROJECT) obj_headless -Rf
+
+buildrepo:
+	@$(call make-repo)
+
+# Create obj directory structure
+define make-repo
+	mkdir -p $(OBJDIR)
+	for dir in $(SRCDIRS); \
+	do \
+		mkdir -p $(OBJDIR)/$$dir; \
+	done
+endef
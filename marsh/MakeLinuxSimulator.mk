@@ -7,7 +7,11 @@ endif
 CC=g++
 STRIP=strip
 
+# Native format of the framebuffer: RGB565, RGB888, ARGB8888, L8 or INDEXED8.
+PIXEL_FORMAT ?= RGB565
+
 CFLAGS= -I src  \
+		-DMARSH_PIXEL_FORMAT=PIXEL_FORMAT_$(PIXEL_FORMAT) \
 		`pkg-config gtkmm-3.0 --cflags --libs` \
 		-g -O0 -c -Wall
 		
@@ -17,7 +21,7 @@ LDFLAGS=-I src \
 
 PROJECT = marsh_simu
  
-OBJDIR = obj
+OBJDIR = obj/$(PIXEL_FORMAT)
 SRCFILES =
 SRCDIRS = \
 	platform_src/linux_simulator \
@@ -54,7 +58,7 @@ $(OBJDIR)/%.o: %.c
 	$(SILENT)$(CC) $(CFLAGS) -c $< -o $@
 
 clean:
-	rm $(PROJECT) $(OBJDIR) -Rf
+	rm $(PROJECT) obj -Rf
 
 printversions:
 	@echo FWVersion: ${FIRWMARE_VERSION}
@@ -0,0 +1,48 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <stdint.h>
+
+#include "types.h"
+
+uint64_t benchmark_now_ns(void);
+/* Prints the rate of units per second over elapsed_ns. */
+void benchmark_report(const char * name, uint64_t units, const char * unit_name, uint64_t elapsed_ns);
+
+/* The linux simulator start screen, built once at a time. */
+widget_t * benchmark_demo_scene_new(void);
+void benchmark_demo_scene_delete(void);
+
+void benchmark_path(void);
+void benchmark_command_queue(void);
+void benchmark_tile_renderer(void);
+void benchmark_parallel_draw(void);
+void benchmark_render_thread(void);
+void benchmark_pixel_convert(void);
+void benchmark_display_rotation(void);
+void benchmark_icon(void);
+void benchmark_indexed(void);
+void benchmark_scale(void);
+
+#endif /* BENCHMARK_H_ */
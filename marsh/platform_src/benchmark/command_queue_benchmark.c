@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "area.h"
+#include "canvas.h"
+#include "command_queue.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+
+#include "benchmark.h"
+
+#define FRAMES          500
+#define WIDGETS         48
+#define GLYPHS          24
+#define LAYOUT_ROUNDS   4000
+
+static const uint8_t glyph[16] = { 0x18, 0x3C, 0x66, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00 };
+
+/* Stands for the tree traversal and layout done between draws, work the queue
+ * overlaps with the pixels. */
+static uint32_t layout(uint32_t seed)
+{
+	int i;
+
+	for (i = 0; i < LAYOUT_ROUNDS; i++)
+		seed = seed * 1664525u + 1013904223u;
+
+	return seed;
+}
+
+/* Rows of labelled buttons, each a filled background and a run of glyphs. */
+static void frames(const char * name)
+{
+	volatile uint32_t seed = 1;
+	uint64_t start;
+	area_t area;
+	canvas_t * canv;
+	int frame, w, g;
+
+	start = benchmark_now_ns();
+
+	for (frame = 0; frame < FRAMES; frame++)
+	{
+		for (w = 0; w < WIDGETS; w++)
+		{
+			seed = layout(seed);
+
+			area_set(&area, (w % 3) * 260 + 10, (w / 3) * 29 + 5, 250, 26);
+			canv = canvas_new(&area);
+			draw_solid_rectangle(canv, (pixel_t)(frame + w));
+			for (g = 0; g < GLYPHS; g++)
+				draw_bitmap_1bpp(canv, 0xFFFF, glyph, 8 + g * 9, 5, 8, 16);
+			canvas_delete(canv);
+		}
+
+		framebuffer_inform_written_area(0, 0, framebuffer_width(), framebuffer_height());
+	}
+
+	benchmark_report(name, FRAMES, "frames", benchmark_now_ns() - start);
+}
+
+static void print_stats(enum e_command_queue_op op, const char * name)
+{
+	command_queue_stats_t stats;
+
+	command_queue_stats(op, &stats);
+	if (!stats.count)
+		return;
+
+	printf("  %-12s %8u commands, %7.0f ns busy, %7.0f ns latency on average, %llu ns max\n", name, stats.count,
+			(double)stats.busy_ns / stats.count, (double)stats.latency_ns / stats.count, (unsigned long long)stats.max_ns);
+}
+
+void benchmark_command_queue(void)
+{
+	frames("command queue off");
+
+	command_queue_start();
+	frames("command queue on");
+	print_stats(COMMAND_QUEUE_FILL_RECT, "fill");
+	print_stats(COMMAND_QUEUE_EXPAND_1BPP, "glyph");
+	command_queue_stop();
+}
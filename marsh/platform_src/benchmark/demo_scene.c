@@ -0,0 +1,142 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "event.h"
+#include "framebuffer.h"
+#include "icon.h"
+#include "image.h"
+#include "rectangle.h"
+#include "text.h"
+#include "widget.h"
+#include "bitmap_data/bitmaps.h"
+#include "font_data/fonts.h"
+#include "helper/my_string.h"
+
+#include "benchmark.h"
+
+/* The linux simulator start screen. */
+static struct
+{
+	widget_t * screen;
+	rectangle_t * rectangles[10];
+	icon_t * icons[3];
+	image_t * lena;
+	text_t * texts[3];
+} scene;
+
+static rectangle_t * rectangle(widget_t * parent, dim_t x, dim_t y, dim_t size, const char * fill, const char * border,
+		dim_t radius, dim_t thickness)
+{
+	rectangle_t * obj = rectangle_new(parent);
+
+	rectangle_set_position(obj, x, y);
+	rectangle_set_size(obj, size, size);
+	if (fill)
+		rectangle_set_fill_color_html(obj, fill);
+	if (border)
+		rectangle_set_border_color_html(obj, border);
+	if (radius)
+		rectangle_set_rounded_corner_radius(obj, radius);
+	if (thickness)
+		rectangle_set_border_tickness(obj, thickness);
+
+	return obj;
+}
+
+static icon_t * icon(dim_t x, dim_t y, const char * color)
+{
+	icon_t * obj = icon_new(scene.screen);
+
+	icon_set_color_html(obj, color);
+	icon_set_position(obj, x, y);
+	icon_set_bitmap(obj, wifi_icon_bitmap);
+
+	return obj;
+}
+
+static text_t * text(dim_t x, dim_t y, const char * color, enum e_text_justification justification)
+{
+	text_t * obj = text_new(scene.screen);
+
+	text_set_color_html(obj, color);
+	text_set_font(obj, ubuntu_monospace_16);
+	text_set_justification(obj, justification);
+	text_set_reference_position(obj, x, y);
+	my_string_set(text_get_string(obj), "Hello World!\nHow beautiful is it?");
+
+	return obj;
+}
+
+widget_t * benchmark_demo_scene_new(void)
+{
+	widget_t * bg;
+
+	event_pool_init();
+
+	scene.screen = widget_new(NULL, NULL, NULL, NULL);
+	widget_set_area(scene.screen, 0, 0, 800, 480);
+
+	scene.rectangles[0] = rectangle_new(scene.screen);
+	rectangle_set_fill_color_html(scene.rectangles[0], "#004000");
+	rectangle_set_position(scene.rectangles[0], 5, 5);
+	rectangle_set_size(scene.rectangles[0], 790, 470);
+	bg = rectangle_get_widget(scene.rectangles[0]);
+
+	scene.rectangles[1] = rectangle(bg, 0, 0, 100, "#800000", NULL, 0, 0);
+	scene.rectangles[2] = rectangle(bg, 50, 50, 100, "#008000", NULL, 0, 0);
+	scene.rectangles[3] = rectangle(bg, 100, 100, 100, "#000080", NULL, 0, 0);
+	scene.rectangles[4] = rectangle(bg, 210, 50, 100, "#808080", NULL, 20, 0);
+	scene.rectangles[5] = rectangle(bg, 320, 50, 100, "#808080", "#c0c0c0", 0, 0);
+	scene.rectangles[6] = rectangle(bg, 430, 50, 100, "#808080", "#c0c0c0", 13, 0);
+	scene.rectangles[7] = rectangle(bg, 540, 50, 100, NULL, "#c0c0c0", 0, 5);
+	scene.rectangles[8] = rectangle(bg, 650, 50, 100, NULL, "#c0c0c0", 13, 5);
+	scene.rectangles[9] = rectangle(scene.screen, 0, 300, 50, "#404040", "#FF4040", 0, 5);
+
+	scene.icons[0] = icon(10, 310, "#00FF00");
+	scene.icons[1] = icon(20, 320, "#00FFFF");
+	scene.icons[2] = icon(30, 330, "#FFFFFF");
+
+	scene.lena = image_new(scene.screen);
+	image_set_bitmap(scene.lena, lena_bitmap);
+	image_set_position(scene.lena, 120, 205);
+
+	scene.texts[0] = text(10, 400, "#C0C0C0", TEXT_LEFT_JUST);
+	scene.texts[1] = text(400, 400, "#D0D0D0", TEXT_CENTER_JUST);
+	scene.texts[2] = text(790, 400, "#E0E0E0", TEXT_RIGHT_JUST);
+
+	return scene.screen;
+}
+
+void benchmark_demo_scene_delete(void)
+{
+	size_t i;
+
+	for (i = 0; i < 3; i++)
+		text_delete(scene.texts[i]);
+	image_delete(scene.lena);
+	for (i = 0; i < 3; i++)
+		icon_delete(scene.icons[i]);
+	for (i = 10; i > 0; i--)
+		rectangle_delete(scene.rectangles[i - 1]);
+	widget_delete(scene.screen);
+
+	event_pool_deinit();
+}
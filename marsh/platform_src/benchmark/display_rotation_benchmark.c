@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "area.h"
+#include "display_rotation.h"
+#include "framebuffer.h"
+#include "framebuffer_geometry.h"
+
+#include "benchmark.h"
+
+#define FULL_FRAMES 300
+#define SMALL_UPDATES 100000
+
+/* Pixel by pixel along the logical rows, what the tiles are measured against. */
+static void rotate_90_unblocked(framebuffer_geometry_t * panel, const pixel_t * src, size_t src_stride, size_t width,
+		size_t height)
+{
+	size_t x, y;
+
+	for (y = 0; y < height; y++)
+		for (x = 0; x < width; x++)
+			panel->pixels[x * panel->stride + height - 1 - y] = src[y * src_stride + x];
+}
+
+/* Presents of the whole framebuffer and of a 64x32 update onto a panel turned each
+ * way. */
+void benchmark_display_rotation(void)
+{
+	static const char * names[] = {"0", "90", "180", "270"};
+	size_t width = framebuffer_width(), height = framebuffer_height(), panel_width, panel_height;
+	framebuffer_geometry_t logical, panel = {0, };
+	enum e_display_rotation rotation;
+	area_t update, presented;
+	char name[64];
+	uint64_t start;
+	int i;
+
+	/* The framebuffer seen as a geometry, presented from in place. */
+	logical.width = width;
+	logical.height = height;
+	logical.stride = framebuffer_stride();
+	logical.area = *framebuffer_area();
+	logical.pixels = framebuffer_start();
+	logical.block = NULL;
+	area_set(&update, 300, 100, 64, 32);
+
+	for (rotation = DISPLAY_ROTATION_0; rotation <= DISPLAY_ROTATION_270; rotation = (enum e_display_rotation)(rotation + 1))
+	{
+		display_rotation_panel_size(rotation, width, height, &panel_width, &panel_height);
+		if (!framebuffer_geometry_init(&panel, panel_width, panel_height))
+			break;
+
+		start = benchmark_now_ns();
+		for (i = 0; i < FULL_FRAMES; i++)
+			display_rotation_present(rotation, &panel, &logical, &logical.area, &presented);
+		snprintf(name, sizeof(name), "rotate %s full", names[rotation]);
+		benchmark_report(name, FULL_FRAMES, "frames", benchmark_now_ns() - start);
+
+		start = benchmark_now_ns();
+		for (i = 0; i < SMALL_UPDATES; i++)
+			display_rotation_present(rotation, &panel, &logical, &update, &presented);
+		snprintf(name, sizeof(name), "rotate %s 64x32", names[rotation]);
+		benchmark_report(name, SMALL_UPDATES, "updates", benchmark_now_ns() - start);
+
+		if (rotation != DISPLAY_ROTATION_90)
+			continue;
+
+		start = benchmark_now_ns();
+		for (i = 0; i < FULL_FRAMES; i++)
+			rotate_90_unblocked(&panel, logical.pixels, logical.stride, width, height);
+		benchmark_report("rotate 90 full unblocked", FULL_FRAMES, "frames", benchmark_now_ns() - start);
+	}
+
+	framebuffer_geometry_deinit(&panel);
+}
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "area.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "bitmap_data/bitmap_data.h"
+#include "bitmap_data/bitmaps.h"
+
+#include "benchmark.h"
+
+#define DRAWS 100000
+
+/* The wifi icon drawn from its 8BPP alpha and from its runs. */
+void benchmark_icon(void)
+{
+	area_t area;
+	canvas_t * canv;
+	uint64_t start;
+	int i;
+
+	area_set(&area, 100, 100, (dim_t)wifi_icon_bitmap->width, (dim_t)wifi_icon_bitmap->height);
+	canv = canvas_new(&area);
+
+	start = benchmark_now_ns();
+	for (i = 0; i < DRAWS; i++)
+		draw_alpha_bitmap_8bpp(canv, 0xFFFF, (BUFFER_PTR_RDOLY)wifi_icon_bitmap->bitmap, 0, 0,
+				wifi_icon_bitmap->width, wifi_icon_bitmap->height);
+	framebuffer_ops_sync();
+	benchmark_report("icon 8bpp", DRAWS, "draws", benchmark_now_ns() - start);
+
+	start = benchmark_now_ns();
+	for (i = 0; i < DRAWS; i++)
+		draw_alpha_bitmap_8bpp_rle(canv, 0xFFFF, (BUFFER_PTR_RDOLY)wifi_icon_rle_bitmap->bitmap, 0, 0,
+				wifi_icon_rle_bitmap->width, wifi_icon_rle_bitmap->height);
+	framebuffer_ops_sync();
+	benchmark_report("icon 8bpp rle", DRAWS, "draws", benchmark_now_ns() - start);
+
+	canvas_delete(canv);
+}
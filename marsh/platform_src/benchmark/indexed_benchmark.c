@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "area.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "pixel_convert.h"
+#include "bitmap_data/bitmap_data.h"
+#include "bitmap_data/bitmaps.h"
+
+#include "benchmark.h"
+
+#define DRAWS 2000
+
+static void draw_lena(const char * name, canvas_t * canv, const bitmap_t * bitmap)
+{
+	uint64_t start;
+	int i;
+
+	start = benchmark_now_ns();
+	for (i = 0; i < DRAWS; i++)
+	{
+		if (bitmap->bitmap_data_width == BITMAP_BUFFER_16BPP)
+			draw_bitmap(canv, (BUFFER_PTR_RDOLY)bitmap->bitmap, 0, 0, bitmap->width, bitmap->height);
+		else
+			draw_bitmap_indexed(canv, (BUFFER_PTR_RDOLY)bitmap->bitmap, bitmap->bitmap_data_width == BITMAP_BUFFER_INDEXED4 ? 4 : 8,
+					bitmap->palette, 0, 0, bitmap->width, bitmap->height);
+	}
+	framebuffer_ops_sync();
+	benchmark_report(name, (uint64_t)DRAWS * bitmap->width * bitmap->height, "pixels", benchmark_now_ns() - start);
+}
+
+/* Lena from its pixels, from 8 bit indices and from 4 bit ones, with and without the
+ * shuffle kernel. */
+void benchmark_indexed(void)
+{
+	enum e_pixel_convert_isa isa = pixel_convert_isa();
+	area_t area;
+	canvas_t * canv;
+
+	area_set(&area, 100, 100, (dim_t)lena_bitmap->width, (dim_t)lena_bitmap->height);
+	canv = canvas_new(&area);
+
+	draw_lena("lena 16bpp", canv, lena_bitmap);
+	draw_lena("lena indexed8", canv, lena_indexed8_bitmap);
+
+	pixel_convert_set_isa(PIXEL_CONVERT_SCALAR);
+	draw_lena("lena indexed4 scalar", canv, lena_indexed4_bitmap);
+	if (pixel_convert_set_isa(isa) != PIXEL_CONVERT_SCALAR)
+		draw_lena("lena indexed4 ssse3", canv, lena_indexed4_bitmap);
+
+	canvas_delete(canv);
+}
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "framebuffer.h"
+#include "framebuffer_geometry.h"
+
+#include "benchmark.h"
+
+struct s_benchmark
+{
+	const char * name;
+	void (*run)(void);
+};
+
+static const struct s_benchmark benchmarks[] =
+{
+	{"path", benchmark_path},
+	{"command_queue", benchmark_command_queue},
+	{"tile_renderer", benchmark_tile_renderer},
+	{"parallel_draw", benchmark_parallel_draw},
+	{"render_thread", benchmark_render_thread},
+	{"pixel_convert", benchmark_pixel_convert},
+	{"display_rotation", benchmark_display_rotation},
+	{"icon", benchmark_icon},
+	{"indexed", benchmark_indexed},
+	{"scale", benchmark_scale},
+};
+
+uint64_t benchmark_now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+void benchmark_report(const char * name, uint64_t units, const char * unit_name, uint64_t elapsed_ns)
+{
+	double seconds = (double)elapsed_ns / 1e9;
+
+	printf("%-32s %12.0f %s/s  (%llu %s in %.3f s)\n", name, seconds > 0 ? (double)units / seconds : 0.0, unit_name,
+			(unsigned long long)units, unit_name, seconds);
+}
+
+/* Runs every benchmark, or only the ones named on the command line, at the resolution
+ * MARSH_FRAMEBUFFER=WxH gives, 800x480 without it. */
+int main(int argc, char ** argv)
+{
+	const char * size = getenv("MARSH_FRAMEBUFFER");
+	size_t width, height;
+	size_t i;
+	int a;
+
+	if (size)
+	{
+		if (!framebuffer_geometry_parse(size, &width, &height))
+		{
+			printf("MARSH_FRAMEBUFFER=%s, expected WxH\n", size);
+			return 2;
+		}
+		framebuffer_configure(width, height);
+	}
+
+	framebuffer_init();
+	printf("%ux%u framebuffer, stride %u\n", (unsigned)framebuffer_width(), (unsigned)framebuffer_height(),
+			(unsigned)framebuffer_stride());
+
+	for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++)
+	{
+		for (a = 1; a < argc; a++)
+			if (!strcmp(argv[a], benchmarks[i].name))
+				break;
+
+		if (argc > 1 && a == argc)
+			continue;
+
+		benchmarks[i].run();
+	}
+
+	framebuffer_deinit();
+
+	return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "framebuffer.h"
+#include "parallel_draw.h"
+#include "widget.h"
+#include "widget_tree.h"
+
+#include "benchmark.h"
+
+#define FRAMES 300
+
+static void redraw(widget_t * screen, const char * name)
+{
+	parallel_draw_stats_t stats;
+	uint64_t start;
+	int frame;
+
+	parallel_draw_reset_stats();
+	start = benchmark_now_ns();
+
+	for (frame = 0; frame < FRAMES; frame++)
+	{
+		widget_tree_draw(screen);
+		framebuffer_inform_written_area(0, 0, framebuffer_width(), framebuffer_height());
+	}
+
+	benchmark_report(name, FRAMES, "frames", benchmark_now_ns() - start);
+
+	parallel_draw_stats(&stats);
+	if (stats.sections && stats.wall_ns)
+		printf("  %u batches per frame, widest %u, parallelism %.2f\n", stats.batches / FRAMES,
+				stats.widest, (double)stats.busy_ns / (double)stats.wall_ns);
+}
+
+/* Full screen redraws of the demo scene, serial and with sibling subtrees drawn
+ * concurrently from one thread up to the count of cores, checking the output stays
+ * the same. */
+void benchmark_parallel_draw(void)
+{
+	size_t size = framebuffer_stride() * framebuffer_height() * sizeof(pixel_t);
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+	widget_t * screen = benchmark_demo_scene_new();
+	pixel_t * reference = (pixel_t *)malloc(size);
+	char name[64];
+	size_t threads;
+
+	redraw(screen, "serial");
+	memcpy(reference, framebuffer_start(), size);
+
+	for (threads = 1; threads <= 16; threads *= 2)
+	{
+		if (threads > 4 && (long)threads > cores)
+			break;
+
+		memset(framebuffer_start(), 0, size);
+		parallel_draw_start(threads);
+		snprintf(name, sizeof(name), "parallel %u thread%s", (unsigned)threads, threads > 1 ? "s" : "");
+		redraw(screen, name);
+		parallel_draw_stop();
+
+		if (memcmp(reference, framebuffer_start(), size))
+			printf("  output differs from the serial drawing\n");
+	}
+
+	free(reference);
+	benchmark_demo_scene_delete();
+}
@@ -0,0 +1,116 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "area.h"
+#include "canvas.h"
+#include "framebuffer.h"
+#include "path_rasterizer.h"
+
+#include "benchmark.h"
+
+#define NEEDLE_FRAMES 20000
+#define CHART_FRAMES  2000
+#define CHART_POINTS  200
+
+/* Shape area in pixels, the count of pixels a fill writes. */
+static uint64_t polygon_pixels(const fixed_point_t * points, size_t count)
+{
+	int64_t area = 0;
+	size_t i;
+
+	for (i = 0; i < count; i++)
+		area += (int64_t)points[i].x * points[(i + 1) % count].y - (int64_t)points[(i + 1) % count].x * points[i].y;
+
+	return (uint64_t)llabs(area) / 2 / (PATH_FIXED_ONE * PATH_FIXED_ONE);
+}
+
+/* Tapered 100 pixels gauge needle sweeping around its hub. */
+static void needle(const canvas_t * canv, bool anti_alias, const char * name)
+{
+	fixed_point_t points[3];
+	uint64_t start, pixels = 0;
+	double angle, c, s;
+	int frame;
+
+	start = benchmark_now_ns();
+
+	for (frame = 0; frame < NEEDLE_FRAMES; frame++)
+	{
+		angle = frame * 0.01;
+		c = cos(angle);
+		s = sin(angle);
+
+		points[0].x = PATH_FIXED(120 + 100 * c);
+		points[0].y = PATH_FIXED(120 + 100 * s);
+		points[1].x = PATH_FIXED(120 - 6 * s);
+		points[1].y = PATH_FIXED(120 + 6 * c);
+		points[2].x = PATH_FIXED(120 + 6 * s);
+		points[2].y = PATH_FIXED(120 - 6 * c);
+
+		draw_polygon(canv, 0xF800, points, 3, FILL_NONZERO, anti_alias);
+		pixels += polygon_pixels(points, 3);
+	}
+
+	benchmark_report(name, pixels, "pixels", benchmark_now_ns() - start);
+}
+
+/* Filled trace of a 400x200 chart, closed along its bottom. */
+static void chart(const canvas_t * canv, bool anti_alias, const char * name)
+{
+	fixed_point_t points[CHART_POINTS + 2];
+	uint64_t start, pixels = 0;
+	int frame, i;
+
+	start = benchmark_now_ns();
+
+	for (frame = 0; frame < CHART_FRAMES; frame++)
+	{
+		for (i = 0; i < CHART_POINTS; i++)
+		{
+			points[i].x = PATH_FIXED(i * 2.0);
+			points[i].y = PATH_FIXED(100 + 80 * sin((i + frame) * 0.07) * cos((i - frame) * 0.013));
+		}
+		points[CHART_POINTS].x = PATH_FIXED(CHART_POINTS * 2 - 2);
+		points[CHART_POINTS].y = PATH_FIXED(200);
+		points[CHART_POINTS + 1].x = 0;
+		points[CHART_POINTS + 1].y = PATH_FIXED(200);
+
+		draw_polygon(canv, 0x07E0, points, CHART_POINTS + 2, FILL_NONZERO, anti_alias);
+		pixels += polygon_pixels(points, CHART_POINTS + 2);
+	}
+
+	benchmark_report(name, pixels, "pixels", benchmark_now_ns() - start);
+}
+
+void benchmark_path(void)
+{
+	canvas_t * canv = canvas_new_fullscreen();
+
+	needle(canv, false, "path needle");
+	needle(canv, true, "path needle anti-aliased");
+	chart(canv, false, "path chart polygon");
+	chart(canv, true, "path chart polygon anti-aliased");
+
+	canvas_delete(canv);
+}
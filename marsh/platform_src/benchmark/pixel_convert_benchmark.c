@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "framebuffer.h"
+#include "pixel_convert.h"
+
+#include "benchmark.h"
+
+#define FULL_FRAMES 300
+#define SMALL_UPDATES 100000
+
+/* Presents of the whole framebuffer and of a 64x32 update, as the simulator converts
+ * them, with every instruction set the CPU has. */
+void benchmark_pixel_convert(void)
+{
+	size_t width = framebuffer_width(), height = framebuffer_height(), stride = framebuffer_stride();
+	uint8_t * packed = (uint8_t *)malloc(width * height * 3);
+	uint32_t * words = (uint32_t *)malloc(width * height * sizeof(uint32_t));
+	enum e_pixel_convert_isa isa, widest = pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+	char name[64];
+	uint64_t start;
+	int i;
+
+	for (isa = PIXEL_CONVERT_SCALAR; isa <= widest; isa = (enum e_pixel_convert_isa)(isa + 1))
+	{
+		pixel_convert_set_isa(isa);
+
+		start = benchmark_now_ns();
+		for (i = 0; i < FULL_FRAMES; i++)
+			pixel_convert_565_to_888(packed, width * 3, framebuffer_start(), stride, (dim_t)width, (dim_t)height);
+		snprintf(name, sizeof(name), "888 full %s", pixel_convert_isa_name(isa));
+		benchmark_report(name, FULL_FRAMES, "frames", benchmark_now_ns() - start);
+
+		start = benchmark_now_ns();
+		for (i = 0; i < FULL_FRAMES; i++)
+			pixel_convert_565_to_x888(words, width * 4, framebuffer_start(), stride, (dim_t)width, (dim_t)height);
+		snprintf(name, sizeof(name), "x888 full %s", pixel_convert_isa_name(isa));
+		benchmark_report(name, FULL_FRAMES, "frames", benchmark_now_ns() - start);
+
+		start = benchmark_now_ns();
+		for (i = 0; i < SMALL_UPDATES; i++)
+			pixel_convert_565_to_x888(words + 100 * width + 300, width * 4, framebuffer_at(300, 100), stride,
+					64, 32);
+		snprintf(name, sizeof(name), "x888 64x32 %s", pixel_convert_isa_name(isa));
+		benchmark_report(name, SMALL_UPDATES, "updates", benchmark_now_ns() - start);
+	}
+
+	pixel_convert_set_isa(widest);
+	free(words);
+	free(packed);
+}
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "framebuffer.h"
+#include "render_thread.h"
+#include "widget.h"
+#include "widget_update.h"
+
+#include "benchmark.h"
+
+#define INPUTS 300
+/* Input handling, slot callbacks and layout, before the change is drawn. */
+#define LOGIC_NS 500000ULL
+
+static void logic(void)
+{
+	uint64_t start = benchmark_now_ns();
+
+	while (benchmark_now_ns() - start < LOGIC_NS)
+		;
+}
+
+/* Each input invalidates the whole scene, as a screen change would. */
+static void handle_input(widget_t * screen)
+{
+	logic();
+	widget_begin_update(screen);
+	widget_invalidate(screen);
+	widget_commit_update(screen);
+}
+
+static void report_latency(uint32_t inputs, uint64_t latency_ns, uint64_t max_latency_ns)
+{
+	if (!inputs)
+		return;
+
+	printf("  input to present %.3f ms average, %.3f ms max\n", (double)latency_ns / inputs / 1e6,
+			(double)max_latency_ns / 1e6);
+}
+
+/* Back to back inputs on the demo scene, drawn by the UI thread and then pipelined
+ * with the render thread. */
+void benchmark_render_thread(void)
+{
+	widget_t * screen = benchmark_demo_scene_new();
+	render_thread_stats_t stats;
+	uint64_t start, stamp, latency, latency_ns = 0, max_latency_ns = 0;
+	int input;
+
+	start = benchmark_now_ns();
+
+	for (input = 0; input < INPUTS; input++)
+	{
+		stamp = benchmark_now_ns();
+		handle_input(screen);
+
+		latency = benchmark_now_ns() - stamp;
+		latency_ns += latency;
+		if (latency > max_latency_ns)
+			max_latency_ns = latency;
+	}
+
+	benchmark_report("serial", INPUTS, "inputs", benchmark_now_ns() - start);
+	report_latency(INPUTS, latency_ns, max_latency_ns);
+
+	render_thread_start();
+	start = benchmark_now_ns();
+
+	for (input = 0; input < INPUTS; input++)
+	{
+		render_thread_mark_input(benchmark_now_ns());
+		handle_input(screen);
+		render_thread_publish();
+	}
+
+	render_thread_flush();
+	benchmark_report("render thread", INPUTS, "inputs", benchmark_now_ns() - start);
+
+	render_thread_stats(&stats);
+	report_latency(stats.inputs, stats.latency_ns, stats.max_latency_ns);
+	printf("  %u frames presented, %u merged, record %.3f ms, render %.3f ms per frame\n", stats.presented,
+			stats.reclaimed, (double)stats.record_ns / stats.published / 1e6,
+			(double)stats.render_ns / stats.presented / 1e6);
+	render_thread_stop();
+
+	benchmark_demo_scene_delete();
+}
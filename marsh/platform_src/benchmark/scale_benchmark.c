@@ -0,0 +1,102 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "area.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "pixel_convert.h"
+#include "pixel_format.h"
+#include "scale.h"
+#include "bitmap_data/bitmap_data.h"
+#include "bitmap_data/bitmaps.h"
+
+#include "benchmark.h"
+
+#define DRAWS 500
+
+static void draw_scaled(const char * name, canvas_t * canv, const bitmap_t * bitmap, dim_t width, dim_t height, enum e_scale_filter filter)
+{
+	uint64_t start;
+	int i;
+
+	start = benchmark_now_ns();
+	for (i = 0; i < DRAWS; i++)
+		draw_bitmap_scaled(canv, bitmap, PIXEL_PACK(0xFF, 0xFF, 0xFF), 0, 0, width, height, filter);
+	framebuffer_ops_sync();
+	benchmark_report(name, (uint64_t)DRAWS * width * height, "pixels", benchmark_now_ns() - start);
+}
+
+/* The level covering the size, blitted when it is the size. */
+static void draw_level(const char * name, canvas_t * canv, bitmap_levels_t * levels, dim_t width, dim_t height)
+{
+	bitmap_t * level = scale_pick_level(levels, width, height);
+	uint64_t start;
+	int i;
+
+	start = benchmark_now_ns();
+	for (i = 0; i < DRAWS; i++)
+	{
+		if ((dim_t)level->width == width && (dim_t)level->height == height)
+			draw_bitmap(canv, (BUFFER_PTR_RDOLY)level->bitmap, 0, 0, level->width, level->height);
+		else
+			draw_bitmap_scaled(canv, level, 0, 0, 0, width, height, SCALE_BILINEAR);
+	}
+	framebuffer_ops_sync();
+	benchmark_report(name, (uint64_t)DRAWS * width * height, "pixels", benchmark_now_ns() - start);
+}
+
+/* Lena shrunk and magnified with each filter, the bilinear vertical pass with and
+ * without SSE2, and small sizes from the full picture or from its levels. */
+void benchmark_scale(void)
+{
+	enum e_pixel_convert_isa isa = pixel_convert_isa();
+	canvas_t * canv;
+	area_t area;
+
+	area_set(&area, 0, 0, 720, 480);
+	canv = canvas_new(&area);
+
+	draw_scaled("lena 181x181 nearest", canv, lena_bitmap, 181, 181, SCALE_NEAREST);
+	draw_scaled("lena 720x480 nearest", canv, lena_bitmap, 720, 480, SCALE_NEAREST);
+	draw_scaled("lena indexed4 720x480 nearest", canv, lena_indexed4_bitmap, 720, 480, SCALE_NEAREST);
+
+	pixel_convert_set_isa(PIXEL_CONVERT_SCALAR);
+	draw_scaled("lena 181x181 bilinear scalar", canv, lena_bitmap, 181, 181, SCALE_BILINEAR);
+	draw_scaled("lena 720x480 bilinear scalar", canv, lena_bitmap, 720, 480, SCALE_BILINEAR);
+	draw_scaled("icon 240x240 bilinear scalar", canv, wifi_icon_bitmap, 240, 240, SCALE_BILINEAR);
+	if (pixel_convert_set_isa(isa) != PIXEL_CONVERT_SCALAR)
+	{
+		draw_scaled("lena 181x181 bilinear sse2", canv, lena_bitmap, 181, 181, SCALE_BILINEAR);
+		draw_scaled("lena 720x480 bilinear sse2", canv, lena_bitmap, 720, 480, SCALE_BILINEAR);
+		draw_scaled("icon 240x240 bilinear sse2", canv, wifi_icon_bitmap, 240, 240, SCALE_BILINEAR);
+	}
+	draw_scaled("lena indexed4 720x480 bilinear", canv, lena_indexed4_bitmap, 720, 480, SCALE_BILINEAR);
+
+	draw_scaled("lena 64x64 bilinear", canv, lena_bitmap, 64, 64, SCALE_BILINEAR);
+	draw_level("lena 64x64 level", canv, lena_levels, 64, 64);
+	draw_scaled("lena 48x48 bilinear", canv, lena_bitmap, 48, 48, SCALE_BILINEAR);
+	draw_level("lena 48x48 from level", canv, lena_levels, 48, 48);
+
+	canvas_delete(canv);
+}
@@ -0,0 +1,263 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "display_rotation.h"
+#include "framebuffer.h"
+#include "framebuffer_geometry.h"
+
+#include "headless.h"
+
+static struct
+{
+	/* Applied on framebuffer_init. */
+	size_t configured_width;
+	size_t configured_height;
+	framebuffer_geometry_t geometry;
+	/* Rotated copy of the written areas, when the panel is not in the logical orientation. */
+	enum e_display_rotation rotation;
+	framebuffer_geometry_t panel;
+
+	enum e_headless_dump dump;
+	char directory[256];
+	FILE * damage_log;
+
+	char name[64];
+	unsigned frame;
+
+	uint64_t present_ns;
+	uint64_t dump_ns;
+	uint32_t damage_count;
+} headless;
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+bool framebuffer_configure(size_t width, size_t height)
+{
+	if (!framebuffer_geometry_valid(width, height))
+	{
+		LOG_ERROR("headless", "Unsupported framebuffer size.");
+		return false;
+	}
+
+	headless.configured_width = width;
+	headless.configured_height = height;
+
+	return true;
+}
+
+void framebuffer_init()
+{
+	size_t panel_width, panel_height;
+
+	if (!headless.configured_width)
+		framebuffer_configure(FRAMEBUFFER_DEFAULT_WIDTH, FRAMEBUFFER_DEFAULT_HEIGHT);
+
+	framebuffer_geometry_init(&headless.geometry, headless.configured_width, headless.configured_height);
+
+	headless.rotation = display_rotation();
+	if (headless.rotation == DISPLAY_ROTATION_0)
+	{
+		framebuffer_geometry_deinit(&headless.panel);
+		return;
+	}
+
+	display_rotation_panel_size(headless.rotation, headless.configured_width, headless.configured_height, &panel_width,
+			&panel_height);
+	framebuffer_geometry_init(&headless.panel, panel_width, panel_height);
+}
+
+void framebuffer_deinit()
+{
+	framebuffer_geometry_deinit(&headless.panel);
+	framebuffer_geometry_deinit(&headless.geometry);
+	headless_set_damage_log(NULL);
+}
+
+pixel_t * framebuffer_start()
+{
+	return headless.geometry.pixels;
+}
+
+pixel_t * framebuffer_at(dim_t x, dim_t y)
+{
+	return framebuffer_geometry_at(&headless.geometry, x, y);
+}
+
+size_t framebuffer_width()
+{
+	return headless.geometry.width;
+}
+
+size_t framebuffer_height()
+{
+	return headless.geometry.height;
+}
+
+size_t framebuffer_stride()
+{
+	return headless.geometry.stride;
+}
+
+const area_t * framebuffer_area()
+{
+	return &headless.geometry.area;
+}
+
+void framebuffer_inform_written_area(size_t x, size_t y, size_t width, size_t height)
+{
+	uint64_t start = now_ns();
+	area_t written;
+
+	area_set(&written, (dim_t)x, (dim_t)y, (dim_t)width, (dim_t)height);
+	framebuffer_ops_sync_area(&written);
+
+	if (headless.panel.pixels)
+	{
+		area_t presented;
+
+		display_rotation_present(headless.rotation, &headless.panel, &headless.geometry, &written, &presented);
+	}
+
+	if (headless.damage_log)
+		fprintf(headless.damage_log, "%s %u %u %u %u %u\n", headless.name, headless.frame, (unsigned)x, (unsigned)y,
+				(unsigned)width, (unsigned)height);
+
+	headless.damage_count++;
+	headless.present_ns += now_ns() - start;
+}
+
+void headless_set_dump(enum e_headless_dump format, const char * directory)
+{
+	headless.dump = format;
+	snprintf(headless.directory, sizeof(headless.directory), "%s", directory ? directory : ".");
+}
+
+bool headless_set_damage_log(const char * path)
+{
+	if (headless.damage_log)
+		fclose(headless.damage_log);
+	headless.damage_log = NULL;
+
+	if (!path)
+		return true;
+
+	headless.damage_log = fopen(path, "w");
+	if (!headless.damage_log)
+	{
+		LOG_ERROR("headless", "Can not open the damage log.");
+		return false;
+	}
+
+	return true;
+}
+
+void headless_begin_frame(const char * name)
+{
+	PTR_CHECK(name, "headless");
+
+	if (strcmp(name, headless.name))
+	{
+		snprintf(headless.name, sizeof(headless.name), "%s", name);
+		headless.frame = 0;
+		return;
+	}
+
+	headless.frame++;
+}
+
+bool headless_end_frame(void)
+{
+	static const char * extensions[] = {"", "ppm", "png", "raw", "raw"};
+	char path[sizeof(headless.directory) + sizeof(headless.name) + 16];
+	const framebuffer_geometry_t * presented;
+	uint64_t start;
+	bool written = false;
+
+	if (headless.dump == HEADLESS_DUMP_NONE)
+		return true;
+
+	start = now_ns();
+	framebuffer_ops_sync();
+	/* What the panel shows, turned when rotated. */
+	presented = headless.panel.pixels ? &headless.panel : &headless.geometry;
+	snprintf(path, sizeof(path), "%s/%s_%05u.%s", headless.directory, headless.name, headless.frame,
+			extensions[headless.dump]);
+
+	switch (headless.dump)
+	{
+	case HEADLESS_DUMP_PPM:
+		written = headless_write_ppm(path, presented->pixels, presented->stride, presented->width, presented->height);
+		break;
+	case HEADLESS_DUMP_PNG:
+		written = headless_write_png(path, presented->pixels, presented->stride, presented->width, presented->height);
+		break;
+	case HEADLESS_DUMP_RAW:
+	case HEADLESS_DUMP_RAW888:
+		written = headless_write_raw(path, presented->pixels, presented->stride, presented->width, presented->height,
+				headless.dump == HEADLESS_DUMP_RAW888);
+		break;
+	case HEADLESS_DUMP_NONE:
+	default:
+		break;
+	}
+
+	headless.dump_ns += now_ns() - start;
+
+	return written;
+}
+
+uint64_t headless_present_ns(void)
+{
+	return headless.present_ns;
+}
+
+uint64_t headless_dump_ns(void)
+{
+	return headless.dump_ns;
+}
+
+uint32_t headless_damage_count(void)
+{
+	return headless.damage_count;
+}
+
+void headless_reset_timings(void)
+{
+	headless.present_ns = 0;
+	headless.dump_ns = 0;
+	headless.damage_count = 0;
+}
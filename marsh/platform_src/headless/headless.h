@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef HEADLESS_H_
+#define HEADLESS_H_
+
+#include <stdint.h>
+
+#include "types.h"
+
+/*
+ * Offscreen framebuffer backend, for benchmarks and rendering regression checks
+ * without a display. The framebuffer lives in memory, sized by framebuffer_configure
+ * before framebuffer_init. Every written area informed is appended to the damage
+ * log and each frame ended may be dumped to an image file. With a display_rotation
+ * set before framebuffer_init, the written areas are rotated into a panel buffer as
+ * they are informed and the dumps show the panel.
+ */
+
+enum e_headless_dump
+{
+	HEADLESS_DUMP_NONE,
+	HEADLESS_DUMP_PPM,
+	HEADLESS_DUMP_PNG,
+	HEADLESS_DUMP_RAW,
+	HEADLESS_DUMP_RAW888
+};
+
+/* Frames are dumped to directory/<name>_<frame>.<extension>. */
+void headless_set_dump(enum e_headless_dump format, const char * directory);
+/* One "<name> <frame> <x> <y> <width> <height>" line per written area, NULL stops it. */
+bool headless_set_damage_log(const char * path);
+
+/* Frames are counted from 0 for each name, the areas written belong to the current one. */
+void headless_begin_frame(const char * name);
+/* Returns false when the dump failed. */
+bool headless_end_frame(void);
+
+/* Spent informing of written areas and dumping frames, since the last reset. */
+uint64_t headless_present_ns(void);
+uint64_t headless_dump_ns(void);
+uint32_t headless_damage_count(void);
+void headless_reset_timings(void);
+
+/* Image files, from framebuffer pixels with a stride in pixels. Raw files hold the
+ * pixels as they are, or converted to packed RGB888. */
+bool headless_write_ppm(const char * path, const pixel_t * pixels, size_t stride, size_t width, size_t height);
+bool headless_write_png(const char * path, const pixel_t * pixels, size_t stride, size_t width, size_t height);
+bool headless_write_raw(const char * path, const pixel_t * pixels, size_t stride, size_t width, size_t height,
+		bool rgb888);
+
+#endif /* HEADLESS_H_ */
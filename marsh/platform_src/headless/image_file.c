@@ -0,0 +1,245 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "helper/log.h"
+
+#include "pixel_convert.h"
+
+#include "headless.h"
+
+/* Stored deflate blocks hold at most this much. */
+#define DEFLATE_STORED_MAX 65535
+
+static uint32_t crc_table[256];
+
+static void crc_init(void)
+{
+	uint32_t c, n, k;
+
+	if (crc_table[1])
+		return;
+
+	for (n = 0; n < 256; n++)
+	{
+		for (c = n, k = 0; k < 8; k++)
+			c = c & 1 ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+		crc_table[n] = c;
+	}
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t * data, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++)
+		crc = crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+	return crc;
+}
+
+static void put_be32(uint8_t * dst, uint32_t value)
+{
+	dst[0] = (uint8_t)(value >> 24);
+	dst[1] = (uint8_t)(value >> 16);
+	dst[2] = (uint8_t)(value >> 8);
+	dst[3] = (uint8_t)value;
+}
+
+static bool write_chunk(FILE * file, const char * type, const uint8_t * data, size_t size)
+{
+	uint8_t header[8], trailer[4];
+	uint32_t crc;
+
+	put_be32(header, (uint32_t)size);
+	memcpy(header + 4, type, 4);
+
+	crc = crc_update(0xFFFFFFFFU, header + 4, 4);
+	crc = crc_update(crc, data, size);
+	put_be32(trailer, crc ^ 0xFFFFFFFFU);
+
+	return fwrite(header, 1, 8, file) == 8 && (!size || fwrite(data, 1, size, file) == size)
+			&& fwrite(trailer, 1, 4, file) == 4;
+}
+
+/* RGB rows, each behind its filter type byte, none. */
+static uint8_t * filtered_rows(const pixel_t * pixels, size_t stride, size_t width, size_t height, size_t * size)
+{
+	size_t row = 1 + width * 3, y;
+	uint8_t * rows = (uint8_t *)malloc(row * height);
+
+	if (!rows)
+		return NULL;
+
+	for (y = 0; y < height; y++)
+	{
+		rows[y * row] = 0;
+		pixel_convert_to_888(rows + y * row + 1, 0, pixels + y * stride, 0, (dim_t)width, 1);
+	}
+
+	*size = row * height;
+
+	return rows;
+}
+
+/* A zlib stream of stored blocks: the dumps are read back by tools, not stored. */
+static uint8_t * zlib_stored(const uint8_t * data, size_t size, size_t * stream_size)
+{
+	size_t blocks = size / DEFLATE_STORED_MAX + 1, offset = 0, length, i;
+	uint8_t * stream = (uint8_t *)malloc(2 + blocks * 5 + size + 4);
+	uint8_t * out = stream;
+	uint32_t a = 1, b = 0;
+
+	if (!stream)
+		return NULL;
+
+	*out++ = 0x78;
+	*out++ = 0x01;
+
+	do
+	{
+		length = size - offset < DEFLATE_STORED_MAX ? size - offset : DEFLATE_STORED_MAX;
+		*out++ = offset + length == size ? 1 : 0;
+		*out++ = (uint8_t)length;
+		*out++ = (uint8_t)(length >> 8);
+		*out++ = (uint8_t)~length;
+		*out++ = (uint8_t)(~length >> 8);
+		memcpy(out, data + offset, length);
+		out += length;
+		offset += length;
+	} while (offset < size);
+
+	for (i = 0; i < size; i++)
+	{
+		a = (a + data[i]) % 65521;
+		b = (b + a) % 65521;
+	}
+	put_be32(out, b << 16 | a);
+	out += 4;
+
+	*stream_size = (size_t)(out - stream);
+
+	return stream;
+}
+
+bool headless_write_ppm(const char * path, const pixel_t * pixels, size_t stride, size_t width, size_t height)
+{
+	uint8_t * row = (uint8_t *)malloc(width * 3);
+	FILE * file = fopen(path, "wb");
+	bool written;
+	size_t y;
+
+	written = row && file && fprintf(file, "P6\n%u %u\n255\n", (unsigned)width, (unsigned)height) > 0;
+
+	for (y = 0; written && y < height; y++)
+	{
+		pixel_convert_to_888(row, 0, pixels + y * stride, 0, (dim_t)width, 1);
+		written = fwrite(row, 1, width * 3, file) == width * 3;
+	}
+
+	if (file && fclose(file))
+		written = false;
+	free(row);
+
+	if (!written)
+		LOG_ERROR("headless", "Failed to write a PPM file.");
+
+	return written;
+}
+
+bool headless_write_png(const char * path, const pixel_t * pixels, size_t stride, size_t width, size_t height)
+{
+	static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+	uint8_t header[13];
+	uint8_t * rows = NULL, * stream = NULL;
+	size_t rows_size, stream_size;
+	FILE * file = NULL;
+	bool written = false;
+
+	crc_init();
+
+	put_be32(header, (uint32_t)width);
+	put_be32(header + 4, (uint32_t)height);
+	header[8] = 8;  /* Bits per channel. */
+	header[9] = 2;  /* Truecolor. */
+	header[10] = 0; /* Deflate. */
+	header[11] = 0; /* Adaptive filtering. */
+	header[12] = 0; /* Not interlaced. */
+
+	rows = filtered_rows(pixels, stride, width, height, &rows_size);
+	if (rows)
+		stream = zlib_stored(rows, rows_size, &stream_size);
+	if (stream)
+		file = fopen(path, "wb");
+
+	if (file)
+	{
+		written = fwrite(signature, 1, sizeof(signature), file) == sizeof(signature)
+				&& write_chunk(file, "IHDR", header, sizeof(header))
+				&& write_chunk(file, "IDAT", stream, stream_size)
+				&& write_chunk(file, "IEND", NULL, 0);
+
+		if (fclose(file))
+			written = false;
+	}
+
+	free(stream);
+	free(rows);
+
+	if (!written)
+		LOG_ERROR("headless", "Failed to write a PNG file.");
+
+	return written;
+}
+
+bool headless_write_raw(const char * path, const pixel_t * pixels, size_t stride, size_t width, size_t height,
+		bool rgb888)
+{
+	uint8_t * row = rgb888 ? (uint8_t *)malloc(width * 3) : NULL;
+	FILE * file = fopen(path, "wb");
+	bool written = file && (!rgb888 || row);
+	size_t y;
+
+	for (y = 0; written && y < height; y++)
+	{
+		if (rgb888)
+		{
+			pixel_convert_to_888(row, 0, pixels + y * stride, 0, (dim_t)width, 1);
+			written = fwrite(row, 1, width * 3, file) == width * 3;
+		}
+		else
+		{
+			written = fwrite(pixels + y * stride, sizeof(pixel_t), width, file) == width;
+		}
+	}
+
+	if (file && fclose(file))
+		written = false;
+	free(row);
+
+	if (!written)
+		LOG_ERROR("headless", "Failed to write a raw file.");
+
+	return written;
+}
@@ -0,0 +1,258 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "display_rotation.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "framebuffer_geometry.h"
+#include "pixel_format.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+
+#include "headless.h"
+#include "scenes.h"
+
+struct s_options
+{
+	size_t width;
+	size_t height;
+	enum e_display_rotation rotation;
+	unsigned frames;
+	enum e_headless_dump dump;
+	const char * directory;
+	const char * damage_log;
+};
+
+struct s_stages
+{
+	uint64_t update_ns;
+	uint64_t draw_ns;
+	uint64_t present_ns;
+	uint64_t dump_ns;
+};
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void usage(const char * program)
+{
+	size_t i;
+
+	printf("Usage: %s [options] [scene...]\n"
+			"  --size WxH         framebuffer resolution, 800x480 by default\n"
+			"  --rotate DEGREES   panel turned 0, 90, 180 or 270 degrees clockwise\n"
+			"  --frames N         frames per scene, 300 by default\n"
+			"  --dump FORMAT      dump every frame: ppm, png, raw (framebuffer pixels) or raw888\n"
+			"  --dump-dir DIR     where dumps go, the current directory by default\n"
+			"  --damage-log FILE  written areas, one per line\n"
+			"Scenes, all by default:\n", program);
+
+	for (i = 0; i < scene_count; i++)
+		printf("  %-18s %s\n", scenes[i].name, scenes[i].description);
+}
+
+static bool parse_dump(const char * format, enum e_headless_dump * dump)
+{
+	static const char * names[] = {"none", "ppm", "png", "raw", "raw888"};
+	size_t i;
+
+	for (i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+	{
+		if (!strcmp(format, names[i]))
+		{
+			*dump = (enum e_headless_dump)i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Returns the index of the first scene name, or -1 on a bad option. */
+static int parse_options(int argc, char ** argv, struct s_options * options)
+{
+	int a;
+
+	for (a = 1; a < argc && !strncmp(argv[a], "--", 2); a++)
+	{
+		if (a + 1 == argc)
+			return -1;
+
+		if (!strcmp(argv[a], "--size") && framebuffer_geometry_parse(argv[a + 1], &options->width, &options->height))
+			;
+		else if (!strcmp(argv[a], "--rotate") && display_rotation_parse(argv[a + 1], &options->rotation))
+			;
+		else if (!strcmp(argv[a], "--frames") && sscanf(argv[a + 1], "%u", &options->frames) == 1 && options->frames)
+			;
+		else if (!strcmp(argv[a], "--dump") && parse_dump(argv[a + 1], &options->dump))
+			;
+		else if (!strcmp(argv[a], "--dump-dir"))
+			options->directory = argv[a + 1];
+		else if (!strcmp(argv[a], "--damage-log"))
+			options->damage_log = argv[a + 1];
+		else
+			return -1;
+
+		a++;
+	}
+
+	return a;
+}
+
+static void report(const char * name, unsigned frames, uint64_t elapsed_ns, const struct s_stages * stages)
+{
+	double per_frame = 1e6 * frames;
+
+	printf("%-12s %8.1f fps  update %.3f  draw %.3f  present %.3f  dump %.3f ms/frame  (%u damaged areas)\n", name,
+			elapsed_ns ? frames * 1e9 / (double)elapsed_ns : 0.0, stages->update_ns / per_frame,
+			stages->draw_ns / per_frame, stages->present_ns / per_frame, stages->dump_ns / per_frame,
+			headless_damage_count());
+}
+
+/* The first frame draws the whole tree, the next ones commit what the scene changed.
+ * Presenting happens inside the draw, its time is taken out of it. */
+static bool run_scene(const struct s_scene * scene, unsigned frames)
+{
+	struct s_stages stages;
+	widget_t * root;
+	uint64_t start, update_end, draw_end, present_ns;
+	unsigned frame;
+	bool dumped = true;
+
+	memset(&stages, 0, sizeof(stages));
+	memset(framebuffer_start(), 0, framebuffer_stride() * framebuffer_height() * sizeof(pixel_t));
+	root = scene->create();
+	headless_reset_timings();
+
+	start = now_ns();
+
+	for (frame = 0; frame < frames; frame++)
+	{
+		uint64_t frame_start = now_ns();
+
+		headless_begin_frame(scene->name);
+		present_ns = headless_present_ns();
+
+		if (frame == 0)
+		{
+			update_end = now_ns();
+			widget_tree_draw(root);
+			framebuffer_inform_written_area(0, 0, framebuffer_width(), framebuffer_height());
+		}
+		else
+		{
+			widget_begin_update(root);
+			scene->step(root, frame);
+			update_end = now_ns();
+			widget_commit_update(root);
+		}
+
+		framebuffer_ops_sync();
+		draw_end = now_ns();
+		present_ns = headless_present_ns() - present_ns;
+
+		stages.update_ns += update_end - frame_start;
+		stages.draw_ns += draw_end - update_end - present_ns;
+		stages.present_ns += present_ns;
+
+		dumped = headless_end_frame() && dumped;
+	}
+
+	stages.dump_ns = headless_dump_ns();
+	report(scene->name, frames, now_ns() - start, &stages);
+
+	scene->destroy();
+
+	return dumped;
+}
+
+/* Runs the scripted scenes as fast as possible, reporting frames per second and the
+ * time of each stage per frame. */
+int main(int argc, char ** argv)
+{
+	struct s_options options;
+	bool ok = true;
+	size_t i;
+	int first, a;
+
+	memset(&options, 0, sizeof(options));
+	options.frames = 300;
+
+	first = parse_options(argc, argv, &options);
+	if (first < 0)
+	{
+		usage(argv[0]);
+		return 2;
+	}
+
+	for (a = first; a < argc; a++)
+	{
+		for (i = 0; i < scene_count && strcmp(argv[a], scenes[i].name); i++)
+			;
+		if (i == scene_count)
+		{
+			usage(argv[0]);
+			return 2;
+		}
+	}
+
+	if (options.width)
+		framebuffer_configure(options.width, options.height);
+	display_rotation_set(options.rotation);
+	headless_set_dump(options.dump, options.directory);
+
+	framebuffer_init();
+	event_pool_init();
+
+	if (options.damage_log && !headless_set_damage_log(options.damage_log))
+		ok = false;
+
+	printf("%ux%u %s (stride %u) rotated %u degrees, %u frames per scene\n", (unsigned)framebuffer_width(),
+			(unsigned)framebuffer_height(), pixel_format_name(), (unsigned)framebuffer_stride(),
+			(unsigned)options.rotation * 90, options.frames);
+
+	for (i = 0; ok && i < scene_count; i++)
+	{
+		for (a = first; a < argc && strcmp(argv[a], scenes[i].name); a++)
+			;
+		if (first < argc && a == argc)
+			continue;
+
+		ok = run_scene(&scenes[i], options.frames) && ok;
+	}
+
+	event_pool_deinit();
+	framebuffer_deinit();
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,281 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "animation.h"
+#include "framebuffer.h"
+#include "gauge.h"
+#include "icon.h"
+#include "image.h"
+#include "rectangle.h"
+#include "text.h"
+#include "widget.h"
+#include "widget_update.h"
+#include "bitmap_data/bitmaps.h"
+#include "font_data/fonts.h"
+#include "helper/my_string.h"
+
+#include "scenes.h"
+
+#define SHAPES 8
+#define PANEL_COLUMNS 4
+#define PANEL_ROWS 2
+#define PANELS (PANEL_COLUMNS * PANEL_ROWS)
+#define MOVERS 8
+
+static struct
+{
+	widget_t * screen;
+	rectangle_t * background;
+	rectangle_t * shapes[SHAPES];
+	icon_t * icons[3];
+	image_t * lena;
+	text_t * texts[2];
+	gauge_t * gauges[PANELS];
+	rectangle_t * panels[PANELS];
+	rectangle_t * bars[PANELS];
+	rectangle_t * movers[MOVERS];
+	bool moving_right;
+} scene;
+
+static dim_t width(void)
+{
+	return (dim_t)framebuffer_width();
+}
+
+static dim_t height(void)
+{
+	return (dim_t)framebuffer_height();
+}
+
+static widget_t * screen_new(const char * color)
+{
+	scene.screen = widget_new(NULL, NULL, NULL, NULL);
+	widget_set_area(scene.screen, 0, 0, width(), height());
+
+	scene.background = rectangle_new(scene.screen);
+	rectangle_set_fill_color_html(scene.background, color);
+	rectangle_set_size(scene.background, width(), height());
+
+	return rectangle_get_widget(scene.background);
+}
+
+static void screen_delete(void)
+{
+	rectangle_delete(scene.background);
+	widget_delete(scene.screen);
+}
+
+/* Shapes of every kind, an image, icons and text, redrawn whole on every frame. */
+static widget_t * redraw_create(void)
+{
+	static const char * fills[] = {"#800000", "#008000", "#000080", "#808080"};
+	widget_t * bg = screen_new("#004000");
+	dim_t size = width() / (SHAPES + 2);
+	int i;
+
+	for (i = 0; i < SHAPES; i++)
+	{
+		scene.shapes[i] = rectangle_new(bg);
+		rectangle_set_position(scene.shapes[i], (dim_t)(size / 2 + i * size * 5 / 4), size / 2);
+		rectangle_set_size(scene.shapes[i], size, size);
+		if (i % 4 != 3)
+			rectangle_set_fill_color_html(scene.shapes[i], fills[i % 4]);
+		if (i % 2)
+			rectangle_set_border_color_html(scene.shapes[i], "#C0C0C0");
+		if (i >= SHAPES / 2)
+			rectangle_set_rounded_corner_radius(scene.shapes[i], size / 8);
+		if (i % 4 == 3)
+			rectangle_set_border_tickness(scene.shapes[i], 5);
+	}
+
+	for (i = 0; i < 3; i++)
+	{
+		scene.icons[i] = icon_new(bg);
+		icon_set_color_html(scene.icons[i], fills[i]);
+		icon_set_position(scene.icons[i], (dim_t)(10 + i * 10), (dim_t)(height() / 2 + i * 10));
+		icon_set_bitmap(scene.icons[i], wifi_icon_bitmap);
+	}
+
+	scene.lena = image_new(bg);
+	image_set_bitmap(scene.lena, lena_bitmap);
+	image_set_position(scene.lena, width() / 4, height() / 3);
+
+	for (i = 0; i < 2; i++)
+	{
+		scene.texts[i] = text_new(bg);
+		text_set_color_html(scene.texts[i], "#E0E0E0");
+		text_set_font(scene.texts[i], ubuntu_monospace_16);
+		text_set_justification(scene.texts[i], i ? TEXT_RIGHT_JUST : TEXT_LEFT_JUST);
+		text_set_reference_position(scene.texts[i], i ? width() - 10 : 10, height() - 60);
+		my_string_set(text_get_string(scene.texts[i]), "Hello World!\nHow beautiful is it?");
+	}
+
+	return scene.screen;
+}
+
+static void redraw_step(widget_t * root, unsigned frame)
+{
+	(void)frame;
+
+	widget_invalidate(root);
+}
+
+static void redraw_destroy(void)
+{
+	int i;
+
+	for (i = 0; i < 2; i++)
+		text_delete(scene.texts[i]);
+	image_delete(scene.lena);
+	for (i = 0; i < 3; i++)
+		icon_delete(scene.icons[i]);
+	for (i = 0; i < SHAPES; i++)
+		rectangle_delete(scene.shapes[i]);
+	screen_delete();
+}
+
+/* Panels of a gauge and a level bar, every value changing on every frame. */
+static widget_t * dashboard_create(void)
+{
+	widget_t * bg = screen_new("#101010");
+	dim_t panel_width = width() / PANEL_COLUMNS, panel_height = height() / PANEL_ROWS, size;
+	int i;
+
+	size = (panel_width < panel_height ? panel_width : panel_height) - 40;
+
+	for (i = 0; i < PANELS; i++)
+	{
+		scene.panels[i] = rectangle_new(bg);
+		rectangle_set_position(scene.panels[i], (dim_t)(i % PANEL_COLUMNS * panel_width + 4),
+				(dim_t)(i / PANEL_COLUMNS * panel_height + 4));
+		rectangle_set_size(scene.panels[i], panel_width - 8, panel_height - 8);
+		rectangle_set_fill_color_html(scene.panels[i], "#303040");
+		rectangle_set_rounded_corner_radius(scene.panels[i], 8);
+
+		scene.gauges[i] = gauge_new(rectangle_get_widget(scene.panels[i]));
+		gauge_set_position(scene.gauges[i], (dim_t)(i % PANEL_COLUMNS * panel_width + (panel_width - size) / 2),
+				(dim_t)(i / PANEL_COLUMNS * panel_height + 10));
+		gauge_set_size(scene.gauges[i], size, size);
+		gauge_set_thickness(scene.gauges[i], size / 8);
+		gauge_set_angles(scene.gauges[i], 1350, 2700);
+		gauge_set_range(scene.gauges[i], 0, 100);
+		gauge_set_track_color_html(scene.gauges[i], "#404040");
+		gauge_set_value_color_html(scene.gauges[i], "#00C0FF");
+
+		scene.bars[i] = rectangle_new(rectangle_get_widget(scene.panels[i]));
+		rectangle_set_position(scene.bars[i], (dim_t)(i % PANEL_COLUMNS * panel_width + 12),
+				(dim_t)((i / PANEL_COLUMNS + 1) * panel_height - 24));
+		rectangle_set_size(scene.bars[i], 1, 10);
+		rectangle_set_fill_color_html(scene.bars[i], "#00C000");
+	}
+
+	return scene.screen;
+}
+
+static void dashboard_step(widget_t * root, unsigned frame)
+{
+	dim_t bar_width = width() / PANEL_COLUMNS - 24;
+	int i, value;
+
+	(void)root;
+
+	for (i = 0; i < PANELS; i++)
+	{
+		/* A triangle wave per panel, out of phase. */
+		value = (int)((frame * (unsigned)(i + 1) + (unsigned)i * 13) % 200);
+		if (value > 100)
+			value = 200 - value;
+
+		gauge_set_value(scene.gauges[i], value);
+		rectangle_set_size(scene.bars[i], (dim_t)(1 + bar_width * value / 100), 10);
+	}
+}
+
+static void dashboard_destroy(void)
+{
+	int i;
+
+	for (i = 0; i < PANELS; i++)
+	{
+		rectangle_delete(scene.bars[i]);
+		gauge_delete(scene.gauges[i]);
+		rectangle_delete(scene.panels[i]);
+	}
+	screen_delete();
+}
+
+/* Squares sliding back and forth across the screen with animations. */
+static widget_t * animation_create(void)
+{
+	widget_t * bg = screen_new("#000040");
+	dim_t size = height() / (MOVERS * 2);
+	int i;
+
+	scene.moving_right = false;
+	for (i = 0; i < MOVERS; i++)
+	{
+		scene.movers[i] = rectangle_new(bg);
+		rectangle_set_position(scene.movers[i], 0, (dim_t)(size / 2 + i * size * 2));
+		rectangle_set_size(scene.movers[i], size, size);
+		rectangle_set_fill_color_html(scene.movers[i], i % 2 ? "#FFC000" : "#00FFC0");
+		rectangle_set_rounded_corner_radius(scene.movers[i], size / 4);
+	}
+
+	return scene.screen;
+}
+
+static void animation_step(widget_t * root, unsigned frame)
+{
+	dim_t size = height() / (MOVERS * 2);
+	int i;
+
+	(void)frame;
+
+	if (!animation_count())
+	{
+		scene.moving_right = !scene.moving_right;
+		for (i = 0; i < MOVERS; i++)
+			animation_move(rectangle_get_widget(scene.movers[i]), scene.moving_right ? width() - size : 0,
+					(dim_t)(size / 2 + i * size * 2), (uint32_t)(300 + i * 25), ANIMATION_EASE_IN_OUT_CUBIC);
+	}
+
+	/* A fixed step, frames run as fast as they can. */
+	animation_tick(root, 16);
+}
+
+static void animation_destroy(void)
+{
+	int i;
+
+	animation_stop_all();
+	for (i = 0; i < MOVERS; i++)
+		rectangle_delete(scene.movers[i]);
+	screen_delete();
+}
+
+const struct s_scene scenes[] =
+{
+	{"redraw", "full redraw of every kind of widget", redraw_create, redraw_step, redraw_destroy},
+	{"dashboard", "gauges and bars changing every frame", dashboard_create, dashboard_step, dashboard_destroy},
+	{"animation", "animated squares", animation_create, animation_step, animation_destroy},
+};
+
+const size_t scene_count = sizeof(scenes) / sizeof(scenes[0]);
@@ -19,58 +19,104 @@
  *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <stdlib.h>
+
 #include "framebuffer.h"
+#include "framebuffer_geometry.h"
 #include "area.h"
+#include "command_queue.h"
+#include "display_rotation.h"
+
+static framebuffer_geometry_t geometry;
+/* Written areas turned to the panel orientation, unused when it is the logical one. */
+static framebuffer_geometry_t panel;
+static enum e_display_rotation rotation;
+static size_t configured_width = FRAMEBUFFER_DEFAULT_WIDTH;
+static size_t configured_height = FRAMEBUFFER_DEFAULT_HEIGHT;
 
-extern char * pVirtFb;
+/* Called by the simulator before it sizes its window. */
+bool framebuffer_configure(size_t width, size_t height)
+{
+	if (!framebuffer_geometry_valid(width, height))
+		return false;
 
-#define FRAMEBUFFER_WIDTH  800UL
-#define FRAMEBUFFER_HEIGHT 480UL
+	configured_width = width;
+	configured_height = height;
 
-#define PIXEL_PTR_LINE_INCREMENT_VAL   FRAMEBUFFER_WIDTH
-#define PIXEL_PTR_PIXEL_INCREMENT_VAL  1UL
+	return true;
+}
 
 void framebuffer_init()
 {
+	size_t panel_width, panel_height;
+
+	framebuffer_geometry_init(&geometry, configured_width, configured_height);
+
+	rotation = display_rotation();
+	if (rotation != DISPLAY_ROTATION_0)
+	{
+		display_rotation_panel_size(rotation, configured_width, configured_height, &panel_width, &panel_height);
+		framebuffer_geometry_init(&panel, panel_width, panel_height);
+	}
+
+	/* MARSH_COMMAND_QUEUE=1 moves the pixel work to the rasterizer thread. */
+	if (getenv("MARSH_COMMAND_QUEUE"))
+		command_queue_start();
 }
 
 void framebuffer_deinit()
 {
+	command_queue_stop();
+	framebuffer_geometry_deinit(&panel);
+	framebuffer_geometry_deinit(&geometry);
 }
 
 pixel_t* framebuffer_start()
 {
-	return (pixel_t *)pVirtFb;
+	return geometry.pixels;
 }
 
 size_t framebuffer_width()
 {
-	return FRAMEBUFFER_WIDTH;
+	return geometry.width;
 }
 
 size_t framebuffer_height()
 {
-	return FRAMEBUFFER_HEIGHT;
+	return geometry.height;
 }
 
-const area_t * framebuffer_area()
+size_t framebuffer_stride()
 {
-	static area_t ret;
-
-	area_set(&ret, 0, 0, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+	return geometry.stride;
+}
 
-	return &ret;
+const area_t * framebuffer_area()
+{
+	return &geometry.area;
 }
 
-pixel_t* framebuffer_at(pixel_t x, pixel_t y)
+pixel_t* framebuffer_at(dim_t x, dim_t y)
 {
-	pixel_t* pFb = (pixel_t *)pVirtFb;
-	return pFb + x*PIXEL_PTR_PIXEL_INCREMENT_VAL + y*PIXEL_PTR_LINE_INCREMENT_VAL;
+	return framebuffer_geometry_at(&geometry, x, y);
 }
 
-extern void VirtualFb_Refresh(void);
+extern void VirtualFb_Refresh(const pixel_t * pixels, size_t stride, int x, int y, int width, int height);
 void framebuffer_inform_written_area(size_t x, size_t y, size_t width, size_t height)
 {
-	VirtualFb_Refresh();
+	area_t written, presented;
+
+	/* Only the queued operations writing into the presented area are waited for. */
+	area_set(&written, x, y, width, height);
+	framebuffer_ops_sync_area(&written);
+
+	if (!panel.pixels)
+	{
+		VirtualFb_Refresh(geometry.pixels, geometry.stride, (int)x, (int)y, (int)width, (int)height);
+		return;
+	}
+
+	if (display_rotation_present(rotation, &panel, &geometry, &written, &presented))
+		VirtualFb_Refresh(panel.pixels, panel.stride, presented.x, presented.y, presented.width, presented.height);
 }
 
@@ -36,30 +36,33 @@
 
 #include "marshmallowthread.h"
 
+extern "C"
+{
+#include "display_rotation.h"
+#include "framebuffer.h"
+#include "framebuffer_geometry.h"
+#include "pixel_convert.h"
+}
+
 class MyArea: public Gtk::DrawingArea
 {
 public:
-	MyArea();
+	MyArea(int width, int height);
 	virtual ~MyArea();
-	Glib::RefPtr<Gdk::Pixbuf> m_PxlBuf;
+	/* Cairo's native 32 bit format, painted without any conversion on draw. */
+	Cairo::RefPtr<Cairo::ImageSurface> m_Surface;
 
 protected:
 	//Override default signal handler:
 	virtual bool on_draw(const Cairo::RefPtr<Cairo::Context>& cr);
 };
 
-MyArea::MyArea()
+MyArea::MyArea(int width, int height)
 {
-	try
-	{
-		m_PxlBuf = Gdk::Pixbuf::create(Gdk::COLORSPACE_RGB, false, 8, 800, 480);
-	} catch (const Gdk::PixbufError& ex)
-	{
-//		std::cerr << "PixbufError: " << ex.what() << std::endl;
-	}
+	m_Surface = Cairo::ImageSurface::create(Cairo::FORMAT_RGB24, width, height);
 
-	if (m_PxlBuf)
-		set_size_request(m_PxlBuf->get_width() / 2, m_PxlBuf->get_height() / 2);
+	if (m_Surface)
+		set_size_request(m_Surface->get_width() / 2, m_Surface->get_height() / 2);
 }
 
 MyArea::~MyArea()
@@ -68,17 +71,17 @@ MyArea::~MyArea()
 
 bool MyArea::on_draw(const Cairo::RefPtr<Cairo::Context>& cr)
 {
-	if (!m_PxlBuf)
+	if (!m_Surface)
 		return false;
 
-	Gdk::Cairo::set_source_pixbuf(cr, m_PxlBuf, 0, 0);
+	/* Clipped by GTK to the areas queued for drawing. */
+	cr->set_source(m_Surface, 0, 0);
 	cr->paint();
 
 	return true;
 }
 
 MyArea *pArea;
-char * pVirtFb = NULL;
 
 Glib::RefPtr<Gtk::Application> gSimuApp;
 
@@ -116,6 +119,23 @@ void * VirtualInputClickHandler(GdkEventButton * ev)
 
 int main(int argc, char **argv)
 {
+	size_t fb_width = FRAMEBUFFER_DEFAULT_WIDTH, fb_height = FRAMEBUFFER_DEFAULT_HEIGHT;
+	size_t panel_width, panel_height;
+	enum e_display_rotation rotation = DISPLAY_ROTATION_0;
+	const char * size = getenv("MARSH_FRAMEBUFFER");
+	const char * degrees = getenv("MARSH_ROTATION");
+
+	/* MARSH_FRAMEBUFFER=1920x1080 simulates another panel. */
+	if (size && !framebuffer_geometry_parse(size, &fb_width, &fb_height))
+		std::cout << "Ignoring MARSH_FRAMEBUFFER=" << size << ", expected WxH" << std::endl;
+	framebuffer_configure(fb_width, fb_height);
+
+	/* MARSH_ROTATION=90 simulates a panel mounted in portrait, the window is the panel. */
+	if (degrees && !display_rotation_parse(degrees, &rotation))
+		std::cout << "Ignoring MARSH_ROTATION=" << degrees << ", expected 0, 90, 180 or 270" << std::endl;
+	display_rotation_set(rotation);
+	display_rotation_panel_size(rotation, fb_width, fb_height, &panel_width, &panel_height);
+
 	gdk_threads_init();
 	gdk_threads_enter();
 
@@ -123,10 +143,10 @@ int main(int argc, char **argv)
 
 	Gtk::Window win;
 	win.set_title("RE8000 Simulador");
-	win.set_default_size(800, 480);
+	win.set_default_size(panel_width, panel_height);
 
 	/* Virtual Framebuffer area */
-	pArea = new MyArea;
+	pArea = new MyArea(panel_width, panel_height);
 
 	/* Input */
 	pArea->add_events(Gdk::BUTTON_PRESS_MASK);
@@ -135,9 +155,6 @@ int main(int argc, char **argv)
 	pArea->signal_button_release_event().connect(sigc::ptr_fun(&VirtualInputClickHandler));
 	gdk_threads_leave();
 
-	/* Fb */
-	pVirtFb = new char[800 * 480 * 2];
-
 	/* Gtk Window call */
 	win.add(*pArea);
 	pArea->show();
@@ -148,20 +165,35 @@ int main(int argc, char **argv)
 	return gSimuApp->run(win);
 }
 
-void VirtualFb_Refresh(void)
+/* Converts and repaints the written area only, called from the marshmallow thread.
+ * pixels are the panel's, the framebuffer itself or its rotated copy. */
+void VirtualFb_Refresh(const pixel_t * pixels, size_t stride, int x, int y, int width, int height)
 {
-	char * pGtkDrawBuffer = (char *) pArea->m_PxlBuf->get_pixels();
-	short * pSh;
-
-	for (int i = 0; i < (800 * 480); i++)
+	if (x < 0)
+	{
+		width += x;
+		x = 0;
+	}
+	if (y < 0)
 	{
-		pSh = (short *) (pVirtFb + i * 2);
-		*pGtkDrawBuffer++ = (((*pSh >> 11) & 0x1F) << 3) | 0x7;
-		*pGtkDrawBuffer++ = (((*pSh >> 5) & 0x3F) << 2) | 0x3;
-		*pGtkDrawBuffer++ = ((*pSh & 0x1F) << 3) | 0x7;
+		height += y;
+		y = 0;
 	}
+	if (x + width > pArea->m_Surface->get_width())
+		width = pArea->m_Surface->get_width() - x;
+	if (y + height > pArea->m_Surface->get_height())
+		height = pArea->m_Surface->get_height() - y;
+	if (width <= 0 || height <= 0)
+		return;
+
 	gdk_threads_enter();
-	pArea->hide();
-	pArea->show();
+
+	pArea->m_Surface->flush();
+	pixel_convert_to_x888(
+			(uint32_t *) (pArea->m_Surface->get_data() + y * pArea->m_Surface->get_stride()) + x,
+			pArea->m_Surface->get_stride(), pixels + (size_t)y * stride + x, stride, width, height);
+	pArea->m_Surface->mark_dirty(x, y, width, height);
+	pArea->queue_draw_area(x, y, width, height);
+
 	gdk_threads_leave();
 }
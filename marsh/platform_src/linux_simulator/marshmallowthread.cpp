@@ -19,15 +19,19 @@
  *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <cstdlib>
 #include <iostream>
 #include "marshmallowthread.h"
 
 extern "C"
 {
 #include <pthread.h>
+#include <time.h>
 }
 
 #include "framebuffer.h"
+#include "animation.h"
+#include "render_thread.h"
 #include "event.h"
 #include "widget.h"
 #include "widget_tree.h"
@@ -53,20 +57,57 @@ struct marshmallow_thread_private
 		bool set;
 		int x;
 		int y;
+		uint64_t stamp_ns;
 	} interaction;
+
+	/* Input to present latency of the interactions drawn serially. */
+	uint32_t inputs;
+	uint64_t latency_ns;
+	uint64_t max_latency_ns;
 };
 
+static uint64_t monotonic_ns()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static uint64_t monotonic_ms()
+{
+	return monotonic_ns() / 1000000;
+}
+
+static void print_latency(const char * mode, uint32_t inputs, uint64_t latency_ns, uint64_t max_latency_ns)
+{
+	if (!inputs)
+		return;
+
+	std::cout << mode << " input to present latency: " << latency_ns / inputs / 1000 << " us average, "
+			<< max_latency_ns / 1000 << " us max over " << inputs << " inputs" << std::endl;
+}
+
 marshmallow_thread::marshmallow_thread()
 {
 	p = new struct marshmallow_thread_private;
 	p->thread_running = true;
+	p->interaction.set = false;
+	p->inputs = 0;
+	p->latency_ns = 0;
+	p->max_latency_ns = 0;
 
 	pthread_mutexattr_t mutex_attr;
+	pthread_condattr_t cond_attr;
 
 	pthread_mutexattr_init(&mutex_attr);
 	pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_ERRORCHECK);
     pthread_mutex_init(&p->thread_mutex, &mutex_attr);
-    pthread_cond_init(&p->thread_cond, NULL);
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC); // Frame deadlines are monotonic.
+    pthread_cond_init(&p->thread_cond, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
     pthread_create(&p->thread_id, NULL, (void*(*)(void*))marshmallow_thread::thread_handler, this);
     pthread_mutexattr_destroy(&mutex_attr);
 }
@@ -74,7 +115,12 @@ marshmallow_thread::marshmallow_thread()
 marshmallow_thread::~marshmallow_thread()
 {
 	void * pVoid;
+
+	pthread_mutex_lock(&p->thread_mutex);
 	p->thread_running = false;
+	pthread_cond_signal(&p->thread_cond);
+	pthread_mutex_unlock(&p->thread_mutex);
+
 	pthread_join(p->thread_id, &pVoid);
 
 	delete p;
@@ -88,6 +134,7 @@ void marshmallow_thread::press(int x, int y)
 	p->interaction.x = x;
 	p->interaction.y = y;
 	p->interaction.type = marshmallow_thread_private::sInteraction::PRESS;
+	p->interaction.stamp_ns = monotonic_ns();
 	p->interaction.set = true;
 
 	pthread_cond_signal(&p->thread_cond);
@@ -102,6 +149,7 @@ void marshmallow_thread::release(int x, int y)
 	p->interaction.x = x;
 	p->interaction.y = y;
 	p->interaction.type = marshmallow_thread_private::sInteraction::RELEASE;
+	p->interaction.stamp_ns = monotonic_ns();
 	p->interaction.set = true;
 
 	pthread_cond_signal(&p->thread_cond);
@@ -113,14 +161,18 @@ void *marshmallow_thread::thread_handler(marshmallow_thread* self)
 	framebuffer_init();
 	event_pool_init();
 
+	/* MARSH_RENDER_THREAD=1 rasterizes the frames this thread publishes on another one. */
+	if (getenv("MARSH_RENDER_THREAD"))
+		render_thread_start();
+
 	widget_t *screen;
 	screen = widget_new(NULL, NULL, NULL, NULL);
-	widget_set_area(screen, 0, 0, 800, 480);
+	widget_set_area(screen, 0, 0, framebuffer_width(), framebuffer_height());
 
 	rectangle_t *bg = rectangle_new(screen);
 	rectangle_set_fill_color_html(bg, "#004000");
 	rectangle_set_position(bg, 5, 5);
-	rectangle_set_size(bg, 790, 470);
+	rectangle_set_size(bg, framebuffer_width() - 10, framebuffer_height() - 10);
 
 	rectangle_t *obj1 = rectangle_new(rectangle_get_widget(bg));
 	rectangle_t *obj2 = rectangle_new(rectangle_get_widget(bg));
@@ -224,14 +276,36 @@ void *marshmallow_thread::thread_handler(marshmallow_thread* self)
 	slot_connect(lena_slot, widget_click_signal(image_get_widget(lena)));
 
 	widget_tree_draw(screen);
-	framebuffer_inform_written_area(0, 0, framebuffer_width(), framebuffer_height());
+	if (!render_thread_publish())
+		framebuffer_inform_written_area(0, 0, framebuffer_width(), framebuffer_height());
 
 	self->main = screen;
 	self->root_pointer = self->main;
 
+	/* The loop sleeps until an interaction arrives, or for one frame period while
+	 * animations are running. Animation frames redraw and present their damage only. */
+	const uint64_t frame_period_ms = 16;
+	uint64_t last_frame_ms = monotonic_ms();
+
+	pthread_mutex_lock(&self->p->thread_mutex);
+
 	while (self->p->thread_running)
 	{
-		pthread_cond_wait(&self->p->thread_cond, &self->p->thread_mutex);
+		bool animating = animation_count() > 0;
+
+		if (animating)
+		{
+			struct timespec deadline;
+			uint64_t deadline_ms = last_frame_ms + frame_period_ms;
+
+			deadline.tv_sec = deadline_ms / 1000;
+			deadline.tv_nsec = (deadline_ms % 1000) * 1000000;
+			pthread_cond_timedwait(&self->p->thread_cond, &self->p->thread_mutex, &deadline);
+		}
+		else
+		{
+			pthread_cond_wait(&self->p->thread_cond, &self->p->thread_mutex);
+		}
 
 		if (self->p->interaction.set)
 		{
@@ -241,10 +315,56 @@ void *marshmallow_thread::thread_handler(marshmallow_thread* self)
 			else if (self->p->interaction.type == self->p->interaction.RELEASE)
 				widget_tree_release(self->root_pointer,
 						self->p->interaction.x, self->p->interaction.y);
+
+			self->p->interaction.set = false;
+
+			if (render_thread_running())
+			{
+				render_thread_mark_input(self->p->interaction.stamp_ns);
+			}
+			else
+			{
+				framebuffer_inform_written_area(0, 0, framebuffer_width(), framebuffer_height());
+
+				uint64_t latency_ns = monotonic_ns() - self->p->interaction.stamp_ns;
+				self->p->inputs++;
+				self->p->latency_ns += latency_ns;
+				if (latency_ns > self->p->max_latency_ns)
+					self->p->max_latency_ns = latency_ns;
+			}
 		}
 
-		framebuffer_inform_written_area(0, 0, framebuffer_width(), framebuffer_height());
-		pthread_mutex_unlock(&self->p->thread_mutex);
+		uint64_t now_ms = monotonic_ms();
+
+		/* Animations started by this interaction begin counting from now. */
+		if (!animating)
+			last_frame_ms = now_ms;
+
+		if (now_ms - last_frame_ms >= frame_period_ms || !animating)
+		{
+			animation_tick(self->root_pointer, now_ms - last_frame_ms);
+			last_frame_ms = now_ms;
+		}
+
+		/* End of the frame, the render thread presents it while the next input is handled. */
+		render_thread_publish();
+	}
+
+	pthread_mutex_unlock(&self->p->thread_mutex);
+	animation_stop_all();
+
+	if (render_thread_running())
+	{
+		render_thread_stats_t stats;
+
+		render_thread_flush();
+		render_thread_stats(&stats);
+		print_latency("Render thread", stats.inputs, stats.latency_ns, stats.max_latency_ns);
+		render_thread_stop();
+	}
+	else
+	{
+		print_latency("Serial", self->p->inputs, self->p->latency_ns, self->p->max_latency_ns);
 	}
 
 	text_delete(txt1);
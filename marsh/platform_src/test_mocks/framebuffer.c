@@ -23,81 +23,67 @@
 #include <string.h>
 
 #include "area.h"
+#include "framebuffer_geometry.h"
 
-#define FRAMEBUFFER_WIDTH  800UL
-#define FRAMEBUFFER_HEIGHT 480UL
+static framebuffer_geometry_t geometry;
+static size_t configured_width = FRAMEBUFFER_DEFAULT_WIDTH;
+static size_t configured_height = FRAMEBUFFER_DEFAULT_HEIGHT;
 
-#define PIXEL_PTR_LINE_INCREMENT_VAL   FRAMEBUFFER_WIDTH
-#define PIXEL_PTR_PIXEL_INCREMENT_VAL  1UL
-
-static pixel_t* pFb;
-
-static bool _fb_not_initd(void)
+bool framebuffer_configure(size_t width, size_t height)
 {
-	if (!pFb)
-		return true;
-	else
+	if (!framebuffer_geometry_valid(width, height))
 		return false;
+
+	configured_width = width;
+	configured_height = height;
+
+	return true;
 }
 
 void framebuffer_init()
 {
-	if (!_fb_not_initd())
-		free(pFb);
-
-	pFb = (pixel_t *) calloc(FRAMEBUFFER_HEIGHT * FRAMEBUFFER_WIDTH, sizeof(pixel_t));
+	framebuffer_geometry_init(&geometry, configured_width, configured_height);
 }
 
 void framebuffer_deinit()
 {
-	if (_fb_not_initd())
-		return;
-
-	if (pFb)
-		free(pFb);
-	pFb = NULL;
+	framebuffer_geometry_deinit(&geometry);
 }
 
 pixel_t* framebuffer_start()
 {
-	if (_fb_not_initd())
-		return NULL;
-
-	return pFb;
+	return geometry.pixels;
 }
 
-pixel_t* framebuffer_at(pixel_t x, pixel_t y)
+pixel_t* framebuffer_at(dim_t x, dim_t y)
 {
-	if (_fb_not_initd())
-		return NULL;
-
-	return pFb + x*PIXEL_PTR_PIXEL_INCREMENT_VAL + y*PIXEL_PTR_LINE_INCREMENT_VAL;
+	return framebuffer_geometry_at(&geometry, x, y);
 }
 
 size_t framebuffer_width()
 {
-	return FRAMEBUFFER_WIDTH;
+	return geometry.width;
 }
 
 size_t framebuffer_height()
 {
-	return FRAMEBUFFER_HEIGHT;
+	return geometry.height;
 }
 
-const area_t * framebuffer_area()
+size_t framebuffer_stride()
 {
-	static area_t ret;
-
-	area_set(&ret, 0, 0, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT);
+	return geometry.stride;
+}
 
-	return &ret;
+const area_t * framebuffer_area()
+{
+	return &geometry.area;
 }
 
 void framebuffer_inform_written_area(size_t x, size_t y, size_t width, size_t height)
 {
-	x = *(int*)&x;
-	y = *(int*)&y;
-	width = *(int*)&width;
-	height = *(int*)&height;
-}
+	area_t written;
 
+	area_set(&written, x, y, width, height);
+	framebuffer_ops_sync_area(&written);
+}
@@ -0,0 +1,376 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "animation.h"
+#include "area.h"
+#include "color.h"
+#include "widget.h"
+#include "widget_update.h"
+
+enum e_animation_property
+{
+	ANIMATION_POSITION,
+	ANIMATION_SIZE,
+	ANIMATION_COLOR,
+	ANIMATION_VALUE,
+	ANIMATION_FRAME
+};
+
+struct s_animation
+{
+	bool active;
+	enum e_animation_property property;
+	enum e_animation_easing easing;
+
+	widget_t * widget;
+	void * target;
+	animation_color_setter_f set_color;
+	animation_value_setter_f set_value;
+	animation_frame_f step;
+
+	/* Integer properties use both components, value animations the first only. */
+	int32_t from[2];
+	int32_t to[2];
+	int32_t current[2];
+
+	color_t from_color;
+	color_t to_color;
+	color_t current_color;
+
+	uint32_t elapsed_ms;
+	uint32_t duration_ms;
+};
+
+static struct s_animation pool[ANIMATION_POOL_SIZE];
+static size_t active_count = 0;
+
+static int32_t q16_mul(int32_t a, int32_t b)
+{
+	return (int32_t)(((int64_t)a * b) >> 16);
+}
+
+int32_t animation_ease(enum e_animation_easing easing, int32_t t)
+{
+	int32_t inv;
+
+	if (t <= 0)
+		return 0;
+	if (t >= ANIMATION_Q16_ONE)
+		return ANIMATION_Q16_ONE;
+
+	inv = ANIMATION_Q16_ONE - t;
+
+	switch (easing)
+	{
+	case ANIMATION_EASE_IN_QUAD:
+		return q16_mul(t, t);
+	case ANIMATION_EASE_OUT_QUAD:
+		return ANIMATION_Q16_ONE - q16_mul(inv, inv);
+	case ANIMATION_EASE_IN_OUT_QUAD:
+		if (t < ANIMATION_Q16_ONE / 2)
+			return 2 * q16_mul(t, t);
+		return ANIMATION_Q16_ONE - 2 * q16_mul(inv, inv);
+	case ANIMATION_EASE_IN_OUT_CUBIC:
+		if (t < ANIMATION_Q16_ONE / 2)
+			return 4 * q16_mul(q16_mul(t, t), t);
+		return ANIMATION_Q16_ONE - 4 * q16_mul(q16_mul(inv, inv), inv);
+	case ANIMATION_EASE_LINEAR:
+	default:
+		return t;
+	}
+}
+
+static int32_t interpolate(int32_t from, int32_t to, int32_t eased)
+{
+	/* Rounded to nearest, so the last frame lands exactly on the target. */
+	return from + (int32_t)(((int64_t)(to - from) * eased + ANIMATION_Q16_ONE / 2) >> 16);
+}
+
+static struct s_animation * find(widget_t * obj, enum e_animation_property property, void * target)
+{
+	size_t i;
+
+	for (i = 0; i < ANIMATION_POOL_SIZE; i++)
+	{
+		if (pool[i].active && pool[i].widget == obj && pool[i].property == property && pool[i].target == target)
+			return &pool[i];
+	}
+
+	return NULL;
+}
+
+static struct s_animation * alloc(widget_t * obj, enum e_animation_property property, void * target)
+{
+	struct s_animation * anim = find(obj, property, target);
+	size_t i;
+
+	if (anim)
+		return anim;
+
+	for (i = 0; i < ANIMATION_POOL_SIZE; i++)
+	{
+		if (!pool[i].active)
+		{
+			anim = &pool[i];
+			anim->active = true;
+			anim->widget = obj;
+			anim->property = property;
+			anim->target = target;
+			active_count++;
+			return anim;
+		}
+	}
+
+	LOG_ERROR("animation", "Animation pool exhausted.");
+
+	return NULL;
+}
+
+static void release(struct s_animation * anim)
+{
+	anim->active = false;
+	active_count--;
+}
+
+static void start(struct s_animation * anim, uint32_t duration_ms, enum e_animation_easing easing)
+{
+	anim->easing = easing;
+	anim->elapsed_ms = 0;
+	anim->duration_ms = duration_ms;
+}
+
+static bool animate_pair(widget_t * obj, enum e_animation_property property, int32_t from0, int32_t from1,
+		int32_t to0, int32_t to1, uint32_t duration_ms, enum e_animation_easing easing)
+{
+	struct s_animation * anim;
+
+	PTR_CHECK_RETURN(obj, "animation", false);
+
+	anim = alloc(obj, property, NULL);
+	if (!anim)
+		return false;
+
+	anim->from[0] = anim->current[0] = from0;
+	anim->from[1] = anim->current[1] = from1;
+	anim->to[0] = to0;
+	anim->to[1] = to1;
+	start(anim, duration_ms, easing);
+
+	return true;
+}
+
+bool animation_move(widget_t * obj, dim_t x, dim_t y, uint32_t duration_ms, enum e_animation_easing easing)
+{
+	PTR_CHECK_RETURN(obj, "animation", false);
+
+	return animate_pair(obj, ANIMATION_POSITION, widget_area(obj)->x, widget_area(obj)->y, x, y, duration_ms, easing);
+}
+
+bool animation_resize(widget_t * obj, dim_t width, dim_t height, uint32_t duration_ms, enum e_animation_easing easing)
+{
+	PTR_CHECK_RETURN(obj, "animation", false);
+
+	return animate_pair(obj, ANIMATION_SIZE, widget_area(obj)->width, widget_area(obj)->height, width, height, duration_ms, easing);
+}
+
+bool animation_color(widget_t * obj, void * target, animation_color_setter_f set_color,
+		color_t from, color_t to, uint32_t duration_ms, enum e_animation_easing easing)
+{
+	struct s_animation * anim;
+
+	PTR_CHECK_RETURN(obj, "animation", false);
+	PTR_CHECK_RETURN(set_color, "animation", false);
+
+	if (!color_check(from) || !color_check(to))
+	{
+		LOG_ERROR("animation", "Invalid color.");
+		return false;
+	}
+
+	anim = alloc(obj, ANIMATION_COLOR, target);
+	if (!anim)
+		return false;
+
+	anim->set_color = set_color;
+	anim->from_color = anim->current_color = from;
+	anim->to_color = to;
+	start(anim, duration_ms, easing);
+
+	return true;
+}
+
+bool animation_opacity(widget_t * obj, void * target, animation_color_setter_f set_color,
+		color_t color, color_t background, uint8_t from, uint8_t to, uint32_t duration_ms, enum e_animation_easing easing)
+{
+	return animation_color(obj, target, set_color,
+			color_alpha_blend(background, color, from),
+			color_alpha_blend(background, color, to),
+			duration_ms, easing);
+}
+
+bool animation_value(widget_t * obj, void * target, animation_value_setter_f set_value,
+		int32_t from, int32_t to, uint32_t duration_ms, enum e_animation_easing easing)
+{
+	struct s_animation * anim;
+
+	PTR_CHECK_RETURN(obj, "animation", false);
+	PTR_CHECK_RETURN(set_value, "animation", false);
+
+	anim = alloc(obj, ANIMATION_VALUE, target);
+	if (!anim)
+		return false;
+
+	anim->set_value = set_value;
+	anim->from[0] = anim->current[0] = from;
+	anim->to[0] = to;
+	start(anim, duration_ms, easing);
+
+	return true;
+}
+
+bool animation_frame(widget_t * obj, void * target, animation_frame_f step)
+{
+	struct s_animation * anim;
+
+	PTR_CHECK_RETURN(obj, "animation", false);
+	PTR_CHECK_RETURN(step, "animation", false);
+
+	anim = alloc(obj, ANIMATION_FRAME, target);
+	if (!anim)
+		return false;
+
+	anim->step = step;
+
+	return true;
+}
+
+static void step(struct s_animation * anim, uint32_t elapsed_ms)
+{
+	int32_t progress;
+	int32_t eased;
+	char html[COLOR_HTML_CODE_SIZE];
+
+	anim->elapsed_ms += elapsed_ms;
+
+	if (anim->elapsed_ms >= anim->duration_ms)
+		progress = ANIMATION_Q16_ONE;
+	else
+		progress = (int32_t)(((uint64_t)anim->elapsed_ms << 16) / anim->duration_ms);
+
+	eased = animation_ease(anim->easing, progress);
+
+	switch (anim->property)
+	{
+	case ANIMATION_POSITION:
+		anim->current[0] = interpolate(anim->from[0], anim->to[0], eased);
+		anim->current[1] = interpolate(anim->from[1], anim->to[1], eased);
+		widget_set_pos(anim->widget, anim->current[0], anim->current[1]);
+		break;
+	case ANIMATION_SIZE:
+		anim->current[0] = interpolate(anim->from[0], anim->to[0], eased);
+		anim->current[1] = interpolate(anim->from[1], anim->to[1], eased);
+		widget_set_dim(anim->widget, anim->current[0], anim->current[1]);
+		break;
+	case ANIMATION_COLOR:
+		anim->current_color = color_alpha_blend(anim->from_color, anim->to_color, (uint8_t)((eased * 255 + ANIMATION_Q16_ONE / 2) >> 16));
+		color_to_html(anim->current_color, html);
+		anim->set_color(anim->target, html);
+		break;
+	case ANIMATION_FRAME:
+		break;
+	case ANIMATION_VALUE:
+	default:
+		anim->current[0] = interpolate(anim->from[0], anim->to[0], eased);
+		anim->set_value(anim->target, anim->current[0]);
+		break;
+	}
+
+	if (progress == ANIMATION_Q16_ONE)
+		release(anim);
+}
+
+void animation_tick(widget_t * root, uint32_t elapsed_ms)
+{
+	size_t i;
+
+	PTR_CHECK(root, "animation");
+
+	bool interpolated = false;
+
+	if (!active_count)
+		return;
+
+	for (i = 0; i < ANIMATION_POOL_SIZE; i++)
+	{
+		if (!pool[i].active)
+			continue;
+
+		if (pool[i].property != ANIMATION_FRAME)
+			interpolated = true;
+		else if (!pool[i].step(pool[i].target, elapsed_ms) && pool[i].active)
+			release(&pool[i]);
+	}
+
+	if (!interpolated)
+		return;
+
+	widget_begin_update(root);
+
+	for (i = 0; i < ANIMATION_POOL_SIZE; i++)
+	{
+		if (pool[i].active && pool[i].property != ANIMATION_FRAME)
+			step(&pool[i], elapsed_ms);
+	}
+
+	widget_commit_update(root);
+}
+
+void animation_stop(widget_t * obj)
+{
+	size_t i;
+
+	if (!active_count)
+		return;
+
+	for (i = 0; i < ANIMATION_POOL_SIZE; i++)
+	{
+		if (pool[i].active && pool[i].widget == obj)
+			release(&pool[i]);
+	}
+}
+
+void animation_stop_all(void)
+{
+	size_t i;
+
+	for (i = 0; i < ANIMATION_POOL_SIZE; i++)
+		pool[i].active = false;
+
+	active_count = 0;
+}
+
+size_t animation_count(void)
+{
+	return active_count;
+}
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ANIMATION_H_
+#define ANIMATION_H_
+
+#include "types.h"
+
+/*
+ * Property animations.
+ *
+ * An animation interpolates a widget property from its current value to a target
+ * value along an easing curve, all math in Q16 fixed point. The UI loop calls
+ * animation_tick once per frame with the elapsed time: every active animation is
+ * stepped inside a single widget update transaction, so only the union of the old
+ * and new bounds of the animated widgets is redrawn, and properties that did not
+ * change in the frame cost only a compare.
+ *
+ * Animations live in a static pool and belong to a widget. Starting an animation on
+ * a property already animated restarts it from the current value, and deleting the
+ * widget stops its animations.
+ */
+
+#define ANIMATION_POOL_SIZE 64
+#define ANIMATION_Q16_ONE   0x10000
+
+enum e_animation_easing
+{
+	ANIMATION_EASE_LINEAR,
+	ANIMATION_EASE_IN_QUAD,
+	ANIMATION_EASE_OUT_QUAD,
+	ANIMATION_EASE_IN_OUT_QUAD,
+	ANIMATION_EASE_IN_OUT_CUBIC
+};
+
+/* Color setters are the creators' html setters, e.g. rectangle_set_fill_color_html. */
+typedef void (*animation_color_setter_f)(void * target, const char * html_color_code);
+typedef void (*animation_value_setter_f)(void * target, int32_t value);
+typedef bool (*animation_frame_f)(void * target, uint32_t elapsed_ms);
+
+bool animation_move(widget_t * obj, dim_t x, dim_t y, uint32_t duration_ms, enum e_animation_easing easing);
+bool animation_resize(widget_t * obj, dim_t width, dim_t height, uint32_t duration_ms, enum e_animation_easing easing);
+
+/* Animates a color of target, obj being the widget of target. */
+bool animation_color(widget_t * obj, void * target, animation_color_setter_f set_color,
+		color_t from, color_t to, uint32_t duration_ms, enum e_animation_easing easing);
+
+/* Widgets are opaque, opacity is rendered as color blended over a known background,
+ * 0 being background only and 255 the color only. */
+bool animation_opacity(widget_t * obj, void * target, animation_color_setter_f set_color,
+		color_t color, color_t background, uint8_t from, uint8_t to, uint32_t duration_ms, enum e_animation_easing easing);
+
+/* Animates any other integer property through a setter. */
+bool animation_value(widget_t * obj, void * target, animation_value_setter_f set_value,
+		int32_t from, int32_t to, uint32_t duration_ms, enum e_animation_easing easing);
+
+/* Physics driven motion (e.g. a fling) installs a step called on every tick until it
+ * returns false. Steps run before the tick transaction, so they may draw by themselves. */
+bool animation_frame(widget_t * obj, void * target, animation_frame_f step);
+
+void animation_tick(widget_t * root, uint32_t elapsed_ms);
+
+void animation_stop(widget_t * obj);
+void animation_stop_all(void);
+size_t animation_count(void);
+
+/* Maps a Q16 progress (0 to ANIMATION_Q16_ONE) through an easing curve. */
+int32_t animation_ease(enum e_animation_easing easing, int32_t progress);
+
+#endif /* ANIMATION_H_ */
@@ -162,6 +162,34 @@ void area_set_intersection(area_t *tgt, const area_t * first, const area_t * sec
     }
 }
 
+void area_set_union(area_t *tgt, const area_t * first, const area_t * second)
+{
+	dim_t x, y;
+
+	PTR_CHECK(tgt, "area");
+	PTR_CHECK(first, "area");
+	PTR_CHECK(second, "area");
+
+	if (!area_value(first))
+	{
+		*tgt = *second;
+		return;
+	}
+
+	if (!area_value(second))
+	{
+		*tgt = *first;
+		return;
+	}
+
+	x = get_smaller(first->x, second->x);
+	y = get_smaller(first->y, second->y);
+
+	area_set(tgt, x, y,
+			get_bigger(area_end_point(first).x, area_end_point(second).x) - x,
+			get_bigger(area_end_point(first).y, area_end_point(second).y) - y);
+}
+
 dim_t area_value(const area_t * area)
 {
 	PTR_CHECK_RETURN(area, "area", false);
@@ -43,6 +43,7 @@ point_t area_end_point_abs(const area_t * area);   //Always start point < end po
 
 bool area_intersects(const area_t * first, const area_t * second);
 void area_set_intersection(area_t *tgt, const area_t * first, const area_t * second);
+void area_set_union(area_t *tgt, const area_t * first, const area_t * second); //Smallest area containing both, empty areas are ignored.
 
 dim_t area_value(const area_t * area);
 
@@ -0,0 +1,414 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "helper/checks.h"
+#include "asset_pack.h"
+#include "bitmap_data/bitmap_data.h"
+#include "font_data/font_data.h"
+
+/* Where the first lookup of an entry left it, later ones not checking it again. */
+enum e_asset_state { ASSET_UNCHECKED, ASSET_BUILT, ASSET_BAD };
+
+/* What a lookup returns, built on the first one. */
+union u_asset
+{
+	struct s_bitmap bitmap;
+	struct s_font font;
+};
+
+struct s_asset_pack
+{
+	const uint8_t * base;
+	size_t size;
+	/* Bytes mapped by asset_pack_open, 0 for packs in memory. */
+	size_t mapped;
+
+	const struct s_asset_pack_header * header;
+	const struct s_asset_pack_entry * entries;
+	union u_asset * assets;
+	uint8_t * state;
+};
+
+uint32_t asset_pack_hash(const char * name)
+{
+	uint32_t hash = 2166136261u;
+
+	PTR_CHECK_RETURN(name, "asset_pack", 0);
+
+	while (*name)
+		hash = (hash ^ (uint8_t)*name++) * 16777619u;
+
+	return hash;
+}
+
+/* Whether size bytes at offset, aligned to align, are in the pack. */
+static bool in_pack(const asset_pack_t * pack, uint32_t offset, size_t size, size_t align)
+{
+	return offset <= pack->size && size <= pack->size - offset && offset % align == 0;
+}
+
+static bool check_header(asset_pack_t * pack)
+{
+	const struct s_asset_pack_header * header = (const struct s_asset_pack_header *)pack->base;
+
+	if (pack->size < sizeof(*header) || memcmp(header->magic, ASSET_PACK_MAGIC, sizeof(header->magic)))
+	{
+		LOG_ERROR("asset_pack", "Not an asset pack");
+		return false;
+	}
+
+	if (header->byte_order != ASSET_PACK_BYTE_ORDER || header->version != ASSET_PACK_VERSION
+			|| header->entry_size != sizeof(struct s_asset_pack_entry))
+	{
+		LOG_ERROR("asset_pack", "Asset pack of another version or byte order");
+		return false;
+	}
+
+	if (header->size > pack->size || header->entry_count > pack->size / sizeof(struct s_asset_pack_entry)
+			|| !in_pack(pack, header->entries, header->entry_count * sizeof(struct s_asset_pack_entry), 4)
+			|| header->names > header->size)
+	{
+		LOG_ERROR("asset_pack", "Truncated asset pack");
+		return false;
+	}
+
+	/* Anything past the pack is not looked at. */
+	pack->size = header->size;
+	pack->header = header;
+	pack->entries = (const struct s_asset_pack_entry *)(pack->base + header->entries);
+
+	return true;
+}
+
+/* Whether the runs of an 8BPP_RLE entry cover each row exactly and end in its data. */
+static bool rle_runs_fit(const asset_pack_t * pack, const struct s_asset_pack_entry * entry)
+{
+	const uint8_t * runs = pack->base + entry->data;
+	size_t used = 0, column, row;
+	uint8_t run = 0;
+
+	for (row = 0; row < entry->height; row++)
+	{
+		for (column = 0; column < entry->width; column += BITMAP_RLE_LENGTH(run))
+		{
+			if (used >= entry->data_size)
+				return false;
+			run = runs[used++];
+			if (BITMAP_RLE_KIND(run) == BITMAP_RLE_PARTIAL)
+				used += BITMAP_RLE_LENGTH(run);
+			else if (BITMAP_RLE_KIND(run) != BITMAP_RLE_TRANSPARENT && BITMAP_RLE_KIND(run) != BITMAP_RLE_OPAQUE)
+				return false;
+		}
+		if (column != entry->width || used > entry->data_size)
+			return false;
+	}
+
+	return true;
+}
+
+asset_pack_t * asset_pack_from_memory(const void * data, size_t size)
+{
+	asset_pack_t * pack;
+
+	PTR_CHECK_RETURN(data, "asset_pack", NULL);
+
+	if ((uintptr_t)data % ASSET_PACK_ALIGN)
+	{
+		LOG_ERROR("asset_pack", "Asset pack not aligned");
+		return NULL;
+	}
+
+	pack = (asset_pack_t *)malloc(sizeof(struct s_asset_pack));
+	MEMORY_ALLOC_CHECK_RETURN(pack, NULL);
+
+	pack->base = (const uint8_t *)data;
+	pack->size = size;
+	pack->mapped = 0;
+	pack->assets = NULL;
+	pack->state = NULL;
+
+	if (!check_header(pack))
+	{
+		free(pack);
+		return NULL;
+	}
+
+	/* One more so that empty packs allocate. */
+	pack->assets = (union u_asset *)malloc((pack->header->entry_count + 1) * sizeof(union u_asset));
+	pack->state = (uint8_t *)calloc(pack->header->entry_count + 1, sizeof(uint8_t));
+	if (!pack->assets || !pack->state)
+	{
+		LOG_ERROR("asset_pack", "Failed to alloc memory");
+		asset_pack_close(pack);
+		return NULL;
+	}
+
+	return pack;
+}
+
+asset_pack_t * asset_pack_open(const char * path)
+{
+	asset_pack_t * pack;
+	struct stat status;
+	void * data;
+	int file;
+
+	PTR_CHECK_RETURN(path, "asset_pack", NULL);
+
+	file = open(path, O_RDONLY);
+	if (file < 0)
+	{
+		LOG_ERROR("asset_pack", "Can't open the asset pack");
+		return NULL;
+	}
+
+	if (fstat(file, &status) || status.st_size <= 0)
+	{
+		LOG_ERROR("asset_pack", "Empty asset pack");
+		close(file);
+		return NULL;
+	}
+
+	/* Pages are read as they are touched, the mapping stays valid once closed. */
+	data = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (data == MAP_FAILED)
+	{
+		LOG_ERROR("asset_pack", "Can't map the asset pack");
+		return NULL;
+	}
+
+	pack = asset_pack_from_memory(data, (size_t)status.st_size);
+	if (!pack)
+	{
+		munmap(data, (size_t)status.st_size);
+		return NULL;
+	}
+
+	pack->mapped = (size_t)status.st_size;
+
+	return pack;
+}
+
+void asset_pack_close(asset_pack_t * pack)
+{
+	PTR_CHECK(pack, "asset_pack");
+
+	if (pack->mapped)
+		munmap((void *)pack->base, pack->mapped);
+
+	free(pack->assets);
+	free(pack->state);
+	free(pack);
+}
+
+/* Index of the entry named name of the kind, -1 if none. */
+static int32_t find(const asset_pack_t * pack, const char * name, enum e_asset_pack_kind kind)
+{
+	const uint32_t hash = asset_pack_hash(name);
+	const size_t length = strlen(name);
+	const struct s_asset_pack_entry * entry;
+	uint32_t low = 0, high = pack->header->entry_count, middle;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (pack->entries[middle].hash < hash)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	for (; low < pack->header->entry_count && pack->entries[low].hash == hash; low++)
+	{
+		entry = &pack->entries[low];
+		if (entry->kind == kind && in_pack(pack, entry->name, length + 1, 1)
+				&& !memcmp(pack->base + entry->name, name, length + 1))
+			return (int32_t)low;
+	}
+
+	return -1;
+}
+
+/* Bytes the pixels of a bitmap take at least. */
+static size_t bitmap_size(const struct s_asset_pack_entry * entry)
+{
+	const size_t pixels = (size_t)entry->width * entry->height;
+
+	switch ((enum e_bitmap_buffer_data_width)entry->layout)
+	{
+	case BITMAP_BUFFER_1BPP:
+		return (pixels + 7) / 8;
+	case BITMAP_BUFFER_8BPP:
+	case BITMAP_BUFFER_INDEXED8:
+		return pixels;
+	case BITMAP_BUFFER_16BPP:
+		return pixels * sizeof(uint16_t);
+	case BITMAP_BUFFER_NATIVE:
+		return pixels * sizeof(pixel_t);
+	case BITMAP_BUFFER_8BPP_RLE:
+		/* The runs are walked by rle_runs_fit. */
+		return 0;
+	case BITMAP_BUFFER_INDEXED4:
+		return (entry->width + 1) / 2 * (size_t)entry->height;
+	default:
+		return SIZE_MAX;
+	}
+}
+
+static bool native_layout(enum e_bitmap_buffer_data_width layout)
+{
+	return layout == BITMAP_BUFFER_NATIVE || layout == BITMAP_BUFFER_INDEXED4 || layout == BITMAP_BUFFER_INDEXED8;
+}
+
+bitmap_t * asset_pack_bitmap(asset_pack_t * pack, const char * name)
+{
+	const struct s_asset_pack_entry * entry;
+	enum e_bitmap_buffer_data_width layout;
+	size_t palette_size = 0, align = 1;
+	int32_t index;
+
+	PTR_CHECK_RETURN(pack, "asset_pack", NULL);
+	PTR_CHECK_RETURN(name, "asset_pack", NULL);
+
+	index = find(pack, name, ASSET_PACK_BITMAP);
+	if (index < 0)
+	{
+		LOG_ERROR("asset_pack", "No such bitmap in the asset pack");
+		return NULL;
+	}
+
+	if (pack->state[index] == ASSET_BUILT)
+		return &pack->assets[index].bitmap;
+	if (pack->state[index] == ASSET_BAD)
+	{
+		LOG_ERROR("asset_pack", "Bad bitmap in the asset pack");
+		return NULL;
+	}
+
+	entry = &pack->entries[index];
+	layout = (enum e_bitmap_buffer_data_width)entry->layout;
+
+	if (native_layout(layout) && entry->pixel_format != MARSH_PIXEL_FORMAT)
+	{
+		LOG_ERROR("asset_pack", "Bitmap packed for another MARSH_PIXEL_FORMAT");
+		pack->state[index] = ASSET_BAD;
+		return NULL;
+	}
+
+	if (layout == BITMAP_BUFFER_INDEXED4 || layout == BITMAP_BUFFER_INDEXED8)
+		palette_size = (layout == BITMAP_BUFFER_INDEXED4 ? 16 : 256) * sizeof(pixel_t);
+	if (layout == BITMAP_BUFFER_16BPP)
+		align = sizeof(uint16_t);
+	if (layout == BITMAP_BUFFER_NATIVE)
+		align = sizeof(pixel_t);
+
+	/* The runs are walked here rather than at open, so that only the pages of the
+	 * bitmaps looked up are read, and rather than at each draw, which trusts them. */
+	if (bitmap_size(entry) > entry->data_size || !in_pack(pack, entry->data, entry->data_size, align)
+			|| (palette_size && (entry->table_size < palette_size || !in_pack(pack, entry->table, palette_size, sizeof(pixel_t))))
+			|| (layout == BITMAP_BUFFER_8BPP_RLE && !rle_runs_fit(pack, entry)))
+	{
+		LOG_ERROR("asset_pack", "Bad bitmap in the asset pack");
+		pack->state[index] = ASSET_BAD;
+		return NULL;
+	}
+
+	{
+		const struct s_bitmap bitmap = {pack->base + entry->data, entry->width, entry->height,
+				(entry->flags & ASSET_PACK_SINGLE_CHANNEL) != 0, layout,
+				palette_size ? (const pixel_t *)(pack->base + entry->table) : NULL};
+
+		memcpy((void *)&pack->assets[index].bitmap, &bitmap, sizeof(bitmap));
+	}
+	pack->state[index] = ASSET_BUILT;
+
+	return &pack->assets[index].bitmap;
+}
+
+font_t * asset_pack_font(asset_pack_t * pack, const char * name)
+{
+	const struct s_asset_pack_entry * entry;
+	const uint16_t * index_list;
+	size_t glyph_size;
+	uint32_t glyphs = 0, c;
+	int32_t index;
+
+	PTR_CHECK_RETURN(pack, "asset_pack", NULL);
+	PTR_CHECK_RETURN(name, "asset_pack", NULL);
+
+	index = find(pack, name, ASSET_PACK_FONT);
+	if (index < 0)
+	{
+		LOG_ERROR("asset_pack", "No such font in the asset pack");
+		return NULL;
+	}
+
+	if (pack->state[index] == ASSET_BUILT)
+		return &pack->assets[index].font;
+	if (pack->state[index] == ASSET_BAD)
+	{
+		LOG_ERROR("asset_pack", "Bad font in the asset pack");
+		return NULL;
+	}
+
+	entry = &pack->entries[index];
+	glyph_size = (entry->layout == FONT_BUFFER_16BITS ? 2 : 1) * (size_t)entry->height;
+
+	if ((entry->layout != FONT_BUFFER_8BITS && entry->layout != FONT_BUFFER_16BITS) || entry->height > UINT8_MAX
+			|| entry->table_size < 256 * sizeof(uint16_t) || !in_pack(pack, entry->table, entry->table_size, sizeof(uint16_t))
+			|| !in_pack(pack, entry->widths, entry->widths_size, 1) || !in_pack(pack, entry->data, entry->data_size, 1))
+	{
+		LOG_ERROR("asset_pack", "Bad font in the asset pack");
+		pack->state[index] = ASSET_BAD;
+		return NULL;
+	}
+
+	/* Every char indexes a glyph and a width of the pack. */
+	index_list = (const uint16_t *)(pack->base + entry->table);
+	for (c = 0; c < 256; c++)
+		if (index_list[c] >= glyphs)
+			glyphs = index_list[c] + 1u;
+
+	if (glyphs > entry->widths_size || glyphs * glyph_size > entry->data_size)
+	{
+		LOG_ERROR("asset_pack", "Bad font in the asset pack");
+		pack->state[index] = ASSET_BAD;
+		return NULL;
+	}
+
+	{
+		const struct s_font font = {pack->base + entry->data, index_list, pack->base + entry->widths, (uint8_t)entry->height,
+				(enum e_buffer_data_width)entry->layout};
+
+		memcpy((void *)&pack->assets[index].font, &font, sizeof(font));
+	}
+	pack->state[index] = ASSET_BUILT;
+
+	return &pack->assets[index].font;
+}
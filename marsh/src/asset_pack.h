@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ASSET_PACK_H_
+#define ASSET_PACK_H_
+
+#include "types.h"
+
+/*
+ * Bitmaps and fonts in one binary file instead of compiled in arrays, as
+ * image_processor -pack writes them. The pack is little endian:
+ *
+ *   header     struct s_asset_pack_header, at 0
+ *   entries    struct s_asset_pack_entry each, sorted by the hash of their names
+ *   names      NUL terminated
+ *   payloads   as the library reads them, ASSET_PACK_ALIGN aligned, page aligned from
+ *              a page long, so a drawn payload shares no page with another
+ *
+ * asset_pack_open maps the file and checks the header only. A lookup reads the
+ * entries and names, checks the entry against the pack, walking the runs of 8BPP_RLE
+ * bitmaps, and returns a bitmap_t or a font_t pointing into the mapping, built once
+ * and valid until the pack is closed. An entry found bad is refused without another
+ * check. The pages of other payloads are first read when something is drawn from
+ * them.
+ */
+
+#define ASSET_PACK_MAGIC      "MPAK"
+#define ASSET_PACK_BYTE_ORDER 0x01020304u
+#define ASSET_PACK_VERSION    1
+#define ASSET_PACK_ALIGN      16
+#define ASSET_PACK_PAGE       4096
+
+enum e_asset_pack_kind { ASSET_PACK_BITMAP = 1, ASSET_PACK_FONT = 2 };
+
+/* pixel_format of payloads read the same by every MARSH_PIXEL_FORMAT. */
+#define ASSET_PACK_ANY_FORMAT 0xFFFF
+/* flags */
+#define ASSET_PACK_SINGLE_CHANNEL 0x0001
+
+struct s_asset_pack_header
+{
+	char magic[4];
+	uint32_t byte_order;
+	uint16_t version;
+	uint16_t entry_size;
+	uint32_t entry_count;
+	uint32_t entries;
+	uint32_t names;
+	uint32_t size;
+	uint32_t reserved;
+};
+
+/* Offsets count from the start of the pack. */
+struct s_asset_pack_entry
+{
+	/* asset_pack_hash of the name. */
+	uint32_t hash;
+	uint32_t name;
+	uint16_t kind;
+	/* enum e_bitmap_buffer_data_width of bitmaps, enum e_buffer_data_width of fonts. */
+	uint16_t layout;
+	/* PIXEL_FORMAT_* of NATIVE pixels and palettes, ASSET_PACK_ANY_FORMAT otherwise. */
+	uint16_t pixel_format;
+	uint16_t flags;
+	/* Bitmap size, fonts only have a height. */
+	uint32_t width;
+	uint32_t height;
+	uint32_t data;
+	uint32_t data_size;
+	/* Palette of indexed bitmaps, the index list of fonts. */
+	uint32_t table;
+	uint32_t table_size;
+	/* Width list of fonts. */
+	uint32_t widths;
+	uint32_t widths_size;
+};
+
+/* 32 bit FNV-1a of the name. */
+uint32_t asset_pack_hash(const char * name);
+
+/* NULL when the file can't be mapped or isn't a pack. */
+asset_pack_t * asset_pack_open(const char * path);
+/* A pack already in memory, e.g. linked in or in memory mapped flash, used in place. */
+asset_pack_t * asset_pack_from_memory(const void * data, size_t size);
+void asset_pack_close(asset_pack_t * pack);
+
+/* NULL when the pack has no such asset, or one it can't be read as. */
+bitmap_t * asset_pack_bitmap(asset_pack_t * pack, const char * name);
+font_t * asset_pack_font(asset_pack_t * pack, const char * name);
+
+#endif /* ASSET_PACK_H_ */
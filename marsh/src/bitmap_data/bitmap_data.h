@@ -24,7 +24,29 @@
 
 #include "types.h"
 
-enum e_bitmap_buffer_data_width { BITMAP_BUFFER_1BPP, BITMAP_BUFFER_8BPP, BITMAP_BUFFER_16BPP };
+/* 16BPP pixels are RGB565, NATIVE ones are in the framebuffer format the library is
+ * built for, see pixel_format.h. 8BPP_RLE is 8BPP alpha in runs, see below.
+ * INDEXED4 and INDEXED8 pixels are indices into the palette of the bitmap, INDEXED4
+ * ones two per byte, the first in the high nibble, rows starting on a byte. */
+enum e_bitmap_buffer_data_width { BITMAP_BUFFER_1BPP, BITMAP_BUFFER_8BPP, BITMAP_BUFFER_16BPP, BITMAP_BUFFER_NATIVE,
+	BITMAP_BUFFER_8BPP_RLE, BITMAP_BUFFER_INDEXED4, BITMAP_BUFFER_INDEXED8 };
+
+/*
+ * Alpha of BITMAP_BUFFER_8BPP_RLE icons, row after row in runs of transparent, opaque
+ * or partially covered pixels. A run starts with a byte holding its kind in the top
+ * two bits and its length minus one in the others. Partial runs are followed by their
+ * alpha bytes, no run spans two rows.
+ */
+#define BITMAP_RLE_TRANSPARENT 0x00
+#define BITMAP_RLE_OPAQUE      0x40
+#define BITMAP_RLE_PARTIAL     0x80
+#define BITMAP_RLE_MAX_LENGTH  64
+
+#define BITMAP_RLE_KIND(run)   ((run) & 0xC0)
+#define BITMAP_RLE_LENGTH(run) (((run) & 0x3F) + 1)
+
+/* Palette index of pixel number index of BITMAP_BUFFER_INDEXED4 data, rows padded. */
+#define BITMAP_INDEXED4_AT(indices, index) ((indices)[(index) >> 1] >> ((index) & 1 ? 0 : 4) & 0x0F)
 
 struct s_bitmap
 {
@@ -33,6 +55,18 @@ struct s_bitmap
 	const uint32_t height;
 	const bool single_channel;
 	enum e_bitmap_buffer_data_width bitmap_data_width;
+	/* Colors of the indexed bitmaps already in the framebuffer format, built with
+	 * PIXEL_PACK, 16 or 256 of them, the unused ones zero. NULL for the others. */
+	const pixel_t *palette;
+};
+
+/* Same picture at several sizes, largest first, all of one kind. image_processor
+ * -mip halves each level, so shrinking the level scale_pick_level picks is never by
+ * more than 2x. */
+struct s_bitmap_levels
+{
+	const bitmap_t * const *levels;
+	const uint32_t count;
 };
 
 #endif /* BITMAP_DATA_H_ */
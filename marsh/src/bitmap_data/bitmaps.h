@@ -25,6 +25,12 @@
 #include "types.h"
 
 extern const bitmap_t *wifi_icon_bitmap;
+extern const bitmap_t *wifi_icon_rle_bitmap;
 extern const bitmap_t *lena_bitmap;
+/* Same picture through 16 and 256 colors. */
+extern const bitmap_t *lena_indexed4_bitmap;
+extern const bitmap_t *lena_indexed8_bitmap;
+/* Lena at 128, 64 and 32 pixels. */
+extern const bitmap_levels_t *lena_levels;
 
 #endif /* BITMAPS_H_ */
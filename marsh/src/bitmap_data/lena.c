@@ -289,6 +289,7 @@ const struct s_bitmap _lena =
 	256,
 	false,
 	BITMAP_BUFFER_16BPP,
+	NULL,
 };
 
 const bitmap_t *lena_bitmap = &_lena;
@@ -0,0 +1,304 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "bitmap_data.h"
+#include "pixel_format.h"
+
+/* 16 colors by median cut, dithered. */
+static const pixel_t _lena_indexed4_palette[16] =
+{
+	PIXEL_PACK(0x54, 0x10, 0x37), PIXEL_PACK(0xCC, 0x74, 0x6D), PIXEL_PACK(0xAF, 0x43, 0x4C), PIXEL_PACK(0xC5, 0x7D, 0x7D),
+	PIXEL_PACK(0x6A, 0x21, 0x47), PIXEL_PACK(0xEC, 0xB9, 0x9A), PIXEL_PACK(0xDE, 0x87, 0x80), PIXEL_PACK(0xAE, 0x51, 0x61),
+	PIXEL_PACK(0xE2, 0x71, 0x68), PIXEL_PACK(0x71, 0x1D, 0x3A), PIXEL_PACK(0xEB, 0xC3, 0xB7), PIXEL_PACK(0xEC, 0x91, 0x73),
+	PIXEL_PACK(0xBC, 0x81, 0x96), PIXEL_PACK(0xCF, 0x5B, 0x5E), PIXEL_PACK(0x77, 0x38, 0x65), PIXEL_PACK(0xE0, 0x94, 0x91),
+};
+
+static const uint8_t _lena_indexed4_data[] =
+{
+	0x6B, 0x6B, 0x6B, 0xB6, 0xBB, 0x8B, 0x1B, 0x8B, 0x8B, 0xB6, 0xBB, 0xBB, 0xBB, 0xBB, 0x86, 0xD7, 0x22, 0x27, 0x27, 0x27, 0x72, 0x27, 0x72, 0x27, 0x27, 0x22, 0x72, 0xDD, 0x7D, 0xDD, 0xDD, 0xDD, 0xD1, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xD1, 0xD8, 0xDD, 0x8D, 0x8D, 0xD1, 0xD8, 0xDD, 0x8D, 0x8D, 0x18, 0x1D, 0x11, 0xDD, 0xDD, 0xDD, 0xD1, 0xD1, 0xDD, 0xD1, 0xDD, 0xD8, 0xDD, 0xDD, 0x88, 0xDD, 0xD1, 0xDD, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x7D, 0x7D, 0x72, 0x2D, 0xDD, 0x18, 0x68, 0xBB, 0xB8, 0x86, 0x8B, 0x16, 0xB8, 0xB6, 0x8B, 0x88, 0x88, 0x8B, 0x88, 0xB1, 0xB8, 0xB1, 0xB8, 0xBB, 0xB5, 0x55, 0x5A, 0x55, 0x51, 0x72, 0x72, 0x77, 0x77, 0xD7, 0xDD, 0x7D, 0x7D, 0x7D, 0x7D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x77, 0xDD, 0x1B, 0xB8,
+	0xB6, 0xB6, 0xB6, 0xB8, 0x68, 0xB1, 0xB8, 0x1B, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x68, 0x87, 0x2E, 0x2E, 0x27, 0x72, 0x77, 0x22, 0xD2, 0x77, 0x2D, 0x27, 0x2D, 0x2D, 0x7D, 0xD7, 0xDD, 0xDD, 0x1D, 0xDD, 0x1D, 0x1D, 0xDD, 0x1D, 0xDD, 0xD1, 0xD1, 0xDD, 0x1D, 0x1D, 0x1D, 0x1D, 0x8D, 0x8D, 0x1D, 0x8D, 0x8D, 0x11, 0xD1, 0xD1, 0xD1, 0xD1, 0xDD, 0x1D, 0x1D, 0xDD, 0x81, 0xD8, 0xDD, 0x1D, 0x1D, 0x1D, 0xD1, 0xD1, 0xDD, 0x1D, 0xDD, 0xD1, 0xD1, 0xD1, 0xDD, 0x1D, 0xD1, 0x7D, 0x77, 0x72, 0x72, 0xD1, 0x11, 0x86, 0xB6, 0xB6, 0x88, 0xB1, 0x88, 0x6B, 0x8B, 0x8B, 0x1B, 0x1B, 0x8B, 0x81, 0xB8, 0xB1, 0xBB, 0x1B, 0x1B, 0x55, 0x55, 0x55, 0x55, 0x5B, 0x22, 0x77, 0x7D, 0xDD, 0x7D, 0x7D, 0x71, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x71, 0x71, 0xD7, 0xDD, 0xDD, 0x77, 0x8F, 0xBB,
+	0x6B, 0x6B, 0x68, 0xB8, 0xBB, 0x1B, 0x1B, 0x8B, 0x8B, 0x8B, 0x6B, 0xBB, 0xBB, 0xBB, 0x88, 0xD7, 0x22, 0x22, 0x22, 0x77, 0x22, 0x72, 0x72, 0xD2, 0x22, 0x2D, 0x22, 0x7D, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0x1D, 0xDD, 0x1D, 0x1D, 0x1D, 0x8D, 0x8D, 0xD8, 0xD8, 0xDD, 0x8D, 0x1D, 0x8D, 0x81, 0xD1, 0xDD, 0x1D, 0x1D, 0xDD, 0xD1, 0xD1, 0xDD, 0xDD, 0x1D, 0xD1, 0xD8, 0xDD, 0xD8, 0xD1, 0xDD, 0xDD, 0x1D, 0xDD, 0xD1, 0xDD, 0x1D, 0xDD, 0xDD, 0xDD, 0xD1, 0x7D, 0x7D, 0x7D, 0x72, 0x2D, 0xD1, 0x81, 0x68, 0x6B, 0x8B, 0x1B, 0x1B, 0x8B, 0x18, 0xB8, 0xB1, 0xB8, 0x8B, 0x8B, 0x8B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0xB5, 0x55, 0x55, 0x55, 0x5B, 0x22, 0x27, 0x77, 0xD7, 0x12, 0xD7, 0xD7, 0x17, 0xD7, 0xD7, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD7, 0xDD, 0xD7, 0x7D, 0x7D, 0x1F, 0xF1,
+	0x6B, 0x8B, 0xBB, 0x8B, 0x18, 0xB8, 0x81, 0xB1, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xDD, 0x22, 0xE2, 0x22, 0x27, 0x22, 0x22, 0xD2, 0x22, 0xD2, 0x72, 0x2D, 0x2D, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0x1D, 0xD1, 0xDD, 0xDD, 0x1D, 0xDD, 0xD1, 0xD8, 0xD8, 0xD8, 0xD8, 0xDD, 0x8D, 0xDD, 0x8D, 0xD8, 0xDD, 0x1D, 0x1D, 0x1D, 0xD1, 0xD1, 0xDD, 0xDD, 0x1D, 0x1D, 0xDD, 0xDD, 0x8D, 0x8D, 0xD1, 0xDD, 0x1D, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0x1D, 0xDD, 0x7D, 0xDD, 0x7D, 0x77, 0x72, 0x27, 0x7D, 0x18, 0x86, 0x1B, 0xB1, 0xB1, 0x88, 0x1B, 0x8B, 0x1B, 0x18, 0xB1, 0xB1, 0xB8, 0xB8, 0x8B, 0x1B, 0x8B, 0x1B, 0x18, 0xB5, 0x55, 0x55, 0x55, 0x5B, 0x12, 0x27, 0x7D, 0x77, 0xD7, 0xD7, 0xD7, 0xD2, 0x12, 0x1D, 0xD7, 0xDD, 0x7D, 0xD7, 0xD7, 0x1D, 0x17, 0xDD, 0xD2, 0xDD, 0x17, 0x29,
+	0xB8, 0x68, 0x6B, 0x8B, 0xB8, 0xB1, 0xB8, 0x88, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0x81, 0xD2, 0x22, 0x2E, 0x22, 0x27, 0x27, 0x22, 0x22, 0x72, 0x27, 0x22, 0x72, 0xD2, 0xD7, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xD1, 0xDD, 0xDD, 0x1D, 0x8D, 0xD8, 0xDD, 0x8D, 0xD8, 0xD8, 0xD1, 0xD8, 0xDD, 0x1D, 0xDD, 0xDD, 0x1D, 0x1D, 0xDD, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0xDD, 0x1D, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD1, 0xDD, 0xD1, 0x7D, 0x7D, 0x7D, 0x72, 0x72, 0xDD, 0xD1, 0x1B, 0x8B, 0xBB, 0x8B, 0x1B, 0xB1, 0xB1, 0xB1, 0xB8, 0xB8, 0xB8, 0xB8, 0x8B, 0x1B, 0x1B, 0x1B, 0x8B, 0x81, 0xB5, 0x55, 0x55, 0x55, 0x55, 0xB2, 0x22, 0x27, 0x7D, 0x71, 0x21, 0x21, 0x21, 0x21, 0x2D, 0x1D, 0xDD, 0xDD, 0x71, 0xDD, 0xD7, 0xDD, 0xDD, 0xD1, 0xD7, 0x29, 0x00,
+	0x68, 0x6B, 0x8B, 0x8B, 0x8B, 0x8B, 0x1B, 0x1B, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0xD2, 0x72, 0x27, 0x22, 0x2D, 0x2D, 0x2D, 0x7D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0x8D, 0x8D, 0x8D, 0x1D, 0xD1, 0xDD, 0x8D, 0x1D, 0xD1, 0xD1, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0xD1, 0xDD, 0x8D, 0xD1, 0xDD, 0xD1, 0xDD, 0x1D, 0xD1, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x7D, 0x77, 0x72, 0x22, 0x77, 0x11, 0x11, 0x86, 0x8B, 0x1B, 0xB1, 0x8B, 0x1B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x1B, 0x8B, 0x1B, 0x81, 0xB1, 0x8B, 0x1B, 0x55, 0x55, 0x55, 0x55, 0x51, 0x22, 0x72, 0xD7, 0xD2, 0x17, 0xD7, 0xDD, 0x7D, 0x7D, 0x7D, 0x7D, 0x71, 0xD2, 0xDD, 0x1D, 0xDD, 0x1D, 0x1D, 0x22, 0x09, 0x04,
+	0xB6, 0x8B, 0x8B, 0x8B, 0x8B, 0x88, 0xB8, 0x88, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x8D, 0xDD, 0x22, 0x22, 0x22, 0x27, 0x72, 0x22, 0xD2, 0x22, 0x22, 0x22, 0x22, 0xD7, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xD8, 0xD8, 0xD1, 0xDD, 0xDD, 0xDD, 0xD8, 0xD1, 0xD8, 0xD8, 0xDD, 0x8D, 0xDD, 0xDD, 0x8D, 0x8D, 0x1D, 0x1D, 0xD1, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0xD8, 0xDD, 0x8D, 0x1D, 0x1D, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0xDD, 0x1D, 0xD1, 0x7D, 0xDD, 0x7D, 0x2D, 0x72, 0x22, 0xDD, 0x18, 0x8B, 0x6B, 0xB8, 0xB1, 0xB8, 0xBB, 0xBB, 0x8B, 0xB1, 0xB8, 0xB8, 0xB1, 0x8B, 0x81, 0xB8, 0x1B, 0x1B, 0x1B, 0xB5, 0x55, 0x55, 0x55, 0x5B, 0x72, 0x27, 0x27, 0xD7, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0xD2, 0xD1, 0xD2, 0xDD, 0x1D, 0xD1, 0xD7, 0x29, 0x00, 0x40,
+	0x8B, 0x8B, 0xB8, 0xB8, 0xB8, 0xBB, 0x8B, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0xD2, 0x22, 0xE2, 0x22, 0x22, 0x72, 0xD2, 0x72, 0x2D, 0x22, 0x27, 0xD2, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xDD, 0xD8, 0xDD, 0x8D, 0x8D, 0x8D, 0x8D, 0xDD, 0xD8, 0x8D, 0x1D, 0x8D, 0xD8, 0xD1, 0xD8, 0xD8, 0xDD, 0xD1, 0xDD, 0x1D, 0xD1, 0xDD, 0x8D, 0x1D, 0xD8, 0xDD, 0xDD, 0xD1, 0xDD, 0xDD, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0x7D, 0x77, 0x77, 0x7D, 0x22, 0xD1, 0x11, 0x61, 0xB8, 0xBB, 0x8B, 0xBB, 0x8B, 0x8B, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x8B, 0x8B, 0x1B, 0x88, 0x8B, 0xD1, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x12, 0x27, 0x22, 0x12, 0x71, 0x7D, 0x21, 0x21, 0x2D, 0xD2, 0x12, 0xD1, 0xD2, 0x1D, 0xDD, 0xDD, 0x1D, 0x72, 0x00, 0x90, 0x04,
+	0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x8B, 0x88, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0x72, 0x22, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0xD8, 0xDD, 0x8D, 0x1D, 0x8D, 0x8D, 0xD8, 0xDD, 0xD8, 0xDD, 0x8D, 0xD8, 0xDD, 0x88, 0xDD, 0xD1, 0xDD, 0xDD, 0xD8, 0xD8, 0xD8, 0xDD, 0xDD, 0x1D, 0x1D, 0x88, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0xD1, 0xDD, 0xDD, 0x1D, 0x1D, 0xD1, 0xD2, 0xDD, 0x27, 0x72, 0x7D, 0x18, 0x18, 0x6B, 0xBB, 0xB1, 0xBB, 0xBB, 0xB8, 0xBB, 0x8B, 0xB8, 0xB8, 0xB8, 0x1B, 0x18, 0x81, 0xB1, 0xB1, 0xB1, 0xBB, 0x55, 0x55, 0x55, 0xA5, 0x51, 0x22, 0x21, 0x27, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1D, 0xDD, 0xD2, 0xDD, 0xDD, 0x1D, 0xD1, 0x17, 0x99, 0x00, 0x09, 0x00,
+	0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0xB8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0xDD, 0x22, 0x92, 0x22, 0x22, 0x72, 0xD2, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xD2, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0x8D, 0xD8, 0xD8, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0xD8, 0xD8, 0xD8, 0xD1, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0xDD, 0x8D, 0x81, 0x8D, 0x8D, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x7D, 0x7D, 0x77, 0x72, 0x27, 0x2D, 0x11, 0x16, 0x81, 0xBB, 0xBB, 0x8B, 0x8B, 0xBB, 0x8B, 0xB8, 0xB8, 0xBB, 0x8B, 0x8B, 0x8B, 0x8B, 0x88, 0x18, 0xB1, 0x1B, 0xB5, 0x55, 0x55, 0x55, 0x5B, 0x22, 0x22, 0x21, 0x2D, 0x7D, 0x71, 0x21, 0x21, 0x2D, 0xD1, 0xD1, 0xD1, 0xDD, 0xD1, 0x1D, 0x72, 0x09, 0x09, 0x00, 0x00,
+	0xB8, 0xB8, 0xB8, 0xBB, 0x8B, 0x8B, 0xB1, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB, 0x8B, 0x8B, 0x88, 0xD2, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x72, 0xD2, 0x2D, 0x22, 0xD2, 0xD2, 0xDD, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0x8D, 0x8D, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0x8D, 0xD8, 0xDD, 0x8D, 0xDD, 0x8D, 0xD8, 0xD8, 0xDD, 0xD8, 0xD8, 0xDD, 0x1D, 0xD1, 0xDD, 0x8D, 0x18, 0xD1, 0xDD, 0x8D, 0xDD, 0xDD, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD1, 0xDD, 0xD1, 0x7D, 0x2D, 0x77, 0x22, 0x72, 0xD1, 0x88, 0x6B, 0xB6, 0xBB, 0xB8, 0xBB, 0x1B, 0xBB, 0x8B, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x18, 0xB1, 0xB8, 0x88, 0xB1, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x12, 0x21, 0x22, 0x71, 0x21, 0x21, 0x21, 0xDD, 0xD2, 0x12, 0x1D, 0xD2, 0x1D, 0x11, 0xD7, 0x99, 0x00, 0x90, 0x40, 0x00,
+	0x8B, 0x8B, 0x8B, 0x8B, 0xB8, 0xB8, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0x8B, 0xBB, 0xB8, 0x88, 0xDD, 0x22, 0x92, 0x22, 0x22, 0x22, 0x72, 0xD2, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x2D, 0x2D, 0x21, 0xDD, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0xD8, 0xD8, 0xDD, 0x8D, 0xD8, 0xD8, 0xDD, 0xDD, 0xD8, 0xDD, 0xD8, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0xDD, 0xDD, 0x1D, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD7, 0xDD, 0xD7, 0xD2, 0x7D, 0x72, 0x2D, 0xD1, 0x16, 0x66, 0x8B, 0x68, 0xBB, 0xB8, 0xBB, 0x8B, 0xB8, 0xBB, 0x8B, 0x1B, 0x8B, 0x8B, 0x81, 0xB8, 0x1B, 0x1B, 0xD1, 0xBB, 0x55, 0x55, 0x55, 0x55, 0xB2, 0x22, 0x21, 0x27, 0xD2, 0x12, 0x12, 0xD2, 0x12, 0x11, 0x21, 0x11, 0x8D, 0x18, 0x79, 0x99, 0x04, 0x40, 0x40, 0x90,
+	0xB8, 0xB8, 0xB8, 0xB8, 0xBB, 0x8B, 0x1B, 0xBB, 0xBB, 0xBB, 0xB8, 0xBB, 0x8B, 0x88, 0x88, 0xD2, 0x22, 0x29, 0x22, 0x22, 0x72, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0x8D, 0x8D, 0xD8, 0xD8, 0xDD, 0x8D, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0x1D, 0x1D, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD7, 0x1D, 0x77, 0x27, 0x22, 0x7D, 0x71, 0x88, 0x66, 0xB6, 0xBB, 0xB1, 0xBB, 0xBB, 0xBB, 0x1B, 0x88, 0x1B, 0x8B, 0x8B, 0x81, 0xB8, 0x1B, 0xDB, 0x81, 0xB1, 0xBB, 0x55, 0x55, 0x55, 0x55, 0x5B, 0x22, 0x22, 0x12, 0x12, 0xDD, 0xD2, 0x12, 0x12, 0x12, 0x1D, 0x21, 0xD1, 0x17, 0x29, 0x90, 0x04, 0x00, 0x04, 0x09,
+	0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0xB8, 0xBB, 0x8B, 0xBB, 0xBB, 0x8B, 0xB8, 0xBB, 0xB8, 0x8D, 0xD2, 0x29, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xD2, 0xD2, 0xD2, 0x22, 0xD2, 0x2D, 0xD2, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0x8D, 0x8D, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD1, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x12, 0xDD, 0x7D, 0x72, 0xD2, 0x2D, 0xD1, 0x18, 0x68, 0x6B, 0x6B, 0xBB, 0xB8, 0xB1, 0xB8, 0xBB, 0xBB, 0x8B, 0x1B, 0xB8, 0xB8, 0x1B, 0x88, 0x8B, 0x88, 0x81, 0x11, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x22, 0x72, 0x12, 0x21, 0x21, 0xD1, 0x21, 0x21, 0x21, 0x21, 0x11, 0x11, 0x29, 0x09, 0x00, 0x00, 0x00, 0x04, 0x09,
+	0xB8, 0xB8, 0xBB, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x8B, 0x8B, 0x8B, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0xDD, 0x8D, 0x8D, 0xDD, 0x8D, 0xDD, 0x8D, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0xD1, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD7, 0xD2, 0x72, 0x72, 0x77, 0xDD, 0x18, 0x66, 0x66, 0xB6, 0xB8, 0xBB, 0xB8, 0xBB, 0x8B, 0x8B, 0xB1, 0xB8, 0xB8, 0x8B, 0x1B, 0x1B, 0x18, 0xB1, 0x8B, 0x1B, 0xBB, 0x55, 0x55, 0x55, 0x55, 0xB2, 0x22, 0x21, 0x21, 0xD2, 0x12, 0x12, 0x12, 0x1D, 0xDD, 0xD1, 0xD2, 0x29, 0x00, 0x90, 0x00, 0x04, 0x04, 0x94,
+	0xB8, 0xBB, 0x8B, 0x8B, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0x8B, 0x8B, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x22, 0x72, 0x22, 0xD2, 0x2D, 0x2D, 0xDD, 0x28, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xDD, 0x8D, 0xD8, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xD8, 0xDD, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD1, 0xD1, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xD7, 0xDD, 0xD7, 0xD7, 0x7D, 0x7D, 0x1D, 0x38, 0x66, 0x86, 0x6B, 0x1B, 0x68, 0xBB, 0x8B, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB1, 0xBB, 0x1B, 0xB1, 0x8B, 0x8D, 0x11, 0x1B, 0x55, 0x55, 0x55, 0x55, 0x51, 0x21, 0x27, 0x21, 0x21, 0x21, 0x2D, 0x21, 0x21, 0xD1, 0xD1, 0x79, 0x00, 0x90, 0x00, 0x00, 0x00, 0x40, 0x04,
+	0x8B, 0x8B, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x8B, 0xB8, 0xB8, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x72, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0xDD, 0xDD, 0x8D, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x1D, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x2D, 0x2D, 0x22, 0x22, 0x72, 0xD1, 0xD3, 0x86, 0x66, 0x6B, 0x6B, 0xBB, 0x1B, 0xB8, 0xBB, 0x8B, 0x8B, 0xB8, 0xB8, 0xBB, 0xDB, 0x1B, 0x8B, 0x88, 0xB8, 0xB1, 0x8B, 0xB5, 0x55, 0x55, 0x5A, 0x55, 0x12, 0x27, 0x12, 0x21, 0x21, 0x21, 0xDD, 0xDD, 0xD1, 0xD7, 0x99, 0x00, 0x90, 0x00, 0x40, 0x44, 0x09, 0x44,
+	0xB8, 0xBB, 0xBB, 0xB8, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0x22, 0xD2, 0x22, 0x22, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xD2, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0x2D, 0x2D, 0xDD, 0xD8, 0x1D, 0x8D, 0xD1, 0xDD, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xD7, 0xD2, 0xDD, 0xD1, 0x88, 0x88, 0x68, 0xB6, 0x68, 0x61, 0xBB, 0x8B, 0x8B, 0xB8, 0xB8, 0xB1, 0xB8, 0xB8, 0xBB, 0x8B, 0x8B, 0x18, 0x18, 0x18, 0x8B, 0xBB, 0x55, 0x55, 0x55, 0x55, 0x12, 0x22, 0x21, 0x21, 0x2D, 0xD2, 0xDD, 0xD1, 0x11, 0x29, 0x90, 0x00, 0x09, 0x44, 0x04, 0x04, 0x09, 0x04,
+	0xBB, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x8D, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x22, 0xD2, 0xD2, 0xDD, 0x2D, 0x2D, 0x28, 0x28, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0xDD, 0x1D, 0x1D, 0xDD, 0x1D, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xDD, 0x2D, 0x2D, 0x7D, 0x22, 0x77, 0xDD, 0x11, 0x86, 0x86, 0x86, 0x8B, 0xBB, 0xB8, 0xBB, 0x8B, 0x8B, 0x8B, 0x1B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x1B, 0x8B, 0x81, 0x8D, 0xBB, 0x55, 0x55, 0x5A, 0x55, 0x51, 0x22, 0x22, 0x22, 0x12, 0x1D, 0xDD, 0x1D, 0xD2, 0x99, 0x00, 0x00, 0x04, 0x04, 0x44, 0x09, 0x09, 0x09,
+	0xB8, 0xB8, 0xBB, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0x8B, 0xB8, 0xBB, 0xBB, 0x8B, 0xB8, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x2D, 0x2D, 0xDD, 0x2D, 0xD1, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x27, 0xD2, 0x7D, 0x7D, 0xD8, 0x38, 0x68, 0x68, 0x66, 0x16, 0x8B, 0x1B, 0xB1, 0xB8, 0xB1, 0xB1, 0xB8, 0xB8, 0xB8, 0xB8, 0xB1, 0x88, 0x18, 0x81, 0x81, 0x1B, 0x55, 0x55, 0x5A, 0xA5, 0x51, 0x22, 0x21, 0x21, 0x21, 0x21, 0xD1, 0xD1, 0x29, 0x99, 0x00, 0x09, 0x44, 0x44, 0x04, 0x04, 0x09, 0x00,
+	0xBB, 0xBB, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0x8B, 0xBB, 0x8B, 0xB8, 0xB8, 0xBB, 0x88, 0x8D, 0xD2, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0xD2, 0xDD, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xD2, 0xDD, 0xD2, 0xDD, 0xDD, 0x28, 0xDD, 0xDD, 0x1D, 0xDD, 0xD1, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xD2, 0xD2, 0xD2, 0xD7, 0x2D, 0xDD, 0x18, 0x88, 0x38, 0x68, 0x68, 0xB6, 0xB1, 0xB8, 0x8B, 0x1B, 0x8B, 0x1B, 0x8B, 0x8B, 0x8B, 0x88, 0x8B, 0x88, 0xB1, 0x88, 0x1B, 0x1B, 0xB5, 0x55, 0x55, 0xAA, 0x55, 0x12, 0x22, 0x22, 0x22, 0x12, 0x21, 0x12, 0x99, 0x90, 0x00, 0x90, 0x44, 0x44, 0x44, 0x00, 0x90, 0x00,
+	0xB8, 0xB8, 0xBB, 0x8B, 0xBB, 0xBB, 0xB8, 0xB8, 0xB8, 0xBB, 0x8B, 0x8B, 0x8B, 0xBB, 0x88, 0xD2, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0xD2, 0x8D, 0xDD, 0x2D, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0x8D, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0x2D, 0x22, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xDD, 0xDD, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xD7, 0x22, 0xD7, 0xDD, 0xD3, 0xD3, 0x86, 0x86, 0x86, 0x1B, 0x1B, 0x1B, 0x1B, 0x81, 0xB1, 0xB8, 0xB8, 0xB8, 0xB8, 0x8B, 0x18, 0x1B, 0xDB, 0x18, 0x1D, 0x11, 0xBB, 0x55, 0x55, 0x55, 0xA5, 0xB2, 0x22, 0x21, 0x21, 0x21, 0x11, 0x29, 0x99, 0x00, 0x00, 0x04, 0x44, 0x00, 0x40, 0x40, 0x00, 0x90,
+	0xBB, 0xBB, 0x8B, 0xBB, 0xBB, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xBB, 0xB8, 0xBB, 0x88, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x22, 0x2D, 0x22, 0xD2, 0xD2, 0xDD, 0x2D, 0x28, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xD2, 0x8D, 0x88, 0x1D, 0x12, 0x12, 0x12, 0x12, 0xDD, 0xDD, 0xDD, 0x1D, 0xDD, 0x1D, 0xD1, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xD2, 0xD2, 0xD7, 0xD2, 0x27, 0xDD, 0x1D, 0x88, 0x88, 0x88, 0x68, 0x68, 0xB1, 0xB8, 0xB1, 0xB8, 0xB1, 0x8B, 0x88, 0xB8, 0x8B, 0x88, 0x8B, 0xD8, 0x88, 0xD8, 0x11, 0x81, 0xBB, 0x55, 0x55, 0xA5, 0xA5, 0x51, 0x22, 0x22, 0x22, 0x12, 0x12, 0x99, 0x00, 0x00, 0x94, 0x40, 0x44, 0x40, 0x44, 0x00, 0x90, 0x09,
+	0xB8, 0x6B, 0x8B, 0x8B, 0xBB, 0xB8, 0xB8, 0x88, 0xB8, 0xBB, 0xB8, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x22, 0xD2, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0xDD, 0x8D, 0x8D, 0x8D, 0x8D, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0x8D, 0xD8, 0xD8, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0x11, 0x21, 0x22, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0x8D, 0xDD, 0x2D, 0x2D, 0x27, 0x2D, 0x7D, 0xD1, 0x83, 0x81, 0x81, 0x68, 0x61, 0xB1, 0xB1, 0x88, 0x1B, 0x1B, 0x8B, 0x8B, 0x8B, 0x8B, 0xDB, 0x18, 0x88, 0x88, 0x18, 0x18, 0x11, 0xDB, 0xB5, 0x55, 0x5A, 0x55, 0x55, 0x22, 0x12, 0x12, 0x17, 0x79, 0x99, 0x00, 0x00, 0x04, 0x04, 0x44, 0x44, 0x04, 0x00, 0x00, 0x90,
+	0xBB, 0xB8, 0xBB, 0xBB, 0xBB, 0x8B, 0x88, 0x88, 0x88, 0xB8, 0xBB, 0x88, 0xBB, 0x8B, 0x88, 0xDD, 0x22, 0x92, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0x81, 0x81, 0x1B, 0xB3, 0x5F, 0x5C, 0x5C, 0x55, 0x55, 0x5B, 0xB1, 0x11, 0x22, 0xD7, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0x1D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xD2, 0xD2, 0xD7, 0xD2, 0xD2, 0xDD, 0x18, 0xD8, 0x11, 0x88, 0x68, 0x68, 0xBB, 0x8B, 0x8B, 0x88, 0x88, 0xB8, 0xB8, 0x8B, 0x88, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x81, 0x8B, 0xB5, 0x55, 0x55, 0x5A, 0x55, 0xB2, 0x22, 0x21, 0x77, 0x99, 0x00, 0x09, 0x04, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x90, 0x90,
+	0xB6, 0xBB, 0x8B, 0xBB, 0xBB, 0x88, 0x88, 0x88, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0x8D, 0x8D, 0xDD, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0xD8, 0x86, 0x13, 0x36, 0x33, 0x6F, 0xC5, 0x3C, 0x55, 0xC5, 0x5C, 0x5C, 0x55, 0x55, 0x5B, 0x31, 0x72, 0x71, 0xDD, 0x7D, 0xD8, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xD2, 0x22, 0x2D, 0x7D, 0xD1, 0x88, 0x81, 0x18, 0x11, 0x86, 0x1B, 0x8B, 0x18, 0xB8, 0xB1, 0x8B, 0x8B, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0xD8, 0x11, 0x81, 0x88, 0xBB, 0x55, 0x5A, 0x5A, 0x55, 0x51, 0x21, 0x17, 0x79, 0x90, 0x00, 0x00, 0x00, 0x44, 0x04, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00,
+	0xB8, 0xB8, 0xBB, 0xBB, 0xBB, 0x88, 0x88, 0x88, 0x88, 0xBB, 0xB8, 0xB8, 0xBB, 0x8B, 0x88, 0xD2, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0x2D, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x81, 0x36, 0x33, 0x33, 0x36, 0xC5, 0xCF, 0xC5, 0xCA, 0x5C, 0x5C, 0x5C, 0x5C, 0x55, 0x55, 0x55, 0xF3, 0xD2, 0x7D, 0x1D, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0x2D, 0x2D, 0x2D, 0x2D, 0x7D, 0x22, 0x22, 0xDD, 0xD8, 0x81, 0x86, 0x81, 0x86, 0x86, 0x86, 0x88, 0xB1, 0x8B, 0x8B, 0x88, 0x88, 0x8B, 0x88, 0x88, 0x8D, 0x8D, 0x18, 0x8D, 0x81, 0x88, 0xD8, 0xBB, 0x55, 0x55, 0x5A, 0x55, 0x5B, 0x27, 0x17, 0x99, 0x00, 0x00, 0x00, 0x04, 0x04, 0x40, 0x44, 0x00, 0x04, 0x00, 0x90, 0x00,
+	0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xDD, 0x8D, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0x8B, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0x88, 0x13, 0x36, 0x33, 0x33, 0x3F, 0xCF, 0xFC, 0x5C, 0x5C, 0xAC, 0x5C, 0x5C, 0x5C, 0x5C, 0x55, 0x5A, 0x55, 0x51, 0x27, 0x27, 0x7D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xDD, 0x28, 0xDD, 0xDD, 0xDD, 0x2D, 0x2D, 0x27, 0xD2, 0xDD, 0x11, 0x88, 0x88, 0x81, 0x81, 0x86, 0x86, 0x8B, 0x8B, 0x18, 0x18, 0x18, 0xB8, 0x88, 0x88, 0x18, 0x8B, 0xDB, 0xDD, 0x18, 0x1D, 0x88, 0x81, 0x18, 0xB5, 0x55, 0xA5, 0xA5, 0x55, 0xB2, 0x74, 0x90, 0x00, 0x00, 0x04, 0x00, 0x44, 0x04, 0x04, 0x04, 0x40, 0x44, 0x09, 0x09,
+	0xB8, 0xB8, 0xBB, 0xBB, 0x88, 0x88, 0xDD, 0xD8, 0x8B, 0xBB, 0xB8, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x18, 0xDD, 0xD8, 0x86, 0x33, 0x6C, 0x31, 0x33, 0xC3, 0x3C, 0xCF, 0xC5, 0xC5, 0xC5, 0x5C, 0x5C, 0x55, 0x55, 0xCA, 0xC5, 0xAA, 0x55, 0xC1, 0x72, 0x7D, 0x1D, 0xD1, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x2D, 0x2D, 0x2D, 0x2D, 0x72, 0x2D, 0xDD, 0xD8, 0x88, 0x38, 0x81, 0x18, 0x68, 0x18, 0x68, 0xB8, 0x88, 0x8B, 0x88, 0x81, 0x88, 0x18, 0x88, 0x88, 0x8D, 0x18, 0x8D, 0x81, 0x8D, 0x8D, 0x81, 0xBB, 0x55, 0x5A, 0x5A, 0x55, 0x57, 0x99, 0x90, 0x00, 0x00, 0x04, 0x44, 0x40, 0x44, 0x40, 0x00, 0x44, 0x00, 0x00, 0x00,
+	0xB8, 0xBB, 0xBB, 0xBB, 0x88, 0x8D, 0xDD, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0x8B, 0xB8, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xDD, 0xD2, 0xD2, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xD8, 0xDD, 0xDD, 0xD8, 0x81, 0x11, 0xD1, 0xD1, 0x13, 0x13, 0x31, 0x33, 0xC6, 0x33, 0x33, 0x35, 0xCC, 0xC5, 0xC5, 0xC5, 0x5C, 0x5C, 0x5C, 0xA5, 0xAA, 0x5A, 0xAA, 0xA5, 0x37, 0x27, 0x7D, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0x2D, 0xD2, 0xD2, 0xD2, 0x72, 0x72, 0xD2, 0xDD, 0xD1, 0x88, 0x88, 0x88, 0x16, 0x86, 0x86, 0x86, 0x81, 0xB8, 0x18, 0x81, 0x88, 0x88, 0x88, 0x88, 0x18, 0xD8, 0x18, 0x11, 0x88, 0x88, 0x81, 0x81, 0x1B, 0x55, 0xAA, 0xAA, 0x55, 0x53, 0x90, 0x00, 0x00, 0x00, 0x44, 0x00, 0x44, 0x40, 0x00, 0x40, 0x40, 0x40, 0x00, 0x90,
+	0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xDD, 0x2D, 0xD8, 0xB8, 0xBB, 0xB8, 0xBB, 0xBB, 0x8B, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x88, 0xBB, 0x11, 0x1D, 0x77, 0x71, 0x73, 0x73, 0x73, 0x13, 0x13, 0x36, 0xCF, 0x3F, 0x53, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0xA5, 0x5C, 0xAC, 0xAA, 0xAC, 0x5A, 0x5F, 0x17, 0x72, 0x77, 0xD1, 0xDD, 0xDD, 0xD2, 0xDD, 0xD2, 0xD2, 0xD2, 0xD2, 0xD7, 0x22, 0x2D, 0x2D, 0x8D, 0x86, 0x88, 0x68, 0x88, 0x68, 0x88, 0x68, 0x8B, 0x88, 0x88, 0x88, 0x88, 0x81, 0xB8, 0x18, 0x88, 0x88, 0x8D, 0x88, 0xD8, 0x88, 0x81, 0xD8, 0x1B, 0xB5, 0x55, 0xA5, 0xA5, 0xA1, 0x00, 0x09, 0x00, 0x40, 0x09, 0x90, 0x40, 0x40, 0x40, 0x04, 0x40, 0x00, 0x40, 0x44,
+	0xBB, 0xBB, 0xBB, 0x8B, 0x88, 0xD2, 0x2D, 0xD8, 0x8B, 0xBB, 0xBB, 0x8B, 0xBB, 0xB8, 0xB8, 0xD2, 0x22, 0x92, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0x88, 0xD1, 0xDD, 0x71, 0x17, 0x17, 0x33, 0x37, 0x37, 0x31, 0x13, 0x33, 0x63, 0xF3, 0x3F, 0xC5, 0xCC, 0x55, 0x5C, 0xA5, 0x5C, 0xA5, 0x5A, 0xCA, 0x5A, 0xAA, 0xA5, 0x51, 0x77, 0xD2, 0x7D, 0x2D, 0xD2, 0xDD, 0xDD, 0x2D, 0xDD, 0x2D, 0x2D, 0x27, 0x22, 0x22, 0xDD, 0xD8, 0x88, 0x18, 0x81, 0x88, 0x18, 0x38, 0x16, 0x88, 0x8B, 0x18, 0x18, 0x81, 0x88, 0x88, 0x88, 0x88, 0x18, 0x88, 0x88, 0x88, 0x8D, 0x88, 0x8D, 0x88, 0xB5, 0x55, 0xAA, 0xAA, 0x59, 0x00, 0x00, 0x00, 0x40, 0x44, 0x09, 0x44, 0x00, 0x00, 0x44, 0x00, 0x00, 0x04, 0x04,
+	0xBB, 0xBB, 0xBB, 0x88, 0x8D, 0x22, 0x22, 0xD8, 0x8B, 0x8B, 0xBB, 0xBB, 0xB8, 0xB8, 0x88, 0xDD, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x2D, 0xDB, 0x8D, 0x2D, 0xDD, 0x77, 0x12, 0x71, 0x73, 0x73, 0x73, 0x73, 0x13, 0xD3, 0x33, 0x33, 0xFC, 0x3C, 0x53, 0x5C, 0x5C, 0x5A, 0x5C, 0xA5, 0xCA, 0xCA, 0x5C, 0xA5, 0xA5, 0xAA, 0xA5, 0x31, 0x27, 0x2D, 0xD2, 0xDD, 0xD2, 0xDD, 0xDD, 0x22, 0xD2, 0xD2, 0x2D, 0x22, 0xD2, 0xDD, 0x8D, 0x88, 0x88, 0x81, 0x88, 0x88, 0x86, 0x88, 0x88, 0xB8, 0x88, 0x1D, 0x88, 0x88, 0x18, 0x88, 0x18, 0x88, 0x1D, 0x88, 0xD8, 0x88, 0x81, 0x18, 0x11, 0xBB, 0x55, 0x55, 0xA5, 0x10, 0x00, 0x09, 0x04, 0x04, 0x40, 0x44, 0x40, 0x00, 0x04, 0x00, 0x00, 0x09, 0x04, 0x40,
+	0xBB, 0xBB, 0xBB, 0x88, 0x8D, 0x22, 0x22, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0x2D, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xBB, 0x22, 0xDD, 0xD2, 0x1D, 0x17, 0x17, 0x17, 0x33, 0x17, 0x37, 0x13, 0x11, 0x33, 0x33, 0x3F, 0x33, 0x35, 0xC5, 0xC5, 0xC5, 0xCA, 0x5C, 0xA5, 0xA5, 0x5A, 0x5C, 0xAA, 0xCA, 0x5A, 0xAF, 0x32, 0x22, 0x21, 0x2D, 0xD2, 0xDD, 0x2D, 0x2D, 0xD2, 0xD2, 0x27, 0x22, 0x2D, 0xDD, 0xD8, 0x88, 0x68, 0x88, 0x88, 0x18, 0x18, 0x81, 0x88, 0x88, 0x88, 0x81, 0xD8, 0x88, 0x88, 0x18, 0x88, 0x88, 0x18, 0x18, 0x88, 0x88, 0x88, 0x88, 0x18, 0xDB, 0x55, 0x5A, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x44, 0x00, 0x00, 0x90, 0x40, 0x40, 0x04, 0x40, 0x00,
+	0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x22, 0xD8, 0x8B, 0xBB, 0x8B, 0xB8, 0xBB, 0x88, 0x88, 0xD2, 0x29, 0x29, 0x29, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0x2D, 0xD2, 0xD2, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xBD, 0x22, 0x2D, 0xDD, 0x21, 0x21, 0x27, 0x17, 0x17, 0x37, 0x11, 0x11, 0x73, 0x11, 0x33, 0x33, 0xF5, 0xC5, 0x5C, 0x55, 0x5C, 0xAC, 0x55, 0xAC, 0x5C, 0xAC, 0xAA, 0xAA, 0xAA, 0xA5, 0xAA, 0x53, 0x77, 0x27, 0x22, 0xD2, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x22, 0xD2, 0x22, 0xDD, 0xD8, 0x88, 0x8B, 0x88, 0x18, 0x81, 0x81, 0x18, 0x18, 0x88, 0xB8, 0x18, 0x88, 0x8D, 0x88, 0x88, 0x8D, 0x88, 0x18, 0x88, 0x8D, 0x81, 0x88, 0x88, 0x8B, 0xDB, 0xB5, 0x55, 0xB9, 0x00, 0x00, 0x00, 0x44, 0x04, 0x44, 0x44, 0x40, 0x44, 0x44, 0x00, 0x00, 0x04, 0x40, 0x00,
+	0xBB, 0xBB, 0xB8, 0x8D, 0x22, 0x92, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0x8B, 0x88, 0xD2, 0x29, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0x2D, 0xD2, 0xD2, 0xDD, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0x28, 0xD2, 0x2D, 0xD2, 0xD2, 0x12, 0x17, 0x17, 0x11, 0x31, 0x71, 0x17, 0x33, 0x71, 0x73, 0x73, 0x33, 0xCF, 0xFC, 0x5C, 0x5C, 0x55, 0x55, 0xC5, 0x5A, 0xA5, 0xA5, 0xAC, 0xA5, 0xA5, 0xAC, 0xAA, 0xAA, 0xF7, 0x27, 0x22, 0x22, 0xDD, 0x2D, 0x2D, 0x22, 0x27, 0x27, 0x22, 0x72, 0xDD, 0x18, 0x8B, 0x88, 0x86, 0x88, 0x81, 0x81, 0x8D, 0x8D, 0x88, 0x8B, 0x88, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x1D, 0x88, 0x88, 0xB8, 0x18, 0x1B, 0xD8, 0xB8, 0xB5, 0x5B, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00,
+	0xBB, 0xBB, 0x88, 0x8D, 0x22, 0x92, 0x22, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0xDD, 0x88, 0x2D, 0x2D, 0xD2, 0x22, 0x1D, 0x7D, 0x71, 0x71, 0x73, 0x17, 0x33, 0xD7, 0x37, 0x33, 0x33, 0x36, 0x33, 0xFC, 0x5C, 0x5C, 0x5C, 0x5C, 0xAC, 0xAC, 0x5A, 0xCA, 0x5A, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xA5, 0xE2, 0xE2, 0x2D, 0x22, 0x2D, 0x2D, 0x2D, 0x2D, 0x72, 0x22, 0x22, 0x7D, 0xD8, 0x88, 0xB8, 0xB8, 0x86, 0x81, 0x8D, 0xD8, 0xD1, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x1B, 0xD8, 0x81, 0x88, 0x88, 0x88, 0x18, 0x18, 0x18, 0x8B, 0x88, 0xBB, 0xBB, 0x10, 0x00, 0x00, 0x00, 0x40, 0x40, 0x90, 0x90, 0x40, 0x44, 0x40, 0x40, 0x40, 0x44, 0x44, 0x40, 0x00,
+	0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xDD, 0x2D, 0xD2, 0xD2, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0xB8, 0x2D, 0x22, 0x2D, 0x2D, 0x2D, 0x1D, 0x17, 0x17, 0x17, 0x13, 0xD3, 0x31, 0x13, 0x11, 0x11, 0x33, 0x3F, 0x3F, 0x3C, 0x5C, 0x5C, 0xA5, 0x55, 0xA5, 0xA5, 0xA5, 0xAC, 0xAA, 0xAA, 0xCA, 0xAA, 0xCA, 0xAA, 0xA7, 0x1E, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x72, 0x7D, 0x22, 0x72, 0xDD, 0x88, 0x88, 0xB6, 0x8B, 0x88, 0x88, 0xD1, 0xDD, 0xDD, 0xD8, 0x88, 0x88, 0x88, 0xDB, 0xDB, 0x88, 0x88, 0x88, 0x88, 0x18, 0xBD, 0xBD, 0xB8, 0x88, 0x88, 0x8B, 0x12, 0x90, 0x90, 0x00, 0x04, 0x44, 0x44, 0x09, 0x00, 0x00, 0x40, 0x40, 0x40, 0x04, 0x44, 0xE0, 0x00, 0x07,
+	0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x22, 0x22, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0x8B, 0x8B, 0x88, 0xD2, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0xD8, 0x8D, 0x22, 0xDD, 0x22, 0xD1, 0x22, 0x7D, 0x1D, 0x71, 0x71, 0x17, 0x11, 0xD3, 0xD3, 0xD3, 0xD3, 0x36, 0x33, 0xFC, 0x53, 0x55, 0x55, 0xC5, 0xCA, 0xCA, 0xC5, 0xCA, 0xAA, 0x5C, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xA5, 0x79, 0x22, 0x2D, 0x2D, 0x22, 0x27, 0x27, 0x22, 0x22, 0x7D, 0x88, 0x88, 0x8B, 0xB8, 0xB8, 0x88, 0x1D, 0xDD, 0x7D, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x88, 0x18, 0x88, 0x88, 0x88, 0x81, 0x8B, 0x8B, 0xB8, 0x19, 0x90, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x09, 0x00, 0x44, 0x04, 0x00, 0x44, 0x44, 0x40, 0x00, 0x2C,
+	0xBB, 0x8B, 0x8D, 0x22, 0x22, 0x92, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0xE2, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xDD, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x28, 0x82, 0x2D, 0x22, 0x2D, 0x2D, 0x12, 0x17, 0xD1, 0x7D, 0x1D, 0x17, 0x13, 0x11, 0xD3, 0x13, 0x11, 0x31, 0x33, 0x3F, 0x35, 0xC5, 0xC5, 0xA5, 0x55, 0x55, 0xAA, 0x5A, 0xCA, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x29, 0x22, 0xD2, 0x22, 0x27, 0x27, 0x22, 0x27, 0xDD, 0xD8, 0x68, 0xB8, 0x68, 0x68, 0x88, 0x8D, 0x22, 0x2D, 0x7D, 0xD8, 0x8B, 0x88, 0x8D, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x18, 0x81, 0x8B, 0x88, 0x8B, 0x81, 0x20, 0x09, 0x00, 0x04, 0x00, 0x40, 0x40, 0x00, 0x00, 0x44, 0x40, 0x40, 0x40, 0x44, 0xE4, 0x00, 0x09, 0x1F,
+	0xB8, 0x88, 0x8D, 0x29, 0x29, 0x29, 0x22, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0x88, 0xD2, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xD2, 0xD2, 0xD2, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0x22, 0x2D, 0x2D, 0xDD, 0x27, 0xDD, 0x7D, 0x7D, 0x17, 0xD7, 0x1D, 0x73, 0xD3, 0xD7, 0x33, 0x11, 0x66, 0xFC, 0xFC, 0x55, 0x5C, 0xAC, 0x5C, 0x5C, 0x5C, 0xAA, 0xAC, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x92, 0x22, 0x22, 0x22, 0x72, 0x22, 0x22, 0x27, 0xDD, 0x18, 0x88, 0x8B, 0x8B, 0x8B, 0x88, 0x8D, 0xD2, 0x22, 0x2D, 0xD8, 0x88, 0x88, 0x88, 0xDB, 0x88, 0xD8, 0x88, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB8, 0x12, 0x09, 0x90, 0x00, 0x90, 0x44, 0x04, 0x04, 0x90, 0x00, 0x44, 0x00, 0x00, 0x04, 0x4E, 0xE4, 0x00, 0x21, 0x3F,
+	0xBB, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xB8, 0xBB, 0x88, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0x22, 0xD2, 0xD2, 0xDD, 0x2D, 0x21, 0x7D, 0x71, 0x71, 0x7D, 0x37, 0x11, 0x1D, 0x3D, 0x3D, 0x31, 0x13, 0x33, 0x3F, 0xF5, 0xC5, 0xA5, 0x5C, 0xAA, 0xA5, 0xCA, 0xAC, 0x5C, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x39, 0x22, 0x22, 0x22, 0x22, 0x72, 0x22, 0x27, 0x2D, 0x88, 0x8B, 0x88, 0xB8, 0xB8, 0x68, 0x8D, 0xD2, 0x29, 0x22, 0xDD, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB8, 0xB8, 0x29, 0x90, 0x00, 0x00, 0x09, 0x00, 0x40, 0x90, 0x00, 0x99, 0x44, 0x04, 0x00, 0x44, 0xEE, 0xE0, 0x09, 0x13, 0x3F,
+	0x88, 0x8D, 0x22, 0x29, 0x22, 0x92, 0x22, 0xD8, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0xD2, 0x22, 0x92, 0x22, 0x92, 0x22, 0x22, 0x22, 0x27, 0x22, 0x22, 0x22, 0x2D, 0xD2, 0x2D, 0xDD, 0xD2, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0xD2, 0x2D, 0x22, 0xD2, 0xDD, 0x2D, 0xDD, 0x7D, 0x7D, 0x77, 0xD7, 0x1D, 0x17, 0x3D, 0x37, 0x1D, 0x3D, 0x3D, 0x31, 0x63, 0xFF, 0x5C, 0x5C, 0xAA, 0x5C, 0x5A, 0xAC, 0xCC, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x92, 0x22, 0x22, 0x72, 0x22, 0xE2, 0x22, 0xDD, 0xD8, 0x88, 0xB8, 0xB8, 0x68, 0x88, 0x8D, 0xD2, 0x99, 0x22, 0x7D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0xB8, 0x88, 0x88, 0xB8, 0x88, 0xB2, 0x20, 0x00, 0x00, 0x99, 0x09, 0x09, 0x90, 0x09, 0x00, 0x90, 0x40, 0x00, 0x40, 0x44, 0xE4, 0x49, 0xED, 0x33, 0x36,
+	0x88, 0x8D, 0x22, 0x92, 0x29, 0x29, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xB8, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0xE2, 0x22, 0x72, 0x22, 0x2D, 0x22, 0xD2, 0xD2, 0xD2, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0x22, 0xD2, 0xDD, 0x2D, 0xDD, 0x71, 0xD7, 0xD7, 0xD7, 0x11, 0x71, 0x11, 0x13, 0xD1, 0x31, 0x13, 0x13, 0x36, 0x6F, 0x3F, 0x5F, 0x55, 0xC5, 0x5A, 0xCC, 0xC5, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0xE9, 0x92, 0x22, 0x22, 0xE2, 0x22, 0x22, 0x7D, 0xD8, 0x86, 0x8B, 0x88, 0xB8, 0xB8, 0x8D, 0xD2, 0x99, 0x99, 0x7D, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x8D, 0x88, 0x88, 0x8D, 0x88, 0x88, 0xB8, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x49, 0x00, 0x09, 0x40, 0x04, 0x00, 0x44, 0xE4, 0xE4, 0x4E, 0x13, 0x33, 0x16,
+	0x88, 0xD2, 0x22, 0x22, 0x92, 0x22, 0x22, 0xD8, 0x88, 0xBB, 0xB8, 0xBB, 0xBB, 0x88, 0x88, 0xD2, 0x22, 0x92, 0x92, 0x22, 0x92, 0x22, 0x22, 0x72, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xDD, 0x2D, 0x2D, 0xDD, 0xD2, 0xD2, 0xDD, 0xD2, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xDD, 0xD2, 0x17, 0xD7, 0x7D, 0x1D, 0x17, 0x11, 0xDD, 0x3D, 0x11, 0xDC, 0xD3, 0x86, 0x33, 0xF3, 0xF5, 0xC5, 0x5C, 0xAC, 0x5C, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5E, 0x29, 0x2E, 0x2E, 0x22, 0x72, 0xE2, 0x7D, 0xD8, 0x8B, 0x88, 0xB8, 0x88, 0x88, 0x8D, 0xD2, 0x99, 0x99, 0x27, 0xD8, 0x88, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB8, 0x29, 0x00, 0x00, 0x00, 0x99, 0x09, 0x49, 0x09, 0x00, 0x94, 0x04, 0x00, 0x04, 0x44, 0xE4, 0xE4, 0xE1, 0x33, 0x31, 0x11,
+	0x8D, 0xD2, 0x92, 0x92, 0x22, 0x92, 0x22, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0x2D, 0x22, 0xDD, 0x2D, 0xDD, 0x27, 0x7D, 0x27, 0x21, 0x7D, 0x71, 0x71, 0x1D, 0x3D, 0x3D, 0x38, 0xC8, 0x83, 0x31, 0x36, 0xFF, 0xFF, 0x5C, 0x55, 0xCC, 0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x99, 0x22, 0x22, 0x22, 0xE2, 0x22, 0x7D, 0x88, 0x86, 0xB8, 0x8B, 0x8B, 0x88, 0x88, 0xD7, 0x99, 0x99, 0x22, 0xDD, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD8, 0x88, 0x88, 0x88, 0x8B, 0x8D, 0x99, 0x99, 0x00, 0x09, 0x04, 0x44, 0x94, 0x00, 0x09, 0x44, 0x40, 0x04, 0x04, 0xE4, 0xE4, 0xEE, 0x73, 0x33, 0x61, 0x11,
+	0xDD, 0x22, 0x22, 0x22, 0x92, 0x29, 0x22, 0xDD, 0x88, 0xB8, 0xBB, 0xB8, 0xB8, 0xB8, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x92, 0x22, 0x22, 0x27, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0xD2, 0xDD, 0x2D, 0x2D, 0x2D, 0x2D, 0xD2, 0xD2, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xD2, 0xD7, 0x27, 0xDD, 0x1D, 0x17, 0x11, 0x13, 0xD3, 0x13, 0x83, 0x83, 0x11, 0x13, 0x16, 0x3F, 0xF5, 0xC5, 0xCC, 0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x79, 0x29, 0xE2, 0x92, 0x22, 0x22, 0x7D, 0xD8, 0x88, 0x68, 0xB8, 0x88, 0xB8, 0x88, 0xD7, 0x99, 0x90, 0x92, 0x2D, 0xD8, 0x88, 0x88, 0x88, 0xD8, 0x88, 0x88, 0x88, 0x88, 0xB8, 0x8B, 0xD2, 0x90, 0x94, 0x40, 0x09, 0x90, 0x40, 0x40, 0x90, 0x44, 0x40, 0x00, 0x40, 0x40, 0x44, 0xEE, 0xE7, 0x33, 0x33, 0x11, 0x1B,
+	0xD2, 0x29, 0x22, 0x22, 0x29, 0x22, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0x8D, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xD2, 0xD2, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xD2, 0x22, 0xD2, 0xDD, 0x2D, 0xD2, 0xD2, 0xD7, 0x72, 0xD7, 0x17, 0x11, 0x71, 0x11, 0x11, 0x38, 0x83, 0x8C, 0xDD, 0xC8, 0x13, 0x16, 0xFF, 0xFF, 0x5C, 0x3C, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x54, 0x92, 0x92, 0x92, 0xE2, 0x22, 0x7D, 0xD8, 0x86, 0x8B, 0x8B, 0x86, 0x8B, 0x88, 0x77, 0x99, 0x09, 0x92, 0x27, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x29, 0x00, 0x00, 0x09, 0x09, 0x04, 0x40, 0x90, 0x00, 0x04, 0x40, 0x40, 0x40, 0x40, 0xE4, 0xEE, 0x73, 0x33, 0x31, 0x31, 0x16,
+	0x22, 0x22, 0x92, 0x92, 0x22, 0x92, 0x22, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x72, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x2D, 0x2D, 0xD2, 0xDD, 0xDD, 0xD2, 0xD2, 0xD2, 0x2D, 0x2D, 0xD2, 0xD2, 0x7D, 0xD7, 0xD7, 0xDD, 0x71, 0xD1, 0xDD, 0x1D, 0x13, 0x83, 0x83, 0xD3, 0x11, 0x16, 0x63, 0x6F, 0xFC, 0x33, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0xE9, 0x92, 0x92, 0x29, 0x22, 0x7D, 0x88, 0x88, 0xB8, 0xB8, 0x8B, 0x88, 0x88, 0xD7, 0xE9, 0x09, 0x99, 0x27, 0xDD, 0x88, 0x8B, 0x88, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xBD, 0x29, 0x00, 0x00, 0x00, 0x99, 0x40, 0x44, 0x00, 0x09, 0x44, 0x00, 0x44, 0x40, 0x4E, 0x0E, 0xE7, 0x33, 0x33, 0x31, 0x16, 0x66,
+	0x22, 0x92, 0x22, 0x22, 0x92, 0x29, 0x22, 0xDD, 0x88, 0x8B, 0x8B, 0xBB, 0x8B, 0x8B, 0x8D, 0xD2, 0x29, 0x29, 0x29, 0x22, 0x22, 0x2E, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0x2D, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0x2D, 0xD2, 0xDD, 0x2D, 0x2D, 0x2D, 0xDD, 0x7D, 0x7D, 0x7D, 0x1D, 0x1D, 0x17, 0x61, 0xD1, 0xD3, 0xD3, 0x13, 0x1D, 0x33, 0x83, 0x36, 0xFF, 0xC1, 0x35, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xE9, 0x29, 0x29, 0x22, 0x2D, 0xD8, 0x88, 0xB8, 0x68, 0xB8, 0x8B, 0x88, 0xD2, 0x99, 0x00, 0x99, 0x92, 0x7D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB8, 0x82, 0x90, 0x00, 0x00, 0x09, 0x94, 0x94, 0x04, 0x00, 0x94, 0x94, 0x00, 0x40, 0x44, 0x44, 0x44, 0x73, 0x33, 0x33, 0x13, 0x36, 0x66,
+	0x29, 0x22, 0x29, 0x22, 0x22, 0x92, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x72, 0xE2, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0x2D, 0xD2, 0xD2, 0x2D, 0x2D, 0x22, 0xD2, 0xD2, 0x2D, 0xDD, 0x71, 0x7D, 0x17, 0xD7, 0x11, 0x1D, 0x3D, 0x31, 0x3D, 0x3D, 0x3D, 0x3D, 0xCD, 0x3F, 0xF3, 0x33, 0xA5, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x54, 0x92, 0x92, 0x92, 0x7D, 0xD8, 0x88, 0x68, 0xB8, 0x68, 0xB8, 0x8D, 0xD7, 0x29, 0x00, 0x09, 0x92, 0x2D, 0xD8, 0x88, 0x88, 0x88, 0xD8, 0x88, 0x88, 0x88, 0xB8, 0x29, 0x00, 0x00, 0x00, 0x94, 0x99, 0x44, 0x40, 0x00, 0x04, 0x04, 0x00, 0x44, 0x44, 0x44, 0xEE, 0x73, 0x33, 0x31, 0x33, 0x6F, 0x6F,
+	0x22, 0x29, 0x22, 0x22, 0x92, 0x22, 0x22, 0xD8, 0x88, 0x8B, 0xBB, 0xB8, 0xB8, 0xB8, 0x8D, 0xD2, 0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x2D, 0xDD, 0x2D, 0x2D, 0x2D, 0xDD, 0xD2, 0xD2, 0x2D, 0x2D, 0x2D, 0x22, 0xDD, 0x2D, 0x27, 0xD2, 0x11, 0xD1, 0x11, 0x11, 0x13, 0x11, 0x11, 0x83, 0xD1, 0xDC, 0xD3, 0x8C, 0xD3, 0x73, 0xFA, 0xAA, 0xAA, 0xA5, 0xAA, 0xCA, 0xAA, 0xAA, 0xAC, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x99, 0x92, 0x92, 0x2D, 0xD8, 0x8B, 0x88, 0xB8, 0x86, 0x88, 0x88, 0xD2, 0x49, 0x90, 0x00, 0x99, 0x22, 0xDD, 0x88, 0x88, 0x8D, 0x8D, 0x88, 0x88, 0x8B, 0x88, 0x29, 0x00, 0x00, 0x00, 0x99, 0x49, 0x40, 0x90, 0x09, 0x49, 0x00, 0x04, 0x44, 0x04, 0x0E, 0xE7, 0xC3, 0x31, 0x31, 0x16, 0xFF, 0x3F,
+	0x29, 0x22, 0x22, 0x92, 0x22, 0x92, 0x22, 0xDD, 0x88, 0xBB, 0x8B, 0xBB, 0xBB, 0x8B, 0x8D, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x72, 0xE2, 0x22, 0x22, 0x22, 0xD2, 0x22, 0xD2, 0xDD, 0xDD, 0x2D, 0x8D, 0xD2, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0x7D, 0x1D, 0x17, 0x11, 0x11, 0x11, 0x13, 0x83, 0xD3, 0xDC, 0xDD, 0x38, 0xCD, 0x73, 0x3F, 0xA5, 0x5A, 0xAC, 0xAA, 0xCA, 0xAA, 0xAC, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x30, 0x99, 0x22, 0x2D, 0x88, 0x88, 0xB8, 0xB6, 0x88, 0xB8, 0x88, 0xD2, 0x20, 0x90, 0x09, 0x99, 0x92, 0xDD, 0xD8, 0x88, 0x88, 0x88, 0x8D, 0x88, 0x8B, 0x82, 0x00, 0x90, 0x00, 0x09, 0x09, 0x00, 0x44, 0x00, 0x44, 0x00, 0x09, 0x40, 0x40, 0x40, 0x4E, 0x3C, 0x3C, 0x13, 0x13, 0x3F, 0xF6, 0xF6,
+	0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xB8, 0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xD2, 0xD2, 0xD2, 0x2D, 0xBD, 0x22, 0xD2, 0x22, 0xDD, 0x2D, 0x2D, 0x2D, 0x2D, 0x7D, 0xDD, 0x17, 0x11, 0x11, 0x11, 0x73, 0xD3, 0xDC, 0xD3, 0xD8, 0x3D, 0x7C, 0xD7, 0xCF, 0x5F, 0x5A, 0xAA, 0x5A, 0xA5, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x99, 0x22, 0x2D, 0xD8, 0x88, 0x8B, 0x88, 0x68, 0x68, 0x8D, 0xD2, 0x20, 0x90, 0x90, 0x99, 0x92, 0x2D, 0xD8, 0x88, 0x88, 0xDD, 0x88, 0x88, 0xB8, 0x29, 0x00, 0x00, 0x09, 0x90, 0x94, 0x44, 0x09, 0x00, 0x44, 0x40, 0x04, 0x04, 0x40, 0x04, 0xEE, 0x3C, 0x31, 0x13, 0x13, 0x6F, 0x66, 0xF3,
+	0x29, 0x22, 0x92, 0x22, 0x29, 0x29, 0x22, 0xDD, 0x88, 0xB8, 0xBB, 0x8B, 0xB8, 0xB8, 0x8D, 0xD2, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0x22, 0x72, 0xD2, 0xD2, 0xD2, 0xDD, 0x22, 0x2B, 0xBD, 0x22, 0x2D, 0x2D, 0x22, 0xD2, 0x2D, 0x2D, 0x2D, 0x2D, 0x17, 0xD1, 0xD1, 0x11, 0x11, 0xD7, 0x31, 0x18, 0x3D, 0xCD, 0x73, 0x7D, 0x7C, 0xFA, 0x5C, 0x5A, 0xFA, 0xCA, 0x5C, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x29, 0x92, 0x2D, 0xD1, 0x88, 0x88, 0xB8, 0xB8, 0xB8, 0x88, 0xD2, 0xE9, 0x90, 0x09, 0x09, 0x99, 0x22, 0xDD, 0xD8, 0x88, 0x8D, 0x88, 0xB8, 0xBD, 0x29, 0x00, 0x90, 0x09, 0x99, 0x94, 0x94, 0x40, 0x04, 0x04, 0x00, 0x44, 0x40, 0x00, 0x44, 0x7C, 0x33, 0x31, 0x73, 0x36, 0x6F, 0x3F, 0x35,
+	0x22, 0x22, 0x22, 0x92, 0x92, 0x22, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x29, 0x22, 0x22, 0x27, 0x27, 0x22, 0x27, 0x22, 0xD2, 0xDD, 0xD2, 0xD2, 0xD2, 0xDB, 0xB2, 0x22, 0x22, 0xD2, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xD7, 0xDD, 0x71, 0x11, 0x11, 0xD7, 0x31, 0x11, 0x3D, 0xDD, 0xDC, 0x77, 0x71, 0xFF, 0xFA, 0xAA, 0xAC, 0xAF, 0xAA, 0xAA, 0xC5, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x79, 0x92, 0x22, 0xD8, 0x88, 0xB8, 0x8B, 0x68, 0x68, 0x8D, 0xD2, 0x29, 0x09, 0x00, 0x09, 0x99, 0x92, 0x2D, 0xD1, 0xBB, 0x81, 0xD8, 0x88, 0x82, 0x90, 0x00, 0x00, 0x90, 0x99, 0x00, 0x40, 0x00, 0x04, 0x44, 0x04, 0x44, 0x40, 0x00, 0x4E, 0xC3, 0xC6, 0x13, 0x13, 0x66, 0x3F, 0x6F, 0xB3,
+	0x24, 0x22, 0x92, 0x22, 0x22, 0x92, 0x22, 0xD8, 0x88, 0xBB, 0x8B, 0xBB, 0xBB, 0x8B, 0x88, 0xD2, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0x22, 0x2D, 0x22, 0xD2, 0xDD, 0x2D, 0x22, 0x85, 0xB2, 0x22, 0x22, 0xD2, 0x22, 0x2D, 0xD2, 0xD2, 0xD2, 0xDD, 0x1D, 0x11, 0x11, 0xD1, 0xD1, 0x1D, 0x18, 0x1C, 0xDC, 0x7D, 0x77, 0xCF, 0xFA, 0xFA, 0x5F, 0x5F, 0xA5, 0xAC, 0x5C, 0xAA, 0x5A, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x99, 0x2D, 0xD1, 0x88, 0x8B, 0x88, 0x68, 0xB8, 0x88, 0xD2, 0x29, 0x00, 0x09, 0x00, 0x09, 0x09, 0x91, 0x55, 0x55, 0x5B, 0xB5, 0x51, 0x79, 0x00, 0x09, 0x00, 0x99, 0x49, 0x04, 0x44, 0x44, 0x40, 0x00, 0x44, 0x40, 0x04, 0x00, 0xE7, 0xC3, 0x31, 0x73, 0x16, 0x3F, 0xF3, 0xF3, 0x3B,
+	0x22, 0x92, 0x22, 0x22, 0x29, 0x29, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xB8, 0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x92, 0x22, 0x22, 0x22, 0x72, 0x27, 0x22, 0xD2, 0xD2, 0x2D, 0x22, 0x22, 0xB5, 0x82, 0x22, 0xD2, 0x22, 0xDD, 0x22, 0xD2, 0xDD, 0xDD, 0xDD, 0x1D, 0x1D, 0xD1, 0x11, 0x3D, 0x11, 0x11, 0xDD, 0x7D, 0x77, 0x73, 0xFF, 0xAA, 0xF5, 0xFA, 0x5A, 0x5C, 0xC5, 0xCA, 0x5A, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x92, 0x22, 0x88, 0x88, 0x88, 0xB8, 0xB8, 0x68, 0x88, 0xD2, 0x99, 0x99, 0x00, 0x00, 0x00, 0x09, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x44, 0x94, 0x99, 0x40, 0x04, 0x44, 0x00, 0x44, 0x04, 0x00, 0x04, 0x7C, 0x33, 0x33, 0x11, 0x36, 0xF3, 0xF6, 0xBB, 0x33,
+	0x2E, 0x22, 0x92, 0x92, 0x22, 0x29, 0x22, 0xD8, 0x88, 0xB8, 0xB8, 0xBB, 0x8B, 0x8B, 0x8D, 0xD2, 0x22, 0x92, 0x92, 0x92, 0x22, 0x22, 0x22, 0x2E, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x2D, 0x2D, 0x28, 0x5B, 0xD2, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0x2D, 0xD2, 0xDD, 0x1D, 0x11, 0xD1, 0x11, 0xDD, 0x1D, 0x8D, 0x77, 0x77, 0x73, 0xCF, 0xFF, 0xAF, 0xAF, 0xFC, 0xAA, 0xC5, 0x5C, 0x55, 0xCA, 0xAA, 0xCA, 0xAA, 0xAC, 0xAA, 0xAA, 0xCA, 0xCA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0x22, 0xD1, 0x8B, 0x88, 0xB8, 0x68, 0x88, 0x88, 0xD2, 0x29, 0x00, 0x00, 0x00, 0x00, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0x00, 0x00, 0x44, 0x40, 0x09, 0x44, 0x04, 0x40, 0x44, 0x00, 0x44, 0x40, 0x00, 0x47, 0xC3, 0x63, 0x11, 0x16, 0x66, 0xF6, 0x3F, 0x3F, 0xBF,
+	0x22, 0x92, 0x22, 0x29, 0x29, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0xD2, 0x29, 0x92, 0x92, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x27, 0x22, 0x2D, 0x2D, 0x22, 0xD2, 0x2B, 0x5B, 0xD2, 0x22, 0x2D, 0xD2, 0x2D, 0x2D, 0xDD, 0xDD, 0x2D, 0xDD, 0x1D, 0x1D, 0x1D, 0xDD, 0x71, 0x1D, 0xDD, 0x77, 0x77, 0x36, 0xFA, 0xFA, 0xFA, 0xCF, 0x5F, 0xFF, 0x55, 0xAA, 0xA5, 0xA5, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x29, 0x22, 0xD8, 0x88, 0x8B, 0x88, 0x8B, 0xB8, 0x88, 0x77, 0xE9, 0x00, 0x00, 0x00, 0x0E, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC0, 0x00, 0x00, 0x40, 0x44, 0x94, 0x90, 0x40, 0x44, 0x00, 0x40, 0x44, 0x40, 0x04, 0xE1, 0x36, 0x31, 0x13, 0x66, 0xF6, 0x3F, 0xB3, 0xB3, 0x3B,
+	0x29, 0x22, 0x29, 0x22, 0x22, 0x92, 0x22, 0xDD, 0x88, 0xB8, 0xBB, 0xB8, 0xB8, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0x2D, 0x22, 0x22, 0x25, 0x5B, 0xD2, 0x22, 0x22, 0xD2, 0x2D, 0x22, 0xDD, 0x2D, 0xDD, 0x71, 0xD1, 0xD1, 0xD7, 0x71, 0x6D, 0x6D, 0xD3, 0x72, 0x7F, 0xFF, 0xFF, 0xAC, 0xFF, 0x5F, 0x5C, 0xFC, 0x55, 0xC5, 0xCA, 0xCA, 0x5A, 0xCA, 0xAA, 0xAC, 0xAC, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x92, 0xD1, 0x88, 0xB8, 0xB8, 0xB8, 0x8B, 0x8D, 0xD2, 0x99, 0x90, 0x00, 0x00, 0x7A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x00, 0x00, 0x04, 0x40, 0x40, 0x40, 0x44, 0x04, 0x00, 0x94, 0x04, 0x00, 0x44, 0x7C, 0x33, 0x13, 0x13, 0x66, 0xF6, 0xF3, 0xF3, 0xB3, 0x53,
+	0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0x88, 0xD2, 0x29, 0x92, 0x92, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0x22, 0xD5, 0x58, 0xD2, 0x22, 0x2D, 0x22, 0xDD, 0xD2, 0x2D, 0xD2, 0xDD, 0x1D, 0xDD, 0xD7, 0x7D, 0x18, 0xD1, 0xDD, 0x77, 0x77, 0x6F, 0xFA, 0xFF, 0xF6, 0xFF, 0x5F, 0xF5, 0x5F, 0xC5, 0x5A, 0x5A, 0x5A, 0xCA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x92, 0x1D, 0x88, 0x8B, 0x88, 0xB8, 0xB8, 0x88, 0x72, 0x20, 0x00, 0x00, 0x0C, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x00, 0x00, 0x04, 0x44, 0x04, 0x00, 0x44, 0x00, 0x00, 0x40, 0x44, 0x04, 0x47, 0xC6, 0x36, 0x13, 0x36, 0x36, 0x63, 0xBF, 0x3B, 0x3B, 0x3B,
+	0x24, 0x22, 0x22, 0x22, 0x29, 0x22, 0x22, 0xDD, 0x88, 0x8B, 0xB8, 0xBB, 0xBB, 0xB8, 0x88, 0x22, 0x22, 0x92, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0x2D, 0x22, 0x6A, 0xBB, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0x2D, 0xD1, 0xD1, 0xD7, 0xD7, 0xDD, 0x1D, 0xDD, 0x77, 0x72, 0x1F, 0xFF, 0xFF, 0xAF, 0xF3, 0xFF, 0xFF, 0xF5, 0x55, 0xFC, 0x55, 0xAC, 0xA5, 0xA5, 0xCA, 0xAA, 0xAC, 0xAC, 0xAA, 0xAC, 0xAC, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x22, 0x78, 0x8B, 0x8B, 0x8B, 0x88, 0x88, 0x8D, 0xD2, 0x40, 0x00, 0x04, 0x5A, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x00, 0x00, 0x04, 0x04, 0x40, 0x00, 0x40, 0x40, 0x40, 0x99, 0x04, 0x04, 0xEC, 0xC6, 0x13, 0x13, 0x66, 0x66, 0x3B, 0x3F, 0x3B, 0x3B, 0x3B,
+	0x22, 0x22, 0x92, 0x29, 0x22, 0x29, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0x8B, 0x8B, 0x88, 0xD2, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x2D, 0x22, 0xFA, 0xBB, 0x22, 0x22, 0x2D, 0x2D, 0xD2, 0x22, 0xD2, 0xDD, 0x1D, 0xD7, 0x7D, 0x78, 0x81, 0x7D, 0xD1, 0x77, 0x21, 0x3F, 0xFA, 0xFF, 0xCF, 0xCF, 0x5F, 0xF5, 0xC5, 0xFF, 0x55, 0xCA, 0xAA, 0xC5, 0xCA, 0xA5, 0xCC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xCA, 0xAA, 0xCA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC9, 0xDD, 0x88, 0xB8, 0xB8, 0xB8, 0xB8, 0x8D, 0x72, 0x90, 0x00, 0xEA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x00, 0x04, 0x00, 0x04, 0x40, 0x40, 0x44, 0x00, 0x44, 0x04, 0x04, 0x0E, 0x7C, 0x6C, 0x81, 0x13, 0x66, 0x63, 0xB3, 0xF3, 0xB3, 0xF3, 0xB3,
+	0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x22, 0xD2, 0x22, 0x55, 0xBB, 0xD2, 0x22, 0x2D, 0x22, 0x22, 0x22, 0xDD, 0xDD, 0xD7, 0xD7, 0xDD, 0xD1, 0xDD, 0xD1, 0xD7, 0x72, 0x1F, 0x6F, 0xA6, 0xFC, 0x3F, 0x5F, 0x6F, 0x55, 0xFC, 0x5C, 0xA5, 0xAC, 0x55, 0xAC, 0xA5, 0xCA, 0xCA, 0xAC, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x7D, 0x88, 0x88, 0xB8, 0x88, 0x88, 0x8D, 0x74, 0x90, 0x93, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x00, 0x00, 0x44, 0x40, 0x00, 0x09, 0x04, 0x00, 0x00, 0x44, 0x00, 0x07, 0xC6, 0xC8, 0x33, 0x66, 0x66, 0x66, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0x8B, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xD2, 0x55, 0xB8, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0xDD, 0xDD, 0x7D, 0xD7, 0xD7, 0xD1, 0xD1, 0xDD, 0x72, 0x21, 0x6F, 0xFF, 0x6F, 0x3F, 0x56, 0x3F, 0x55, 0xC5, 0xF5, 0xFA, 0x5F, 0xA5, 0xC5, 0xCA, 0x5C, 0x5C, 0xA5, 0xAA, 0xAA, 0xAA, 0xAC, 0xAC, 0xAA, 0xAA, 0xCA, 0xAC, 0xAC, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x31, 0x18, 0xB8, 0xB8, 0x8B, 0x88, 0x87, 0x29, 0x97, 0x5A, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x99, 0x04, 0x00, 0x00, 0xE7, 0x36, 0x61, 0x13, 0x63, 0x63, 0x66, 0x36, 0x63, 0xB3, 0xB3, 0xB3,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xDD, 0xD2, 0x2D, 0x55, 0xB8, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xD2, 0xDD, 0xDD, 0x7D, 0xDD, 0xDD, 0x1D, 0xD1, 0x17, 0x27, 0x1F, 0x66, 0xFF, 0xD6, 0xFF, 0xF3, 0xFF, 0xFA, 0xFF, 0xF5, 0xC5, 0xCA, 0xF5, 0xCA, 0xAC, 0x5C, 0x55, 0xAC, 0x5C, 0xAA, 0xAC, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xCC, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x18, 0x8B, 0x88, 0x88, 0x88, 0xD7, 0x2E, 0xFA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x00, 0x04, 0x40, 0x44, 0x90, 0x09, 0x09, 0x44, 0x44, 0x00, 0x04, 0x7C, 0x63, 0x38, 0x36, 0x66, 0xF6, 0x36, 0xB3, 0xB3, 0xF3, 0x63, 0xF3,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x22, 0xD2, 0x28, 0xA5, 0xBD, 0x22, 0x22, 0x22, 0x2D, 0xD2, 0x2D, 0x22, 0xD2, 0xD7, 0xDD, 0x1D, 0xD7, 0xDD, 0x72, 0x78, 0xF6, 0x66, 0x66, 0x36, 0xF6, 0x3F, 0x5F, 0xCF, 0x55, 0x5A, 0xFF, 0x55, 0xCA, 0xF5, 0xC5, 0xC5, 0xCA, 0x5A, 0x55, 0xCA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAC, 0xAC, 0xCC, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x61, 0x88, 0x8B, 0x88, 0x88, 0x27, 0x3A, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x00, 0x00, 0x04, 0x44, 0x09, 0x09, 0x04, 0x04, 0x00, 0x00, 0x0E, 0x3C, 0x63, 0x83, 0x66, 0xF6, 0x63, 0xB3, 0x66, 0x3B, 0x3B, 0x3B, 0x3B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xD2, 0xD2, 0x2B, 0xA5, 0x82, 0xD2, 0x22, 0x22, 0xD2, 0x2D, 0x22, 0xDD, 0xDD, 0xDD, 0xD1, 0xDD, 0xD7, 0x77, 0x27, 0x86, 0x66, 0xF1, 0xD3, 0xF6, 0x13, 0xFF, 0xFF, 0xF5, 0xFF, 0xC5, 0xC5, 0xC5, 0xFA, 0xCF, 0xCF, 0x5A, 0x5C, 0xA5, 0xAC, 0xAA, 0xCA, 0xAA, 0xCA, 0xAA, 0xAA, 0xCC, 0xCA, 0xCA, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xA1, 0xB8, 0xB8, 0x88, 0x11, 0x35, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x00, 0x00, 0xE0, 0x40, 0x40, 0x00, 0x04, 0x40, 0x40, 0x00, 0x47, 0xC6, 0x63, 0x13, 0x6F, 0x63, 0xF6, 0x66, 0x3B, 0x36, 0x3B, 0x36, 0x36,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x92, 0x22, 0xDD, 0x88, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0x22, 0x2F, 0x5B, 0x8D, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0xD7, 0x77, 0xDD, 0x72, 0xD1, 0x66, 0x66, 0x83, 0x63, 0x13, 0x3F, 0xFF, 0x5F, 0xF5, 0xC5, 0xFC, 0x55, 0xF5, 0xC5, 0xF5, 0xC5, 0x5C, 0x5A, 0xCC, 0x5A, 0x5C, 0xAC, 0xAA, 0xAA, 0xAA, 0xCA, 0xCA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAC, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x68, 0x88, 0x81, 0x15, 0x5A, 0xA5, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x00, 0xE0, 0x00, 0x40, 0x40, 0x09, 0x00, 0x44, 0x40, 0x04, 0xE3, 0x6C, 0x83, 0x36, 0x6C, 0x66, 0x63, 0x63, 0xB3, 0xFB, 0x36, 0x3B, 0x3B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x25, 0x5B, 0x8D, 0xD2, 0x22, 0x2D, 0x22, 0x22, 0x2D, 0xD2, 0x2D, 0xDD, 0xD7, 0xDD, 0x7D, 0x71, 0x16, 0x86, 0x68, 0x16, 0x61, 0x13, 0xFF, 0x6F, 0xF5, 0xFF, 0xFC, 0xFF, 0xFA, 0xFA, 0xCC, 0xC5, 0x5C, 0xF5, 0xCA, 0x55, 0xC5, 0xCA, 0xCA, 0xCA, 0xAC, 0xAA, 0xCC, 0xAA, 0xCA, 0xAA, 0xCA, 0xCA, 0xAA, 0xCA, 0xAA, 0xAA, 0xCA, 0xAC, 0xAA, 0xA5, 0x11, 0xB8, 0x1B, 0x5A, 0xA5, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0xE0, 0x40, 0x00, 0x00, 0x40, 0x40, 0x44, 0x4E, 0xDC, 0x68, 0xC8, 0x36, 0x66, 0xF3, 0x66, 0x66, 0x3B, 0x33, 0xB3, 0xB3, 0x63,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0x2D, 0x22, 0x2A, 0x5B, 0x18, 0xD2, 0x2D, 0x22, 0xD2, 0x22, 0xD2, 0x22, 0xDD, 0xD7, 0x2D, 0xDD, 0x77, 0xD6, 0x61, 0x31, 0x11, 0x63, 0xD1, 0x36, 0x6F, 0x3F, 0xFF, 0xFC, 0x5F, 0xFF, 0xFF, 0xF5, 0x3F, 0x5F, 0x5C, 0x5C, 0x5F, 0xC5, 0x5C, 0x55, 0x5A, 0xAC, 0xAC, 0xCC, 0xAA, 0xCA, 0xCA, 0xCC, 0xAA, 0xAC, 0xAC, 0xAC, 0xAC, 0xAA, 0xAC, 0xAA, 0xCA, 0xAA, 0x31, 0x8B, 0x5A, 0xAA, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0xE0, 0x40, 0x40, 0x00, 0x00, 0x94, 0x44, 0x44, 0x97, 0xC6, 0x38, 0x31, 0x66, 0xF3, 0xF6, 0x63, 0x63, 0xB3, 0xFB, 0x36, 0x3B, 0x33,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x29, 0x29, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDA, 0x5B, 0xBD, 0xDD, 0x22, 0x22, 0x2D, 0x2D, 0x22, 0xDD, 0x2D, 0xD2, 0xDD, 0x7D, 0x7D, 0x16, 0x86, 0x6D, 0x36, 0x6D, 0xD6, 0x66, 0x66, 0xFF, 0x3F, 0x5F, 0xFC, 0xF5, 0xFC, 0xF3, 0xFF, 0xFF, 0x5F, 0xF5, 0xF5, 0x5C, 0x55, 0xC5, 0xAC, 0xAC, 0xCA, 0xAA, 0xCA, 0xCA, 0xCA, 0xAA, 0xCA, 0xAA, 0xAC, 0xAC, 0xAA, 0xCA, 0xCA, 0xCA, 0xAC, 0xAA, 0xCB, 0x55, 0xA5, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC0, 0x00, 0x0E, 0x0E, 0x04, 0x04, 0x09, 0x00, 0x44, 0x44, 0x7D, 0xC8, 0x63, 0x16, 0x6F, 0x66, 0x66, 0x66, 0x66, 0x3B, 0x33, 0xB3, 0xB3, 0x66,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x22, 0x8A, 0x5B, 0x88, 0xD2, 0x2D, 0x2D, 0x22, 0x22, 0xDD, 0x2D, 0xD2, 0xDD, 0xDD, 0xD7, 0xD6, 0x11, 0xF6, 0xD3, 0x81, 0xD3, 0x33, 0x66, 0x6F, 0x66, 0xFC, 0x3F, 0x55, 0xCF, 0xFC, 0x35, 0xF5, 0xFC, 0x5F, 0x5C, 0x5C, 0xF5, 0xC5, 0x5C, 0xA5, 0x55, 0xC5, 0xCA, 0xAA, 0xCA, 0xAC, 0xAA, 0xAC, 0xAC, 0xAC, 0xAA, 0xCA, 0xCA, 0xAA, 0xCA, 0xCA, 0xCA, 0xA5, 0xAA, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x44, 0x4E, 0x7C, 0x6C, 0x81, 0x36, 0x66, 0xF3, 0x63, 0x63, 0xB3, 0xB3, 0xB3, 0x63, 0x66, 0x3B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xBA, 0x5B, 0xB8, 0xDD, 0x22, 0x2D, 0x22, 0x2D, 0x2D, 0xD2, 0xDD, 0xDD, 0xDD, 0x7D, 0x86, 0x68, 0x11, 0x36, 0xDD, 0x3D, 0x38, 0x36, 0xF3, 0x3F, 0x36, 0xFF, 0xF5, 0xFF, 0x3F, 0xF5, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0xCF, 0x5C, 0x5A, 0x5C, 0x5C, 0xA5, 0xCA, 0xCA, 0xAC, 0xAA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xAC, 0xCA, 0xCC, 0xAC, 0xAA, 0xAA, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0x00, 0x00, 0x44, 0x00, 0x40, 0x04, 0x44, 0x44, 0xE7, 0x8C, 0x86, 0xDC, 0x66, 0x6C, 0x6F, 0x66, 0xB3, 0x63, 0x63, 0x66, 0x66, 0x3B, 0x36,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x8B, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xFA, 0xBB, 0xB8, 0xDD, 0xDD, 0xD2, 0x2D, 0x22, 0xD2, 0x2D, 0x2D, 0xDD, 0x77, 0x21, 0x6D, 0x63, 0xD3, 0x6D, 0x37, 0x63, 0x86, 0x66, 0x33, 0x36, 0xF5, 0xFF, 0xFF, 0xF3, 0xF5, 0x6F, 0x5C, 0xFF, 0x5C, 0xFF, 0x55, 0xFC, 0xF5, 0xC5, 0xCA, 0xA5, 0xCA, 0xC5, 0xCA, 0xAA, 0xCA, 0xAC, 0xAA, 0xCA, 0xCC, 0xAC, 0xAC, 0xCA, 0xCC, 0xCC, 0xCA, 0xAA, 0xCC, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x04, 0x90, 0x09, 0xED, 0xC6, 0x68, 0xC8, 0x6C, 0x66, 0x66, 0x63, 0xF3, 0xB3, 0xB6, 0x3B, 0x3B, 0x36, 0x63,
+	0x22, 0x22, 0x22, 0x29, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0x22, 0x55, 0x5B, 0xB8, 0x8D, 0xDD, 0xDD, 0x22, 0xD2, 0x22, 0x2D, 0xD7, 0xD7, 0xDD, 0x8D, 0x36, 0x8D, 0x36, 0xD7, 0xD6, 0x66, 0x36, 0xCD, 0x16, 0x63, 0xFF, 0xFF, 0xF1, 0x3F, 0x5F, 0xFF, 0x35, 0xFF, 0xF5, 0xFF, 0xC5, 0xFF, 0xFC, 0x5C, 0x55, 0xCA, 0xC5, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAA, 0xCC, 0xAC, 0xAA, 0xAA, 0xCC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xCA, 0xAA, 0xAA, 0xAA, 0xAC, 0x00, 0x00, 0x00, 0xE0, 0x40, 0x40, 0x44, 0x40, 0x09, 0x7C, 0x66, 0xC8, 0x36, 0x6F, 0x66, 0x36, 0x66, 0x3B, 0x3B, 0x3B, 0x3B, 0x3F, 0x3B, 0x3B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0xBB, 0xBB, 0x8D, 0x8D, 0xD2, 0xD2, 0x22, 0xD2, 0xD7, 0xD7, 0x22, 0xDD, 0x6D, 0x68, 0x3D, 0x6D, 0x7D, 0xC8, 0x38, 0x66, 0x3D, 0x31, 0x66, 0x6F, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x3F, 0xF5, 0xF5, 0xFF, 0xFF, 0xFF, 0x53, 0xFF, 0xFC, 0x5C, 0x55, 0xCA, 0x5C, 0xAA, 0xAA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCC, 0xCA, 0xCC, 0xCC, 0xAA, 0xCA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0xCC, 0xAA, 0xAA, 0xAA, 0xAE, 0x00, 0x00, 0x40, 0x04, 0x00, 0x04, 0x00, 0x40, 0x9E, 0xDC, 0x6D, 0xC8, 0xC6, 0xF3, 0xF6, 0x66, 0x3F, 0x63, 0xB3, 0xF3, 0xB3, 0xFB, 0x3B, 0x36,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0x5B, 0xBB, 0x88, 0x8D, 0xDD, 0x22, 0x22, 0x22, 0xDD, 0xD2, 0x22, 0x86, 0xD3, 0x8D, 0xC8, 0x37, 0xDC, 0x68, 0x36, 0x36, 0x83, 0x66, 0x13, 0xF6, 0x36, 0x3F, 0x5F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC3, 0x3F, 0xFF, 0xFF, 0x5C, 0xC5, 0xC5, 0x55, 0xAC, 0xAC, 0xCA, 0xCA, 0xCA, 0xAC, 0xAC, 0xAC, 0xAC, 0xCC, 0xAA, 0xAC, 0xAC, 0xAA, 0xAA, 0xAA, 0xA5, 0xAA, 0xAC, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAC, 0xAC, 0x5C, 0xAC, 0xCA, 0xAA, 0xC0, 0x00, 0x00, 0x0E, 0x04, 0x00, 0x00, 0x00, 0x49, 0x47, 0xC6, 0x38, 0x36, 0x6C, 0xF6, 0x66, 0x6B, 0x3B, 0xF3, 0x63, 0xB3, 0xF3, 0xB3, 0x3B, 0x36,
+	0x22, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0xBB, 0xBB, 0x88, 0x8D, 0x8D, 0xD2, 0x22, 0x22, 0xD2, 0xD2, 0xD8, 0x83, 0x8D, 0xDC, 0x87, 0x7D, 0x38, 0x8F, 0x38, 0x11, 0x36, 0x63, 0x11, 0x36, 0x31, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xF3, 0x5F, 0xF3, 0xFF, 0xC3, 0xC5, 0x5C, 0x5C, 0x5C, 0xA5, 0xCA, 0xCA, 0xCA, 0xCC, 0xCA, 0xCA, 0xCC, 0xCC, 0xAA, 0xAC, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xCC, 0x55, 0xC3, 0xCA, 0xAA, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x04, 0x40, 0x44, 0x4E, 0x77, 0x6C, 0x8C, 0x83, 0x66, 0x6C, 0x66, 0x3B, 0x36, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x36, 0x3B,
+	0x22, 0x2E, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xD2, 0x22, 0x92, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0xBB, 0xBB, 0xB8, 0x8D, 0x8D, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x83, 0xD8, 0xCD, 0x18, 0xD7, 0xD1, 0x16, 0xC8, 0xD3, 0x18, 0x68, 0x38, 0x66, 0x11, 0xF6, 0x66, 0xF6, 0xFF, 0xF3, 0xFF, 0xFF, 0x36, 0xFF, 0x6F, 0xF5, 0x33, 0xFC, 0x53, 0xC5, 0xF5, 0xC3, 0x5A, 0x5C, 0x5C, 0xCA, 0xCA, 0xCA, 0xAC, 0xCC, 0x5A, 0x5C, 0x5C, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0x35, 0x5C, 0x73, 0xC5, 0xAA, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x04, 0x04, 0xEE, 0xDC, 0x66, 0xD3, 0x6C, 0x6F, 0x6F, 0x6F, 0x3B, 0x3B, 0x3B, 0xF3, 0xB3, 0xB3, 0xF3, 0xB3, 0xB3,
+	0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xD2, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xB5, 0xBB, 0xBB, 0x88, 0x88, 0xD8, 0x2D, 0x22, 0x22, 0x22, 0x28, 0x3D, 0x3D, 0xD6, 0xDD, 0x77, 0x86, 0xDD, 0x61, 0x18, 0x3D, 0x31, 0x6F, 0x63, 0x76, 0xF6, 0x63, 0x36, 0xFF, 0xFF, 0xF6, 0x36, 0xF6, 0xFF, 0x53, 0x33, 0xFC, 0x5C, 0xFF, 0x5C, 0xFF, 0x35, 0xCC, 0x5C, 0x5C, 0x5C, 0xCC, 0x5C, 0xCC, 0x55, 0xC5, 0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xCC, 0x5C, 0x33, 0x33, 0x55, 0xAC, 0x00, 0x00, 0x04, 0xE0, 0x00, 0x04, 0x00, 0x44, 0xE2, 0x36, 0x6C, 0x8C, 0x66, 0x6C, 0x63, 0xF3, 0xF3, 0xB3, 0xF3, 0xB3, 0x63, 0xF3, 0xB3, 0xB3, 0xF6,
+	0x22, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xD2, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x55, 0xBB, 0xBB, 0xB8, 0x8D, 0x8D, 0xD2, 0x2D, 0x22, 0xDD, 0x81, 0x88, 0xDD, 0xD3, 0x77, 0xD3, 0x83, 0x8C, 0xD3, 0x81, 0xD3, 0x13, 0x83, 0xD3, 0x6F, 0x66, 0x66, 0x66, 0xFF, 0xFC, 0x3F, 0xF3, 0xFF, 0xF3, 0x31, 0x6F, 0x56, 0xFF, 0x33, 0xF5, 0xF5, 0x3F, 0x5C, 0xC5, 0xC5, 0xC5, 0xC5, 0xCC, 0xC5, 0x55, 0x5C, 0x5C, 0xAA, 0xAA, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAC, 0xC5, 0x53, 0x33, 0x53, 0x5A, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0xE4, 0xE1, 0x63, 0x61, 0x38, 0x6F, 0x66, 0xF6, 0x66, 0x63, 0xFB, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xDD, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x55, 0xBB, 0xBB, 0x8B, 0x88, 0xD8, 0xDD, 0x2D, 0x22, 0xDD, 0x8D, 0x3D, 0x31, 0xD7, 0xD7, 0x83, 0x8C, 0x88, 0x83, 0xD7, 0x18, 0x63, 0x81, 0x1C, 0x6F, 0x36, 0x3C, 0xFC, 0xCF, 0xC3, 0x66, 0xFF, 0x56, 0x36, 0x66, 0x6F, 0xF3, 0xFF, 0x5C, 0x53, 0xFF, 0xCF, 0xC5, 0x3C, 0xC5, 0xC3, 0x5C, 0x3C, 0x55, 0xC5, 0xC5, 0x5A, 0x5A, 0xCA, 0xCA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0xC5, 0x33, 0xFF, 0x33, 0xCA, 0xA0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x4E, 0x7C, 0x6C, 0x83, 0x16, 0xC6, 0x6F, 0x36, 0x36, 0x3B, 0x36, 0x3B, 0x3F, 0x3B, 0x3B, 0x35, 0x33, 0xB3,
+	0x22, 0x22, 0x22, 0x22, 0x92, 0x22, 0x22, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x29, 0x29, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x98, 0x55, 0x5B, 0xBB, 0xBB, 0x88, 0x88, 0xDD, 0x22, 0x22, 0xD8, 0xD1, 0xDD, 0x3D, 0xD7, 0xDD, 0x38, 0x18, 0x3D, 0xCD, 0xD1, 0x33, 0x66, 0xDC, 0x66, 0x66, 0x6F, 0xC6, 0xFF, 0xFC, 0x33, 0x37, 0x31, 0x73, 0xF3, 0xFF, 0x36, 0x6F, 0xF3, 0x6F, 0xF3, 0xFF, 0xFF, 0xF3, 0xC5, 0x33, 0x33, 0x3C, 0x55, 0x55, 0xC5, 0x55, 0xAA, 0x5C, 0x5A, 0xCA, 0xCA, 0xCA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0x53, 0x33, 0x37, 0x33, 0xAA, 0xC0, 0x00, 0x00, 0x44, 0xE0, 0x4E, 0x44, 0x44, 0x4E, 0x7F, 0x38, 0xC8, 0xC6, 0x66, 0x36, 0xF3, 0x66, 0x63, 0xB3, 0xB3, 0xB3, 0xB3, 0xF3, 0xB3, 0xB3, 0x66,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xD2, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x55, 0xB5, 0xBB, 0xBB, 0xBD, 0x88, 0x8D, 0x22, 0x2D, 0x88, 0xDD, 0x18, 0xD7, 0xDD, 0x11, 0x81, 0xDC, 0xD8, 0xD7, 0xD3, 0x86, 0xDD, 0x3D, 0x6F, 0xFC, 0x8C, 0xDC, 0xDC, 0xCC, 0x6C, 0x7C, 0x7E, 0x93, 0x5C, 0xF3, 0xFF, 0x3F, 0x63, 0xFF, 0xFF, 0x3F, 0xCF, 0xFC, 0xFF, 0x33, 0x33, 0x55, 0x55, 0xC5, 0x55, 0x5A, 0xA5, 0x5A, 0xCA, 0xAA, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xC5, 0x3C, 0x37, 0xE2, 0x35, 0xAA, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x0E, 0x40, 0x44, 0x47, 0xC6, 0xC8, 0x33, 0x66, 0x66, 0xF3, 0x66, 0x63, 0x66, 0x3B, 0x3F, 0x3B, 0x3B, 0x3B, 0x33, 0xB3, 0x3B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x29, 0x29, 0x22, 0x22, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x98, 0x55, 0x5B, 0xBB, 0xBB, 0x8B, 0x88, 0x88, 0x22, 0xD8, 0xDD, 0x17, 0x38, 0x77, 0xD1, 0x61, 0xDD, 0x38, 0xD7, 0xD3, 0x1D, 0xC8, 0xCD, 0x6C, 0x8F, 0x37, 0x77, 0x7E, 0x77, 0x7C, 0xC7, 0xCC, 0xF3, 0x77, 0xC3, 0xFF, 0xFC, 0x33, 0x3F, 0x3F, 0xFC, 0xCC, 0x3E, 0xCF, 0xCC, 0x33, 0xB5, 0x55, 0xC5, 0xC5, 0x5A, 0x5A, 0x5C, 0xAA, 0xAC, 0xAC, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xC5, 0x3E, 0x42, 0x21, 0x35, 0xAA, 0x00, 0x00, 0x04, 0x00, 0x40, 0x04, 0x04, 0x0E, 0xE7, 0xF6, 0x8C, 0x86, 0x66, 0xC6, 0x3F, 0x36, 0x3B, 0x3F, 0x3F, 0x3B, 0x36, 0x36, 0x3B, 0x3B, 0x33, 0xB3,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x98, 0x55, 0x55, 0xBB, 0xBB, 0xB8, 0xB8, 0xBD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD7, 0x7D, 0x1D, 0xDC, 0x83, 0x8D, 0x71, 0xD3, 0x8C, 0xDD, 0xD6, 0x66, 0xCD, 0x27, 0x7C, 0x37, 0x77, 0xE7, 0xEE, 0xCC, 0xFC, 0xCE, 0x77, 0xC7, 0xCC, 0xFC, 0xC6, 0x7C, 0xCC, 0xFC, 0x7E, 0xE3, 0xFC, 0x33, 0x55, 0xF3, 0x55, 0xAA, 0xAA, 0x5A, 0x5A, 0x5C, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0xCE, 0x92, 0x2E, 0x23, 0x5A, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x0E, 0x04, 0x7C, 0xC6, 0x13, 0x36, 0xC6, 0x6F, 0x66, 0x66, 0x63, 0xF6, 0x6B, 0x3B, 0x3B, 0x3B, 0x36, 0x36, 0x33, 0x36,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x29, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x98, 0xA5, 0x5B, 0xBB, 0xBB, 0xB8, 0x8B, 0x88, 0xD2, 0xDD, 0xDD, 0xD3, 0x77, 0xDD, 0x33, 0xD8, 0xD8, 0xD7, 0xD3, 0xDC, 0x88, 0xDC, 0x8C, 0x86, 0x87, 0x7C, 0xC8, 0xC7, 0xCE, 0x7E, 0xE2, 0xCF, 0xAC, 0xCC, 0xCE, 0xCE, 0xE7, 0xCC, 0xCC, 0xC7, 0x7E, 0xEE, 0xEC, 0x00, 0xCC, 0x6A, 0x53, 0x35, 0x55, 0xA5, 0xA5, 0x5C, 0xAA, 0xAA, 0xCA, 0xCA, 0xCA, 0xAC, 0xAA, 0xCA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xCC, 0xE2, 0x2E, 0x27, 0x35, 0xAA, 0xA0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x44, 0x00, 0x4E, 0x76, 0x63, 0x13, 0x66, 0x66, 0x63, 0x63, 0xF3, 0xF6, 0x36, 0x3F, 0x36, 0x3B, 0x33, 0xF3, 0xB3, 0xB3, 0xF3,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x99, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x98, 0xA5, 0x5B, 0x5B, 0xBB, 0xBD, 0x88, 0xBD, 0xDD, 0x2D, 0xDD, 0xD7, 0x7D, 0xD1, 0x88, 0xD3, 0xD7, 0xD1, 0xDD, 0x3D, 0xDC, 0xD8, 0xC8, 0xC8, 0x7C, 0xCD, 0xCE, 0x27, 0xEE, 0xEE, 0x9E, 0xCC, 0xCC, 0xCC, 0xCC, 0xEC, 0xEE, 0xEE, 0xEE, 0x4E, 0x44, 0x44, 0x04, 0x00, 0x7A, 0xAF, 0x3C, 0x55, 0xA5, 0xAA, 0x5C, 0xAA, 0xAC, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCE, 0xE9, 0x92, 0x92, 0xE3, 0x55, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x00, 0xE7, 0xC3, 0x38, 0x36, 0xC6, 0x6F, 0x66, 0x66, 0x66, 0x36, 0x6F, 0x36, 0x63, 0xB3, 0xB3, 0x33, 0x33, 0x33, 0xB3,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x29, 0x29, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0x55, 0xB5, 0xBB, 0xBD, 0xD8, 0x8D, 0x2D, 0x2D, 0xDD, 0x72, 0x7D, 0x18, 0xDC, 0x8D, 0x37, 0xD1, 0xD3, 0xDD, 0xDD, 0xC8, 0x8C, 0x87, 0x7C, 0xCC, 0x77, 0x7E, 0x7E, 0x7E, 0xE7, 0xCC, 0xCC, 0xCE, 0xEE, 0xEE, 0xEE, 0xC4, 0x4E, 0x40, 0x44, 0x00, 0x00, 0x0E, 0xFA, 0xC3, 0xF5, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xA5, 0xAC, 0xAC, 0xAC, 0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAC, 0xCE, 0xEE, 0x72, 0x22, 0x27, 0x33, 0x5A, 0xAC, 0x00, 0x00, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00, 0xE3, 0x33, 0x31, 0x36, 0x66, 0xF6, 0xC6, 0xF3, 0xF3, 0xF6, 0x36, 0xF3, 0x36, 0x36, 0x3F, 0x3B, 0x3B, 0x3F, 0x3B,
+	0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD2, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x92, 0x55, 0x5B, 0x5B, 0xBB, 0xB2, 0x8D, 0x8D, 0x22, 0x2D, 0xD7, 0x22, 0xD8, 0x3D, 0xD3, 0xDD, 0x78, 0xCD, 0xD3, 0xDC, 0xDD, 0x8C, 0x8C, 0x77, 0xCC, 0xD7, 0xE7, 0xC7, 0x7C, 0xC7, 0xEE, 0xEE, 0xCC, 0xEE, 0xEE, 0x0E, 0xCE, 0xEE, 0xEE, 0x40, 0x00, 0x04, 0x04, 0xEA, 0xC3, 0xCF, 0xAA, 0xAA, 0xAA, 0xA5, 0xAC, 0xA5, 0xAC, 0xAA, 0xAA, 0xAA, 0xAC, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAC, 0xEE, 0xEE, 0xE2, 0x92, 0x97, 0x23, 0x55, 0xAA, 0xC0, 0x00, 0x00, 0x40, 0x40, 0x04, 0x04, 0x40, 0x04, 0xE3, 0x36, 0x13, 0x16, 0xF6, 0xC6, 0x6F, 0x3F, 0x6F, 0x3F, 0x63, 0x6F, 0x33, 0xB3, 0x3B, 0x3B, 0x33, 0xB3, 0x33,
+	0x22, 0x27, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x29, 0x29, 0x29, 0x22, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xB5, 0x55, 0xB5, 0xBB, 0xB2, 0x2D, 0xD8, 0xD2, 0x8D, 0x22, 0xDD, 0xD8, 0xDC, 0xD8, 0x77, 0xDD, 0x8C, 0xDD, 0x7D, 0x3D, 0xCD, 0xDD, 0x77, 0xDC, 0x7E, 0xCC, 0x7E, 0xC7, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0C, 0xAC, 0xC3, 0x5A, 0x5A, 0xA5, 0xAC, 0xAA, 0xCA, 0xA5, 0xAA, 0xCA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAE, 0xEE, 0xEE, 0xE2, 0x22, 0x22, 0x71, 0x35, 0x5A, 0x57, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x0E, 0x7C, 0x61, 0x36, 0x66, 0xF6, 0x6F, 0x66, 0xF3, 0x63, 0xF3, 0xF6, 0x36, 0xB3, 0x6B, 0x33, 0xB3, 0xB3, 0x33, 0xB3,
+	0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0xB5, 0x55, 0xB5, 0xBB, 0xB2, 0xDB, 0x88, 0xDD, 0xD2, 0x27, 0xDD, 0x31, 0xD8, 0xD7, 0xDD, 0xCD, 0xDD, 0x3D, 0xDD, 0xC8, 0x8C, 0x77, 0xCC, 0xC7, 0x7C, 0x77, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xEC, 0xEC, 0xEE, 0x00, 0xEE, 0x00, 0xE0, 0x00, 0xCA, 0xC7, 0xCA, 0x55, 0xA5, 0xAC, 0xAA, 0xA5, 0xA5, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAC, 0xEE, 0xEE, 0x22, 0x92, 0x22, 0x71, 0x35, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x40, 0x40, 0x0E, 0xC6, 0x31, 0x31, 0xCF, 0xF6, 0x3F, 0x3F, 0x3F, 0x6F, 0x66, 0x3F, 0xF3, 0x63, 0x63, 0xB3, 0x33, 0x3F, 0x3B, 0x33,
+	0x22, 0x27, 0x27, 0x29, 0x22, 0x2D, 0x2D, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD2, 0x29, 0x29, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x85, 0x55, 0xB5, 0xBB, 0xB2, 0x8B, 0x88, 0xDD, 0x22, 0x2D, 0xDD, 0x18, 0xCD, 0xD7, 0xCD, 0xDD, 0xCD, 0xDD, 0xCD, 0xD8, 0xD7, 0x77, 0xDD, 0xC7, 0x7C, 0xEE, 0xEE, 0xEE, 0x4E, 0x44, 0xEC, 0xCE, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0xEC, 0xAE, 0x73, 0x55, 0x55, 0xC5, 0xAA, 0x55, 0xCA, 0xC5, 0xA5, 0xAA, 0xCA, 0xCA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAC, 0xCC, 0xEE, 0x12, 0x92, 0x22, 0x71, 0x33, 0x35, 0x55, 0x5E, 0x00, 0x00, 0x04, 0x04, 0x00, 0x40, 0x04, 0x04, 0x04, 0x47, 0xC3, 0x61, 0x16, 0x6F, 0xCF, 0x6F, 0x6F, 0x6F, 0x3F, 0x3F, 0x36, 0x3F, 0x3F, 0x6F, 0x3F, 0x3B, 0x33, 0x33, 0x3B,
+	0x77, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x25, 0x55, 0x5B, 0x5B, 0xBD, 0xDD, 0x88, 0x81, 0x22, 0xD7, 0x11, 0xDD, 0xDD, 0x7D, 0xDD, 0x7C, 0xDD, 0xCD, 0x88, 0xCD, 0xC2, 0x7C, 0xCC, 0x7E, 0xEE, 0xEE, 0xEE, 0xEE, 0x40, 0x4E, 0xCE, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xEE, 0x00, 0x0E, 0xCA, 0x73, 0xC5, 0x5A, 0xC5, 0xC5, 0x5C, 0xAA, 0x5A, 0x55, 0xCA, 0xCA, 0x5A, 0xAA, 0xAA, 0xAC, 0xAA, 0xCA, 0xEE, 0xC3, 0xE7, 0x92, 0x22, 0x11, 0x33, 0x53, 0x53, 0x55, 0x70, 0x00, 0x00, 0x09, 0x49, 0x00, 0x04, 0x04, 0x44, 0x44, 0xEC, 0x33, 0x31, 0x3F, 0x6F, 0x66, 0xF3, 0xF3, 0x63, 0xF6, 0xF3, 0xF3, 0xF6, 0x63, 0x63, 0xF3, 0xF3, 0xB3, 0xB3, 0x33,
+	0x27, 0x27, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xD8, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0x29, 0x29, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x9B, 0x55, 0xB5, 0xBB, 0xB1, 0x2B, 0x88, 0xB2, 0x2D, 0x21, 0x1D, 0x18, 0x77, 0xDD, 0xCD, 0xDD, 0xDD, 0x78, 0xD8, 0x8D, 0xC2, 0x7C, 0x77, 0xEE, 0xEE, 0x7E, 0xEE, 0x40, 0xE0, 0xEC, 0xEC, 0xEE, 0xEE, 0xEC, 0xEE, 0xCE, 0xE0, 0xEE, 0xE0, 0xEC, 0xC7, 0xCC, 0x5A, 0x5F, 0x5C, 0xA5, 0xA5, 0xCA, 0xC5, 0xCA, 0x5A, 0x5C, 0x5C, 0xAC, 0xAC, 0xAA, 0xAA, 0xC0, 0xEE, 0xCC, 0x37, 0x17, 0x11, 0xBB, 0xBB, 0xB5, 0x55, 0xAE, 0x00, 0x00, 0x04, 0x40, 0x90, 0x44, 0x00, 0x44, 0x44, 0x04, 0x7C, 0x61, 0x13, 0x6F, 0x6F, 0x6F, 0x3F, 0x66, 0xFF, 0x3B, 0x3F, 0x3F, 0x33, 0xF3, 0x36, 0x36, 0x3F, 0x33, 0x35, 0x33,
+	0x72, 0xD2, 0x27, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x29, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x9B, 0x55, 0x5B, 0x5B, 0xBB, 0xD1, 0xBD, 0x22, 0x2D, 0x11, 0xD8, 0xD7, 0x7D, 0xD7, 0xDD, 0xCD, 0x7D, 0xDC, 0xDC, 0xDC, 0x87, 0x7C, 0xEE, 0xE4, 0xE7, 0xEE, 0x44, 0x40, 0x00, 0xEC, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0xAC, 0xC3, 0xCA, 0xA5, 0xF5, 0x55, 0x5C, 0x5C, 0xA5, 0x55, 0x55, 0xC5, 0xA5, 0xAA, 0x5A, 0xAA, 0xAA, 0xEE, 0xEE, 0xCE, 0xCC, 0xC3, 0x3B, 0xBB, 0xBB, 0x35, 0x3B, 0x5A, 0xE0, 0x00, 0x04, 0x49, 0x40, 0x90, 0x00, 0x00, 0x40, 0x00, 0x4E, 0x33, 0x61, 0x13, 0x6F, 0x3F, 0x3F, 0xF3, 0xF3, 0xF3, 0x53, 0xF3, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x33, 0xF3, 0x33, 0x3B,
+	0x72, 0x22, 0xD2, 0x22, 0x22, 0xD2, 0x2D, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0xD2, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x9D, 0x55, 0x55, 0xBB, 0xBB, 0xB1, 0xBD, 0x2D, 0xDD, 0x11, 0xD3, 0xD2, 0xD7, 0x1D, 0xCD, 0xD7, 0xD7, 0xD7, 0x72, 0xDF, 0xC7, 0xE7, 0xEE, 0x4E, 0xEE, 0x40, 0x44, 0x40, 0x0E, 0xEE, 0xEE, 0xE0, 0xEC, 0xEE, 0xEE, 0xEE, 0x0E, 0xEE, 0xCC, 0xC7, 0x3C, 0xAA, 0x55, 0xC5, 0xC5, 0xCA, 0x55, 0xC5, 0xC5, 0xCA, 0xAA, 0xCA, 0xC5, 0xAC, 0xAA, 0xCE, 0x0E, 0xEE, 0xE3, 0xEC, 0xC5, 0xBB, 0xBB, 0xBB, 0x5B, 0x55, 0xA3, 0x00, 0x00, 0x09, 0x04, 0x99, 0x00, 0x40, 0x40, 0x44, 0x00, 0x47, 0x33, 0x13, 0x83, 0xF6, 0xF6, 0xF3, 0xFB, 0xF3, 0xB3, 0xB3, 0xF3, 0xF3, 0x3F, 0x33, 0xF3, 0x33, 0xF3, 0x3B, 0x3B, 0x33,
+	0x2D, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x82, 0x22, 0x99, 0x22, 0x29, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x55, 0x55, 0x5B, 0xBB, 0xBB, 0x81, 0x22, 0x11, 0xD1, 0x1D, 0x77, 0xDD, 0xD7, 0xD7, 0xD7, 0xCD, 0xCD, 0xD7, 0xE7, 0x7C, 0xE4, 0xEE, 0xEE, 0xE4, 0x44, 0xE4, 0x00, 0xEE, 0xCE, 0xEE, 0x0E, 0xEE, 0xCE, 0xEE, 0x0E, 0xE0, 0xCE, 0xCC, 0xCC, 0x5A, 0x5A, 0x5F, 0x5C, 0xAC, 0x55, 0xC5, 0x5C, 0xAC, 0xA5, 0xAC, 0xA5, 0xAA, 0xAA, 0xCE, 0x0E, 0xE4, 0xCC, 0xE3, 0xEC, 0x3C, 0x3B, 0xBB, 0xBB, 0x55, 0x5A, 0x30, 0x00, 0x00, 0x04, 0x04, 0x09, 0x00, 0x00, 0x90, 0x40, 0x00, 0xE7, 0xC3, 0x61, 0x36, 0x6F, 0x3F, 0xFB, 0xF3, 0x53, 0x53, 0xFF, 0x3F, 0x35, 0x33, 0xF3, 0x3F, 0x3F, 0x3F, 0x33, 0x33, 0xB3,
+	0x22, 0x72, 0xD2, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x15, 0x55, 0x5B, 0xBB, 0xBB, 0x12, 0x2D, 0xDD, 0xD1, 0xD7, 0x7D, 0x17, 0xCD, 0x7D, 0xCD, 0xDC, 0x8C, 0x77, 0xE2, 0xEE, 0xEE, 0xEE, 0xEE, 0x44, 0xEE, 0xE0, 0x00, 0xEE, 0xE4, 0x40, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0x0E, 0xCC, 0xCE, 0xCC, 0x55, 0x5A, 0xFA, 0xC5, 0x55, 0xC5, 0xCA, 0xC5, 0xC5, 0xAC, 0xAA, 0x5A, 0xCA, 0xCC, 0xE0, 0x0E, 0x34, 0xE5, 0xEC, 0xCE, 0xCF, 0xB5, 0xBB, 0x5B, 0x55, 0x5E, 0x00, 0x00, 0x00, 0x94, 0x90, 0x49, 0x94, 0x00, 0x04, 0x44, 0x44, 0xE3, 0x33, 0x11, 0x66, 0xF6, 0xF3, 0x53, 0xF3, 0xB3, 0xF3, 0xF3, 0x53, 0xB3, 0x35, 0x3F, 0x3F, 0x3F, 0x33, 0xB3, 0x53, 0x33,
+	0x72, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0x29, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x2B, 0x55, 0x5B, 0xBB, 0x5B, 0xB2, 0x28, 0xD1, 0x17, 0x77, 0xD3, 0xDD, 0xD7, 0xD7, 0xDD, 0xCD, 0xDD, 0xEE, 0x9E, 0xEE, 0xE4, 0xEE, 0xEE, 0x40, 0xEE, 0x40, 0x00, 0xEE, 0xE0, 0x04, 0xEE, 0xEE, 0xEE, 0x0E, 0xCE, 0x0C, 0xCC, 0xEC, 0x5A, 0x5A, 0x55, 0xC5, 0x5C, 0x5C, 0xA5, 0xC5, 0xCA, 0xC5, 0xCA, 0x5A, 0xAC, 0xA5, 0xC3, 0x4E, 0xE9, 0xE3, 0xEE, 0xCE, 0x3E, 0x33, 0x3B, 0xBB, 0x55, 0x53, 0x90, 0x00, 0x00, 0x00, 0x90, 0x49, 0x44, 0x09, 0x00, 0x99, 0x04, 0x04, 0x7C, 0x31, 0x73, 0x66, 0xFF, 0x35, 0x3B, 0x35, 0x35, 0x35, 0x3B, 0x3F, 0x35, 0x33, 0x33, 0xF3, 0x3F, 0x33, 0x33, 0x33, 0xB3,
+	0x7D, 0x7D, 0x27, 0xD2, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x55, 0x55, 0xBB, 0xB5, 0xB2, 0x11, 0x1D, 0xDD, 0x7D, 0xD7, 0xCD, 0xC7, 0x7D, 0xCD, 0xD7, 0x77, 0x77, 0xE7, 0xE9, 0xE7, 0xEE, 0x00, 0x0E, 0xCE, 0x00, 0x0E, 0xEE, 0x40, 0x4E, 0x4E, 0x0E, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xAA, 0xA5, 0x55, 0xCA, 0x5C, 0xA5, 0xCA, 0xC5, 0xC5, 0xCA, 0x5C, 0xAA, 0xCA, 0xCA, 0x5A, 0x5C, 0x79, 0x77, 0xEE, 0xEE, 0xCC, 0xE3, 0x73, 0x3B, 0x5B, 0x5A, 0x39, 0x00, 0x00, 0x00, 0x99, 0x09, 0x44, 0x94, 0x00, 0x00, 0x44, 0x40, 0x4E, 0x73, 0x73, 0x13, 0x6F, 0x6F, 0xB3, 0xF3, 0x53, 0xF3, 0xB3, 0x53, 0xF3, 0xF3, 0x3F, 0xFF, 0x35, 0x33, 0x53, 0xB3, 0xB3, 0x33,
+	0x22, 0x22, 0x72, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x92, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0xB5, 0x55, 0xBB, 0x5B, 0x2D, 0x12, 0xD1, 0xD7, 0xD7, 0xCD, 0x8D, 0x7D, 0xCD, 0x7C, 0xCD, 0xC7, 0x7E, 0x7E, 0xEE, 0xEE, 0xE4, 0x00, 0x44, 0xEE, 0x04, 0x04, 0xEE, 0x40, 0xE0, 0x0E, 0x0E, 0xEE, 0xEC, 0xEC, 0xCE, 0xEC, 0xAA, 0x55, 0xAA, 0xAC, 0xA5, 0xC5, 0x55, 0xC5, 0xC5, 0xCA, 0x5A, 0xCA, 0x5C, 0xAC, 0xAA, 0x55, 0x3E, 0x92, 0x73, 0xE3, 0xEC, 0x3E, 0x33, 0xB5, 0x55, 0x52, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x90, 0x04, 0x44, 0xE7, 0x3C, 0x77, 0x33, 0xF6, 0xFB, 0xF3, 0x53, 0x35, 0x35, 0x3F, 0x3B, 0x35, 0x35, 0x33, 0xB3, 0x53, 0x33, 0x3F, 0x33, 0x3B, 0x3B,
+	0x77, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0x29, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x55, 0x5B, 0x5B, 0x2B, 0xD2, 0x1D, 0x2D, 0x1D, 0xDC, 0xDC, 0x7D, 0xDC, 0x77, 0x77, 0x7E, 0xEE, 0xEE, 0xE7, 0xEE, 0xE4, 0x00, 0x0E, 0xCE, 0x00, 0xEE, 0x04, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xEE, 0xCC, 0xAC, 0xAF, 0x5C, 0xA5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x5C, 0xAC, 0xAC, 0xA5, 0x5A, 0xA5, 0x5C, 0x31, 0x29, 0xE3, 0xEE, 0xEC, 0xCC, 0x33, 0x35, 0x51, 0x99, 0x09, 0x00, 0x09, 0x09, 0x90, 0x49, 0x90, 0x90, 0x00, 0x90, 0x44, 0x04, 0x47, 0x37, 0x37, 0x36, 0xFB, 0xFF, 0x35, 0x3B, 0xF3, 0xB3, 0x53, 0xBF, 0x3B, 0x3B, 0x35, 0x33, 0x33, 0x53, 0x33, 0xB3, 0x33, 0x33,
+	0x2D, 0x2D, 0x22, 0xD2, 0x22, 0x22, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0x22, 0x2B, 0x55, 0xB5, 0xBB, 0xD1, 0xDD, 0x77, 0x27, 0xD3, 0xD7, 0x72, 0xDC, 0xDC, 0xDC, 0x77, 0xEE, 0xEE, 0xEE, 0xEE, 0x7E, 0xE0, 0x40, 0xEE, 0xEE, 0x0E, 0xE0, 0x40, 0x04, 0x4E, 0xEE, 0x0E, 0xEE, 0xEE, 0xEC, 0xCC, 0xCA, 0xAC, 0x5F, 0xA5, 0xCA, 0xC5, 0xC5, 0xC5, 0xC5, 0x5C, 0xAC, 0x55, 0xAA, 0x55, 0xA5, 0xAA, 0xA5, 0x57, 0x22, 0x9E, 0x3E, 0xEE, 0x3C, 0xEC, 0x33, 0x19, 0x00, 0x00, 0x09, 0x09, 0x99, 0x44, 0x09, 0x44, 0x00, 0x00, 0x94, 0x00, 0x44, 0x77, 0xC7, 0x73, 0x36, 0xFF, 0x6B, 0xF3, 0xB3, 0x53, 0x53, 0x3B, 0xCF, 0x35, 0x3F, 0x3F, 0x35, 0x33, 0x3F, 0x35, 0x33, 0xB3, 0x53,
+	0x72, 0x22, 0x72, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0x29, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x22, 0x22, 0x98, 0x55, 0x55, 0x5B, 0xB2, 0xD1, 0x22, 0x2D, 0x17, 0xD7, 0x7D, 0x7D, 0xD7, 0x7C, 0x77, 0xEE, 0xE4, 0xEE, 0xE7, 0xEE, 0xE4, 0x0E, 0x0E, 0xEE, 0xEE, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xEC, 0xCC, 0xAC, 0xAF, 0x5C, 0xAC, 0x5C, 0x5C, 0x5C, 0xAC, 0x5C, 0x5C, 0x5A, 0xAC, 0xA5, 0xA5, 0xA5, 0x55, 0x5B, 0x22, 0x99, 0x43, 0xE4, 0xEC, 0x3C, 0x33, 0x72, 0x00, 0x00, 0x00, 0x90, 0x04, 0x49, 0x44, 0x04, 0x90, 0x90, 0x04, 0x04, 0x4E, 0x73, 0x37, 0x37, 0x3F, 0xFB, 0xFF, 0xBF, 0x35, 0x33, 0xB3, 0x53, 0x53, 0xB3, 0xB3, 0x53, 0xB3, 0x53, 0xF3, 0x33, 0x3B, 0x33, 0x33,
+	0x72, 0x72, 0xD2, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0x22, 0x2D, 0x55, 0x55, 0xBB, 0x8D, 0xDD, 0x72, 0x1D, 0xD7, 0xDD, 0xDC, 0x8C, 0xD7, 0x77, 0xCE, 0xEE, 0x94, 0x49, 0xEE, 0xEE, 0xEE, 0x40, 0xE4, 0xEE, 0xEE, 0x00, 0xE4, 0x00, 0xE0, 0x00, 0x0E, 0xEE, 0xEE, 0xEC, 0xCC, 0xCA, 0xCA, 0xCA, 0xC5, 0xCC, 0x5C, 0x55, 0xC5, 0xC5, 0x5C, 0x55, 0xAA, 0xA5, 0x5A, 0x5A, 0xCA, 0xA5, 0xFB, 0x19, 0x24, 0x0E, 0xEE, 0xEC, 0x3C, 0x33, 0x74, 0x00, 0x09, 0x09, 0x99, 0x49, 0x49, 0x49, 0x40, 0x00, 0x00, 0x90, 0x44, 0x4E, 0x73, 0x77, 0x33, 0x3F, 0x35, 0x3B, 0x35, 0x33, 0x53, 0x53, 0xB3, 0xB3, 0x53, 0x53, 0x3B, 0xF3, 0x63, 0x53, 0xB3, 0xB3, 0x3B, 0x3B,
+	0x72, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x8D, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x22, 0x22, 0x2D, 0x55, 0x55, 0x5B, 0x22, 0xD7, 0x17, 0xDD, 0x77, 0xDC, 0xD8, 0xDD, 0xC7, 0xE7, 0xEE, 0xE2, 0x44, 0x40, 0x4E, 0xEE, 0xEE, 0x44, 0xE4, 0x0C, 0xCE, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0E, 0xCE, 0xEC, 0xCC, 0xCA, 0xAC, 0xAA, 0xA5, 0xC5, 0xC5, 0xC5, 0xCA, 0xC5, 0xCC, 0x5C, 0x5A, 0xCA, 0x5A, 0xA5, 0xAA, 0xAA, 0x55, 0x58, 0x12, 0x29, 0x00, 0xEE, 0xEE, 0xC3, 0xC3, 0x79, 0x00, 0x00, 0x00, 0x99, 0x44, 0x94, 0x44, 0x44, 0x00, 0x00, 0x99, 0x04, 0x47, 0x33, 0x37, 0x73, 0x3F, 0x3B, 0x53, 0x53, 0x53, 0xB3, 0xB3, 0x53, 0x53, 0xF3, 0x3B, 0xF3, 0xFF, 0x35, 0x3B, 0x33, 0x35, 0x33, 0x33,
+	0x27, 0x22, 0x2D, 0x27, 0x22, 0x29, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0x2D, 0x22, 0x2D, 0xA5, 0x55, 0xB2, 0x2D, 0xD7, 0x1D, 0xD7, 0x2D, 0xD8, 0xDC, 0xD7, 0x77, 0xE4, 0x44, 0xEE, 0x44, 0x04, 0x4E, 0xE4, 0xEE, 0xE0, 0xEE, 0x0E, 0xEC, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xEE, 0xCC, 0xCC, 0xCA, 0xCA, 0xCA, 0xCA, 0xFC, 0x5C, 0xC5, 0xC5, 0xCC, 0x35, 0xC5, 0x5A, 0x55, 0xAA, 0x5A, 0x55, 0xAA, 0x55, 0x5B, 0x12, 0x29, 0x90, 0x9E, 0xE7, 0xC3, 0xC3, 0x74, 0x90, 0x90, 0x00, 0x90, 0x94, 0x99, 0x49, 0x04, 0x00, 0x90, 0x90, 0x04, 0xE3, 0x31, 0x73, 0x33, 0x3F, 0x3F, 0x3B, 0x3F, 0xB3, 0x53, 0x53, 0x35, 0x3F, 0x35, 0xB3, 0xB3, 0x53, 0xB3, 0x33, 0x53, 0x33, 0x3B, 0x33,
+	0x22, 0xD2, 0x27, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0x82, 0x29, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0x22, 0x22, 0x5A, 0x55, 0xB2, 0x2D, 0x2D, 0x77, 0x7D, 0xDD, 0xDD, 0xDD, 0xCD, 0xCE, 0x99, 0x4E, 0xE4, 0x00, 0x40, 0x04, 0xEE, 0xEE, 0xE0, 0xEE, 0x0E, 0xEC, 0xEE, 0xEE, 0x00, 0x00, 0x0E, 0xCE, 0xEC, 0xCC, 0xCC, 0xAC, 0xAA, 0xAA, 0xAC, 0xFC, 0x35, 0xC5, 0x5C, 0x53, 0x53, 0x55, 0x55, 0x5A, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xF5, 0x82, 0x29, 0x09, 0x0E, 0x9E, 0x3C, 0xFC, 0xE0, 0x00, 0x09, 0x09, 0x09, 0x49, 0x94, 0x44, 0x00, 0x40, 0x09, 0x09, 0x04, 0x73, 0x37, 0x37, 0x33, 0x33, 0x35, 0x35, 0x3F, 0x35, 0x33, 0xB3, 0xB3, 0xB3, 0x53, 0x35, 0x3F, 0x3B, 0xC3, 0x53, 0x35, 0x3B, 0x33, 0xB3,
+	0x22, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0x22, 0x92, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xD2, 0xD2, 0x22, 0x22, 0x5A, 0x55, 0x22, 0xD2, 0x2D, 0x7D, 0xD2, 0xDD, 0x37, 0x7D, 0x77, 0x77, 0x40, 0x4E, 0x44, 0x04, 0x00, 0x44, 0x4E, 0xEE, 0xE0, 0xEE, 0x00, 0xEC, 0xEE, 0xEE, 0x00, 0x00, 0xEC, 0xCE, 0xCC, 0xAC, 0xCE, 0xAC, 0xCA, 0xCA, 0xC5, 0xC5, 0x33, 0x5C, 0x5C, 0x35, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0xA5, 0xAA, 0xAA, 0xAA, 0xAB, 0xF7, 0x29, 0x90, 0x09, 0xE9, 0xCC, 0xF3, 0x90, 0x90, 0x09, 0x09, 0x09, 0x99, 0x49, 0x44, 0x04, 0x00, 0x09, 0x00, 0x9E, 0x7C, 0x37, 0x13, 0x33, 0x35, 0x33, 0x3B, 0x35, 0x3B, 0x35, 0x35, 0x3B, 0x35, 0x3B, 0x3B, 0x35, 0x33, 0x53, 0x33, 0xF3, 0xB3, 0x33, 0x33,
+	0x22, 0x22, 0xD2, 0x27, 0x22, 0x22, 0x92, 0xDD, 0x88, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0xDD, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x2D, 0x2D, 0xD2, 0x22, 0xBA, 0x55, 0xD2, 0xDD, 0x2D, 0x22, 0xD8, 0xDD, 0xD7, 0xE7, 0xEE, 0xEE, 0x49, 0xEE, 0x40, 0x04, 0x04, 0x40, 0x0E, 0x4E, 0x0E, 0xEE, 0x0E, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xCC, 0xE3, 0xAF, 0xCC, 0xCC, 0xCA, 0xCA, 0xCA, 0xC5, 0xCC, 0x5C, 0x5F, 0x35, 0x3F, 0x35, 0xF5, 0x5A, 0xA5, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0xA5, 0xBD, 0x22, 0x90, 0x09, 0xE4, 0x7C, 0x5C, 0xE0, 0x99, 0x04, 0x99, 0x99, 0x90, 0x44, 0x44, 0x00, 0x00, 0x44, 0x00, 0x9E, 0x33, 0x73, 0x73, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0xB3, 0xF3, 0x53, 0x35, 0x35, 0x33, 0xB3, 0x3F, 0x3B, 0x3B, 0x33, 0x53, 0xB3,
+	0x27, 0x2D, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x82, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0x22, 0xD2, 0xD2, 0xD2, 0xDA, 0x5B, 0x2D, 0x28, 0xD2, 0x21, 0x8D, 0xD7, 0x2E, 0x24, 0xEE, 0x9E, 0x49, 0x7E, 0x00, 0x4E, 0x40, 0x04, 0x40, 0x44, 0xE0, 0xEE, 0xEE, 0x0E, 0xC0, 0x00, 0x00, 0x0C, 0xC2, 0x1F, 0xFF, 0xCA, 0xCC, 0xCC, 0xCA, 0xAA, 0xCA, 0xC5, 0xC5, 0x3B, 0x3B, 0xF5, 0x5F, 0x55, 0x5A, 0x5A, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0xA5, 0xF8, 0x22, 0x90, 0x00, 0x94, 0xEC, 0x5C, 0x79, 0x04, 0x09, 0x09, 0x04, 0x49, 0x44, 0x49, 0x00, 0x90, 0x44, 0x00, 0x97, 0x33, 0x37, 0x3B, 0xF3, 0xB3, 0x3B, 0x3B, 0x3B, 0x33, 0x33, 0xF3, 0x53, 0x3B, 0x3B, 0x33, 0xB3, 0x53, 0xF3, 0xB3, 0x3B, 0x33, 0xB3, 0x33,
+	0x22, 0x22, 0x22, 0x27, 0x22, 0x22, 0x22, 0x28, 0x88, 0xBB, 0xBB, 0xBB, 0xB5, 0xBB, 0xB8, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xDD, 0xDD, 0xDD, 0x2D, 0x2D, 0x22, 0x25, 0x55, 0x2D, 0xD2, 0xD2, 0x21, 0xDD, 0xD3, 0xD7, 0x7E, 0xE9, 0x44, 0x40, 0xEE, 0x00, 0x44, 0x44, 0x00, 0xE0, 0x0E, 0x44, 0xEE, 0xCE, 0x0E, 0xEE, 0x00, 0x00, 0xCC, 0x71, 0xF5, 0xFA, 0xCC, 0xCC, 0xAC, 0xAA, 0xAC, 0xC5, 0xC5, 0x3F, 0x33, 0xBF, 0xFF, 0xF5, 0x55, 0xFA, 0xA5, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x56, 0x72, 0x90, 0x00, 0x0E, 0x4C, 0xFC, 0x70, 0x44, 0x04, 0x09, 0x99, 0x44, 0x4E, 0x90, 0x90, 0x09, 0x40, 0x00, 0xE7, 0x33, 0x73, 0x33, 0xF3, 0x3B, 0x33, 0x33, 0x33, 0x33, 0xB3, 0x33, 0x33, 0xB3, 0x53, 0x53, 0x53, 0x3F, 0x3F, 0x33, 0xB3, 0xB3, 0x3B, 0x33,
+	0x2D, 0x27, 0x22, 0x22, 0x22, 0x29, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0xDD, 0x29, 0x29, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0xD2, 0xD2, 0xDD, 0x28, 0x55, 0xDD, 0xD2, 0x21, 0x12, 0x73, 0x3D, 0x77, 0xE9, 0x44, 0x40, 0x00, 0xEE, 0x40, 0xE0, 0x44, 0x04, 0x04, 0x44, 0x0E, 0xEE, 0xEE, 0xEE, 0xCE, 0x00, 0x0C, 0xC7, 0x7F, 0x5F, 0xFA, 0xCA, 0xCC, 0xCA, 0xCA, 0xAA, 0xCC, 0x5C, 0x33, 0xB6, 0xFF, 0xBF, 0x55, 0x5A, 0xAF, 0xAA, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xFB, 0xD2, 0x99, 0x00, 0x04, 0x43, 0xAC, 0x74, 0x04, 0x44, 0x90, 0x44, 0x44, 0x44, 0x99, 0x00, 0x09, 0x00, 0x04, 0x73, 0xC3, 0x73, 0x35, 0x35, 0x35, 0x33, 0xB3, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x3F, 0xB3, 0x33, 0xB3, 0x33, 0x3B, 0x33, 0xB3,
+	0x22, 0x2D, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xD2, 0xD2, 0xDD, 0xD2, 0xD2, 0x22, 0x55, 0x82, 0xD2, 0xDD, 0x21, 0x1D, 0xD7, 0xEE, 0xE9, 0x4E, 0x40, 0x00, 0xEE, 0x4E, 0x0E, 0x40, 0x44, 0x04, 0xE0, 0x00, 0xEE, 0xEE, 0xEE, 0xCE, 0x00, 0xEC, 0x77, 0xF5, 0xFF, 0xAF, 0xAF, 0xCC, 0xCC, 0xAA, 0xAC, 0xC5, 0xC3, 0xB6, 0x6B, 0xFF, 0xF5, 0xF5, 0xFA, 0x5A, 0xA5, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0xD2, 0x99, 0x00, 0x04, 0x47, 0xFC, 0x74, 0x00, 0x40, 0x49, 0x94, 0x94, 0x44, 0x40, 0x90, 0x94, 0x40, 0x44, 0x7C, 0x37, 0x33, 0xBB, 0x3B, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x33, 0x33, 0x33, 0xB3, 0x33, 0xF3, 0x53, 0x33, 0x53, 0xB3, 0xB3, 0x33,
+	0x27, 0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0xDD, 0xDD, 0x2D, 0xDD, 0xD2, 0xDD, 0x2D, 0xB5, 0xDD, 0x2D, 0x81, 0x11, 0x1C, 0x77, 0xE9, 0x94, 0x7E, 0x40, 0x40, 0x4E, 0xE0, 0x0E, 0xE0, 0x0E, 0x00, 0xEE, 0x00, 0xEE, 0xEE, 0x00, 0xEC, 0x0E, 0xCC, 0x73, 0xF6, 0xFF, 0xFA, 0xAC, 0xCC, 0xCA, 0xAA, 0xCC, 0xCC, 0x3B, 0x66, 0xFF, 0xFB, 0x5F, 0xF5, 0xAF, 0xA5, 0xAA, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0x82, 0x29, 0x90, 0x00, 0x4E, 0xFA, 0x74, 0x40, 0x44, 0x04, 0x49, 0x44, 0x44, 0x40, 0x90, 0x40, 0x00, 0x9E, 0x33, 0x33, 0x13, 0xFF, 0xFF, 0x53, 0xB3, 0x53, 0x53, 0xB3, 0xB3, 0x33, 0x33, 0x13, 0xB3, 0x33, 0x33, 0x33, 0x33, 0xB3, 0x33, 0x3B, 0x3B, 0x33,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x82, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0x22, 0xD2, 0x2D, 0x22, 0xDD, 0xD2, 0xD2, 0xD2, 0xDD, 0x28, 0xDD, 0xDD, 0xD1, 0x17, 0x17, 0x74, 0x4E, 0x40, 0xEE, 0x04, 0x04, 0x0E, 0xE4, 0xEE, 0x40, 0x04, 0x0E, 0xEE, 0x0E, 0x0E, 0xEE, 0x00, 0x0E, 0xEC, 0xC7, 0x3F, 0xF3, 0xF5, 0xFA, 0xFA, 0xCC, 0xCA, 0xCC, 0xCC, 0x53, 0xB6, 0xF6, 0xFB, 0xFF, 0xF5, 0xFF, 0x55, 0xAF, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x8D, 0x29, 0x90, 0x00, 0x4E, 0xCF, 0x74, 0x40, 0x44, 0x94, 0x94, 0x44, 0x49, 0x09, 0x04, 0x40, 0x00, 0x47, 0xC3, 0x73, 0x13, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x35, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xB3, 0xB3, 0x36, 0x36,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0x5B, 0x5B, 0xBB, 0xBB, 0x82, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0x22, 0x2D, 0xDD, 0xD2, 0x22, 0xD2, 0x22, 0xD8, 0x22, 0x22, 0xDD, 0x11, 0x17, 0x17, 0xE4, 0x4E, 0x00, 0xEE, 0x0E, 0x04, 0x00, 0x4E, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0xE0, 0xEE, 0x00, 0x0E, 0xCC, 0xEC, 0xF6, 0x6F, 0x3F, 0xAF, 0xAA, 0xAC, 0xCA, 0xFA, 0xC6, 0x3F, 0x66, 0x66, 0xFF, 0xFF, 0xFF, 0x5F, 0x5F, 0xA5, 0xAA, 0xAF, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x8D, 0x29, 0x90, 0x00, 0x47, 0xCA, 0xC4, 0x90, 0x04, 0x04, 0x44, 0x44, 0x49, 0x00, 0x90, 0x40, 0x09, 0xE3, 0x73, 0x37, 0x3B, 0x3B, 0x35, 0x33, 0x53, 0xB3, 0x35, 0x33, 0x33, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x33, 0x33,
+	0x22, 0x2D, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0x29, 0x29, 0x22, 0x29, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x22, 0xD2, 0xD2, 0x22, 0xDD, 0xD2, 0xD2, 0xDD, 0xD2, 0x22, 0xB2, 0xDD, 0xD1, 0x77, 0x77, 0xE9, 0xEE, 0x00, 0xEE, 0xE4, 0x44, 0x44, 0xEE, 0xE4, 0x00, 0x00, 0x0E, 0xE0, 0xEE, 0x0E, 0xEE, 0x00, 0x0E, 0xCE, 0x7F, 0xF6, 0x6F, 0x3F, 0x5A, 0xCA, 0xCC, 0x5C, 0x5C, 0x66, 0xBF, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0xF5, 0xF5, 0xFA, 0xFA, 0x5A, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x6D, 0x22, 0x00, 0x00, 0x44, 0x7F, 0xC9, 0x44, 0x44, 0x44, 0x44, 0x44, 0x90, 0x44, 0x04, 0x40, 0x09, 0x73, 0xC1, 0x73, 0x35, 0x35, 0x3B, 0x3B, 0x33, 0x53, 0x53, 0x5B, 0x53, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xB3, 0xB3,
+	0x27, 0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0x28, 0x88, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0x82, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0x22, 0xDD, 0xD2, 0xD2, 0xBD, 0xDB, 0xBB, 0xD1, 0x1D, 0x37, 0xCE, 0x94, 0xEE, 0x00, 0xEC, 0x00, 0x00, 0xEE, 0xEE, 0xE4, 0x00, 0xE0, 0xEE, 0x00, 0xEE, 0x0E, 0xE0, 0x00, 0xEC, 0xE7, 0xAF, 0x6F, 0xF6, 0x6F, 0x5A, 0xCA, 0xAC, 0xAC, 0x31, 0x68, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0x5F, 0xA5, 0xAF, 0xAF, 0xAA, 0x5A, 0xAA, 0xAA, 0xAA, 0xA5, 0xFD, 0x29, 0x90, 0x00, 0x94, 0x7A, 0xCE, 0x94, 0x4E, 0x49, 0x44, 0xE9, 0x90, 0x04, 0x44, 0x09, 0x04, 0x73, 0x37, 0x31, 0x33, 0xB3, 0xB3, 0x53, 0x3B, 0x33, 0x3B, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x88, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xB8, 0x8D, 0x29, 0x29, 0x29, 0x22, 0x22, 0x27, 0x22, 0xD2, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xDD, 0x2D, 0x2D, 0x88, 0x89, 0x92, 0x27, 0x7D, 0x71, 0x77, 0x74, 0x4E, 0x70, 0x00, 0xEE, 0x40, 0xE0, 0xEE, 0xE4, 0x00, 0x00, 0x00, 0xEE, 0x0E, 0xEE, 0x0E, 0xE0, 0x0E, 0xCC, 0xEF, 0xFF, 0xF5, 0xF6, 0x3F, 0x5A, 0xAC, 0xA5, 0x32, 0x9D, 0x7D, 0x88, 0xF6, 0xFF, 0xFF, 0x5F, 0xFF, 0x5F, 0xF5, 0xF5, 0x5A, 0xFA, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0x6D, 0x99, 0x90, 0x00, 0x0E, 0xEA, 0xC2, 0x94, 0x44, 0x44, 0x44, 0x44, 0x90, 0x00, 0x44, 0x40, 0x9E, 0x33, 0x37, 0x31, 0xB3, 0xB3, 0x53, 0xB3, 0x53, 0x35, 0x35, 0x35, 0x3B, 0x35, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x33, 0x31, 0x33, 0x13,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xDD, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x22, 0xDD, 0xD2, 0xDB, 0xB8, 0x20, 0x00, 0x07, 0xFF, 0x17, 0x77, 0xE4, 0xEE, 0xE0, 0x0E, 0xCE, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x04, 0x40, 0xE4, 0x0E, 0xEE, 0xEE, 0x00, 0x0C, 0xC4, 0x35, 0xFF, 0x55, 0xF3, 0x35, 0xCA, 0xAA, 0x57, 0x29, 0x22, 0x22, 0x72, 0x7D, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xFA, 0x5F, 0xAF, 0xA5, 0x55, 0xAA, 0xAA, 0x56, 0x82, 0x99, 0x00, 0x00, 0x94, 0xEF, 0xF7, 0x40, 0x44, 0x44, 0x4E, 0x44, 0x90, 0x94, 0x04, 0x00, 0x47, 0x7C, 0x73, 0x13, 0x35, 0x3B, 0x3B, 0x33, 0x3B, 0x33, 0x33, 0x53, 0x35, 0x33, 0x33, 0x33, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x31,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x88, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0x82, 0x29, 0x92, 0x22, 0x92, 0x22, 0x27, 0x27, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xDD, 0xD2, 0xDD, 0xDB, 0xB2, 0x09, 0x00, 0x93, 0x5F, 0x8E, 0x2E, 0x44, 0xEC, 0xE0, 0x0E, 0xCE, 0x00, 0x0E, 0x0E, 0x0E, 0x40, 0x40, 0x00, 0xEE, 0xE0, 0xEE, 0x00, 0x00, 0xEC, 0xE7, 0x5F, 0xFF, 0x55, 0xFC, 0xFF, 0xA5, 0xA3, 0x37, 0x7B, 0x8D, 0x72, 0x29, 0x99, 0x27, 0x8F, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xAF, 0xAF, 0xA5, 0xAF, 0xAA, 0x5A, 0x5F, 0x1D, 0x22, 0x99, 0x90, 0x00, 0x94, 0x9F, 0xA7, 0x49, 0x4E, 0x44, 0x44, 0x99, 0x09, 0x00, 0x44, 0x00, 0x47, 0x33, 0x73, 0x33, 0xF3, 0xB3, 0xB3, 0xB3, 0xB3, 0x35, 0x3B, 0x33, 0xB3, 0x35, 0x33, 0xB3, 0x53, 0x35, 0x33, 0x33, 0xC3, 0x33, 0x33, 0x73, 0x33, 0x73,
+	0x27, 0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x22, 0x2D, 0x22, 0xD2, 0xD2, 0xD2, 0xDD, 0xD8, 0xB2, 0x99, 0x00, 0x23, 0x17, 0x79, 0x9E, 0x4E, 0xEE, 0x40, 0xEE, 0xEC, 0x00, 0x0E, 0xEE, 0x04, 0xE0, 0x40, 0x00, 0x0E, 0xEE, 0x0E, 0xE0, 0x0E, 0xC7, 0x75, 0xFF, 0xF5, 0xAF, 0xC3, 0x5A, 0x5A, 0xC1, 0x76, 0x66, 0x8F, 0x68, 0x72, 0x29, 0x92, 0x9D, 0xDF, 0xFF, 0xFB, 0x5B, 0x5F, 0x5A, 0xF5, 0x5F, 0x5A, 0xFF, 0xF8, 0x72, 0x42, 0x22, 0x29, 0x90, 0x00, 0x94, 0x4F, 0xFC, 0x40, 0x44, 0xE4, 0xE4, 0x90, 0x09, 0x00, 0x44, 0x04, 0xE7, 0xC3, 0x73, 0x36, 0xB3, 0xB3, 0x35, 0x33, 0x53, 0xB3, 0x33, 0x3B, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x92, 0xDD, 0x88, 0xBB, 0xB5, 0xBB, 0xB5, 0xBB, 0xB8, 0x82, 0x29, 0x29, 0x22, 0x2E, 0x22, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x22, 0xDD, 0xD8, 0x8D, 0x81, 0x99, 0x90, 0x9C, 0x7E, 0x22, 0xE9, 0xE2, 0xE4, 0x0E, 0xEE, 0xEE, 0xE0, 0x0E, 0x00, 0xEE, 0xE4, 0x00, 0x00, 0x00, 0xEC, 0x0E, 0x00, 0x0C, 0xC7, 0xFF, 0xFF, 0x55, 0xAF, 0xCC, 0xAA, 0xCC, 0x7D, 0xD1, 0x81, 0xDD, 0xF6, 0x8D, 0x22, 0x29, 0x92, 0x28, 0x66, 0xFB, 0xFF, 0xF5, 0xFA, 0xFA, 0xAF, 0xFF, 0xF8, 0x22, 0x2E, 0x27, 0xD7, 0x22, 0x99, 0x90, 0x04, 0x4F, 0xFC, 0xE0, 0x04, 0x44, 0x44, 0x49, 0x00, 0x40, 0x44, 0x44, 0xE3, 0x37, 0x31, 0x36, 0xF3, 0xBF, 0x3B, 0x3B, 0x33, 0xB3, 0xB3, 0xB3, 0x33, 0x3B, 0x35, 0x3B, 0x3B, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC7, 0x3E, 0x33,
+	0x22, 0x2D, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x22, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x88, 0xB8, 0x15, 0x21, 0x14, 0x77, 0xC7, 0x9E, 0x94, 0x47, 0xEE, 0xEE, 0xEE, 0x0E, 0xE0, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0xEC, 0xEF, 0xAF, 0xFF, 0x55, 0xFF, 0xC5, 0xA5, 0xC2, 0x7D, 0xD7, 0xDD, 0xE2, 0x6D, 0x7D, 0x2D, 0x2D, 0x22, 0x22, 0x66, 0xB6, 0xBF, 0xF5, 0xAF, 0xAF, 0xAF, 0x5F, 0x82, 0x22, 0x77, 0x77, 0x72, 0x29, 0x99, 0x90, 0x94, 0x4C, 0xF7, 0x70, 0x94, 0x44, 0x44, 0x40, 0x09, 0x04, 0x44, 0x4E, 0x73, 0x37, 0x73, 0x3F, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x33, 0x35, 0x33, 0x53, 0xB3, 0x33, 0x33, 0x33, 0x53, 0x35, 0x33, 0x53, 0xC3, 0xC3, 0xC3, 0x33, 0xC7,
+	0x27, 0x22, 0x27, 0x22, 0x72, 0x29, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x8D, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0xD8, 0x8B, 0x88, 0x8B, 0xFF, 0xFC, 0x7E, 0xE4, 0x44, 0x0E, 0x7C, 0x0E, 0xEE, 0xE0, 0x0E, 0xEE, 0x0E, 0xE0, 0x00, 0xEC, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x0E, 0xC7, 0xC5, 0xF3, 0x55, 0xAA, 0x5C, 0x5A, 0x57, 0x92, 0x22, 0x29, 0x29, 0x99, 0x2E, 0x99, 0x2D, 0x2D, 0xD2, 0xDD, 0xD8, 0x86, 0x66, 0xFA, 0xF5, 0xAF, 0x5F, 0xF8, 0x11, 0x72, 0x99, 0x99, 0x99, 0x29, 0x24, 0x90, 0x0E, 0x9C, 0xFC, 0xE4, 0x99, 0xE4, 0x44, 0x90, 0x90, 0x40, 0x40, 0x04, 0x7C, 0x11, 0x33, 0x66, 0xB3, 0xF3, 0xB3, 0xB3, 0xB3, 0x3B, 0x33, 0xB3, 0x3B, 0x33, 0xB3, 0xB3, 0x53, 0x33, 0x33, 0x53, 0x33, 0x33, 0x33, 0x3C, 0x3C, 0x7C,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0x5B, 0x5B, 0xBB, 0xBB, 0xDD, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xD8, 0x88, 0x88, 0xB8, 0xBB, 0xD7, 0xF7, 0x00, 0x00, 0x4E, 0xEE, 0xCE, 0xEE, 0xEC, 0xE0, 0xEE, 0xE0, 0x0E, 0x00, 0x00, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC7, 0xFF, 0xF5, 0x55, 0xA5, 0x55, 0x5C, 0x79, 0x29, 0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x28, 0xDD, 0xDD, 0x88, 0x68, 0x66, 0xF5, 0xAA, 0xA5, 0xFA, 0x3D, 0x29, 0x99, 0x90, 0x99, 0x99, 0x94, 0x44, 0x90, 0x09, 0x4C, 0xFC, 0x74, 0x99, 0x49, 0x49, 0x00, 0x04, 0x04, 0x00, 0x0E, 0x33, 0x77, 0x13, 0x63, 0x63, 0xB3, 0xB3, 0x3B, 0x3B, 0x33, 0x33, 0x3B, 0x3B, 0x35, 0x33, 0x33, 0x3B, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C, 0x33,
+	0x22, 0x22, 0x22, 0x22, 0x2E, 0x22, 0x92, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD8, 0x5F, 0xD8, 0x68, 0x8B, 0x88, 0x79, 0x2E, 0x90, 0x04, 0xCE, 0xEC, 0xEE, 0xEE, 0xEC, 0xE0, 0x0E, 0x0E, 0x0E, 0xE0, 0x00, 0x0E, 0xCE, 0xE0, 0x00, 0xE0, 0x00, 0xEC, 0x7C, 0xAF, 0xF5, 0xCA, 0xA5, 0x5C, 0x57, 0x09, 0x99, 0x99, 0x99, 0x09, 0x99, 0x94, 0x90, 0x09, 0x9D, 0xD8, 0xDD, 0x88, 0x88, 0x66, 0xFF, 0xAA, 0xFA, 0xA6, 0x24, 0x09, 0x09, 0x99, 0x09, 0x99, 0x99, 0x99, 0x00, 0x09, 0x9C, 0xFC, 0xEE, 0x99, 0x44, 0x94, 0x04, 0x04, 0x44, 0x40, 0x97, 0x33, 0x13, 0x3B, 0x3B, 0x3B, 0x33, 0x3B, 0x33, 0xB3, 0x53, 0xB3, 0x53, 0xB3, 0x33, 0x3B, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xCE, 0xC3,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x92, 0x92, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xB8, 0x82, 0x29, 0x29, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6F, 0x58, 0xD1, 0x86, 0x86, 0x87, 0x29, 0x90, 0x00, 0x4E, 0xE4, 0xEE, 0xEE, 0xEE, 0xEC, 0xE0, 0x0E, 0x0E, 0xEE, 0xE0, 0x00, 0x00, 0xEE, 0xCE, 0x00, 0x00, 0x00, 0xCC, 0x75, 0xFF, 0xF5, 0x5A, 0x55, 0x55, 0x79, 0x99, 0x99, 0x09, 0x00, 0x99, 0x09, 0xCF, 0x79, 0x09, 0x09, 0xD8, 0xDD, 0xD8, 0x88, 0x66, 0xFA, 0x5A, 0xAA, 0x69, 0x90, 0x99, 0x92, 0x72, 0x90, 0x99, 0x99, 0x99, 0x90, 0x99, 0x9C, 0xFC, 0x2E, 0x99, 0xE9, 0x49, 0x00, 0x40, 0x04, 0x00, 0x47, 0xC3, 0x73, 0x3B, 0x3F, 0xB3, 0xB3, 0xB3, 0x3B, 0x33, 0xB3, 0x3B, 0x33, 0x3B, 0x3B, 0x33, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x53, 0x33, 0x33, 0x3E, 0xC3, 0x3C,
+	0x22, 0x22, 0x22, 0x29, 0x22, 0x29, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0x22, 0x92, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x98, 0xA5, 0xFD, 0x18, 0x1B, 0x82, 0x73, 0xE9, 0x00, 0x00, 0xCE, 0x0E, 0xEE, 0x0E, 0xEE, 0xCE, 0xE0, 0xE0, 0x00, 0x0E, 0xEE, 0x00, 0x00, 0x0E, 0x0E, 0xE0, 0x00, 0x0E, 0xCE, 0xF5, 0xF5, 0xFF, 0xAA, 0xAA, 0xC3, 0x92, 0x29, 0x90, 0x99, 0x99, 0x00, 0x24, 0xFA, 0xFC, 0x90, 0x99, 0x2D, 0xDD, 0x8D, 0x68, 0x66, 0xFA, 0xAA, 0xAF, 0xE9, 0x00, 0x09, 0xCE, 0xFC, 0x99, 0x99, 0x99, 0x90, 0x90, 0x04, 0x07, 0xA7, 0xEE, 0x94, 0xE9, 0x49, 0x00, 0x04, 0x00, 0x04, 0xE3, 0x33, 0x11, 0x63, 0xB3, 0x35, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0xB3, 0x3B, 0x33, 0x33, 0xB3, 0xB3, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3,
+	0x22, 0x22, 0x22, 0x22, 0x92, 0x92, 0x92, 0x2D, 0x88, 0xBB, 0xBB, 0x5B, 0x5B, 0x5B, 0xBB, 0x82, 0x29, 0x92, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x9D, 0xFF, 0xF8, 0x11, 0x81, 0x62, 0xF7, 0x94, 0x00, 0xEE, 0xE4, 0x4E, 0xE0, 0x0E, 0xCE, 0xEE, 0xE0, 0x0E, 0x00, 0x0E, 0xEE, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x0E, 0x0C, 0x73, 0xAF, 0xFF, 0x5A, 0xAA, 0xAA, 0x39, 0x29, 0x99, 0x09, 0x22, 0x92, 0x90, 0xE9, 0xCA, 0xAA, 0x39, 0x2D, 0x2D, 0xDD, 0xD8, 0xD8, 0x8F, 0xFA, 0xAA, 0xA7, 0x99, 0x99, 0x04, 0xE7, 0xAC, 0x79, 0x09, 0x09, 0x09, 0x00, 0x09, 0x47, 0xAC, 0xE2, 0x42, 0x49, 0x90, 0x09, 0x40, 0x40, 0x04, 0x73, 0x31, 0x13, 0x66, 0x3B, 0x3B, 0x3B, 0x33, 0xB3, 0x33, 0x3B, 0x33, 0x33, 0xB3, 0xB3, 0x33, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0xEC, 0xE3, 0x33,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x92, 0x92, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8D, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x92, 0xF7, 0xD5, 0xBB, 0x11, 0x17, 0x7E, 0x00, 0x0E, 0xEE, 0x04, 0xEE, 0xE0, 0x0E, 0xEE, 0xEC, 0xE0, 0x00, 0xE0, 0x0E, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xE5, 0xF6, 0xFF, 0x5A, 0xAF, 0xA3, 0x27, 0x22, 0x99, 0x90, 0x27, 0x99, 0x29, 0xE4, 0xAA, 0xAA, 0xA2, 0x22, 0x22, 0xDD, 0xDD, 0xD8, 0x6F, 0xFA, 0xAA, 0xF2, 0x24, 0x7E, 0xEE, 0xEE, 0xFC, 0x79, 0x90, 0x09, 0x09, 0x09, 0x9E, 0x07, 0xAC, 0xE2, 0xEE, 0x44, 0x09, 0x04, 0x40, 0x00, 0x0E, 0x7C, 0x37, 0x33, 0x66, 0x66, 0x3B, 0x33, 0xB3, 0x33, 0xB3, 0x13, 0x1B, 0x3B, 0x3B, 0x3B, 0x1B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x33, 0x33, 0x33, 0x33,
+	0x22, 0x22, 0x22, 0x29, 0x29, 0x29, 0x29, 0x2D, 0xD8, 0xBB, 0xB5, 0xB5, 0xB5, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x99, 0x90, 0xC7, 0x7F, 0x55, 0x56, 0x90, 0x00, 0x00, 0xEE, 0xE4, 0x4E, 0x40, 0xEE, 0xEE, 0xCE, 0xCE, 0xE0, 0xE0, 0x0E, 0x00, 0xEE, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0xCE, 0x3F, 0x33, 0xF5, 0xAA, 0xAA, 0x32, 0x7D, 0xDD, 0xD2, 0x99, 0x27, 0x79, 0x94, 0xEC, 0xAA, 0xAA, 0xFD, 0x2D, 0xD2, 0xDD, 0xDD, 0x88, 0x6F, 0xFA, 0xAA, 0x37, 0x37, 0x4E, 0xEE, 0x4C, 0xAC, 0x79, 0x99, 0x00, 0x00, 0x00, 0x9E, 0x07, 0xFC, 0xEE, 0x9E, 0x94, 0x90, 0x04, 0x04, 0x04, 0x07, 0x73, 0x33, 0x13, 0x63, 0xB3, 0xB3, 0x3B, 0x33, 0xB3, 0x3B, 0x3B, 0x33, 0xB1, 0x31, 0xB3, 0x13, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0xE3, 0xE3, 0x3C,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0x5B, 0x5B, 0xB8, 0x82, 0x22, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x29, 0x99, 0x92, 0x3F, 0xF5, 0xAA, 0xA9, 0x40, 0x00, 0x00, 0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE7, 0xA3, 0xF5, 0x5A, 0xAA, 0x5C, 0x27, 0xDD, 0xDD, 0xD7, 0x29, 0x2D, 0xD3, 0x77, 0xCA, 0xAA, 0xAA, 0xC8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8F, 0xAA, 0xAA, 0x19, 0xDC, 0xDE, 0x27, 0xCA, 0xFC, 0x79, 0x99, 0x90, 0x90, 0x90, 0x94, 0x0E, 0xAF, 0x7E, 0x2E, 0x99, 0x09, 0x40, 0x44, 0x00, 0x07, 0xC3, 0x37, 0x36, 0x66, 0x3B, 0x33, 0x33, 0x33, 0x13, 0xB3, 0x33, 0x13, 0x3B, 0x3B, 0x31, 0xB3, 0x31, 0x3B, 0x33, 0x33, 0x33, 0xE3, 0xE3, 0x33, 0x33, 0x53, 0x55,
+	0x27, 0x22, 0x22, 0x29, 0x29, 0x29, 0x92, 0x2D, 0x88, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0x22, 0xD2, 0xDD, 0x99, 0x99, 0x27, 0x3C, 0xFF, 0xCA, 0xA6, 0x44, 0xEE, 0x00, 0xEC, 0xCE, 0xE4, 0x0E, 0xEE, 0xEE, 0xEE, 0xCE, 0xCC, 0xEE, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEC, 0xEF, 0xFF, 0xFF, 0xAA, 0x5A, 0x7E, 0x1D, 0xDD, 0x86, 0x8D, 0xD2, 0x22, 0xDD, 0xC6, 0xFA, 0xAA, 0xAF, 0xF6, 0x8D, 0xDD, 0xDD, 0xDD, 0xD8, 0x6F, 0xAA, 0xAA, 0x37, 0x27, 0xC3, 0xCC, 0xAF, 0xFD, 0x29, 0x99, 0x99, 0x90, 0x90, 0x9E, 0x9E, 0xAC, 0x7E, 0xE2, 0x44, 0x00, 0x00, 0x44, 0x09, 0x97, 0xC1, 0x31, 0x36, 0x63, 0x63, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x33, 0xB3, 0x13, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x35, 0x55,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x92, 0x29, 0x2D, 0x88, 0xBB, 0xB5, 0xB5, 0xB5, 0xB5, 0xB8, 0x8D, 0x22, 0x22, 0x92, 0x22, 0x2D, 0x22, 0xDD, 0x99, 0x99, 0xDC, 0xCC, 0xCF, 0xAF, 0xE0, 0x00, 0xEE, 0xEE, 0xCE, 0xEE, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xCE, 0xCE, 0xEE, 0xEE, 0x00, 0x00, 0xE0, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0xCE, 0x3A, 0xFF, 0xA5, 0xAA, 0xA3, 0xED, 0xDD, 0xD1, 0xD8, 0x68, 0xDD, 0xDD, 0x77, 0xD7, 0xC1, 0xCC, 0xCF, 0xFF, 0xF8, 0xDD, 0xDD, 0xDD, 0xDD, 0x6F, 0xFA, 0xAA, 0xFF, 0x3D, 0x6C, 0xDC, 0xCD, 0x7E, 0x29, 0x29, 0x99, 0x90, 0x94, 0x4E, 0x07, 0xCF, 0xC4, 0xEE, 0x90, 0x90, 0x00, 0x99, 0x09, 0xE7, 0x33, 0x73, 0x36, 0x6B, 0x33, 0xF3, 0x33, 0x33, 0x13, 0x53, 0x33, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0x31, 0x31, 0x33, 0x73, 0x3E, 0x37, 0x33, 0x35, 0x55, 0x55, 0x35,
+	0x22, 0x22, 0x22, 0x29, 0x22, 0x92, 0x92, 0x2D, 0xD8, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0x22, 0xD2, 0xDD, 0x99, 0x2D, 0xFF, 0xCC, 0xCC, 0xCE, 0x0E, 0x00, 0xEE, 0xCE, 0xEE, 0xEE, 0xE0, 0x0E, 0xEE, 0xEE, 0xEE, 0xCE, 0xCE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC7, 0xF5, 0xCF, 0x5A, 0x5A, 0x72, 0x2D, 0xD1, 0x18, 0x88, 0xD6, 0x8C, 0x8D, 0xDD, 0x72, 0xDD, 0x77, 0xDF, 0xF6, 0x88, 0xDD, 0xDD, 0xDD, 0xDD, 0x8F, 0xAA, 0xAA, 0xFF, 0xFD, 0x8D, 0x77, 0xDE, 0x92, 0x92, 0x22, 0x99, 0x90, 0x90, 0x49, 0x9E, 0xFA, 0x7E, 0x24, 0x94, 0x40, 0x04, 0x40, 0x99, 0x73, 0x37, 0x33, 0x66, 0x3B, 0x3B, 0x33, 0xB3, 0xB3, 0xB3, 0x33, 0xB3, 0xB3, 0x33, 0xB3, 0x33, 0x11, 0x33, 0x13, 0x73, 0x3E, 0x33, 0x33, 0x53, 0x53, 0x53, 0x5B, 0x55,
+	0x27, 0x27, 0x22, 0x22, 0x92, 0x92, 0x92, 0x2D, 0x88, 0xBB, 0xB5, 0xB5, 0xB5, 0xBB, 0xBB, 0x8D, 0x22, 0x22, 0x22, 0x22, 0x22, 0xD2, 0x2D, 0xD2, 0xD1, 0x3C, 0x7E, 0xEE, 0xEE, 0x40, 0x04, 0x0E, 0xCC, 0xEC, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xCC, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0x4C, 0x77, 0xF3, 0x5F, 0x5A, 0xA3, 0x42, 0x7D, 0x18, 0x81, 0x86, 0x88, 0x88, 0xC8, 0xDD, 0xD8, 0x8C, 0xD8, 0xC8, 0x68, 0xC8, 0xDD, 0xDD, 0xDD, 0xDD, 0x8F, 0xFA, 0xAA, 0xAC, 0x8C, 0xDC, 0xDD, 0xDD, 0x29, 0x22, 0x92, 0x99, 0x90, 0x99, 0x4E, 0x0E, 0xFF, 0xCE, 0xEE, 0x90, 0x40, 0x04, 0x90, 0x09, 0x33, 0x37, 0x33, 0x63, 0xB3, 0x33, 0xB3, 0x33, 0x33, 0x33, 0xB3, 0x33, 0x3B, 0x33, 0x33, 0xB3, 0x31, 0x33, 0x33, 0x37, 0x33, 0x33, 0x35, 0x55, 0x55, 0xB5, 0xB5, 0xB5,
+	0x22, 0x22, 0x22, 0x2E, 0x29, 0x29, 0x92, 0x2D, 0xD8, 0xBB, 0xBB, 0xB5, 0xBB, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x22, 0x22, 0xDD, 0x88, 0xFF, 0xCC, 0x7E, 0x4E, 0xEE, 0x00, 0x04, 0x0E, 0xEC, 0xCE, 0xCE, 0xE0, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xEE, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x2F, 0xFF, 0x5C, 0xAA, 0x39, 0x22, 0xDD, 0xD8, 0x68, 0x68, 0x6C, 0x86, 0x8C, 0x8C, 0x8C, 0x88, 0x66, 0x6F, 0xCF, 0xF6, 0xDD, 0xDD, 0xDD, 0xDD, 0x8C, 0xAA, 0xAA, 0xAF, 0xFF, 0x8D, 0xDD, 0xDD, 0x22, 0x22, 0x22, 0x99, 0x90, 0x09, 0x49, 0x9E, 0xCA, 0xC2, 0x42, 0x00, 0x90, 0x04, 0x40, 0x02, 0x73, 0x73, 0x33, 0xB3, 0x3B, 0x33, 0x33, 0xB3, 0xB3, 0xB3, 0x33, 0xB3, 0x33, 0x3B, 0x33, 0x33, 0x13, 0x33, 0x33, 0x73, 0xE3, 0x35, 0x53, 0x5B, 0x5B, 0x5B, 0x5B, 0x55,
+	0x27, 0x22, 0x2E, 0x29, 0x22, 0x92, 0x99, 0x2D, 0xD8, 0xBB, 0xB5, 0xBB, 0x5B, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x86, 0xFC, 0xD7, 0x44, 0xEE, 0xEE, 0x00, 0xEE, 0x0E, 0xEE, 0xEE, 0xCE, 0xE0, 0x0E, 0xEE, 0xEE, 0xCE, 0xEE, 0xEC, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x0E, 0x32, 0x75, 0xF5, 0x55, 0xAF, 0x92, 0x2D, 0xDD, 0x88, 0x86, 0x8C, 0x66, 0xF6, 0x86, 0x86, 0x88, 0xF6, 0xCF, 0xFF, 0xF6, 0x6D, 0xDD, 0x8D, 0xDD, 0xDD, 0x8C, 0xFA, 0xAA, 0xAF, 0xFF, 0x6C, 0x68, 0xDD, 0xDD, 0x2D, 0x22, 0x29, 0x99, 0x09, 0x4E, 0x02, 0xCF, 0xCE, 0x94, 0x09, 0x00, 0x94, 0x90, 0x02, 0x33, 0x37, 0x36, 0x3B, 0x33, 0xF3, 0xB3, 0x33, 0x33, 0x33, 0xB3, 0x13, 0xB3, 0x33, 0x33, 0x33, 0x31, 0x31, 0x73, 0x33, 0x33, 0x55, 0x55, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+	0x22, 0x22, 0x22, 0x92, 0x92, 0x99, 0x92, 0x22, 0x88, 0xBB, 0xBB, 0x5B, 0xB5, 0xBB, 0xBB, 0x8D, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0x22, 0xDC, 0x77, 0xEE, 0xE4, 0x7E, 0x44, 0x00, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0x00, 0xE0, 0xEE, 0xEE, 0xEC, 0xCE, 0xEE, 0xEC, 0x00, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C, 0x77, 0x3F, 0x55, 0x5A, 0xAE, 0x92, 0xD2, 0xD8, 0xD8, 0x86, 0x66, 0xFF, 0xFF, 0xFF, 0x6F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xDC, 0x88, 0xDD, 0xDD, 0xDF, 0xAA, 0xAA, 0xAA, 0xF6, 0x66, 0x8C, 0x8D, 0xDD, 0xD2, 0x72, 0x99, 0x99, 0x94, 0x49, 0x04, 0xFA, 0xC7, 0x4E, 0x09, 0x90, 0x00, 0x00, 0x97, 0x73, 0x73, 0x3B, 0x33, 0x3B, 0x33, 0x33, 0xB3, 0xB3, 0xB3, 0x33, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x3B, 0x5B, 0x5B, 0x5B, 0xBB, 0x5B, 0xB5, 0x5B,
+	0x22, 0x92, 0x92, 0x29, 0x29, 0x29, 0x92, 0x22, 0xD8, 0xBB, 0xBB, 0xB5, 0xBB, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0x22, 0x22, 0xD7, 0x7E, 0xCC, 0x7C, 0xCC, 0xC4, 0x44, 0x0E, 0xEE, 0xEC, 0xCE, 0xEE, 0xEE, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xCE, 0xEC, 0xCE, 0x0E, 0x0E, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0xEF, 0x27, 0x5F, 0x55, 0xAA, 0x20, 0x22, 0xDD, 0xDD, 0x88, 0x88, 0x68, 0x6F, 0x66, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xF6, 0x88, 0x88, 0x8D, 0xDD, 0xDD, 0xDC, 0xFA, 0xAA, 0xAF, 0xFF, 0x66, 0x8D, 0x8D, 0xDD, 0xDD, 0xD2, 0x99, 0x99, 0x99, 0x9E, 0x04, 0xCF, 0xF7, 0x49, 0x04, 0x00, 0x49, 0x00, 0x97, 0x33, 0x73, 0x36, 0xF3, 0xB3, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xB1, 0x31, 0x33, 0x73, 0x73, 0x33, 0x35, 0xB5, 0x55, 0xBB, 0x5B, 0xB5, 0xBB, 0x55,
+	0x22, 0x22, 0x29, 0x22, 0x92, 0x92, 0x99, 0x2D, 0xD8, 0xBB, 0xB5, 0xBB, 0x5B, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x22, 0xDD, 0xDC, 0xCC, 0xCC, 0xCC, 0xCE, 0xE4, 0x4E, 0xEE, 0xEE, 0xCE, 0xEE, 0xEC, 0xE0, 0x0E, 0x0E, 0xEE, 0xEE, 0xCE, 0xEC, 0xCC, 0xEE, 0xEE, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0xC7, 0x2F, 0xFA, 0xAC, 0xA7, 0x02, 0x22, 0x2D, 0xDD, 0xD8, 0x88, 0x66, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x6D, 0x8C, 0xDC, 0xDD, 0xDD, 0xDC, 0xFA, 0xAA, 0xAA, 0xFF, 0x66, 0x6C, 0xD8, 0xDD, 0xDD, 0x72, 0x29, 0x99, 0x99, 0x99, 0x04, 0xFA, 0xF7, 0x49, 0x09, 0x90, 0x90, 0x90, 0x23, 0x37, 0x31, 0x36, 0x33, 0x33, 0xB3, 0x3B, 0x3B, 0x3B, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x13, 0x33, 0x37, 0x33, 0x3B, 0xB5, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x55, 0xB5,
+	0x2E, 0x2E, 0x29, 0x29, 0x29, 0x99, 0x92, 0x22, 0x88, 0xBB, 0xBB, 0xB5, 0xB5, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0x2D, 0xD8, 0x6C, 0xCC, 0xCC, 0xEE, 0xEE, 0x4E, 0x4E, 0x0E, 0xEE, 0xEE, 0xCC, 0xEE, 0xE0, 0x00, 0x00, 0x0E, 0xEE, 0xEC, 0xEE, 0xEE, 0xEC, 0xCE, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0xC2, 0x75, 0xCA, 0xAA, 0xF0, 0x09, 0x22, 0xDD, 0xDD, 0x88, 0x88, 0x68, 0xF6, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x8C, 0x8D, 0xCD, 0xDD, 0xDD, 0xDC, 0xFA, 0xAA, 0xAA, 0xFF, 0x66, 0x88, 0xD8, 0xDD, 0xDD, 0xD2, 0x29, 0x94, 0x99, 0xE9, 0x04, 0xCF, 0xCC, 0x90, 0x09, 0x00, 0x99, 0x09, 0xE3, 0x31, 0x13, 0xB3, 0x53, 0xB3, 0x33, 0xF3, 0x33, 0x33, 0x3B, 0x33, 0x33, 0x33, 0x11, 0x31, 0x31, 0x73, 0x73, 0x33, 0x35, 0x5B, 0x55, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x55,
+	0x92, 0x22, 0x92, 0x92, 0x92, 0x92, 0x99, 0x2D, 0xD8, 0xBB, 0xBB, 0x5B, 0x5B, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0xDD, 0xDD, 0xDC, 0xDC, 0xEE, 0xEE, 0xEE, 0x44, 0xE0, 0xEE, 0xEE, 0xCE, 0xCE, 0xEE, 0x0E, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0xEE, 0xCC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x77, 0xFF, 0xA5, 0xAA, 0x00, 0x92, 0x2D, 0xDD, 0xDD, 0xD8, 0x88, 0x68, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x88, 0x8C, 0xD8, 0xDC, 0xDD, 0xDC, 0xFA, 0xAA, 0xAA, 0xF6, 0x66, 0xC8, 0x8D, 0x8D, 0xDD, 0xD7, 0x99, 0x94, 0x99, 0x94, 0x04, 0x3F, 0xFC, 0x99, 0x00, 0x90, 0x90, 0x09, 0x73, 0x37, 0x13, 0xB3, 0x33, 0x3B, 0x3B, 0x33, 0xB3, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x31, 0x33, 0x13, 0x3E, 0x33, 0x33, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x55, 0x55,
+	0x29, 0x29, 0x29, 0x29, 0x29, 0x99, 0x99, 0x22, 0x88, 0xBB, 0xBB, 0xBB, 0x5B, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x2D, 0x2D, 0x2D, 0x7C, 0xEE, 0x7E, 0xEE, 0xE0, 0xE0, 0xEE, 0xEE, 0xEC, 0xCC, 0xEE, 0xEE, 0xE0, 0x00, 0xE0, 0x00, 0xEE, 0xEE, 0xEE, 0x00, 0xEE, 0xCE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x73, 0x5F, 0x5A, 0xAE, 0x00, 0x92, 0x22, 0xDD, 0xDD, 0xD8, 0x88, 0x68, 0x66, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x68, 0x88, 0x8C, 0xDD, 0xDD, 0xDD, 0xFA, 0xAA, 0xAA, 0x6F, 0x66, 0x66, 0xD8, 0xDD, 0xDD, 0xD2, 0x29, 0x94, 0x99, 0x24, 0x04, 0x7F, 0xCC, 0x90, 0x00, 0x90, 0x00, 0x09, 0x33, 0x11, 0x13, 0xB3, 0xB3, 0xB3, 0x33, 0x33, 0x33, 0xB3, 0x33, 0x33, 0x3B, 0x33, 0x33, 0x13, 0x37, 0x33, 0x33, 0x3B, 0x55, 0xB5, 0xB5, 0xBB, 0x5B, 0xB5, 0xB5, 0x5B, 0x55,
+	0x29, 0x24, 0x29, 0x29, 0x92, 0x99, 0x92, 0x22, 0x88, 0x8B, 0xB5, 0xB5, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x22, 0x22, 0x22, 0x2D, 0x2D, 0xC7, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0x00, 0xE0, 0x00, 0xE0, 0x0E, 0x0E, 0xEE, 0x00, 0xEE, 0xCC, 0xE4, 0x00, 0x0E, 0x00, 0x0E, 0xCC, 0x7C, 0xA5, 0xFA, 0xC0, 0x00, 0x92, 0x2D, 0xDD, 0xDD, 0xD8, 0xD8, 0x8C, 0x86, 0x6F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xF6, 0x68, 0x86, 0x8C, 0xD8, 0xDD, 0xDD, 0xDC, 0xCA, 0xAA, 0xAA, 0xF6, 0xF6, 0x8C, 0x8D, 0xDD, 0xDD, 0xD7, 0x99, 0x94, 0x94, 0xE9, 0x00, 0xCF, 0xC6, 0x20, 0x00, 0x94, 0x90, 0x92, 0x73, 0x31, 0x3B, 0x3B, 0x33, 0x3F, 0x35, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x33, 0xE3, 0xEB, 0x55, 0xBB, 0x5B, 0x5B, 0x5B, 0x55, 0x5B, 0x55, 0x55, 0x55,
+	0x29, 0x24, 0x92, 0x99, 0x29, 0x92, 0x99, 0x22, 0x88, 0xBB, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x2D, 0x2D, 0x7E, 0x77, 0xCC, 0xEE, 0xCE, 0xEE, 0xCE, 0xEE, 0xEE, 0xCE, 0xEE, 0xE0, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0xEC, 0xEC, 0xCE, 0x00, 0x00, 0x00, 0x0E, 0xCE, 0x75, 0xFA, 0xAC, 0x00, 0x00, 0x92, 0x22, 0xDD, 0xDD, 0xDD, 0x88, 0x88, 0xC8, 0xF6, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x66, 0x88, 0xD8, 0x8D, 0xDD, 0xDD, 0xDC, 0x6F, 0xAA, 0xAA, 0xF6, 0x66, 0x68, 0xCD, 0x8D, 0xDD, 0xD7, 0x99, 0x94, 0x09, 0xE9, 0x00, 0x7F, 0xCC, 0x70, 0x00, 0x49, 0x00, 0x97, 0x31, 0x73, 0xBF, 0x3F, 0x3B, 0x33, 0x33, 0x33, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x11, 0x33, 0x33, 0xE3, 0x31, 0x33, 0xB5, 0xB5, 0xB5, 0xBB, 0x5B, 0xB5, 0xB5, 0x55, 0x55, 0x55,
+	0x92, 0x92, 0x42, 0x92, 0x99, 0x99, 0x99, 0x22, 0x88, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0x88, 0x22, 0x92, 0x22, 0x22, 0x22, 0xD7, 0x7E, 0x7C, 0xCE, 0xEE, 0xEE, 0xEC, 0xEE, 0xE0, 0xEE, 0xCE, 0xEE, 0xEE, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0xEE, 0x0E, 0x00, 0xE7, 0xE7, 0x53, 0x40, 0x00, 0x00, 0x0C, 0x77, 0xCA, 0xAA, 0xAE, 0x00, 0x09, 0x92, 0x2D, 0xDD, 0xDD, 0xD8, 0xD8, 0x68, 0x86, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x68, 0x88, 0x8D, 0x88, 0xDD, 0xDD, 0xDD, 0xCF, 0xAA, 0xAA, 0xF6, 0x66, 0x86, 0xD8, 0xDD, 0xDD, 0x72, 0x99, 0x09, 0x09, 0x20, 0x00, 0x7A, 0x3F, 0x79, 0x00, 0x94, 0x09, 0x97, 0x33, 0x13, 0xFF, 0xB3, 0xB3, 0x3B, 0x3B, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x13, 0x33, 0x33, 0x13, 0x31, 0xE3, 0xB5, 0xB5, 0xBB, 0xBB, 0xB5, 0xB5, 0x5B, 0x55, 0x55, 0x55, 0x55,
+	0x92, 0x99, 0x24, 0x99, 0x99, 0x99, 0x99, 0x2D, 0xD8, 0xBB, 0xBB, 0xBB, 0x5B, 0x5B, 0xBB, 0x8D, 0x22, 0x99, 0x2D, 0x22, 0x22, 0x77, 0xCC, 0xCE, 0xEE, 0xCC, 0xEE, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0x0E, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0xE7, 0x39, 0x7C, 0xC4, 0x00, 0x00, 0xEC, 0x77, 0x5A, 0xAA, 0xC0, 0x00, 0x09, 0x92, 0x22, 0xDD, 0xDD, 0xDD, 0x88, 0x88, 0xC8, 0x68, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x68, 0x88, 0xD8, 0xDD, 0xDD, 0xDD, 0xDC, 0x8F, 0xAA, 0xAA, 0xFF, 0x8F, 0x8C, 0x8D, 0xDD, 0xDD, 0x7E, 0x99, 0x99, 0x99, 0xE9, 0x00, 0x7F, 0xCC, 0x39, 0x00, 0x94, 0x00, 0x21, 0x11, 0x13, 0xB3, 0xB3, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x31, 0x31, 0x33, 0x37, 0x37, 0x33, 0xB5, 0xB5, 0xBB, 0x5B, 0x5B, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x29, 0x24, 0x24, 0x29, 0x24, 0x99, 0x99, 0x22, 0x88, 0x8B, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x2D, 0x22, 0x2D, 0xCF, 0xC7, 0xEE, 0x4E, 0xCC, 0xEC, 0xE0, 0x0E, 0xEE, 0xEE, 0xCC, 0xEE, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xEE, 0x0E, 0x73, 0xC2, 0x97, 0xFE, 0x00, 0x00, 0xC7, 0x7C, 0xAA, 0xAA, 0x90, 0x00, 0xE9, 0x92, 0x22, 0xDD, 0xDD, 0xD8, 0xD8, 0x88, 0xC8, 0xF6, 0x66, 0xFF, 0xFF, 0xFB, 0xFB, 0x66, 0x68, 0x88, 0xD8, 0x8D, 0xDD, 0xDD, 0xDD, 0xCF, 0xAA, 0xAA, 0xF6, 0x66, 0x88, 0x88, 0xD8, 0xDD, 0x72, 0x90, 0x99, 0x99, 0x20, 0x00, 0xEF, 0x63, 0xC9, 0x00, 0x09, 0x09, 0x27, 0x31, 0x13, 0xB3, 0x53, 0xB3, 0xB3, 0x53, 0xB3, 0x33, 0x33, 0x33, 0x13, 0x13, 0x13, 0x33, 0x33, 0x73, 0x1B, 0x5B, 0x5B, 0xBB, 0xB5, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x92, 0x42, 0x49, 0x24, 0x99, 0x99, 0x99, 0x2D, 0xD8, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0x8D, 0x29, 0x29, 0x2D, 0x7E, 0xCF, 0xCD, 0xCE, 0xE4, 0xEC, 0xCE, 0xEE, 0xE0, 0xEE, 0xEE, 0xEC, 0xEC, 0xEC, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xE0, 0xEE, 0x7F, 0xA3, 0x04, 0xCE, 0x00, 0x04, 0xC7, 0x7F, 0xAA, 0x5E, 0x00, 0x00, 0x99, 0x92, 0x22, 0x2D, 0xDD, 0xDD, 0x8D, 0x88, 0x8C, 0x86, 0x68, 0xF6, 0x6F, 0xBF, 0xBF, 0x66, 0x68, 0x8D, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xCF, 0xAA, 0xAA, 0xF6, 0x66, 0xC8, 0xCD, 0xDD, 0xDD, 0xE9, 0x90, 0x99, 0x49, 0xE9, 0x00, 0x2C, 0x6C, 0x34, 0x00, 0x00, 0x09, 0x73, 0x11, 0x13, 0xB3, 0xB3, 0xB3, 0x33, 0x33, 0x33, 0xB3, 0x3B, 0x33, 0x33, 0x13, 0x13, 0x13, 0x73, 0x73, 0x3B, 0x5B, 0x5B, 0xBB, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x24, 0x29, 0x24, 0x99, 0x24, 0x99, 0x99, 0x22, 0x88, 0xBB, 0xB5, 0xBB, 0xBB, 0x5B, 0xBB, 0x8D, 0x22, 0x99, 0x27, 0xCD, 0xCD, 0xE7, 0xCE, 0xEE, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0xEE, 0xEC, 0xEE, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x0E, 0xEC, 0x44, 0xE7, 0x7F, 0xAC, 0x99, 0xE0, 0x00, 0x07, 0x77, 0x1A, 0xAA, 0xC0, 0x00, 0x00, 0x29, 0x92, 0x22, 0xDD, 0xDD, 0xDD, 0x8D, 0x88, 0xCD, 0x86, 0x66, 0x86, 0x66, 0xF6, 0x66, 0x66, 0x88, 0x88, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xCF, 0xFA, 0xAA, 0xFF, 0x86, 0x88, 0xD8, 0xCD, 0xDD, 0x74, 0x00, 0x09, 0x49, 0x29, 0x00, 0x9F, 0xC3, 0xC2, 0x00, 0x90, 0x09, 0x11, 0x11, 0x13, 0xB3, 0x3B, 0x3B, 0x3B, 0x3B, 0x33, 0x3B, 0x33, 0x33, 0x31, 0x31, 0x33, 0x73, 0x37, 0x31, 0x3B, 0x5B, 0xBB, 0x5B, 0x5B, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x92, 0x4E, 0x92, 0x4E, 0x99, 0x99, 0x99, 0x22, 0x88, 0x8B, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0x8D, 0x29, 0x29, 0x22, 0x7D, 0x77, 0xCC, 0xCE, 0xEE, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0xEE, 0x47, 0xD3, 0xE2, 0xCD, 0x90, 0x90, 0x00, 0x0C, 0x77, 0xFA, 0xAF, 0x00, 0x00, 0x00, 0xE9, 0x92, 0x22, 0xD2, 0xDD, 0xDD, 0xD8, 0x88, 0x88, 0x68, 0x86, 0x66, 0x66, 0x6F, 0x66, 0x66, 0x88, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8C, 0xFA, 0xAA, 0xA8, 0x66, 0x8C, 0x8D, 0xDD, 0xD7, 0xE9, 0x04, 0x49, 0x49, 0xE9, 0x00, 0x93, 0xFC, 0x3E, 0x00, 0x00, 0x92, 0x11, 0x17, 0xB3, 0xF3, 0x53, 0x33, 0x33, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x13, 0x13, 0x33, 0x73, 0x13, 0xB5, 0xB5, 0xBB, 0xB5, 0xBB, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x5A,
+	0x29, 0x29, 0x24, 0x29, 0x99, 0x99, 0x99, 0x22, 0xD8, 0xBB, 0xBB, 0xBB, 0x5B, 0x5B, 0xB8, 0x8D, 0x22, 0x29, 0x92, 0xE7, 0xC7, 0x7C, 0x7E, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEC, 0xCE, 0xEE, 0x00, 0xE0, 0xE0, 0x00, 0x0E, 0xE4, 0x23, 0x72, 0x94, 0x70, 0x00, 0x00, 0x00, 0x27, 0x73, 0x5A, 0xFE, 0x00, 0x00, 0x00, 0x29, 0x29, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0x8D, 0xC8, 0x86, 0x88, 0x86, 0x66, 0x68, 0x66, 0x68, 0x88, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8F, 0xFA, 0xAA, 0xA3, 0x68, 0xC8, 0x8D, 0xDD, 0xD7, 0xE9, 0x00, 0x44, 0x92, 0x99, 0x00, 0x91, 0xFC, 0x67, 0x00, 0x00, 0x97, 0x11, 0x11, 0x3B, 0x33, 0x33, 0x3B, 0x3B, 0x3B, 0x33, 0xB3, 0x33, 0x33, 0x31, 0x31, 0x31, 0x73, 0x77, 0x33, 0x5B, 0x5B, 0xB5, 0xBB, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x5A,
+	0x92, 0x42, 0x42, 0x99, 0x29, 0x99, 0x99, 0x9D, 0xD8, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0xDD, 0x7E, 0x77, 0x7E, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xCE, 0xEE, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0x47, 0xE3, 0x37, 0xE7, 0xE9, 0x00, 0x00, 0x91, 0x3E, 0x73, 0x53, 0x34, 0x00, 0x00, 0x00, 0x29, 0x92, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0x8D, 0x88, 0x88, 0xC8, 0x68, 0x68, 0x6F, 0x66, 0x86, 0x88, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xDF, 0xFA, 0xAA, 0xA8, 0x38, 0x88, 0xDC, 0xDD, 0x7E, 0x90, 0x40, 0x44, 0x94, 0x99, 0x00, 0x97, 0xFC, 0x6C, 0x90, 0x00, 0x97, 0x31, 0x11, 0xB3, 0xB3, 0xB3, 0xB1, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x33, 0x33, 0x33, 0x35, 0xB5, 0xBB, 0x5B, 0xB5, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x5A,
+	0x2E, 0x29, 0x24, 0x29, 0x99, 0x99, 0x99, 0x22, 0x88, 0xBB, 0xBB, 0xB5, 0xB5, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x2D, 0xC7, 0x77, 0xDC, 0x7E, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xCE, 0xEE, 0xEE, 0xE0, 0x0E, 0x00, 0x0E, 0xC7, 0x49, 0x77, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x33, 0x37, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x72, 0x92, 0x22, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0x88, 0xC8, 0x86, 0x66, 0x66, 0x68, 0x66, 0x68, 0x68, 0xD2, 0xDD, 0x88, 0x8C, 0xDD, 0xDD, 0x8C, 0xFA, 0xAA, 0xAD, 0x68, 0x6D, 0x8D, 0xDD, 0x7E, 0x90, 0x04, 0x04, 0x4E, 0x99, 0x90, 0x07, 0xFC, 0x63, 0x40, 0x00, 0xE1, 0x31, 0x11, 0x63, 0x35, 0x33, 0x3B, 0x1B, 0x3B, 0x3B, 0x33, 0xB3, 0x33, 0x13, 0x33, 0x31, 0x77, 0x31, 0xB5, 0xB5, 0xBB, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0x55,
+	0x29, 0x29, 0x24, 0x99, 0x99, 0x99, 0x99, 0x22, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0x8D, 0x22, 0x2D, 0xD7, 0x27, 0x77, 0x7C, 0xEE, 0xEE, 0xCE, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0xEE, 0xE0, 0x0E, 0x0E, 0x00, 0x04, 0x04, 0x00, 0x4C, 0xE0, 0x00, 0x00, 0x0E, 0x5C, 0x53, 0x5C, 0xA3, 0x40, 0x00, 0x00, 0x00, 0x22, 0x92, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0x88, 0x88, 0x88, 0xC8, 0x88, 0x68, 0x66, 0x68, 0x68, 0x88, 0xDD, 0xDD, 0xD8, 0xDD, 0xDD, 0xDD, 0xD8, 0xFA, 0xAA, 0xF6, 0x68, 0x88, 0x8D, 0xCD, 0x74, 0x90, 0x04, 0x49, 0x49, 0x20, 0x00, 0x02, 0xFF, 0xC7, 0xE0, 0x00, 0x23, 0x11, 0x16, 0xB3, 0x53, 0x3B, 0x33, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x33, 0x37, 0x13, 0xBB, 0x5B, 0xB5, 0xB5, 0x55, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5,
+	0x2E, 0x29, 0x29, 0x22, 0x92, 0x99, 0x99, 0x2D, 0x88, 0xBB, 0xBF, 0xB5, 0xBB, 0x5B, 0xBB, 0x8D, 0xD2, 0x29, 0x22, 0x22, 0x27, 0x77, 0x7E, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xEC, 0xCE, 0xEC, 0xE0, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0x0E, 0xC4, 0x00, 0x00, 0x00, 0x07, 0x5F, 0x55, 0x55, 0x39, 0x00, 0x00, 0x00, 0x09, 0x72, 0x92, 0x22, 0x2D, 0x2D, 0xDD, 0xDD, 0x8D, 0x88, 0x88, 0xC8, 0xC8, 0x66, 0x86, 0x66, 0x68, 0x68, 0xDD, 0xDD, 0xD2, 0x22, 0x2D, 0xDD, 0xDD, 0xFF, 0xAA, 0xF1, 0x86, 0x88, 0xDD, 0xD7, 0xE4, 0x04, 0x04, 0x04, 0x24, 0xE9, 0x99, 0x04, 0xFF, 0xC3, 0xE0, 0x00, 0x23, 0x31, 0x1B, 0x33, 0x33, 0x33, 0x3B, 0x3B, 0x3B, 0x33, 0x33, 0x31, 0x33, 0x13, 0x31, 0x37, 0x37, 0x33, 0xB5, 0xBB, 0xBB, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0xA5,
+	0x92, 0x92, 0x92, 0x42, 0x49, 0x99, 0x99, 0x2D, 0x88, 0xBB, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x77, 0xD7, 0xEE, 0xEE, 0xEC, 0xCE, 0xE0, 0xEC, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xEC, 0xE0, 0x0E, 0xE0, 0x00, 0x00, 0x0E, 0x4C, 0xC4, 0x00, 0x00, 0x00, 0x0F, 0xC5, 0x55, 0xAC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x22, 0x92, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0x88, 0x88, 0xCD, 0xC8, 0x8C, 0x86, 0x66, 0x86, 0x66, 0x88, 0x8D, 0xDD, 0xD2, 0x92, 0x22, 0x2D, 0xDD, 0x8F, 0xAF, 0x66, 0x88, 0x8D, 0x8D, 0xC7, 0x44, 0x00, 0x44, 0x94, 0xE9, 0x99, 0x90, 0x09, 0xCF, 0x33, 0xE0, 0x99, 0x13, 0x81, 0x16, 0xB3, 0xB3, 0xB3, 0xB3, 0x13, 0x33, 0x3B, 0x33, 0x33, 0x13, 0xB1, 0x31, 0x33, 0x73, 0x13, 0xBB, 0x5B, 0x5B, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5,
+	0xE2, 0x92, 0x92, 0x99, 0x92, 0x99, 0x92, 0x2D, 0x88, 0x6B, 0xFB, 0xB5, 0xBB, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0x77, 0x77, 0xE7, 0xEE, 0xEE, 0xEE, 0xE0, 0xCE, 0xEE, 0xEE, 0xEC, 0xEC, 0xCC, 0xEE, 0xE0, 0x00, 0x0E, 0xE4, 0x00, 0x00, 0xEE, 0xE4, 0x04, 0x09, 0x00, 0x2C, 0x35, 0xC5, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x22, 0x22, 0x2D, 0x2D, 0xDD, 0xDD, 0xD8, 0x88, 0x88, 0x88, 0xC8, 0x68, 0x66, 0x68, 0x68, 0x68, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0x22, 0xDD, 0xDF, 0xFF, 0xF6, 0x88, 0x8D, 0xCD, 0xDE, 0x40, 0x40, 0x04, 0x49, 0x29, 0x99, 0x09, 0x09, 0x3F, 0x33, 0x70, 0x92, 0x33, 0x11, 0x1B, 0x33, 0xF3, 0x33, 0x31, 0x3B, 0x3B, 0x33, 0x33, 0x13, 0x13, 0x31, 0x31, 0x33, 0x73, 0x3B, 0x5B, 0x5B, 0xBB, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5, 0xA5,
+	0x92, 0x92, 0x99, 0x22, 0x99, 0x29, 0x29, 0xDD, 0x86, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x22, 0x2D, 0x77, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xC0, 0x00, 0x0E, 0xAE, 0x00, 0x00, 0xEC, 0x00, 0x4E, 0xEE, 0x27, 0x77, 0x37, 0xCA, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x09, 0x72, 0x92, 0x22, 0xD2, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0x88, 0xCD, 0x88, 0xC8, 0x68, 0x66, 0x66, 0x86, 0x68, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD6, 0xFF, 0xAF, 0x68, 0xC8, 0xCD, 0xDD, 0x74, 0x40, 0x40, 0x44, 0x04, 0xE9, 0xE9, 0x99, 0x00, 0x3F, 0x3C, 0x70, 0x02, 0x33, 0x16, 0x1B, 0xF3, 0x33, 0xB3, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x3B, 0x31, 0x31, 0x31, 0x33, 0x73, 0x1B, 0x5B, 0x5B, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5, 0x5A,
+	0x29, 0x29, 0x22, 0x99, 0x29, 0x99, 0x22, 0x28, 0x88, 0x6B, 0xBB, 0xFB, 0x5B, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x22, 0x22, 0x77, 0x7C, 0xE4, 0xEE, 0xEE, 0xE0, 0xEC, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xCE, 0xCE, 0x00, 0x0E, 0xAC, 0x40, 0x00, 0xEE, 0xE0, 0xE2, 0x7C, 0xCC, 0x77, 0x77, 0xA5, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x77, 0x22, 0x22, 0xD2, 0xDD, 0xDD, 0xDD, 0xD8, 0x88, 0x8D, 0x8C, 0x8C, 0x86, 0x66, 0x68, 0xF8, 0x68, 0x68, 0x8D, 0xDD, 0xDD, 0xDD, 0xD8, 0xFA, 0xAF, 0xFF, 0x86, 0x88, 0xD8, 0xCD, 0xE4, 0x04, 0x00, 0x04, 0x42, 0xE2, 0x99, 0x99, 0x00, 0x7F, 0xC7, 0x74, 0x97, 0x31, 0x11, 0xB3, 0xB3, 0x53, 0x33, 0x3B, 0x3B, 0x33, 0x33, 0x3B, 0x31, 0x31, 0x31, 0x33, 0x73, 0x73, 0x3B, 0x5B, 0x5B, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0xA5, 0xA5,
+	0x92, 0x92, 0x99, 0x29, 0x92, 0x92, 0x92, 0xD8, 0x86, 0xBB, 0xFB, 0xBB, 0xBB, 0x5B, 0xBB, 0x88, 0x22, 0x92, 0x92, 0x22, 0x27, 0xDC, 0x74, 0x4E, 0xEE, 0xEE, 0xCE, 0x0E, 0xEE, 0xEE, 0xEC, 0xEC, 0xEE, 0xCE, 0xCE, 0x00, 0xEE, 0xC7, 0xE0, 0x0E, 0x00, 0xEE, 0x77, 0xCC, 0x57, 0x77, 0x7A, 0xAE, 0x00, 0x00, 0x44, 0x44, 0x09, 0x09, 0x77, 0x92, 0x2D, 0x2D, 0xDD, 0x2D, 0xDD, 0xD8, 0xD8, 0xDC, 0xD8, 0x88, 0xC8, 0x86, 0x66, 0x66, 0x68, 0x68, 0x68, 0x8D, 0xD8, 0xFF, 0x8F, 0xFA, 0xFA, 0xFF, 0x66, 0x8D, 0xCD, 0xD7, 0x49, 0x00, 0x00, 0xE4, 0x4E, 0x9E, 0x99, 0x99, 0x00, 0x7C, 0x33, 0x74, 0x91, 0x16, 0x11, 0xB3, 0xB3, 0x33, 0xB3, 0x33, 0x33, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x13, 0x13, 0x37, 0x31, 0xBB, 0x5B, 0xBB, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0x5A, 0xAA,
+	0x29, 0x29, 0x22, 0x92, 0x99, 0x99, 0x22, 0xDD, 0x68, 0xFB, 0xBB, 0xFB, 0x5B, 0xBB, 0xBB, 0x8D, 0x22, 0x29, 0x22, 0x22, 0x27, 0xCC, 0xE4, 0xEE, 0xEE, 0xEC, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xCE, 0xCE, 0xEE, 0x0E, 0xEE, 0x44, 0xE0, 0x0E, 0xCC, 0xCC, 0xCA, 0x34, 0x77, 0xCA, 0x70, 0x04, 0x44, 0x04, 0x44, 0x40, 0x09, 0x77, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0x88, 0x8D, 0xCD, 0xC8, 0x8C, 0x86, 0x86, 0x86, 0x86, 0x68, 0xC8, 0x88, 0x8F, 0xFA, 0xFF, 0xAF, 0xAF, 0xFF, 0x88, 0xC8, 0xDC, 0xDE, 0x44, 0x40, 0x40, 0x44, 0x42, 0x92, 0x99, 0x99, 0x90, 0xEF, 0xC3, 0xE2, 0x21, 0x11, 0x11, 0xB3, 0x33, 0xB3, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x31, 0x37, 0x37, 0x13, 0x3B, 0x5B, 0x55, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x5A, 0xA5, 0xAA,
+	0xE9, 0x29, 0x99, 0x29, 0x29, 0x99, 0x22, 0xD8, 0x68, 0x6B, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0x88, 0x22, 0x92, 0x92, 0x22, 0x2C, 0xCD, 0xEE, 0xEE, 0xEC, 0xCE, 0xE0, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0xCE, 0xCC, 0xEE, 0xEE, 0xE7, 0xE0, 0x40, 0x07, 0xCC, 0xCC, 0x5F, 0xE2, 0xE7, 0xAC, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x09, 0x77, 0xE2, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0x8D, 0x8D, 0x88, 0xC8, 0xC8, 0x68, 0xF8, 0x68, 0x86, 0x88, 0xC8, 0xCF, 0xFA, 0xFF, 0xAA, 0xAA, 0xFF, 0x66, 0x88, 0xDD, 0x7E, 0x90, 0x44, 0x00, 0xE4, 0x4E, 0x94, 0x99, 0x99, 0x00, 0x9F, 0x61, 0x7E, 0x71, 0x11, 0x1B, 0xB3, 0xB3, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x71, 0xBB, 0x5B, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0x5A, 0x5A,
+	0x92, 0x92, 0x92, 0x92, 0x99, 0x92, 0x92, 0xD8, 0x66, 0x6B, 0xFB, 0xFB, 0x5B, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0x92, 0x92, 0xDD, 0x77, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xEC, 0xCC, 0xEE, 0xEC, 0x44, 0x00, 0x04, 0xEC, 0xCC, 0xFA, 0xA1, 0x22, 0x93, 0xF0, 0x00, 0x00, 0x00, 0x90, 0xE4, 0x90, 0x00, 0x77, 0x22, 0x2D, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0x88, 0xD8, 0x88, 0x88, 0x88, 0x8C, 0x86, 0x8F, 0x86, 0x88, 0xC6, 0x88, 0x6F, 0xAA, 0xAF, 0xFA, 0xAF, 0xFF, 0x88, 0xCD, 0xCC, 0xE9, 0x04, 0x00, 0x00, 0xE4, 0x42, 0xE2, 0x99, 0x99, 0x00, 0x4C, 0xC3, 0xE2, 0x71, 0x81, 0x1B, 0x33, 0x1B, 0x33, 0x33, 0xB3, 0x1B, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x73, 0x13, 0xB5, 0xB5, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA,
+	0x99, 0x29, 0x99, 0x29, 0x99, 0x29, 0x22, 0x78, 0x86, 0x6B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0x22, 0x92, 0x22, 0x2D, 0xCD, 0x7C, 0xE4, 0xEE, 0xCE, 0x00, 0xE0, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xEE, 0xCE, 0x00, 0x44, 0xEE, 0x7C, 0xCC, 0xFA, 0x3E, 0x2E, 0x15, 0xE0, 0x00, 0x09, 0x09, 0x09, 0x94, 0x90, 0x09, 0x7E, 0x22, 0x22, 0xD2, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0x8D, 0x8D, 0xCD, 0x8C, 0xD8, 0x88, 0x88, 0x88, 0xCD, 0x86, 0x8C, 0x6F, 0xAA, 0xFF, 0xAA, 0xAA, 0xFF, 0x8D, 0x8C, 0xD7, 0x49, 0x04, 0x04, 0x40, 0x44, 0xEE, 0x99, 0x99, 0x99, 0x00, 0x93, 0x67, 0x72, 0x11, 0x1B, 0x13, 0xB3, 0x3B, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x31, 0x33, 0x13, 0x33, 0x31, 0x37, 0x37, 0x31, 0xBB, 0x5B, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5, 0xA5, 0xA5,
+	0x29, 0x99, 0x29, 0x92, 0x99, 0x92, 0x92, 0xD3, 0x86, 0x6B, 0xBF, 0xB5, 0xB5, 0xB5, 0xBB, 0x88, 0x22, 0x92, 0x99, 0xDD, 0x77, 0x7C, 0xEE, 0xEE, 0xCE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0xCC, 0xC0, 0x00, 0x07, 0x7E, 0xE7, 0xCC, 0xAF, 0x72, 0x92, 0x5E, 0x00, 0x09, 0x99, 0x09, 0x09, 0x4E, 0x90, 0x00, 0x27, 0x79, 0x22, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0xD8, 0x88, 0xDC, 0xDD, 0xD8, 0x8C, 0xDC, 0x8C, 0x88, 0x86, 0x8C, 0x86, 0xFF, 0xAA, 0xFA, 0xFA, 0xAF, 0xFC, 0x88, 0xCD, 0xC2, 0x00, 0x04, 0x00, 0x40, 0x44, 0x42, 0x92, 0x99, 0x99, 0x00, 0x9C, 0xC1, 0x77, 0x11, 0x11, 0x1B, 0x3B, 0x33, 0xB3, 0x3B, 0x33, 0x33, 0x33, 0x31, 0x31, 0x33, 0x33, 0x13, 0x13, 0x17, 0x31, 0xB5, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xA5, 0xAA, 0x5A, 0xAA,
+	0x49, 0x29, 0x92, 0x99, 0x99, 0x29, 0x22, 0x7D, 0x68, 0x6B, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0x8D, 0xD2, 0x92, 0x22, 0xDD, 0x77, 0x77, 0xEE, 0xEE, 0xCE, 0xE0, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xEC, 0xE0, 0x04, 0xEC, 0xCC, 0xCC, 0xAF, 0xA7, 0x7E, 0x2C, 0xC0, 0x00, 0x92, 0x00, 0x90, 0x99, 0x99, 0x49, 0x00, 0x97, 0x72, 0x22, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x88, 0xDD, 0xD8, 0x8D, 0x8D, 0x8D, 0x8D, 0x88, 0x88, 0x88, 0xF8, 0x66, 0xFF, 0xAF, 0xAF, 0xFF, 0xF6, 0xDD, 0x8C, 0xD4, 0x40, 0x0E, 0x04, 0x04, 0x44, 0x42, 0x49, 0x29, 0x99, 0x00, 0x03, 0xF1, 0x77, 0x11, 0x11, 0x13, 0x33, 0xB3, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x33, 0x13, 0x13, 0x37, 0x37, 0x31, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x5A, 0xA5, 0xAA,
+	0x99, 0x99, 0x99, 0x29, 0x29, 0x99, 0x92, 0x71, 0x68, 0x6B, 0xFB, 0xFB, 0x5B, 0xBB, 0xBB, 0x88, 0x22, 0x99, 0x2D, 0xDE, 0x27, 0xC7, 0xE4, 0x4E, 0xEE, 0x0E, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xC0, 0x0E, 0xEC, 0xAA, 0xAA, 0xAA, 0x1E, 0x29, 0xC5, 0x00, 0x00, 0x07, 0x00, 0x99, 0x99, 0x92, 0x49, 0x09, 0x2E, 0x29, 0x22, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0x8D, 0x8D, 0x88, 0x8D, 0xDD, 0xCD, 0x88, 0x8C, 0xD8, 0x88, 0x88, 0xD8, 0x88, 0xFF, 0x68, 0x8F, 0x8D, 0xDC, 0xDC, 0x70, 0x00, 0x40, 0x40, 0x40, 0x4E, 0x9E, 0x92, 0x99, 0x99, 0x00, 0x07, 0xF7, 0x77, 0x18, 0x11, 0xB1, 0xB3, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x33, 0x13, 0x13, 0x73, 0x37, 0x13, 0xBB, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x5A, 0xA5, 0xAA, 0xAA,
+	0x99, 0x99, 0x99, 0x92, 0x99, 0x92, 0x92, 0x78, 0x66, 0x6B, 0xFB, 0xBB, 0xB5, 0xB5, 0xBB, 0x8D, 0x22, 0x92, 0x2D, 0x72, 0xE7, 0xCE, 0x44, 0x4E, 0xEE, 0xE0, 0xEE, 0x0E, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0xEC, 0xCE, 0xCA, 0xAA, 0xA3, 0x22, 0x93, 0x5E, 0x00, 0x00, 0x0E, 0x90, 0x09, 0x09, 0x9E, 0x99, 0x00, 0x2E, 0x22, 0x92, 0x22, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0x88, 0x8D, 0x88, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD7, 0xDD, 0xD2, 0xDD, 0xCD, 0xE0, 0x40, 0x44, 0x04, 0x04, 0x49, 0x92, 0x92, 0x99, 0x94, 0x00, 0x07, 0xF3, 0x73, 0x88, 0x11, 0x13, 0x3B, 0x33, 0xB1, 0xB3, 0x33, 0xB3, 0x33, 0x33, 0x31, 0x33, 0x13, 0x33, 0x31, 0x73, 0x1B, 0x5B, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xA5, 0xAA, 0x5A, 0xAA,
+	0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x22, 0x73, 0x86, 0x6B, 0xBB, 0x5B, 0x5B, 0xBB, 0xBB, 0x88, 0x22, 0x92, 0x87, 0xE2, 0x7C, 0xC7, 0x44, 0xEE, 0xEE, 0xEE, 0x0E, 0xE0, 0xEE, 0xCE, 0xCE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xCC, 0xCC, 0xAA, 0xAA, 0xF4, 0x72, 0x7F, 0xC0, 0x00, 0x00, 0x09, 0x49, 0x00, 0x99, 0x99, 0xE9, 0x00, 0x92, 0x42, 0x92, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0x88, 0x88, 0xD2, 0x22, 0x22, 0x2D, 0xDD, 0xDD, 0x22, 0x22, 0x22, 0xDD, 0xDD, 0x22, 0x22, 0xD7, 0xDC, 0x87, 0x90, 0x00, 0x40, 0x04, 0x44, 0xE9, 0x92, 0x9E, 0x99, 0x9E, 0x90, 0x0E, 0xF7, 0x31, 0x18, 0x81, 0xB3, 0xB3, 0x3B, 0x33, 0x3B, 0x33, 0x33, 0x33, 0x13, 0x33, 0x13, 0x13, 0x31, 0x37, 0x37, 0x33, 0xBB, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+	0x99, 0x99, 0x99, 0x92, 0x99, 0x22, 0x97, 0xD3, 0x86, 0xBF, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0x8D, 0x22, 0x28, 0xDE, 0x22, 0xDC, 0xDE, 0x4E, 0x40, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xCE, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xEC, 0x7D, 0xAA, 0xAA, 0xC2, 0x9E, 0x3A, 0x00, 0x00, 0x00, 0x09, 0x99, 0x09, 0x99, 0x99, 0x29, 0x09, 0x92, 0xE2, 0x22, 0x22, 0xDD, 0xDD, 0x2D, 0xDD, 0xDD, 0x8D, 0x88, 0x88, 0xDD, 0xDD, 0x22, 0x22, 0x2D, 0x2D, 0xDD, 0x22, 0x22, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8C, 0xD4, 0x90, 0x04, 0x00, 0x00, 0x0E, 0x99, 0x29, 0x92, 0x99, 0x99, 0x90, 0x0E, 0x63, 0x11, 0x81, 0xB1, 0x1B, 0x33, 0xB3, 0x3B, 0x33, 0x33, 0x33, 0x13, 0x3B, 0x33, 0x31, 0x31, 0x31, 0x37, 0x37, 0x1B, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0xAA, 0xA5, 0xAA, 0x5A,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x22, 0x7C, 0x86, 0xBB, 0xFB, 0x5B, 0x5B, 0x5B, 0xBB, 0x6D, 0x22, 0x1C, 0x29, 0x27, 0xCD, 0xCE, 0xEE, 0x4E, 0x0E, 0x00, 0xEE, 0xEE, 0xEE, 0xCC, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0x8D, 0x3A, 0xAC, 0x7E, 0x23, 0xAE, 0x00, 0x00, 0x40, 0x09, 0x90, 0x00, 0x99, 0x99, 0x49, 0x09, 0x99, 0x29, 0x92, 0x22, 0x22, 0xDD, 0x2D, 0xDD, 0xDD, 0xD8, 0x88, 0x88, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0x88, 0x6F, 0xFF, 0xCD, 0xD8, 0x88, 0xCD, 0xE4, 0x09, 0x04, 0x00, 0x04, 0x44, 0x49, 0xE9, 0x22, 0x99, 0x92, 0x00, 0x0E, 0xC3, 0x11, 0xB1, 0x11, 0xB3, 0x33, 0x3B, 0x33, 0x3B, 0x33, 0x33, 0x31, 0x33, 0x31, 0x31, 0x31, 0x33, 0x17, 0x31, 0x3B, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5, 0xA5, 0x5A, 0x55, 0xA5,
+	0x99, 0x99, 0x99, 0x92, 0x99, 0x92, 0x97, 0xDD, 0x68, 0xFB, 0xBB, 0xBB, 0xBB, 0x5B, 0xFB, 0x81, 0x7C, 0xDE, 0x2E, 0x2D, 0xD7, 0xE7, 0xE4, 0xEE, 0x00, 0x00, 0xEE, 0x0E, 0xEE, 0xCC, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xCE, 0xEC, 0xCC, 0x82, 0x7A, 0xA7, 0x27, 0x35, 0x30, 0x94, 0x44, 0x00, 0x09, 0x99, 0x90, 0x99, 0x49, 0x49, 0x90, 0x29, 0xE2, 0x92, 0x22, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0x8D, 0x88, 0x8C, 0x8D, 0xDD, 0xDD, 0xD2, 0xDD, 0xDD, 0xD8, 0xFF, 0xFF, 0xFA, 0xFF, 0xCC, 0xDC, 0x88, 0x87, 0x49, 0x00, 0x04, 0x00, 0x40, 0x44, 0x99, 0x29, 0x99, 0x99, 0x92, 0x90, 0x0E, 0x63, 0x11, 0x11, 0xB1, 0x3B, 0x3B, 0x33, 0x3B, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x73, 0xE1, 0x3B, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x5A, 0x5A, 0x55, 0x5A, 0x55, 0xA5, 0x5A, 0x5A,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x22, 0x7C, 0x86, 0x6B, 0xFB, 0x5B, 0x5B, 0x5B, 0xBB, 0x61, 0x11, 0x29, 0x92, 0x2C, 0x77, 0x7E, 0xEE, 0xEE, 0xE0, 0x00, 0xEE, 0xEE, 0xEE, 0xCC, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0xDD, 0xFA, 0x77, 0x73, 0xFC, 0x90, 0x04, 0x44, 0x40, 0x09, 0x90, 0x00, 0x99, 0x49, 0xE9, 0x90, 0x92, 0x92, 0x99, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0x8D, 0x88, 0x88, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xC8, 0xCF, 0xCC, 0xCC, 0xCD, 0xDC, 0x8C, 0xDE, 0x90, 0x04, 0x04, 0x00, 0x04, 0x40, 0x09, 0x79, 0x22, 0x49, 0x9E, 0x90, 0x94, 0xC6, 0x31, 0xB1, 0x1B, 0x13, 0x53, 0x35, 0x33, 0x33, 0x33, 0x3B, 0x33, 0x33, 0x13, 0x33, 0x33, 0x33, 0x31, 0x17, 0x3B, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5, 0x5A, 0xAA, 0x55, 0xA5, 0x5A, 0x5A, 0x55,
+	0x99, 0x09, 0x99, 0x99, 0x99, 0x29, 0x22, 0x78, 0x68, 0x6B, 0xBB, 0xB5, 0xBB, 0xB5, 0xBF, 0xB8, 0xDE, 0x92, 0x42, 0xCD, 0x77, 0xEE, 0xEE, 0xCE, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xCC, 0xCC, 0x73, 0xAF, 0xE7, 0x35, 0xF4, 0x04, 0x04, 0x40, 0x40, 0x00, 0x49, 0x90, 0x99, 0x94, 0x99, 0x99, 0x94, 0x9E, 0x92, 0x22, 0x2D, 0x22, 0xD2, 0x2D, 0xDD, 0xDD, 0x88, 0x88, 0x88, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x8C, 0xDD, 0x74, 0x00, 0x04, 0x04, 0x00, 0x40, 0x49, 0x99, 0x79, 0xE9, 0x29, 0x92, 0x90, 0x0E, 0x3F, 0x16, 0xB1, 0x8B, 0xB3, 0x3B, 0x31, 0x3B, 0x3B, 0x35, 0x33, 0x33, 0xB3, 0x33, 0x33, 0x13, 0x31, 0x73, 0xE3, 0x3B, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0x5A, 0xA5, 0xA5, 0xA5, 0xA5, 0x55, 0x55, 0x55,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x2E, 0xDD, 0x66, 0xBB, 0xF5, 0xBB, 0x5B, 0x5B, 0xBB, 0x68, 0x79, 0x99, 0x2D, 0xC7, 0x7C, 0xEE, 0x4E, 0xC4, 0x00, 0x0E, 0xEE, 0xEE, 0xEC, 0xCE, 0xCE, 0xEE, 0xEE, 0xEC, 0xEC, 0xCE, 0xCC, 0xCC, 0x7C, 0xAC, 0x2B, 0x55, 0xE0, 0x94, 0x04, 0x44, 0x44, 0x44, 0x09, 0x09, 0x94, 0x44, 0xE9, 0x99, 0x92, 0x42, 0x99, 0x92, 0x22, 0x22, 0xD2, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0x88, 0xD8, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xDD, 0x8C, 0x8C, 0x8D, 0xE9, 0x90, 0x04, 0x04, 0x44, 0x04, 0x49, 0x09, 0x29, 0x2E, 0x99, 0x9E, 0x99, 0x49, 0x3F, 0x31, 0xB1, 0x11, 0x3B, 0x33, 0xB3, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x33, 0x13, 0x73, 0x11, 0x3B, 0x55, 0x55, 0x55, 0x5A, 0x55, 0xA5, 0xAA, 0x5A, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x5A,
+	0x90, 0x09, 0x99, 0x99, 0x99, 0x29, 0x22, 0x21, 0x88, 0x6B, 0xBB, 0xBB, 0xB5, 0xB5, 0xBB, 0x8D, 0x22, 0x29, 0x7C, 0xDE, 0x77, 0xEE, 0x4C, 0xC0, 0xE0, 0x0E, 0xEE, 0xEE, 0xEC, 0xCE, 0xEC, 0xEC, 0xEE, 0xEE, 0xCC, 0xEC, 0xEC, 0xCC, 0xCD, 0xA6, 0x35, 0x57, 0x09, 0x40, 0x44, 0x0E, 0x40, 0x04, 0x40, 0x94, 0x49, 0x49, 0x9E, 0x90, 0x9E, 0x9E, 0x99, 0x29, 0x22, 0xD2, 0x22, 0xD2, 0xDD, 0xDD, 0xD8, 0xD8, 0x88, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xD8, 0xCD, 0xDE, 0xE0, 0x90, 0x00, 0x40, 0x44, 0x04, 0x90, 0x9E, 0x29, 0x92, 0x99, 0x92, 0x99, 0x04, 0xCF, 0x16, 0x1B, 0x1B, 0x33, 0x3B, 0x33, 0x3B, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0xE3, 0x35, 0x55, 0x55, 0x5A, 0x55, 0xA5, 0xAA, 0x5A, 0xA5, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x49, 0x00, 0x99, 0x99, 0x99, 0x92, 0x29, 0x7D, 0x18, 0x6B, 0xB5, 0xB5, 0xBB, 0xBB, 0xBB, 0x8D, 0x79, 0x99, 0x7C, 0x77, 0x7E, 0xE4, 0x4E, 0xC0, 0x00, 0x0E, 0xEE, 0x0E, 0xEC, 0xCE, 0xEC, 0xEC, 0xEE, 0xEE, 0xCC, 0xEE, 0xEE, 0xCE, 0xCC, 0xAC, 0x65, 0x30, 0x94, 0x04, 0x04, 0x40, 0x40, 0x04, 0x40, 0x94, 0x94, 0x49, 0x99, 0x99, 0x99, 0x92, 0x49, 0x92, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0x88, 0xD8, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xCD, 0x8C, 0x79, 0x99, 0x00, 0x00, 0x04, 0x4E, 0x44, 0x99, 0x92, 0xE9, 0x22, 0xE9, 0x92, 0x40, 0x44, 0x3F, 0x16, 0x11, 0x1B, 0x3B, 0x33, 0x3B, 0x33, 0x33, 0xB3, 0x53, 0x3B, 0x33, 0x33, 0x33, 0x31, 0x73, 0x33, 0xE1, 0x35, 0x55, 0x55, 0x5A, 0xA5, 0xA5, 0xA5, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55,
+	0x40, 0x99, 0x00, 0x09, 0x99, 0x22, 0x22, 0xDD, 0x88, 0x6B, 0xBB, 0xBB, 0x5B, 0x5B, 0xBB, 0x6D, 0x22, 0x92, 0x7C, 0x7E, 0x7E, 0xE4, 0xEC, 0xE0, 0x00, 0xEE, 0xEE, 0xE0, 0xEC, 0xCC, 0xEE, 0xCC, 0xEE, 0xCE, 0xEE, 0xCC, 0xEE, 0xCC, 0xEF, 0xAC, 0xAF, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x09, 0x49, 0x44, 0x99, 0x09, 0x9E, 0xE9, 0x92, 0x92, 0x22, 0x22, 0xD2, 0xDD, 0xDD, 0xD8, 0xD8, 0x88, 0xDD, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDC, 0x8C, 0xDC, 0xDC, 0xDD, 0x4E, 0x90, 0x00, 0x04, 0x44, 0x04, 0x00, 0x99, 0x09, 0x79, 0xE2, 0x99, 0x99, 0xE9, 0x44, 0x7F, 0x36, 0xB1, 0x33, 0xB3, 0x3B, 0x33, 0x53, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0xE3, 0x3E, 0xB5, 0x55, 0x55, 0xAA, 0x55, 0x5A, 0x5A, 0xA5, 0xA5, 0xA5, 0x55, 0x55, 0xA5, 0x55, 0xA5,
+	0x40, 0x90, 0x99, 0x09, 0x99, 0x27, 0x22, 0x7D, 0x18, 0x6B, 0xB5, 0xBB, 0xBB, 0x5B, 0xFB, 0x88, 0x22, 0x99, 0x2D, 0x77, 0xEE, 0xE4, 0xEE, 0x40, 0x00, 0xEE, 0xE0, 0xEE, 0xEC, 0xCE, 0xCE, 0xCC, 0xEC, 0xEE, 0xEE, 0xCE, 0xEE, 0xCE, 0xCC, 0xAA, 0x54, 0x90, 0x40, 0x44, 0x04, 0x40, 0x40, 0x44, 0x40, 0x40, 0x94, 0x44, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x22, 0x22, 0x22, 0x22, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xCD, 0x88, 0x88, 0x88, 0x88, 0x86, 0x6F, 0xC8, 0xC8, 0xC8, 0x88, 0xC7, 0x99, 0x40, 0x04, 0x00, 0x44, 0x44, 0x49, 0x09, 0x02, 0x79, 0x24, 0x29, 0x92, 0x99, 0x04, 0xCF, 0x66, 0x11, 0xB3, 0x3B, 0x33, 0x53, 0x33, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x37, 0x35, 0x55, 0x55, 0xA5, 0xA5, 0xA5, 0xAA, 0x5A, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55,
+	0x90, 0x90, 0x40, 0x90, 0x99, 0x72, 0x22, 0xDD, 0x81, 0x8B, 0xBB, 0xB5, 0xB5, 0xB5, 0xBB, 0x8D, 0x22, 0x99, 0x7C, 0x77, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0xEE, 0x00, 0xEE, 0xEC, 0xEE, 0xCE, 0xCC, 0xCE, 0xCE, 0xEE, 0xCC, 0xEC, 0xEE, 0xCC, 0xAA, 0xE0, 0x90, 0x04, 0x40, 0x04, 0x04, 0x40, 0x04, 0x09, 0x40, 0x00, 0x94, 0x94, 0x49, 0x09, 0x94, 0x99, 0x99, 0x99, 0x22, 0x22, 0x22, 0xD2, 0xDD, 0xDD, 0x8D, 0x8D, 0xD8, 0x8C, 0x88, 0xC8, 0x8F, 0x6F, 0xFF, 0xF6, 0xC8, 0x68, 0xC8, 0xD4, 0x99, 0x40, 0x00, 0x04, 0x44, 0x44, 0x44, 0x09, 0x9E, 0x29, 0x92, 0x42, 0x92, 0x99, 0x40, 0x1F, 0x66, 0x11, 0x3B, 0x33, 0x53, 0x33, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0xE3, 0xE3, 0x35, 0x55, 0x55, 0xAA, 0x5A, 0x5A, 0x5A, 0xAA, 0x5A, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x04, 0x09, 0x09, 0x92, 0x27, 0x72, 0xDD, 0x18, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0xBB, 0x8D, 0x22, 0x92, 0xE7, 0xE7, 0x7E, 0x4E, 0xEE, 0xE0, 0x00, 0xEE, 0xE0, 0xEE, 0xEC, 0xEC, 0xEC, 0xEC, 0xCE, 0xEC, 0xEE, 0xCE, 0xEC, 0xEE, 0xEC, 0xA7, 0x09, 0x04, 0x04, 0x44, 0x04, 0x44, 0x00, 0x04, 0x90, 0x49, 0x00, 0x40, 0x49, 0x49, 0x99, 0x94, 0x99, 0x92, 0x99, 0x92, 0x22, 0x22, 0x2D, 0xDD, 0xDD, 0x8D, 0x88, 0xC8, 0xD8, 0xC8, 0x68, 0x68, 0xFF, 0xFF, 0xF6, 0x66, 0x6D, 0x6C, 0x79, 0x94, 0x40, 0x40, 0x40, 0x44, 0x44, 0x04, 0x99, 0x92, 0x74, 0x2E, 0x99, 0x99, 0x99, 0x49, 0x7F, 0xF3, 0x11, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x33, 0x33, 0xE3, 0x35, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A,
+	0x00, 0x40, 0x40, 0x90, 0x99, 0x77, 0x22, 0xDD, 0x18, 0x8B, 0xBB, 0xB5, 0xB5, 0xBB, 0xBB, 0x88, 0x22, 0x99, 0x2E, 0x7E, 0xEE, 0xEE, 0xEE, 0x40, 0x00, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0xCC, 0xCE, 0xEE, 0xCC, 0xEC, 0xCE, 0xEC, 0xAE, 0x4E, 0x00, 0x44, 0x0E, 0x04, 0x44, 0x90, 0x94, 0x00, 0x40, 0x00, 0x99, 0x44, 0x99, 0x09, 0x49, 0x49, 0x99, 0x29, 0x99, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0xD8, 0xD8, 0xDC, 0x88, 0xC6, 0xFF, 0xFF, 0x66, 0xF6, 0xFF, 0xF6, 0x86, 0x88, 0xE9, 0x9E, 0x00, 0x40, 0x04, 0x44, 0x40, 0x44, 0x90, 0x92, 0x74, 0x22, 0x92, 0x92, 0x9E, 0x90, 0xCF, 0xF6, 0x33, 0xB3, 0x53, 0x3B, 0x33, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0xE3, 0xE3, 0x35, 0x55, 0x55, 0xA5, 0x55, 0x55, 0xA5, 0xA5, 0xA5, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x40, 0x00, 0x09, 0x94, 0x22, 0x22, 0x78, 0xD8, 0xBF, 0xBB, 0x5B, 0xBB, 0x5B, 0xBB, 0x8D, 0x22, 0x92, 0xE7, 0x77, 0xE4, 0xE4, 0xCE, 0x0E, 0x00, 0xEE, 0xE0, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xCC, 0xEC, 0xCE, 0xCC, 0xCC, 0xEE, 0xEE, 0xE4, 0xE0, 0x00, 0xE0, 0x00, 0x04, 0x44, 0x40, 0x04, 0x40, 0x44, 0x09, 0x00, 0x94, 0x99, 0x90, 0x94, 0x94, 0x99, 0x99, 0x99, 0x99, 0x22, 0x22, 0x2D, 0xDD, 0xD8, 0x88, 0x88, 0xC8, 0x86, 0x6F, 0x66, 0xFF, 0x6F, 0xFF, 0xFF, 0x8C, 0x8D, 0x49, 0x44, 0x04, 0x40, 0x04, 0x44, 0x00, 0x49, 0x09, 0x9E, 0x7E, 0x24, 0xE9, 0x24, 0x9E, 0x99, 0x7F, 0xF6, 0x13, 0x33, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x33, 0x3E, 0x33, 0x35, 0x55, 0x5A, 0x5A, 0x55, 0x55, 0xA5, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x40, 0x40, 0x40, 0x00, 0x99, 0xE2, 0x22, 0xDD, 0x88, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xB8, 0x22, 0x99, 0x2E, 0x7E, 0x44, 0x44, 0xEC, 0x0E, 0xE0, 0xEE, 0x00, 0x0E, 0xEC, 0xCE, 0xEE, 0xEE, 0xEC, 0xCC, 0xCE, 0xEC, 0xCC, 0xCE, 0xEC, 0x04, 0x40, 0xE0, 0x0E, 0x04, 0x04, 0x44, 0x40, 0x94, 0x40, 0x94, 0x00, 0x90, 0x90, 0x90, 0x99, 0x99, 0x94, 0x99, 0x92, 0x99, 0x99, 0x99, 0x22, 0x2D, 0xDD, 0xDD, 0x8D, 0xCD, 0x8C, 0x8C, 0x8F, 0xF6, 0xFF, 0xF6, 0xFC, 0xF6, 0x88, 0xC7, 0x90, 0x44, 0x0E, 0x04, 0x04, 0x44, 0x49, 0x44, 0x09, 0x92, 0x79, 0xE2, 0x92, 0x92, 0x92, 0x04, 0x3F, 0xF3, 0x63, 0x33, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x3E, 0x3E, 0x3E, 0x33, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B,
+	0x04, 0x04, 0x00, 0x09, 0x09, 0x2E, 0x22, 0xDD, 0x18, 0x6B, 0xB5, 0xBB, 0xB5, 0xB5, 0xBB, 0x8D, 0x22, 0x99, 0x2E, 0x74, 0x44, 0x0E, 0xEE, 0x40, 0xE0, 0xEE, 0x0E, 0xE0, 0xEC, 0xEC, 0xEE, 0xEE, 0xEE, 0xCE, 0xCC, 0xCE, 0xCC, 0xCE, 0xEE, 0xE4, 0x44, 0x04, 0x00, 0x40, 0x44, 0xE4, 0x40, 0x44, 0x40, 0x40, 0x40, 0x90, 0x90, 0x44, 0x49, 0x99, 0x49, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x22, 0x22, 0x2D, 0xDD, 0xDD, 0xD8, 0x88, 0xC8, 0xC6, 0xCF, 0x6F, 0xF6, 0xCF, 0x68, 0xCD, 0x87, 0x40, 0x44, 0x4E, 0x00, 0xE0, 0x4E, 0x09, 0x90, 0x99, 0x97, 0xE9, 0x29, 0x92, 0x92, 0x9E, 0x90, 0x7F, 0x66, 0x31, 0x31, 0x33, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0xE3, 0x55, 0x55, 0x5A, 0x5A, 0x55, 0x55, 0xA5, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0xB1, 0x29,
+	0x00, 0x00, 0x40, 0x00, 0x44, 0x92, 0x27, 0xDD, 0x86, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0x29, 0x99, 0x2C, 0xEE, 0xE0, 0xEE, 0xEE, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0xEC, 0xCE, 0xEE, 0xEE, 0xEC, 0xEE, 0xCC, 0xCE, 0xCC, 0xCC, 0xEC, 0xCE, 0x00, 0x40, 0xE0, 0x0E, 0x0E, 0x44, 0x90, 0x9E, 0x90, 0x44, 0x44, 0x04, 0x90, 0x94, 0x94, 0x49, 0x49, 0x99, 0x92, 0x99, 0x99, 0x99, 0x99, 0x29, 0x22, 0x22, 0x2D, 0xDD, 0xCD, 0xDC, 0x88, 0x66, 0xF6, 0x68, 0x8C, 0x8C, 0x8C, 0xD7, 0x00, 0x40, 0x00, 0xE0, 0x04, 0x44, 0x90, 0x90, 0x94, 0x47, 0x7E, 0x22, 0x42, 0xE9, 0x9E, 0x99, 0x3F, 0x66, 0x31, 0x71, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0xE3, 0xE3, 0x3E, 0x33, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xB2, 0x90, 0x00,
+	0x00, 0x40, 0x00, 0x00, 0x09, 0x42, 0x22, 0x2D, 0x88, 0x6B, 0xBF, 0xB5, 0xB5, 0xB5, 0xBB, 0x82, 0x79, 0x97, 0xFC, 0xEC, 0x40, 0x0E, 0xEE, 0x44, 0x0E, 0x0E, 0x00, 0x00, 0xEC, 0xEC, 0xEE, 0xEE, 0xEE, 0xCC, 0xEE, 0xEC, 0xCC, 0xCC, 0xCC, 0xCE, 0xE0, 0x00, 0x0E, 0x00, 0x4E, 0x9E, 0x90, 0x04, 0x94, 0x04, 0x04, 0x04, 0x00, 0x90, 0x44, 0x44, 0x94, 0x49, 0x44, 0xE9, 0x99, 0x99, 0x29, 0x92, 0x29, 0x22, 0x27, 0xD7, 0xDD, 0x88, 0xC8, 0xC8, 0xCF, 0x6C, 0x86, 0x8D, 0xDD, 0x7E, 0x90, 0x40, 0xE0, 0xE0, 0xE0, 0x44, 0x49, 0x09, 0x04, 0x4E, 0x7E, 0x2E, 0x92, 0x2E, 0x92, 0x49, 0x3F, 0x63, 0x17, 0x77, 0x17, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x3E, 0x33, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x5B, 0x12, 0x90, 0x00, 0x00,
+	0x09, 0x04, 0x00, 0x00, 0x00, 0x92, 0xE2, 0x2D, 0x18, 0x6B, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0x8D, 0x29, 0x1A, 0xCE, 0xEC, 0x40, 0x4E, 0xE4, 0x0E, 0x0E, 0x00, 0xE0, 0xE0, 0xEE, 0xCC, 0xCE, 0xEE, 0xEE, 0xCE, 0xEC, 0xCE, 0xEC, 0xCE, 0xEC, 0xCA, 0xEE, 0x00, 0x00, 0x00, 0x44, 0x29, 0x00, 0x94, 0x00, 0x00, 0x44, 0x00, 0x90, 0x94, 0x44, 0x49, 0x49, 0x99, 0x99, 0x22, 0x92, 0x22, 0x22, 0xD2, 0xDD, 0xDD, 0xDD, 0xD8, 0xC8, 0xC8, 0xC6, 0xC6, 0x6F, 0x6F, 0xFF, 0xF6, 0xFF, 0xC7, 0x49, 0x00, 0xE0, 0x0E, 0x0E, 0x0E, 0x04, 0x04, 0x09, 0x47, 0x74, 0x2E, 0x24, 0xE2, 0x9E, 0x99, 0x3F, 0x6C, 0x77, 0x77, 0x77, 0x37, 0x37, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x3E, 0x3E, 0x33, 0xE3, 0x33, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0x12, 0x99, 0x00, 0x90, 0x99,
+	0x94, 0x40, 0x00, 0x00, 0x09, 0x9E, 0x29, 0x2D, 0x88, 0xBB, 0xFB, 0x5B, 0xBB, 0xBB, 0xBB, 0x82, 0x23, 0xAC, 0x74, 0xEC, 0x40, 0x0E, 0xEE, 0x4E, 0xE0, 0xEE, 0x0E, 0x0E, 0xEC, 0xEC, 0xCE, 0xEE, 0xEE, 0xEE, 0xEC, 0xCE, 0xEC, 0xCC, 0xEE, 0xEC, 0xCC, 0xE0, 0x00, 0xE0, 0x0E, 0x49, 0x90, 0x0E, 0x90, 0x40, 0x40, 0x90, 0x90, 0x09, 0x04, 0x99, 0x99, 0x90, 0x90, 0x92, 0x92, 0x22, 0xDD, 0xDD, 0xD8, 0x88, 0x88, 0xDC, 0xD8, 0x8C, 0x8C, 0x8C, 0x8C, 0x66, 0x66, 0xFF, 0xFF, 0xAA, 0xCC, 0xE4, 0x00, 0x0E, 0x00, 0x04, 0x40, 0x04, 0x09, 0x97, 0xE2, 0xE2, 0x42, 0x92, 0x9E, 0x99, 0x6F, 0x31, 0x77, 0x77, 0x7E, 0x77, 0x77, 0x73, 0xE3, 0x73, 0x33, 0x33, 0x3E, 0x33, 0x33, 0x33, 0xE3, 0xEE, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xB1, 0x29, 0x00, 0x90, 0x90, 0x99,
+	0x04, 0x44, 0x40, 0x00, 0x00, 0x99, 0x29, 0x2D, 0x18, 0x6B, 0xBB, 0xBB, 0x5B, 0xB5, 0xBB, 0xDD, 0xFA, 0x64, 0xE4, 0xEE, 0x40, 0x0E, 0xEE, 0x04, 0xE0, 0x0E, 0xE0, 0x00, 0xEE, 0xCE, 0xCC, 0xEE, 0xEE, 0xEC, 0xEC, 0xCE, 0xEC, 0xCC, 0xEE, 0xEE, 0xAC, 0xCE, 0x00, 0x00, 0xE4, 0xE9, 0x00, 0x9E, 0x90, 0x04, 0x04, 0x40, 0x00, 0x09, 0x44, 0x44, 0x49, 0x99, 0x99, 0x92, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xD8, 0x8D, 0x88, 0xC8, 0x68, 0xC8, 0x8C, 0x8C, 0x6F, 0xFA, 0xFA, 0xAA, 0xAC, 0xEE, 0x00, 0x0E, 0x0E, 0x04, 0x04, 0x99, 0x97, 0x74, 0xE2, 0x9E, 0x2E, 0x92, 0x42, 0x3F, 0x31, 0x77, 0x17, 0x77, 0x77, 0x77, 0x77, 0x1E, 0x1E, 0x1E, 0x33, 0x33, 0x3E, 0x33, 0xE3, 0xE3, 0x3E, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xB7, 0x90, 0x90, 0x09, 0x99, 0x29,
+	0x44, 0x44, 0x44, 0x04, 0x09, 0x92, 0x99, 0x2D, 0x18, 0x6B, 0xBF, 0xBB, 0xBB, 0x5B, 0xB8, 0xBF, 0x5D, 0x94, 0x94, 0xCE, 0x00, 0x04, 0xEE, 0x44, 0xE0, 0xEE, 0xEE, 0xE0, 0xEE, 0xCE, 0xCE, 0xCE, 0xEE, 0xEE, 0xCC, 0xEE, 0xCE, 0xEC, 0xEC, 0xEE, 0xCC, 0xCC, 0xE0, 0x0E, 0x0E, 0xE9, 0x40, 0x94, 0x44, 0x44, 0x04, 0x04, 0x99, 0x90, 0x49, 0x49, 0x99, 0x90, 0x99, 0x92, 0x92, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0x8C, 0xD8, 0xC8, 0xC8, 0x68, 0x88, 0x8C, 0x88, 0x68, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAC, 0xCE, 0x00, 0x00, 0xE0, 0x04, 0x04, 0xE2, 0xE2, 0x9E, 0x29, 0x22, 0x9E, 0x9E, 0xBF, 0x11, 0x71, 0x71, 0x77, 0x17, 0x77, 0x7E, 0x1E, 0x1E, 0x17, 0xE3, 0xE3, 0xE3, 0x3E, 0x33, 0x3E, 0x3E, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBB, 0x19, 0x00, 0x90, 0x99, 0x92, 0x99,
+	0xEE, 0xE9, 0x44, 0x99, 0x09, 0x99, 0x99, 0x22, 0xD8, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xF5, 0x7E, 0x92, 0x47, 0xC4, 0x00, 0x00, 0xEE, 0x04, 0x40, 0x0E, 0xEE, 0xE0, 0xEE, 0xEC, 0xEE, 0xCE, 0xEC, 0xCC, 0xCE, 0xEE, 0xEE, 0xEC, 0xEE, 0xEC, 0xCC, 0xEC, 0xC0, 0x00, 0xE0, 0xE9, 0x00, 0x4E, 0x90, 0x40, 0x04, 0x40, 0x40, 0x44, 0x00, 0x44, 0x99, 0x99, 0x99, 0x92, 0x22, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xD8, 0xD8, 0x8D, 0xCD, 0x88, 0xC8, 0xCF, 0xFF, 0xAA, 0xFA, 0xFA, 0xAA, 0xAA, 0xAC, 0xCE, 0x00, 0x00, 0x00, 0x09, 0x2E, 0x74, 0x2E, 0x9E, 0x92, 0x4E, 0x92, 0xF3, 0x31, 0x73, 0x73, 0x17, 0x71, 0x77, 0x1E, 0x1E, 0x77, 0xE1, 0xE7, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xB7, 0x90, 0x00, 0x99, 0x92, 0x92, 0x22,
+	0x37, 0x7E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x92, 0x7D, 0xB6, 0xBF, 0xBB, 0x5B, 0xB5, 0xF5, 0xB8, 0x29, 0x9E, 0x7C, 0xE0, 0x00, 0x00, 0xEE, 0x4E, 0x00, 0xE0, 0xCE, 0xEE, 0xE0, 0x0E, 0xCE, 0xEE, 0xEE, 0xCC, 0xCE, 0xEE, 0xEC, 0xCE, 0xCE, 0xEC, 0xCE, 0xEE, 0xCE, 0x00, 0x0E, 0xE9, 0x00, 0x9E, 0x90, 0x40, 0x00, 0x40, 0x00, 0x40, 0x09, 0x44, 0x44, 0x94, 0x00, 0x99, 0x22, 0xDD, 0x2D, 0xDD, 0xDD, 0xD8, 0x8D, 0xC8, 0xD8, 0x8C, 0xD8, 0xD8, 0xCD, 0x88, 0x66, 0xFF, 0xF5, 0xA5, 0xAA, 0x5A, 0xAA, 0xAA, 0xAC, 0xC0, 0x00, 0x00, 0x00, 0xE9, 0x74, 0x42, 0xE2, 0x9E, 0x99, 0x9E, 0xFB, 0x17, 0x31, 0x13, 0x11, 0x73, 0x71, 0x77, 0x77, 0x77, 0xE7, 0xE1, 0xE1, 0xEE, 0x3E, 0x3E, 0xE3, 0xEE, 0x3B, 0x55, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBB, 0x20, 0x00, 0x99, 0x94, 0x9E, 0x24, 0x92,
+	0x37, 0xC7, 0x7E, 0xE9, 0x99, 0x99, 0x99, 0x92, 0x28, 0x8B, 0xBB, 0xFB, 0xBB, 0xB5, 0xFB, 0x6D, 0x7E, 0x27, 0xCC, 0x00, 0x00, 0x00, 0x04, 0xEE, 0x00, 0x0E, 0xEE, 0xEE, 0xE0, 0xEE, 0xEC, 0xCE, 0xEE, 0xEC, 0xEE, 0xCE, 0xCE, 0xCE, 0xEC, 0xCE, 0xAE, 0xEE, 0xEC, 0xE0, 0xE0, 0xE9, 0x00, 0x9E, 0x00, 0x40, 0x00, 0x44, 0x44, 0x00, 0x90, 0x94, 0x94, 0x40, 0x99, 0x92, 0x92, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0x88, 0xD8, 0x88, 0x8D, 0x88, 0xC8, 0x6F, 0xFF, 0x5F, 0x5F, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0x00, 0x00, 0xEE, 0x7E, 0x9E, 0x29, 0x92, 0x92, 0x92, 0xF3, 0x13, 0x13, 0x73, 0x33, 0x37, 0x37, 0x37, 0x17, 0x77, 0x77, 0xEE, 0x7E, 0x7E, 0xEE, 0x1E, 0x34, 0xEE, 0x15, 0x5B, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x55, 0xB2, 0x00, 0x99, 0x94, 0xEE, 0x24, 0x22, 0xE2,
+	0xCC, 0x7C, 0xE7, 0xEE, 0x92, 0x99, 0x99, 0x92, 0x2D, 0xBB, 0xBB, 0xBB, 0xB5, 0xBF, 0xB6, 0x8D, 0x79, 0x1C, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xCE, 0xEE, 0xEE, 0x00, 0xEC, 0xEC, 0xCE, 0xCE, 0xEE, 0xEC, 0xEE, 0xEC, 0xCE, 0xCE, 0xCC, 0xEE, 0xEC, 0xEE, 0x0E, 0x49, 0x00, 0x9E, 0x90, 0x40, 0x40, 0x04, 0x44, 0x00, 0x49, 0x44, 0x44, 0x44, 0x90, 0x99, 0x72, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x88, 0x8D, 0x88, 0xDC, 0xDC, 0x88, 0x8F, 0x8F, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xAA, 0xAA, 0xAC, 0x00, 0x04, 0x4E, 0x74, 0x92, 0x49, 0x99, 0xE4, 0x97, 0xF3, 0x11, 0x33, 0x33, 0x73, 0x73, 0x31, 0x73, 0x73, 0xE1, 0x77, 0x1E, 0x1E, 0x7E, 0x1E, 0x11, 0xE1, 0x4E, 0xBB, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBB, 0x29, 0x99, 0x92, 0xE2, 0x92, 0xE2, 0xE2, 0x92,
+	0x3C, 0xCC, 0xC7, 0x77, 0xEE, 0x29, 0x90, 0x99, 0xDD, 0x8B, 0xBF, 0xBB, 0xBB, 0xBB, 0xFB, 0x6D, 0x73, 0x77, 0xC0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0x00, 0x0E, 0xCE, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0xCC, 0xEC, 0xCC, 0xCC, 0xEC, 0xCE, 0x0E, 0xCE, 0x0E, 0x40, 0x00, 0x9E, 0x94, 0x44, 0x00, 0x40, 0x44, 0x44, 0x40, 0x49, 0x49, 0xE9, 0x49, 0x94, 0x27, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0x88, 0x88, 0xCD, 0x8D, 0x88, 0x8C, 0x86, 0xF6, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xC0, 0x00, 0x44, 0x7E, 0x4E, 0x92, 0xE2, 0x9E, 0x97, 0xF1, 0x13, 0x33, 0x13, 0x33, 0x37, 0x33, 0x33, 0x37, 0x37, 0x3E, 0x1E, 0x77, 0xE7, 0xE1, 0x71, 0x7E, 0x2E, 0x15, 0x5B, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xB2, 0x00, 0x99, 0x29, 0x92, 0x92, 0x92, 0x29, 0x29,
+	0xCE, 0xCC, 0x7C, 0xCE, 0x72, 0xE9, 0x99, 0x92, 0x28, 0xBB, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0x8D, 0x3F, 0xCE, 0x70, 0x00, 0x00, 0x00, 0x0E, 0xCC, 0xEE, 0xEC, 0xEE, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xCC, 0xEC, 0xEE, 0xEC, 0x0E, 0xEC, 0x0E, 0x44, 0x00, 0x47, 0x04, 0x40, 0x40, 0x44, 0x4E, 0x04, 0x04, 0x94, 0x49, 0x2E, 0x99, 0x92, 0x47, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0x88, 0xD8, 0x88, 0x88, 0xD8, 0x8C, 0xD8, 0xC8, 0xFF, 0xFF, 0x55, 0xF5, 0xF5, 0x55, 0x55, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0xE0, 0x04, 0xE4, 0x92, 0x49, 0x29, 0x99, 0x97, 0xF3, 0x13, 0x33, 0x31, 0x31, 0x33, 0x17, 0x37, 0x33, 0x73, 0x73, 0x71, 0x77, 0x77, 0xE1, 0x11, 0x1E, 0xE2, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBB, 0x90, 0x99, 0x92, 0x29, 0x29, 0x2E, 0x27, 0xE2, 0x92,
+	0xCC, 0xEC, 0xCC, 0xC7, 0x7E, 0xE9, 0x90, 0x99, 0xDD, 0x8B, 0xBF, 0xBF, 0xBB, 0xBB, 0xFB, 0x81, 0x5A, 0xE7, 0xE4, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xCC, 0xCE, 0xEE, 0xEE, 0xE0, 0xEC, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xEE, 0xEC, 0xCE, 0xCC, 0xCC, 0xEE, 0xEC, 0xE0, 0xEC, 0xE0, 0x04, 0x00, 0x4E, 0x40, 0x44, 0x04, 0x00, 0x44, 0x40, 0x40, 0x44, 0x99, 0xE2, 0x09, 0x09, 0x22, 0x7D, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0x88, 0xDC, 0xD8, 0xDC, 0xD8, 0x86, 0x66, 0x6F, 0x6F, 0xFF, 0x5B, 0x55, 0xF5, 0x55, 0x5A, 0x55, 0xAA, 0xAA, 0xAA, 0xAE, 0x00, 0xE4, 0x94, 0x94, 0x99, 0xE9, 0x03, 0x61, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x73, 0xE3, 0x73, 0x77, 0x3E, 0x1E, 0x17, 0x17, 0x12, 0x21, 0xB5, 0x55, 0xB5, 0x55, 0x55, 0x55, 0xB2, 0x99, 0x09, 0x22, 0x92, 0x92, 0x92, 0x22, 0x29, 0x2E,
+	0xEC, 0xCC, 0xCC, 0xCC, 0xC7, 0xE2, 0x90, 0x92, 0x28, 0x8B, 0xFB, 0xBB, 0xBB, 0x5B, 0xBB, 0x88, 0xAF, 0xEE, 0x44, 0x04, 0x00, 0x00, 0xEE, 0x00, 0x0E, 0xEE, 0xE0, 0xEE, 0xEE, 0xCE, 0x00, 0xEC, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xEC, 0xCC, 0xCC, 0xCE, 0x0C, 0xAE, 0xEC, 0xC0, 0x00, 0x00, 0x4E, 0x94, 0x44, 0x04, 0x04, 0x4E, 0x04, 0x04, 0x4E, 0x99, 0x77, 0x40, 0x99, 0x27, 0x72, 0xDD, 0xDD, 0xDD, 0x88, 0x8D, 0x8D, 0x88, 0x88, 0x8D, 0x88, 0xC8, 0x66, 0x6F, 0xFB, 0xF5, 0xF5, 0xF5, 0x55, 0x55, 0x55, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0xE0, 0xE9, 0x49, 0x42, 0xE2, 0x99, 0x93, 0x61, 0x11, 0x33, 0x31, 0x31, 0x33, 0x33, 0x73, 0x33, 0x33, 0x3E, 0x33, 0xE3, 0x1E, 0x17, 0x11, 0x72, 0x21, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xB2, 0x09, 0x92, 0x2E, 0x2E, 0x22, 0x72, 0x72, 0xE2, 0x22,
+	0xCE, 0xCC, 0xCC, 0xCC, 0xEC, 0x7E, 0x99, 0x99, 0x28, 0x8B, 0xFB, 0x5B, 0x5B, 0xBB, 0xBB, 0x86, 0xAC, 0x3C, 0x00, 0x00, 0xEE, 0x4E, 0x0E, 0xE0, 0x0E, 0xE0, 0xE0, 0x0E, 0xE0, 0x0E, 0x00, 0xEC, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xCE, 0xCC, 0xCE, 0xEE, 0xCC, 0xEE, 0xCE, 0x00, 0x40, 0xE4, 0x44, 0x44, 0x40, 0x44, 0x44, 0x44, 0x40, 0xE9, 0x92, 0xE7, 0xE9, 0x99, 0x22, 0xDD, 0xDD, 0xD2, 0xDD, 0xD8, 0x8D, 0xC8, 0x8D, 0x8D, 0x88, 0xC8, 0x86, 0x66, 0xF6, 0x6F, 0xFB, 0x5B, 0x55, 0xB5, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0x54, 0x49, 0x99, 0x94, 0x99, 0x99, 0x9C, 0x61, 0x13, 0x33, 0x33, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x3E, 0x33, 0xE1, 0x71, 0x71, 0x12, 0x7B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0x19, 0x99, 0x2E, 0x22, 0x29, 0x22, 0x27, 0x22, 0x29, 0x22,
+	0xEC, 0xEC, 0xCC, 0xCC, 0xCC, 0x3E, 0x90, 0x92, 0x28, 0x8B, 0xFB, 0xBB, 0xBB, 0x5B, 0xB8, 0x88, 0xA7, 0xEC, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0xE0, 0xEE, 0x00, 0xEE, 0xE0, 0x00, 0xE0, 0xE0, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xCE, 0xEC, 0xCC, 0xCE, 0xEC, 0xEE, 0xCC, 0xE0, 0xCE, 0x40, 0x00, 0xEE, 0x44, 0x04, 0x40, 0x04, 0x4E, 0x04, 0x40, 0x4E, 0x92, 0x27, 0x29, 0x99, 0x97, 0xDD, 0x22, 0xDD, 0xD8, 0x8D, 0x88, 0xD8, 0x88, 0x8C, 0xD8, 0x88, 0x66, 0x66, 0x66, 0xFB, 0xFF, 0xFF, 0xF5, 0x5F, 0x55, 0x55, 0x5A, 0xA5, 0xAA, 0xAA, 0xAA, 0xAC, 0x09, 0x00, 0x92, 0x99, 0xE9, 0x96, 0x31, 0x13, 0x33, 0x31, 0x31, 0x13, 0x37, 0x33, 0xE3, 0x33, 0x3E, 0x33, 0x3E, 0x31, 0xE1, 0x17, 0x11, 0x7B, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBB, 0x29, 0x99, 0x22, 0x42, 0x72, 0x91, 0x77, 0x72, 0xE2, 0x97,
+	0x4E, 0xEC, 0xCC, 0xCC, 0xCC, 0x3E, 0x99, 0x92, 0x28, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0x86, 0xF7, 0xE4, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0xEE, 0xEE, 0x00, 0x0E, 0xE0, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xCC, 0xCC, 0xCC, 0xEC, 0xEE, 0xCE, 0xCC, 0x00, 0x00, 0x44, 0x40, 0x40, 0x40, 0x40, 0xE4, 0x40, 0x00, 0x49, 0x99, 0x2D, 0x79, 0x09, 0x22, 0xDD, 0xDD, 0xDD, 0xDD, 0x88, 0x88, 0x8D, 0x8D, 0x8D, 0x88, 0xC8, 0x88, 0x68, 0x66, 0x6B, 0xFB, 0x5B, 0x5B, 0xF5, 0xF5, 0x55, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0x30, 0x09, 0x09, 0x99, 0x90, 0x23, 0x11, 0x13, 0x11, 0x31, 0x33, 0x13, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x3E, 0x33, 0x73, 0x11, 0x11, 0x17, 0x1B, 0x55, 0x55, 0x55, 0x55, 0x55, 0xB1, 0x29, 0x92, 0x7E, 0x2E, 0x22, 0x72, 0x12, 0x29, 0x22, 0x72,
+	0x04, 0xEC, 0xEC, 0xCC, 0x5C, 0x37, 0x49, 0x02, 0x28, 0x8B, 0xFB, 0xB5, 0xB5, 0xB5, 0xBB, 0x88, 0xF3, 0xE9, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x0E, 0x00, 0x00, 0xEE, 0xEE, 0xE0, 0x0E, 0xEE, 0x0E, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xEC, 0xCE, 0xEC, 0xCC, 0xCE, 0xEE, 0xAE, 0xEA, 0x00, 0x00, 0x4E, 0x94, 0x40, 0x40, 0x40, 0x4E, 0x00, 0x40, 0x49, 0x92, 0xD7, 0x29, 0x99, 0x92, 0x72, 0xDD, 0x8D, 0xDD, 0x8D, 0xD8, 0x8D, 0x88, 0x88, 0xCD, 0x86, 0x68, 0x66, 0x66, 0x6B, 0xFF, 0xB5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x00, 0x09, 0x99, 0x40, 0x23, 0x31, 0x13, 0x13, 0x31, 0x31, 0x31, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x3E, 0x11, 0x11, 0x11, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0xB2, 0x99, 0x27, 0xE2, 0x22, 0x27, 0x27, 0x72, 0x22, 0x22, 0x77,
+	0x00, 0xEE, 0xCC, 0xCA, 0xCC, 0xC3, 0xE0, 0x99, 0xD8, 0x8B, 0xFB, 0x5B, 0xBB, 0xBB, 0xBB, 0x88, 0xA7, 0x2E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0xE0, 0x0E, 0xEC, 0x0E, 0xE0, 0x00, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xCE, 0xCC, 0xCC, 0xE0, 0xEC, 0xEA, 0xE0, 0x00, 0x04, 0x94, 0x44, 0x00, 0x40, 0x4E, 0x04, 0x40, 0x49, 0x22, 0x2D, 0x72, 0x00, 0x92, 0xDD, 0xDD, 0x8D, 0x8D, 0xD8, 0x8D, 0x88, 0x8D, 0xCD, 0x88, 0x88, 0x86, 0x86, 0x66, 0x6B, 0xFB, 0xFF, 0x5B, 0xFB, 0x5B, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x09, 0x99, 0x90, 0x26, 0x11, 0x13, 0x31, 0x31, 0x33, 0x13, 0x13, 0x73, 0x33, 0x33, 0xE3, 0x3E, 0x33, 0x73, 0x17, 0x11, 0x11, 0xBB, 0x55, 0x55, 0x55, 0x55, 0x5B, 0x19, 0x29, 0x22, 0x92, 0x2E, 0x27, 0x77, 0x22, 0xE2, 0x7E, 0x27,
+	0x00, 0x0E, 0xCC, 0xCA, 0xCC, 0xCE, 0x70, 0x09, 0xDD, 0xBB, 0xFB, 0xB5, 0xB5, 0xB5, 0xBB, 0x88, 0x1C, 0x7E, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xCE, 0x00, 0xE0, 0x00, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xCC, 0xCC, 0xCC, 0xE0, 0x0C, 0xEA, 0xE0, 0x00, 0x44, 0x44, 0x90, 0x40, 0x40, 0xE4, 0x40, 0x40, 0x99, 0x92, 0xDD, 0x79, 0x09, 0x22, 0x2D, 0xDD, 0x8D, 0xD8, 0xDD, 0x88, 0x8D, 0x88, 0x88, 0x88, 0xC8, 0xC8, 0x68, 0x66, 0x6B, 0xBF, 0xB5, 0xB5, 0x5F, 0x55, 0x55, 0x55, 0x5A, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0x70, 0x09, 0x09, 0x90, 0x26, 0x17, 0x3B, 0x31, 0x31, 0x31, 0x31, 0x33, 0x33, 0x73, 0xE3, 0x33, 0x33, 0xE3, 0x3E, 0x11, 0x11, 0x11, 0xB5, 0x55, 0x55, 0x55, 0xB5, 0xBB, 0x19, 0x22, 0x2E, 0x22, 0x22, 0x77, 0x22, 0x29, 0x22, 0x77, 0x72,
+	0x00, 0x04, 0xEC, 0xCA, 0xCC, 0xC3, 0xE0, 0x09, 0xDD, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0x88, 0x2C, 0x70, 0x00, 0x00, 0x04, 0x4E, 0x00, 0xE0, 0x00, 0x0E, 0xEC, 0x0E, 0xE0, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xEC, 0xEC, 0xCC, 0xCE, 0xE0, 0x0C, 0xCA, 0xE0, 0x00, 0x0E, 0x94, 0x40, 0x90, 0x00, 0x4E, 0x00, 0x40, 0x99, 0x22, 0x22, 0x22, 0x09, 0x92, 0x2D, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0x88, 0x8D, 0x88, 0xD6, 0x88, 0x88, 0x68, 0x66, 0x66, 0xBF, 0xBF, 0xFF, 0xB5, 0xB5, 0x5B, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x09, 0x00, 0x00, 0x7F, 0x11, 0x33, 0x13, 0x31, 0x31, 0x31, 0x37, 0x33, 0x33, 0x33, 0x17, 0x33, 0x3E, 0x33, 0xE1, 0x11, 0xBB, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0x22, 0x92, 0x29, 0x72, 0x77, 0x77, 0x22, 0x22, 0x2E, 0x27, 0xE7,
+	0x00, 0x04, 0xEA, 0xCC, 0xCC, 0xCC, 0xE0, 0x09, 0xDD, 0x8B, 0xBB, 0xBB, 0x5B, 0x5B, 0xBB, 0x88, 0x77, 0x74, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0xCE, 0x00, 0xEE, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xCC, 0xCC, 0xCE, 0x0E, 0xEE, 0xAA, 0xE0, 0x00, 0x04, 0x4E, 0x99, 0x00, 0x44, 0x44, 0x00, 0x44, 0x99, 0x22, 0x22, 0x22, 0x90, 0x92, 0xDD, 0xDD, 0xDD, 0x8D, 0xD8, 0xD8, 0x8D, 0x88, 0x88, 0xC8, 0x88, 0x86, 0x86, 0x86, 0x66, 0x6B, 0xFB, 0x5F, 0x5B, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x00, 0x00, 0x00, 0x16, 0x11, 0x1B, 0x31, 0x31, 0x31, 0x31, 0x33, 0x37, 0x33, 0x31, 0x33, 0xE3, 0x33, 0xE3, 0x31, 0xBB, 0x55, 0xB5, 0x55, 0x55, 0x55, 0xB5, 0xB2, 0x29, 0x22, 0x22, 0x27, 0x27, 0x21, 0x29, 0x29, 0x72, 0x72, 0x7E,
+	0x00, 0x04, 0xEC, 0xCA, 0xCC, 0xCC, 0x40, 0x09, 0x2B, 0x8B, 0x5B, 0x5B, 0xBB, 0x5B, 0xBB, 0xBD, 0x77, 0xC4, 0x00, 0x40, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0E, 0xCE, 0x00, 0xEE, 0x00, 0xE0, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0xCE, 0x0E, 0x0E, 0xAC, 0xE0, 0x00, 0xE4, 0x97, 0x09, 0x09, 0x00, 0x4E, 0x00, 0x00, 0x99, 0x22, 0xD2, 0x22, 0x90, 0x22, 0x2D, 0x8D, 0xDD, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x68, 0x66, 0x86, 0xBF, 0xFB, 0xFB, 0x5F, 0x5F, 0x55, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x09, 0x13, 0x11, 0x33, 0x13, 0x33, 0x13, 0x33, 0x31, 0x33, 0x73, 0xE3, 0xE3, 0x3E, 0x3E, 0x33, 0x3B, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xB2, 0x22, 0x22, 0x22, 0x72, 0x77, 0x22, 0x22, 0x22, 0x77, 0xE7, 0xE7,
+	0x00, 0x00, 0xEC, 0xCA, 0xCA, 0xCC, 0x40, 0x09, 0xD1, 0x8B, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0x88, 0x63, 0x70, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0xE0, 0x0E, 0xCE, 0xE0, 0xE0, 0x0E, 0x00, 0xEE, 0x00, 0xEE, 0xEE, 0xEE, 0xCE, 0xEE, 0xEC, 0xCC, 0xCC, 0xCE, 0xE0, 0xEE, 0xAC, 0x00, 0x00, 0xE4, 0x4E, 0x94, 0x90, 0x44, 0x44, 0x00, 0x49, 0x99, 0x22, 0x2D, 0xD2, 0x99, 0x92, 0xDD, 0xDD, 0xDD, 0x8D, 0x88, 0x8D, 0x8D, 0x88, 0x8D, 0x88, 0x8C, 0x88, 0x68, 0x68, 0xF6, 0xFB, 0xFB, 0xF5, 0xFB, 0x5F, 0x5F, 0x55, 0x5A, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x09, 0x16, 0x11, 0x31, 0xB3, 0x3B, 0x31, 0x11, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x33, 0x35, 0x55, 0x5B, 0x55, 0x55, 0x55, 0x55, 0xBB, 0xB2, 0x92, 0x29, 0x22, 0x72, 0x12, 0x22, 0x29, 0x2E, 0x27, 0x2E, 0x77,
+	0x00, 0x00, 0xEC, 0xCC, 0xCC, 0xCC, 0xE0, 0x09, 0x28, 0xBB, 0xB5, 0xBB, 0xB5, 0xB5, 0xBB, 0xBD, 0xF3, 0xE0, 0x40, 0x0E, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0xEC, 0xCE, 0x00, 0x0E, 0x0E, 0xE0, 0x0E, 0x00, 0xE0, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0xCC, 0xEC, 0xCC, 0xCE, 0x0E, 0xAE, 0xEE, 0x00, 0xE4, 0x44, 0x90, 0x09, 0x04, 0x44, 0x44, 0x09, 0x92, 0x22, 0xDD, 0x22, 0x99, 0x22, 0x2D, 0xDD, 0xDD, 0xD8, 0xDD, 0x8D, 0x88, 0xDD, 0x8D, 0x88, 0x88, 0x88, 0x86, 0x86, 0x66, 0xB6, 0xFB, 0xFB, 0x5F, 0x5F, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x50, 0x00, 0x09, 0x61, 0x13, 0x13, 0x33, 0x13, 0x13, 0x33, 0x33, 0x37, 0x3E, 0x37, 0x3E, 0x33, 0x3E, 0x33, 0xB5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x72, 0x12, 0x72, 0x92, 0x27, 0x77, 0xE2, 0x77,
+	0x00, 0x00, 0xEC, 0xCC, 0xAC, 0xCC, 0x40, 0x09, 0x21, 0xBB, 0xBB, 0x5B, 0xBB, 0x5B, 0xBB, 0xBD, 0x17, 0x90, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xCE, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xCC, 0xCC, 0xEE, 0xCE, 0xEA, 0xCC, 0xCE, 0x00, 0x44, 0x4E, 0x99, 0x94, 0x00, 0x40, 0x44, 0x09, 0x92, 0x2D, 0xDD, 0xD2, 0x99, 0x22, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0x8D, 0xDD, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x66, 0xB6, 0x6F, 0xBF, 0xFB, 0x5B, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x09, 0x61, 0x13, 0xB3, 0x13, 0x13, 0x31, 0x31, 0x37, 0x33, 0x33, 0x33, 0xE3, 0x7E, 0x31, 0xEB, 0x55, 0x55, 0x5B, 0x55, 0x55, 0x55, 0x55, 0xBB, 0x22, 0x29, 0x22, 0x22, 0x72, 0x12, 0x22, 0x22, 0x27, 0xE7, 0x77, 0xE7,
+	0x00, 0x00, 0x4C, 0xCC, 0xCC, 0xCC, 0xE0, 0x09, 0x2B, 0x8B, 0xBB, 0x5B, 0x5B, 0xBB, 0xBB, 0x88, 0x33, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xCE, 0xEE, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x0E, 0xE0, 0xEE, 0xEE, 0xEC, 0xEE, 0xEE, 0xCC, 0xCC, 0xCE, 0xCE, 0xCC, 0xCC, 0xCE, 0x00, 0xE4, 0x99, 0x49, 0x04, 0x94, 0x00, 0x40, 0x99, 0x22, 0xDD, 0xDD, 0xD2, 0x99, 0x22, 0x2D, 0xDD, 0xD8, 0xD8, 0xD8, 0xD8, 0x8D, 0x8D, 0xD8, 0xD8, 0x88, 0xC8, 0x88, 0x68, 0x66, 0xB6, 0xBF, 0xF5, 0xF5, 0xF5, 0x5F, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x00, 0x02, 0x11, 0x13, 0x11, 0x31, 0x31, 0x33, 0x33, 0x33, 0x37, 0x3E, 0x13, 0x13, 0x33, 0x73, 0x1B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xB2, 0x22, 0x22, 0x29, 0x22, 0x12, 0x22, 0x29, 0x2E, 0x27, 0x72, 0xE7, 0xE2,
+	0x00, 0x00, 0x0C, 0xCC, 0xAC, 0xCC, 0xE0, 0x09, 0x21, 0xBB, 0xB5, 0xBB, 0xB5, 0xB5, 0xBB, 0xB8, 0x17, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xEE, 0xEE, 0x00, 0x0E, 0xEE, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xE0, 0x00, 0x0E, 0x40, 0x44, 0x49, 0x99, 0x04, 0x40, 0x04, 0x92, 0x27, 0xDD, 0xD2, 0xD2, 0x09, 0x22, 0x2D, 0xDD, 0x8D, 0x88, 0x8D, 0x8D, 0xD8, 0xD8, 0xD8, 0x88, 0xD8, 0x88, 0x86, 0x86, 0x68, 0x66, 0x6B, 0xBF, 0xBF, 0x5B, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x00, 0x02, 0x11, 0x16, 0x31, 0x33, 0x13, 0x13, 0x17, 0x37, 0x33, 0x33, 0x73, 0xE3, 0xE1, 0xE3, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x21, 0x22, 0x22, 0x22, 0x7E, 0x77, 0x7E, 0x2E,
+	0x00, 0x00, 0x4E, 0xCA, 0xCC, 0xCC, 0xE0, 0x09, 0x21, 0x8B, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0xB1, 0x77, 0x44, 0x40, 0xE0, 0xE0, 0x0E, 0x00, 0xEE, 0xEE, 0x0E, 0xCE, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0xEE, 0xCC, 0xEC, 0xEC, 0xCE, 0xEC, 0xCC, 0xCC, 0xEE, 0x0E, 0x0E, 0x40, 0x44, 0x44, 0x09, 0x09, 0x40, 0x99, 0x99, 0x2D, 0xDD, 0xDD, 0xD9, 0x99, 0x22, 0xDD, 0x8D, 0xDD, 0x8D, 0x88, 0xD8, 0xDD, 0x8D, 0x8D, 0x8D, 0x88, 0x88, 0x86, 0x88, 0x66, 0x66, 0x6F, 0xFF, 0xFB, 0x5F, 0x5F, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x02, 0x11, 0x33, 0xB3, 0x13, 0x13, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x33, 0x37, 0x37, 0x37, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBB, 0x12, 0x12, 0x22, 0x22, 0x21, 0x22, 0x22, 0x92, 0xE2, 0x77, 0xE2, 0xE2, 0xE9,
+	0x00, 0x00, 0x4C, 0xCC, 0xCA, 0xCC, 0x30, 0x09, 0x21, 0xBB, 0xBB, 0xBB, 0x5B, 0xB5, 0xBB, 0x88, 0x17, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0x00, 0x0E, 0xEE, 0x0E, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xEC, 0xCE, 0xEE, 0xEC, 0xCC, 0xAE, 0xCE, 0xEE, 0x00, 0x40, 0x44, 0x99, 0x94, 0x90, 0x99, 0x29, 0x2D, 0xDD, 0xDD, 0x22, 0x99, 0x22, 0xDD, 0xD8, 0xDD, 0x88, 0xD8, 0x8D, 0x8D, 0xDD, 0x88, 0xD8, 0x8D, 0x88, 0xC8, 0x86, 0x68, 0x66, 0xB6, 0xBF, 0x5F, 0xB5, 0xF5, 0x55, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x40, 0x02, 0x11, 0x33, 0x31, 0x33, 0x33, 0x13, 0x73, 0x31, 0x73, 0x33, 0x73, 0xE3, 0x3E, 0x13, 0x1B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBB, 0xD1, 0x22, 0x22, 0x22, 0x22, 0x12, 0x22, 0x22, 0x27, 0x77, 0x7E, 0x2E, 0x2E,
+	0x00, 0x00, 0x0E, 0xCC, 0xCC, 0xCC, 0xE0, 0x09, 0x21, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0xBB, 0xB1, 0x3C, 0xE4, 0x00, 0x40, 0x00, 0x00, 0x0E, 0xE0, 0x0E, 0x0E, 0xEE, 0xE0, 0x0E, 0x00, 0xE0, 0xE0, 0x0E, 0xE0, 0xEE, 0xE0, 0x00, 0xEE, 0xCC, 0xCC, 0xEC, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xEC, 0xCE, 0xCE, 0x7E, 0x99, 0x09, 0x09, 0x99, 0x22, 0x2D, 0xDD, 0xDD, 0x29, 0x92, 0x2D, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0x88, 0xD8, 0xDD, 0xDD, 0x8D, 0x88, 0x88, 0x88, 0x68, 0x66, 0x66, 0x6F, 0x6B, 0xBF, 0xF5, 0x5F, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC0, 0x07, 0x11, 0x13, 0x33, 0x31, 0x33, 0x13, 0x33, 0x73, 0x33, 0x13, 0xE3, 0x3E, 0x33, 0x73, 0x15, 0x55, 0x5B, 0x55, 0x55, 0x55, 0x55, 0xB1, 0x2D, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x92, 0x7E, 0x7E, 0x72, 0xE2, 0x42,
+	0x00, 0x00, 0x0C, 0xCC, 0xCA, 0xCC, 0xC0, 0x09, 0x21, 0xBB, 0xBB, 0x5B, 0x5B, 0x5B, 0xBB, 0xB8, 0x37, 0x44, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0xE0, 0x0E, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0xE0, 0xEE, 0xEE, 0x0E, 0xEE, 0xCE, 0xCE, 0xCE, 0xCE, 0x00, 0xEE, 0x0E, 0x00, 0xEE, 0xEC, 0xC7, 0xE4, 0x99, 0x99, 0x09, 0x99, 0x22, 0x2D, 0xDD, 0xDD, 0xD9, 0x92, 0x22, 0xDD, 0x8D, 0x8D, 0xD8, 0x88, 0xD8, 0xD8, 0xDD, 0x88, 0xD8, 0x88, 0x88, 0x88, 0x68, 0x86, 0x66, 0x66, 0x6F, 0xFF, 0xFB, 0x55, 0xF5, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC0, 0x01, 0x11, 0x13, 0x33, 0x33, 0x13, 0x73, 0x31, 0x33, 0x33, 0x73, 0x33, 0x33, 0x73, 0x71, 0xB5, 0x55, 0x5B, 0x55, 0x55, 0x55, 0x5B, 0xB2, 0xDD, 0x22, 0x12, 0x22, 0x22, 0x27, 0x22, 0xE2, 0x77, 0x72, 0xE7, 0xE2, 0xE2,
+	0x00, 0x00, 0x0E, 0xCC, 0xCC, 0xCC, 0xE4, 0x09, 0x21, 0x8B, 0xBB, 0x5B, 0xB5, 0xB5, 0xBB, 0x81, 0x37, 0x40, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0xEE, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0xEE, 0xE0, 0xEE, 0xEE, 0xEC, 0xEC, 0xEC, 0xEC, 0xE0, 0xEE, 0x0E, 0x00, 0xE4, 0x00, 0x44, 0xE3, 0x40, 0x04, 0x09, 0x92, 0x92, 0xDD, 0xDD, 0xDD, 0x29, 0x92, 0x2D, 0x8D, 0xDD, 0x88, 0x8D, 0x8D, 0x88, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0x8D, 0x88, 0x86, 0x86, 0x86, 0x66, 0x6F, 0xBF, 0xB5, 0xF5, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x97, 0x11, 0x11, 0x33, 0x11, 0x33, 0x33, 0x73, 0x73, 0x33, 0x33, 0x3E, 0x3E, 0x33, 0x71, 0x1B, 0xB5, 0xB5, 0x55, 0x55, 0x55, 0x5B, 0xB2, 0xD2, 0x12, 0x22, 0x92, 0x12, 0x22, 0x92, 0x2E, 0x27, 0xE7, 0x2E, 0x2E, 0x7E,
+	0x00, 0x00, 0x0E, 0xCC, 0xAC, 0xCC, 0xC0, 0x09, 0x21, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xB8, 0x37, 0x44, 0x00, 0xE0, 0x00, 0x00, 0x0E, 0xEE, 0x00, 0xEE, 0x0E, 0x0E, 0x00, 0xE0, 0xEE, 0x00, 0x0E, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0xCE, 0xCC, 0xEE, 0xEE, 0x00, 0x00, 0x40, 0x04, 0x49, 0x9E, 0x44, 0x40, 0x09, 0x92, 0x22, 0xDD, 0xDD, 0xDD, 0x29, 0x22, 0x2D, 0xD8, 0xD8, 0xD8, 0x88, 0xD8, 0x88, 0x88, 0x8D, 0x8D, 0x8D, 0x88, 0xD8, 0x8C, 0x88, 0x66, 0x68, 0x66, 0xB6, 0xFB, 0xFF, 0xB5, 0xF5, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x91, 0x11, 0x13, 0x33, 0x33, 0x13, 0x33, 0x33, 0x33, 0xE3, 0x3E, 0x33, 0x33, 0x37, 0x11, 0xBB, 0xBB, 0x55, 0x55, 0x55, 0x55, 0xBB, 0xD2, 0xDD, 0x22, 0x22, 0x22, 0x22, 0x29, 0x2E, 0x27, 0x77, 0x2E, 0x2E, 0x7E, 0x27,
+	0x00, 0x00, 0x0E, 0xCC, 0xCC, 0xCC, 0xEE, 0x09, 0x21, 0x8B, 0xBB, 0x5B, 0xBB, 0x5B, 0xBB, 0xB1, 0xF7, 0x44, 0x40, 0x00, 0x00, 0xE0, 0xEE, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0E, 0xEE, 0xEE, 0x0E, 0xEE, 0xEC, 0xCE, 0xEE, 0xEC, 0xCE, 0xEE, 0x00, 0x0E, 0x0E, 0x04, 0x40, 0x09, 0x44, 0x00, 0x99, 0x29, 0x22, 0xDD, 0xDD, 0x8D, 0x99, 0x92, 0xDD, 0xDD, 0x8D, 0x88, 0xD8, 0x88, 0x8D, 0x8D, 0x8D, 0x8D, 0x88, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x66, 0x66, 0x6F, 0xBF, 0xBF, 0x5F, 0x5F, 0xA5, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x91, 0x11, 0x1B, 0x33, 0x13, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x3E, 0x33, 0x11, 0x1B, 0xBB, 0xB5, 0x55, 0x55, 0x55, 0xBB, 0x12, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x99, 0x22, 0x77, 0xE2, 0xE2, 0xE7, 0xE2, 0xEE,
+	0x00, 0x00, 0x0E, 0xCC, 0xCC, 0xCC, 0xC4, 0x49, 0x21, 0x1B, 0xBB, 0xBB, 0x5B, 0xB5, 0xBB, 0xBD, 0xFC, 0x9E, 0x40, 0x00, 0x00, 0x0E, 0xEE, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0xE0, 0xEE, 0xEE, 0xEC, 0xCE, 0xCC, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0x00, 0x40, 0x04, 0x99, 0x90, 0x40, 0x09, 0x99, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0x99, 0x22, 0xDD, 0x8D, 0x88, 0x88, 0x88, 0x88, 0xD8, 0xD8, 0xD8, 0xD8, 0xDD, 0x8D, 0x88, 0x88, 0xC8, 0x68, 0x68, 0x66, 0x66, 0xF6, 0xFF, 0xB5, 0xF5, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x21, 0x11, 0x13, 0x37, 0x33, 0x33, 0x33, 0x37, 0x33, 0x33, 0x3E, 0x33, 0x33, 0x31, 0x71, 0x11, 0xBB, 0xBB, 0x55, 0x55, 0x55, 0xBB, 0x2D, 0x22, 0x22, 0x22, 0x22, 0x29, 0x22, 0x27, 0x72, 0x22, 0x92, 0xE2, 0x7E, 0x72,
+	0x00, 0x00, 0x00, 0xCC, 0xCA, 0xCC, 0xCE, 0x04, 0x21, 0x1B, 0xBB, 0x5B, 0xBB, 0xBB, 0xBB, 0xBD, 0x63, 0x9E, 0x40, 0x00, 0x0E, 0xEE, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0E, 0x0E, 0x00, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEC, 0xEC, 0xEE, 0xEE, 0xCC, 0xCC, 0xC0, 0x0E, 0x00, 0x04, 0x49, 0x00, 0x00, 0x00, 0x99, 0x22, 0x2D, 0x2D, 0xDD, 0xD2, 0x99, 0x22, 0xDD, 0x8D, 0x88, 0xD8, 0xD8, 0x88, 0x8D, 0x8D, 0x8D, 0x8D, 0xD8, 0xD8, 0x8D, 0x88, 0x88, 0x86, 0x86, 0x86, 0x6B, 0x6B, 0xFB, 0x5F, 0x5F, 0x5F, 0xAA, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x11, 0x11, 0x27, 0x73, 0x17, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x33, 0x33, 0xE3, 0x11, 0x11, 0x11, 0x11, 0xBB, 0x55, 0x55, 0x5B, 0xBB, 0x22, 0xD2, 0x22, 0x29, 0x22, 0x92, 0x92, 0x27, 0x7E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+	0x00, 0x00, 0x0E, 0xEC, 0xCC, 0xCC, 0xCE, 0x44, 0x21, 0xBB, 0xBB, 0xBB, 0xBB, 0x5B, 0xBB, 0xBD, 0x63, 0x92, 0x44, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xEE, 0xE0, 0x0E, 0x00, 0xEE, 0x0E, 0x00, 0x0E, 0xEE, 0x00, 0xEE, 0xEE, 0x0E, 0xEE, 0xEC, 0xEE, 0xEE, 0xEC, 0xCC, 0xEE, 0x00, 0x00, 0x44, 0x00, 0x04, 0x04, 0x09, 0x99, 0x22, 0x2D, 0xDD, 0xDD, 0x79, 0x92, 0x22, 0x8D, 0x8D, 0x88, 0xD8, 0x88, 0x88, 0x88, 0xD8, 0x8D, 0x8D, 0x8D, 0x8D, 0x88, 0x88, 0x88, 0x68, 0x68, 0x66, 0x66, 0x66, 0xFF, 0xFB, 0x5F, 0x55, 0x5A, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF3, 0x17, 0x22, 0x7E, 0x73, 0x73, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x1B, 0x11, 0x11, 0x1B, 0x55, 0x55, 0xBB, 0xB1, 0x2D, 0x22, 0x22, 0x22, 0x22, 0x92, 0x92, 0xE7, 0x22, 0xE2, 0x97, 0x7E, 0x7E, 0x24,
+	0x00, 0x00, 0x00, 0xCC, 0xCC, 0xCC, 0xEE, 0x44, 0x21, 0x1B, 0xBB, 0x5B, 0xB5, 0xBB, 0xBB, 0xB8, 0x11, 0xEE, 0x40, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0xE0, 0xEE, 0xE0, 0x00, 0xE0, 0xE0, 0x0E, 0xEE, 0x0E, 0xEE, 0xCE, 0xE0, 0xE0, 0xEE, 0xCE, 0xEE, 0xEE, 0xCC, 0xE0, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x99, 0x92, 0x22, 0xD2, 0xDD, 0xDD, 0x29, 0x92, 0x2D, 0xD8, 0xD8, 0xD8, 0x88, 0xD8, 0x88, 0xD8, 0x88, 0x88, 0xD8, 0xD8, 0x88, 0x8D, 0x88, 0x88, 0x88, 0x68, 0x68, 0x66, 0xB6, 0xBB, 0x5F, 0xF5, 0x5F, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x72, 0x9E, 0x22, 0xE2, 0x77, 0x73, 0xE3, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x31, 0xB1, 0x11, 0x11, 0xBB, 0x55, 0x55, 0xBB, 0xB1, 0x22, 0x22, 0x22, 0x22, 0x92, 0x92, 0x22, 0x72, 0xE2, 0xE2, 0xE7, 0xE2, 0xE2, 0x49,
+	0x00, 0x00, 0x0E, 0xEC, 0xCC, 0xCC, 0xCE, 0x44, 0x21, 0x1B, 0xBB, 0xBB, 0xBB, 0xB5, 0xBB, 0xBD, 0x1D, 0x92, 0x44, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xE0, 0xEE, 0xEC, 0xEE, 0xE0, 0xEE, 0xEE, 0x0E, 0xCE, 0xEE, 0xE0, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x99, 0x92, 0x22, 0xDD, 0xDD, 0x2D, 0x29, 0x92, 0x2D, 0xD8, 0xD8, 0x8D, 0x88, 0x88, 0x88, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xD8, 0xD8, 0x88, 0x86, 0x88, 0x86, 0x86, 0x6B, 0x6B, 0x63, 0xBF, 0x5F, 0x55, 0x5A, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x92, 0x92, 0x99, 0x2E, 0x2E, 0x7E, 0x1E, 0x33, 0x3E, 0x3E, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0xB5, 0x55, 0x55, 0x5B, 0xB2, 0x22, 0x22, 0x92, 0x22, 0xE9, 0x92, 0x27, 0xE2, 0x22, 0xE2, 0x27, 0xE2, 0xE2, 0x49,
+	0x00, 0x00, 0x00, 0xEA, 0xCA, 0xCC, 0xCE, 0x44, 0x22, 0xBB, 0xBB, 0xBB, 0x5B, 0x5B, 0xBB, 0xB8, 0x17, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xE0, 0xE0, 0x00, 0x00, 0x0E, 0x0E, 0xEE, 0xEE, 0xCC, 0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0xEE, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x92, 0x92, 0x2D, 0x2D, 0x2D, 0xD2, 0x99, 0x92, 0xDD, 0x8D, 0x8D, 0x88, 0x88, 0x88, 0x8D, 0x88, 0x88, 0x88, 0xD8, 0x8D, 0x8D, 0x88, 0x88, 0x88, 0x86, 0x88, 0x68, 0x66, 0xB6, 0xBB, 0x5B, 0xFB, 0x55, 0xFA, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x92, 0x99, 0x29, 0x99, 0x2E, 0xE7, 0xE1, 0xEE, 0x3E, 0x33, 0x3E, 0x33, 0x1B, 0x11, 0x12, 0x11, 0xB5, 0x55, 0x5B, 0xBB, 0x12, 0x22, 0x29, 0x22, 0x22, 0x92, 0x92, 0x72, 0x2E, 0x2E, 0x2E, 0x7E, 0x1E, 0x9E, 0x99,
+	0x00, 0x00, 0x00, 0xEC, 0xAC, 0xCC, 0xC3, 0x04, 0x21, 0x1B, 0xBB, 0xBB, 0xBB, 0xBB, 0x5B, 0xB8, 0x77, 0x2E, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0xEE, 0x00, 0xE0, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0x0E, 0xCE, 0xEE, 0xCE, 0x0E, 0xE0, 0xEE, 0xEC, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x09, 0x92, 0x22, 0xDD, 0xDD, 0xDD, 0xD9, 0x99, 0x22, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x88, 0xD8, 0x8D, 0x8D, 0x8D, 0x8D, 0xD8, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x68, 0x68, 0x6B, 0xFB, 0x6F, 0xB5, 0xF5, 0x5F, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x92, 0x92, 0x92, 0x92, 0x4E, 0xEE, 0xEE, 0xEE, 0x7E, 0xEE, 0x33, 0x33, 0x11, 0xB1, 0x11, 0x11, 0xB5, 0x55, 0x5B, 0xBB, 0x22, 0x29, 0x29, 0x22, 0x92, 0x92, 0x27, 0xE7, 0xE2, 0xE2, 0xE2, 0x7E, 0x2E, 0x29, 0x99,
+	0x00, 0x00, 0x00, 0xEC, 0xCC, 0xAC, 0xCE, 0xE4, 0x22, 0xB8, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0xB8, 0x27, 0x7E, 0x20, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x0E, 0xE0, 0x0E, 0x00, 0xEE, 0xEC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x99, 0x92, 0x22, 0xD2, 0xD2, 0xD2, 0x29, 0x99, 0x2D, 0xD8, 0xD8, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x88, 0x88, 0xD8, 0xDD, 0x88, 0x88, 0x88, 0x88, 0x86, 0x86, 0x86, 0xB6, 0xBB, 0xBF, 0xB5, 0xF5, 0xFA, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x27, 0x97, 0x97, 0x92, 0x92, 0x49, 0xEE, 0xEE, 0xEE, 0xEE, 0x73, 0x33, 0x11, 0xB1, 0x1B, 0x55, 0x55, 0x5B, 0xB1, 0x22, 0x99, 0x29, 0x29, 0x29, 0x29, 0x72, 0x22, 0x2E, 0x22, 0xE2, 0x7E, 0x7E, 0x94, 0x99,
+	0x00, 0x00, 0x00, 0xEA, 0xCA, 0xCC, 0xCC, 0x44, 0x22, 0xBB, 0xBB, 0xB5, 0xBB, 0xB5, 0xBB, 0xB8, 0x27, 0x7E, 0xE0, 0x04, 0x00, 0xE0, 0x0E, 0x0E, 0x00, 0xEE, 0x00, 0xEE, 0x0E, 0xE0, 0xE0, 0x00, 0x0E, 0x00, 0x0E, 0x0E, 0xEE, 0xCC, 0xCE, 0xEE, 0xEC, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x99, 0x22, 0x22, 0xDD, 0xDD, 0xD2, 0x99, 0x92, 0x28, 0xDD, 0x8D, 0x8D, 0x8D, 0x88, 0xD8, 0x8D, 0x8D, 0x88, 0xD8, 0xD8, 0xDD, 0x8D, 0xD8, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x68, 0x68, 0xB6, 0xBF, 0xFF, 0xF5, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x79, 0x22, 0x77, 0x2E, 0x29, 0x29, 0xE9, 0x99, 0x44, 0x44, 0x4E, 0xEE, 0x33, 0x1B, 0xBB, 0x1B, 0xB5, 0x55, 0xBB, 0xB2, 0x29, 0x99, 0x29, 0x29, 0x29, 0x27, 0x77, 0xEE, 0x2E, 0x24, 0x7E, 0x1E, 0x2E, 0x24, 0x09,
+	0x00, 0x00, 0x00, 0xEC, 0xCC, 0xAC, 0xCC, 0x44, 0x21, 0x11, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB1, 0x97, 0x74, 0x40, 0x40, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0x0E, 0xEC, 0xEC, 0xEC, 0xCE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x22, 0x22, 0xD2, 0xDD, 0x22, 0x09, 0x92, 0xD8, 0xD8, 0x88, 0xD8, 0x88, 0xD8, 0x8D, 0x88, 0x88, 0x8D, 0x88, 0xD8, 0xDD, 0xD8, 0xD8, 0xD8, 0x8D, 0x88, 0x88, 0x68, 0x66, 0x86, 0x6B, 0x6B, 0xB5, 0xB5, 0xF5, 0xF5, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x39, 0x7E, 0x7E, 0x22, 0x2E, 0x29, 0x29, 0xE9, 0x44, 0x00, 0x00, 0xEE, 0xE1, 0xBB, 0xBB, 0xBB, 0x55, 0x55, 0xBB, 0x12, 0x99, 0x99, 0x29, 0x29, 0x29, 0x77, 0xE7, 0x29, 0x29, 0x2E, 0x77, 0xE2, 0xE9, 0x49, 0x90,
+	0x09, 0x99, 0x04, 0xEC, 0xAC, 0xCA, 0xCC, 0x44, 0xE1, 0x1B, 0xBB, 0xBB, 0xB5, 0xB5, 0xBB, 0xBD, 0x23, 0xE4, 0x40, 0x40, 0x00, 0x0E, 0x00, 0xE0, 0xE0, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0x0E, 0x0E, 0xEE, 0xEC, 0xCE, 0xCE, 0xEC, 0xEE, 0x00, 0x0E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x09, 0x92, 0x22, 0x2D, 0x2D, 0xDD, 0x20, 0x99, 0x2D, 0xDD, 0x8D, 0xDD, 0x8D, 0xD8, 0x8D, 0x88, 0xD8, 0x8D, 0x88, 0xD8, 0x8D, 0x88, 0xDD, 0x8D, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x86, 0xB6, 0x66, 0xBB, 0xFB, 0x5F, 0x5F, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x22, 0x77, 0x2E, 0x22, 0xE2, 0x42, 0x94, 0x40, 0x00, 0x00, 0x0E, 0x1B, 0x55, 0xBB, 0x1B, 0x55, 0xB5, 0xBB, 0x29, 0x99, 0x92, 0x92, 0x99, 0x22, 0x77, 0x74, 0x2E, 0x2E, 0x2E, 0x77, 0xE7, 0xE9, 0x44, 0x90,
+	0x9E, 0x2E, 0xEE, 0x3C, 0xCA, 0xCA, 0xCC, 0xE4, 0x21, 0x1B, 0xBB, 0x5B, 0xBB, 0xB5, 0xBB, 0xB2, 0x23, 0x74, 0x00, 0x40, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0xE0, 0x0E, 0xEC, 0xEC, 0xCE, 0xEC, 0xEC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x22, 0xD2, 0xDD, 0x22, 0x90, 0x99, 0x2D, 0xDD, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x8D, 0x88, 0x88, 0x88, 0x8D, 0xD8, 0x8D, 0x88, 0x88, 0xD8, 0xD8, 0x88, 0x86, 0x8B, 0x86, 0x86, 0xB6, 0xFB, 0xFF, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xE9, 0x77, 0x77, 0x72, 0x2E, 0x2E, 0x24, 0x44, 0x40, 0x00, 0x04, 0xB5, 0x5B, 0xBB, 0xBB, 0xB5, 0xBB, 0xB2, 0x99, 0x99, 0x29, 0x29, 0x92, 0x97, 0x7E, 0x2E, 0x29, 0xE9, 0x27, 0x77, 0xE7, 0xEE, 0x99, 0x49,
+	0x2E, 0xE2, 0xEE, 0xEC, 0xCC, 0xAC, 0xCC, 0xEE, 0x22, 0xB1, 0xBB, 0xB5, 0xBB, 0xB5, 0xBB, 0xBD, 0x23, 0xEE, 0x00, 0x04, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x0E, 0x0E, 0x00, 0xE0, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0xE0, 0x0E, 0xEE, 0xCC, 0xCC, 0xEE, 0xCE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x22, 0x22, 0xDD, 0xDD, 0x29, 0x99, 0x9D, 0xDD, 0x8D, 0x8D, 0xD8, 0xD8, 0xD8, 0x88, 0x8D, 0x88, 0x88, 0xD8, 0xD8, 0x88, 0x8D, 0x8D, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x86, 0xB6, 0x6B, 0xBF, 0x5B, 0xF5, 0xF5, 0xAA, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x97, 0x27, 0x22, 0x7E, 0x72, 0xE2, 0xE9, 0xE4, 0x40, 0x00, 0x09, 0xB5, 0xBB, 0xBB, 0xBB, 0x5B, 0x5B, 0x19, 0x99, 0x92, 0x99, 0x99, 0x29, 0x77, 0x7E, 0x29, 0x42, 0x2E, 0x2E, 0x3E, 0x34, 0xE2, 0x44, 0x94,
+	0xE2, 0xE2, 0xE7, 0x3C, 0xCC, 0xAC, 0xAC, 0xEE, 0x21, 0x1B, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xB2, 0x27, 0x7E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0xE0, 0x0E, 0xE0, 0x00, 0x0E, 0x00, 0xEE, 0x0E, 0x0E, 0x0E, 0xEE, 0xEC, 0xCE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x2D, 0x2D, 0x22, 0x90, 0x99, 0x2D, 0xDD, 0xDD, 0x8D, 0x8D, 0x88, 0x8D, 0x8D, 0x88, 0xD8, 0x88, 0x88, 0x88, 0xD8, 0xD8, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x88, 0x88, 0x88, 0x68, 0x6B, 0x6B, 0x6B, 0xBF, 0x5F, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x9E, 0x27, 0x7E, 0x12, 0x7E, 0x2E, 0x2E, 0x24, 0x44, 0x40, 0x94, 0x35, 0x5B, 0xBB, 0xBB, 0x55, 0xB1, 0x99, 0x99, 0x99, 0x29, 0x92, 0x97, 0x27, 0xE2, 0x4E, 0x24, 0x92, 0xE1, 0xE1, 0x47, 0x4E, 0x99, 0x44,
+	0xE2, 0xE2, 0x77, 0xEC, 0xCC, 0xAC, 0xCC, 0x34, 0x22, 0x1B, 0xBB, 0xBB, 0xB5, 0xBB, 0x5B, 0xB2, 0x73, 0xE4, 0x04, 0x04, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x0E, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x0E, 0x0E, 0xEE, 0x00, 0xE0, 0x0E, 0xEE, 0xEE, 0xEE, 0xCC, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x22, 0x2D, 0xD2, 0x29, 0x99, 0x92, 0x2D, 0xDD, 0xDD, 0x8D, 0x88, 0xD8, 0xD8, 0x8D, 0x8D, 0x8D, 0x88, 0xD8, 0x88, 0xD8, 0x8D, 0x8D, 0x88, 0xD8, 0x88, 0xD8, 0x88, 0x81, 0x86, 0x8B, 0x1B, 0x6B, 0x6F, 0xFF, 0x5F, 0x55, 0xFA, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x29, 0x7E, 0x77, 0x2E, 0x1E, 0x7E, 0x2E, 0xEE, 0x44, 0x99, 0x92, 0x1B, 0x55, 0xBB, 0xBB, 0xBB, 0x19, 0x99, 0x99, 0x99, 0x99, 0x29, 0x77, 0x7E, 0x24, 0x92, 0x9E, 0x2E, 0x37, 0x7E, 0x74, 0x74, 0xE9, 0xE9,
+	0x99, 0x7E, 0x73, 0xCC, 0xCA, 0xCA, 0xCC, 0xEE, 0x21, 0x1B, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0xB2, 0x27, 0xE4, 0x04, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0xEE, 0xE0, 0x0E, 0xEE, 0x00, 0x00, 0xEE, 0x0E, 0xEE, 0x0E, 0xEE, 0xEE, 0xCE, 0xEE, 0xCE, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x49, 0x92, 0x22, 0xD2, 0x29, 0x90, 0x99, 0x2D, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0x88, 0xD8, 0xD8, 0xD8, 0x88, 0x88, 0x8D, 0x88, 0x88, 0xD8, 0x88, 0xD8, 0x8D, 0x8D, 0x88, 0xD8, 0x88, 0x88, 0x16, 0x86, 0xB6, 0xBB, 0xFB, 0xFF, 0x5F, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x39, 0x22, 0x77, 0x77, 0x22, 0xE7, 0xE7, 0xE2, 0x4E, 0xE2, 0x99, 0x35, 0x5B, 0x5B, 0xBB, 0xB2, 0x29, 0x99, 0x99, 0x29, 0x29, 0x97, 0x7E, 0x72, 0x42, 0x4E, 0x92, 0xE1, 0xE7, 0x7E, 0x7E, 0xE9, 0x99, 0xE9,
+	0x9E, 0x77, 0x7E, 0x3C, 0xCC, 0xCC, 0xCC, 0x34, 0x72, 0x1B, 0xBB, 0xBB, 0xB5, 0xBB, 0xBB, 0xB2, 0x73, 0xE4, 0x04, 0x0E, 0x0E, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0E, 0xEE, 0xE0, 0xEE, 0xEE, 0x00, 0x0E, 0xEE, 0xE0, 0xEE, 0x0E, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x27, 0x72, 0x92, 0x09, 0x99, 0x22, 0xD2, 0xDD, 0xDD, 0xDD, 0x8D, 0xD8, 0xDD, 0x88, 0x88, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD8, 0x8D, 0x88, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x8B, 0x66, 0xB6, 0x6B, 0xFB, 0xFF, 0x5F, 0x55, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC9, 0x7E, 0x2E, 0x7E, 0x77, 0xE7, 0x7E, 0x7E, 0x2E, 0x2E, 0x22, 0x15, 0x5B, 0x5B, 0xB1, 0x29, 0x99, 0x99, 0x29, 0x29, 0x92, 0x27, 0x77, 0xEE, 0x9E, 0x92, 0xE2, 0xE1, 0x7E, 0x3E, 0xE2, 0x44, 0x4E, 0x99,
+	0x99, 0xE7, 0xCE, 0xE3, 0xCC, 0xAC, 0xAC, 0xEE, 0x72, 0x11, 0xBB, 0xB5, 0xBB, 0x5B, 0x5B, 0xB1, 0x97, 0xE0, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0xEE, 0x0E, 0x00, 0xEE, 0xE0, 0x0E, 0xEE, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0xEE, 0x0E, 0xEE, 0xCC, 0xE0, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE9, 0x29, 0x99, 0x00, 0x99, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD8, 0x88, 0x8D, 0x88, 0x88, 0x18, 0x68, 0x1B, 0x66, 0x6B, 0xFB, 0x5F, 0xF5, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x59, 0x22, 0xE2, 0x77, 0x7E, 0x7E, 0x7E, 0xE7, 0xE7, 0xE2, 0x42, 0x1B, 0x55, 0xBB, 0x12, 0x99, 0x99, 0x92, 0x99, 0x99, 0x2E, 0x77, 0xE2, 0x92, 0x99, 0x99, 0x7E, 0x77, 0x77, 0xE7, 0xE4, 0x4E, 0x49, 0xE9,
+	0x09, 0xEE, 0xE7, 0xEC, 0xCC, 0xCC, 0xCC, 0x3E, 0xE1, 0x1B, 0xBB, 0xBB, 0x5B, 0xBB, 0xBB, 0xB1, 0x97, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0x0E, 0x0E, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x99, 0x00, 0x09, 0x99, 0x22, 0x22, 0x2D, 0xDD, 0x2D, 0xDD, 0xDD, 0xD8, 0xD8, 0xD8, 0xD8, 0x88, 0x8D, 0x8D, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD8, 0x8D, 0x8D, 0x88, 0x8D, 0x88, 0x88, 0x88, 0x68, 0x66, 0x6B, 0xFB, 0xFF, 0x5F, 0xF5, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x4E, 0x27, 0xE7, 0x77, 0x77, 0x77, 0xE7, 0xE7, 0x77, 0x72, 0x1B, 0xBB, 0xB1, 0x29, 0x2E, 0x29, 0x29, 0x29, 0x2E, 0x27, 0x77, 0x7E, 0x24, 0xE9, 0x92, 0xE7, 0x77, 0x3E, 0x7E, 0x24, 0x44, 0xE9, 0xE9,
+	0x09, 0x9E, 0xEE, 0x7E, 0xCC, 0xAC, 0xCC, 0x3E, 0x72, 0x11, 0xBB, 0xB5, 0xBB, 0x5B, 0xBB, 0xB1, 0x9E, 0x40, 0x40, 0xE0, 0xE0, 0x0E, 0xE0, 0xE0, 0xEE, 0x0E, 0x0E, 0x0E, 0xE0, 0xEE, 0xEC, 0xEE, 0x0E, 0x0E, 0xE0, 0xEE, 0xEE, 0xE0, 0xEE, 0xCC, 0xCE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x92, 0x22, 0x22, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xDD, 0xD8, 0xD8, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD8, 0x8D, 0x88, 0x88, 0x88, 0x1B, 0x1B, 0xB8, 0x6B, 0xFB, 0xF5, 0xB5, 0x5F, 0xAF, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x92, 0x97, 0xE7, 0xE7, 0xE3, 0xE7, 0xE1, 0xE1, 0x77, 0x7E, 0x71, 0xB1, 0x19, 0x92, 0x92, 0x92, 0x92, 0x99, 0x24, 0x77, 0xE7, 0xE9, 0x99, 0x99, 0xE2, 0x77, 0x7E, 0x3E, 0x7E, 0xE4, 0x44, 0x44, 0x90,
+	0x00, 0x99, 0x7E, 0xE3, 0xCC, 0xCA, 0xCC, 0x3E, 0x77, 0x1B, 0xBB, 0xB5, 0xB5, 0xBB, 0x5B, 0xBB, 0x99, 0x40, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0x00, 0x0E, 0x0E, 0xE0, 0x0E, 0xCE, 0xCE, 0x00, 0xEE, 0xC0, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x92, 0x22, 0x22, 0x2D, 0xD2, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xD8, 0xDD, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD8, 0x88, 0x88, 0x8D, 0x88, 0x88, 0x88, 0x86, 0xBB, 0x6B, 0x6F, 0xBF, 0x5F, 0x55, 0xFA, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x9E, 0x2E, 0x7E, 0x1E, 0x1E, 0x1E, 0x3E, 0x1E, 0x17, 0x72, 0x12, 0x22, 0x22, 0x29, 0x24, 0x72, 0x99, 0x29, 0xE7, 0x77, 0x7E, 0x92, 0x99, 0x92, 0x97, 0xE3, 0x3E, 0x3E, 0x7E, 0x44, 0x44, 0x44, 0x40,
+	0x09, 0x49, 0x4E, 0xE3, 0xCC, 0xCC, 0xAC, 0xE3, 0xE1, 0x11, 0xBB, 0xB5, 0xBB, 0xBB, 0xBB, 0xBB, 0x9E, 0x44, 0x04, 0x40, 0x00, 0xE0, 0xEE, 0xE0, 0xEE, 0x00, 0x00, 0xEE, 0xE0, 0x0E, 0xEE, 0xCE, 0xE0, 0xEE, 0xEE, 0x00, 0xEE, 0xEE, 0xEE, 0xCC, 0xEE, 0xEE, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x92, 0x22, 0x22, 0x22, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x18, 0x18, 0x61, 0x6B, 0xBF, 0xBF, 0xF5, 0xF5, 0x5F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x49, 0xE2, 0xE7, 0xE1, 0xE1, 0xE1, 0xE1, 0x71, 0x77, 0x12, 0x27, 0x72, 0x29, 0x72, 0x77, 0x2E, 0x29, 0xE2, 0x2E, 0x7E, 0x29, 0x24, 0x99, 0x99, 0x73, 0xE3, 0xE3, 0xE7, 0xEE, 0x94, 0x44, 0x44, 0x99,
+	0x04, 0x44, 0xEE, 0x4E, 0xCC, 0xAC, 0xAC, 0xCE, 0x72, 0x11, 0xBB, 0xB5, 0xBB, 0x55, 0xBB, 0xB7, 0x99, 0xE4, 0x00, 0x0E, 0x00, 0xE0, 0xE0, 0x0E, 0x0E, 0xE0, 0xE0, 0xEE, 0xE0, 0xEE, 0xEE, 0xEC, 0xE0, 0x0E, 0xCE, 0xE0, 0x0E, 0xCE, 0xEE, 0xEE, 0xCE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x92, 0x22, 0x22, 0xDD, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0xDD, 0x8D, 0xDD, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x88, 0x88, 0x88, 0xB8, 0x66, 0x8B, 0x86, 0xBF, 0xBF, 0xBF, 0xFF, 0x55, 0xF5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x79, 0x2E, 0x7E, 0x1E, 0x77, 0xE1, 0xE1, 0xE1, 0x77, 0x21, 0x27, 0x27, 0x27, 0x22, 0x22, 0x29, 0x29, 0x2E, 0x27, 0xE2, 0x44, 0xE2, 0x92, 0x42, 0xE1, 0x73, 0x77, 0x7E, 0xE2, 0x44, 0x44, 0x44, 0x40,
+	0x44, 0x44, 0x94, 0x4E, 0xCC, 0xAA, 0xAC, 0xC3, 0xE1, 0x1B, 0xBB, 0xBB, 0xB5, 0xBB, 0x5B, 0xB9, 0x94, 0x44, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x0E, 0x0E, 0xE0, 0x0E, 0xEE, 0xE0, 0x0E, 0xEE, 0xEC, 0xEE, 0x0E, 0xEC, 0xE0, 0x0E, 0xEE, 0xE0, 0xEE, 0xCE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x99, 0x22, 0x22, 0xDD, 0xDD, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x8B, 0x1B, 0x6B, 0x6B, 0xFB, 0xF5, 0x5F, 0x5F, 0xA5, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x30, 0xE9, 0x7E, 0x77, 0xE3, 0xE3, 0x17, 0x17, 0x71, 0x22, 0x12, 0x72, 0x72, 0x27, 0x72, 0x22, 0xE2, 0xE2, 0xE7, 0x49, 0x92, 0x99, 0x49, 0xE7, 0x77, 0x3E, 0x3E, 0x7E, 0xE9, 0x44, 0x49, 0x40, 0x99,
+	0x00, 0x40, 0x44, 0x4E, 0x5C, 0xAA, 0xAA, 0x53, 0xE1, 0x2B, 0xBB, 0xB5, 0xB5, 0xBB, 0xBB, 0xB2, 0x94, 0x04, 0x44, 0xE0, 0x00, 0xE0, 0xE0, 0xEE, 0x0E, 0xE0, 0x00, 0xCE, 0xE0, 0x0E, 0xCE, 0xEC, 0xEE, 0x0E, 0xEE, 0xEE, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x49, 0x92, 0x22, 0x2D, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB8, 0xB8, 0x81, 0xB6, 0xBB, 0xFF, 0xFF, 0xF5, 0xFA, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x50, 0x2E, 0xE7, 0xE1, 0xE1, 0xE1, 0xE1, 0x71, 0x72, 0x12, 0x21, 0x27, 0x27, 0x12, 0x12, 0x29, 0x2E, 0x7E, 0x74, 0x24, 0x94, 0x9E, 0x97, 0x27, 0x3E, 0x37, 0xE3, 0xEE, 0x94, 0x94, 0x44, 0x99, 0x99,
+	0x00, 0x40, 0x44, 0x4E, 0x5A, 0xAA, 0xAA, 0xC3, 0x71, 0x11, 0xBB, 0xBB, 0x5B, 0xB5, 0xB5, 0xB7, 0x70, 0x40, 0x40, 0x00, 0xE0, 0xE0, 0x0E, 0x0E, 0x00, 0xEE, 0x0E, 0xEE, 0xE0, 0x0E, 0xEE, 0xEE, 0xCE, 0x00, 0xEE, 0xE0, 0xE0, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x42, 0x22, 0x22, 0x2D, 0x2D, 0x2D, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x8D, 0x8D, 0xDD, 0x8D, 0x8D, 0xD8, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x88, 0x1B, 0x1B, 0xB6, 0xB6, 0xBB, 0x5B, 0x5F, 0x55, 0x5F, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x92, 0xE7, 0xE7, 0xE1, 0xE1, 0x17, 0x71, 0x71, 0x21, 0x22, 0x21, 0x21, 0x21, 0x22, 0x22, 0x77, 0x7E, 0x2E, 0xE2, 0xE2, 0x92, 0x97, 0xE3, 0x73, 0xE3, 0xEE, 0x9E, 0x94, 0x44, 0x99, 0x99, 0x92,
+	0x04, 0x40, 0x40, 0x4E, 0xCA, 0xAA, 0xAC, 0x5C, 0xE1, 0x11, 0xBB, 0xBB, 0xBB, 0xB5, 0xBB, 0x17, 0xE9, 0x04, 0x00, 0xE0, 0x0E, 0x0E, 0x0E, 0xEE, 0xE0, 0xEE, 0x0E, 0xCE, 0xE0, 0xEE, 0xCE, 0xEE, 0xCE, 0xE0, 0xEE, 0xC0, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEE, 0x00, 0x04, 0x99, 0x22, 0x22, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xD8, 0xD8, 0xDD, 0x8D, 0xD8, 0xDD, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x81, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x8B, 0x8B, 0x86, 0x8B, 0x6B, 0x66, 0xFF, 0xFF, 0x5F, 0x5A, 0x5A, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x44, 0x2E, 0x7E, 0x7E, 0x1E, 0x17, 0x17, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x2E, 0x2E, 0x24, 0xE2, 0x9E, 0x9E, 0x9E, 0x27, 0x73, 0x73, 0x3E, 0x7E, 0x24, 0x40, 0x90, 0x99, 0x9E, 0x2E,
+	0x00, 0x40, 0x44, 0x0E, 0x5A, 0xCA, 0xAA, 0x5C, 0x72, 0x1B, 0xBB, 0xB5, 0xB5, 0xBB, 0x5B, 0x12, 0x90, 0x40, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0xEE, 0xE0, 0x0E, 0xEE, 0xEE, 0x0E, 0x0E, 0xEE, 0xEE, 0xEC, 0xEE, 0x0E, 0xCE, 0x00, 0xEE, 0xE0, 0xE0, 0xEE, 0xEE, 0xCE, 0x00, 0x44, 0x22, 0x92, 0x22, 0x2D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0xD8, 0xD8, 0xD8, 0xDD, 0x8D, 0x8D, 0x88, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB8, 0x8B, 0x88, 0x81, 0x81, 0xB8, 0xB8, 0xBB, 0x6B, 0xB6, 0xFB, 0xFF, 0xF5, 0xF5, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xEE, 0x2E, 0x7E, 0x7E, 0x1E, 0x1E, 0x11, 0x11, 0x21, 0x21, 0x11, 0x11, 0x12, 0x22, 0x22, 0x92, 0x4E, 0x9E, 0x7E, 0x29, 0x7E, 0x23, 0x73, 0x73, 0xE7, 0xE4, 0x40, 0x00, 0x99, 0x94, 0x29, 0x72,
+	0x00, 0x00, 0x40, 0x0E, 0xCA, 0xAA, 0xCC, 0x53, 0xE1, 0x11, 0xBB, 0xBB, 0x5B, 0x5B, 0x5B, 0x19, 0xE9, 0x40, 0x00, 0xE0, 0x0E, 0x0E, 0x0E, 0x4E, 0xEE, 0x0E, 0xEE, 0xC0, 0xE0, 0xEE, 0xC0, 0xEE, 0xEE, 0xCE, 0xEE, 0xEE, 0x00, 0xE0, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xE4, 0x22, 0x22, 0x22, 0xD2, 0xD2, 0xD2, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xDD, 0x8D, 0x8D, 0x8D, 0xD8, 0xD8, 0xD8, 0x8D, 0x88, 0x88, 0x88, 0x88, 0x18, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x8B, 0x88, 0xB6, 0xBB, 0x68, 0xB6, 0xB6, 0xFF, 0xF5, 0xF5, 0x55, 0xAF, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0xE7, 0xEE, 0xE7, 0xE1, 0xE1, 0x71, 0x11, 0x21, 0x12, 0x12, 0x11, 0xD1, 0xD2, 0x22, 0x92, 0x49, 0xE9, 0x7E, 0x2E, 0x24, 0x29, 0x3E, 0x37, 0x3E, 0x3E, 0x44, 0x44, 0x00, 0x90, 0x9E, 0x27, 0x77,
+};
+
+static const struct s_bitmap _lena_indexed4 =
+{
+	_lena_indexed4_data,
+	256,
+	256,
+	false,
+	BITMAP_BUFFER_INDEXED4,
+	_lena_indexed4_palette,
+};
+
+const bitmap_t *lena_indexed4_bitmap = &_lena_indexed4;
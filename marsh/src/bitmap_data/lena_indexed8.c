@@ -0,0 +1,364 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "bitmap_data.h"
+#include "pixel_format.h"
+
+/* 256 colors by median cut, dithered. */
+static const pixel_t _lena_indexed8_palette[256] =
+{
+	PIXEL_PACK(0x44, 0x07, 0x1F), PIXEL_PACK(0xA9, 0x64, 0x5E), PIXEL_PACK(0x9D, 0x31, 0x3E), PIXEL_PACK(0x9A, 0x67, 0x81),
+	PIXEL_PACK(0x52, 0x14, 0x45), PIXEL_PACK(0xD2, 0xA9, 0x9E), PIXEL_PACK(0xD8, 0x7A, 0x7F), PIXEL_PACK(0xA3, 0x41, 0x55),
+	PIXEL_PACK(0xDF, 0x68, 0x61), PIXEL_PACK(0x63, 0x0D, 0x25), PIXEL_PACK(0xDA, 0xB1, 0xAB), PIXEL_PACK(0xE9, 0x86, 0x6A),
+	PIXEL_PACK(0x98, 0x67, 0x95), PIXEL_PACK(0xCB, 0x5A, 0x5A), PIXEL_PACK(0x57, 0x20, 0x55), PIXEL_PACK(0xD7, 0x86, 0x89),
+	PIXEL_PACK(0x67, 0x1F, 0x48), PIXEL_PACK(0xCB, 0x7A, 0x88), PIXEL_PACK(0x82, 0x34, 0x58), PIXEL_PACK(0xCA, 0x77, 0x8F),
+	PIXEL_PACK(0x6B, 0x1D, 0x38), PIXEL_PACK(0xD7, 0x69, 0x60), PIXEL_PACK(0xB1, 0x3F, 0x49), PIXEL_PACK(0xCB, 0x73, 0x7D),
+	PIXEL_PACK(0x9C, 0x47, 0x5D), PIXEL_PACK(0x99, 0x6B, 0xA1), PIXEL_PACK(0xD8, 0x86, 0x94), PIXEL_PACK(0x80, 0x3F, 0x72),
+	PIXEL_PACK(0xCA, 0x7E, 0x99), PIXEL_PACK(0xE8, 0xC8, 0xB9), PIXEL_PACK(0xF4, 0xB0, 0x86), PIXEL_PACK(0xB9, 0x72, 0x8D),
+	PIXEL_PACK(0x9B, 0x4A, 0x6A), PIXEL_PACK(0xD7, 0x86, 0x98), PIXEL_PACK(0xCB, 0x84, 0xA1), PIXEL_PACK(0xE5, 0xC9, 0xBE),
+	PIXEL_PACK(0xEF, 0x93, 0x75), PIXEL_PACK(0x68, 0x2F, 0x5E), PIXEL_PACK(0x74, 0x2D, 0x49), PIXEL_PACK(0xA8, 0x7C, 0xA7),
+	PIXEL_PACK(0xF9, 0xD0, 0x98), PIXEL_PACK(0xA7, 0x3F, 0x48), PIXEL_PACK(0xD6, 0x8D, 0x84), PIXEL_PACK(0xD8, 0x7D, 0x60),
+	PIXEL_PACK(0xB8, 0x86, 0x8F), PIXEL_PACK(0xCE, 0x62, 0x5C), PIXEL_PACK(0xC3, 0x73, 0x7F), PIXEL_PACK(0xD7, 0x88, 0x9C),
+	PIXEL_PACK(0xCA, 0x82, 0xAF), PIXEL_PACK(0x69, 0x33, 0x69), PIXEL_PACK(0xEE, 0xB2, 0xAB), PIXEL_PACK(0x88, 0x3E, 0x5B),
+	PIXEL_PACK(0xCC, 0x97, 0x91), PIXEL_PACK(0x97, 0x56, 0x7D), PIXEL_PACK(0xD9, 0x95, 0x89), PIXEL_PACK(0xD0, 0x90, 0x86),
+	PIXEL_PACK(0xCF, 0x9D, 0x97), PIXEL_PACK(0xED, 0x9C, 0x79), PIXEL_PACK(0x5A, 0x09, 0x26), PIXEL_PACK(0x48, 0x0D, 0x3B),
+	PIXEL_PACK(0xC1, 0x66, 0x5C), PIXEL_PACK(0xE7, 0xA8, 0x94), PIXEL_PACK(0xBD, 0x53, 0x59), PIXEL_PACK(0x63, 0x17, 0x3D),
+	PIXEL_PACK(0xC7, 0x59, 0x5E), PIXEL_PACK(0xAE, 0x4C, 0x5F), PIXEL_PACK(0xAE, 0x57, 0x6B), PIXEL_PACK(0xA8, 0x7E, 0xB2),
+	PIXEL_PACK(0xD9, 0x98, 0xA3), PIXEL_PACK(0x5A, 0x11, 0x3C), PIXEL_PACK(0xDC, 0x98, 0xAA), PIXEL_PACK(0xAA, 0x6A, 0x73),
+	PIXEL_PACK(0xBD, 0x72, 0x7E), PIXEL_PACK(0xAE, 0x73, 0x7E), PIXEL_PACK(0x6B, 0x26, 0x55), PIXEL_PACK(0x6D, 0x1F, 0x45),
+	PIXEL_PACK(0x86, 0x21, 0x2E), PIXEL_PACK(0xD5, 0x6D, 0x6E), PIXEL_PACK(0xBA, 0x49, 0x4F), PIXEL_PACK(0xCE, 0x87, 0x7E),
+	PIXEL_PACK(0xA4, 0x6E, 0xA2), PIXEL_PACK(0x86, 0x4C, 0x82), PIXEL_PACK(0x8C, 0x2D, 0x47), PIXEL_PACK(0xD5, 0x83, 0x79),
+	PIXEL_PACK(0xCA, 0x70, 0x73), PIXEL_PACK(0xC6, 0x84, 0x7D), PIXEL_PACK(0xCA, 0x9C, 0xAB), PIXEL_PACK(0xED, 0xB6, 0xB2),
+	PIXEL_PACK(0xBE, 0x73, 0x74), PIXEL_PACK(0xE8, 0xB2, 0x8C), PIXEL_PACK(0x87, 0x2A, 0x3E), PIXEL_PACK(0xCA, 0x9A, 0xC8),
+	PIXEL_PACK(0x9E, 0x4D, 0x59), PIXEL_PACK(0xB4, 0x47, 0x49), PIXEL_PACK(0x9F, 0x53, 0x60), PIXEL_PACK(0xD9, 0x9D, 0x94),
+	PIXEL_PACK(0x85, 0x4B, 0x75), PIXEL_PACK(0xDC, 0x9E, 0x98), PIXEL_PACK(0xCC, 0x9F, 0x9F), PIXEL_PACK(0xBB, 0x95, 0x9F),
+	PIXEL_PACK(0xB8, 0x77, 0x75), PIXEL_PACK(0xC2, 0x54, 0x51), PIXEL_PACK(0xCA, 0x83, 0x78), PIXEL_PACK(0xC0, 0x7D, 0x76),
+	PIXEL_PACK(0x5A, 0x18, 0x3F), PIXEL_PACK(0xE8, 0xCF, 0xC7), PIXEL_PACK(0xC9, 0x5C, 0x63), PIXEL_PACK(0x85, 0x24, 0x40),
+	PIXEL_PACK(0x52, 0x0B, 0x23), PIXEL_PACK(0x45, 0x08, 0x31), PIXEL_PACK(0xB7, 0x69, 0x5E), PIXEL_PACK(0xA0, 0x37, 0x4B),
+	PIXEL_PACK(0xB4, 0x68, 0x7D), PIXEL_PACK(0xE2, 0x6D, 0x6D), PIXEL_PACK(0x6A, 0x10, 0x25), PIXEL_PACK(0x63, 0x16, 0x37),
+	PIXEL_PACK(0xDC, 0xB8, 0xB3), PIXEL_PACK(0xA6, 0x68, 0x93), PIXEL_PACK(0xCF, 0x90, 0x98), PIXEL_PACK(0xF5, 0xC7, 0xB6),
+	PIXEL_PACK(0xE7, 0x90, 0x96), PIXEL_PACK(0xD4, 0x80, 0x72), PIXEL_PACK(0xE8, 0x9A, 0x9C), PIXEL_PACK(0xD7, 0xA1, 0x9C),
+	PIXEL_PACK(0x70, 0x38, 0x71), PIXEL_PACK(0xAB, 0x5A, 0x7B), PIXEL_PACK(0x96, 0x5D, 0x91), PIXEL_PACK(0xE9, 0x99, 0x8B),
+	PIXEL_PACK(0xF0, 0x9F, 0x7A), PIXEL_PACK(0x5A, 0x10, 0x39), PIXEL_PACK(0x5A, 0x0E, 0x32), PIXEL_PACK(0x52, 0x0F, 0x3B),
+	PIXEL_PACK(0xC0, 0x75, 0x65), PIXEL_PACK(0xC1, 0x68, 0x6C), PIXEL_PACK(0x63, 0x16, 0x3D), PIXEL_PACK(0xB9, 0x5B, 0x63),
+	PIXEL_PACK(0xE3, 0x9C, 0xA2), PIXEL_PACK(0xED, 0x9D, 0xAF), PIXEL_PACK(0xDB, 0x97, 0xB9), PIXEL_PACK(0xB6, 0x6D, 0x74),
+	PIXEL_PACK(0xBD, 0x7E, 0x7C), PIXEL_PACK(0x7B, 0x24, 0x46), PIXEL_PACK(0xC1, 0x47, 0x4D), PIXEL_PACK(0x8C, 0x3A, 0x4A),
+	PIXEL_PACK(0xD3, 0x8C, 0x7B), PIXEL_PACK(0xEF, 0xBC, 0xBA), PIXEL_PACK(0xEA, 0x9D, 0x94), PIXEL_PACK(0xEB, 0x9D, 0x98),
+	PIXEL_PACK(0xCE, 0x56, 0x51), PIXEL_PACK(0xFC, 0xCF, 0xCA), PIXEL_PACK(0xD6, 0x5E, 0x65), PIXEL_PACK(0x52, 0x0F, 0x35),
+	PIXEL_PACK(0xB7, 0x6C, 0x6C), PIXEL_PACK(0x74, 0x16, 0x32), PIXEL_PACK(0x69, 0x16, 0x36), PIXEL_PACK(0xA9, 0x79, 0x8F),
+	PIXEL_PACK(0xC5, 0x7B, 0x73), PIXEL_PACK(0xC3, 0x78, 0x6E), PIXEL_PACK(0x70, 0x19, 0x3C), PIXEL_PACK(0x5E, 0x1D, 0x48),
+	PIXEL_PACK(0xEE, 0xD8, 0xCA), PIXEL_PACK(0xFD, 0xDC, 0xD3), PIXEL_PACK(0xDC, 0x8E, 0x87), PIXEL_PACK(0x6F, 0x24, 0x3D),
+	PIXEL_PACK(0xE2, 0x97, 0x93), PIXEL_PACK(0xF7, 0xC0, 0x91), PIXEL_PACK(0xA0, 0x58, 0x6A), PIXEL_PACK(0xDB, 0x97, 0x95),
+	PIXEL_PACK(0xA7, 0x47, 0x4E), PIXEL_PACK(0xCC, 0x69, 0x64), PIXEL_PACK(0xD9, 0x98, 0x9C), PIXEL_PACK(0xCA, 0x91, 0xB3),
+	PIXEL_PACK(0xB2, 0x7C, 0x80), PIXEL_PACK(0x8A, 0x59, 0x8C), PIXEL_PACK(0xEE, 0xC8, 0xA4), PIXEL_PACK(0x8A, 0x33, 0x3E),
+	PIXEL_PACK(0x72, 0x43, 0x77), PIXEL_PACK(0xF2, 0xAA, 0x7A), PIXEL_PACK(0x5A, 0x13, 0x2D), PIXEL_PACK(0xF8, 0xD2, 0xB2),
+	PIXEL_PACK(0x5A, 0x16, 0x39), PIXEL_PACK(0x5A, 0x14, 0x32), PIXEL_PACK(0x52, 0x15, 0x3E), PIXEL_PACK(0x45, 0x08, 0x2A),
+	PIXEL_PACK(0xB0, 0x6B, 0x68), PIXEL_PACK(0xA8, 0x67, 0x6B), PIXEL_PACK(0xA8, 0x67, 0x66), PIXEL_PACK(0x9E, 0x34, 0x45),
+	PIXEL_PACK(0xAA, 0x68, 0x7F), PIXEL_PACK(0x5E, 0x16, 0x44), PIXEL_PACK(0xDD, 0xAC, 0x9F), PIXEL_PACK(0xE5, 0x7D, 0x7D),
+	PIXEL_PACK(0xD6, 0x86, 0x7C), PIXEL_PACK(0xB3, 0x45, 0x53), PIXEL_PACK(0xE3, 0x74, 0x64), PIXEL_PACK(0x63, 0x12, 0x31),
+	PIXEL_PACK(0x63, 0x12, 0x2D), PIXEL_PACK(0xE0, 0xB8, 0xAC), PIXEL_PACK(0xDC, 0xBA, 0xAD), PIXEL_PACK(0xEA, 0x89, 0x74),
+	PIXEL_PACK(0xD4, 0x5A, 0x5A), PIXEL_PACK(0x63, 0x23, 0x56), PIXEL_PACK(0xE6, 0x87, 0x8A), PIXEL_PACK(0xCD, 0x87, 0x85),
+	PIXEL_PACK(0xCC, 0x85, 0x90), PIXEL_PACK(0x69, 0x1D, 0x41), PIXEL_PACK(0xCC, 0x82, 0x7C), PIXEL_PACK(0xCB, 0x7E, 0x7C),
+	PIXEL_PACK(0xE9, 0x8D, 0x92), PIXEL_PACK(0xDA, 0x91, 0x92), PIXEL_PACK(0xF5, 0xB1, 0x98), PIXEL_PACK(0xDB, 0x92, 0x95),
+	PIXEL_PACK(0xCF, 0x92, 0xA0), PIXEL_PACK(0xF4, 0xCB, 0xBE), PIXEL_PACK(0x71, 0x32, 0x5C), PIXEL_PACK(0x80, 0x30, 0x48),
+	PIXEL_PACK(0xB7, 0x7E, 0xA5), PIXEL_PACK(0xF8, 0xD0, 0xA1), PIXEL_PACK(0xA8, 0x40, 0x51), PIXEL_PACK(0xE7, 0x91, 0x83),
+	PIXEL_PACK(0xDB, 0x80, 0x6B), PIXEL_PACK(0xD9, 0x7C, 0x69), PIXEL_PACK(0xBA, 0x93, 0x92), PIXEL_PACK(0xCD, 0x63, 0x66),
+	PIXEL_PACK(0xC5, 0x7D, 0x7C), PIXEL_PACK(0x73, 0x37, 0x69), PIXEL_PACK(0xEF, 0xBB, 0xAD), PIXEL_PACK(0x8A, 0x48, 0x5E),
+	PIXEL_PACK(0xF2, 0x9A, 0x78), PIXEL_PACK(0x5A, 0x0B, 0x2F), PIXEL_PACK(0x50, 0x10, 0x3B), PIXEL_PACK(0xC0, 0x67, 0x67),
+	PIXEL_PACK(0xE9, 0xA8, 0xA1), PIXEL_PACK(0xD3, 0x5D, 0x5F), PIXEL_PACK(0xB8, 0x4E, 0x5F), PIXEL_PACK(0xBD, 0x5A, 0x68),
+	PIXEL_PACK(0xB7, 0x87, 0xB9), PIXEL_PACK(0x87, 0x24, 0x39), PIXEL_PACK(0x83, 0x22, 0x38), PIXEL_PACK(0xAD, 0x70, 0xA3),
+	PIXEL_PACK(0xED, 0xBF, 0xB2), PIXEL_PACK(0xE9, 0xB3, 0xA5), PIXEL_PACK(0xE8, 0xB2, 0x9F), PIXEL_PACK(0xB5, 0x4F, 0x58),
+	PIXEL_PACK(0xAD, 0x50, 0x59), PIXEL_PACK(0xB5, 0x48, 0x52), PIXEL_PACK(0xB3, 0x49, 0x4E), PIXEL_PACK(0xF1, 0xCD, 0xC9),
+	PIXEL_PACK(0xC8, 0x5D, 0x6C), PIXEL_PACK(0x52, 0x0D, 0x31), PIXEL_PACK(0x52, 0x0B, 0x2A), PIXEL_PACK(0x4A, 0x0A, 0x31),
+	PIXEL_PACK(0xB7, 0x6C, 0x69), PIXEL_PACK(0xE4, 0x7B, 0x6F), PIXEL_PACK(0x6A, 0x14, 0x31), PIXEL_PACK(0xE2, 0xC0, 0xB6),
+};
+
+static const uint8_t _lena_indexed8_data[] =
+{
+	0xC7, 0xDB, 0xC7, 0xDB, 0xC7, 0xC7, 0xC7, 0xDC, 0xC7, 0xC7, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0xFD, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0x39, 0x39, 0x24, 0x24, 0x24, 0xC7, 0xFD, 0xFD, 0x96, 0xEA, 0xDA, 0x07, 0x6F, 0x18, 0xC1, 0x41, 0x41, 0xF3, 0xF3, 0xF3, 0xC1, 0xF5, 0xF3, 0xF5, 0xF4, 0xF3, 0xF5, 0xF3, 0xF5, 0xF5, 0xF3, 0xF6, 0x3E, 0x40, 0x3E, 0x40, 0x40, 0x0D, 0x0D, 0x2D, 0x0D, 0xDF, 0xDF, 0xDF, 0x2D, 0x2D, 0xA9, 0xA9, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0xA9, 0xDF, 0xDF, 0x15, 0x15, 0xDF, 0xDF, 0x15, 0x15, 0x15, 0xDF, 0xDF, 0xDF, 0x15, 0x15, 0x15, 0xDF, 0x15, 0x96, 0x15, 0x15, 0x4D, 0x4D, 0xDF, 0x4D, 0xA9, 0x4D, 0xDF, 0xDF, 0xDF, 0xDF, 0x2D, 0xDF, 0xDF, 0xDF, 0xA9, 0xA9, 0xDF, 0xDF, 0x2D, 0xA9, 0x15, 0xDF, 0x15, 0x15, 0x15, 0x2D, 0x2D, 0xDF, 0x71, 0x15, 0xDF, 0x2D, 0xDF, 0xDF, 0xDF, 0xDF, 0x0D, 0x2D, 0xDF, 0xDF, 0x2D, 0x2D, 0x2D, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x6A, 0x6A, 0x87, 0x3E, 0x87, 0xEB, 0xF3, 0xF6, 0xF5, 0x65, 0x40, 0xA9, 0x4D, 0xDD, 0xFD, 0x79, 0xC7, 0xC7, 0xC7, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xFD, 0xC7, 0xC7, 0xC7, 0xFD, 0x0B, 0xDC, 0xDC, 0xDC, 0x2B, 0xC2, 0x2B, 0x0B, 0x2B, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0x0B, 0x1E, 0xA5, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x1E, 0x79, 0xF4, 0xA8, 0xF4, 0x41, 0xEA, 0x87, 0xF3, 0x6E, 0x3C, 0x3E, 0x3E, 0x0D, 0x3C, 0x87, 0xE7, 0x3E, 0x3E, 0x3C, 0x3E, 0x3C, 0x40, 0x0D, 0x40, 0x6A, 0x6A, 0x6A, 0x40, 0x0D, 0x6A, 0x6A, 0xE7, 0x6A, 0x3C, 0x0D, 0x6A, 0x6A, 0xEA, 0xEA, 0xEB, 0x40, 0x4D, 0xC7, 0xC7, 0xC2,
+	0xC7, 0xDB, 0xBF, 0xC7, 0xDB, 0xC7, 0xC7, 0xC0, 0xC7, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0x0B, 0x0B, 0xFD, 0xC7, 0xC7, 0xC7, 0x39, 0x24, 0xE4, 0x39, 0x24, 0x24, 0xC7, 0xFD, 0x06, 0x15, 0x3E, 0xDA, 0x6F, 0x07, 0x07, 0x07, 0xC1, 0x41, 0xF3, 0xF3, 0xC1, 0xF5, 0xF3, 0xF3, 0xF5, 0xF6, 0xF3, 0xF5, 0xF6, 0xF5, 0xF3, 0xF6, 0xF3, 0x3E, 0x40, 0x3E, 0x0D, 0x65, 0x40, 0x2D, 0x0D, 0xC8, 0x2D, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0xA9, 0x2D, 0x96, 0x15, 0xDF, 0xA9, 0xDF, 0x96, 0x15, 0xA9, 0xDF, 0x2D, 0x15, 0x15, 0x96, 0xA9, 0x15, 0x15, 0x15, 0x15, 0x4D, 0xA9, 0xA9, 0x54, 0xDF, 0xA9, 0xDF, 0xA9, 0xE9, 0xDF, 0x2D, 0xDF, 0x2D, 0xDF, 0xA9, 0xA9, 0x2D, 0x2D, 0x2D, 0xA9, 0x15, 0xDF, 0x15, 0x15, 0x2D, 0x2D, 0x2D, 0x2D, 0x4D, 0x15, 0xDF, 0x2D, 0x2D, 0xA9, 0xDF, 0x2D, 0x2D, 0x2D, 0xDF, 0xA9, 0x2D, 0x2D, 0x2D, 0xDF, 0x2D, 0xDF, 0xE9, 0xDF, 0x2D, 0x2D, 0x2D, 0xDF, 0x6A, 0x6A, 0x87, 0x3E, 0xEB, 0xF3, 0xF3, 0xF4, 0xF6, 0x65, 0x3C, 0xA9, 0x4D, 0xDD, 0x79, 0xFD, 0xC7, 0xC7, 0xC7, 0xDC, 0xDC, 0xFD, 0xDC, 0xDC, 0xFD, 0xDC, 0x79, 0xFD, 0xC7, 0x0B, 0xFD, 0xDC, 0xFD, 0xDC, 0xC2, 0xDC, 0x0B, 0x0B, 0x2B, 0x0B, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0x0B, 0xDC, 0x2B, 0x0B, 0x1E, 0xA5, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x59, 0x79, 0xA8, 0xA8, 0xF5, 0xF3, 0xEA, 0x87, 0x3C, 0x3E, 0x3E, 0x3C, 0x65, 0x3C, 0x3E, 0xE7, 0x87, 0x3C, 0x3E, 0x3C, 0x3E, 0x3C, 0x40, 0x3C, 0x0D, 0x3C, 0x6A, 0x3C, 0x0D, 0x40, 0x40, 0xE7, 0x6A, 0x3C, 0x0D, 0x3C, 0x6A, 0x6A, 0x6A, 0xF8, 0x3E, 0xF3, 0x4D, 0xD0, 0xE4, 0x0B,
+	0xC7, 0xC7, 0xDB, 0xBF, 0xC7, 0xC7, 0xC7, 0xDC, 0x0B, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0x0B, 0x0B, 0xC7, 0xC7, 0xC7, 0x39, 0x24, 0x24, 0x24, 0x24, 0xC7, 0xFD, 0x71, 0xE9, 0xEA, 0xDA, 0x07, 0x6F, 0x07, 0x41, 0xDA, 0x41, 0xC1, 0xEA, 0xC1, 0xA8, 0xF5, 0xF3, 0xF3, 0xF5, 0xF3, 0xF3, 0xF6, 0xF5, 0xF6, 0xF3, 0xF6, 0x3E, 0x65, 0x40, 0x40, 0x40, 0x0D, 0x0D, 0x2D, 0x0D, 0x2D, 0xA9, 0x2D, 0x2D, 0x2D, 0xA9, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0xDF, 0xDF, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0x15, 0x15, 0xA9, 0xDF, 0xDF, 0x4D, 0xDF, 0xDF, 0xDF, 0x2D, 0xDF, 0xDF, 0xDF, 0x2D, 0xA9, 0x2D, 0xA9, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0x2D, 0x15, 0x15, 0x15, 0x2D, 0x2D, 0x15, 0x15, 0xDF, 0xA9, 0x2D, 0xDF, 0xDF, 0x2D, 0xDF, 0x2D, 0xDF, 0xDF, 0xDF, 0xDF, 0x2D, 0xDF, 0xDF, 0xDF, 0x2D, 0xDF, 0xDF, 0x2D, 0x0D, 0x6A, 0x6A, 0x6A, 0x3C, 0xEB, 0x3E, 0x87, 0x3E, 0xF3, 0xA8, 0xF4, 0x4E, 0x6A, 0xA9, 0x4D, 0xDD, 0xFD, 0x53, 0xDC, 0xC7, 0xC7, 0xDC, 0xDC, 0xDC, 0xFD, 0xDC, 0xDC, 0xFD, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x2B, 0x0B, 0x0B, 0x0B, 0xC2, 0x2B, 0x0B, 0xDC, 0x0B, 0x90, 0x0B, 0x90, 0xDC, 0x0B, 0x2B, 0x90, 0xB1, 0xA5, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0x2B, 0x01, 0x29, 0xF4, 0xF3, 0xEA, 0x87, 0x3E, 0x6E, 0x3E, 0x6E, 0x3E, 0x3C, 0x3E, 0x87, 0x3C, 0x3E, 0x3E, 0x3C, 0x87, 0x3E, 0x3C, 0x40, 0x40, 0x0D, 0x40, 0x0D, 0x3C, 0x65, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x0D, 0x40, 0x3C, 0x65, 0x3E, 0x3E, 0x3E, 0x54, 0xD0, 0xD0, 0x54,
+	0xBF, 0xC7, 0xC7, 0xC7, 0xFD, 0xC7, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0xFD, 0xDC, 0xFD, 0x0B, 0xFD, 0x0B, 0xC7, 0x24, 0x24, 0x24, 0x24, 0x39, 0x24, 0x24, 0x0B, 0xDD, 0x71, 0xDF, 0x3E, 0xC1, 0x07, 0x6F, 0x07, 0xDA, 0xDA, 0xC1, 0x41, 0xC1, 0xC1, 0xDA, 0xF5, 0xF5, 0xF5, 0xF6, 0xF6, 0xF6, 0xF4, 0xF5, 0xF5, 0xF6, 0xF3, 0x65, 0x3E, 0x40, 0x65, 0x40, 0x40, 0x0D, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0xA9, 0x2D, 0x2D, 0x2D, 0xA9, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x96, 0xDF, 0xDF, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xA9, 0xDF, 0xA9, 0xDF, 0xE9, 0x2D, 0x2D, 0x2D, 0xDF, 0xA9, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x15, 0x96, 0x2D, 0x2D, 0x2D, 0x15, 0xDF, 0xDF, 0x2D, 0xDF, 0x2D, 0x2D, 0xDF, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xDF, 0x6A, 0xE9, 0x2D, 0x40, 0x3C, 0x6A, 0x6A, 0x40, 0x87, 0x3E, 0x87, 0xF3, 0xF3, 0xF4, 0x5D, 0xF3, 0x3E, 0xA9, 0x4D, 0x4D, 0x79, 0xC7, 0x53, 0xC7, 0xC7, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0x0B, 0xDC, 0x0B, 0x0B, 0xDC, 0x0B, 0x2B, 0x0B, 0x0B, 0x0B, 0x2B, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0x2B, 0x0B, 0x39, 0xA5, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x28, 0x90, 0x6E, 0xA8, 0xA8, 0xF4, 0xEA, 0x87, 0x3E, 0x3E, 0x3C, 0x3E, 0x3E, 0x3C, 0x3E, 0x3C, 0x3E, 0x3C, 0x3E, 0x87, 0x65, 0x3C, 0x6A, 0x6A, 0x3C, 0x0D, 0x3C, 0x65, 0x40, 0x0D, 0x3C, 0x6A, 0x6A, 0x6A, 0x3C, 0x6A, 0x0D, 0x2D, 0x65, 0x65, 0x3C, 0xA9, 0xE7, 0x87, 0x07, 0xAF,
+	0xC7, 0xFD, 0x79, 0xC7, 0xC7, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0xDC, 0xDC, 0xFD, 0xDD, 0x2B, 0x0B, 0x0B, 0xC7, 0xC7, 0x39, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0xDD, 0x15, 0x0D, 0x4E, 0xDA, 0x07, 0x6F, 0x6F, 0x07, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xA8, 0xF5, 0xF5, 0xF6, 0xF4, 0xA8, 0xF5, 0xF5, 0xF5, 0xF5, 0xF3, 0x4E, 0x65, 0x3E, 0x40, 0x40, 0x0D, 0x65, 0x2D, 0xC8, 0x0D, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xDF, 0x2D, 0x2D, 0x2D, 0xA9, 0x2D, 0x2D, 0x2D, 0x2D, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0x15, 0x96, 0xDF, 0x15, 0x15, 0x15, 0xDF, 0xDF, 0x96, 0x15, 0x96, 0x15, 0xDF, 0xDF, 0xA9, 0xDF, 0x2D, 0xDF, 0xDF, 0x2D, 0xA9, 0xE9, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x15, 0x15, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0x2D, 0xA9, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x2D, 0x2D, 0x2D, 0x94, 0x0D, 0x2D, 0x2D, 0x0D, 0xDF, 0xDF, 0xDF, 0x2D, 0x0D, 0x3C, 0x6A, 0xEB, 0x0D, 0x87, 0x3E, 0xEB, 0xF3, 0xF3, 0xF5, 0xA8, 0xF3, 0x3E, 0x6A, 0xA9, 0xA9, 0xDD, 0xFD, 0xDC, 0xC7, 0xC7, 0xC7, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0x0B, 0xDC, 0xDC, 0x0B, 0xFD, 0xDC, 0x2B, 0x0B, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0x0B, 0x2B, 0x2B, 0x90, 0xB1, 0xA5, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0xDC, 0x01, 0x29, 0xF6, 0xF3, 0xF3, 0x87, 0xF4, 0x3C, 0x3C, 0x3E, 0x87, 0x3E, 0x6E, 0x3E, 0x3C, 0x3E, 0x3C, 0x3E, 0x3C, 0x6A, 0x6A, 0x40, 0x40, 0x0D, 0x3C, 0x0D, 0x3C, 0x40, 0x6A, 0xEB, 0x6A, 0x6A, 0x6A, 0x2D, 0x2D, 0x3C, 0x3C, 0x2D, 0x01, 0x07, 0xEE, 0xC3, 0xE5,
+	0xDC, 0x53, 0xFD, 0x79, 0x0B, 0x0B, 0xDC, 0x0B, 0xFD, 0x0B, 0xFD, 0xDC, 0xFD, 0xDC, 0xDC, 0x2B, 0x0B, 0x0B, 0x0B, 0xC7, 0x24, 0x24, 0x24, 0x24, 0xE4, 0x0B, 0x0B, 0x0B, 0xC2, 0x15, 0x2D, 0x4E, 0xC1, 0x6F, 0x6F, 0x6F, 0xDA, 0xC1, 0xDA, 0xF5, 0xF5, 0xC1, 0xF5, 0xF5, 0xF5, 0xF5, 0xDA, 0xC1, 0xF5, 0xC1, 0xA8, 0xF5, 0xF6, 0x65, 0x4E, 0x3E, 0x40, 0x65, 0x40, 0x40, 0x0D, 0x0D, 0x0D, 0x0D, 0x2D, 0x2D, 0x94, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xDF, 0x2D, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x96, 0x2D, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x6A, 0xDF, 0xE9, 0x15, 0x96, 0x15, 0xDF, 0xDF, 0xDF, 0xA9, 0xE9, 0xA9, 0xDF, 0xE9, 0xA9, 0xDF, 0xDF, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x15, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xA9, 0xDF, 0x2D, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0xC8, 0x2D, 0xDF, 0x2D, 0x2D, 0x0D, 0x3C, 0x0D, 0x3C, 0x3E, 0x87, 0x3E, 0xF3, 0xF3, 0xF3, 0xF4, 0xF6, 0xF6, 0x3E, 0xA9, 0xA9, 0x4D, 0x79, 0xDD, 0xDC, 0xC7, 0xC7, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0xFD, 0x0B, 0xDC, 0x0B, 0x2B, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0x2B, 0x2B, 0x39, 0x1E, 0x28, 0x28, 0x28, 0x28, 0xD9, 0x28, 0xD9, 0x1E, 0x84, 0xA8, 0xA8, 0xF6, 0xF3, 0xF3, 0x3E, 0x6E, 0x3E, 0x87, 0x3C, 0x3E, 0x3E, 0x3C, 0x3E, 0x6E, 0x3E, 0x3E, 0x3C, 0x40, 0x3C, 0x0D, 0x3C, 0x65, 0x0D, 0x40, 0x0D, 0x0D, 0x3C, 0x40, 0x6A, 0xDF, 0x6A, 0xE9, 0xA9, 0x2D, 0x2D, 0xF6, 0x8F, 0x99, 0xC4, 0x04, 0x45,
+	0xC7, 0xC7, 0xC7, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x2B, 0x0B, 0x0B, 0xC7, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x2B, 0x15, 0x0D, 0x65, 0xDA, 0xDA, 0x6F, 0x6F, 0xC1, 0xDA, 0xDA, 0xC1, 0xEA, 0xC1, 0xC1, 0xF5, 0xF5, 0xF5, 0xF5, 0xC1, 0xC1, 0x5D, 0x5D, 0xF5, 0xF3, 0xF6, 0x3E, 0x3E, 0x65, 0x40, 0x0D, 0x40, 0x0D, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x96, 0x96, 0x96, 0xE9, 0x2D, 0x2D, 0x2D, 0x2D, 0x15, 0x2D, 0x2D, 0x96, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x2D, 0x96, 0x15, 0x96, 0x15, 0x96, 0xDF, 0xE9, 0x15, 0x96, 0x15, 0xDF, 0xDF, 0xA9, 0xDF, 0x2D, 0xDF, 0xDF, 0xDF, 0xE9, 0x2D, 0x2D, 0x2D, 0x2D, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x15, 0x2D, 0x15, 0x96, 0x15, 0x2D, 0x15, 0x15, 0x2D, 0xA9, 0xDF, 0xA9, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0xE9, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xDF, 0x0D, 0x0D, 0x0D, 0x6A, 0x87, 0xF3, 0xF3, 0xF3, 0xF3, 0xF5, 0xF6, 0xF3, 0x87, 0xA9, 0x4D, 0xDD, 0xFD, 0x79, 0xC7, 0xC7, 0x0B, 0x0B, 0xDC, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0xFD, 0x0B, 0x0B, 0x0B, 0xDC, 0x2B, 0x2B, 0x0B, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x2B, 0x2B, 0xB1, 0x1E, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB3, 0xA5, 0x90, 0x6E, 0x29, 0x5D, 0xF4, 0x65, 0xF4, 0x3E, 0x3E, 0xF3, 0x87, 0x3C, 0x3E, 0x6E, 0x3E, 0x3C, 0x3E, 0x3E, 0x3C, 0x40, 0x40, 0x3E, 0x0D, 0x3C, 0x40, 0x3C, 0x0D, 0x3C, 0x0D, 0x6A, 0xE9, 0x6A, 0xE9, 0xDF, 0x2D, 0xA9, 0x6E, 0x8F, 0x4C, 0xB2, 0xB4, 0xBD, 0xBD,
+	0xC7, 0xFD, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x15, 0x0D, 0x65, 0xDA, 0xDA, 0x6F, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xC1, 0xF5, 0xF5, 0xF3, 0xF3, 0xF5, 0xC1, 0xC1, 0xC1, 0xA8, 0x5D, 0xF5, 0xF5, 0xF3, 0x65, 0x3E, 0x3E, 0x65, 0x40, 0x65, 0x2D, 0x0D, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xE9, 0x15, 0x96, 0x96, 0x2D, 0x2D, 0x2D, 0x2D, 0x15, 0x2D, 0x2D, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0x15, 0x96, 0x2D, 0x2D, 0x15, 0x15, 0x96, 0x15, 0xDF, 0x15, 0x96, 0x15, 0x15, 0x15, 0x96, 0xA9, 0x15, 0x15, 0x15, 0x96, 0x15, 0x15, 0x6A, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x2D, 0x15, 0x96, 0x15, 0x15, 0x15, 0xDF, 0x15, 0x15, 0x2D, 0x2D, 0xDF, 0xE9, 0xA9, 0xDF, 0xDF, 0x2D, 0x2D, 0xDF, 0x2D, 0x2D, 0x94, 0x2D, 0x2D, 0x94, 0x2D, 0x0D, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0xDF, 0xE9, 0x6A, 0x3C, 0x40, 0x0D, 0x87, 0xF3, 0xEA, 0xF3, 0xF3, 0xF5, 0xA8, 0xF5, 0x3E, 0x4D, 0x4D, 0x4D, 0xFD, 0x53, 0xC7, 0xC7, 0xC7, 0xC7, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0x0B, 0x2B, 0x0B, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0xFD, 0xDC, 0x2B, 0x2B, 0x39, 0x1E, 0xA5, 0x28, 0x28, 0x28, 0x28, 0x28, 0xD9, 0xD2, 0x2B, 0xA8, 0x5D, 0x01, 0x5D, 0x65, 0x3E, 0x87, 0xF3, 0x87, 0x87, 0x3E, 0x3C, 0x3E, 0x3C, 0x3E, 0x87, 0x3E, 0x3E, 0x3C, 0x3E, 0x3C, 0x0D, 0x0D, 0x0D, 0x65, 0x40, 0x0D, 0x2D, 0x6A, 0x96, 0xDF, 0xDF, 0xDF, 0xEA, 0x02, 0x72, 0x14, 0x14, 0x68, 0x04, 0x9F,
+	0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xFD, 0x2B, 0xC2, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x2B, 0xC2, 0x15, 0x94, 0x4E, 0x16, 0x6F, 0x6F, 0x6F, 0x16, 0xDA, 0xC1, 0xC1, 0xC1, 0x4E, 0x8E, 0xC1, 0xF5, 0xC1, 0xF5, 0xF5, 0xF5, 0x5D, 0x16, 0xF5, 0xF3, 0x4E, 0x65, 0x3E, 0x40, 0x40, 0x0D, 0x0D, 0x2D, 0xC8, 0x2D, 0x2D, 0x2D, 0xC8, 0x2D, 0x94, 0xC8, 0x15, 0xE9, 0x15, 0x96, 0x96, 0x15, 0xE9, 0xE9, 0xE9, 0xC8, 0xC8, 0x15, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x96, 0x4D, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x96, 0x96, 0x96, 0x15, 0x96, 0x96, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0xDF, 0x2D, 0x2D, 0x15, 0xDF, 0x2D, 0x2D, 0x2D, 0x15, 0x96, 0x15, 0x4D, 0x15, 0x96, 0xDF, 0x0D, 0x2D, 0xDF, 0xDF, 0xDF, 0x15, 0x15, 0x96, 0x2D, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x2D, 0x2D, 0xDF, 0x2D, 0x0D, 0x2D, 0x2D, 0xDF, 0x6A, 0x0D, 0x40, 0x6A, 0x3E, 0xF3, 0x3E, 0xEB, 0xF3, 0xF3, 0xEA, 0xF3, 0xF3, 0x6A, 0x54, 0x79, 0x4D, 0xFD, 0x79, 0xDC, 0xC7, 0xC7, 0x24, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x90, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x2B, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xFD, 0xDC, 0xDC, 0xDC, 0x2B, 0x84, 0x80, 0xA5, 0x28, 0x28, 0xD9, 0x28, 0xB3, 0xD9, 0xA5, 0xB1, 0x6E, 0xA8, 0x5D, 0xA8, 0x6E, 0xF4, 0xF3, 0x3C, 0x3E, 0xE7, 0x3E, 0x3C, 0x3E, 0x3C, 0x3E, 0x3C, 0x3C, 0x65, 0x3C, 0x0D, 0x40, 0x3C, 0x65, 0x3C, 0x3C, 0x2D, 0x2D, 0x2D, 0x2D, 0xDF, 0x4D, 0x4D, 0x42, 0x6B, 0x9E, 0xC4, 0x97, 0xB4, 0x68, 0x04, 0x04,
+	0xFD, 0x0B, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0x0B, 0x2B, 0x0B, 0x0B, 0x0B, 0x2B, 0x2B, 0x0B, 0x0B, 0x0B, 0x24, 0xC7, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x15, 0x2D, 0x65, 0x16, 0x6F, 0x6F, 0xBB, 0x16, 0x16, 0xC1, 0xC1, 0xC1, 0xC1, 0xF5, 0xF5, 0xC1, 0xF5, 0xF5, 0xF5, 0xF5, 0x5D, 0x5D, 0xF5, 0xF6, 0x65, 0xF3, 0x65, 0x65, 0x65, 0x0D, 0x40, 0x65, 0x2D, 0x0D, 0x0D, 0x2D, 0x94, 0x15, 0xC8, 0x15, 0x96, 0x96, 0x96, 0x96, 0x15, 0x96, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x96, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0x15, 0x96, 0x96, 0x15, 0x15, 0x15, 0x15, 0x96, 0x96, 0x15, 0x15, 0x96, 0x15, 0x96, 0x96, 0x96, 0x2D, 0xDF, 0x96, 0x2D, 0x2D, 0x2D, 0x0D, 0x15, 0x15, 0x96, 0x15, 0x15, 0x15, 0x15, 0x15, 0x96, 0x2D, 0xDF, 0xE9, 0x96, 0x15, 0x15, 0x2D, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x94, 0x2D, 0x2D, 0x2D, 0xE9, 0x2D, 0x2D, 0x2D, 0xDF, 0xDF, 0x2D, 0x40, 0x6A, 0xEB, 0x87, 0x3E, 0x3E, 0xEB, 0xF3, 0xF3, 0xF6, 0xA8, 0xF3, 0x3E, 0xDF, 0x4D, 0x79, 0xFD, 0x53, 0xFD, 0xC7, 0x90, 0xC7, 0x0B, 0x0B, 0xDC, 0x0B, 0xC7, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0x0B, 0x0B, 0xFD, 0xDC, 0xFD, 0xDC, 0xDD, 0xFD, 0xDC, 0xDC, 0x2B, 0x2B, 0xC7, 0x1E, 0xA5, 0xD9, 0x28, 0x28, 0x28, 0xB3, 0x28, 0xA5, 0x79, 0x01, 0x5D, 0xA8, 0x65, 0xF6, 0x87, 0xF3, 0x3C, 0x87, 0x3E, 0x3C, 0x3E, 0x3C, 0x0D, 0x65, 0x3C, 0x3E, 0x0D, 0x3C, 0x40, 0x6A, 0xDF, 0x6A, 0x3C, 0x2D, 0x2D, 0xDF, 0xA9, 0xDF, 0xDF, 0x41, 0x52, 0x9A, 0x81, 0xBD, 0x45, 0xBD, 0xE6, 0xB6, 0xB5,
+	0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0x08, 0x2D, 0x65, 0x16, 0x29, 0x6F, 0x16, 0x16, 0xDA, 0xC1, 0xC1, 0x8E, 0xC1, 0xF5, 0xC1, 0xF5, 0xC1, 0xC1, 0x16, 0xF5, 0x5D, 0x5D, 0xF5, 0x4E, 0x4E, 0x65, 0x3E, 0x65, 0x65, 0x65, 0x0D, 0x65, 0x0D, 0x94, 0x2D, 0x0D, 0x2D, 0xC8, 0x15, 0x96, 0x96, 0x2D, 0xC8, 0x15, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xE9, 0x15, 0x96, 0x15, 0xE9, 0x15, 0x96, 0x15, 0x96, 0x96, 0x96, 0xE9, 0xC8, 0x15, 0x96, 0x96, 0x96, 0x15, 0x96, 0x15, 0x96, 0x96, 0xE9, 0x15, 0xE9, 0xE9, 0x96, 0x15, 0x96, 0x96, 0xDF, 0x2D, 0x2D, 0x15, 0x15, 0x96, 0x2D, 0x2D, 0x2D, 0x2D, 0x96, 0x15, 0x96, 0x15, 0x15, 0x96, 0x15, 0x15, 0xDF, 0xDF, 0xDF, 0x96, 0x96, 0x96, 0x2D, 0x0D, 0x2D, 0x2D, 0x94, 0x2D, 0x94, 0x2D, 0x0D, 0x2D, 0x0D, 0x0D, 0x2D, 0x0D, 0x0D, 0x0D, 0x2D, 0xE9, 0x6A, 0x3C, 0x6A, 0x6A, 0x6A, 0x3E, 0x3E, 0xF3, 0xF3, 0xEA, 0xA8, 0xC1, 0xF5, 0x3E, 0xDF, 0xA9, 0x06, 0x71, 0x53, 0xC7, 0xC7, 0x24, 0xC7, 0xC7, 0x0B, 0x39, 0x0B, 0x0B, 0xC7, 0x24, 0x90, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0xFD, 0x0B, 0xFD, 0x0B, 0xDD, 0xFD, 0xDD, 0xFD, 0xDC, 0xDC, 0xFD, 0xDC, 0xDC, 0x2B, 0x2B, 0xC7, 0xA5, 0x28, 0x28, 0xD9, 0x28, 0x28, 0xB3, 0x28, 0xB1, 0x6E, 0xA8, 0x5D, 0x01, 0x5D, 0x01, 0xF3, 0x87, 0x3E, 0x3E, 0x87, 0x3E, 0x3C, 0x3C, 0x40, 0x0D, 0x87, 0x3C, 0x40, 0xE7, 0x6A, 0x3C, 0x6A, 0x6A, 0x15, 0x2D, 0xA9, 0x4D, 0x4D, 0xF4, 0x52, 0xFE, 0x81, 0x86, 0xBD, 0xBD, 0xBD, 0xB4, 0xB5, 0xB2,
+	0x0B, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xFD, 0xDC, 0x0B, 0x0B, 0xC7, 0x24, 0x24, 0x0B, 0x24, 0xC7, 0xC7, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x2D, 0x65, 0x16, 0x29, 0xBB, 0x6F, 0x16, 0xDA, 0xC1, 0x8E, 0x8E, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xF5, 0x16, 0xC1, 0x5D, 0x5D, 0x4E, 0x3E, 0x4E, 0x4E, 0x65, 0x65, 0x94, 0x65, 0x0D, 0x65, 0x0D, 0x94, 0x2D, 0x0D, 0xC8, 0x2D, 0xC8, 0x15, 0xC8, 0x15, 0xC8, 0x15, 0xC8, 0x15, 0xC8, 0x15, 0xC8, 0x15, 0xC8, 0x15, 0xE9, 0x96, 0x96, 0x96, 0xE9, 0x15, 0x96, 0x15, 0x96, 0x2D, 0x15, 0xC8, 0xC8, 0x15, 0x96, 0x96, 0xDF, 0x96, 0x96, 0x15, 0xE9, 0x15, 0xC8, 0x15, 0xC8, 0x15, 0xC8, 0x15, 0x2D, 0x2D, 0x0D, 0x2D, 0xE9, 0x96, 0x2D, 0x2D, 0x0D, 0x2D, 0x2D, 0x15, 0x15, 0x96, 0x15, 0x96, 0x15, 0xDF, 0x2D, 0x6A, 0xE9, 0xDF, 0x96, 0x15, 0x96, 0x2D, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0x0D, 0x2D, 0xC8, 0x2D, 0x0D, 0x2D, 0x6A, 0x0D, 0x40, 0x40, 0x6A, 0x6A, 0x3E, 0xF3, 0xF3, 0xEA, 0xF3, 0xA8, 0xF5, 0x3E, 0x6A, 0xDF, 0x79, 0xFD, 0xBF, 0xC7, 0xC7, 0xC0, 0xDB, 0xC7, 0x90, 0x0B, 0xC7, 0x0B, 0x90, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0x0B, 0x0B, 0xFD, 0xDC, 0xDC, 0xDC, 0xDC, 0xFD, 0xC2, 0xDC, 0xC2, 0xDC, 0x2B, 0x84, 0x2B, 0x1E, 0xA5, 0xD9, 0x28, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x90, 0x01, 0x5D, 0xA8, 0x65, 0xF3, 0xF3, 0x3C, 0x3E, 0x3C, 0x3E, 0x3C, 0x3E, 0x3E, 0x3C, 0x3E, 0x3E, 0x3C, 0x0D, 0x3C, 0x6A, 0xE7, 0xA9, 0xDF, 0x4D, 0xDF, 0x4D, 0x4D, 0xF4, 0xD7, 0xFE, 0x73, 0x45, 0xBD, 0xC9, 0xBD, 0x04, 0xB4, 0xB5, 0xB5,
+	0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0xDC, 0x0B, 0xC7, 0xC7, 0x24, 0x24, 0xC7, 0xC7, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0xC2, 0x2B, 0x15, 0x94, 0x65, 0x29, 0xBB, 0x02, 0x6F, 0x16, 0x16, 0xC1, 0xC1, 0xC1, 0xC1, 0x4E, 0x5D, 0x4E, 0xF5, 0xF5, 0xF5, 0xC1, 0x5D, 0x5D, 0x8E, 0x4E, 0x3E, 0x4E, 0x65, 0x65, 0x65, 0x0D, 0x65, 0x0D, 0x2D, 0x2D, 0x0D, 0x2D, 0x2D, 0xC8, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xC8, 0x15, 0xE9, 0x15, 0xE9, 0x96, 0x96, 0x15, 0x96, 0x96, 0xC8, 0x15, 0xC8, 0x15, 0xE9, 0x15, 0x15, 0x96, 0x15, 0x96, 0x96, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x2D, 0x94, 0x0D, 0x0D, 0x2D, 0xC8, 0x15, 0x0D, 0x0D, 0xC8, 0x2D, 0x0D, 0x0D, 0xDF, 0xDF, 0x2D, 0xDF, 0xA9, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xE9, 0x96, 0xDF, 0x2D, 0x2D, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0x0D, 0x2D, 0x2D, 0x6A, 0x0D, 0x40, 0x6A, 0xEB, 0x40, 0x3E, 0xEA, 0xF3, 0xF3, 0xF3, 0xF6, 0xF5, 0x3E, 0x6A, 0xDF, 0x4D, 0x06, 0x06, 0xBF, 0xC7, 0xC7, 0xDB, 0x0B, 0x24, 0xC7, 0xC7, 0xC7, 0x0B, 0x24, 0xC7, 0xC7, 0x53, 0x0B, 0x0B, 0xDC, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0xFD, 0xDC, 0xFD, 0xDD, 0xFD, 0xDD, 0xDC, 0xC2, 0xFD, 0xDC, 0xFD, 0x2B, 0x2B, 0x2B, 0xC0, 0x1E, 0x28, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x1E, 0x84, 0xA8, 0xA8, 0x01, 0x5D, 0x3C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x0D, 0x3E, 0x6E, 0x3E, 0x3E, 0x3C, 0x3E, 0x0D, 0x3C, 0x6A, 0xE7, 0x2D, 0xDF, 0x54, 0x4D, 0x42, 0x52, 0x9E, 0x73, 0xBD, 0xBD, 0xBD, 0x04, 0x04, 0x45, 0x3F, 0x14, 0x14,
+	0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0xC7, 0xC7, 0xC7, 0x24, 0x24, 0xC7, 0x24, 0xDC, 0x24, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x15, 0x94, 0x65, 0x29, 0xBB, 0x02, 0xBB, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xF5, 0xF5, 0xF5, 0xC1, 0x5D, 0x5D, 0x4E, 0x3E, 0x8E, 0x3E, 0x65, 0x65, 0x94, 0x40, 0x0D, 0x94, 0x94, 0x2D, 0x2D, 0x2D, 0x2D, 0x94, 0x2D, 0x94, 0x2D, 0x2D, 0x94, 0x2D, 0x2D, 0x94, 0x2D, 0x2D, 0xC8, 0x2D, 0x2D, 0x94, 0x15, 0xC8, 0xC8, 0x15, 0xC8, 0x15, 0x96, 0x15, 0x96, 0x15, 0xC8, 0xC8, 0x15, 0x96, 0x96, 0x15, 0x96, 0x15, 0x15, 0xE9, 0xC8, 0x94, 0x2D, 0x94, 0x94, 0x2D, 0x0D, 0x2D, 0x2D, 0xC8, 0x0D, 0x2D, 0x94, 0x2D, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x0D, 0xC8, 0x2D, 0x2D, 0x2D, 0xDF, 0xDF, 0x2D, 0xDF, 0x96, 0x15, 0x96, 0x2D, 0x0D, 0x0D, 0x2D, 0x94, 0x2D, 0x0D, 0x0D, 0x2D, 0x0D, 0x0D, 0xC8, 0x2D, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x0D, 0x2D, 0xC8, 0x6A, 0x6A, 0x40, 0x40, 0x6A, 0x3E, 0xF3, 0xF3, 0xF3, 0xF5, 0xA8, 0xF3, 0x3E, 0x6A, 0x54, 0x4D, 0xFD, 0xBF, 0xC0, 0xBF, 0xDB, 0xC7, 0xC7, 0xC0, 0xC7, 0xC7, 0xC7, 0xC7, 0xDC, 0xC7, 0x0B, 0xC7, 0x0B, 0x0B, 0x0B, 0xDC, 0xDC, 0xDC, 0x0B, 0x0B, 0x0B, 0xDD, 0xDC, 0x0B, 0xDC, 0xFD, 0xDC, 0xFD, 0xFD, 0xDC, 0xDD, 0xFD, 0x2B, 0x2B, 0x2B, 0xB1, 0xA5, 0x28, 0x28, 0x28, 0xD9, 0x28, 0xD9, 0x28, 0xB1, 0x01, 0x5D, 0x5D, 0xA8, 0x3C, 0xF6, 0x3C, 0x40, 0x3C, 0x40, 0x6A, 0x3C, 0x3E, 0x3C, 0x3E, 0x3C, 0x3E, 0x3C, 0x0D, 0x6A, 0xA9, 0x4D, 0x54, 0xF8, 0xEA, 0xED, 0xC4, 0x14, 0xCD, 0x83, 0x83, 0x04, 0x83, 0x83, 0x45, 0x73, 0x73, 0xB4,
+	0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC7, 0xC7, 0xDB, 0x24, 0x24, 0x24, 0x0B, 0x90, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x4E, 0x29, 0x02, 0xBB, 0xBB, 0x16, 0x16, 0xDA, 0xC1, 0x4E, 0xC1, 0x4E, 0xF5, 0xF5, 0xC1, 0xC1, 0xC1, 0xF5, 0x5D, 0x4E, 0xF5, 0x4E, 0x4E, 0x4E, 0x65, 0x65, 0x65, 0x0D, 0x3C, 0x94, 0x2D, 0x65, 0x2D, 0x2D, 0x94, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0x2D, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xC8, 0x2D, 0x15, 0xC8, 0xC8, 0xC8, 0xC8, 0x15, 0x96, 0xC8, 0xC8, 0xC8, 0x15, 0xC8, 0x15, 0x96, 0x15, 0x96, 0x15, 0x96, 0x15, 0xC8, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xC8, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0x0D, 0x2D, 0x0D, 0x2D, 0xDF, 0xDF, 0x2D, 0xDF, 0xDF, 0x96, 0xE9, 0x96, 0x96, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x0D, 0x0D, 0x2D, 0x2D, 0x0D, 0x2D, 0x6A, 0x40, 0x40, 0x40, 0x3E, 0x3E, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x3E, 0x6A, 0xDF, 0x4D, 0x06, 0x06, 0xBF, 0xC0, 0xC7, 0xDB, 0xC7, 0xC7, 0xC7, 0xC7, 0xDC, 0xC7, 0xC7, 0xC7, 0xC7, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0xFD, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xFD, 0x79, 0xFD, 0xFD, 0xFD, 0xDD, 0xC2, 0x2B, 0x84, 0x90, 0x1E, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB3, 0xD9, 0x28, 0x2B, 0x01, 0xA8, 0x5D, 0xF3, 0x3E, 0x3E, 0x3E, 0x0D, 0x3C, 0x0D, 0x40, 0x3C, 0x3E, 0x3C, 0x3E, 0x3C, 0x0D, 0x3C, 0x6A, 0xA9, 0xDF, 0xDF, 0xEA, 0x52, 0x72, 0x3A, 0x73, 0x68, 0xFB, 0x83, 0x97, 0x83, 0x45, 0x73, 0x86, 0xCD, 0xCD,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC7, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0xC2, 0x08, 0x94, 0x65, 0x16, 0x6F, 0x02, 0x6F, 0xC1, 0x29, 0x16, 0xC1, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xC1, 0xF5, 0xC1, 0x5D, 0x5D, 0xF5, 0x5D, 0x8E, 0x3E, 0x65, 0x0D, 0x65, 0x65, 0x0D, 0x0D, 0x94, 0x3C, 0xC8, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x2D, 0x94, 0x2D, 0x0D, 0x2D, 0x2D, 0x94, 0x2D, 0xC8, 0x15, 0x08, 0xE9, 0x15, 0xC8, 0x15, 0x15, 0x96, 0xC8, 0xC8, 0x15, 0xC8, 0xC8, 0x15, 0x96, 0x96, 0x15, 0x96, 0x96, 0x15, 0xC8, 0x2D, 0xC8, 0xC8, 0x94, 0x94, 0x94, 0x94, 0x2D, 0x0D, 0xC8, 0x2D, 0xC8, 0x0D, 0x2D, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x2D, 0x2D, 0xDF, 0xDF, 0xE9, 0xDF, 0xDF, 0x2D, 0xDF, 0x15, 0x15, 0xDF, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0x2D, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x0D, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0x2D, 0xDF, 0x40, 0x65, 0x40, 0x40, 0x40, 0x3E, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xEB, 0xF8, 0xDF, 0x4D, 0x71, 0xBF, 0x53, 0xBF, 0xC0, 0xC7, 0xC7, 0x53, 0xDC, 0xC7, 0xC7, 0xC7, 0xDC, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0xDC, 0xC7, 0x53, 0xFD, 0xC7, 0xDD, 0xC2, 0xFD, 0xDD, 0x15, 0xDD, 0x2B, 0x2B, 0xB1, 0xA5, 0x28, 0x28, 0x28, 0x28, 0xD9, 0xD9, 0xB3, 0x59, 0x01, 0x5D, 0x6E, 0x5D, 0x87, 0x3E, 0x3E, 0x3E, 0x3C, 0x40, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x0D, 0x3C, 0x6A, 0xE7, 0xDF, 0x85, 0xEB, 0xEE, 0x09, 0xC3, 0x86, 0x81, 0xBD, 0x68, 0xB6, 0xB6, 0xB4, 0xB4, 0x73, 0x73, 0x86, 0x10,
+	0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC7, 0xC7, 0x0B, 0x90, 0x24, 0x24, 0x24, 0x24, 0xC7, 0x24, 0x24, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x65, 0x29, 0x6F, 0x6F, 0x29, 0x16, 0x16, 0x16, 0x16, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0x5D, 0x16, 0x5D, 0x5D, 0x5D, 0x5D, 0xF5, 0x3E, 0x4E, 0x65, 0x40, 0x65, 0x65, 0x40, 0x0D, 0x65, 0x0D, 0x2D, 0x0D, 0x0D, 0x0D, 0xC8, 0xC8, 0x2D, 0xC8, 0x2D, 0x2D, 0x0D, 0xC8, 0x0D, 0x2D, 0x2D, 0x08, 0xC8, 0x15, 0xC8, 0xC8, 0xC8, 0x15, 0xC8, 0xE9, 0x15, 0xC8, 0x15, 0xE9, 0x08, 0xE9, 0xC8, 0xE9, 0x96, 0x15, 0x15, 0x15, 0xDF, 0x0D, 0xC8, 0xC8, 0xC8, 0x2D, 0x94, 0x94, 0x2D, 0x94, 0x94, 0x94, 0x2D, 0x0D, 0x2D, 0x0D, 0x0D, 0xC8, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0xE9, 0xDF, 0xDF, 0xC8, 0x2D, 0xDF, 0xDF, 0xDF, 0x2D, 0xDF, 0xC8, 0x2D, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0xC8, 0x0D, 0xC8, 0x2D, 0x0D, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0x94, 0x2D, 0x0D, 0x0D, 0x0D, 0x0D, 0x40, 0x65, 0x3E, 0x3E, 0xF5, 0xF3, 0xF5, 0xF5, 0xF3, 0x3E, 0x6A, 0xF8, 0x4D, 0x4D, 0x06, 0xFD, 0xC0, 0xBF, 0xC7, 0xBF, 0xDB, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0xFD, 0x0B, 0xDC, 0xDC, 0xDC, 0xC7, 0xBF, 0xDC, 0xDC, 0xFD, 0xDC, 0xDD, 0xDD, 0xA9, 0x15, 0x2B, 0x80, 0xA5, 0x28, 0x28, 0x28, 0xD9, 0xD9, 0xB3, 0x28, 0x39, 0x6E, 0x5D, 0xF6, 0xF3, 0x3E, 0x87, 0x3E, 0x3E, 0x3E, 0x6E, 0x3E, 0x3C, 0x0D, 0x0D, 0x2D, 0x6A, 0xDF, 0xDF, 0xF8, 0xEB, 0x8D, 0xCD, 0x45, 0x81, 0x86, 0xBD, 0x81, 0xE6, 0x68, 0xB4, 0x73, 0x73, 0x73, 0x86, 0xBD, 0x9E,
+	0x0B, 0x0B, 0x0B, 0x0B, 0xC7, 0xC7, 0xC7, 0xDC, 0xC7, 0xC7, 0xC7, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0x0B, 0x0B, 0x24, 0xC2, 0xC2, 0xC2, 0x94, 0x4E, 0x5D, 0x6F, 0x6F, 0x16, 0x16, 0x29, 0xDA, 0xA8, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0x5D, 0xA8, 0x5D, 0x5D, 0x5D, 0x4E, 0xF5, 0x4E, 0x65, 0x4E, 0x40, 0x65, 0x65, 0x40, 0x0D, 0x65, 0x0D, 0x0D, 0xC8, 0x2D, 0x2D, 0x2D, 0x2D, 0xC8, 0x2D, 0xC8, 0xC8, 0x2D, 0x0D, 0x2D, 0x94, 0xC8, 0xC8, 0xC8, 0x08, 0xC8, 0xC8, 0xC8, 0x2D, 0x2D, 0x2D, 0xDF, 0x96, 0x96, 0x96, 0xE9, 0x96, 0x6A, 0xE9, 0xDF, 0x96, 0x15, 0x96, 0x0D, 0x2D, 0xC8, 0x0D, 0x0D, 0xC8, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x2D, 0xC8, 0x2D, 0x0D, 0x2D, 0x65, 0x65, 0x65, 0x65, 0x0D, 0x0D, 0x2D, 0x15, 0x96, 0x96, 0x2D, 0x0D, 0x2D, 0xA9, 0xDF, 0xDF, 0x2D, 0xDF, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x0D, 0x2D, 0x0D, 0xC8, 0x0D, 0xC8, 0x2D, 0x0D, 0x2D, 0x94, 0x2D, 0x2D, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0x40, 0x40, 0x3E, 0x3E, 0x3E, 0xEA, 0x3E, 0xC1, 0xEA, 0x40, 0xF8, 0x4D, 0x4D, 0x4D, 0x71, 0xFD, 0xBF, 0xDC, 0xC7, 0xC7, 0xBF, 0x90, 0xDC, 0xC0, 0xC7, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0x0B, 0x53, 0xDC, 0x0B, 0xFD, 0x0B, 0x0B, 0x0B, 0x0B, 0xBF, 0xC7, 0x0B, 0xDC, 0xDD, 0xDC, 0xFD, 0xDD, 0xFD, 0xC2, 0x2B, 0xC2, 0x24, 0xA5, 0x28, 0x28, 0x28, 0x28, 0xB3, 0xD9, 0xB3, 0xA5, 0x9C, 0xF4, 0x5D, 0xF4, 0xF3, 0xF3, 0x3E, 0x6E, 0x3E, 0x3C, 0x0D, 0x65, 0x65, 0x2D, 0x2D, 0xDF, 0x4D, 0x54, 0x41, 0xD7, 0x73, 0x81, 0xF9, 0x83, 0x45, 0xBD, 0xCD, 0x9F, 0x3F, 0x3F, 0x10, 0x73, 0x3F, 0x73, 0x86, 0xBD,
+	0xC7, 0x0B, 0x0B, 0xDC, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x90, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x15, 0x94, 0x65, 0x29, 0x02, 0x02, 0x6F, 0x16, 0x16, 0xC1, 0xF5, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0xC1, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0xF5, 0x4E, 0x3E, 0x3E, 0x65, 0x65, 0x65, 0x0D, 0x65, 0x65, 0x0D, 0x2D, 0x65, 0x0D, 0x2D, 0x2D, 0x94, 0x0D, 0x2D, 0xC8, 0x2D, 0x0D, 0x94, 0x0D, 0xC8, 0x2D, 0xC8, 0xC8, 0xC8, 0xC8, 0x15, 0xC8, 0x0D, 0xC8, 0x0D, 0x2D, 0x96, 0x15, 0x96, 0x96, 0x96, 0x0D, 0x2D, 0x6A, 0x96, 0x96, 0x96, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x94, 0x94, 0x0D, 0x0D, 0xC8, 0x15, 0x94, 0x94, 0x94, 0x0D, 0xC8, 0x0D, 0xC8, 0x2D, 0x0D, 0x2D, 0x2D, 0xDF, 0x2D, 0xDF, 0x2D, 0xDF, 0xDF, 0xDF, 0x2D, 0xDF, 0xDF, 0x2D, 0xDF, 0x2D, 0x2D, 0x2D, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0x0D, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0x0D, 0x0D, 0x0D, 0x65, 0x40, 0x40, 0x3E, 0x3E, 0x3E, 0xC1, 0xF5, 0xEA, 0x3E, 0x6A, 0xF8, 0x96, 0x4D, 0x06, 0xFD, 0xFD, 0x53, 0x53, 0xFD, 0xC0, 0xC7, 0xC7, 0xC7, 0xC7, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0xC7, 0xFD, 0xDC, 0xFD, 0xDC, 0xDD, 0xFD, 0xDD, 0x15, 0xC2, 0x2B, 0x2B, 0xB1, 0xA5, 0x28, 0x28, 0xD9, 0xD9, 0xB3, 0xB3, 0xD9, 0x7F, 0x6E, 0x29, 0xA8, 0xF6, 0xF3, 0xF6, 0x3E, 0x3E, 0x3C, 0x40, 0x3C, 0x2D, 0x2D, 0x2D, 0xDF, 0xF8, 0x41, 0x5A, 0x09, 0xE5, 0x83, 0x83, 0x81, 0xBD, 0xBD, 0x10, 0x9F, 0xCD, 0xBD, 0x3F, 0x3F, 0x73, 0x3F, 0x3F, 0x73,
+	0xC7, 0xC7, 0x0B, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0x94, 0x94, 0x5D, 0x29, 0x02, 0x02, 0x6F, 0x6F, 0x16, 0xC1, 0xA8, 0xC1, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0xC1, 0xC1, 0x5D, 0x16, 0x4E, 0x5D, 0x5D, 0x65, 0x65, 0x3E, 0x65, 0x94, 0x65, 0x40, 0x65, 0x0D, 0x0D, 0x0D, 0x65, 0x2D, 0x94, 0x2D, 0x2D, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0xC8, 0x0D, 0x0D, 0xC8, 0x2D, 0xC8, 0xC8, 0xC8, 0x15, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0x2D, 0xE9, 0x96, 0x15, 0x96, 0xC8, 0xC8, 0x2D, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x94, 0x94, 0x94, 0x94, 0xC8, 0x94, 0x94, 0x0D, 0xC8, 0x0D, 0xC8, 0x94, 0x8E, 0x65, 0x65, 0x65, 0xC8, 0x0D, 0x0D, 0x40, 0x2D, 0xDF, 0xDF, 0xE9, 0xA9, 0xDF, 0xDF, 0xE9, 0x0D, 0x0D, 0xC8, 0x0D, 0x2D, 0x2D, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0xC8, 0x2D, 0x0D, 0x2D, 0xC8, 0x2D, 0x0D, 0x2D, 0xC8, 0x0D, 0xC8, 0x0D, 0x40, 0x40, 0x65, 0x40, 0x94, 0xEA, 0xEA, 0x3E, 0xF5, 0xEA, 0x3E, 0x40, 0x96, 0x4D, 0x4D, 0x71, 0x06, 0xFD, 0xFD, 0xFD, 0x53, 0x0B, 0x79, 0xDC, 0x53, 0xDC, 0x0B, 0xDC, 0xDC, 0x0B, 0xDC, 0xC7, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0xDC, 0xDC, 0xDC, 0xC2, 0xFD, 0xDD, 0xFD, 0x2B, 0x15, 0x2B, 0x2D, 0x0B, 0xA5, 0x28, 0x28, 0x28, 0xD9, 0xB3, 0xB3, 0xB3, 0xD9, 0x66, 0x5D, 0xA8, 0x5D, 0x65, 0xF4, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x6A, 0xA9, 0xDF, 0x85, 0x41, 0x6B, 0xFE, 0xC3, 0x81, 0x81, 0x45, 0xBD, 0xBD, 0xCD, 0x9F, 0x10, 0x9F, 0x3F, 0x3F, 0x73, 0x73, 0x73, 0x73, 0x81,
+	0xC7, 0xC7, 0x0B, 0x0B, 0x0B, 0x90, 0xC7, 0x0B, 0xC7, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x15, 0x94, 0x8E, 0x29, 0x02, 0xBB, 0xBB, 0x16, 0x29, 0xDA, 0x5D, 0x5D, 0x5D, 0x5D, 0x16, 0x5D, 0x5D, 0xC1, 0x4E, 0x5D, 0x5D, 0x5D, 0x16, 0x5D, 0x4E, 0x3E, 0x65, 0x65, 0x40, 0x40, 0x65, 0x94, 0x65, 0x3C, 0x0D, 0xC8, 0x0D, 0x94, 0x0D, 0xC8, 0x0D, 0x0D, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x0D, 0x2D, 0xC8, 0x08, 0xC8, 0xC8, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x15, 0xE9, 0x96, 0xC8, 0xC8, 0x2D, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x0D, 0x0D, 0x2D, 0x65, 0x94, 0x65, 0xC8, 0x0D, 0x94, 0x40, 0x40, 0x0D, 0x0D, 0x40, 0x0D, 0x40, 0x3C, 0x0D, 0x6A, 0xE9, 0xDF, 0xDF, 0x2D, 0xDF, 0x2D, 0xDF, 0xE9, 0x6A, 0x2D, 0x0D, 0x0D, 0x2D, 0x2D, 0xDF, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0xC8, 0x0D, 0x0D, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0x0D, 0xC8, 0x3E, 0x0D, 0x3E, 0x40, 0x8E, 0x40, 0x3E, 0xEA, 0x8E, 0xEA, 0x3E, 0x40, 0x6A, 0x96, 0x4D, 0x4D, 0x71, 0x06, 0x79, 0xFD, 0xFD, 0x53, 0xFD, 0xC0, 0xC7, 0x53, 0xDC, 0x0B, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0x0B, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0xFD, 0xDC, 0xFD, 0xDC, 0xFD, 0xDD, 0xDD, 0xC2, 0x4D, 0x2B, 0x15, 0x2B, 0x2B, 0x2B, 0xB1, 0x28, 0x28, 0x28, 0x28, 0xD9, 0xB3, 0xD9, 0xB3, 0x1E, 0x6E, 0xA8, 0x5D, 0xF4, 0xF6, 0x65, 0xF4, 0x3E, 0x3E, 0x3C, 0x3E, 0x85, 0x54, 0x41, 0x52, 0xFE, 0xE5, 0x86, 0x81, 0x81, 0xBD, 0x68, 0x3F, 0x10, 0x10, 0x9F, 0xCD, 0x3F, 0x3F, 0xB4, 0x3F, 0x73, 0x81, 0x82,
+	0xC7, 0xC7, 0xC7, 0xDC, 0x0B, 0x0B, 0x0B, 0x0B, 0x39, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xDC, 0x0B, 0x0B, 0x24, 0x0B, 0xC2, 0xC2, 0x08, 0x94, 0x8E, 0x16, 0x02, 0x02, 0x6F, 0x6F, 0x16, 0xC1, 0xC1, 0xC1, 0xC1, 0x5D, 0x5D, 0x5D, 0xC1, 0xC1, 0xC1, 0x16, 0x4E, 0x5D, 0x5D, 0x4E, 0x4E, 0x4E, 0x65, 0x65, 0x40, 0x40, 0x40, 0x65, 0x65, 0xC8, 0x40, 0x0D, 0x94, 0x94, 0x0D, 0x2D, 0xC8, 0x2D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0xC8, 0xC8, 0xC8, 0xE9, 0x2D, 0xC8, 0x2D, 0x2D, 0x94, 0x2D, 0x0D, 0xC8, 0xC8, 0xC8, 0x15, 0xC8, 0xC8, 0xC8, 0xC8, 0x15, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x2D, 0x0D, 0x2D, 0x0D, 0x40, 0x65, 0x3E, 0x65, 0x3E, 0xEA, 0x65, 0x3E, 0x3E, 0x3E, 0x65, 0x3E, 0x3E, 0x0D, 0x6A, 0xDF, 0xDF, 0xE9, 0x6A, 0xDF, 0xE9, 0x6A, 0x6A, 0xE9, 0x6A, 0xE9, 0x2D, 0x0D, 0xDF, 0xDF, 0xE9, 0x2D, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0x0D, 0x2D, 0xC8, 0x2D, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0x40, 0x65, 0x40, 0x8E, 0xEA, 0x3E, 0x3E, 0xEA, 0x4E, 0xEA, 0xEA, 0x40, 0x96, 0xDF, 0x4D, 0x4D, 0xDD, 0x71, 0xFD, 0xDD, 0xBF, 0xDC, 0xBF, 0xDC, 0xDC, 0xC7, 0x90, 0xDC, 0xDC, 0x0B, 0xDC, 0x0B, 0xDC, 0xDC, 0x0B, 0xDC, 0xDC, 0x0B, 0x0B, 0x0B, 0xFD, 0x0B, 0xFD, 0xDC, 0xFD, 0xDD, 0xC2, 0xDD, 0xFD, 0xDD, 0xC2, 0xDD, 0x15, 0x2B, 0xA9, 0x3C, 0x2B, 0x2B, 0xA5, 0x28, 0x28, 0xD9, 0xD9, 0xD9, 0xB3, 0xB3, 0xD9, 0x90, 0x5D, 0x5D, 0x5D, 0xF6, 0xF4, 0xF6, 0x3E, 0x3E, 0x87, 0x85, 0x54, 0x41, 0xD7, 0xFE, 0xC3, 0x81, 0x81, 0x45, 0x45, 0x04, 0xBD, 0x10, 0x10, 0x10, 0x68, 0x3F, 0xBD, 0xB4, 0xB4, 0x81, 0x81, 0x81, 0x82,
+	0xC7, 0xC7, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x5D, 0x16, 0x02, 0x02, 0x6F, 0x6F, 0x16, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x4E, 0xC1, 0x5D, 0x5D, 0x16, 0x4E, 0x4E, 0x65, 0x3E, 0x4E, 0x65, 0x0D, 0x65, 0x40, 0x65, 0x0D, 0x0D, 0x0D, 0xC8, 0x0D, 0x94, 0x0D, 0x2D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0xC8, 0xC8, 0xC8, 0x94, 0x0D, 0x2D, 0x2D, 0x2D, 0xC8, 0xC8, 0x15, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0xE9, 0x15, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x2D, 0x0D, 0x0D, 0x40, 0x3C, 0x3E, 0x3C, 0x6E, 0x54, 0x84, 0x54, 0x9D, 0xE7, 0x6E, 0x6E, 0xF4, 0x01, 0x3E, 0x3C, 0x3E, 0x0D, 0x40, 0x40, 0x6A, 0xE9, 0x6A, 0xE9, 0xDF, 0xE9, 0xDF, 0x6A, 0xE9, 0x6A, 0xE9, 0xDF, 0x96, 0x96, 0x6A, 0xC8, 0x2D, 0x2D, 0xC8, 0x0D, 0xC8, 0x2D, 0x0D, 0x0D, 0x2D, 0x0D, 0x0D, 0x0D, 0xC8, 0x40, 0x40, 0x40, 0xEA, 0x3E, 0x3E, 0x8E, 0xEA, 0xC1, 0xF5, 0x3E, 0x40, 0x40, 0xF8, 0x4D, 0x4D, 0x4D, 0xDD, 0x4D, 0xFD, 0xDD, 0xFD, 0x79, 0xFD, 0x53, 0xFD, 0xDC, 0x0B, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0x0B, 0xC2, 0xDD, 0xFD, 0xDD, 0xC2, 0xC2, 0xC2, 0xC2, 0x15, 0x2B, 0xA9, 0x2B, 0x2B, 0x3C, 0x2B, 0x80, 0xA5, 0x28, 0x28, 0xB3, 0xD9, 0xD9, 0xB3, 0x28, 0x1E, 0x84, 0xA8, 0xA8, 0x65, 0xF6, 0x3E, 0xF4, 0x87, 0xEB, 0x85, 0x41, 0xD7, 0xC4, 0x3A, 0x81, 0x45, 0x83, 0xBD, 0xBD, 0xCD, 0x3F, 0x10, 0x10, 0x10, 0x68, 0xBD, 0xCD, 0x73, 0xB4, 0x81, 0x81, 0x81, 0x73,
+	0x0B, 0xC7, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0x39, 0x24, 0x0B, 0x0B, 0x0B, 0x2B, 0x0B, 0x2B, 0xC2, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x16, 0x02, 0xBB, 0x6F, 0x6F, 0x29, 0xC1, 0x29, 0xF5, 0xC1, 0x4E, 0xF5, 0xF5, 0xC1, 0xC1, 0xC1, 0x5D, 0x8E, 0x5D, 0xF5, 0x4E, 0x4E, 0x65, 0x65, 0x65, 0x40, 0x40, 0x40, 0x65, 0x0D, 0xC8, 0x0D, 0x94, 0x0D, 0xC8, 0x0D, 0x0D, 0x2D, 0x0D, 0x2D, 0x0D, 0xC8, 0xC8, 0xC8, 0x15, 0x96, 0xC8, 0xC8, 0x08, 0xC8, 0x0D, 0x2D, 0x15, 0x15, 0x15, 0xC8, 0x15, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0xC8, 0x0D, 0x15, 0xDF, 0xE9, 0x0D, 0x6A, 0x6A, 0x6A, 0x3C, 0x4D, 0xA9, 0x85, 0x85, 0x9D, 0x9D, 0x0F, 0xA7, 0x36, 0x5F, 0x5F, 0x5F, 0x76, 0x36, 0x36, 0x2A, 0xFC, 0x3C, 0x3C, 0xF4, 0x65, 0x3E, 0x40, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0xE9, 0x6A, 0x96, 0x6A, 0xE9, 0x96, 0x15, 0x96, 0xDF, 0x0D, 0x0D, 0x2D, 0x0D, 0x2D, 0x0D, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0xC8, 0x0D, 0x0D, 0x0D, 0x65, 0x40, 0x3E, 0x8E, 0xEA, 0xEA, 0x3E, 0xC1, 0xF5, 0x3E, 0x3E, 0x96, 0xDF, 0x4D, 0x4D, 0x4D, 0xDD, 0x4D, 0xDD, 0xDD, 0xFD, 0xBF, 0xDC, 0xBF, 0xDC, 0xC0, 0xDC, 0xDC, 0xDC, 0xDC, 0xFD, 0xDC, 0xDC, 0x0B, 0x0B, 0x0B, 0xFD, 0xFD, 0x0B, 0xFD, 0xFD, 0xFD, 0xDD, 0xC2, 0xDD, 0xFD, 0xC2, 0x2B, 0xC2, 0x2B, 0x4D, 0x15, 0x2B, 0x15, 0x2B, 0x15, 0x2B, 0x2B, 0xA5, 0x28, 0x28, 0x28, 0xD9, 0xB3, 0xD9, 0xB3, 0x28, 0x39, 0xA8, 0x01, 0x5D, 0x01, 0xF3, 0x87, 0xEB, 0x85, 0x5C, 0x52, 0xC4, 0xC4, 0x3F, 0x45, 0x45, 0xBD, 0x45, 0xBD, 0x86, 0x10, 0x9F, 0x10, 0x10, 0x10, 0x3F, 0xBD, 0x3F, 0xB4, 0x81, 0x81, 0x73, 0x73,
+	0xC7, 0xC7, 0xC7, 0xDC, 0x0B, 0x0B, 0x39, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x2B, 0x2B, 0xC2, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0xC2, 0xC8, 0x65, 0x29, 0x6F, 0x02, 0x6F, 0x16, 0x16, 0xDA, 0xC1, 0xC1, 0x4E, 0xF5, 0xF5, 0xF5, 0xF5, 0xC1, 0x5D, 0x16, 0x16, 0x5D, 0x5D, 0x65, 0x4E, 0x4E, 0x3E, 0x65, 0x0D, 0x0D, 0x0D, 0x94, 0x94, 0x0D, 0x0D, 0x2D, 0x0D, 0x2D, 0x0D, 0xC8, 0x2D, 0x0D, 0xC8, 0xC8, 0xC8, 0x15, 0xC8, 0xC8, 0xC8, 0x08, 0xC8, 0xC8, 0xC8, 0x96, 0xC8, 0x0D, 0xC8, 0x2D, 0x15, 0x96, 0xC8, 0x15, 0xC8, 0xC8, 0xC8, 0x94, 0x2D, 0x0D, 0x85, 0x4D, 0x85, 0x85, 0x54, 0x54, 0x17, 0x06, 0xCF, 0xCF, 0x4F, 0x0F, 0xD3, 0xA7, 0x61, 0x05, 0x38, 0x38, 0x5F, 0xBE, 0xE8, 0xE8, 0xE8, 0xE8, 0x93, 0xD1, 0xCE, 0x85, 0xE7, 0xF3, 0xF3, 0x3E, 0x0D, 0x6A, 0x6A, 0x40, 0x6A, 0x6A, 0xE9, 0x6A, 0x96, 0x6A, 0xE9, 0x96, 0x96, 0x96, 0x2D, 0xE9, 0x6A, 0xC8, 0x0D, 0x0D, 0x2D, 0x94, 0x0D, 0x96, 0x0D, 0xC8, 0x3E, 0x0D, 0x8E, 0xEA, 0xEA, 0x40, 0xEA, 0x3E, 0x4E, 0xEA, 0x3E, 0x3E, 0x6A, 0x4D, 0x96, 0x4D, 0x71, 0xDD, 0x4D, 0xDD, 0x71, 0x79, 0xFD, 0x79, 0xFD, 0xC7, 0xC7, 0xC7, 0x0B, 0xFD, 0xDC, 0xFD, 0x0B, 0xDC, 0xDC, 0xFD, 0x0B, 0x0B, 0xFD, 0xFD, 0x0B, 0xC2, 0xFD, 0xC2, 0xFD, 0xC2, 0xC2, 0x2B, 0x08, 0xC2, 0xC2, 0xC2, 0x15, 0xDD, 0x15, 0x2B, 0x15, 0x2B, 0x2B, 0x24, 0xA5, 0x28, 0x28, 0xB3, 0xD9, 0x28, 0xB3, 0xD9, 0x28, 0x2B, 0x5D, 0x5D, 0x5D, 0x3E, 0xE7, 0xEB, 0x41, 0x8D, 0xC3, 0xB2, 0xF9, 0xB4, 0xBD, 0x04, 0x04, 0xBD, 0xBD, 0xCD, 0x10, 0x10, 0x4A, 0x10, 0x9F, 0x3F, 0xB4, 0xF9, 0x81, 0xB4, 0x73, 0x86, 0x73,
+	0xC7, 0xC7, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0xC2, 0xC2, 0x2B, 0x08, 0x2B, 0x2B, 0xC2, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0xC2, 0xC8, 0x8E, 0x16, 0xBB, 0x02, 0x6F, 0x6F, 0x16, 0x16, 0xC1, 0xC1, 0xF5, 0xC1, 0xC1, 0xF5, 0xF5, 0xC1, 0x4E, 0x5D, 0x5D, 0x5D, 0x8E, 0x3E, 0x4E, 0x3E, 0x4E, 0x65, 0x65, 0xC8, 0x0D, 0x94, 0x94, 0xC8, 0x0D, 0x2D, 0xC8, 0x0D, 0x2D, 0x0D, 0x0D, 0xC8, 0x0D, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0xC8, 0xC8, 0xE9, 0x96, 0xC8, 0x08, 0xC8, 0xC8, 0xDF, 0x0D, 0x96, 0x71, 0xE9, 0x96, 0xC8, 0x08, 0xE9, 0xC8, 0x40, 0xDF, 0x54, 0x06, 0x06, 0x06, 0x17, 0xCE, 0x0F, 0x2E, 0x11, 0xCC, 0xD3, 0xA7, 0x34, 0x34, 0x38, 0x05, 0x05, 0x7B, 0x05, 0x05, 0x05, 0x7B, 0x05, 0x61, 0xE8, 0xF1, 0x32, 0xD2, 0x36, 0x4F, 0xFC, 0x87, 0xF3, 0xF3, 0x6A, 0x6A, 0x0D, 0x40, 0x6A, 0xE9, 0x96, 0x96, 0x96, 0x96, 0x6A, 0xE9, 0x96, 0x6A, 0xE9, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0x0D, 0x3E, 0x40, 0x0D, 0x3E, 0xEA, 0x3E, 0xC1, 0xC1, 0x4E, 0x8E, 0x3E, 0x40, 0x15, 0x4D, 0x4D, 0xC2, 0x4D, 0xDD, 0x4D, 0xDD, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0xFD, 0xFD, 0xDC, 0xDC, 0xDD, 0xFD, 0xFD, 0xDC, 0xFD, 0xDD, 0xFD, 0xFD, 0x0B, 0xC2, 0xFD, 0xC2, 0xC2, 0xDC, 0xDD, 0x08, 0x15, 0xC2, 0x15, 0xC2, 0xA9, 0x2B, 0x15, 0xDD, 0x15, 0x15, 0x2B, 0xC8, 0x2B, 0x0B, 0xB1, 0x28, 0x28, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0x28, 0x59, 0x6E, 0xA8, 0x6E, 0x6E, 0xEB, 0x41, 0x8D, 0xFE, 0xB2, 0xF9, 0xF9, 0x83, 0x45, 0x04, 0xBD, 0xBD, 0x10, 0xBD, 0x10, 0x3F, 0x3F, 0xCD, 0x9F, 0xB4, 0x81, 0xF9, 0x81, 0x81, 0x81, 0x81, 0x81,
+	0xC7, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x24, 0x24, 0x0B, 0xC2, 0x2B, 0x08, 0x08, 0x08, 0x94, 0x2B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0xC8, 0x8E, 0x16, 0x6F, 0x02, 0x6F, 0x16, 0x16, 0x29, 0xDA, 0xF5, 0xC1, 0xF5, 0x5D, 0xC1, 0xC1, 0xC1, 0xC1, 0x16, 0x4E, 0x16, 0x4E, 0x4E, 0x65, 0x65, 0x0D, 0x40, 0x0D, 0x0D, 0xC8, 0x94, 0x94, 0x0D, 0xC8, 0x0D, 0x2D, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0xE9, 0xC8, 0x96, 0xE9, 0x96, 0xE9, 0x96, 0x08, 0xC8, 0xC8, 0xC8, 0x40, 0x2D, 0x0D, 0x96, 0x6A, 0xE9, 0xE9, 0x6A, 0xE9, 0x6A, 0xDF, 0xDF, 0x17, 0x17, 0x11, 0x0F, 0xCB, 0x17, 0xE0, 0xCB, 0xE0, 0xCB, 0xD1, 0xAA, 0x38, 0x76, 0x38, 0x38, 0x46, 0x0A, 0x05, 0xBE, 0x7B, 0x38, 0x38, 0x38, 0x05, 0xBE, 0xBE, 0x3D, 0xF1, 0xF1, 0xF1, 0x3D, 0xA7, 0xCF, 0x3E, 0xF4, 0xF3, 0x6A, 0x6A, 0x40, 0x40, 0x6A, 0x96, 0x96, 0x6A, 0xC8, 0x6A, 0x96, 0xE9, 0x6A, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x94, 0x3E, 0x40, 0x94, 0x3E, 0x40, 0x8E, 0x3E, 0x3E, 0x4E, 0x16, 0xF5, 0x3E, 0x40, 0x6A, 0x96, 0x4D, 0xC2, 0x4D, 0xFD, 0x4D, 0xDD, 0x4D, 0x4D, 0x4D, 0xFD, 0x79, 0xFD, 0x53, 0xFD, 0xFD, 0xFD, 0xDC, 0xDC, 0xDC, 0xFD, 0xDC, 0x0B, 0xC2, 0xFD, 0xC2, 0xFD, 0xC2, 0xC2, 0x2B, 0xC2, 0xC2, 0xC2, 0xC2, 0x15, 0xDD, 0x15, 0x15, 0x15, 0x4D, 0x15, 0x2B, 0xA9, 0xC2, 0x08, 0x2B, 0x2B, 0x0B, 0xA5, 0x28, 0xD9, 0xB3, 0x28, 0xB3, 0xD9, 0xB3, 0x28, 0x90, 0x01, 0x6E, 0x6E, 0x42, 0x52, 0xC3, 0x82, 0xF9, 0x97, 0xE6, 0x83, 0xBD, 0x83, 0xBD, 0xBD, 0x10, 0x86, 0xBD, 0xCD, 0xBD, 0x68, 0x68, 0xB4, 0x81, 0xB4, 0x81, 0x73, 0x81, 0x81, 0x81,
+	0x0B, 0xDC, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x94, 0xC2, 0x08, 0xC2, 0xC2, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0xC2, 0xC8, 0x8E, 0x29, 0xBB, 0x02, 0xBB, 0x6F, 0x6F, 0x16, 0xC1, 0xC1, 0xC1, 0x5D, 0x16, 0xDA, 0x4E, 0xC1, 0x4E, 0xC1, 0xC1, 0x5D, 0x8E, 0x3E, 0x4E, 0x40, 0x8E, 0x40, 0x3E, 0xC8, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0xC8, 0xC8, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0xC8, 0xC8, 0x08, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0xC8, 0xC8, 0x96, 0x96, 0x6A, 0x4D, 0x0D, 0x6A, 0x40, 0x6A, 0xF8, 0xE9, 0x6A, 0xF8, 0x4D, 0x06, 0x17, 0x17, 0xCF, 0x11, 0x17, 0x48, 0x58, 0x48, 0x55, 0xCC, 0x34, 0x34, 0x76, 0x34, 0x38, 0x62, 0x7B, 0x7B, 0xBE, 0x7B, 0x7B, 0x38, 0x38, 0x38, 0x05, 0x38, 0x05, 0x38, 0x05, 0xC5, 0xC5, 0xC5, 0x32, 0x32, 0x92, 0x58, 0xF4, 0xF4, 0x01, 0x40, 0x3E, 0x40, 0x40, 0x6A, 0xE9, 0x6A, 0xE9, 0x6A, 0x96, 0x6A, 0xC8, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0x40, 0x3E, 0x40, 0x8E, 0xEA, 0xEA, 0x3E, 0xEA, 0x4E, 0xC1, 0xF5, 0x65, 0x65, 0xDF, 0x15, 0x4D, 0x71, 0xDD, 0x71, 0x71, 0x4D, 0xDD, 0xDD, 0x4D, 0xFD, 0xFD, 0x06, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC2, 0xFD, 0xDD, 0xFD, 0x2B, 0xC2, 0x2B, 0xC2, 0x2B, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0x2B, 0x08, 0xC2, 0x15, 0x15, 0x4D, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC2, 0x15, 0x94, 0x2B, 0x2B, 0x80, 0xA5, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0xB3, 0x28, 0x28, 0x2B, 0x01, 0xF4, 0x8F, 0xFE, 0x81, 0xE5, 0x81, 0x68, 0xB6, 0x97, 0x68, 0x04, 0xBD, 0xBD, 0xCD, 0xBD, 0x86, 0xBD, 0xBD, 0xB4, 0xB4, 0x3F, 0xBD, 0x3F, 0xBD, 0x86, 0xB4, 0x81, 0x73,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x08, 0x94, 0xC2, 0x2B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x52, 0x02, 0x6F, 0x16, 0x29, 0xDA, 0x16, 0xDA, 0xC1, 0xC1, 0xF5, 0xC1, 0xC1, 0x16, 0xC1, 0x5D, 0x8E, 0x8E, 0x4E, 0x4E, 0x65, 0x40, 0x8E, 0x0D, 0x94, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0xC8, 0xC8, 0x15, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0xC8, 0xC8, 0x3E, 0x0D, 0xE9, 0xE7, 0x6A, 0x54, 0x4D, 0xDF, 0xF8, 0xF8, 0x54, 0x06, 0x06, 0x2E, 0x11, 0x11, 0xE0, 0xE0, 0xE0, 0x11, 0xE0, 0x11, 0x55, 0xCB, 0xCB, 0xCC, 0x34, 0x34, 0x34, 0x34, 0x7B, 0x7B, 0xBE, 0x7B, 0x05, 0x05, 0x05, 0x38, 0x05, 0x59, 0x05, 0x05, 0x05, 0x05, 0xC6, 0xF1, 0x91, 0xE2, 0x32, 0x36, 0xB8, 0xA8, 0xF4, 0xF3, 0x6A, 0x2D, 0x6A, 0x6A, 0x96, 0xDF, 0x40, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x94, 0x40, 0x8E, 0x40, 0xEA, 0x3E, 0x8E, 0xEA, 0x3E, 0xEA, 0xF5, 0x4E, 0x3E, 0x40, 0x0D, 0x15, 0x4D, 0x71, 0xDD, 0xC2, 0xDD, 0x71, 0xDD, 0x4D, 0xFD, 0x06, 0xFD, 0xFD, 0x06, 0xFD, 0xBF, 0xFD, 0xDC, 0xDD, 0xC2, 0x2B, 0xC2, 0x2B, 0xC2, 0xC2, 0xC2, 0xC2, 0x2B, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0x15, 0x4D, 0x15, 0x2B, 0x15, 0x4D, 0x2B, 0x15, 0xC2, 0x15, 0xC2, 0x2B, 0x94, 0x2B, 0x2B, 0x1E, 0xD9, 0xD9, 0xD9, 0xB3, 0xB3, 0xB3, 0xD9, 0xD9, 0xB1, 0x01, 0xAF, 0x99, 0xE5, 0x81, 0x81, 0x83, 0x04, 0xB6, 0xB4, 0x10, 0x4B, 0xBD, 0xCD, 0xBD, 0xCD, 0xBD, 0xCD, 0x68, 0xB4, 0x45, 0xCD, 0xBD, 0xCD, 0xB4, 0x45, 0x81, 0x81, 0x73,
+	0x0B, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x94, 0x94, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x8E, 0xBB, 0x02, 0x02, 0x02, 0x6F, 0x6F, 0x16, 0xC1, 0x16, 0x16, 0xDA, 0xF5, 0xC1, 0xDA, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x8E, 0x4E, 0x8E, 0x8E, 0x40, 0x94, 0x8E, 0x65, 0xC8, 0x94, 0x0D, 0x0D, 0x0D, 0x94, 0x94, 0x94, 0x94, 0x0D, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0xC8, 0xC8, 0x08, 0xC8, 0xC8, 0xC8, 0xE9, 0x0D, 0xE9, 0x40, 0x6A, 0x4D, 0x4D, 0x06, 0x06, 0x4D, 0xF8, 0xEB, 0xE7, 0x85, 0x2E, 0x17, 0x54, 0xE0, 0xE0, 0x17, 0x17, 0x11, 0xCB, 0xCB, 0x11, 0x55, 0x2C, 0x55, 0x55, 0x34, 0x34, 0x34, 0x37, 0x5F, 0x7B, 0x5F, 0x5F, 0x7B, 0x05, 0x38, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC6, 0xC6, 0xC6, 0xC6, 0xC5, 0xC5, 0xE2, 0x91, 0xE8, 0x66, 0xF4, 0xA8, 0x01, 0x87, 0x0D, 0x40, 0x6A, 0x6A, 0xE9, 0x40, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x94, 0xEA, 0x8E, 0x94, 0x40, 0x8E, 0x40, 0xEA, 0xEA, 0xEA, 0xF5, 0xEA, 0xF5, 0x4E, 0x65, 0x65, 0xC8, 0x15, 0x4D, 0x71, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xDD, 0x4D, 0xFD, 0x79, 0x71, 0xFD, 0x79, 0xFD, 0xFD, 0xFD, 0xDD, 0xC2, 0xC2, 0xDD, 0xC2, 0x2B, 0xC2, 0x2B, 0xC2, 0xC2, 0x2B, 0xC2, 0xC2, 0x15, 0xC2, 0x15, 0xDD, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x71, 0x15, 0x08, 0x15, 0x15, 0x2B, 0x94, 0x2B, 0xE4, 0x28, 0xD9, 0xB3, 0xB3, 0xD9, 0xB3, 0xB3, 0xD9, 0xB3, 0x84, 0x09, 0x3A, 0xC3, 0x81, 0x45, 0x04, 0xB6, 0xE6, 0xB4, 0x4B, 0x73, 0x73, 0x3F, 0x10, 0xCD, 0xBD, 0x68, 0x45, 0x68, 0x68, 0x9F, 0x3F, 0xB4, 0x45, 0x81, 0x81, 0x81, 0x73,
+	0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x94, 0x94, 0x94, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0xC2, 0xC2, 0xC8, 0x8E, 0x29, 0xBB, 0x02, 0x6F, 0x6F, 0x16, 0x16, 0xDA, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x29, 0x16, 0x5D, 0x16, 0x4E, 0x8E, 0x8E, 0x4E, 0x94, 0x8E, 0x65, 0x94, 0x8E, 0x65, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x0D, 0xC8, 0x0D, 0x0D, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0xC8, 0xC8, 0xC8, 0x0D, 0x6A, 0xBF, 0xBF, 0xCA, 0xCA, 0x06, 0x54, 0x85, 0xEB, 0x87, 0x42, 0x87, 0x70, 0x48, 0x85, 0x8B, 0x85, 0x58, 0x8B, 0x54, 0x9C, 0x17, 0xE0, 0x11, 0xCB, 0xCB, 0xCB, 0x37, 0x36, 0x36, 0x34, 0x34, 0x34, 0x38, 0x34, 0x38, 0x05, 0x7B, 0x38, 0x38, 0x59, 0xBE, 0xC6, 0xC6, 0x59, 0xC6, 0xBE, 0xC6, 0xFF, 0xFF, 0x0A, 0xBE, 0xF0, 0x32, 0xA7, 0x6E, 0x3E, 0xF3, 0xF3, 0x3E, 0x3E, 0x40, 0x6A, 0x40, 0x65, 0x0D, 0xC8, 0x0D, 0x94, 0x40, 0xC8, 0x40, 0x8E, 0x94, 0x4E, 0xEA, 0x3E, 0x8E, 0xEA, 0x8E, 0xEA, 0xC1, 0x5D, 0xF5, 0x65, 0x65, 0x0D, 0x15, 0x4D, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xDD, 0x4D, 0xFD, 0x06, 0x71, 0x06, 0xC2, 0xFD, 0x06, 0xFD, 0xFD, 0xDD, 0xFD, 0x2B, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0xC2, 0x2B, 0x15, 0xC2, 0xC2, 0x15, 0x08, 0xC2, 0x15, 0xC2, 0x15, 0xDD, 0x08, 0x08, 0x2B, 0xC2, 0x08, 0x2B, 0x94, 0x2B, 0x94, 0x2B, 0xB1, 0xD9, 0xD9, 0xB3, 0xB3, 0xB3, 0xB3, 0xD9, 0xB3, 0x01, 0x00, 0x3A, 0xC3, 0x45, 0xBD, 0x04, 0xBD, 0x04, 0xB4, 0x14, 0xB5, 0x73, 0xCD, 0xBD, 0x3F, 0xB4, 0xB4, 0xB4, 0x68, 0xCD, 0xBD, 0xB4, 0x81, 0xB4, 0xB4, 0x81, 0x86, 0xBD,
+	0x0B, 0x24, 0xC7, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x5D, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0xC8, 0x8E, 0x02, 0x02, 0x52, 0x02, 0xBB, 0x6F, 0x6F, 0x6F, 0xC1, 0xDA, 0x16, 0x29, 0x16, 0x29, 0x16, 0xC1, 0x16, 0x5D, 0x5D, 0x5D, 0x4E, 0x4E, 0xEA, 0x8E, 0x40, 0x8E, 0x40, 0x94, 0x40, 0x94, 0x94, 0x65, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x2D, 0xC8, 0x2D, 0xDF, 0x96, 0x71, 0x4D, 0xA9, 0x54, 0x3C, 0x87, 0xE7, 0xEB, 0x85, 0x87, 0x42, 0x98, 0x85, 0x2E, 0x58, 0x85, 0x42, 0x58, 0x54, 0x54, 0x54, 0x9D, 0x11, 0xCE, 0xCB, 0xCB, 0xCB, 0x37, 0xD1, 0x37, 0x5F, 0x38, 0x34, 0x38, 0x38, 0xBE, 0x59, 0x05, 0xBE, 0x05, 0x59, 0x05, 0x05, 0x59, 0xC6, 0xBE, 0xC6, 0xC6, 0x05, 0xC6, 0xF0, 0xFF, 0x57, 0x91, 0x3D, 0x9C, 0x01, 0xF4, 0x6E, 0xF3, 0x3E, 0x40, 0x3E, 0x40, 0x0D, 0x0D, 0xC8, 0x0D, 0x94, 0xC8, 0x3E, 0x40, 0x3E, 0x40, 0xEA, 0xEA, 0x8E, 0x8E, 0xEA, 0xEA, 0xC1, 0x16, 0xF5, 0x4E, 0x40, 0xDF, 0x96, 0x15, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xFD, 0x4D, 0xDD, 0x4D, 0xFD, 0xDD, 0xFD, 0xFD, 0xC2, 0xFD, 0x2B, 0x15, 0x2B, 0xC2, 0x15, 0xC2, 0x2B, 0xC2, 0xC2, 0xDD, 0x08, 0xDD, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0x15, 0x08, 0x08, 0x08, 0xC2, 0x15, 0xC2, 0x2B, 0x15, 0x2B, 0x2B, 0x2B, 0x0B, 0xA5, 0xD9, 0xD9, 0xB3, 0xD9, 0xB3, 0xB3, 0x28, 0xA3, 0x00, 0x99, 0xF9, 0x45, 0x04, 0x83, 0xBD, 0x68, 0x9F, 0xA3, 0x73, 0xCD, 0x3F, 0xBD, 0xB4, 0x81, 0x83, 0xB4, 0xBD, 0xCD, 0xB4, 0xB4, 0x81, 0xB4, 0xBD, 0xBD, 0x86, 0xBD,
+	0xC7, 0x24, 0xE4, 0xE4, 0x24, 0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x8E, 0x02, 0x02, 0x94, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0xC2, 0xC2, 0xC8, 0x8E, 0x16, 0x52, 0x02, 0x52, 0x02, 0x02, 0x6F, 0x29, 0x6F, 0x16, 0x16, 0x16, 0xDA, 0xC1, 0xDA, 0x16, 0xC1, 0xC1, 0xC1, 0xF5, 0xC1, 0xF5, 0x8E, 0x8E, 0x40, 0x40, 0x8E, 0x40, 0x3E, 0x94, 0x65, 0x94, 0x0D, 0x0D, 0xC8, 0x0D, 0x0D, 0xC8, 0xC8, 0xC8, 0xC8, 0x94, 0x0D, 0x0D, 0x94, 0x94, 0x94, 0x7F, 0x71, 0x6A, 0x3E, 0x40, 0x6A, 0x6A, 0x87, 0x87, 0x3C, 0xEB, 0x87, 0xEB, 0x85, 0x8B, 0x85, 0x8B, 0x85, 0x8B, 0x85, 0x58, 0x54, 0x58, 0x54, 0x54, 0xE0, 0xE0, 0xE0, 0x11, 0xA2, 0x76, 0x55, 0xCB, 0x34, 0x34, 0x38, 0x38, 0x38, 0x05, 0xBE, 0xBE, 0xC5, 0xBE, 0xC6, 0x05, 0x05, 0xC6, 0xBE, 0xC6, 0x05, 0x05, 0xC6, 0xC6, 0xC6, 0xC6, 0xC5, 0xC5, 0x91, 0x32, 0x37, 0x01, 0xA8, 0xF4, 0xF3, 0x3E, 0x40, 0x3E, 0x94, 0x40, 0x8E, 0x8E, 0xC8, 0x8E, 0x40, 0x40, 0x8E, 0xEA, 0x3E, 0x8E, 0xEA, 0xEA, 0xF5, 0xF3, 0xC1, 0xC1, 0xC1, 0x4E, 0x40, 0xE9, 0x15, 0x08, 0x4D, 0xC2, 0xDD, 0x71, 0xDD, 0x15, 0xC2, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0x06, 0x71, 0xC2, 0xFD, 0xC2, 0xFD, 0xC2, 0x15, 0xDD, 0xA9, 0x15, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0x08, 0xC2, 0x15, 0xC2, 0xA9, 0x15, 0xDD, 0xC2, 0x15, 0x08, 0x2B, 0xC2, 0x08, 0x15, 0x2B, 0x94, 0x2B, 0x94, 0x0B, 0x80, 0xA5, 0xB3, 0xD9, 0xD9, 0xB3, 0xD9, 0x01, 0x00, 0x6C, 0x6C, 0xF9, 0xBD, 0xBD, 0x04, 0xBD, 0xCD, 0x3F, 0xBD, 0xCD, 0x10, 0x10, 0xBD, 0x81, 0x81, 0xB4, 0x73, 0x73, 0x3F, 0xB4, 0xF9, 0x82, 0x81, 0x45, 0x10, 0x9F, 0xBD,
+	0x24, 0x39, 0x24, 0x24, 0x0B, 0x0B, 0xC2, 0xC2, 0x08, 0x94, 0x5D, 0x02, 0x16, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x6B, 0x02, 0x02, 0x6F, 0x6F, 0xDA, 0x6F, 0x29, 0x6F, 0x16, 0xDA, 0xC1, 0xDA, 0xDA, 0x16, 0xC1, 0xC1, 0xC1, 0x5D, 0xF5, 0x4E, 0x4E, 0x8E, 0x94, 0x3E, 0x94, 0x8E, 0x94, 0x8E, 0x65, 0xC8, 0x40, 0x40, 0x0D, 0x0D, 0x0D, 0xC8, 0xC8, 0x94, 0xC8, 0x94, 0x94, 0x65, 0x65, 0xC7, 0xCA, 0x16, 0x5D, 0x3E, 0x6A, 0x40, 0x3E, 0x3E, 0x3C, 0x6A, 0x87, 0xEB, 0x87, 0x85, 0x85, 0x8B, 0x85, 0x70, 0x85, 0x98, 0xE7, 0x85, 0x54, 0x58, 0x54, 0x17, 0xE0, 0x17, 0x55, 0xCB, 0xCB, 0x55, 0x55, 0x34, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x05, 0xBE, 0x05, 0xBE, 0xBE, 0xBE, 0xC6, 0xBE, 0xC6, 0x59, 0xC6, 0xC6, 0xAE, 0xC6, 0xAE, 0xC6, 0xFF, 0xC6, 0xC6, 0xF0, 0x57, 0x61, 0xE0, 0xA8, 0xA8, 0xF3, 0xC1, 0x40, 0x40, 0x8E, 0x6A, 0x8E, 0x40, 0xC8, 0x8E, 0x3E, 0xEA, 0x3E, 0x3E, 0xEA, 0x3E, 0x8E, 0xEA, 0xF3, 0xF5, 0xC1, 0xC1, 0xEA, 0x65, 0x6A, 0x96, 0x08, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xDD, 0x08, 0x71, 0x4D, 0x71, 0x4D, 0x4D, 0xC2, 0x4D, 0x71, 0xDD, 0xFD, 0xFD, 0xC2, 0xDD, 0x15, 0x2B, 0x15, 0x08, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0x2B, 0x15, 0xC2, 0x15, 0xC2, 0x08, 0xC2, 0x15, 0x2B, 0xC2, 0xC2, 0xC2, 0x15, 0x2B, 0x15, 0xDC, 0xA5, 0x28, 0x28, 0xB3, 0xB3, 0x66, 0xB2, 0x00, 0x72, 0x68, 0x83, 0x83, 0x45, 0xBD, 0xBD, 0xBD, 0xCD, 0xBD, 0x4B, 0x10, 0xBD, 0x81, 0x81, 0x81, 0x73, 0x3F, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x68, 0x10, 0xBD, 0xBD, 0x83,
+	0x39, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x4C, 0x5D, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x02, 0x6B, 0xBB, 0xBB, 0x6F, 0x6F, 0x16, 0x6F, 0x16, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xC1, 0x16, 0x16, 0x5D, 0x4E, 0xC1, 0x8E, 0xEA, 0x8E, 0x3E, 0x8E, 0x94, 0x8E, 0x40, 0x65, 0x65, 0x40, 0x65, 0x0D, 0xC8, 0x0D, 0xC8, 0x0D, 0xC8, 0x94, 0xC8, 0xC8, 0x2D, 0x94, 0x65, 0xBF, 0x15, 0x16, 0x5D, 0x3E, 0x40, 0xEB, 0x3C, 0x3E, 0x87, 0xDF, 0x87, 0x87, 0x87, 0xEB, 0x85, 0x85, 0x54, 0x85, 0xEB, 0x85, 0x98, 0x54, 0x54, 0x54, 0x8B, 0x54, 0x9D, 0x58, 0x48, 0x55, 0xCB, 0xCB, 0xD1, 0x36, 0x5F, 0x05, 0x05, 0x05, 0x05, 0xBE, 0x05, 0xBE, 0x05, 0xBE, 0xBE, 0xF2, 0xC6, 0xBE, 0x0A, 0xBE, 0xBE, 0xBE, 0xC6, 0xC6, 0xC6, 0xAE, 0xC6, 0xC6, 0xC6, 0xF0, 0xD5, 0xE8, 0xE0, 0x01, 0xA8, 0xA8, 0xEB, 0xC1, 0xF5, 0x3E, 0x3E, 0x8E, 0x4E, 0x0D, 0x65, 0x65, 0x3E, 0xEA, 0x8E, 0xEA, 0xEA, 0xC1, 0xF5, 0xC1, 0xC1, 0xC1, 0x8E, 0x40, 0x6A, 0x15, 0x71, 0xC2, 0xFD, 0xC2, 0xFD, 0xC2, 0xFD, 0xDD, 0xC2, 0x71, 0xDD, 0x4D, 0x4D, 0x4D, 0xDD, 0x4D, 0x71, 0x71, 0xC2, 0xFD, 0xFD, 0x71, 0x15, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0xC2, 0x2B, 0x15, 0xC2, 0x15, 0xDD, 0x15, 0x15, 0xDD, 0x15, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0x08, 0xC2, 0xC2, 0xDD, 0xC2, 0xDD, 0x15, 0x2B, 0xB1, 0xD9, 0xD9, 0xD9, 0x66, 0xA3, 0x00, 0x6C, 0xB2, 0x68, 0x45, 0x45, 0x04, 0xBD, 0x9A, 0x86, 0x86, 0x10, 0xBD, 0x10, 0xBD, 0x81, 0x81, 0x3F, 0xBD, 0xCD, 0xB4, 0x97, 0x83, 0xB4, 0xB4, 0xCD, 0x10, 0xBD, 0xB7, 0xB7,
+	0x24, 0xE4, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x94, 0x94, 0x02, 0x4C, 0x02, 0x02, 0x94, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x94, 0x02, 0x4C, 0xED, 0x02, 0xBB, 0x6F, 0x6F, 0x6F, 0xC1, 0xDA, 0xC1, 0xA8, 0xC1, 0xDA, 0x16, 0x16, 0xC1, 0x16, 0x16, 0x5D, 0xF5, 0x4E, 0x3E, 0x8E, 0x3E, 0x8E, 0x65, 0x65, 0x94, 0x8E, 0x94, 0x65, 0x40, 0x40, 0x3E, 0xC8, 0x94, 0x0D, 0xC8, 0x0D, 0xC8, 0x94, 0xE9, 0x2D, 0x65, 0x71, 0x94, 0x4E, 0x65, 0x3E, 0x3E, 0x0D, 0x40, 0x3E, 0x3E, 0x3C, 0x40, 0x87, 0x87, 0x87, 0x85, 0x85, 0x54, 0x54, 0xEB, 0x85, 0x85, 0x54, 0x58, 0x54, 0x85, 0x85, 0x8B, 0x54, 0x58, 0x58, 0xE0, 0xCB, 0xCC, 0x5F, 0x34, 0x5F, 0x5F, 0x5F, 0x5F, 0x05, 0x7B, 0x05, 0x05, 0x05, 0x05, 0xBE, 0xBE, 0xBE, 0xC6, 0xF2, 0xC6, 0xBE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xFF, 0xC6, 0xC6, 0xC5, 0x91, 0x77, 0x91, 0xD3, 0xBA, 0x8F, 0xF4, 0xF4, 0xC1, 0xF5, 0xF5, 0x4E, 0x40, 0x4E, 0x3E, 0xEA, 0x8E, 0xEA, 0xEA, 0xC1, 0xEA, 0xF5, 0xF3, 0xC1, 0xDA, 0xC1, 0xC1, 0x40, 0xE9, 0x96, 0x71, 0xFD, 0xC2, 0xFD, 0xFD, 0xFD, 0xC2, 0x71, 0xDD, 0x71, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x15, 0x15, 0x08, 0xFD, 0xFD, 0xFD, 0xDD, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x08, 0xC2, 0x15, 0x2B, 0xC2, 0x15, 0xC2, 0xC2, 0x2B, 0xC2, 0x2B, 0x4D, 0xDD, 0x71, 0xC2, 0xC2, 0x2B, 0x2B, 0xC7, 0xD2, 0xA5, 0x84, 0xB2, 0x6C, 0x72, 0xA3, 0xB5, 0xE6, 0x04, 0xBD, 0xBD, 0x45, 0x86, 0x73, 0xCD, 0xBD, 0x86, 0xBD, 0xBD, 0x86, 0xBD, 0xCD, 0xCD, 0x68, 0xB4, 0xB4, 0x83, 0xCD, 0x9F, 0x10, 0x26, 0xF9, 0x00, 0xB7,
+	0xE4, 0x24, 0x24, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x5D, 0x02, 0x4C, 0x02, 0x16, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0xB1, 0x0B, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0xED, 0xED, 0x02, 0xBB, 0x6F, 0xDA, 0x6F, 0xC1, 0xC1, 0xA8, 0xC1, 0xDA, 0xC1, 0xDA, 0x16, 0xDA, 0x16, 0x16, 0x5D, 0xF5, 0x8E, 0x3E, 0x4E, 0x4E, 0x3E, 0x65, 0x40, 0x8E, 0x0D, 0x8E, 0xC8, 0x3E, 0x0D, 0x3E, 0xC8, 0x40, 0x94, 0x0D, 0xC8, 0xC8, 0x94, 0x94, 0x65, 0x96, 0xFD, 0x5D, 0x65, 0x65, 0x65, 0x40, 0x4E, 0xF3, 0xF6, 0x87, 0xF8, 0x87, 0x87, 0xEB, 0xE7, 0xF8, 0x85, 0xF8, 0x2E, 0xEB, 0x98, 0x54, 0x54, 0x54, 0xEB, 0x98, 0x85, 0x54, 0x2E, 0x9D, 0x17, 0xCF, 0xCF, 0xCE, 0xCC, 0x37, 0x34, 0x34, 0x38, 0x38, 0x5F, 0x05, 0xBE, 0x59, 0x05, 0xBE, 0x59, 0xC6, 0xBE, 0xC6, 0xAE, 0xBE, 0xC6, 0xF2, 0xC6, 0xC6, 0xAE, 0xC6, 0xC6, 0xC6, 0xFF, 0x1D, 0xFF, 0xFF, 0x95, 0x1D, 0x62, 0xBA, 0xAF, 0x8F, 0x8F, 0xA8, 0x3E, 0xF3, 0x4E, 0x4E, 0x8E, 0x3E, 0xEA, 0x8E, 0xEA, 0xEA, 0xC1, 0xEA, 0xF3, 0xC1, 0xC1, 0xC1, 0xF5, 0xEA, 0xE9, 0x15, 0x71, 0x71, 0xFD, 0x0B, 0xFD, 0xFD, 0xFD, 0xFD, 0xC2, 0x4D, 0x4D, 0x4D, 0x15, 0x15, 0x15, 0xDF, 0xDF, 0x15, 0x71, 0xC2, 0x71, 0x71, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0x2B, 0xC2, 0x15, 0xC2, 0xC2, 0x2B, 0xC2, 0x15, 0xDD, 0x4D, 0xC2, 0xDD, 0xFD, 0xC2, 0xC2, 0x0B, 0x0B, 0xFD, 0xC0, 0xE7, 0x14, 0xB2, 0xB2, 0xB2, 0xB6, 0x97, 0x04, 0xBD, 0xBD, 0xBD, 0x86, 0x9A, 0x3F, 0x73, 0x3F, 0xB4, 0x81, 0x86, 0x10, 0x3F, 0x10, 0x68, 0xB4, 0x68, 0x68, 0x68, 0x10, 0x26, 0x10, 0x3F, 0x00, 0x6C, 0xCD,
+	0xE4, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x94, 0x94, 0x02, 0x02, 0x02, 0x02, 0x02, 0x94, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x4C, 0x02, 0x52, 0xBB, 0x6F, 0x6F, 0xDA, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0x29, 0x16, 0xA8, 0x16, 0x5D, 0xF5, 0x4E, 0x65, 0x4E, 0x8E, 0x65, 0x8E, 0x94, 0x65, 0x65, 0x65, 0x40, 0x94, 0x0D, 0x94, 0x94, 0xC8, 0x8E, 0xC8, 0xC8, 0x94, 0x94, 0xC8, 0xC7, 0x08, 0x8E, 0x65, 0x65, 0x4E, 0x65, 0xF5, 0xF5, 0x3E, 0x3E, 0x3E, 0x6A, 0x6A, 0x85, 0xF8, 0xF8, 0x85, 0xEB, 0xEB, 0x54, 0x54, 0x85, 0x54, 0x85, 0x85, 0x54, 0x17, 0x54, 0x54, 0x54, 0x9D, 0x17, 0xCF, 0xCF, 0xCB, 0x37, 0x34, 0x34, 0x37, 0x38, 0x7B, 0x05, 0x05, 0xBE, 0x05, 0xBE, 0xBE, 0xC6, 0xC6, 0xBE, 0xC6, 0xF2, 0xC5, 0xC5, 0xAE, 0xC6, 0xC6, 0xC6, 0xFF, 0xC6, 0xC6, 0xFF, 0xC6, 0x0A, 0xC6, 0x23, 0x1D, 0x0A, 0xB9, 0xBA, 0x5E, 0x8F, 0xA8, 0x29, 0x16, 0x4E, 0x4E, 0xEA, 0x8E, 0xEA, 0xC1, 0xC1, 0xEA, 0xC1, 0xEA, 0xC1, 0xDA, 0xC1, 0xC1, 0x3E, 0x6A, 0x71, 0x71, 0xC2, 0xFD, 0xFD, 0xC7, 0xC7, 0xFD, 0xFD, 0xFD, 0xC2, 0x71, 0x15, 0xA9, 0xE9, 0x0D, 0x0D, 0x0D, 0x96, 0x71, 0x71, 0xFD, 0xC2, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0x15, 0xFD, 0xC2, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0xC2, 0x2B, 0xC2, 0xDD, 0x71, 0xDD, 0x71, 0xC2, 0xC2, 0xC2, 0xC2, 0xC7, 0xC0, 0xF4, 0x14, 0x6C, 0x14, 0xB4, 0xB6, 0x97, 0x04, 0xBD, 0xBD, 0xBD, 0x10, 0x86, 0x3F, 0x73, 0x73, 0xB4, 0x81, 0x83, 0x3F, 0x10, 0x3F, 0x68, 0x04, 0x83, 0xBD, 0x9F, 0x10, 0xD6, 0x26, 0x3F, 0x00, 0x00, 0x14, 0x42,
+	0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x16, 0x02, 0x02, 0x02, 0x02, 0x16, 0x94, 0x94, 0xC2, 0x2B, 0x2B, 0x0B, 0xB1, 0x0B, 0xE4, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x4C, 0x02, 0x6F, 0x6F, 0x07, 0xDA, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0x16, 0x16, 0x29, 0x5D, 0x5D, 0xC1, 0x4E, 0x4E, 0x3E, 0x3E, 0x0D, 0x40, 0x8E, 0x94, 0x8E, 0x0D, 0x3E, 0xC8, 0x40, 0xC8, 0x8E, 0xC8, 0xC8, 0x94, 0x94, 0xC8, 0x94, 0x71, 0xBF, 0x94, 0x8E, 0x4E, 0x3E, 0x4E, 0xC1, 0xF5, 0x3E, 0x6A, 0x3E, 0xF3, 0x87, 0x6A, 0xF8, 0x85, 0x87, 0x87, 0x85, 0xF8, 0x85, 0x85, 0x85, 0x54, 0x54, 0x54, 0x54, 0x54, 0x85, 0x54, 0x85, 0x54, 0xCF, 0x06, 0xCF, 0xCB, 0xCC, 0x37, 0x37, 0x5F, 0x5F, 0xBE, 0x3D, 0x05, 0xBE, 0xBE, 0xBE, 0xC6, 0xBE, 0xF2, 0xBE, 0xC6, 0xBE, 0xC6, 0xE2, 0xC5, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x69, 0xA1, 0xF7, 0x91, 0xF1, 0xBA, 0xAF, 0x29, 0xF4, 0xF5, 0x8E, 0xEA, 0xEA, 0xC1, 0xC1, 0xC1, 0x41, 0xC1, 0xF3, 0xDA, 0xC1, 0xDA, 0xF5, 0xEA, 0xE9, 0x96, 0x71, 0xFD, 0xC2, 0x0B, 0xFD, 0xC7, 0xFD, 0xFD, 0xFD, 0xC2, 0xDD, 0x15, 0x2D, 0x40, 0x65, 0x0D, 0x40, 0xE9, 0xDF, 0x71, 0xC2, 0xFD, 0x71, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0xFD, 0xC2, 0xC2, 0x08, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0xDD, 0x15, 0xC2, 0xC2, 0xDD, 0x71, 0xDD, 0xC2, 0xC2, 0x2B, 0x0B, 0x0B, 0xFD, 0x85, 0xAF, 0x72, 0xC3, 0xB5, 0x97, 0x68, 0x04, 0xBD, 0xBD, 0xC9, 0xBD, 0x10, 0x86, 0x73, 0xB5, 0xB5, 0x81, 0x81, 0xBD, 0xBD, 0xCD, 0x68, 0xBD, 0xBD, 0x68, 0x68, 0x10, 0x4A, 0x10, 0xCD, 0xFA, 0x3A, 0xC4, 0x5E, 0x1C,
+	0x24, 0x0B, 0x0B, 0xC2, 0xC2, 0x08, 0x8E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x94, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x52, 0xDA, 0xDA, 0xC1, 0xC1, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xC1, 0x29, 0xC1, 0x5D, 0x5D, 0x5D, 0x5D, 0x8E, 0x3E, 0x4E, 0x65, 0x8E, 0x40, 0x8E, 0x40, 0x65, 0x94, 0x0D, 0x94, 0x40, 0xC8, 0xC8, 0x40, 0x94, 0x94, 0xC8, 0xC8, 0x8E, 0x71, 0x71, 0x65, 0x5D, 0x65, 0x5D, 0xF5, 0x4E, 0x3E, 0x3E, 0x40, 0x6A, 0x3E, 0x3E, 0x6A, 0xF8, 0xF8, 0x87, 0xEB, 0xF8, 0x54, 0xF8, 0xE7, 0xF8, 0x54, 0x54, 0x54, 0xF8, 0xDF, 0x54, 0x54, 0x54, 0x54, 0xCF, 0x17, 0xCF, 0x79, 0xCB, 0x37, 0xD1, 0x38, 0x61, 0xBE, 0xBE, 0xBE, 0xF2, 0xBE, 0x05, 0x59, 0xBE, 0xBE, 0xC6, 0xF2, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x05, 0xC6, 0xC6, 0xC6, 0x23, 0x69, 0x69, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0x57, 0x5C, 0x8F, 0x8F, 0xC1, 0xC1, 0x8E, 0xC1, 0xC1, 0xC1, 0xDA, 0xC1, 0xA8, 0x41, 0xC1, 0xDA, 0xC1, 0xC1, 0x3E, 0x6A, 0x4D, 0x71, 0xFD, 0xFD, 0xFD, 0xC7, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x71, 0x15, 0x0D, 0x65, 0x4E, 0xF5, 0x4E, 0x40, 0xE9, 0x15, 0x71, 0x71, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0xC2, 0x08, 0xC2, 0x15, 0x15, 0xC2, 0x08, 0xC2, 0x15, 0xC2, 0xC2, 0x15, 0xC2, 0x4D, 0xC2, 0xFD, 0xC2, 0xC2, 0xC2, 0x0B, 0x0B, 0x54, 0x6F, 0x72, 0xC3, 0xBD, 0x86, 0x83, 0x45, 0xBD, 0x83, 0x04, 0xBD, 0x86, 0x86, 0x86, 0xB5, 0x82, 0x82, 0xB4, 0x86, 0x10, 0xCD, 0x9F, 0x68, 0x04, 0x68, 0x9F, 0x9F, 0x10, 0xE1, 0x4B, 0x97, 0x6C, 0xC4, 0x8F, 0x48, 0xAA,
+	0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x16, 0x02, 0xBB, 0xBB, 0x02, 0x02, 0x16, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0xE4, 0x0B, 0xE4, 0x0B, 0x0B, 0xB1, 0x0B, 0x0B, 0x2B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x4C, 0x52, 0x6F, 0x6F, 0x6F, 0xDA, 0x6F, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xA8, 0x5D, 0x16, 0x4E, 0xC1, 0x4E, 0x3E, 0x8E, 0x3E, 0x40, 0x40, 0x8E, 0x94, 0x65, 0x0D, 0xC8, 0x40, 0x94, 0x8E, 0xC8, 0x94, 0x94, 0x94, 0x0D, 0xC8, 0x96, 0x96, 0xC8, 0x4E, 0x8E, 0x4E, 0xF5, 0x4E, 0x3E, 0x3E, 0x40, 0x40, 0x3E, 0xF3, 0x6A, 0x6A, 0x6A, 0x87, 0x87, 0x6A, 0xF8, 0x85, 0xEB, 0xE7, 0x85, 0x85, 0x85, 0xDF, 0x54, 0x54, 0x85, 0x85, 0x54, 0xCF, 0x54, 0x9D, 0x06, 0x0F, 0x0F, 0x34, 0x36, 0x5F, 0x61, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x05, 0x05, 0xC6, 0xF2, 0xBE, 0xC6, 0xC6, 0xC6, 0xC5, 0x0A, 0x05, 0x0A, 0xC6, 0x23, 0x23, 0x23, 0xA0, 0xA0, 0xA0, 0x69, 0xA0, 0x69, 0xA1, 0xA1, 0xA1, 0xA1, 0x34, 0xAF, 0xAF, 0xBB, 0xC1, 0xC1, 0xC1, 0xC1, 0xDA, 0xF3, 0x29, 0xC1, 0xA8, 0xDA, 0xDA, 0xDA, 0xEA, 0x3E, 0x96, 0x96, 0x71, 0xC2, 0xFD, 0x0B, 0xFD, 0xFD, 0xC7, 0xFD, 0xFD, 0xC2, 0xFD, 0x08, 0x96, 0x65, 0x16, 0x16, 0x16, 0xA8, 0x40, 0x6A, 0x08, 0x71, 0x0B, 0x71, 0xFD, 0x08, 0xC2, 0xC2, 0xFD, 0xFD, 0xC2, 0x08, 0xC2, 0xC2, 0xC2, 0x15, 0xDD, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0x08, 0x71, 0xFD, 0xC2, 0x0B, 0x0B, 0xFD, 0x79, 0xA8, 0x09, 0x9A, 0x10, 0x45, 0x81, 0x81, 0x81, 0x04, 0x86, 0x10, 0x86, 0x9A, 0x3F, 0x14, 0x73, 0x82, 0x82, 0xB4, 0x10, 0x10, 0xB4, 0xB4, 0xB4, 0xB6, 0xE6, 0x68, 0x4A, 0xE1, 0x12, 0x10, 0xB5, 0xC4, 0x8F, 0x98, 0xCC, 0xD1,
+	0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x8E, 0x02, 0x02, 0xBB, 0xBB, 0xBB, 0x02, 0x16, 0x65, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x94, 0x94, 0x8E, 0x02, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0xDA, 0xDA, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0xA8, 0xC1, 0xA8, 0x5D, 0x5D, 0xF5, 0x4E, 0x4E, 0x3E, 0x8E, 0x4E, 0x94, 0x8E, 0x65, 0x94, 0x65, 0x0D, 0x94, 0xC8, 0xC8, 0x40, 0x94, 0x94, 0x40, 0xC8, 0xC8, 0x96, 0xC8, 0x4E, 0x3E, 0x4E, 0x4E, 0x4E, 0x3E, 0x0D, 0x40, 0xEA, 0x3E, 0x3E, 0x6A, 0x87, 0x87, 0x87, 0x6A, 0x87, 0xE7, 0x87, 0x87, 0x3C, 0x87, 0xDF, 0x85, 0xA9, 0x85, 0x85, 0x54, 0xA9, 0x85, 0x4D, 0x17, 0x54, 0x54, 0xCF, 0xCF, 0xCB, 0xCB, 0x36, 0xA7, 0x61, 0xBE, 0xE8, 0x0A, 0xBE, 0x5F, 0xBE, 0xAE, 0xC5, 0xBE, 0x05, 0xAE, 0xC6, 0x0A, 0x05, 0x05, 0x05, 0xC6, 0x1D, 0x23, 0x23, 0x23, 0x69, 0x69, 0x69, 0xA0, 0x69, 0x69, 0x23, 0xA0, 0xA1, 0xA1, 0xA1, 0x91, 0xB9, 0x26, 0x8F, 0xA8, 0xDA, 0xC1, 0xDA, 0xC1, 0x07, 0xA8, 0xA8, 0x07, 0xDA, 0xDA, 0xC1, 0xC1, 0x3E, 0x6A, 0x4D, 0x71, 0xFD, 0xFD, 0xC2, 0x0B, 0xFD, 0xBF, 0xFD, 0xC7, 0xFD, 0x71, 0x08, 0x96, 0x40, 0x29, 0x02, 0xBB, 0x6F, 0xF3, 0x6A, 0x96, 0x71, 0x71, 0xC2, 0xFD, 0xC2, 0x08, 0xC2, 0x71, 0xC2, 0xC2, 0x08, 0xC2, 0x15, 0xDD, 0xC2, 0x08, 0xC2, 0xC2, 0xC2, 0x71, 0xC2, 0x71, 0xFD, 0xC2, 0xFD, 0x71, 0xC7, 0xFD, 0x87, 0xA3, 0x72, 0x81, 0x45, 0x45, 0x45, 0x81, 0x81, 0x73, 0x86, 0x73, 0x73, 0x86, 0x73, 0x3F, 0xB5, 0x81, 0xB4, 0x3F, 0x9F, 0x10, 0xB6, 0xB4, 0xB4, 0xB4, 0x68, 0x10, 0x4A, 0xD6, 0x12, 0x3F, 0xB2, 0x8F, 0x8B, 0xCB, 0xCB, 0xCA,
+	0x0B, 0x0B, 0xC2, 0xC8, 0x94, 0x16, 0x02, 0x52, 0xBB, 0x6F, 0xBB, 0x02, 0x29, 0x8E, 0x15, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x4C, 0x02, 0x6F, 0x6F, 0xDA, 0x07, 0xDA, 0xC1, 0xDA, 0xC1, 0x16, 0xDA, 0xC1, 0xC1, 0xC1, 0xDA, 0x5D, 0x16, 0x5D, 0xF5, 0x4E, 0x65, 0x3E, 0x4E, 0x3E, 0x8E, 0x0D, 0x40, 0x65, 0x8E, 0xC8, 0x40, 0xC8, 0x40, 0xC8, 0xC8, 0x40, 0xC8, 0x94, 0x96, 0x0D, 0x4E, 0x5D, 0x4E, 0x65, 0x4E, 0x3E, 0x3E, 0x6A, 0x40, 0x3E, 0x3E, 0x6A, 0x6A, 0x87, 0xEB, 0x87, 0xEB, 0x40, 0x87, 0x87, 0x6A, 0x85, 0x85, 0x85, 0x85, 0x4D, 0x85, 0x54, 0xDF, 0x85, 0x85, 0x54, 0x54, 0x54, 0x54, 0x54, 0xCF, 0x0F, 0x2A, 0x36, 0xA7, 0x61, 0xE8, 0xE8, 0xBE, 0xF1, 0xC5, 0xC5, 0x05, 0x05, 0xC5, 0xC6, 0x05, 0x62, 0x05, 0x05, 0xC6, 0x23, 0xF7, 0x69, 0xD5, 0xF7, 0xF7, 0xD5, 0x1D, 0x23, 0x23, 0x1D, 0x23, 0x23, 0x69, 0xA0, 0xA1, 0xA1, 0xA1, 0x74, 0x5C, 0xAF, 0xAF, 0x29, 0xDA, 0xDA, 0xC1, 0x07, 0xC1, 0xA8, 0x07, 0xDA, 0xDA, 0xDA, 0xC1, 0x3E, 0x96, 0x96, 0x08, 0xC2, 0x0B, 0xFD, 0xFD, 0x0B, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x08, 0x96, 0x0D, 0x16, 0xED, 0xEE, 0x52, 0xDA, 0xEA, 0xE9, 0x08, 0x71, 0x71, 0xC2, 0xC2, 0xC2, 0x15, 0xC2, 0xFD, 0xC2, 0x08, 0xC2, 0x15, 0x08, 0x08, 0x15, 0xC2, 0xC2, 0x08, 0xC2, 0xC2, 0x71, 0x0B, 0x71, 0x0B, 0xFD, 0xBF, 0xE7, 0xAF, 0x6C, 0xB2, 0x83, 0x6D, 0x45, 0x45, 0x81, 0x86, 0x73, 0x73, 0x3F, 0x73, 0x3F, 0xB5, 0xB5, 0xB5, 0xB4, 0x3F, 0x10, 0xBD, 0x68, 0x97, 0xB4, 0x68, 0x68, 0x10, 0x4A, 0xD6, 0x26, 0x10, 0xA3, 0xD7, 0xBA, 0xCB, 0x17, 0xCF, 0xA2,
+	0xC2, 0xC2, 0x08, 0x94, 0x16, 0x02, 0x02, 0xBB, 0xBB, 0xBB, 0xBB, 0x02, 0x16, 0x5D, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x24, 0xE4, 0x0B, 0xB1, 0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x94, 0x8E, 0x16, 0x02, 0x02, 0x52, 0x6F, 0x6F, 0x6F, 0xDA, 0xDA, 0xC1, 0xDA, 0xDA, 0xDA, 0xC1, 0xC1, 0xF5, 0xDA, 0xC1, 0xA8, 0x16, 0x5D, 0xF5, 0x4E, 0x4E, 0x3E, 0x65, 0x65, 0x65, 0x65, 0x40, 0x94, 0x65, 0xC8, 0x94, 0x40, 0x94, 0x8E, 0xC8, 0xC8, 0x40, 0xC8, 0x0D, 0x65, 0x4E, 0x5D, 0x4E, 0xEA, 0x8E, 0x3E, 0xEA, 0x3E, 0xEA, 0x6A, 0x6A, 0xEB, 0xEB, 0x6A, 0x87, 0x3E, 0x3E, 0xF3, 0x87, 0xF8, 0x85, 0xF8, 0xA9, 0x4D, 0x54, 0x54, 0x4D, 0x4D, 0x54, 0x4D, 0x54, 0x4D, 0x54, 0x54, 0x54, 0xCF, 0x06, 0x0F, 0x2A, 0x0F, 0x36, 0x61, 0x61, 0xBE, 0x7B, 0xBE, 0xBE, 0xBE, 0xE2, 0xBE, 0x05, 0x37, 0x38, 0x05, 0xC6, 0x23, 0x69, 0x69, 0xF7, 0x1D, 0x23, 0xD5, 0x1D, 0xD5, 0x23, 0x1D, 0xD5, 0x69, 0xA0, 0x69, 0x23, 0x69, 0xA0, 0xA0, 0xA1, 0xA1, 0x34, 0x8F, 0xAF, 0x8F, 0x6F, 0x6F, 0xDA, 0x07, 0x07, 0xA8, 0xA8, 0x07, 0xDA, 0xDA, 0xC1, 0xEA, 0x40, 0x96, 0xC2, 0x71, 0xFD, 0xFD, 0x0B, 0xFD, 0x0B, 0xFD, 0xFD, 0xFD, 0xC2, 0xC2, 0x96, 0x3E, 0x16, 0xEE, 0x99, 0x99, 0x02, 0x41, 0x6A, 0x96, 0x71, 0x71, 0xFD, 0x71, 0xC2, 0xC2, 0x08, 0xC2, 0xFD, 0x08, 0x08, 0xC2, 0xC2, 0x15, 0xC2, 0xC2, 0xC2, 0x08, 0x08, 0xC2, 0xC2, 0xC2, 0x71, 0xFD, 0xBF, 0xBF, 0xBB, 0x09, 0x00, 0xB2, 0x81, 0x3B, 0x45, 0x45, 0x86, 0x73, 0x14, 0x3F, 0x14, 0x3F, 0x14, 0xB5, 0xB2, 0x81, 0x3F, 0x10, 0xBD, 0xBD, 0xBD, 0xE6, 0x68, 0x10, 0xC9, 0x4A, 0xD6, 0x26, 0x26, 0x4B, 0xE3, 0x47, 0x11, 0xCF, 0x9C, 0x79, 0x53,
+	0xC2, 0xC2, 0xC8, 0x8E, 0x02, 0x02, 0xBB, 0x6F, 0x6F, 0x6F, 0xBB, 0x02, 0x29, 0x65, 0x15, 0x08, 0x2B, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x6F, 0xDA, 0x6F, 0xDA, 0xC1, 0xDA, 0xC1, 0xC1, 0xC1, 0xF5, 0x16, 0x29, 0x5D, 0xA8, 0x5D, 0xF5, 0xF5, 0x3E, 0x4E, 0x65, 0x3E, 0x40, 0x8E, 0x65, 0x65, 0x40, 0x0D, 0xC8, 0x40, 0x40, 0x8E, 0x40, 0x0D, 0x96, 0x0D, 0x4E, 0x8E, 0x4E, 0x4E, 0x8E, 0xEA, 0x40, 0x3E, 0x3E, 0x3E, 0x3E, 0x6A, 0x40, 0x40, 0x3E, 0x87, 0x3E, 0x3E, 0x3E, 0x87, 0x87, 0xDF, 0x85, 0xE7, 0x85, 0x4D, 0xA9, 0x54, 0x85, 0x85, 0xA9, 0x4D, 0x54, 0x54, 0x54, 0x54, 0x79, 0x06, 0x53, 0xCE, 0xCB, 0x2A, 0x36, 0x36, 0x61, 0x61, 0x3D, 0x61, 0xBE, 0xBE, 0x0A, 0x38, 0x34, 0x38, 0xC6, 0x1D, 0x69, 0x69, 0x69, 0x1D, 0x1D, 0xFF, 0xFF, 0x23, 0x23, 0x1D, 0x23, 0x23, 0x23, 0xD5, 0x1D, 0xD5, 0x23, 0x23, 0xA0, 0x69, 0x69, 0xA1, 0xF7, 0x2C, 0x8F, 0xAF, 0x8F, 0x6F, 0xDA, 0xDA, 0x07, 0x07, 0x07, 0xDA, 0x07, 0x6F, 0xC1, 0xEA, 0x0D, 0x15, 0x71, 0xFD, 0xC7, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC2, 0xFD, 0xC2, 0x08, 0x08, 0x40, 0xDA, 0x6B, 0x99, 0xFE, 0xEE, 0x6F, 0x3E, 0x6A, 0x08, 0x71, 0xC2, 0xFD, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x08, 0xC2, 0x15, 0xC2, 0x08, 0x08, 0xC2, 0x71, 0xC2, 0x08, 0xC2, 0xC2, 0xC2, 0xC2, 0xBF, 0xBF, 0xF3, 0x9E, 0x3A, 0x81, 0xB4, 0x83, 0x83, 0x81, 0x86, 0xBD, 0x14, 0x14, 0xCD, 0x14, 0x73, 0x68, 0xB2, 0xB4, 0xBD, 0x10, 0x9F, 0x68, 0x81, 0xB4, 0x68, 0x10, 0x9F, 0x4A, 0x26, 0xD6, 0x12, 0x26, 0x33, 0x47, 0x17, 0x11, 0xCF, 0x54, 0x4D, 0x9D,
+	0x08, 0x08, 0x8E, 0x16, 0x02, 0x02, 0xBB, 0x6F, 0x6F, 0xBB, 0x02, 0x02, 0x02, 0x65, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x94, 0x94, 0x8E, 0x02, 0x02, 0x02, 0x52, 0x6F, 0xDA, 0xDA, 0xDA, 0x6F, 0x16, 0xDA, 0xC1, 0xDA, 0xC1, 0xC1, 0xDA, 0x16, 0x16, 0xA8, 0x16, 0x5D, 0xF5, 0xF5, 0xF5, 0x4E, 0x3E, 0x65, 0x40, 0x94, 0x8E, 0x0D, 0x0D, 0x94, 0x40, 0xC8, 0x8E, 0x0D, 0x40, 0x0D, 0x0D, 0x65, 0x4E, 0x5D, 0x3E, 0xEA, 0x8E, 0x4E, 0x40, 0x8E, 0x3E, 0x6A, 0x6A, 0x3E, 0xEA, 0x3E, 0xEB, 0xF5, 0xF3, 0x3E, 0x87, 0x87, 0x6A, 0xDF, 0x87, 0xE7, 0xE7, 0x4D, 0xA9, 0x85, 0xA9, 0x4D, 0x54, 0x4D, 0x4D, 0x79, 0x54, 0x79, 0x54, 0x54, 0x79, 0xCF, 0x4F, 0x2A, 0x36, 0x36, 0x3D, 0xBE, 0x61, 0xBE, 0x7B, 0x34, 0x8C, 0xDE, 0x05, 0x1D, 0xD5, 0xA0, 0xD5, 0x23, 0x1D, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1D, 0x1D, 0xFF, 0x1D, 0x23, 0xD5, 0x23, 0x23, 0x69, 0xA0, 0xA0, 0xA1, 0xA1, 0xF7, 0xBA, 0xA3, 0xAF, 0xBB, 0x6F, 0x8F, 0x07, 0x6F, 0x07, 0xDA, 0xDA, 0xDA, 0xDA, 0x3E, 0x40, 0x96, 0x71, 0xC2, 0xFD, 0xC7, 0xFD, 0x0B, 0xC2, 0xFD, 0xFD, 0xFD, 0xFD, 0x71, 0x4D, 0x40, 0x41, 0x6B, 0x99, 0x09, 0x9E, 0x52, 0xC1, 0x40, 0x6A, 0x08, 0xC2, 0xFD, 0xC2, 0xC2, 0x15, 0xC2, 0x08, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0x08, 0xC2, 0x71, 0x71, 0x71, 0xC2, 0x71, 0xC2, 0xC7, 0x71, 0x96, 0xEE, 0xC3, 0xCD, 0x4A, 0x45, 0x81, 0x81, 0x86, 0x4B, 0xCD, 0xBD, 0xCD, 0xCD, 0x9F, 0x73, 0xB4, 0x81, 0x3F, 0x10, 0x9F, 0x3F, 0x45, 0xB4, 0xB4, 0x68, 0x10, 0xC9, 0x4A, 0x26, 0xD6, 0xD7, 0x33, 0xA6, 0x70, 0x11, 0xC0, 0x06, 0x79, 0x84, 0x4D,
+	0x15, 0x94, 0x5D, 0x02, 0x02, 0x02, 0x16, 0x6F, 0xBB, 0xBB, 0x02, 0x02, 0x5D, 0x5D, 0xC8, 0x08, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0x0B, 0xC2, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x4C, 0x02, 0x6F, 0x6F, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0x16, 0xA8, 0x5D, 0xC1, 0x5D, 0xF5, 0xF5, 0xF3, 0x4E, 0x65, 0x3E, 0x40, 0x8E, 0x0D, 0x65, 0x40, 0x65, 0xC8, 0x40, 0x40, 0x0D, 0x0D, 0x0D, 0x65, 0x8E, 0x5D, 0x5D, 0x65, 0x3E, 0xEA, 0x3E, 0xEA, 0x3E, 0x3E, 0x6A, 0x40, 0xEA, 0xF3, 0x3E, 0x3E, 0xF3, 0xF3, 0xEB, 0x6A, 0xA9, 0xE7, 0x6A, 0x3C, 0x85, 0x4D, 0x54, 0x54, 0x4D, 0x54, 0x54, 0x54, 0x54, 0x06, 0x54, 0x54, 0x4D, 0x79, 0x54, 0x58, 0x79, 0x53, 0x2A, 0x36, 0x61, 0x7A, 0x5F, 0x5F, 0x34, 0xDE, 0x37, 0x05, 0xAE, 0xF0, 0xF0, 0xD5, 0x1D, 0x23, 0x1D, 0x23, 0x69, 0x69, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0xFF, 0x23, 0xD5, 0x1D, 0xD5, 0xA0, 0x69, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0x46, 0x5E, 0x5A, 0x52, 0x52, 0x6F, 0x6F, 0x6F, 0x6F, 0x07, 0x6F, 0x6F, 0xC1, 0xEA, 0x40, 0x4D, 0x71, 0x71, 0xC7, 0xFD, 0xFD, 0x0B, 0xFD, 0xFD, 0xFD, 0x0B, 0xC2, 0x71, 0x71, 0xF8, 0x41, 0x8D, 0x9E, 0x3A, 0xC3, 0x6B, 0x07, 0xF3, 0x40, 0x15, 0x08, 0xFD, 0x71, 0xFD, 0x71, 0x71, 0xC2, 0x15, 0x08, 0xC2, 0x08, 0xC2, 0x08, 0x71, 0xC2, 0xFD, 0x71, 0xFD, 0x0B, 0xC2, 0xC7, 0x08, 0x6F, 0x72, 0x81, 0x4B, 0x4A, 0xBD, 0x45, 0xB5, 0x73, 0x3F, 0xBD, 0x3F, 0xBD, 0x3F, 0x73, 0xB4, 0x81, 0x68, 0x10, 0x10, 0x10, 0x45, 0xB4, 0x73, 0xB4, 0xBD, 0x9F, 0x9F, 0xD6, 0x26, 0x12, 0xE3, 0xA6, 0x70, 0xE0, 0x11, 0xCF, 0x54, 0x85, 0x4D, 0xDC,
+	0x0D, 0x4E, 0x16, 0x02, 0x02, 0x16, 0x16, 0x6F, 0x6F, 0xBB, 0x02, 0x02, 0x29, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x24, 0x0B, 0xE4, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x94, 0x94, 0x8E, 0x16, 0x02, 0x02, 0x02, 0x6F, 0xDA, 0x6F, 0xC1, 0xDA, 0xC1, 0xDA, 0x16, 0xDA, 0xC1, 0xDA, 0xC1, 0x29, 0x16, 0xA8, 0x5D, 0x5D, 0xF5, 0xF5, 0xF5, 0x40, 0x4E, 0x65, 0x8E, 0x0D, 0x65, 0x94, 0x65, 0x8E, 0xC8, 0x0D, 0x0D, 0xC8, 0x0D, 0x40, 0x65, 0x5D, 0xF5, 0x65, 0xEA, 0x3E, 0x40, 0x4E, 0xEA, 0x40, 0x3E, 0xEA, 0x3E, 0x3E, 0x3E, 0xF3, 0xF5, 0xF3, 0x3E, 0x87, 0x85, 0xF8, 0x85, 0x85, 0xF8, 0x4D, 0x54, 0x54, 0x54, 0x54, 0x4D, 0x79, 0x54, 0x4D, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0xCF, 0x54, 0xC0, 0xA2, 0xA4, 0xA7, 0x61, 0x36, 0x37, 0x64, 0xDE, 0xF2, 0x1D, 0xD5, 0x1D, 0xFF, 0x57, 0xFF, 0x23, 0xF7, 0xF7, 0xF7, 0x1D, 0x23, 0xFF, 0x74, 0x74, 0xFF, 0x74, 0xFF, 0x23, 0x69, 0x95, 0x95, 0x77, 0x69, 0x23, 0x69, 0xA0, 0xA0, 0xA1, 0xA0, 0xA1, 0x76, 0xA3, 0xAF, 0xAF, 0x52, 0x52, 0x8F, 0xBB, 0x6F, 0x6F, 0x29, 0xDA, 0x3E, 0x6A, 0x96, 0x71, 0xC2, 0xBF, 0xFD, 0xC7, 0xFD, 0x0B, 0xC2, 0xDC, 0xFD, 0xFD, 0xC2, 0x71, 0x40, 0x41, 0x6B, 0x86, 0x3A, 0xC3, 0x8D, 0x52, 0x41, 0x3E, 0x6A, 0x15, 0x71, 0xC2, 0xFD, 0xC2, 0x71, 0xC2, 0x71, 0x08, 0xC2, 0x08, 0x08, 0xC2, 0x71, 0x71, 0x71, 0xC2, 0x71, 0xC2, 0xFD, 0xBF, 0x0D, 0x99, 0x3A, 0x81, 0x83, 0xFB, 0xBD, 0x86, 0x82, 0x14, 0xBD, 0xCD, 0x9F, 0x3F, 0x86, 0x81, 0x81, 0x81, 0xBD, 0x10, 0x10, 0xBD, 0x81, 0x73, 0xCD, 0x68, 0x68, 0x0E, 0x4A, 0x26, 0x12, 0xE3, 0xA6, 0x70, 0x11, 0xCB, 0x11, 0x79, 0x79, 0x9D, 0x79, 0xDB,
+	0xF5, 0x16, 0x02, 0x02, 0x02, 0x02, 0x6F, 0x6F, 0x6F, 0xBB, 0x02, 0x02, 0x16, 0x5D, 0x08, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0xED, 0x02, 0x6F, 0x6F, 0xDA, 0x07, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0xDA, 0x16, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0xF5, 0x4E, 0x4E, 0x94, 0x40, 0x65, 0x94, 0x65, 0x65, 0x94, 0x0D, 0x8E, 0xC8, 0x65, 0xC8, 0x96, 0x65, 0x4E, 0x65, 0x4E, 0x3E, 0xEA, 0x8E, 0x65, 0x3E, 0x94, 0x40, 0x3E, 0x3E, 0x3E, 0xEA, 0x3E, 0x3E, 0x3E, 0x3C, 0x87, 0xEB, 0xDF, 0x6A, 0x85, 0xDF, 0x85, 0xA9, 0xDF, 0x85, 0xDF, 0x4D, 0x54, 0x06, 0x4D, 0xC0, 0x54, 0xA9, 0x54, 0x54, 0x54, 0x4D, 0x06, 0x0F, 0xC0, 0x2A, 0xA7, 0xA4, 0xCB, 0x64, 0xAC, 0x05, 0xF1, 0x1D, 0xD5, 0xFF, 0xF0, 0x1D, 0xFF, 0x1D, 0x91, 0x1D, 0x23, 0xFF, 0xFF, 0x74, 0xC6, 0x23, 0x74, 0xFF, 0x23, 0x23, 0x23, 0x23, 0x69, 0xFF, 0xFF, 0x1D, 0x23, 0x23, 0x69, 0x69, 0xA0, 0xA0, 0xA1, 0xF7, 0x34, 0xE3, 0xAF, 0xD7, 0xAF, 0x02, 0x02, 0x6F, 0x6F, 0x52, 0xA8, 0x3E, 0xC8, 0x08, 0x08, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x0B, 0xC2, 0x71, 0x71, 0x40, 0xDA, 0x52, 0x81, 0xE5, 0x86, 0x9E, 0x5A, 0x6F, 0xF3, 0x6A, 0x15, 0x71, 0x71, 0xFD, 0xC2, 0xFD, 0x71, 0xC2, 0x08, 0x08, 0x08, 0x71, 0x71, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xFD, 0xCA, 0x96, 0x52, 0x72, 0xFA, 0xF9, 0x83, 0x83, 0x81, 0xBD, 0x9E, 0x9E, 0x4B, 0x86, 0xBD, 0xCD, 0x81, 0xE5, 0x81, 0x73, 0x4B, 0x4B, 0x81, 0x83, 0x3F, 0x10, 0xBD, 0x68, 0xC9, 0xC9, 0x10, 0x26, 0x33, 0xA6, 0x48, 0x2E, 0x11, 0xCF, 0x9D, 0x84, 0x9C, 0xC0, 0x90, 0x90,
+	0x29, 0xBB, 0x02, 0x02, 0x02, 0x16, 0x6F, 0x16, 0xDA, 0x6F, 0xBB, 0x02, 0x02, 0x65, 0x94, 0x08, 0x2B, 0xC2, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x94, 0x94, 0x94, 0x02, 0x02, 0x02, 0x52, 0xBB, 0x6F, 0xDA, 0xDA, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0x29, 0xA8, 0x5D, 0x5D, 0x16, 0x4E, 0x4E, 0x65, 0x4E, 0x65, 0x40, 0x65, 0x65, 0x94, 0x65, 0x65, 0xC8, 0x0D, 0x94, 0xC8, 0x08, 0x65, 0x8E, 0x40, 0x3E, 0x3E, 0x3E, 0x3E, 0x4E, 0x3E, 0x4E, 0x65, 0x3E, 0x3E, 0x3E, 0x3E, 0xEB, 0x87, 0x87, 0xEB, 0x3E, 0x6A, 0x6A, 0x3C, 0x6A, 0x6A, 0x85, 0xDF, 0x4D, 0x4D, 0x4D, 0xA9, 0x54, 0x4D, 0x54, 0x54, 0x4D, 0x54, 0x17, 0xA9, 0x54, 0x17, 0x06, 0x54, 0xCF, 0x0F, 0xA4, 0x92, 0x55, 0x47, 0x8C, 0xC5, 0xC6, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xD5, 0x23, 0xFF, 0x57, 0x57, 0x74, 0x91, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0x23, 0xFF, 0x23, 0xFF, 0x74, 0x1D, 0x1D, 0x1D, 0x23, 0x69, 0x23, 0x69, 0x69, 0x69, 0xA0, 0xA0, 0xA0, 0x23, 0xAC, 0x26, 0xA3, 0xAF, 0xBB, 0x52, 0x8F, 0x6F, 0x07, 0x3E, 0x6A, 0x96, 0x08, 0xC2, 0x0B, 0xC7, 0xFD, 0xFD, 0xC7, 0xFD, 0xDD, 0xFD, 0x0B, 0x71, 0x96, 0x96, 0x07, 0x52, 0xC3, 0x82, 0x82, 0xC3, 0x9E, 0x52, 0x07, 0x3E, 0x40, 0x15, 0x71, 0xC2, 0xFD, 0xC2, 0xC2, 0x71, 0xC2, 0x71, 0x71, 0x71, 0xC2, 0x71, 0xC2, 0xC2, 0xC2, 0x0B, 0xBF, 0x71, 0xDA, 0x99, 0xE5, 0xF9, 0xFB, 0x83, 0xE6, 0xB4, 0x4B, 0x4B, 0x8D, 0x86, 0xCD, 0xBD, 0x86, 0x45, 0x81, 0x73, 0xCD, 0x4B, 0xBD, 0xB4, 0x81, 0xBD, 0x10, 0x9F, 0x10, 0x4A, 0x4A, 0x10, 0x26, 0x5E, 0x8B, 0x2E, 0xCE, 0xCB, 0xCF, 0x9C, 0x9C, 0xCF, 0x90, 0x36, 0x90,
+	0x6F, 0xBB, 0xBB, 0x6F, 0x16, 0x6F, 0x6F, 0x6F, 0xDA, 0x6F, 0x02, 0x02, 0x5D, 0x5D, 0x94, 0x15, 0x2B, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x2B, 0x08, 0x94, 0x8E, 0x02, 0x02, 0xED, 0x02, 0x02, 0x6F, 0x6F, 0x6F, 0xC1, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0x5D, 0xC1, 0x5D, 0x5D, 0x5D, 0x4E, 0x3E, 0x4E, 0x65, 0x65, 0x94, 0x65, 0x65, 0x40, 0x65, 0xC8, 0x0D, 0x65, 0x96, 0x71, 0x8E, 0x4E, 0x4E, 0x4E, 0x3E, 0x3E, 0x3E, 0x4E, 0x4E, 0x65, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x40, 0x6A, 0xEB, 0x87, 0x87, 0x6A, 0x85, 0xDF, 0xE7, 0x6A, 0x85, 0x85, 0x54, 0x54, 0xA9, 0x54, 0x54, 0x54, 0x54, 0x4D, 0x54, 0x54, 0x84, 0x85, 0x54, 0x54, 0x54, 0x17, 0x54, 0xA2, 0xA2, 0x98, 0x64, 0x38, 0xF1, 0xE2, 0xC6, 0xC6, 0xF0, 0xF0, 0xFF, 0xF0, 0xFF, 0x1D, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0x23, 0x23, 0xFF, 0xFF, 0x23, 0x23, 0xFF, 0x1D, 0x23, 0x23, 0x23, 0x23, 0xA0, 0x69, 0xA0, 0x69, 0xA0, 0xA0, 0xA1, 0xA1, 0xA0, 0xDE, 0x8F, 0x5A, 0x52, 0x52, 0x02, 0x6F, 0x29, 0xEA, 0xC8, 0x96, 0x08, 0xFD, 0xFD, 0xFD, 0x0B, 0xFD, 0xFD, 0x0B, 0xDC, 0xFD, 0xFD, 0x71, 0x71, 0xC8, 0x41, 0x52, 0x9E, 0xC3, 0x82, 0x3A, 0xC3, 0xEE, 0x52, 0xC1, 0x40, 0x15, 0x15, 0xC2, 0x71, 0xC2, 0xC2, 0xC2, 0x08, 0x15, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0xC2, 0xC2, 0x0B, 0xBF, 0x40, 0x99, 0x3A, 0xE5, 0xF9, 0xF9, 0xB6, 0xB4, 0x73, 0xCD, 0x9E, 0x9E, 0x4B, 0xBD, 0xCD, 0x81, 0x81, 0x81, 0xBD, 0x4B, 0x73, 0x3F, 0xB4, 0xB4, 0x3F, 0x10, 0x9F, 0x10, 0x9F, 0x4B, 0x26, 0xE3, 0x47, 0x2E, 0xE0, 0x17, 0xCF, 0x9C, 0x54, 0xCE, 0x2A, 0xDB, 0x2A, 0x36,
+	0x6F, 0x6F, 0x6F, 0x29, 0x6F, 0x02, 0x16, 0x6F, 0x6F, 0x6F, 0xBB, 0x02, 0x29, 0x65, 0x94, 0x15, 0xC2, 0x0B, 0x0B, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x94, 0x94, 0x8E, 0x16, 0x02, 0x4C, 0x52, 0xBB, 0x6F, 0xDA, 0x6F, 0x16, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0x16, 0x29, 0xA8, 0xF5, 0xC1, 0xF5, 0xF5, 0x4E, 0x4E, 0x3E, 0x4E, 0x40, 0x8E, 0x40, 0x40, 0x0D, 0x65, 0x65, 0x94, 0x0D, 0x96, 0x6A, 0x8E, 0x4E, 0x4E, 0xF5, 0xEA, 0x3E, 0x3E, 0x3E, 0x4E, 0x4E, 0x65, 0xEA, 0x3E, 0x3E, 0x3E, 0x3E, 0xEB, 0x3E, 0x3E, 0x6A, 0xDF, 0x85, 0x85, 0xF8, 0x85, 0x4D, 0x54, 0x4D, 0x54, 0x4D, 0x54, 0x4D, 0x54, 0x54, 0x54, 0x54, 0xDF, 0x85, 0x54, 0x54, 0x4D, 0x17, 0x17, 0x9C, 0x58, 0x98, 0x67, 0x5F, 0x57, 0xF0, 0xC5, 0x57, 0xC6, 0xC6, 0xC5, 0xF0, 0xC6, 0xC5, 0xC6, 0x74, 0xF0, 0xFF, 0x91, 0x1D, 0xFF, 0x74, 0xC6, 0x1D, 0x74, 0x74, 0x23, 0x23, 0x23, 0x1D, 0xF7, 0x23, 0x23, 0x1D, 0x69, 0x1D, 0x69, 0x69, 0x23, 0x69, 0x69, 0xA0, 0xA0, 0xF7, 0xA1, 0xA0, 0x34, 0xEE, 0x99, 0xED, 0xAF, 0x52, 0x16, 0xC1, 0x0D, 0x96, 0x08, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0x71, 0x08, 0x96, 0xDA, 0x52, 0x86, 0xC3, 0x82, 0xE5, 0xE5, 0x99, 0xEE, 0x29, 0x4E, 0x6A, 0x15, 0x15, 0xFD, 0xFD, 0xC2, 0xC2, 0x15, 0x15, 0x15, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC7, 0xBF, 0x96, 0x02, 0x72, 0xE5, 0x81, 0x81, 0x83, 0xB4, 0xB4, 0x3F, 0x4B, 0x4B, 0x86, 0x9E, 0xBD, 0x3F, 0x81, 0x81, 0x86, 0xCD, 0xCD, 0x81, 0xB4, 0x45, 0x3F, 0x10, 0x9F, 0xBD, 0x9F, 0xBD, 0xD6, 0xE3, 0x7D, 0x48, 0x11, 0xE0, 0x9D, 0x9C, 0x9C, 0x79, 0x2A, 0x36, 0x36, 0x37, 0x2A,
+	0xBB, 0xBB, 0x6F, 0x6F, 0x6F, 0x16, 0x6F, 0x16, 0x6F, 0x6F, 0x6F, 0x29, 0x16, 0x65, 0x2D, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x0B, 0x24, 0x24, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x52, 0x02, 0xBB, 0x6F, 0x6F, 0x29, 0x16, 0x16, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0x16, 0x16, 0x5D, 0xDA, 0x5D, 0xC1, 0xF5, 0x8E, 0x3E, 0x8E, 0x65, 0x65, 0x94, 0x65, 0x40, 0x65, 0x94, 0x65, 0x65, 0xFD, 0x96, 0x8E, 0x5D, 0x4E, 0x16, 0x5D, 0xF5, 0x3E, 0x3E, 0x3E, 0x65, 0x4E, 0x3E, 0x65, 0xEA, 0x3E, 0x3E, 0x3E, 0x6A, 0x6A, 0x6A, 0xDF, 0x4D, 0xF8, 0x85, 0x4D, 0x54, 0x79, 0x54, 0x54, 0x9C, 0x54, 0x54, 0x54, 0x54, 0x4D, 0x4D, 0x85, 0x4D, 0x54, 0xF8, 0x85, 0x06, 0x17, 0xE7, 0x98, 0x98, 0x55, 0xBE, 0xE2, 0xF1, 0xF1, 0xF0, 0xFF, 0xE2, 0x0A, 0xC5, 0xC5, 0xC6, 0x0A, 0x91, 0xFF, 0x74, 0xFF, 0x74, 0x74, 0xF0, 0xFF, 0x1D, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1D, 0x23, 0x1D, 0x23, 0x1D, 0x23, 0x23, 0x23, 0x23, 0x23, 0xA0, 0x69, 0x69, 0xA0, 0x23, 0xA1, 0xA1, 0x1D, 0xB9, 0xC4, 0x4C, 0xAF, 0x02, 0xC1, 0xC1, 0xE9, 0x96, 0x15, 0xC2, 0xFD, 0x0B, 0xC2, 0xC7, 0xFD, 0xFD, 0xDC, 0xFD, 0xFD, 0x08, 0x08, 0xC8, 0xC1, 0x52, 0x99, 0xC3, 0x81, 0xE5, 0xC3, 0xFE, 0x99, 0x02, 0x16, 0x40, 0x6A, 0x96, 0x08, 0xC2, 0xC2, 0xC2, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x71, 0x71, 0xFD, 0xBF, 0x71, 0x16, 0x72, 0xE5, 0xC3, 0x81, 0x81, 0x81, 0xB4, 0x73, 0xBD, 0xCD, 0x73, 0x73, 0xBD, 0xCD, 0xB4, 0x81, 0x86, 0x9F, 0xCD, 0x45, 0x81, 0xB4, 0x86, 0x9F, 0x10, 0x9F, 0xBD, 0xBD, 0x3F, 0x33, 0x7D, 0x48, 0xCC, 0x11, 0x9D, 0x54, 0x9C, 0x9C, 0xCE, 0xA2, 0xA2, 0x36, 0x2A, 0x36,
+	0xBB, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xDA, 0x07, 0xDA, 0x6F, 0x6F, 0xBB, 0x29, 0x65, 0x0D, 0x15, 0xC2, 0xC2, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x94, 0x5D, 0x29, 0x02, 0xED, 0x02, 0x6F, 0x6F, 0x6F, 0x29, 0x16, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0xDA, 0x5D, 0xDA, 0xC1, 0xC1, 0xF5, 0x4E, 0x4E, 0x3E, 0x4E, 0x40, 0x8E, 0x40, 0x3E, 0x94, 0x4E, 0xA8, 0xA9, 0x7F, 0x96, 0x29, 0x5D, 0x4E, 0xF5, 0xF5, 0xF5, 0x3E, 0x3E, 0x3E, 0x3E, 0x4E, 0x65, 0x3E, 0x3E, 0xEA, 0x3E, 0x3E, 0x40, 0x6A, 0x6A, 0x85, 0x85, 0x85, 0xDF, 0x54, 0x4D, 0x79, 0x4D, 0xE7, 0x98, 0x54, 0x54, 0x4D, 0x54, 0x54, 0x54, 0xDF, 0x4D, 0x54, 0xF8, 0x85, 0xF8, 0x85, 0x87, 0x64, 0x61, 0xE8, 0x61, 0xBE, 0x32, 0xF0, 0x91, 0xC5, 0xC5, 0xC5, 0xC5, 0x0A, 0xC5, 0xC5, 0x0A, 0x0A, 0x0A, 0x74, 0x74, 0xFF, 0x1D, 0x23, 0x23, 0x91, 0x23, 0x23, 0x1D, 0xFF, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x69, 0x1D, 0x69, 0x1D, 0x23, 0x69, 0x23, 0xA0, 0xA0, 0x69, 0xA1, 0x69, 0xA0, 0xA1, 0x0A, 0x26, 0x14, 0x4C, 0x52, 0x16, 0x16, 0x6A, 0xDF, 0x15, 0xFD, 0xC2, 0xFD, 0x0B, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC2, 0x08, 0xC8, 0xC1, 0x52, 0x9E, 0xC3, 0x81, 0x81, 0xC3, 0xE5, 0x99, 0xEE, 0x02, 0x8E, 0x96, 0x96, 0x08, 0xC2, 0xC2, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x71, 0x71, 0xFD, 0xBF, 0xBF, 0x40, 0x99, 0x3A, 0xE5, 0x81, 0x81, 0x81, 0x86, 0xBD, 0x3F, 0x4B, 0xCD, 0xCD, 0xCD, 0xBD, 0x73, 0xB4, 0x81, 0xCD, 0x10, 0x3F, 0x81, 0x81, 0x86, 0xBD, 0xCD, 0xBD, 0xBD, 0x68, 0x9F, 0x12, 0xA6, 0x48, 0xCC, 0x11, 0x58, 0x98, 0x9C, 0x9C, 0xCF, 0x2A, 0xA2, 0x36, 0x2A, 0x36, 0x37,
+	0x6F, 0x8F, 0x6F, 0x6F, 0x16, 0x6F, 0x6F, 0x6F, 0xDA, 0x6F, 0x6F, 0xBB, 0x16, 0x4E, 0x2D, 0x15, 0x2B, 0xC2, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0xC2, 0xC2, 0x15, 0x94, 0x8E, 0x02, 0x02, 0x52, 0x52, 0xBB, 0x6F, 0x6F, 0x6F, 0x16, 0x16, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xC1, 0xDA, 0xC1, 0xA8, 0xC1, 0xC1, 0xF5, 0x4E, 0x65, 0x3E, 0x40, 0x65, 0x3E, 0x8E, 0x0D, 0x4E, 0xF6, 0x5D, 0xE4, 0x7F, 0x94, 0x29, 0x5D, 0x8E, 0x4E, 0xF5, 0xF5, 0x65, 0x3E, 0x4E, 0x4E, 0x65, 0x3E, 0x3E, 0x8E, 0xEA, 0x3E, 0x3E, 0x6A, 0xEB, 0x6A, 0x6A, 0x85, 0xDF, 0x54, 0x4D, 0x54, 0x4D, 0x85, 0xE7, 0x6E, 0xA9, 0x54, 0x54, 0x54, 0x4D, 0x54, 0x4D, 0xEB, 0xEB, 0x85, 0xEB, 0x87, 0x8B, 0x11, 0xE8, 0x32, 0xF1, 0x7B, 0xBE, 0xC5, 0x57, 0xC5, 0xF1, 0x0A, 0x57, 0xC6, 0x0A, 0xC5, 0x0A, 0xBE, 0x05, 0x0A, 0x74, 0x1D, 0x1D, 0x23, 0x23, 0x91, 0xFF, 0x23, 0x23, 0xFF, 0xFF, 0x23, 0x69, 0x23, 0x23, 0x1D, 0x23, 0x1D, 0x1D, 0x23, 0x23, 0x23, 0xC6, 0xA0, 0x69, 0x23, 0xA0, 0xA1, 0xA0, 0xA0, 0xA0, 0xAC, 0xD7, 0x4C, 0xED, 0x02, 0x16, 0x0D, 0xDF, 0x15, 0xFD, 0xFD, 0xC2, 0xFD, 0xFD, 0xFD, 0xC7, 0xFD, 0xBF, 0xC2, 0x08, 0x08, 0xC8, 0xC1, 0x6F, 0x9E, 0x81, 0x81, 0x81, 0xC3, 0xE5, 0xC3, 0x99, 0xED, 0xBB, 0xC1, 0x40, 0xC8, 0x15, 0xC2, 0xC2, 0x08, 0x15, 0x15, 0x15, 0x71, 0xFD, 0xBF, 0xBF, 0x96, 0x6F, 0xE5, 0x09, 0x45, 0x81, 0x81, 0x45, 0xBD, 0x9E, 0xCD, 0x9E, 0xCD, 0xBD, 0xCD, 0xCD, 0xB4, 0xB4, 0x68, 0x9F, 0xCD, 0x68, 0xB4, 0xBD, 0x10, 0x9F, 0x3F, 0xB4, 0x83, 0x3F, 0x26, 0x20, 0x70, 0x11, 0x11, 0xE0, 0x84, 0x84, 0x9C, 0xCF, 0x2A, 0x2A, 0x2A, 0x36, 0x2A, 0x36, 0x90,
+	0x6F, 0x6F, 0x6F, 0x29, 0x6F, 0x6F, 0x16, 0x6F, 0x6F, 0xBB, 0xBB, 0x02, 0x29, 0x65, 0x2D, 0x08, 0xC2, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x29, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x6F, 0x6F, 0x16, 0x16, 0x16, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0xC1, 0xA8, 0xC1, 0xF5, 0x4E, 0xEA, 0x94, 0x3E, 0x40, 0x8E, 0x3E, 0x65, 0x4E, 0x4E, 0x65, 0xD2, 0xDB, 0x16, 0x4E, 0x5D, 0xF5, 0x4E, 0x3E, 0x4E, 0xF5, 0xF3, 0x4E, 0x65, 0x8E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0xF8, 0xA9, 0x54, 0x54, 0x4D, 0x85, 0xE7, 0x85, 0x54, 0x54, 0x54, 0x4D, 0x54, 0xF8, 0xF8, 0x85, 0xF8, 0x87, 0xF4, 0xF4, 0x58, 0x0F, 0x88, 0x88, 0xF1, 0xC5, 0x57, 0xF1, 0x0A, 0x05, 0xBE, 0xC5, 0xE2, 0xC5, 0xBE, 0x05, 0xBE, 0xC5, 0x0A, 0xFF, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0xF0, 0x23, 0x23, 0x1D, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0xA0, 0xA0, 0x69, 0xA0, 0xA0, 0xA0, 0xA1, 0x23, 0xBA, 0xA3, 0xED, 0x02, 0x16, 0x3E, 0xDF, 0x15, 0xDD, 0xFD, 0xFD, 0xC2, 0x0B, 0xFD, 0xBF, 0xFD, 0xFD, 0xFD, 0x08, 0x08, 0x40, 0xDA, 0x52, 0x9E, 0x9A, 0x86, 0x81, 0x81, 0x45, 0x86, 0xFE, 0x99, 0x6B, 0x6F, 0xC1, 0xF3, 0xA9, 0x79, 0x53, 0xC0, 0x79, 0x54, 0xA9, 0x79, 0x06, 0x71, 0x13, 0xEA, 0x9A, 0x3A, 0x45, 0xBD, 0x83, 0x45, 0xBD, 0x9E, 0x9E, 0x4B, 0x45, 0x86, 0xCD, 0x9F, 0x68, 0xB4, 0x45, 0xCD, 0x9F, 0xCD, 0x68, 0xBD, 0x10, 0x10, 0x10, 0xBD, 0xF9, 0xF9, 0x10, 0x33, 0x70, 0x13, 0xCC, 0xCF, 0x54, 0x98, 0x9D, 0xCE, 0xC0, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x36, 0x90,
+	0x6F, 0x8F, 0x29, 0x6F, 0x29, 0x29, 0x6F, 0x6F, 0x6F, 0x6F, 0xBB, 0xBB, 0x29, 0x5D, 0x94, 0xC2, 0xC2, 0xC2, 0x24, 0x0B, 0x24, 0xC7, 0x24, 0xC7, 0xC7, 0x24, 0x24, 0xC2, 0xC2, 0x08, 0x94, 0x8E, 0xBB, 0x02, 0x52, 0x6F, 0xBB, 0x6F, 0xDA, 0x6F, 0x6F, 0x29, 0x16, 0x16, 0xDA, 0xF5, 0xC1, 0xC1, 0xC1, 0xA8, 0xC1, 0xF5, 0xF5, 0xF3, 0x8E, 0x4E, 0x8E, 0x8E, 0x40, 0x3E, 0x8E, 0x3E, 0x65, 0x29, 0xDC, 0xD2, 0xFD, 0x5D, 0x5D, 0x16, 0xF5, 0xF5, 0x3E, 0xF5, 0xF3, 0x4E, 0x4E, 0x3E, 0x40, 0x8E, 0x40, 0x3E, 0x40, 0x3E, 0x40, 0x40, 0xF8, 0x6A, 0xDF, 0x54, 0x4D, 0x54, 0xA9, 0xE7, 0xA9, 0xE7, 0xA9, 0xA9, 0x4D, 0x4D, 0x06, 0x54, 0x85, 0xF8, 0x85, 0x85, 0x5C, 0x5E, 0x55, 0x7A, 0xE8, 0x88, 0xBE, 0xF1, 0xE2, 0xF1, 0x05, 0x7B, 0xBE, 0xF1, 0xC5, 0xBE, 0x05, 0x05, 0xBE, 0x57, 0xE2, 0xE2, 0xFF, 0x74, 0xC5, 0xC5, 0xFF, 0x23, 0x23, 0x23, 0x23, 0xFF, 0x74, 0x23, 0x1D, 0x23, 0x23, 0x1D, 0x23, 0x74, 0x74, 0xFF, 0x69, 0x23, 0x23, 0x69, 0x1D, 0x23, 0x1D, 0x69, 0x69, 0x69, 0xA0, 0xA0, 0xA0, 0xA1, 0x23, 0xD7, 0x99, 0x02, 0x16, 0x40, 0xDF, 0x4D, 0x71, 0xC2, 0xFD, 0xFD, 0xFD, 0xFD, 0xBF, 0xC7, 0xFD, 0xFD, 0x71, 0x08, 0x40, 0xF5, 0x6F, 0x9E, 0x86, 0x81, 0x81, 0x86, 0x81, 0x81, 0xE5, 0xE5, 0xE5, 0x14, 0x8F, 0x64, 0xF2, 0xE2, 0x77, 0xD5, 0xE2, 0x36, 0x5F, 0x32, 0x61, 0x48, 0x41, 0x9E, 0xE5, 0xE5, 0x81, 0x9F, 0x04, 0x45, 0x10, 0x10, 0x4B, 0x9E, 0x86, 0x86, 0x10, 0x10, 0x68, 0x9F, 0x3F, 0xCD, 0xB4, 0xB4, 0xBD, 0xCD, 0x9F, 0xBD, 0xBD, 0x04, 0xF9, 0xB5, 0x12, 0xB9, 0x13, 0x11, 0xCE, 0x9C, 0x58, 0x84, 0x79, 0x0F, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x90, 0x90, 0x90,
+	0x6F, 0x29, 0x8F, 0x29, 0x6F, 0x6F, 0x16, 0x6F, 0x6F, 0x6F, 0xBB, 0x02, 0x02, 0x5D, 0x2D, 0x08, 0xC2, 0x0B, 0x0B, 0xC7, 0xC7, 0xC7, 0x24, 0xC7, 0x0B, 0xC7, 0x24, 0x0B, 0xC2, 0xC2, 0xC8, 0x8E, 0xDA, 0x52, 0x02, 0x52, 0x52, 0xBB, 0x6F, 0x29, 0x29, 0x6F, 0x16, 0xDA, 0x16, 0xDA, 0xC1, 0xDA, 0xDA, 0xC1, 0xA8, 0xF5, 0xF5, 0x4E, 0x4E, 0xEA, 0x40, 0x8E, 0x8E, 0xEA, 0x8E, 0x4E, 0x5D, 0xF6, 0xD2, 0xD2, 0x15, 0x29, 0x5D, 0xF3, 0xC1, 0xC1, 0xC1, 0x5D, 0x65, 0x65, 0x4E, 0x4E, 0x40, 0x8E, 0x8E, 0x40, 0x40, 0x3E, 0x40, 0x96, 0xF8, 0xDF, 0xA9, 0x4D, 0xE7, 0xA9, 0x4D, 0x4D, 0x54, 0xA9, 0x4D, 0xDF, 0x4D, 0x4D, 0xDF, 0xEB, 0xEB, 0x85, 0x87, 0xA8, 0xF4, 0xCC, 0xA4, 0xA7, 0xE8, 0x57, 0xF1, 0xBE, 0x61, 0xBE, 0xF1, 0xE2, 0xF1, 0x05, 0x38, 0x38, 0x7B, 0xBE, 0x57, 0xC5, 0xC5, 0x57, 0xFF, 0xF0, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0x91, 0x23, 0xFF, 0x23, 0x1D, 0x23, 0x1D, 0xFF, 0x74, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x69, 0x69, 0x69, 0x1D, 0x23, 0x23, 0x23, 0x23, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xB9, 0x72, 0x02, 0xBB, 0x3E, 0xE9, 0x4D, 0xC2, 0xFD, 0xFD, 0xC2, 0x0B, 0xFD, 0xFD, 0xFD, 0xBF, 0x0B, 0x71, 0x08, 0x40, 0xC1, 0x8F, 0x99, 0x86, 0x86, 0x45, 0xBD, 0xF9, 0xE5, 0x6D, 0xB7, 0xFA, 0x26, 0x38, 0x69, 0xD5, 0xB3, 0x1D, 0x77, 0xF0, 0xFF, 0xD5, 0x95, 0xF0, 0x0A, 0xD7, 0xE5, 0xE5, 0x83, 0xE6, 0x04, 0x68, 0xBD, 0x10, 0x10, 0x9E, 0xBD, 0x9E, 0x10, 0xCD, 0x9F, 0x68, 0xCD, 0x9F, 0xCD, 0xB4, 0xB4, 0x3F, 0x10, 0x10, 0xBD, 0x81, 0x81, 0x73, 0xD7, 0xA6, 0x48, 0x11, 0x11, 0xE0, 0x54, 0x9D, 0x9D, 0xCE, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x90, 0x90, 0x90, 0x90,
+	0x6F, 0x6F, 0x6F, 0x6F, 0xBB, 0xBB, 0xBB, 0x6F, 0x6F, 0x6F, 0x02, 0x02, 0x29, 0x5D, 0x0D, 0x08, 0xC2, 0x0B, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x0B, 0x24, 0x0B, 0xFD, 0xC2, 0x08, 0x94, 0x4E, 0x6F, 0x52, 0xED, 0x02, 0x6B, 0xBB, 0x6F, 0x6F, 0x29, 0x29, 0x16, 0x29, 0x16, 0x16, 0x29, 0x29, 0xDA, 0xC1, 0xDA, 0xF5, 0xC1, 0xF5, 0x8E, 0x8E, 0x4E, 0x40, 0x4E, 0x3E, 0x3E, 0xF5, 0x29, 0x15, 0x77, 0x80, 0x3C, 0x02, 0xF6, 0x3E, 0xDA, 0xC1, 0xF5, 0xF5, 0x65, 0xF3, 0x65, 0x3E, 0x8E, 0xEA, 0xEA, 0x94, 0x40, 0x40, 0x40, 0xDF, 0xDF, 0xDF, 0x4D, 0xDF, 0x6A, 0x54, 0x4D, 0x54, 0xA9, 0x6A, 0xDF, 0x4D, 0x4D, 0xDF, 0xEB, 0xF3, 0x3E, 0x87, 0xF4, 0x58, 0x0F, 0x61, 0xA7, 0xE8, 0x77, 0xBE, 0xBE, 0x5F, 0x5F, 0x05, 0xF1, 0xE2, 0x0A, 0x38, 0x5F, 0xBE, 0xBE, 0x0A, 0xBE, 0xE2, 0xC5, 0xE2, 0x74, 0xFF, 0xF0, 0xFF, 0x57, 0x74, 0xFF, 0xFF, 0x23, 0x1D, 0x74, 0x74, 0xFF, 0x74, 0xFF, 0x23, 0x74, 0x23, 0x23, 0x23, 0x74, 0x23, 0x69, 0x23, 0x23, 0x23, 0x23, 0xA0, 0x69, 0x23, 0xA0, 0xA0, 0xA0, 0xA0, 0xA1, 0x56, 0x72, 0xED, 0xDA, 0xF5, 0xA9, 0x4D, 0xC2, 0xFD, 0xFD, 0xFD, 0xFD, 0xC7, 0xFD, 0xBF, 0x0B, 0xC2, 0xFD, 0x08, 0x40, 0xF4, 0x52, 0x9E, 0x9A, 0x45, 0x83, 0x83, 0xF9, 0x97, 0xB7, 0x00, 0xD6, 0xC6, 0xA0, 0xF7, 0xA1, 0xC6, 0xC6, 0xFF, 0x23, 0xA0, 0xA0, 0xA1, 0xF7, 0xF7, 0x33, 0x00, 0x45, 0xB4, 0x83, 0xB6, 0x68, 0x9F, 0x10, 0xBD, 0x86, 0x9E, 0x4B, 0xCD, 0xBD, 0x68, 0x3F, 0x9F, 0x3F, 0x9F, 0xB4, 0xB4, 0x9F, 0x10, 0xBD, 0xBD, 0x83, 0xE5, 0xA3, 0x20, 0x1F, 0xCC, 0x06, 0xCF, 0x54, 0x9D, 0x79, 0x53, 0x90, 0xDB, 0x2A, 0x2A, 0x2A, 0x2A, 0x90, 0x90, 0x90, 0x90,
+	0x6F, 0x8F, 0x6F, 0x6F, 0x29, 0x02, 0x6F, 0x6F, 0x6F, 0x6F, 0xBB, 0x02, 0x02, 0x5D, 0xC8, 0x15, 0xC2, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0xC7, 0x0B, 0x0B, 0xC7, 0x0B, 0xFD, 0xC2, 0x08, 0x94, 0x8E, 0xBB, 0x6B, 0x6B, 0x02, 0x02, 0x02, 0x6F, 0x02, 0x6F, 0x29, 0x16, 0x16, 0x29, 0x16, 0x16, 0x29, 0x16, 0xDA, 0xC1, 0xC1, 0xF5, 0xC1, 0x4E, 0x4E, 0xEA, 0x8E, 0xC1, 0x8E, 0xF3, 0x5D, 0x29, 0xDB, 0xA5, 0x24, 0x3C, 0x29, 0x5D, 0xF6, 0x16, 0xEA, 0x8E, 0x3E, 0x4E, 0x65, 0x4E, 0xEA, 0x40, 0x40, 0x40, 0x40, 0x3E, 0xEA, 0x6A, 0x6A, 0x4D, 0xF8, 0x4D, 0x54, 0x4D, 0xDF, 0xA9, 0x6A, 0xE7, 0xDF, 0x4D, 0x4D, 0x6A, 0x6A, 0xF3, 0xF4, 0xF4, 0x01, 0x2E, 0xCB, 0x61, 0xE8, 0x7B, 0x7B, 0xF1, 0xBE, 0x5F, 0x5F, 0x3D, 0x5F, 0x5F, 0x05, 0x3D, 0xBE, 0xC5, 0xC5, 0xF2, 0x0A, 0xBE, 0x0A, 0x32, 0xC5, 0xF0, 0xC5, 0xC5, 0xC6, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x74, 0xC5, 0x74, 0x74, 0xFF, 0x23, 0x69, 0x23, 0x23, 0x23, 0x23, 0xC6, 0x23, 0x23, 0x1D, 0x69, 0x23, 0x23, 0x69, 0x23, 0x23, 0x23, 0xA0, 0xA0, 0xA0, 0xA0, 0x69, 0xE3, 0x72, 0x29, 0xA8, 0xDF, 0x15, 0xDD, 0xFD, 0xC2, 0xFD, 0x0B, 0x71, 0x0B, 0xC2, 0xFD, 0xFD, 0x71, 0x08, 0x3E, 0x41, 0x6F, 0x9E, 0x81, 0xF9, 0xF9, 0x83, 0xFB, 0x00, 0xB4, 0x60, 0xFF, 0xA1, 0xA0, 0xFF, 0x62, 0xFF, 0x23, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x2C, 0xB7, 0x97, 0xB6, 0xB6, 0x68, 0x10, 0xBD, 0x10, 0xBD, 0x86, 0x9E, 0xBD, 0xBD, 0xCD, 0xBD, 0x9F, 0x3F, 0xCD, 0xB4, 0xB4, 0xB4, 0xCD, 0x10, 0x10, 0x81, 0xFB, 0x73, 0x33, 0x70, 0x06, 0xCB, 0xCF, 0x54, 0x9D, 0x9C, 0x53, 0xA2, 0xA2, 0xA2, 0x2A, 0x2A, 0x2A, 0x2A, 0x90, 0x90, 0x90, 0x90,
+	0x6F, 0x6F, 0x6F, 0x6F, 0x29, 0x29, 0x6F, 0x29, 0xDA, 0x6F, 0x02, 0x02, 0x16, 0x8E, 0x0D, 0x08, 0xC2, 0xC2, 0x0B, 0xC7, 0xC7, 0x24, 0xC7, 0xC7, 0x24, 0x0B, 0x0B, 0x0B, 0x08, 0x15, 0x94, 0x8E, 0x02, 0x6B, 0xED, 0x52, 0x52, 0x02, 0x6F, 0xBB, 0x6F, 0x29, 0x29, 0x16, 0xDA, 0x16, 0x29, 0x16, 0xDA, 0x16, 0x29, 0xC1, 0xC1, 0xF5, 0x8E, 0x8E, 0x8E, 0xEA, 0x4E, 0xF3, 0xF6, 0xA8, 0xF3, 0xD2, 0xD2, 0xC7, 0x2D, 0x5D, 0x29, 0xF5, 0xC1, 0xEA, 0xEA, 0x5D, 0x8E, 0x40, 0x65, 0x4E, 0x8E, 0xF8, 0xEA, 0x3E, 0x3E, 0x6A, 0x6A, 0xDF, 0xDF, 0xDF, 0x6A, 0xDF, 0xDF, 0x65, 0x3E, 0xA9, 0x4D, 0x4D, 0x4D, 0xDF, 0x6A, 0xE7, 0xF3, 0xA8, 0x01, 0x11, 0xA4, 0xAA, 0xA4, 0xF1, 0xE8, 0x34, 0x36, 0xE8, 0x7B, 0xBE, 0xBE, 0x5F, 0x34, 0x37, 0xBE, 0xF2, 0xBE, 0xBE, 0x0A, 0xBE, 0xC5, 0xF1, 0xC5, 0xC5, 0xC6, 0xC6, 0xC5, 0xC5, 0x74, 0x74, 0xC5, 0x0A, 0x0A, 0x74, 0xFF, 0x23, 0x23, 0x1D, 0x91, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x69, 0x69, 0xA0, 0xA1, 0xA1, 0xDE, 0xA3, 0xAF, 0xF4, 0x40, 0x15, 0x71, 0xFD, 0x0B, 0xC2, 0x0B, 0xFD, 0xFD, 0x0B, 0xFD, 0xC2, 0xFD, 0x15, 0x3E, 0x41, 0x52, 0xFE, 0x82, 0x81, 0x97, 0xB7, 0xB7, 0xB4, 0xB9, 0xA0, 0xA1, 0x23, 0x0A, 0x05, 0xFF, 0x69, 0xA0, 0xA1, 0xA1, 0xA1, 0xA0, 0xA1, 0xA1, 0xA1, 0xF7, 0x9F, 0xB7, 0xB6, 0x97, 0xB6, 0x68, 0xBD, 0x10, 0xCD, 0x86, 0xBD, 0x4B, 0x86, 0x86, 0xBD, 0x10, 0xBD, 0x45, 0xB4, 0x73, 0xCD, 0x9F, 0xCD, 0xBD, 0x45, 0xBD, 0x12, 0x42, 0x11, 0x11, 0xCF, 0x54, 0x9C, 0x9C, 0xCF, 0xC0, 0xA2, 0xDB, 0xA2, 0x2A, 0x2A, 0x2A, 0x90, 0xC0, 0x90, 0x90, 0x90,
+	0x6F, 0x6F, 0x8F, 0x29, 0x6F, 0x6F, 0xDA, 0x6F, 0xDA, 0x6F, 0x6F, 0xBB, 0x16, 0x5D, 0x94, 0x08, 0x15, 0x0B, 0x0B, 0x24, 0x0B, 0x24, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0xC2, 0xC2, 0x08, 0x94, 0x16, 0xBB, 0x6B, 0xED, 0x02, 0x6B, 0x02, 0x6F, 0x29, 0x6F, 0x16, 0x16, 0xDA, 0x16, 0x16, 0x29, 0x16, 0x16, 0x29, 0x5D, 0xC1, 0xC1, 0xC1, 0x8E, 0xC1, 0x8E, 0x40, 0x4E, 0x65, 0xF3, 0x29, 0x84, 0xE2, 0xD2, 0x0B, 0x3C, 0x5D, 0x5D, 0x4E, 0xC1, 0x8E, 0x8E, 0xC1, 0x4E, 0x0D, 0x65, 0x3E, 0xEA, 0x40, 0xEA, 0x40, 0x40, 0x96, 0xF8, 0x4D, 0xDF, 0x40, 0xDF, 0x3E, 0xF3, 0x3E, 0xA9, 0x4D, 0x4D, 0xDF, 0xDF, 0x6A, 0x3E, 0xF4, 0xF4, 0xFC, 0x11, 0xA4, 0xA7, 0x32, 0xE8, 0xA7, 0x36, 0x36, 0x36, 0x5F, 0x3D, 0x61, 0x5F, 0x5F, 0x3D, 0x5F, 0x5F, 0x3D, 0xBE, 0xBE, 0x0A, 0xF2, 0x0A, 0xC5, 0xC5, 0x0A, 0xC5, 0x57, 0xFF, 0xFF, 0xC5, 0x0A, 0x05, 0x0A, 0x74, 0x74, 0xFF, 0x1D, 0x91, 0xFF, 0x23, 0x23, 0xFF, 0xFF, 0x74, 0xFF, 0x23, 0x74, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0x23, 0x69, 0x69, 0xA0, 0xA1, 0xA1, 0xF7, 0xB9, 0x4C, 0xA8, 0x6A, 0x15, 0xFD, 0xC2, 0xFD, 0x0B, 0xFD, 0x0B, 0xC2, 0x0B, 0x0B, 0xC2, 0x71, 0x08, 0x3E, 0x41, 0xD7, 0xC3, 0x82, 0xF9, 0x00, 0x00, 0xD6, 0xDE, 0xA0, 0xF7, 0x91, 0x63, 0x05, 0x69, 0xA0, 0xA1, 0x69, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x7C, 0xB7, 0xB6, 0xB6, 0x97, 0xB4, 0xCD, 0xBD, 0xCD, 0xBD, 0xCD, 0x45, 0x81, 0x86, 0xBD, 0xBD, 0xBD, 0x81, 0xB4, 0x73, 0x14, 0x9F, 0x3F, 0x45, 0xBD, 0x8D, 0x20, 0x13, 0x13, 0xCE, 0xCF, 0x9C, 0x9C, 0xCF, 0xC0, 0x2A, 0x90, 0x90, 0x90, 0x2A, 0x2A, 0xC0, 0xC0, 0x90, 0xC0, 0xC7, 0x90,
+	0x6F, 0x6F, 0x29, 0x6F, 0x29, 0x29, 0xDA, 0xDA, 0xDA, 0x6F, 0x16, 0x02, 0x16, 0x8E, 0x94, 0x08, 0x08, 0xC2, 0x0B, 0x24, 0x24, 0xC7, 0x24, 0xC7, 0x24, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x5D, 0x6F, 0x02, 0x6B, 0x02, 0x6B, 0xBB, 0x6F, 0x29, 0x29, 0x16, 0x29, 0x16, 0x29, 0xC1, 0xA8, 0x16, 0x29, 0x16, 0x16, 0xC1, 0xC1, 0x8E, 0xC1, 0x8E, 0xEA, 0x8E, 0x3E, 0x65, 0xF6, 0x29, 0xDB, 0x77, 0x1E, 0xC2, 0x65, 0x29, 0x29, 0xF5, 0xC1, 0xC1, 0x8E, 0x4E, 0x65, 0x65, 0x4E, 0x8E, 0x40, 0x40, 0xEA, 0x3E, 0x6A, 0xDF, 0xDF, 0xDF, 0x40, 0x3E, 0x6A, 0x65, 0x3E, 0x4D, 0x4D, 0xDF, 0x40, 0x6A, 0x3E, 0x3E, 0xF3, 0xA8, 0xE7, 0xD1, 0x7A, 0xD1, 0x88, 0x61, 0x61, 0x61, 0x36, 0x90, 0x36, 0x36, 0x5F, 0x5F, 0xA4, 0x3D, 0xF1, 0xF2, 0x5F, 0x34, 0xF1, 0xF1, 0xC5, 0x0A, 0xBE, 0x0A, 0xBE, 0xC5, 0x0A, 0xC5, 0x57, 0xC5, 0x0A, 0x05, 0x74, 0x74, 0xF0, 0xFF, 0xF0, 0x74, 0x74, 0x74, 0xFF, 0xD5, 0x74, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0x69, 0x69, 0x69, 0x69, 0x69, 0x23, 0x69, 0xA0, 0xA0, 0xA1, 0x56, 0x8F, 0x29, 0x40, 0x15, 0x71, 0x0B, 0xFD, 0x0B, 0x0B, 0xFD, 0x0B, 0x71, 0x0B, 0xFD, 0x71, 0xA9, 0x3E, 0x07, 0x8D, 0xC3, 0xF9, 0xB7, 0x3B, 0xE3, 0x63, 0xA1, 0xA0, 0x91, 0xDE, 0x05, 0xA0, 0xF7, 0x1D, 0xA0, 0x69, 0x69, 0x69, 0xF7, 0x69, 0x23, 0xA0, 0xA1, 0xA1, 0x0C, 0xB7, 0xB6, 0x97, 0xB4, 0xB4, 0xBD, 0x68, 0x10, 0x9F, 0xB4, 0xB4, 0x81, 0xBD, 0x86, 0xBD, 0x45, 0x45, 0x73, 0x3F, 0x14, 0x68, 0x3F, 0x81, 0x10, 0x1B, 0x1F, 0x13, 0x0F, 0x79, 0x54, 0x9C, 0xCF, 0x0F, 0xA2, 0xC0, 0x90, 0x90, 0xC0, 0x2A, 0x2A, 0xC0, 0x90, 0xC0, 0x90, 0x90, 0xDC,
+	0x6F, 0x8F, 0x29, 0x29, 0x6F, 0x6F, 0x16, 0x6F, 0x16, 0x6F, 0xBB, 0x02, 0x16, 0x8E, 0x94, 0x2D, 0x2B, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0xC2, 0xC2, 0x08, 0x94, 0x5D, 0x02, 0x52, 0x6B, 0x02, 0x52, 0x02, 0x6F, 0x6F, 0x16, 0xDA, 0x16, 0x16, 0xDA, 0x16, 0xA8, 0x16, 0x16, 0xA8, 0xC1, 0xC1, 0x16, 0x8E, 0x8E, 0xEA, 0x8E, 0x3E, 0x4E, 0x65, 0x3E, 0x29, 0x7F, 0x77, 0xE4, 0xC2, 0x5D, 0x29, 0x5D, 0x16, 0xC1, 0xEA, 0x8E, 0xEA, 0x40, 0x5D, 0x16, 0x4E, 0x40, 0xEA, 0x40, 0x6A, 0xDF, 0x4D, 0xF8, 0x3E, 0x3E, 0x0D, 0xF3, 0xA9, 0x71, 0xA9, 0x3E, 0x40, 0x2D, 0xDF, 0x87, 0xA8, 0xF4, 0x84, 0x0F, 0xA4, 0x7A, 0xE8, 0xE8, 0x36, 0x37, 0x36, 0x37, 0x36, 0xE8, 0x36, 0x61, 0x5F, 0x3D, 0xE8, 0x3D, 0x5F, 0x61, 0xBE, 0xBE, 0xF2, 0xE2, 0xC5, 0xBE, 0xBE, 0x0A, 0xBE, 0x57, 0x0A, 0x05, 0x05, 0x0A, 0xC5, 0xFF, 0xD5, 0x57, 0xFF, 0xFF, 0xF0, 0x74, 0x74, 0x74, 0xF0, 0xC6, 0x1D, 0x23, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0x69, 0x23, 0x69, 0x23, 0x69, 0x23, 0x23, 0x23, 0x74, 0xA0, 0x69, 0x69, 0xA1, 0x69, 0xAC, 0xAF, 0x87, 0x15, 0x71, 0xFD, 0xFD, 0xFD, 0x0B, 0xC2, 0x0B, 0xFD, 0xC2, 0xC2, 0x71, 0x96, 0xF3, 0x07, 0x14, 0x3A, 0x00, 0xFB, 0x03, 0x69, 0xA1, 0x69, 0x62, 0xDE, 0x05, 0xA0, 0xB3, 0xA0, 0xA1, 0x23, 0x23, 0x69, 0x69, 0x23, 0xFF, 0x23, 0xA0, 0xA1, 0xA1, 0x27, 0xB7, 0x3B, 0xB6, 0x3F, 0xBD, 0xBD, 0xB4, 0x9F, 0xCD, 0xB4, 0xB4, 0x73, 0xBD, 0x86, 0x81, 0x81, 0xBD, 0xCD, 0x9F, 0xCD, 0x68, 0x3F, 0x45, 0x12, 0x42, 0x13, 0x21, 0x06, 0x9C, 0x9D, 0x4D, 0xCE, 0x2A, 0xA2, 0xC0, 0xC0, 0xC0, 0xC0, 0x2A, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0x90,
+	0x29, 0x29, 0x29, 0x6F, 0x29, 0x16, 0x16, 0xDA, 0x16, 0xC1, 0x16, 0x16, 0x02, 0x8E, 0x94, 0x15, 0xC2, 0xC2, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x02, 0x02, 0xED, 0x02, 0x02, 0xBB, 0x6F, 0x16, 0x16, 0x16, 0xDA, 0x16, 0x16, 0x5D, 0x16, 0x5D, 0xA8, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x5D, 0xF3, 0xF3, 0xF6, 0x4E, 0x5D, 0xA5, 0xE2, 0xE4, 0x0B, 0x94, 0x02, 0x5D, 0xC1, 0xC1, 0xEA, 0xEA, 0xC1, 0x16, 0x16, 0x5D, 0xEA, 0x40, 0x40, 0x96, 0x6A, 0xF8, 0x40, 0x6A, 0x3E, 0x3E, 0x6A, 0x40, 0x4D, 0x4D, 0x40, 0x6A, 0x4D, 0xDF, 0x3E, 0xF4, 0xA8, 0x79, 0xA4, 0xC0, 0xA2, 0xE8, 0xD1, 0xD3, 0xCB, 0x55, 0xA7, 0xE8, 0xA7, 0x2A, 0x36, 0xBE, 0xE8, 0x7B, 0x36, 0x38, 0xBE, 0xF2, 0xF1, 0xBE, 0xBE, 0xBE, 0x0A, 0xF1, 0xBE, 0x0A, 0xBE, 0x05, 0x7B, 0x05, 0xF1, 0xC5, 0x32, 0xFF, 0x57, 0xFF, 0xC5, 0x74, 0xFF, 0x91, 0x74, 0xC6, 0x74, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x69, 0xC6, 0x23, 0x74, 0x74, 0x23, 0x23, 0xFF, 0x23, 0x69, 0x69, 0x23, 0x69, 0x69, 0x69, 0xA1, 0x0A, 0xB9, 0xF4, 0x40, 0xFD, 0xC2, 0x0B, 0xC2, 0x0B, 0x0B, 0xC2, 0xC2, 0x0B, 0x71, 0x71, 0xDF, 0xA8, 0xAF, 0xC4, 0x00, 0x26, 0xDE, 0x23, 0xA1, 0x23, 0x63, 0xDE, 0xC6, 0xA0, 0xA0, 0x23, 0x69, 0xA0, 0x1D, 0xFF, 0x23, 0x1D, 0x23, 0xA0, 0xA0, 0xA0, 0xA1, 0xA1, 0x27, 0x00, 0x3B, 0xB6, 0x04, 0x9F, 0x10, 0x3F, 0xB4, 0xB5, 0xB5, 0xB4, 0x86, 0xBD, 0xBD, 0x81, 0x81, 0x81, 0x68, 0x9F, 0x68, 0x04, 0xE6, 0x73, 0x20, 0x2E, 0x13, 0x0F, 0x17, 0x54, 0x79, 0xC0, 0xC0, 0x2A, 0x2A, 0x2A, 0xC0, 0xC0, 0xC0, 0x53, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0x90, 0xC0,
+	0x29, 0x6F, 0x29, 0xDA, 0x29, 0x16, 0xDA, 0x16, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x2D, 0xC2, 0xC2, 0x0B, 0x24, 0x0B, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x8E, 0x6F, 0x02, 0xED, 0x02, 0xBB, 0xBB, 0x6F, 0x16, 0xDA, 0x16, 0x29, 0x16, 0x16, 0x5D, 0x5D, 0x5D, 0x16, 0x5D, 0x16, 0x8E, 0xEA, 0x8E, 0x8E, 0x5D, 0xF5, 0x3E, 0x87, 0xF5, 0x8E, 0x4E, 0xA5, 0xD9, 0xE4, 0xC2, 0x65, 0x5D, 0x29, 0x5D, 0xDA, 0xC1, 0xC1, 0x16, 0x29, 0x3E, 0x6A, 0x40, 0x40, 0x96, 0x6A, 0x40, 0xEB, 0x6A, 0x40, 0x3E, 0x3E, 0x6A, 0xDF, 0xF8, 0x4D, 0xDF, 0xDF, 0xF8, 0x3E, 0xF6, 0xF4, 0x84, 0xC0, 0xA2, 0x7A, 0xD0, 0x2A, 0xA2, 0x4F, 0x92, 0x92, 0x2A, 0x4F, 0x36, 0xE8, 0xE8, 0xBE, 0x61, 0x5F, 0x5F, 0xBE, 0xBE, 0xE8, 0xF1, 0xE8, 0x32, 0xBE, 0x7B, 0xBE, 0x57, 0xBE, 0x5F, 0x34, 0x05, 0xF1, 0xF1, 0xC5, 0xC5, 0x57, 0xC5, 0x77, 0xFF, 0xC5, 0xC5, 0xC5, 0xC5, 0x74, 0xFF, 0xF0, 0xD5, 0xC6, 0xC5, 0xFF, 0xC6, 0x05, 0xFF, 0x74, 0xFF, 0x74, 0x23, 0x23, 0xFF, 0x23, 0x74, 0x23, 0x23, 0x69, 0x69, 0x69, 0x69, 0x69, 0x74, 0xCB, 0x4D, 0xDF, 0x71, 0xFD, 0x0B, 0x0B, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x15, 0x87, 0x5C, 0xA3, 0xA3, 0xBA, 0x05, 0xF7, 0xF7, 0x0A, 0x38, 0x05, 0xAE, 0xA0, 0xB3, 0xA0, 0x23, 0x1D, 0x23, 0x1D, 0xFF, 0x23, 0x1D, 0x23, 0x69, 0xA0, 0xA0, 0xA1, 0xA1, 0x9B, 0x00, 0x3B, 0xB6, 0x9F, 0x9F, 0x4B, 0xBD, 0x3F, 0xB2, 0x82, 0x82, 0x81, 0x81, 0xE5, 0x86, 0x9A, 0x86, 0x68, 0x68, 0x3B, 0x3B, 0xB6, 0x12, 0x47, 0x11, 0x06, 0xC0, 0x79, 0x9C, 0xCE, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0x90, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x90,
+	0x16, 0x16, 0x16, 0x29, 0x16, 0x29, 0x16, 0xA8, 0x16, 0xDA, 0x16, 0x02, 0x16, 0x5D, 0x94, 0x15, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0xC2, 0xC2, 0x94, 0x8E, 0xBB, 0x02, 0xED, 0xBB, 0x02, 0x6F, 0x16, 0x16, 0xDA, 0x16, 0xC1, 0x16, 0x4E, 0x16, 0x5D, 0x5D, 0x5D, 0xA8, 0x16, 0x8E, 0x4E, 0x4E, 0x8E, 0x8E, 0x65, 0x3E, 0xEB, 0xF5, 0x16, 0x2D, 0xD9, 0xA5, 0xC7, 0x08, 0x5D, 0x5D, 0x29, 0x4E, 0xC1, 0xC1, 0x16, 0xDA, 0xEA, 0x40, 0x40, 0x8E, 0x40, 0x3E, 0x6A, 0x40, 0xEA, 0x40, 0x40, 0x6A, 0xEB, 0x6A, 0x4D, 0x6A, 0x6A, 0x4D, 0xDF, 0xEA, 0xF6, 0xA8, 0x54, 0xCA, 0xCA, 0x0F, 0x93, 0xA2, 0xA9, 0x0F, 0xA4, 0xA4, 0x37, 0x37, 0x36, 0x76, 0x61, 0xE8, 0xE8, 0x3D, 0x5F, 0xF2, 0x61, 0x61, 0xBE, 0xE8, 0x0A, 0xAA, 0x7B, 0xE8, 0xF1, 0x62, 0x38, 0x38, 0x5F, 0xBE, 0xC5, 0xBE, 0xBE, 0xBE, 0x57, 0xC5, 0xE2, 0xC5, 0xC5, 0xC6, 0xC6, 0xFF, 0xFF, 0xC5, 0xC5, 0xC5, 0xD5, 0xFF, 0x05, 0x38, 0x05, 0xC6, 0xFF, 0x74, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x74, 0x23, 0x23, 0x69, 0x69, 0x69, 0xA1, 0x91, 0x78, 0xA9, 0xC2, 0xFD, 0x0B, 0xC2, 0x0B, 0xC2, 0xC2, 0xC2, 0xC2, 0xA9, 0x5C, 0x8F, 0x5C, 0xDE, 0x69, 0xA1, 0x91, 0x05, 0x62, 0x05, 0xA0, 0xA0, 0xA0, 0xD5, 0x23, 0x23, 0x23, 0x23, 0xFF, 0xFF, 0x23, 0x23, 0x91, 0xF7, 0xD5, 0xA0, 0xA1, 0xA1, 0x03, 0xB7, 0xB6, 0xB6, 0x9F, 0x9F, 0x10, 0x10, 0xCD, 0x3F, 0xB5, 0x82, 0x81, 0x45, 0x86, 0x9E, 0xCD, 0xBD, 0xBD, 0x04, 0xB7, 0xFB, 0xA3, 0xA6, 0x2E, 0x1A, 0x06, 0xCF, 0x54, 0x79, 0x53, 0xA2, 0xA2, 0x2A, 0xC0, 0x90, 0xC0, 0x90, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x53, 0xC0,
+	0xDA, 0xDA, 0x16, 0xA8, 0x5D, 0xA8, 0x5D, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x08, 0xC2, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x24, 0x0B, 0x0B, 0x0B, 0x08, 0x94, 0x8E, 0xBB, 0x02, 0x02, 0x6B, 0xBB, 0x6F, 0x6F, 0x16, 0xDA, 0xDA, 0xC1, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x16, 0x16, 0x8E, 0xF5, 0x8E, 0x8E, 0x8E, 0x65, 0xF3, 0x3E, 0xF5, 0x16, 0xFD, 0xB3, 0xA5, 0xFD, 0x94, 0x5D, 0x5D, 0x16, 0x16, 0xDA, 0xC1, 0xEA, 0xEA, 0x40, 0xEA, 0xC1, 0x8E, 0x8E, 0x8E, 0xF8, 0x4E, 0x3E, 0x40, 0x40, 0x6A, 0xDF, 0xF8, 0x6A, 0x40, 0x40, 0x40, 0xEA, 0xA8, 0xF3, 0x4D, 0xDB, 0xCA, 0x0F, 0x06, 0x53, 0x53, 0xCE, 0x53, 0x78, 0x4F, 0x55, 0x36, 0xE8, 0xA4, 0x36, 0x61, 0x3D, 0x7B, 0xE8, 0xF2, 0xBE, 0x5F, 0x5F, 0xE8, 0xBE, 0x7B, 0x7B, 0x0A, 0x7B, 0x37, 0x76, 0xBE, 0x0A, 0xBE, 0x32, 0xF1, 0xBE, 0x05, 0xBE, 0x57, 0x0A, 0xC5, 0xC5, 0xC5, 0x57, 0xFF, 0xF0, 0xC6, 0xC5, 0xE2, 0xF0, 0x0A, 0xDE, 0x38, 0xC6, 0x74, 0xFF, 0x23, 0xFF, 0x74, 0x23, 0x23, 0xFF, 0x74, 0xFF, 0x74, 0x74, 0x5B, 0x69, 0x69, 0x23, 0x69, 0x95, 0xE2, 0xC0, 0xDD, 0xC2, 0x0B, 0x08, 0x0B, 0x0B, 0xC2, 0xC2, 0x2B, 0xF4, 0x01, 0x67, 0xAE, 0x95, 0x95, 0x74, 0x0A, 0x05, 0xFF, 0x23, 0xA0, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x23, 0xFF, 0xFF, 0xFF, 0x1D, 0x1D, 0xF7, 0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0x60, 0xB7, 0xB6, 0xB6, 0x0E, 0xBD, 0xBD, 0x4B, 0xCD, 0x3F, 0x73, 0x73, 0x86, 0xBD, 0x86, 0xBD, 0x9E, 0xBD, 0xBD, 0x83, 0xB7, 0x81, 0x33, 0x1F, 0x0F, 0x0F, 0x17, 0x79, 0x79, 0x53, 0xA2, 0xA2, 0xA2, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xC1, 0xDA, 0x16, 0x16, 0x29, 0x5D, 0x29, 0x16, 0xDA, 0x16, 0x29, 0x02, 0x16, 0x8E, 0x94, 0x08, 0x2B, 0xC2, 0x0B, 0x24, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0xC2, 0xC2, 0x94, 0x8E, 0x02, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x16, 0x6F, 0xC1, 0x16, 0xC1, 0x16, 0x16, 0x4E, 0x16, 0x5D, 0x5D, 0x16, 0x16, 0x16, 0x8E, 0xEA, 0x8E, 0x8E, 0x4E, 0x65, 0x3E, 0x16, 0x16, 0xE4, 0xB3, 0x1E, 0x2B, 0x65, 0x94, 0x5D, 0x16, 0x29, 0x16, 0xC1, 0xEA, 0xC1, 0xC1, 0x4E, 0x8E, 0xC1, 0xEA, 0x6A, 0x3E, 0x40, 0x94, 0x6A, 0xF8, 0x96, 0xDF, 0xE9, 0x6A, 0x3E, 0x3E, 0xF3, 0xF6, 0x87, 0x4D, 0xCA, 0xBF, 0x0F, 0xCA, 0x79, 0xE7, 0xCF, 0xA2, 0xC0, 0x84, 0xCB, 0xA4, 0x92, 0x61, 0xA4, 0x61, 0xE8, 0x61, 0x3D, 0x7B, 0x61, 0x5F, 0x5F, 0x38, 0x61, 0xBE, 0xF1, 0x88, 0x34, 0xCB, 0x38, 0xE8, 0x32, 0x7B, 0x05, 0xBE, 0x57, 0x32, 0x0A, 0xBE, 0x0A, 0x57, 0xC5, 0xC5, 0x0A, 0xC5, 0xFF, 0xF0, 0xFF, 0x91, 0x77, 0x62, 0xDE, 0x34, 0x05, 0xC6, 0xFF, 0x74, 0xC6, 0x23, 0x74, 0x23, 0x74, 0x23, 0x23, 0x23, 0x23, 0x74, 0x74, 0x23, 0x23, 0x23, 0x23, 0x69, 0xD5, 0xE8, 0x79, 0xFD, 0xC2, 0x0B, 0xC2, 0xC2, 0x2B, 0x84, 0x84, 0x90, 0xF2, 0x77, 0x95, 0xFF, 0x0A, 0x05, 0x74, 0x23, 0x69, 0xA0, 0xFF, 0x23, 0x1D, 0xFF, 0x1D, 0x1D, 0x1D, 0xFF, 0x1D, 0x1D, 0xD5, 0xF7, 0xF7, 0xA0, 0x95, 0xA0, 0xA0, 0xA0, 0x31, 0x00, 0xB6, 0x0E, 0xB6, 0x45, 0xBD, 0xBD, 0x86, 0x73, 0x73, 0xB4, 0x81, 0x45, 0xBD, 0xBD, 0xBD, 0x86, 0x45, 0xF9, 0xF9, 0x26, 0x42, 0x13, 0x0F, 0x06, 0x17, 0x9C, 0xCF, 0x2A, 0xA2, 0x2A, 0xC0, 0xA2, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x53, 0xC0, 0x53, 0xC0, 0xC0, 0xC0,
+	0xC1, 0xDA, 0xC1, 0x29, 0xA8, 0x5D, 0x29, 0x16, 0xC1, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x0B, 0x08, 0x94, 0x8E, 0xBB, 0x02, 0xED, 0xBB, 0x02, 0x6F, 0x6F, 0x6F, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0x8E, 0x8E, 0x5D, 0x65, 0xF6, 0xF3, 0x29, 0x16, 0x93, 0xA5, 0x39, 0x15, 0x2D, 0x65, 0x65, 0x16, 0x16, 0xC1, 0xEA, 0xC1, 0x16, 0x16, 0x16, 0xF5, 0x3E, 0x94, 0x40, 0x8E, 0x3E, 0x96, 0xF8, 0x96, 0xF8, 0x3E, 0x3E, 0x40, 0x3E, 0x87, 0xF6, 0x87, 0x54, 0x06, 0xCA, 0xBF, 0x53, 0x79, 0x06, 0x53, 0x06, 0x79, 0x17, 0x54, 0xA2, 0x7A, 0xA7, 0xA4, 0x5F, 0x61, 0x93, 0x5F, 0x38, 0x36, 0x36, 0x61, 0xE8, 0xE8, 0x61, 0x61, 0x61, 0x5F, 0x38, 0x5F, 0x61, 0xE8, 0x0A, 0x61, 0xBE, 0xBE, 0x7B, 0xBE, 0xF1, 0xBE, 0x05, 0x05, 0xF1, 0x0A, 0xC5, 0xC5, 0xF0, 0x91, 0xD5, 0x0A, 0x05, 0x38, 0x38, 0xC6, 0xC6, 0xC6, 0xC6, 0x74, 0xFF, 0x74, 0xFF, 0x74, 0xFF, 0x74, 0x23, 0x74, 0xFF, 0x23, 0x74, 0x5B, 0x23, 0x74, 0x74, 0x23, 0x23, 0xE2, 0x4F, 0x79, 0x0B, 0x0B, 0x08, 0x15, 0x84, 0x90, 0x3D, 0x77, 0x95, 0x77, 0x05, 0x0A, 0x05, 0xFF, 0x23, 0x23, 0x23, 0xA0, 0x23, 0x1D, 0x1D, 0x1D, 0xF0, 0xFF, 0xFF, 0x1D, 0x1D, 0x23, 0xF7, 0x69, 0xD5, 0xA0, 0xA0, 0xA0, 0xA1, 0x23, 0x9F, 0xB7, 0xB6, 0x9F, 0x9F, 0xBD, 0xBD, 0x86, 0x3F, 0x73, 0xB4, 0x81, 0x82, 0x81, 0xBD, 0x86, 0x86, 0xBD, 0x86, 0x82, 0xCD, 0x20, 0x48, 0x13, 0x06, 0x06, 0x79, 0xCF, 0xC0, 0x2A, 0x2A, 0x0F, 0x2A, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x53, 0xC0,
+	0xDA, 0xC1, 0x29, 0x16, 0x5D, 0x29, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x94, 0x08, 0xC2, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x94, 0x8E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x6F, 0x16, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0x5D, 0x8E, 0x5D, 0x8E, 0xF6, 0xC1, 0x29, 0x5D, 0xD2, 0x28, 0x0B, 0x2B, 0x2D, 0x2D, 0x5D, 0xC1, 0xEA, 0xC1, 0xF5, 0x16, 0xC1, 0xC1, 0xDA, 0x5D, 0x3E, 0x3E, 0xC1, 0x8E, 0x3E, 0x96, 0x6A, 0x3E, 0x3E, 0x3E, 0x3E, 0x40, 0x3E, 0x3E, 0xE7, 0x4D, 0x06, 0xBF, 0x79, 0xCA, 0x4D, 0x4D, 0x06, 0xDB, 0x54, 0x85, 0xCE, 0xA4, 0xA2, 0xCB, 0x36, 0xE8, 0x93, 0x61, 0x5F, 0x5F, 0x36, 0x36, 0x34, 0x61, 0xE8, 0xE8, 0xBE, 0x37, 0x37, 0x34, 0x3D, 0xE8, 0x7B, 0x36, 0x61, 0xE8, 0x32, 0x61, 0x5F, 0x5F, 0x7B, 0xBE, 0x7B, 0x7B, 0x05, 0x0A, 0x57, 0x57, 0x0A, 0x0A, 0x57, 0x38, 0x34, 0xBE, 0xFF, 0xC5, 0x0A, 0xC6, 0xC6, 0xC6, 0xC6, 0x74, 0xFF, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x23, 0x23, 0x74, 0x74, 0x74, 0x63, 0x23, 0x23, 0x1D, 0x5F, 0x2B, 0xDD, 0xC2, 0xC2, 0x90, 0x36, 0xE2, 0x77, 0xE2, 0xBE, 0x05, 0xC6, 0x0A, 0xC6, 0x69, 0x69, 0x23, 0x23, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x1D, 0x1D, 0x23, 0x23, 0x1D, 0x23, 0x23, 0x23, 0xA0, 0xA0, 0xA0, 0xA1, 0x56, 0xB6, 0xB6, 0x68, 0x9F, 0x9F, 0x9F, 0xBD, 0xCD, 0x86, 0x45, 0xB5, 0x82, 0x81, 0x86, 0xBD, 0x10, 0xBD, 0x10, 0x4B, 0x4B, 0x52, 0x70, 0x17, 0x1A, 0x06, 0x17, 0xCF, 0xCF, 0x0F, 0x2A, 0x2A, 0x2A, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0x53, 0xC0, 0xC0, 0x53, 0xC0, 0x53, 0xC0, 0x53, 0xCE,
+	0xDA, 0xDA, 0x16, 0xA8, 0x16, 0xA8, 0x16, 0x16, 0x16, 0x16, 0x29, 0x16, 0x8E, 0x8E, 0x94, 0x08, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0B, 0x0B, 0x08, 0xC8, 0x65, 0xBB, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x6F, 0x6F, 0xC1, 0xDA, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0x16, 0x8E, 0x8E, 0x5D, 0x4E, 0xC1, 0x29, 0xF3, 0xB3, 0xA5, 0x39, 0x2B, 0x15, 0x0D, 0x5D, 0xC1, 0x3E, 0xC1, 0xC1, 0xEA, 0xC1, 0x5D, 0x4E, 0x4E, 0x8E, 0x8E, 0x8E, 0x40, 0x40, 0x96, 0x3E, 0x8E, 0xEA, 0x6A, 0xF8, 0x3E, 0x3E, 0xE7, 0x06, 0xCA, 0x4D, 0x54, 0x06, 0x4D, 0x79, 0x06, 0x06, 0xDF, 0x85, 0x53, 0xA2, 0xA2, 0xCA, 0x2A, 0x36, 0x92, 0x61, 0xA7, 0x36, 0x34, 0x36, 0xA7, 0x5F, 0x61, 0x61, 0x61, 0xE8, 0x55, 0x34, 0x5F, 0xBE, 0x61, 0x5F, 0x5F, 0x61, 0x7B, 0x61, 0x61, 0xBE, 0xBE, 0x5F, 0x7B, 0xBE, 0xBE, 0xBE, 0x0A, 0xBE, 0x05, 0x34, 0x34, 0x62, 0x05, 0xC5, 0xC5, 0x7B, 0x05, 0x0A, 0x05, 0x05, 0xC6, 0xC6, 0xC6, 0x74, 0x23, 0x0A, 0x0A, 0x74, 0x74, 0x56, 0x74, 0x74, 0x56, 0x74, 0x74, 0x74, 0x63, 0xC6, 0xC6, 0xBE, 0x55, 0x9D, 0xC7, 0xDB, 0xE8, 0x77, 0x77, 0xE2, 0xC5, 0xF2, 0xC6, 0xBE, 0xC6, 0xA0, 0x1D, 0x23, 0x23, 0x23, 0xC6, 0x23, 0xC6, 0x23, 0x23, 0x1D, 0x23, 0x91, 0x1D, 0x74, 0x1D, 0x23, 0x23, 0xA0, 0xA0, 0xB3, 0xA0, 0xA1, 0x63, 0x00, 0xB6, 0x9F, 0x9F, 0x10, 0x10, 0x86, 0xBD, 0x45, 0x81, 0x82, 0x82, 0x81, 0x86, 0xBD, 0xBD, 0xBD, 0x4B, 0x8D, 0x8D, 0x20, 0x13, 0x06, 0x06, 0x06, 0x79, 0x79, 0x53, 0x2A, 0xA2, 0x2A, 0xA2, 0xA2, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0x2A, 0xC0, 0xC0, 0x53, 0x53, 0x53, 0xC0, 0x53, 0x79,
+	0xC1, 0x16, 0x16, 0xA8, 0x5D, 0xA8, 0x16, 0xA8, 0x5D, 0x16, 0x16, 0x16, 0x16, 0x94, 0x94, 0x08, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x24, 0xE4, 0xE4, 0x24, 0x0B, 0x0B, 0xC2, 0x94, 0x8E, 0xBB, 0x02, 0xED, 0xBB, 0x6F, 0x16, 0x6F, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x4E, 0xC1, 0x5D, 0x5D, 0x5D, 0x8E, 0x8E, 0x29, 0xAF, 0xDC, 0x77, 0x1E, 0x24, 0x2B, 0x15, 0x2D, 0x65, 0x16, 0xC1, 0x16, 0x8E, 0x8E, 0x8E, 0x4E, 0x4E, 0xF5, 0x3E, 0xEA, 0xEA, 0x8E, 0x96, 0xEA, 0x8E, 0x96, 0xF8, 0x0D, 0xDF, 0xF3, 0x3E, 0x06, 0xBF, 0x4D, 0x06, 0x0F, 0x85, 0x54, 0xCA, 0x06, 0x3C, 0x85, 0x06, 0xA2, 0x06, 0x53, 0x2A, 0x92, 0xD1, 0x55, 0x0F, 0x7A, 0x36, 0xA7, 0x36, 0xA7, 0xE8, 0xA4, 0x37, 0x36, 0x55, 0x61, 0x5F, 0x61, 0x61, 0x61, 0x61, 0x5F, 0x61, 0x92, 0x7B, 0xBE, 0xA4, 0x5F, 0xBE, 0x88, 0xBE, 0x32, 0x57, 0xF1, 0x38, 0x34, 0x38, 0x0A, 0xBE, 0x32, 0xBE, 0x05, 0x62, 0x0A, 0xC6, 0xC6, 0x74, 0x74, 0x74, 0x74, 0x74, 0xC6, 0xC6, 0x56, 0x0A, 0xFF, 0x74, 0x74, 0x74, 0x74, 0x63, 0xC6, 0x74, 0xC6, 0xC6, 0xC6, 0xC6, 0x34, 0x90, 0x92, 0xE2, 0x77, 0x32, 0xBE, 0x0A, 0xBE, 0xC6, 0x1D, 0x1D, 0xB3, 0x1D, 0x1D, 0x1D, 0x1D, 0xC6, 0x23, 0xC6, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xD5, 0xFF, 0xF0, 0xFF, 0xFF, 0x23, 0xA0, 0x1D, 0xA0, 0xA1, 0xA1, 0x03, 0x00, 0x9F, 0xB6, 0x9F, 0x9F, 0x10, 0xBD, 0x4B, 0xBD, 0xB4, 0xB4, 0x81, 0x73, 0xBD, 0x45, 0xCD, 0x4B, 0x8D, 0x8D, 0x20, 0x70, 0x06, 0x06, 0x06, 0x54, 0x54, 0x53, 0xA2, 0xA2, 0x2A, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xDA, 0x16, 0x29, 0x5D, 0xA8, 0x16, 0x16, 0x16, 0x5D, 0x29, 0x16, 0x16, 0x8E, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0xE4, 0x24, 0xE4, 0xE4, 0x0B, 0x0B, 0x08, 0x94, 0x8E, 0xBB, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x6F, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0x4E, 0x16, 0x16, 0x16, 0x16, 0x16, 0x8E, 0xC1, 0xC1, 0x16, 0x4E, 0x8E, 0x16, 0x8E, 0x16, 0x02, 0xA2, 0xD9, 0xA5, 0xE4, 0x2B, 0x15, 0x2D, 0x4E, 0x5D, 0x8E, 0x16, 0xEA, 0xC1, 0xC1, 0x4E, 0x4E, 0x3E, 0x65, 0x40, 0x8E, 0x96, 0xEA, 0x40, 0x40, 0x6A, 0x96, 0x40, 0xF5, 0x6A, 0x06, 0x06, 0x54, 0xCA, 0xBF, 0x85, 0x4D, 0x4D, 0x54, 0x85, 0x85, 0x54, 0x53, 0x53, 0xCA, 0xA2, 0xD1, 0x2A, 0xC0, 0xD1, 0xCB, 0x37, 0x5F, 0xE8, 0x88, 0x36, 0x5F, 0xA7, 0xCB, 0xCB, 0xA7, 0xA4, 0xE8, 0x5F, 0x36, 0x61, 0x3D, 0xE8, 0x5F, 0x93, 0x5F, 0x5F, 0x61, 0x61, 0x61, 0xBE, 0xE8, 0x32, 0xBE, 0x05, 0x05, 0x05, 0x05, 0xBE, 0xBE, 0x74, 0x0A, 0xE8, 0x05, 0xBE, 0xC6, 0x0A, 0xC6, 0x0A, 0x74, 0xC6, 0x0A, 0x05, 0x0A, 0x05, 0xC6, 0x0A, 0x0A, 0x05, 0x05, 0x74, 0xC6, 0x05, 0x05, 0xC6, 0x63, 0xC6, 0xAE, 0xC6, 0xF1, 0x77, 0x77, 0x32, 0x74, 0x0A, 0xC6, 0x1D, 0xFF, 0x1D, 0x1D, 0x1D, 0x1D, 0xAE, 0xFF, 0x1D, 0xFF, 0xC6, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x1D, 0xF0, 0xFF, 0xF0, 0x1D, 0x23, 0x23, 0xA0, 0x23, 0xA0, 0xA0, 0xA1, 0xE3, 0xB7, 0xB6, 0xB6, 0x68, 0xB4, 0xBD, 0xBD, 0x10, 0x81, 0xB4, 0x81, 0x81, 0x45, 0x3F, 0xBD, 0x4B, 0x4A, 0x4A, 0x12, 0x42, 0x13, 0x06, 0x06, 0x17, 0x79, 0xCF, 0xC0, 0xA2, 0xA2, 0x2A, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xC1, 0x29, 0x16, 0xA8, 0x16, 0x29, 0x16, 0x29, 0x5D, 0x16, 0x16, 0x5D, 0x8E, 0x94, 0x94, 0x94, 0x0B, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0xE4, 0x24, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x94, 0x65, 0xBB, 0x02, 0xED, 0x02, 0x02, 0x6F, 0x6F, 0x16, 0x6F, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xC1, 0x5D, 0x5D, 0x8E, 0x16, 0x8E, 0x29, 0x02, 0x3D, 0xB3, 0x1E, 0xE4, 0x0B, 0xC2, 0x2D, 0x94, 0x65, 0x65, 0x4E, 0x8E, 0xF5, 0x5D, 0x5D, 0x8E, 0xEA, 0x94, 0xEA, 0x3E, 0x40, 0x40, 0x8E, 0x96, 0xF8, 0x40, 0xC1, 0x3E, 0x06, 0xBF, 0x06, 0x4D, 0x06, 0x54, 0x54, 0xCA, 0xA9, 0xDF, 0x85, 0x79, 0x06, 0x06, 0x53, 0x0F, 0x92, 0x9C, 0xCF, 0xA2, 0xCB, 0x2A, 0xA4, 0xA4, 0x92, 0xE8, 0x7A, 0xCB, 0xCB, 0x2A, 0x36, 0xD2, 0x92, 0x5F, 0xA4, 0x5F, 0x61, 0xA4, 0x61, 0x5F, 0x7A, 0xA7, 0x37, 0x5F, 0x61, 0x61, 0xE8, 0xF1, 0xBE, 0x88, 0x61, 0xBE, 0xBE, 0xBE, 0x61, 0xE8, 0xBE, 0x0A, 0x0A, 0x74, 0x0A, 0x0A, 0xC5, 0x74, 0x0A, 0x0A, 0x05, 0x0A, 0x05, 0x05, 0x05, 0x74, 0x63, 0xC6, 0x0A, 0x05, 0x0A, 0x62, 0x62, 0x63, 0x05, 0xC6, 0x05, 0xC6, 0x1D, 0xC5, 0xF2, 0xF1, 0xC5, 0xC5, 0xF0, 0x77, 0x1D, 0xD5, 0x1D, 0x1D, 0xAE, 0xFF, 0xFF, 0xFF, 0x1D, 0xC6, 0xFF, 0xC6, 0x23, 0xC6, 0x23, 0x23, 0x1D, 0x57, 0x57, 0x0A, 0xFF, 0xB3, 0x23, 0xA0, 0xA0, 0xA0, 0xA0, 0x69, 0x9F, 0x00, 0xB6, 0xB6, 0x9F, 0x97, 0x86, 0xCD, 0xBD, 0x81, 0x81, 0x81, 0x81, 0x3F, 0x4B, 0xBD, 0xCD, 0x10, 0x12, 0x41, 0x17, 0x13, 0xBF, 0x06, 0x54, 0xCF, 0xC0, 0x2A, 0xC0, 0x2A, 0x2A, 0xA2, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0x90, 0x53, 0xC0, 0xC0, 0x53, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xDA, 0xC1, 0x16, 0xA8, 0x16, 0x16, 0xA8, 0x16, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x8E, 0x94, 0x08, 0xC2, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0xE4, 0xE4, 0xE4, 0x0B, 0x0B, 0x0B, 0xC2, 0x94, 0x8E, 0x29, 0x52, 0x02, 0x6B, 0xBB, 0x6F, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0xDA, 0xC1, 0x16, 0x5D, 0x8E, 0x8E, 0x5D, 0x02, 0x29, 0xD2, 0xD9, 0xB1, 0xB1, 0x0B, 0xC2, 0x15, 0x2D, 0x94, 0x40, 0x65, 0x3E, 0x8E, 0x8E, 0x4E, 0x4E, 0x4E, 0x8E, 0x8E, 0xEA, 0xEA, 0x96, 0xF8, 0xF8, 0x40, 0xC1, 0xF5, 0x4D, 0x06, 0x4D, 0x06, 0x06, 0x87, 0x54, 0xCA, 0x54, 0xE7, 0x85, 0x06, 0x06, 0x54, 0x53, 0xBF, 0x06, 0x79, 0xCF, 0xCF, 0x53, 0xD3, 0x7A, 0x92, 0xD1, 0x2A, 0xD1, 0xA7, 0xCB, 0x2A, 0x92, 0x36, 0x92, 0x92, 0x36, 0xA4, 0x5F, 0x61, 0xA4, 0x36, 0x61, 0x5F, 0x7A, 0x61, 0x36, 0x36, 0x61, 0x61, 0x7B, 0x5F, 0x0A, 0x32, 0xBE, 0x88, 0xBE, 0x7B, 0x7B, 0x7B, 0x0A, 0x0A, 0x32, 0x0A, 0x0A, 0xBE, 0x0A, 0x0A, 0xBE, 0x0A, 0x05, 0x62, 0x62, 0x05, 0x0A, 0xC6, 0x05, 0x62, 0x05, 0x0A, 0x34, 0xDE, 0xDE, 0x05, 0xC6, 0xA0, 0xC6, 0xC6, 0x38, 0x05, 0xE2, 0xFF, 0xFF, 0x91, 0xD5, 0xD5, 0x1D, 0xC6, 0xC6, 0xFF, 0xFF, 0xFF, 0x1D, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x91, 0xF1, 0xBE, 0x0A, 0xC5, 0x1D, 0x1D, 0x1D, 0xA0, 0xA0, 0xA1, 0xDE, 0xB6, 0x3B, 0xB6, 0xB6, 0xB4, 0xB6, 0x3F, 0xBD, 0x86, 0x45, 0x83, 0xB4, 0xB4, 0xBD, 0x4B, 0x73, 0x82, 0x4B, 0x33, 0x7D, 0x06, 0xCA, 0x06, 0x54, 0x54, 0x53, 0x0F, 0x2A, 0x0F, 0x90, 0xC0, 0xDB, 0x90, 0x2A, 0x2A, 0xC0, 0xC0, 0x53, 0x90, 0xC0, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x53, 0xC0, 0xC0,
+	0xDA, 0x16, 0x29, 0x5D, 0xA8, 0x16, 0x16, 0x29, 0x16, 0x29, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x94, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0xE4, 0x24, 0xE4, 0xE4, 0xE4, 0x0B, 0x0B, 0xC2, 0x94, 0x65, 0x02, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x6F, 0x16, 0x16, 0x29, 0x16, 0x29, 0x16, 0x29, 0x16, 0x5D, 0x16, 0x16, 0x16, 0xDA, 0x16, 0x8E, 0x5D, 0x5D, 0x8E, 0x8E, 0x02, 0x29, 0xAE, 0xD9, 0xB1, 0xE4, 0x0B, 0xC2, 0x15, 0x2D, 0x2D, 0x0D, 0xC8, 0x8E, 0x4E, 0x4E, 0x4E, 0x8E, 0xF3, 0xC1, 0xC1, 0x8E, 0x96, 0xEA, 0x40, 0x3E, 0xC1, 0x0D, 0x4D, 0x4D, 0x4D, 0x06, 0x06, 0xDF, 0x4D, 0xCA, 0x54, 0xF4, 0xA9, 0x4D, 0x0F, 0xFD, 0x06, 0x0F, 0x0F, 0xE7, 0x85, 0x06, 0xC0, 0xC0, 0x78, 0x93, 0x92, 0xA4, 0xA2, 0x84, 0x55, 0xA7, 0x93, 0xE8, 0x36, 0xD1, 0x2A, 0xA7, 0x3D, 0xA4, 0x5F, 0x3D, 0x92, 0x36, 0x61, 0x93, 0x92, 0x36, 0x36, 0x36, 0x5F, 0x36, 0x61, 0xE8, 0xE8, 0xBE, 0x7B, 0xBE, 0xBE, 0xBE, 0xAA, 0x7B, 0x0A, 0x0A, 0x57, 0x0A, 0xBE, 0x46, 0x05, 0x0A, 0xBE, 0x7B, 0x38, 0x62, 0x7B, 0x05, 0x0A, 0x05, 0x05, 0x34, 0x34, 0x34, 0x34, 0xC5, 0xAE, 0xC6, 0x05, 0xDE, 0xC6, 0xAE, 0xC6, 0xF0, 0xF0, 0xD5, 0x1D, 0xD5, 0x23, 0x74, 0xC6, 0xC6, 0xFF, 0xFF, 0xFF, 0x1D, 0xFF, 0xFF, 0xFF, 0x23, 0xFF, 0xFF, 0x23, 0xD5, 0xC5, 0x5F, 0x5F, 0x5F, 0xBE, 0xD5, 0x1D, 0x23, 0xB3, 0xB3, 0xA1, 0xBA, 0x00, 0xB6, 0x3B, 0xB5, 0x68, 0xB4, 0x3F, 0xCD, 0x9F, 0xBD, 0x45, 0xBD, 0x3F, 0xCD, 0xCD, 0x73, 0xFA, 0x4B, 0x42, 0x17, 0x21, 0x06, 0x06, 0x17, 0x53, 0x0F, 0xC0, 0x2A, 0x2A, 0x90, 0x90, 0xC0, 0x90, 0xC0, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0x90,
+	0xDA, 0x16, 0x16, 0x29, 0x16, 0x29, 0x16, 0xA8, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x2B, 0xC2, 0x0B, 0x0B, 0xE4, 0x0B, 0xE4, 0xE4, 0x0B, 0xB1, 0x24, 0xE4, 0x0B, 0x0B, 0x08, 0xC8, 0x8E, 0x02, 0x02, 0xED, 0x02, 0x6F, 0x16, 0x6F, 0x16, 0x29, 0x16, 0xC1, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xC1, 0x16, 0x5D, 0x5D, 0x5D, 0x16, 0x8E, 0x02, 0xA8, 0xD9, 0x28, 0xB1, 0xE4, 0x0B, 0x0B, 0x08, 0x15, 0x15, 0x94, 0x0D, 0x65, 0x8E, 0x8E, 0xF6, 0x8E, 0xC1, 0xF5, 0xEA, 0x6A, 0x96, 0xC1, 0x16, 0x4E, 0x40, 0x4D, 0x06, 0x4D, 0x06, 0x4D, 0x4D, 0x4D, 0x06, 0x85, 0x3E, 0x87, 0x06, 0x79, 0x06, 0xBF, 0x06, 0xBF, 0xCF, 0x85, 0xCF, 0x54, 0x0F, 0xA2, 0x0F, 0xA2, 0x78, 0x2A, 0xD1, 0xE0, 0x0F, 0x7A, 0x92, 0x92, 0xA7, 0x36, 0x2A, 0x36, 0xA4, 0x92, 0x92, 0xE8, 0x92, 0x36, 0x36, 0x36, 0x34, 0xA7, 0xA7, 0x36, 0x34, 0x61, 0x61, 0x5F, 0x38, 0xA7, 0x7B, 0x61, 0x0A, 0x32, 0x05, 0x0A, 0x46, 0x0A, 0x0A, 0x0A, 0x46, 0x05, 0x05, 0x88, 0x0A, 0xBE, 0xBE, 0x7B, 0xAA, 0x7B, 0x7B, 0x05, 0x38, 0xDE, 0x34, 0x05, 0xBE, 0xF0, 0x05, 0xC6, 0x05, 0x05, 0xC6, 0xC6, 0xFF, 0x1D, 0x1D, 0x1D, 0xFF, 0xFF, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0xF0, 0xFF, 0x1D, 0x23, 0xFF, 0x23, 0x1D, 0xE2, 0x61, 0x37, 0x37, 0x36, 0xC5, 0xF0, 0xC5, 0xC6, 0x23, 0x95, 0x1D, 0xA3, 0xB7, 0xB6, 0x68, 0xB6, 0x68, 0x73, 0xBD, 0xBD, 0x3F, 0x45, 0x81, 0xBD, 0xB4, 0xBD, 0x3F, 0x86, 0xC3, 0x12, 0x70, 0x06, 0x13, 0x17, 0x17, 0x06, 0x0F, 0x2A, 0x2A, 0x2A, 0x2A, 0xDB, 0xC0, 0x90, 0xC0, 0x2A, 0x2A, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0x53, 0xC0,
+	0xDA, 0x29, 0x29, 0x16, 0xA8, 0x29, 0x16, 0x16, 0xDA, 0x16, 0x29, 0x16, 0x16, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0xE4, 0xE4, 0x24, 0xE4, 0xE4, 0x0B, 0xE4, 0x0B, 0x0B, 0x0B, 0xC2, 0x94, 0x65, 0x29, 0x02, 0x02, 0xBB, 0x6F, 0x6F, 0x16, 0x16, 0x6F, 0x16, 0x16, 0x5D, 0x16, 0x8E, 0x16, 0x16, 0x16, 0x16, 0x16, 0xDA, 0xC1, 0x5D, 0x5D, 0x5D, 0x8E, 0x8E, 0x16, 0x29, 0xAE, 0xA5, 0xB1, 0xE4, 0x0B, 0x0B, 0xC2, 0x2B, 0x08, 0x15, 0xC8, 0x94, 0x65, 0x8E, 0x16, 0x16, 0x5D, 0x8E, 0xEA, 0x6A, 0x6A, 0x4E, 0x16, 0x4E, 0x71, 0x06, 0x4D, 0xF8, 0xBF, 0xF8, 0x54, 0x06, 0xF8, 0xF3, 0x3C, 0x06, 0xBF, 0x06, 0x54, 0x06, 0x53, 0x06, 0x54, 0x54, 0x06, 0xA2, 0x79, 0x54, 0xA2, 0x0F, 0x9C, 0x0F, 0x4F, 0x92, 0xE8, 0x92, 0x37, 0xD1, 0xA4, 0x36, 0xA4, 0x2A, 0x2A, 0x5F, 0x92, 0xA7, 0x36, 0xA4, 0x37, 0xCB, 0x37, 0x36, 0xA4, 0xA7, 0x36, 0x5F, 0x5F, 0x34, 0x37, 0x5F, 0x5F, 0x61, 0xBE, 0xBE, 0x0A, 0x0A, 0x05, 0x0A, 0x05, 0x46, 0x05, 0x7B, 0x7B, 0x7B, 0xBE, 0xE8, 0x46, 0x61, 0x5F, 0xA7, 0x61, 0x5F, 0x55, 0x34, 0xF2, 0xF0, 0xF0, 0x05, 0xC5, 0x05, 0xC6, 0x1D, 0x1D, 0x1D, 0x23, 0xFF, 0xF0, 0xC6, 0xC5, 0xC6, 0xC6, 0x74, 0xFF, 0xFF, 0x23, 0xFF, 0xC6, 0xFF, 0x1D, 0xFF, 0xF0, 0x1D, 0x1D, 0x1D, 0xF0, 0xBE, 0x34, 0xCE, 0x2A, 0xA7, 0xE8, 0x34, 0x38, 0x0A, 0x77, 0x95, 0x2C, 0x00, 0xB2, 0x0E, 0x9F, 0xB4, 0xCD, 0x9F, 0x9A, 0x3F, 0x45, 0x81, 0x81, 0x68, 0x81, 0x45, 0x4B, 0xCD, 0xD7, 0xA6, 0x17, 0x13, 0x06, 0x4D, 0x79, 0xCF, 0x2A, 0x0F, 0xA2, 0xD1, 0x2A, 0x90, 0xC7, 0xC0, 0x90, 0xA2, 0x2A, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x90, 0xC7, 0x90, 0xC0, 0xC0, 0xC0, 0x90,
+	0xDA, 0x29, 0xA8, 0xDA, 0x16, 0x29, 0x6F, 0x16, 0x16, 0x29, 0x16, 0x16, 0x5D, 0x8E, 0x2D, 0x08, 0xC2, 0x0B, 0x24, 0x0B, 0xE4, 0xE4, 0x24, 0xE4, 0x0B, 0xB1, 0xE4, 0x0B, 0x0B, 0x08, 0x94, 0x5D, 0x29, 0x52, 0xED, 0x02, 0x6F, 0x6F, 0x29, 0x16, 0xDA, 0xC1, 0x16, 0x16, 0x16, 0x29, 0x16, 0x8E, 0x16, 0x8E, 0x16, 0xC1, 0xC1, 0x16, 0x16, 0x5D, 0x16, 0x16, 0x02, 0x5D, 0xD9, 0xA5, 0xB1, 0xE4, 0x0B, 0x0B, 0x2B, 0x08, 0xC2, 0xC8, 0x08, 0x0D, 0x0D, 0x8E, 0x02, 0x16, 0x5D, 0xF5, 0x3E, 0xEA, 0xEA, 0x16, 0x3E, 0x71, 0x17, 0x4D, 0x4D, 0x4D, 0x40, 0xBF, 0x06, 0xEB, 0xF4, 0x3C, 0x06, 0x4D, 0x79, 0x06, 0x53, 0x54, 0x54, 0x79, 0x06, 0xA2, 0xBF, 0x06, 0x54, 0x9D, 0x06, 0xC0, 0x06, 0x9D, 0xD1, 0x93, 0xA2, 0xD1, 0x78, 0x36, 0x36, 0xD1, 0xA4, 0x36, 0x2A, 0x2A, 0x36, 0xA7, 0xA4, 0x66, 0xA4, 0x36, 0x36, 0x2A, 0xD1, 0xA7, 0x37, 0x8C, 0x55, 0x5F, 0x7B, 0x61, 0x5F, 0x61, 0x61, 0xA7, 0x32, 0x46, 0x7B, 0x7B, 0x7B, 0x05, 0x7B, 0x7B, 0x34, 0xAA, 0x7B, 0x46, 0xBE, 0x5F, 0x34, 0xCC, 0x55, 0x36, 0xF2, 0x32, 0xE2, 0xBE, 0x05, 0x0A, 0xC6, 0xC6, 0x1D, 0x1D, 0x1D, 0xFF, 0x1D, 0xFF, 0xC6, 0xC6, 0xBE, 0xC6, 0xFF, 0x74, 0xFF, 0xFF, 0x23, 0x74, 0xFF, 0xFF, 0xFF, 0x1D, 0xFF, 0x1D, 0x1D, 0x1D, 0xF1, 0x36, 0x4F, 0x4F, 0xA7, 0xE8, 0xCB, 0xB8, 0x34, 0xC6, 0xF0, 0x95, 0x8F, 0x00, 0xB6, 0x68, 0x9F, 0x68, 0xB6, 0xCD, 0x81, 0xB4, 0x81, 0xB4, 0x3F, 0xBD, 0x81, 0x3F, 0x4A, 0x12, 0x18, 0x70, 0x13, 0xCA, 0x17, 0x54, 0xCF, 0x53, 0xCB, 0xCB, 0x2A, 0x37, 0x2A, 0x90, 0x90, 0xC7, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0x90, 0x90, 0xC0, 0xC0, 0xC0, 0xC0,
+	0x16, 0xDA, 0x16, 0x29, 0x29, 0x29, 0x16, 0x29, 0x16, 0x16, 0x29, 0x16, 0x16, 0x8E, 0xC8, 0xC2, 0x2B, 0x0B, 0x0B, 0xE4, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0x0B, 0xE4, 0x0B, 0x0B, 0x08, 0x94, 0x5D, 0x29, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x6F, 0x16, 0x16, 0xDA, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x29, 0x16, 0x16, 0x4E, 0x16, 0xA8, 0x16, 0x16, 0x02, 0x65, 0xD2, 0xA5, 0xB1, 0xE4, 0x0B, 0x0B, 0x0B, 0xC2, 0xC2, 0x08, 0x08, 0x96, 0x8E, 0x8E, 0x16, 0x16, 0x16, 0x4E, 0xEA, 0x4E, 0x29, 0x6A, 0x06, 0x4D, 0x4D, 0x4D, 0x4D, 0xF8, 0x4D, 0x4D, 0xF8, 0xF3, 0xA9, 0x54, 0x4D, 0x06, 0x06, 0x06, 0x4D, 0x4D, 0x54, 0x79, 0x06, 0x4D, 0x79, 0x9C, 0xCA, 0xC0, 0x54, 0x54, 0xA2, 0xA2, 0xC0, 0xDB, 0xA4, 0x2A, 0xA2, 0x78, 0x36, 0x2A, 0xA2, 0xA4, 0x7F, 0x7F, 0x0F, 0x53, 0xA4, 0x92, 0x2A, 0xA2, 0x7A, 0x36, 0xCB, 0xCB, 0x37, 0x76, 0xA7, 0xA7, 0xA7, 0x61, 0x61, 0xA4, 0x36, 0xA4, 0x5F, 0x32, 0xE8, 0x34, 0x7B, 0x7B, 0x38, 0x7B, 0x46, 0x62, 0xD4, 0xBE, 0xBE, 0x34, 0x8C, 0x55, 0xBE, 0xF1, 0xF1, 0xBE, 0x5F, 0x05, 0xC5, 0xF0, 0xFF, 0x77, 0x1D, 0xD5, 0xFF, 0xC6, 0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0xC6, 0x74, 0xFF, 0x23, 0xFF, 0x23, 0xFF, 0xFF, 0xFF, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0xAE, 0x05, 0x66, 0x66, 0xA4, 0x89, 0x0F, 0xBA, 0x55, 0x34, 0x59, 0xD5, 0x0A, 0xB2, 0xB7, 0xB2, 0x97, 0xB6, 0x10, 0x4A, 0xBD, 0xF9, 0xB5, 0xB5, 0xB4, 0xBD, 0x45, 0xBD, 0x4B, 0x12, 0x8F, 0x8B, 0x17, 0x06, 0x11, 0x54, 0x79, 0xCE, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0x90, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0x90, 0xC0, 0x90, 0xC0,
+	0x16, 0x16, 0x16, 0x29, 0x6F, 0x29, 0xDA, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x2D, 0x08, 0xC2, 0x0B, 0x24, 0x0B, 0xE4, 0xE4, 0x24, 0xE4, 0xB1, 0x24, 0xE4, 0x0B, 0x0B, 0xC2, 0x15, 0x8E, 0x02, 0x02, 0x52, 0x02, 0x6F, 0x6F, 0x29, 0xDA, 0x16, 0x16, 0x16, 0xDA, 0x16, 0xDA, 0x16, 0x29, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x16, 0x16, 0x02, 0x65, 0xA5, 0xA5, 0xB1, 0x0B, 0x0B, 0x0B, 0x2B, 0x0B, 0x94, 0xC2, 0x08, 0xE9, 0x8E, 0x8E, 0x16, 0x5D, 0xF6, 0xF5, 0xF5, 0x5D, 0x65, 0x4D, 0x4D, 0x4D, 0x4D, 0xF8, 0x40, 0xBF, 0xDF, 0xE7, 0xF3, 0xF3, 0x4D, 0x06, 0x4D, 0xDF, 0x06, 0x4D, 0x9D, 0xDD, 0x79, 0x85, 0xA9, 0x79, 0x0F, 0xCA, 0xA2, 0x54, 0xE7, 0x53, 0x78, 0xCA, 0x90, 0x79, 0xCF, 0x2A, 0xA4, 0x78, 0xA4, 0xD3, 0xA2, 0x2A, 0xCF, 0x0F, 0xA2, 0xA2, 0xA2, 0x78, 0x92, 0x2A, 0xCE, 0xCB, 0x37, 0x37, 0xD3, 0xD3, 0x38, 0xD1, 0xA7, 0x61, 0xA7, 0x36, 0x36, 0x36, 0xD3, 0x36, 0x44, 0x61, 0xAA, 0xD1, 0x7B, 0x44, 0x34, 0xCC, 0x62, 0xAA, 0x76, 0x55, 0x5F, 0xF2, 0xBE, 0xBE, 0x5F, 0x05, 0xBE, 0xF1, 0xC5, 0xF0, 0x1D, 0xD5, 0xFF, 0xF0, 0xC6, 0xC5, 0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0x74, 0xFF, 0xFF, 0x23, 0x23, 0x74, 0x23, 0x23, 0xFF, 0x1D, 0xD5, 0x1D, 0x1D, 0x1D, 0xC6, 0x55, 0x55, 0x92, 0x93, 0x0F, 0x8B, 0x55, 0x34, 0x5F, 0x0A, 0x95, 0xAC, 0xB7, 0xB6, 0xB6, 0xB4, 0x68, 0x9F, 0xC9, 0xCD, 0x97, 0xFA, 0xB5, 0xCD, 0x04, 0x45, 0x10, 0x4B, 0x12, 0x41, 0x2E, 0x06, 0x0F, 0x53, 0x54, 0xCF, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0x90,
+	0x29, 0x16, 0xDA, 0x29, 0x29, 0x29, 0x16, 0x29, 0x16, 0x6F, 0x16, 0x29, 0x16, 0x8E, 0xC8, 0xC2, 0xC2, 0x0B, 0x0B, 0xE4, 0x24, 0x24, 0x24, 0x0B, 0xB1, 0x0B, 0xE4, 0x0B, 0x0B, 0x08, 0x94, 0x65, 0x29, 0x02, 0x52, 0x02, 0x6F, 0x6F, 0x29, 0xC1, 0x29, 0x16, 0xDA, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x29, 0x16, 0x16, 0x5D, 0x16, 0x5D, 0xA8, 0x16, 0x02, 0x02, 0x3C, 0xD9, 0x1E, 0xB1, 0xB1, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0x94, 0xC2, 0x96, 0xC8, 0x4E, 0xF5, 0x4E, 0xF5, 0x5D, 0x8E, 0x3E, 0x4D, 0x06, 0x4D, 0x4D, 0x4D, 0x6A, 0xE7, 0x4D, 0xF3, 0x3E, 0xA9, 0x54, 0x4D, 0x4D, 0x06, 0x06, 0xA9, 0x54, 0x54, 0x4D, 0x85, 0x4D, 0x54, 0x54, 0x06, 0x4D, 0x85, 0x79, 0x0F, 0xCA, 0xA2, 0x0F, 0xC0, 0x2A, 0x0F, 0x0F, 0x1A, 0xAA, 0xD3, 0xCC, 0xCF, 0x92, 0xA2, 0xCE, 0xA2, 0x78, 0xA2, 0xCE, 0xCE, 0x9C, 0x4F, 0x7F, 0xA4, 0xA4, 0x36, 0xA7, 0x0F, 0x37, 0xA7, 0xA4, 0xA7, 0x92, 0xD1, 0xD3, 0xAA, 0xD1, 0x37, 0xD3, 0x34, 0x5F, 0xA7, 0x76, 0x34, 0x76, 0xCC, 0x8C, 0xCB, 0xBE, 0xF1, 0xF2, 0x3D, 0x05, 0x5F, 0xBE, 0xAE, 0x77, 0xF0, 0x77, 0xFF, 0xFF, 0xC5, 0xC6, 0xC5, 0x0A, 0xC6, 0x57, 0xC6, 0xC6, 0x74, 0xFF, 0xFF, 0x23, 0xFF, 0x23, 0xFF, 0xFF, 0x23, 0x23, 0xFF, 0x23, 0x23, 0xD5, 0xAE, 0x37, 0x67, 0x3D, 0xE8, 0x06, 0x58, 0x0F, 0xD3, 0x37, 0x5F, 0xE2, 0xA1, 0x26, 0xB7, 0xB6, 0xF9, 0xB4, 0x68, 0x45, 0xBD, 0x68, 0x97, 0x6C, 0xB5, 0x10, 0xBD, 0x45, 0x4A, 0x4A, 0x33, 0x70, 0x06, 0x06, 0x06, 0xCF, 0x79, 0xCF, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x0F, 0x2A, 0x0F, 0x53, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0,
+	0x29, 0x16, 0x29, 0x16, 0x6F, 0x16, 0x29, 0x16, 0x16, 0x16, 0x6F, 0x16, 0x5D, 0x94, 0xC8, 0x08, 0xC2, 0x0B, 0x24, 0x24, 0x0B, 0xE4, 0xE4, 0x24, 0xE4, 0x0B, 0xE4, 0x0B, 0x0B, 0xC2, 0xC8, 0x65, 0x29, 0x02, 0x52, 0x02, 0xBB, 0x6F, 0x29, 0x16, 0xDA, 0xDA, 0x16, 0x29, 0x16, 0xA8, 0x16, 0xA8, 0x16, 0xDA, 0x5D, 0x16, 0x16, 0x16, 0x16, 0x29, 0x16, 0x02, 0x02, 0x15, 0xD9, 0xA5, 0xB1, 0xB1, 0xB1, 0x0B, 0x2B, 0x0B, 0xC2, 0x08, 0x08, 0x08, 0x94, 0x65, 0x65, 0x4E, 0x16, 0x5D, 0x40, 0x96, 0x4D, 0x4D, 0xDF, 0x4D, 0xDF, 0x54, 0xA9, 0x3E, 0x87, 0x3E, 0xA9, 0x79, 0x06, 0x06, 0x4D, 0x06, 0xA9, 0x54, 0x4D, 0x87, 0xA9, 0x79, 0x0F, 0x06, 0xDD, 0x85, 0x54, 0x06, 0xD0, 0x0F, 0xCF, 0x0F, 0x17, 0x0F, 0x1A, 0x0F, 0x11, 0x1A, 0x1A, 0x17, 0x11, 0x0F, 0xD1, 0x92, 0x92, 0x2A, 0xCB, 0xCB, 0x0F, 0x53, 0x2A, 0xA4, 0xA2, 0x2A, 0x37, 0xD1, 0x36, 0x0F, 0x92, 0x36, 0xD1, 0xA7, 0x0F, 0xD3, 0xD3, 0x76, 0xCC, 0x37, 0xD3, 0xD3, 0x37, 0xCB, 0xA7, 0x55, 0x8C, 0x38, 0xF1, 0xE8, 0x3D, 0x5F, 0x5F, 0x59, 0xC5, 0xE2, 0xE2, 0xC5, 0xC5, 0xC5, 0x0A, 0x0A, 0xC5, 0x0A, 0xC5, 0xC6, 0xC6, 0xC6, 0xC5, 0xF0, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0xFF, 0xFF, 0x23, 0x23, 0x1D, 0x23, 0xD5, 0x05, 0xDE, 0x37, 0xD3, 0xCF, 0x11, 0x78, 0xA4, 0x55, 0x55, 0x38, 0x95, 0x57, 0xB2, 0xFB, 0xB6, 0xB4, 0x73, 0xBD, 0x04, 0x68, 0x68, 0xB4, 0x68, 0xB4, 0x10, 0xBD, 0x45, 0x10, 0x12, 0x20, 0x11, 0x1A, 0x06, 0x17, 0x54, 0x79, 0x53, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x0F, 0x90, 0x53, 0x53, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x90, 0xC7, 0xC0, 0xC0, 0xC0, 0x90,
+	0x16, 0x29, 0x16, 0xA8, 0x16, 0x16, 0x16, 0x29, 0x16, 0x6F, 0x16, 0x16, 0x8E, 0x65, 0xC8, 0x08, 0xC2, 0x0B, 0x0B, 0xE4, 0x24, 0x24, 0x24, 0x24, 0xB1, 0x0B, 0xB1, 0x0B, 0x0B, 0xC2, 0x08, 0x4E, 0x29, 0x02, 0xED, 0x52, 0xBB, 0x6F, 0x6F, 0x16, 0x16, 0x16, 0x16, 0xA8, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x29, 0x02, 0x2B, 0xB3, 0x1E, 0xB1, 0xB1, 0xB1, 0x0B, 0x0B, 0x0B, 0xC2, 0x2B, 0x08, 0xC2, 0x94, 0x94, 0x65, 0x16, 0x16, 0x3E, 0x96, 0x06, 0x6A, 0xDF, 0x54, 0xDF, 0x4D, 0x4D, 0x3E, 0xF3, 0x40, 0xA9, 0x4D, 0x4D, 0x54, 0x4D, 0x06, 0xA9, 0x54, 0xA9, 0x87, 0xA9, 0x4D, 0x06, 0xBF, 0x06, 0xA9, 0x06, 0xC0, 0x0F, 0xC0, 0xCA, 0x0F, 0x1A, 0x0F, 0x0F, 0x1A, 0x78, 0x2F, 0x1C, 0x13, 0x48, 0x48, 0x8B, 0xB8, 0x58, 0x98, 0xE0, 0xA2, 0xCB, 0xA4, 0x2A, 0x2A, 0x2A, 0x2A, 0xA2, 0xD1, 0x2A, 0xA2, 0xD1, 0xD3, 0x0F, 0x0F, 0xD3, 0xD1, 0xAA, 0x1A, 0x55, 0xD1, 0x88, 0xCB, 0x4F, 0x2A, 0x55, 0x55, 0x37, 0xE8, 0x32, 0xF1, 0x5F, 0x5F, 0x59, 0x05, 0xAE, 0x77, 0xC5, 0xC5, 0x05, 0xBE, 0x0A, 0x05, 0x0A, 0x0A, 0xC6, 0xC6, 0xC5, 0xC6, 0xC5, 0xF0, 0xFF, 0xF0, 0x1D, 0x1D, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xF7, 0xF7, 0x23, 0xF0, 0x37, 0x67, 0x36, 0x0F, 0x11, 0xCA, 0x0F, 0x01, 0xB8, 0x37, 0xC5, 0xA1, 0x9B, 0x00, 0xB6, 0xB6, 0xB4, 0x73, 0xBD, 0x10, 0x9F, 0xBD, 0xCD, 0x4A, 0x10, 0xCD, 0xBD, 0xBD, 0x4B, 0x33, 0x70, 0x0F, 0x06, 0x06, 0x17, 0xCF, 0xCF, 0x0F, 0xC0, 0xC0, 0x2A, 0x2A, 0x0F, 0x90, 0x53, 0xC0, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0x16, 0xDA, 0x16, 0x16, 0x29, 0xA8, 0x16, 0x16, 0x6F, 0xC1, 0xC1, 0x16, 0x8E, 0x65, 0xC8, 0xC2, 0x2B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0xE4, 0x0B, 0xE4, 0x0B, 0xE4, 0x0B, 0x0B, 0xC2, 0x08, 0x8E, 0xBB, 0x52, 0xED, 0x02, 0xBB, 0x6F, 0x6F, 0x16, 0xDA, 0x16, 0x29, 0x16, 0x16, 0x29, 0x16, 0x29, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x16, 0x29, 0x16, 0x02, 0x4C, 0xFD, 0xD9, 0xA5, 0xB1, 0xB1, 0xB1, 0x0B, 0x0B, 0x0B, 0x0B, 0x94, 0x0B, 0xC2, 0xC2, 0x94, 0x5D, 0x02, 0x5D, 0x96, 0x71, 0x4D, 0xF8, 0x6A, 0xDF, 0x4D, 0xDF, 0x87, 0x3E, 0x6A, 0xA9, 0x06, 0x06, 0x4D, 0xA9, 0x54, 0x4D, 0x4D, 0x85, 0xE7, 0x6A, 0x54, 0x06, 0x06, 0x4D, 0x85, 0x85, 0x54, 0xCA, 0xCA, 0x21, 0x06, 0x17, 0x17, 0x2E, 0x70, 0x17, 0x13, 0x13, 0x1C, 0x1C, 0x70, 0x47, 0x48, 0x8B, 0x5C, 0xAF, 0xBA, 0x88, 0xCC, 0xA2, 0x0F, 0xD3, 0x0F, 0x0F, 0x0F, 0xCA, 0x0F, 0xA2, 0xD3, 0x1A, 0x0F, 0xCC, 0xD1, 0x2F, 0xCC, 0x89, 0x21, 0x1A, 0xD1, 0xCB, 0x9C, 0x9C, 0xCE, 0x36, 0x32, 0x32, 0x92, 0x34, 0x3D, 0xC5, 0xF2, 0xC5, 0x77, 0xF0, 0xC5, 0xBE, 0xC5, 0x05, 0x0A, 0xC6, 0xC6, 0xC6, 0xC6, 0xC5, 0xC6, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x1D, 0x23, 0x1D, 0xFF, 0x23, 0x74, 0x23, 0x23, 0xFF, 0x23, 0xA0, 0x1D, 0x05, 0x4F, 0x2A, 0x0F, 0xCC, 0x17, 0x01, 0x8F, 0x5C, 0x01, 0x05, 0x95, 0x95, 0x26, 0xB7, 0xB6, 0x97, 0x73, 0x73, 0x3F, 0x9F, 0xBD, 0x81, 0x68, 0xD6, 0x10, 0x68, 0x9F, 0x4B, 0x8D, 0x20, 0x11, 0x06, 0x06, 0x17, 0xCF, 0x06, 0xC0, 0xA2, 0x2A, 0x2A, 0x0F, 0x2A, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x0F, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x66, 0xC0, 0xC0,
+	0x16, 0xDA, 0xA8, 0x16, 0x16, 0x16, 0xDA, 0x16, 0x16, 0xC1, 0xC1, 0x8E, 0x8E, 0x65, 0xC8, 0x08, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0xE4, 0xB1, 0x0B, 0xB1, 0x0B, 0x24, 0x0B, 0xC2, 0xC8, 0x65, 0x02, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x29, 0x16, 0x29, 0x16, 0x16, 0x6F, 0x16, 0x16, 0x6F, 0x16, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x16, 0x16, 0x02, 0x4C, 0x0B, 0xB3, 0xA5, 0x1E, 0xB1, 0xB1, 0xB1, 0x0B, 0x0B, 0x2B, 0x0B, 0xC2, 0xC2, 0x0B, 0x94, 0x94, 0x5D, 0x94, 0x96, 0x4D, 0xF8, 0x4D, 0xEB, 0x54, 0x4D, 0xF3, 0xF3, 0xA9, 0xDF, 0x06, 0x4D, 0xDF, 0xE7, 0x4D, 0xBF, 0x85, 0x3E, 0x87, 0xDF, 0x4D, 0x54, 0x4D, 0x06, 0x4D, 0x85, 0xBF, 0x17, 0x06, 0x1A, 0x06, 0x42, 0x42, 0xF4, 0x20, 0x18, 0x20, 0x20, 0x7D, 0x1F, 0x13, 0x7D, 0x11, 0x1C, 0xCC, 0xAC, 0xE3, 0x5E, 0xCC, 0xCC, 0x2F, 0xD3, 0x2F, 0xD1, 0x2E, 0xE0, 0x11, 0x0F, 0x0F, 0x7A, 0x1A, 0x2F, 0xCC, 0x1F, 0x1F, 0xA6, 0x13, 0xD4, 0x1C, 0x48, 0xCB, 0xCF, 0xCE, 0x92, 0xE2, 0x93, 0x36, 0x5F, 0xBE, 0xF2, 0xC5, 0xAE, 0xF1, 0xC5, 0xF1, 0xBE, 0xF2, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xFF, 0x74, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF0, 0x1D, 0x1D, 0x1D, 0xFF, 0x23, 0x23, 0x74, 0x69, 0x23, 0x23, 0x1D, 0xB3, 0xC5, 0x37, 0x2A, 0x78, 0x17, 0x8F, 0x8F, 0x8F, 0xAF, 0x84, 0x37, 0xAE, 0xA1, 0xAB, 0x3B, 0xB7, 0x6D, 0xB4, 0xB4, 0x3F, 0xB4, 0xB4, 0xBD, 0x81, 0xBD, 0x9F, 0x10, 0xBD, 0x10, 0x4B, 0x33, 0x70, 0x0F, 0x0F, 0x17, 0xCF, 0x06, 0x53, 0x2A, 0xA2, 0x0F, 0x2A, 0x2A, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0x0F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x4F, 0x53, 0x4F, 0xC0,
+	0x16, 0xC1, 0xA8, 0x16, 0xA8, 0x16, 0xDA, 0xDA, 0x16, 0xC1, 0x8E, 0x8E, 0x8E, 0x65, 0x94, 0xC2, 0xC2, 0x0B, 0x24, 0x24, 0x0B, 0xE4, 0x24, 0xE4, 0xE4, 0x0B, 0xB1, 0x0B, 0x0B, 0xC2, 0x08, 0x5D, 0x29, 0x02, 0xED, 0x52, 0x02, 0x6F, 0x29, 0x16, 0xDA, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xDA, 0x16, 0x16, 0x8E, 0x16, 0x16, 0xBB, 0x29, 0x02, 0x4C, 0x0B, 0xB3, 0xA5, 0xA5, 0xB1, 0xB1, 0x0B, 0x0B, 0x0B, 0x0B, 0x2B, 0xC2, 0xC2, 0x0B, 0x08, 0x94, 0x65, 0x0D, 0x6A, 0xF8, 0xF8, 0xF8, 0x4D, 0xF8, 0x3E, 0xF3, 0x87, 0xDF, 0x54, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0xE7, 0x3E, 0xDF, 0x85, 0x4D, 0x17, 0x06, 0x4D, 0x6A, 0xDF, 0x06, 0xCA, 0x06, 0x06, 0xEB, 0x07, 0x5C, 0x8B, 0x17, 0x17, 0x7D, 0x7D, 0x41, 0x33, 0x20, 0x20, 0xE3, 0x1F, 0x22, 0x44, 0xD4, 0x48, 0x35, 0xA6, 0x35, 0xBC, 0xBC, 0x1F, 0x76, 0xD4, 0x1C, 0x1C, 0x11, 0x42, 0x13, 0x1F, 0x2F, 0x22, 0x9B, 0x7D, 0xD6, 0x26, 0xBC, 0x2F, 0xCC, 0x8B, 0xCB, 0xE8, 0x32, 0x7F, 0x36, 0x7B, 0xF1, 0xF0, 0x1D, 0xAE, 0xC5, 0xAE, 0xF0, 0xC6, 0xC6, 0xC6, 0xC6, 0x05, 0xC6, 0xC6, 0xC6, 0x74, 0x1D, 0xFF, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0x1D, 0x1D, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0x23, 0x23, 0xF7, 0x95, 0x91, 0x5F, 0x37, 0xCF, 0xF4, 0x6F, 0x52, 0x6F, 0x5C, 0x01, 0x67, 0xAE, 0xD5, 0xA1, 0x60, 0x00, 0x3B, 0x6D, 0xB4, 0xB4, 0x73, 0xB4, 0x82, 0xBD, 0x68, 0x9F, 0x10, 0x45, 0x10, 0x4B, 0x8D, 0x20, 0x17, 0x1A, 0x06, 0x79, 0x17, 0xCE, 0x0F, 0xC0, 0x0F, 0xC0, 0x2A, 0x0F, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0x2A, 0x90, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x53, 0xC0, 0xC0, 0x53, 0x4F, 0x66, 0x4F, 0x53,
+	0xDA, 0xDA, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0xC1, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x08, 0x08, 0xC2, 0x0B, 0x0B, 0xE4, 0x24, 0x24, 0xE4, 0x0B, 0xB1, 0x0B, 0xE4, 0x24, 0x0B, 0xC2, 0x08, 0x8E, 0x02, 0x02, 0xED, 0x02, 0x02, 0x6F, 0x6F, 0x29, 0x16, 0x16, 0xDA, 0x16, 0x29, 0x16, 0x16, 0xF6, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x02, 0x16, 0x02, 0x4C, 0xFD, 0xB3, 0xA5, 0x1E, 0xA5, 0xB1, 0xB1, 0x0B, 0xB1, 0x2B, 0x2B, 0x2B, 0x0B, 0x08, 0x2B, 0x94, 0x5D, 0x94, 0xE9, 0x40, 0xF8, 0xF8, 0xF8, 0x3E, 0xEA, 0x3E, 0xDF, 0x4D, 0x4D, 0x4D, 0x4D, 0xA9, 0x4D, 0xE7, 0x40, 0x3E, 0xDF, 0xF8, 0x54, 0xBF, 0x4D, 0xF8, 0x54, 0x06, 0x06, 0x06, 0x06, 0x13, 0xF4, 0x5E, 0x13, 0x13, 0x2E, 0x70, 0xF8, 0x7D, 0x20, 0x20, 0x20, 0x4B, 0x12, 0x30, 0x8A, 0x8A, 0x22, 0x22, 0x03, 0x75, 0xBC, 0x75, 0x35, 0xE3, 0x60, 0x70, 0x1F, 0x13, 0x1C, 0xBC, 0x35, 0x20, 0x12, 0x35, 0xD6, 0x35, 0x35, 0xB4, 0x14, 0x22, 0x2C, 0x37, 0x32, 0x93, 0x2A, 0x37, 0x5F, 0xBE, 0xF1, 0xE2, 0xC5, 0xC6, 0xC5, 0xC5, 0xBE, 0xAE, 0xC5, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xC6, 0xFF, 0xB3, 0xFF, 0xFF, 0x23, 0xC6, 0x23, 0xFF, 0x1D, 0xD5, 0x77, 0x91, 0x93, 0x55, 0xFC, 0x29, 0xAF, 0x8F, 0x8F, 0x5C, 0x5C, 0x6E, 0x59, 0xD5, 0xA1, 0x76, 0xFB, 0x6D, 0xB6, 0x68, 0xB4, 0xB4, 0x3F, 0xB4, 0xF9, 0xE6, 0xBD, 0x9F, 0xBD, 0xBD, 0xBD, 0x4B, 0x33, 0xEB, 0x13, 0x0F, 0xCF, 0x54, 0xCE, 0xC0, 0x0F, 0xA2, 0xA2, 0x2A, 0xC0, 0xC0, 0x90, 0x2A, 0x2A, 0x2A, 0x0F, 0x0F, 0x0F, 0x2A, 0x0F, 0x53, 0xC0, 0xC0, 0xC0, 0xC0, 0x90, 0x53, 0x66, 0x90, 0x66, 0x90, 0x4F, 0x66, 0x4F,
+	0xC1, 0xDA, 0xC1, 0x29, 0x16, 0xA8, 0xDA, 0xDA, 0xC1, 0xC1, 0xC1, 0x8E, 0x8E, 0x94, 0xC8, 0x08, 0xC2, 0x0B, 0x0B, 0x24, 0xE4, 0x24, 0xB1, 0x24, 0xB1, 0x0B, 0xE4, 0x0B, 0x0B, 0xC2, 0x94, 0x65, 0x02, 0x02, 0xED, 0x52, 0x02, 0x6F, 0x6F, 0x29, 0xDA, 0x16, 0x16, 0x29, 0x16, 0xC1, 0x16, 0x5D, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x29, 0x16, 0x02, 0x02, 0xA9, 0x95, 0xA5, 0x1E, 0xB1, 0xB1, 0xB1, 0xB1, 0x0B, 0x2B, 0x94, 0x94, 0x2B, 0x0B, 0x94, 0x94, 0x94, 0x65, 0x3E, 0x40, 0xF8, 0xF8, 0xEB, 0xF5, 0x3E, 0xF8, 0x4D, 0x06, 0x4D, 0xDF, 0x54, 0xDF, 0xF8, 0x3E, 0x3C, 0xE7, 0xDF, 0x54, 0xF8, 0xF8, 0x54, 0xF8, 0x06, 0x06, 0x17, 0x06, 0x06, 0xEB, 0x70, 0x13, 0x13, 0x2E, 0x20, 0x18, 0x20, 0x20, 0x12, 0x12, 0x4A, 0x4B, 0x33, 0xEF, 0x30, 0x22, 0x30, 0xD8, 0xEF, 0x75, 0x75, 0x35, 0x7E, 0x35, 0x4A, 0x1B, 0x1B, 0x12, 0xE1, 0x12, 0x12, 0x4A, 0x68, 0x9F, 0xB6, 0xB6, 0x9F, 0xFB, 0x6C, 0xBC, 0x46, 0x57, 0xAA, 0x8C, 0x34, 0xBE, 0xF2, 0xE2, 0xC5, 0xF0, 0xF0, 0xC6, 0xC5, 0xC6, 0xC5, 0xE2, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xFF, 0x1D, 0xFF, 0xF0, 0x1D, 0xFF, 0x1D, 0xC6, 0xFF, 0x1D, 0x23, 0x1D, 0xFF, 0x1D, 0xD5, 0x77, 0x91, 0xE8, 0x0F, 0x6E, 0x8F, 0xAF, 0xAF, 0x02, 0x07, 0x8F, 0x5C, 0x64, 0xE8, 0xF1, 0x77, 0x91, 0xA3, 0xB7, 0xB6, 0x6D, 0x9F, 0x9F, 0xB4, 0xB4, 0xB4, 0xB5, 0x82, 0x68, 0x9F, 0x10, 0xBD, 0x45, 0x8D, 0x20, 0x2E, 0x11, 0xCF, 0x54, 0x79, 0xCF, 0x0F, 0x2A, 0xA2, 0xA2, 0xC0, 0x2A, 0x2A, 0xC0, 0x2A, 0x0F, 0x2A, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0xC0, 0x4F, 0xC0, 0x53, 0xC0, 0x66, 0xCE, 0xCE, 0x4F, 0x4F, 0x66, 0x4F, 0x53, 0xC0,
+	0xDA, 0xC1, 0xDA, 0xC1, 0xA8, 0x5D, 0x16, 0x16, 0xC1, 0xC1, 0x8E, 0x8E, 0x8E, 0x94, 0x08, 0xC2, 0xC2, 0x0B, 0x0B, 0xE4, 0x24, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0xB1, 0x0B, 0x0B, 0xC2, 0x08, 0x65, 0x02, 0x02, 0xED, 0x02, 0x02, 0x6F, 0x6F, 0x29, 0x16, 0x29, 0x16, 0xA8, 0x16, 0x16, 0x5D, 0x5D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x4C, 0x0D, 0xB3, 0x28, 0x1E, 0xA5, 0xB1, 0xA5, 0xB1, 0x0B, 0x2B, 0x2B, 0x94, 0x2B, 0x0B, 0x94, 0x65, 0x65, 0x5D, 0x3E, 0xF8, 0xF8, 0x4E, 0xC1, 0xF3, 0xDF, 0x4D, 0x4D, 0xDF, 0x4D, 0x4D, 0x4D, 0x6A, 0x87, 0x6A, 0xDF, 0x4D, 0xDF, 0x06, 0xF8, 0x6A, 0xDF, 0x4D, 0x06, 0x17, 0xF8, 0x13, 0xEA, 0x42, 0x17, 0x13, 0x70, 0x42, 0x18, 0x7D, 0x18, 0x12, 0x33, 0x20, 0x1B, 0x12, 0x1B, 0x1F, 0xD8, 0xEF, 0x30, 0x7E, 0x35, 0x51, 0x25, 0x31, 0x0E, 0x0E, 0x35, 0x7E, 0x4A, 0xC9, 0xE1, 0x04, 0xBD, 0x10, 0x9F, 0x6D, 0x68, 0xB6, 0xFB, 0xB7, 0xE3, 0x62, 0x57, 0xCC, 0x64, 0xBE, 0xF2, 0xE2, 0xF0, 0x91, 0xC5, 0xC6, 0xC6, 0xC6, 0xF2, 0xAE, 0xC5, 0xC6, 0xC5, 0xC5, 0xC5, 0xC5, 0xC6, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0x1D, 0xF0, 0xC6, 0xC6, 0x23, 0x1D, 0x1D, 0x1D, 0x1D, 0xF7, 0x77, 0x91, 0x7A, 0x58, 0xF4, 0x5C, 0x8F, 0x29, 0xAF, 0xAF, 0xA8, 0x8F, 0xF4, 0x48, 0xCC, 0x32, 0x95, 0xA1, 0xBC, 0xB7, 0x68, 0x97, 0xE6, 0x9F, 0xBD, 0xB4, 0xB4, 0xB4, 0xB5, 0xB4, 0x3F, 0xBD, 0xBD, 0x45, 0x45, 0x12, 0x70, 0x11, 0x53, 0xCF, 0x54, 0x79, 0xCE, 0xA2, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x0F, 0xC0, 0x0F, 0x0F, 0x0F, 0x66, 0x53, 0xC0, 0xC0, 0x90, 0x4F, 0xCE, 0x53, 0x66, 0x4F, 0x4F, 0x53, 0xC0, 0xC0,
+	0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xA8, 0x16, 0x16, 0xC1, 0x8E, 0x4E, 0x8E, 0x94, 0xC8, 0xC2, 0xC2, 0x0B, 0x24, 0xE4, 0xE4, 0xE4, 0xE4, 0xB1, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x65, 0x02, 0x02, 0xED, 0x52, 0x02, 0x6F, 0x6F, 0x6F, 0x16, 0x16, 0x29, 0x16, 0x16, 0x29, 0x16, 0x5D, 0x16, 0x29, 0x16, 0x8E, 0x8E, 0x8E, 0x16, 0x16, 0x16, 0x16, 0x4C, 0x5D, 0xA5, 0x28, 0xA5, 0x1E, 0x28, 0xB1, 0xB1, 0x2B, 0x2B, 0x94, 0x94, 0x94, 0x2B, 0x94, 0x5D, 0x5D, 0x65, 0x6A, 0xF8, 0x3E, 0x16, 0xF5, 0x6A, 0x4D, 0x4D, 0x4D, 0xF8, 0x54, 0x54, 0xF8, 0x87, 0xDF, 0x54, 0x4D, 0xF8, 0x4D, 0xDF, 0xDF, 0xF8, 0x4D, 0x4D, 0x13, 0x06, 0x17, 0xEA, 0x07, 0x13, 0x13, 0x1F, 0x7D, 0x20, 0x7D, 0x7D, 0x20, 0x7D, 0x1C, 0x75, 0x20, 0x1B, 0x51, 0x20, 0x1B, 0x7E, 0x7E, 0x35, 0x1B, 0x7C, 0x0E, 0xC9, 0x7C, 0x7E, 0x1B, 0x7C, 0x25, 0xC9, 0x31, 0xC9, 0x04, 0x3B, 0x3B, 0x3B, 0x10, 0x3B, 0xD6, 0xA6, 0x0A, 0x44, 0xAC, 0xCC, 0x05, 0xE2, 0xD5, 0xF0, 0xFF, 0xF0, 0xC6, 0xC5, 0xC6, 0xC6, 0xC6, 0xC5, 0xF0, 0xC6, 0xBE, 0xC5, 0xC6, 0xC5, 0xC6, 0xFF, 0x74, 0xFF, 0xFF, 0xFF, 0xF0, 0xC6, 0xC6, 0xC6, 0xB3, 0xFF, 0xFF, 0x95, 0x77, 0xE8, 0x8C, 0xB8, 0x5C, 0xAF, 0xAF, 0xAF, 0x02, 0x8F, 0x29, 0xA8, 0xA8, 0x01, 0x84, 0xAA, 0x32, 0x91, 0x95, 0x1C, 0xFA, 0x68, 0xB2, 0xE6, 0x10, 0xCD, 0x68, 0xBD, 0x86, 0xB4, 0xB4, 0x73, 0x10, 0x86, 0x45, 0x81, 0xBD, 0x18, 0x2E, 0x11, 0xCF, 0x17, 0x79, 0xCF, 0x2A, 0xA2, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x0F, 0xC0, 0x2A, 0x0F, 0xC0, 0x0F, 0xC0, 0x4F, 0x4F, 0xC0, 0x53, 0x4F, 0x66, 0xC0, 0xC0, 0xC0, 0x66, 0x4F, 0x66, 0xCE, 0xCE,
+	0xC1, 0xDA, 0xC1, 0xA8, 0xC1, 0xC1, 0x16, 0x29, 0x16, 0x16, 0xC1, 0x8E, 0x8E, 0x94, 0x94, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0xE4, 0xE4, 0x0B, 0x0B, 0xC2, 0x94, 0x94, 0x02, 0x02, 0xED, 0x02, 0x02, 0x6F, 0x6F, 0x29, 0x16, 0x29, 0x16, 0xA8, 0x16, 0x16, 0x16, 0xF6, 0xDA, 0xF6, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xBB, 0x16, 0x02, 0x02, 0x1E, 0xD9, 0xA5, 0x1E, 0xB1, 0xA5, 0xB1, 0xB1, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x65, 0x3C, 0x6A, 0xF3, 0xF5, 0xF3, 0x6A, 0xDF, 0x4D, 0xF8, 0x4D, 0x4D, 0x4D, 0xEB, 0xEA, 0x3E, 0xDF, 0x4D, 0x54, 0xDF, 0x4D, 0x87, 0xF8, 0x4D, 0x54, 0x4D, 0x17, 0xF8, 0xF8, 0x41, 0x70, 0x13, 0x70, 0x7D, 0x20, 0x70, 0x1F, 0x7D, 0x20, 0x7D, 0x75, 0x1B, 0x4A, 0x4A, 0xE1, 0x1B, 0x1B, 0x35, 0x35, 0x51, 0xE1, 0x1B, 0x31, 0x1B, 0x7E, 0x31, 0x0E, 0x1B, 0x31, 0x31, 0x1B, 0x04, 0x04, 0x04, 0xB7, 0xB7, 0xB7, 0xB4, 0xDE, 0x0A, 0xD4, 0x49, 0x8C, 0xBE, 0xF0, 0xF1, 0xF0, 0x57, 0xC5, 0xC5, 0xC6, 0xC5, 0xC6, 0xC5, 0xF2, 0xC6, 0xC6, 0xC6, 0xC6, 0xC5, 0xC5, 0xC6, 0xC6, 0x74, 0xFF, 0x74, 0xC6, 0xFF, 0xFF, 0x1D, 0xF0, 0xC6, 0x69, 0xD5, 0xD5, 0x32, 0xAC, 0x5E, 0x8F, 0xAF, 0xAF, 0xAF, 0xA8, 0xA8, 0x29, 0xAF, 0x29, 0xA8, 0x84, 0x90, 0x37, 0xE8, 0x95, 0x88, 0x20, 0xB4, 0x6C, 0x97, 0xB7, 0xCD, 0xBD, 0xB4, 0x86, 0xBD, 0xBD, 0x81, 0x73, 0x14, 0x9F, 0xBD, 0x81, 0xF9, 0x4B, 0x7D, 0x11, 0x53, 0x54, 0xCF, 0xCF, 0x53, 0x2A, 0xA2, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x0F, 0x2A, 0x0F, 0xC0, 0xC0, 0x4F, 0x53, 0xC0, 0x4F, 0x66, 0xC0, 0xC0, 0xC0, 0x4F, 0x53, 0x4F, 0xCE, 0xCE,
+	0xC1, 0xDA, 0xC1, 0xA8, 0xC1, 0xA8, 0x16, 0x16, 0x29, 0x16, 0x8E, 0x8E, 0x94, 0x94, 0x08, 0x08, 0xC2, 0x0B, 0x0B, 0xE4, 0xE4, 0x24, 0xE4, 0x24, 0xB1, 0x0B, 0xB1, 0x0B, 0x0B, 0xC2, 0x08, 0x5D, 0x29, 0x02, 0xED, 0x52, 0x02, 0x6F, 0x29, 0x6F, 0x16, 0xDA, 0x16, 0x16, 0x29, 0xA8, 0x16, 0x5D, 0xDA, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x16, 0xBB, 0x16, 0x02, 0x02, 0x02, 0x90, 0xD9, 0x28, 0xA5, 0xB1, 0xB1, 0xB1, 0x0B, 0x2B, 0x5D, 0x94, 0x2B, 0xC2, 0xC2, 0x15, 0x0D, 0x40, 0xF5, 0x29, 0xF3, 0x6A, 0xF8, 0x4D, 0x4D, 0x4D, 0x4D, 0xF8, 0xEB, 0xEB, 0x6A, 0xF8, 0xF8, 0xDF, 0x54, 0xF8, 0xF8, 0x3E, 0xDF, 0x54, 0x4D, 0x17, 0xF8, 0xEA, 0x41, 0x2E, 0x13, 0xF8, 0x7D, 0x20, 0x7D, 0x1F, 0x7D, 0x7D, 0x1B, 0x12, 0x9E, 0xC9, 0x4A, 0x4A, 0xC9, 0x4A, 0xE1, 0x51, 0x75, 0x51, 0x7E, 0x51, 0x7E, 0x51, 0x51, 0x7E, 0x7C, 0x0E, 0x0E, 0x7C, 0xB0, 0x04, 0x04, 0x04, 0xB7, 0x00, 0xD6, 0x49, 0x89, 0x2C, 0x5E, 0x37, 0x77, 0xBE, 0x0A, 0xF0, 0xBE, 0xC6, 0xC6, 0xC5, 0xC6, 0xC6, 0xC5, 0xBE, 0xC6, 0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0xC5, 0xC6, 0xC5, 0xC6, 0xFF, 0xFF, 0xC6, 0x74, 0xFF, 0x77, 0xFF, 0xD5, 0x95, 0xF0, 0x34, 0x5E, 0xAF, 0xAF, 0x8F, 0xA8, 0x02, 0xAF, 0x29, 0x8F, 0xA8, 0x6E, 0x6E, 0x64, 0x36, 0xE8, 0x32, 0x77, 0x88, 0xA3, 0x00, 0xF9, 0xB4, 0x97, 0x14, 0xB4, 0x73, 0x81, 0xBD, 0xBD, 0x45, 0x45, 0x73, 0x14, 0xB4, 0xB4, 0x81, 0x81, 0xE3, 0x2E, 0x1A, 0xCF, 0x79, 0x17, 0xCF, 0x2A, 0x36, 0xD1, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x0F, 0x2A, 0x2A, 0xC0, 0xCB, 0x2A, 0x0F, 0xC0, 0x53, 0xC0, 0xC0, 0xC0, 0x4F, 0x4F, 0x66, 0x4F, 0x66, 0x4F, 0x66, 0x90, 0xCE,
+	0xC1, 0xF5, 0xF5, 0xF5, 0xC1, 0xC1, 0x29, 0x16, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x94, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0xB1, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x8E, 0x29, 0x52, 0x02, 0x52, 0x02, 0x6F, 0x6F, 0x29, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x5D, 0xA8, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x16, 0x16, 0x16, 0x02, 0x4C, 0x84, 0x28, 0xA5, 0x1E, 0xA5, 0x28, 0xB1, 0x24, 0x2B, 0x94, 0x94, 0x0B, 0xC2, 0xC2, 0x15, 0x6A, 0x3E, 0xA8, 0xF4, 0x3E, 0x6A, 0xDF, 0x4D, 0x4D, 0x17, 0x4D, 0xF8, 0xF5, 0xF8, 0xDF, 0x54, 0xDF, 0xF8, 0x4D, 0xF8, 0x6A, 0x54, 0x4D, 0x54, 0x4D, 0xF8, 0xF8, 0x41, 0x42, 0xF8, 0x7D, 0x13, 0x7D, 0x7D, 0x7D, 0x1B, 0x4A, 0x12, 0x12, 0x4A, 0xC9, 0xC9, 0x4A, 0xC9, 0xC9, 0x1B, 0x51, 0x7E, 0x7E, 0x1B, 0xE1, 0x7C, 0x51, 0x1B, 0x7E, 0x51, 0xC9, 0x7C, 0x0E, 0x31, 0x7E, 0x3B, 0x6D, 0xB7, 0x3B, 0xE3, 0x63, 0x89, 0x49, 0x5E, 0x66, 0xF2, 0xE2, 0xBE, 0xF2, 0x05, 0xBE, 0xC6, 0xC5, 0xC5, 0xC5, 0xBE, 0xC5, 0xBE, 0xBE, 0xBE, 0xF2, 0xC6, 0xC5, 0xC5, 0xC5, 0xC6, 0xC6, 0xC5, 0x74, 0x74, 0xC6, 0xF0, 0x1D, 0xFF, 0xC5, 0xF0, 0x38, 0x55, 0xBA, 0x8F, 0x5C, 0x5C, 0xA8, 0x8F, 0x02, 0xBB, 0xA8, 0x65, 0x9D, 0x54, 0x4F, 0xD3, 0x93, 0xD2, 0xE2, 0xE2, 0x5C, 0x00, 0xB2, 0xB4, 0xB7, 0xB2, 0xCD, 0x82, 0xCD, 0x73, 0x45, 0x04, 0xBD, 0x45, 0x73, 0x14, 0x14, 0xBD, 0xBD, 0x4A, 0x7D, 0x13, 0x11, 0xCF, 0x54, 0x79, 0xBF, 0x2A, 0x36, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xCB, 0xCB, 0x2A, 0x2A, 0xC0, 0x0F, 0xC0, 0x0F, 0x0F, 0xC0, 0xC0, 0x4F, 0x53, 0x4F, 0x4F, 0x4F, 0x66, 0x4F, 0x4F,
+	0xF3, 0xF3, 0xF5, 0xF5, 0xC1, 0xC1, 0x29, 0x16, 0x16, 0x4E, 0x8E, 0x8E, 0x8E, 0x94, 0x08, 0x08, 0xC2, 0x0B, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0xB1, 0x0B, 0xB1, 0x0B, 0xE4, 0x0B, 0xC2, 0x08, 0x5D, 0x29, 0x02, 0x4C, 0x02, 0x02, 0x6F, 0x29, 0x6F, 0x16, 0x29, 0x16, 0xA8, 0x16, 0x29, 0x5D, 0x16, 0x16, 0x29, 0x16, 0x16, 0x8E, 0x16, 0x02, 0x16, 0x16, 0x16, 0x16, 0x4C, 0x5D, 0x28, 0xA5, 0xA5, 0xB1, 0xA5, 0xB1, 0x2B, 0x2B, 0x94, 0x2B, 0x08, 0xC2, 0xC2, 0x06, 0xF8, 0x5D, 0xC1, 0x87, 0x3E, 0x4D, 0xDF, 0xF8, 0x4D, 0x96, 0x3E, 0x3E, 0x6A, 0xF8, 0x6A, 0xF8, 0x4D, 0x54, 0xF8, 0xF8, 0xDF, 0x71, 0x4D, 0x54, 0x4D, 0xF8, 0xC1, 0x41, 0x13, 0x1F, 0x13, 0x7D, 0x20, 0x12, 0x4B, 0x4A, 0x12, 0x1B, 0x12, 0x4A, 0x4A, 0xC9, 0x04, 0x0E, 0x1B, 0x75, 0x7D, 0x7E, 0x1B, 0x4A, 0x04, 0xC9, 0x1B, 0x51, 0xE1, 0x1B, 0xB0, 0x7C, 0x04, 0x0E, 0xB0, 0x6D, 0x6D, 0x00, 0xE3, 0x56, 0x88, 0x47, 0xBA, 0x37, 0xF1, 0x32, 0xF2, 0x7B, 0x05, 0x38, 0xBE, 0xC6, 0xF2, 0xC6, 0xBE, 0xC5, 0xBE, 0xBE, 0x59, 0xC6, 0xC6, 0xBE, 0xC5, 0x0A, 0xC5, 0xC6, 0xC5, 0x74, 0xFF, 0x57, 0xFF, 0x57, 0xFF, 0xF1, 0x0A, 0xB9, 0xE3, 0x47, 0x8C, 0x5E, 0xA8, 0x8F, 0x02, 0x29, 0xF6, 0x6E, 0x54, 0xCF, 0xA2, 0xD0, 0xA7, 0x93, 0x61, 0x32, 0xE2, 0x5C, 0x00, 0xB2, 0xB4, 0x68, 0xB4, 0x9F, 0xC4, 0xA3, 0x3F, 0x81, 0x45, 0x45, 0x45, 0x86, 0x9F, 0xA3, 0x10, 0xCD, 0x3F, 0xE3, 0x70, 0x13, 0xCF, 0x53, 0x54, 0x9C, 0xD1, 0x2A, 0x36, 0x37, 0x2A, 0x2A, 0x2A, 0x2A, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xCB, 0xCB, 0x2A, 0x0F, 0x2A, 0x0F, 0x0F, 0x2A, 0x2A, 0x0F, 0xC0, 0x0F, 0x53, 0xC0, 0x66, 0x53, 0xCE, 0xCE, 0x53,
+	0xC1, 0xEA, 0xC1, 0xF5, 0xC1, 0xC1, 0xC1, 0x5D, 0x16, 0x16, 0x16, 0x8E, 0x8E, 0x94, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0xE4, 0x0B, 0xE4, 0x0B, 0xE4, 0x0B, 0x0B, 0xB1, 0x0B, 0x0B, 0xC2, 0x2B, 0x94, 0x02, 0x02, 0xED, 0x02, 0xBB, 0xBB, 0x6F, 0x29, 0x6F, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x29, 0xDA, 0xC1, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x16, 0x02, 0x02, 0xAF, 0xB1, 0xB3, 0xA5, 0xB1, 0xB1, 0xA5, 0xB1, 0x0B, 0x2B, 0x5D, 0x2B, 0xC2, 0x15, 0xBF, 0x4E, 0x29, 0x6A, 0x3E, 0x54, 0x4D, 0xDF, 0x4D, 0x4D, 0x3E, 0xF5, 0xEB, 0xA9, 0xF8, 0x6A, 0xF8, 0xF8, 0xF8, 0x6A, 0x6A, 0x4D, 0x4D, 0x71, 0x71, 0x17, 0x17, 0x07, 0x7D, 0x13, 0x7D, 0x20, 0x12, 0x4B, 0x45, 0x12, 0x7D, 0x1B, 0x4A, 0x4A, 0xC9, 0xBD, 0xC9, 0x04, 0xC9, 0x75, 0x7E, 0x7D, 0x1B, 0x4B, 0x04, 0x04, 0x7C, 0x7E, 0xC9, 0x7C, 0x19, 0xC9, 0x04, 0x3B, 0x7C, 0x51, 0x04, 0xB7, 0xE3, 0x0A, 0xCC, 0xBA, 0xAC, 0x34, 0x32, 0xF1, 0xF1, 0xBE, 0x5F, 0x05, 0x59, 0xC6, 0xBE, 0xBE, 0xBE, 0xC5, 0xBE, 0xF2, 0xBE, 0xBE, 0xBE, 0xC6, 0xC5, 0x05, 0xBE, 0xC6, 0xC6, 0xC6, 0xFF, 0xC5, 0x91, 0x91, 0xF7, 0x89, 0x49, 0xD7, 0xE3, 0xE3, 0x2C, 0x1F, 0x70, 0x42, 0x01, 0x3C, 0x2B, 0x2B, 0xC7, 0xDB, 0xDB, 0xDB, 0x90, 0xDB, 0x61, 0xE8, 0x91, 0x5C, 0x00, 0xB5, 0xB4, 0xB4, 0xCD, 0x68, 0xCD, 0x3F, 0x3F, 0x73, 0xBD, 0x86, 0x81, 0xE5, 0xBD, 0x4B, 0x10, 0x9F, 0xB4, 0xA3, 0x7D, 0x17, 0x06, 0xCF, 0x85, 0x79, 0x2A, 0x36, 0x2A, 0x36, 0x2A, 0x36, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xCB, 0x37, 0xCB, 0xCB, 0xCB, 0x4F, 0xCB, 0xCE, 0x4F, 0xCB, 0xCB, 0xCB, 0xCB, 0x2A, 0x4F, 0x66, 0x4F, 0xCE, 0xCE,
+	0xEA, 0xC1, 0xC1, 0xF5, 0xC1, 0xF5, 0x5D, 0x16, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x94, 0x08, 0x08, 0xC2, 0x0B, 0x0B, 0xE4, 0x0B, 0xE4, 0xE4, 0xE4, 0xB1, 0x0B, 0x0B, 0x0B, 0x0B, 0xC2, 0x94, 0x94, 0x02, 0x02, 0xED, 0x52, 0x02, 0x6F, 0x6F, 0x29, 0x16, 0xDA, 0x16, 0xDA, 0x16, 0xA8, 0x16, 0x16, 0xDA, 0xC1, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x02, 0x4C, 0x79, 0xB3, 0xA5, 0x1E, 0xB1, 0xA5, 0xB1, 0x0B, 0x0B, 0x94, 0x2B, 0x0B, 0xA9, 0x0D, 0xF5, 0xF5, 0x6A, 0xF8, 0xF8, 0x4D, 0x96, 0xF8, 0x3E, 0xF3, 0x87, 0x6A, 0x6A, 0x54, 0xDF, 0xF8, 0xF8, 0xEB, 0x87, 0xF8, 0x54, 0x4D, 0xF8, 0xF8, 0x17, 0x06, 0x41, 0x7D, 0x70, 0x33, 0x8D, 0xBD, 0x4A, 0x1B, 0x51, 0x4A, 0xBD, 0xBD, 0xC9, 0xC9, 0x04, 0x04, 0x83, 0x1B, 0x7D, 0x7D, 0x51, 0x8D, 0xBD, 0x04, 0x7C, 0x7E, 0x1B, 0x31, 0x1B, 0x31, 0x04, 0x3B, 0x0E, 0x51, 0x7C, 0x68, 0xB9, 0x44, 0xCC, 0xBA, 0x8B, 0x61, 0x57, 0xE2, 0xF1, 0xBE, 0xBE, 0x05, 0xBE, 0xBE, 0xBE, 0xBE, 0x05, 0x59, 0xBE, 0xBE, 0x05, 0xBE, 0xBE, 0x05, 0xBE, 0xF2, 0xAE, 0xC6, 0xF2, 0xAE, 0xC6, 0xC5, 0x91, 0xF7, 0x89, 0x47, 0xD6, 0xE3, 0xE3, 0xE3, 0x60, 0xBC, 0x1F, 0x1C, 0x1A, 0x06, 0xDC, 0x0B, 0x24, 0x39, 0xC7, 0x90, 0x39, 0x39, 0x5F, 0xE2, 0x95, 0x5E, 0x00, 0x73, 0x97, 0xB5, 0x10, 0x3F, 0x4B, 0xCD, 0x14, 0x73, 0x3F, 0xB4, 0x81, 0x86, 0xE5, 0x10, 0xBD, 0x68, 0xB4, 0x73, 0x12, 0x70, 0x06, 0x0F, 0x54, 0x9D, 0xCE, 0x2A, 0x2A, 0x36, 0x2A, 0x36, 0x90, 0x36, 0x37, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xCB, 0xCB, 0xCB, 0x37, 0xCB, 0xCB, 0xCB, 0xCB, 0x4F, 0xCB, 0xCB, 0xCB, 0x4F, 0xCB, 0xCB, 0x4F, 0x53, 0xCE, 0xCE,
+	0xC1, 0xEA, 0xF5, 0xF5, 0xF5, 0xC1, 0xC1, 0x5D, 0x16, 0x16, 0x8E, 0x16, 0x8E, 0x94, 0xC8, 0xC2, 0xC2, 0x0B, 0x0B, 0x24, 0xE4, 0x0B, 0xE4, 0x0B, 0xB1, 0xE4, 0xB1, 0x0B, 0x0B, 0xC2, 0x08, 0x5D, 0x29, 0x02, 0xED, 0x02, 0xBB, 0x6F, 0x07, 0x6F, 0x16, 0x16, 0x29, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x29, 0x16, 0x29, 0x16, 0x16, 0x8E, 0x16, 0x8E, 0x16, 0x02, 0x4C, 0x01, 0xD9, 0xA5, 0xA5, 0xA5, 0xB1, 0xB1, 0xB1, 0x2B, 0xB1, 0x2B, 0x0B, 0x4D, 0x16, 0x4E, 0x6A, 0x6A, 0x4D, 0x4D, 0xF8, 0x4D, 0x40, 0xA8, 0x3E, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xEA, 0xEB, 0xF8, 0xF8, 0xEA, 0xC1, 0x41, 0x4D, 0x21, 0x13, 0x7D, 0x12, 0x20, 0x4A, 0x4A, 0x4A, 0x1B, 0x12, 0x4A, 0xBD, 0x45, 0xC9, 0xBD, 0xBD, 0x04, 0x04, 0x4A, 0x75, 0x1B, 0x1B, 0x4A, 0xBD, 0xBD, 0x1B, 0x50, 0x51, 0x7C, 0x51, 0xC9, 0x3B, 0x0E, 0x0E, 0x04, 0xB0, 0x25, 0x9B, 0xD4, 0xCC, 0xBA, 0x64, 0x05, 0x57, 0x91, 0xF1, 0xBE, 0x7B, 0x5F, 0x05, 0x59, 0xBE, 0x05, 0xBE, 0x05, 0x05, 0x05, 0xBE, 0x05, 0xBE, 0xF2, 0xAE, 0xC6, 0xC6, 0xC6, 0xBE, 0xC6, 0xBE, 0xC5, 0x77, 0x91, 0x49, 0xE3, 0xA3, 0xA3, 0xBA, 0xE3, 0xE3, 0x03, 0x60, 0x13, 0x1C, 0x78, 0xCA, 0x24, 0x7F, 0xDC, 0xDC, 0x80, 0x7F, 0x36, 0x59, 0x32, 0x77, 0x42, 0x6C, 0x00, 0xF9, 0xB4, 0x86, 0xBD, 0x3F, 0x4B, 0xCD, 0x73, 0xB4, 0xB4, 0xB4, 0x81, 0x73, 0x86, 0x86, 0xBD, 0xE6, 0x81, 0xA3, 0x20, 0x17, 0x11, 0x06, 0x54, 0x79, 0x4F, 0x2A, 0x36, 0x2A, 0x37, 0x36, 0x36, 0x90, 0x36, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0x4F, 0x37, 0xCB, 0x37, 0x4F, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCE, 0x4F, 0x66, 0x53, 0xCE,
+	0xF3, 0xC1, 0xF5, 0xF5, 0xF5, 0xC1, 0x5D, 0x16, 0x8E, 0x16, 0x16, 0x8E, 0x8E, 0x94, 0x94, 0x08, 0xC2, 0x0B, 0x0B, 0x0B, 0xE4, 0x24, 0xE4, 0x24, 0x0B, 0xE4, 0x0B, 0x0B, 0x0B, 0xC2, 0x08, 0x65, 0x02, 0x02, 0xED, 0x52, 0xBB, 0x6F, 0x6F, 0xDA, 0x16, 0x6F, 0x16, 0x16, 0x16, 0x29, 0x16, 0x5D, 0x16, 0x29, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x02, 0x02, 0xAF, 0x1E, 0xB3, 0xA5, 0x1E, 0xA5, 0xB1, 0xB1, 0x0B, 0xB1, 0x0B, 0x2B, 0x4D, 0x29, 0x65, 0xF8, 0xDF, 0xF8, 0x06, 0xF8, 0xF8, 0xEA, 0xF3, 0x6A, 0x85, 0xF8, 0xF8, 0x87, 0xF8, 0xF8, 0xEB, 0xF8, 0x54, 0xF8, 0xF8, 0xEB, 0x07, 0x18, 0x41, 0x7D, 0x7D, 0x8D, 0x10, 0x4A, 0x12, 0xE1, 0x1B, 0x10, 0xC9, 0xBD, 0xC9, 0xE1, 0xBD, 0x3B, 0x83, 0xBD, 0x1B, 0x7D, 0x4A, 0x9E, 0xC9, 0xBD, 0x31, 0x51, 0x51, 0x7E, 0x7E, 0x7C, 0x3B, 0x0E, 0xAD, 0x3B, 0x0E, 0x19, 0x75, 0xD4, 0xAC, 0x01, 0x64, 0xF2, 0x32, 0xF1, 0xF0, 0xBE, 0xBE, 0x5F, 0x05, 0x05, 0x05, 0x05, 0x05, 0xBE, 0x05, 0xBE, 0x05, 0x05, 0x05, 0x05, 0xC6, 0x0A, 0x0A, 0xBE, 0xBE, 0xC6, 0xC5, 0xF0, 0xF0, 0x7B, 0xE3, 0x6C, 0xE3, 0x26, 0x26, 0x03, 0x9B, 0xA6, 0x03, 0xA6, 0x9B, 0x1C, 0x1A, 0xCA, 0xDB, 0xC7, 0xE4, 0xE4, 0xDB, 0xD2, 0xD2, 0x32, 0x77, 0x8B, 0x00, 0x6C, 0xB2, 0xB2, 0x3F, 0xF9, 0x10, 0x86, 0x3F, 0x3F, 0x3F, 0x73, 0xB4, 0xBD, 0x81, 0x73, 0x73, 0xBD, 0x3F, 0xB4, 0xB4, 0x12, 0x7D, 0x13, 0x11, 0x17, 0x4D, 0x66, 0xC0, 0x2A, 0x2A, 0x36, 0x36, 0x90, 0x36, 0x36, 0x37, 0x36, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xCB, 0x37, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0x53, 0x4F, 0x66, 0x4F, 0x4F, 0xCE,
+	0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x5D, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x8E, 0x94, 0x94, 0x08, 0xC2, 0x0B, 0x0B, 0xB1, 0x0B, 0xE4, 0x0B, 0xB1, 0x0B, 0xB1, 0x0B, 0xE4, 0x0B, 0x0B, 0x94, 0x94, 0x29, 0x4C, 0xED, 0x02, 0x02, 0x6F, 0x6F, 0x6F, 0x16, 0x16, 0x16, 0x29, 0x16, 0x16, 0xDA, 0x16, 0x29, 0x16, 0x29, 0x16, 0x02, 0x5D, 0x8E, 0x8E, 0x8E, 0x8E, 0x16, 0x29, 0x29, 0xAF, 0x2B, 0x77, 0x28, 0x1E, 0x28, 0xB1, 0x2B, 0xB1, 0xB1, 0x0B, 0x3C, 0xF6, 0x5D, 0x65, 0xDF, 0x4D, 0x6A, 0x54, 0xF8, 0xEA, 0x87, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x87, 0xEB, 0xF8, 0xF8, 0xF8, 0x06, 0x06, 0x13, 0xEB, 0x20, 0x6F, 0x12, 0x52, 0x20, 0x4A, 0x12, 0xD6, 0x51, 0x4A, 0x4A, 0x4A, 0x0E, 0xC9, 0x1B, 0x4A, 0x45, 0x3B, 0x45, 0xD6, 0x1B, 0xE1, 0xBD, 0xBD, 0xBD, 0xC9, 0x51, 0x1B, 0xC9, 0x51, 0xAD, 0x0E, 0x0E, 0x19, 0xB0, 0x6D, 0x31, 0xEC, 0x8A, 0xA6, 0xBA, 0x67, 0x3D, 0xAE, 0xF1, 0x0A, 0xE2, 0xBE, 0xBE, 0x05, 0xBE, 0x05, 0xBE, 0x05, 0xBE, 0x05, 0x05, 0x05, 0x38, 0x05, 0x05, 0xBE, 0xC6, 0xBE, 0xC5, 0xC5, 0xC5, 0xF1, 0xE2, 0xBE, 0x34, 0xE3, 0xB2, 0x6C, 0xE3, 0x47, 0x25, 0xE3, 0x63, 0x03, 0xA6, 0x03, 0x7D, 0x13, 0x0F, 0xC0, 0xE4, 0xE4, 0xE4, 0x7F, 0x39, 0x92, 0x77, 0x93, 0x5C, 0x6C, 0x6C, 0x6C, 0xB5, 0xB5, 0xB4, 0xBD, 0xCD, 0x73, 0x3F, 0xCD, 0x14, 0x73, 0x73, 0x81, 0x81, 0x81, 0xBD, 0x3F, 0x10, 0xBD, 0x3F, 0xE3, 0x48, 0x13, 0x17, 0x54, 0x79, 0x53, 0x2A, 0x36, 0x36, 0x90, 0x36, 0x36, 0x90, 0x36, 0x90, 0x36, 0x90, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0x37, 0xCB, 0x37, 0xCB, 0x37, 0xCB, 0x4F, 0x4F, 0x66, 0x4F, 0x4F, 0x66, 0x4F, 0x66,
+	0xF3, 0xC1, 0xF5, 0xF5, 0xF5, 0xF5, 0xC1, 0x16, 0x5D, 0x16, 0x16, 0x16, 0x8E, 0x8E, 0x94, 0xC2, 0xC2, 0x0B, 0x0B, 0x24, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x0B, 0x0B, 0xC2, 0x2B, 0x94, 0x02, 0x02, 0xED, 0x52, 0x02, 0x6F, 0x6F, 0x6F, 0x16, 0x6F, 0x16, 0x16, 0x6F, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x5D, 0x8E, 0x8E, 0xC1, 0x16, 0x4E, 0x5D, 0x4C, 0x29, 0x80, 0xD9, 0x28, 0x1E, 0xB1, 0x39, 0x2B, 0xB1, 0x7F, 0xFD, 0x02, 0x65, 0x4D, 0x6A, 0xF8, 0xF8, 0x6A, 0xEA, 0xF3, 0xF8, 0x54, 0xF8, 0xF8, 0xF8, 0x87, 0xEB, 0xEB, 0xF8, 0xF8, 0x17, 0xF8, 0xF8, 0xF8, 0x20, 0x8D, 0x4B, 0x12, 0x4A, 0x12, 0x4A, 0xD6, 0x1B, 0x1B, 0x31, 0xC9, 0x04, 0x04, 0x7C, 0x51, 0xBD, 0x83, 0x83, 0xBD, 0x1B, 0x33, 0x10, 0x45, 0xBD, 0xBD, 0x12, 0x1B, 0xC9, 0x7C, 0x51, 0xC9, 0x3B, 0x51, 0x43, 0x04, 0x3B, 0x19, 0xD8, 0xA6, 0xB9, 0x55, 0xF2, 0xE2, 0xE2, 0xF2, 0xC5, 0xBE, 0xBE, 0xBE, 0xBE, 0x05, 0x05, 0x05, 0x05, 0x05, 0x5F, 0x34, 0x05, 0x05, 0x05, 0x38, 0x05, 0x0A, 0xC5, 0x57, 0xFF, 0x0A, 0x0A, 0xF2, 0x34, 0x8B, 0xAF, 0x8F, 0xD7, 0xA3, 0xA6, 0x35, 0x33, 0x35, 0xBC, 0x03, 0x47, 0x20, 0x70, 0x0F, 0x79, 0x39, 0xC7, 0x39, 0x7F, 0xD2, 0x91, 0x0F, 0x5A, 0x00, 0x6C, 0xB2, 0xB2, 0xB4, 0xF9, 0xB4, 0x8D, 0x86, 0x3F, 0x4B, 0xA3, 0x10, 0xBD, 0x73, 0x81, 0x81, 0x73, 0x4B, 0x86, 0xBD, 0xCD, 0x26, 0x20, 0x1F, 0x17, 0x58, 0xFC, 0x54, 0x90, 0xA2, 0xDB, 0x36, 0x36, 0x90, 0x36, 0x36, 0x90, 0x36, 0x36, 0x37, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xCB, 0xCB, 0x4F, 0xCB, 0xCB, 0x4F, 0xCB, 0x37, 0x4F, 0x4F, 0x4F, 0x53, 0x66, 0x90, 0xCE, 0x90,
+	0xF3, 0xEA, 0xF3, 0xF3, 0xF5, 0xF5, 0xF5, 0xF5, 0x16, 0x5D, 0x16, 0x16, 0x5D, 0x94, 0x94, 0x08, 0xC2, 0x0B, 0x0B, 0xE4, 0xE4, 0x0B, 0xE4, 0xE4, 0x0B, 0xB1, 0x0B, 0x24, 0x0B, 0xC2, 0x94, 0x94, 0x29, 0x02, 0xED, 0x02, 0x02, 0xBB, 0x6F, 0x29, 0x6F, 0x16, 0x16, 0x6F, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x29, 0x16, 0x16, 0x5D, 0x8E, 0x8E, 0x8E, 0x16, 0xC1, 0x5D, 0x29, 0xAF, 0x3C, 0xA5, 0xA5, 0xD9, 0xA5, 0xB1, 0x90, 0x39, 0x1E, 0xDD, 0x5D, 0xA9, 0x4D, 0xF8, 0xA9, 0xF8, 0x3E, 0xF3, 0xEA, 0xF8, 0xF8, 0xF8, 0x85, 0xF8, 0xEB, 0xEA, 0xEB, 0xF8, 0x17, 0xF8, 0xEB, 0x41, 0x20, 0x20, 0x20, 0x1B, 0x33, 0x4A, 0x4B, 0xE1, 0x1B, 0x1B, 0xBD, 0xBD, 0x04, 0x04, 0xC9, 0x7E, 0x20, 0x45, 0x83, 0x83, 0x9F, 0x60, 0xE1, 0x10, 0x83, 0xBD, 0xE1, 0xBD, 0xBD, 0x04, 0xC9, 0x51, 0x0E, 0x04, 0x19, 0x51, 0x0E, 0xAD, 0x0C, 0x35, 0xE3, 0x38, 0xF2, 0xE2, 0xD2, 0xBE, 0xBE, 0x0A, 0xC6, 0x05, 0x05, 0x05, 0x59, 0x05, 0xBE, 0x05, 0x5F, 0x38, 0x38, 0x05, 0x05, 0x05, 0x0A, 0x05, 0xC5, 0x0A, 0xBE, 0xBE, 0x0A, 0xBE, 0x32, 0x88, 0x37, 0x5C, 0xAF, 0xE3, 0x5C, 0xD7, 0x20, 0x51, 0xE1, 0x49, 0x03, 0xBC, 0xE3, 0x47, 0xE0, 0x79, 0xDB, 0x39, 0x7F, 0x32, 0x91, 0x17, 0xFE, 0x00, 0x09, 0xB2, 0xB2, 0xB4, 0xB4, 0xCD, 0xCD, 0xF9, 0xCD, 0xCD, 0x4B, 0xCD, 0x3F, 0x73, 0xB4, 0x81, 0x81, 0x86, 0x10, 0xBD, 0xCD, 0x10, 0x12, 0x7D, 0x48, 0x85, 0x98, 0x98, 0x53, 0xA2, 0x36, 0x36, 0x39, 0x37, 0x36, 0x90, 0x36, 0x36, 0x37, 0x90, 0x36, 0x90, 0x36, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0xCB, 0xCB, 0xCB, 0x66, 0x4F, 0x4F, 0x4F, 0x66, 0x4F,
+	0xF3, 0xC1, 0xF5, 0xF5, 0xF5, 0xF5, 0x5D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x08, 0xC2, 0x0B, 0x0B, 0x0B, 0xB1, 0xE4, 0xE4, 0xE4, 0xB1, 0x0B, 0xE4, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x02, 0x02, 0xED, 0x52, 0x52, 0x02, 0x6F, 0x29, 0x6F, 0x16, 0x16, 0xDA, 0x16, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x5D, 0x8E, 0xC1, 0xC1, 0x8E, 0xC1, 0x16, 0x5D, 0x02, 0x02, 0x2B, 0xB3, 0xA5, 0x1E, 0x59, 0xB1, 0xA5, 0x0B, 0x5D, 0x15, 0x4D, 0x3E, 0xF8, 0x4D, 0x6A, 0x6A, 0xEB, 0xF8, 0xF8, 0x2E, 0x17, 0xF8, 0xF8, 0xF8, 0xEB, 0xF8, 0x2E, 0xF8, 0x70, 0xF8, 0x7D, 0xF8, 0x35, 0x20, 0x1B, 0x12, 0x4A, 0x12, 0x51, 0x1B, 0x10, 0xBD, 0x04, 0x3B, 0xBD, 0x4A, 0x75, 0x1B, 0x3B, 0x45, 0xBD, 0x10, 0x12, 0x4A, 0x4A, 0x83, 0x4A, 0x04, 0xBD, 0xC9, 0x04, 0x31, 0x7E, 0x04, 0x0E, 0x43, 0xAD, 0x19, 0x43, 0xE1, 0x5E, 0xAC, 0x32, 0x32, 0x32, 0xF2, 0xAE, 0xC5, 0xBE, 0xBE, 0xBE, 0x59, 0x38, 0x38, 0x05, 0x05, 0x5F, 0x05, 0x34, 0x38, 0x05, 0xF2, 0x0A, 0x05, 0x0A, 0xBE, 0x0A, 0x7B, 0x7B, 0xBE, 0x57, 0x32, 0x32, 0x7A, 0x8B, 0xA8, 0x4C, 0x8F, 0x7D, 0x20, 0xE3, 0x35, 0x35, 0x1F, 0xBC, 0x7D, 0x47, 0xE0, 0x90, 0x7F, 0xD2, 0xE2, 0x93, 0xEA, 0xC4, 0x6C, 0x09, 0xB2, 0xB5, 0xF9, 0x3F, 0xCD, 0x73, 0xCD, 0xBD, 0x73, 0x3F, 0x14, 0x3F, 0x73, 0x45, 0x81, 0x81, 0x81, 0xBD, 0x10, 0xCD, 0xCD, 0x12, 0xE3, 0x70, 0x48, 0x98, 0x98, 0x98, 0x4F, 0xDB, 0x36, 0xDB, 0x36, 0x37, 0x36, 0x36, 0x90, 0x36, 0x36, 0x36, 0x90, 0x36, 0x37, 0x2A, 0x2A, 0x2A, 0x36, 0x2A, 0x2A, 0xCB, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0x37, 0x2A, 0xCB, 0x90, 0x4F, 0x66, 0x4F, 0x53, 0x4F,
+	0xC1, 0xEA, 0xF3, 0xF5, 0xF5, 0x5D, 0xA8, 0xC1, 0xC1, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x94, 0x08, 0xC2, 0x0B, 0x0B, 0xE4, 0x24, 0xE4, 0x24, 0x24, 0x24, 0xB1, 0x24, 0x24, 0x0B, 0x0B, 0x94, 0x94, 0x29, 0xED, 0xED, 0x02, 0x02, 0xBB, 0x6F, 0x29, 0x6F, 0x16, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0x4E, 0x29, 0x16, 0x5D, 0x5D, 0x16, 0xC1, 0x8E, 0x8E, 0xC1, 0x8E, 0xC1, 0x5D, 0x29, 0x02, 0xA8, 0xA5, 0x28, 0xA5, 0x59, 0xB1, 0xA5, 0x2B, 0x5D, 0xDC, 0x6A, 0xF3, 0x6A, 0xF8, 0xF5, 0x40, 0xF8, 0xF8, 0x17, 0xF8, 0xF8, 0xF8, 0xEB, 0xF8, 0x70, 0xF8, 0xEA, 0x7D, 0xF8, 0x7D, 0x7D, 0x12, 0x9E, 0x1B, 0x8D, 0x12, 0x1B, 0x1B, 0x35, 0x1B, 0xBD, 0xBD, 0x0E, 0x83, 0x3B, 0x1B, 0x7E, 0x4A, 0x6D, 0xBD, 0xD6, 0x4A, 0xBD, 0x9F, 0x4A, 0xBD, 0xE1, 0xE1, 0x1B, 0x31, 0xC9, 0x1B, 0x51, 0x0E, 0xB0, 0x19, 0xAD, 0x43, 0x7E, 0x60, 0x63, 0x34, 0x32, 0xF1, 0xF2, 0xF2, 0x0A, 0xC5, 0x05, 0x0A, 0x05, 0x05, 0x05, 0x05, 0x05, 0x5F, 0x05, 0x5F, 0x05, 0x05, 0x05, 0xBE, 0x05, 0x0A, 0x05, 0xBE, 0xF1, 0xBE, 0x0A, 0xF1, 0x57, 0xE2, 0x32, 0x93, 0x06, 0xF4, 0x5C, 0x5A, 0x33, 0x1F, 0x35, 0x1B, 0xE3, 0xBC, 0x9B, 0xBC, 0x70, 0x48, 0xA4, 0x3D, 0xD2, 0x17, 0x5A, 0xC4, 0xB2, 0x73, 0xB2, 0xB2, 0xB4, 0xB4, 0x3F, 0xCD, 0x9F, 0x73, 0x73, 0x14, 0x14, 0x3F, 0x73, 0xB4, 0x82, 0x81, 0x73, 0xBD, 0x9F, 0xCD, 0xBD, 0xCD, 0x12, 0x42, 0x70, 0x48, 0x42, 0x01, 0x9C, 0x2A, 0x36, 0x36, 0xDB, 0x36, 0x90, 0x90, 0x36, 0x37, 0x90, 0x36, 0x90, 0x36, 0x36, 0x90, 0x2A, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0xCB, 0x4F, 0xCB, 0x4F, 0x66, 0x4F, 0x66, 0x90, 0x66, 0x4F, 0x4F,
+	0xF3, 0xF3, 0xF5, 0xF5, 0xF5, 0xC1, 0xC1, 0xC1, 0xDA, 0xC1, 0x16, 0x02, 0x16, 0x8E, 0x94, 0x08, 0x2B, 0x0B, 0x0B, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x24, 0xE4, 0x0B, 0x24, 0x0B, 0xC2, 0xC2, 0x94, 0xBB, 0x02, 0xED, 0x52, 0x52, 0x02, 0x6F, 0x6F, 0x6F, 0x16, 0x29, 0x16, 0x16, 0x29, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0xC1, 0x8E, 0xF5, 0x8E, 0x8E, 0x3E, 0x8E, 0xC1, 0x16, 0x29, 0xAF, 0x24, 0xD9, 0xA5, 0x59, 0xA5, 0x1E, 0x0B, 0x2D, 0x4D, 0x6A, 0x87, 0x87, 0xF3, 0xF6, 0x3E, 0xF8, 0xF8, 0xF8, 0xF8, 0xEA, 0xEA, 0xEA, 0x17, 0xF8, 0x13, 0xF8, 0x70, 0x7D, 0x41, 0x12, 0x8D, 0x12, 0x4A, 0x1B, 0x12, 0x12, 0x1B, 0x20, 0x4A, 0xC9, 0xBD, 0xBD, 0xBD, 0xBD, 0x1B, 0x1B, 0x12, 0x45, 0x4A, 0x4A, 0x4A, 0xBD, 0x45, 0xBD, 0xBD, 0x10, 0x4A, 0xE1, 0x4A, 0xBD, 0x1B, 0x1B, 0xC9, 0x7C, 0x51, 0xB0, 0x50, 0x75, 0xD8, 0x62, 0x44, 0xBE, 0x88, 0x7B, 0xBE, 0xBE, 0xBE, 0x05, 0x05, 0x38, 0x05, 0x34, 0x05, 0x38, 0x05, 0x5F, 0x5F, 0x5F, 0x7B, 0x05, 0x7B, 0x7B, 0x05, 0xC5, 0xC5, 0xF1, 0xF1, 0xF1, 0xC5, 0xE2, 0xE2, 0x32, 0xD2, 0x78, 0x85, 0xA8, 0x6F, 0x5A, 0x12, 0x35, 0x20, 0xD6, 0xE3, 0x75, 0x1F, 0xBC, 0x2E, 0xCB, 0x0F, 0x6E, 0x8F, 0x6C, 0x6C, 0x82, 0x3F, 0xB4, 0x3F, 0xBD, 0xBD, 0x3F, 0x4B, 0xCD, 0xCD, 0x3F, 0x14, 0xCD, 0xCD, 0x73, 0x81, 0x81, 0xB4, 0x73, 0xBD, 0xBD, 0x68, 0x9F, 0x8D, 0xE3, 0x7D, 0x58, 0x8B, 0xB9, 0x98, 0x9C, 0x36, 0x7F, 0x36, 0x36, 0x39, 0x37, 0x36, 0x90, 0x36, 0x36, 0x90, 0x36, 0x36, 0x90, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0x37, 0xCB, 0xCB, 0x37, 0x66, 0x4F, 0x4F, 0x4F, 0x66, 0x4F,
+	0xF3, 0xEA, 0xC1, 0xF5, 0xF5, 0xF5, 0xC1, 0xC1, 0xDA, 0xC1, 0x16, 0x16, 0x02, 0x8E, 0x94, 0x94, 0x2B, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0x24, 0x24, 0xE4, 0x24, 0xE4, 0x0B, 0x0B, 0x0B, 0x94, 0x94, 0x29, 0xED, 0xED, 0x02, 0x52, 0x02, 0x6F, 0x16, 0x6F, 0x16, 0x16, 0xDA, 0x16, 0x6F, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0xC1, 0x8E, 0x4E, 0x3E, 0x8E, 0x8E, 0x8E, 0x4E, 0xC1, 0x29, 0x4C, 0x2B, 0xB3, 0x28, 0xA5, 0xA5, 0x1E, 0xB1, 0xC2, 0x2D, 0x40, 0xF8, 0xF3, 0x29, 0xF3, 0x40, 0x54, 0xF8, 0xF8, 0xEA, 0xEA, 0xEB, 0xF8, 0x17, 0xF8, 0x7D, 0xEA, 0x13, 0x7D, 0x7D, 0x9E, 0x8D, 0x12, 0xBD, 0x12, 0x4A, 0x12, 0x20, 0x1B, 0x4A, 0x4A, 0xC9, 0xBD, 0xBD, 0xC9, 0x4A, 0x12, 0x1B, 0xD6, 0xD6, 0xBD, 0x83, 0x45, 0x81, 0x83, 0x10, 0x83, 0xBD, 0x81, 0x45, 0x83, 0xBD, 0x4A, 0x7C, 0x51, 0x7C, 0x7C, 0x7E, 0x35, 0xD8, 0x2C, 0x62, 0x61, 0x7B, 0xBE, 0x61, 0xBE, 0x05, 0x62, 0x38, 0x38, 0x05, 0x38, 0x34, 0x59, 0x38, 0xBE, 0x5F, 0xBE, 0x5F, 0x5F, 0x7B, 0xBE, 0x32, 0x57, 0x57, 0xF1, 0xF1, 0x32, 0xE2, 0xE2, 0xE2, 0x32, 0x32, 0x93, 0xBF, 0x65, 0x6F, 0x5A, 0x9E, 0x8D, 0x35, 0xD6, 0x4A, 0x35, 0x13, 0xBC, 0x13, 0xCB, 0x58, 0x01, 0xAF, 0xC4, 0xE5, 0x81, 0x45, 0x83, 0xB4, 0x86, 0xBD, 0x3F, 0x4B, 0xCD, 0x4B, 0xA3, 0x9F, 0xCD, 0x9F, 0x73, 0x81, 0x82, 0xB4, 0x73, 0xCD, 0x04, 0x68, 0x4B, 0x12, 0x42, 0x8B, 0x58, 0x42, 0xB8, 0x58, 0x4F, 0x36, 0x36, 0xDB, 0x36, 0x36, 0xDB, 0x36, 0x36, 0x90, 0x36, 0x90, 0x36, 0x90, 0x36, 0x2A, 0x2A, 0x36, 0x90, 0x36, 0x90, 0x90, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0xCB, 0xCB, 0x37, 0x90, 0x4F, 0x90, 0x66, 0x4F, 0x53, 0x4F, 0x66,
+	0xC1, 0xF5, 0xC1, 0xC1, 0xF5, 0xF5, 0xC1, 0x29, 0xC1, 0xDA, 0x16, 0x02, 0x16, 0x5D, 0x94, 0x08, 0x2B, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0xE4, 0x24, 0xE4, 0x0B, 0xB1, 0x0B, 0x0B, 0xC2, 0xC2, 0x94, 0x29, 0x02, 0xED, 0x02, 0x6B, 0x02, 0x6F, 0x6F, 0x6F, 0x16, 0xDA, 0xDA, 0x16, 0x16, 0x16, 0x29, 0x16, 0x16, 0x16, 0x16, 0xDA, 0xC1, 0xC1, 0xF5, 0x8E, 0x3E, 0x94, 0x8E, 0xEA, 0x8E, 0xF5, 0x16, 0x02, 0x3C, 0xB3, 0xD9, 0x28, 0xA5, 0x1E, 0xE4, 0x15, 0x65, 0x40, 0xF8, 0x87, 0xF6, 0x6A, 0xF8, 0xF8, 0xEA, 0xEA, 0xF8, 0xF8, 0x17, 0x17, 0xF8, 0xF8, 0x41, 0x20, 0x7D, 0x7D, 0x20, 0x4A, 0x12, 0x4A, 0x9E, 0xBD, 0xBD, 0x4A, 0x1B, 0x4A, 0x12, 0x4A, 0x4A, 0xC9, 0xBD, 0x4A, 0x4A, 0xC9, 0x51, 0x51, 0xE1, 0x83, 0x83, 0x4A, 0xBD, 0x45, 0xBD, 0x4A, 0xBD, 0x83, 0x83, 0x83, 0x4A, 0x1B, 0x7D, 0x7C, 0x7C, 0x51, 0x50, 0x9B, 0xDE, 0xDE, 0x05, 0x7B, 0xBE, 0xBE, 0xBE, 0x7B, 0x7B, 0x38, 0xDE, 0x38, 0x38, 0x05, 0x05, 0x38, 0x5F, 0x5F, 0x5F, 0x61, 0x5F, 0x5F, 0x7B, 0xF1, 0x91, 0x57, 0xF1, 0xF1, 0x32, 0xE2, 0x32, 0x57, 0x32, 0xE2, 0xD2, 0xD2, 0xBF, 0x3C, 0xBB, 0x8F, 0x6B, 0xE5, 0xE1, 0x20, 0x26, 0xE3, 0x75, 0x1F, 0x13, 0xCC, 0x48, 0x42, 0xD7, 0xB2, 0x81, 0x81, 0x81, 0xF9, 0x86, 0x9E, 0xCD, 0x4B, 0xCD, 0x4B, 0xCD, 0x4B, 0xCD, 0xCD, 0x3F, 0xB4, 0xF9, 0x82, 0x81, 0x73, 0x73, 0x3F, 0xBD, 0x4B, 0x33, 0x47, 0x48, 0x85, 0xBA, 0x6E, 0x64, 0x4F, 0x2A, 0x36, 0x36, 0x39, 0x90, 0x90, 0x36, 0x90, 0x36, 0x36, 0x90, 0x36, 0x36, 0x90, 0x36, 0x2A, 0x36, 0x37, 0x36, 0x90, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x4F, 0x90, 0x66, 0x90, 0x66, 0x4F, 0x66, 0x4F,
+	0xEA, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xDA, 0x5D, 0xDA, 0x16, 0x16, 0x02, 0x02, 0x5D, 0x94, 0x94, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0x24, 0xE4, 0xE4, 0xE4, 0x24, 0x24, 0x0B, 0xC2, 0x08, 0x94, 0xBB, 0x52, 0xED, 0x02, 0x52, 0x02, 0x16, 0x6F, 0x16, 0xDA, 0x16, 0xDA, 0x16, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xDA, 0xC1, 0xC1, 0xF5, 0x8E, 0x8E, 0x8E, 0x94, 0x8E, 0x4E, 0xC1, 0x16, 0x02, 0x15, 0xB3, 0xD9, 0x28, 0x28, 0x1E, 0x2B, 0x8E, 0x65, 0xF8, 0xEA, 0xF8, 0xEB, 0xF8, 0x6A, 0xC1, 0x4E, 0xF8, 0x4D, 0xF8, 0x71, 0xF8, 0xF8, 0x13, 0x07, 0x52, 0x20, 0x52, 0x4A, 0x12, 0x12, 0xBD, 0xC9, 0xBD, 0x45, 0xBD, 0x1B, 0x4A, 0x4A, 0x1B, 0x1B, 0x4A, 0xBD, 0xE1, 0xC9, 0xBD, 0x35, 0x75, 0x1B, 0x83, 0x3B, 0x45, 0xBD, 0xBD, 0x83, 0x83, 0xFB, 0xB6, 0xFB, 0xFB, 0x33, 0x1F, 0x1B, 0x12, 0x35, 0x75, 0x22, 0x56, 0x0A, 0x0A, 0x0A, 0x05, 0x0A, 0x32, 0xE8, 0x7B, 0x38, 0x38, 0x38, 0x34, 0x34, 0x05, 0xBE, 0x7B, 0x37, 0x34, 0x5F, 0x36, 0x5F, 0xE8, 0xE2, 0x32, 0x32, 0xE2, 0xE2, 0xE2, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0xD2, 0x32, 0xD2, 0xFD, 0xA9, 0x5D, 0x02, 0x8D, 0xE5, 0x81, 0x60, 0x12, 0xD6, 0x35, 0x1F, 0x48, 0xCC, 0x55, 0xA6, 0x14, 0x82, 0x81, 0x45, 0x45, 0x45, 0x73, 0xBD, 0x4B, 0xCD, 0xCD, 0x14, 0x4B, 0xA3, 0xCD, 0x9F, 0x3F, 0xB4, 0x83, 0xE5, 0xB5, 0x73, 0x73, 0xB4, 0xCD, 0x12, 0x20, 0x48, 0x54, 0x98, 0xBA, 0x98, 0xE0, 0x37, 0x37, 0x2A, 0x36, 0x36, 0xDB, 0x37, 0x36, 0x36, 0x90, 0x36, 0x36, 0x90, 0x36, 0x37, 0x36, 0x90, 0x36, 0x90, 0x36, 0x90, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x90, 0x4F, 0x90, 0x4F, 0x4F, 0x4F, 0x4F, 0x66,
+	0xF3, 0xC1, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xA8, 0xC1, 0x29, 0x16, 0x02, 0x16, 0x5D, 0x94, 0x94, 0x2B, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0x24, 0xE4, 0x0B, 0xE4, 0x24, 0x0B, 0x0B, 0x0B, 0x08, 0x94, 0x29, 0x02, 0xED, 0x6B, 0x02, 0x6F, 0x6F, 0x16, 0x6F, 0xC1, 0xDA, 0xC1, 0x16, 0xC1, 0x5D, 0x16, 0x8E, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0xC1, 0xF5, 0x3E, 0x94, 0x65, 0x8E, 0x40, 0x8E, 0xC1, 0xC1, 0x02, 0x15, 0x95, 0xD9, 0x28, 0x28, 0xE4, 0x5D, 0x5D, 0x65, 0xF8, 0xEA, 0xEB, 0xF8, 0x40, 0x3E, 0xC1, 0x3E, 0x71, 0xF8, 0x17, 0xF8, 0xF8, 0xF8, 0x7D, 0x6F, 0x9E, 0x9E, 0xBD, 0xBD, 0x1B, 0x4A, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x4A, 0x1B, 0x4A, 0x4A, 0x1B, 0x4A, 0xBD, 0xC9, 0xC9, 0x04, 0x7C, 0x75, 0x7E, 0xD6, 0xBD, 0x45, 0x83, 0x45, 0x83, 0x83, 0xF9, 0xB7, 0x97, 0xE3, 0x75, 0x41, 0x12, 0x75, 0x30, 0x75, 0x76, 0x56, 0x0A, 0x62, 0x62, 0xBE, 0x32, 0xC5, 0x0A, 0x5F, 0x34, 0x37, 0x34, 0x38, 0x38, 0x3D, 0xBE, 0x5F, 0x55, 0x37, 0x38, 0x5F, 0x93, 0xF1, 0x32, 0x32, 0xF1, 0xE2, 0xE2, 0xE2, 0x32, 0xE2, 0xE2, 0xF0, 0x91, 0xE2, 0x32, 0x93, 0x7F, 0x15, 0xA8, 0xBB, 0xEE, 0x9A, 0x81, 0xCD, 0x33, 0xD7, 0x20, 0x13, 0x1F, 0xCC, 0xCC, 0x5E, 0x14, 0x3F, 0x45, 0xBD, 0xBD, 0xE5, 0x82, 0x3F, 0xCD, 0x9E, 0x4B, 0x14, 0x4B, 0xA3, 0xCD, 0x3F, 0xBD, 0xBD, 0x81, 0x81, 0x73, 0x73, 0x73, 0xF9, 0x9F, 0x33, 0xB9, 0x2E, 0x54, 0x98, 0x6E, 0x67, 0x55, 0xCB, 0x37, 0x37, 0x90, 0x36, 0xDB, 0x36, 0x90, 0x36, 0x36, 0x90, 0x90, 0x90, 0x90, 0x36, 0x90, 0x36, 0x36, 0x2A, 0x36, 0x90, 0x90, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0xCB, 0x2A, 0x2A, 0x66, 0x90, 0x66, 0x4F, 0x66, 0x4F,
+	0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xC1, 0xDA, 0xDA, 0xC1, 0x16, 0xBB, 0x16, 0x5D, 0x94, 0x15, 0x2B, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0xE4, 0xE4, 0xE4, 0x24, 0xE4, 0x24, 0x0B, 0xC2, 0x08, 0x94, 0xBB, 0x52, 0xED, 0x02, 0x52, 0xBB, 0x6F, 0x6F, 0x16, 0xDA, 0xC1, 0xDA, 0x16, 0xDA, 0x4E, 0x16, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0xC1, 0xC1, 0x5D, 0x8E, 0x8E, 0x94, 0x8E, 0x8E, 0x3E, 0x8E, 0xC1, 0x16, 0x3E, 0xB3, 0xB3, 0x28, 0xD9, 0x2B, 0x5D, 0x5D, 0x8E, 0x8E, 0xEB, 0x42, 0xEB, 0xEA, 0x3E, 0x40, 0xF8, 0xF8, 0x96, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x20, 0xFE, 0xE5, 0x9E, 0x12, 0x4A, 0xBD, 0xBD, 0x04, 0x45, 0xBD, 0xBD, 0xC9, 0x1B, 0x12, 0x4A, 0x7C, 0x4A, 0x0E, 0x31, 0x31, 0x3B, 0x0E, 0x7C, 0xEF, 0x7E, 0xE1, 0x1B, 0x4A, 0x81, 0xFB, 0xF9, 0xB7, 0xFB, 0x33, 0x1C, 0x7D, 0x12, 0x7D, 0x8A, 0x22, 0xBC, 0x2C, 0x0A, 0x05, 0x62, 0xE2, 0x74, 0xF1, 0x88, 0x7B, 0x34, 0x37, 0x37, 0x37, 0x5F, 0x05, 0xBE, 0xAA, 0x37, 0x34, 0x36, 0x5F, 0x32, 0xE8, 0xD2, 0x32, 0xD2, 0xE2, 0x77, 0x32, 0xE2, 0x32, 0x32, 0x91, 0x77, 0x77, 0xE2, 0xE2, 0xD2, 0x93, 0x71, 0x16, 0x07, 0x6B, 0x81, 0x86, 0xF9, 0x12, 0x26, 0x12, 0x1C, 0x1F, 0x1A, 0xCC, 0x8F, 0xB2, 0xBD, 0x81, 0x45, 0x86, 0x82, 0xC3, 0x73, 0x4B, 0x4B, 0x9A, 0x14, 0xA3, 0x4B, 0x4B, 0x68, 0xBD, 0x68, 0x81, 0x81, 0x73, 0xC4, 0xC3, 0xB4, 0x26, 0x20, 0x70, 0x13, 0x98, 0x85, 0x98, 0x55, 0x55, 0x55, 0x55, 0x90, 0x4F, 0x2A, 0x2A, 0x36, 0x36, 0x36, 0x90, 0x36, 0x36, 0x90, 0x90, 0x36, 0x90, 0x90, 0x36, 0x90, 0x36, 0x36, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0x37, 0x4F, 0x2A, 0x2A, 0x2A, 0x4F, 0x4F, 0x66, 0x90, 0x4F,
+	0xC1, 0xC1, 0xF5, 0xF5, 0xC1, 0xA8, 0xC1, 0xA8, 0xC1, 0xDA, 0x16, 0x02, 0x16, 0x5D, 0x94, 0x94, 0xC2, 0x0B, 0x0B, 0x24, 0xE4, 0x24, 0xE4, 0x39, 0x24, 0x24, 0xE4, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x16, 0x02, 0xED, 0x02, 0x52, 0xBB, 0x6F, 0x16, 0x16, 0xDA, 0xDA, 0xC1, 0x16, 0xDA, 0x5D, 0x16, 0x16, 0x16, 0x8E, 0x16, 0xC1, 0xC1, 0x4E, 0x8E, 0x4E, 0x8E, 0x65, 0x94, 0x4E, 0x4E, 0x8E, 0xC1, 0x16, 0x16, 0xD2, 0xB3, 0x28, 0xA5, 0x5D, 0x5D, 0x5D, 0x8E, 0x5D, 0xEB, 0xEA, 0xEA, 0x40, 0x8E, 0x96, 0xF8, 0xF8, 0xEA, 0xEA, 0xF8, 0xEA, 0x7D, 0x41, 0x20, 0xC3, 0x45, 0x4A, 0x1B, 0x4A, 0x04, 0x04, 0xBD, 0x04, 0x83, 0xBD, 0xBD, 0x4A, 0x1B, 0x4A, 0x7C, 0xE1, 0xBD, 0x31, 0x7C, 0x04, 0x0E, 0x0E, 0x75, 0x1B, 0xC9, 0xE1, 0x4B, 0x83, 0xE5, 0xB7, 0x00, 0xE3, 0x2C, 0x13, 0x18, 0x70, 0x89, 0x8A, 0x1C, 0xAC, 0x47, 0x74, 0x62, 0x38, 0x05, 0xC5, 0x0A, 0xBE, 0x5F, 0x37, 0x34, 0x37, 0x37, 0x38, 0x3D, 0xE8, 0x37, 0xCB, 0x36, 0x92, 0x92, 0x93, 0xE8, 0xD2, 0x32, 0x32, 0xD2, 0xE2, 0x77, 0x32, 0x77, 0x77, 0x91, 0x91, 0xD5, 0x77, 0x77, 0x32, 0x92, 0xDB, 0x40, 0xBB, 0x52, 0xC3, 0xE5, 0x81, 0x26, 0x12, 0x10, 0x1F, 0x22, 0xAA, 0xCC, 0x26, 0x6C, 0x86, 0x81, 0x81, 0x86, 0xC3, 0xC3, 0x73, 0xCD, 0x9A, 0x9E, 0x4B, 0x26, 0x26, 0x9F, 0x81, 0x45, 0x45, 0x81, 0xB4, 0x73, 0x73, 0xB5, 0xA3, 0xD6, 0xA6, 0x11, 0x2E, 0xFC, 0x6E, 0x9C, 0x4F, 0x55, 0x55, 0x55, 0x55, 0x4F, 0x90, 0x2A, 0x90, 0x36, 0x90, 0x36, 0x36, 0x90, 0x36, 0x36, 0x90, 0x90, 0x90, 0x36, 0x36, 0x90, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x37, 0xCB, 0x4F, 0x4F, 0x37, 0x2A, 0x0F, 0x2A, 0x4F, 0x90, 0x66, 0xCE, 0x4F,
+	0x16, 0xDA, 0xF5, 0xF5, 0xF5, 0xF6, 0xC1, 0xC1, 0xDA, 0xDA, 0xC1, 0x16, 0x02, 0x5D, 0x94, 0x15, 0x2B, 0x0B, 0x0B, 0x24, 0x24, 0xE4, 0xE4, 0x24, 0xE4, 0xE4, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0xC8, 0xDA, 0x52, 0x6B, 0x02, 0x52, 0xBB, 0xDA, 0x6F, 0x6F, 0x16, 0xC1, 0xDA, 0xDA, 0x16, 0x16, 0x5D, 0xC1, 0x8E, 0x6F, 0x8E, 0xC1, 0xC1, 0x16, 0x16, 0x40, 0x65, 0x65, 0x65, 0x65, 0x3E, 0x65, 0x4E, 0xC1, 0xDA, 0xA2, 0xB3, 0xD9, 0xB1, 0x5D, 0x5D, 0x94, 0x94, 0x8E, 0xEA, 0xC1, 0xA8, 0x96, 0x71, 0x6A, 0x40, 0xF8, 0xDA, 0x52, 0x20, 0x07, 0x12, 0x12, 0x4A, 0x8D, 0x86, 0x4A, 0x1B, 0xBD, 0x83, 0xFB, 0xC9, 0xBD, 0xBD, 0xBD, 0x83, 0x45, 0xC9, 0x4A, 0x12, 0xBD, 0x31, 0x7C, 0x4A, 0xBD, 0xC9, 0x04, 0xEF, 0x51, 0x83, 0x83, 0x83, 0x83, 0xB7, 0x00, 0x5A, 0xCC, 0x11, 0x07, 0x48, 0x88, 0x46, 0xCC, 0x46, 0x2C, 0x49, 0x63, 0x62, 0x62, 0xC6, 0x05, 0x0A, 0x88, 0x7B, 0x34, 0x34, 0x34, 0x34, 0x93, 0x36, 0xC0, 0x0F, 0xA2, 0x7F, 0x92, 0x93, 0xD2, 0xE8, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xD2, 0xE2, 0x91, 0x77, 0xD5, 0x77, 0x77, 0x77, 0x77, 0xD2, 0xDB, 0xDF, 0xDA, 0x52, 0x9E, 0xFA, 0x81, 0x81, 0xD6, 0x4A, 0xA6, 0x22, 0x88, 0x22, 0xD7, 0xB2, 0xCD, 0xBD, 0x86, 0x4B, 0xC3, 0xA3, 0x3F, 0xCD, 0x4B, 0xCD, 0xCD, 0x4B, 0x4B, 0xCD, 0x81, 0x81, 0x81, 0xB4, 0x3F, 0x10, 0xE6, 0xE6, 0x14, 0x20, 0x70, 0x48, 0x58, 0x98, 0x9D, 0x4F, 0x2A, 0xCB, 0x4F, 0x66, 0x66, 0xCE, 0x53, 0xCE, 0x66, 0xCB, 0x37, 0x90, 0x37, 0x2A, 0x2A, 0x2A, 0x36, 0x2A, 0x2A, 0x90, 0x36, 0x37, 0x36, 0x90, 0x90, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x4F, 0x4F, 0x53, 0xC0, 0x66, 0x4F, 0x66, 0xCE, 0xCE, 0xCE,
+	0xC1, 0xF5, 0xC1, 0xF5, 0xF5, 0x5D, 0xC1, 0xC1, 0xDA, 0xC1, 0x29, 0x29, 0x02, 0x5D, 0x94, 0x15, 0xC2, 0x0B, 0x0B, 0x24, 0x24, 0x24, 0xE4, 0xE4, 0x39, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x0D, 0xC1, 0x52, 0x6B, 0x02, 0x52, 0xBB, 0x6F, 0xDA, 0x16, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x16, 0x16, 0x16, 0xC1, 0x6A, 0xBF, 0x96, 0x5D, 0x65, 0x65, 0x65, 0x65, 0x4E, 0xEA, 0x29, 0x3C, 0xB3, 0xD9, 0x39, 0x29, 0x94, 0x8E, 0x96, 0xF8, 0xC1, 0xA8, 0x6A, 0x71, 0x96, 0x96, 0xF8, 0x6F, 0x07, 0x52, 0x8D, 0x12, 0x4B, 0xBD, 0x12, 0x4B, 0x45, 0x20, 0x1B, 0x83, 0x04, 0xBD, 0x10, 0x10, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x10, 0xC9, 0xC9, 0xBD, 0x1B, 0x1B, 0x1B, 0x31, 0x3B, 0x1B, 0x7E, 0x3B, 0x83, 0x6D, 0x83, 0x00, 0x14, 0x11, 0x11, 0xA8, 0xFC, 0x93, 0xE8, 0x76, 0xAA, 0x76, 0x1F, 0xAC, 0x0A, 0x63, 0x62, 0x74, 0x74, 0x44, 0x7B, 0x7B, 0x34, 0x38, 0x7B, 0xA7, 0xA2, 0xC0, 0xBF, 0xA2, 0xD0, 0x7F, 0x92, 0xE8, 0xE8, 0x32, 0xD2, 0x57, 0xE2, 0xE2, 0xE2, 0x77, 0xE2, 0xE2, 0x77, 0xD5, 0x91, 0x95, 0x77, 0x77, 0x77, 0xD2, 0x7F, 0x71, 0x4E, 0xBB, 0xEE, 0x3A, 0xF9, 0x83, 0x9F, 0x4A, 0x12, 0x1C, 0x44, 0xCC, 0xE3, 0x14, 0xCD, 0xBD, 0x81, 0xBD, 0xC3, 0x14, 0x14, 0x9F, 0xCD, 0x4B, 0x8D, 0x26, 0xCD, 0x3F, 0x73, 0xB5, 0x73, 0xB4, 0x10, 0x9F, 0x04, 0x81, 0xA3, 0x5E, 0x48, 0x2E, 0x58, 0xB8, 0x9C, 0x90, 0x2A, 0x90, 0x66, 0x53, 0xCE, 0xCE, 0xCE, 0xCE, 0x53, 0xCE, 0x4F, 0x4F, 0x66, 0xCB, 0x37, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x90, 0x90, 0x36, 0x2A, 0x2A, 0x2A, 0x90, 0x4F, 0x90, 0xC0, 0xC0, 0x4F, 0xC0, 0x53, 0x4F, 0xCE,
+	0xC1, 0xC1, 0xF5, 0xF5, 0x5D, 0x5D, 0xA8, 0xC1, 0xDA, 0xDA, 0x16, 0xBB, 0x16, 0x5D, 0x65, 0x15, 0xC2, 0x0B, 0xC7, 0x24, 0xE4, 0xE4, 0xE4, 0x39, 0x24, 0xE4, 0xE4, 0x24, 0x0B, 0xC2, 0x08, 0x0D, 0xDA, 0xBB, 0x6B, 0x02, 0x52, 0x6F, 0x6F, 0xDA, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x4E, 0xC1, 0x16, 0xC1, 0xC1, 0x16, 0x16, 0xDA, 0x3E, 0x4D, 0x4D, 0x40, 0x8E, 0x65, 0x65, 0x8E, 0x94, 0x65, 0x8E, 0xC1, 0xA8, 0x1E, 0xB3, 0xB1, 0x29, 0x94, 0x94, 0x8E, 0x3E, 0xF3, 0xF3, 0x6A, 0xF8, 0xF8, 0x96, 0x96, 0xF8, 0x7D, 0x41, 0x12, 0x12, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x1B, 0x12, 0x3B, 0x83, 0x4A, 0x4A, 0x10, 0x9F, 0x83, 0xBD, 0x4A, 0x04, 0xBD, 0xC9, 0xC9, 0xBD, 0x31, 0x51, 0x7E, 0x1B, 0x04, 0xC9, 0x7E, 0x0E, 0x3B, 0x3B, 0xB7, 0x14, 0x48, 0x0F, 0x42, 0xFC, 0x93, 0x93, 0x36, 0x88, 0xD4, 0x62, 0x2C, 0x2C, 0x44, 0x62, 0x0A, 0x0A, 0x91, 0x56, 0x38, 0x34, 0x5F, 0xA7, 0xD3, 0xA2, 0x79, 0x06, 0xA2, 0xDB, 0x7F, 0xA4, 0x92, 0xD2, 0x32, 0xE8, 0x32, 0x32, 0xE2, 0xE2, 0xE2, 0xAE, 0xE2, 0x77, 0x77, 0xD5, 0x77, 0xD5, 0x77, 0xD5, 0xE2, 0xE2, 0xD2, 0xBF, 0xEA, 0xBB, 0xEE, 0xC3, 0xFA, 0x83, 0x83, 0x26, 0x26, 0x1F, 0x46, 0x76, 0x18, 0x14, 0x68, 0x9F, 0xBD, 0xCD, 0x73, 0x3F, 0xA3, 0xCD, 0x4B, 0x10, 0x4A, 0x4A, 0x4B, 0x73, 0x73, 0x82, 0xB4, 0x73, 0xCD, 0x68, 0x83, 0x68, 0x12, 0x7D, 0xE0, 0x48, 0xFC, 0x9D, 0x66, 0x2A, 0x2A, 0xCB, 0x90, 0x4F, 0x4F, 0x4F, 0x66, 0xCE, 0xCE, 0x55, 0xE0, 0x66, 0xCE, 0xCE, 0x4F, 0x4F, 0x4F, 0x4F, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x36, 0x2A, 0x2A, 0x4F, 0xCB, 0xCB, 0x90, 0x66, 0xC0, 0xC0, 0xC0, 0x53, 0xC0, 0x53, 0xCE, 0xCE,
+	0xC1, 0xF5, 0xF5, 0xF5, 0x16, 0x29, 0x16, 0xDA, 0xC1, 0xDA, 0x16, 0xBB, 0x16, 0x5D, 0x0D, 0x2D, 0xC2, 0xC2, 0x24, 0x24, 0xDB, 0xE4, 0xE4, 0x39, 0xE4, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x0D, 0xDA, 0x52, 0x52, 0x52, 0x6F, 0x6F, 0xDA, 0x6F, 0xC1, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xDA, 0xC1, 0xC1, 0x16, 0x16, 0x16, 0xC1, 0xC1, 0x8E, 0x96, 0x16, 0x8E, 0x0D, 0x40, 0x8E, 0x94, 0x8E, 0x3E, 0x8E, 0x94, 0x5D, 0x84, 0xB3, 0xD2, 0x94, 0x65, 0x96, 0x16, 0x8E, 0x3C, 0x6E, 0x87, 0xEA, 0xF8, 0x13, 0xF8, 0x42, 0x20, 0x12, 0x8D, 0xBD, 0x4A, 0x4A, 0x83, 0xE5, 0x45, 0x12, 0x4A, 0xBD, 0xBD, 0x10, 0xBD, 0x10, 0x9F, 0xBD, 0xBD, 0x9F, 0xBD, 0xBD, 0x4A, 0x04, 0xC9, 0x4A, 0x1B, 0x1B, 0x51, 0xD6, 0x7C, 0xEF, 0x1B, 0x6D, 0x6D, 0x9A, 0x7D, 0x21, 0x87, 0x6E, 0x92, 0xE8, 0xA7, 0xE8, 0xE8, 0x62, 0x0A, 0x76, 0x8C, 0xD4, 0xD4, 0x0A, 0x57, 0xFF, 0x05, 0xDE, 0x38, 0xA7, 0x0F, 0x0F, 0x06, 0xBF, 0xA2, 0xDB, 0x7F, 0x7F, 0x7F, 0x93, 0x32, 0xD2, 0x32, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0x77, 0xE2, 0xAE, 0x77, 0x77, 0x91, 0x95, 0x77, 0x77, 0x77, 0xD2, 0xD2, 0xBF, 0x0D, 0x6F, 0xEE, 0xFE, 0xFA, 0x83, 0x83, 0xD6, 0x10, 0xBC, 0x89, 0xCC, 0xE3, 0x26, 0xB4, 0x10, 0x10, 0xBD, 0x14, 0x14, 0x10, 0xA3, 0xCD, 0x26, 0x8D, 0x4B, 0x4B, 0x73, 0x81, 0x82, 0xB4, 0xBD, 0xCD, 0xB4, 0xE6, 0xCD, 0xE3, 0x70, 0x11, 0x58, 0xB8, 0x9C, 0x90, 0x36, 0x2A, 0x2A, 0x2A, 0x37, 0x4F, 0x4F, 0x4F, 0x4F, 0x66, 0x66, 0xE0, 0xE0, 0x55, 0x66, 0xCE, 0x66, 0x9C, 0x66, 0xCE, 0x66, 0x4F, 0x90, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xCB, 0x37, 0x4F, 0x4F, 0x4F, 0x4F, 0x66, 0x90, 0x4F, 0x53, 0xCE, 0xCE, 0xCE,
+	0xC1, 0xF5, 0xF5, 0xF5, 0x5D, 0xA8, 0x16, 0xA8, 0xC1, 0x16, 0x16, 0xBB, 0x16, 0x16, 0x94, 0x2D, 0xC2, 0xC2, 0xC7, 0x24, 0xE4, 0xE4, 0xDB, 0xE4, 0xE4, 0xE4, 0x24, 0x24, 0x0B, 0xC2, 0x08, 0x0D, 0xC1, 0x52, 0x02, 0x52, 0x6F, 0x6F, 0xDA, 0x07, 0xDA, 0xC1, 0xC1, 0xC1, 0x16, 0x16, 0x16, 0xDA, 0xC1, 0x16, 0x16, 0xC1, 0x4E, 0x8E, 0xF5, 0x40, 0x3E, 0x65, 0x8E, 0x94, 0x65, 0xC8, 0xE9, 0x94, 0x8E, 0x94, 0x5D, 0x5D, 0xD2, 0xE2, 0x96, 0x40, 0x8E, 0x8E, 0x3C, 0x3C, 0x87, 0xA9, 0xF8, 0x17, 0xF8, 0x41, 0x20, 0x52, 0x8D, 0xBD, 0x4A, 0x4A, 0x4B, 0x83, 0x81, 0xF9, 0xE1, 0x1B, 0xBD, 0x4A, 0x45, 0x4A, 0x4A, 0xBD, 0x04, 0x10, 0x45, 0xBD, 0x4A, 0xBD, 0x04, 0x04, 0x51, 0x1B, 0xE1, 0x4A, 0x4A, 0x4A, 0xEF, 0x35, 0x00, 0xB7, 0xA6, 0x2F, 0xF8, 0xF4, 0x2A, 0xE8, 0xA2, 0x61, 0x32, 0xE8, 0x0A, 0x8A, 0x2C, 0xAC, 0xD4, 0x34, 0x0A, 0x91, 0x0A, 0x38, 0x34, 0x34, 0x36, 0x0F, 0x06, 0xFD, 0xCA, 0xDB, 0xDB, 0x7F, 0xD0, 0x92, 0x93, 0x32, 0x32, 0xD2, 0x32, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0x77, 0xE2, 0x77, 0xD5, 0x77, 0x77, 0xD5, 0x77, 0xB3, 0x77, 0xD2, 0xCA, 0x96, 0x16, 0x52, 0x99, 0xE5, 0xF9, 0x83, 0x4B, 0x4A, 0xA6, 0x46, 0x76, 0xBA, 0xA3, 0xB4, 0xBD, 0xBD, 0x3F, 0x10, 0x14, 0xCD, 0xCD, 0x4B, 0x10, 0x26, 0x10, 0xBD, 0x73, 0x73, 0x81, 0x3F, 0xCD, 0x9F, 0xB4, 0xB4, 0x26, 0x47, 0x2E, 0x11, 0x8B, 0x84, 0xCE, 0x2A, 0x36, 0x36, 0x2A, 0x36, 0x2A, 0x2A, 0x90, 0x66, 0x37, 0xCE, 0x4F, 0x55, 0x66, 0x55, 0x55, 0x55, 0x55, 0x9C, 0x9C, 0x9C, 0x66, 0x66, 0x55, 0x66, 0x4F, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0x4F, 0x4F, 0x66, 0x53, 0xCE, 0x53, 0xC0, 0x53, 0x53, 0xCF, 0x53,
+	0xC1, 0xF5, 0xF5, 0xF5, 0xA8, 0x16, 0x16, 0x16, 0x29, 0x16, 0x6F, 0x02, 0x29, 0x16, 0x65, 0x2D, 0xC2, 0xC2, 0x24, 0x24, 0xDB, 0xE4, 0xE4, 0x39, 0x24, 0xE4, 0x24, 0x24, 0x0B, 0x0B, 0x08, 0x0D, 0xDA, 0x52, 0x52, 0xBB, 0x6F, 0x6F, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xC1, 0xC1, 0xC1, 0x16, 0x4E, 0xC1, 0xC1, 0xC1, 0xC1, 0x8E, 0x0D, 0x96, 0x8E, 0x94, 0x40, 0xC8, 0x40, 0x94, 0x94, 0xC8, 0x94, 0x8E, 0x65, 0xDC, 0xD2, 0xE9, 0x6A, 0x8E, 0x65, 0xDF, 0x85, 0x85, 0x54, 0x17, 0xF8, 0x7D, 0xEA, 0x8D, 0x4B, 0xBD, 0xBD, 0x20, 0x1B, 0x04, 0x83, 0xBD, 0x83, 0xBD, 0x20, 0x31, 0xBD, 0x45, 0x12, 0xC9, 0x83, 0x45, 0x10, 0x04, 0xC9, 0x4A, 0x4A, 0xBD, 0x04, 0x7C, 0xC9, 0xC9, 0x4A, 0x04, 0x6D, 0x1B, 0x7E, 0xB7, 0x20, 0x2F, 0xF8, 0x87, 0x17, 0x78, 0x2A, 0x5F, 0x3D, 0x61, 0x32, 0x57, 0x44, 0x2C, 0x49, 0xDE, 0xBE, 0x57, 0x57, 0xAA, 0xDE, 0x4F, 0xD1, 0x0F, 0x06, 0xBF, 0xCA, 0xDB, 0xD0, 0x7F, 0x7F, 0xA4, 0x92, 0x93, 0x93, 0x32, 0x32, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0x77, 0xD5, 0x91, 0x95, 0x77, 0xB3, 0x77, 0xD2, 0xD0, 0x71, 0x8E, 0xBB, 0x99, 0x86, 0xE5, 0x83, 0x45, 0x26, 0xE3, 0xD4, 0x46, 0xA6, 0x26, 0xB4, 0x81, 0x3F, 0x10, 0xB4, 0xA3, 0x10, 0xA3, 0xCD, 0x10, 0x4B, 0x4B, 0x86, 0x86, 0x73, 0x86, 0xBD, 0x3F, 0xB4, 0x82, 0x73, 0x12, 0x48, 0x11, 0x2E, 0xFC, 0x9D, 0xCE, 0x36, 0x90, 0x36, 0x90, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x90, 0xCB, 0x4F, 0x66, 0x4F, 0x66, 0x4F, 0x66, 0x55, 0x55, 0x9C, 0x9C, 0x9C, 0x9C, 0xE0, 0xE0, 0x55, 0x66, 0x55, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0xCE, 0xCE, 0xC0, 0xC0, 0x53, 0x53, 0xCE, 0xCF,
+	0xDA, 0xF5, 0xC1, 0xC1, 0x16, 0xA8, 0x16, 0xDA, 0x16, 0x29, 0x16, 0xBB, 0x02, 0x16, 0x65, 0x15, 0xC2, 0xFD, 0xC7, 0x24, 0xE4, 0xE4, 0x80, 0xE4, 0x39, 0xE4, 0xE4, 0x24, 0x0B, 0xC2, 0x08, 0x0D, 0x6F, 0xBB, 0x6B, 0x52, 0x6F, 0x6F, 0x6F, 0x07, 0xC1, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xF5, 0x4E, 0xC1, 0xC1, 0xC1, 0xC1, 0xF5, 0xC1, 0x4E, 0xC8, 0x8E, 0x4E, 0x65, 0xC8, 0x0D, 0x8E, 0x94, 0x94, 0xC8, 0x8E, 0x94, 0x3C, 0x65, 0xDD, 0x65, 0x0D, 0x3E, 0x96, 0xF8, 0x17, 0x54, 0xEB, 0xF8, 0x70, 0x20, 0x9E, 0x45, 0x12, 0xBD, 0x3B, 0x7C, 0x1B, 0x83, 0x45, 0xBD, 0xBD, 0x83, 0xC9, 0x12, 0xBD, 0x4A, 0xE1, 0x4B, 0x83, 0xBD, 0x9F, 0x04, 0xC9, 0x4A, 0xD6, 0xC9, 0xBD, 0x04, 0xBD, 0xE1, 0x7C, 0x83, 0x6D, 0xB6, 0x03, 0x60, 0xCC, 0x2E, 0x07, 0x54, 0x93, 0x7F, 0x9C, 0x36, 0xF2, 0x61, 0xF1, 0x0A, 0x0A, 0x62, 0x47, 0xDE, 0x57, 0x0A, 0x44, 0x37, 0xCB, 0x0F, 0xC0, 0xBF, 0x0F, 0xDB, 0xCA, 0x7F, 0xD0, 0x7F, 0xA4, 0x93, 0x92, 0xD2, 0x92, 0xD2, 0xD2, 0x32, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0x77, 0x77, 0xD5, 0xB3, 0x77, 0x77, 0xE2, 0x93, 0x71, 0x8E, 0xDA, 0x6B, 0x9E, 0x81, 0x83, 0x83, 0x4A, 0x33, 0x1C, 0x89, 0xA6, 0xA3, 0x73, 0xCD, 0xBD, 0x10, 0x14, 0xCD, 0xCD, 0x4B, 0xA3, 0x4A, 0xCD, 0x3F, 0x86, 0x73, 0x45, 0x3F, 0x10, 0xB4, 0xF9, 0xB5, 0x26, 0x20, 0x1F, 0x2E, 0x58, 0x98, 0x9C, 0x90, 0x36, 0x36, 0x2A, 0x36, 0x90, 0x36, 0x90, 0x90, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xCB, 0x90, 0x4F, 0x55, 0x55, 0x8C, 0x67, 0xE0, 0x55, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xE0, 0xE0, 0x66, 0x55, 0x66, 0xCE, 0xCE, 0xC0, 0xC0, 0x53, 0x53, 0xCE, 0xCF,
+	0x16, 0x16, 0x16, 0x5D, 0x5D, 0x16, 0xA8, 0x16, 0xDA, 0xDA, 0x16, 0x29, 0x29, 0x16, 0x65, 0x15, 0xC2, 0xC2, 0x24, 0x24, 0xE4, 0xDB, 0xE4, 0xE4, 0x39, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x94, 0x6F, 0x52, 0x52, 0xBB, 0x6F, 0x6F, 0x07, 0x6F, 0xC1, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xF5, 0xF5, 0xC1, 0x4E, 0x16, 0x5D, 0x8E, 0x8E, 0x8E, 0x8E, 0x40, 0x40, 0x94, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0xC8, 0xA9, 0x02, 0x5D, 0x65, 0x5D, 0x6A, 0x96, 0x17, 0xF8, 0x54, 0xEB, 0x70, 0x41, 0x12, 0x9E, 0x10, 0xD6, 0x04, 0x3B, 0xD6, 0x1B, 0x83, 0x7C, 0x83, 0xBD, 0x83, 0x83, 0xC9, 0x31, 0x20, 0x4A, 0xBD, 0x83, 0xC9, 0x45, 0x83, 0xE1, 0x4A, 0xBD, 0x31, 0xBD, 0xBD, 0x04, 0x51, 0x1B, 0x6D, 0x6D, 0xB7, 0x26, 0x1F, 0x48, 0x5E, 0x54, 0x93, 0xA2, 0x53, 0x36, 0x37, 0x37, 0xF1, 0x0A, 0x0A, 0x46, 0x0A, 0x2C, 0xDE, 0x0A, 0xAA, 0xA7, 0x0F, 0x0F, 0xBF, 0xCA, 0xCA, 0xCA, 0xDB, 0x0F, 0x92, 0xA4, 0x78, 0x7F, 0x78, 0x92, 0x92, 0xD2, 0xE8, 0xD2, 0x32, 0xD2, 0x57, 0x32, 0xE2, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xE2, 0x93, 0xBF, 0xF8, 0x16, 0x52, 0xC3, 0x81, 0xFB, 0x83, 0x26, 0x12, 0x70, 0x89, 0x8B, 0x26, 0xA3, 0xB4, 0xB4, 0x10, 0xB4, 0x10, 0xA3, 0x10, 0x4A, 0x26, 0xCD, 0x73, 0xB4, 0x73, 0xBD, 0xCD, 0x10, 0xB4, 0x82, 0x73, 0x33, 0x70, 0x48, 0x17, 0x58, 0x84, 0x66, 0x90, 0x90, 0x2A, 0x90, 0x90, 0x90, 0x37, 0x37, 0x90, 0x90, 0x37, 0x37, 0x90, 0x2A, 0x2A, 0x37, 0x4F, 0xCB, 0x37, 0x55, 0x55, 0x67, 0x67, 0x66, 0x55, 0x55, 0x8C, 0xE0, 0x67, 0x8C, 0x64, 0x9D, 0x8C, 0xE0, 0xE0, 0x53, 0xCE, 0xCE, 0x53, 0x53, 0xCE, 0x06, 0x79,
+	0xC1, 0xF5, 0xC1, 0xC1, 0x16, 0xA8, 0x16, 0x16, 0x16, 0x16, 0x16, 0x02, 0x02, 0x16, 0x94, 0x15, 0x71, 0xC7, 0xC7, 0xDB, 0x24, 0xE4, 0xE4, 0x39, 0x80, 0xE4, 0xE4, 0x24, 0x0B, 0xC2, 0x08, 0x94, 0xDA, 0xBB, 0x6B, 0x52, 0x6F, 0x52, 0xDA, 0x07, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x4E, 0x4E, 0x4E, 0x8E, 0x94, 0x94, 0x94, 0xC8, 0x8E, 0x96, 0x8E, 0x94, 0x8E, 0x4D, 0xA8, 0x02, 0x6E, 0xC7, 0x3E, 0x6A, 0xF8, 0xF8, 0xF8, 0xF8, 0x7D, 0xF8, 0x7D, 0x12, 0x45, 0x12, 0x1B, 0x83, 0x6D, 0x7C, 0x51, 0xC9, 0xBD, 0xBD, 0xBD, 0x4A, 0xBD, 0x12, 0x51, 0x4A, 0x10, 0x83, 0x83, 0xBD, 0xBD, 0x3B, 0x1B, 0xBD, 0x04, 0xE1, 0xE1, 0xBD, 0xC9, 0x1B, 0x10, 0x3B, 0x83, 0x82, 0x20, 0x7D, 0x8F, 0x01, 0x93, 0xA2, 0xC7, 0xA2, 0x2A, 0x90, 0x5F, 0xBE, 0xE2, 0x05, 0x0A, 0x05, 0x34, 0x0A, 0xE8, 0xAA, 0xA2, 0x06, 0x06, 0xD0, 0xD0, 0xCA, 0xCA, 0xDB, 0xA2, 0x78, 0x92, 0x92, 0x92, 0x92, 0x7F, 0x92, 0x93, 0x93, 0xD2, 0x32, 0x32, 0xD2, 0xE2, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0x77, 0x77, 0xD5, 0x77, 0xB3, 0x77, 0xD2, 0xBF, 0x96, 0x6F, 0x52, 0xC3, 0xE5, 0xE5, 0x45, 0x10, 0xD6, 0xBC, 0x89, 0x11, 0x26, 0x14, 0xCD, 0xCD, 0x4A, 0x4B, 0xCD, 0x9F, 0x10, 0x4B, 0xCD, 0x14, 0x3F, 0x3F, 0xBD, 0x86, 0xBD, 0x3F, 0xB4, 0xB5, 0xA3, 0xE3, 0x70, 0x2E, 0x58, 0x98, 0x98, 0x90, 0x2A, 0x36, 0x90, 0x36, 0x36, 0x36, 0x90, 0x90, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x36, 0x37, 0x36, 0x37, 0xCB, 0x55, 0x55, 0x66, 0x67, 0x55, 0x55, 0x55, 0x66, 0x8C, 0x8C, 0x8C, 0x8C, 0x48, 0x64, 0x9D, 0xE0, 0xE0, 0xE0, 0xCF, 0xCF, 0x53, 0xCE, 0xCE, 0x53,
+	0xC1, 0xC1, 0x5D, 0x5D, 0x16, 0x16, 0x29, 0x16, 0xDA, 0x16, 0x29, 0x29, 0x29, 0x16, 0x65, 0x15, 0xDD, 0xFD, 0xC7, 0x24, 0x24, 0xDB, 0xE4, 0xE4, 0x39, 0xE4, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x94, 0x07, 0x52, 0x52, 0x52, 0x6F, 0x6F, 0x6F, 0xDA, 0xDA, 0xC1, 0xDA, 0xC1, 0xDA, 0x4E, 0xC1, 0x4E, 0x16, 0xDA, 0x5D, 0xC1, 0x8E, 0x4E, 0xEA, 0x8E, 0x94, 0x8E, 0xC8, 0x8E, 0x40, 0xC8, 0x65, 0x8E, 0xC8, 0x65, 0xCA, 0x79, 0x6E, 0xC0, 0x93, 0xCA, 0xEA, 0xF8, 0xF8, 0x13, 0xF8, 0xEB, 0x13, 0x52, 0x45, 0xBD, 0x7E, 0xC9, 0x3B, 0x3B, 0x1B, 0x7E, 0xBD, 0x04, 0x83, 0x45, 0x4A, 0x1B, 0x1B, 0x1B, 0x4A, 0x10, 0x83, 0x83, 0xBD, 0xBD, 0xC9, 0x1B, 0x83, 0x3B, 0x51, 0x4A, 0x83, 0x1B, 0x4A, 0x83, 0xBD, 0x00, 0x20, 0x1C, 0x5C, 0x5C, 0x3D, 0xD1, 0x2A, 0x36, 0x7F, 0xA2, 0xCB, 0x5F, 0xBE, 0x0A, 0x0A, 0xC6, 0x0A, 0x05, 0xBE, 0xCC, 0x2E, 0x85, 0xBF, 0x06, 0xCA, 0xCA, 0xD0, 0xCA, 0x7A, 0x7F, 0x78, 0x92, 0x93, 0x93, 0x93, 0x92, 0x92, 0x93, 0xD2, 0x93, 0xD2, 0x32, 0x32, 0xD2, 0x57, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0x77, 0x77, 0x91, 0x89, 0xD0, 0x96, 0xBB, 0xED, 0xFE, 0xE5, 0xFB, 0x45, 0xBD, 0x8D, 0xA6, 0x8A, 0xCC, 0x8F, 0x10, 0x10, 0x10, 0x26, 0x10, 0x4B, 0x10, 0x26, 0x26, 0xA3, 0x3F, 0xB4, 0xB4, 0xCD, 0xBD, 0x10, 0xBD, 0xB4, 0xC3, 0xD7, 0xA6, 0x48, 0x2E, 0x58, 0x85, 0x9D, 0x4F, 0x2A, 0x90, 0x90, 0x36, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x37, 0x90, 0x36, 0x90, 0x36, 0x90, 0x37, 0xCB, 0xCB, 0xCB, 0xCB, 0x55, 0x55, 0x66, 0xE0, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x67, 0x8C, 0x64, 0x58, 0xE0, 0xE0, 0x17, 0x9C, 0xE0, 0xE0, 0xCF, 0xCE,
+	0xDA, 0xC1, 0x16, 0x29, 0xF6, 0xA8, 0x16, 0x29, 0xDA, 0xDA, 0x16, 0x02, 0x02, 0x16, 0x65, 0x15, 0x08, 0x0B, 0xC7, 0x24, 0xDB, 0xE4, 0xE4, 0xE4, 0x39, 0xE4, 0xE4, 0x0B, 0x0B, 0xC2, 0x08, 0x94, 0x6F, 0x52, 0x52, 0x02, 0xBB, 0x6F, 0x6F, 0x07, 0xC1, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x16, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x8E, 0x8E, 0x94, 0x8E, 0x40, 0xC8, 0x8E, 0x65, 0xC8, 0x65, 0x08, 0x24, 0xFD, 0x06, 0x5A, 0xA3, 0x52, 0x6F, 0x41, 0xEB, 0xF8, 0xEB, 0xF8, 0x42, 0x7D, 0x41, 0x4A, 0xBD, 0x12, 0x51, 0x04, 0x3B, 0x04, 0xB0, 0x51, 0x83, 0x04, 0xBD, 0xBD, 0xD6, 0x4A, 0x4A, 0xBD, 0x45, 0x45, 0xE5, 0x83, 0xBD, 0xBD, 0xC9, 0x4A, 0x6D, 0xBD, 0x51, 0xC9, 0xBD, 0x1B, 0x0E, 0xBD, 0x82, 0x26, 0x21, 0x42, 0xA8, 0x90, 0xF1, 0x36, 0x36, 0xE8, 0x92, 0x4F, 0x66, 0x5F, 0x0A, 0xC6, 0xC6, 0x05, 0xC5, 0xE8, 0x2E, 0x02, 0xAF, 0x3E, 0x6A, 0xF8, 0x71, 0x4D, 0xCA, 0xCA, 0xD0, 0x92, 0xD0, 0x93, 0x93, 0x93, 0x92, 0x93, 0x92, 0x7F, 0x93, 0x93, 0xD2, 0xD2, 0x32, 0x32, 0xD2, 0x32, 0x32, 0xD2, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0x77, 0x77, 0x77, 0xE2, 0x89, 0xD0, 0x96, 0xED, 0x99, 0xC3, 0xF9, 0xF9, 0x83, 0x86, 0x26, 0xE3, 0x89, 0x76, 0xE3, 0xA3, 0xA3, 0x4A, 0x4B, 0x10, 0x4B, 0x4A, 0x26, 0xD6, 0xA3, 0x3F, 0xB5, 0xB4, 0x68, 0x10, 0x9F, 0xCD, 0x81, 0x3F, 0x33, 0x47, 0x11, 0x48, 0xE7, 0x98, 0x79, 0xC0, 0x90, 0x90, 0x90, 0x90, 0x39, 0x90, 0x37, 0x90, 0x90, 0x37, 0x90, 0x37, 0x36, 0x36, 0x90, 0x36, 0x36, 0x37, 0x37, 0x37, 0x4F, 0x37, 0xCB, 0x55, 0x55, 0xE0, 0x55, 0xE0, 0x66, 0xE0, 0x55, 0xE0, 0x8C, 0x8C, 0x58, 0x67, 0x48, 0x58, 0x58, 0x58, 0x9D, 0x9C, 0xE0,
+	0xDA, 0xDA, 0x16, 0xA8, 0x16, 0xA8, 0x16, 0x16, 0xC1, 0xDA, 0x16, 0x29, 0x02, 0x5D, 0x65, 0x15, 0xC2, 0xFD, 0xC7, 0x24, 0xE4, 0xE4, 0xE4, 0x80, 0x80, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x94, 0xDA, 0x52, 0x6B, 0x52, 0x6F, 0x6F, 0x6F, 0x07, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x16, 0x5D, 0x5D, 0x16, 0x4E, 0x16, 0x8E, 0xEA, 0x8E, 0xC8, 0x8E, 0xC8, 0x40, 0x94, 0x65, 0x94, 0x7F, 0xD2, 0xA9, 0xAF, 0x6C, 0x3A, 0x6C, 0x3A, 0xEB, 0xD0, 0xD0, 0x96, 0xEA, 0x41, 0x41, 0x4A, 0x9E, 0xE1, 0x51, 0xE1, 0x04, 0x04, 0x0E, 0x50, 0x51, 0x3B, 0x04, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x4A, 0x83, 0x45, 0x45, 0xBD, 0xBD, 0x04, 0x4A, 0x4A, 0x04, 0x4A, 0x1B, 0x4A, 0xC9, 0x4A, 0x83, 0xB7, 0xB5, 0x13, 0x48, 0xAF, 0x67, 0x32, 0x2A, 0x5F, 0x3D, 0xF1, 0x92, 0x55, 0x55, 0x5F, 0xBE, 0xC6, 0xC6, 0xF0, 0x3D, 0x98, 0x29, 0x02, 0x5D, 0x16, 0x16, 0xA8, 0xC1, 0x6F, 0x87, 0x87, 0x17, 0xCA, 0xD0, 0x93, 0x93, 0x93, 0xD0, 0x93, 0x92, 0x7F, 0x7F, 0x93, 0xD2, 0x89, 0xD2, 0x32, 0x32, 0xE8, 0xF2, 0xE2, 0xE2, 0xD2, 0x32, 0xD2, 0xE2, 0x77, 0x77, 0x32, 0x89, 0xD0, 0x96, 0x16, 0x4C, 0x72, 0x09, 0xFA, 0x81, 0x83, 0x10, 0x4A, 0xD7, 0x89, 0x76, 0xA6, 0x14, 0x73, 0x26, 0x10, 0x4A, 0x4B, 0x10, 0x26, 0x8D, 0x10, 0x73, 0xB5, 0xB4, 0xBD, 0x3F, 0x10, 0xBD, 0x81, 0xA3, 0x20, 0x70, 0x48, 0x58, 0xFC, 0x58, 0xCE, 0x2A, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x90, 0x90, 0x90, 0x90, 0x37, 0x36, 0x37, 0x90, 0x37, 0x37, 0x66, 0x90, 0x4F, 0x4F, 0x37, 0x4F, 0x55, 0xCB, 0x55, 0x55, 0xCB, 0x55, 0x11, 0xE0, 0x64, 0x67, 0x8C, 0x8C, 0x8C, 0x64, 0x48, 0x58, 0x58, 0x58,
+	0xF5, 0xF5, 0x5D, 0x16, 0xA8, 0x5D, 0x29, 0x16, 0xDA, 0xC1, 0x16, 0xBB, 0x02, 0x16, 0x94, 0xE9, 0xC2, 0xFD, 0xC7, 0x24, 0xD0, 0xE4, 0x39, 0x80, 0x80, 0xE4, 0xE4, 0xE4, 0x0B, 0xC2, 0x08, 0x94, 0xDA, 0x52, 0x02, 0x52, 0x6F, 0xBB, 0x07, 0x6F, 0xC1, 0xDA, 0xC1, 0xC1, 0xC1, 0x8E, 0xC1, 0xC1, 0x5D, 0xC1, 0x16, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x96, 0x8E, 0x40, 0x94, 0x40, 0x65, 0x0D, 0x7F, 0xE4, 0xAF, 0x4C, 0x72, 0x82, 0x82, 0x12, 0x13, 0x89, 0x93, 0x4D, 0x6F, 0x52, 0x20, 0x9E, 0x4B, 0x1B, 0x7E, 0x4A, 0x04, 0x04, 0x7C, 0x50, 0x51, 0x6D, 0x3B, 0x83, 0xBD, 0x4A, 0xC9, 0xBD, 0x4A, 0x4B, 0x45, 0xBD, 0xBD, 0x83, 0xBD, 0x4A, 0x51, 0x4A, 0xBD, 0x1B, 0x4A, 0xBD, 0x4A, 0xFB, 0xFA, 0xA6, 0x11, 0x8F, 0xFC, 0x93, 0x36, 0x5F, 0x3D, 0xF2, 0xF1, 0xA7, 0x55, 0x34, 0x7B, 0x0A, 0xF1, 0xE2, 0x36, 0x9C, 0xF4, 0x6E, 0x4D, 0x71, 0x6A, 0x3E, 0xF5, 0xBB, 0x4C, 0x4C, 0xAF, 0x29, 0xF3, 0x4D, 0xCA, 0x93, 0x93, 0xD0, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xD2, 0xD2, 0x32, 0xD2, 0x32, 0xE8, 0xD2, 0x32, 0x32, 0x32, 0xD2, 0x91, 0x32, 0x32, 0xE8, 0xA4, 0x54, 0x87, 0xC1, 0x02, 0x4C, 0x4C, 0x09, 0xFA, 0xE5, 0x81, 0xBD, 0x4A, 0x8D, 0x46, 0x46, 0x47, 0xA3, 0x73, 0x10, 0x4A, 0x4B, 0x4A, 0x4B, 0x10, 0x4B, 0x73, 0xB5, 0x14, 0xB4, 0x68, 0x9F, 0x9F, 0xBD, 0x81, 0x26, 0xA6, 0x48, 0x58, 0x98, 0x98, 0x9C, 0x2A, 0xA2, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x90, 0x55, 0x90, 0x90, 0x90, 0x37, 0x36, 0x90, 0x90, 0x55, 0x4F, 0x90, 0x4F, 0xCB, 0xCB, 0x37, 0xCB, 0x55, 0xCB, 0xCB, 0xCB, 0x55, 0x55, 0x8C, 0x48, 0x67, 0x48, 0x8C, 0x8C, 0x8C, 0x64, 0x8B, 0x8B,
+	0xC1, 0xC1, 0x5D, 0x5D, 0x16, 0xA8, 0xC1, 0x29, 0xC1, 0xDA, 0x16, 0xBB, 0x02, 0x16, 0x65, 0x15, 0xC2, 0xFD, 0xC7, 0x24, 0xE4, 0xE4, 0xE4, 0x80, 0x80, 0x24, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x0D, 0xDA, 0x52, 0x52, 0x52, 0x6F, 0x6F, 0x6F, 0x07, 0xDA, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x16, 0x16, 0x8E, 0x5D, 0x16, 0x8E, 0x4E, 0x3E, 0x8E, 0x94, 0x65, 0x8E, 0xE9, 0x15, 0x2D, 0x71, 0xC7, 0x6E, 0xA3, 0xC4, 0x81, 0x81, 0x33, 0x2E, 0x54, 0xF4, 0x41, 0x52, 0x8D, 0x12, 0x4A, 0x4A, 0x1B, 0x1B, 0x04, 0x04, 0x31, 0xB0, 0x7C, 0x7E, 0x3B, 0x3B, 0xBD, 0xD6, 0x4A, 0x4A, 0xC9, 0x10, 0x12, 0x45, 0xBD, 0xF9, 0x6D, 0x83, 0x04, 0x12, 0xE1, 0x1B, 0xBD, 0xD6, 0x10, 0x83, 0xB7, 0x33, 0x46, 0xF4, 0x01, 0xE8, 0x36, 0x36, 0x3D, 0x3D, 0xE2, 0x61, 0xCC, 0x2C, 0x7B, 0xF1, 0x57, 0xE2, 0x36, 0xE7, 0x3C, 0x06, 0xCA, 0xBF, 0x71, 0xD0, 0xBF, 0x06, 0x87, 0x16, 0x02, 0x4C, 0x4C, 0x4C, 0x02, 0xF6, 0x4D, 0xD0, 0xD0, 0x7F, 0xD0, 0x7F, 0x7F, 0x7F, 0x93, 0xD2, 0x32, 0x32, 0xD2, 0xE8, 0x32, 0xD2, 0xD2, 0xD2, 0x32, 0xD2, 0xCA, 0xFD, 0xF4, 0x8F, 0xAF, 0xBB, 0x16, 0xBB, 0x02, 0x52, 0x9A, 0x82, 0x81, 0x81, 0xBD, 0x8D, 0x4B, 0x46, 0x44, 0x70, 0x26, 0xB5, 0xA3, 0xD6, 0x26, 0x10, 0xD6, 0x4B, 0x14, 0x73, 0xB5, 0x73, 0x68, 0xB4, 0x10, 0x10, 0xBD, 0x81, 0x12, 0xB9, 0x2E, 0x58, 0x98, 0x58, 0xCF, 0x2A, 0xA2, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x90, 0x66, 0x4F, 0x90, 0x90, 0x4F, 0x66, 0x4F, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0x55, 0xCB, 0x8C, 0x8C, 0x64, 0x48, 0x8C, 0x58, 0x49, 0x64, 0x47,
+	0xDA, 0xF5, 0xC1, 0xC1, 0x5D, 0x5D, 0xC1, 0xDA, 0xDA, 0xDA, 0x16, 0x29, 0x02, 0x16, 0x8E, 0x2D, 0x2B, 0xC2, 0xC7, 0x24, 0xD0, 0xE4, 0x7F, 0x80, 0x80, 0xE4, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x0D, 0xDA, 0x52, 0x52, 0xBB, 0xBB, 0x6F, 0x6F, 0xDA, 0xDA, 0xC1, 0xC1, 0xC1, 0x16, 0xDA, 0xC1, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x3E, 0x94, 0xE9, 0x4D, 0xFD, 0x4D, 0x3C, 0xDD, 0x54, 0x72, 0x9E, 0x4A, 0xFA, 0x8D, 0x1F, 0x70, 0x8F, 0x52, 0x33, 0x12, 0x4B, 0x8D, 0x1B, 0x1B, 0xBD, 0x3B, 0x31, 0x51, 0x7C, 0x0E, 0x75, 0xBD, 0x3B, 0x83, 0x4A, 0x10, 0x9F, 0xC9, 0x25, 0x1B, 0x26, 0xBD, 0x83, 0x83, 0x83, 0x3B, 0xBD, 0x1B, 0x75, 0xBD, 0x10, 0x4A, 0x00, 0x04, 0x1F, 0x17, 0x3E, 0x36, 0x92, 0x90, 0x59, 0x5F, 0xE2, 0x32, 0x5F, 0x55, 0x34, 0x0A, 0x57, 0xBE, 0xD1, 0x65, 0x3E, 0x96, 0x4D, 0x71, 0x17, 0x40, 0x4D, 0xD0, 0xBF, 0x96, 0xF8, 0xF5, 0x4E, 0x02, 0x4C, 0x4C, 0x02, 0x5D, 0x4D, 0xCA, 0x24, 0xCA, 0xDB, 0xDB, 0x7F, 0x93, 0xD2, 0xD2, 0x89, 0x32, 0xE8, 0x32, 0xD2, 0xE8, 0xD2, 0xCA, 0x08, 0x29, 0xAF, 0xA8, 0x8F, 0x5C, 0xEA, 0x96, 0xF8, 0xEA, 0x07, 0x8D, 0xCD, 0x81, 0x45, 0x45, 0x10, 0x4B, 0x2F, 0x46, 0x98, 0x33, 0xB5, 0xB4, 0x26, 0x10, 0x4B, 0x4A, 0x26, 0x9F, 0xC4, 0xB5, 0x14, 0xB4, 0x68, 0x10, 0x10, 0x9F, 0x10, 0x33, 0x70, 0xE0, 0x8B, 0x98, 0x54, 0x0F, 0x2A, 0x2A, 0x90, 0xDB, 0x90, 0xC0, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x90, 0x90, 0x55, 0x90, 0x55, 0x90, 0x55, 0x90, 0x90, 0x4F, 0x66, 0x4F, 0x66, 0x4F, 0x4F, 0x90, 0xCB, 0xCB, 0x37, 0xCB, 0xCB, 0x55, 0x2C, 0xE0, 0x8C, 0x2C, 0x8C, 0xAC, 0x64, 0x48, 0x8B, 0x47,
+	0xC1, 0xDA, 0xF5, 0xC1, 0xF5, 0xF5, 0xC1, 0xF5, 0xC1, 0xDA, 0x16, 0x02, 0x02, 0x16, 0x65, 0xC8, 0xC2, 0xFD, 0xC7, 0xE4, 0xE4, 0xE4, 0xE4, 0x39, 0x80, 0x24, 0xE4, 0xE4, 0x0B, 0x0B, 0x08, 0xC8, 0x16, 0x52, 0x02, 0x52, 0x6F, 0x6F, 0x07, 0x6F, 0xC1, 0xC1, 0xC1, 0xC1, 0x16, 0x16, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x5D, 0x16, 0x16, 0xF5, 0xF6, 0xC1, 0xF5, 0x3E, 0x96, 0xBF, 0xBF, 0xC7, 0x4D, 0x79, 0x93, 0xF4, 0x70, 0x13, 0x12, 0x20, 0x70, 0x48, 0x70, 0x9E, 0x12, 0xBD, 0x4B, 0x4A, 0x7D, 0x51, 0x0E, 0xC9, 0x51, 0x51, 0x3B, 0x3B, 0xAD, 0xE1, 0x83, 0x83, 0x12, 0xC9, 0x3B, 0x3B, 0xBD, 0x35, 0xD6, 0xF9, 0xFB, 0x83, 0x83, 0x83, 0x04, 0x83, 0xC9, 0x1B, 0xF9, 0xB7, 0xB7, 0xA6, 0x1C, 0x07, 0xD1, 0x93, 0x5F, 0x3D, 0x38, 0xF2, 0xE2, 0x3D, 0x34, 0x34, 0x05, 0x57, 0x57, 0x11, 0x6F, 0x3E, 0x3E, 0x40, 0x3E, 0x6A, 0xF8, 0x52, 0x6F, 0xCA, 0xF8, 0xEA, 0xF8, 0x16, 0xEB, 0xEA, 0x8E, 0x4E, 0x29, 0x29, 0x3E, 0xBF, 0xBF, 0xC7, 0xC7, 0xCA, 0x7F, 0x93, 0x93, 0x32, 0xD2, 0x32, 0x32, 0x32, 0x93, 0x92, 0xCA, 0x4D, 0x4E, 0x5D, 0xF3, 0x6E, 0x5E, 0xF4, 0x42, 0xEA, 0xC1, 0x6F, 0x52, 0x8D, 0xCD, 0x86, 0xBD, 0x45, 0x10, 0x8D, 0x13, 0xD3, 0x8B, 0xE3, 0x14, 0x82, 0x4A, 0x4B, 0x4A, 0x4B, 0x10, 0x10, 0x14, 0xB2, 0xB4, 0x9F, 0x10, 0xBD, 0x9F, 0x10, 0x4A, 0x20, 0x2E, 0x2E, 0x6E, 0x98, 0x9D, 0x2A, 0x2A, 0x90, 0x90, 0x90, 0xC0, 0xC0, 0xC0, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x90, 0x66, 0x90, 0x66, 0x4F, 0x90, 0x66, 0x37, 0xCB, 0xCB, 0xCB, 0x37, 0xCB, 0xCB, 0xCB, 0xCB, 0xCC, 0x55, 0x2C, 0x67, 0x49, 0x64, 0x49, 0x49,
+	0xDA, 0xC1, 0xC1, 0xF5, 0xC1, 0xF5, 0xC1, 0xDA, 0xDA, 0xDA, 0x29, 0xBB, 0x02, 0x16, 0x8E, 0x15, 0xC2, 0x0B, 0xC7, 0x24, 0xE4, 0x24, 0xE4, 0xE4, 0x80, 0xE4, 0xE4, 0x24, 0x0B, 0x0B, 0xC2, 0x0D, 0x16, 0x52, 0x52, 0x02, 0x52, 0x6F, 0x6F, 0xDA, 0xDA, 0x16, 0xC1, 0x8E, 0x16, 0xC1, 0x16, 0x16, 0x16, 0x5D, 0x16, 0x5D, 0x16, 0x5D, 0xA8, 0xF6, 0xEB, 0xF3, 0x54, 0x4D, 0xBF, 0xC7, 0xFD, 0x71, 0xFD, 0x93, 0xD0, 0xD0, 0x1A, 0x1F, 0x42, 0xD6, 0x33, 0x10, 0xBD, 0x10, 0xBD, 0xE1, 0x51, 0x51, 0xBD, 0x7C, 0x7C, 0x51, 0x1B, 0x6D, 0x04, 0x31, 0xE1, 0xBD, 0x83, 0x1B, 0x10, 0x3B, 0x83, 0xBD, 0x1B, 0x51, 0xBD, 0xFB, 0x45, 0xBD, 0xBD, 0x45, 0x04, 0x83, 0x45, 0x86, 0x3A, 0xD7, 0x1C, 0x5E, 0x6E, 0x32, 0x36, 0x37, 0xF2, 0xBE, 0xAE, 0xAE, 0x3D, 0x34, 0x05, 0xAE, 0x32, 0x42, 0xAF, 0x16, 0x6F, 0xC1, 0xBB, 0xED, 0x52, 0xBB, 0x09, 0x6B, 0x33, 0x6F, 0xFE, 0x6B, 0xBB, 0xF8, 0xC1, 0xF8, 0xF8, 0x8E, 0x40, 0x0D, 0x96, 0xFD, 0xBF, 0xBF, 0xC7, 0xCA, 0x93, 0xD2, 0xE8, 0xF2, 0xE2, 0xD2, 0xD2, 0x93, 0x93, 0x4D, 0x54, 0xF8, 0xF4, 0x52, 0x52, 0xEE, 0x99, 0xEE, 0x6B, 0x6B, 0x6B, 0x8D, 0x12, 0x4B, 0xC3, 0xE5, 0x81, 0x12, 0xCD, 0x1C, 0x46, 0x70, 0x18, 0x10, 0xC3, 0x8D, 0x26, 0x8D, 0x26, 0xCD, 0x73, 0xB4, 0xB4, 0x68, 0x68, 0x68, 0x10, 0x97, 0x82, 0x33, 0x8B, 0x2E, 0x54, 0xB8, 0x85, 0x9C, 0x2A, 0xC0, 0x90, 0x90, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x53, 0xC0, 0x66, 0x90, 0x66, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x66, 0x66, 0x90, 0x4F, 0x4F, 0x90, 0x4F, 0x4F, 0x37, 0xCB, 0x37, 0x4F, 0xCB, 0x55, 0x55, 0x8C, 0x55, 0x8C, 0x8C, 0x8C, 0x2C, 0x48, 0x64, 0x49,
+	0xDA, 0xC1, 0xC1, 0xDA, 0xC1, 0xC1, 0xDA, 0xC1, 0xDA, 0xDA, 0x6F, 0x02, 0x02, 0x16, 0x8E, 0x15, 0x08, 0xC2, 0x24, 0x24, 0x24, 0xE4, 0xE4, 0x80, 0xE4, 0xE4, 0xE4, 0x24, 0xC7, 0xC2, 0xC2, 0xC8, 0x16, 0x02, 0xED, 0x02, 0x52, 0x6F, 0x6F, 0x6F, 0x16, 0x16, 0x16, 0xC1, 0x16, 0x16, 0x16, 0x16, 0x02, 0x8E, 0x16, 0x16, 0x29, 0x29, 0x29, 0x3C, 0xE7, 0xCA, 0xBF, 0x4D, 0x4D, 0xFD, 0xC7, 0xFD, 0xFD, 0x0B, 0x40, 0x85, 0xD0, 0x20, 0xE5, 0x81, 0xFB, 0x04, 0x9F, 0xE1, 0x7C, 0x51, 0x7E, 0x1B, 0x0E, 0x1B, 0x7C, 0x51, 0x7C, 0x3B, 0x04, 0x4A, 0xE1, 0x10, 0x3B, 0x1B, 0x10, 0x3B, 0x3B, 0x83, 0xC9, 0x51, 0x60, 0x9F, 0xFB, 0xFB, 0x04, 0x45, 0x83, 0x45, 0xF9, 0xFA, 0x3A, 0x47, 0x48, 0xF4, 0xE8, 0x93, 0x5F, 0x3D, 0xBE, 0xAE, 0xAE, 0xBE, 0xC6, 0x38, 0xAE, 0x5F, 0x5C, 0x4C, 0xBB, 0x02, 0xEE, 0x99, 0x99, 0xEE, 0x72, 0xFE, 0x9E, 0xC3, 0x9E, 0x86, 0x09, 0xFE, 0x72, 0x6B, 0xDA, 0x13, 0x96, 0x96, 0xC8, 0x96, 0x96, 0x71, 0xBF, 0xBF, 0xBF, 0xCA, 0x93, 0xD2, 0x32, 0xE2, 0xE2, 0xE8, 0xD2, 0x32, 0x54, 0x87, 0x6F, 0xEE, 0xEE, 0x99, 0xFE, 0x09, 0xFE, 0x9E, 0x99, 0x8D, 0x8D, 0x8D, 0x9E, 0x4B, 0x86, 0xE5, 0xE5, 0x8D, 0xBD, 0x1F, 0x89, 0x70, 0x5E, 0x26, 0x73, 0xA3, 0x26, 0xCD, 0x4B, 0x73, 0xB4, 0xB4, 0x68, 0x68, 0x68, 0x9F, 0xBD, 0xF9, 0xC3, 0x8F, 0x70, 0x2E, 0x58, 0xE7, 0x9D, 0x79, 0x2A, 0x90, 0xC0, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x66, 0x90, 0x55, 0x90, 0x90, 0x90, 0x90, 0x90, 0x66, 0x90, 0x66, 0x4F, 0x66, 0x4F, 0x66, 0x90, 0x55, 0xCB, 0xCB, 0xCB, 0xCB, 0x55, 0x55, 0x55, 0x55, 0x55, 0x8C, 0x8C, 0x8C, 0x2E, 0x1F, 0x64, 0x49,
+	0x16, 0xDA, 0xC1, 0x16, 0x16, 0x16, 0xDA, 0x29, 0xDA, 0xDA, 0x6F, 0x02, 0x02, 0x02, 0x8E, 0x15, 0xC2, 0xC2, 0xC7, 0x24, 0x24, 0xE4, 0x24, 0x80, 0xE4, 0xE4, 0xE4, 0x24, 0xC7, 0x0B, 0x08, 0xC8, 0x29, 0x02, 0xED, 0x02, 0x52, 0xBB, 0x6F, 0xBB, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x16, 0x16, 0xDA, 0x8E, 0x6F, 0x16, 0x16, 0x02, 0x29, 0x6E, 0xDB, 0xD2, 0x7F, 0x3C, 0xDD, 0xFD, 0xFD, 0xFD, 0xBF, 0xC7, 0x71, 0xF4, 0x99, 0x07, 0x33, 0x9A, 0xB7, 0x00, 0x4A, 0x7E, 0x1B, 0xE1, 0x7E, 0x51, 0x51, 0x31, 0x7C, 0x1B, 0x50, 0x7C, 0x3B, 0x04, 0xE1, 0xBD, 0x4A, 0x45, 0x60, 0x4A, 0x83, 0xFB, 0x3B, 0x6D, 0x25, 0x75, 0x7E, 0x4A, 0x83, 0x3B, 0xBD, 0xBD, 0x83, 0x81, 0x00, 0x33, 0x2F, 0xA6, 0xCB, 0x32, 0xA2, 0x5F, 0xF2, 0x7B, 0xAE, 0xF0, 0xF2, 0x59, 0x05, 0xF2, 0x5C, 0x72, 0xAF, 0x4C, 0x72, 0x72, 0x99, 0x09, 0x99, 0xC3, 0x99, 0x9A, 0x9A, 0x8D, 0x8D, 0x73, 0x6C, 0x09, 0xFE, 0x99, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0x93, 0xD2, 0x57, 0x77, 0xD2, 0x91, 0x32, 0x06, 0x07, 0xA3, 0x72, 0xC4, 0x09, 0x9E, 0x4B, 0xFE, 0x09, 0xFE, 0x99, 0x9E, 0x99, 0x9E, 0x9E, 0x9E, 0x81, 0x81, 0x3A, 0x8D, 0x3F, 0x1F, 0x89, 0x70, 0x20, 0xD7, 0xA3, 0xA3, 0x26, 0xCD, 0x4B, 0x73, 0xB4, 0xB4, 0x68, 0x9F, 0x9F, 0x10, 0xBD, 0xF9, 0x3F, 0x5E, 0x48, 0x17, 0xFC, 0x84, 0x66, 0x90, 0x2A, 0x90, 0xC0, 0x90, 0xC0, 0x79, 0x79, 0x90, 0x79, 0xC0, 0xC0, 0xC0, 0xC0, 0x90, 0x90, 0x66, 0x90, 0x90, 0x90, 0x90, 0x90, 0x66, 0x90, 0x4F, 0x66, 0x90, 0x90, 0x90, 0x55, 0x55, 0xCB, 0xCB, 0x55, 0xCB, 0x55, 0x55, 0x8C, 0x67, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0xAC, 0x1F, 0xAC,
+	0x16, 0x16, 0x29, 0x16, 0x29, 0x16, 0x29, 0x6F, 0xDA, 0x6F, 0x6F, 0x02, 0x4C, 0x02, 0x8E, 0xC8, 0xC2, 0xC2, 0x24, 0x24, 0xE4, 0x24, 0xE4, 0xB1, 0xE4, 0xE4, 0xE4, 0xE4, 0xC7, 0xFD, 0x08, 0xC8, 0x16, 0x52, 0xED, 0x02, 0x52, 0xBB, 0x6F, 0x6F, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xDA, 0x16, 0xC1, 0x16, 0xC1, 0xBB, 0xED, 0xA9, 0x92, 0x7F, 0xD2, 0x2B, 0x3C, 0x2B, 0x2B, 0xBF, 0x71, 0x71, 0x4D, 0xEB, 0x07, 0xA3, 0x14, 0xC3, 0xF9, 0x6D, 0xD6, 0x7E, 0x60, 0x04, 0x51, 0x51, 0x04, 0x7C, 0x1B, 0x7C, 0x1B, 0xEF, 0x31, 0x6D, 0x04, 0xD6, 0x83, 0x4A, 0x10, 0x51, 0x12, 0x83, 0x04, 0x83, 0x04, 0x3B, 0xD6, 0x7D, 0x35, 0xD6, 0x10, 0x3B, 0x83, 0xB7, 0xE5, 0xC3, 0x13, 0x8B, 0x01, 0xD2, 0xD1, 0x36, 0x3D, 0x5F, 0xF1, 0x77, 0x0A, 0xC6, 0xC6, 0xF2, 0x01, 0x4C, 0x4C, 0x4C, 0xC4, 0xC3, 0xE5, 0x14, 0xC3, 0x09, 0xFE, 0x9A, 0xC3, 0x12, 0x75, 0x8A, 0x20, 0xA3, 0x09, 0x09, 0x09, 0x99, 0x8E, 0x71, 0x96, 0x96, 0x96, 0x4D, 0x71, 0x71, 0xBF, 0xCA, 0x93, 0xD2, 0x77, 0x77, 0xE2, 0xD5, 0x06, 0x8D, 0x14, 0x72, 0x73, 0x26, 0x8D, 0x33, 0x7D, 0x18, 0x9A, 0x09, 0xFE, 0x9E, 0x9E, 0x9E, 0x86, 0x86, 0xC3, 0x45, 0x82, 0xD7, 0x86, 0x1F, 0x89, 0x70, 0xE3, 0x12, 0x14, 0x26, 0x8D, 0x4A, 0x4B, 0x73, 0xB5, 0xB4, 0x68, 0xBD, 0xBD, 0x3F, 0xBD, 0x82, 0x26, 0x7D, 0x11, 0x2E, 0x85, 0x9C, 0x53, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0x79, 0x66, 0x79, 0x66, 0x90, 0x66, 0xC0, 0x53, 0xC0, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x66, 0x66, 0x90, 0x4F, 0x66, 0x4F, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0xE0, 0x55, 0x8C, 0x8C, 0x8C, 0x48, 0x67, 0x49, 0x48, 0xAC, 0x1F, 0x49, 0x1F,
+	0x29, 0x16, 0x16, 0x29, 0x6F, 0x16, 0x6F, 0x6F, 0x6F, 0x6F, 0x02, 0x02, 0x4C, 0x02, 0x8E, 0x94, 0xC2, 0x0B, 0x0B, 0x24, 0xE4, 0xE4, 0xE4, 0xE4, 0x80, 0x80, 0xE4, 0x24, 0x0B, 0xFD, 0x08, 0x94, 0x16, 0x02, 0xED, 0x6B, 0x02, 0x6F, 0x6F, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x29, 0x6F, 0x16, 0xBB, 0x02, 0x6F, 0x17, 0x32, 0xE2, 0x1E, 0x3C, 0x3C, 0x2B, 0x2B, 0xC7, 0xDD, 0xF3, 0x87, 0x2E, 0x8F, 0xD7, 0x82, 0xE5, 0x83, 0xBD, 0x7E, 0x60, 0x6D, 0xC9, 0x51, 0x04, 0x04, 0xC9, 0x7E, 0x51, 0x51, 0x75, 0x04, 0x3B, 0xBD, 0x0E, 0x83, 0x9F, 0xBD, 0xE1, 0x60, 0x45, 0x04, 0x45, 0xBD, 0x83, 0x45, 0x4A, 0x9F, 0x4A, 0xE1, 0xBD, 0x6D, 0x45, 0x00, 0x7D, 0x13, 0x8F, 0x7A, 0x89, 0x36, 0xF2, 0x5F, 0x3D, 0xF0, 0x1D, 0xC6, 0xF1, 0xF2, 0xFC, 0x4C, 0xAF, 0x52, 0x72, 0xC3, 0x73, 0x4B, 0xA3, 0x14, 0x4B, 0x3A, 0xE5, 0x12, 0x12, 0x46, 0x91, 0x8A, 0x13, 0xA3, 0x72, 0xED, 0x4C, 0x8E, 0x96, 0x96, 0x96, 0x96, 0x96, 0x06, 0x71, 0xBF, 0xBF, 0x93, 0x32, 0x77, 0x77, 0x91, 0x78, 0x8F, 0x09, 0xC4, 0xB5, 0xB4, 0xCD, 0xBC, 0x35, 0x46, 0x1F, 0x52, 0xE5, 0x72, 0xFE, 0x99, 0x9E, 0xC3, 0x86, 0x81, 0x81, 0xE5, 0x26, 0x81, 0x7D, 0x89, 0x70, 0x33, 0x8F, 0x26, 0x26, 0x12, 0x4B, 0x4B, 0x73, 0xB5, 0xB4, 0xBD, 0x68, 0xBD, 0xBD, 0xB4, 0x73, 0x8F, 0x70, 0x11, 0xE0, 0x84, 0x9C, 0x2A, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0x79, 0x66, 0x90, 0x79, 0x66, 0x79, 0x66, 0x79, 0x90, 0x66, 0x79, 0x66, 0x90, 0x66, 0x66, 0x79, 0x90, 0x66, 0x79, 0x66, 0x4F, 0x4F, 0x4F, 0x55, 0x55, 0x66, 0x55, 0x55, 0x55, 0x67, 0x8C, 0x64, 0x8C, 0x64, 0x49, 0x64, 0x49, 0x48, 0x49, 0x49, 0x47,
+	0xDA, 0xDA, 0x16, 0x16, 0x16, 0x16, 0x16, 0x6F, 0x6F, 0x6F, 0x02, 0x02, 0x4C, 0x02, 0x8E, 0x96, 0xC2, 0xC2, 0x24, 0x24, 0xE4, 0xE4, 0xE4, 0x39, 0x80, 0xE4, 0xE4, 0xE4, 0x0B, 0xFD, 0xC2, 0x94, 0x29, 0xED, 0xED, 0x02, 0x6F, 0x6F, 0x16, 0x16, 0x6F, 0x16, 0x16, 0x16, 0x16, 0x16, 0x29, 0xC1, 0x16, 0x6F, 0x6F, 0xBB, 0x6B, 0xEA, 0x89, 0x93, 0x7F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x06, 0xA8, 0x1A, 0x42, 0xC3, 0x26, 0xF9, 0x45, 0xE1, 0x51, 0x4A, 0xBD, 0x0E, 0x51, 0xC9, 0x6D, 0x0E, 0x31, 0x7E, 0x7C, 0x51, 0x51, 0x0E, 0x04, 0x04, 0x04, 0x04, 0x83, 0x83, 0x10, 0x75, 0x10, 0x04, 0x83, 0x6D, 0x86, 0xBD, 0xBD, 0x6D, 0xFB, 0xD6, 0xBD, 0x45, 0x10, 0x8D, 0x1C, 0xA6, 0xE0, 0x91, 0x7F, 0x5F, 0x3D, 0x3D, 0xC5, 0xAE, 0xC6, 0xD5, 0xE2, 0x58, 0xAF, 0x16, 0xED, 0x99, 0x99, 0x3A, 0x10, 0x18, 0x33, 0x9E, 0x18, 0x10, 0x86, 0x1B, 0xB4, 0xD8, 0xF7, 0x91, 0x91, 0x70, 0x8D, 0xF4, 0xEA, 0x16, 0x8E, 0xC8, 0x8E, 0x96, 0x96, 0x71, 0x71, 0xBF, 0xCA, 0x93, 0x32, 0xD5, 0x95, 0x32, 0xEB, 0x8D, 0xFE, 0x26, 0x3F, 0xE6, 0x10, 0x35, 0x1B, 0x89, 0x1C, 0x20, 0x9E, 0xFE, 0x09, 0xE5, 0x73, 0x86, 0x86, 0xFE, 0x45, 0x82, 0xD7, 0x45, 0x7D, 0x89, 0x2C, 0x33, 0xE3, 0x26, 0xD7, 0x26, 0xCD, 0x73, 0x73, 0xB4, 0x73, 0xBD, 0x68, 0xB4, 0x81, 0xB4, 0x26, 0x18, 0x48, 0x11, 0x58, 0x85, 0x79, 0x2A, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x90, 0x79, 0x66, 0x66, 0x79, 0x66, 0x79, 0x66, 0x79, 0x66, 0x79, 0x66, 0x79, 0x66, 0x79, 0x66, 0x79, 0x66, 0x79, 0x66, 0x66, 0x90, 0x66, 0x66, 0x55, 0x55, 0x66, 0x55, 0x8C, 0x8C, 0x8C, 0x48, 0x48, 0x49, 0x48, 0x49, 0x70, 0x47, 0x47, 0x47, 0x64,
+	0xC1, 0xC1, 0xDA, 0x16, 0x6F, 0x16, 0x16, 0x6F, 0x6F, 0xBB, 0xBB, 0xAF, 0x02, 0x02, 0x8E, 0xE9, 0xC2, 0xC2, 0x24, 0x24, 0xE4, 0xE4, 0xB1, 0x80, 0xB1, 0x80, 0xE4, 0xE4, 0xC7, 0x0B, 0x08, 0x94, 0x16, 0x02, 0x02, 0x02, 0xBB, 0x6F, 0xC1, 0x16, 0x8E, 0x16, 0x8E, 0x16, 0x16, 0x16, 0xDA, 0xC1, 0xBB, 0x16, 0xC1, 0x6F, 0xFE, 0x6F, 0x89, 0xA8, 0x3C, 0x80, 0xB1, 0x2B, 0x84, 0x9C, 0x17, 0x07, 0x20, 0x12, 0xF9, 0x83, 0x6D, 0xE1, 0x51, 0x12, 0x3B, 0xC9, 0x31, 0x0E, 0x25, 0xC9, 0x3B, 0x7C, 0x7E, 0x7C, 0x51, 0x7E, 0x0E, 0x04, 0x04, 0x04, 0x45, 0x04, 0x83, 0x45, 0x7E, 0x12, 0x83, 0x83, 0x81, 0x81, 0x83, 0x68, 0xBD, 0x83, 0x83, 0xFB, 0x83, 0x9F, 0x35, 0xA6, 0x5C, 0x7A, 0xA4, 0x66, 0x36, 0x5F, 0xBE, 0x1D, 0xC6, 0xC5, 0x32, 0x0F, 0xBB, 0x3E, 0x8E, 0x6F, 0xED, 0x6B, 0x86, 0x9A, 0x18, 0xEB, 0x8D, 0x12, 0x12, 0x8D, 0xD6, 0x26, 0x56, 0xF7, 0x95, 0x91, 0x89, 0x41, 0xBB, 0x3E, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0x96, 0x96, 0x71, 0xBF, 0xD0, 0xD2, 0x32, 0xD5, 0x95, 0xA4, 0x8F, 0x07, 0x8D, 0x20, 0x12, 0xD6, 0xE3, 0x10, 0x20, 0x8A, 0x30, 0x42, 0x8D, 0x99, 0xC4, 0x3A, 0x73, 0x73, 0x81, 0x81, 0x86, 0x86, 0x12, 0xB4, 0x35, 0x89, 0xCC, 0xE3, 0x33, 0x12, 0x12, 0x4B, 0x10, 0x73, 0x73, 0x45, 0x3F, 0x10, 0x3F, 0xB4, 0x81, 0xB5, 0x12, 0x47, 0x2E, 0x2E, 0x58, 0x9D, 0xCE, 0x2A, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0xC0, 0xC0, 0x66, 0x66, 0x90, 0x66, 0x66, 0x90, 0x79, 0x66, 0x79, 0x66, 0x90, 0x79, 0x66, 0xDC, 0x90, 0xDC, 0x66, 0x79, 0x79, 0x66, 0x67, 0x55, 0x55, 0xE0, 0x55, 0x67, 0x8C, 0x64, 0x8C, 0x8B, 0x64, 0x49, 0x8B, 0x47, 0x47, 0x47, 0x64, 0x64, 0x67, 0x8C,
+	0xC1, 0xDA, 0xC1, 0x16, 0x16, 0xDA, 0x16, 0x29, 0x6F, 0x6F, 0x02, 0xED, 0x4C, 0x02, 0x5D, 0xC8, 0xC2, 0x0B, 0xC7, 0xE4, 0xE4, 0xE4, 0x80, 0x80, 0x80, 0xB1, 0xE4, 0xE4, 0xC7, 0xFD, 0x08, 0xC8, 0x16, 0x02, 0x02, 0x02, 0xBB, 0x6F, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x8E, 0x16, 0xF5, 0xC1, 0xA8, 0x6A, 0xC1, 0xEE, 0x9E, 0x09, 0xE5, 0x13, 0xB9, 0x01, 0x36, 0xD9, 0xE2, 0xD2, 0x0F, 0xA3, 0x3A, 0xF9, 0xE6, 0xFB, 0x83, 0x25, 0x1B, 0x31, 0x0E, 0x0E, 0x25, 0xC9, 0xC9, 0x25, 0xC9, 0xC9, 0x51, 0x19, 0x51, 0x50, 0xAD, 0x04, 0x3B, 0xBD, 0xBD, 0x0E, 0xBD, 0x83, 0xFB, 0x1B, 0x12, 0x83, 0xBD, 0x45, 0x81, 0xBD, 0xB4, 0xE6, 0x97, 0xFB, 0x81, 0xB7, 0x26, 0x70, 0xD7, 0xAC, 0x36, 0xCB, 0x37, 0x36, 0xF1, 0xF0, 0xAE, 0x1D, 0xE2, 0x0F, 0xA8, 0x3E, 0xF8, 0xF8, 0xF8, 0xEA, 0x6F, 0x99, 0x99, 0x6F, 0xF8, 0xEA, 0x6B, 0x9E, 0x26, 0x26, 0x63, 0xA0, 0xF7, 0xF7, 0x91, 0x89, 0x17, 0x16, 0x40, 0x8E, 0x8E, 0xC8, 0x8E, 0xC8, 0x96, 0x96, 0x71, 0xBF, 0xD0, 0xD2, 0x91, 0x95, 0x77, 0x54, 0xA8, 0x17, 0x7D, 0x8D, 0xE3, 0x60, 0xD6, 0xD6, 0xDE, 0x8A, 0x21, 0xEA, 0x9E, 0x99, 0x09, 0x3A, 0x82, 0x82, 0x82, 0x81, 0xE5, 0x86, 0x12, 0xB2, 0x35, 0x89, 0x76, 0x33, 0x12, 0xD7, 0x8F, 0x26, 0xCD, 0x3F, 0x73, 0xB4, 0xCD, 0x9F, 0xCD, 0x45, 0xB5, 0xB2, 0x33, 0x70, 0x11, 0x2E, 0x58, 0x9C, 0xCE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x4F, 0x66, 0x79, 0x79, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x79, 0x90, 0x2B, 0x66, 0x66, 0xDC, 0x90, 0xDC, 0x66, 0x66, 0x79, 0x9D, 0x55, 0x66, 0x55, 0xE0, 0xE0, 0x8C, 0x8C, 0x48, 0x64, 0x49, 0x48, 0x49, 0x47, 0x8B, 0xB8, 0xB8, 0x64, 0x8C, 0x37, 0x34,
+	0x16, 0xDA, 0x16, 0x29, 0x16, 0x29, 0x16, 0x6F, 0x07, 0x6F, 0xBB, 0x02, 0x4C, 0x02, 0x8E, 0x6A, 0xC2, 0xC2, 0xC7, 0x24, 0xE4, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0xE4, 0x24, 0xC2, 0x08, 0x94, 0x5D, 0xBB, 0x02, 0xBB, 0x6F, 0x16, 0xC1, 0x16, 0x8E, 0x16, 0x8E, 0x16, 0xF5, 0xC1, 0xF3, 0x6F, 0xA8, 0x99, 0x99, 0x99, 0x8D, 0x8F, 0x2E, 0xD1, 0x37, 0xA5, 0x95, 0xA1, 0x57, 0xD7, 0x26, 0x45, 0x04, 0x04, 0x6D, 0xC9, 0x51, 0x1B, 0xE1, 0x31, 0xC9, 0x0E, 0x1B, 0x25, 0x7C, 0x1B, 0x31, 0x51, 0x7E, 0x7C, 0xAD, 0x50, 0x0E, 0x04, 0x04, 0x04, 0xC9, 0x04, 0x83, 0x45, 0x10, 0xBD, 0xBD, 0x10, 0x45, 0xF9, 0x86, 0xB4, 0x83, 0x83, 0xB7, 0x81, 0x10, 0x1F, 0xA6, 0xBA, 0x32, 0x55, 0x36, 0xF2, 0xF1, 0xC5, 0xC6, 0xFF, 0xE2, 0x55, 0x5C, 0x40, 0x40, 0xC8, 0x96, 0x96, 0xF8, 0xF8, 0x6F, 0x6B, 0xDA, 0xF8, 0xF8, 0x7D, 0x41, 0xA6, 0xD4, 0x23, 0x91, 0xF7, 0x91, 0x8A, 0x21, 0x96, 0x96, 0xC8, 0x96, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x4D, 0xBF, 0xCA, 0x32, 0x95, 0x95, 0xE2, 0x85, 0x8F, 0xEB, 0x13, 0x7D, 0x12, 0x33, 0xA6, 0x2C, 0x89, 0x89, 0x13, 0x41, 0x6B, 0x99, 0xFE, 0xC3, 0x73, 0x73, 0x82, 0x86, 0x45, 0x73, 0x12, 0xFA, 0x20, 0x89, 0x76, 0xE3, 0x26, 0xE3, 0x33, 0x4B, 0xB4, 0x82, 0x73, 0xBD, 0x81, 0xCD, 0xCD, 0x82, 0x82, 0x73, 0x20, 0x48, 0x2E, 0x58, 0xFC, 0x79, 0xA2, 0xC0, 0x90, 0xC0, 0x90, 0xC0, 0x4F, 0x66, 0x4F, 0x79, 0x66, 0x79, 0x79, 0x90, 0x4F, 0x79, 0x66, 0x79, 0x66, 0x66, 0x90, 0x90, 0x79, 0x66, 0x79, 0x66, 0x66, 0x79, 0x67, 0xE0, 0xCE, 0xE0, 0x9D, 0x8C, 0x48, 0x58, 0x48, 0x64, 0x49, 0x8B, 0xB8, 0xB8, 0x64, 0x67, 0x55, 0x37, 0x36, 0x5F, 0x59,
+	0xDA, 0xC1, 0x29, 0x16, 0xA8, 0xC1, 0x29, 0x6F, 0x6F, 0x6F, 0x02, 0x02, 0x4C, 0x02, 0x8E, 0x6A, 0xC2, 0xFD, 0x24, 0xE4, 0xE4, 0x80, 0x80, 0xB1, 0x80, 0xB1, 0xE4, 0xE4, 0x24, 0xFD, 0xC2, 0x94, 0x4E, 0x6F, 0x02, 0x02, 0x6F, 0x6F, 0xC1, 0x16, 0x8E, 0x8E, 0x8E, 0x4E, 0x3E, 0x6A, 0x4C, 0x4C, 0x72, 0x72, 0x5C, 0x42, 0x70, 0x22, 0x89, 0x7B, 0x37, 0x77, 0x77, 0x64, 0xA3, 0xB6, 0x1B, 0xC9, 0x3B, 0x0E, 0x7C, 0x50, 0x7E, 0x51, 0xC9, 0x0E, 0x3B, 0x31, 0x4A, 0xE1, 0x1B, 0x7C, 0x7C, 0xAD, 0x50, 0x7C, 0xAD, 0xEC, 0x1B, 0x0E, 0x9F, 0x04, 0x45, 0x83, 0xF9, 0x81, 0xBD, 0xBD, 0xBD, 0x10, 0x45, 0xB4, 0xB4, 0xBD, 0xFB, 0xF9, 0xF9, 0xFA, 0xA6, 0xBC, 0x5C, 0x34, 0xE8, 0x34, 0x61, 0x5F, 0xC5, 0xFF, 0xF0, 0xE2, 0x8B, 0xA8, 0xE7, 0x40, 0x40, 0x96, 0x96, 0x71, 0x06, 0xF8, 0xF8, 0xC1, 0x6F, 0xEA, 0xF8, 0x96, 0x13, 0x13, 0x46, 0x46, 0x57, 0x89, 0x8A, 0x89, 0xCA, 0x06, 0x71, 0xEA, 0x96, 0x96, 0x8E, 0xC8, 0x96, 0x96, 0x96, 0x96, 0xBF, 0xD0, 0x32, 0xD5, 0x95, 0xF1, 0x58, 0xA8, 0xDA, 0xEB, 0x17, 0x13, 0x13, 0x2F, 0x89, 0x89, 0x21, 0xF8, 0x52, 0x99, 0x99, 0x6B, 0x9E, 0x9A, 0x9E, 0x81, 0xBD, 0xCD, 0x4B, 0x12, 0xB2, 0xE3, 0x46, 0xD4, 0xA6, 0x12, 0xE3, 0xD7, 0x26, 0xBD, 0xB4, 0xB4, 0xB4, 0x82, 0x9F, 0xCD, 0x82, 0x73, 0x26, 0x5E, 0x1F, 0xE0, 0x58, 0x84, 0x66, 0x2A, 0xC0, 0x90, 0xC0, 0x4F, 0x66, 0x4F, 0x53, 0x4F, 0x66, 0x79, 0x66, 0x66, 0x2A, 0x90, 0x66, 0x90, 0x66, 0x79, 0x66, 0x90, 0x90, 0xDC, 0x66, 0x79, 0x90, 0x66, 0x66, 0x9C, 0xE0, 0xE0, 0xE0, 0x8C, 0x8B, 0x48, 0x1F, 0x8C, 0x8B, 0xB8, 0x64, 0x64, 0x8C, 0x55, 0x34, 0x36, 0x59, 0x36, 0x59, 0x59,
+	0xC1, 0xC1, 0xF5, 0xC1, 0xDA, 0xC1, 0x16, 0x6F, 0x6F, 0x6F, 0x52, 0x02, 0x4C, 0x02, 0x16, 0xE9, 0x08, 0xFD, 0xC7, 0x24, 0xE4, 0x80, 0x80, 0xB1, 0x80, 0x80, 0xB1, 0xE4, 0xC7, 0x0B, 0x08, 0x94, 0x4E, 0xBB, 0x02, 0xBB, 0x6F, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x65, 0x8E, 0x40, 0x4D, 0x72, 0x09, 0x72, 0xAF, 0x70, 0x2F, 0x1C, 0x1F, 0xD8, 0x44, 0x57, 0x76, 0x8F, 0xB6, 0xB7, 0x04, 0x7C, 0x7E, 0x7C, 0x51, 0x7E, 0x7C, 0x51, 0x7C, 0x04, 0x6D, 0x3B, 0x1B, 0xC9, 0xE1, 0x1B, 0x31, 0x7C, 0x51, 0x43, 0x31, 0x50, 0x19, 0x1B, 0xC9, 0xB0, 0x04, 0xE6, 0x83, 0x83, 0x81, 0x45, 0xBD, 0x86, 0xBD, 0xB4, 0x68, 0xB4, 0x81, 0xF9, 0xB7, 0x00, 0x8D, 0x1C, 0xE3, 0xB8, 0x91, 0x36, 0x5F, 0xF1, 0xF1, 0xC6, 0xFF, 0x77, 0x58, 0x6F, 0xF4, 0x6A, 0x6A, 0x96, 0x96, 0x71, 0x71, 0xBF, 0x71, 0x96, 0x96, 0xF8, 0xF8, 0xEA, 0xEA, 0xF8, 0xF8, 0x17, 0x17, 0x17, 0xCC, 0x0F, 0x78, 0xD0, 0xD0, 0xD0, 0x71, 0x96, 0x96, 0xC8, 0xC8, 0x96, 0xC8, 0x96, 0x71, 0xBF, 0xCA, 0x89, 0x95, 0x95, 0x77, 0x61, 0x1A, 0x06, 0xF8, 0x06, 0x17, 0x85, 0x2E, 0x13, 0x7D, 0x41, 0xBB, 0xED, 0x4C, 0x6B, 0x52, 0x6B, 0x9E, 0x9A, 0x81, 0x10, 0xBD, 0x26, 0x26, 0xB5, 0xE3, 0x56, 0x88, 0x03, 0xD7, 0xE3, 0x12, 0xCD, 0x3F, 0x3F, 0xB4, 0x81, 0xB4, 0xCD, 0xCD, 0xC3, 0xA3, 0x33, 0x47, 0x2E, 0x58, 0x85, 0x9C, 0xCF, 0xC0, 0x90, 0xC0, 0x4F, 0x4F, 0x53, 0x4F, 0x4F, 0x66, 0x9C, 0x66, 0x79, 0x90, 0x2A, 0x2A, 0x4F, 0x66, 0x66, 0x90, 0x66, 0x66, 0x90, 0x66, 0x66, 0x66, 0x9C, 0x66, 0xE0, 0x9C, 0x58, 0x58, 0x67, 0x48, 0x49, 0x64, 0x8C, 0x64, 0x8B, 0x64, 0x67, 0x55, 0x36, 0x36, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+	0xC1, 0xC1, 0xC1, 0xC1, 0xA8, 0xC1, 0x29, 0x6F, 0xBB, 0x6F, 0x52, 0x02, 0x4C, 0x02, 0x16, 0x96, 0xC2, 0xFD, 0xC7, 0xE4, 0xE4, 0x80, 0x80, 0xB1, 0xB1, 0x80, 0x80, 0xE4, 0x24, 0xFD, 0x08, 0x94, 0x4E, 0xBB, 0x02, 0xBB, 0x16, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x94, 0x5D, 0x3E, 0x4D, 0x72, 0x72, 0x29, 0x58, 0x2F, 0x21, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xD6, 0xB4, 0x26, 0xB6, 0x0E, 0x31, 0x51, 0x50, 0x7C, 0x0E, 0x7C, 0x51, 0x04, 0x0E, 0x0E, 0x04, 0x51, 0xE1, 0x31, 0x60, 0x0E, 0x31, 0xAD, 0x19, 0xAD, 0x50, 0x7E, 0x7C, 0x7E, 0xD6, 0xB6, 0x04, 0x97, 0x81, 0x81, 0x45, 0xBD, 0xBD, 0x81, 0x68, 0xB4, 0xBD, 0x6D, 0x81, 0x3A, 0x6C, 0x42, 0x48, 0x5C, 0x36, 0x3D, 0x37, 0x5F, 0xBE, 0xC5, 0xF0, 0xF0, 0x67, 0x29, 0xF4, 0xE9, 0xF8, 0x4D, 0x4D, 0x4D, 0x71, 0x71, 0x71, 0x71, 0x71, 0x13, 0x96, 0xF8, 0x96, 0xEA, 0x8E, 0xC1, 0xF8, 0xF8, 0xF4, 0x87, 0x98, 0x0F, 0xD0, 0xBF, 0xBF, 0x71, 0x96, 0x96, 0x96, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x71, 0xD0, 0x32, 0x95, 0xA1, 0xF0, 0x7A, 0x0F, 0xCA, 0x4D, 0x17, 0xF8, 0x41, 0x42, 0x87, 0x6F, 0x4C, 0x4C, 0xED, 0x02, 0xBB, 0x52, 0x99, 0x99, 0x86, 0x82, 0x4B, 0x86, 0xD7, 0x26, 0xB5, 0x33, 0x2F, 0x89, 0x49, 0x33, 0x8F, 0x12, 0x14, 0x9F, 0x3F, 0xB4, 0xB4, 0x3F, 0x4B, 0x73, 0xB5, 0xD7, 0xA6, 0x70, 0x17, 0x8B, 0xFC, 0xCE, 0xC0, 0x90, 0x90, 0xC0, 0x90, 0x66, 0x4F, 0x66, 0x4F, 0x4F, 0x79, 0x66, 0x66, 0x66, 0x90, 0x4F, 0x79, 0x79, 0x4F, 0x66, 0x90, 0x4F, 0x66, 0x4F, 0x66, 0x53, 0x9C, 0x9C, 0x9C, 0x58, 0x9D, 0x64, 0x58, 0x64, 0x64, 0x8B, 0x8B, 0x64, 0x64, 0x90, 0x37, 0x36, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+	0xC1, 0xA8, 0xC1, 0xA8, 0xC1, 0xDA, 0x29, 0x6F, 0x6F, 0x52, 0x02, 0xED, 0x4C, 0x02, 0x16, 0x6A, 0x08, 0xFD, 0x24, 0x24, 0x39, 0x80, 0x80, 0xB1, 0xB1, 0xB1, 0x1E, 0xE4, 0x24, 0x0B, 0xC2, 0xC8, 0x4E, 0x02, 0x02, 0x02, 0x6F, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0xF3, 0x4D, 0x3E, 0xF6, 0x54, 0x85, 0x17, 0x1C, 0x70, 0x35, 0x12, 0x1B, 0xD6, 0x60, 0x25, 0xB6, 0xB6, 0x04, 0x3B, 0x31, 0xEF, 0x19, 0x7C, 0x19, 0x7E, 0x7C, 0x0E, 0x04, 0x0E, 0xC9, 0x1B, 0x25, 0x51, 0x7C, 0x0E, 0xAD, 0x51, 0x19, 0x19, 0x7E, 0xEF, 0x7E, 0xFB, 0x3B, 0xBD, 0x68, 0xBD, 0x81, 0xB4, 0x45, 0xBD, 0x81, 0x68, 0xB6, 0x68, 0xB7, 0xE5, 0x6C, 0x52, 0x21, 0x5C, 0x6E, 0x92, 0x37, 0x5F, 0x05, 0xBE, 0xE2, 0x77, 0x67, 0xAF, 0x29, 0x40, 0x40, 0x96, 0x71, 0x71, 0x4D, 0x71, 0x06, 0x71, 0x06, 0x71, 0x71, 0xBF, 0x71, 0xF8, 0x96, 0x96, 0x96, 0x71, 0x4D, 0xF8, 0x54, 0x17, 0x06, 0x06, 0xBF, 0xBF, 0x4D, 0xF8, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0xD0, 0x89, 0x95, 0x95, 0xF0, 0xAA, 0x0F, 0x06, 0x54, 0x4D, 0x85, 0x87, 0xF8, 0xF8, 0x3E, 0x02, 0x02, 0x16, 0x6F, 0x6F, 0xBB, 0x6B, 0x99, 0xC3, 0xE5, 0xBD, 0x86, 0x26, 0x26, 0x45, 0x33, 0x76, 0x89, 0x1F, 0x33, 0x26, 0x33, 0xB5, 0x73, 0xCD, 0x81, 0xB4, 0xCD, 0xCD, 0xB5, 0xB2, 0x26, 0xB9, 0x48, 0x48, 0xFC, 0x58, 0x4F, 0x2A, 0xC0, 0x90, 0xC0, 0xC0, 0x4F, 0x66, 0x90, 0x66, 0xCE, 0xCE, 0x90, 0x66, 0x79, 0xCE, 0xCE, 0x9C, 0x66, 0x4F, 0x4F, 0x66, 0xCE, 0xCE, 0xCE, 0xCE, 0xCF, 0x9C, 0x9C, 0x17, 0xE0, 0xE0, 0x48, 0x58, 0x8B, 0x8B, 0x64, 0x64, 0x55, 0x37, 0x5F, 0x59, 0x59, 0x59, 0x59, 0xB1, 0x59, 0x59, 0xB1, 0x59, 0xB1,
+	0xC1, 0xDA, 0x16, 0xDA, 0x16, 0x16, 0x6F, 0x6F, 0xBB, 0x52, 0xBB, 0xED, 0x4C, 0x4C, 0x8E, 0xE9, 0x08, 0xFD, 0xC7, 0x24, 0x80, 0x80, 0x80, 0xB1, 0xB1, 0x80, 0x7F, 0xE4, 0x24, 0x0B, 0xC2, 0xC8, 0x5D, 0x02, 0x02, 0x02, 0x16, 0xBB, 0x16, 0x8E, 0x8E, 0x8E, 0x4E, 0x4E, 0xF6, 0xF8, 0x06, 0x06, 0x78, 0x21, 0x21, 0x70, 0x20, 0xD6, 0x4A, 0x4A, 0x35, 0x25, 0x3B, 0x3B, 0xB6, 0x0E, 0x04, 0x04, 0x31, 0x43, 0x43, 0x19, 0x19, 0x19, 0xC9, 0x0E, 0x04, 0x04, 0x1B, 0x0E, 0x51, 0xAD, 0x7C, 0x7C, 0x31, 0xAD, 0x7E, 0x50, 0x7E, 0xE1, 0xC9, 0x10, 0x04, 0x68, 0x04, 0x81, 0x81, 0xB4, 0x86, 0xBD, 0xB6, 0x68, 0xB6, 0xF9, 0x00, 0xC3, 0x13, 0x85, 0xA8, 0xA7, 0x37, 0x36, 0xF2, 0x05, 0xF0, 0xD5, 0xC0, 0xAF, 0x02, 0x8E, 0x40, 0x96, 0x96, 0x71, 0xBF, 0xBF, 0xFD, 0x06, 0x06, 0xBF, 0x06, 0xBF, 0x06, 0x17, 0x71, 0x71, 0x17, 0x71, 0x13, 0x71, 0x06, 0xCA, 0xCA, 0xD3, 0xCA, 0x0F, 0xCA, 0x06, 0xF8, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0xCA, 0x89, 0x77, 0xA1, 0x95, 0x32, 0x7A, 0xCA, 0xCA, 0x06, 0xF8, 0x4D, 0xDF, 0x6A, 0x96, 0x65, 0x16, 0xC1, 0xC1, 0xC1, 0x6F, 0x6B, 0x99, 0xFE, 0x45, 0x86, 0xBD, 0x26, 0x26, 0x81, 0x33, 0x22, 0x89, 0x1F, 0xE3, 0xD7, 0xD7, 0xB5, 0x73, 0xBD, 0x81, 0xB4, 0xCD, 0x4B, 0xB2, 0x3A, 0x8F, 0x70, 0x58, 0x58, 0x98, 0x9D, 0xC0, 0x90, 0xC0, 0xC0, 0x4F, 0x66, 0x90, 0xCE, 0xCE, 0xCE, 0x53, 0xCE, 0x66, 0xCE, 0x79, 0xCE, 0xCE, 0x79, 0x4F, 0x66, 0xCE, 0x53, 0xCE, 0xCE, 0xCF, 0xCF, 0xE0, 0x9C, 0x9C, 0x8C, 0x48, 0x67, 0x48, 0x8B, 0x64, 0xB8, 0x64, 0x90, 0x36, 0x59, 0x59, 0x1E, 0x59, 0xB1, 0x59, 0x59, 0xB1, 0x59, 0x59, 0x59, 0x59,
+	0xDA, 0xC1, 0xA8, 0x29, 0x29, 0x6F, 0x29, 0x02, 0xBB, 0x52, 0x02, 0xED, 0x4C, 0x4C, 0x16, 0xC8, 0x08, 0xFD, 0xC7, 0x24, 0xE4, 0x80, 0x80, 0xB1, 0x80, 0xB1, 0x1E, 0xE4, 0x24, 0x0B, 0xC2, 0xC8, 0x8E, 0x02, 0x02, 0x02, 0x16, 0x16, 0x16, 0x8E, 0x16, 0x8E, 0x8E, 0x65, 0x5D, 0xEA, 0x06, 0x1A, 0xD0, 0x13, 0x7D, 0x42, 0x8D, 0x9A, 0x26, 0x60, 0x26, 0xD6, 0x04, 0x3B, 0x7C, 0x25, 0x0E, 0x31, 0x31, 0x51, 0xAD, 0x51, 0x51, 0x7C, 0x0E, 0x04, 0x3B, 0xC9, 0xE1, 0xC9, 0xC9, 0x7E, 0x19, 0xB0, 0x51, 0x51, 0x7C, 0x50, 0x25, 0x60, 0xC9, 0x25, 0x45, 0xBD, 0x81, 0x81, 0x81, 0x81, 0x86, 0xBD, 0x83, 0x9F, 0x3B, 0xF9, 0xE5, 0x6F, 0x13, 0x07, 0x6E, 0xD2, 0xDB, 0x3D, 0x3D, 0xF1, 0xD5, 0x5F, 0x4C, 0x5D, 0x29, 0x65, 0x96, 0x96, 0x71, 0x96, 0xBF, 0x71, 0x06, 0xBF, 0xCA, 0x0F, 0xCA, 0xBF, 0x06, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xCA, 0xCA, 0x21, 0xD0, 0x1A, 0x78, 0xD3, 0xCA, 0x1A, 0x4D, 0xF8, 0x96, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0xBF, 0x89, 0x77, 0x95, 0xD5, 0x32, 0x88, 0xD3, 0xCA, 0x06, 0xCA, 0xBF, 0x4D, 0xF8, 0x6A, 0x40, 0x8E, 0x8E, 0xEA, 0xEA, 0xDA, 0x6B, 0x99, 0xFE, 0x86, 0xBD, 0x9E, 0x26, 0x26, 0x82, 0x12, 0x76, 0x89, 0x1C, 0xE3, 0x26, 0xD7, 0xB5, 0xBD, 0xCD, 0x81, 0x73, 0xCD, 0x73, 0xB2, 0xC4, 0xE3, 0x58, 0x48, 0x8B, 0x85, 0xCF, 0xC0, 0xC0, 0x79, 0x4F, 0x66, 0x4F, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0x4F, 0xCE, 0x79, 0xCE, 0xCE, 0x79, 0x4F, 0xCE, 0xCE, 0x55, 0x55, 0xCF, 0xCF, 0xE0, 0x9C, 0x17, 0x58, 0x58, 0x64, 0x58, 0x8B, 0x8B, 0x8B, 0x67, 0x90, 0x5F, 0x59, 0xD2, 0x59, 0x1E, 0x59, 0xA5, 0xB1, 0x59, 0x59, 0x59, 0xB1, 0x59, 0x59,
+	0xC1, 0xA8, 0x16, 0x6F, 0x6F, 0x29, 0x02, 0x52, 0x02, 0x52, 0x5A, 0xED, 0x4C, 0x4C, 0x16, 0x3E, 0x08, 0xFD, 0xC7, 0xE4, 0xDB, 0x80, 0x80, 0x80, 0x59, 0x39, 0x80, 0xE4, 0x24, 0x0B, 0xC2, 0x08, 0x16, 0xBB, 0x02, 0x02, 0x16, 0xBB, 0x8E, 0x8E, 0x8E, 0x4E, 0x4E, 0x3E, 0xC1, 0x87, 0x42, 0x17, 0x7D, 0x20, 0x20, 0x12, 0x8D, 0x12, 0x20, 0xE3, 0x10, 0xBD, 0x04, 0x04, 0xE1, 0x25, 0x7C, 0x7E, 0xAD, 0xAD, 0x04, 0x0E, 0x51, 0x31, 0x3B, 0x3B, 0x04, 0xC9, 0xC9, 0x51, 0x04, 0x0E, 0x19, 0xEC, 0x19, 0xB0, 0x7C, 0x31, 0xAD, 0x7E, 0x6D, 0x83, 0x68, 0xBD, 0x68, 0x45, 0x81, 0x81, 0x81, 0xCD, 0xB6, 0x0E, 0x97, 0xFA, 0x4B, 0x13, 0xEB, 0x5C, 0x0F, 0x36, 0x3D, 0xF2, 0xF1, 0xB3, 0x0A, 0x8F, 0x4C, 0x16, 0x94, 0x8E, 0xC8, 0x96, 0x96, 0x71, 0x71, 0xBF, 0xBF, 0x0F, 0x0F, 0xCA, 0xD0, 0xCA, 0xD0, 0xD0, 0xBF, 0xD0, 0xCA, 0xBF, 0xD0, 0xD0, 0xD0, 0x78, 0xD1, 0xD1, 0xD0, 0xD0, 0xD0, 0x4D, 0xF8, 0x06, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xD0, 0x89, 0x77, 0x95, 0x95, 0x57, 0xE8, 0x7A, 0xCA, 0x06, 0xBF, 0x06, 0x71, 0x71, 0x96, 0x96, 0x0D, 0x40, 0xEA, 0xEA, 0x6F, 0xED, 0x6B, 0x99, 0x9E, 0x86, 0x4B, 0x8D, 0x26, 0xF9, 0x26, 0xD4, 0x89, 0xCC, 0xA6, 0x14, 0x26, 0x81, 0xCD, 0x73, 0x81, 0xB4, 0x73, 0xB5, 0xFA, 0xFE, 0x5E, 0x2E, 0x85, 0x85, 0x84, 0xCE, 0xC0, 0x4F, 0x4F, 0x66, 0x90, 0x66, 0x4F, 0x53, 0xCE, 0xCE, 0x53, 0xCE, 0x4F, 0xCE, 0xCE, 0xCE, 0x79, 0x67, 0xCE, 0x66, 0x55, 0x66, 0xE0, 0x9C, 0x9C, 0xE0, 0xE0, 0xE0, 0xE0, 0x8C, 0x48, 0x8B, 0xFC, 0x64, 0x64, 0x36, 0x59, 0x59, 0x59, 0xA5, 0x59, 0x1E, 0xA5, 0xB1, 0x59, 0xB1, 0x59, 0x59, 0x59, 0x59, 0x59,
+	0x29, 0x29, 0x6F, 0xBB, 0xBB, 0xBB, 0x02, 0x02, 0x52, 0x02, 0x6B, 0xEE, 0x4C, 0x4C, 0x16, 0x94, 0x15, 0xC2, 0xC7, 0x24, 0xE4, 0x80, 0x80, 0x80, 0x1E, 0x80, 0x1E, 0xE4, 0x24, 0xFD, 0x08, 0xC8, 0x4E, 0x02, 0x02, 0x02, 0xBB, 0x16, 0x16, 0x16, 0xEA, 0x8E, 0xC1, 0xF3, 0xEA, 0x7D, 0x20, 0x20, 0x7D, 0x30, 0x20, 0x75, 0x30, 0xEF, 0x75, 0x4A, 0xC9, 0xBD, 0x04, 0x0E, 0x51, 0x7C, 0x51, 0x7E, 0x19, 0x31, 0x0E, 0xAD, 0x35, 0xBD, 0x3B, 0x04, 0x04, 0xC9, 0x1B, 0x7E, 0x51, 0x0E, 0x31, 0x51, 0x19, 0x31, 0xB0, 0x50, 0xAB, 0xC9, 0x68, 0x10, 0x04, 0x10, 0xBD, 0x83, 0x45, 0xB6, 0xE6, 0x68, 0x0E, 0x04, 0x04, 0xFA, 0x42, 0x06, 0xA8, 0x6E, 0xE8, 0x38, 0xBE, 0xF0, 0xE2, 0xE2, 0x5C, 0x72, 0x02, 0x8E, 0x8E, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xCA, 0xCA, 0xD0, 0xCA, 0xD0, 0xD0, 0xD0, 0xD0, 0xCA, 0xD0, 0xD0, 0x78, 0x78, 0xD0, 0x7F, 0x78, 0xD0, 0xCA, 0x06, 0x4D, 0x71, 0x71, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0x89, 0x77, 0x95, 0xF7, 0x57, 0x7A, 0x92, 0x7F, 0x0F, 0xBF, 0x06, 0xF8, 0x71, 0x96, 0x96, 0xC8, 0xC8, 0x8E, 0xEA, 0xC1, 0x6B, 0x6B, 0x9E, 0x45, 0x9E, 0x9E, 0x4B, 0x26, 0xE5, 0x4A, 0xCC, 0x88, 0x46, 0x20, 0xA3, 0xA3, 0x82, 0x4B, 0x86, 0x82, 0x3F, 0x86, 0x73, 0xFA, 0xD7, 0x47, 0x2E, 0x85, 0x98, 0x9D, 0x4F, 0x2A, 0x2A, 0x4F, 0x66, 0x4F, 0x4F, 0x66, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0x53, 0xCE, 0x66, 0x55, 0x55, 0xCE, 0x66, 0x55, 0xE0, 0x55, 0x9C, 0x9C, 0x9C, 0x67, 0x58, 0x67, 0x48, 0x8B, 0x8B, 0xFC, 0x98, 0x67, 0x36, 0x59, 0xB1, 0x59, 0xA5, 0xA5, 0xA5, 0x1E, 0xB1, 0xB1, 0xA5, 0xB1, 0x59, 0xB1, 0x59, 0x59, 0x59,
+	0xBB, 0x6F, 0x07, 0x6F, 0x6F, 0x6F, 0x6F, 0xBB, 0x52, 0x5A, 0x6B, 0xEE, 0x99, 0x4C, 0x16, 0x8E, 0x15, 0x2B, 0xC7, 0x24, 0xE4, 0x80, 0x80, 0x80, 0x1E, 0xE4, 0x7F, 0xE4, 0x24, 0x0B, 0xC2, 0xC8, 0x4E, 0x02, 0xED, 0xBB, 0x6F, 0x16, 0x6F, 0x16, 0x16, 0xC1, 0xEA, 0xEB, 0x70, 0x1F, 0x1C, 0xEF, 0x30, 0x8A, 0x30, 0xEF, 0x7E, 0x35, 0xD6, 0x0E, 0x0E, 0xE1, 0x25, 0x31, 0xAD, 0x7C, 0xAD, 0x7E, 0x7C, 0xAD, 0xAD, 0x7E, 0xE1, 0x83, 0x6D, 0x04, 0x04, 0x04, 0x0E, 0x51, 0xAD, 0x51, 0x7E, 0x7C, 0x7C, 0x19, 0x5B, 0x50, 0x1B, 0xE3, 0x60, 0xD6, 0x12, 0x81, 0x81, 0x10, 0xE6, 0x3B, 0xB6, 0xE6, 0x0E, 0x04, 0x83, 0x8D, 0x06, 0xF4, 0xA8, 0x34, 0x7B, 0x0A, 0xC5, 0x0A, 0xD5, 0x6E, 0x09, 0x02, 0x02, 0x8E, 0x94, 0x94, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xCA, 0xCA, 0xD0, 0xD0, 0xD0, 0x93, 0xD0, 0xD0, 0xD0, 0xD0, 0x7A, 0xD0, 0x7F, 0x7F, 0x78, 0x7F, 0xCA, 0xCA, 0xBF, 0x71, 0x4D, 0x71, 0x06, 0x96, 0x96, 0x96, 0x96, 0xC8, 0x96, 0xBF, 0x78, 0x91, 0x95, 0xA0, 0xE2, 0xE8, 0x92, 0xDB, 0xA2, 0x06, 0xBF, 0x06, 0x96, 0x71, 0x96, 0x96, 0x96, 0xC8, 0xF8, 0xC1, 0x6B, 0x99, 0x9E, 0x86, 0x9E, 0x9E, 0xD7, 0x8D, 0xFB, 0x4A, 0x21, 0x88, 0xAA, 0x5E, 0x14, 0x14, 0x82, 0x10, 0x73, 0x82, 0xCD, 0xBD, 0x73, 0x82, 0x33, 0x70, 0x17, 0xFC, 0x84, 0x79, 0xCE, 0x2A, 0x2A, 0x4F, 0x4F, 0x66, 0x4F, 0x53, 0xCE, 0x53, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0x66, 0x55, 0xE0, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x67, 0x9D, 0x64, 0x48, 0x58, 0x64, 0x8B, 0x64, 0x84, 0x90, 0x59, 0x59, 0x59, 0x59, 0xA5, 0x1E, 0xA5, 0x59, 0x59, 0xA5, 0xB1, 0x59, 0x59, 0x59, 0x59, 0xA5, 0x59,
+	0xBB, 0xA8, 0x07, 0x07, 0x6F, 0x52, 0x52, 0x02, 0x52, 0x52, 0x6B, 0xEE, 0x99, 0x4C, 0x16, 0x94, 0x15, 0xDD, 0xC7, 0x24, 0x39, 0x80, 0x80, 0x80, 0x1E, 0x80, 0x1E, 0xE4, 0xC7, 0x0B, 0xC2, 0x94, 0x5D, 0x02, 0x02, 0x02, 0x6F, 0x6F, 0x8E, 0x16, 0x8E, 0x96, 0x4D, 0x06, 0x13, 0x21, 0x30, 0x30, 0x30, 0x7E, 0x4A, 0xC9, 0xE1, 0xE1, 0x9F, 0x25, 0xC9, 0x4A, 0x0E, 0xE1, 0x51, 0x7C, 0x51, 0x51, 0x51, 0xEF, 0x7E, 0xE1, 0x83, 0xBD, 0x83, 0x83, 0x04, 0x04, 0x04, 0xC9, 0x7C, 0x1B, 0x7E, 0x19, 0x19, 0x51, 0x25, 0x9F, 0x68, 0x9B, 0x75, 0x20, 0x1B, 0xB4, 0x81, 0x9F, 0xB6, 0x97, 0x9F, 0x04, 0x3B, 0x04, 0x97, 0xA6, 0x06, 0x29, 0x6E, 0x3D, 0x7B, 0xFF, 0xC5, 0xF7, 0xCB, 0x6C, 0x09, 0xBB, 0x16, 0x8E, 0xC8, 0x40, 0xC8, 0x96, 0x96, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xD0, 0xD0, 0xD0, 0xD0, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x7F, 0x7F, 0x92, 0x93, 0xD0, 0xDB, 0xCA, 0xBF, 0x4D, 0xBF, 0x71, 0x71, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0x78, 0xE2, 0x95, 0x95, 0x77, 0xE8, 0x7F, 0xDB, 0xCA, 0x0F, 0xBF, 0xF8, 0x71, 0xF8, 0x96, 0x96, 0x96, 0x40, 0xEA, 0xEA, 0x6B, 0x6B, 0x9E, 0xBD, 0x8D, 0x9A, 0x26, 0x4A, 0xE5, 0x4B, 0x1C, 0xAA, 0x2F, 0x70, 0x14, 0x14, 0xE5, 0xBD, 0x81, 0x82, 0xCD, 0x73, 0x82, 0x14, 0x5E, 0x48, 0x17, 0xFC, 0x9D, 0x66, 0x90, 0x90, 0x37, 0x4F, 0x4F, 0x53, 0x4F, 0x4F, 0xCE, 0xCE, 0xCE, 0x53, 0xCE, 0x4F, 0x53, 0x4F, 0xCE, 0x55, 0xE0, 0x9C, 0xE0, 0x9C, 0x9C, 0x66, 0x9C, 0x67, 0x64, 0x9D, 0x64, 0x48, 0x8B, 0xB8, 0x67, 0x90, 0x59, 0x59, 0x59, 0x59, 0xA5, 0x59, 0xA5, 0xB1, 0xA5, 0xB1, 0x59, 0xA5, 0xB1, 0xA5, 0xB1, 0x59, 0xA5, 0x59,
+	0xAF, 0x6F, 0x6F, 0x6F, 0x52, 0x52, 0x02, 0x52, 0x5A, 0x5A, 0x6B, 0x6B, 0x4C, 0xED, 0x16, 0x40, 0x15, 0xFD, 0xC7, 0x24, 0xE4, 0x80, 0x80, 0x80, 0x1E, 0xE4, 0x7F, 0xE4, 0x24, 0x0B, 0x08, 0xC8, 0x5D, 0x02, 0xED, 0x02, 0x02, 0x16, 0x16, 0xEA, 0x96, 0x96, 0xF8, 0xF8, 0x13, 0xF8, 0x7D, 0x75, 0x1B, 0x4A, 0xBD, 0xD6, 0xE1, 0xC9, 0x0E, 0x0E, 0x4A, 0xC9, 0x31, 0x1B, 0x7C, 0x1B, 0x19, 0xAD, 0x19, 0x19, 0xE1, 0x04, 0x04, 0x9F, 0xBD, 0x04, 0x45, 0x04, 0x3B, 0x0E, 0x25, 0x31, 0x31, 0xE1, 0xAD, 0x04, 0x6D, 0xFB, 0x26, 0xBC, 0x1F, 0x47, 0x12, 0x73, 0x81, 0xB4, 0x83, 0x83, 0x04, 0x04, 0x04, 0xE6, 0xA3, 0x13, 0x87, 0x01, 0xA2, 0x5F, 0x0A, 0xBE, 0xD5, 0x74, 0x14, 0x00, 0x4C, 0x02, 0x16, 0x8E, 0xC8, 0x8E, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xCA, 0xCA, 0xE4, 0x93, 0xD0, 0x93, 0x7F, 0x93, 0x93, 0x92, 0x7F, 0x93, 0xD0, 0x92, 0x7F, 0x24, 0xCA, 0xBF, 0xFD, 0x71, 0x71, 0x71, 0xF8, 0x71, 0x96, 0x96, 0x96, 0x96, 0x71, 0x78, 0x57, 0x95, 0xA1, 0x91, 0xE8, 0xA4, 0xDB, 0xA2, 0x06, 0xBF, 0x06, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x40, 0xC1, 0x6B, 0x99, 0x9E, 0x9E, 0x4B, 0x9E, 0xD7, 0x4B, 0x83, 0x86, 0x48, 0xA7, 0x1A, 0x11, 0xA3, 0xC4, 0x82, 0x73, 0x73, 0xB5, 0x73, 0xB5, 0xFA, 0xA3, 0x7D, 0x2E, 0x9D, 0x85, 0x9D, 0xC0, 0x90, 0x90, 0x4F, 0x90, 0x66, 0x4F, 0x66, 0x4F, 0xCE, 0x53, 0xCE, 0xCE, 0xCE, 0xCE, 0x66, 0xCE, 0xCE, 0x66, 0xE0, 0x9C, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x9D, 0x64, 0x48, 0x64, 0x8B, 0x64, 0x64, 0x66, 0x36, 0x59, 0x59, 0xA5, 0xA5, 0x59, 0xA5, 0xB1, 0xA5, 0xB1, 0xA5, 0xB1, 0x59, 0xB1, 0x28, 0x59, 0x28, 0x59, 0x28,
+	0xBB, 0xAF, 0x8F, 0x52, 0x6F, 0x52, 0x52, 0xBB, 0x52, 0x6B, 0x6B, 0x99, 0x99, 0x4C, 0x02, 0x94, 0x15, 0xDD, 0xC7, 0xDB, 0xE4, 0x80, 0x80, 0x80, 0x1E, 0xE4, 0xE4, 0xE4, 0x24, 0x0B, 0xC2, 0xC8, 0x5D, 0x02, 0x4C, 0x02, 0x02, 0x16, 0x8E, 0x8E, 0x96, 0xEA, 0xEA, 0xEA, 0x7D, 0x7D, 0x7D, 0x1B, 0x20, 0xE1, 0x1B, 0x1B, 0x4A, 0x0E, 0x31, 0xC9, 0x0E, 0x7C, 0x7E, 0xE1, 0x0E, 0x19, 0x50, 0x19, 0xB0, 0xB0, 0x31, 0xBD, 0xC9, 0xBD, 0x45, 0x04, 0x04, 0x3B, 0x0E, 0x04, 0x04, 0x31, 0x4A, 0x04, 0xE1, 0x9F, 0x6D, 0x3B, 0x33, 0x7D, 0x11, 0x20, 0x33, 0xA3, 0xB5, 0x81, 0x45, 0x04, 0xB6, 0x04, 0xE6, 0xFA, 0x42, 0x0F, 0x5C, 0x58, 0xE8, 0xBE, 0xBE, 0xC5, 0xF7, 0xD6, 0x00, 0xC4, 0xEE, 0x02, 0x16, 0x8E, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xD0, 0xD0, 0x7F, 0x93, 0x93, 0x93, 0xE4, 0x93, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xCA, 0xCA, 0xC7, 0xBF, 0x71, 0xBF, 0x71, 0xBF, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0x2F, 0x57, 0x95, 0x95, 0xD5, 0xE8, 0xD1, 0xDB, 0xA2, 0xCA, 0x06, 0xBF, 0x71, 0x71, 0x96, 0xC8, 0x96, 0x96, 0x40, 0xDA, 0x6B, 0x6B, 0x9E, 0xBD, 0x9E, 0x9E, 0x8F, 0x4B, 0xE5, 0xBD, 0x70, 0xD3, 0xCC, 0xCC, 0xD7, 0xB2, 0xFA, 0x82, 0xBD, 0x73, 0x3F, 0x82, 0xFA, 0xD7, 0x8B, 0x17, 0x9C, 0x84, 0x9D, 0xC0, 0x90, 0x90, 0x90, 0x66, 0x4F, 0x4F, 0x4F, 0x66, 0x53, 0xCE, 0xCE, 0xCE, 0x53, 0xCE, 0x66, 0x55, 0xE0, 0xE0, 0x55, 0x66, 0xE0, 0xE0, 0xE0, 0x66, 0x9C, 0x67, 0x58, 0x48, 0x64, 0xBA, 0xFC, 0x67, 0x36, 0x59, 0x1E, 0x59, 0x1E, 0x59, 0xB1, 0xA5, 0x59, 0x59, 0xB1, 0x59, 0xA5, 0xB1, 0x28, 0x59, 0x59, 0x28, 0x59, 0x28,
+	0x8F, 0xBB, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5A, 0x6B, 0x6B, 0x8D, 0x99, 0x4C, 0x6F, 0x40, 0x96, 0xFD, 0xC7, 0x24, 0xDB, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0xC7, 0x0B, 0xC2, 0x94, 0x5D, 0x02, 0x02, 0x16, 0xBB, 0x16, 0xC1, 0xC1, 0xC1, 0x8E, 0xEA, 0xF8, 0x13, 0x7D, 0x12, 0x12, 0x1B, 0x1B, 0x1B, 0xE1, 0x1B, 0x1B, 0x0E, 0x04, 0x1B, 0x51, 0x1B, 0x0E, 0x31, 0x50, 0x19, 0xAD, 0x31, 0xC9, 0x7C, 0x9F, 0x04, 0xFB, 0xBD, 0xBD, 0x04, 0x04, 0xC9, 0x04, 0x3B, 0xC9, 0xC9, 0x10, 0xD6, 0x4A, 0xFB, 0xF9, 0x26, 0xA6, 0x48, 0x49, 0x47, 0xFE, 0xFA, 0xB4, 0x83, 0x83, 0x9F, 0x83, 0x00, 0x8D, 0x11, 0x42, 0x01, 0x0F, 0x32, 0xF1, 0xBE, 0xD5, 0x49, 0x00, 0xB2, 0xCD, 0x99, 0x29, 0x4E, 0xC8, 0x40, 0xC8, 0xC8, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0xBF, 0xBF, 0xCA, 0xCA, 0xD0, 0xE4, 0x92, 0x92, 0x93, 0xD2, 0x93, 0x7F, 0x7F, 0x7F, 0x7F, 0xD0, 0xE4, 0xBF, 0xBF, 0xFD, 0xBF, 0x71, 0x71, 0x71, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0xD0, 0x89, 0x95, 0xA1, 0xD5, 0xE8, 0xD1, 0xDB, 0xCA, 0x06, 0x06, 0x06, 0x71, 0x96, 0x96, 0x96, 0x96, 0xC8, 0x96, 0x6F, 0x6B, 0x99, 0x86, 0x9E, 0x9E, 0x9E, 0x33, 0x9A, 0x45, 0x81, 0x70, 0xAA, 0x11, 0xCC, 0x8F, 0xB2, 0xFA, 0x81, 0x4B, 0x4B, 0x73, 0xB2, 0xC4, 0x18, 0x70, 0x17, 0x54, 0x9D, 0x79, 0x90, 0x90, 0x90, 0x4F, 0x79, 0x4F, 0x66, 0x53, 0x4F, 0xCE, 0xCE, 0xCE, 0xCE, 0x66, 0x55, 0xE0, 0xE0, 0xE0, 0xE0, 0x66, 0x55, 0x9C, 0xE0, 0xE0, 0xE0, 0xE0, 0x58, 0x58, 0x8B, 0xB8, 0xB8, 0xFC, 0x36, 0x59, 0x59, 0x1E, 0xA5, 0xB1, 0xA5, 0xB1, 0xA5, 0xB1, 0x28, 0xB1, 0x28, 0x59, 0x59, 0x28, 0x59, 0x28, 0x28, 0x59, 0xAE,
+	0x8F, 0x02, 0x52, 0x52, 0x52, 0x52, 0x6B, 0xED, 0x5A, 0xD7, 0x8D, 0x6B, 0x99, 0x6B, 0x6F, 0x8E, 0x4D, 0xDD, 0xC7, 0x24, 0xE4, 0x39, 0x80, 0x80, 0x80, 0x80, 0xE4, 0xE4, 0xC7, 0x0B, 0xC2, 0x08, 0x5D, 0x02, 0x4C, 0x02, 0x16, 0x6F, 0xC1, 0xDA, 0xEA, 0xEA, 0xEA, 0xEA, 0x41, 0x12, 0x12, 0x20, 0x51, 0x75, 0x1B, 0x1B, 0x7E, 0x1B, 0x0E, 0x51, 0x7E, 0x1B, 0x0E, 0x0E, 0x7C, 0x7E, 0x19, 0xB0, 0xB0, 0x25, 0x31, 0xBD, 0x83, 0x83, 0x9F, 0x9F, 0xBD, 0xC9, 0x83, 0xBD, 0xC9, 0xBD, 0x83, 0x83, 0x4A, 0x4A, 0x6C, 0xC3, 0x8F, 0xB9, 0x01, 0x2E, 0x11, 0xD7, 0xFA, 0xF9, 0xB7, 0x6D, 0x83, 0x6D, 0x00, 0x42, 0x11, 0x8F, 0x98, 0xE8, 0x32, 0x32, 0xF0, 0x05, 0x97, 0xB2, 0x9F, 0x73, 0x6B, 0xBB, 0x8E, 0x8E, 0xC8, 0x40, 0x96, 0xC8, 0x96, 0x96, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0x24, 0xD0, 0xD0, 0xE4, 0x93, 0x93, 0x92, 0x7F, 0x7F, 0xD0, 0x7F, 0xE4, 0xCA, 0xC7, 0xBF, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x96, 0x96, 0xC8, 0x96, 0x96, 0x71, 0xCA, 0x89, 0x95, 0x95, 0x95, 0x32, 0xA2, 0xDB, 0xA2, 0xCA, 0x06, 0xBF, 0x71, 0x71, 0x96, 0x08, 0x96, 0xC8, 0xEA, 0x6F, 0x99, 0x99, 0x86, 0x9E, 0xE5, 0x9E, 0x33, 0x73, 0x81, 0xE5, 0x47, 0x88, 0x11, 0xCC, 0xA6, 0xB2, 0xF9, 0x81, 0x10, 0xA3, 0xB5, 0xC3, 0xA3, 0x5E, 0x85, 0x9C, 0x98, 0x79, 0xA2, 0x36, 0x90, 0x90, 0x90, 0x66, 0x66, 0x90, 0x66, 0x4F, 0x66, 0x53, 0xCE, 0x66, 0xE0, 0x66, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0xE0, 0x17, 0x8C, 0x58, 0x8B, 0x64, 0xB8, 0x64, 0x90, 0x36, 0x1E, 0xA5, 0x1E, 0xB1, 0xA5, 0xB1, 0x59, 0xA5, 0xB1, 0x59, 0xA5, 0x59, 0x28, 0x59, 0x28, 0x28, 0x59, 0xAE, 0x28, 0xAE,
+	0x5A, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6B, 0xD7, 0x8D, 0x8D, 0x8D, 0x99, 0x99, 0x4C, 0x6F, 0x40, 0x15, 0xFD, 0xFD, 0xDB, 0x24, 0x39, 0x39, 0x80, 0x7F, 0xE4, 0xE4, 0xE4, 0x24, 0xFD, 0xC2, 0xC8, 0x5D, 0x02, 0x02, 0x02, 0xBB, 0x6F, 0xC1, 0xC1, 0xC1, 0xC1, 0xEA, 0xEA, 0x7D, 0x20, 0x35, 0x30, 0xEF, 0x20, 0xC9, 0x51, 0x51, 0x4A, 0x51, 0x50, 0xE1, 0xC9, 0x0E, 0xC9, 0x04, 0x31, 0x43, 0x51, 0x51, 0x0E, 0x0E, 0xC9, 0x9F, 0x9F, 0x10, 0xBD, 0x83, 0xC9, 0x83, 0xBD, 0x83, 0x68, 0x33, 0x4B, 0x45, 0x4A, 0xC3, 0xE5, 0x8F, 0x42, 0x8F, 0x5C, 0x88, 0x48, 0xD7, 0xFA, 0xF9, 0x83, 0x3B, 0xE5, 0x99, 0xE0, 0xF4, 0xB8, 0x11, 0x91, 0xE8, 0x91, 0xD5, 0xE3, 0x00, 0xB7, 0x10, 0x9A, 0xEE, 0x6F, 0x8E, 0x8E, 0xC8, 0x8E, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xDB, 0xDB, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xD0, 0xCA, 0xC7, 0xFD, 0x71, 0x71, 0x08, 0x71, 0x71, 0x96, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x71, 0xCA, 0x78, 0x91, 0x95, 0xF7, 0x32, 0xD1, 0xDB, 0xBF, 0x06, 0xBF, 0x06, 0x71, 0x71, 0x96, 0x96, 0x96, 0x96, 0x8E, 0x6F, 0x99, 0x99, 0x86, 0x9E, 0x81, 0x9E, 0x33, 0xC3, 0x81, 0xE5, 0xA6, 0x89, 0x11, 0xCC, 0x70, 0xC3, 0xFA, 0xF9, 0x10, 0x4B, 0xB5, 0xC3, 0xD7, 0x87, 0x58, 0x54, 0x84, 0x66, 0x36, 0x7F, 0x90, 0x90, 0x90, 0x79, 0x4F, 0x66, 0x4F, 0x4F, 0xCE, 0xCE, 0xCE, 0x9C, 0x9C, 0x9C, 0xE0, 0xE0, 0xE0, 0x9C, 0x9C, 0x67, 0x58, 0xE0, 0x9C, 0x8C, 0x48, 0x58, 0x8B, 0xB8, 0xB8, 0x67, 0x36, 0x59, 0x1E, 0x1E, 0xB1, 0xA5, 0xB1, 0xB1, 0xB1, 0x28, 0xB1, 0x59, 0x28, 0xB1, 0x28, 0x59, 0x28, 0x59, 0xAE, 0xAE, 0xAE, 0xAE,
+	0xAF, 0x52, 0x5A, 0x52, 0x52, 0x52, 0x8D, 0x5A, 0x8D, 0x8D, 0x9E, 0x99, 0x99, 0xEE, 0x6F, 0x3E, 0x15, 0xDD, 0xC7, 0x24, 0xDB, 0xE4, 0x39, 0x39, 0x80, 0x80, 0xE4, 0xE4, 0xC7, 0xFD, 0xC2, 0x94, 0x8E, 0x02, 0x4C, 0x52, 0x07, 0xF8, 0x20, 0x6F, 0x41, 0x07, 0x41, 0x7D, 0x13, 0x30, 0x7D, 0x51, 0x4A, 0x4A, 0x7E, 0x75, 0xE1, 0x51, 0x75, 0x25, 0x04, 0x31, 0x7C, 0x31, 0x0E, 0x7C, 0x43, 0xAD, 0xAD, 0xB0, 0x04, 0x4A, 0xC9, 0x68, 0x10, 0x9F, 0x83, 0xBD, 0xE6, 0x04, 0xFB, 0x45, 0x33, 0x4B, 0x81, 0x8D, 0xE5, 0xFE, 0x52, 0xB9, 0x58, 0x5A, 0xA6, 0xCC, 0x22, 0x4B, 0xFA, 0xF9, 0x45, 0xB7, 0x07, 0xCF, 0x5C, 0xB9, 0x89, 0x77, 0xE2, 0xD5, 0xAC, 0x00, 0x3B, 0xB6, 0xA3, 0x14, 0xEE, 0x6F, 0x16, 0x8E, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xCA, 0xE4, 0xD0, 0x7F, 0x7F, 0xD0, 0x7F, 0x7F, 0x7F, 0x24, 0xCA, 0xC7, 0xBF, 0xBF, 0x71, 0x71, 0x96, 0x08, 0x08, 0x96, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x71, 0x06, 0x78, 0x91, 0x95, 0x95, 0x91, 0x2A, 0xDB, 0x06, 0x0F, 0x71, 0xBF, 0x71, 0x96, 0x96, 0x08, 0x96, 0x96, 0xC1, 0x52, 0x99, 0xFE, 0x86, 0x9E, 0x9E, 0x9E, 0x8F, 0xC3, 0xF9, 0xFB, 0x20, 0xA4, 0xCC, 0x48, 0x70, 0x26, 0x3A, 0xB5, 0x10, 0xA3, 0xB2, 0xB2, 0x8F, 0x8B, 0x54, 0x9D, 0x84, 0x53, 0x90, 0x90, 0x90, 0x90, 0xDC, 0x90, 0x4F, 0x4F, 0x66, 0x53, 0xCE, 0xCE, 0x66, 0x66, 0x66, 0x55, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x67, 0x17, 0xE0, 0x48, 0x58, 0x58, 0x8B, 0xFC, 0xFC, 0x90, 0x59, 0x59, 0x1E, 0xA5, 0xB1, 0xA5, 0xB1, 0x28, 0xB1, 0x59, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE,
+	0x52, 0x5A, 0x52, 0x52, 0x52, 0x52, 0x52, 0xD7, 0x8D, 0xEE, 0x4B, 0x9E, 0x99, 0xEE, 0x6F, 0x3E, 0x08, 0xFD, 0xC7, 0xC7, 0xE4, 0xE4, 0x39, 0x24, 0x39, 0x80, 0xE4, 0xE4, 0xC7, 0x0B, 0xC2, 0x94, 0x8E, 0x02, 0xED, 0x6B, 0x6F, 0x13, 0x41, 0x6F, 0x07, 0x13, 0x30, 0x21, 0x30, 0x7D, 0xBD, 0x45, 0xBD, 0x7E, 0x30, 0x7E, 0x1B, 0x7E, 0xC9, 0x04, 0x04, 0xAD, 0x7C, 0x7C, 0x0E, 0x19, 0x43, 0xAD, 0xAD, 0xAD, 0x3B, 0xC9, 0x4A, 0x4A, 0x4A, 0xE6, 0x83, 0xB7, 0xFB, 0x68, 0x73, 0x73, 0x12, 0x8D, 0x33, 0x9E, 0x9E, 0x52, 0x5E, 0x06, 0xCC, 0x8F, 0x14, 0xBA, 0xD4, 0xE3, 0x00, 0xFB, 0xFB, 0x86, 0x54, 0x6E, 0x5C, 0x11, 0x91, 0x32, 0x77, 0x57, 0x26, 0x00, 0xB7, 0x9F, 0x26, 0x9E, 0x99, 0x02, 0x16, 0x8E, 0x94, 0xC8, 0x96, 0x96, 0x96, 0x08, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xCA, 0xCA, 0xE4, 0xD0, 0xD0, 0xE4, 0xD0, 0xE4, 0xD0, 0x24, 0xD0, 0xCA, 0xC7, 0x71, 0x71, 0x08, 0x96, 0x08, 0x96, 0x96, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x71, 0x71, 0x89, 0x57, 0x95, 0x95, 0xF0, 0x2A, 0xCA, 0xBF, 0xBF, 0x06, 0x06, 0x71, 0x71, 0x96, 0x96, 0xC8, 0x96, 0x6F, 0x6B, 0x99, 0xC3, 0x9E, 0x86, 0x8D, 0x8D, 0x18, 0x9A, 0x83, 0xE5, 0x18, 0x1A, 0xCC, 0x11, 0x48, 0xD7, 0x6C, 0x82, 0x9F, 0xCD, 0xB2, 0x72, 0x5C, 0x54, 0x54, 0x9D, 0x9D, 0xC0, 0x90, 0x90, 0x90, 0x90, 0x90, 0x53, 0x66, 0x90, 0x4F, 0x4F, 0xCE, 0x53, 0x9C, 0x9C, 0x55, 0x66, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0xE0, 0x67, 0x48, 0x64, 0x58, 0xFC, 0xB8, 0x66, 0x36, 0x1E, 0x1E, 0x1E, 0xB1, 0xB1, 0xB1, 0xB1, 0x28, 0xB1, 0xB1, 0x28, 0x59, 0x59, 0x28, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x59, 0xAE,
+	0xAF, 0x52, 0x52, 0x52, 0x52, 0x8D, 0x52, 0x6B, 0x8D, 0x8D, 0x9E, 0x99, 0x99, 0x99, 0x6F, 0x3E, 0x96, 0xDD, 0xFD, 0xDB, 0xE4, 0xDB, 0xE4, 0x39, 0x39, 0x39, 0xE4, 0xE4, 0xC7, 0xFD, 0xC2, 0x94, 0x5D, 0x02, 0x52, 0xBB, 0x6F, 0x70, 0x7D, 0x07, 0x13, 0x13, 0x13, 0xF8, 0xEF, 0x12, 0xBD, 0xC9, 0x51, 0xEF, 0x7E, 0x51, 0x7E, 0xC9, 0x0E, 0x0E, 0x31, 0x51, 0x51, 0xB0, 0x7C, 0x43, 0xAD, 0x19, 0x51, 0x19, 0x25, 0x0E, 0xC9, 0x10, 0x4A, 0xB6, 0xFB, 0xE6, 0x83, 0xF9, 0x3F, 0x26, 0x7D, 0x33, 0x12, 0xC3, 0x6B, 0x18, 0x42, 0x2F, 0x89, 0x67, 0x09, 0xD7, 0x1F, 0x12, 0x00, 0xB7, 0xB7, 0x12, 0xCB, 0xF3, 0x01, 0xD3, 0x91, 0xD5, 0x32, 0xE3, 0x00, 0x00, 0x3B, 0xB4, 0x33, 0x99, 0x99, 0xBB, 0x16, 0x8E, 0x8E, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0x24, 0xBF, 0xCA, 0x24, 0xD0, 0xE4, 0xD0, 0xDB, 0xDB, 0xCA, 0x24, 0xCA, 0xBF, 0xFD, 0x71, 0x08, 0x08, 0x96, 0x08, 0x96, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0xBF, 0xD0, 0x89, 0x95, 0xA1, 0xD5, 0xA2, 0xA2, 0x53, 0xCA, 0x4D, 0x71, 0x71, 0x96, 0x71, 0x96, 0x96, 0xEA, 0x6F, 0x6B, 0xE5, 0x45, 0x86, 0x9E, 0xA3, 0xA3, 0x8F, 0x9E, 0x81, 0xE5, 0x33, 0x0F, 0xCC, 0x11, 0x13, 0x26, 0x00, 0x82, 0x68, 0xB4, 0xB2, 0xA3, 0x41, 0x54, 0x9C, 0xA9, 0x9D, 0x90, 0x90, 0x90, 0x90, 0x90, 0xDC, 0x90, 0x66, 0x4F, 0x66, 0x4F, 0x66, 0xCE, 0x66, 0x4F, 0x9C, 0x55, 0xE0, 0xE0, 0xCF, 0x9C, 0x66, 0x9C, 0x9C, 0x58, 0x58, 0x48, 0x58, 0x98, 0xFC, 0x64, 0x90, 0xB1, 0x59, 0x1E, 0xA5, 0xB1, 0xB1, 0x28, 0xB1, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x59,
+	0xBB, 0x52, 0x52, 0x52, 0x52, 0x12, 0x6B, 0x8D, 0xEE, 0xA3, 0x8D, 0x9E, 0xFE, 0x99, 0x02, 0x3E, 0x08, 0x71, 0xC7, 0x24, 0x24, 0xE4, 0x39, 0x39, 0x39, 0x80, 0xE4, 0xE4, 0xC7, 0x0B, 0x08, 0x94, 0x5D, 0x4C, 0xED, 0x6B, 0x6F, 0x7D, 0x13, 0xF8, 0x13, 0x7D, 0x07, 0x7D, 0x7D, 0x20, 0x0E, 0x1B, 0xEF, 0x7E, 0x1B, 0x1B, 0xE1, 0x51, 0x0E, 0xC9, 0x51, 0x7C, 0x7E, 0x51, 0xB0, 0x19, 0xAD, 0x43, 0xB0, 0x19, 0x1B, 0x83, 0x9F, 0x04, 0x10, 0x68, 0xFB, 0x04, 0xB7, 0x68, 0xCD, 0x4B, 0xA6, 0x7D, 0x8D, 0x99, 0x12, 0x42, 0x42, 0xD3, 0x91, 0x1A, 0x14, 0xC4, 0xE3, 0x82, 0xFA, 0x00, 0x3A, 0x8B, 0x6E, 0xF4, 0x98, 0x57, 0x91, 0x95, 0x49, 0x00, 0xB7, 0xB6, 0xB7, 0xB2, 0x33, 0x4C, 0xEE, 0xBB, 0x16, 0x8E, 0xC8, 0x8E, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xC7, 0xBF, 0xC7, 0xCA, 0xE4, 0xCA, 0x24, 0xCA, 0x24, 0xCA, 0xBF, 0xFD, 0x71, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0xC8, 0x94, 0xC8, 0xC8, 0xC8, 0x96, 0xBF, 0xD0, 0x89, 0x95, 0xA1, 0x95, 0x7F, 0x53, 0xBF, 0x0F, 0xBF, 0x06, 0x71, 0x96, 0x96, 0x96, 0x96, 0xEA, 0x6F, 0x86, 0xE5, 0x45, 0x86, 0x9E, 0xA3, 0x8D, 0x12, 0x9A, 0x83, 0xFB, 0x8F, 0xCC, 0x1A, 0x2E, 0xCC, 0x8F, 0x6C, 0xB4, 0x68, 0x82, 0x3A, 0xAF, 0x85, 0x17, 0x9D, 0x84, 0x79, 0x90, 0x90, 0x90, 0x90, 0x90, 0x79, 0x79, 0x90, 0x66, 0x4F, 0x53, 0xCE, 0xCE, 0x53, 0xCE, 0x9C, 0x66, 0xE0, 0x66, 0xE0, 0x9C, 0x9C, 0x9C, 0xE0, 0x58, 0x58, 0x8C, 0x58, 0xFC, 0xB8, 0x9C, 0x59, 0x59, 0x1E, 0xA5, 0xB1, 0x28, 0xB1, 0xB1, 0x28, 0xB1, 0xB1, 0x28, 0x59, 0x28, 0x28, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+	0x52, 0x52, 0x52, 0x52, 0x52, 0x8D, 0x52, 0x26, 0xEE, 0xA3, 0x9E, 0x9A, 0x72, 0x99, 0x02, 0xEA, 0x15, 0xFD, 0xC7, 0xC7, 0xDB, 0xE4, 0x39, 0x39, 0x39, 0x39, 0xE4, 0xE4, 0x0B, 0x0B, 0xC2, 0x94, 0x8E, 0x02, 0x02, 0x6B, 0x52, 0x07, 0x7D, 0x7D, 0xEA, 0x7D, 0x7D, 0x13, 0xEF, 0x1B, 0x4B, 0x4A, 0x75, 0x1B, 0x1B, 0x1B, 0x7C, 0x1B, 0x0E, 0x51, 0x7C, 0x51, 0x19, 0x7C, 0x7C, 0xAD, 0xAD, 0x43, 0xB0, 0xB0, 0xB0, 0x6D, 0x04, 0x9F, 0xBD, 0x68, 0x3B, 0x83, 0xFB, 0x9F, 0x10, 0x12, 0x12, 0x18, 0x99, 0x41, 0x48, 0x42, 0x8F, 0x33, 0x13, 0x70, 0x14, 0x00, 0xA3, 0xFA, 0xFA, 0x00, 0x14, 0xCC, 0x01, 0x01, 0xD1, 0x95, 0x91, 0x76, 0xB2, 0x00, 0x3B, 0x3B, 0xFB, 0x9A, 0x18, 0xEE, 0x6B, 0x02, 0x16, 0x8E, 0x8E, 0x96, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xCA, 0xCA, 0x24, 0xCA, 0xCA, 0xCA, 0xC7, 0xBF, 0x71, 0x71, 0x71, 0x96, 0xC8, 0xC8, 0x96, 0x08, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x71, 0xCA, 0x7A, 0x77, 0xA1, 0x95, 0x93, 0x79, 0xBF, 0x06, 0x71, 0x06, 0x71, 0x71, 0x96, 0x96, 0x40, 0xC1, 0x8D, 0x86, 0x81, 0xBD, 0x86, 0x4B, 0xA3, 0xD7, 0xD7, 0x9E, 0xE5, 0xF9, 0x8D, 0xE0, 0xD1, 0x13, 0x2C, 0x20, 0xFA, 0xB4, 0xB4, 0xF9, 0x73, 0xE3, 0x85, 0x54, 0xA9, 0x84, 0x79, 0x90, 0x90, 0x90, 0x90, 0x90, 0x66, 0x79, 0x66, 0x90, 0x66, 0x4F, 0xCE, 0xCE, 0xCE, 0xCE, 0x9C, 0x55, 0x55, 0x55, 0xE0, 0x9C, 0x9C, 0x9C, 0x58, 0x58, 0x58, 0x64, 0x98, 0xB8, 0x9D, 0x90, 0xB1, 0xB1, 0x1E, 0xB1, 0xA5, 0xB1, 0xB1, 0x28, 0xB1, 0x28, 0x59, 0x28, 0x28, 0x28, 0x28, 0x59, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+	0xAF, 0x52, 0x52, 0x52, 0x52, 0x12, 0x6B, 0x5A, 0xA3, 0xA3, 0x99, 0x9E, 0x72, 0x72, 0x02, 0x8E, 0x4D, 0x71, 0xC7, 0x24, 0xE4, 0xE4, 0x39, 0x80, 0x80, 0xE4, 0xE4, 0xE4, 0xC7, 0x0B, 0xC2, 0x94, 0x8E, 0x02, 0x02, 0x52, 0x52, 0x6F, 0x07, 0xEA, 0x7D, 0xEA, 0x7D, 0x13, 0x7D, 0x12, 0x4A, 0x1B, 0x1B, 0x12, 0x51, 0x51, 0x1B, 0x0E, 0x51, 0xB0, 0xC9, 0x50, 0x7C, 0x0E, 0xAD, 0xB0, 0xAD, 0xEC, 0x19, 0x0E, 0x51, 0x3B, 0x04, 0x04, 0x04, 0xBD, 0x9F, 0x04, 0x68, 0xB6, 0xB5, 0xE3, 0xA3, 0x8D, 0x8F, 0x2E, 0xEB, 0x8F, 0xEE, 0xD7, 0x18, 0x73, 0x82, 0xFA, 0xB5, 0xFA, 0x00, 0xA3, 0x5E, 0xBA, 0x42, 0x85, 0x32, 0xE8, 0x44, 0xE3, 0x00, 0x00, 0x3B, 0xFB, 0xF9, 0x9E, 0x20, 0xEE, 0xED, 0x02, 0xBB, 0x8E, 0x8E, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0xFD, 0xFD, 0xBF, 0xC7, 0xBF, 0xBF, 0xC7, 0xBF, 0xC7, 0xBF, 0xBF, 0x71, 0x71, 0x08, 0x0D, 0x94, 0xC8, 0x96, 0x08, 0x96, 0x96, 0xC8, 0xC8, 0xC8, 0x96, 0x71, 0xCA, 0x7A, 0x91, 0xA1, 0xA1, 0xD2, 0x9C, 0x06, 0xBF, 0x06, 0x71, 0x71, 0xF8, 0x96, 0x96, 0xF8, 0x6F, 0x8D, 0xE5, 0x45, 0x45, 0xBD, 0x4B, 0xD7, 0xD7, 0x8D, 0x9A, 0x81, 0xE5, 0xA3, 0x58, 0x2F, 0x11, 0xCC, 0xA6, 0xB5, 0xB4, 0xE6, 0xF9, 0xA3, 0x41, 0x17, 0x79, 0x4D, 0x84, 0x90, 0x90, 0x90, 0x90, 0x4F, 0x4F, 0x66, 0xDC, 0x66, 0x4F, 0x4F, 0x79, 0xCE, 0x53, 0xCE, 0xCE, 0x66, 0x55, 0x66, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x67, 0x58, 0x64, 0x58, 0xFC, 0x6E, 0x66, 0x36, 0x59, 0xA5, 0xA5, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xD9, 0xAE, 0xAE, 0xAE,
+	0xBB, 0x52, 0x52, 0x12, 0x52, 0x52, 0x52, 0x5A, 0xEE, 0xA3, 0x99, 0x9A, 0x72, 0x99, 0x02, 0xEA, 0x96, 0xC2, 0xC7, 0x24, 0xDB, 0xE4, 0xDB, 0x80, 0x80, 0x80, 0xE4, 0xE4, 0x24, 0x0B, 0xC2, 0x94, 0x8E, 0x02, 0x4C, 0xED, 0xDA, 0x41, 0x7D, 0xF8, 0x7D, 0x41, 0x20, 0xF8, 0x7D, 0x4A, 0x8D, 0x1B, 0x7C, 0x4A, 0xEF, 0x51, 0xC9, 0x1B, 0x51, 0x0E, 0x7C, 0x50, 0x0E, 0x0E, 0x19, 0xB0, 0x7C, 0x43, 0x19, 0x0E, 0x7E, 0xC9, 0x3B, 0x04, 0x9F, 0x0E, 0x4A, 0xFB, 0xFB, 0xFB, 0xCD, 0x12, 0xD7, 0x5E, 0x07, 0x17, 0x11, 0x42, 0x18, 0x18, 0xE3, 0x14, 0xF9, 0xB4, 0xF9, 0x00, 0xD7, 0x64, 0x64, 0x5E, 0x5C, 0x58, 0x93, 0x55, 0xAC, 0x26, 0xB7, 0x3B, 0xB6, 0xB5, 0xC3, 0x9E, 0x41, 0x6B, 0xED, 0x02, 0x16, 0x16, 0x8E, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0xC8, 0x96, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0xBF, 0xCA, 0xC7, 0xCA, 0xBF, 0xFD, 0x71, 0x71, 0x96, 0x8E, 0x94, 0x96, 0x96, 0x96, 0x71, 0x96, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0xCA, 0x7A, 0xE2, 0xA1, 0xA1, 0xD2, 0x4D, 0x06, 0x06, 0x71, 0x06, 0x96, 0x96, 0x96, 0x96, 0xEA, 0x6F, 0x9E, 0xE5, 0xBD, 0xBD, 0xBD, 0x4B, 0x8D, 0xD7, 0xA3, 0x14, 0x81, 0xE5, 0xFE, 0x42, 0xAA, 0xCC, 0xCC, 0x70, 0xA3, 0xB4, 0xFB, 0xF9, 0xD7, 0x70, 0x17, 0x54, 0xDD, 0x9D, 0x90, 0x90, 0x90, 0x4F, 0x90, 0x66, 0x66, 0x79, 0x79, 0x79, 0x66, 0x79, 0x66, 0xCE, 0xCE, 0xCE, 0x55, 0xE0, 0x55, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x67, 0x58, 0x9D, 0x98, 0x98, 0x9D, 0x90, 0x1E, 0xA5, 0xB1, 0xA5, 0xB1, 0x28, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x59, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xD9, 0xAE, 0xAE,
+	0x8F, 0x6F, 0x8F, 0xBB, 0x52, 0x52, 0xD7, 0x8D, 0x8D, 0xA3, 0x99, 0x9A, 0x72, 0x99, 0x02, 0x40, 0x96, 0xDD, 0xC7, 0xC7, 0xE4, 0xDB, 0xE4, 0x80, 0x80, 0x80, 0x92, 0xE4, 0x24, 0x0B, 0x08, 0x08, 0x8E, 0x02, 0xED, 0xBB, 0xF8, 0x13, 0xF8, 0x7D, 0xC1, 0xEA, 0x7D, 0x7D, 0x20, 0x12, 0x4A, 0x1B, 0x1B, 0x7E, 0x7E, 0x7C, 0x1B, 0x31, 0x31, 0x04, 0x7E, 0xAD, 0x0E, 0x0E, 0x19, 0x51, 0x7C, 0x43, 0x43, 0x0E, 0xB0, 0x7C, 0x04, 0x0E, 0xD6, 0x10, 0x83, 0x68, 0xE6, 0xF9, 0x26, 0x26, 0xBC, 0x70, 0xA3, 0xEE, 0x20, 0x42, 0x33, 0xF9, 0xF9, 0xF9, 0xFB, 0x81, 0xFA, 0xB5, 0x76, 0xAA, 0x64, 0x55, 0x8B, 0xB9, 0x4F, 0x5F, 0x8C, 0xB5, 0x00, 0x3B, 0xB7, 0xB6, 0xC3, 0xFE, 0x20, 0x6F, 0xEE, 0xED, 0x16, 0x8E, 0x94, 0xC8, 0xC8, 0x96, 0x96, 0xC8, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xFD, 0x71, 0xC8, 0x8E, 0x94, 0x96, 0x71, 0x71, 0x71, 0x71, 0x96, 0x96, 0xC8, 0x96, 0x96, 0xBF, 0x89, 0x32, 0x95, 0x95, 0x3D, 0xA9, 0x06, 0x71, 0x71, 0x4D, 0x96, 0x96, 0xF8, 0xF8, 0xEA, 0x8D, 0xE5, 0xE5, 0x04, 0xBD, 0x86, 0xCD, 0x8D, 0xD7, 0x5A, 0x14, 0x81, 0xE5, 0xC4, 0x5E, 0x78, 0xCC, 0xCB, 0x48, 0x26, 0x82, 0xB7, 0xF9, 0x12, 0x8B, 0x06, 0x54, 0x4D, 0x79, 0x90, 0x90, 0x90, 0x90, 0x55, 0x90, 0x79, 0x79, 0x66, 0x79, 0x66, 0x79, 0x66, 0x79, 0x9C, 0x66, 0x66, 0x66, 0xE0, 0xE0, 0x9C, 0x9C, 0x66, 0x9C, 0xE0, 0x58, 0x8B, 0xB8, 0x98, 0x9D, 0x39, 0x59, 0x1E, 0xA5, 0xB1, 0xB1, 0x28, 0xB1, 0xB1, 0x28, 0xB1, 0x28, 0x59, 0x28, 0x28, 0x59, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+	0x6F, 0x8F, 0x52, 0x6F, 0x52, 0x52, 0x52, 0x5A, 0x8D, 0x8D, 0x8D, 0x99, 0x72, 0x99, 0x02, 0x40, 0xDF, 0x4D, 0xC7, 0xDB, 0x24, 0xE4, 0xE4, 0xE4, 0x7F, 0xE4, 0x80, 0xE4, 0x24, 0x0B, 0x08, 0xC8, 0x8E, 0x16, 0x8E, 0xF8, 0xEA, 0xEA, 0xC1, 0x6F, 0xEA, 0xEA, 0x7D, 0x7D, 0x52, 0x4A, 0x4A, 0x1B, 0x7D, 0x51, 0x7D, 0x1B, 0x31, 0x04, 0x0E, 0x7C, 0x19, 0x7C, 0x0E, 0x0E, 0xB0, 0x19, 0x31, 0x19, 0x43, 0x0E, 0x7C, 0x19, 0x3B, 0x0E, 0xBD, 0x45, 0x45, 0x12, 0xE5, 0xF9, 0xB4, 0x10, 0xC9, 0xB4, 0xFA, 0x97, 0x26, 0x03, 0x1B, 0xF9, 0xF9, 0xE5, 0xE5, 0x81, 0x00, 0xE3, 0x56, 0x34, 0x5F, 0x36, 0x61, 0x5F, 0x32, 0x37, 0xA3, 0x00, 0x00, 0xB6, 0xB4, 0xB4, 0x3A, 0x9A, 0x20, 0x6F, 0xED, 0x02, 0x16, 0x8E, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xC7, 0xBF, 0xC7, 0xC7, 0xBF, 0xFD, 0x71, 0x71, 0x96, 0x8E, 0xC8, 0xC8, 0x71, 0x71, 0x96, 0x71, 0x96, 0x96, 0xC8, 0xC8, 0xC8, 0x71, 0xD0, 0x32, 0xB3, 0x77, 0x36, 0x06, 0xBF, 0xFD, 0x71, 0x71, 0x71, 0x96, 0xF8, 0xF8, 0x12, 0xFE, 0xE5, 0x04, 0x45, 0xBD, 0x86, 0x4B, 0x8D, 0xA3, 0x12, 0xC3, 0x86, 0xE5, 0xE5, 0x33, 0xAA, 0xD3, 0x2E, 0x49, 0xD7, 0x81, 0xFB, 0xFA, 0x18, 0x11, 0x4D, 0x9D, 0xDD, 0x79, 0x90, 0x90, 0x37, 0x66, 0x90, 0x66, 0x66, 0x79, 0x66, 0x66, 0x66, 0xCE, 0xCE, 0xCE, 0x55, 0x66, 0x55, 0x55, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x58, 0x48, 0xFC, 0xFC, 0x84, 0x90, 0x59, 0xB1, 0xA5, 0xB1, 0xA5, 0xB1, 0xB1, 0x28, 0x28, 0x28, 0x59, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xD9, 0xAE,
+	0x8F, 0x6F, 0x52, 0x52, 0x6F, 0x52, 0x52, 0x52, 0x8D, 0xEE, 0x9E, 0x99, 0x72, 0x4C, 0x6F, 0x40, 0x96, 0xDD, 0xC7, 0xC7, 0xE4, 0xDB, 0xE4, 0xE4, 0xE4, 0xE4, 0x1E, 0xE4, 0xC7, 0x0B, 0x08, 0xC8, 0x3E, 0x6F, 0x6F, 0x52, 0x6F, 0x6F, 0xDA, 0xC1, 0xDA, 0xEA, 0xF8, 0x7D, 0x20, 0x1B, 0x4A, 0x1B, 0x1B, 0x7E, 0xEF, 0x7C, 0x4A, 0xC9, 0x04, 0xEF, 0x19, 0x7C, 0x0E, 0x0E, 0xB0, 0xAD, 0x7C, 0x19, 0x5B, 0xB0, 0x0E, 0x43, 0xC9, 0x04, 0x9F, 0x4A, 0xCD, 0x12, 0x73, 0x00, 0xB7, 0x10, 0x10, 0x9F, 0xB6, 0xE1, 0xEF, 0xD6, 0x97, 0x97, 0x81, 0x81, 0x81, 0xB7, 0x00, 0x49, 0x32, 0x7B, 0x3D, 0x3D, 0xBE, 0x32, 0x8B, 0xA3, 0x6C, 0xB2, 0x6C, 0x6C, 0xB4, 0xB4, 0xE5, 0x9E, 0x41, 0x07, 0xED, 0x02, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0xBF, 0xBF, 0xBF, 0xBF, 0x71, 0x71, 0x4D, 0x8E, 0x96, 0x08, 0x96, 0x02, 0x4C, 0x02, 0x8E, 0x8E, 0xC8, 0xC8, 0x96, 0x71, 0xBF, 0x93, 0x32, 0xE2, 0xC0, 0x4D, 0xFD, 0x71, 0x71, 0x71, 0x71, 0xF8, 0xF8, 0x7D, 0x6B, 0x81, 0x81, 0xBD, 0xBD, 0xBD, 0x9E, 0x8D, 0x12, 0x9E, 0x12, 0xFE, 0xFE, 0xC3, 0xE5, 0x12, 0x2F, 0xAA, 0x8C, 0x48, 0x12, 0x82, 0x82, 0xC3, 0x5E, 0x11, 0x79, 0xDD, 0x9D, 0x90, 0x90, 0x90, 0x4F, 0x90, 0x55, 0x90, 0x66, 0x79, 0x66, 0x53, 0xCE, 0xCE, 0xCE, 0x66, 0x55, 0xE0, 0x9C, 0x9C, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x48, 0x67, 0x98, 0xB8, 0x84, 0x90, 0xB1, 0x1E, 0x1E, 0xB1, 0xB1, 0x28, 0xB1, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x59, 0x28, 0x59, 0x28, 0xAE, 0x28, 0xC6, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+	0x52, 0x52, 0x6F, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6B, 0x8D, 0xEE, 0x99, 0x4C, 0xED, 0x16, 0x6A, 0x4D, 0xFD, 0xC7, 0x24, 0xDB, 0xE4, 0x24, 0xE4, 0x39, 0xE4, 0x7F, 0xE4, 0x24, 0xFD, 0xC2, 0x08, 0x3E, 0x6F, 0xED, 0xBB, 0x6B, 0x6F, 0x6F, 0xC1, 0xEA, 0xC1, 0x7D, 0xC1, 0x12, 0x1B, 0x4A, 0x51, 0x1B, 0xEF, 0x7E, 0x1B, 0xC9, 0x3B, 0x31, 0x43, 0x7C, 0xC9, 0x51, 0x0E, 0x7C, 0xAD, 0x7C, 0xAD, 0x5B, 0x19, 0x0E, 0x19, 0x31, 0x6D, 0x04, 0x26, 0x12, 0xCD, 0x73, 0x3A, 0x97, 0xB7, 0xFB, 0x25, 0x26, 0x03, 0xD4, 0x10, 0xB7, 0x68, 0xF9, 0x81, 0xFA, 0x00, 0xA3, 0x44, 0xD4, 0xE8, 0xF1, 0xF1, 0x91, 0xD4, 0xA3, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xB4, 0xB4, 0xE5, 0x9A, 0x42, 0x07, 0x02, 0x02, 0x8E, 0x8E, 0x94, 0x8E, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x08, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0xBF, 0xC7, 0xBF, 0xFD, 0xBF, 0x71, 0xC8, 0xC8, 0x96, 0xC8, 0x02, 0x4C, 0x4C, 0x8E, 0x8E, 0x16, 0x8E, 0x8E, 0x96, 0x71, 0x93, 0xD2, 0xA4, 0xA2, 0x06, 0x4D, 0xBF, 0x71, 0x71, 0x96, 0x96, 0xF8, 0x6F, 0x86, 0xE5, 0x45, 0x45, 0xBD, 0xBD, 0x9A, 0xA3, 0x12, 0x9E, 0x52, 0x9A, 0xFE, 0x9A, 0x3A, 0xA3, 0xCC, 0x7A, 0x8B, 0x8C, 0x20, 0xFB, 0x73, 0xD7, 0x8B, 0x17, 0x79, 0x9D, 0xDD, 0x79, 0x90, 0x90, 0x4F, 0x55, 0x4F, 0x66, 0x79, 0x66, 0x79, 0x66, 0xCE, 0x53, 0xCE, 0x55, 0x66, 0x55, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x8C, 0x58, 0xFC, 0x84, 0x9D, 0x39, 0x59, 0x1E, 0xA5, 0xB1, 0x28, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xB3, 0xAE, 0xAE, 0xAE,
+	0x52, 0x52, 0x52, 0x02, 0x6B, 0x52, 0x52, 0x5A, 0x6B, 0x6B, 0x6B, 0xEE, 0xEE, 0x02, 0xC1, 0xF8, 0xFD, 0x53, 0xC7, 0xDB, 0x24, 0x24, 0xDB, 0xE4, 0x7F, 0xE4, 0x80, 0xE4, 0x24, 0xC7, 0x08, 0x08, 0x4E, 0xBB, 0x02, 0x02, 0x6F, 0x6F, 0xC1, 0xC1, 0xC1, 0xEA, 0xF8, 0x20, 0x1B, 0x6F, 0x7C, 0x1B, 0x1B, 0x1B, 0x1B, 0x4A, 0x04, 0x0E, 0x75, 0x50, 0xC9, 0x7C, 0x51, 0x0E, 0x7C, 0x19, 0xB0, 0xAD, 0x19, 0x43, 0x0E, 0x43, 0xB0, 0xB7, 0x6D, 0x68, 0x73, 0x12, 0x20, 0xCD, 0xB7, 0xFB, 0xFB, 0x3B, 0x1B, 0x03, 0x1B, 0xB4, 0xB4, 0xCD, 0xB4, 0xB4, 0xB4, 0xC4, 0x5E, 0x13, 0x55, 0x7B, 0x5F, 0xBE, 0x46, 0xE3, 0x00, 0x6C, 0xB2, 0xB2, 0xA3, 0xB6, 0xB4, 0xB4, 0x82, 0x9E, 0x42, 0x07, 0x52, 0x16, 0x8E, 0x8E, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xC7, 0xBF, 0xC7, 0xBF, 0xBF, 0x71, 0xFD, 0x71, 0x96, 0xC8, 0xC8, 0xC8, 0x94, 0x94, 0x94, 0x94, 0x8E, 0x8E, 0x8E, 0x8E, 0xC8, 0x71, 0x93, 0x93, 0x7F, 0xA2, 0xCA, 0x71, 0x71, 0x71, 0x96, 0x96, 0x4D, 0xF8, 0x8D, 0x81, 0x45, 0xBD, 0xBD, 0x45, 0x10, 0x9E, 0xA3, 0x8F, 0x8D, 0x8D, 0x9A, 0xC3, 0x9A, 0xFA, 0x3F, 0x11, 0x44, 0x64, 0x2E, 0x7D, 0xE5, 0xC3, 0x18, 0x54, 0x17, 0x79, 0xDD, 0x9D, 0xC7, 0x90, 0x90, 0xCB, 0x66, 0x90, 0x4F, 0x66, 0x79, 0x66, 0x66, 0xCE, 0xCE, 0xCE, 0x66, 0xE0, 0x55, 0x9C, 0x9C, 0x9C, 0x66, 0x9C, 0x9C, 0x9C, 0x9C, 0x48, 0x58, 0xB8, 0x84, 0x66, 0xB1, 0x59, 0x1E, 0xA5, 0xB1, 0xB1, 0xB1, 0xB1, 0x28, 0x28, 0x28, 0x59, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0xAE, 0xD9, 0x23, 0xD9, 0xAE, 0xAE,
+	0x52, 0x6F, 0x52, 0xBB, 0x6B, 0x52, 0x5A, 0x52, 0xEE, 0x6B, 0x6B, 0xED, 0xED, 0xBB, 0xEA, 0x96, 0xBF, 0xFD, 0xC7, 0x24, 0xDB, 0x24, 0xE4, 0xE4, 0xE4, 0x80, 0x92, 0xE4, 0xE4, 0xFD, 0xC2, 0xC8, 0x4E, 0x02, 0x6B, 0x6B, 0x6F, 0x6F, 0x16, 0xDA, 0xEA, 0xEA, 0x7D, 0xEA, 0x12, 0x4A, 0x12, 0x1B, 0x1B, 0x4A, 0xE1, 0xBD, 0x3B, 0x7E, 0x7E, 0x7C, 0x7C, 0x7C, 0xB0, 0x31, 0x31, 0x19, 0xB0, 0xAD, 0x19, 0x43, 0xAD, 0xAD, 0x19, 0x6D, 0xB7, 0x73, 0xFA, 0x35, 0x89, 0x18, 0xF9, 0x97, 0xFB, 0x6D, 0x60, 0x35, 0xCD, 0xFA, 0x4B, 0x12, 0xE3, 0xD6, 0xE3, 0xBC, 0x42, 0x42, 0x8B, 0xBA, 0x34, 0xFF, 0xA6, 0xB6, 0xB7, 0xB2, 0x9F, 0x26, 0x25, 0xF9, 0xB4, 0xB4, 0xE5, 0x4B, 0x42, 0x07, 0x02, 0x02, 0x8E, 0x8E, 0x8E, 0x94, 0xC8, 0xC8, 0xC8, 0x96, 0xC8, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0xBF, 0xBF, 0xBF, 0xBF, 0x71, 0x96, 0xC8, 0xC8, 0xC8, 0x08, 0x96, 0xC8, 0xC8, 0x94, 0xC8, 0x96, 0xBF, 0xD0, 0x89, 0xD2, 0xD0, 0xBF, 0x06, 0x06, 0x71, 0x71, 0x96, 0xF8, 0xF8, 0x20, 0x9E, 0xE5, 0x86, 0xBD, 0x04, 0x04, 0xC9, 0x14, 0xD7, 0x12, 0x8D, 0x8D, 0x9E, 0xFE, 0x9E, 0xF9, 0xC3, 0x48, 0x88, 0x58, 0x8C, 0xA6, 0x3F, 0xC4, 0x5C, 0x17, 0xCF, 0x79, 0x9D, 0xDC, 0x90, 0x90, 0x90, 0xCB, 0x4F, 0x66, 0x4F, 0x79, 0x66, 0x66, 0x53, 0xCE, 0x53, 0x55, 0x55, 0x55, 0x66, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x67, 0x8B, 0xFC, 0x84, 0x90, 0x59, 0x1E, 0x1E, 0xA5, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x59, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xD9, 0xAE, 0xAE, 0xAE,
+	0x52, 0x52, 0xBB, 0x6B, 0x52, 0x02, 0x02, 0x5A, 0x6B, 0x6B, 0x6B, 0x52, 0x52, 0x6F, 0xEA, 0x71, 0x06, 0xDC, 0xDB, 0xC7, 0x24, 0x24, 0xDB, 0xE4, 0xE4, 0x80, 0xE4, 0xE4, 0xE4, 0xC7, 0xC2, 0x08, 0x4E, 0xBB, 0x4C, 0x02, 0x02, 0x6F, 0x16, 0x16, 0xEA, 0xF8, 0x41, 0x7D, 0x12, 0xBD, 0xC9, 0x1B, 0x7C, 0xE1, 0xBD, 0x04, 0x51, 0x7E, 0x4A, 0x04, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7E, 0x7C, 0xAD, 0xAD, 0x19, 0x19, 0xAD, 0x19, 0x0E, 0xB7, 0x14, 0xB4, 0x33, 0x2F, 0x1C, 0x4A, 0xB7, 0x6D, 0x25, 0x1B, 0xD6, 0x26, 0x3F, 0xE3, 0xE3, 0xA6, 0xAC, 0xD4, 0xCC, 0x41, 0x5C, 0x5E, 0x01, 0x91, 0x62, 0x97, 0xFB, 0xB6, 0x97, 0x9F, 0xD6, 0x9F, 0x3F, 0xB4, 0xB4, 0xE5, 0x4B, 0x42, 0x41, 0x02, 0x02, 0x8E, 0x8E, 0x94, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x08, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0xBF, 0xCA, 0xBF, 0xBF, 0xBF, 0x71, 0x71, 0x71, 0x71, 0x96, 0x96, 0xC8, 0x96, 0x71, 0x08, 0x96, 0x71, 0x89, 0x89, 0x32, 0x89, 0x92, 0xCA, 0x53, 0xBF, 0x06, 0x4D, 0x4D, 0x4D, 0xF8, 0x70, 0x6B, 0xC3, 0xE5, 0xBD, 0x04, 0x83, 0xBD, 0x9F, 0x14, 0x12, 0x52, 0x12, 0x52, 0x9E, 0x9E, 0x9A, 0xE5, 0xE5, 0x7D, 0x46, 0x8C, 0x70, 0xA6, 0x8D, 0x72, 0x01, 0x06, 0x9C, 0xDD, 0x79, 0x79, 0x90, 0x90, 0x90, 0xCB, 0x4F, 0x4F, 0x66, 0x79, 0x66, 0x9C, 0x66, 0xCE, 0xCE, 0x66, 0xE0, 0x55, 0x9C, 0xE0, 0x9C, 0x66, 0x9C, 0x9C, 0x9C, 0x54, 0x67, 0x58, 0xFC, 0xB8, 0x84, 0x90, 0xB1, 0xA5, 0x1E, 0xA5, 0xB1, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x59, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+	0x52, 0x52, 0x02, 0x52, 0x52, 0x52, 0x52, 0x52, 0x6B, 0x6B, 0x6B, 0x5A, 0xBB, 0xC1, 0x6A, 0x4D, 0x71, 0x53, 0xC7, 0xDB, 0x24, 0x24, 0xE4, 0xE4, 0xDB, 0x80, 0x1E, 0xE4, 0xCA, 0x0B, 0xC2, 0x08, 0x8E, 0xBB, 0x02, 0x02, 0xBB, 0x6F, 0x6F, 0x6F, 0xC1, 0xEA, 0xF8, 0x30, 0x52, 0xBD, 0xC9, 0x1B, 0x4A, 0xE1, 0xBD, 0x1B, 0x50, 0x7C, 0x04, 0xC9, 0x31, 0x7C, 0x31, 0x51, 0xAD, 0xAD, 0xAD, 0x19, 0xB0, 0xB0, 0x43, 0x19, 0xEC, 0xB0, 0xFB, 0xB5, 0x73, 0x12, 0x1F, 0x70, 0x8D, 0x81, 0xBD, 0xD6, 0x86, 0x81, 0x60, 0xE3, 0xA6, 0xA6, 0xAC, 0x62, 0x89, 0x42, 0x8F, 0xF4, 0x8B, 0x88, 0xD5, 0xD7, 0xB5, 0xB6, 0x68, 0x68, 0x9F, 0x4B, 0x3F, 0x10, 0x68, 0xBD, 0x82, 0x8D, 0x42, 0x41, 0x02, 0xBB, 0x8E, 0x8E, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0xCA, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x71, 0x71, 0x71, 0x71, 0x96, 0x71, 0xD0, 0xD0, 0xBF, 0xD0, 0x89, 0x32, 0x32, 0xD2, 0xD0, 0xD0, 0xBF, 0xBF, 0x71, 0x4D, 0xF8, 0x4D, 0xF8, 0xEA, 0x9E, 0x86, 0x81, 0xBD, 0xB6, 0x04, 0x10, 0x10, 0x4B, 0x18, 0x52, 0x12, 0x52, 0xFE, 0x4B, 0x9A, 0xE5, 0xFA, 0x20, 0x76, 0xE0, 0x8B, 0x20, 0xD7, 0xAF, 0xE7, 0x06, 0x79, 0x84, 0xDD, 0x90, 0x0B, 0x90, 0x66, 0x90, 0x66, 0x4F, 0x66, 0x79, 0x90, 0x9C, 0x66, 0x55, 0x55, 0x55, 0x55, 0xE0, 0xE0, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x67, 0x58, 0x58, 0xB8, 0x84, 0x67, 0x39, 0x59, 0x1E, 0x1E, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xA0, 0xD9, 0x23, 0xD9,
+	0x52, 0xBB, 0x52, 0x6B, 0x02, 0x52, 0xBB, 0x6B, 0x52, 0xEE, 0x99, 0x6B, 0xBB, 0x41, 0xF8, 0xF8, 0xBF, 0xC7, 0xC7, 0xDB, 0xC7, 0x24, 0xDB, 0xE4, 0xE4, 0x80, 0x7F, 0xE4, 0xE4, 0x0B, 0xC2, 0xC8, 0x65, 0x02, 0xED, 0x02, 0x02, 0x16, 0xC1, 0xC1, 0xEA, 0x7D, 0x13, 0x13, 0x12, 0xC9, 0xC9, 0x1B, 0x7C, 0x4A, 0x51, 0xEF, 0x1B, 0xC9, 0x04, 0x0E, 0x4A, 0x7C, 0xC9, 0x7C, 0x51, 0xAD, 0x51, 0x19, 0xB0, 0xB0, 0xEC, 0xAD, 0x43, 0x7E, 0x10, 0x26, 0x26, 0x12, 0x20, 0x20, 0x10, 0x4A, 0x4A, 0x45, 0xF9, 0x26, 0xBC, 0x1F, 0x49, 0x2C, 0x62, 0x89, 0x64, 0xAF, 0x5C, 0x42, 0x21, 0x91, 0xB9, 0x00, 0xB6, 0x4A, 0x9F, 0xCD, 0x9F, 0x10, 0x4A, 0x10, 0xBD, 0xCD, 0x81, 0xCD, 0x7D, 0x18, 0xBB, 0x29, 0x8E, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x71, 0x71, 0x71, 0x71, 0xCA, 0x89, 0x89, 0xCA, 0xD0, 0x89, 0x32, 0xE2, 0x32, 0x93, 0xD0, 0xBF, 0x71, 0x06, 0x4D, 0x4D, 0x17, 0xF8, 0x12, 0xC3, 0x86, 0x10, 0x04, 0x04, 0x9F, 0xC9, 0x4A, 0x14, 0x33, 0x8D, 0xD7, 0x6B, 0xFE, 0x8D, 0x9E, 0xBD, 0xF9, 0x33, 0x2F, 0xCC, 0x8B, 0x18, 0x8F, 0x6F, 0x84, 0x79, 0x9D, 0x84, 0x79, 0x90, 0x79, 0x66, 0x90, 0x66, 0x4F, 0x66, 0x55, 0x66, 0x66, 0x55, 0x55, 0x66, 0x55, 0x66, 0xE0, 0xE0, 0xE0, 0x66, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x58, 0x58, 0x58, 0x98, 0x84, 0x9D, 0x39, 0x59, 0x1E, 0xA5, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0xB1, 0x28, 0x28, 0x28, 0xAE, 0x28, 0x59, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xD9, 0xAE, 0xAE, 0xB3, 0xB3,
+	0x52, 0x52, 0x52, 0xED, 0xED, 0x52, 0x6B, 0x52, 0x6B, 0xEE, 0x99, 0xED, 0x52, 0xC1, 0xF8, 0x71, 0x79, 0xFD, 0xDB, 0xC7, 0xE4, 0xDB, 0xE4, 0xE4, 0xE4, 0x80, 0x1E, 0xE4, 0x24, 0xC7, 0xC2, 0x08, 0x5D, 0x6F, 0x02, 0x02, 0x02, 0x02, 0xDA, 0x6F, 0xC1, 0x13, 0x13, 0xEA, 0x12, 0x4A, 0x4A, 0x7C, 0x7C, 0x7E, 0x75, 0xE1, 0xC9, 0xBD, 0x3B, 0x0E, 0xC9, 0x31, 0x31, 0x31, 0x7C, 0x0E, 0x51, 0x19, 0xAD, 0x7C, 0x19, 0xAD, 0x19, 0x0C, 0x1B, 0x4A, 0x33, 0xE3, 0x33, 0x33, 0x8D, 0xBD, 0x4A, 0x83, 0x81, 0x7D, 0xD4, 0x2C, 0xCC, 0x62, 0xE8, 0xAA, 0x8F, 0x5C, 0x8F, 0x5E, 0x57, 0x1F, 0x00, 0x6C, 0xB5, 0xB6, 0xB4, 0x73, 0xBD, 0x4B, 0x8D, 0x10, 0x4B, 0x3F, 0x82, 0xC3, 0x42, 0x20, 0x07, 0xA8, 0x8E, 0x94, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x08, 0x71, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0x71, 0x71, 0x71, 0x06, 0x06, 0x71, 0x71, 0xBF, 0xD0, 0x89, 0xE2, 0x93, 0xA4, 0xF1, 0xE2, 0xE2, 0xE2, 0x93, 0xCA, 0xBF, 0xBF, 0x4D, 0x4D, 0x17, 0xF8, 0x7D, 0xFE, 0xC3, 0xBD, 0xBD, 0x9F, 0x3B, 0xB6, 0x4A, 0x26, 0xA3, 0x8F, 0x52, 0x8D, 0x8D, 0xA3, 0xA3, 0xC3, 0x81, 0xF9, 0xD7, 0xCC, 0xA2, 0x58, 0x20, 0x8F, 0x01, 0xA9, 0x79, 0x2B, 0x2B, 0x90, 0xC7, 0x66, 0x79, 0x66, 0x90, 0x66, 0x53, 0xCE, 0xCE, 0xCE, 0x9C, 0x66, 0xE0, 0x55, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x64, 0x58, 0xFC, 0x6E, 0x66, 0xB1, 0x59, 0xA5, 0xB1, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x59, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x23, 0xD9, 0xA0, 0xAE, 0xAE,
+	0x52, 0x5A, 0x52, 0x6B, 0x52, 0xED, 0x52, 0x52, 0x6B, 0xEE, 0x99, 0xED, 0x6F, 0xDA, 0xF8, 0x4D, 0xBF, 0x79, 0xC7, 0xDB, 0x24, 0x24, 0xE4, 0xDB, 0xE4, 0xE4, 0x7F, 0xE4, 0x24, 0xC7, 0xC2, 0x08, 0x8E, 0x02, 0xED, 0xED, 0x02, 0x6F, 0x6F, 0xC1, 0x13, 0xF8, 0xEA, 0x7D, 0x12, 0x4A, 0x4A, 0x1B, 0x51, 0xEF, 0x4A, 0xBD, 0xC9, 0xC9, 0xC9, 0x0E, 0x31, 0x0E, 0x7C, 0xC9, 0x7C, 0x7C, 0x7C, 0xAD, 0x7C, 0x31, 0xAD, 0x19, 0x19, 0x43, 0x51, 0x9F, 0x03, 0x18, 0x4B, 0x4A, 0x73, 0x00, 0x86, 0x4B, 0x33, 0x1F, 0x22, 0x2C, 0x7B, 0xBE, 0x32, 0x98, 0x8F, 0xF4, 0xAF, 0x11, 0x46, 0xB2, 0x6C, 0xB2, 0xB2, 0xB5, 0xB5, 0xC3, 0xC3, 0x14, 0x4B, 0x26, 0x86, 0x73, 0x82, 0xC3, 0x20, 0x41, 0x5C, 0x6F, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x08, 0x96, 0x71, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xFD, 0xBF, 0x71, 0x53, 0x06, 0xBF, 0xBF, 0xBF, 0xD0, 0xE2, 0x77, 0xD2, 0x7B, 0xF1, 0xE2, 0xE2, 0xF1, 0xD0, 0xCA, 0x71, 0x06, 0x4D, 0xF8, 0x13, 0xF8, 0xD7, 0xE5, 0x45, 0xBD, 0x04, 0xBD, 0x04, 0x68, 0x4A, 0x10, 0x8D, 0x33, 0x52, 0x8D, 0x8D, 0xA3, 0x8D, 0x9A, 0x81, 0xF9, 0x26, 0x13, 0xCC, 0x8B, 0x5C, 0x5C, 0x87, 0xA9, 0xDD, 0x84, 0xDD, 0x90, 0x90, 0x79, 0x90, 0x66, 0x90, 0x66, 0xCE, 0xCE, 0x53, 0xCE, 0x9C, 0x55, 0x55, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x54, 0x9C, 0x58, 0x58, 0x58, 0xFC, 0x84, 0x90, 0xB1, 0xB1, 0xA5, 0xB1, 0xA5, 0x28, 0x28, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x23, 0xD9, 0xAE, 0xAE, 0xA0, 0xAE,
+	0x6B, 0x6B, 0x52, 0xED, 0x52, 0xED, 0xED, 0x6B, 0xED, 0xEE, 0xEE, 0x52, 0x52, 0xC1, 0x87, 0x4D, 0xFD, 0x53, 0xC7, 0x24, 0xDB, 0x24, 0xDB, 0xE4, 0xE4, 0x80, 0xE4, 0xE4, 0xE4, 0xC7, 0xC2, 0x08, 0x4E, 0x02, 0x02, 0xED, 0x02, 0x6F, 0x6F, 0xF8, 0x13, 0xEA, 0x7D, 0x7D, 0x12, 0xC9, 0x1B, 0x1B, 0xEF, 0x7E, 0x04, 0xBD, 0xC9, 0x7C, 0x31, 0x04, 0x31, 0x0E, 0x7C, 0xC9, 0x7C, 0x7C, 0x31, 0xAD, 0x7C, 0x31, 0x51, 0x43, 0x7E, 0x19, 0x7E, 0x25, 0x1C, 0x60, 0xB4, 0xF9, 0xA3, 0x4B, 0x26, 0x20, 0x35, 0x7D, 0x2C, 0x2C, 0x7B, 0x91, 0xCB, 0xA8, 0x8F, 0x8F, 0xB9, 0x56, 0x12, 0x00, 0x6C, 0xB2, 0xA3, 0x14, 0xB5, 0x14, 0xB2, 0x3F, 0xA3, 0x26, 0x73, 0x82, 0x82, 0xC3, 0x18, 0x18, 0x07, 0x6F, 0x16, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x08, 0x08, 0x96, 0x71, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xFD, 0x71, 0x71, 0x71, 0x4D, 0x79, 0x79, 0xFD, 0xBF, 0xBF, 0x93, 0xE2, 0x77, 0xE8, 0x36, 0xF1, 0x77, 0xF0, 0x32, 0x7A, 0x0F, 0x71, 0x71, 0x4D, 0x17, 0x17, 0x42, 0x73, 0x82, 0x45, 0x9F, 0x04, 0x68, 0x68, 0x68, 0x10, 0x4B, 0xD7, 0x8F, 0x52, 0x6B, 0xEE, 0x99, 0xA3, 0x9A, 0x81, 0xFB, 0x4B, 0x48, 0x37, 0x98, 0x5C, 0xA8, 0xA9, 0x2B, 0xDD, 0x79, 0x9D, 0x79, 0x90, 0x2B, 0x66, 0x90, 0x66, 0x4F, 0xCE, 0xCE, 0xCE, 0x55, 0xE0, 0xE0, 0x66, 0xE0, 0x9C, 0x9C, 0x66, 0x9C, 0x9C, 0xE0, 0xCF, 0xE0, 0xE0, 0x9C, 0x58, 0x84, 0x8B, 0x98, 0x84, 0x90, 0xB1, 0xA5, 0xB1, 0xA5, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x59, 0x28, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xA0, 0xAE, 0xD9, 0xAE, 0xB3,
+	0x5A, 0x6B, 0x6B, 0xED, 0x6B, 0x6B, 0x6B, 0x6B, 0xEE, 0x9E, 0xED, 0x6B, 0x6F, 0x07, 0xEB, 0x54, 0xFD, 0xFD, 0xDB, 0xC7, 0xE4, 0x24, 0xE4, 0xE4, 0xDB, 0x80, 0xB1, 0xE4, 0x24, 0xC7, 0xC2, 0x08, 0x8E, 0xBB, 0x4C, 0x02, 0x6F, 0x52, 0xEA, 0x13, 0x41, 0x41, 0x7D, 0x7D, 0x4A, 0x4A, 0x1B, 0x51, 0x7E, 0x1B, 0x45, 0x0E, 0xC9, 0x7C, 0xC9, 0x31, 0xC9, 0x4A, 0x7C, 0x7C, 0x31, 0x0E, 0x31, 0x7C, 0x51, 0x0E, 0x31, 0xAD, 0x19, 0x7E, 0x19, 0xEF, 0xD8, 0xB2, 0xB5, 0xF9, 0xB5, 0xA6, 0x7D, 0x60, 0xE3, 0xA6, 0x2C, 0xCC, 0x32, 0x88, 0x5C, 0x8F, 0x5C, 0x8F, 0x74, 0xE3, 0x00, 0x6C, 0x14, 0xA3, 0xA3, 0xB2, 0x14, 0xB2, 0xFE, 0x14, 0xD7, 0x8D, 0x4B, 0xB5, 0x82, 0xC3, 0x18, 0x20, 0x41, 0x6F, 0x16, 0x8E, 0xC8, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x08, 0x71, 0x71, 0x71, 0x96, 0x71, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0xBF, 0x71, 0xBF, 0x71, 0xBF, 0xBF, 0xFD, 0x71, 0x06, 0x4D, 0xBF, 0xBF, 0xDB, 0x93, 0x32, 0x77, 0xD2, 0xE8, 0xE2, 0x77, 0x32, 0x32, 0x93, 0x06, 0x71, 0x4D, 0x17, 0x4D, 0x17, 0x12, 0xFA, 0xB4, 0x04, 0x9F, 0x9F, 0x04, 0x68, 0x68, 0xA3, 0x26, 0x26, 0x33, 0x6B, 0x8D, 0xA3, 0x99, 0xA3, 0x9A, 0x81, 0x83, 0xCD, 0x1F, 0x76, 0xFC, 0x5E, 0xF4, 0x9D, 0xA9, 0x84, 0xDD, 0x79, 0x66, 0x90, 0x90, 0x66, 0x90, 0xC0, 0x66, 0x53, 0xCE, 0x55, 0x66, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0xCF, 0xE0, 0xE0, 0xE0, 0x9C, 0x9C, 0x58, 0x58, 0x98, 0x6E, 0x84, 0x90, 0xB1, 0xA5, 0xB1, 0x28, 0x59, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x59, 0x28, 0xAE, 0x28, 0xAE, 0x23, 0xD9, 0xA0, 0x28, 0x23, 0xD9, 0xA0, 0xAE,
+	0xD7, 0x6B, 0xEE, 0x9E, 0xED, 0x6B, 0x52, 0x6B, 0xEE, 0xEE, 0xEE, 0x6B, 0xAF, 0x6F, 0xEA, 0x54, 0xFD, 0x53, 0xC7, 0xDB, 0x24, 0xDB, 0xE4, 0xE4, 0x80, 0x80, 0x1E, 0xE4, 0xE4, 0xC7, 0xC2, 0x08, 0x3E, 0xBB, 0xED, 0x02, 0x52, 0xDA, 0x13, 0xF8, 0x07, 0x07, 0xF8, 0x7D, 0x8D, 0x1B, 0x4A, 0x1B, 0x7E, 0xC9, 0xBD, 0x0E, 0xC9, 0x31, 0x0E, 0xE1, 0xC9, 0x7C, 0x7C, 0x1B, 0x7C, 0xC9, 0x7C, 0x7C, 0x7C, 0x51, 0x0E, 0x0E, 0x43, 0x19, 0x7E, 0xEC, 0x60, 0x6C, 0x00, 0x10, 0x35, 0x2C, 0x1C, 0xD8, 0x49, 0x2C, 0xE8, 0x32, 0x57, 0xF4, 0x5C, 0x8F, 0x5C, 0x34, 0x2C, 0x6C, 0x00, 0xFA, 0xD7, 0xE3, 0x14, 0xB5, 0xC4, 0x73, 0xFE, 0x14, 0x8D, 0x26, 0x26, 0xC3, 0xE5, 0xC3, 0x12, 0x07, 0x5E, 0x6F, 0x16, 0x16, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x08, 0x08, 0x96, 0x71, 0x71, 0x96, 0x08, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xFD, 0xBF, 0xBF, 0xBF, 0xC7, 0xDB, 0x93, 0x93, 0x32, 0xD2, 0x89, 0x93, 0xD0, 0x93, 0x93, 0xBF, 0xF8, 0x71, 0x17, 0x13, 0xEA, 0xCD, 0x82, 0xB4, 0xB6, 0xC9, 0x04, 0xBD, 0x3F, 0x3F, 0xA3, 0xA3, 0x8D, 0x6F, 0x8D, 0x5A, 0xAF, 0xEE, 0x8D, 0x73, 0x83, 0xF9, 0x86, 0x47, 0xD3, 0x85, 0x01, 0xF4, 0xDD, 0xA9, 0x2B, 0x9D, 0x79, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x79, 0xCE, 0x9C, 0x55, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x9C, 0x66, 0x9C, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x58, 0x58, 0x58, 0x85, 0xB8, 0x84, 0x90, 0xB1, 0x59, 0xA5, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0x59, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x23, 0x28, 0x23, 0xD9, 0x23, 0xD9, 0xAE,
+	0x6B, 0x8D, 0x9E, 0xEE, 0xEE, 0x6B, 0x6B, 0x6B, 0x8D, 0x99, 0xEE, 0x6B, 0x52, 0x6F, 0x87, 0x54, 0xFD, 0x53, 0xC7, 0x24, 0xDB, 0xE4, 0xE4, 0x7F, 0xE4, 0x1E, 0xE4, 0xE4, 0xD0, 0x24, 0xC2, 0x08, 0x4E, 0xBB, 0x52, 0xED, 0xBB, 0xF8, 0xF8, 0x6F, 0x07, 0x20, 0x13, 0x20, 0x4A, 0xBD, 0xBD, 0x51, 0x7D, 0x31, 0xBD, 0x0E, 0x4A, 0xC9, 0xC9, 0x4A, 0x31, 0x7C, 0x1B, 0x51, 0x7C, 0x1B, 0x7C, 0x31, 0x7C, 0x51, 0x7C, 0x0E, 0x31, 0xB0, 0x7E, 0x50, 0x0C, 0x9F, 0x00, 0xD6, 0xA6, 0x20, 0x8A, 0x91, 0x74, 0x57, 0x91, 0x57, 0x48, 0x8F, 0xA8, 0x8F, 0xDE, 0xAA, 0xB4, 0xFA, 0x97, 0xF9, 0x4B, 0x20, 0x3F, 0xB2, 0xC3, 0x14, 0x9A, 0x9E, 0x8D, 0x52, 0x8D, 0xC3, 0x82, 0xC3, 0x33, 0x07, 0x18, 0x52, 0x02, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0x96, 0x71, 0x71, 0x96, 0x08, 0x08, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0x71, 0x08, 0x71, 0x71, 0x08, 0x08, 0x71, 0x71, 0xC2, 0x71, 0x96, 0x71, 0x71, 0x71, 0xCA, 0xD0, 0xCA, 0x71, 0x71, 0xBF, 0xBF, 0x40, 0xF8, 0xF8, 0x71, 0x13, 0x6F, 0xE5, 0xB4, 0xB6, 0x9F, 0x9F, 0x9F, 0xBD, 0x3F, 0x73, 0x26, 0x8D, 0x8D, 0x8F, 0x6B, 0xD7, 0x5A, 0xA3, 0x5A, 0xCD, 0x83, 0x83, 0x82, 0xA6, 0xA4, 0x85, 0x42, 0x87, 0x4D, 0x2B, 0xA9, 0x79, 0x66, 0x79, 0x90, 0x90, 0x66, 0x66, 0xDC, 0x66, 0x79, 0x66, 0x67, 0x55, 0x66, 0xE0, 0xE0, 0xE0, 0xCF, 0xE0, 0xE0, 0x9C, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x58, 0x58, 0x58, 0x58, 0x6E, 0x84, 0x90, 0x1E, 0xA5, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xAE, 0x28, 0xAE, 0x28, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xA0, 0x28, 0x23, 0xD9, 0xD9, 0xD9, 0xA0, 0xB3,
+	0x4B, 0x9E, 0x99, 0x9E, 0xEE, 0xEE, 0x6B, 0x6B, 0x99, 0x6B, 0x9E, 0x5A, 0xAF, 0x07, 0x87, 0x4D, 0x06, 0xFD, 0xDB, 0x24, 0x7F, 0x24, 0xE4, 0xE4, 0xE4, 0x7F, 0x80, 0xE4, 0xE4, 0xC7, 0xC2, 0x08, 0x4E, 0x02, 0x6B, 0xBB, 0xEA, 0x70, 0x41, 0x12, 0xDA, 0x7D, 0x13, 0x20, 0x9E, 0xBD, 0xC9, 0x1B, 0x1B, 0x7C, 0x0E, 0xC9, 0x4A, 0x31, 0x0E, 0x0E, 0xC9, 0x31, 0x7E, 0x51, 0x51, 0x1B, 0x1B, 0x7C, 0xC9, 0x31, 0xAD, 0x7C, 0x0E, 0x51, 0xAD, 0x19, 0x7E, 0xAD, 0xE3, 0x2C, 0x2C, 0x35, 0x22, 0x91, 0xF7, 0x91, 0x91, 0x17, 0xBB, 0xA8, 0xAF, 0xBA, 0x0A, 0x33, 0x00, 0xB7, 0xA3, 0xFB, 0x4B, 0x12, 0xCD, 0x81, 0x73, 0x9A, 0x9E, 0x4B, 0x8D, 0x8D, 0xD6, 0xC3, 0x3A, 0x09, 0x6F, 0x33, 0x6F, 0x02, 0x02, 0x16, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x08, 0x96, 0x71, 0x71, 0x08, 0x08, 0x71, 0x96, 0x94, 0x8E, 0x8E, 0xC8, 0xC8, 0x96, 0x96, 0x08, 0x96, 0x08, 0x08, 0xC8, 0xC8, 0xC8, 0x94, 0x65, 0x94, 0xC8, 0x96, 0x08, 0x71, 0x94, 0x8E, 0xC8, 0xC8, 0x8E, 0x16, 0xC8, 0x71, 0x13, 0xEB, 0x9E, 0xB2, 0xB4, 0xB6, 0x9F, 0x04, 0xBD, 0xBD, 0x73, 0x14, 0xD7, 0xA3, 0x8D, 0x8F, 0x6B, 0x52, 0xD7, 0x72, 0xA3, 0x4B, 0x81, 0xE5, 0xF9, 0x5E, 0xD3, 0x98, 0xB8, 0x85, 0xDD, 0xC2, 0x2B, 0x9D, 0x79, 0x90, 0x66, 0x66, 0x90, 0x79, 0x79, 0x66, 0x66, 0x79, 0x55, 0x55, 0x55, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x9C, 0xE0, 0x9C, 0x9C, 0x54, 0xE0, 0x64, 0x58, 0x58, 0xB8, 0x98, 0x9D, 0x39, 0x59, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xA0, 0xD9, 0xA0, 0xD9, 0xB3,
+	0x14, 0x9E, 0x9E, 0x99, 0xEE, 0x99, 0x6B, 0x6B, 0xEE, 0x9E, 0xEE, 0x6B, 0x8F, 0xDA, 0xEB, 0x54, 0xBF, 0xC7, 0xC7, 0xDB, 0xE4, 0xE4, 0xE4, 0x80, 0x80, 0xB1, 0xE4, 0xE4, 0xE4, 0xC7, 0xC2, 0xC8, 0xEA, 0xBB, 0x4C, 0xEA, 0x13, 0xEA, 0x52, 0x07, 0xEA, 0x13, 0x13, 0x1B, 0x9E, 0x10, 0x1B, 0xBD, 0xBD, 0xC9, 0xC9, 0xC9, 0xC9, 0x1B, 0xBD, 0x0E, 0x04, 0xE1, 0xEF, 0x7E, 0x51, 0x51, 0x51, 0x51, 0x7C, 0xC9, 0x7C, 0x51, 0x19, 0x7E, 0x0E, 0x51, 0x7C, 0x31, 0xBC, 0x1C, 0x7D, 0x48, 0x89, 0x74, 0x91, 0xF7, 0x44, 0xAF, 0x01, 0x8F, 0x5E, 0x7B, 0xCC, 0xB7, 0xB5, 0xB6, 0xB4, 0xB5, 0xFA, 0x26, 0x4B, 0x86, 0xE5, 0x81, 0x9A, 0x9E, 0x8D, 0x8D, 0x12, 0x9A, 0xE5, 0x09, 0x33, 0x52, 0x33, 0x6F, 0x4C, 0x16, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0x08, 0x71, 0x71, 0x71, 0x08, 0x71, 0x71, 0xC8, 0x16, 0x02, 0x02, 0x02, 0x02, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x02, 0x16, 0x16, 0x02, 0x8E, 0x94, 0x94, 0x6A, 0xE9, 0x02, 0x02, 0x8E, 0x8E, 0x8E, 0x40, 0x96, 0x06, 0x06, 0x6F, 0xC3, 0x82, 0xB6, 0xB6, 0x0E, 0x04, 0x04, 0xCD, 0xBD, 0xA3, 0xD7, 0x99, 0x5A, 0x52, 0xD7, 0x8F, 0x5A, 0x09, 0x14, 0x12, 0x45, 0x04, 0xE5, 0x20, 0x1A, 0xB8, 0x85, 0x54, 0xDD, 0x2B, 0xDD, 0xDD, 0x66, 0x90, 0x90, 0x90, 0x66, 0x66, 0x79, 0x79, 0x66, 0xCE, 0x66, 0xE0, 0x66, 0x55, 0x9C, 0xE0, 0x9C, 0xE0, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0xE0, 0xE0, 0x9D, 0x58, 0x84, 0x85, 0x98, 0x9D, 0x39, 0x59, 0xA5, 0xB1, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xD9, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0x28, 0xAE, 0xAE, 0x28, 0xAE, 0xA0, 0xD9, 0xA0, 0xD9, 0xAE, 0xD9, 0xD9, 0xB3, 0xB3,
+	0x14, 0x99, 0xA3, 0x9E, 0x9E, 0xEE, 0x8D, 0x6B, 0x99, 0xEE, 0x6B, 0x52, 0x6F, 0x18, 0xEB, 0x17, 0xFD, 0xC7, 0xDB, 0xDB, 0xE4, 0xE4, 0x7F, 0xE4, 0x80, 0x80, 0x1E, 0x7F, 0xE4, 0xC7, 0x71, 0xDF, 0xDA, 0x52, 0x6F, 0x13, 0xF8, 0x52, 0x6F, 0x6F, 0x70, 0x13, 0x13, 0x12, 0xBD, 0xE1, 0xC9, 0xBD, 0x3B, 0xC9, 0x4A, 0x31, 0x31, 0x31, 0x0E, 0x31, 0x0E, 0x31, 0xEF, 0x50, 0x51, 0xAD, 0x51, 0x51, 0xAD, 0x7C, 0x31, 0x1B, 0x19, 0x19, 0x0E, 0x7C, 0x0E, 0xC9, 0x7D, 0xE7, 0xE9, 0x4D, 0x32, 0x95, 0x95, 0x91, 0x8B, 0x8F, 0xAF, 0x8F, 0x34, 0x0A, 0x68, 0xB4, 0x68, 0x68, 0x9F, 0xB2, 0x82, 0x9E, 0x8D, 0x45, 0xE5, 0x9A, 0x4B, 0x9A, 0x14, 0x4B, 0x52, 0x8D, 0x3A, 0xC4, 0x8F, 0x52, 0x33, 0xBB, 0x02, 0x02, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x08, 0x96, 0x71, 0x71, 0x71, 0x71, 0x96, 0xC8, 0x8E, 0x94, 0x8E, 0x8E, 0x02, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x94, 0x8E, 0x8E, 0x8E, 0x8E, 0x5D, 0x8E, 0xF8, 0xF8, 0xF8, 0x96, 0x96, 0xC8, 0x96, 0x96, 0x96, 0x17, 0xBF, 0x7D, 0x99, 0xE5, 0x9A, 0xB4, 0x68, 0x68, 0xB6, 0xF9, 0xB4, 0x73, 0x12, 0x9E, 0xA3, 0x52, 0xD7, 0xED, 0x8F, 0x52, 0x09, 0x8D, 0xD7, 0x86, 0xE5, 0x81, 0x12, 0x13, 0xE0, 0x85, 0xDD, 0xDD, 0x4D, 0xDD, 0x9D, 0x66, 0x90, 0x55, 0x66, 0x66, 0x2B, 0x90, 0x55, 0x66, 0xCE, 0x55, 0x55, 0xE0, 0x9C, 0x9C, 0x55, 0x55, 0x55, 0x66, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x67, 0x58, 0x98, 0x98, 0xE7, 0x79, 0x39, 0x59, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xD9, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0xAE, 0xA0, 0xD9, 0xA0, 0xD9, 0xB3, 0xAE,
+	0x14, 0x14, 0x9E, 0x99, 0x9E, 0x4B, 0x8D, 0x9E, 0x6B, 0x9E, 0xED, 0x8F, 0x6F, 0x5C, 0xF8, 0x17, 0x79, 0xC7, 0xC7, 0xE4, 0xE4, 0xE4, 0xE4, 0x80, 0x80, 0xE4, 0x80, 0x7F, 0xE4, 0xCA, 0xFD, 0x85, 0xF3, 0x41, 0x13, 0xF8, 0x12, 0x52, 0x6F, 0x7D, 0x13, 0xF8, 0x7D, 0x20, 0x4A, 0x4A, 0x4A, 0x10, 0xBD, 0x0E, 0xC9, 0xBD, 0xC9, 0x7C, 0x0E, 0x1B, 0x0E, 0x7C, 0xEC, 0x43, 0x7C, 0x7C, 0x51, 0xAD, 0x51, 0xAD, 0x51, 0xE1, 0x51, 0x1B, 0x7C, 0x7C, 0x7C, 0x51, 0xCC, 0x4D, 0x71, 0x94, 0xC0, 0xA1, 0x91, 0x2F, 0x5C, 0x5C, 0x5C, 0x67, 0xE2, 0x20, 0xB4, 0x68, 0x68, 0x68, 0x3F, 0x82, 0xB2, 0x14, 0x4B, 0x73, 0x82, 0x86, 0x4B, 0x4B, 0x14, 0x4B, 0xD7, 0x4B, 0xC4, 0xC3, 0x12, 0x52, 0x12, 0x6F, 0xED, 0x16, 0x16, 0x8E, 0x94, 0x94, 0xC8, 0x94, 0x94, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x08, 0x08, 0x71, 0x71, 0x71, 0x71, 0x08, 0xC8, 0xC8, 0xC8, 0x94, 0x94, 0x8E, 0x8E, 0x94, 0x94, 0xC8, 0x08, 0xC8, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xCA, 0xD0, 0x89, 0x89, 0xCA, 0x71, 0x96, 0x71, 0x06, 0x71, 0x17, 0x17, 0x12, 0xFE, 0xE5, 0x45, 0xBD, 0x68, 0x68, 0xB4, 0xB4, 0x73, 0xCD, 0x4B, 0x4B, 0x9E, 0x8F, 0x52, 0xED, 0x8F, 0x6B, 0xFE, 0x8D, 0x8F, 0x73, 0xE5, 0x81, 0x12, 0x1C, 0xCF, 0x9D, 0x9D, 0xFD, 0xDD, 0xDD, 0x79, 0x79, 0x90, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x4F, 0x66, 0x4F, 0x66, 0x9C, 0x9C, 0x9C, 0x55, 0xE0, 0x9C, 0x9C, 0x9C, 0x9C, 0x66, 0x9C, 0x9C, 0x67, 0x84, 0x98, 0xB8, 0x6E, 0x9D, 0xB1, 0x59, 0xA5, 0x28, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x28, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0xAE, 0xD9, 0xA0, 0x28, 0x28, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+	0x14, 0x14, 0x9E, 0xA3, 0x8D, 0x9E, 0x6B, 0x8D, 0x99, 0x4C, 0xEE, 0x6F, 0x6F, 0x18, 0xEB, 0x54, 0xBF, 0x79, 0xDB, 0x24, 0xDB, 0xE4, 0x80, 0x80, 0x80, 0x80, 0x1E, 0x7F, 0x24, 0xBF, 0xFD, 0x6A, 0xEB, 0x13, 0x13, 0x6F, 0x52, 0x6F, 0x52, 0xF8, 0x13, 0x7D, 0x20, 0x1B, 0x4A, 0x4A, 0x1B, 0xD6, 0xC9, 0x83, 0x83, 0x04, 0x4A, 0x7C, 0x0E, 0x51, 0x0E, 0x31, 0xEC, 0x43, 0x31, 0x0E, 0x51, 0x51, 0x7E, 0x51, 0x7C, 0x1B, 0x9F, 0xC9, 0x19, 0x7C, 0x7E, 0x50, 0x13, 0xBF, 0x71, 0x4E, 0xBA, 0xD5, 0x89, 0x5C, 0x5C, 0x01, 0x84, 0xF1, 0x2C, 0x6C, 0xB4, 0x9F, 0x9F, 0x9F, 0xBD, 0x81, 0x82, 0x14, 0xCD, 0x3F, 0xC3, 0x73, 0xCD, 0xCD, 0x4B, 0x14, 0xD7, 0xA3, 0xC3, 0xC3, 0x52, 0xD7, 0xD7, 0x8F, 0xED, 0x02, 0x16, 0x8E, 0x8E, 0x8E, 0xC8, 0x94, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x08, 0x71, 0x71, 0x71, 0x71, 0x71, 0x96, 0xC8, 0xC8, 0x94, 0x94, 0x94, 0x94, 0xC8, 0xC8, 0xC8, 0x96, 0x71, 0xD0, 0xD0, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xD0, 0x96, 0x13, 0x71, 0xBF, 0x71, 0x17, 0x41, 0xC3, 0xE5, 0x82, 0x81, 0x68, 0x9F, 0x45, 0xF9, 0xB4, 0x73, 0x4B, 0x9E, 0x9A, 0x8D, 0x33, 0x6B, 0x5A, 0x52, 0x8D, 0x9E, 0xA3, 0x8F, 0x9E, 0x82, 0x45, 0xD6, 0x13, 0xCB, 0x9D, 0xDD, 0x79, 0xDD, 0xDD, 0x79, 0x79, 0x90, 0x55, 0x90, 0x90, 0x66, 0x90, 0x66, 0x4F, 0x66, 0x90, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x9C, 0x9C, 0x67, 0x55, 0x66, 0xE0, 0xE0, 0x9C, 0x64, 0x98, 0x98, 0x98, 0x6E, 0x66, 0x59, 0xA5, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xD9, 0xD9, 0xD9, 0xAE, 0xAE, 0xD9, 0xAE, 0xAE, 0xD9, 0xD9, 0xAE, 0xD9, 0xA0, 0x28, 0x28, 0xD9, 0xD9, 0x23, 0x28, 0xAE, 0xAE, 0xAE,
+	0x14, 0x14, 0x9E, 0x99, 0x9E, 0x9E, 0x8D, 0x8D, 0x99, 0x99, 0xEE, 0x8F, 0x07, 0x07, 0xEB, 0x54, 0xBF, 0xDC, 0xC7, 0xDB, 0xE4, 0xE4, 0x80, 0x80, 0xB1, 0xE4, 0x1E, 0xE4, 0x24, 0xCA, 0xFD, 0x4D, 0x17, 0xF8, 0x52, 0x6B, 0x52, 0x52, 0x7D, 0x13, 0xEA, 0xEA, 0x20, 0x1B, 0x8D, 0x4A, 0x7E, 0x1B, 0x45, 0x3B, 0x04, 0x04, 0x51, 0xE1, 0x0E, 0x7C, 0x31, 0x7C, 0x5B, 0x43, 0x7C, 0x0E, 0x7C, 0xB0, 0x51, 0x19, 0x7C, 0x51, 0xC9, 0xC9, 0x1B, 0x51, 0x50, 0x50, 0x1F, 0x06, 0x96, 0x6A, 0xA4, 0xE2, 0xB8, 0x8F, 0x01, 0x66, 0x7B, 0xCB, 0x14, 0xB5, 0xB4, 0x9F, 0x10, 0x10, 0xBD, 0x81, 0x81, 0x73, 0xCD, 0x73, 0xC3, 0x82, 0x73, 0x4B, 0xA3, 0x4B, 0x8D, 0xD7, 0xC3, 0xC3, 0x8D, 0xD7, 0x52, 0x52, 0xED, 0x02, 0x6F, 0x8E, 0x8E, 0x8E, 0xC8, 0x8E, 0xC8, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x08, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x71, 0xBF, 0xBF, 0xCA, 0xBF, 0xCA, 0xCA, 0x89, 0xCA, 0x71, 0x96, 0x96, 0xBF, 0x06, 0xF8, 0x17, 0x6B, 0x3A, 0xE5, 0x45, 0xBD, 0x68, 0x9F, 0xB4, 0xF9, 0xB4, 0x73, 0x4B, 0xC3, 0x73, 0x8D, 0x07, 0x5A, 0x52, 0x52, 0x8D, 0x9E, 0x99, 0x33, 0xA3, 0xB4, 0x81, 0x12, 0x13, 0x0F, 0x79, 0xDD, 0x79, 0xDD, 0x79, 0x79, 0x90, 0x90, 0x90, 0x66, 0x90, 0x90, 0x66, 0x90, 0x66, 0x4F, 0x4F, 0x66, 0x55, 0x66, 0x55, 0xE0, 0x55, 0x66, 0x9C, 0x9C, 0x55, 0xE0, 0xE0, 0xE0, 0x67, 0x67, 0xFC, 0xB8, 0x98, 0x98, 0x66, 0xB1, 0xA5, 0x28, 0x28, 0x28, 0xAE, 0xD9, 0xD9, 0xD9, 0x28, 0xD9, 0xA0, 0xAE, 0xD9, 0xD9, 0xD9, 0xD9, 0xA0, 0xD9, 0x28, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xAE, 0xB3, 0x28,
+	0x14, 0x14, 0x9A, 0x14, 0x9E, 0x8D, 0x9E, 0x9E, 0x9E, 0x99, 0xED, 0x8F, 0x6F, 0x07, 0xEB, 0x4D, 0x79, 0xBF, 0xC7, 0x24, 0xE4, 0x39, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0xE4, 0xD0, 0xC7, 0x71, 0xF8, 0x52, 0x99, 0x52, 0x6B, 0x6F, 0x21, 0xF8, 0x20, 0x20, 0x20, 0x4A, 0x4A, 0xE1, 0xEF, 0x4A, 0x83, 0xBD, 0x04, 0xBD, 0x51, 0x31, 0x31, 0x31, 0x7C, 0xAD, 0x5B, 0xAD, 0xAD, 0x31, 0x31, 0xB0, 0x31, 0x51, 0x19, 0xAD, 0xAD, 0x7C, 0x51, 0x51, 0x50, 0x30, 0x13, 0x21, 0xEA, 0x4D, 0x91, 0x5F, 0xAF, 0x6E, 0x66, 0xF2, 0x76, 0x26, 0x6C, 0x9F, 0xB4, 0x10, 0x9F, 0x10, 0x9F, 0xBD, 0x81, 0x86, 0x4B, 0x73, 0x73, 0x73, 0x73, 0xCD, 0x8D, 0xCD, 0xD7, 0x8D, 0x9A, 0xC3, 0x8D, 0x12, 0x8D, 0x12, 0xEE, 0x6B, 0xBB, 0xDA, 0x8E, 0x8E, 0xC8, 0x8E, 0xC8, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x96, 0x96, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x71, 0x71, 0x71, 0xBF, 0x71, 0x71, 0x96, 0x71, 0x71, 0x13, 0xBF, 0x71, 0x13, 0x96, 0x41, 0xE5, 0x82, 0x82, 0x81, 0x3F, 0xBD, 0xBD, 0x68, 0xB4, 0x73, 0x73, 0x8D, 0xC3, 0xC3, 0x8D, 0x18, 0xEE, 0x8F, 0x8F, 0xD7, 0x8D, 0x99, 0x8F, 0xA3, 0x73, 0x45, 0x4A, 0x13, 0x1A, 0x66, 0x79, 0xDC, 0x79, 0xDD, 0x79, 0x90, 0x66, 0x90, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x4F, 0x66, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x55, 0x55, 0xE0, 0x8C, 0x67, 0x67, 0x67, 0x67, 0x64, 0x64, 0xFC, 0xB8, 0x98, 0x66, 0x59, 0x28, 0x28, 0x28, 0xD9, 0xD9, 0xB3, 0xD9, 0xAE, 0xD9, 0xD9, 0xD9, 0xA0, 0xD9, 0xA0, 0xD9, 0xA0, 0x28, 0xD9, 0xD9, 0xAE, 0xD9, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0x28, 0xAE,
+	0x14, 0x9E, 0x9A, 0x9E, 0x9A, 0x9E, 0x9E, 0x99, 0x9E, 0x99, 0x6B, 0x6F, 0x6F, 0x6F, 0x87, 0x54, 0xFD, 0x79, 0xC7, 0xDB, 0xE4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1E, 0xE4, 0xD0, 0x24, 0xBF, 0x4D, 0xEA, 0xED, 0x52, 0x6B, 0x52, 0x13, 0x13, 0xEA, 0x41, 0x7D, 0x20, 0xC9, 0xBD, 0x51, 0x13, 0xBD, 0x04, 0x04, 0x04, 0x31, 0x51, 0xC9, 0x31, 0x7C, 0x7C, 0x43, 0x43, 0xB0, 0x19, 0xAD, 0x31, 0xAD, 0x7C, 0x0E, 0x51, 0x19, 0xAD, 0x19, 0x50, 0x7E, 0x7E, 0x5B, 0x30, 0x13, 0xF8, 0xF8, 0x91, 0x8C, 0x01, 0x90, 0xA5, 0xE8, 0xE3, 0x09, 0xA3, 0x9F, 0x68, 0x10, 0x9F, 0x10, 0x10, 0xBD, 0xBD, 0x10, 0x86, 0x73, 0x3F, 0xCD, 0x4B, 0xCD, 0xCD, 0x4B, 0x8D, 0x26, 0x14, 0xC3, 0xA3, 0x12, 0x6B, 0x12, 0x4B, 0x6B, 0x52, 0x6F, 0x8E, 0x8E, 0x8E, 0x8E, 0x94, 0x94, 0xC8, 0x8E, 0x96, 0x96, 0x96, 0x08, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0x08, 0x71, 0x96, 0x96, 0xC8, 0xC8, 0xC8, 0x8E, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x96, 0x96, 0x71, 0xBF, 0xBF, 0x71, 0xF8, 0xF8, 0x12, 0x3A, 0x9E, 0x82, 0x81, 0xBD, 0x68, 0x68, 0x9F, 0x3F, 0x73, 0x3F, 0xA3, 0xFE, 0xC3, 0x52, 0x8F, 0xEE, 0x8F, 0x52, 0xD7, 0x8D, 0x99, 0x8F, 0x26, 0x73, 0xBD, 0x8D, 0x48, 0xD3, 0x79, 0x79, 0xC7, 0xDD, 0x79, 0x79, 0x90, 0x2B, 0x90, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x55, 0x55, 0x55, 0x66, 0x55, 0x55, 0x55, 0x66, 0xE0, 0x8C, 0x67, 0x67, 0x9D, 0x64, 0x67, 0x64, 0xFC, 0x98, 0x01, 0x98, 0x90, 0x1E, 0x28, 0x28, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xB3, 0xD9, 0xB3, 0xD9, 0xD9, 0xB3, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xB3, 0xAE, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0xAE, 0xAE, 0xAE,
+	0x14, 0x3F, 0x73, 0x73, 0x9A, 0x9E, 0x9A, 0x9E, 0x99, 0x99, 0x52, 0x6F, 0x6F, 0x6F, 0xF4, 0xDF, 0x4D, 0xDC, 0xC7, 0x24, 0x39, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1E, 0xE4, 0x24, 0xC7, 0xFD, 0x2D, 0xA8, 0xBB, 0x52, 0x99, 0x41, 0x30, 0xEA, 0x07, 0x20, 0x7D, 0x4A, 0x4A, 0xBD, 0x7E, 0x75, 0x83, 0x9F, 0x04, 0x3B, 0x1B, 0x1B, 0x04, 0x0E, 0xB0, 0x7C, 0xEC, 0x43, 0xB0, 0xB0, 0x19, 0xAD, 0x19, 0x51, 0x31, 0x0E, 0x51, 0x19, 0x43, 0x51, 0x19, 0x7C, 0x75, 0x1C, 0x1F, 0xF8, 0x13, 0x91, 0x37, 0x90, 0x59, 0xD2, 0x42, 0xB2, 0x9F, 0x9F, 0x68, 0x10, 0x9F, 0x10, 0x10, 0x4A, 0xBD, 0xBD, 0x10, 0xBD, 0x73, 0xCD, 0xCD, 0x4B, 0xCD, 0x4B, 0xCD, 0x26, 0x8D, 0x14, 0x73, 0x14, 0x12, 0x8D, 0x8F, 0xA3, 0x8D, 0x6B, 0x6F, 0x6F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0x96, 0xC8, 0x96, 0x08, 0x96, 0x71, 0x71, 0x71, 0x96, 0x71, 0x96, 0x96, 0xC8, 0xC8, 0xC8, 0x96, 0xC8, 0xC8, 0x8E, 0xC8, 0x96, 0x96, 0x96, 0x96, 0xEA, 0x96, 0x96, 0x71, 0x13, 0x71, 0x71, 0x13, 0xF8, 0x6F, 0x8D, 0xFA, 0x73, 0x81, 0xF9, 0xBD, 0x68, 0xBD, 0x10, 0x10, 0x3F, 0x73, 0x4B, 0x9A, 0xC3, 0x12, 0x6F, 0xA3, 0x52, 0x8F, 0x52, 0x9E, 0xA3, 0x8F, 0xA3, 0x3F, 0x86, 0x4B, 0x1F, 0xD3, 0x79, 0x79, 0x79, 0xDD, 0x79, 0x79, 0x90, 0x66, 0x66, 0x90, 0x66, 0x2B, 0x90, 0x66, 0x90, 0x4F, 0x90, 0x55, 0x55, 0x55, 0x55, 0x66, 0x67, 0x55, 0x8C, 0x67, 0x67, 0x64, 0x67, 0x67, 0x64, 0x64, 0xFC, 0x98, 0x01, 0xB9, 0x66, 0x59, 0x28, 0x28, 0xD9, 0xB3, 0xB3, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0xB3, 0xB3, 0xB3, 0xB3, 0xD9, 0xD9, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0xAE, 0x28, 0xAE, 0x28, 0xAE,
+	0xCD, 0x73, 0x73, 0x86, 0x73, 0x9A, 0x9A, 0xFE, 0xFE, 0x99, 0xAF, 0x07, 0x6F, 0xBB, 0xF3, 0x4D, 0x4D, 0xDC, 0xFD, 0xDB, 0xE4, 0x39, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0xE4, 0xC7, 0x71, 0xDF, 0xC1, 0x5A, 0x6B, 0x6B, 0x41, 0x13, 0xEA, 0x20, 0x20, 0x20, 0xBD, 0x4B, 0xC9, 0x75, 0x7E, 0x45, 0x3B, 0xBD, 0x04, 0x1B, 0x25, 0x0E, 0x04, 0x0E, 0xAD, 0x5B, 0xEC, 0xAD, 0x0E, 0x43, 0x19, 0xAD, 0xAD, 0x31, 0x31, 0x7C, 0x43, 0x43, 0x7E, 0x7E, 0x1B, 0x60, 0x7D, 0x7D, 0x7D, 0x21, 0x57, 0x8C, 0x90, 0xAE, 0x8B, 0x6C, 0xCD, 0x3F, 0x68, 0x9F, 0x68, 0x10, 0x9F, 0xCD, 0xCD, 0xE6, 0x83, 0x10, 0xBD, 0x73, 0x3F, 0xCD, 0x4B, 0xCD, 0x4B, 0xA3, 0xCD, 0x26, 0x14, 0xC3, 0x14, 0xD7, 0xA3, 0x33, 0x8D, 0x8D, 0x8D, 0x52, 0xBB, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x96, 0x71, 0x96, 0x71, 0x96, 0x96, 0x08, 0x96, 0x96, 0x96, 0xC8, 0x96, 0xC8, 0xC8, 0xC8, 0x8E, 0xC8, 0x96, 0x8E, 0x96, 0x96, 0x71, 0xCA, 0x71, 0x71, 0x13, 0x96, 0x20, 0x99, 0x4B, 0x45, 0xF9, 0x68, 0xFB, 0x68, 0xBD, 0x68, 0x10, 0x4A, 0x4B, 0xCD, 0x9A, 0x9E, 0xFE, 0x6F, 0x18, 0xD7, 0x8F, 0x6F, 0xD7, 0x9E, 0x99, 0x8F, 0x26, 0x73, 0x4B, 0x8D, 0x1F, 0xA4, 0x66, 0x79, 0x53, 0xDD, 0x9D, 0x90, 0x66, 0x66, 0x66, 0x90, 0x67, 0x90, 0x55, 0x90, 0x55, 0x90, 0x90, 0x37, 0x4F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x8C, 0x67, 0x8C, 0x8C, 0x8C, 0x64, 0x9D, 0x64, 0xB8, 0xB9, 0xA6, 0xB8, 0x90, 0xD2, 0x28, 0xD9, 0xD9, 0xD9, 0xB3, 0xB3, 0xD9, 0xD9, 0xB3, 0xD9, 0xB3, 0xB3, 0xD9, 0xB3, 0xB3, 0xD9, 0xB3, 0x28, 0xAE, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0x28, 0x28, 0x28,
+	0xCD, 0x3F, 0x73, 0x3F, 0x73, 0x86, 0x73, 0x9A, 0x09, 0x6B, 0x07, 0x41, 0xA8, 0xA8, 0x3E, 0xA9, 0x4D, 0xC2, 0x53, 0xC7, 0xE4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1E, 0xE4, 0xE4, 0xC7, 0xFD, 0xDF, 0xF5, 0x02, 0xEE, 0x6B, 0xEA, 0x13, 0x20, 0x6F, 0x20, 0x12, 0x4A, 0xBD, 0x4A, 0x7E, 0x12, 0x04, 0x9F, 0x6D, 0x0E, 0x1B, 0xC9, 0xC9, 0x0E, 0x04, 0xAD, 0x5B, 0x19, 0x43, 0xB0, 0xB0, 0x43, 0x19, 0xAD, 0xB0, 0x19, 0xAD, 0xB0, 0x19, 0x19, 0x51, 0x4B, 0x35, 0x75, 0x7D, 0x7D, 0x13, 0x91, 0x37, 0xE2, 0x36, 0xC4, 0xB2, 0x9F, 0x9F, 0xBD, 0xC9, 0x45, 0xCD, 0x14, 0x68, 0x14, 0xB4, 0xB4, 0x10, 0xBD, 0x73, 0xCD, 0x3F, 0x3F, 0xA3, 0xCD, 0x14, 0x4B, 0xA3, 0x8D, 0x14, 0xC3, 0x14, 0x8D, 0xD7, 0x12, 0x9A, 0x52, 0x5A, 0x02, 0x16, 0x02, 0x8E, 0x8E, 0x8E, 0x8E, 0x94, 0x8E, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x08, 0x71, 0x71, 0x71, 0x96, 0x71, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x71, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0xBF, 0xBF, 0x71, 0xBF, 0x71, 0x13, 0x71, 0xF8, 0x99, 0x8D, 0x4B, 0x83, 0x83, 0x68, 0xB6, 0xB4, 0x3F, 0x9F, 0x10, 0x26, 0x86, 0x73, 0x9A, 0x9E, 0x09, 0x12, 0x18, 0xEE, 0x8F, 0x8F, 0x6B, 0xEE, 0x99, 0xAF, 0xD7, 0xC3, 0x9F, 0xBD, 0x48, 0xD3, 0x79, 0x79, 0x79, 0x79, 0x79, 0x66, 0x90, 0x90, 0x90, 0x90, 0x55, 0x55, 0x90, 0x90, 0x90, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x67, 0x8C, 0x8C, 0x67, 0x8C, 0x64, 0x64, 0x64, 0xAC, 0x64, 0xB8, 0xB8, 0xB9, 0x01, 0x4F, 0x59, 0xD9, 0xD9, 0xB3, 0xB3, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0xB3, 0xB3, 0xB3, 0xD9, 0xAE, 0xAE, 0xAE, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0x28, 0xAE, 0x28,
+	0x9F, 0x73, 0x73, 0x73, 0x73, 0x73, 0x86, 0x73, 0xFE, 0x6B, 0x18, 0x5C, 0xDA, 0xA8, 0x3E, 0xDF, 0x15, 0xC2, 0xC7, 0xC7, 0x39, 0x39, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0xE4, 0xC7, 0xFD, 0x2D, 0xF5, 0x02, 0xEE, 0x6B, 0x1B, 0xF8, 0x7D, 0x20, 0x1B, 0x12, 0x8D, 0x4A, 0x1B, 0x51, 0x10, 0x83, 0x04, 0x3B, 0x4A, 0x60, 0x0E, 0x0E, 0x31, 0x04, 0xAD, 0x5B, 0x19, 0xAD, 0x19, 0xB0, 0x43, 0x43, 0xAD, 0xAD, 0x19, 0x7C, 0x7C, 0xAD, 0x19, 0x75, 0x9F, 0x35, 0x7D, 0x60, 0x13, 0x8A, 0x91, 0xD5, 0xE8, 0xD7, 0xB2, 0xB2, 0x9F, 0x0E, 0x04, 0xBD, 0x04, 0xB4, 0x14, 0x14, 0x68, 0xB5, 0xB4, 0x10, 0x3F, 0x73, 0xBD, 0x3F, 0x73, 0x9F, 0x4B, 0xCD, 0xCD, 0x4B, 0x4B, 0x9A, 0xC3, 0x14, 0xA3, 0x8D, 0x4B, 0x9E, 0x6B, 0xEE, 0xED, 0x02, 0x02, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x08, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0x08, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xCA, 0xCA, 0xBF, 0xBF, 0xBF, 0xBF, 0x71, 0x71, 0x13, 0xF8, 0x07, 0x72, 0x8D, 0x10, 0xE6, 0xB6, 0x68, 0xE6, 0x68, 0x10, 0x10, 0x9F, 0x8D, 0x86, 0x9A, 0x86, 0x9A, 0x09, 0x33, 0x18, 0xEE, 0x52, 0x33, 0x52, 0x6B, 0xA3, 0x8F, 0xD7, 0xC3, 0x10, 0x86, 0x48, 0x78, 0xC0, 0x90, 0x79, 0x9D, 0x79, 0x90, 0x66, 0x90, 0x90, 0x66, 0x90, 0x55, 0x90, 0x55, 0x90, 0x55, 0x55, 0x55, 0x90, 0x55, 0x55, 0x55, 0x55, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x64, 0x64, 0x64, 0xBA, 0xB9, 0xB9, 0xA6, 0x90, 0xA5, 0xD9, 0xD9, 0xD9, 0xB3, 0xB3, 0xB3, 0xD9, 0xB3, 0xD9, 0xB3, 0xD9, 0xB3, 0xB3, 0x23, 0xD9, 0xD9, 0xAE, 0x28, 0xAE, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x28, 0x28, 0xAE,
+	0x73, 0xB4, 0x73, 0x3F, 0x3F, 0x86, 0x73, 0x86, 0x9A, 0xD7, 0x07, 0x41, 0xC1, 0xA8, 0x0D, 0xA9, 0x15, 0xDD, 0xFD, 0x24, 0xDB, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x24, 0xC7, 0x71, 0x2D, 0xF3, 0xBB, 0x6B, 0x6B, 0x6F, 0xEF, 0xEA, 0x20, 0x6F, 0x12, 0x4A, 0x1B, 0x1B, 0x1B, 0xBD, 0xBD, 0x3B, 0x3B, 0x31, 0x1B, 0x04, 0x04, 0x31, 0x0E, 0xB0, 0xEC, 0x19, 0xB0, 0x43, 0xAD, 0x19, 0x43, 0xAD, 0xAD, 0xAD, 0x31, 0xB0, 0xB0, 0x19, 0x7E, 0x12, 0xBC, 0x1B, 0x20, 0x7D, 0x2F, 0x91, 0x91, 0xE3, 0x00, 0x14, 0x68, 0x04, 0xC9, 0xBD, 0x04, 0xBD, 0x3F, 0x14, 0x68, 0xA3, 0xB2, 0xB4, 0x4B, 0x3F, 0x3F, 0xCD, 0x73, 0x81, 0x73, 0xCD, 0x4B, 0x14, 0x4B, 0xA3, 0x14, 0x3F, 0x14, 0x14, 0x4B, 0xA3, 0x14, 0x9E, 0xEE, 0xED, 0x4C, 0x02, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xCA, 0xCA, 0xD0, 0xD0, 0xD0, 0xBF, 0xCA, 0xBF, 0xBF, 0x71, 0x13, 0x71, 0x13, 0x99, 0x09, 0x8D, 0xBD, 0x04, 0xB6, 0x04, 0xB4, 0x9F, 0x10, 0x4B, 0x10, 0x10, 0x3F, 0x4B, 0xC3, 0xFE, 0xFE, 0x18, 0x18, 0xA3, 0x8F, 0x6F, 0xD7, 0xD7, 0x5A, 0x8F, 0x8D, 0x14, 0x10, 0x86, 0x70, 0x7A, 0x2A, 0x90, 0x79, 0x2B, 0x66, 0x90, 0x90, 0x90, 0x90, 0x55, 0x55, 0x90, 0x55, 0x90, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x8C, 0x8C, 0x55, 0x8C, 0x8C, 0x8C, 0x64, 0xAC, 0x64, 0x47, 0xB8, 0xB9, 0xA6, 0x01, 0x37, 0xAE, 0x28, 0xD9, 0xD9, 0xB3, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xB3, 0xD9, 0xB3, 0xD9, 0xD9, 0xB3, 0xD9, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0x28,
+	0xB4, 0xB4, 0xB4, 0x3F, 0xBD, 0x73, 0x73, 0x9A, 0x9E, 0x52, 0x41, 0xF4, 0xA8, 0xF5, 0x40, 0xDF, 0x15, 0x2B, 0xBF, 0x24, 0xE4, 0x39, 0x80, 0x80, 0x80, 0x80, 0xE4, 0xE4, 0x24, 0xC7, 0xC2, 0x2D, 0xF6, 0xBB, 0x6B, 0x6B, 0x52, 0x7D, 0x20, 0x20, 0x20, 0x4A, 0x4A, 0x51, 0x1B, 0xE1, 0xC9, 0x9F, 0x3B, 0x3B, 0x25, 0x1B, 0x04, 0x04, 0x0E, 0x0E, 0x7C, 0x43, 0xAD, 0xB0, 0xB0, 0x19, 0xAD, 0x19, 0x19, 0xAD, 0xAD, 0xAD, 0xB0, 0x31, 0xAD, 0x75, 0x35, 0x22, 0x1B, 0x12, 0x20, 0xBC, 0x91, 0xB9, 0x00, 0xA3, 0x68, 0x9F, 0x04, 0xC9, 0xC9, 0xBD, 0xBD, 0x10, 0xA3, 0xA3, 0xB4, 0xB2, 0xB5, 0xA3, 0x3F, 0x73, 0xBD, 0x73, 0x82, 0xB4, 0xCD, 0x3F, 0xCD, 0x4B, 0x4B, 0x14, 0x73, 0x14, 0x14, 0x4B, 0xA3, 0x9E, 0xFE, 0x6B, 0x52, 0x4C, 0x4C, 0x02, 0x02, 0x02, 0x8E, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xCA, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xBF, 0xCA, 0xBF, 0x71, 0xBF, 0xBF, 0x41, 0x09, 0xFE, 0x8D, 0x04, 0x04, 0x04, 0xB6, 0xB4, 0xCD, 0x10, 0xA3, 0x4A, 0xCD, 0xCD, 0x4B, 0x86, 0xFE, 0x9E, 0x18, 0x18, 0xD7, 0x8F, 0x8F, 0x52, 0x6B, 0xED, 0xAF, 0xA3, 0x8D, 0x4B, 0x73, 0x70, 0x7A, 0x2A, 0xC0, 0x9D, 0x9D, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x55, 0x55, 0x90, 0x67, 0x55, 0x55, 0x55, 0x90, 0x55, 0x90, 0x55, 0x55, 0x55, 0x8C, 0x8C, 0x8C, 0xAC, 0x64, 0xAC, 0x64, 0xAC, 0x64, 0xB9, 0xB9, 0xA6, 0xBA, 0x36, 0x28, 0x28, 0xB3, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0x28, 0x28, 0xAE, 0x28, 0xAE, 0x28, 0x28, 0x28, 0xAE, 0x28,
+	0xB4, 0x81, 0x68, 0xBD, 0x68, 0x45, 0x73, 0x86, 0x9A, 0x52, 0x18, 0xF4, 0xC1, 0xA8, 0x0D, 0xDF, 0x15, 0xC2, 0xFD, 0xDB, 0x24, 0x39, 0x80, 0x7F, 0x80, 0x80, 0x80, 0xE4, 0x24, 0xC7, 0xFD, 0x15, 0xF6, 0x02, 0xED, 0x52, 0x6F, 0x20, 0x20, 0x20, 0x12, 0x4A, 0x12, 0x4A, 0x51, 0x12, 0xBD, 0x9F, 0xB6, 0x04, 0x25, 0x1B, 0x0E, 0xBD, 0xC9, 0x31, 0xB0, 0x19, 0xAD, 0xB0, 0x31, 0xB0, 0xAD, 0x19, 0x43, 0x19, 0x19, 0x19, 0xB0, 0xB0, 0x19, 0xEF, 0x33, 0xD8, 0x7D, 0x10, 0x60, 0x7D, 0x8A, 0xE3, 0x68, 0xD6, 0xB7, 0x68, 0xC9, 0xBD, 0x04, 0xBD, 0xBD, 0x4B, 0x10, 0xA3, 0x14, 0xB5, 0xB4, 0x10, 0x73, 0xB4, 0xCD, 0x9F, 0xB4, 0x81, 0x3F, 0x73, 0xCD, 0x4B, 0xCD, 0x14, 0x3F, 0x14, 0x4B, 0xA3, 0x8D, 0x4B, 0xFE, 0x5A, 0x52, 0x72, 0x72, 0x4C, 0x4C, 0x02, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0xC8, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0x71, 0xBF, 0xCA, 0xCA, 0xD0, 0xD0, 0xBF, 0xD0, 0xCA, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xBF, 0xBF, 0x71, 0x06, 0x17, 0x52, 0x3A, 0x8D, 0x4A, 0x04, 0x04, 0x68, 0xB6, 0x68, 0x10, 0xA3, 0x10, 0xA3, 0x73, 0xCD, 0x8D, 0x86, 0xC3, 0x9E, 0x18, 0x20, 0x52, 0x8F, 0x18, 0x8D, 0xD7, 0x5A, 0xD7, 0xA3, 0xD7, 0x10, 0x73, 0x70, 0x7A, 0x2A, 0x90, 0x9C, 0x9C, 0x90, 0x90, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x90, 0x55, 0x55, 0x55, 0x55, 0x8C, 0xDE, 0x66, 0x55, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x64, 0xAC, 0x64, 0xAC, 0x64, 0x64, 0x47, 0xB9, 0xBA, 0xBA, 0x5F, 0xD9, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0x28, 0xD9, 0x28, 0xD9, 0xB3, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0x28, 0xAE, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAE, 0xAE, 0x28, 0x59,
+	0xB4, 0xB4, 0x68, 0xBD, 0x68, 0x45, 0x81, 0x73, 0x14, 0xD7, 0x18, 0xDA, 0x29, 0x5D, 0x40, 0x15, 0x15, 0xDD, 0xC7, 0xC7, 0xE4, 0xE4, 0x39, 0x80, 0x80, 0x80, 0xE4, 0xE4, 0x24, 0xC7, 0xC2, 0x15, 0x65, 0x02, 0xED, 0x6B, 0x12, 0x20, 0x20, 0x20, 0x4A, 0x9E, 0x4A, 0xBD, 0x7E, 0x1B, 0x83, 0x10, 0x0E, 0xB6, 0xC9, 0x1B, 0x0E, 0xBD, 0xC9, 0x0E, 0xAD, 0x19, 0xAD, 0x0E, 0x0E, 0x0E, 0x31, 0xAD, 0x19, 0x43, 0x19, 0x19, 0x19, 0xAD, 0xAD, 0xEF, 0x75, 0x30, 0x7D, 0xE1, 0x20, 0x60, 0x33, 0x26, 0xD6, 0x26, 0xB6, 0xB6, 0xC9, 0xBD, 0xBD, 0xBD, 0x45, 0xCD, 0xA3, 0x10, 0x9F, 0xB4, 0x73, 0x26, 0xBD, 0xB4, 0xCD, 0x3F, 0xB4, 0xB4, 0x73, 0x73, 0x3F, 0xCD, 0x14, 0x14, 0x9A, 0x14, 0x14, 0x4B, 0x14, 0x8D, 0x14, 0x4B, 0x52, 0x99, 0x99, 0x72, 0x99, 0x4C, 0x02, 0xBB, 0x16, 0x8E, 0x8E, 0xC8, 0x96, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0xBF, 0xBF, 0xBF, 0xBF, 0xCA, 0xCA, 0xD0, 0xCA, 0xCA, 0xD0, 0xCA, 0xCA, 0xD0, 0x89, 0xD0, 0xCA, 0x71, 0xBF, 0x06, 0xF8, 0x99, 0x3A, 0x4A, 0x10, 0x04, 0x9F, 0x0E, 0xB4, 0xB4, 0x14, 0x9F, 0xA3, 0x3F, 0x81, 0xCD, 0xCD, 0x73, 0xC3, 0xA3, 0x18, 0x18, 0xD7, 0x6F, 0x8F, 0x6B, 0xD7, 0x5A, 0xAF, 0x14, 0xD7, 0x4B, 0x73, 0x70, 0x7A, 0x2A, 0x90, 0x79, 0x9C, 0x66, 0x90, 0x90, 0x90, 0xDE, 0x90, 0x55, 0x55, 0x55, 0x55, 0xDE, 0x66, 0x55, 0x67, 0x66, 0x55, 0x67, 0xDE, 0x67, 0x55, 0x8C, 0x8C, 0x8C, 0xAC, 0x64, 0xAC, 0x64, 0x47, 0xB8, 0xB9, 0xA6, 0x64, 0x59, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0x28, 0xD9, 0xD9, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x59, 0x28, 0x59, 0x28, 0xA5, 0xAE, 0x59,
+	0x68, 0xBD, 0x68, 0x68, 0xBD, 0x81, 0x81, 0x73, 0x9E, 0x8D, 0x8F, 0x6F, 0x29, 0xF5, 0x40, 0x15, 0x15, 0x71, 0xC7, 0x24, 0xDB, 0xE4, 0x39, 0x80, 0x80, 0x80, 0x80, 0xE4, 0xE4, 0x24, 0xFD, 0x08, 0x4E, 0x02, 0xED, 0x6B, 0x6F, 0x20, 0x7D, 0x8D, 0xBD, 0xC9, 0xC9, 0x0E, 0x7E, 0x51, 0x81, 0x10, 0xC9, 0x04, 0xC9, 0xE1, 0xBD, 0x04, 0x0E, 0x04, 0x51, 0x43, 0xAD, 0xAD, 0x0E, 0x0E, 0x0E, 0xB0, 0xAD, 0x19, 0x19, 0x19, 0x43, 0xAD, 0xAD, 0xEF, 0xEF, 0x13, 0x7E, 0x20, 0x33, 0x20, 0x68, 0x26, 0x9F, 0xB6, 0x25, 0x68, 0x9F, 0x9F, 0x9F, 0x45, 0x45, 0xCD, 0x26, 0x10, 0xCD, 0x81, 0xBD, 0x4A, 0x86, 0xB4, 0xBD, 0xCD, 0x73, 0xB4, 0x73, 0x73, 0x73, 0x73, 0x14, 0xCD, 0x14, 0x14, 0x14, 0x14, 0x14, 0x26, 0x14, 0x9E, 0x8D, 0x8D, 0x9E, 0x99, 0xFE, 0x99, 0x6B, 0xED, 0x02, 0x8E, 0x8E, 0xC8, 0xC8, 0xC8, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x06, 0xBF, 0xBF, 0xD0, 0xCA, 0xCA, 0xD0, 0xE4, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xCA, 0x71, 0x06, 0x17, 0x41, 0xC3, 0x82, 0x4A, 0xBD, 0x04, 0x0E, 0x9F, 0x68, 0x68, 0xA3, 0x9F, 0x26, 0x73, 0x73, 0xCD, 0xBD, 0x73, 0xC3, 0xA3, 0x5C, 0x18, 0xD7, 0x8F, 0x52, 0x6B, 0x52, 0x52, 0xAF, 0xA3, 0x8F, 0x4B, 0x73, 0x70, 0x7A, 0x2A, 0x90, 0x4F, 0x9C, 0x66, 0x55, 0x55, 0xDE, 0x90, 0x67, 0x55, 0x55, 0x67, 0x90, 0x55, 0x55, 0xDE, 0x67, 0xDE, 0x67, 0x67, 0x67, 0x8C, 0xAC, 0x67, 0x64, 0xAC, 0x64, 0xAC, 0x64, 0x64, 0x47, 0xB9, 0xB9, 0xBA, 0x49, 0xF2, 0xB3, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0x28, 0xD9, 0x28, 0xB3, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xAE, 0x28, 0x28, 0x59, 0x28, 0x28, 0x59, 0x28, 0x59, 0x59, 0x90, 0x90,
+	0x68, 0x68, 0xBD, 0x04, 0xBD, 0xE6, 0x81, 0x73, 0x73, 0x8D, 0x8F, 0x6F, 0xA8, 0x65, 0x0D, 0x15, 0x15, 0xDC, 0xC7, 0x24, 0xE4, 0xDB, 0xE4, 0xDB, 0x80, 0x80, 0x1E, 0xE4, 0xDB, 0xC7, 0xC2, 0x15, 0xF6, 0x52, 0xEE, 0x99, 0x12, 0x20, 0x1B, 0x9E, 0xBD, 0xBD, 0xBD, 0xE1, 0x1B, 0x1B, 0xBD, 0x9F, 0x25, 0x0E, 0x4A, 0xD6, 0xBD, 0x0E, 0x0E, 0x04, 0x7C, 0x43, 0x19, 0x19, 0x0E, 0x31, 0xB0, 0xB0, 0xAD, 0xAD, 0xAD, 0x19, 0x43, 0x43, 0x43, 0xAD, 0x50, 0x30, 0x30, 0xE1, 0xD6, 0xE3, 0x60, 0x68, 0x9F, 0x9F, 0xB6, 0x0E, 0xB6, 0x9F, 0x68, 0x10, 0xBD, 0x4B, 0x26, 0x4B, 0x4B, 0x81, 0x86, 0x4A, 0xCD, 0x81, 0x3F, 0x9F, 0x3F, 0x45, 0x3F, 0x73, 0x3F, 0x3F, 0xCD, 0x4B, 0x4B, 0x14, 0x14, 0x14, 0x4B, 0xA3, 0x9A, 0x14, 0x12, 0x12, 0x9E, 0x9E, 0xE5, 0x72, 0x99, 0x99, 0xED, 0x02, 0x8E, 0x16, 0x8E, 0x8E, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x71, 0x17, 0x71, 0x06, 0x71, 0xBF, 0xCA, 0xCA, 0xCA, 0xD0, 0xD0, 0xD0, 0xD0, 0xCA, 0xCA, 0xBF, 0xBF, 0x06, 0x4D, 0x54, 0x5E, 0x9A, 0xFA, 0x10, 0x0E, 0x0E, 0x25, 0x9F, 0x9F, 0x9F, 0x14, 0xA3, 0xD6, 0x14, 0x73, 0xCD, 0x86, 0x9A, 0x14, 0x8D, 0x5E, 0x18, 0x5A, 0x8F, 0x8F, 0xD7, 0x8F, 0xAF, 0x8F, 0xEE, 0x33, 0xCD, 0x73, 0x8B, 0x78, 0xC0, 0x90, 0x53, 0x9D, 0x64, 0x9C, 0x66, 0x66, 0x67, 0x67, 0x66, 0x55, 0x55, 0x55, 0xDE, 0x55, 0x90, 0x67, 0x67, 0xDE, 0x67, 0xDE, 0x67, 0x67, 0xAC, 0xAC, 0x64, 0x64, 0x64, 0xB8, 0x64, 0x49, 0xBA, 0xB9, 0xB9, 0x64, 0xA5, 0xD9, 0x28, 0xB3, 0x28, 0x28, 0xB3, 0xD9, 0xD9, 0x28, 0xD9, 0x28, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0x59, 0x59, 0x36, 0x90, 0x6E, 0xA8, 0xA3,
+	0x81, 0x45, 0x45, 0xBD, 0x45, 0x04, 0x83, 0xE6, 0x73, 0x4B, 0xD7, 0x07, 0xA8, 0xF5, 0x40, 0x96, 0x71, 0x79, 0xBF, 0xDB, 0xE4, 0xE4, 0x80, 0x24, 0x80, 0x39, 0xE4, 0xE4, 0x24, 0x0B, 0xC2, 0x15, 0xA8, 0x5A, 0x99, 0x6B, 0x33, 0x1F, 0x20, 0x12, 0x4A, 0x83, 0x4A, 0x1B, 0x12, 0x4A, 0x4A, 0x9F, 0xC9, 0xC9, 0x25, 0x4A, 0x0E, 0x83, 0xC9, 0x3B, 0x31, 0xEC, 0x19, 0x19, 0x0E, 0x0E, 0xB0, 0x31, 0xB0, 0xAD, 0x19, 0xB0, 0xAD, 0x43, 0x19, 0xAD, 0x19, 0xEC, 0xEC, 0x50, 0x35, 0x03, 0x0C, 0xD6, 0xB6, 0xB6, 0x0E, 0xB6, 0x0E, 0xB6, 0x9F, 0x9F, 0x9E, 0x8D, 0x8D, 0xD7, 0x3F, 0x82, 0xCD, 0x8D, 0x3F, 0xCD, 0xBD, 0xCD, 0x10, 0x3F, 0xB4, 0xCD, 0x73, 0x73, 0x73, 0xCD, 0xCD, 0x4B, 0x4B, 0xCD, 0xA3, 0x8D, 0x14, 0x14, 0x8D, 0x12, 0x8D, 0x8D, 0x99, 0x72, 0x99, 0x99, 0x4C, 0x4C, 0x4C, 0xED, 0x02, 0x02, 0x02, 0x16, 0x16, 0xEA, 0x96, 0xEA, 0xF8, 0xF8, 0x71, 0x06, 0xBF, 0xBF, 0xBF, 0xCA, 0xD0, 0xD0, 0xBF, 0xBF, 0x71, 0xCA, 0xBF, 0x71, 0x4D, 0x17, 0x54, 0x18, 0xFE, 0xB5, 0x10, 0x9F, 0x04, 0x0E, 0x0E, 0x9F, 0x68, 0x9F, 0xA3, 0x26, 0xB4, 0x14, 0x3F, 0x73, 0x73, 0x8D, 0x4A, 0x20, 0x20, 0x8F, 0x8F, 0x8F, 0x52, 0x52, 0x8F, 0x8F, 0x8D, 0x12, 0x26, 0x14, 0x8B, 0x92, 0x0F, 0xC0, 0x9C, 0x98, 0x6E, 0xB8, 0x9D, 0x64, 0x67, 0x8C, 0x67, 0x67, 0x55, 0x55, 0x55, 0x55, 0xDE, 0x55, 0x55, 0x66, 0x67, 0x67, 0x67, 0x8C, 0x67, 0xAC, 0x64, 0x64, 0x64, 0x64, 0x64, 0xB9, 0xB9, 0xA6, 0xBA, 0xDE, 0xAE, 0x28, 0x28, 0x28, 0xD9, 0x28, 0xD9, 0xD9, 0xD9, 0x28, 0xD9, 0xD9, 0xB3, 0xD9, 0xD9, 0xD9, 0x28, 0x28, 0xAE, 0x59, 0x59, 0x59, 0x59, 0x39, 0x67, 0x5C, 0xA3, 0xB2, 0xB2, 0xB2,
+	0x81, 0x81, 0x45, 0x04, 0xBD, 0xB6, 0xE6, 0xB4, 0xF9, 0x73, 0xD7, 0x8F, 0x07, 0x16, 0x4E, 0x2D, 0x71, 0xFD, 0xC7, 0x24, 0xDB, 0xE4, 0x39, 0x39, 0x39, 0x80, 0xE4, 0xE4, 0xE4, 0xC7, 0xC2, 0x65, 0x5C, 0xAF, 0xB2, 0x20, 0x8A, 0xEF, 0x12, 0x30, 0xBD, 0xFB, 0xBD, 0x1B, 0xE1, 0x4A, 0x4B, 0x4A, 0x9F, 0xC9, 0xC9, 0x9F, 0xBD, 0x83, 0x04, 0x04, 0x0E, 0x43, 0x43, 0x43, 0xB0, 0xB0, 0xAD, 0x31, 0x0E, 0x19, 0x19, 0x19, 0x31, 0x19, 0xB0, 0x19, 0x43, 0x43, 0xEC, 0x50, 0x27, 0x5B, 0x56, 0x03, 0xB6, 0xB6, 0xB6, 0x0E, 0xB6, 0x0E, 0x9F, 0x68, 0x10, 0x12, 0x6B, 0xD7, 0x73, 0xF9, 0x3F, 0x12, 0x73, 0xBD, 0xB4, 0x3F, 0x10, 0xBD, 0xB4, 0x3F, 0x45, 0xB4, 0x73, 0x9F, 0xCD, 0x10, 0x4B, 0x4B, 0xA3, 0x4B, 0x4B, 0x14, 0x4B, 0x12, 0xD7, 0xD7, 0xEE, 0x99, 0x99, 0x4C, 0xED, 0xED, 0x6B, 0x02, 0x02, 0x16, 0x16, 0x16, 0xC1, 0xEA, 0xEA, 0xF8, 0xF8, 0x4D, 0x4D, 0x13, 0x71, 0x06, 0xBF, 0xBF, 0xBF, 0xD0, 0xBF, 0xBF, 0xBF, 0xBF, 0x4D, 0x4D, 0xF8, 0xEB, 0x42, 0x33, 0xFE, 0xB5, 0x9F, 0xB6, 0x0E, 0x0E, 0x0E, 0x9F, 0x9F, 0x9F, 0x26, 0x26, 0x73, 0xCD, 0x73, 0xCD, 0x86, 0x4B, 0x8D, 0x20, 0x20, 0xD7, 0x18, 0x8F, 0xD7, 0x8F, 0x6F, 0x8F, 0x8D, 0xD7, 0x8D, 0xA3, 0x58, 0x92, 0x0F, 0x06, 0x98, 0x87, 0x42, 0x01, 0xB8, 0xFC, 0x64, 0xB8, 0x67, 0x64, 0x67, 0x8C, 0x8C, 0x8C, 0x67, 0x55, 0x55, 0x67, 0x55, 0x55, 0xAC, 0x67, 0x8C, 0xAC, 0xAC, 0x64, 0x64, 0xB9, 0x47, 0x47, 0xB9, 0xBA, 0xBA, 0x05, 0xA5, 0x28, 0xD9, 0x28, 0x28, 0xD9, 0x28, 0xD9, 0xD9, 0x28, 0xD9, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x59, 0xA5, 0xA5, 0xB1, 0x90, 0x84, 0x5C, 0x14, 0x6C, 0x6C, 0xB2, 0xB4, 0x68,
+	0x81, 0x73, 0xBD, 0xBD, 0x83, 0x83, 0x83, 0xE6, 0xF9, 0xC3, 0x8D, 0x8F, 0x6F, 0x29, 0xF5, 0x6A, 0x4D, 0xDD, 0xBF, 0x24, 0x24, 0xE4, 0x39, 0x39, 0x24, 0x80, 0x1E, 0xDB, 0x24, 0xC7, 0xC2, 0x3C, 0xA8, 0xA3, 0x98, 0x91, 0x2F, 0x8D, 0x20, 0xEF, 0xC9, 0x83, 0x04, 0x4A, 0x12, 0x10, 0x10, 0x4A, 0xC9, 0x25, 0x9F, 0x04, 0xBD, 0x04, 0x04, 0x04, 0x0E, 0x19, 0x19, 0x43, 0x43, 0xB0, 0xB0, 0x0E, 0x0E, 0xAD, 0x19, 0xB0, 0x31, 0xAD, 0x19, 0xB0, 0x19, 0x5B, 0x43, 0xAD, 0xB0, 0x35, 0xEC, 0x56, 0x03, 0x0E, 0x0E, 0x3B, 0xB6, 0x0E, 0x3B, 0x9F, 0xBD, 0x52, 0xD7, 0xD7, 0xB5, 0xFA, 0x73, 0x26, 0x45, 0x68, 0xB4, 0x45, 0xCD, 0xBD, 0xB4, 0x73, 0x3F, 0x73, 0x73, 0x3F, 0x4B, 0xA3, 0x4B, 0x4B, 0x4B, 0x8D, 0x14, 0x14, 0x9A, 0xA3, 0x52, 0x52, 0x5A, 0xED, 0xBB, 0x16, 0xC1, 0xEA, 0xEA, 0xF8, 0xF8, 0x96, 0xF8, 0x96, 0xF8, 0x96, 0x96, 0x4D, 0x71, 0x17, 0x71, 0xBF, 0xBF, 0xBF, 0xCA, 0xBF, 0xCA, 0xCA, 0xD0, 0xD0, 0xD0, 0xD0, 0xCA, 0xBF, 0xD0, 0xD1, 0x0F, 0x01, 0xA3, 0xB5, 0x68, 0xB6, 0x25, 0x0E, 0x0E, 0x9F, 0x9F, 0x10, 0x9F, 0x4A, 0x9F, 0xCD, 0xB4, 0x4B, 0x82, 0x8D, 0x4B, 0x20, 0x18, 0x8F, 0x8F, 0x18, 0x52, 0x8F, 0x8F, 0x8F, 0x8D, 0x12, 0x26, 0xA3, 0xCF, 0xA4, 0xCB, 0x11, 0x01, 0x01, 0xF4, 0xF4, 0x5E, 0x01, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x64, 0x64, 0x64, 0x64, 0x84, 0x55, 0x55, 0x66, 0x55, 0x8C, 0x8C, 0x67, 0xAC, 0x64, 0x64, 0xB8, 0xAC, 0x47, 0xBA, 0xB9, 0xE3, 0xAC, 0x59, 0x28, 0x28, 0x28, 0x28, 0x28, 0xD9, 0xD9, 0x28, 0xD9, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x28, 0x59, 0x59, 0x59, 0x90, 0x84, 0xA8, 0x72, 0x72, 0x6C, 0x09, 0xB2, 0x14, 0xB4, 0xCD,
+	0x73, 0x9F, 0xCD, 0xBD, 0x81, 0x83, 0x97, 0xF9, 0x81, 0xC3, 0x8D, 0x8F, 0x02, 0xAF, 0xF6, 0xDF, 0x4D, 0xFD, 0xC7, 0xDB, 0x24, 0x7F, 0xE4, 0x39, 0x24, 0x39, 0x7F, 0xE4, 0x24, 0xBF, 0x08, 0x65, 0xA8, 0x11, 0x95, 0x22, 0x33, 0xCD, 0x60, 0x75, 0xBD, 0x04, 0x83, 0xD6, 0x1B, 0x4A, 0x10, 0x4A, 0x4A, 0xC9, 0x9F, 0x4A, 0xC9, 0xBD, 0x04, 0x04, 0x0E, 0x43, 0x19, 0x19, 0x43, 0xAD, 0x7C, 0x7C, 0x0E, 0x0E, 0xB0, 0xB0, 0xB0, 0x19, 0x43, 0xB0, 0xB0, 0x43, 0xEC, 0x19, 0xB0, 0xB6, 0x25, 0x56, 0x63, 0x63, 0x0E, 0x3B, 0xB6, 0x6D, 0x0E, 0xB6, 0x3F, 0x26, 0xD7, 0xD7, 0xB5, 0xF9, 0x3F, 0x12, 0xB4, 0xB4, 0x45, 0xB4, 0xBD, 0xCD, 0x73, 0x45, 0x73, 0x3F, 0x73, 0x3F, 0xCD, 0xCD, 0xCD, 0x14, 0x14, 0xA3, 0x9A, 0xC3, 0xC3, 0x9E, 0x8D, 0x6F, 0x8F, 0x16, 0xC1, 0x3E, 0x6A, 0xF8, 0xF8, 0xF8, 0x96, 0xF8, 0x71, 0x71, 0x71, 0x17, 0x96, 0x17, 0x71, 0x4D, 0x06, 0xBF, 0xBF, 0xCA, 0xBF, 0xBF, 0x06, 0xCA, 0xCA, 0xBF, 0xDB, 0xDB, 0xD0, 0x7F, 0x92, 0xE8, 0x32, 0x32, 0xD4, 0xAC, 0xE3, 0x9F, 0xB6, 0xB6, 0xB6, 0x26, 0x0E, 0xB6, 0x68, 0x9F, 0x10, 0x68, 0xE6, 0xCD, 0x82, 0xA3, 0x9E, 0x33, 0x5E, 0x8F, 0x33, 0x8F, 0x52, 0x52, 0x8F, 0x8F, 0x8D, 0xD7, 0x26, 0xEE, 0xCE, 0x36, 0xCF, 0x54, 0xF4, 0x42, 0x01, 0xF4, 0x5C, 0xF4, 0x01, 0x42, 0x01, 0xB8, 0x01, 0xBA, 0xB8, 0xB8, 0xFC, 0xB8, 0x67, 0x67, 0x67, 0xAC, 0x67, 0xAC, 0xAC, 0x64, 0xAC, 0x64, 0x47, 0xB8, 0x47, 0xB9, 0x03, 0x01, 0xAC, 0xA5, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x28, 0xAE, 0x28, 0x28, 0xAE, 0x59, 0x59, 0x90, 0x84, 0x8F, 0x14, 0x6C, 0x72, 0x72, 0xB2, 0x14, 0xB2, 0xA3, 0x26,
+	0x73, 0x4B, 0xCD, 0x4B, 0x3F, 0xB4, 0x81, 0x82, 0x82, 0xC3, 0x14, 0x5A, 0x52, 0xED, 0x29, 0xDF, 0x4D, 0xC2, 0xFD, 0x24, 0x24, 0xE4, 0xDB, 0xE4, 0x39, 0xE4, 0xE4, 0xE4, 0x24, 0xC7, 0xA9, 0x3C, 0xCA, 0x91, 0x13, 0xEE, 0x12, 0x8D, 0x1B, 0x60, 0x83, 0x04, 0x3B, 0x4A, 0x60, 0xD6, 0x10, 0x4A, 0x25, 0x04, 0x9F, 0xE1, 0x4A, 0x04, 0x0E, 0x04, 0x31, 0x19, 0x19, 0xAD, 0x19, 0x43, 0xB0, 0x31, 0x0E, 0x0E, 0xB0, 0x19, 0x19, 0x43, 0x19, 0xB0, 0xB0, 0x19, 0x43, 0x43, 0x0C, 0x60, 0xB6, 0xB0, 0x56, 0x5B, 0x27, 0x31, 0x6D, 0xB6, 0x0E, 0x68, 0xA3, 0xD7, 0x12, 0x26, 0xB4, 0xF9, 0xCD, 0x12, 0xBD, 0xBD, 0x68, 0x3F, 0xBD, 0x3F, 0xBD, 0xB4, 0xB4, 0xB4, 0x81, 0x73, 0x9F, 0x4B, 0xCD, 0xA3, 0x4B, 0x14, 0x9E, 0xFE, 0xFE, 0x9E, 0x6B, 0x8F, 0x6F, 0xDA, 0x8E, 0x40, 0x40, 0x96, 0x96, 0xF8, 0xF8, 0x96, 0xF8, 0x96, 0xF8, 0xF8, 0x4D, 0x96, 0x17, 0x96, 0x71, 0x06, 0xBF, 0x71, 0x06, 0xBF, 0x06, 0x06, 0x79, 0x79, 0x4D, 0xC0, 0xDB, 0x7F, 0xD2, 0xE8, 0x32, 0x57, 0x91, 0x1D, 0xC6, 0xDE, 0xE3, 0x26, 0xB6, 0xB2, 0xB6, 0x0E, 0x0E, 0xC9, 0x0E, 0x68, 0xB6, 0xCD, 0xC3, 0x26, 0xEE, 0x5C, 0x18, 0xD7, 0x8F, 0x18, 0xD7, 0x52, 0x8F, 0x8F, 0x52, 0x12, 0x8D, 0xD7, 0x2A, 0xA2, 0x06, 0x8B, 0xF4, 0x87, 0x87, 0x01, 0xF4, 0xF4, 0x01, 0xF4, 0xF4, 0x01, 0xF4, 0x42, 0x01, 0x42, 0x01, 0x01, 0x01, 0xBA, 0x64, 0x64, 0x64, 0xAC, 0x64, 0xAC, 0x64, 0x64, 0x47, 0xAC, 0xB9, 0x03, 0xBA, 0xA6, 0x37, 0xAE, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x28, 0x59, 0x59, 0x59, 0x59, 0x36, 0x66, 0x01, 0xAF, 0xB2, 0x72, 0xB2, 0xB2, 0xC4, 0x14, 0xD7, 0xAF, 0xAF,
+	0xA3, 0x4B, 0xA3, 0x4B, 0xCD, 0x73, 0x73, 0x73, 0x3A, 0xC3, 0x8D, 0x52, 0x5A, 0xED, 0x07, 0x87, 0xDF, 0x71, 0xC7, 0xDB, 0x24, 0x24, 0xE4, 0x24, 0x39, 0x39, 0x7F, 0x7F, 0xC7, 0xFD, 0xBF, 0xD0, 0x32, 0xF8, 0x99, 0x26, 0xCD, 0xCD, 0x75, 0x4A, 0xE6, 0x83, 0xFB, 0xC9, 0x60, 0x12, 0x9F, 0x10, 0x25, 0xB6, 0xC9, 0xE1, 0x1B, 0xC9, 0xC9, 0x04, 0x0E, 0x31, 0x19, 0x19, 0x19, 0x19, 0x43, 0x7C, 0x3B, 0x0E, 0xB0, 0x19, 0x43, 0x43, 0xB0, 0xB0, 0xAD, 0xB0, 0x19, 0xAD, 0xAD, 0xAD, 0x31, 0x25, 0x27, 0x63, 0xD8, 0x27, 0x9F, 0x68, 0xB6, 0x9F, 0x10, 0x26, 0x12, 0xA3, 0xB4, 0xB6, 0xA3, 0x12, 0x3F, 0xBD, 0xCD, 0xBD, 0xBD, 0x3F, 0x10, 0x3F, 0x3F, 0x73, 0x73, 0x3F, 0xCD, 0xCD, 0x4B, 0xA3, 0xA3, 0x14, 0x14, 0x9A, 0x9A, 0x9E, 0x5A, 0xBB, 0xBB, 0x16, 0x3E, 0x0D, 0x96, 0x96, 0x96, 0x40, 0x96, 0xF8, 0x96, 0xF8, 0x71, 0xF8, 0x71, 0x96, 0x71, 0x06, 0x71, 0xBF, 0xBF, 0x71, 0x06, 0x71, 0x4D, 0x06, 0x4D, 0x79, 0x06, 0xC0, 0xDB, 0x7F, 0x5F, 0xF2, 0xE2, 0xE2, 0x57, 0xFF, 0x1D, 0xA0, 0x23, 0x05, 0xBA, 0x25, 0x9F, 0xB6, 0xB6, 0x0E, 0x9F, 0xB6, 0xB6, 0x9F, 0xC4, 0x26, 0xD7, 0x8F, 0xA6, 0xD7, 0x8F, 0x12, 0xD7, 0x52, 0x8F, 0x18, 0xD7, 0x12, 0x8D, 0xD7, 0xA2, 0x2A, 0xCF, 0xE7, 0x87, 0xB8, 0xE7, 0xEB, 0x01, 0x87, 0xF4, 0x01, 0xF4, 0x01, 0xF4, 0xF4, 0x5E, 0xF4, 0xF4, 0x5E, 0x01, 0x01, 0x01, 0xBA, 0xBA, 0xB9, 0x47, 0xB9, 0x47, 0x47, 0xB8, 0x47, 0xB9, 0xB9, 0x03, 0x5E, 0x90, 0xA5, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x28, 0xD9, 0x28, 0xAE, 0x28, 0x28, 0x28, 0x59, 0x28, 0x59, 0x1E, 0x59, 0x90, 0xBA, 0x26, 0xB2, 0xB2, 0x14, 0xB5, 0xA3, 0xA3, 0x8F, 0x8F, 0x8F, 0x4C,
+	0xE3, 0x33, 0x26, 0x26, 0x26, 0xCD, 0x9A, 0x9A, 0xC3, 0x9A, 0x8D, 0x6B, 0xEE, 0xA3, 0x52, 0xC1, 0x40, 0x15, 0xFD, 0xC7, 0xDB, 0x24, 0xDB, 0x24, 0x39, 0xDB, 0x80, 0x7F, 0xC7, 0xDB, 0x7F, 0xD2, 0xEA, 0xD7, 0x99, 0x33, 0xA3, 0xA6, 0xD8, 0x10, 0x83, 0x83, 0x3B, 0x04, 0xD6, 0xD6, 0x9F, 0x9F, 0xC9, 0xB6, 0x9F, 0xE1, 0x35, 0xD6, 0x4A, 0xC9, 0x0E, 0x0E, 0xB0, 0x19, 0xAD, 0x7C, 0x19, 0x19, 0x19, 0x19, 0x19, 0x43, 0xEC, 0xAD, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0x19, 0xAD, 0x0E, 0xB0, 0x9B, 0x9B, 0x9B, 0xB0, 0x63, 0x9B, 0xB6, 0xB6, 0xB6, 0xA3, 0x26, 0x12, 0x14, 0xB4, 0x97, 0xCD, 0xD6, 0x3F, 0x3F, 0x9F, 0x3F, 0xB4, 0x68, 0x10, 0xBD, 0x3F, 0x10, 0xCD, 0x9F, 0x73, 0x73, 0xCD, 0x4B, 0x14, 0x14, 0x14, 0x14, 0x9E, 0xFE, 0xEE, 0x8F, 0x6F, 0xC1, 0x3E, 0xC8, 0x94, 0xC8, 0x40, 0xC8, 0x6A, 0x96, 0xF8, 0x96, 0xF8, 0x71, 0xF8, 0x4D, 0x4D, 0x96, 0x71, 0x71, 0x71, 0x4D, 0x71, 0x71, 0x4D, 0x4D, 0x4D, 0x06, 0x53, 0xA2, 0x5F, 0x7F, 0xF2, 0xD2, 0xF1, 0xF1, 0xC5, 0xF0, 0xC5, 0xE2, 0xFF, 0x1D, 0x23, 0x05, 0x03, 0xD6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB5, 0xB5, 0xA3, 0x8F, 0x33, 0x5E, 0xD7, 0xD7, 0x8F, 0x12, 0xD7, 0x8F, 0x8F, 0x8D, 0x12, 0x8D, 0xD7, 0x36, 0xC0, 0x79, 0x85, 0x98, 0x85, 0x98, 0x54, 0x85, 0x98, 0x87, 0x6E, 0x42, 0x01, 0xF4, 0x01, 0x5C, 0xF4, 0x5C, 0xA8, 0x5C, 0x5C, 0x5C, 0x5E, 0x5E, 0xA6, 0x01, 0x5E, 0xBA, 0xBA, 0xB9, 0xB9, 0xA6, 0xA6, 0xA6, 0x5E, 0x55, 0xA5, 0x28, 0x28, 0xA5, 0xA5, 0x28, 0xA5, 0x28, 0xAE, 0x28, 0x28, 0xA5, 0x28, 0xA5, 0x59, 0x59, 0x39, 0x67, 0x01, 0xAF, 0xB2, 0xB2, 0xB2, 0xCD, 0x4B, 0x8D, 0x52, 0xD7, 0x8F, 0xAF, 0x8F,
+	0x47, 0x03, 0x5E, 0x33, 0x26, 0x26, 0x4B, 0x9E, 0x9A, 0x9E, 0x8D, 0x99, 0xFE, 0x99, 0x5A, 0x6F, 0x40, 0x15, 0xFD, 0x24, 0x24, 0xDB, 0xE4, 0xC7, 0x39, 0xDB, 0x24, 0xE4, 0x93, 0x93, 0x24, 0x71, 0x18, 0xAF, 0xD7, 0x8F, 0x20, 0x22, 0x1B, 0xFB, 0x97, 0x3B, 0x3B, 0xE6, 0x4A, 0xE1, 0x10, 0x4A, 0xB6, 0x9F, 0x9F, 0x9F, 0x75, 0x1B, 0x4A, 0xC9, 0x31, 0x0E, 0x6D, 0xAD, 0x43, 0xAD, 0xB0, 0x31, 0xB0, 0x19, 0x19, 0x43, 0x19, 0x31, 0x31, 0xB0, 0xB0, 0x19, 0xAD, 0xAD, 0x19, 0xB0, 0xAD, 0xEC, 0x5B, 0x9B, 0xE1, 0xE1, 0x56, 0xE3, 0xB7, 0x0E, 0xA3, 0x10, 0x33, 0x14, 0xB4, 0x83, 0xA3, 0x33, 0xBD, 0xBD, 0xCD, 0x68, 0x97, 0xB4, 0xCD, 0x68, 0xB4, 0xB4, 0x73, 0xB4, 0xB4, 0x73, 0x4B, 0x26, 0xCD, 0xCD, 0x4B, 0x4B, 0x73, 0xC3, 0xEE, 0x52, 0x6F, 0xF5, 0xC8, 0x0D, 0x94, 0xC8, 0xC8, 0x96, 0xC8, 0x40, 0x96, 0x96, 0x4D, 0x96, 0x71, 0x4D, 0x96, 0x71, 0x71, 0x06, 0x71, 0x96, 0x4D, 0x71, 0x06, 0x71, 0x17, 0xDD, 0xBF, 0xA2, 0x7F, 0x59, 0x5F, 0xF2, 0xF2, 0xAE, 0xF1, 0xAE, 0xE2, 0x77, 0xAE, 0xF0, 0xF0, 0x1D, 0xA0, 0x05, 0x03, 0xA3, 0xB6, 0x00, 0xB6, 0xB7, 0x97, 0x14, 0x12, 0xD7, 0xA6, 0x26, 0xD7, 0x8F, 0x12, 0x52, 0xD7, 0x52, 0x4B, 0xD7, 0xA3, 0x8F, 0x78, 0xC0, 0x54, 0xB8, 0x58, 0x85, 0xFC, 0x54, 0x54, 0x98, 0x98, 0x85, 0x87, 0x87, 0x01, 0xF4, 0x5E, 0xF4, 0xA8, 0x5C, 0x5C, 0xA8, 0x8F, 0x5E, 0x5C, 0x5C, 0x5C, 0xE3, 0x5C, 0x5E, 0x5E, 0x5E, 0xE3, 0x5E, 0xE3, 0xE3, 0x90, 0xA5, 0xA5, 0xA5, 0x28, 0xA5, 0xA5, 0x28, 0xAE, 0x28, 0xA5, 0x28, 0x28, 0xA5, 0xA5, 0x59, 0x59, 0x9C, 0xA8, 0xB2, 0x6C, 0xB2, 0x14, 0xA3, 0x26, 0x4B, 0xD7, 0x12, 0x8F, 0x8F, 0x02, 0x8F,
+	0x49, 0xBC, 0x47, 0x35, 0x5E, 0x33, 0x12, 0x4B, 0x9E, 0x6B, 0x8D, 0x9E, 0xFE, 0x99, 0xEE, 0x8F, 0x65, 0x15, 0xBF, 0xC7, 0x24, 0x24, 0xDB, 0xE4, 0x39, 0x24, 0x39, 0xD2, 0x93, 0x24, 0xBF, 0x6A, 0x5C, 0xAF, 0x33, 0x5E, 0x8A, 0x7D, 0x81, 0x3B, 0x3B, 0xB6, 0x3B, 0x97, 0xB6, 0xC9, 0x60, 0x60, 0xB6, 0x3B, 0x04, 0xC9, 0x35, 0x1B, 0xE1, 0xE1, 0x1B, 0x3B, 0x6D, 0x0E, 0xAD, 0x43, 0x7E, 0x7C, 0x31, 0x31, 0x7C, 0x43, 0x31, 0xB0, 0xAD, 0xAD, 0xAD, 0xB0, 0x19, 0x19, 0xAD, 0xAD, 0x19, 0x0C, 0x56, 0xB0, 0x33, 0xD6, 0x33, 0x9B, 0x0E, 0xB6, 0x10, 0xCD, 0x33, 0x14, 0x81, 0xF9, 0xCD, 0x12, 0xB4, 0x68, 0x68, 0x68, 0xB4, 0x45, 0x68, 0x10, 0x9F, 0xCD, 0xB4, 0xB4, 0x73, 0x73, 0xCD, 0x4B, 0xCD, 0x12, 0xCD, 0x73, 0xCD, 0xC3, 0x14, 0x52, 0x8F, 0xF5, 0x3E, 0x8E, 0x94, 0xC8, 0xC8, 0xC8, 0x94, 0xF8, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x4D, 0x4D, 0x96, 0x71, 0x71, 0x71, 0x71, 0xF8, 0x71, 0x71, 0x71, 0x06, 0xC0, 0xDB, 0x7F, 0x3D, 0x59, 0x59, 0xF2, 0xF2, 0xF2, 0xAE, 0xE2, 0xAE, 0xF1, 0x77, 0xAE, 0xAE, 0x1D, 0xA0, 0xFF, 0x05, 0x60, 0x00, 0xB7, 0xB6, 0xB7, 0x9F, 0x12, 0x12, 0x20, 0xD7, 0xD7, 0x12, 0x12, 0x8D, 0x5A, 0xAF, 0x8D, 0x12, 0x14, 0x18, 0x36, 0xC0, 0x9D, 0x54, 0x58, 0x54, 0x58, 0x64, 0x9D, 0x58, 0x8B, 0x98, 0x58, 0x85, 0x98, 0x87, 0xBA, 0x01, 0x5E, 0xF4, 0x5C, 0x5C, 0x5C, 0x8F, 0xE3, 0x5C, 0xE3, 0x5C, 0x8F, 0x8F, 0x01, 0x5E, 0x5E, 0xE3, 0xAF, 0xAF, 0x84, 0xA5, 0x28, 0xA5, 0xA5, 0xA5, 0xA5, 0x28, 0xD9, 0xA5, 0x28, 0x28, 0xA5, 0xA5, 0xA5, 0x3D, 0xCA, 0x5C, 0x72, 0x6C, 0x72, 0xA3, 0xAF, 0x4B, 0x26, 0x12, 0x12, 0x52, 0x6F, 0x52, 0x8F, 0x6F,
+	0x49, 0x49, 0x49, 0xBC, 0x35, 0xA6, 0x33, 0x12, 0x8D, 0xD7, 0x52, 0x9E, 0xFE, 0x72, 0xEE, 0x52, 0x65, 0x15, 0xFD, 0xC7, 0xCA, 0xE4, 0x24, 0xE4, 0x24, 0xDB, 0xDB, 0x7F, 0xE4, 0xBF, 0xFD, 0xDF, 0xA8, 0x8F, 0xB9, 0x1F, 0x8A, 0x10, 0xB7, 0x97, 0x83, 0xE6, 0x04, 0x04, 0x83, 0x68, 0x1B, 0x03, 0xFB, 0x6D, 0x04, 0x04, 0x7E, 0x75, 0x4A, 0x1B, 0xAD, 0x3B, 0x0E, 0x6D, 0x0E, 0x0C, 0x19, 0x43, 0xAD, 0x7C, 0x19, 0x43, 0x0E, 0x31, 0x19, 0xB0, 0xAD, 0xAD, 0xB0, 0x19, 0x19, 0xAD, 0x19, 0x0C, 0x75, 0x63, 0x1B, 0x97, 0xE3, 0x03, 0x03, 0x68, 0x9F, 0x26, 0x8D, 0x73, 0x81, 0xF9, 0xCD, 0x12, 0x86, 0xBD, 0x68, 0xBD, 0xB4, 0xE6, 0x68, 0x10, 0xCD, 0x9F, 0x68, 0xB4, 0x3F, 0x3F, 0xCD, 0xCD, 0x4B, 0x26, 0x26, 0x4B, 0xCD, 0x73, 0x14, 0xD7, 0x07, 0xC1, 0xF3, 0x8E, 0xC8, 0x40, 0x94, 0xC8, 0x96, 0x40, 0x96, 0x6A, 0x96, 0x4D, 0x71, 0x71, 0x71, 0x71, 0x71, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0x06, 0xBF, 0xBF, 0xC7, 0xDB, 0x7F, 0x3D, 0x3D, 0x59, 0xF2, 0x59, 0x59, 0xAE, 0xD2, 0xF2, 0xAE, 0xE2, 0xAE, 0xE2, 0xAE, 0xD5, 0xB3, 0x23, 0xC6, 0x9B, 0xB6, 0x00, 0xB6, 0x26, 0xC9, 0x12, 0x20, 0x26, 0x26, 0x52, 0x12, 0x6B, 0xD7, 0xEE, 0xD7, 0xD7, 0x9E, 0x20, 0xA2, 0x79, 0x98, 0x54, 0xE0, 0x9C, 0x67, 0x64, 0x67, 0x58, 0x58, 0x8B, 0x58, 0x98, 0x8B, 0x98, 0x98, 0xB9, 0x01, 0x87, 0x01, 0x5E, 0x5C, 0x5C, 0x5C, 0xA8, 0x8F, 0x8F, 0x5C, 0x5C, 0x01, 0x01, 0x01, 0xA8, 0xAF, 0xAF, 0x84, 0x59, 0xA5, 0xA5, 0x28, 0xA5, 0x28, 0x28, 0xD9, 0xA5, 0x28, 0xA5, 0x1E, 0xA5, 0x7F, 0x66, 0xA8, 0x4C, 0x72, 0x4C, 0x4C, 0xAF, 0x12, 0xD7, 0xD7, 0x52, 0x12, 0x07, 0x33, 0x6F, 0x8F, 0x6F,
+	0x9B, 0xAC, 0x9B, 0x1F, 0x49, 0x03, 0xA6, 0xE3, 0x8F, 0x33, 0xD7, 0x8D, 0xFE, 0x09, 0x9E, 0x8F, 0x65, 0x15, 0xFD, 0xC7, 0x24, 0x24, 0xC7, 0xE4, 0x24, 0x39, 0xE4, 0x24, 0x24, 0xCA, 0xFD, 0xA9, 0x42, 0x47, 0x70, 0x7D, 0x13, 0xFA, 0xB4, 0xBD, 0xBD, 0x04, 0x83, 0x04, 0xC9, 0x60, 0x35, 0x60, 0x04, 0xB7, 0x6D, 0xE1, 0xEF, 0x1B, 0xC9, 0x35, 0x25, 0x0E, 0x6D, 0x0E, 0x51, 0xB0, 0x0E, 0x1B, 0x0C, 0x19, 0xAD, 0xB0, 0x31, 0x31, 0x31, 0x19, 0xAD, 0x19, 0xB0, 0x19, 0x43, 0x19, 0x19, 0x0C, 0xB0, 0xD8, 0x75, 0x9F, 0x68, 0x03, 0x9B, 0xD6, 0x68, 0x12, 0x9E, 0x86, 0x81, 0x83, 0x8D, 0x12, 0x10, 0x9F, 0x10, 0xBD, 0x68, 0xB4, 0x68, 0x9F, 0x10, 0x4A, 0xCD, 0x9F, 0xCD, 0xBD, 0x4B, 0xCD, 0x26, 0xA3, 0x12, 0x4B, 0x4B, 0x14, 0x9A, 0xD7, 0x07, 0x07, 0xF5, 0x3E, 0xC8, 0x8E, 0xC8, 0xF8, 0xC8, 0x96, 0x0D, 0xE9, 0x96, 0x71, 0x96, 0x71, 0x4D, 0x71, 0x71, 0x71, 0x4D, 0x4D, 0x71, 0x4D, 0x71, 0x71, 0xBF, 0xBF, 0xDB, 0xDB, 0x7F, 0x3D, 0x3D, 0xD2, 0x59, 0xD2, 0x59, 0xD2, 0xF2, 0xA5, 0xF1, 0xAE, 0xF1, 0xAE, 0xE2, 0xB3, 0xB3, 0x1D, 0xA0, 0xB3, 0xDE, 0x26, 0xB7, 0xB6, 0x9F, 0x4A, 0xA6, 0x26, 0xD7, 0x12, 0x6B, 0x8D, 0x8F, 0xD7, 0x52, 0x8D, 0x14, 0xA6, 0xA2, 0x79, 0x98, 0xE0, 0x55, 0x55, 0x9C, 0x9C, 0x9C, 0x9D, 0x58, 0x58, 0x58, 0x58, 0x58, 0x8B, 0x58, 0x8B, 0x98, 0x42, 0x87, 0xB9, 0x87, 0x5E, 0x5C, 0x5C, 0x5C, 0x8F, 0x5C, 0xA8, 0x6E, 0xFC, 0xF4, 0x8F, 0xAF, 0xAF, 0x84, 0xA5, 0x28, 0xA5, 0x28, 0x28, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0xA5, 0x1E, 0x36, 0x84, 0x8F, 0x14, 0x6C, 0x72, 0xAF, 0xD7, 0x8F, 0xD7, 0xAF, 0x8F, 0x8F, 0x6F, 0x07, 0x6F, 0x8F, 0xBB, 0x8F,
+	0x49, 0x9B, 0x9B, 0x2C, 0x1F, 0x49, 0x47, 0xA6, 0xE3, 0x18, 0x12, 0x8D, 0xFE, 0x09, 0x99, 0x6F, 0x4E, 0x15, 0xFD, 0x24, 0x24, 0x24, 0x24, 0xDB, 0x24, 0x39, 0x39, 0xE4, 0xCA, 0x0B, 0x71, 0x3C, 0x54, 0x88, 0x1F, 0xA6, 0x60, 0xB2, 0xB4, 0x83, 0x6D, 0x3B, 0x83, 0x6D, 0xB6, 0x35, 0x75, 0x1F, 0x35, 0x51, 0x35, 0x75, 0x35, 0x4A, 0xE1, 0x4A, 0x7C, 0x9F, 0x3B, 0x51, 0x60, 0xC9, 0x0E, 0x1B, 0x19, 0xAD, 0x31, 0x0E, 0x0E, 0xB0, 0x31, 0xB0, 0x19, 0x19, 0xAD, 0x19, 0x43, 0x43, 0x19, 0x19, 0x31, 0x9F, 0x75, 0x75, 0x00, 0xA3, 0x03, 0x9B, 0x10, 0x4A, 0x4B, 0x4B, 0x45, 0x83, 0x26, 0x33, 0xBD, 0x10, 0x9F, 0x10, 0x68, 0x68, 0x9F, 0xCD, 0x26, 0x25, 0x68, 0xCD, 0x9F, 0x73, 0xCD, 0x4B, 0x26, 0x9A, 0x12, 0xD7, 0x14, 0x14, 0x9E, 0x52, 0x8F, 0x41, 0xEA, 0x40, 0x40, 0x40, 0xC8, 0x96, 0x6A, 0x6A, 0x6A, 0x96, 0x96, 0x71, 0x71, 0x71, 0x71, 0x4D, 0x71, 0x96, 0x96, 0x4D, 0x71, 0x71, 0x06, 0xFD, 0xBF, 0xC7, 0xCA, 0xDB, 0x7F, 0x7F, 0xD2, 0x3D, 0xD2, 0x59, 0xF2, 0x59, 0xD2, 0x59, 0xD2, 0xE2, 0xAE, 0xAE, 0xAE, 0xA5, 0xAE, 0xAE, 0xB3, 0x23, 0xA0, 0x05, 0x25, 0xB6, 0x68, 0x9F, 0xE3, 0x26, 0xA3, 0x8D, 0x8D, 0x8D, 0x8F, 0xEE, 0x26, 0x9E, 0x9E, 0x70, 0xA2, 0xCF, 0xA9, 0xCF, 0xCE, 0x66, 0x55, 0x9C, 0xE0, 0x9C, 0x64, 0x67, 0x58, 0x58, 0x48, 0x58, 0x58, 0x8B, 0xB8, 0xB9, 0x98, 0x87, 0xB9, 0x42, 0xA6, 0x5E, 0x5C, 0x5C, 0xA8, 0x01, 0xE7, 0x85, 0x3C, 0xA8, 0xAF, 0x29, 0x90, 0xA5, 0x28, 0x28, 0x28, 0xA5, 0x28, 0xD9, 0xD9, 0xD9, 0xA5, 0xA5, 0x59, 0x84, 0x8F, 0x72, 0x72, 0x72, 0xAF, 0x8F, 0x8F, 0xAF, 0xAF, 0x5A, 0x8F, 0x8F, 0x07, 0x8F, 0x07, 0x52, 0x52, 0xBB,
+	0x03, 0x03, 0x9B, 0x2C, 0x2C, 0x2C, 0x9B, 0x49, 0xA6, 0x5E, 0x8F, 0xD7, 0x14, 0x09, 0x99, 0x8F, 0x65, 0x15, 0xBF, 0xC7, 0x24, 0xDB, 0xE4, 0xE4, 0x24, 0x39, 0xE4, 0xE4, 0x24, 0xC7, 0xC2, 0xA9, 0x89, 0x57, 0x33, 0xE3, 0x12, 0xA3, 0xB4, 0x83, 0x45, 0x83, 0xBD, 0x3B, 0x3B, 0xBD, 0x4A, 0xE1, 0x35, 0x35, 0x75, 0x1B, 0x25, 0x1B, 0x4A, 0xC9, 0xD6, 0xC9, 0x51, 0x0C, 0x25, 0xB6, 0x0E, 0x03, 0xAD, 0x0E, 0x0E, 0x31, 0x0E, 0xB0, 0xB0, 0x7C, 0xB0, 0x19, 0x19, 0x19, 0x43, 0x43, 0x43, 0x43, 0xAD, 0xB7, 0xC9, 0x8A, 0xE3, 0x00, 0xB0, 0x63, 0xE1, 0x81, 0x9E, 0xBD, 0xBD, 0x83, 0x10, 0x33, 0xBD, 0x3F, 0x10, 0x9F, 0xBD, 0x68, 0x68, 0x68, 0x9F, 0x26, 0x68, 0xB4, 0x73, 0xB4, 0x4B, 0x8D, 0x8D, 0x9E, 0x18, 0x12, 0x9E, 0x14, 0x9A, 0x52, 0x52, 0x41, 0x40, 0xEA, 0x3E, 0xC8, 0x6A, 0x40, 0x40, 0xC8, 0x96, 0x96, 0x96, 0x96, 0x71, 0x4D, 0x08, 0x71, 0x71, 0x71, 0x4D, 0x96, 0x71, 0x71, 0xFD, 0xBF, 0xBF, 0xC7, 0xCA, 0xDB, 0x7F, 0x7F, 0x7F, 0x3D, 0x3D, 0x59, 0x3D, 0xD2, 0xD2, 0xD2, 0xAE, 0xD2, 0xD2, 0xAE, 0xE2, 0xD9, 0xE2, 0xB3, 0xAE, 0x1D, 0xA0, 0xA1, 0x05, 0xE3, 0xFB, 0x68, 0x33, 0xA3, 0x14, 0x26, 0x9E, 0x8D, 0xD7, 0x8D, 0x8D, 0xFE, 0xC3, 0x70, 0xDB, 0x9C, 0x54, 0xCF, 0x66, 0xE0, 0x55, 0x9C, 0xE0, 0xE0, 0xE0, 0x64, 0x8C, 0x64, 0x48, 0x58, 0x58, 0x8B, 0x8B, 0x8B, 0xB9, 0x98, 0xB9, 0x42, 0xB8, 0xB9, 0x01, 0x5C, 0x5C, 0x6E, 0x3C, 0xA9, 0x3C, 0x29, 0x02, 0x01, 0xB1, 0x28, 0x28, 0xA5, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0xA5, 0xA5, 0xDB, 0x01, 0x99, 0x09, 0x72, 0xD7, 0x8F, 0x07, 0x8F, 0xAF, 0xAF, 0xBB, 0x6F, 0xA8, 0x07, 0xA8, 0x07, 0x8F, 0x6F, 0x8F,
+	0x03, 0x9B, 0x9B, 0x2C, 0x2C, 0x2C, 0x2C, 0x49, 0x03, 0x03, 0xE3, 0xD7, 0x99, 0x09, 0x99, 0x02, 0xF4, 0x15, 0xFD, 0x24, 0xE4, 0xE4, 0xE4, 0xE4, 0x39, 0x24, 0xDB, 0xE4, 0x24, 0xC7, 0x71, 0xFD, 0x95, 0x46, 0xD7, 0xE3, 0x26, 0x9F, 0x68, 0x68, 0xBD, 0x3B, 0x04, 0x45, 0x4A, 0x12, 0x10, 0x6D, 0xBD, 0xD6, 0x4A, 0xC9, 0xC9, 0x9F, 0x9F, 0xE1, 0x1B, 0x51, 0x35, 0x1B, 0xB6, 0x3B, 0x31, 0xEC, 0x0E, 0x0E, 0x25, 0x0E, 0x31, 0x0E, 0xB0, 0xAD, 0xB0, 0xB0, 0xAD, 0x43, 0x19, 0x19, 0x43, 0x43, 0x63, 0x0E, 0x6D, 0x19, 0x74, 0x25, 0x25, 0x9B, 0x75, 0xBD, 0xBD, 0x83, 0x04, 0xE6, 0x26, 0x26, 0x10, 0x10, 0x9F, 0x10, 0x9F, 0x68, 0x9F, 0x9F, 0x9F, 0x25, 0xCD, 0x68, 0x10, 0x3F, 0x26, 0x26, 0x8D, 0xEE, 0x18, 0x18, 0x4B, 0xC3, 0xFE, 0x52, 0xBB, 0x41, 0x3E, 0x8E, 0x40, 0x96, 0x96, 0x8E, 0x40, 0x6A, 0x96, 0x71, 0x71, 0x4D, 0x96, 0x71, 0x71, 0x4D, 0x71, 0x96, 0x71, 0x71, 0x4D, 0x71, 0x06, 0xDC, 0xC0, 0xC7, 0xDB, 0xDB, 0xDB, 0x7F, 0x7F, 0x3D, 0x3D, 0x3D, 0x3D, 0x59, 0xD2, 0x59, 0xD2, 0xF2, 0xD2, 0xD2, 0xAE, 0xE2, 0xD9, 0xB3, 0xB3, 0xB3, 0xF0, 0xA1, 0xA1, 0x62, 0xE3, 0x00, 0x33, 0xA3, 0xCD, 0xA3, 0x4B, 0x12, 0x52, 0xAF, 0xD7, 0xC3, 0x9E, 0x13, 0xC0, 0xDD, 0x84, 0x54, 0xE0, 0x55, 0xE0, 0x9C, 0xE0, 0x9C, 0xCF, 0xE0, 0x8C, 0x48, 0x58, 0x58, 0x64, 0x48, 0x48, 0x64, 0x8B, 0x47, 0x47, 0xB8, 0xB9, 0x42, 0x01, 0x01, 0xA8, 0x6E, 0x3C, 0x3C, 0x3C, 0x5D, 0x5D, 0x2B, 0x59, 0xA5, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xD9, 0xA5, 0xA5, 0x1E, 0x66, 0xAF, 0x72, 0xFE, 0x8D, 0x8F, 0x18, 0x07, 0x8F, 0x6F, 0x8F, 0x6F, 0xA8, 0xA8, 0xA8, 0x07, 0xA8, 0x8F, 0x6F, 0x07,
+	0x03, 0x03, 0x03, 0xDE, 0x27, 0x2C, 0x2C, 0x2C, 0xAC, 0x47, 0xA6, 0x8F, 0xA3, 0xC4, 0x99, 0xAF, 0xF3, 0xA9, 0xFD, 0xCA, 0xE4, 0xE4, 0x7F, 0xE4, 0xE4, 0x24, 0xE4, 0xE4, 0x24, 0xC7, 0x08, 0xBF, 0x95, 0xCC, 0x49, 0x2C, 0xB4, 0xFB, 0xB6, 0x83, 0xC9, 0x4A, 0xC9, 0xBD, 0xC9, 0xD6, 0xD6, 0x83, 0xBD, 0x51, 0xC9, 0xC9, 0xC9, 0x9F, 0xC9, 0xC9, 0x10, 0xBD, 0x04, 0xC9, 0x3B, 0x3B, 0xAD, 0x9B, 0x25, 0x3B, 0x25, 0x31, 0x31, 0x0E, 0xB0, 0xAD, 0xB0, 0xB0, 0xB0, 0x19, 0x43, 0x19, 0x43, 0x19, 0x19, 0xAD, 0x0E, 0xB0, 0x0A, 0x9B, 0x25, 0xB0, 0x30, 0xD6, 0x45, 0x83, 0xB6, 0x04, 0x26, 0xD6, 0x4B, 0x9F, 0x10, 0x9F, 0x9F, 0x68, 0x68, 0x0E, 0x10, 0x26, 0x9F, 0x9F, 0xCD, 0x9F, 0x4A, 0x12, 0xEE, 0xD7, 0x18, 0x20, 0x8F, 0xFE, 0x72, 0x9E, 0x8F, 0xEA, 0x40, 0x3E, 0x40, 0x94, 0xEA, 0x8E, 0x96, 0x96, 0x71, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0x96, 0x71, 0x71, 0x4D, 0x71, 0x71, 0x06, 0xFD, 0xDC, 0xDB, 0xC0, 0xA2, 0xA2, 0xDB, 0x36, 0x7F, 0x7F, 0x7F, 0x59, 0x3D, 0xD2, 0x3D, 0x59, 0xF2, 0xAE, 0xF2, 0xD2, 0xA5, 0xE2, 0xD9, 0xE2, 0x77, 0xB3, 0x1D, 0xB3, 0xA1, 0xF7, 0x38, 0x26, 0xB4, 0x26, 0xB2, 0x9E, 0x9E, 0x52, 0x6B, 0x8D, 0xD7, 0xC3, 0x4B, 0x13, 0xC0, 0x84, 0x54, 0x79, 0xCE, 0x66, 0xE0, 0x9C, 0x9C, 0x9C, 0xE0, 0xE0, 0x48, 0x67, 0x8C, 0x8C, 0x48, 0x58, 0x48, 0x64, 0x47, 0x64, 0x47, 0x47, 0xB8, 0xB8, 0xBA, 0x01, 0x01, 0x6E, 0x3C, 0x3C, 0x3C, 0x5D, 0x5D, 0x0B, 0xA5, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0x59, 0xDB, 0x6E, 0xAF, 0xFE, 0x8D, 0x8F, 0x07, 0x07, 0x6F, 0x07, 0x8F, 0xBB, 0xA8, 0xF3, 0xF4, 0xF4, 0x29, 0x6F, 0x8F, 0x6F, 0xA8,
+	0x60, 0x03, 0x03, 0x9B, 0x9B, 0xDE, 0xDE, 0xDE, 0x9B, 0x2C, 0x47, 0xE3, 0xA3, 0x72, 0x99, 0x8F, 0x65, 0xA9, 0xFD, 0x24, 0xD0, 0xE4, 0xE4, 0xE4, 0x39, 0xE4, 0x7F, 0xE4, 0xE4, 0x0B, 0x08, 0xDC, 0x95, 0x18, 0xE3, 0x1C, 0xB7, 0xB2, 0xE6, 0x97, 0xBD, 0xBD, 0xBD, 0xC9, 0x4A, 0x4A, 0x4A, 0x10, 0x9F, 0xC9, 0x68, 0x9F, 0xC9, 0xE1, 0xD6, 0x9F, 0x04, 0xE6, 0x9F, 0x9F, 0x25, 0x3B, 0xB6, 0xB0, 0x7E, 0x0E, 0x04, 0x31, 0x31, 0xB0, 0x0E, 0xB0, 0x19, 0xAD, 0x7C, 0xAD, 0x43, 0x19, 0x19, 0xAD, 0xAD, 0x27, 0x03, 0xB0, 0x03, 0x63, 0xB0, 0x3B, 0x63, 0x60, 0xB6, 0xB6, 0xB6, 0x04, 0x26, 0x26, 0x4A, 0x10, 0x9F, 0x10, 0x10, 0x68, 0x9F, 0x68, 0x9F, 0xD6, 0x9F, 0xA3, 0x9F, 0x3F, 0x8D, 0x26, 0xEE, 0x5A, 0xDA, 0xEB, 0x18, 0x99, 0xFE, 0x99, 0x02, 0xF3, 0xF8, 0x96, 0x8E, 0x8E, 0x94, 0x96, 0x96, 0x96, 0x71, 0x96, 0x71, 0x71, 0x4D, 0x96, 0x71, 0x71, 0x4D, 0x4D, 0x71, 0x71, 0xFD, 0xFD, 0x53, 0xC7, 0xC7, 0xDB, 0xC7, 0xDB, 0xDB, 0xDB, 0x7F, 0x59, 0x7F, 0x7F, 0x7F, 0x3D, 0x3D, 0x59, 0x3D, 0xD2, 0xA5, 0xE2, 0xE2, 0xD9, 0xE2, 0x77, 0xAE, 0xB3, 0x77, 0x77, 0x77, 0xA1, 0xA0, 0x55, 0xB2, 0xA3, 0xB2, 0xC4, 0x14, 0xD7, 0xEE, 0x8D, 0x8D, 0xC3, 0x8D, 0x1A, 0x79, 0x84, 0x54, 0xCF, 0xCE, 0x55, 0x55, 0x9C, 0x9C, 0x9C, 0x9D, 0x17, 0xE0, 0x8C, 0x48, 0x67, 0x8C, 0x48, 0x58, 0x8B, 0x47, 0x49, 0x47, 0x8B, 0x47, 0xB8, 0xB8, 0x01, 0x3C, 0x3C, 0x6E, 0x3C, 0x3C, 0x65, 0x6E, 0xB1, 0xA5, 0x77, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x1E, 0x80, 0x66, 0x01, 0x4C, 0x14, 0x52, 0x18, 0x6F, 0x8F, 0x07, 0x07, 0x6F, 0x29, 0xEA, 0xEB, 0xF3, 0xF4, 0x07, 0x6F, 0xAF, 0xA8, 0xA8,
+	0x26, 0xD6, 0xA6, 0x03, 0x9B, 0x9B, 0x63, 0x63, 0xDE, 0x2C, 0xAC, 0x5E, 0x26, 0x09, 0x99, 0x6F, 0x65, 0x15, 0xBF, 0xC7, 0xE4, 0xE4, 0x80, 0xE4, 0x7F, 0x80, 0x80, 0xE4, 0x24, 0x0B, 0xFD, 0xFD, 0x0F, 0xB9, 0xD7, 0x26, 0x97, 0x3B, 0x9F, 0x3B, 0x3B, 0x9F, 0x83, 0xFB, 0x12, 0x68, 0x10, 0xC9, 0x04, 0xBD, 0x04, 0x83, 0xE1, 0x35, 0x4A, 0x9F, 0x9F, 0x3B, 0x04, 0xC9, 0xB0, 0xB6, 0x3B, 0x0E, 0x60, 0xAD, 0x0E, 0x04, 0x25, 0x31, 0x31, 0x7C, 0xB0, 0x19, 0x31, 0xAD, 0x43, 0x19, 0x19, 0x27, 0x0C, 0x27, 0xAD, 0x60, 0xE1, 0x03, 0xAB, 0x3B, 0x0C, 0x56, 0x00, 0x6D, 0xB6, 0xFB, 0x26, 0x12, 0xB4, 0x14, 0xCD, 0x45, 0xBD, 0x81, 0x3F, 0x10, 0x26, 0x25, 0xA3, 0xB6, 0xB4, 0xB2, 0xBD, 0x8D, 0x9E, 0x02, 0xF5, 0x87, 0x41, 0xEE, 0x3A, 0x99, 0x8F, 0x41, 0x0D, 0x8E, 0x8E, 0x96, 0x96, 0x96, 0x6A, 0x96, 0x71, 0x71, 0x71, 0x96, 0x71, 0x08, 0x71, 0x4D, 0x71, 0x08, 0x71, 0x4D, 0x71, 0x06, 0xFD, 0x79, 0xFD, 0xC0, 0xC7, 0xDB, 0xC7, 0x90, 0x7F, 0xDB, 0x7F, 0x3D, 0x7F, 0x3D, 0x3D, 0x3D, 0x59, 0xD2, 0x59, 0xD2, 0xD2, 0xE2, 0xA5, 0x77, 0x77, 0xB3, 0x77, 0xB3, 0xD5, 0xB3, 0x95, 0xA1, 0x47, 0x6C, 0x6C, 0x10, 0xC3, 0x4B, 0x9E, 0x4B, 0x4B, 0x3A, 0x8F, 0x2A, 0x79, 0x9D, 0x9C, 0xCF, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x58, 0xE0, 0xE0, 0x48, 0x67, 0x48, 0x64, 0x64, 0xB8, 0x64, 0x64, 0x47, 0xB8, 0x47, 0xB8, 0x6E, 0x6E, 0x3C, 0x2D, 0x2B, 0x3C, 0x65, 0x2B, 0xB1, 0xA5, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0xD2, 0x90, 0x6E, 0xAF, 0x4C, 0xEE, 0x8F, 0x18, 0x8F, 0x8F, 0x6F, 0x5C, 0x29, 0x41, 0xF3, 0x87, 0xC1, 0x07, 0x6F, 0x29, 0x5C, 0x07, 0x5C,
+	0xB4, 0x9F, 0x60, 0x03, 0x9B, 0xDE, 0x63, 0x63, 0xDE, 0xDE, 0xAC, 0xBA, 0x26, 0x09, 0xFE, 0x6F, 0xEA, 0x71, 0xFD, 0x24, 0x92, 0xE4, 0x92, 0xE4, 0x80, 0x80, 0x80, 0xE4, 0x24, 0xC7, 0xFD, 0xFD, 0x93, 0x42, 0xE3, 0xA3, 0xFB, 0x3B, 0x04, 0x04, 0xE6, 0x68, 0xB6, 0x10, 0xD6, 0xB4, 0x9F, 0x9F, 0x9F, 0x04, 0x83, 0x68, 0x60, 0x35, 0x9F, 0x25, 0x25, 0xB6, 0x6D, 0x0E, 0x35, 0x0E, 0x3B, 0x25, 0x60, 0xB0, 0xE1, 0x0E, 0x0E, 0xB0, 0x31, 0x31, 0x31, 0xAD, 0xB0, 0xAD, 0x19, 0xAD, 0xAD, 0x43, 0x19, 0x56, 0x27, 0x03, 0xD6, 0x9F, 0x5B, 0x60, 0x03, 0x5B, 0x3B, 0x3B, 0xB6, 0x6D, 0x26, 0x26, 0x14, 0xCD, 0x4B, 0x73, 0x3F, 0x81, 0xBD, 0x68, 0x10, 0x26, 0x9F, 0xB4, 0x73, 0xB5, 0x4B, 0x26, 0x99, 0xBB, 0x3E, 0x3E, 0x41, 0x52, 0xC3, 0x9A, 0x52, 0xDA, 0x3E, 0x65, 0xC8, 0x96, 0x96, 0x96, 0xC8, 0x96, 0x96, 0x96, 0x08, 0x71, 0x71, 0x96, 0x71, 0x08, 0x71, 0x4D, 0x4D, 0x71, 0xFD, 0xFD, 0xFD, 0xBF, 0xC7, 0xBF, 0xC7, 0xDB, 0xC7, 0x39, 0x7F, 0x39, 0x7F, 0x7F, 0x7F, 0x59, 0x7F, 0x3D, 0xD2, 0x59, 0xD2, 0xF2, 0xA5, 0xF1, 0xE2, 0xD9, 0xE2, 0x77, 0xB3, 0x77, 0xD5, 0xB3, 0xD5, 0xA1, 0xC6, 0xA6, 0xB7, 0xB4, 0xB2, 0xA3, 0x14, 0x9E, 0x8D, 0xE5, 0x8F, 0x2A, 0x9D, 0x84, 0x9C, 0x06, 0x79, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x17, 0xE0, 0x48, 0x8C, 0x48, 0x48, 0xFC, 0x64, 0x64, 0x47, 0x47, 0x47, 0x98, 0xB8, 0x3C, 0x3C, 0x2D, 0x2B, 0x3C, 0x6E, 0x2B, 0xB1, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0xD2, 0xDC, 0xA8, 0xAF, 0xAF, 0xAF, 0x18, 0x07, 0x07, 0x07, 0x07, 0xA8, 0x41, 0xF4, 0xEA, 0xEA, 0xC1, 0x29, 0x07, 0x8F, 0xA8, 0x5C, 0x07,
+	0xFB, 0xB6, 0x26, 0x60, 0x9B, 0x9B, 0x63, 0x63, 0x05, 0xDE, 0xAC, 0xB9, 0xE3, 0xB2, 0xFE, 0x52, 0x65, 0x71, 0xFD, 0x24, 0x7F, 0xE4, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0xD0, 0xC7, 0xC2, 0x71, 0x32, 0x42, 0x8F, 0xE3, 0x68, 0x6D, 0xB6, 0x3B, 0x04, 0xB6, 0xB6, 0xE3, 0x4A, 0xB6, 0xB6, 0x68, 0x9F, 0xBD, 0x83, 0x9F, 0x35, 0x35, 0x04, 0x4A, 0xD6, 0xB6, 0x6D, 0x3B, 0x51, 0x1B, 0x04, 0x6D, 0xB0, 0x25, 0x1B, 0x7C, 0x31, 0x1B, 0xB0, 0x7C, 0x0E, 0x7C, 0xB0, 0x19, 0xB0, 0xAD, 0x19, 0x0C, 0x19, 0x56, 0x56, 0x9B, 0xB6, 0xB7, 0x35, 0x03, 0x60, 0x23, 0x0E, 0x00, 0x3B, 0x6D, 0xCD, 0xA3, 0x14, 0xA3, 0x4B, 0x73, 0xBD, 0x81, 0x86, 0xB4, 0x10, 0xD6, 0x68, 0x14, 0x9F, 0x73, 0xCD, 0x6B, 0x4C, 0x16, 0x40, 0x3E, 0xF4, 0x52, 0xE5, 0xC3, 0x52, 0x29, 0x3E, 0x8E, 0xC8, 0x96, 0x71, 0x96, 0x96, 0x96, 0x08, 0x08, 0x96, 0x71, 0x96, 0x71, 0x71, 0x96, 0x71, 0x71, 0x4D, 0x71, 0x4D, 0x06, 0xFD, 0x79, 0xFD, 0xC7, 0xBF, 0xC7, 0xDB, 0xC7, 0xA2, 0x7F, 0x39, 0x5F, 0x59, 0x7F, 0x59, 0x59, 0x3D, 0xD2, 0x59, 0xD2, 0xF2, 0xA5, 0xE2, 0xAE, 0xE2, 0xD9, 0x77, 0x77, 0xB3, 0x95, 0x95, 0xB3, 0xA1, 0x62, 0xB4, 0xB7, 0xB2, 0xA3, 0x99, 0x9E, 0x4B, 0xE5, 0xA8, 0xA2, 0x84, 0x6E, 0x79, 0x9C, 0x9C, 0x9C, 0x9C, 0x66, 0x9C, 0x9C, 0x9C, 0x9C, 0x67, 0x58, 0x8C, 0x64, 0x8C, 0x48, 0x64, 0x8C, 0x64, 0x64, 0x64, 0x47, 0x64, 0x47, 0x98, 0x6E, 0xE7, 0x3C, 0x3C, 0x2B, 0x3C, 0x2B, 0x2B, 0xA5, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0x7F, 0x84, 0xAF, 0x4C, 0xAF, 0x07, 0x07, 0x8F, 0x6F, 0xA8, 0x07, 0xF4, 0xF4, 0xF3, 0xF3, 0xDA, 0x6F, 0x6F, 0x07, 0x41, 0x07, 0x41, 0x5C,
+	0xFB, 0x97, 0x9F, 0xE3, 0x03, 0xDE, 0x63, 0x05, 0x63, 0xDE, 0xAC, 0xAC, 0xE3, 0xB2, 0x09, 0x6B, 0x65, 0x15, 0xBF, 0x24, 0x7F, 0xE4, 0x7F, 0x80, 0x80, 0x80, 0x80, 0xE4, 0x24, 0x0B, 0x0B, 0x08, 0x85, 0xCB, 0x5E, 0x33, 0xB7, 0x3B, 0x0E, 0x3B, 0x68, 0x68, 0x68, 0xE1, 0x68, 0xB5, 0xB6, 0x9F, 0x9F, 0x9F, 0x04, 0xBD, 0xAD, 0x7E, 0x97, 0x9F, 0xD6, 0x04, 0x04, 0x6D, 0x9F, 0x7C, 0xE1, 0x3B, 0x7C, 0x4A, 0x0E, 0x51, 0x1B, 0x7C, 0x51, 0x51, 0xB0, 0x31, 0xB0, 0x19, 0xB0, 0xAD, 0x43, 0xAD, 0x19, 0xEC, 0x5B, 0xAD, 0x9F, 0x3B, 0x6D, 0x50, 0x03, 0x69, 0xB0, 0x00, 0x3B, 0xE6, 0xA3, 0x26, 0xCD, 0x26, 0xCD, 0x73, 0x73, 0x45, 0x3F, 0xBD, 0x4A, 0x26, 0x10, 0xCD, 0x9F, 0x73, 0x73, 0x9E, 0xED, 0x16, 0x3E, 0x40, 0xEA, 0x52, 0x3A, 0x09, 0x52, 0x29, 0x65, 0x0D, 0xC8, 0x96, 0x08, 0xC8, 0x08, 0x96, 0x96, 0x96, 0x08, 0x71, 0x71, 0x96, 0x71, 0x71, 0x4D, 0x71, 0x08, 0xDD, 0xFD, 0x71, 0xFD, 0xFD, 0xBF, 0xFD, 0xC7, 0xBF, 0xDB, 0xDB, 0x24, 0xDB, 0x7F, 0x7F, 0x7F, 0x7F, 0x3D, 0x7F, 0x1E, 0x3D, 0xD2, 0xA5, 0xF2, 0xD2, 0xAE, 0xAE, 0xE2, 0x77, 0x77, 0x77, 0xB3, 0xB3, 0xB3, 0xA1, 0xA1, 0xD5, 0x35, 0x6C, 0xB2, 0xA3, 0x73, 0x86, 0x9E, 0xE5, 0x5C, 0xA2, 0x84, 0x84, 0xCE, 0xCE, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x64, 0x9D, 0x58, 0x58, 0x48, 0x58, 0x58, 0x58, 0x64, 0x64, 0xB8, 0x49, 0x47, 0x47, 0xB8, 0xB8, 0x6E, 0x6E, 0x84, 0x2B, 0x2B, 0x2B, 0xB1, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x28, 0xA5, 0x1E, 0x39, 0xF4, 0xAF, 0xAF, 0x29, 0x8F, 0x07, 0x6F, 0xA8, 0x5C, 0xA8, 0x41, 0xF3, 0xF3, 0xC1, 0x6F, 0x6F, 0x6F, 0xA8, 0x5C, 0x5C, 0xF4, 0x5C,
+	0xFB, 0xFB, 0xB6, 0x9F, 0xA6, 0x27, 0x63, 0x56, 0x05, 0xDE, 0xDE, 0xAC, 0xE3, 0x6C, 0x3A, 0x6B, 0xF3, 0x15, 0xFD, 0xC7, 0xE4, 0xE4, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0xE4, 0xC7, 0xC2, 0x08, 0xA8, 0xD4, 0xE3, 0xCD, 0xB7, 0xB6, 0x04, 0x04, 0xB6, 0x10, 0xC9, 0x10, 0xB4, 0xB6, 0x68, 0x9F, 0x3B, 0x04, 0x04, 0x9F, 0x7E, 0x7E, 0x68, 0x9F, 0xE1, 0xBD, 0xB6, 0x3B, 0x3B, 0x9F, 0x1B, 0x1B, 0x1B, 0xE1, 0x04, 0xB0, 0xE1, 0x1B, 0x51, 0xAD, 0x19, 0xAD, 0x31, 0xB0, 0xB0, 0xAD, 0x19, 0x19, 0x27, 0x43, 0x27, 0x25, 0x25, 0x0E, 0x04, 0x50, 0xEC, 0xA1, 0xB0, 0x00, 0x3B, 0xFB, 0xA3, 0x26, 0x14, 0x26, 0x3F, 0x73, 0x86, 0x81, 0xBD, 0x68, 0x4A, 0x4A, 0x68, 0xB4, 0xCD, 0x73, 0x73, 0x9E, 0x02, 0x29, 0x65, 0x4E, 0xF3, 0x52, 0xC3, 0xFE, 0x52, 0xA8, 0x65, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0x96, 0x15, 0x96, 0x08, 0x71, 0x71, 0x71, 0x4D, 0x71, 0x71, 0x71, 0x4D, 0xFD, 0x06, 0x71, 0x79, 0xFD, 0xFD, 0xC7, 0xC7, 0xC0, 0xC7, 0x90, 0x90, 0xA2, 0xDB, 0x39, 0x3D, 0x7F, 0x59, 0x3D, 0x1E, 0x3D, 0xD2, 0x59, 0xF2, 0xAE, 0xD2, 0xD9, 0x77, 0xD9, 0x77, 0x77, 0xD5, 0x95, 0xB3, 0x95, 0xD5, 0xA1, 0x0A, 0x14, 0x6C, 0xC4, 0x82, 0xBD, 0x81, 0x3A, 0xEB, 0xA2, 0x84, 0x84, 0x53, 0xCE, 0x9C, 0x66, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x67, 0x64, 0x58, 0x58, 0x9D, 0x64, 0x58, 0x58, 0x58, 0x64, 0x8B, 0x64, 0x47, 0xB8, 0xBA, 0x01, 0xF4, 0x3C, 0x2B, 0x39, 0xB1, 0xB1, 0xA5, 0xA5, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0x28, 0xA5, 0x1E, 0x2B, 0x29, 0xAF, 0x02, 0xA8, 0x07, 0x52, 0x07, 0xA8, 0xF4, 0xF4, 0xF3, 0xF3, 0xA8, 0x29, 0xBB, 0x8F, 0xA8, 0x07, 0x5C, 0xF4, 0x18, 0x5C,
+	0xFB, 0xFB, 0xFA, 0x9F, 0x03, 0xDE, 0x63, 0x56, 0x62, 0x63, 0xDE, 0x9B, 0x8F, 0xB2, 0x3A, 0x6B, 0xF3, 0x15, 0xFD, 0x24, 0xE4, 0xE4, 0x80, 0x80, 0x80, 0x80, 0x1E, 0xE4, 0xE4, 0xC7, 0xC2, 0xC2, 0x01, 0x5E, 0x47, 0xA3, 0xB6, 0xB6, 0x04, 0x3B, 0x04, 0x9F, 0x26, 0xB4, 0x68, 0xB6, 0x0E, 0x9F, 0x04, 0x3B, 0x04, 0x25, 0x75, 0x35, 0x3B, 0x04, 0xE1, 0x4A, 0xB7, 0x3B, 0x68, 0x04, 0x4A, 0xE1, 0x60, 0x1B, 0x0E, 0xC9, 0x25, 0x51, 0xB0, 0xAD, 0xAD, 0x51, 0x31, 0x7C, 0xB0, 0xB0, 0x43, 0xEC, 0x43, 0x27, 0x27, 0x25, 0xB7, 0x25, 0x0E, 0x03, 0x5B, 0xF7, 0x25, 0xB7, 0x6D, 0x6D, 0x10, 0xD7, 0x4B, 0x33, 0x14, 0x73, 0x73, 0x81, 0x3F, 0xBD, 0x10, 0x25, 0xB4, 0xB4, 0x9F, 0x73, 0x14, 0xEE, 0x6F, 0x4E, 0x8E, 0x5D, 0xC1, 0x6F, 0x99, 0x09, 0xAF, 0xA8, 0x65, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0x08, 0x96, 0x96, 0x08, 0x08, 0x96, 0x71, 0x96, 0x71, 0x96, 0x71, 0x71, 0x71, 0xFD, 0x71, 0x71, 0xDD, 0xFD, 0x79, 0xFD, 0x53, 0xC7, 0xC0, 0xC7, 0xDB, 0x90, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x59, 0x3D, 0x3D, 0xD2, 0xD2, 0xD2, 0xD2, 0xE2, 0x77, 0xE2, 0x77, 0x77, 0xB3, 0xD5, 0xD5, 0xD5, 0xB3, 0x95, 0xA1, 0xF7, 0xE3, 0x00, 0x6C, 0xB2, 0x81, 0xE5, 0xE5, 0x17, 0xA2, 0xA9, 0x9D, 0x79, 0x79, 0x66, 0x9C, 0x9C, 0x66, 0x9C, 0x9C, 0x9C, 0x9C, 0x67, 0x9D, 0x64, 0x58, 0x64, 0x58, 0x58, 0x64, 0x64, 0x8B, 0x8B, 0x98, 0x47, 0xB8, 0x01, 0x6E, 0x6E, 0x2B, 0xB1, 0xB1, 0x59, 0xA5, 0xA5, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x28, 0x28, 0xA5, 0xA5, 0x39, 0x6E, 0xAF, 0x02, 0x5D, 0x29, 0x07, 0xDA, 0xA8, 0xF4, 0xF6, 0xF3, 0xF3, 0xEA, 0xA8, 0xBB, 0x6F, 0x6F, 0x5C, 0x5C, 0xF4, 0x18, 0x5C, 0x5C,
+	0x6D, 0x83, 0xE6, 0x9F, 0x60, 0x9B, 0x63, 0x56, 0x56, 0x05, 0xDE, 0xAC, 0xD6, 0x6C, 0x3A, 0xEE, 0xF3, 0x15, 0xDC, 0xDB, 0xE4, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0xE4, 0xE4, 0x24, 0xFD, 0x08, 0x87, 0x5E, 0x1C, 0xA3, 0x6D, 0xB6, 0x9F, 0x3B, 0x9F, 0x9F, 0x9F, 0x68, 0x9F, 0xB6, 0x9F, 0x04, 0x9F, 0x04, 0x3B, 0x60, 0xD8, 0x60, 0xFB, 0x3B, 0xD6, 0x4A, 0xFB, 0x04, 0xC9, 0x68, 0x10, 0x9F, 0x4A, 0x31, 0xC9, 0xC9, 0x25, 0x1B, 0xB0, 0x51, 0x51, 0x7C, 0x7C, 0xB0, 0x31, 0xB0, 0x43, 0x43, 0x43, 0x43, 0x63, 0xAD, 0xB7, 0x25, 0x3B, 0xAD, 0xF7, 0x5B, 0x0E, 0xB7, 0xB6, 0xB6, 0x26, 0x26, 0x14, 0x33, 0x4B, 0x86, 0x73, 0x73, 0xBD, 0x68, 0x10, 0x4A, 0xB5, 0xB6, 0x73, 0x73, 0x4B, 0x6B, 0xDA, 0x4E, 0x4E, 0x5D, 0xF6, 0x6F, 0x99, 0x09, 0x8F, 0x29, 0x65, 0xC8, 0x96, 0x08, 0xC8, 0xC8, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x71, 0xDD, 0x71, 0x71, 0xDD, 0x71, 0xBF, 0xFD, 0x79, 0xBF, 0xC0, 0xC0, 0xDB, 0xDB, 0xDB, 0x39, 0xA4, 0x3D, 0x7F, 0x3D, 0x59, 0x3D, 0x3D, 0x59, 0xF2, 0xAE, 0xD2, 0x77, 0xD9, 0x77, 0x77, 0x77, 0xB3, 0xD5, 0xB3, 0x95, 0xB3, 0xA1, 0xA1, 0x34, 0xB2, 0x6C, 0xB2, 0x81, 0xE5, 0x9E, 0x17, 0x06, 0x9D, 0x9D, 0x79, 0x66, 0x79, 0x66, 0x66, 0x9C, 0x9C, 0x66, 0x9C, 0x9C, 0x67, 0x64, 0x67, 0x58, 0x58, 0x58, 0x64, 0x98, 0x64, 0x8B, 0x8B, 0x47, 0xB8, 0xBA, 0xB8, 0x6E, 0x79, 0xB1, 0x59, 0x59, 0xA5, 0xA5, 0xA5, 0x28, 0x28, 0xB3, 0x28, 0x28, 0x28, 0x28, 0xA5, 0xB1, 0x2B, 0x5D, 0xAF, 0x02, 0x29, 0x29, 0x6F, 0xC1, 0xA8, 0xF4, 0xF6, 0xF3, 0xF3, 0xA8, 0x29, 0xBB, 0x8F, 0x07, 0x5C, 0x5C, 0x18, 0x18, 0x18, 0x5E,
+	0xB7, 0x83, 0x97, 0x10, 0x60, 0x9B, 0x63, 0x56, 0x62, 0x63, 0xDE, 0x49, 0x26, 0x6C, 0x3A, 0xEE, 0xF3, 0x15, 0xDC, 0x24, 0xE4, 0x7F, 0x80, 0x80, 0x80, 0x80, 0xB1, 0xE4, 0xE4, 0x24, 0xFD, 0x15, 0x06, 0xE0, 0xE3, 0xFA, 0x9F, 0x9F, 0x3B, 0x9F, 0x25, 0xB6, 0x68, 0x9F, 0xB6, 0xE6, 0x9F, 0x9F, 0x04, 0x0E, 0x04, 0x51, 0x30, 0x60, 0x3B, 0x6D, 0x4A, 0x4A, 0xE6, 0x4A, 0x10, 0x83, 0x4A, 0xC9, 0x6D, 0x04, 0x04, 0x31, 0x1B, 0xC9, 0xAD, 0x51, 0xAD, 0xB0, 0xB0, 0x31, 0x31, 0xAD, 0x19, 0x43, 0xAD, 0x43, 0x43, 0xAD, 0x0E, 0x3B, 0x3B, 0x51, 0x5B, 0x63, 0xB6, 0xB7, 0xB7, 0xB6, 0xD7, 0xD7, 0x3F, 0xE3, 0x9E, 0x73, 0x3F, 0x73, 0xCD, 0x68, 0x4A, 0x26, 0x68, 0x81, 0x73, 0xC3, 0xA3, 0x6B, 0x16, 0x16, 0x5D, 0x94, 0x40, 0x07, 0x99, 0xFE, 0x6F, 0x29, 0x8E, 0xC8, 0x08, 0x96, 0xC8, 0xC8, 0x08, 0x08, 0x08, 0x71, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x71, 0x71, 0x4D, 0x71, 0xDD, 0xFD, 0xFD, 0xBF, 0xFD, 0xBF, 0xC0, 0xC7, 0xDB, 0x36, 0xDB, 0xDB, 0x7F, 0x7F, 0x59, 0x7F, 0x3D, 0x59, 0x3D, 0x59, 0xF2, 0xD2, 0xE2, 0xE2, 0x77, 0xE2, 0x77, 0x77, 0x77, 0xD5, 0xD5, 0xB3, 0x95, 0xB3, 0xA1, 0x95, 0x26, 0x00, 0xFA, 0xF9, 0xFB, 0x99, 0x17, 0x06, 0x54, 0x79, 0x9C, 0x66, 0x79, 0x55, 0x9C, 0x66, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x64, 0x58, 0x58, 0x64, 0x8B, 0x8B, 0x64, 0x8B, 0x8B, 0x47, 0xB8, 0xB9, 0x01, 0xFC, 0x84, 0x36, 0x59, 0xA5, 0xA5, 0xA5, 0xA5, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xB1, 0x6E, 0x29, 0x02, 0x5D, 0x29, 0x02, 0x07, 0xA8, 0xF5, 0xF3, 0x3E, 0x3E, 0xF3, 0x29, 0xBB, 0x29, 0xA8, 0xA8, 0x5C, 0xF4, 0x18, 0x18, 0x18, 0x5E,
+	0xE5, 0x6D, 0xFB, 0x68, 0xE3, 0x9B, 0x63, 0x63, 0x63, 0x05, 0xDE, 0x9B, 0xE3, 0x00, 0x3A, 0xA3, 0x4E, 0x15, 0xDC, 0x24, 0xE4, 0x80, 0x80, 0x39, 0x80, 0x80, 0xB1, 0xE4, 0xE4, 0xC7, 0x0B, 0x08, 0xA2, 0x2E, 0x33, 0xB5, 0x9F, 0xB6, 0xB6, 0xC9, 0xC9, 0x3B, 0xB6, 0x10, 0xE6, 0x83, 0x9F, 0x04, 0x6D, 0x3B, 0x25, 0x75, 0x50, 0xE1, 0x3B, 0xB6, 0x9F, 0x10, 0x97, 0x4A, 0xD6, 0x45, 0x9F, 0xC9, 0x04, 0x04, 0xC9, 0x83, 0x31, 0x31, 0xB0, 0x51, 0x19, 0xAD, 0x31, 0xB0, 0x0E, 0xB0, 0x43, 0x27, 0xAD, 0xEC, 0x43, 0x9B, 0x0C, 0x0E, 0x0E, 0xAD, 0x74, 0x31, 0x60, 0x0E, 0x00, 0x3B, 0xE3, 0x26, 0x26, 0x26, 0x14, 0x73, 0xB5, 0xCD, 0xB5, 0xCD, 0x9F, 0x9F, 0x10, 0xCD, 0x73, 0x9E, 0x9E, 0x52, 0xC1, 0x8E, 0x94, 0x94, 0x65, 0xDA, 0x99, 0x72, 0x6F, 0xA8, 0x94, 0xC8, 0x96, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x4D, 0xC2, 0x71, 0x71, 0x4D, 0xFD, 0xFD, 0xFD, 0x53, 0xC7, 0xC0, 0xDB, 0xDB, 0xA2, 0xDB, 0x39, 0x5F, 0x7F, 0x7F, 0x59, 0x3D, 0x3D, 0xD2, 0xF2, 0xD2, 0xE2, 0xE2, 0xD9, 0x77, 0x77, 0x77, 0x1D, 0xB3, 0x95, 0xB3, 0xB3, 0xA1, 0x95, 0xA1, 0xAC, 0x6C, 0x00, 0x81, 0x6C, 0x12, 0x06, 0x54, 0x79, 0x9C, 0x9D, 0x79, 0x67, 0x66, 0x9D, 0x9C, 0x9C, 0x9C, 0x67, 0x67, 0x64, 0x9D, 0x64, 0x58, 0x64, 0x98, 0x64, 0x47, 0x47, 0x8B, 0x8B, 0x98, 0x8B, 0x01, 0x01, 0x90, 0xA5, 0x28, 0x28, 0x28, 0xA5, 0xA5, 0x28, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x65, 0xAF, 0x02, 0x29, 0x29, 0x29, 0xA8, 0xC1, 0xF5, 0x65, 0x87, 0x3E, 0xF6, 0xA8, 0xBB, 0x8F, 0x6F, 0x5C, 0x41, 0x5C, 0x5C, 0x18, 0x18, 0x20,
+	0x6D, 0xFB, 0x6D, 0xE6, 0xD6, 0x03, 0x63, 0x63, 0x05, 0x63, 0xDE, 0xAC, 0xD6, 0x6C, 0xFA, 0xEE, 0xF6, 0x4D, 0xC7, 0xC7, 0xE4, 0x80, 0x80, 0x39, 0x80, 0x80, 0xB1, 0xE4, 0x24, 0x24, 0xFD, 0x15, 0x17, 0x8B, 0x14, 0xFA, 0xB4, 0x9F, 0x9F, 0x9F, 0x68, 0xB6, 0x68, 0x81, 0x83, 0x68, 0x04, 0x3B, 0x3B, 0x3B, 0xAD, 0xEF, 0xEF, 0x1B, 0x97, 0xB6, 0xB6, 0x9F, 0xB6, 0x4A, 0x10, 0x68, 0xBD, 0xBD, 0x04, 0xBD, 0x0E, 0x3B, 0xC9, 0x25, 0x25, 0x31, 0x7E, 0x7E, 0x0E, 0x0E, 0x0E, 0xB0, 0x43, 0x43, 0x43, 0x43, 0xAD, 0x31, 0x63, 0xAD, 0xB0, 0x5B, 0x43, 0x03, 0x74, 0x25, 0xB7, 0x68, 0x26, 0x4B, 0x4B, 0x26, 0x4B, 0x14, 0x73, 0xA3, 0x82, 0xB4, 0xCD, 0x68, 0xCD, 0xBD, 0x9A, 0xEE, 0xED, 0x6F, 0xF3, 0x65, 0xC8, 0x94, 0x96, 0xDA, 0x99, 0x99, 0x6F, 0xA8, 0x94, 0xC8, 0x96, 0xC8, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x96, 0x08, 0x96, 0x71, 0x71, 0xC2, 0x71, 0xC2, 0xDD, 0x71, 0xFD, 0xBF, 0xFD, 0xC7, 0xBF, 0xC7, 0xC7, 0x90, 0xDB, 0xDB, 0x7F, 0x7F, 0x7F, 0x59, 0x7F, 0x59, 0x3D, 0xF2, 0xD2, 0xE2, 0xF2, 0xE2, 0x77, 0x77, 0x77, 0xB3, 0x77, 0xD5, 0xD5, 0xD5, 0xB3, 0xA0, 0xD5, 0xA1, 0xBE, 0xB2, 0x00, 0xFB, 0x3A, 0x52, 0x06, 0x4D, 0x54, 0x53, 0x66, 0x79, 0x9C, 0x9C, 0x66, 0x9C, 0x9C, 0x66, 0x9D, 0x64, 0x58, 0x67, 0x58, 0x58, 0x64, 0x8B, 0x8B, 0x64, 0xB8, 0x8B, 0xB9, 0xB9, 0x98, 0x01, 0x6E, 0x39, 0xA5, 0xD9, 0xD9, 0x28, 0x28, 0xA5, 0x28, 0x28, 0xD9, 0x28, 0x28, 0x28, 0x28, 0x1E, 0x39, 0x2B, 0x5D, 0x5D, 0x02, 0x29, 0x02, 0x29, 0xA8, 0xC1, 0xF3, 0x65, 0x3E, 0xF3, 0x29, 0xBB, 0x6F, 0x29, 0x5C, 0x5C, 0x41, 0x5C, 0x18, 0x5E, 0x20, 0x5C,
+	0x6D, 0xFB, 0xFB, 0x83, 0xD6, 0x03, 0x63, 0x63, 0x56, 0x63, 0xDE, 0xAC, 0xE3, 0xB2, 0x6C, 0x99, 0xF6, 0x15, 0xC7, 0xDB, 0x7F, 0x80, 0x80, 0x39, 0xB1, 0x80, 0x80, 0xE4, 0xE4, 0x24, 0xC2, 0x15, 0x2E, 0x7D, 0xB2, 0xB5, 0x10, 0xC9, 0x68, 0x04, 0xE6, 0x68, 0xB4, 0x83, 0xE6, 0x68, 0x04, 0x3B, 0x04, 0x60, 0x75, 0x60, 0x35, 0xC9, 0xB7, 0xB6, 0x3B, 0x9F, 0x9F, 0x4A, 0x68, 0x9F, 0x04, 0x83, 0x83, 0xC9, 0xC9, 0x04, 0x0E, 0xC9, 0x0E, 0x25, 0x7E, 0x19, 0x7C, 0x0E, 0xB0, 0xB0, 0x43, 0x43, 0x43, 0x5B, 0x27, 0xB0, 0x0C, 0xB0, 0xAD, 0x5B, 0x9B, 0x9B, 0x63, 0x25, 0xB6, 0x68, 0x26, 0x26, 0x3F, 0xA3, 0x4B, 0x73, 0x14, 0x26, 0x3F, 0x9F, 0x3F, 0x45, 0xBD, 0x14, 0x9E, 0xEE, 0xAF, 0xF3, 0x40, 0xC8, 0x94, 0x94, 0x6A, 0x29, 0x99, 0xEE, 0x6F, 0xF6, 0x65, 0xC8, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x71, 0x71, 0x71, 0x71, 0xDD, 0xFD, 0xFD, 0xFD, 0xFD, 0xBF, 0xC0, 0xDB, 0xC0, 0xDB, 0x2A, 0xDB, 0x7F, 0x7F, 0x3D, 0x7F, 0x3D, 0x59, 0xF2, 0xD2, 0xF2, 0xAE, 0xE2, 0xAE, 0x77, 0x77, 0x77, 0x1D, 0xD5, 0xB3, 0x95, 0xD5, 0xB3, 0xA0, 0xA1, 0xA0, 0x8F, 0x00, 0xB7, 0x6C, 0x18, 0x06, 0x9D, 0x54, 0xCE, 0x79, 0x66, 0x9D, 0x66, 0x9D, 0x66, 0x9D, 0x67, 0x64, 0x9D, 0x64, 0x9D, 0x64, 0x58, 0x64, 0xB8, 0xFC, 0x64, 0xB9, 0x47, 0xB8, 0x01, 0x87, 0x01, 0x84, 0x59, 0xA5, 0xD9, 0xB3, 0x28, 0x28, 0x28, 0x28, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x65, 0x02, 0x5D, 0x5D, 0x02, 0x29, 0x29, 0x16, 0xF6, 0x65, 0x65, 0xF4, 0x5D, 0xA8, 0x8F, 0x29, 0x8F, 0xF4, 0x5C, 0x41, 0x18, 0x18, 0x20, 0x5C, 0x8F,
+	0xFB, 0xFB, 0xFB, 0x3B, 0xD6, 0x03, 0x63, 0x63, 0xC6, 0x63, 0x63, 0xAC, 0xE3, 0xB2, 0x00, 0x99, 0x5D, 0x15, 0xFD, 0x24, 0x7F, 0x80, 0x80, 0x39, 0xB1, 0x80, 0xB1, 0xE4, 0xE4, 0x24, 0x0B, 0x4D, 0x58, 0xA6, 0xB2, 0x10, 0x4A, 0x10, 0x04, 0x3B, 0x68, 0x83, 0x83, 0xB4, 0xB4, 0x83, 0x04, 0x04, 0x1B, 0x7E, 0x25, 0x25, 0x35, 0xC9, 0xB6, 0x3B, 0xB6, 0x9F, 0xD6, 0xD6, 0xB6, 0xBD, 0x83, 0x3B, 0x83, 0x4A, 0x10, 0x04, 0xBD, 0xE1, 0x0E, 0x0E, 0xAD, 0x7E, 0xAD, 0xB0, 0xB0, 0xAD, 0x43, 0x27, 0x43, 0x0C, 0x9B, 0x9B, 0x0C, 0x27, 0x5B, 0x56, 0x25, 0xB6, 0x6D, 0xB6, 0x9F, 0x10, 0x26, 0xFA, 0x10, 0x26, 0xA3, 0x3F, 0x73, 0x14, 0x73, 0xCD, 0x9F, 0xB4, 0x73, 0x9E, 0xEE, 0xED, 0x29, 0x3E, 0x6A, 0xC8, 0x94, 0x94, 0x6A, 0x02, 0x09, 0x6B, 0x07, 0xA8, 0x65, 0xC8, 0xC8, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x15, 0xC2, 0x4D, 0x71, 0x4D, 0xFD, 0xBF, 0xFD, 0xBF, 0xBF, 0xC0, 0xC7, 0xC0, 0xC7, 0x36, 0x39, 0x7F, 0x7F, 0x7F, 0x59, 0x3D, 0x3D, 0xF2, 0xF2, 0xD2, 0xE2, 0xE2, 0xE2, 0xF0, 0x77, 0x77, 0xD5, 0xD5, 0xD5, 0xB3, 0xD5, 0xA0, 0xB3, 0xB3, 0xA1, 0xAC, 0x00, 0xB7, 0x3A, 0x5C, 0x54, 0xA9, 0x79, 0xCE, 0x66, 0x84, 0x66, 0x9C, 0x9C, 0x9C, 0x67, 0x9D, 0x67, 0x64, 0x67, 0x64, 0x9D, 0x64, 0x64, 0xB8, 0x64, 0xB8, 0x47, 0x8B, 0x98, 0x42, 0x01, 0x01, 0x84, 0xD2, 0x28, 0xD9, 0x28, 0x28, 0x28, 0xA5, 0x28, 0xD9, 0x28, 0xD9, 0x28, 0x28, 0xA5, 0xE4, 0x2B, 0x5D, 0x5D, 0x5D, 0x5D, 0x02, 0x5D, 0x29, 0x5D, 0xF3, 0x3E, 0xF3, 0xF6, 0xA8, 0xBB, 0x29, 0x5C, 0xA8, 0x5C, 0x41, 0x18, 0x5C, 0x18, 0xE3, 0x8F, 0x33,
+	0x6D, 0xFB, 0xFB, 0x3B, 0x26, 0x03, 0x63, 0x63, 0x56, 0x05, 0xDE, 0xDE, 0xE3, 0x14, 0x6C, 0x99, 0xA8, 0x15, 0xFD, 0x24, 0x7F, 0xE4, 0x7F, 0x39, 0x80, 0x39, 0x80, 0x80, 0xE4, 0xC7, 0x0B, 0x71, 0x87, 0xA6, 0xA3, 0x10, 0x4A, 0xB6, 0x9F, 0xE6, 0x10, 0xFB, 0xB4, 0x68, 0x83, 0x68, 0x4A, 0xC9, 0x1B, 0x25, 0xB7, 0x60, 0x35, 0x25, 0x4A, 0x3B, 0x97, 0x9F, 0xE1, 0xC9, 0x68, 0x04, 0x45, 0x83, 0x83, 0xC9, 0x4A, 0x04, 0x04, 0x1B, 0x25, 0x04, 0x7C, 0x7C, 0xAD, 0x19, 0x19, 0x19, 0x19, 0x43, 0x43, 0x31, 0xB0, 0x9B, 0x27, 0x5B, 0x5B, 0x43, 0x60, 0xB6, 0x00, 0xD6, 0x9F, 0x10, 0x12, 0xB5, 0x4B, 0xCD, 0x4B, 0xA3, 0x3F, 0x73, 0x73, 0xA3, 0xCD, 0x73, 0x73, 0x4B, 0x6B, 0xED, 0x16, 0x40, 0xE9, 0x96, 0x94, 0x94, 0x6A, 0x02, 0x09, 0x52, 0x07, 0xF5, 0x94, 0xC8, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x71, 0x71, 0x4D, 0xFD, 0x06, 0xDC, 0xBF, 0xC7, 0xBF, 0xDB, 0x2A, 0xA2, 0xDB, 0x7F, 0xA4, 0x7F, 0x7F, 0x59, 0x3D, 0x3D, 0xF2, 0xD2, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0x1D, 0x77, 0xD5, 0xD5, 0xD5, 0x95, 0xD5, 0xA0, 0x77, 0xA1, 0x05, 0xB7, 0x00, 0x3A, 0x87, 0x9D, 0xDD, 0x17, 0x66, 0x90, 0x84, 0x66, 0x9D, 0x66, 0x67, 0x67, 0x64, 0x9D, 0x64, 0x9D, 0x67, 0x64, 0x9D, 0x64, 0xB8, 0xFC, 0x64, 0xB8, 0xB8, 0x98, 0x01, 0x6E, 0x6E, 0x2B, 0xA5, 0x28, 0xD9, 0x28, 0x28, 0x28, 0x28, 0xD9, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0xB1, 0x0B, 0x3C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x29, 0x29, 0x65, 0x3E, 0xF3, 0xF3, 0xA8, 0x8F, 0xBB, 0x07, 0x5C, 0x5E, 0x20, 0x5C, 0x18, 0x18, 0x8F, 0x33, 0x8F,
+	0xFB, 0xFB, 0x6D, 0xFB, 0xD6, 0x03, 0x63, 0x63, 0x63, 0x05, 0x63, 0xAC, 0xBA, 0xB2, 0x6C, 0x4C, 0x5D, 0x15, 0xBF, 0x24, 0xDB, 0xE4, 0x80, 0x39, 0x39, 0x39, 0x39, 0x39, 0x24, 0xC7, 0xFD, 0x4D, 0x85, 0x70, 0x12, 0x10, 0x68, 0x04, 0x9F, 0xE6, 0x68, 0x97, 0x68, 0x68, 0x97, 0x4A, 0xE1, 0x4A, 0xB6, 0x3B, 0xB6, 0x60, 0xE1, 0xD6, 0x9F, 0x68, 0xB6, 0x68, 0xD6, 0x9F, 0x9F, 0x83, 0xBD, 0x04, 0xBD, 0x9F, 0x4A, 0xB6, 0x9F, 0x60, 0xC9, 0x04, 0x04, 0x0E, 0x7C, 0xAD, 0x43, 0x43, 0xAD, 0x43, 0x19, 0xB0, 0xB0, 0xB0, 0x60, 0x9B, 0x9B, 0x63, 0x74, 0x9B, 0x9B, 0x03, 0x9F, 0xD6, 0x10, 0xB5, 0x10, 0x73, 0x26, 0x26, 0xA3, 0x14, 0xB4, 0xA3, 0x73, 0x73, 0x86, 0x8D, 0x6B, 0x02, 0x16, 0x0D, 0x6A, 0x96, 0x94, 0x94, 0x40, 0x4C, 0x72, 0x52, 0xDA, 0xF5, 0xC8, 0xC8, 0x96, 0x08, 0x96, 0xC8, 0x08, 0x08, 0x71, 0x08, 0x71, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x4D, 0x71, 0xDD, 0x71, 0x06, 0xFD, 0xFD, 0xBF, 0xBF, 0xC7, 0xC0, 0xC7, 0xA2, 0xDB, 0xDB, 0x7F, 0x7F, 0x3D, 0x7F, 0x3D, 0x59, 0xF2, 0xD2, 0xF1, 0xAE, 0xE2, 0xF0, 0xF0, 0x77, 0x1D, 0x1D, 0xD5, 0xD5, 0x95, 0xD5, 0xA1, 0xB3, 0xA0, 0x95, 0x4A, 0x00, 0x6C, 0x6E, 0xA9, 0x9D, 0xCF, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x84, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x9D, 0x64, 0x64, 0x64, 0xFC, 0xB8, 0xB8, 0xB9, 0x98, 0x6E, 0x6E, 0x3C, 0x90, 0xA5, 0xA5, 0xD9, 0x28, 0xA5, 0xA5, 0x28, 0xD9, 0xD9, 0xD9, 0x28, 0xD9, 0x28, 0xE4, 0x2B, 0x94, 0x94, 0x65, 0x5D, 0x5D, 0x29, 0xA8, 0x5D, 0x29, 0xF6, 0xF3, 0xF3, 0xF6, 0x29, 0x29, 0x8F, 0xA8, 0x5C, 0x41, 0x41, 0x20, 0x18, 0x33, 0x8F, 0x8F, 0x8F,
+	0x6D, 0xFB, 0x6D, 0xFB, 0x26, 0x60, 0xDE, 0x63, 0x63, 0x05, 0xDE, 0xDE, 0xBA, 0x14, 0x6C, 0x4C, 0x29, 0x15, 0xFD, 0x24, 0x7F, 0xE4, 0x80, 0xDB, 0x39, 0x39, 0x90, 0x80, 0x24, 0xC7, 0xDC, 0x4D, 0x11, 0x70, 0x12, 0x10, 0x83, 0x04, 0xBD, 0x04, 0xE6, 0xB6, 0xCD, 0xB4, 0xE6, 0x4B, 0xD6, 0x10, 0x04, 0x9F, 0x68, 0xD6, 0xE3, 0x60, 0x9F, 0xB6, 0x68, 0x9F, 0x9F, 0x04, 0xC9, 0x04, 0xBD, 0x04, 0x04, 0xC9, 0x4A, 0xB6, 0xD6, 0x51, 0x0E, 0x0E, 0x3B, 0x04, 0x0E, 0xAD, 0x43, 0x19, 0x19, 0x19, 0x0C, 0x9B, 0xB0, 0x00, 0xB6, 0x0E, 0xB0, 0x25, 0x25, 0x60, 0x03, 0xBC, 0x75, 0xD8, 0x35, 0x35, 0x35, 0x33, 0xE3, 0x26, 0x26, 0xC4, 0x14, 0x73, 0x73, 0x9A, 0x9A, 0x6B, 0x02, 0xBB, 0x8E, 0xC8, 0x0D, 0xC8, 0x94, 0xC8, 0x65, 0x4C, 0x99, 0x52, 0xF4, 0x3E, 0x0D, 0x08, 0x96, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x4D, 0x71, 0x71, 0xFD, 0xFD, 0x06, 0xFD, 0xC0, 0xC0, 0xC0, 0xC0, 0xA2, 0xA2, 0xDB, 0x7F, 0x36, 0x3D, 0x3D, 0x3D, 0x3D, 0xF2, 0xF2, 0xF1, 0xE2, 0xE2, 0xAE, 0x77, 0xF0, 0x77, 0xD5, 0xD5, 0xD5, 0xD5, 0x95, 0xA0, 0xB3, 0x95, 0xA1, 0xA6, 0x00, 0x09, 0xFC, 0x3C, 0xDD, 0xCF, 0xE0, 0x55, 0x66, 0x84, 0x67, 0x67, 0x64, 0x67, 0x64, 0x9D, 0x64, 0x9D, 0x64, 0x67, 0x64, 0x9D, 0x64, 0xB8, 0x64, 0xB8, 0xBA, 0x98, 0x6E, 0x6E, 0x6E, 0x90, 0xA5, 0xD9, 0x28, 0x28, 0xA5, 0x28, 0x28, 0xD9, 0xD9, 0xB3, 0x28, 0x28, 0x1E, 0x2B, 0x3C, 0x65, 0x65, 0x65, 0x5D, 0x5D, 0x29, 0x5D, 0x29, 0x5D, 0xF3, 0xF3, 0xA8, 0xA8, 0x6F, 0x8F, 0xA8, 0x07, 0x41, 0x20, 0x18, 0x18, 0x18, 0x18, 0x33, 0x8F, 0x33,
+	0xFB, 0x6D, 0x6D, 0x6D, 0x9F, 0x03, 0x9B, 0x63, 0x63, 0x05, 0x63, 0xDE, 0xE3, 0xA3, 0x00, 0x99, 0x16, 0x15, 0xBF, 0x24, 0xE4, 0xE4, 0x92, 0x39, 0x59, 0x39, 0x80, 0x80, 0xE4, 0xC7, 0x0B, 0x4D, 0x11, 0x7D, 0x4B, 0x4A, 0xBD, 0xBD, 0x3B, 0x9F, 0xB6, 0xB5, 0xB4, 0xB4, 0x68, 0xBD, 0x04, 0xB6, 0x10, 0x9F, 0xB6, 0xE1, 0x1B, 0x10, 0x9F, 0xB6, 0xC9, 0x4A, 0xB6, 0x9F, 0xC9, 0xB6, 0x9F, 0x04, 0x3B, 0x10, 0xC9, 0x83, 0x1B, 0x51, 0x3B, 0x25, 0x04, 0x3B, 0x31, 0xAD, 0x19, 0xAD, 0x43, 0xAD, 0xAD, 0x03, 0x03, 0xB0, 0x00, 0xB6, 0xB0, 0x3B, 0xB7, 0x26, 0xB6, 0xB7, 0xD6, 0x33, 0x12, 0x7D, 0x1C, 0x7D, 0x20, 0x26, 0x14, 0x73, 0xA3, 0xCD, 0x73, 0x4B, 0x9E, 0x6B, 0xBB, 0x29, 0x65, 0x0D, 0xC8, 0x96, 0xC8, 0x96, 0x4E, 0x4C, 0xEE, 0x6F, 0x41, 0x3E, 0xC8, 0xC8, 0xC8, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x71, 0x71, 0x71, 0x4D, 0xFD, 0xFD, 0xFD, 0xFD, 0xBF, 0xC7, 0xBF, 0xDB, 0xC0, 0xDB, 0x36, 0xA2, 0x36, 0x39, 0x3D, 0x3D, 0x3D, 0xF2, 0xF2, 0xF1, 0xE2, 0xE2, 0xE2, 0xF0, 0x1D, 0x77, 0x1D, 0xD5, 0xD5, 0x95, 0xD5, 0xD5, 0xD5, 0xA0, 0x95, 0xDE, 0x00, 0x72, 0x84, 0x3C, 0xDD, 0x9C, 0x58, 0x66, 0x66, 0x67, 0x64, 0x67, 0x64, 0x9D, 0x64, 0x67, 0x64, 0x9D, 0x64, 0x9D, 0x64, 0x58, 0x64, 0x64, 0x8B, 0xB8, 0xB8, 0x98, 0x87, 0x6E, 0x84, 0x0B, 0xA5, 0x28, 0x28, 0xA5, 0xA5, 0xA5, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x65, 0x5D, 0x94, 0x5D, 0x5D, 0x5D, 0x5D, 0x02, 0x5D, 0x3C, 0x5D, 0xF6, 0xA8, 0x29, 0xBB, 0x8F, 0x07, 0x5C, 0x41, 0x41, 0x18, 0x33, 0x33, 0x07, 0x33, 0x07, 0x8F,
+	0xFB, 0xFB, 0xFB, 0xFB, 0x9F, 0xE3, 0xDE, 0x63, 0x63, 0xC6, 0xDE, 0xDE, 0x03, 0xA3, 0x6C, 0xEE, 0x29, 0x2D, 0xFD, 0x24, 0xDB, 0xE4, 0xB1, 0x39, 0x39, 0x80, 0xB1, 0x39, 0xDB, 0xC7, 0xDC, 0xDD, 0x17, 0x20, 0x8D, 0xB4, 0x83, 0xC9, 0x9F, 0x04, 0x04, 0x68, 0x68, 0xBD, 0x68, 0x68, 0x68, 0x10, 0x9F, 0xB6, 0x68, 0xD6, 0x4A, 0xC9, 0x9F, 0x68, 0x10, 0xB6, 0x68, 0x9F, 0x25, 0xE6, 0x83, 0x3B, 0x3B, 0xC9, 0x9F, 0xFB, 0x1B, 0x51, 0x3B, 0x04, 0x7C, 0x0E, 0xB0, 0xB0, 0x19, 0xAD, 0xAD, 0x19, 0xB0, 0x19, 0x03, 0x0C, 0x0E, 0xB6, 0x60, 0x0E, 0xB6, 0x25, 0x00, 0xB6, 0x10, 0x26, 0x82, 0x26, 0xA3, 0x4B, 0xE3, 0x35, 0x12, 0xB4, 0xB4, 0xCD, 0x3A, 0x9A, 0x6B, 0x52, 0x02, 0x16, 0x94, 0x0D, 0x96, 0xE9, 0xC8, 0xA9, 0xC1, 0x99, 0xED, 0x07, 0xC1, 0x6A, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x71, 0x71, 0x4D, 0xBF, 0xFD, 0xBF, 0xBF, 0xC0, 0xC0, 0xC7, 0xA2, 0xA2, 0x39, 0x36, 0x36, 0x59, 0x7F, 0x59, 0xF2, 0xF2, 0xD2, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0x1D, 0x77, 0xD5, 0x77, 0xD5, 0xD5, 0x95, 0xB3, 0xA0, 0xB3, 0xC5, 0x6C, 0x4C, 0x6E, 0xDD, 0x9D, 0x54, 0x66, 0x67, 0x67, 0x67, 0x84, 0x55, 0x67, 0x67, 0x64, 0x9D, 0x64, 0x64, 0x64, 0x8C, 0x64, 0x9D, 0x58, 0x58, 0x8B, 0x47, 0xB8, 0x47, 0x8B, 0x3C, 0x3C, 0x90, 0x1E, 0xA5, 0xA5, 0x28, 0xA5, 0xA5, 0x28, 0xD9, 0xD9, 0x28, 0x28, 0xA5, 0x24, 0x2B, 0x65, 0x94, 0x65, 0x5D, 0x65, 0x5D, 0xAF, 0x5D, 0xA8, 0x5D, 0xA8, 0xA8, 0x6F, 0xAF, 0x8F, 0x07, 0x07, 0xF4, 0x5E, 0x18, 0x18, 0x18, 0x18, 0x33, 0x33, 0x18, 0x18,
+	0xFB, 0x6D, 0xFB, 0xFB, 0x68, 0x60, 0x9B, 0x63, 0x63, 0x63, 0x63, 0xDE, 0xBA, 0xA3, 0x6C, 0xA3, 0x29, 0x2D, 0x0B, 0xC7, 0xE4, 0x80, 0x80, 0xE4, 0xB1, 0x39, 0x80, 0x80, 0x39, 0x24, 0xDD, 0x4D, 0x0F, 0x20, 0x8D, 0x73, 0xB4, 0x9F, 0x04, 0x04, 0x3B, 0x9F, 0x68, 0x83, 0x83, 0x10, 0x4A, 0x25, 0x9F, 0xB6, 0x68, 0xD6, 0x4A, 0xC9, 0xC9, 0x9F, 0xB6, 0xB6, 0x9F, 0x9F, 0xD6, 0x10, 0xFB, 0x3B, 0x97, 0xC9, 0x3B, 0x4A, 0x1B, 0xE1, 0xE1, 0x04, 0xB0, 0x51, 0x0E, 0x51, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x27, 0xEC, 0x60, 0x3B, 0xB0, 0x9F, 0xB7, 0x68, 0x97, 0x9F, 0x26, 0xCD, 0x82, 0xA3, 0x9E, 0xC3, 0x4B, 0xD7, 0x4A, 0xCD, 0x68, 0x45, 0xC3, 0x9E, 0x52, 0x02, 0xBB, 0xF5, 0x40, 0x0D, 0x96, 0x96, 0x6A, 0xE9, 0x6F, 0x99, 0x5A, 0x07, 0xEA, 0x6A, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x71, 0x96, 0x08, 0x71, 0x71, 0x71, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x4D, 0xC2, 0x4D, 0xFD, 0x4D, 0xBF, 0xBF, 0xC7, 0xBF, 0xC0, 0xC0, 0xDB, 0xDB, 0xDB, 0x36, 0x39, 0x36, 0x59, 0x3D, 0xBE, 0xF2, 0xF1, 0xF1, 0xE2, 0xE2, 0xF0, 0xF0, 0x77, 0x1D, 0x77, 0x77, 0xD5, 0xD5, 0x95, 0x1D, 0xB3, 0x95, 0x77, 0xAF, 0x72, 0x84, 0x9D, 0x79, 0x9C, 0x66, 0x67, 0x67, 0x67, 0x67, 0x9D, 0x67, 0x67, 0x64, 0x9D, 0x8C, 0x9D, 0x8C, 0x58, 0x67, 0x58, 0x8B, 0x8B, 0xB8, 0xB8, 0x47, 0x8B, 0x85, 0xE7, 0x3C, 0x2B, 0xB1, 0xB1, 0x28, 0xB1, 0xA5, 0xA5, 0x28, 0xD9, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x3C, 0x5D, 0x94, 0x65, 0x65, 0x5D, 0x5D, 0xAF, 0x5D, 0xA8, 0xF6, 0xF6, 0x6F, 0x52, 0xBB, 0x07, 0x5C, 0xF4, 0x18, 0x18, 0x07, 0x5C, 0x8F, 0x18, 0x18, 0x33, 0x18, 0xE3,
+	0x3B, 0x3B, 0x3B, 0xFB, 0xB6, 0xB0, 0x9B, 0x63, 0x63, 0x05, 0xDE, 0xDE, 0x03, 0xA3, 0xB2, 0xEE, 0x29, 0x2D, 0xC2, 0x24, 0xDB, 0xE4, 0x80, 0x39, 0x80, 0xB1, 0x80, 0x80, 0xE4, 0xC7, 0xFD, 0xDD, 0x1A, 0x70, 0x9E, 0x4B, 0x68, 0xBD, 0x04, 0x04, 0x3B, 0x04, 0x45, 0xBD, 0x4A, 0xD6, 0xD6, 0x10, 0xB6, 0xB6, 0x9F, 0xC9, 0x26, 0x9F, 0x4A, 0x9F, 0xB4, 0x9F, 0x68, 0x04, 0x4A, 0x4A, 0xFB, 0xB6, 0x9F, 0xC9, 0x6D, 0xE1, 0xE1, 0xC9, 0x60, 0x7C, 0x3B, 0x51, 0x7E, 0xB0, 0xB0, 0xAD, 0x19, 0x19, 0xB0, 0x0E, 0xB0, 0x0C, 0x27, 0xB0, 0xB0, 0x25, 0x9F, 0xB7, 0xB6, 0x26, 0x10, 0xCD, 0xB5, 0x8D, 0xA3, 0x9A, 0xB5, 0xBD, 0x4B, 0x9F, 0xB4, 0xE5, 0xFE, 0xEE, 0x52, 0xBB, 0x16, 0x4E, 0x65, 0xC8, 0xC8, 0x96, 0xF8, 0x6A, 0x5A, 0x72, 0x6F, 0x41, 0xEA, 0xE9, 0xC8, 0x08, 0xC8, 0x08, 0x08, 0x71, 0x71, 0x71, 0x71, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x96, 0x08, 0x08, 0x08, 0x71, 0x71, 0x71, 0xFD, 0x71, 0x06, 0xFD, 0xFD, 0xBF, 0xBF, 0xC7, 0xC0, 0xDB, 0xDB, 0xDB, 0xA2, 0x36, 0x36, 0x5F, 0x59, 0x3D, 0xF2, 0xD2, 0xF1, 0xE2, 0xE2, 0xF0, 0x77, 0xF0, 0x77, 0x77, 0x77, 0x77, 0xD5, 0xD5, 0xD5, 0xA0, 0xB3, 0xB3, 0x64, 0xAF, 0x6E, 0x79, 0x54, 0x54, 0x90, 0x8C, 0x64, 0x67, 0x66, 0x9D, 0x9C, 0x67, 0x8C, 0x8C, 0x8C, 0x64, 0x8C, 0x8C, 0x64, 0x64, 0x64, 0xB8, 0x64, 0xB8, 0x64, 0x98, 0x54, 0x85, 0xA9, 0x2B, 0x2B, 0xB1, 0xB1, 0xA5, 0xB1, 0x28, 0x28, 0x28, 0xD9, 0x28, 0x28, 0xB1, 0x2B, 0x94, 0x65, 0x65, 0x5D, 0x5D, 0x5D, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x29, 0xED, 0x52, 0x6F, 0x5C, 0x41, 0x5C, 0x5C, 0x07, 0x8F, 0x8F, 0x18, 0xE3, 0x18, 0x18, 0x33, 0x18,
+	0x3B, 0xFB, 0x3B, 0xFB, 0xB6, 0xD6, 0x9B, 0xDE, 0x63, 0x05, 0x63, 0xDE, 0x03, 0x26, 0x14, 0xA3, 0x29, 0x2D, 0xDC, 0xC7, 0xE4, 0xE4, 0x80, 0x80, 0x39, 0x39, 0x80, 0x80, 0xE4, 0x24, 0xDD, 0x4D, 0xD0, 0x70, 0x8D, 0x12, 0x10, 0x04, 0xB6, 0x3B, 0x83, 0x04, 0x10, 0xD6, 0xE1, 0xD6, 0x9F, 0xB6, 0xB6, 0xB6, 0x9F, 0x9F, 0x4A, 0x9F, 0x9F, 0x68, 0x9F, 0x25, 0x9F, 0xB6, 0x68, 0xD6, 0x97, 0x9F, 0x68, 0xC9, 0xC9, 0xD6, 0x4A, 0x0E, 0x31, 0xAD, 0x0E, 0x3B, 0x19, 0x19, 0x19, 0x19, 0x19, 0xAD, 0xAD, 0x31, 0x0E, 0xAD, 0x9B, 0x0C, 0x60, 0x25, 0x03, 0xB6, 0xB6, 0x9F, 0xA3, 0xB4, 0x73, 0xCD, 0x4B, 0xCD, 0x73, 0xB4, 0xCD, 0x68, 0xB4, 0xC3, 0x9A, 0xEE, 0x02, 0x29, 0x5D, 0x65, 0x94, 0x0D, 0x96, 0x40, 0x96, 0xF3, 0x4C, 0x4C, 0x8F, 0xC1, 0x40, 0x96, 0x08, 0xC8, 0x08, 0x08, 0x71, 0x08, 0x71, 0x71, 0x71, 0x71, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x4D, 0x71, 0x71, 0x4D, 0xFD, 0xFD, 0xFD, 0xFD, 0xBF, 0xC0, 0xBF, 0xC0, 0xA2, 0xDB, 0xA2, 0x39, 0x36, 0x7F, 0x59, 0x3D, 0x3D, 0xF2, 0xE2, 0x32, 0xE2, 0xE2, 0xF0, 0x1D, 0x77, 0x77, 0x77, 0xD5, 0x95, 0xB3, 0x77, 0xD5, 0xD5, 0xA1, 0x59, 0xAF, 0x84, 0x9D, 0x4D, 0x6E, 0x64, 0x67, 0x84, 0x67, 0x67, 0x66, 0x55, 0x55, 0x55, 0x8C, 0x67, 0x67, 0x67, 0x67, 0x64, 0x64, 0x64, 0x84, 0xB8, 0x64, 0xB8, 0x9C, 0x54, 0xA9, 0xA9, 0x2B, 0x2B, 0x2B, 0x2B, 0xB1, 0xB1, 0xA5, 0x28, 0x28, 0x28, 0x28, 0xA5, 0xB1, 0x2B, 0x65, 0x5D, 0x5D, 0x5D, 0x5D, 0x29, 0xAF, 0xA8, 0xA8, 0xA8, 0x29, 0x02, 0xED, 0x02, 0x07, 0xF4, 0x41, 0x07, 0x5C, 0x07, 0x8F, 0x18, 0x33, 0x18, 0x33, 0x18, 0x18, 0x33,
+	0x3B, 0xE6, 0x3B, 0x3B, 0x97, 0xD6, 0x03, 0x63, 0x63, 0x05, 0xDE, 0xDE, 0xAC, 0xE3, 0xB2, 0xAF, 0x02, 0x2D, 0xDC, 0xC7, 0xE4, 0xE4, 0x80, 0x39, 0xE4, 0x39, 0x80, 0x39, 0x24, 0xC7, 0xFD, 0x15, 0xCA, 0x2E, 0x8D, 0x12, 0x26, 0xB4, 0x83, 0x3B, 0x9F, 0x4A, 0xD6, 0xD6, 0x26, 0x68, 0xE6, 0xB6, 0x3B, 0xB6, 0x25, 0xC9, 0x26, 0x68, 0x68, 0x9F, 0x25, 0xC9, 0x26, 0x9F, 0xB6, 0xD6, 0x10, 0x9F, 0x3B, 0x9F, 0x60, 0x25, 0x04, 0x0E, 0x04, 0x51, 0xB0, 0x3B, 0x04, 0x19, 0xAD, 0xAD, 0x19, 0xAD, 0xB0, 0x0E, 0x0E, 0xB0, 0x03, 0x27, 0x27, 0x9B, 0x63, 0x9F, 0xB4, 0xA3, 0x9F, 0xB5, 0xB4, 0xA3, 0x73, 0x3F, 0x73, 0xB4, 0xB4, 0x45, 0x81, 0xC3, 0x9E, 0x5A, 0x02, 0x29, 0x3E, 0x94, 0x0D, 0xC8, 0x40, 0x6A, 0xF8, 0x07, 0x72, 0xEE, 0xDA, 0xC1, 0x6A, 0x96, 0x08, 0x08, 0x08, 0xC2, 0x71, 0x71, 0x96, 0x71, 0x71, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x96, 0x08, 0x71, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xFD, 0xBF, 0xFD, 0x79, 0xFD, 0xC0, 0xDB, 0xC0, 0xC7, 0x90, 0x36, 0x39, 0x3D, 0x7F, 0x3D, 0xE8, 0xF2, 0xF2, 0xF1, 0xE2, 0xE2, 0x77, 0xF0, 0x77, 0x77, 0xD5, 0x77, 0x95, 0xD5, 0xD5, 0x69, 0xB3, 0xD5, 0xE2, 0x6E, 0x9D, 0x79, 0x85, 0xF4, 0x6E, 0xB8, 0xB8, 0x64, 0x84, 0x64, 0x67, 0x67, 0x8C, 0x67, 0x67, 0x64, 0x67, 0x64, 0x64, 0x64, 0xB8, 0x64, 0x84, 0xB8, 0x84, 0x67, 0x54, 0x4D, 0xDD, 0x3C, 0x6E, 0x2B, 0x2B, 0x2B, 0xB1, 0xA5, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xB1, 0x94, 0x65, 0x65, 0x5D, 0x5D, 0x5D, 0x29, 0x02, 0xA8, 0xA8, 0xA8, 0x02, 0xAF, 0x02, 0x6F, 0x5C, 0x41, 0x5C, 0x07, 0x07, 0x8F, 0x8F, 0x8F, 0x18, 0x18, 0xE3, 0x8F, 0x18, 0x8F,
+	0x3B, 0x3B, 0xFB, 0xFB, 0x3B, 0xD6, 0x03, 0x63, 0x63, 0x63, 0xDE, 0xDE, 0xBA, 0xE3, 0xA3, 0xA3, 0x29, 0x2D, 0xC2, 0xC7, 0x24, 0xE4, 0x80, 0xE4, 0xE4, 0x39, 0x80, 0x39, 0xE4, 0x24, 0xFD, 0xA9, 0x0F, 0x17, 0x8D, 0x12, 0x10, 0xBD, 0x83, 0xB6, 0x04, 0xC9, 0x4A, 0x9F, 0x04, 0x04, 0xB6, 0x9F, 0x3B, 0x68, 0xC9, 0x26, 0x25, 0x0E, 0x9F, 0x0E, 0x26, 0x68, 0xC9, 0xC9, 0x68, 0x4A, 0x9F, 0xB6, 0x3B, 0x10, 0x60, 0x25, 0x6D, 0x04, 0x25, 0x51, 0xB0, 0x0E, 0x0E, 0x3B, 0x3B, 0x31, 0xB0, 0x27, 0xAD, 0xB6, 0xB6, 0x25, 0xB0, 0x03, 0x5B, 0x5B, 0x35, 0xB7, 0xB6, 0x9F, 0xB4, 0xB2, 0x68, 0xA3, 0xB4, 0xB4, 0xB4, 0xB4, 0x81, 0xB4, 0x82, 0xC4, 0xEE, 0x5A, 0x29, 0x5D, 0x8E, 0x65, 0x94, 0x0D, 0xC8, 0x40, 0xEA, 0x52, 0x99, 0x52, 0xC1, 0x3E, 0xDF, 0x15, 0x08, 0xC8, 0x71, 0x71, 0x08, 0x08, 0x71, 0x71, 0x71, 0x71, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x71, 0x4D, 0x71, 0xFD, 0x71, 0xBF, 0x71, 0xFD, 0xBF, 0xDC, 0xC7, 0xC0, 0xC7, 0x90, 0xDB, 0x36, 0x36, 0x7F, 0x3D, 0x59, 0x3D, 0x3D, 0xF2, 0xF1, 0xE2, 0xE2, 0xE2, 0x77, 0x1D, 0x77, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x1D, 0xB3, 0x95, 0xB3, 0x4F, 0x9D, 0x85, 0x87, 0x29, 0x5C, 0xF4, 0x01, 0x01, 0x01, 0xB8, 0xB8, 0x67, 0x64, 0x67, 0x67, 0x8C, 0x67, 0x67, 0x67, 0x67, 0x67, 0x64, 0x64, 0x84, 0x64, 0x9C, 0x79, 0xFD, 0xFD, 0x2B, 0x2B, 0x65, 0x6E, 0x2B, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x2B, 0x5D, 0x5D, 0x65, 0x5D, 0x5D, 0x02, 0xA8, 0xA8, 0xA8, 0x8F, 0x02, 0xAF, 0x52, 0x07, 0x5C, 0x41, 0x41, 0x07, 0x8F, 0x8F, 0x18, 0x8F, 0x18, 0xE3, 0x07, 0xE3, 0x8F, 0x26,
+	0x3B, 0x3B, 0x3B, 0x6D, 0x3B, 0xD6, 0x03, 0xDE, 0xDE, 0x63, 0xDE, 0xDE, 0xAC, 0xE3, 0xB2, 0x4C, 0x29, 0x2D, 0x2B, 0xC7, 0x24, 0xDB, 0x80, 0xE4, 0xE4, 0x39, 0xE4, 0xE4, 0xE4, 0x24, 0xFD, 0x15, 0x17, 0x17, 0x5A, 0x12, 0x26, 0x68, 0x3B, 0x68, 0x3B, 0x68, 0xB6, 0xB6, 0x68, 0x9F, 0x68, 0xB6, 0xB6, 0x9F, 0x10, 0x25, 0x9F, 0x9F, 0x9F, 0xE1, 0xC9, 0x68, 0x68, 0x9F, 0x9F, 0x10, 0x9F, 0x3B, 0xE6, 0x25, 0xE1, 0x0E, 0x3B, 0x04, 0x31, 0xAD, 0x19, 0xB0, 0x31, 0x3B, 0x31, 0x3B, 0x3B, 0x51, 0x43, 0x25, 0x0E, 0x31, 0xB0, 0xB0, 0x9B, 0x9B, 0x04, 0x3B, 0xB4, 0x9F, 0xB6, 0xB2, 0x9F, 0x9F, 0xCD, 0xB4, 0xB4, 0x81, 0xF9, 0xB4, 0x9A, 0xFE, 0xEE, 0xAF, 0x16, 0x4E, 0x65, 0x94, 0x94, 0x0D, 0x40, 0xF8, 0x41, 0x99, 0x4C, 0xBB, 0xA8, 0xDF, 0xDF, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x71, 0x71, 0x71, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x71, 0xC2, 0x71, 0xFD, 0xC2, 0xFD, 0x79, 0xFD, 0x53, 0xDC, 0xC0, 0xC0, 0xDB, 0x90, 0x39, 0x36, 0x39, 0x7F, 0x7F, 0x3D, 0xF2, 0xF2, 0xF1, 0xF1, 0xE2, 0xF0, 0xF0, 0xF0, 0x77, 0xD5, 0x77, 0xD5, 0xD5, 0xB3, 0xA0, 0xD5, 0x95, 0x95, 0x93, 0x58, 0x01, 0xA8, 0xAF, 0x8F, 0x8F, 0x8F, 0x5C, 0x5C, 0x01, 0x01, 0x01, 0xB8, 0x64, 0x64, 0x64, 0x67, 0x67, 0x64, 0x84, 0x67, 0x67, 0x64, 0x84, 0x84, 0x90, 0x79, 0xFD, 0x4D, 0x2B, 0x3C, 0x2B, 0x6E, 0x2B, 0xB1, 0x28, 0x28, 0x28, 0x28, 0xA5, 0xB1, 0x2B, 0x65, 0x5D, 0x65, 0x5D, 0x5D, 0x02, 0x29, 0x29, 0xA8, 0x8F, 0x02, 0xAF, 0x02, 0x6F, 0xA8, 0x5C, 0x07, 0x18, 0x5C, 0x8F, 0x8F, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0x33, 0x52, 0x4B,
+	0x3B, 0xFB, 0xFB, 0xFB, 0x3B, 0x25, 0x03, 0x9B, 0x63, 0x05, 0x05, 0xDE, 0xAC, 0xE3, 0xA3, 0xA3, 0x29, 0x2D, 0xC2, 0xC7, 0x24, 0xE4, 0xE4, 0xE4, 0x39, 0xB1, 0xE4, 0xE4, 0xE4, 0x24, 0x0B, 0x15, 0xDF, 0x70, 0x52, 0x33, 0x10, 0x10, 0xFB, 0x04, 0x68, 0x9F, 0x68, 0x9F, 0x68, 0xE6, 0xE6, 0x9F, 0xC9, 0xC9, 0x9F, 0xC9, 0x9F, 0x68, 0x0E, 0xD6, 0xD6, 0x0E, 0x97, 0xFB, 0x10, 0xB6, 0xB6, 0x3B, 0x97, 0xD6, 0xC9, 0xB6, 0x0E, 0x0E, 0x0E, 0xAD, 0x0C, 0x0C, 0x0E, 0x0E, 0x0E, 0x6D, 0x0E, 0x0E, 0xAD, 0x0E, 0xB6, 0xB0, 0x03, 0xB0, 0x60, 0x03, 0xFB, 0x68, 0x26, 0xB6, 0xB2, 0xB6, 0x14, 0xB2, 0xB4, 0xF9, 0xE6, 0xB4, 0xF9, 0x82, 0x8D, 0xEE, 0xED, 0x02, 0x5D, 0x8E, 0x94, 0x94, 0x94, 0x0D, 0x40, 0xF8, 0x6F, 0x99, 0x99, 0x07, 0xC1, 0x4D, 0xC8, 0x08, 0x96, 0x08, 0x96, 0x71, 0x08, 0x08, 0x71, 0x71, 0x71, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x71, 0x71, 0xFD, 0xC2, 0xFD, 0xFD, 0xFD, 0xFD, 0xBF, 0xFD, 0xDB, 0xC7, 0xC7, 0xDB, 0x90, 0x24, 0x36, 0x39, 0x5F, 0x3D, 0x3D, 0xF2, 0xF1, 0xC5, 0xE2, 0xE2, 0xE2, 0x77, 0x77, 0xD5, 0xD5, 0xD5, 0xD5, 0xA0, 0xD5, 0xB3, 0xB3, 0x95, 0x77, 0x85, 0x8F, 0xAF, 0x4C, 0x8F, 0x8F, 0xAF, 0x8F, 0x8F, 0x5C, 0x5C, 0x5C, 0x5E, 0x01, 0xBA, 0xB8, 0xBA, 0x64, 0xB8, 0x64, 0x64, 0x64, 0x67, 0x67, 0x66, 0x90, 0xDC, 0x79, 0x84, 0x3C, 0x3C, 0x3C, 0x2B, 0xB1, 0xB1, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xB1, 0x94, 0x65, 0x5D, 0x5D, 0x02, 0x02, 0x02, 0x29, 0xA8, 0x5C, 0x02, 0x4C, 0x4C, 0xAF, 0x5C, 0x41, 0x5C, 0x07, 0x07, 0x07, 0x8F, 0x5C, 0x5C, 0x18, 0x18, 0x8F, 0x33, 0x8F, 0x26, 0x9E,
+	0x3B, 0xFB, 0xFB, 0xFB, 0x97, 0x10, 0x60, 0x63, 0x63, 0xC6, 0x63, 0xDE, 0xDE, 0xE3, 0xB2, 0xA3, 0xAF, 0x94, 0x2B, 0xBF, 0x24, 0xE4, 0xE4, 0x24, 0x39, 0xB1, 0xE4, 0xE4, 0xE4, 0x24, 0x0B, 0xDD, 0x54, 0x41, 0x8F, 0x12, 0x33, 0x97, 0xE6, 0x97, 0x9F, 0x9F, 0x9F, 0xB6, 0xB6, 0x68, 0x9F, 0x0E, 0x25, 0x9F, 0x9F, 0x26, 0x04, 0x9F, 0x9F, 0xD6, 0xD6, 0x10, 0x68, 0xB6, 0xE6, 0x68, 0x68, 0x3B, 0x3B, 0x31, 0xB6, 0x0E, 0x25, 0x51, 0xB0, 0xB0, 0x0C, 0x43, 0xB0, 0x04, 0x0E, 0x31, 0x04, 0x0E, 0x0E, 0xB6, 0x0E, 0xB0, 0x35, 0xE1, 0x03, 0x1B, 0xFB, 0xB4, 0xB4, 0x97, 0xB5, 0xB4, 0xB6, 0xB4, 0xB4, 0xE6, 0x83, 0xF9, 0x81, 0x14, 0xEE, 0x5A, 0x02, 0x29, 0x94, 0x65, 0x8E, 0x65, 0x94, 0x40, 0xF8, 0x41, 0x99, 0x72, 0x02, 0xDA, 0x6A, 0x15, 0x2D, 0x15, 0x08, 0x96, 0x71, 0x71, 0x71, 0xC2, 0xC2, 0x71, 0x71, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x96, 0x08, 0xC2, 0x08, 0x71, 0x71, 0x71, 0xC2, 0x71, 0xFD, 0xFD, 0xFD, 0x53, 0xFD, 0xC0, 0xC7, 0xDB, 0x24, 0xDB, 0x36, 0x36, 0x7F, 0x3D, 0x3D, 0xD2, 0xBE, 0xF2, 0xF1, 0xE2, 0x77, 0xF0, 0xF0, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xA0, 0xB3, 0x95, 0x77, 0x58, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0x4C, 0xAF, 0xAF, 0xAF, 0x8F, 0x8F, 0x8F, 0x5E, 0x5C, 0x5E, 0x5E, 0x01, 0x01, 0xBA, 0xBA, 0x64, 0x64, 0x67, 0x90, 0x90, 0x90, 0x2B, 0x84, 0x3C, 0x3C, 0x3C, 0x2B, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x94, 0x5D, 0x5D, 0x02, 0x02, 0x4C, 0xBB, 0xDA, 0x07, 0x6F, 0xAF, 0xEE, 0x8F, 0x07, 0x42, 0x07, 0x07, 0x8F, 0x8F, 0x18, 0x8F, 0xE3, 0x5C, 0x5E, 0x20, 0x18, 0x8F, 0xD7, 0x8D, 0x14,
+	0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x9F, 0x60, 0x63, 0x63, 0x05, 0x05, 0xDE, 0xDE, 0xE3, 0xA3, 0x4C, 0xAF, 0x94, 0x2B, 0xC7, 0xC7, 0xE4, 0xE4, 0xE4, 0xE4, 0x80, 0x80, 0xE4, 0xE4, 0x24, 0x0B, 0x4D, 0xEB, 0x42, 0x18, 0x33, 0x33, 0x97, 0xE6, 0x04, 0x4A, 0xE6, 0xFB, 0x68, 0x68, 0x3B, 0xB6, 0x4A, 0x9F, 0xB6, 0xC9, 0x25, 0xB6, 0x0E, 0x9F, 0x4A, 0xC9, 0x9F, 0x68, 0x68, 0xE6, 0xBD, 0x68, 0x68, 0x68, 0x3B, 0x0E, 0x60, 0x3B, 0x31, 0x19, 0xB0, 0x0C, 0x0C, 0x43, 0xB0, 0x0E, 0x31, 0x25, 0x0E, 0x25, 0x25, 0xD6, 0x27, 0xD6, 0x10, 0x60, 0x73, 0xB4, 0x3F, 0xB4, 0x97, 0xB4, 0xB4, 0xB4, 0x81, 0xB4, 0x83, 0x97, 0x82, 0xB5, 0x9E, 0xEE, 0xAF, 0x02, 0x5D, 0x65, 0x94, 0xC8, 0x65, 0x40, 0x3E, 0xEB, 0xED, 0x72, 0x99, 0xDA, 0xEA, 0x40, 0x71, 0x15, 0xC8, 0x08, 0x96, 0x71, 0x71, 0x08, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0x71, 0xC2, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x4D, 0xC2, 0x71, 0xFD, 0xC2, 0x71, 0xDD, 0xFD, 0xC7, 0xDC, 0xC7, 0xBF, 0xC7, 0xDB, 0x24, 0xDB, 0x39, 0x7F, 0x7F, 0x59, 0xF2, 0xF2, 0xF2, 0xF1, 0xE2, 0xF0, 0x77, 0xF0, 0x77, 0xD5, 0xD5, 0xB3, 0xD5, 0xD5, 0xB3, 0x95, 0xB3, 0x95, 0x37, 0xAF, 0xAF, 0xAF, 0x8F, 0xAF, 0xAF, 0xAF, 0xD7, 0xAF, 0xAF, 0xAF, 0xAF, 0x8F, 0xD7, 0x8F, 0x8F, 0xE3, 0xE3, 0xE3, 0x5E, 0xBA, 0x47, 0x84, 0x67, 0x90, 0x90, 0x2B, 0x2B, 0x2B, 0x2B, 0x6E, 0x2B, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0x0B, 0x2B, 0x65, 0x5D, 0xAF, 0x4C, 0x02, 0x02, 0x6F, 0x6F, 0x07, 0x8F, 0x5A, 0xAF, 0x07, 0x5C, 0x5C, 0x18, 0x07, 0x18, 0x8F, 0x18, 0x8F, 0x5C, 0x20, 0xE3, 0x18, 0x33, 0x12, 0x8D, 0x14, 0x14,
+	0xF9, 0xFA, 0xB7, 0xFB, 0xFB, 0xB6, 0xE3, 0x63, 0x63, 0x05, 0xC6, 0xDE, 0xDE, 0xBA, 0x26, 0xA3, 0x02, 0x94, 0x2B, 0xFD, 0x24, 0x24, 0xE4, 0x39, 0x39, 0xE4, 0xE4, 0xB1, 0xE4, 0x24, 0xC7, 0x71, 0xF4, 0x41, 0x18, 0x33, 0xE3, 0xF9, 0x83, 0x9F, 0x68, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x9F, 0x25, 0x9F, 0xB6, 0x26, 0xC9, 0x97, 0x68, 0x4A, 0xC9, 0x4A, 0x9F, 0x10, 0x9F, 0xB6, 0x97, 0x68, 0x9F, 0x9F, 0x04, 0x04, 0xE1, 0x6D, 0x3B, 0x60, 0x31, 0x51, 0x0C, 0x50, 0xEC, 0xAD, 0x04, 0x25, 0x60, 0xAD, 0x75, 0x25, 0xE3, 0x68, 0xF9, 0x97, 0x26, 0x9F, 0xCD, 0xB4, 0xB2, 0xB4, 0xB4, 0xB4, 0xE6, 0x83, 0x83, 0x81, 0x82, 0xC3, 0xA3, 0xAF, 0x02, 0x16, 0x8E, 0x94, 0x94, 0x3E, 0x0D, 0x3E, 0x40, 0xDA, 0x72, 0x72, 0xED, 0xEA, 0x40, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0xC2, 0xC2, 0x71, 0xDD, 0x71, 0xDC, 0xFD, 0xFD, 0x53, 0xDC, 0xC0, 0xC7, 0xDB, 0x24, 0xDB, 0xDB, 0x39, 0x3D, 0x3D, 0x3D, 0x3D, 0xF2, 0xE2, 0xE2, 0xE2, 0x77, 0xF0, 0x77, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x95, 0xE8, 0xAF, 0xAF, 0x8F, 0xA8, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xAF, 0xD7, 0xD7, 0xA3, 0x5A, 0xA3, 0xAF, 0x26, 0xAF, 0x26, 0xD7, 0xE3, 0xE3, 0x01, 0x84, 0x84, 0x2B, 0x2B, 0x90, 0x0B, 0x2B, 0x2B, 0xB1, 0x59, 0x28, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x3C, 0x5D, 0xAF, 0x4C, 0x4C, 0x4C, 0x02, 0x6F, 0x8F, 0x52, 0x52, 0xAF, 0x8F, 0xF4, 0x5C, 0x07, 0x6F, 0x07, 0x8F, 0x18, 0x8F, 0x5C, 0xE3, 0x5E, 0x18, 0xE3, 0xE3, 0x8F, 0xA3, 0x14, 0x14,
+	0xB5, 0xFA, 0xB7, 0xB7, 0xF9, 0xB4, 0x60, 0x63, 0x63, 0x63, 0xC6, 0x63, 0xDE, 0x03, 0x26, 0x4C, 0xAF, 0x3C, 0xC2, 0xC7, 0xC7, 0xE4, 0x24, 0x80, 0xE4, 0xB1, 0x24, 0xB1, 0xE4, 0x24, 0xC7, 0x15, 0x8F, 0x42, 0x20, 0x12, 0x12, 0x83, 0xBD, 0x9F, 0x3B, 0x68, 0x68, 0x3B, 0x97, 0x4A, 0xD6, 0x10, 0x9F, 0x3B, 0x25, 0xC9, 0xB6, 0xB6, 0x25, 0x10, 0x25, 0x26, 0x25, 0x10, 0x68, 0x04, 0x68, 0x9F, 0x68, 0x25, 0xB6, 0x6D, 0x04, 0x04, 0x04, 0xB0, 0xAD, 0xAD, 0x19, 0x50, 0x27, 0x0C, 0xB0, 0xAD, 0x1B, 0x35, 0x60, 0x68, 0xB7, 0xCD, 0xB4, 0xB4, 0x3F, 0xB4, 0xB4, 0xB4, 0xBD, 0xB4, 0xF9, 0x97, 0x83, 0xF9, 0x82, 0xB5, 0xFE, 0xEE, 0x02, 0xBB, 0x5D, 0x65, 0x94, 0x65, 0x94, 0x40, 0xEA, 0xEA, 0x99, 0x09, 0x4C, 0x02, 0x3E, 0x96, 0x96, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x08, 0xC2, 0x71, 0x08, 0xC2, 0x71, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x08, 0xC2, 0x71, 0xFD, 0xDD, 0xFD, 0xDD, 0xFD, 0x53, 0xC7, 0x79, 0xC7, 0xDB, 0x24, 0x36, 0x7F, 0x7F, 0x7F, 0x3D, 0x3D, 0xF2, 0xF2, 0xE2, 0xE2, 0xF0, 0xF0, 0xF0, 0xD5, 0x91, 0xD5, 0xD5, 0xD5, 0xA0, 0xB3, 0x95, 0x95, 0x77, 0x5C, 0xA3, 0x5C, 0xA8, 0x07, 0x18, 0x6F, 0x8F, 0x8F, 0x8F, 0xAF, 0xAF, 0xD7, 0xEE, 0xA3, 0x14, 0x14, 0xA3, 0x14, 0xB4, 0xA3, 0x26, 0xE3, 0x01, 0x01, 0x84, 0xB1, 0xB1, 0xB1, 0x90, 0x2B, 0xB1, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x5D, 0xAF, 0x4C, 0x4C, 0x4C, 0xAF, 0xAF, 0x8F, 0x52, 0x52, 0xAF, 0x6F, 0x5C, 0x5E, 0xF4, 0x8F, 0x33, 0x8F, 0x5C, 0x8F, 0x33, 0x5C, 0x5C, 0x5E, 0xE3, 0x8F, 0x33, 0xD7, 0x14, 0x3F, 0x14,
+	0xC3, 0x82, 0x82, 0x9A, 0xB4, 0xA3, 0x60, 0xDE, 0x05, 0x63, 0xC6, 0x63, 0x05, 0xAC, 0x26, 0xA3, 0x29, 0x65, 0x2B, 0xFD, 0xDB, 0xE4, 0xE4, 0x39, 0x24, 0x39, 0xE4, 0xB1, 0xE4, 0x24, 0x24, 0x15, 0xAF, 0x42, 0x20, 0xA3, 0x4A, 0x83, 0x9F, 0x04, 0x04, 0x83, 0x83, 0x97, 0x10, 0xC9, 0x10, 0x68, 0x68, 0xB6, 0x25, 0x9F, 0x97, 0x68, 0x25, 0xC9, 0x10, 0x9F, 0x9F, 0x10, 0x9F, 0x9F, 0x9F, 0xB6, 0xB6, 0x9F, 0x9F, 0x04, 0x9F, 0x0E, 0x3B, 0xC9, 0xB0, 0x51, 0x27, 0x27, 0x19, 0x19, 0x19, 0x60, 0x60, 0x4A, 0x60, 0x60, 0x68, 0xB7, 0xF9, 0x9F, 0xB4, 0xB4, 0x81, 0xB4, 0xBD, 0x83, 0xF9, 0x83, 0x83, 0xF9, 0xE5, 0xC3, 0xA3, 0x5A, 0x02, 0x16, 0x8E, 0x65, 0x94, 0x8E, 0x40, 0xF8, 0xEA, 0x02, 0x09, 0x72, 0x02, 0xA8, 0x40, 0x08, 0x96, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x15, 0xC2, 0x71, 0xC2, 0xDD, 0xFD, 0xFD, 0x79, 0xFD, 0xC0, 0xC0, 0xC7, 0xDB, 0x24, 0xDB, 0x39, 0x3D, 0x3D, 0x3D, 0xF2, 0xF1, 0xF1, 0xE2, 0xE2, 0xF0, 0x77, 0xD5, 0xD5, 0xD5, 0xD5, 0x1D, 0xD5, 0xD5, 0xB3, 0xB3, 0x95, 0x64, 0xA3, 0x5C, 0x8F, 0x5E, 0x5C, 0x18, 0x07, 0x07, 0x8F, 0x6F, 0x8F, 0x5A, 0xA3, 0x8D, 0x14, 0x14, 0xB2, 0xB2, 0xB5, 0xB5, 0xB5, 0xA3, 0xAF, 0x8F, 0x2B, 0x59, 0xB1, 0xB1, 0xB1, 0x2B, 0xB1, 0x28, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0x6E, 0x02, 0x4C, 0x4C, 0x4C, 0x4C, 0xAF, 0x6F, 0x52, 0x5A, 0x52, 0x8F, 0x5C, 0x5E, 0x41, 0x18, 0x8F, 0x07, 0x8F, 0x8F, 0x8F, 0x18, 0x5C, 0x18, 0x18, 0x18, 0xE3, 0xD7, 0xA3, 0x14, 0x3F, 0xC3,
+	0xC3, 0xA3, 0xD7, 0x26, 0x26, 0xA3, 0xE3, 0xDE, 0x63, 0xC6, 0x05, 0xC6, 0xDE, 0xAC, 0x26, 0xA3, 0xAF, 0x94, 0x2B, 0xC7, 0xC7, 0xE4, 0x80, 0x39, 0xB1, 0x0B, 0xB1, 0xB1, 0xE4, 0x24, 0xC7, 0x94, 0x8F, 0x70, 0xA6, 0x10, 0xCD, 0x04, 0x9F, 0x04, 0xB6, 0x45, 0x9F, 0x9F, 0x9F, 0x68, 0x68, 0x9F, 0x68, 0xB6, 0x9F, 0x9F, 0xB6, 0x9F, 0xD6, 0xC9, 0x10, 0x9F, 0x9F, 0x10, 0x9F, 0x9F, 0x68, 0xE6, 0xE6, 0xFB, 0x4A, 0x10, 0xB6, 0xC9, 0x3B, 0x3B, 0x0E, 0x31, 0x7E, 0xEC, 0x19, 0xAD, 0x27, 0xB0, 0xE1, 0x03, 0x35, 0x1B, 0x68, 0xB7, 0x68, 0xCD, 0x97, 0xB5, 0xE6, 0xB4, 0x68, 0x83, 0xFB, 0x83, 0xF9, 0xE5, 0x82, 0x14, 0x5A, 0xAF, 0x29, 0x5D, 0x65, 0x8E, 0x94, 0x65, 0x96, 0xEA, 0x02, 0x09, 0x09, 0x72, 0x29, 0x0D, 0x0D, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x08, 0xC2, 0xC2, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0xC2, 0xFD, 0x71, 0xDD, 0xFD, 0xC7, 0xC7, 0xDC, 0xC7, 0xC0, 0xC7, 0xDB, 0x36, 0x7F, 0x59, 0x7F, 0x3D, 0x59, 0xF2, 0xF1, 0xE2, 0xF0, 0xF0, 0x91, 0x91, 0xD5, 0xD5, 0xD5, 0xD5, 0xA0, 0xB3, 0x95, 0xD5, 0x95, 0x5F, 0xAF, 0x8F, 0x5C, 0x5E, 0x5C, 0xA8, 0xA8, 0xA8, 0x5C, 0x8F, 0x8F, 0x8F, 0xD7, 0xD7, 0xA3, 0x73, 0x73, 0xB2, 0x97, 0x97, 0x6C, 0xB2, 0xA3, 0x84, 0x59, 0x28, 0x28, 0xB1, 0x2B, 0x2B, 0xB1, 0x28, 0x28, 0x28, 0x28, 0xB1, 0x2B, 0xAF, 0xAF, 0x4C, 0x4C, 0x4C, 0xAF, 0x8F, 0x8F, 0x5A, 0xEE, 0xAF, 0xA8, 0xF4, 0x5E, 0x18, 0x18, 0x8F, 0x33, 0x8F, 0x8F, 0x8F, 0xE3, 0x18, 0x5E, 0xE3, 0x18, 0x12, 0xD7, 0xCD, 0x14, 0x14, 0xC3,
+	0x8D, 0xD7, 0x33, 0x33, 0x12, 0x12, 0x60, 0xAC, 0x63, 0x05, 0xC6, 0x63, 0x05, 0xAC, 0xE3, 0xAF, 0xAF, 0x3C, 0xC2, 0xFD, 0xDB, 0xE4, 0x80, 0x80, 0x39, 0x39, 0x39, 0xB1, 0xE4, 0x24, 0x0B, 0x65, 0xA8, 0x70, 0x20, 0x26, 0x83, 0x83, 0x9F, 0x04, 0x04, 0xC9, 0x4A, 0x10, 0xE6, 0xB6, 0x68, 0x0E, 0x68, 0xB6, 0x9F, 0x9F, 0x0E, 0x26, 0x9F, 0xC9, 0x26, 0x9F, 0xC9, 0x10, 0x9F, 0x68, 0x04, 0x3B, 0xB6, 0xFB, 0x9F, 0x9F, 0x9F, 0x25, 0xC9, 0xC9, 0x3B, 0x04, 0xB0, 0xAD, 0x27, 0xEC, 0x19, 0xB0, 0xAD, 0xAD, 0x60, 0x75, 0x10, 0xFB, 0x10, 0xB2, 0x97, 0x97, 0xF9, 0xF9, 0xB6, 0x97, 0x3B, 0x97, 0xF9, 0x82, 0x14, 0x8D, 0x52, 0x02, 0x29, 0x65, 0x94, 0x65, 0x94, 0xC8, 0xEA, 0xBB, 0x99, 0x09, 0x72, 0xBB, 0xEA, 0xDF, 0x15, 0x94, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0x71, 0x08, 0xC2, 0x71, 0xC2, 0xC2, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x94, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x4D, 0x08, 0xC2, 0x15, 0xC2, 0xDD, 0xFD, 0xFD, 0x53, 0xFD, 0x53, 0xC0, 0xC7, 0xDB, 0x39, 0xDB, 0x7F, 0x3D, 0x3D, 0x3D, 0xF2, 0xF1, 0xE2, 0xE2, 0xF0, 0xF0, 0x91, 0xD5, 0xD5, 0xD5, 0x1D, 0xD5, 0xD5, 0xB3, 0xD5, 0x95, 0xAE, 0x8F, 0x8F, 0x8F, 0x01, 0xA8, 0x5E, 0xF4, 0x5C, 0x5C, 0xA8, 0x8F, 0x07, 0x8F, 0xD7, 0xD7, 0xA3, 0x9F, 0xB4, 0xB4, 0xFB, 0xF9, 0x6C, 0x5A, 0x90, 0xA5, 0x28, 0xB1, 0xB1, 0x2B, 0xB1, 0xB1, 0x28, 0x28, 0xB1, 0xB1, 0x2B, 0x5D, 0x4C, 0x4C, 0x72, 0x4C, 0xA3, 0xD7, 0xAF, 0xD7, 0xEE, 0xAF, 0x8F, 0x5C, 0x41, 0x18, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x33, 0x5C, 0xA6, 0xA6, 0x20, 0xE3, 0x8F, 0x26, 0x26, 0xA3, 0x4B, 0x14,
+	0x18, 0x18, 0x33, 0x52, 0x33, 0xE3, 0xBA, 0x9B, 0xDE, 0x05, 0xC6, 0x63, 0x05, 0xDE, 0xE3, 0xA3, 0x29, 0x94, 0x2B, 0xC7, 0xC7, 0x39, 0x80, 0x80, 0xB1, 0x24, 0xB1, 0xB1, 0xE4, 0xE4, 0x0B, 0xF3, 0x5C, 0x48, 0x20, 0x12, 0x83, 0x83, 0x9F, 0x9F, 0x4A, 0x10, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x9F, 0x68, 0xB6, 0x9F, 0x9F, 0x25, 0x68, 0x9F, 0x25, 0xC9, 0x26, 0x9F, 0x68, 0xE6, 0x68, 0xB6, 0x9F, 0x68, 0x3B, 0x9F, 0x4A, 0x4A, 0x4A, 0x04, 0x04, 0x04, 0x0E, 0xB0, 0xAD, 0x27, 0xEC, 0x43, 0x60, 0xE1, 0x03, 0x75, 0x4A, 0xB4, 0xB4, 0x97, 0xB2, 0xB4, 0xF9, 0xF9, 0xB6, 0x97, 0x3B, 0xF9, 0x82, 0xC3, 0x4B, 0x5A, 0x52, 0x02, 0x5D, 0x65, 0x65, 0x8E, 0xC8, 0x6A, 0x29, 0x99, 0x09, 0x72, 0xED, 0xEA, 0x40, 0x2D, 0x2D, 0xC8, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0xC2, 0x71, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x15, 0xC2, 0xC2, 0x15, 0xFD, 0xDC, 0xC7, 0xFD, 0xC7, 0xDC, 0xBF, 0xDB, 0xC7, 0xDB, 0xDB, 0x7F, 0x7F, 0x3D, 0x3D, 0xF2, 0xF1, 0xC5, 0xE2, 0xE2, 0x91, 0xD5, 0x91, 0xD5, 0x1D, 0xD5, 0x1D, 0xA0, 0xD5, 0xB3, 0xA1, 0xB3, 0xBA, 0x8F, 0x8F, 0x5C, 0xF4, 0xF4, 0xA8, 0x5C, 0xA8, 0x5C, 0x8F, 0x18, 0x8F, 0x33, 0xD7, 0xD7, 0x26, 0x9F, 0xB4, 0x97, 0xB2, 0x3A, 0xA3, 0x66, 0x59, 0xB1, 0x28, 0xB1, 0x2B, 0xB1, 0xB1, 0x28, 0x28, 0xB1, 0xB1, 0x6E, 0x4C, 0x4C, 0x72, 0x4C, 0xAF, 0xAF, 0x26, 0xAF, 0xA3, 0xAF, 0x8F, 0x18, 0x42, 0x5E, 0x18, 0x8F, 0xD7, 0x52, 0x8F, 0x8F, 0x8F, 0x07, 0x18, 0xA6, 0xA6, 0x20, 0x8F, 0x12, 0xD7, 0xD7, 0x8D, 0xCD, 0x4B,
+	0x8F, 0x33, 0x33, 0x8F, 0xE3, 0x5E, 0x03, 0xAC, 0xDE, 0x05, 0xC6, 0x05, 0x63, 0xDE, 0x01, 0xA3, 0xA8, 0x65, 0x2B, 0x0B, 0xC7, 0x24, 0x80, 0x80, 0x39, 0x39, 0xB1, 0xE4, 0xE4, 0x24, 0xC7, 0xF6, 0x5C, 0x7D, 0x20, 0xD6, 0xB4, 0xE6, 0x04, 0x04, 0xE6, 0x68, 0x04, 0xB4, 0xE6, 0xB4, 0x9F, 0x9F, 0x9F, 0x0E, 0xB6, 0xB6, 0x68, 0xB6, 0x9F, 0x4A, 0x25, 0x9F, 0x0E, 0xC9, 0x4A, 0x3B, 0x68, 0xE6, 0xE6, 0x4A, 0x68, 0x3B, 0x26, 0x4A, 0x4A, 0x9F, 0x9F, 0xE1, 0x3B, 0x25, 0x31, 0xB0, 0x0C, 0x27, 0x9B, 0x60, 0x60, 0x25, 0x68, 0xB6, 0xCD, 0xFB, 0xB4, 0xB4, 0xB6, 0x97, 0xFB, 0xB7, 0xFB, 0x81, 0xE5, 0x9E, 0x6B, 0xED, 0x02, 0x5D, 0x5D, 0x94, 0x65, 0x94, 0x3E, 0x29, 0x72, 0x3A, 0x72, 0x52, 0x4E, 0x65, 0xC8, 0xC8, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x71, 0x71, 0x71, 0x71, 0x08, 0x71, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x15, 0x08, 0x08, 0x71, 0x71, 0xDD, 0xDD, 0xC2, 0xDD, 0xFD, 0xBF, 0xDC, 0xDB, 0xC7, 0xDB, 0x90, 0xDB, 0x39, 0xA4, 0x3D, 0x3D, 0xF2, 0xF2, 0xF1, 0xF0, 0xE2, 0xF0, 0xF0, 0xD5, 0x91, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x95, 0x55, 0xAF, 0xAF, 0x5C, 0x5C, 0xF4, 0x01, 0x5C, 0xA8, 0xA8, 0x5C, 0x8F, 0x07, 0x8F, 0x12, 0x12, 0x26, 0xA3, 0x14, 0x73, 0xC4, 0xFE, 0xAF, 0x84, 0xA5, 0xA5, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0x28, 0xB1, 0xB1, 0x6E, 0x4C, 0x72, 0x72, 0x72, 0xA3, 0xD7, 0xAF, 0xA3, 0x5A, 0xAF, 0x8F, 0x8F, 0xF4, 0x5E, 0x18, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0x52, 0x33, 0x20, 0xA6, 0x42, 0x5E, 0xE3, 0x33, 0x8F, 0x12, 0x26, 0x14, 0x4B, 0x26,
+	0x8F, 0x33, 0x8F, 0x5E, 0xE3, 0xB9, 0x03, 0xDE, 0x63, 0x05, 0x63, 0xC6, 0x05, 0xDE, 0xE3, 0xAF, 0xA8, 0x65, 0x3C, 0x0B, 0xC7, 0x24, 0x80, 0x39, 0x39, 0xB1, 0xB1, 0xB1, 0xE4, 0xE4, 0xC7, 0x5D, 0x5E, 0xBC, 0x18, 0x26, 0xB4, 0x68, 0xB6, 0x04, 0xB6, 0x68, 0xB4, 0xB4, 0xB4, 0x83, 0x9F, 0x68, 0x9F, 0x9F, 0x68, 0x68, 0x9F, 0x68, 0x68, 0xC9, 0x25, 0x9F, 0x68, 0x4A, 0xD6, 0x9F, 0xB6, 0x9F, 0x3B, 0xC9, 0xD6, 0xC9, 0x3B, 0x9F, 0xD6, 0x9F, 0xB6, 0x31, 0x1B, 0x0E, 0x25, 0x31, 0xB0, 0x31, 0x03, 0x27, 0x35, 0xB7, 0xB6, 0x9F, 0xB2, 0xB4, 0xB4, 0xB6, 0xB5, 0xB4, 0x81, 0xF9, 0x81, 0x73, 0x9A, 0xEE, 0xED, 0x02, 0x02, 0x5D, 0x8E, 0x65, 0x2D, 0x3E, 0x02, 0x72, 0x09, 0x72, 0x52, 0x6F, 0x4E, 0x94, 0xC8, 0xC8, 0xC8, 0x08, 0x08, 0x96, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0x71, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x4D, 0xC2, 0x71, 0xDC, 0xFD, 0x79, 0xC7, 0xDC, 0xBF, 0xC7, 0xC7, 0xDB, 0xDB, 0xDB, 0x7F, 0x3D, 0x3D, 0x3D, 0xF2, 0xF2, 0xC5, 0xE2, 0xF0, 0xF0, 0xF0, 0xD5, 0x1D, 0xD5, 0x1D, 0xD5, 0xD5, 0xB3, 0xB3, 0x95, 0xBE, 0x8F, 0x8F, 0x5C, 0xA8, 0x5C, 0x5E, 0xF4, 0x5C, 0xA8, 0x5C, 0x8F, 0x5C, 0x8F, 0xE3, 0x8F, 0xD7, 0x26, 0xA3, 0xA3, 0x99, 0x14, 0xAF, 0x6E, 0x7F, 0xA5, 0x28, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0x2B, 0x6E, 0x4C, 0x4C, 0x72, 0xA3, 0x4C, 0xA3, 0xAF, 0xA3, 0xEE, 0xD7, 0xAF, 0xE3, 0x5C, 0x5E, 0x18, 0x8F, 0x8F, 0xD7, 0xD7, 0x52, 0x33, 0x8F, 0x18, 0xA6, 0xA6, 0xA6, 0x20, 0x5C, 0x8F, 0x12, 0x26, 0x26, 0xCD, 0x26, 0x4B,
+	0x26, 0x8F, 0xE3, 0x5E, 0x35, 0xB9, 0x03, 0xAC, 0x63, 0x05, 0xC6, 0x63, 0x05, 0xDE, 0x03, 0xAF, 0x8F, 0x65, 0x2B, 0x0B, 0xC7, 0x39, 0x39, 0x80, 0x39, 0x39, 0xB1, 0xE4, 0xB1, 0x24, 0x0B, 0xA8, 0xF4, 0x7D, 0x20, 0xBD, 0x83, 0x9F, 0x04, 0x68, 0x68, 0x68, 0xB4, 0x68, 0x68, 0xB6, 0x68, 0x9F, 0x0E, 0x68, 0xB6, 0x04, 0xB6, 0x0E, 0xC9, 0x25, 0x26, 0xB6, 0xB6, 0x25, 0x60, 0xC9, 0x3B, 0x10, 0xFB, 0xC9, 0x33, 0xE1, 0x9F, 0x9F, 0xE1, 0x10, 0xB6, 0x25, 0x60, 0x0E, 0xE1, 0xAD, 0x19, 0x25, 0x25, 0x60, 0x35, 0x0E, 0xB5, 0x68, 0xB6, 0x68, 0x68, 0xB6, 0xF9, 0xE6, 0x83, 0xF9, 0x81, 0x73, 0xEE, 0x6B, 0xAF, 0x8F, 0xF5, 0xEA, 0x87, 0x3E, 0x6F, 0x4C, 0x09, 0x09, 0x72, 0x02, 0xC1, 0xEA, 0x94, 0x94, 0xC8, 0xC8, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x71, 0x71, 0x71, 0xC2, 0x71, 0x71, 0x71, 0xC2, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0xC2, 0x71, 0xDD, 0x71, 0xDD, 0xFD, 0xFD, 0x53, 0xC7, 0xDB, 0xC7, 0x90, 0xDB, 0x7F, 0x39, 0x36, 0x5F, 0x3D, 0x3D, 0xF1, 0xF1, 0xC5, 0xE2, 0xF0, 0x91, 0x91, 0x91, 0xD5, 0xD5, 0x1D, 0x1D, 0x1D, 0x95, 0xB3, 0xB3, 0xBA, 0xAF, 0x8F, 0x5C, 0x5C, 0x5C, 0xF4, 0x5C, 0xA8, 0x5C, 0x8F, 0x5C, 0xE3, 0x33, 0x8F, 0x12, 0xD7, 0xD7, 0xD7, 0xAF, 0xAF, 0xAF, 0x84, 0x1E, 0xA5, 0x28, 0x28, 0xB1, 0xB1, 0xB1, 0x2B, 0x01, 0xAF, 0x4C, 0x72, 0x4C, 0xA3, 0xA3, 0xAF, 0x26, 0xEE, 0xA3, 0x8F, 0x8F, 0x41, 0x5E, 0x20, 0x07, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0x33, 0x18, 0x20, 0x42, 0xA6, 0x20, 0xE3, 0xE3, 0x33, 0x8F, 0x26, 0x14, 0xA3, 0xD7, 0xA3,
+	0x14, 0xD7, 0x5E, 0xA6, 0xA6, 0x03, 0xB9, 0x9B, 0x63, 0x63, 0x05, 0x63, 0x63, 0xDE, 0xBA, 0x26, 0x5C, 0x65, 0x2B, 0x0B, 0xC7, 0x39, 0x80, 0x39, 0x39, 0x80, 0xB1, 0xE4, 0xB1, 0x24, 0xC7, 0xA8, 0x5C, 0x7D, 0x20, 0xB4, 0xF9, 0x9F, 0x04, 0x9F, 0x9F, 0x9F, 0x68, 0x10, 0x10, 0x04, 0x68, 0x9F, 0x9F, 0x9F, 0xB6, 0xB6, 0x3B, 0xC9, 0xD6, 0xE1, 0xE1, 0xB6, 0x0E, 0xD6, 0x60, 0xD6, 0xB6, 0xB6, 0x3B, 0x9F, 0xB0, 0x12, 0x25, 0x9F, 0x4A, 0x1B, 0x9F, 0x25, 0xC9, 0xD6, 0x31, 0xAD, 0xD8, 0xAD, 0x31, 0x3B, 0xE1, 0xD6, 0xFB, 0xB6, 0x68, 0xFB, 0x68, 0xB6, 0xF9, 0xFB, 0xF9, 0xF9, 0x81, 0x73, 0xA3, 0x52, 0x07, 0x5C, 0x41, 0x07, 0x52, 0x6B, 0x09, 0x3A, 0x72, 0x4C, 0x16, 0x5D, 0x4E, 0x94, 0x94, 0xC8, 0xC8, 0xC8, 0x15, 0xC8, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0xC2, 0x08, 0x08, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x08, 0x08, 0xC2, 0x15, 0xFD, 0x4D, 0xFD, 0x71, 0xDD, 0xDC, 0xFD, 0xC0, 0xC7, 0xDB, 0xC7, 0xDB, 0xDB, 0x7F, 0x36, 0x7F, 0x3D, 0x59, 0xF2, 0xF1, 0xF1, 0xC5, 0xF0, 0xF0, 0x77, 0x23, 0xD5, 0x1D, 0xD5, 0xD5, 0xB3, 0xD5, 0x77, 0x95, 0x67, 0xAF, 0x8F, 0x5C, 0xA8, 0x5C, 0x5C, 0x5C, 0xA8, 0x5C, 0x8F, 0x5C, 0x5C, 0xE3, 0x8F, 0x33, 0x8F, 0x8F, 0x8F, 0x33, 0x8F, 0xA8, 0x84, 0x1E, 0xA5, 0xA5, 0xB1, 0x28, 0x2B, 0x6E, 0xAF, 0xAF, 0x4C, 0x72, 0x4C, 0xA3, 0xAF, 0xAF, 0xD7, 0xA3, 0x5A, 0x8F, 0x5C, 0x5E, 0x5E, 0x5C, 0x18, 0x8F, 0xD7, 0xD7, 0xD7, 0xD7, 0x12, 0x8F, 0x20, 0xA6, 0xA6, 0xA6, 0x18, 0xE3, 0xE3, 0x8F, 0x26, 0xA3, 0xA3, 0x26, 0x12, 0xCD,
+	0x73, 0x26, 0xE3, 0x20, 0x35, 0x5E, 0x60, 0xAC, 0xDE, 0x63, 0xC6, 0x63, 0x05, 0xDE, 0x03, 0xAF, 0x8F, 0x65, 0xA9, 0x2B, 0x39, 0x39, 0x39, 0x80, 0x39, 0x80, 0xB1, 0xB1, 0xE4, 0xE4, 0x24, 0xF4, 0x8F, 0x35, 0xE3, 0xE6, 0x83, 0x68, 0x04, 0x9F, 0x0E, 0x68, 0x68, 0xC9, 0x9F, 0xB6, 0x9F, 0x68, 0xD6, 0xC9, 0xB6, 0x9F, 0x3B, 0x4A, 0xD6, 0xB0, 0x35, 0xB6, 0x0E, 0xE1, 0x60, 0xB0, 0xC9, 0x3B, 0x9F, 0x3B, 0x1B, 0x31, 0xB6, 0x9F, 0xB6, 0xAD, 0xD6, 0x0E, 0x0E, 0xE1, 0x25, 0x31, 0x19, 0x27, 0xD6, 0xB6, 0xD6, 0xD6, 0xB6, 0xB7, 0xB6, 0xB4, 0xE6, 0x97, 0xF9, 0xF9, 0xF9, 0x82, 0x86, 0x4B, 0x8F, 0x8F, 0xAF, 0x5A, 0x8D, 0x99, 0x09, 0xE5, 0x99, 0xEE, 0x6F, 0xDA, 0xF6, 0x65, 0x94, 0x94, 0x94, 0x94, 0x08, 0xC8, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0x71, 0x71, 0x08, 0xC2, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x4D, 0x08, 0xC2, 0xDD, 0x71, 0xDD, 0xFD, 0xDD, 0xFD, 0xC0, 0xC7, 0xC0, 0xC0, 0x24, 0xDB, 0xDB, 0x7F, 0x5F, 0x3D, 0x3D, 0xF2, 0xF1, 0xF1, 0xF0, 0xE2, 0xF0, 0x91, 0xF0, 0xD5, 0xD5, 0x23, 0xD5, 0x69, 0xB3, 0x77, 0x95, 0x5F, 0xA3, 0x8F, 0xA8, 0xE3, 0x5C, 0x5C, 0x5C, 0xA8, 0x5C, 0x5C, 0x8F, 0x5C, 0xE3, 0xE3, 0x8F, 0xE3, 0xE3, 0x5C, 0x8F, 0x8F, 0x29, 0x84, 0x80, 0xA5, 0x28, 0xB1, 0xB1, 0x6E, 0xAF, 0xAF, 0x4C, 0xAF, 0xA3, 0x4C, 0xAF, 0xAF, 0x26, 0xAF, 0x5A, 0xD7, 0x18, 0x5C, 0x42, 0x41, 0xE3, 0x8F, 0xD7, 0xD7, 0xA3, 0xA3, 0x52, 0x33, 0x18, 0x5E, 0xA6, 0x42, 0x20, 0xE3, 0x5C, 0x33, 0xD7, 0xA3, 0x10, 0x26, 0x26, 0x26, 0xCD,
+	0xB2, 0x14, 0xD7, 0xE3, 0x20, 0xE3, 0x60, 0x03, 0xDE, 0x63, 0x05, 0xC6, 0x63, 0xDE, 0xBA, 0xE3, 0x8F, 0x65, 0x2B, 0xDC, 0xC7, 0x39, 0x80, 0x39, 0x1E, 0x80, 0xB1, 0xB1, 0xE4, 0x24, 0x24, 0x6E, 0x8F, 0x18, 0x1B, 0x97, 0x83, 0xB6, 0x04, 0x04, 0x9F, 0x68, 0x68, 0x10, 0x10, 0x04, 0xB6, 0x04, 0xD6, 0xC9, 0xB6, 0x9F, 0xB6, 0xC9, 0x25, 0xD6, 0x60, 0x04, 0x9F, 0xB0, 0x60, 0x60, 0x60, 0xB6, 0x0E, 0x04, 0x0E, 0x60, 0x3B, 0xB6, 0xC9, 0xE1, 0x0C, 0x9F, 0x0E, 0x25, 0xB0, 0x60, 0x0C, 0xEC, 0x03, 0xC9, 0x9F, 0xC9, 0x9F, 0xB7, 0xFB, 0x9F, 0xB5, 0xB6, 0xB4, 0xB4, 0xB4, 0x81, 0x73, 0x14, 0xA3, 0x99, 0xC4, 0x6C, 0x09, 0x72, 0x99, 0x52, 0x6F, 0xDA, 0xEA, 0x3E, 0x4E, 0x94, 0xC8, 0x94, 0x94, 0xC8, 0xC8, 0x08, 0x08, 0x94, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x96, 0x08, 0x08, 0x71, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x71, 0x71, 0x71, 0x71, 0xC2, 0x71, 0x71, 0xC2, 0x71, 0x71, 0xC2, 0x15, 0xC2, 0x15, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x15, 0xC2, 0x08, 0xDD, 0x71, 0xDD, 0xDC, 0xFD, 0x53, 0xC7, 0xBF, 0xC0, 0xDB, 0xDB, 0x7F, 0x7F, 0x7F, 0x3D, 0x5F, 0xBE, 0xF2, 0xF2, 0xC5, 0xF0, 0xFF, 0x77, 0xF0, 0x1D, 0xD5, 0xD5, 0xD5, 0xD5, 0xB3, 0xD5, 0x95, 0xE2, 0x8F, 0x8F, 0x8F, 0x8F, 0x5C, 0x5C, 0x5C, 0x01, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0xE3, 0x5C, 0x5C, 0x5C, 0xF4, 0xA8, 0xA8, 0x01, 0xC7, 0xB1, 0xB1, 0x2B, 0x6E, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xD7, 0xD7, 0xD7, 0x8F, 0x5E, 0x5E, 0x5E, 0x18, 0x8F, 0xD7, 0xD7, 0xD7, 0x14, 0x8D, 0xD7, 0x18, 0x18, 0xA6, 0x42, 0xA6, 0x5E, 0x20, 0xE3, 0x33, 0x26, 0xA3, 0xA3, 0x26, 0x26, 0x10, 0x14,
+	0xB2, 0x14, 0xA3, 0xD6, 0xE3, 0xE3, 0xE3, 0xB9, 0xDE, 0x63, 0x63, 0xC6, 0x63, 0xDE, 0x03, 0x01, 0xAF, 0x6E, 0x3C, 0xDC, 0x24, 0x39, 0x39, 0x80, 0x7F, 0x80, 0xB1, 0xB1, 0xB1, 0x24, 0xDB, 0xDF, 0x26, 0x12, 0x4B, 0x83, 0x04, 0xE6, 0x9F, 0x04, 0x68, 0x9F, 0x68, 0x9F, 0xC9, 0x68, 0x0E, 0x9F, 0x25, 0xC9, 0x3B, 0x9F, 0x04, 0xC9, 0xC9, 0xE1, 0xB0, 0x3B, 0x04, 0xE1, 0x35, 0xAD, 0x03, 0x25, 0x3B, 0x0E, 0xB6, 0x60, 0xE1, 0x3B, 0xC9, 0x9F, 0x03, 0x1B, 0xC9, 0x9F, 0x25, 0x03, 0xAD, 0x50, 0xEC, 0x60, 0xB6, 0xB6, 0x68, 0x3B, 0xB6, 0xB6, 0x97, 0xB4, 0xB4, 0xB4, 0x82, 0x82, 0x82, 0xC3, 0x6C, 0xB2, 0x72, 0x4C, 0xED, 0x02, 0xBB, 0xC1, 0xEA, 0xC1, 0xEA, 0x0D, 0x0D, 0xC8, 0x94, 0x08, 0xC8, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0xC2, 0x71, 0xFD, 0xC2, 0xFD, 0x71, 0xC2, 0x71, 0xC2, 0x15, 0x08, 0x71, 0x08, 0x08, 0x4D, 0xC2, 0x15, 0x08, 0xC2, 0xC2, 0xDD, 0x71, 0xDD, 0xFD, 0xFD, 0x53, 0xC7, 0xDC, 0xDB, 0xC7, 0xDB, 0xDB, 0x7F, 0x7F, 0x3D, 0x3D, 0x3D, 0xF2, 0xF1, 0xF1, 0xC5, 0xE2, 0xF0, 0x77, 0xD5, 0x23, 0xD5, 0x23, 0xA0, 0x1D, 0xB3, 0x95, 0x77, 0xB8, 0xAF, 0x8F, 0x8F, 0x5C, 0x8F, 0x5C, 0x5C, 0x5C, 0x5C, 0x01, 0xE3, 0x5C, 0xE3, 0x5C, 0x5C, 0x5E, 0xF4, 0xF4, 0xF4, 0xA8, 0xF3, 0x84, 0x2B, 0x84, 0x6E, 0xAF, 0xAF, 0xAF, 0xAF, 0x8F, 0x8F, 0xAF, 0xAF, 0xAF, 0x26, 0xAF, 0xD7, 0x8F, 0x5C, 0x42, 0x41, 0x18, 0x8F, 0xAF, 0xD7, 0x8D, 0xA3, 0xA3, 0xD7, 0xE3, 0x18, 0xA6, 0xA6, 0x7D, 0xA6, 0x5E, 0xE3, 0xE3, 0xD7, 0xA3, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0x73,
+	0xB5, 0xB5, 0x14, 0x26, 0x12, 0xE3, 0xE3, 0x03, 0x9B, 0x63, 0x05, 0x63, 0x05, 0xDE, 0xBA, 0xE3, 0xA8, 0x01, 0x2D, 0xDC, 0xC7, 0x39, 0x80, 0x80, 0x1E, 0x80, 0x80, 0xB1, 0xE4, 0x24, 0x7F, 0x54, 0xD7, 0x26, 0x3F, 0xE6, 0x68, 0x3B, 0x9F, 0xB6, 0x04, 0x68, 0x9F, 0xC9, 0x4A, 0x10, 0x9F, 0x9F, 0x1B, 0x25, 0x3B, 0x9F, 0x04, 0x25, 0x9F, 0x60, 0x31, 0xB6, 0x04, 0xB0, 0xAD, 0x35, 0xAD, 0xE1, 0xB6, 0x3B, 0xD6, 0x1B, 0x35, 0xE6, 0x6D, 0x0E, 0x25, 0xAD, 0xE1, 0x25, 0x0E, 0x0C, 0xAD, 0x51, 0x60, 0x03, 0xB0, 0xB6, 0x9F, 0xB6, 0x68, 0x68, 0xB4, 0xB4, 0xB5, 0x3A, 0xB2, 0x09, 0xC3, 0xC3, 0xA3, 0x8D, 0xAF, 0xAF, 0x29, 0x16, 0x16, 0x8E, 0x8E, 0xC8, 0x94, 0x40, 0x0D, 0xC8, 0x2D, 0x65, 0xC8, 0x08, 0x94, 0x08, 0x94, 0x08, 0x94, 0x08, 0xC8, 0xC8, 0x08, 0x08, 0xC8, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x71, 0x08, 0xC2, 0x08, 0x71, 0xC2, 0x71, 0xC2, 0xFD, 0x71, 0x71, 0x71, 0x71, 0x71, 0xC2, 0xC2, 0x08, 0x15, 0xC2, 0x08, 0xC2, 0x08, 0xC2, 0x08, 0xDD, 0x08, 0xDD, 0x71, 0xDD, 0xDD, 0xFD, 0xDC, 0xC7, 0xC7, 0xC0, 0xC7, 0xDB, 0xDB, 0xDB, 0x3D, 0x92, 0x3D, 0xE8, 0xF2, 0xF2, 0xF1, 0xC5, 0xE2, 0xC5, 0xF0, 0x91, 0xD5, 0xD5, 0xD5, 0xB3, 0x69, 0xB3, 0xD5, 0x95, 0x8C, 0xA3, 0x8F, 0x8F, 0xE3, 0x5C, 0x8F, 0x01, 0x5C, 0x5C, 0x01, 0x5C, 0x5E, 0x5C, 0x5C, 0x01, 0x01, 0x42, 0x87, 0xF4, 0xA8, 0xF4, 0x6E, 0xF4, 0x5D, 0x5D, 0xAF, 0xAF, 0x29, 0xAF, 0xA8, 0x8F, 0x5C, 0x8F, 0xAF, 0xAF, 0xA3, 0x8F, 0x18, 0x5E, 0x5E, 0x18, 0x18, 0xD7, 0x26, 0xEE, 0xA3, 0x99, 0xD7, 0x8F, 0x18, 0xA6, 0xA6, 0x7D, 0x42, 0xA6, 0xA6, 0xE3, 0xE3, 0x26, 0x26, 0xA3, 0x10, 0x14, 0x68, 0x14, 0xB5,
+	0xB4, 0x9F, 0xA3, 0x10, 0x26, 0x33, 0xD6, 0x03, 0x9B, 0xDE, 0x05, 0xC6, 0x63, 0xDE, 0xAC, 0x01, 0x8F, 0x65, 0x3C, 0xDC, 0x24, 0x24, 0x80, 0x7F, 0x1E, 0xE4, 0xB1, 0xB1, 0x80, 0x24, 0xE4, 0x54, 0x8D, 0x26, 0x10, 0xBD, 0xB6, 0x9F, 0x0E, 0x9F, 0xB6, 0xB6, 0x9F, 0x4A, 0x25, 0x4A, 0xC9, 0x04, 0x25, 0x60, 0xB6, 0x04, 0xB6, 0x04, 0xB0, 0x60, 0x0E, 0xB6, 0x3B, 0x25, 0xAD, 0x7C, 0xEF, 0x51, 0x3B, 0x04, 0x0E, 0xB0, 0x75, 0xE1, 0xB7, 0x0E, 0x25, 0x60, 0xB0, 0x25, 0x31, 0xB0, 0xAD, 0x0C, 0x25, 0x60, 0x03, 0xC9, 0xB6, 0xB6, 0xB6, 0x68, 0x97, 0xF9, 0xB2, 0xB2, 0xC4, 0xFE, 0x8D, 0x52, 0x8F, 0x6F, 0x07, 0x16, 0x16, 0x5D, 0x8E, 0x94, 0x94, 0x94, 0x94, 0xC8, 0x0D, 0xC8, 0xE9, 0xE9, 0xC8, 0xC8, 0x94, 0x94, 0x94, 0xC8, 0xC8, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x08, 0xC8, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x71, 0x71, 0x71, 0xC2, 0x71, 0x71, 0xC2, 0x71, 0xC2, 0xC2, 0x4D, 0xFD, 0xC2, 0x15, 0xC2, 0x15, 0xC2, 0x15, 0x08, 0xC2, 0x71, 0xDD, 0x71, 0xFD, 0x71, 0xDD, 0xFD, 0x53, 0xFD, 0x53, 0xC7, 0xDB, 0xDB, 0xDB, 0x36, 0x7F, 0x3D, 0x3D, 0x3D, 0xF2, 0xF1, 0xF1, 0xC5, 0xF0, 0xF0, 0xFF, 0x1D, 0xD5, 0x23, 0xD5, 0xD5, 0xB3, 0xD5, 0x95, 0xBE, 0xAF, 0xAF, 0x8F, 0x8F, 0xE3, 0x5C, 0x8F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x01, 0x5E, 0xA6, 0x01, 0xF3, 0xF3, 0x3C, 0xF6, 0xF6, 0xF6, 0xA8, 0xA8, 0xA8, 0xA8, 0x29, 0xA8, 0xA8, 0xA8, 0x5C, 0xAF, 0xAF, 0xAF, 0xD7, 0x8F, 0x18, 0x18, 0x5E, 0x18, 0x8F, 0xD7, 0xD7, 0xD7, 0xD7, 0xA3, 0xA3, 0xD7, 0xE3, 0xA6, 0x5E, 0x42, 0x47, 0xA6, 0x5E, 0x20, 0x33, 0x12, 0x26, 0xCD, 0x10, 0xA3, 0xA3, 0xA3, 0x14, 0x14,
+	0xB4, 0xA3, 0x10, 0xA3, 0xD6, 0x26, 0xD6, 0xE3, 0xAC, 0x63, 0xC6, 0xC6, 0xC6, 0xDE, 0xDE, 0x01, 0x5C, 0x01, 0x15, 0x2B, 0xC7, 0x39, 0x80, 0x80, 0x80, 0x80, 0x1E, 0x1E, 0x1E, 0xC7, 0xC0, 0xF3, 0xA3, 0x4A, 0x26, 0x10, 0x04, 0x04, 0x04, 0x0E, 0xB6, 0x68, 0x9F, 0x10, 0x10, 0x9F, 0x10, 0xC9, 0x9F, 0xE1, 0xC9, 0xB6, 0x04, 0x0E, 0x31, 0x60, 0x04, 0x3B, 0x04, 0x25, 0xAD, 0x25, 0x7E, 0x0C, 0x0E, 0x3B, 0x6D, 0xB0, 0x0C, 0x60, 0x0E, 0x00, 0xB6, 0xD6, 0x0C, 0x25, 0x3B, 0x31, 0xAD, 0x0C, 0xAD, 0x25, 0x25, 0x25, 0x00, 0x3B, 0xB6, 0x68, 0x97, 0xB2, 0xC4, 0xFE, 0x99, 0xEE, 0xEE, 0x52, 0x29, 0xDA, 0xC1, 0x4E, 0x8E, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x0D, 0x0D, 0x0D, 0x96, 0x96, 0xC8, 0x08, 0x94, 0x08, 0x94, 0x08, 0xC8, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x08, 0xFD, 0x71, 0x71, 0xC2, 0x71, 0x71, 0xC2, 0x4D, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x08, 0x08, 0xC2, 0xC2, 0x15, 0xC2, 0x4D, 0xC2, 0xDD, 0xDD, 0xDD, 0xFD, 0x06, 0xDC, 0xC7, 0xC7, 0xC7, 0xDB, 0xDB, 0xDB, 0x36, 0x7F, 0x3D, 0x92, 0x61, 0x3D, 0xF2, 0xF1, 0xF1, 0xC5, 0xE2, 0x91, 0x77, 0x1D, 0xD5, 0x1D, 0x69, 0xD5, 0xD5, 0x95, 0x32, 0xE3, 0xA3, 0x8F, 0xE3, 0x8F, 0x5C, 0x01, 0xE3, 0x01, 0x5E, 0xA6, 0x01, 0xA6, 0x01, 0x01, 0x87, 0x87, 0xF3, 0x65, 0x65, 0xF4, 0xF3, 0xF4, 0xF4, 0xA8, 0x29, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x8F, 0x8F, 0xAF, 0x8F, 0x33, 0xE3, 0x5C, 0x18, 0x8F, 0xD7, 0xD7, 0xD7, 0xAF, 0x8D, 0x5A, 0xA3, 0x8F, 0x18, 0x42, 0x7D, 0x47, 0x42, 0xB9, 0x20, 0xE3, 0x33, 0x26, 0xA3, 0x10, 0xA3, 0x14, 0x14, 0xB5, 0x73, 0xB5,
+	0x68, 0x9F, 0xA3, 0x9F, 0x26, 0x26, 0x26, 0xE3, 0x9B, 0xC6, 0x23, 0xC6, 0xC6, 0xC6, 0xDE, 0x01, 0x5C, 0x65, 0x84, 0xDC, 0x24, 0x39, 0x80, 0x80, 0x80, 0x1E, 0x1E, 0xE4, 0x80, 0xDB, 0x4D, 0xAF, 0x14, 0x4B, 0x4A, 0x10, 0x04, 0xB6, 0xB6, 0xB6, 0xB6, 0x9F, 0x9F, 0x10, 0x10, 0x9F, 0xC9, 0x25, 0xB6, 0xE1, 0xD6, 0x04, 0xB6, 0xB6, 0x60, 0x60, 0x0E, 0x3B, 0x0E, 0xC9, 0x0C, 0x25, 0xE1, 0xD8, 0x51, 0x0E, 0x3B, 0x25, 0xAD, 0x03, 0x25, 0x3B, 0xB7, 0x25, 0x1B, 0x75, 0x04, 0x04, 0xE1, 0x60, 0x03, 0x7C, 0xB6, 0x9F, 0xB6, 0xB6, 0xB6, 0x97, 0xB4, 0xC3, 0xC4, 0x72, 0x99, 0xED, 0x02, 0x16, 0x16, 0x8E, 0x8E, 0x94, 0x94, 0x94, 0x94, 0x8E, 0x94, 0x94, 0x94, 0x94, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x94, 0x08, 0xC8, 0x08, 0xC8, 0x08, 0x08, 0x08, 0xC8, 0x08, 0x94, 0x08, 0x94, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0xC2, 0x71, 0x71, 0xFD, 0x71, 0x71, 0xDD, 0x71, 0x71, 0x71, 0x71, 0x71, 0xC2, 0x4D, 0x71, 0x4D, 0xC2, 0x71, 0xDD, 0x71, 0xFD, 0xDD, 0xFD, 0xDD, 0xFD, 0xDC, 0x79, 0xC7, 0xC7, 0xDB, 0xC7, 0xDB, 0x39, 0x7F, 0x3D, 0x3D, 0x5F, 0xE8, 0xF2, 0xF2, 0xF1, 0xC5, 0xE2, 0xF0, 0x91, 0x77, 0xD5, 0x1D, 0xB3, 0x23, 0x77, 0x95, 0x77, 0xBA, 0xA3, 0x8F, 0x8F, 0xE3, 0x8F, 0x01, 0xE3, 0x5E, 0x5E, 0x5E, 0xBA, 0xB9, 0x01, 0x87, 0x87, 0xF6, 0x65, 0x65, 0xF3, 0x3E, 0xF3, 0xF3, 0xF4, 0xA8, 0xA8, 0x5D, 0xF6, 0x6E, 0x5D, 0xA8, 0x8F, 0x8F, 0x8F, 0x8F, 0x5C, 0x18, 0x33, 0x8F, 0xD7, 0x8D, 0x8D, 0xD7, 0x26, 0xD7, 0x26, 0x8F, 0xE3, 0xA6, 0x42, 0x47, 0x47, 0x42, 0x5E, 0xE3, 0xE3, 0x12, 0xA3, 0xA3, 0x14, 0x14, 0x14, 0xB5, 0x73, 0xC4, 0x14,
+	0xB4, 0x68, 0x9F, 0xB4, 0xCD, 0x9F, 0x0E, 0xE3, 0xDE, 0xC6, 0x23, 0x23, 0x23, 0xC6, 0x05, 0xAC, 0x5C, 0x01, 0x3C, 0xDD, 0x24, 0x39, 0x80, 0x80, 0x1E, 0x80, 0x80, 0x80, 0x1E, 0xDB, 0x4D, 0x29, 0x26, 0x3F, 0xBD, 0x68, 0x9F, 0x9F, 0x0E, 0xB6, 0xB6, 0x68, 0x10, 0x9F, 0x9F, 0x9F, 0xC9, 0x4A, 0x9F, 0x0E, 0x1B, 0x04, 0x3B, 0xB6, 0xAD, 0x03, 0x04, 0xB6, 0xB6, 0x25, 0x0C, 0xE1, 0xC9, 0xEF, 0x50, 0x25, 0x3B, 0x0E, 0xE1, 0x7E, 0x9F, 0xC9, 0x6D, 0x9F, 0x25, 0xAD, 0xAD, 0x6D, 0x0E, 0x31, 0x51, 0x51, 0x25, 0xC9, 0x0E, 0xB7, 0xB6, 0xF9, 0x73, 0xFE, 0x99, 0x99, 0xED, 0x02, 0x16, 0x4E, 0x8E, 0x8E, 0x94, 0x8E, 0x94, 0x94, 0x8E, 0x94, 0x94, 0x94, 0x94, 0x2D, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x94, 0x08, 0xC8, 0x08, 0x94, 0x08, 0xC8, 0x08, 0x94, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x71, 0x71, 0xFD, 0xC2, 0x71, 0xC2, 0xDD, 0x71, 0xDD, 0x71, 0xFD, 0xC2, 0xDD, 0x71, 0xDD, 0xFD, 0xC2, 0xFD, 0xDD, 0x71, 0xDD, 0xDD, 0x71, 0xFD, 0xDC, 0xDC, 0xFD, 0xDC, 0xC7, 0xBF, 0xDB, 0xC7, 0x36, 0xDB, 0x7F, 0x7F, 0x3D, 0x92, 0x3D, 0xF2, 0x3D, 0xF1, 0xE2, 0xE2, 0xF0, 0xF0, 0xF0, 0xD5, 0x1D, 0x1D, 0xD5, 0x1D, 0x77, 0x95, 0xDE, 0xA3, 0x26, 0xAF, 0xE3, 0x8F, 0xE3, 0x01, 0x5C, 0x5C, 0x01, 0xA6, 0xB9, 0x87, 0x87, 0x6E, 0x65, 0x65, 0x01, 0x65, 0x3E, 0xF3, 0xF3, 0xC1, 0xEA, 0xC1, 0x3C, 0x65, 0x65, 0xF6, 0xA8, 0x29, 0x8F, 0x5C, 0x5E, 0xE3, 0x18, 0x8F, 0xD7, 0xD7, 0x8D, 0xD7, 0x26, 0x5A, 0xA3, 0x8F, 0xE3, 0xF4, 0x42, 0x47, 0x47, 0x42, 0xA6, 0xE3, 0xE3, 0x8F, 0x26, 0xA3, 0x14, 0x14, 0xCD, 0x14, 0x14, 0xFE, 0xA3, 0xEE,
+	0xB6, 0xB4, 0x68, 0xB4, 0x9F, 0xA3, 0x9F, 0xE3, 0x63, 0x74, 0xC6, 0xC6, 0x23, 0xC6, 0xC6, 0xDE, 0xA8, 0x3C, 0x3C, 0x2B, 0x0B, 0x39, 0x39, 0x39, 0x7F, 0x80, 0xB1, 0x80, 0x7F, 0x7F, 0x06, 0xB8, 0x18, 0x9F, 0xBD, 0x68, 0xC9, 0x04, 0x9F, 0x97, 0x9F, 0x9F, 0x26, 0x9F, 0xC9, 0x10, 0x4A, 0x4A, 0xC9, 0x3B, 0x1B, 0x25, 0xB6, 0x9F, 0x75, 0x60, 0x04, 0x9F, 0x3B, 0xE1, 0x7E, 0xE1, 0x25, 0x60, 0xD8, 0xB0, 0x6D, 0x3B, 0x0E, 0x35, 0xE1, 0xB6, 0xC9, 0x3B, 0xE1, 0xD6, 0x60, 0x25, 0x04, 0xE1, 0x60, 0xAD, 0x60, 0xAD, 0x26, 0xB7, 0x97, 0x6C, 0xB2, 0xFE, 0xEE, 0xED, 0xBB, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x94, 0x8E, 0x94, 0x94, 0x94, 0x65, 0x94, 0x2D, 0x2D, 0x94, 0xC8, 0x94, 0x94, 0x08, 0x94, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x94, 0x08, 0x08, 0x08, 0x94, 0x08, 0x08, 0x94, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x71, 0x71, 0xC2, 0x71, 0x71, 0x71, 0x71, 0xC2, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xFD, 0x71, 0xC2, 0xFD, 0x71, 0xC2, 0xDD, 0x71, 0xDD, 0xFD, 0xC2, 0xFD, 0xDC, 0xDC, 0xFD, 0xC7, 0xDB, 0xC7, 0xDB, 0xDB, 0x7F, 0x7F, 0x7F, 0x3D, 0x3D, 0xE8, 0xF2, 0xF2, 0xF1, 0xF1, 0xE2, 0x91, 0xF0, 0xF0, 0x1D, 0x77, 0xD5, 0xD5, 0x77, 0xD5, 0x95, 0x5F, 0xAF, 0x26, 0x8F, 0xE3, 0x5C, 0x8F, 0xE3, 0x5C, 0x5E, 0x01, 0xA6, 0x01, 0x87, 0x87, 0x3E, 0x65, 0x65, 0x65, 0x65, 0x4E, 0x65, 0x4E, 0x3E, 0x3E, 0x3E, 0x40, 0x65, 0x65, 0xF6, 0xA8, 0x29, 0x5C, 0x18, 0x18, 0x18, 0x33, 0x33, 0x8F, 0x26, 0xD7, 0xAF, 0xD7, 0x26, 0xAF, 0x8F, 0x5E, 0xB9, 0x8B, 0x7D, 0xB9, 0xA6, 0xA6, 0xE3, 0x33, 0x26, 0x10, 0x10, 0x73, 0x14, 0x4B, 0x14, 0x99, 0xA3, 0xAF, 0x8F,
+	0xB4, 0x9F, 0xA3, 0xB4, 0x9F, 0xCD, 0x9F, 0xE3, 0x63, 0x23, 0x74, 0x23, 0x23, 0xC6, 0xAE, 0xDE, 0xA8, 0x6E, 0x2D, 0x2B, 0x0B, 0x39, 0x39, 0x80, 0x80, 0x80, 0x80, 0x1E, 0xE4, 0x7F, 0xA9, 0x42, 0x33, 0x86, 0xBD, 0xBD, 0x68, 0x3B, 0x9F, 0x68, 0x9F, 0x10, 0x9F, 0x10, 0x10, 0x4A, 0xD6, 0xD6, 0xE1, 0x97, 0x4A, 0x25, 0xB6, 0x25, 0x75, 0x31, 0x9F, 0x0E, 0x0E, 0xE1, 0x75, 0x4A, 0xD6, 0x7C, 0x75, 0x0C, 0x9F, 0x3B, 0x9F, 0xAD, 0x35, 0x0E, 0xC9, 0x68, 0x25, 0x60, 0x0E, 0xD6, 0x9F, 0x25, 0x1B, 0x60, 0xE1, 0x75, 0x51, 0x4A, 0xFB, 0x82, 0xC3, 0x99, 0xED, 0x02, 0x02, 0x16, 0x16, 0x8E, 0x8E, 0x8E, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x2D, 0x94, 0xC8, 0x94, 0x94, 0x08, 0xC8, 0x08, 0x08, 0x94, 0x08, 0x94, 0x94, 0x08, 0x94, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x08, 0x71, 0xC2, 0x71, 0x71, 0x71, 0xFD, 0xC2, 0x71, 0xC2, 0x71, 0xDD, 0x71, 0x71, 0xC2, 0xFD, 0xC2, 0xFD, 0xC2, 0xFD, 0xC2, 0xFD, 0x71, 0xDD, 0xFD, 0xDD, 0xFD, 0xFD, 0xFD, 0xFD, 0xBF, 0xC7, 0xC7, 0xC0, 0x24, 0x90, 0xDB, 0x36, 0x7F, 0x7F, 0x5F, 0x3D, 0x3D, 0xF2, 0xF1, 0xC5, 0x32, 0xE2, 0x91, 0x77, 0x77, 0x1D, 0xD5, 0x1D, 0xB3, 0xD5, 0x95, 0xF0, 0xE3, 0xA3, 0xAF, 0x8F, 0xE3, 0x5C, 0x5C, 0xE3, 0x5C, 0x01, 0x5E, 0x01, 0x87, 0x3C, 0x3C, 0x94, 0x65, 0x94, 0x65, 0x65, 0x3E, 0x65, 0x65, 0xE9, 0x2D, 0x2D, 0x40, 0x65, 0xA8, 0x29, 0x8F, 0x5C, 0x5C, 0x33, 0x12, 0xD7, 0x12, 0x8F, 0x12, 0x8F, 0xD7, 0xD7, 0x8F, 0xE3, 0x5C, 0xB9, 0xEB, 0x8B, 0x8B, 0x7D, 0xA6, 0xE3, 0x8F, 0x26, 0xA3, 0x3F, 0x73, 0x73, 0x73, 0x14, 0xA3, 0xEE, 0x5A, 0x8F, 0x8F,
+	0xB6, 0xB4, 0x68, 0xB4, 0xCD, 0x9F, 0xB4, 0xE3, 0x63, 0x23, 0x74, 0x23, 0xC6, 0x05, 0xC6, 0x90, 0x01, 0x65, 0x2B, 0x2B, 0x0B, 0xB1, 0x39, 0x80, 0x7F, 0x1E, 0x80, 0x7F, 0xE4, 0x92, 0x87, 0x8F, 0xD7, 0x86, 0x9F, 0x83, 0xE6, 0xE6, 0x4A, 0xB6, 0x9F, 0x10, 0x9F, 0x26, 0x10, 0xD6, 0xD6, 0xE1, 0x12, 0x10, 0x68, 0x25, 0x4A, 0x60, 0x7E, 0x10, 0xC9, 0x9F, 0xC9, 0xD6, 0x75, 0x9F, 0x25, 0xE1, 0x1B, 0x50, 0x60, 0x0E, 0x9F, 0x35, 0x0C, 0x26, 0x68, 0xB6, 0xC9, 0xE1, 0xE1, 0x04, 0xC9, 0x3B, 0xC9, 0xB0, 0x31, 0x1B, 0x9B, 0x51, 0xCD, 0x73, 0x4B, 0x5A, 0x52, 0x02, 0x02, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xC8, 0x15, 0xC8, 0x94, 0x08, 0x94, 0x94, 0x94, 0x08, 0x94, 0x08, 0x08, 0x94, 0x08, 0x94, 0x08, 0x08, 0x08, 0x08, 0x94, 0x08, 0x94, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xC2, 0x08, 0x08, 0x71, 0xC2, 0x71, 0x71, 0xC2, 0x71, 0x71, 0x71, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xFD, 0x71, 0xFD, 0x71, 0xFD, 0x71, 0xDD, 0xFD, 0xDD, 0x71, 0xDD, 0xBF, 0xC7, 0xC7, 0xFD, 0xC7, 0xC7, 0xC7, 0xDB, 0xC7, 0x90, 0xDB, 0x7F, 0x36, 0x5F, 0x3D, 0x3D, 0xF2, 0xF2, 0xF2, 0xC5, 0x57, 0x57, 0xF0, 0xF0, 0x1D, 0x77, 0x1D, 0xD5, 0x1D, 0x77, 0xD5, 0x64, 0x26, 0xE3, 0x8F, 0xE3, 0xAF, 0x8F, 0x5C, 0xE3, 0x01, 0x5E, 0x01, 0x87, 0x87, 0x3C, 0x2D, 0x2D, 0x94, 0x0D, 0x65, 0x94, 0x2D, 0x2D, 0x94, 0x15, 0x2D, 0x65, 0x5D, 0xA8, 0xA8, 0x6F, 0x8F, 0x8F, 0xD7, 0xD7, 0x12, 0x8F, 0x33, 0x33, 0x12, 0x8F, 0x8F, 0x8F, 0x5C, 0xA6, 0x70, 0x8B, 0x8B, 0x8B, 0xA6, 0xE3, 0xE3, 0x26, 0x26, 0xB4, 0xB5, 0xB4, 0xC3, 0x14, 0x9E, 0x8D, 0xD7, 0x8F, 0x18, 0x18,
+	0x97, 0xB6, 0xB4, 0xB4, 0x9F, 0xB5, 0x68, 0xD6, 0xDE, 0xFF, 0x74, 0xC6, 0xC6, 0xC6, 0x59, 0x55, 0x01, 0x5D, 0x84, 0x2B, 0x0B, 0x39, 0x80, 0x80, 0x1E, 0x80, 0x7F, 0x1E, 0x7F, 0x93, 0x87, 0x8F, 0x8D, 0xCD, 0x4A, 0x83, 0x97, 0x68, 0x25, 0xFB, 0xCD, 0x26, 0x26, 0x10, 0x4A, 0x4A, 0x4A, 0x4A, 0x25, 0x25, 0x04, 0xD6, 0x1B, 0x03, 0x7E, 0x04, 0x25, 0x9F, 0x04, 0xE1, 0x75, 0x9F, 0x9F, 0xE1, 0x25, 0x31, 0xEF, 0x31, 0xB6, 0x0C, 0x35, 0xB6, 0xFB, 0xB6, 0x9F, 0xC9, 0x12, 0xE1, 0xC9, 0x04, 0x04, 0x7C, 0x60, 0x3B, 0x60, 0x60, 0x20, 0x4B, 0x8D, 0x52, 0x16, 0x02, 0x02, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x94, 0x8E, 0x94, 0x94, 0x94, 0x94, 0xC8, 0xC8, 0x94, 0xC8, 0x94, 0x94, 0x94, 0x08, 0x94, 0x94, 0x08, 0x94, 0x08, 0x08, 0x94, 0x08, 0x94, 0x94, 0x08, 0x08, 0x08, 0x08, 0x08, 0x94, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x71, 0x71, 0x71, 0xC2, 0x71, 0xFD, 0x71, 0xFD, 0x71, 0x4D, 0x71, 0x71, 0x71, 0xFD, 0xC2, 0xFD, 0xC2, 0xFD, 0xC2, 0xFD, 0xC2, 0xFD, 0xFD, 0xFD, 0xDD, 0xFD, 0xC7, 0xC7, 0xC7, 0xC7, 0xFD, 0xDB, 0xC7, 0xDB, 0x90, 0x36, 0x36, 0x7F, 0x36, 0x3D, 0x3D, 0xF2, 0x3D, 0xF1, 0x32, 0xC5, 0x57, 0xFF, 0x1D, 0x1D, 0x1D, 0xB3, 0xD5, 0xD5, 0x77, 0x95, 0xDE, 0x5C, 0xE3, 0xE3, 0x8F, 0x8F, 0xE3, 0x8F, 0x01, 0x5C, 0x5C, 0x01, 0x87, 0x3C, 0xA9, 0x2D, 0x94, 0x2D, 0x0D, 0x94, 0x94, 0x2D, 0x2B, 0x94, 0x2B, 0x94, 0x65, 0x29, 0x29, 0xBB, 0x8F, 0x8F, 0x52, 0x26, 0xD7, 0x12, 0x33, 0x18, 0x33, 0x8F, 0x8F, 0xD7, 0xE3, 0x5E, 0x42, 0x98, 0x8B, 0x42, 0x47, 0xA6, 0xE3, 0xA3, 0xA3, 0x68, 0xB5, 0xB5, 0xB5, 0xC3, 0x14, 0xA3, 0x52, 0x8F, 0x18, 0x41, 0x07,
+};
+
+static const struct s_bitmap _lena_indexed8 =
+{
+	_lena_indexed8_data,
+	256,
+	256,
+	false,
+	BITMAP_BUFFER_INDEXED8,
+	_lena_indexed8_palette,
+};
+
+const bitmap_t *lena_indexed8_bitmap = &_lena_indexed8;
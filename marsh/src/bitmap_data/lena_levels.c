@@ -0,0 +1,305 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "bitmap_data.h"
+
+/* 3 sizes by Lanczos-3, largest first. */
+
+static const uint16_t _lena_levels_128x128_data[] =
+{
+	0xE44F, 0xE44F, 0xEC4E, 0xE44E, 0xE42E, 0xE40D, 0xDC0D, 0xE40D, 0xEC0D, 0xE44E, 0xE46E, 0xECCF, 0xECCE, 0xEC6E, 0xE3CE, 0xCACC, 0x99EA, 0xA20A, 0xAA2B, 0xB24B, 0xB24B, 0xB24A, 0xB26A, 0xB26A, 0xB26A, 0xB24A, 0xB26A, 0xC28B, 0xC2AB, 0xC2CB, 0xCAEB, 0xCAEB, 0xCB2C, 0xCB0B, 0xCB2C, 0xCB2B, 0xCB0B, 0xCB2B, 0xCB0B, 0xCB2C, 0xCB2C, 0xD32C, 0xCB2C, 0xD32C, 0xD32C, 0xCB2C, 0xD34C, 0xD32C, 0xD32C, 0xD34C, 0xD34D, 0xCB4D, 0xCB4D, 0xCB2C, 0xCB0C, 0xCB0C, 0xCB2C, 0xCB4C, 0xCB2C, 0xCB2B, 0xD32C, 0xD32B, 0xD32B, 0xCB2B, 0xD34D, 0xCB0B, 0xCB2C, 0xCB0C, 0xCB0B, 0xCB2C, 0xCB0B, 0xCB0C, 0xCB0C, 0xCB0C, 0xCB0C, 0xCB0C, 0xC2EC, 0xBACB, 0xBAAC, 0xB26A, 0xBA6A, 0xCB2B, 0xD3AD, 0xDC0E, 0xE44E, 0xE42D, 0xDBED, 0xDC0D, 0xDBED, 0xE40E, 0xEC0E, 0xE40D, 0xDBED, 0xDBEC, 0xE40C, 0xDC0C, 0xDC2D, 0xDC2D, 0xDC4D, 0xDC2D, 0xDC4D, 0xFDB1, 0xFE72, 0xFED3, 0xFEB3, 0xDCCF, 0xA249, 0xB24B, 0xB2AC, 0xBAEB, 0xBAEB, 0xC2CA, 0xBB0C, 0xBAEB, 0xBACB, 0xBAEB, 0xC2EB, 0xC2EB, 0xC2EC, 0xC2CB, 0xC2EC, 0xC30C, 0xC2EB, 0xC2CC, 0xC2AC, 0xBA8B, 0xEC0F, 0xF48F,
+	0xE44F, 0xE42E, 0xE42E, 0xE42D, 0xE42D, 0xDC0D, 0xDC0D, 0xDC0D, 0xE40D, 0xE42D, 0xEC8E, 0xECAE, 0xF4CE, 0xEC6E, 0xE3AD, 0xC2AB, 0xA1EA, 0xA1CA, 0xAA0A, 0xB24B, 0xB24A, 0xB24A, 0xB24A, 0xB26A, 0xB24A, 0xB24A, 0xB26A, 0xBA8B, 0xC2AB, 0xC2CB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCB0B, 0xCB2C, 0xCB2B, 0xCB2B, 0xCB2B, 0xCB0B, 0xCB2C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD30C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xCB2C, 0xCB2C, 0xCB2C, 0xCB0C, 0xCB0B, 0xCB2B, 0xCB2C, 0xCB0B, 0xCB0B, 0xCB2B, 0xD32C, 0xD32B, 0xD32B, 0xD32C, 0xCB0C, 0xCB0B, 0xCB2C, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0C, 0xCB0C, 0xCAEB, 0xC2EC, 0xC2EC, 0xBACB, 0xBAAB, 0xB26A, 0xB26A, 0xCB0C, 0xD38D, 0xDBEE, 0xE42E, 0xE42D, 0xDC0D, 0xDBED, 0xDC0D, 0xDC0D, 0xDC0D, 0xDC0D, 0xE40D, 0xDC0C, 0xE40D, 0xE40C, 0xDC2D, 0xDC2D, 0xDC2D, 0xDC0D, 0xDC0C, 0xF571, 0xFE73, 0xFEB3, 0xFED3, 0xE530, 0xAA89, 0xAA4A, 0xBAAC, 0xBAEB, 0xBAEB, 0xBACB, 0xBAEB, 0xBAEB, 0xBACB, 0xC2EB, 0xC2EC, 0xC2EB, 0xC2EB, 0xC2EB, 0xC2EC, 0xC2EC, 0xC2EC, 0xCAEB, 0xC2CA, 0xC2EB, 0xCB8E, 0xB2CC,
+	0xE40E, 0xE40E, 0xE42D, 0xE40D, 0xE40D, 0xE40D, 0xDBED, 0xDBED, 0xE40C, 0xEC4E, 0xEC8E, 0xECAE, 0xECAE, 0xEC4D, 0xDB8C, 0xC2AA, 0xA9EA, 0xA1A9, 0xA9EA, 0xB22A, 0xB22A, 0xB22A, 0xB24A, 0xAA2A, 0xB24A, 0xB24A, 0xBA6A, 0xBA8A, 0xC2AB, 0xC2CB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0C, 0xCB0B, 0xCB0B, 0xD30C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD30C, 0xD30C, 0xD32C, 0xD30C, 0xCB2C, 0xCB2C, 0xCB0C, 0xCB2C, 0xCB0C, 0xCB0B, 0xCB0A, 0xCB0B, 0xCB2C, 0xCB0B, 0xCB0B, 0xCB0B, 0xD32B, 0xCB2B, 0xCB2B, 0xCB2C, 0xCB2C, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0B, 0xCAEB, 0xCB0B, 0xCAEB, 0xCB0C, 0xCB0B, 0xC2EB, 0xC2EB, 0xBACB, 0xBAAB, 0xB26A, 0xB24A, 0xBAAB, 0xCB4C, 0xDBCD, 0xE40D, 0xE42E, 0xDC2D, 0xDC0D, 0xDC0D, 0xE40D, 0xE42D, 0xE40D, 0xE40D, 0xE40D, 0xE40D, 0xDC0C, 0xDC0C, 0xDC0D, 0xDC0D, 0xDC0D, 0xDBEC, 0xE4AE, 0xFE12, 0xFE93, 0xFED3, 0xFE53, 0xCBED, 0xA229, 0xB28A, 0xB2AB, 0xBAEB, 0xBACB, 0xBACB, 0xBAEB, 0xBACB, 0xC2EB, 0xC2EC, 0xC2EB, 0xC2EB, 0xC2EB, 0xC2EB, 0xCAEC, 0xCAEC, 0xCB0B, 0xCB4B, 0xB2CA, 0x7927, 0x5846,
+	0xE42E, 0xE40D, 0xE42D, 0xE40D, 0xE40D, 0xE40D, 0xE40D, 0xE3EC, 0xEC2D, 0xEC8E, 0xEC8E, 0xEC8E, 0xEC8D, 0xEC2D, 0xDB6C, 0xC2AA, 0xA9EA, 0xA1C9, 0xA9EA, 0xB20A, 0xB24A, 0xB24A, 0xB24A, 0xB22A, 0xB229, 0xB229, 0xB26A, 0xBA8A, 0xC2AB, 0xCACB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCB0B, 0xD30B, 0xD30C, 0xD30B, 0xCB0B, 0xD30B, 0xD30B, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD30B, 0xD32C, 0xD30C, 0xD30C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD30C, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0B, 0xD30B, 0xD32C, 0xD32C, 0xD30C, 0xD30B, 0xCB0C, 0xCB2C, 0xCB2C, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0B, 0xCAEB, 0xCB0B, 0xCB0B, 0xCB0C, 0xC2EB, 0xC2CB, 0xBAAB, 0xB28B, 0xB26A, 0xB24A, 0xC30C, 0xD3AD, 0xDBEE, 0xE42E, 0xE44D, 0xE42D, 0xE42D, 0xEC4D, 0xEC4D, 0xE42D, 0xE42D, 0xE40D, 0xE40D, 0xE40C, 0xE40C, 0xDBED, 0xDBED, 0xDBED, 0xDBED, 0xD3EC, 0xED30, 0xFE53, 0xFEB2, 0xFEB4, 0xF592, 0xB2EA, 0xAA69, 0xB2AA, 0xBAAB, 0xBACB, 0xBAEB, 0xBAEB, 0xBACB, 0xBACB, 0xC2CB, 0xC2CB, 0xC2EB, 0xC2EB, 0xC2EB, 0xCAEC, 0xCAEC, 0xD34D, 0xB2AB, 0x7126, 0x5886, 0x58A9,
+	0xE40D, 0xE40D, 0xE40D, 0xE42D, 0xE42C, 0xE40D, 0xE3EC, 0xE42D, 0xEC6D, 0xEC8E, 0xEC8E, 0xEC6D, 0xEC6D, 0xEC0D, 0xDB6B, 0xC2AA, 0xA9E9, 0xA1A9, 0xA9E9, 0xB20A, 0xB22A, 0xB24A, 0xB22A, 0xB22A, 0xB229, 0xB229, 0xBA6A, 0xBA8A, 0xC2AA, 0xCACB, 0xCAEB, 0xCAEB, 0xD2EB, 0xD2EB, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD32C, 0xD32C, 0xD30C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD30C, 0xD30C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD30C, 0xCB0B, 0xD30C, 0xCB0B, 0xD30B, 0xD32C, 0xD34C, 0xD32C, 0xD30C, 0xCB0C, 0xD30C, 0xD32C, 0xCAEB, 0xCB0B, 0xCB0B, 0xCB0B, 0xCAEB, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0C, 0xCAEC, 0xC2EC, 0xBAAB, 0xBA8B, 0xB26B, 0xB24A, 0xBAAB, 0xD36D, 0xDBCE, 0xDC0E, 0xE46E, 0xE44D, 0xE44D, 0xE44D, 0xE44E, 0xE44D, 0xE42D, 0xE42D, 0xEC2D, 0xE40D, 0xE40D, 0xE40D, 0xDBED, 0xDBED, 0xDBED, 0xDBEC, 0xDC4D, 0xFDF2, 0xFEB3, 0xFEB3, 0xFE94, 0xDC8E, 0xA268, 0xB28A, 0xB28B, 0xBACB, 0xBACB, 0xBAEB, 0xC2EB, 0xC2EB, 0xC2EB, 0xC2EB, 0xC2EB, 0xC30B, 0xCB0B, 0xCB0B, 0xD34D, 0xB26C, 0x6887, 0x5867, 0x58A8, 0x50C7,
+	0xE40D, 0xE40D, 0xE40D, 0xE42D, 0xE42D, 0xE42D, 0xE40D, 0xE44D, 0xEC6D, 0xEC6E, 0xEC6E, 0xE46D, 0xEC4D, 0xEC0C, 0xDB8C, 0xCACA, 0xA9E9, 0xA1A8, 0xA9E9, 0xB22A, 0xBA4A, 0xB22A, 0xB22A, 0xB22A, 0xB229, 0xBA29, 0xBA6A, 0xBA8A, 0xC2AA, 0xC2CA, 0xC2CA, 0xCAEA, 0xCAEB, 0xD30B, 0xD30B, 0xD30B, 0xD30B, 0xD30B, 0xD30B, 0xD30B, 0xD30B, 0xD30C, 0xD30C, 0xD32C, 0xD30C, 0xD30B, 0xD30B, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD30B, 0xD30B, 0xD30B, 0xD30B, 0xCB0B, 0xD30B, 0xD30C, 0xCB0B, 0xCB0B, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xCB0C, 0xD30C, 0xD30C, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCAEB, 0xC2EC, 0xC2CC, 0xBA8B, 0xB26B, 0xAA4A, 0xBA6A, 0xCB2D, 0xDBCE, 0xE40E, 0xEC4E, 0xE44E, 0xE44D, 0xE44D, 0xE44E, 0xE44E, 0xE42D, 0xE42D, 0xE42D, 0xE40D, 0xEC0D, 0xE3ED, 0xDBED, 0xDBED, 0xDBED, 0xDBED, 0xD3CB, 0xECCF, 0xFE73, 0xFE92, 0xFED3, 0xFE13, 0xBB4A, 0xAA69, 0xB2AA, 0xBAAB, 0xBACB, 0xBACB, 0xC2EB, 0xC2EB, 0xBACB, 0xC30C, 0xC30C, 0xCB0C, 0xD32C, 0xD38E, 0xAA8B, 0x68A6, 0x5868, 0x60A9, 0x58A7, 0x58C5,
+	0xE40D, 0xE40D, 0xE40D, 0xE42D, 0xE42D, 0xE42D, 0xE42D, 0xEC4E, 0xEC8E, 0xE46E, 0xE44E, 0xE42D, 0xEC4D, 0xEC0D, 0xDB8C, 0xC2AA, 0xA1C8, 0xA1A8, 0xA9E9, 0xB22A, 0xB22A, 0xB229, 0xB24A, 0xB24A, 0xB229, 0xBA49, 0xBA6A, 0xBA6A, 0xC2AA, 0xC2CA, 0xCAEA, 0xCAEB, 0xCB0B, 0xCAEB, 0xCAEB, 0xCB0B, 0xCB0B, 0xCB0B, 0xD30B, 0xCB0B, 0xD30B, 0xD30B, 0xD30B, 0xD30C, 0xD30C, 0xD30B, 0xD30B, 0xD30C, 0xD32C, 0xD30C, 0xD2EB, 0xD2EA, 0xD2EA, 0xD2EB, 0xCAEB, 0xCAEB, 0xD2EB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCB2C, 0xCB0C, 0xD30C, 0xD30C, 0xCB0B, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xC2CB, 0xC2CC, 0xBA8B, 0xB26B, 0xB24A, 0xBA6A, 0xCB0C, 0xDB8E, 0xE40F, 0xE44F, 0xE44F, 0xE44E, 0xE44E, 0xE42E, 0xE44E, 0xE42D, 0xE42D, 0xDC0D, 0xE42D, 0xE40D, 0xDBED, 0xDC0D, 0xDBED, 0xE3CD, 0xE3ED, 0xDBCC, 0xD40C, 0xF5D1, 0xFEB3, 0xFED3, 0xFED4, 0xE510, 0xA289, 0xB26A, 0xBAAB, 0xBACB, 0xC2EB, 0xC2EB, 0xBACB, 0xBAEB, 0xC2EB, 0xC30B, 0xCB2C, 0xD34E, 0xB26B, 0x70C6, 0x5887, 0x5088, 0x5088, 0x58A7, 0x60C6,
+	0xE40D, 0xE42D, 0xE42D, 0xE42D, 0xE42D, 0xE42D, 0xEC6E, 0xEC8F, 0xEC8E, 0xEC6E, 0xE44D, 0xE42D, 0xEC4D, 0xEC2D, 0xE38C, 0xC2AA, 0xA1C8, 0xA1A8, 0xAA09, 0xB229, 0xB24A, 0xB24A, 0xB22A, 0xB22A, 0xB229, 0xB249, 0xBA4A, 0xC28A, 0xC2AA, 0xC2CB, 0xCAEA, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCB0B, 0xD30B, 0xD30B, 0xD30B, 0xD2EB, 0xD30C, 0xD30B, 0xD2EB, 0xD30B, 0xD30C, 0xD32C, 0xD32C, 0xD2EB, 0xD2CA, 0xCAAA, 0xCACA, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCB0C, 0xCB0C, 0xCB0C, 0xD30C, 0xD30C, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCAEC, 0xC2CB, 0xC2AB, 0xBA8B, 0xB28B, 0xB26A, 0xBA8B, 0xCB0D, 0xDB8E, 0xDBEF, 0xE42F, 0xE44F, 0xE44E, 0xE42E, 0xE42E, 0xE42E, 0xE42D, 0xEC2D, 0xE42D, 0xE42D, 0xEC0D, 0xE40D, 0xDC0D, 0xDC0E, 0xE3ED, 0xE3CD, 0xDBCD, 0xCBAC, 0xE4AE, 0xFE52, 0xFED2, 0xFEF3, 0xFE75, 0xC3CD, 0xAA49, 0xBA8B, 0xBACB, 0xC2EB, 0xC2EB, 0xBACB, 0xC2EB, 0xC2EB, 0xC30B, 0xD34D, 0xB26B, 0x6885, 0x5866, 0x50A7, 0x50A6, 0x58C6, 0x60A7, 0x68A8,
+	0xE42D, 0xE42D, 0xE42D, 0xE42D, 0xE44E, 0xEC6E, 0xEC8E, 0xEC8E, 0xF48D, 0xEC6D, 0xE42D, 0xE42C, 0xEC4C, 0xEC2D, 0xE38B, 0xC2AA, 0xA9C9, 0xA1A9, 0xAA09, 0xAA29, 0xB24A, 0xB24A, 0xB24A, 0xB229, 0xB229, 0xB229, 0xBA4A, 0xBA8A, 0xC2AA, 0xC2AA, 0xC2CA, 0xCACB, 0xCAEB, 0xCB0B, 0xD2EB, 0xD2EB, 0xCAEB, 0xCAEB, 0xD2EB, 0xDB0B, 0xDAEB, 0xD2EB, 0xD30B, 0xD30C, 0xD2EC, 0xD30C, 0xD2EC, 0xD2EC, 0xD32C, 0xD30C, 0xD2EB, 0xD2CB, 0xCAAA, 0xCAAA, 0xCAAA, 0xD2EA, 0xCAEB, 0xCAEB, 0xCACA, 0xCAEA, 0xCB0B, 0xD30C, 0xD30C, 0xD2EB, 0xCB2C, 0xCB2C, 0xCB0C, 0xCB0B, 0xCB0B, 0xCAEB, 0xCAEB, 0xD2CB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCACB, 0xC2AB, 0xC28B, 0xBA6B, 0xB24A, 0xBA8B, 0xCB0D, 0xD34E, 0xDBAE, 0xE40F, 0xE42F, 0xE42F, 0xE42E, 0xEC2E, 0xE44D, 0xE42D, 0xE42D, 0xE42D, 0xE42D, 0xE40D, 0xE40D, 0xE40D, 0xE40E, 0xE40D, 0xDBED, 0xDBED, 0xDBAC, 0xDB8B, 0xF550, 0xFE92, 0xF6F3, 0xFEF5, 0xF5D3, 0xBAEB, 0xAA4A, 0xBAAB, 0xBAAB, 0xBAEB, 0xC2CB, 0xCACA, 0xCB0C, 0xD34E, 0xAA6B, 0x60A7, 0x5046, 0x58A8, 0x58C7, 0x58C8, 0x60C7, 0x60A7, 0x60C8,
+	0xEC2E, 0xE42D, 0xE44E, 0xE44E, 0xE46E, 0xEC8E, 0xEC8E, 0xEC6D, 0xF46D, 0xEC4D, 0xE42D, 0xE42D, 0xEC4D, 0xEC0D, 0xDB6B, 0xC289, 0xA1A8, 0xA188, 0xA9E9, 0xB229, 0xB229, 0xB229, 0xB229, 0xB229, 0xB229, 0xB229, 0xBA49, 0xBA8A, 0xC2AA, 0xC2AA, 0xC2CA, 0xCACB, 0xCACA, 0xCAEB, 0xCAEB, 0xD2EB, 0xCAEB, 0xCACB, 0xCACB, 0xD2EB, 0xDAEB, 0xD30B, 0xCAEB, 0xCAEB, 0xD30C, 0xD30C, 0xD2EB, 0xCAEB, 0xD2EB, 0xD2EB, 0xD2CB, 0xD2CB, 0xD2CA, 0xCAAA, 0xCACA, 0xD2EB, 0xD2CB, 0xCAAA, 0xCAAA, 0xCACA, 0xCAEB, 0xCB0B, 0xCB0C, 0xCB0C, 0xCB2C, 0xCB0C, 0xCAEC, 0xCAEB, 0xCB0B, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCACB, 0xCACB, 0xC2AB, 0xC2AB, 0xBA8B, 0xBA4A, 0xBA6B, 0xCAEC, 0xD34D, 0xDBAE, 0xDBEE, 0xDC0E, 0xDC2E, 0xE42E, 0xE42D, 0xE42D, 0xE42D, 0xE42D, 0xDC0D, 0xDC0D, 0xE40D, 0xE40D, 0xEC0D, 0xEC0D, 0xE40D, 0xDBED, 0xDBCD, 0xDBAD, 0xDB8B, 0xDC4D, 0xFE52, 0xFED3, 0xFEF5, 0xFEB6, 0xD46F, 0xA228, 0xB26A, 0xBA8A, 0xBACB, 0xC2EB, 0xCB0B, 0xD34D, 0xAA4B, 0x6886, 0x5046, 0x5087, 0x60C8, 0x6109, 0x60C8, 0x60A7, 0x60C7, 0x60A7,
+	0xEC4E, 0xE42D, 0xE44D, 0xE44D, 0xEC8E, 0xF48E, 0xEC4D, 0xE44D, 0xEC4D, 0xE44D, 0xE42D, 0xE44D, 0xEC4D, 0xEC0C, 0xDB6C, 0xC289, 0xA1A8, 0x9988, 0xA9E9, 0xAA2A, 0xB229, 0xB229, 0xB229, 0xB22A, 0xB229, 0xB229, 0xBA49, 0xBA8A, 0xC2AA, 0xC2AB, 0xC2AA, 0xCACB, 0xCACA, 0xCACA, 0xD2EB, 0xCACB, 0xCACB, 0xCACB, 0xCAEB, 0xD2EB, 0xD2EB, 0xD2EB, 0xCB0B, 0xCB0B, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2CB, 0xD2CB, 0xD2EB, 0xCACA, 0xCACB, 0xC2CA, 0xC2AA, 0xC2AB, 0xC28A, 0xBA8A, 0xBA8A, 0xC2AA, 0xC2EB, 0xCB0C, 0xCB0C, 0xCB0C, 0xCAEC, 0xCAEC, 0xCAEB, 0xCAEB, 0xCB0C, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCACB, 0xCAAB, 0xC2AB, 0xC28B, 0xBA8B, 0xBA4B, 0xBA6B, 0xCACC, 0xD32D, 0xDB8D, 0xDBCE, 0xDBEE, 0xDC0E, 0xDC0E, 0xDC2E, 0xE42D, 0xDC0D, 0xDC0D, 0xDC0D, 0xDC0D, 0xE40D, 0xE40D, 0xE40D, 0xE3ED, 0xDBED, 0xDBCD, 0xDBCD, 0xDBAC, 0xD38B, 0xCB8B, 0xF550, 0xFE93, 0xFEF4, 0xFEF5, 0xFE34, 0xBB2A, 0xAA28, 0xB26A, 0xB28A, 0xBAAB, 0xCB4D, 0xAA6B, 0x68A6, 0x5866, 0x5887, 0x58A8, 0x60E8, 0x60E8, 0x60C8, 0x58A7, 0x5887, 0x5886,
+	0xE44E, 0xE44E, 0xE42D, 0xEC6D, 0xEC8E, 0xEC4D, 0xE42C, 0xE40C, 0xE40C, 0xEC4D, 0xEC4D, 0xE42D, 0xEC4D, 0xEC0D, 0xE38C, 0xC28A, 0xA1A8, 0x9988, 0xA9E9, 0xAA0A, 0xB22A, 0xB22A, 0xB22A, 0xB22A, 0xB229, 0xB249, 0xBA6A, 0xBA8A, 0xC2AA, 0xC2AB, 0xCAAA, 0xCACB, 0xCACA, 0xCACB, 0xCAEB, 0xCAEB, 0xCACB, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2EB, 0xCACB, 0xD30B, 0xD30B, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2EB, 0xD30C, 0xCAEB, 0xCACB, 0xCAEC, 0xCB2C, 0xC32C, 0xC34C, 0xCBEF, 0xCC2F, 0xCC2F, 0xCBEF, 0xC3AE, 0xC32C, 0xBACB, 0xBA8A, 0xC2AB, 0xCACC, 0xCAEC, 0xCACC, 0xCAEC, 0xD2EC, 0xD30C, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCACB, 0xCACB, 0xC2AB, 0xBA8B, 0xBA6B, 0xB24A, 0xBA6A, 0xC2CC, 0xD32D, 0xD36D, 0xDBAD, 0xDBCD, 0xDBEE, 0xDBEE, 0xDC0E, 0xDC0D, 0xDBED, 0xDBED, 0xDC0D, 0xE40D, 0xE3ED, 0xE40D, 0xE3ED, 0xDBCD, 0xDBCD, 0xDBAC, 0xDBAC, 0xDB8C, 0xD3AC, 0xD38B, 0xDC2C, 0xFE12, 0xFED3, 0xFF14, 0xFED5, 0xE4F0, 0xAA68, 0xB26A, 0xB28B, 0xC2ED, 0xA26B, 0x68C5, 0x5866, 0x5868, 0x60A8, 0x60C8, 0x6909, 0x60E8, 0x60C8, 0x58A7, 0x5887, 0x6087,
+	0xE44E, 0xE44D, 0xE44D, 0xF48E, 0xF48E, 0xE40C, 0xE3CB, 0xDBAB, 0xE3EB, 0xEC4E, 0xEC4E, 0xE44D, 0xEC6D, 0xEC0D, 0xE38C, 0xCAAA, 0xA1A9, 0xA188, 0xA9E9, 0xAA09, 0xB22A, 0xB24A, 0xB22A, 0xB22A, 0xB209, 0xB229, 0xBA6A, 0xBA6A, 0xC28A, 0xCACB, 0xCACA, 0xCACB, 0xCAEB, 0xCAEB, 0xCACB, 0xCACB, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2EB, 0xDACB, 0xD2EB, 0xCAEB, 0xD30C, 0xDB0C, 0xD2CB, 0xD2EB, 0xCACB, 0xCB2D, 0xCB8E, 0xCB8E, 0xD3CF, 0xCBD0, 0xD431, 0xD492, 0xD4F3, 0xD554, 0xD553, 0xDD74, 0xE554, 0xE513, 0xE4D2, 0xD40F, 0xC34C, 0xBAAA, 0xBAAB, 0xCAEC, 0xCACC, 0xD2EC, 0xD2EC, 0xD2EC, 0xD2EC, 0xCAEC, 0xCACB, 0xCACB, 0xCACB, 0xD2CB, 0xCAAB, 0xC2AB, 0xC28B, 0xBA8B, 0xBA4A, 0xBA6A, 0xC2CB, 0xD32D, 0xDB8D, 0xDBAD, 0xDBAD, 0xDBCE, 0xDBEE, 0xE40E, 0xE40D, 0xDBED, 0xE3ED, 0xE3ED, 0xE3ED, 0xEBED, 0xE3ED, 0xE3CD, 0xDBCD, 0xDB8C, 0xDB8C, 0xDB8C, 0xDB8C, 0xD38C, 0xD38B, 0xDB8B, 0xF50F, 0xFE93, 0xFEF4, 0xFEF4, 0xFE74, 0xC3CC, 0xAA69, 0xC2ED, 0xA24B, 0x60A6, 0x5065, 0x5887, 0x5088, 0x60A8, 0x60E8, 0x60E8, 0x60E8, 0x58A7, 0x5066, 0x5887, 0x5887,
+	0xE42D, 0xE44D, 0xEC6D, 0xF48E, 0xF44D, 0xE3AB, 0xDB4A, 0xDB4B, 0xE3CB, 0xEC6E, 0xEC4E, 0xEC4D, 0xEC6D, 0xEC0D, 0xE38C, 0xCA8A, 0xA188, 0x9988, 0xA9C9, 0xAA09, 0xB22A, 0xB229, 0xB22A, 0xB22A, 0xB229, 0xBA29, 0xBA6A, 0xC28A, 0xCAAB, 0xCACB, 0xCACA, 0xCACB, 0xD2EB, 0xCACB, 0xCACB, 0xD2CB, 0xD2EB, 0xD2EB, 0xD2EC, 0xD2EC, 0xDACB, 0xD2CB, 0xCAEB, 0xCAEB, 0xCAEC, 0xCAEC, 0xCAEC, 0xD34E, 0xCBAF, 0xD410, 0xCBCF, 0xC3CF, 0xCC30, 0xD4B2, 0xCCB2, 0xCCD2, 0xD534, 0xDD54, 0xD512, 0xCD12, 0xD553, 0xDD93, 0xE5B4, 0xE594, 0xE4D3, 0xC38D, 0xB2AA, 0xBACB, 0xCACB, 0xD2EC, 0xCAEC, 0xCAEC, 0xCAEC, 0xCACB, 0xCACB, 0xCACB, 0xCAAB, 0xC2AB, 0xC28B, 0xC28B, 0xBA8B, 0xB22A, 0xBA4A, 0xCACB, 0xD34C, 0xDB8D, 0xDB8D, 0xD3AD, 0xDBAD, 0xDBCE, 0xDBEE, 0xE3EE, 0xE3ED, 0xDBCD, 0xE3ED, 0xDBCC, 0xE3CC, 0xE3CC, 0xDBAC, 0xDB8C, 0xDB8C, 0xDB6C, 0xD36C, 0xD36C, 0xD36C, 0xDB6C, 0xDB6B, 0xDBEB, 0xFDD1, 0xFEB4, 0xFEF4, 0xFF15, 0xF5B2, 0xB32B, 0xAA8B, 0x68A7, 0x5066, 0x50A7, 0x5087, 0x58A8, 0x60C8, 0x60C8, 0x60C8, 0x58A7, 0x58A7, 0x58A7, 0x5887, 0x5887,
+	0xE42D, 0xEC4D, 0xF48E, 0xF46D, 0xEBEC, 0xDB4A, 0xD2C9, 0xDB0B, 0xE3EC, 0xEC6D, 0xEC6D, 0xF46D, 0xEC6D, 0xEC2D, 0xE38C, 0xC289, 0xA188, 0x9968, 0xA1C9, 0xAA09, 0xAA09, 0xB20A, 0xB22A, 0xB209, 0xB229, 0xBA29, 0xBA4A, 0xC28A, 0xC28A, 0xCAAA, 0xCACB, 0xCACB, 0xCACA, 0xCACA, 0xCACB, 0xD2EB, 0xD2CB, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2CB, 0xCAEB, 0xD32D, 0xD36E, 0xD34E, 0xC2ED, 0xC32D, 0xCB8F, 0xCBAF, 0xC3CF, 0xC3CF, 0xCBF0, 0xC410, 0xC430, 0xCC71, 0xCCB2, 0xD4D2, 0xDD13, 0xD513, 0xD533, 0xD552, 0xD593, 0xD593, 0xDDD4, 0xEDF6, 0xEDD6, 0xD4B2, 0xB2EB, 0xB28A, 0xC2EC, 0xCAEC, 0xCAEC, 0xCACB, 0xCACB, 0xCACB, 0xCAAB, 0xCA8A, 0xC28A, 0xC28B, 0xBA6B, 0xBA6B, 0xB24A, 0xBA6A, 0xCACA, 0xD34C, 0xDB8D, 0xDBAD, 0xDBAD, 0xDBAD, 0xDBCE, 0xDBCE, 0xE3EE, 0xE3EE, 0xDBAC, 0xDBCC, 0xDBCC, 0xDBAC, 0xDBAC, 0xDBAC, 0xDB8C, 0xDB8C, 0xDB6C, 0xD36B, 0xD36C, 0xDB6C, 0xDB6B, 0xDB6B, 0xCB4A, 0xE48E, 0xFE54, 0xFED5, 0xFF15, 0xFEF5, 0xD48F, 0x68C5, 0x5826, 0x5088, 0x50A7, 0x58C7, 0x60C7, 0x60C8, 0x60C8, 0x58A7, 0x58A7, 0x60C8, 0x58A7, 0x5887, 0x5887,
+	0xE44D, 0xF48E, 0xF48E, 0xEC2D, 0xE38B, 0xCA88, 0xC228, 0xDB0C, 0xEC0C, 0xEC6D, 0xEC6D, 0xEC6D, 0xEC6D, 0xEC2D, 0xE3AC, 0xCA89, 0x9988, 0x9968, 0xA1A9, 0xA9E9, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xB209, 0xB229, 0xBA4A, 0xC26A, 0xC28A, 0xC28A, 0xCAAA, 0xCAAA, 0xCACA, 0xCACA, 0xCACB, 0xCACB, 0xCACB, 0xCACB, 0xD2EB, 0xD2EB, 0xD30C, 0xDB8E, 0xDBAF, 0xCB6E, 0xC32D, 0xB2EC, 0xB32D, 0xBB6E, 0xBB6E, 0xBB4E, 0xC3AE, 0xCBAF, 0xCBF0, 0xCC30, 0xD471, 0xD491, 0xCCD2, 0xCCD2, 0xD533, 0xD553, 0xDD53, 0xDD73, 0xDD94, 0xDDB4, 0xD5D5, 0xDDD5, 0xEDF6, 0xED75, 0xC3CE, 0xAA8A, 0xB28A, 0xC2CB, 0xC2AB, 0xCAAB, 0xCAAB, 0xCAAB, 0xC28B, 0xC28A, 0xBA6B, 0xBA6A, 0xB24B, 0xB22A, 0xBA4A, 0xCACB, 0xD32C, 0xDB8D, 0xDBAD, 0xDBAD, 0xDB8D, 0xDBAE, 0xDBAD, 0xDBCE, 0xE3CD, 0xE3CD, 0xDBAC, 0xDB8C, 0xDB8C, 0xDB8C, 0xDBAC, 0xDB8C, 0xDB8C, 0xDB6C, 0xDB6C, 0xDB6C, 0xDB6B, 0xDB8C, 0xDB8C, 0xD36B, 0xD38B, 0xFD51, 0xFEB5, 0xFF15, 0xFF77, 0xBC2E, 0x4802, 0x5868, 0x5068, 0x50A8, 0x60C7, 0x60C7, 0x60C8, 0x58A7, 0x5087, 0x60C8, 0x58A7, 0x5886, 0x58A7, 0x60A8,
+	0xEC8E, 0xFCAE, 0xF46D, 0xEBCC, 0xD32B, 0xA9C7, 0xB1E8, 0xDB4B, 0xEC0C, 0xEC6D, 0xEC6D, 0xEC6D, 0xEC6D, 0xEC2D, 0xE38C, 0xCA8A, 0x9988, 0x9148, 0x9988, 0xA1C9, 0xA1E9, 0xA9E9, 0xAA0A, 0xAA0A, 0xB20A, 0xB22A, 0xB22A, 0xBA4A, 0xC26A, 0xC28A, 0xC28A, 0xC28A, 0xCACB, 0xCACB, 0xCACB, 0xD2CB, 0xD2CA, 0xCACA, 0xC2AA, 0xE3CE, 0xC2CB, 0xC2AB, 0xC2EC, 0xBACB, 0xBAEC, 0xBAEC, 0xBB2D, 0xBB6E, 0xBB4E, 0xBB4D, 0xC38E, 0xC38E, 0xCBCF, 0xCBF0, 0xCC51, 0xCC30, 0xD4D1, 0xD512, 0xD532, 0xDD73, 0xDD74, 0xDD74, 0xDD94, 0xDD94, 0xDD94, 0xDDD4, 0xDDF5, 0xE616, 0xEDF6, 0xD491, 0xAAAB, 0xAA2A, 0xC28B, 0xCAAB, 0xC28A, 0xCAAA, 0xC2AB, 0xBA8B, 0xBA6B, 0xBA4B, 0xB26A, 0xB22A, 0xBA2A, 0xCAAB, 0xDB4C, 0xE3AD, 0xE3AD, 0xDBAD, 0xDB8C, 0xDB8D, 0xDB8D, 0xDB8D, 0xE3AD, 0xEBCD, 0xDBAD, 0xD38C, 0xDB6C, 0xDB8C, 0xDB8C, 0xDB8C, 0xDB8C, 0xDB8C, 0xD38C, 0xDB8C, 0xDB6C, 0xDB8C, 0xDB8C, 0xDB8C, 0xD36C, 0xDC0D, 0xFE33, 0xFF35, 0xEDF3, 0x6124, 0x5045, 0x5867, 0x5888, 0x60C8, 0x60C8, 0x68C9, 0x60A8, 0x5867, 0x60A7, 0x58C7, 0x5086, 0x5887, 0x60C8, 0x5888,
+	0xF4AF, 0xF48D, 0xEC2C, 0xE38B, 0xBA49, 0x9126, 0xB208, 0xDB4B, 0xE40C, 0xEC6D, 0xEC6D, 0xEC6D, 0xEC6C, 0xEC0C, 0xE36B, 0xCA89, 0x9147, 0x9147, 0x99A9, 0xA1C9, 0xAA09, 0xAA2A, 0xAA0A, 0xAA09, 0xAA09, 0xB209, 0xBA4A, 0xBA4A, 0xBA6A, 0xC28A, 0xC28A, 0xC28A, 0xC2AB, 0xCAAB, 0xCAAB, 0xD2CB, 0xD2CA, 0xCACA, 0xCAEB, 0xD30B, 0xB229, 0xC2AB, 0xC2CB, 0xBACB, 0xC2EC, 0xB2CC, 0xC32D, 0xC34E, 0xBB2D, 0xC34D, 0xC36E, 0xBB4D, 0xC38E, 0xBBAE, 0xCC10, 0xD471, 0xD4F2, 0xD513, 0xD533, 0xD553, 0xD553, 0xDD73, 0xDD94, 0xDDB4, 0xDD94, 0xDDD4, 0xDDF5, 0xDE15, 0xDDD5, 0xF617, 0xED75, 0xB32C, 0xA229, 0xAA4A, 0xBA6A, 0xC26A, 0xBA8A, 0xBA8B, 0xBA6B, 0xB24B, 0xB24A, 0xB22A, 0xB22A, 0xCAAB, 0xDB4C, 0xEBAD, 0xEBCD, 0xE3CD, 0xDBAD, 0xDB8D, 0xD36D, 0xD36D, 0xD36D, 0xE38D, 0xE3CD, 0xDB8C, 0xDB6C, 0xDB8C, 0xE38C, 0xDB8C, 0xDB8C, 0xDB8C, 0xD38C, 0xDB8C, 0xDB8C, 0xDB8C, 0xDB8C, 0xE3AD, 0xE3AC, 0xD3AB, 0xF551, 0xED92, 0x79A6, 0x5064, 0x5888, 0x5868, 0x58A7, 0x60C7, 0x60C8, 0x60A8, 0x58A7, 0x60C7, 0x60C8, 0x5087, 0x50A7, 0x6108, 0x60E8, 0x4004,
+	0xF4AE, 0xF44D, 0xEBCC, 0xCAEA, 0xA187, 0x9127, 0xB229, 0xDB2B, 0xEC0C, 0xEC8E, 0xEC8E, 0xEC6D, 0xF46C, 0xEC0C, 0xE36B, 0xCA89, 0x9147, 0x8947, 0x99A9, 0xA1C9, 0xAA0A, 0xAA2A, 0xAA0A, 0xAA0A, 0xAA09, 0xAA09, 0xBA4A, 0xBA6A, 0xBA6A, 0xC28A, 0xC28A, 0xC28A, 0xC2AB, 0xCAAB, 0xCAAA, 0xD2AB, 0xD2AA, 0xCACA, 0xE36D, 0xBA69, 0xC2AA, 0xBA6A, 0xB26A, 0xBACB, 0xC2EC, 0xC30D, 0xC30D, 0xC32D, 0xC34D, 0xC36E, 0xC34E, 0xC34E, 0xC38E, 0xC3AE, 0xCBCF, 0xCC30, 0xCC91, 0xCCB1, 0xD4F2, 0xDD33, 0xDD73, 0xDD73, 0xDDB4, 0xE5B4, 0xE5B4, 0xE5B5, 0xDDF5, 0xDDF5, 0xDE15, 0xDDF6, 0xE617, 0xE616, 0xAB8E, 0x924A, 0xA229, 0xB24A, 0xBA4A, 0xBA4B, 0xB24B, 0xB24B, 0xB26B, 0xB22A, 0xB22A, 0xC2AB, 0xDB6D, 0xE3AD, 0xE3ED, 0xE3EE, 0xE3CD, 0xDB8D, 0xD34C, 0xD30C, 0xCAEB, 0xDB4C, 0xE3AD, 0xE38C, 0xDB8C, 0xDB8C, 0xE38C, 0xE38C, 0xDB8C, 0xDB8C, 0xDB8C, 0xDB8C, 0xDBAC, 0xDBAC, 0xDBAD, 0xE3AD, 0xE3AB, 0xEC0D, 0xD3CE, 0x7946, 0x5065, 0x5887, 0x5868, 0x60A9, 0x60C7, 0x60C7, 0x60A7, 0x5887, 0x60C8, 0x60E8, 0x58A7, 0x58A8, 0x6909, 0x6929, 0x4824, 0x6928,
+	0xF46D, 0xEC0D, 0xE36C, 0xB209, 0x9968, 0x9968, 0xB229, 0xDB4B, 0xE40C, 0xF48E, 0xF48E, 0xEC8D, 0xEC6C, 0xEC0C, 0xE36B, 0xCA69, 0x9147, 0x9147, 0x9989, 0xA1EA, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA09, 0xB229, 0xB229, 0xBA4A, 0xC26A, 0xC28B, 0xC28A, 0xC28A, 0xCAAB, 0xCAAB, 0xCAAB, 0xCAAA, 0xCAAA, 0xDB2C, 0xDB2C, 0xBA49, 0xBA4A, 0xB24A, 0xC2CB, 0xBA8B, 0xC2CC, 0xC30D, 0xBAEC, 0xC30D, 0xC32D, 0xC34D, 0xCB6E, 0xCB6E, 0xCB6E, 0xC38E, 0xCBCF, 0xCBEF, 0xCC71, 0xD4B2, 0xDD13, 0xDD53, 0xDD73, 0xDD73, 0xDD94, 0xDD94, 0xE5B5, 0xE5D6, 0xDDD5, 0xD5B5, 0xD5D5, 0xD5F5, 0xDE36, 0xE698, 0xFEBA, 0xF659, 0xAB2D, 0x91C8, 0xBA4A, 0xBA2A, 0xB22A, 0xAA4A, 0xB24A, 0xAA0A, 0xB20A, 0xC2AB, 0xDB6D, 0xE3AD, 0xEC0D, 0xE40E, 0xE3CD, 0xE3AD, 0xD32B, 0xC28A, 0xC28A, 0xCAEC, 0xDB6D, 0xEBAD, 0xE38C, 0xDB8C, 0xE3AC, 0xE38C, 0xDB6C, 0xDB8C, 0xDB6C, 0xDB8C, 0xDB8C, 0xDB8C, 0xE38D, 0xE3AC, 0xE3EC, 0xE40E, 0x91A8, 0x5826, 0x5888, 0x5068, 0x5888, 0x60C8, 0x60C7, 0x58A6, 0x5886, 0x58A8, 0x60E8, 0x58C8, 0x58A8, 0x6109, 0x714A, 0x5065, 0x60C5, 0xC3D0,
+	0xF42D, 0xE3AC, 0xCAAB, 0xA188, 0x9969, 0x9988, 0xB229, 0xDB4B, 0xEC0C, 0xEC6E, 0xEC8E, 0xEC8D, 0xEC6D, 0xEC0C, 0xE36B, 0xC269, 0x9968, 0x9147, 0xA1A9, 0xA1EA, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA2A, 0xB229, 0xB229, 0xBA6A, 0xBA6A, 0xC28A, 0xC28A, 0xCAAA, 0xCAAB, 0xCAAB, 0xCAAA, 0xCAAA, 0xD2CB, 0xD2EC, 0xC26A, 0xBA49, 0xBA4A, 0xC2AB, 0xC2AB, 0xBAAB, 0xC2CC, 0xC2EC, 0xC2EC, 0xC30C, 0xBB0C, 0xC32D, 0xC34D, 0xCB4D, 0xC34D, 0xCB8E, 0xC38E, 0xD3EF, 0xD450, 0xDCB2, 0xE533, 0xE574, 0xDD73, 0xDD73, 0xDD94, 0xE5B4, 0xDDB5, 0xD574, 0xDD95, 0xE5F6, 0xEE37, 0xEE78, 0xF6B9, 0xE698, 0xEEB9, 0xFF3C, 0xEE18, 0x8A08, 0x99C9, 0xB22A, 0xAA0A, 0xAA2A, 0xAA2A, 0xA9EA, 0xB22A, 0xC2AC, 0xDB4D, 0xE3CD, 0xE3ED, 0xE3EE, 0xE3EE, 0xE3AD, 0xDB2C, 0xBA49, 0xA1A8, 0xB24A, 0xD30C, 0xE38D, 0xE3AD, 0xDB6C, 0xE38C, 0xE38D, 0xDB6C, 0xDB8C, 0xDB8C, 0xE38C, 0xE38C, 0xE38C, 0xEB8D, 0xE3AD, 0xEC2E, 0xAAAA, 0x6065, 0x5868, 0x5867, 0x58A7, 0x60C7, 0x60C7, 0x60C7, 0x5886, 0x58A7, 0x60E9, 0x58C7, 0x50A7, 0x58C8, 0x716B, 0x6929, 0x60C5, 0xB32D, 0xDC71,
+	0xEBEC, 0xDB2B, 0xB1E8, 0x9968, 0x99A9, 0x9988, 0xB229, 0xDB4B, 0xEBEC, 0xEC6D, 0xEC6E, 0xEC6D, 0xEC6D, 0xEBEC, 0xE34B, 0xC269, 0x9988, 0x9148, 0xA1A9, 0xA1EA, 0xAA0A, 0xAA0A, 0xAA0A, 0xB22A, 0xAA2A, 0xAA29, 0xB229, 0xBA6A, 0xBA8A, 0xC28A, 0xC2AA, 0xC2AA, 0xCAAB, 0xCAAB, 0xCACB, 0xCACB, 0xD2EB, 0xC26A, 0xBA29, 0xBA6A, 0xBA8B, 0xC2AB, 0xC2AB, 0xC2CC, 0xBACC, 0xBAAB, 0xBACC, 0xC30C, 0xC32D, 0xCB4D, 0xCB4E, 0xCB4D, 0xCB4D, 0xCB6E, 0xCB8E, 0xD3CF, 0xD450, 0xDCB1, 0xE513, 0xE534, 0xE574, 0xE5B5, 0xDD73, 0xCD32, 0xCD74, 0xDDF6, 0xEE58, 0xEE58, 0xF658, 0xEE57, 0xEE57, 0xEE78, 0xE678, 0xEEB9, 0xFF1B, 0xCCD3, 0x8187, 0x99C9, 0xAA0A, 0xA22A, 0xA22A, 0xA1EA, 0xAA0A, 0xC2AB, 0xDB4C, 0xE3CD, 0xE3ED, 0xE3ED, 0xE3EE, 0xE3AD, 0xDB4C, 0xB24A, 0x80E6, 0x8968, 0xC2AC, 0xDB4D, 0xE3AD, 0xE38C, 0xDB8C, 0xE38D, 0xDB6C, 0xDB6C, 0xDB6C, 0xE38C, 0xE36C, 0xEB6C, 0xEB8D, 0xEBEF, 0xC34D, 0x6084, 0x5046, 0x5047, 0x58A7, 0x60C7, 0x60C7, 0x60E7, 0x5886, 0x5887, 0x60E8, 0x58A8, 0x50A7, 0x58E8, 0x694A, 0x716A, 0x7148, 0xAAED, 0xCC10, 0xD3EF,
+	0xE36C, 0xBA49, 0x9967, 0xA1A9, 0x99C9, 0x99A7, 0xB228, 0xDB2B, 0xEBEC, 0xEC6D, 0xEC6E, 0xEC6D, 0xEC6D, 0xEBEC, 0xE34B, 0xC269, 0x9968, 0x9168, 0xA1C9, 0xA1E9, 0xA9E9, 0xAA0A, 0xB22A, 0xB22A, 0xAA09, 0xAA29, 0xB229, 0xB24A, 0xBA6A, 0xC28B, 0xC28A, 0xCAAB, 0xCACB, 0xCAAA, 0xC2AA, 0xCAEB, 0xC28A, 0xBA49, 0xBA4A, 0xC26A, 0xBA8B, 0xC2AB, 0xC2AC, 0xBAAB, 0xBA8B, 0xBAAB, 0xC2EC, 0xC30C, 0xC32D, 0xCB6D, 0xC34D, 0xCB6D, 0xD38E, 0xCBAE, 0xD3AE, 0xD3CE, 0xCC2F, 0xD490, 0xDCF2, 0xE533, 0xDD33, 0xCCF2, 0xCCF2, 0xE5B5, 0xF678, 0xEE78, 0xEE57, 0xE637, 0xE657, 0xE657, 0xE637, 0xEE57, 0xEE57, 0xE678, 0xEED9, 0xFF1B, 0xB3CF, 0x8147, 0xA1CA, 0xA1EA, 0xA20A, 0xA1EA, 0xA9EA, 0xC28B, 0xDB4D, 0xEBCE, 0xEC0E, 0xE3ED, 0xDBED, 0xE3CD, 0xDB6D, 0xBA6B, 0x78C7, 0x6886, 0xA20A, 0xCAEC, 0xE38C, 0xE3AD, 0xDB8C, 0xE38C, 0xDB6C, 0xDB6C, 0xDB6C, 0xE38C, 0xDB6D, 0xE38C, 0xEBCD, 0xE3AE, 0x8148, 0x5887, 0x5887, 0x5887, 0x60C8, 0x60C7, 0x68E8, 0x60C7, 0x5887, 0x60E9, 0x58C8, 0x5887, 0x58C8, 0x692A, 0x716A, 0x7989, 0xA2CD, 0xD411, 0xCBCE, 0xCB8D,
+	0xCACA, 0xA9A7, 0xA188, 0xA9C9, 0x99A8, 0x99A7, 0xB228, 0xDB2B, 0xEBEC, 0xEC6D, 0xEC6E, 0xEC6D, 0xEC4D, 0xEBEC, 0xE34B, 0xC249, 0x9988, 0x9167, 0xA1C9, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA09, 0xB229, 0xB229, 0xB24A, 0xBA8A, 0xC28A, 0xC2AA, 0xC2AA, 0xCAAA, 0xCACB, 0xCAEB, 0xC2AA, 0xB249, 0xBA6A, 0xBA8B, 0xBA6B, 0xC2AB, 0xC2AB, 0xBA8B, 0xBA8A, 0xB28A, 0xC2EC, 0xC32D, 0xC30C, 0xCB6D, 0xCB6E, 0xCB8E, 0xD38E, 0xD3AE, 0xCB8E, 0xCB8E, 0xCB8E, 0xD40F, 0xDC91, 0xE513, 0xD4D1, 0xC490, 0xDD53, 0xEE17, 0xEE17, 0xEE37, 0xEE58, 0xEE58, 0xE637, 0xDE17, 0xDE37, 0xE637, 0xEE78, 0xF657, 0xEE98, 0xE6D9, 0xF71A, 0xFE99, 0x9A6B, 0x8106, 0x9189, 0x99C9, 0x99C9, 0xA9E9, 0xC2AB, 0xDB4D, 0xE3CD, 0xE3EE, 0xE3ED, 0xDBED, 0xE3CD, 0xDB6D, 0xBA8C, 0x70E8, 0x5845, 0x8969, 0xBA8B, 0xD34C, 0xE3AD, 0xE3AD, 0xE38D, 0xDB6C, 0xE36C, 0xDB6C, 0xE38D, 0xDB8D, 0xE3AD, 0xEC0E, 0xAA29, 0x5825, 0x58A9, 0x5888, 0x60A6, 0x60C8, 0x60C8, 0x60A7, 0x5867, 0x60C8, 0x60E8, 0x58A7, 0x58C7, 0x58C8, 0x694A, 0x79AA, 0xA2CD, 0xC3D0, 0xCBEF, 0xCBAD, 0xD40E,
+	0xA9E9, 0x9988, 0xA1A8, 0xA1C9, 0xA1C9, 0x9987, 0xB228, 0xDB2B, 0xE3EC, 0xEC4D, 0xEC6E, 0xEC6E, 0xEC6D, 0xEC0D, 0xDB6B, 0xC289, 0x9988, 0x9148, 0xA1C9, 0xA1EA, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA29, 0xB229, 0xB229, 0xBA4A, 0xC28A, 0xC2AA, 0xC2AA, 0xC2AA, 0xCAAB, 0xCACA, 0xD2EB, 0xC26A, 0xBA8A, 0xBA6B, 0xBA8A, 0xC28A, 0xC2AB, 0xBA8B, 0xBAAB, 0xBAAB, 0xBACB, 0xC30C, 0xC30C, 0xC32D, 0xCB4D, 0xCB2D, 0xCB6E, 0xD3AE, 0xD3AE, 0xCB6D, 0xCB8E, 0xD3AE, 0xD410, 0xE4B2, 0xC40F, 0xC470, 0xDD95, 0xEE37, 0xE636, 0xEE37, 0xEE17, 0xEE17, 0xE5F7, 0xE5F6, 0xE617, 0xE617, 0xE637, 0xE637, 0xEE36, 0xE657, 0xE677, 0xE698, 0xF6FA, 0xEE18, 0xA3AE, 0x7186, 0x9948, 0x99A9, 0x99E9, 0xC2AB, 0xDB2C, 0xE3CD, 0xE3EE, 0xE3EE, 0xDBED, 0xEBCD, 0xE34D, 0xBA6C, 0x70E7, 0x5866, 0x70E7, 0xA1EA, 0xCAEC, 0xDB6D, 0xEBAD, 0xE38C, 0xE36C, 0xDB4C, 0xE36D, 0xEB8C, 0xE3AB, 0xF3EE, 0xD30E, 0x68A6, 0x4845, 0x4886, 0x60A7, 0x70C8, 0x60C8, 0x60C8, 0x5866, 0x60A7, 0x68E8, 0x5887, 0x60C8, 0x60E9, 0x610A, 0x6929, 0x9AAC, 0xCBD0, 0xCC10, 0xC3AE, 0xD42F, 0xDC8F,
+	0x99A9, 0xA1A9, 0xA1A9, 0xA1C9, 0xA1C9, 0x99A8, 0xB229, 0xD30B, 0xE3EC, 0xEC4D, 0xEC6E, 0xEC6E, 0xEC4D, 0xEC0C, 0xDB6B, 0xC289, 0x9988, 0x8947, 0x99A9, 0xA1E9, 0xAA09, 0xAA0A, 0xAA0A, 0xAA0A, 0xAA29, 0xB229, 0xB229, 0xBA6A, 0xBA6A, 0xC28A, 0xC2AA, 0xC2AA, 0xCAAA, 0xD2EB, 0xCAAB, 0xBA29, 0xBA6A, 0xBA8B, 0xBA6A, 0xBA6A, 0xBA8B, 0xBA8B, 0xC2CC, 0xBACC, 0xC30C, 0xC32D, 0xC32C, 0xCB6D, 0xCB8E, 0xCB6D, 0xCB8E, 0xCB6E, 0xCB4D, 0xC34D, 0xCB6E, 0xCB8F, 0xC3CE, 0xC3EE, 0xD4B2, 0xEDD6, 0xE5D5, 0xE5F5, 0xE5F6, 0xE5F6, 0xE5F6, 0xE5F6, 0xE5F6, 0xE5D6, 0xE617, 0xE637, 0xE637, 0xEE37, 0xE657, 0xE657, 0xEE98, 0xE698, 0xE698, 0xF6DA, 0xFF1B, 0xBC51, 0x8106, 0x8968, 0xA1C9, 0xC26B, 0xDB2C, 0xE3CD, 0xE3ED, 0xE3EE, 0xDBED, 0xEBCE, 0xE34D, 0xBA6B, 0x7908, 0x5865, 0x5845, 0x80E7, 0xB24A, 0xD32C, 0xE38C, 0xE3AC, 0xDB6C, 0xDB6C, 0xE38C, 0xE38C, 0xEBCD, 0xE3AE, 0x8928, 0x5025, 0x5086, 0x50A7, 0x60C8, 0x68C8, 0x60E8, 0x58A7, 0x5887, 0x68E8, 0x58A7, 0x58A7, 0x60C9, 0x60C9, 0x60E9, 0x8A2C, 0xBBB0, 0xCBCF, 0xC3CE, 0xCC0F, 0xDC90, 0xD490,
+	0x99A9, 0xA1C9, 0xA1C9, 0xA1EA, 0xA1C9, 0x99C8, 0xB249, 0xD32C, 0xE3CC, 0xEC4D, 0xEC4E, 0xEC6E, 0xEC4E, 0xEC0D, 0xDB6C, 0xC269, 0x9988, 0x9148, 0x99A9, 0xA1E9, 0xA9E9, 0xAA2A, 0xAA2A, 0xAA0A, 0xAA09, 0xAA2A, 0xB22A, 0xBA4A, 0xBA6A, 0xC28A, 0xCAAB, 0xC28A, 0xC2EA, 0xDB8D, 0xB228, 0xB249, 0xB249, 0xBAAB, 0xBA8A, 0xBA6A, 0xBA8B, 0xBA6B, 0xC2AB, 0xC2EC, 0xCB2D, 0xC32D, 0xD38E, 0xD3AE, 0xC36D, 0xCB8E, 0xCB8E, 0xCB6E, 0xCB4D, 0xCB4E, 0xCB4E, 0xC32D, 0xC3EE, 0xD4D2, 0xED95, 0xEDF6, 0xE5D5, 0xDDB5, 0xDDB5, 0xDDB5, 0xDDB5, 0xDDD6, 0xE617, 0xE637, 0xE637, 0xE637, 0xE657, 0xE657, 0xE657, 0xEE57, 0xEE77, 0xE657, 0xEE78, 0xEE78, 0xF699, 0xFEFA, 0x92EC, 0x70C5, 0xA189, 0xC26B, 0xD34C, 0xE3AD, 0xEBED, 0xE3EE, 0xDBEE, 0xE3CD, 0xE34C, 0xC28B, 0x7927, 0x5866, 0x6066, 0x6846, 0xA128, 0xCA8B, 0xDB4C, 0xE38C, 0xDB6B, 0xDB2B, 0xE34C, 0xEB8D, 0xF3F0, 0xAA4A, 0x5844, 0x5866, 0x5887, 0x60A7, 0x68C8, 0x60C7, 0x60C7, 0x5887, 0x60E8, 0x58A7, 0x5887, 0x60C8, 0x60E8, 0x58A7, 0x79AA, 0xC3B0, 0xCBF0, 0xC38D, 0xCBCE, 0xDC70, 0xDC90, 0xD4B0,
+	0x99C9, 0xA1C9, 0xA1C9, 0xA1C9, 0x99C9, 0x99A8, 0xB229, 0xD32B, 0xE3CC, 0xEC4E, 0xEC4E, 0xEC4E, 0xEC4E, 0xEC0D, 0xDB6C, 0xC26A, 0x9988, 0x9168, 0x99A9, 0xA1C9, 0xA9E9, 0xAA0A, 0xAA2A, 0xAA0A, 0xAA0A, 0xAA2A, 0xB22A, 0xBA4A, 0xC28B, 0xC28A, 0xC28A, 0xB228, 0xDBED, 0xDBCE, 0xA9E8, 0xBA4A, 0xBA6A, 0xBA6A, 0xBA6A, 0xC28A, 0xC28B, 0xC28B, 0xC2CC, 0xC2EC, 0xC30C, 0xCB6D, 0xCB6D, 0xC34D, 0xC34C, 0xCB8E, 0xCB8E, 0xCB4E, 0xC32E, 0xB2CC, 0xBB0C, 0xD3F0, 0xED74, 0xEDB5, 0xDD74, 0xE5B4, 0xE5B5, 0xDDB5, 0xDD94, 0xDD95, 0xDDB5, 0xDDF6, 0xE637, 0xE637, 0xE637, 0xE637, 0xE637, 0xE657, 0xE657, 0xE657, 0xE637, 0xE637, 0xEE57, 0xEE98, 0xEEB8, 0xF71A, 0xDE17, 0x81A8, 0x9106, 0xBA4A, 0xD34C, 0xE3AD, 0xEBCD, 0xE3ED, 0xE3EE, 0xE3CD, 0xDB4C, 0xC28B, 0x8128, 0x5866, 0x5867, 0x5826, 0x7866, 0x99A9, 0xBA8A, 0xD38C, 0xE40E, 0xD38D, 0xD36D, 0xE3CF, 0xCB0E, 0x68A6, 0x5086, 0x5887, 0x60A8, 0x68C8, 0x60C7, 0x60E8, 0x58C7, 0x58A7, 0x60E8, 0x58A7, 0x60E9, 0x60C8, 0x5066, 0x6929, 0xB34F, 0xCC11, 0xC38D, 0xC3AE, 0xD450, 0xD490, 0xD490, 0xD490,
+	0x99E9, 0xA1C9, 0xA1C9, 0xA1C9, 0xA1C9, 0x9987, 0xAA08, 0xD32B, 0xE3CC, 0xEC4E, 0xEC4E, 0xEC6E, 0xEC6E, 0xEC2E, 0xE36C, 0xC28A, 0x9989, 0x9148, 0x9989, 0xA1C9, 0xA1E9, 0xAA09, 0xAA0A, 0xAA2A, 0xAA2A, 0xB24A, 0xBA4A, 0xBA4A, 0xC26A, 0xC28A, 0xBA6A, 0xB269, 0xF511, 0xC30B, 0xAA09, 0xB22A, 0xB24A, 0xBA6A, 0xBA6A, 0xC26A, 0xC28B, 0xC2AB, 0xCACC, 0xCB0C, 0xCB2D, 0xCB6D, 0xCB6D, 0xC34D, 0xCB4D, 0xD36E, 0xCB2D, 0xC30D, 0xB2CC, 0xB30C, 0xDC92, 0xED75, 0xE574, 0xE574, 0xE594, 0xDD74, 0xD553, 0xDD53, 0xE5B5, 0xEDD5, 0xE5F6, 0xE5F6, 0xE5F6, 0xE637, 0xE637, 0xE617, 0xE637, 0xE637, 0xDE37, 0xDE17, 0xE658, 0xEE58, 0xE657, 0xEE77, 0xE698, 0xE6D9, 0xFF9C, 0xC431, 0x78A5, 0xBA6A, 0xD34C, 0xE3AD, 0xEBCD, 0xE3ED, 0xE3EE, 0xEBCD, 0xDB6C, 0xBA8A, 0x8128, 0x5887, 0x5887, 0x5887, 0x4044, 0x58E5, 0xC450, 0xF616, 0xF636, 0xE594, 0xEDB5, 0xDD13, 0x7948, 0x5045, 0x50A8, 0x58A8, 0x68C9, 0x68A8, 0x60C7, 0x6108, 0x58C8, 0x60E8, 0x58A7, 0x60C8, 0x60C8, 0x5887, 0x60A7, 0xA2CD, 0xD3F1, 0xCBAF, 0xC38D, 0xD42F, 0xD470, 0xD470, 0xD46F, 0xD46F,
+	0x99C9, 0x99C9, 0xA1A8, 0xA1A9, 0xA1C9, 0x9987, 0xAA08, 0xD30B, 0xEBEC, 0xEC4D, 0xEC4E, 0xE44E, 0xEC4D, 0xEC0D, 0xDB6C, 0xC26A, 0x9968, 0x8927, 0x9988, 0xA1A8, 0xA1C9, 0xA9E9, 0xA9E9, 0xA9E9, 0xAA0A, 0xB22A, 0xB22A, 0xBA4A, 0xBA4A, 0xBA6A, 0xAA29, 0xC32C, 0xFD72, 0xB288, 0xB209, 0xB22A, 0xBA4A, 0xBA8A, 0xBA6A, 0xC26B, 0xC2AB, 0xC2AB, 0xCAEC, 0xD32D, 0xD34D, 0xCB2D, 0xCB4D, 0xCB2D, 0xD34D, 0xCB2D, 0xB28B, 0xAAAB, 0xBB6E, 0xDCD3, 0xE534, 0xE594, 0xDD32, 0xDD12, 0xE573, 0xDD53, 0xDD73, 0xDD74, 0xE595, 0xE5D5, 0xE5D6, 0xE5D6, 0xE5F6, 0xE5F6, 0xE616, 0xDDF6, 0xDDF6, 0xE637, 0xE657, 0xE657, 0xE637, 0xEE58, 0xE657, 0xE678, 0xE678, 0xE698, 0xEF1A, 0xEDF8, 0x7946, 0xA209, 0xD34C, 0xE3AD, 0xEBCD, 0xE3ED, 0xE3ED, 0xE3ED, 0xDB6C, 0xBA8B, 0x8128, 0x5886, 0x50A7, 0x4044, 0x5106, 0xCD15, 0xF699, 0xDE16, 0xE657, 0xF6B9, 0xFEFA, 0xFEDA, 0x71CA, 0x4845, 0x50A8, 0x60C8, 0x60C8, 0x60A7, 0x68E8, 0x58A8, 0x60C8, 0x60C7, 0x58C7, 0x60E8, 0x58A8, 0x5046, 0x922C, 0xCC11, 0xCBCF, 0xC3AE, 0xD42F, 0xDC90, 0xD470, 0xD470, 0xD46F, 0xD46F,
+	0x99C9, 0xA1C9, 0xA1C9, 0xA1C9, 0xA1C9, 0xA188, 0xB208, 0xD30B, 0xE3CC, 0xEC4D, 0xEC6E, 0xEC6E, 0xEC4D, 0xEC0C, 0xDB6C, 0xC269, 0x9148, 0x8907, 0x9968, 0xA1C8, 0xA1C9, 0xA9E9, 0xAA09, 0xAA09, 0xAA09, 0xB209, 0xB22A, 0xBA2A, 0xBA4A, 0xBA8A, 0xA208, 0xDC50, 0xF531, 0xBAA9, 0xB1E9, 0xBA2B, 0xBA4A, 0xC28A, 0xC28A, 0xC28B, 0xC2AB, 0xC2CB, 0xCB2D, 0xCB0C, 0xC2EC, 0xC2CB, 0xCB2C, 0xD34D, 0xCB2D, 0xBAAB, 0xAAAB, 0xC3CF, 0xE513, 0xE534, 0xD4D1, 0xDCF1, 0xE533, 0xDD12, 0xD4F2, 0xDD33, 0xE594, 0xDD74, 0xE595, 0xE5B5, 0xE5D5, 0xE5D6, 0xDDB5, 0xDD95, 0xDDB5, 0xE617, 0xE617, 0xEE37, 0xE637, 0xE637, 0xDE37, 0xE637, 0xE657, 0xDE57, 0xE657, 0xE658, 0xE6B9, 0xFF1C, 0xB3AF, 0x9187, 0xD32C, 0xE3AD, 0xE3ED, 0xE3ED, 0xEBED, 0xEBED, 0xDB6C, 0xB26B, 0x7908, 0x5066, 0x3824, 0x6A0A, 0xEDB8, 0xEE18, 0xD595, 0xEE78, 0xF6D9, 0xF6DA, 0xF6D9, 0xFF7C, 0xABF2, 0x4045, 0x50A7, 0x58C8, 0x60E8, 0x60C8, 0x58A7, 0x60A8, 0x58A8, 0x5887, 0x60E7, 0x60E8, 0x5888, 0x796A, 0xC390, 0xD40F, 0xC3AE, 0xCC0F, 0xDC70, 0xDC70, 0xD450, 0xD44F, 0xD44F, 0xD44E,
+	0x99C9, 0xA1C9, 0xA1C9, 0xA9EA, 0xA9C9, 0xA1A8, 0xB1E8, 0xD2EB, 0xE3CC, 0xEC4D, 0xEC6E, 0xEC6E, 0xEC6D, 0xEC0D, 0xE36B, 0xC269, 0x9168, 0x9128, 0x9168, 0xA1C9, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xB20A, 0xBA0A, 0xBA2A, 0xBA6A, 0xBA8A, 0xAA49, 0xF553, 0xF4AF, 0xB227, 0xB209, 0xBA2A, 0xBA4A, 0xBA69, 0xBA49, 0xC26C, 0xC2CB, 0xCB2D, 0xCAEC, 0xC2AB, 0xC2CB, 0xCB0C, 0xCB0C, 0xCB0C, 0xB28A, 0xB2AA, 0xD410, 0xED14, 0xDCF2, 0xD4B1, 0xDCB1, 0xDCD1, 0xDCF2, 0xE513, 0xE553, 0xDD12, 0xE574, 0xE5B5, 0xDD74, 0xDD94, 0xE5B5, 0xDD95, 0xDD94, 0xE5D6, 0xE5F6, 0xE5F6, 0xDDD6, 0xE5F6, 0xE616, 0xDE16, 0xE637, 0xE657, 0xE658, 0xE658, 0xEE58, 0xE638, 0xE658, 0xEEDA, 0xEE58, 0x9A4A, 0xC2AB, 0xEBCD, 0xE3ED, 0xEC0D, 0xF3ED, 0xEBCD, 0xD34D, 0xAA6B, 0x6086, 0x4004, 0x932F, 0xEE59, 0xDD95, 0xD573, 0xF6B8, 0xEEB8, 0xE678, 0xE678, 0xE677, 0xFF5A, 0xC536, 0x4066, 0x5887, 0x58A7, 0x58E8, 0x58E7, 0x58A7, 0x6088, 0x5867, 0x58A7, 0x60E8, 0x58A7, 0x60C8, 0xAAF0, 0xD432, 0xCBCE, 0xCBCE, 0xDC50, 0xD44F, 0xD44F, 0xD450, 0xD44F, 0xD44F, 0xD44E,
+	0xA1E9, 0xA1E9, 0xAA09, 0xAA09, 0xA9E9, 0xA9C8, 0xB208, 0xD2EB, 0xE3CC, 0xEC4D, 0xEC8E, 0xEC8E, 0xEC6D, 0xEC2D, 0xE36B, 0xC269, 0x9968, 0x9147, 0x9988, 0xA9C9, 0xA9E9, 0xAA09, 0xB209, 0xB229, 0xAA29, 0xBA09, 0xBA29, 0xBA29, 0xBA8A, 0xB26B, 0xBA69, 0xFDD3, 0xF46E, 0xB228, 0xAA09, 0xB24B, 0xB22A, 0xB209, 0xC28B, 0xCACC, 0xCAEC, 0xC2EC, 0xC2AB, 0xBAAB, 0xD32D, 0xD32D, 0xCB0D, 0xBAAB, 0xB2AA, 0xDC30, 0xE4B2, 0xDC91, 0xDC91, 0xD491, 0xDCB1, 0xE4F3, 0xE533, 0xDCF2, 0xDD33, 0xE594, 0xE554, 0xDD54, 0xE575, 0xDD53, 0xD513, 0xDD74, 0xE5B5, 0xEDF6, 0xE5F6, 0xE5D6, 0xE5D6, 0xDDD6, 0xEE16, 0xE616, 0xE5F6, 0xDDF6, 0xDE16, 0xE617, 0xE637, 0xE637, 0xE657, 0xDE78, 0xEEDA, 0xDD34, 0xC32C, 0xE36D, 0xEBED, 0xE40C, 0xF3CB, 0xEBAC, 0xCB2C, 0x81A7, 0x6947, 0xBC72, 0xF679, 0xD594, 0xD5B4, 0xF6B9, 0xEE98, 0xE657, 0xE617, 0xE637, 0xEE78, 0xFF3B, 0xCD55, 0x3865, 0x58A9, 0x60C9, 0x60C7, 0x5886, 0x5887, 0x5887, 0x6087, 0x58C8, 0x50C8, 0x4866, 0x89EB, 0xD411, 0xD3EF, 0xCBCE, 0xD44F, 0xD450, 0xD44F, 0xD44F, 0xD42F, 0xD44F, 0xD42F, 0xD44F,
+	0xA9E9, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xA9C8, 0xB208, 0xD30A, 0xE3CC, 0xEC4D, 0xEC6E, 0xEC8E, 0xEC8D, 0xEC4D, 0xE38C, 0xC289, 0x9988, 0x9147, 0xA1A8, 0xA9E9, 0xAA0A, 0xB209, 0xB229, 0xB229, 0xB229, 0xBA09, 0xBA4A, 0xC249, 0xBAAA, 0xB24A, 0xCACB, 0xFE33, 0xDBAC, 0xB228, 0xA9E9, 0xAA0A, 0xB22A, 0xC28B, 0xC26A, 0xC28B, 0xC2AB, 0xC28B, 0xCACC, 0xCB0D, 0xCAEC, 0xCAEC, 0xBA8B, 0xB28A, 0xE410, 0xE450, 0xDC30, 0xD40F, 0xDC71, 0xD491, 0xDCB2, 0xE513, 0xE533, 0xE553, 0xDD13, 0xDD33, 0xDD54, 0xDD34, 0xDD13, 0xD4F3, 0xDD54, 0xE595, 0xDD54, 0xE5B5, 0xE5D5, 0xDDD5, 0xE5F6, 0xE5F6, 0xEDF6, 0xE5D5, 0xC512, 0xD5B5, 0xDE16, 0xE617, 0xE637, 0xE617, 0xE617, 0xDE17, 0xDE78, 0xF6B9, 0xF5B6, 0xD3AD, 0xE3CD, 0xEBEC, 0xEBEC, 0xD38C, 0xAAEA, 0xB3AE, 0xEDF7, 0xEE58, 0xCD74, 0xE636, 0xF6B8, 0xEE57, 0xE657, 0xE616, 0xE617, 0xEE58, 0xF698, 0xFF3B, 0xBCD4, 0x4065, 0x58A8, 0x60A9, 0x68E8, 0x60C6, 0x5886, 0x6087, 0x68C8, 0x60C8, 0x4026, 0x60E7, 0xC390, 0xD410, 0xCBCE, 0xD42F, 0xDC70, 0xD44F, 0xD44F, 0xD44F, 0xD42F, 0xD42F, 0xD42F, 0xD42F,
+	0xAA0A, 0xAA09, 0xAA29, 0xAA09, 0xAA09, 0xA9C8, 0xBA28, 0xDB0A, 0xE3CB, 0xEC2D, 0xEC6E, 0xECAE, 0xECAE, 0xEC4E, 0xE38C, 0xC289, 0x9968, 0x9147, 0xA1A8, 0xA1E9, 0xAA09, 0xB209, 0xB209, 0xB229, 0xB209, 0xB1E9, 0xBA2A, 0xBA49, 0xBA8A, 0xAA09, 0xD38D, 0xFDF2, 0xCB2A, 0xC26A, 0xA9E9, 0xB22A, 0xB24A, 0xB229, 0xB24A, 0xC28B, 0xC26B, 0xCACC, 0xCAED, 0xC2CB, 0xC2CB, 0xB28A, 0xBACB, 0xE3F0, 0xE430, 0xD3CF, 0xD3CF, 0xD3EF, 0xCC0F, 0xE4D2, 0xE4F2, 0xE4F2, 0xDD12, 0xDCF2, 0xDD13, 0xDD13, 0xDD33, 0xD4F2, 0xD4D2, 0xE554, 0xDD54, 0xDD54, 0xE574, 0xDD74, 0xDD74, 0xE5B5, 0xE5F6, 0xEE17, 0xE5B5, 0xCD12, 0xD574, 0xDDD6, 0xDDF6, 0xDE16, 0xDE17, 0xE617, 0xE5F7, 0xDDD7, 0xDE17, 0xDE37, 0xF698, 0xDCF1, 0xDBCD, 0xEBAC, 0xCBAC, 0xD44F, 0xED94, 0xF637, 0xDDB6, 0xD5B5, 0xE678, 0xEE98, 0xE636, 0xE616, 0xE617, 0xE617, 0xEE57, 0xF678, 0xEEB8, 0xFF3A, 0xA3F1, 0x4045, 0x58C9, 0x5888, 0x60C7, 0x60C7, 0x5887, 0x5888, 0x60A8, 0x5888, 0x5066, 0x9A6D, 0xDC11, 0xD3CF, 0xCBEF, 0xDC70, 0xD450, 0xD44F, 0xD44F, 0xD42F, 0xD44F, 0xD42F, 0xD42F, 0xD42F,
+	0xAA0A, 0xAA09, 0xAA09, 0xAA09, 0xB1E9, 0xB1E8, 0xC249, 0xDB0A, 0xE3CC, 0xEC4D, 0xEC8E, 0xECAE, 0xF4AE, 0xF46E, 0xE3AC, 0xC28A, 0x9968, 0x9167, 0xA1C8, 0xA9E9, 0xAA09, 0xB209, 0xB209, 0xB209, 0xB209, 0xB209, 0xB229, 0xBA49, 0xBA4A, 0xA1C8, 0xDC4F, 0xF5B0, 0xD36B, 0xC28A, 0xB22A, 0xBA2A, 0xB22A, 0xB209, 0xBA4A, 0xBA4A, 0xC28B, 0xCACC, 0xBA8B, 0xC2CC, 0xBAAA, 0xCB2D, 0xDBCF, 0xD3CF, 0xD3CF, 0xDBCF, 0xD38E, 0xCBEF, 0xDC71, 0xDC91, 0xE4F3, 0xDCD2, 0xD4B1, 0xD4B1, 0xE513, 0xE513, 0xCC70, 0xDD12, 0xDD13, 0xDCD2, 0xE533, 0xDD13, 0xDD13, 0xDD33, 0xDD53, 0xE595, 0xDD54, 0xD554, 0xD533, 0xDD74, 0xDD95, 0xD595, 0xDDB5, 0xDDF6, 0xDDD6, 0xDDB6, 0xDDB6, 0xE5F7, 0xD596, 0xCDB6, 0xD616, 0xE5B4, 0xCBED, 0xE3EE, 0xE512, 0xF616, 0xE5F5, 0xD594, 0xDE15, 0xEE97, 0xE657, 0xDE37, 0xDE17, 0xE637, 0xEE37, 0xE637, 0xE657, 0xE697, 0xEED8, 0xFF3A, 0x82CD, 0x4866, 0x60E9, 0x60A8, 0x60A8, 0x5886, 0x5866, 0x60A8, 0x60A8, 0x68C8, 0x898A, 0xCB90, 0xD3CF, 0xCBCE, 0xD430, 0xDC70, 0xDC70, 0xD44F, 0xD42F, 0xD44F, 0xD42F, 0xD42F, 0xD42F, 0xD40F,
+	0xAA09, 0xAA09, 0xAA29, 0xAA09, 0xB209, 0xB1E8, 0xC249, 0xDB0A, 0xEBEC, 0xEC6E, 0xECAE, 0xECCE, 0xF4CE, 0xF48E, 0xE3AC, 0xC289, 0x9968, 0x9167, 0xA1C9, 0xA1C9, 0xA9E9, 0xB209, 0xB209, 0xB1E8, 0xB208, 0xB209, 0xB229, 0xB229, 0xBA29, 0xA1C7, 0xED32, 0xFD90, 0xDB8B, 0xC2AA, 0xB229, 0xB22A, 0xBA4A, 0xBA49, 0xBA6A, 0xC28B, 0xCAAB, 0xC28B, 0xCAEC, 0xC2AB, 0xC30C, 0xDBCF, 0xDBF0, 0xCB8E, 0xD3AE, 0xCB6D, 0xCB8E, 0xDC30, 0xDC70, 0xDC71, 0xD450, 0xDCB2, 0xE4F3, 0xDCF2, 0xD491, 0xD471, 0xE4F2, 0xDCF2, 0xDCF2, 0xE512, 0xDCF2, 0xDCF2, 0xDD13, 0xE554, 0xE595, 0xD533, 0xD512, 0xDD54, 0xE595, 0xD534, 0xDD94, 0xDDB5, 0xDDB6, 0xDDB6, 0xDD95, 0xD595, 0xD5B5, 0xDD95, 0xDD75, 0xD575, 0xCD94, 0xDDD5, 0xE533, 0xFDB5, 0xEDF6, 0xDD95, 0xE5F5, 0xEE56, 0xEE77, 0xE636, 0xE616, 0xDE16, 0xDE37, 0xE637, 0xEE37, 0xE5F6, 0xE636, 0xE698, 0xEED8, 0xF6FA, 0x69CA, 0x4866, 0x60C8, 0x60A8, 0x60A8, 0x5887, 0x5887, 0x60A8, 0x68C9, 0x7949, 0xB2CE, 0xDBF0, 0xCBCE, 0xD3EF, 0xDC70, 0xD470, 0xD44F, 0xD44F, 0xD42F, 0xD42F, 0xD42F, 0xD42F, 0xD42F, 0xD42F,
+	0xAA0A, 0xAA09, 0xAA09, 0xAA09, 0xA9E9, 0xB209, 0xC249, 0xD2EA, 0xE3EC, 0xEC6D, 0xECAE, 0xECCE, 0xF4CE, 0xF46E, 0xE3AC, 0xC289, 0x9988, 0x8947, 0xA1A8, 0xA9E9, 0xA9E9, 0xB209, 0xA9E9, 0xA9E8, 0xB1E8, 0xAA09, 0xB209, 0xBA49, 0xBA09, 0xA208, 0xF5D3, 0xFD8F, 0xE3CC, 0xCB0B, 0xC2AA, 0xBA6A, 0xBA29, 0xBA4A, 0xC26A, 0xC26A, 0xC2AC, 0xCAEC, 0xC2AB, 0xBAAB, 0xDBAF, 0xD38F, 0xD38E, 0xD3CF, 0xC32D, 0xCBAE, 0xD3CF, 0xDC30, 0xD40F, 0xD40F, 0xDC92, 0xE4B2, 0xE4D2, 0xD491, 0xD470, 0xE4F2, 0xE4F2, 0xDCD2, 0xDCF2, 0xDCF2, 0xE4F3, 0xDCB2, 0xDCF2, 0xE533, 0xDD34, 0xE554, 0xDD53, 0xDD33, 0xDD54, 0xE595, 0xDD95, 0xDD95, 0xDD95, 0xD554, 0xD513, 0xDD74, 0xD594, 0xD554, 0xD513, 0xCCB2, 0xDD74, 0xE5F5, 0xDDB5, 0xE5B4, 0xE5D6, 0xEE37, 0xEE57, 0xE616, 0xE616, 0xE616, 0xE5F6, 0xE617, 0xDE37, 0xEE37, 0xEDF6, 0xDD94, 0xEE36, 0xEE97, 0xF6F9, 0xE5F7, 0x48C7, 0x5086, 0x5887, 0x60A8, 0x58A7, 0x5087, 0x60A7, 0x60C8, 0x60C7, 0x9A2C, 0xD3D1, 0xD3CF, 0xCBCE, 0xD450, 0xD450, 0xDC6F, 0xD44F, 0xD44F, 0xD42F, 0xD44F, 0xD42F, 0xD44F, 0xD42F, 0xD42F,
+	0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xA9E8, 0xBA29, 0xD30B, 0xE3EC, 0xEC6E, 0xECAE, 0xECCE, 0xF4CE, 0xF48E, 0xE3AC, 0xC2AA, 0x9988, 0x9147, 0xA1C9, 0xA9E9, 0xAA09, 0xB209, 0xB1E9, 0xB1E9, 0xB1E9, 0xAA09, 0xB229, 0xB249, 0xBA09, 0xAA29, 0xF613, 0xF54E, 0xEC0C, 0xDB4B, 0xD30B, 0xCA8A, 0xBA49, 0xBA49, 0xB22A, 0xBA6B, 0xC2AC, 0xB24A, 0xC2CC, 0xD36E, 0xDB8E, 0xD38E, 0xD38E, 0xBB0C, 0xCB8E, 0xDBEF, 0xDC10, 0xCBAE, 0xCBAE, 0xDC30, 0xE492, 0xE4B2, 0xCC0F, 0xD471, 0xED13, 0xDCB1, 0xDC91, 0xE4F2, 0xE513, 0xE4D2, 0xDCB2, 0xDCD2, 0xD4B1, 0xDCD2, 0xDD13, 0xDD13, 0xDD33, 0xDD54, 0xD534, 0xDD75, 0xDD95, 0xD534, 0xDD34, 0xDD54, 0xD4F3, 0xDD13, 0xDD54, 0xCCD1, 0xCCD2, 0xDD74, 0xE5B5, 0xD573, 0xDDB5, 0xE616, 0xEE37, 0xEE37, 0xE616, 0xDDD6, 0xE5F6, 0xE616, 0xE616, 0xE637, 0xE636, 0xF637, 0xDD12, 0xD4B1, 0xEDF6, 0xE616, 0xFEB9, 0xB431, 0x4045, 0x58A8, 0x60A7, 0x60C8, 0x58A8, 0x5887, 0x60C8, 0x6087, 0x68E7, 0xC34F, 0xDBF0, 0xCBCF, 0xD430, 0xD470, 0xDC70, 0xDC4F, 0xD450, 0xD450, 0xD42F, 0xD44F, 0xD44F, 0xD44F, 0xD42F, 0xD44F,
+	0xAA09, 0xAA09, 0xAA09, 0xA9E9, 0xA9E9, 0xA9E9, 0xBA29, 0xD32B, 0xEC0C, 0xEC8E, 0xECAE, 0xECAE, 0xECAE, 0xEC8D, 0xE3AC, 0xC2A9, 0x9988, 0x9148, 0xA1C9, 0xA9E9, 0xAA09, 0xB209, 0xB1E9, 0xB209, 0xB1E9, 0xAA09, 0xB209, 0xB229, 0xB1E8, 0xAA49, 0xF5F3, 0xF52E, 0xF44C, 0xE3AC, 0xDB4C, 0xD2EB, 0xC249, 0xB1E8, 0xB229, 0xC2AC, 0xBA6A, 0xBA8A, 0xDB8F, 0xD34E, 0xD36E, 0xD36E, 0xBACB, 0xCB6E, 0xDBEF, 0xD3AE, 0xD3CF, 0xD3CF, 0xDBEF, 0xCBCE, 0xD410, 0xCBEF, 0xE4B1, 0xECD2, 0xDC91, 0xDCB1, 0xDC91, 0xDC91, 0xDCD2, 0xDCB1, 0xD471, 0xDC91, 0xDCB2, 0xCC91, 0xD4B1, 0xD4D2, 0xDCF2, 0xDD33, 0xDD75, 0xD534, 0xD534, 0xD513, 0xD4F3, 0xE554, 0xDD13, 0xCC71, 0xD4B1, 0xDD12, 0xE5B5, 0xDDB4, 0xDDB4, 0xE616, 0xEE37, 0xE616, 0xDDF5, 0xDDD5, 0xDDF6, 0xE617, 0xE617, 0xDE16, 0xE636, 0xE636, 0xEE57, 0xE574, 0xCC2F, 0xE4D2, 0xCC70, 0xD512, 0xFE58, 0x79E9, 0x4866, 0x58C9, 0x60C8, 0x58A7, 0x5887, 0x5887, 0x5887, 0x6928, 0x9A6C, 0xD3F1, 0xCBAE, 0xCBEF, 0xD450, 0xD471, 0xD470, 0xDC4F, 0xD44F, 0xD44F, 0xD42F, 0xD42F, 0xD44F, 0xD44F, 0xD42F, 0xD44F,
+	0xA9E9, 0xA9E9, 0xA1E9, 0xAA09, 0xA9E9, 0xA9C9, 0xBA29, 0xDB2B, 0xEC0D, 0xEC6E, 0xECAE, 0xECAE, 0xECAE, 0xF46E, 0xE3AC, 0xC2AA, 0x9988, 0x9148, 0xA1C9, 0xA9E9, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xB209, 0xAA29, 0xA9C8, 0xB249, 0xFDD2, 0xF50D, 0xEC4C, 0xE3CC, 0xE34C, 0xDB0C, 0xC24A, 0xB209, 0xB24A, 0xB229, 0xC2CB, 0xDBAE, 0xCB4D, 0xD34D, 0xCB4D, 0xBACB, 0xCB4D, 0xD38E, 0xD3AE, 0xD3AD, 0xCB8E, 0xD3AE, 0xDC0F, 0xD3EF, 0xCBAE, 0xDC51, 0xD44F, 0xD450, 0xE4B2, 0xDC91, 0xDC91, 0xDC70, 0xDC50, 0xE491, 0xDC91, 0xDC70, 0xD471, 0xD492, 0xD4B2, 0xDCD3, 0xDCD2, 0xDC91, 0xE4F3, 0xDCF3, 0xD4D2, 0xD4F3, 0xCCB3, 0xD4D3, 0xCCB1, 0xD4D1, 0xE553, 0xDD73, 0xDD73, 0xE5D5, 0xEE37, 0xEE17, 0xE5D5, 0xDDB5, 0xDDD5, 0xDDD5, 0xDE16, 0xE617, 0xE617, 0xE617, 0xEE37, 0xEE57, 0xE616, 0xCC90, 0xE492, 0xD411, 0xBBCF, 0xE593, 0xDD55, 0x4885, 0x5066, 0x60A9, 0x60E9, 0x5085, 0x58C6, 0x5888, 0x68C9, 0x89CB, 0xCB8F, 0xD3F0, 0xCBCE, 0xD450, 0xD470, 0xD470, 0xD450, 0xD44F, 0xD44F, 0xD44F, 0xD44F, 0xD42F, 0xD44F, 0xD44F, 0xD44F, 0xD44F,
+	0xA9E9, 0xAA09, 0xA1E9, 0xA9E9, 0xA9E9, 0xA9C9, 0xBA49, 0xDB2B, 0xE40C, 0xEC6E, 0xECAE, 0xECAE, 0xF4CE, 0xF46E, 0xE3CD, 0xCAAA, 0x99A8, 0x9168, 0xA1C9, 0xA9E9, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xB209, 0xB1E9, 0xAA29, 0xA1A8, 0xB2A9, 0xFDF3, 0xF52E, 0xEC8D, 0xE3CC, 0xE36B, 0xDB2B, 0xCAAA, 0xBA4A, 0xB229, 0xC28B, 0xD38E, 0xD36D, 0xCB4D, 0xC30C, 0xBAAB, 0xCB4D, 0xDBAF, 0xD38E, 0xCB8D, 0xCB4D, 0xCB6D, 0xD3EF, 0xD3AE, 0xCBAE, 0xDC31, 0xDC51, 0xD430, 0xDC31, 0xDC52, 0xD431, 0xD430, 0xDC71, 0xE4B1, 0xD430, 0xCC0F, 0xD470, 0xDCB1, 0xDC91, 0xD471, 0xDCB2, 0xDCB2, 0xDC92, 0xD472, 0xD471, 0xDCB2, 0xD491, 0xCC71, 0xCC51, 0xDD13, 0xE573, 0xDD52, 0xE594, 0xEDF5, 0xEDD6, 0xE5D5, 0xDDB5, 0xDDB5, 0xDDD5, 0xE5D5, 0xE5F6, 0xE637, 0xE637, 0xDE17, 0xE637, 0xE637, 0xEE78, 0xCD12, 0xD471, 0xE471, 0xD431, 0xCC50, 0xEDF6, 0xABD0, 0x4025, 0x58A7, 0x58A8, 0x58C8, 0x50A6, 0x60E7, 0x5888, 0x6909, 0xAAEE, 0xDC11, 0xCBCF, 0xCBEE, 0xD470, 0xD470, 0xD450, 0xD450, 0xD42F, 0xD44F, 0xD44F, 0xD44F, 0xD42F, 0xD44F, 0xD44F, 0xD42F, 0xD44F,
+	0xA9E9, 0xAA09, 0xAA09, 0xA9E9, 0xA9E9, 0xB209, 0xC269, 0xDB2B, 0xEC0C, 0xEC8E, 0xECAE, 0xECAE, 0xF4AE, 0xF48E, 0xEBED, 0xCACA, 0x9988, 0x9147, 0x99A9, 0xA9C9, 0xA9E9, 0xA9E9, 0xA9E9, 0xA9E9, 0xA9E9, 0xB1E9, 0xB1E8, 0xB229, 0xA187, 0xBACA, 0xFE53, 0xF56F, 0xF4EE, 0xEC4D, 0xE3AB, 0xE38C, 0xD30B, 0xB207, 0xBA4A, 0xDB4E, 0xCB0D, 0xD32D, 0xCB2D, 0xBACB, 0xCB2D, 0xD38E, 0xD38E, 0xD38E, 0xC32C, 0xC30C, 0xDBCF, 0xD3AE, 0xCB6D, 0xDC31, 0xDC31, 0xCBAF, 0xC390, 0xD3D1, 0xD413, 0xC3B1, 0xBB6F, 0xAB2D, 0xAB2C, 0xDC92, 0xDC91, 0xDC71, 0xD430, 0xDC50, 0xDC91, 0xDC72, 0xD451, 0xDC73, 0xDC73, 0xD472, 0xCC30, 0xCC0E, 0xDCD2, 0xED54, 0xDD33, 0xDD52, 0xEDD5, 0xEE15, 0xDD94, 0xD594, 0xD595, 0xDDD5, 0xDDD5, 0xE5F6, 0xEDF6, 0xEE36, 0xE637, 0xDE37, 0xDE57, 0xE637, 0xEE98, 0xE5F5, 0xD471, 0xD431, 0xC38F, 0xAB0B, 0xBC0E, 0xFE79, 0x69C9, 0x4845, 0x60C7, 0x60C8, 0x58A8, 0x6109, 0x60E9, 0x60A8, 0x81AA, 0xCBD0, 0xD3F0, 0xCBCF, 0xD430, 0xD450, 0xD450, 0xD44F, 0xD42F, 0xD42F, 0xD44F, 0xD44F, 0xD42F, 0xD42F, 0xD42F, 0xD44F, 0xD42F, 0xD42F,
+	0xAA09, 0xAA09, 0xAA09, 0xAA09, 0xB1E9, 0xBA29, 0xC269, 0xDB2B, 0xEC0C, 0xEC8E, 0xECAE, 0xECCE, 0xF4AE, 0xF48E, 0xEBED, 0xCACA, 0x9988, 0x8947, 0x99A8, 0xA9E9, 0xAA09, 0xA9E9, 0xA9E9, 0xAA09, 0xA9E9, 0xB1C9, 0xB9E8, 0xAA09, 0x9947, 0xBACA, 0xFE54, 0xFDAF, 0xECEE, 0xEC6D, 0xEBEC, 0xEBCC, 0xDB8C, 0xBA69, 0xCACC, 0xD2ED, 0xCB0D, 0xCB0D, 0xBA8A, 0xCB2D, 0xD38E, 0xD36D, 0xD36D, 0xC2EC, 0xCB0D, 0xD38F, 0xCB6E, 0xD36E, 0xDBD0, 0xD3AF, 0xB2CC, 0xBB0E, 0xB2CE, 0xA26D, 0xAAAE, 0xA2CE, 0xC3F2, 0xCC32, 0x9ACD, 0xB370, 0xBBD1, 0xCC32, 0xD412, 0xD411, 0xCBF1, 0xD433, 0xC3F2, 0xA2CE, 0xB350, 0xCC12, 0xC3EF, 0xECF2, 0xE512, 0xDD12, 0xE5B5, 0xEE15, 0xE5F5, 0xE5B4, 0xDDB4, 0xDDD5, 0xDDD5, 0xE5F6, 0xE616, 0xE5F6, 0xE616, 0xEE36, 0xE636, 0xDE37, 0xE637, 0xF678, 0xFE78, 0xDD12, 0xCBAF, 0xA24B, 0x89C8, 0xA2EA, 0xF616, 0xD516, 0x3845, 0x5086, 0x60C7, 0x58A7, 0x5887, 0x60C9, 0x60C9, 0x68E8, 0xAACE, 0xDC31, 0xCBCF, 0xD40F, 0xDC50, 0xD450, 0xD450, 0xD44F, 0xD42F, 0xD430, 0xD44F, 0xD42F, 0xD42F, 0xD42F, 0xD42F, 0xD42F, 0xCC2F, 0xD42F,
+	0xAA0A, 0xAA09, 0xAA09, 0xAA09, 0xB20A, 0xB209, 0xCA89, 0xDB2B, 0xE3EC, 0xF48E, 0xF4AE, 0xECCE, 0xF4CE, 0xF48E, 0xEBED, 0xCACA, 0x9968, 0x9127, 0x9988, 0xA1E9, 0xA9E9, 0xAA09, 0xB209, 0xB209, 0xAA09, 0xB1E8, 0xB9E8, 0xAA09, 0x9967, 0xB2AA, 0xFE55, 0xFDAF, 0xF54F, 0xECAD, 0xDBCA, 0xEBAB, 0xE3AC, 0xC2AA, 0xC28B, 0xCAAC, 0xCAED, 0xB28A, 0xCB0D, 0xD36E, 0xCB4D, 0xCB2D, 0xC2EB, 0xC30C, 0xCB4E, 0xD34E, 0xCB2E, 0xDB8F, 0xDBD0, 0xBAED, 0xBB4F, 0xBB4F, 0xAAAD, 0x920C, 0x818B, 0x796A, 0xCC15, 0xD496, 0xB3B3, 0xA2F1, 0x92B0, 0x822D, 0x9AAF, 0x9AAF, 0x8A2D, 0x79AB, 0x718B, 0x696A, 0x5085, 0xC432, 0xE4F3, 0xD4B1, 0xDD12, 0xEDB5, 0xEE16, 0xDDD5, 0xE5D5, 0xE5D5, 0xDDD5, 0xDDD5, 0xDDF5, 0xE616, 0xE616, 0xE616, 0xE636, 0xE636, 0xE636, 0xEE57, 0xFE58, 0xF5F7, 0xD491, 0xAAEA, 0x91C7, 0x91A9, 0xA28B, 0xDCF2, 0xFE99, 0x71EA, 0x4026, 0x58A8, 0x58A7, 0x5886, 0x5887, 0x60C9, 0x5888, 0x81AA, 0xCBB0, 0xD3EF, 0xCBCE, 0xD450, 0xDC70, 0xD450, 0xD44F, 0xD450, 0xD450, 0xD430, 0xD430, 0xD42F, 0xD42F, 0xD42F, 0xCC2F, 0xCC2F, 0xCC2F, 0xD42F,
+	0xAA0A, 0xAA2A, 0xAA2A, 0xAA09, 0xB20A, 0xBA2A, 0xCA89, 0xE34B, 0xEC0C, 0xF48E, 0xF4AE, 0xECCE, 0xF4CE, 0xF48D, 0xEBEC, 0xCACA, 0x9988, 0x8947, 0x9988, 0xA1C9, 0xA9E9, 0xAA09, 0xAA09, 0xB209, 0xAA09, 0xB209, 0xB9E9, 0xB209, 0xA9A8, 0xAA28, 0xFE34, 0xFDF0, 0xFDD0, 0xECCE, 0xD349, 0xD32A, 0xD32B, 0xBA49, 0xC2AB, 0xC2CC, 0xB24A, 0xC2EC, 0xD34E, 0xD34D, 0xCB2D, 0xC2EC, 0xCB2D, 0xD34D, 0xCB2D, 0xCB0C, 0xD38F, 0xD390, 0xB2AC, 0xC350, 0xBB50, 0xA28D, 0xA28D, 0xA2AF, 0x924E, 0x81CD, 0xA2F1, 0xAB52, 0x9291, 0x698D, 0x616C, 0x7A2E, 0x71AD, 0x612B, 0x58C9, 0x4887, 0x4866, 0x4886, 0x92CE, 0xD493, 0xCC91, 0xE594, 0xEE16, 0xE5F6, 0xDDD5, 0xDDD5, 0xE5F5, 0xDDD5, 0xDDB5, 0xDDD5, 0xDDF6, 0xDDF6, 0xE616, 0xE5F5, 0xE616, 0xEE57, 0xF678, 0xE574, 0xC410, 0xA28A, 0x91E8, 0x89A7, 0x9A08, 0xAAAB, 0xD472, 0xFE59, 0xABB0, 0x4844, 0x58A8, 0x60C8, 0x58A7, 0x58A6, 0x60C7, 0x58A8, 0x5867, 0xA2AD, 0xD410, 0xCBAE, 0xD40F, 0xDC70, 0xD470, 0xD470, 0xD470, 0xD450, 0xD450, 0xD430, 0xD430, 0xCC2F, 0xD42F, 0xCC2F, 0xD42F, 0xD42F, 0xCC2F, 0xD42F,
+	0xAA0A, 0xAA2A, 0xAA2A, 0xA9E9, 0xB1E9, 0xBA29, 0xCA89, 0xE32A, 0xEC0C, 0xF48E, 0xF4AE, 0xECCE, 0xECCE, 0xF48D, 0xEBEC, 0xCACA, 0x9988, 0x9147, 0x99A8, 0xA1E9, 0xA9E9, 0xAA09, 0xAA09, 0xB209, 0xAA29, 0xB209, 0xB9E9, 0xA9E9, 0xA9A8, 0x99A6, 0xEDB2, 0xFE31, 0xFDB0, 0xF50F, 0xCB08, 0xCAC9, 0xDB4C, 0xC2CB, 0xC2AB, 0xB24A, 0xC2CC, 0xD34E, 0xD34E, 0xCB2D, 0xBACC, 0xCB0C, 0xD34E, 0xCB0D, 0xC2EC, 0xD34E, 0xCB6F, 0xBACC, 0xBAEE, 0xC330, 0xAAAF, 0xB310, 0x9A6E, 0x920E, 0x796C, 0x692B, 0x718C, 0x92B0, 0x8A50, 0x79EF, 0x8A70, 0x79EE, 0x612C, 0x71CE, 0x50E9, 0x4046, 0x4885, 0xB391, 0xCC72, 0xCC71, 0xE5B5, 0xEDF5, 0xE5D5, 0xDDD5, 0xDDD5, 0xDDB4, 0xDDD5, 0xDDD5, 0xDDB5, 0xDDD5, 0xDDF6, 0xDDF6, 0xE5F6, 0xEE16, 0xF678, 0xEDD6, 0xB38E, 0x9229, 0x8987, 0x91A7, 0x9A09, 0xAA6A, 0xC36E, 0xE512, 0xFDF6, 0x8A8B, 0x4865, 0x5086, 0x60A7, 0x6087, 0x5888, 0x58A7, 0x60E7, 0x5067, 0x6908, 0xC3B0, 0xD3EF, 0xCBCF, 0xD470, 0xDC91, 0xD470, 0xD470, 0xD470, 0xD450, 0xD450, 0xD450, 0xD430, 0xD42F, 0xD42F, 0xD42F, 0xD42F, 0xD42F, 0xCC2F, 0xCC2F,
+	0xB24A, 0xB24A, 0xB22A, 0xAA09, 0xB209, 0xBA29, 0xCA69, 0xE32B, 0xE40C, 0xF48D, 0xF4AE, 0xECCE, 0xF4CD, 0xF48D, 0xEBEC, 0xCACA, 0x9988, 0x9147, 0x99A8, 0xA1E9, 0xA9E9, 0xAA09, 0xAA09, 0xB209, 0xAA09, 0xB209, 0xB9E9, 0xA9E9, 0xB1E9, 0x9166, 0xD4AE, 0xFE32, 0xFDD0, 0xF50F, 0xCB29, 0xDB4C, 0xE38F, 0xD32D, 0xB24A, 0xBA8B, 0xCB2D, 0xD34D, 0xCB2D, 0xBACB, 0xC2ED, 0xCB2E, 0xCB2D, 0xCB0D, 0xD36D, 0xD36E, 0xBACC, 0xB2AD, 0xCB71, 0xAAAE, 0x89CC, 0x81CC, 0x818C, 0x68CA, 0x58A9, 0x610B, 0x9290, 0x92B1, 0x694B, 0x79EE, 0x8A50, 0x7A2F, 0x58EB, 0x71CE, 0x3846, 0x50E7, 0xC412, 0xBBF0, 0xC40F, 0xEDB5, 0xDD73, 0xD573, 0xDDD4, 0xDDB4, 0xDDB4, 0xDD73, 0xDDB4, 0xDDB5, 0xDDB5, 0xDDD5, 0xDDB6, 0xE5F6, 0xF637, 0xE5B5, 0xBC50, 0xB38E, 0x9229, 0x99E9, 0xA1E9, 0xB28B, 0xCB8E, 0xDC31, 0xE4D2, 0xFE16, 0x92EB, 0x4043, 0x5887, 0x60C7, 0x60C7, 0x5887, 0x5868, 0x60C7, 0x6907, 0x58A7, 0x924D, 0xD3F1, 0xCBAE, 0xD40F, 0xDCB1, 0xD490, 0xD470, 0xD470, 0xD470, 0xD470, 0xD450, 0xD450, 0xD450, 0xD430, 0xD450, 0xD430, 0xD42F, 0xD42F, 0xCC2F, 0xCC2F,
+	0xB24B, 0xB22A, 0xB22A, 0xB229, 0xB1E9, 0xBA09, 0xCA69, 0xE32B, 0xEBEC, 0xEC6E, 0xEC8E, 0xECAE, 0xECAD, 0xF48D, 0xEBEC, 0xCAEA, 0x9988, 0x9147, 0x9988, 0xA1C9, 0xA9E9, 0xAA09, 0xAA09, 0xAA09, 0xA9EA, 0xB209, 0xB208, 0xB209, 0xB209, 0x9166, 0xB34B, 0xFE54, 0xFD8F, 0xFD70, 0xDC0C, 0xCB4B, 0xDBAE, 0xC2AB, 0xBA6A, 0xCB0D, 0xD34D, 0xCB0C, 0xBA8A, 0xC2EC, 0xCB0D, 0xCAED, 0xC2CC, 0xCB0D, 0xD32D, 0xDB8F, 0xBAED, 0xB2EF, 0x922D, 0x6929, 0x798B, 0x716B, 0x60CA, 0x58E9, 0x5088, 0x8A4E, 0xAAD1, 0x68EA, 0x58CA, 0x7A2F, 0x71ED, 0x616D, 0x408A, 0x698D, 0x6989, 0xC411, 0xBBCF, 0xD492, 0xF5D5, 0xDD53, 0xD553, 0xDD73, 0xDD93, 0xDD94, 0xDD73, 0xDD73, 0xDD94, 0xDDD4, 0xDDD4, 0xDDD4, 0xEE17, 0xEDD7, 0xBC11, 0x8A8B, 0x824B, 0xB351, 0xC391, 0xCB6C, 0xDC0D, 0xEC8F, 0xE48F, 0xE4D0, 0xF5D6, 0x9ACC, 0x4824, 0x60A8, 0x60C8, 0x60E7, 0x60C7, 0x5887, 0x5886, 0x60E8, 0x58C8, 0x6908, 0xC34F, 0xD3CF, 0xCBCE, 0xD470, 0xD490, 0xD490, 0xD490, 0xD470, 0xD470, 0xD470, 0xD450, 0xCC50, 0xCC50, 0xCC30, 0xCC30, 0xCC30, 0xD430, 0xD430, 0xCC2F, 0xCC0F,
+	0xB24A, 0xB24A, 0xB22A, 0xB209, 0xB209, 0xBA09, 0xCA69, 0xE32B, 0xE3EC, 0xF46E, 0xF48E, 0xECAE, 0xF4AE, 0xF48E, 0xEBEC, 0xCACA, 0x9988, 0x8927, 0x99A9, 0xA1E9, 0xA9E9, 0xA9E9, 0xAA09, 0xB209, 0xA9E9, 0xA9E8, 0xAA08, 0xB209, 0xBA29, 0xA1C8, 0x9A27, 0xFDF4, 0xFDF1, 0xFD90, 0xECCE, 0xE44E, 0xD38D, 0xB249, 0xCAEC, 0xD34E, 0xCB2E, 0xB26A, 0xC2CC, 0xC2ED, 0xC2ED, 0xC2CC, 0xC2ED, 0xCB0E, 0xB26B, 0xBAEE, 0xBAEF, 0x818B, 0x692A, 0x718C, 0x714B, 0x5888, 0x60EA, 0x4867, 0x694A, 0x926F, 0x68E9, 0x60C9, 0x8A70, 0x8AD1, 0x616B, 0x510B, 0x50CA, 0x92B0, 0xC411, 0xB3CE, 0xD4D2, 0xF5F6, 0xE574, 0xD532, 0xDD53, 0xDD73, 0xD553, 0xD553, 0xD553, 0xDD94, 0xDDB5, 0xDDB4, 0xE5B4, 0xEE16, 0xCCB2, 0x824A, 0x6968, 0x9ACE, 0x92CD, 0xAB30, 0xDC33, 0xEC90, 0xF4AE, 0xE48E, 0xED11, 0xFE15, 0xA34D, 0x4023, 0x5887, 0x60A8, 0x60C8, 0x60C7, 0x58A7, 0x5887, 0x60A7, 0x60C8, 0x5066, 0x8A0B, 0xD3D1, 0xCBAE, 0xD40E, 0xD490, 0xD490, 0xD4B0, 0xD490, 0xD490, 0xD470, 0xD470, 0xD470, 0xCC50, 0xCC50, 0xCC50, 0xCC50, 0xCC50, 0xCC30, 0xCC2F, 0xCC2F, 0xCC0F,
+	0xB24A, 0xB24A, 0xB22A, 0xB209, 0xB209, 0xB209, 0xC249, 0xDB0A, 0xE40C, 0xF48E, 0xF48E, 0xECAE, 0xF4AE, 0xF48E, 0xEBEC, 0xCAEA, 0x9988, 0x8927, 0x9989, 0xA1C9, 0xA9E9, 0xA9C9, 0xA9E9, 0xAA09, 0xA9E9, 0xA9E9, 0xB1E8, 0xBA29, 0xBA0A, 0xB209, 0x99A6, 0xD42E, 0xFE94, 0xF590, 0xDCAD, 0xF4F0, 0xC2EA, 0xBA8A, 0xCB2D, 0xCB0D, 0xBA8B, 0xC2ED, 0xC2ED, 0xC2CD, 0xBAAC, 0xCAED, 0xCB2E, 0xCB2F, 0x9A0C, 0x8149, 0x798A, 0x714B, 0x79CD, 0x696C, 0x50A9, 0x79CD, 0x60C9, 0x4867, 0x820D, 0x6109, 0x5888, 0x798C, 0x71AD, 0x71CE, 0x616C, 0x720F, 0x698B, 0xBC13, 0xAB6D, 0xDD12, 0xF5F5, 0xDDB4, 0xDD73, 0xD553, 0xD553, 0xD553, 0xD533, 0xD533, 0xCD33, 0xDD74, 0xE5B5, 0xE5B5, 0xE5B5, 0xCC92, 0x7187, 0x7148, 0x924D, 0x9AAF, 0xA350, 0xA2EE, 0xC3B0, 0xE46F, 0xEC8E, 0xFD32, 0xF554, 0x928A, 0x4843, 0x5086, 0x58A7, 0x60C8, 0x60E7, 0x68E8, 0x60A7, 0x5867, 0x60A7, 0x60C8, 0x60E8, 0xAACE, 0xCBB0, 0xC38E, 0xDC6F, 0xDCB0, 0xD4B0, 0xD490, 0xD490, 0xD490, 0xD490, 0xD470, 0xD470, 0xD470, 0xCC50, 0xCC50, 0xCC50, 0xCC50, 0xCC2F, 0xCC2F, 0xCC2F, 0xCC2F,
+	0xB24B, 0xB24A, 0xB24A, 0xB229, 0xB209, 0xB1E8, 0xBA28, 0xDB0A, 0xE3EC, 0xF48E, 0xF4AF, 0xECCE, 0xF4CE, 0xF48E, 0xEBED, 0xCAEA, 0x9988, 0x8947, 0x9988, 0xA1C9, 0xA9E9, 0xA9E9, 0xAA09, 0xA9E9, 0xB209, 0xAA09, 0xB209, 0xBA29, 0xBA2A, 0xBA2A, 0xA9E8, 0xA207, 0xF5B2, 0xFE32, 0xE54F, 0xECEF, 0xC30B, 0xCB0D, 0xCB2D, 0xC2CC, 0xBAAC, 0xCB0E, 0xCB2E, 0xC2CD, 0xBACD, 0xC30E, 0xC2EE, 0xB28D, 0x920D, 0x81AC, 0x714A, 0x81EE, 0x692B, 0x4847, 0x610A, 0x926F, 0x4846, 0x60E9, 0x79AC, 0x58C8, 0x60EA, 0x58A9, 0x614B, 0x614C, 0x71EF, 0x92F2, 0x8AAF, 0x9AED, 0xE534, 0xF5F5, 0xE5B4, 0xDD94, 0xDD73, 0xD553, 0xD553, 0xD533, 0xCCF2, 0xDD54, 0xD574, 0xDD74, 0xDD74, 0xDD54, 0xED95, 0xDCD3, 0x9A6A, 0x89A9, 0x9A4D, 0x8A2E, 0xAB50, 0xA2EE, 0xB36E, 0xE490, 0xFD53, 0xE4B2, 0x7987, 0x4823, 0x5886, 0x58A7, 0x60C7, 0x60C7, 0x68E7, 0x60C7, 0x5887, 0x5867, 0x60C8, 0x60C8, 0x79AA, 0xB34F, 0xB34D, 0xC3CE, 0xDCB0, 0xDCB0, 0xD490, 0xD490, 0xD490, 0xD490, 0xD490, 0xD490, 0xD470, 0xD470, 0xD450, 0xD470, 0xD470, 0xCC50, 0xD450, 0xCC2F, 0xCC2F, 0xCC2F,
+	0xB24B, 0xB24A, 0xB22A, 0xB22A, 0xB20A, 0xA9E8, 0xB208, 0xD30A, 0xE3EC, 0xF46E, 0xF4AF, 0xECCE, 0xF4CE, 0xF48E, 0xEBED, 0xCAEB, 0x9968, 0x8927, 0x9988, 0xA1C9, 0xA9E9, 0xA9E9, 0xA9E9, 0xA9E9, 0xB1E9, 0xAA09, 0xB209, 0xB22A, 0xBA4A, 0xBA2A, 0xBA4A, 0x9987, 0xC3AC, 0xFE53, 0xF5F1, 0xECAE, 0xCB0B, 0xC2CC, 0xBAAB, 0xBA8A, 0xCB0E, 0xCAEE, 0xBA8C, 0xC2CD, 0xCB0F, 0xBACE, 0xB2CE, 0x89AB, 0x794B, 0x818C, 0x89EE, 0x81EE, 0x58C9, 0x5067, 0x716B, 0x81CD, 0x58A8, 0x694A, 0x58A8, 0x60C9, 0x714B, 0x696B, 0x716C, 0x718D, 0x7A10, 0x9B33, 0x9B51, 0xC493, 0xE574, 0xE553, 0xDD94, 0xD574, 0xD533, 0xD532, 0xD533, 0xD512, 0xD513, 0xDD33, 0xD554, 0xDD94, 0xE594, 0xE594, 0xF5D6, 0xFD75, 0xD3AE, 0x91A8, 0x920C, 0x924E, 0x8A4D, 0xB371, 0xB36F, 0xDCB1, 0xC3CE, 0x60A5, 0x5046, 0x60A7, 0x5887, 0x60C8, 0x60C8, 0x60C7, 0x60E7, 0x58A7, 0x5886, 0x60A7, 0x58C8, 0x68E8, 0x9A6C, 0xBB6F, 0xAB2C, 0xCC2F, 0xDCD1, 0xDCB0, 0xD490, 0xD490, 0xD490, 0xDC90, 0xD470, 0xD470, 0xD470, 0xD470, 0xD470, 0xD470, 0xCC50, 0xCC50, 0xCC50, 0xCC2F, 0xCC2F, 0xCC2F,
+	0xB24B, 0xB22A, 0xB24A, 0xAA2A, 0xAA0A, 0xA9C8, 0xB207, 0xD30A, 0xE3EC, 0xEC6E, 0xECAF, 0xECAE, 0xF4CE, 0xF48E, 0xEBED, 0xD2EA, 0x9988, 0x8927, 0x9968, 0xA1A9, 0xA9C9, 0xAA09, 0xA9E9, 0xA9E9, 0xB1E9, 0xA9E9, 0xB20A, 0xB22A, 0xC24A, 0xC24A, 0xBA4A, 0xA9C8, 0xB2AA, 0xFE95, 0xF631, 0xFD30, 0xD30B, 0xC2CC, 0xB26B, 0xC2AB, 0xCACD, 0xBA8C, 0xC2CD, 0xCB2F, 0xBAAD, 0xB2CF, 0xA28E, 0x7929, 0x7109, 0x60C9, 0x81AC, 0x796C, 0x692A, 0x60E9, 0x692A, 0x79CD, 0x79CD, 0x5067, 0x5888, 0x5888, 0x58C8, 0x5087, 0x58A7, 0x8A0D, 0x71CD, 0x8AAF, 0xB412, 0xCCD3, 0xDD13, 0xDD34, 0xDD33, 0xCCF2, 0xCCF2, 0xD513, 0xD513, 0xDD12, 0xDCF2, 0xD4F3, 0xE595, 0xEDD6, 0xEDB4, 0xEDD5, 0xEDD5, 0xFDB5, 0xEC91, 0xB26A, 0x7907, 0x796B, 0x79CB, 0x9AAF, 0xC3D1, 0xCBF0, 0x8A09, 0x5045, 0x5867, 0x5887, 0x60A8, 0x68C8, 0x6908, 0x68E8, 0x60E8, 0x5886, 0x5886, 0x60C7, 0x58A8, 0x7969, 0xB32E, 0xB34D, 0xB36D, 0xD470, 0xDCB0, 0xDCB0, 0xDC90, 0xD490, 0xD490, 0xD490, 0xD490, 0xD490, 0xD490, 0xD46F, 0xD470, 0xD470, 0xD470, 0xD470, 0xCC4F, 0xCC4F, 0xCC2F, 0xCC2F,
+	0xB24A, 0xB24A, 0xB24A, 0xAA2A, 0xAA09, 0xA9A8, 0xA9E7, 0xCAEA, 0xE3EC, 0xEC6E, 0xECAF, 0xECCE, 0xECCE, 0xF48E, 0xEBED, 0xD2EA, 0x9988, 0x8927, 0x9988, 0xA1C9, 0xA9E9, 0xAA0A, 0xAA09, 0xB209, 0xB1E9, 0xB1E9, 0xAA0A, 0xB22A, 0xC26A, 0xC26A, 0xC26A, 0xA9C9, 0xBA8A, 0xFE75, 0xFE93, 0xDC2C, 0xBA29, 0xC2AD, 0xC2ED, 0xC2AC, 0xBA4A, 0xD30D, 0xD32E, 0xCB0E, 0xAA4C, 0x8128, 0x7129, 0x798B, 0x58C8, 0x5067, 0x692A, 0x718C, 0x79AC, 0x610A, 0x58EA, 0x718C, 0x9AD1, 0x58C9, 0x5888, 0x5887, 0x5087, 0x4045, 0x8A0C, 0x9A4E, 0x92CF, 0xB413, 0xD535, 0xD554, 0xDD74, 0xE575, 0xD4F2, 0xCCB1, 0xCCD2, 0xDD54, 0xD4B2, 0xD491, 0xDCF2, 0xED74, 0xF5B5, 0xF5D5, 0xF5B5, 0xEDD5, 0xEDF6, 0xFDB4, 0xF4D1, 0xBAAA, 0x8947, 0x6067, 0x798A, 0x8A0C, 0xBB91, 0xCC11, 0x89EA, 0x5867, 0x5888, 0x5886, 0x68C7, 0x68E8, 0x68E7, 0x6908, 0x60C8, 0x5087, 0x5886, 0x60C6, 0x58A7, 0x922C, 0xC38F, 0xB32C, 0xBBCE, 0xCC70, 0xD490, 0xDC90, 0xDC90, 0xD490, 0xD490, 0xD48F, 0xD490, 0xD490, 0xD490, 0xD46F, 0xD470, 0xD470, 0xD470, 0xD470, 0xD44F, 0xCC4F, 0xCC2F, 0xCC2F,
+	0xB22A, 0xB24A, 0xB22A, 0xAA2A, 0xAA0A, 0xA9C8, 0xB1E8, 0xCAEA, 0xE3EC, 0xF46E, 0xECAF, 0xECCF, 0xECCE, 0xF48E, 0xEBED, 0xD30B, 0x99A8, 0x8927, 0x9988, 0xA1C9, 0xA9E9, 0xAA0A, 0xAA09, 0xB209, 0xB1E9, 0xB209, 0xB22A, 0xB229, 0xBA69, 0xC289, 0xC26A, 0xB20A, 0xB24A, 0xFE35, 0xFE73, 0xBAE8, 0xBA08, 0xBA6C, 0xBAAC, 0xC28B, 0xCAEC, 0xCACC, 0xC2AC, 0xBACD, 0xA24C, 0x5845, 0x714A, 0x60E9, 0x5067, 0x58A8, 0x58C9, 0x716C, 0x718C, 0x612B, 0x614C, 0x4889, 0x8A90, 0x822F, 0x690A, 0x5066, 0x4004, 0x8A4C, 0xB32F, 0xB330, 0xD495, 0xB3F0, 0xD534, 0xD554, 0xE5B5, 0xDD33, 0xCC91, 0xCC90, 0xDD33, 0xDCF3, 0xCC71, 0xE4F2, 0xED53, 0xF594, 0xF5B4, 0xF5F5, 0xF5B5, 0xF5F6, 0xF637, 0xFE16, 0xFD53, 0xCB2C, 0x9168, 0x5866, 0x60E8, 0x81AB, 0xC3B2, 0xD452, 0x6927, 0x5867, 0x6087, 0x60A6, 0x60C7, 0x68C7, 0x6907, 0x6908, 0x5888, 0x5887, 0x60A7, 0x60A6, 0x6908, 0xB32F, 0xC38E, 0xBB8D, 0xCC2F, 0xC44F, 0xCC4F, 0xD470, 0xD490, 0xD490, 0xD490, 0xD490, 0xD46F, 0xD48F, 0xD490, 0xD490, 0xD470, 0xD470, 0xCC50, 0xCC50, 0xD450, 0xD44F, 0xCC2F, 0xCC2F,
+	0xB20A, 0xB22A, 0xB24A, 0xB22A, 0xAA0A, 0xA9E9, 0xA9E8, 0xCB0B, 0xE3ED, 0xF46E, 0xECAF, 0xECCE, 0xF4CE, 0xF4AE, 0xEC0D, 0xD30B, 0xA1A9, 0x8928, 0x9988, 0xA1C9, 0xA9E9, 0xB20A, 0xB22A, 0xB209, 0xB20A, 0xB209, 0xAA09, 0xBA6B, 0xD30C, 0xBA69, 0xC28A, 0xC26A, 0xA9E9, 0xED72, 0xF5F1, 0xB248, 0xD26C, 0xBA6B, 0xB26A, 0xDAEC, 0xD2CC, 0xAA2B, 0x91AA, 0x818A, 0x714A, 0x68E9, 0x79CC, 0x5068, 0x58C8, 0x60E8, 0x58A7, 0x58C8, 0x692A, 0x610A, 0x79AD, 0x612A, 0x69CC, 0x718C, 0x4827, 0x4004, 0x81C9, 0xC38F, 0xC38E, 0xE514, 0xD473, 0xB3F1, 0xC4D3, 0xD554, 0xDD75, 0xD4F3, 0xD4D2, 0xD4D2, 0xE470, 0xDC30, 0xE491, 0xED12, 0xED54, 0xF5B5, 0xEDD5, 0xEDF5, 0xEDF5, 0xF637, 0xF637, 0xFE57, 0xFDF5, 0xE40F, 0xA1C9, 0x6086, 0x5087, 0x6109, 0xAB30, 0xDC94, 0x7168, 0x5887, 0x60A8, 0x60E6, 0x60E7, 0x68E8, 0x7109, 0x68E8, 0x5886, 0x58A7, 0x60C8, 0x5067, 0x81AA, 0xC3B0, 0xBB6D, 0xCBEE, 0xD470, 0xCC0F, 0xCC0F, 0xCC0F, 0xCC2F, 0xCC50, 0xD450, 0xD470, 0xD470, 0xD470, 0xD490, 0xD470, 0xD46F, 0xD470, 0xD450, 0xCC4F, 0xD44F, 0xD42F, 0xD42F, 0xCC0F,
+	0xB22A, 0xB24A, 0xB229, 0xAA2A, 0xAA0A, 0xA9C8, 0xB1E8, 0xCAEB, 0xE3CC, 0xEC6E, 0xECAF, 0xECCF, 0xF4CE, 0xF4AE, 0xEBED, 0xD30B, 0x99A9, 0x8948, 0x99A9, 0xA1CA, 0xAA0A, 0xB22A, 0xB22A, 0xB22A, 0xB20A, 0xB209, 0xB209, 0xCACC, 0xCACB, 0xC26A, 0xC26A, 0xCA8A, 0xBA29, 0xC3CC, 0xFDD3, 0xC28A, 0xCA6A, 0xBAAA, 0xBAEB, 0xCACE, 0xCB0E, 0xB28D, 0x89AB, 0x60E9, 0x58A8, 0x5887, 0x798C, 0x5088, 0x6909, 0x60E9, 0x58A8, 0x58C8, 0x58C9, 0x58C9, 0x81EE, 0x8A2F, 0x71AC, 0x8A6F, 0x3805, 0x7949, 0xC390, 0xC38E, 0xED13, 0xDCF3, 0xD4F4, 0xC452, 0xCCB3, 0xE596, 0xDD95, 0xCCD2, 0xD4B2, 0xDC30, 0xDC0F, 0xE471, 0xECB1, 0xF533, 0xF574, 0xEDB5, 0xEDD5, 0xEE15, 0xF615, 0xF637, 0xF637, 0xFE57, 0xFE15, 0xEC91, 0xB20A, 0x70A6, 0x4825, 0x58A8, 0x9A8D, 0xDCB4, 0x81C9, 0x58A8, 0x60C8, 0x60E7, 0x6908, 0x6908, 0x7129, 0x68C7, 0x5886, 0x60A7, 0x58C8, 0x50A7, 0x9A8D, 0xC3D0, 0xBB8D, 0xD46F, 0xD490, 0xD450, 0xCC2F, 0xCC2F, 0xCC0F, 0xC3EF, 0xCC0F, 0xCC0F, 0xCC0F, 0xD42F, 0xD450, 0xD470, 0xD470, 0xD470, 0xCC50, 0xCC4F, 0xD42F, 0xD42F, 0xD40F, 0xCC0F,
+	0xB22A, 0xB24A, 0xAA09, 0xAA09, 0xA9E9, 0xA1A8, 0xA9E8, 0xCAEA, 0xE3AC, 0xEC6E, 0xECCF, 0xECCF, 0xF4CE, 0xF4AE, 0xEC0D, 0xD2EC, 0x99A9, 0x9168, 0xA1A9, 0xA1EA, 0xAA0A, 0xAA0A, 0xAA09, 0xB20A, 0xB209, 0xB22A, 0xBA2A, 0xC26A, 0xC26A, 0xCA8A, 0xCAAB, 0xCAAA, 0xD26A, 0xB2A8, 0xF4F2, 0xD30D, 0xC249, 0xC32C, 0xC32D, 0xCB2F, 0xB2AD, 0x816A, 0x60C8, 0x798C, 0x5888, 0x5046, 0x796C, 0x690A, 0x60E9, 0x60E9, 0x58A8, 0x58C9, 0x692A, 0x58A9, 0x718C, 0x694B, 0x60EA, 0x8A8F, 0x6128, 0xC350, 0xC32D, 0xDC91, 0xDD12, 0xED54, 0xDD55, 0xB410, 0xCCB2, 0xEDB6, 0xD513, 0xCC91, 0xDC30, 0xE3EF, 0xEC71, 0xE4B1, 0xECD2, 0xF533, 0xFD94, 0xF5B5, 0xEDD5, 0xF5F5, 0xFE15, 0xF636, 0xF637, 0xF657, 0xFE76, 0xFCF2, 0xCA8B, 0x8107, 0x5066, 0x5087, 0x820B, 0xDC94, 0x8A2A, 0x5087, 0x60C8, 0x60E7, 0x6908, 0x6908, 0x6908, 0x60A7, 0x6087, 0x60C8, 0x5886, 0x6928, 0xBB90, 0xC38E, 0xC3CE, 0xDCB0, 0xD490, 0xD490, 0xD470, 0xCC70, 0xCC4F, 0xCC2F, 0xCC2F, 0xCC2F, 0xC3EE, 0xC3EE, 0xC3EE, 0xCC0F, 0xCC2F, 0xCC30, 0xCC50, 0xCC2F, 0xCC0F, 0xD42F, 0xD40F, 0xCBEF,
+	0xAA09, 0xB229, 0xAA29, 0xAA09, 0xA9E9, 0xA9C8, 0xA9C8, 0xCAEB, 0xE3CD, 0xEC6E, 0xECCF, 0xECCE, 0xECEE, 0xF4AE, 0xEC0D, 0xD2EB, 0x9989, 0x8948, 0x99A9, 0xA1EA, 0xAA0A, 0xB22A, 0xB22A, 0xB24A, 0xB22A, 0xB22A, 0xB22A, 0xC26A, 0xC28A, 0xCA8A, 0xCA8A, 0xCA6A, 0xCA4A, 0xC2CA, 0xB2C9, 0xC2AA, 0xCAAC, 0xCB4F, 0xC32E, 0xBAEE, 0x8169, 0x68E8, 0x5088, 0x718C, 0x58E9, 0x58A8, 0x5888, 0x694B, 0x798C, 0x58A8, 0x5888, 0x60E9, 0x694B, 0x60EA, 0x58A9, 0x79AD, 0x4005, 0x6129, 0xB370, 0xBB0D, 0xE430, 0xDC70, 0xD4D1, 0xE574, 0xE575, 0xBC71, 0xCD13, 0xE534, 0xD430, 0xDC10, 0xE410, 0xE450, 0xE4B2, 0xE4B2, 0xECD2, 0xED12, 0xF573, 0xFDB5, 0xEDD5, 0xEDD5, 0xF5F5, 0xF616, 0xF637, 0xF657, 0xF676, 0xFD74, 0xD30D, 0x9988, 0x6086, 0x5047, 0x798A, 0xD453, 0x926B, 0x5886, 0x60C8, 0x60E8, 0x6908, 0x6929, 0x60E8, 0x60A7, 0x60C8, 0x60C7, 0x5086, 0x922C, 0xC3B0, 0xBB6D, 0xCC2E, 0xD4B0, 0xD490, 0xD490, 0xCC90, 0xD490, 0xD490, 0xD490, 0xD470, 0xCC50, 0xC42F, 0xBBEE, 0xC40F, 0xC3EF, 0xBBEF, 0xBBCF, 0xC3EF, 0xCC0F, 0xCC0F, 0xD42F, 0xD40F, 0xCBEF,
+	0xB22A, 0xB229, 0xAA09, 0xA9E9, 0xA9E9, 0xA9C8, 0xA9E8, 0xCAEB, 0xE3ED, 0xEC6F, 0xECAF, 0xECCF, 0xF4EE, 0xF4AE, 0xEC0D, 0xD2EA, 0x99A9, 0x8948, 0x9989, 0xA1EA, 0xAA0A, 0xAA0A, 0xB20A, 0xB22A, 0xB209, 0xB229, 0xBA2A, 0xBA4A, 0xCA6A, 0xCA8A, 0xCAAA, 0xC289, 0xCACA, 0xCB4D, 0xBB0B, 0xDB8F, 0xC28C, 0xCAEE, 0xC2EE, 0xAA8D, 0x68E8, 0x79AC, 0x4047, 0x79EE, 0x60EA, 0x5888, 0x692A, 0x81ED, 0x692A, 0x5067, 0x58A8, 0x692A, 0x58C9, 0x716C, 0x612A, 0x698B, 0x4845, 0x924C, 0xA2AB, 0xD450, 0xE4B1, 0xDC70, 0xD491, 0xDD94, 0xD595, 0xD574, 0xD4F3, 0xCBEF, 0xE3F0, 0xF452, 0xEC72, 0xE4B1, 0xECB2, 0xECD2, 0xECD2, 0xECF2, 0xED33, 0xF574, 0xF5B4, 0xF5B5, 0xEDD5, 0xEDF5, 0xFE16, 0xF636, 0xF656, 0xFDD6, 0xE38F, 0x9188, 0x5886, 0x5047, 0x6908, 0xCC12, 0xAB0D, 0x60C7, 0x6929, 0x6908, 0x6909, 0x6928, 0x60C7, 0x58A7, 0x60C8, 0x58A7, 0x60E7, 0xAB0E, 0xC38F, 0xBB6D, 0xD44F, 0xD48F, 0xD490, 0xD48F, 0xCC8F, 0xCC8F, 0xD490, 0xD4B0, 0xD490, 0xCC70, 0xCC50, 0xC42F, 0xC40F, 0xC40F, 0xBBEF, 0xBBCF, 0xBBCF, 0xBBCE, 0xC3CF, 0xCBCF, 0xCBEF, 0xD40F,
+	0xAA0A, 0xAA09, 0xAA09, 0xAA09, 0xAA0A, 0xA9C8, 0xA9E8, 0xCAEB, 0xE3CD, 0xEC6E, 0xECAF, 0xECCF, 0xECEE, 0xF4AE, 0xEC0D, 0xD2EB, 0x9989, 0x8948, 0x9989, 0xA1EA, 0xAA0A, 0xB22A, 0xB22A, 0xB209, 0xB209, 0xB209, 0xBA29, 0xC24A, 0xCA6A, 0xCAAB, 0xC289, 0xDB8D, 0xEC4F, 0x91C8, 0x68A6, 0xA22B, 0xE3F0, 0xC2ED, 0xB26D, 0x790A, 0x798C, 0x694B, 0x4889, 0x8A70, 0x5067, 0x58A8, 0x692A, 0x60E9, 0x5087, 0x5887, 0x58C9, 0x690A, 0x58C9, 0x718C, 0x694A, 0x4866, 0x79CA, 0xB30E, 0xCBCE, 0xE512, 0xE532, 0xDC91, 0xCC70, 0xDDB4, 0xE5F6, 0xD4D2, 0xA249, 0xA9E8, 0xBA8A, 0xB2AB, 0xC36E, 0xE451, 0xF4F3, 0xF4F3, 0xF4D2, 0xECD2, 0xECF2, 0xF574, 0xFD94, 0xED94, 0xEDB4, 0xF5D5, 0xFDD5, 0xFE37, 0xFE57, 0xF535, 0xCAED, 0x78C5, 0x5865, 0x5047, 0x60C8, 0xBB91, 0xBBB0, 0x60E7, 0x6929, 0x6909, 0x7129, 0x7129, 0x58A6, 0x58A7, 0x60E9, 0x5887, 0x7989, 0xBB8F, 0xBB6E, 0xC3AE, 0xD46F, 0xD46F, 0xD46F, 0xD46F, 0xCC6F, 0xCC6F, 0xD48F, 0xD490, 0xD490, 0xCC70, 0xCC50, 0xCC50, 0xCC2F, 0xC42F, 0xC40F, 0xC430, 0xC3EF, 0xBBCE, 0xBBCF, 0xBBAF, 0xBBAE, 0xC3AE,
+	0xB22A, 0xB229, 0xAA29, 0xAA09, 0xAA0A, 0xA9C8, 0xA9C7, 0xCACB, 0xE3CD, 0xEC6F, 0xECD0, 0xECEF, 0xECEE, 0xF4AE, 0xEC0D, 0xD30B, 0x9989, 0x8948, 0x99A9, 0xA1CA, 0xAA0A, 0xB22A, 0xB22A, 0xB22A, 0xB209, 0xB209, 0xBA09, 0xC26A, 0xCA8A, 0xCAAA, 0xC2CA, 0xE3CE, 0xCBAC, 0x5844, 0x4805, 0x9A6D, 0xDC31, 0xAA2A, 0x894A, 0x70E9, 0x820E, 0x50A9, 0x698D, 0x8A90, 0x4847, 0x58C8, 0x612A, 0x612A, 0x6108, 0x58A7, 0x5047, 0x694B, 0x79AC, 0x696B, 0x58A8, 0x58C7, 0xBB2F, 0xBB6D, 0xE4F2, 0xE532, 0xED74, 0xC451, 0xD4F3, 0xEDD6, 0xDC91, 0xC32C, 0xD36E, 0xE36E, 0xCB0D, 0xA1E8, 0x8926, 0x9987, 0xBAEB, 0xEC51, 0xF4B2, 0xECB1, 0xECD1, 0xF533, 0xF574, 0xED54, 0xED94, 0xF594, 0xFD74, 0xECB1, 0xBBAE, 0xAA8B, 0xA9C9, 0x8947, 0x5886, 0x5847, 0x6088, 0xAB0F, 0xCC32, 0x60E6, 0x6909, 0x6929, 0x6929, 0x60E7, 0x58C6, 0x58C7, 0x60E9, 0x5087, 0x922B, 0xC3AF, 0xBB4D, 0xD40F, 0xDC90, 0xD44F, 0xD44F, 0xD44F, 0xD44F, 0xD44F, 0xCC4F, 0xCC6F, 0xD46F, 0xCC6F, 0xCC2F, 0xCC4F, 0xCC50, 0xCC50, 0xCC30, 0xCC50, 0xC430, 0xC3EF, 0xBBCF, 0xBBCF, 0xBBAF, 0xB38E,
+	0xB20A, 0xB22A, 0xB249, 0xB22A, 0xAA0A, 0xA9C8, 0xA1A7, 0xCACB, 0xE3CD, 0xEC6F, 0xF4AF, 0xECEF, 0xF4EE, 0xF4AE, 0xEC2D, 0xD30B, 0x99A9, 0x9168, 0x99A9, 0xA1EA, 0xAA2A, 0xB22A, 0xAA09, 0xAA09, 0xB209, 0xB209, 0xBA29, 0xBA49, 0xB229, 0xCACB, 0xE3EE, 0xD38D, 0xD3CE, 0xA26C, 0x818B, 0xA2CE, 0xAACD, 0x7929, 0x68C8, 0x81EC, 0x698B, 0x616C, 0x698D, 0x69AC, 0x6109, 0x60E8, 0x60E9, 0x60EA, 0x81EC, 0x4846, 0x5067, 0x5088, 0x718C, 0x692A, 0x4845, 0x9A8E, 0xCB8F, 0xE4D1, 0xD511, 0xEDB4, 0xDD13, 0xC4B2, 0xEDD7, 0xCC10, 0xC26A, 0xCB0C, 0xCB2D, 0xBAAB, 0xE3D1, 0xC2AD, 0xBA4B, 0xA1A9, 0x9966, 0xBA8A, 0xE410, 0xE450, 0xE490, 0xED33, 0xF574, 0xED74, 0xED54, 0xF512, 0xDBAE, 0xAA49, 0x9A29, 0xAA2B, 0xC26C, 0xA1CA, 0x7108, 0x5887, 0x5867, 0xA2CE, 0xD432, 0x6948, 0x60C8, 0x7129, 0x6929, 0x60C7, 0x58A6, 0x58C8, 0x60C9, 0x60E9, 0xAAEE, 0xBB8E, 0xBB6D, 0xD450, 0xD46F, 0xD44F, 0xD44F, 0xD44F, 0xD44F, 0xD42F, 0xCC4F, 0xCC4F, 0xCC6F, 0xCC4F, 0xCC4F, 0xCC2F, 0xCC2F, 0xCC4F, 0xCC50, 0xCC50, 0xCC50, 0xC430, 0xC410, 0xBBF0, 0xB3AF, 0xAB8E,
+	0xAA0A, 0xB22A, 0xB22A, 0xAA0A, 0xAA0A, 0xA1A8, 0xA187, 0xCACB, 0xE3CC, 0xF46E, 0xF4CE, 0xF4EE, 0xF4EF, 0xF4AE, 0xEC0E, 0xD32B, 0xA1A8, 0x9147, 0x9988, 0xA1C9, 0xB209, 0xB229, 0xB229, 0xAA09, 0xB1E9, 0xB208, 0xA208, 0xAA49, 0xCB4D, 0xD38E, 0xE3CE, 0xEBEE, 0xEC0F, 0xDBF0, 0xCBB1, 0x7169, 0x60E8, 0x612A, 0x71AD, 0x8A70, 0x616B, 0x8A70, 0x58EA, 0x58E9, 0x694A, 0x692A, 0x58C9, 0x4847, 0x820E, 0x694B, 0x4866, 0x5088, 0x5067, 0x5025, 0x7989, 0xBB6E, 0xDC71, 0xDD12, 0xE593, 0xEE14, 0xD572, 0xE5B4, 0xB32C, 0x9927, 0x9168, 0x8907, 0x78E7, 0x68A6, 0x70E7, 0x6885, 0x9169, 0xCAAE, 0xD2CD, 0xCA8B, 0xDB4D, 0xEBCF, 0xF410, 0xF513, 0xEDB4, 0xF594, 0xF574, 0xCBCF, 0xAA0A, 0x8948, 0x70C6, 0x70E7, 0x80E7, 0x80E8, 0x7109, 0x5846, 0x6086, 0x9A8E, 0xD453, 0x81A9, 0x68C7, 0x7129, 0x68E8, 0x58A7, 0x58A7, 0x60E9, 0x5887, 0x7148, 0xBB8F, 0xBB6D, 0xC3CD, 0xD470, 0xD44F, 0xD44F, 0xD44F, 0xD42F, 0xD42F, 0xD42F, 0xCC4F, 0xD44F, 0xD44F, 0xD44F, 0xCC2F, 0xCC2F, 0xCC4F, 0xCC50, 0xCC50, 0xCC50, 0xCC2F, 0xC42F, 0xC40F, 0xBBEF, 0xBBD0, 0xB3AF,
+	0xA9E9, 0xA9E9, 0xA9E9, 0xA1E9, 0xA1EA, 0x9988, 0x9967, 0xC28A, 0xE3CC, 0xF46E, 0xF4CE, 0xECEE, 0xF4EF, 0xF4AF, 0xEC0D, 0xD32B, 0xA1A8, 0x8927, 0x9988, 0xA1A9, 0xA9E9, 0xB209, 0xA9E9, 0xA9E9, 0xB1CA, 0xA189, 0xAA09, 0xECB1, 0xECF0, 0xCB8B, 0xDBEE, 0xE3AE, 0xD36D, 0x91C8, 0x7928, 0x4805, 0x698B, 0x7A0D, 0x822F, 0x71CE, 0x71AD, 0x92D1, 0x590A, 0x58E9, 0x6109, 0x71AC, 0x6109, 0x4846, 0x50A8, 0x928F, 0x718B, 0x5088, 0x5046, 0x5065, 0xAB0E, 0xCC10, 0xE512, 0xDD12, 0xEDD5, 0xE5F4, 0xE5B4, 0xAB0B, 0x78C5, 0x70A6, 0x6085, 0x6085, 0x6045, 0x70E8, 0x9A8E, 0x7128, 0x5003, 0x8927, 0xDB0D, 0xDAEC, 0xDB2D, 0xE38E, 0xEBEF, 0xF533, 0xF5F5, 0xFE16, 0xC3CF, 0x7106, 0x60A6, 0x7929, 0x818A, 0x6065, 0x70C6, 0x70E7, 0x68A7, 0x5866, 0x5886, 0x9A4D, 0xD453, 0x81CA, 0x7127, 0x7129, 0x60C7, 0x58A6, 0x58C8, 0x60C9, 0x5066, 0x81CA, 0xC3B0, 0xC38D, 0xD42F, 0xD46F, 0xD44F, 0xD42E, 0xCC2E, 0xD42F, 0xD42F, 0xD42F, 0xCC2F, 0xD44F, 0xD44F, 0xCC2F, 0xCC2F, 0xCC2F, 0xCC4F, 0xC42F, 0xCC2F, 0xC42F, 0xC40F, 0xBBEF, 0xBBCF, 0xBBCF, 0xB3B0, 0xB3B0,
+	0xAA09, 0xA9E9, 0xA9C9, 0xA1C9, 0x99A9, 0x9167, 0x9946, 0xC28A, 0xE3CC, 0xF46E, 0xF4CE, 0xECEE, 0xF4EF, 0xF4CF, 0xEC0D, 0xD30B, 0x9988, 0x8927, 0x99A9, 0xA9E9, 0xB1E9, 0xB1E8, 0xA9E9, 0xA9E9, 0xA9C9, 0x9989, 0xAA6C, 0xFD55, 0xDC4E, 0xC389, 0xDBED, 0xD36D, 0xBB0E, 0x7948, 0x5046, 0x716B, 0x71AD, 0x614B, 0x590A, 0x50EA, 0x8A90, 0x8A90, 0x50C9, 0x50A8, 0x5067, 0x692A, 0x79CC, 0x4847, 0x5067, 0x58C8, 0x6109, 0x6109, 0x4846, 0x8A0C, 0xBB8F, 0xE4D2, 0xDCF1, 0xE573, 0xE616, 0xEE16, 0xBB6E, 0x9107, 0x7886, 0x60A7, 0x7969, 0x7108, 0x68E7, 0x7169, 0xDD37, 0xE557, 0x81C9, 0x8967, 0xC22A, 0xD28B, 0xD30D, 0xDB6D, 0xEBEF, 0xF533, 0xFE98, 0xE4D3, 0x70C6, 0x6086, 0x6108, 0x9AAF, 0xD414, 0x7949, 0x6084, 0x60A6, 0x60A7, 0x5887, 0x58A6, 0x8A2C, 0xD453, 0x81EA, 0x7969, 0x7129, 0x60C7, 0x58A6, 0x58C8, 0x5887, 0x60C7, 0xA2CD, 0xCBD0, 0xC3AE, 0xD450, 0xD44F, 0xD44F, 0xD42F, 0xCC2E, 0xCC2E, 0xCC2E, 0xCC2E, 0xCC2E, 0xCC2E, 0xCC2E, 0xCC2E, 0xCC2E, 0xCC2F, 0xCC2F, 0xC40F, 0xC42F, 0xC40F, 0xBBCF, 0xBBAF, 0xB3AF, 0xB38F, 0xAB6E, 0xAB6E,
+	0xAA2A, 0xAA09, 0xA9E9, 0xA9E9, 0x99A9, 0x9167, 0x9146, 0xC28A, 0xE3CC, 0xF48E, 0xF4EF, 0xED0F, 0xF50F, 0xF4CF, 0xEC0E, 0xD30B, 0xA1A8, 0x9148, 0xA1A9, 0xB209, 0xB209, 0xB229, 0xB209, 0xB24A, 0xB24A, 0x8127, 0x70E7, 0xB34E, 0xCC0D, 0xFDD3, 0xDC70, 0x89C9, 0x6929, 0x4006, 0x694C, 0x79AD, 0x50C9, 0x696B, 0x590A, 0x698C, 0x8AB1, 0x8A90, 0x50C9, 0x50A8, 0x58A8, 0x58A8, 0x81CD, 0x5087, 0x5887, 0x58A7, 0x5067, 0x4846, 0x6108, 0x9AAD, 0xC3EF, 0xDCB1, 0xDCF1, 0xE615, 0xEE36, 0xCC10, 0xB22A, 0xC24C, 0x9169, 0x6886, 0xB22D, 0x99CB, 0x7148, 0x82AD, 0xE5F9, 0xFE5A, 0xD3D1, 0xB20A, 0xCA2A, 0xCA4A, 0xD2CB, 0xDB4D, 0xEC10, 0xFDB5, 0xFE98, 0xBB2D, 0x99EC, 0x81CB, 0x69AA, 0x928D, 0xE496, 0x99EB, 0x6064, 0x5885, 0x5886, 0x5867, 0x6107, 0x81EB, 0xD494, 0x820A, 0x81AA, 0x6908, 0x60A6, 0x60A7, 0x60E8, 0x5066, 0x6928, 0xBB90, 0xC38E, 0xCBEE, 0xD44F, 0xD44F, 0xD42F, 0xD42F, 0xCC0E, 0xCC0F, 0xCC0F, 0xCC0E, 0xCC2E, 0xCC2E, 0xD42E, 0xD42E, 0xCC0E, 0xCBEE, 0xC40F, 0xC40F, 0xC3EF, 0xBBCF, 0xBBAF, 0xB38F, 0xAB6E, 0xAB6D, 0xB3AE, 0xC450,
+	0xAA0A, 0xAA09, 0xAA09, 0xA9E9, 0xA1C9, 0x9167, 0x9126, 0xC28B, 0xE3CD, 0xEC6E, 0xF4EF, 0xED0F, 0xF50F, 0xF4EF, 0xEC0D, 0xD30A, 0xA9C9, 0x9968, 0xA9C9, 0xB229, 0xBA29, 0xBA49, 0xBA6A, 0x99A7, 0x7905, 0x8168, 0xA2AD, 0xCC72, 0xED93, 0xEDF5, 0x8A6C, 0x60A9, 0x4848, 0x71AE, 0x8A71, 0x58EB, 0x58EA, 0x71AC, 0x71CD, 0x8250, 0x8291, 0x9312, 0x614B, 0x50A8, 0x58A8, 0x5067, 0x60C8, 0x60C8, 0x58A7, 0x58A7, 0x5046, 0x5045, 0x926C, 0xB38F, 0xDCD2, 0xDCF2, 0xE5D5, 0xEE16, 0xC40F, 0xB28B, 0xD2CC, 0xDB4E, 0xD32E, 0xA9AA, 0xB1EB, 0xCACE, 0xB2EE, 0xDCF5, 0xF5F8, 0xED55, 0xE3F0, 0xD2CC, 0xD2AC, 0xD26B, 0xD2CC, 0xDB2D, 0xEC10, 0xFE17, 0xF637, 0xB2EB, 0xBACD, 0xB30F, 0xAB2F, 0xE4B5, 0xDBF2, 0x8928, 0x7086, 0x68C7, 0x60A7, 0x60A7, 0x6908, 0x79CA, 0xDCB4, 0x8A2B, 0x81EA, 0x6908, 0x5886, 0x58A7, 0x60E8, 0x5886, 0x81CA, 0xC3B0, 0xBB8D, 0xD40F, 0xD44F, 0xD42F, 0xCC2F, 0xCC2F, 0xCC0E, 0xCC2E, 0xD44F, 0xCC2F, 0xCC0E, 0xD42F, 0xD42E, 0xCC0E, 0xCC0F, 0xCBEE, 0xC3EF, 0xC3CF, 0xBBAF, 0xBBAF, 0xB38E, 0xAB8E, 0xBBEE, 0xCC6F, 0xDCF0, 0xE572,
+	0xB22A, 0xB22A, 0xAA2A, 0xA1C9, 0x99A9, 0x9168, 0x9126, 0xC26B, 0xE3CD, 0xEC8E, 0xECEF, 0xED2F, 0xED2F, 0xF4EF, 0xEC2D, 0xD32B, 0xA9C9, 0x9968, 0xA9E9, 0xBA29, 0xC269, 0xC269, 0xC2CC, 0x7083, 0x89A8, 0xD412, 0xC3F3, 0xC433, 0xB3F1, 0x6167, 0x4067, 0x81F0, 0x8270, 0x720F, 0x71CE, 0x4048, 0x612B, 0x79ED, 0x698C, 0x7A0F, 0x9313, 0x9312, 0x824F, 0x592A, 0x4867, 0x5887, 0x58A8, 0x58A8, 0x58C7, 0x5887, 0x4804, 0x7148, 0xAB0D, 0xD491, 0xDD12, 0xE574, 0xEE37, 0xC3CF, 0xAA2A, 0xD30D, 0xD32C, 0xDB6D, 0xE36E, 0xDB4E, 0xCAED, 0xC28C, 0xC2AC, 0xCB4E, 0xBB4D, 0xD410, 0xEC51, 0xE3AF, 0xCACC, 0xD28B, 0xDACC, 0xDB0D, 0xE3F0, 0xFE17, 0xFE78, 0xDC72, 0xD36E, 0xCB6E, 0xC34E, 0xBB0D, 0x9167, 0x8906, 0x9148, 0x78C7, 0x6087, 0x68C8, 0x6928, 0x7169, 0xDCD4, 0x9AAD, 0x79A9, 0x68E8, 0x58A7, 0x58A7, 0x60C7, 0x68E7, 0xA2CD, 0xBB8F, 0xC3AE, 0xD44F, 0xD44F, 0xCC2F, 0xCC2F, 0xCC2F, 0xCC0E, 0xCC2F, 0xD44F, 0xCC2F, 0xCC2F, 0xCC2F, 0xCC2F, 0xCC0F, 0xCBEE, 0xC3CE, 0xBBAE, 0xBBAF, 0xB38F, 0xB38E, 0xBBCE, 0xCC8F, 0xDD11, 0xE571, 0xED91, 0xE590,
+	0xAA2A, 0xAA29, 0xAA09, 0xA1C9, 0x99A9, 0x9147, 0x9106, 0xC26A, 0xE3AD, 0xEC6E, 0xECEF, 0xED2F, 0xED4F, 0xF50F, 0xEC4D, 0xDB2B, 0xA9C8, 0x9967, 0xA9C9, 0xBA09, 0xC249, 0xBA49, 0xC2AB, 0xCB4E, 0xDBF1, 0xCBD1, 0x922D, 0x718B, 0x71CC, 0x50C8, 0x50A8, 0x50CA, 0x8AF2, 0x9B33, 0x8A91, 0x58EA, 0x58EA, 0x71AC, 0x7A0F, 0x69CE, 0x8290, 0x9B53, 0x8A90, 0x58C9, 0x58A8, 0x58A7, 0x5887, 0x5887, 0x50C7, 0x5066, 0x5825, 0xB2CD, 0xBB6D, 0xDCD1, 0xD512, 0xF637, 0xC40F, 0x99A7, 0xD28C, 0xDB2D, 0xE3AE, 0xDBAE, 0xDBAE, 0xDBAF, 0xDBAE, 0xD32D, 0xD30D, 0xD34E, 0xD36E, 0xD410, 0xDC10, 0xDBCF, 0xCAEC, 0xDAED, 0xDACC, 0xD2CC, 0xE3CF, 0xF5F6, 0xFE98, 0xE4F3, 0xDBF0, 0xCB4E, 0xC2EC, 0xC28B, 0xA9C8, 0xA9E9, 0xA1CA, 0x80A7, 0x5866, 0x60A8, 0x6928, 0x7149, 0xDCD5, 0xAAEE, 0x7968, 0x60C7, 0x5887, 0x60C8, 0x60A6, 0x6907, 0xBB6F, 0xBB6E, 0xCBCE, 0xDC4F, 0xD42F, 0xCC2F, 0xCC2F, 0xCC0F, 0xCC2F, 0xCC0E, 0xCC0F, 0xCC0E, 0xCC2F, 0xCC0F, 0xCC0F, 0xCBEF, 0xC3CE, 0xC3CF, 0xC3AF, 0xB38E, 0xB38D, 0xCC4F, 0xE511, 0xED91, 0xEDB1, 0xEDB0, 0xE5B0, 0xEDB0,
+	0xAA2A, 0xA9E9, 0xA1C8, 0x99A8, 0x9188, 0x8927, 0x80C5, 0xBA49, 0xE3AD, 0xEC6E, 0xECEF, 0xED0F, 0xED2F, 0xF50F, 0xF44D, 0xDB4B, 0xA9C8, 0x9967, 0xA9C9, 0xBA09, 0xBA49, 0xBA49, 0xB26A, 0xCB70, 0xC330, 0xA24D, 0x7969, 0x81EC, 0x692A, 0x5088, 0x694C, 0x71AD, 0x7A6F, 0x722E, 0x822F, 0x4888, 0x50C9, 0x69AC, 0x618D, 0x92F3, 0x7A70, 0x7A2F, 0x826F, 0x58C8, 0x58A8, 0x5887, 0x5887, 0x58A7, 0x58E9, 0x4846, 0x89CB, 0xBB0D, 0xD42F, 0xE532, 0xF616, 0xCC91, 0x9165, 0xC26A, 0xD2AC, 0xE30D, 0xE38F, 0xDC0F, 0xE451, 0xE431, 0xEC30, 0xEC10, 0xEBF0, 0xEC51, 0xE492, 0xE492, 0xE472, 0xDBD0, 0xCB2D, 0xE32E, 0xDACC, 0xDAAC, 0xE3AF, 0xF5B6, 0xFE99, 0xED55, 0xE472, 0xE3F0, 0xE36F, 0xD30D, 0xCAAB, 0xBA8B, 0xB22A, 0x80E7, 0x6086, 0x68C8, 0x6928, 0x6908, 0xDCB4, 0xB34F, 0x6928, 0x60A7, 0x5887, 0x60C7, 0x5065, 0x8189, 0xC38F, 0xBB6D, 0xD40F, 0xD42F, 0xCC2F, 0xCC2F, 0xCC0F, 0xCC0F, 0xCC2F, 0xCC0F, 0xCC0F, 0xCC0E, 0xCC0F, 0xC40F, 0xCBEE, 0xC3CF, 0xC3CF, 0xBBAF, 0xB38E, 0xB38E, 0xCC8F, 0xED72, 0xF5D1, 0xEDD0, 0xEDD0, 0xEDB0, 0xE5B0, 0xED91,
+	0xA1E9, 0xA1C9, 0x9989, 0x9988, 0x9168, 0x8107, 0x80C5, 0xBA49, 0xDBAC, 0xEC6E, 0xECCF, 0xED0F, 0xF530, 0xF4EF, 0xF44D, 0xDB4B, 0xA9E8, 0x9167, 0xA9A9, 0xB1E9, 0xBA2A, 0xBA8C, 0xBAEF, 0xAB11, 0xBBB4, 0xAB32, 0xA332, 0x79CC, 0x58CA, 0x612B, 0x7A0F, 0x8AB1, 0x8270, 0x824F, 0x694B, 0x4826, 0x50C9, 0x7A0F, 0x7A0F, 0x8270, 0x8AF1, 0x9B52, 0x8A8F, 0x694A, 0x60E9, 0x58A7, 0x5087, 0x50A7, 0x48A9, 0x60C8, 0xBB0C, 0xB34C, 0xDD34, 0xE5F5, 0xE533, 0x7906, 0xB1A8, 0xD28B, 0xD2CC, 0xE32D, 0xEB8E, 0xE3EF, 0xEC51, 0xEC71, 0xF4B2, 0xEC91, 0xE491, 0xE4D2, 0xE4B1, 0xECB2, 0xEC51, 0xDBAE, 0xE34E, 0xDB4D, 0xD2EC, 0xE2AC, 0xDB4E, 0xED95, 0xFEB9, 0xED75, 0xECB1, 0xDC30, 0xDB8F, 0xDB2D, 0xDAEC, 0xCAAB, 0xBA4B, 0x80E7, 0x6887, 0x70E7, 0x6908, 0x60C8, 0xDCB4, 0xBBB0, 0x60E6, 0x60A7, 0x60A7, 0x60A7, 0x5866, 0x9A6C, 0xC3AE, 0xC38D, 0xD450, 0xD450, 0xCC2F, 0xCC2F, 0xCC0F, 0xCC0F, 0xCC0F, 0xCC0F, 0xCC0F, 0xC40F, 0xC40F, 0xC40E, 0xC3EE, 0xBBCE, 0xBBAF, 0xB38E, 0xB38D, 0xD4AF, 0xEDB0, 0xEDF1, 0xF5F1, 0xEDD0, 0xEDB0, 0xED90, 0xED90, 0xEDB1,
+	0x99C8, 0xA1EA, 0x9169, 0x9188, 0x8948, 0x80E7, 0x80C6, 0xBA49, 0xDBAC, 0xEC6E, 0xECEF, 0xED0F, 0xF530, 0xF4EF, 0xF44E, 0xD34B, 0xA1C8, 0x9147, 0xA9A9, 0xBA0A, 0xCAAC, 0xCB2F, 0xCB71, 0xC394, 0x92B0, 0x698B, 0x698C, 0x590A, 0x610A, 0x71AD, 0x7A2F, 0x82B1, 0x9B33, 0x79EE, 0x5088, 0x5088, 0x5088, 0x50C9, 0x71CD, 0x826F, 0x7A4F, 0x50E8, 0x8A4C, 0xB350, 0x6929, 0x5887, 0x50A7, 0x50A8, 0x4847, 0x922B, 0xBB0C, 0xCC30, 0xE5B5, 0xEE17, 0x71A7, 0x78C5, 0xC24A, 0xCA8B, 0xD2CC, 0xDB0D, 0xE38E, 0xE3CF, 0xEC30, 0xF491, 0xECB2, 0xECD2, 0xECF2, 0xECD1, 0xECD2, 0xF4B2, 0xEC50, 0xE3CE, 0xEB6E, 0xDB6D, 0xDB0C, 0xE2AC, 0xDB2E, 0xE554, 0xFEB9, 0xEDB6, 0xE490, 0xDC30, 0xDBAF, 0xD30D, 0xDAEC, 0xD2CC, 0xBA6B, 0x80E7, 0x6888, 0x7108, 0x7128, 0x60A8, 0xCC52, 0xCC11, 0x68E6, 0x5866, 0x60A7, 0x58A6, 0x60A6, 0xB32E, 0xC38E, 0xCBED, 0xD46F, 0xCC4F, 0xCC2F, 0xCC2F, 0xCC0F, 0xCC0F, 0xCC0F, 0xCC0F, 0xCC0F, 0xC3EF, 0xC3EF, 0xC3EE, 0xC3CE, 0xBBAE, 0xBBAE, 0xB38E, 0xCC4F, 0xED91, 0xEDF1, 0xEDF1, 0xEDD0, 0xEDB0, 0xEDB0, 0xEDB0, 0xEDD1, 0xEDF2,
+	0x91A8, 0x9169, 0x9149, 0x8968, 0x8968, 0x78E8, 0x78A6, 0xB229, 0xDBAD, 0xEC6E, 0xECEF, 0xED0F, 0xF50F, 0xF4EF, 0xF44E, 0xDB4B, 0xA1E7, 0x9967, 0xA9A9, 0xBA2A, 0xC26B, 0xBAAC, 0xB2CE, 0x89CC, 0x79CD, 0x79ED, 0x71AC, 0x58EA, 0x79EE, 0x718D, 0x8250, 0x9B54, 0x71EE, 0x612A, 0x5088, 0x58A8, 0x50A8, 0x50A9, 0x58E9, 0x610A, 0x610A, 0x4025, 0x924C, 0xBBB0, 0x7989, 0x5045, 0x5088, 0x4867, 0x58A6, 0xB32E, 0xBB6E, 0xE554, 0xEE36, 0x932D, 0x4824, 0x9168, 0xC24A, 0xCAAB, 0xD2CC, 0xDB0C, 0xE36E, 0xE3AF, 0xEC10, 0xF471, 0xECD1, 0xECF2, 0xF4F2, 0xECD1, 0xECD1, 0xEC91, 0xE42F, 0xE3CE, 0xE38E, 0xDB6E, 0xDB0C, 0xE2CC, 0xDB2D, 0xE513, 0xFEB9, 0xEDD6, 0xE470, 0xE430, 0xDBD0, 0xDB2D, 0xDACB, 0xDAEC, 0xBA4B, 0x78C7, 0x6087, 0x7107, 0x7128, 0x5867, 0xC3D0, 0xD452, 0x7127, 0x5045, 0x68E8, 0x5885, 0x7127, 0xC38F, 0xC3AD, 0xD42E, 0xD46F, 0xCC2F, 0xCC2F, 0xCC2F, 0xCC0F, 0xCC0F, 0xCC0F, 0xC3EF, 0xC3EF, 0xC40F, 0xC3EF, 0xC3EF, 0xC3CE, 0xBBAE, 0xAB6D, 0xC3EE, 0xE551, 0xF5D1, 0xEDD0, 0xEDD0, 0xEDD0, 0xEDD0, 0xEDD1, 0xEDF2, 0xEE13, 0xEE33,
+	0x9188, 0x8949, 0x8949, 0x8148, 0x8148, 0x78E8, 0x78A6, 0xB22A, 0xDBAD, 0xEC4E, 0xF4CF, 0xECEF, 0xECEF, 0xF4CF, 0xF42E, 0xDB4B, 0xA9C8, 0x9167, 0xA1CA, 0xAA0A, 0xB22A, 0xB26C, 0xA26D, 0xA2B0, 0x9AB0, 0x7A0E, 0x7A2E, 0x822F, 0x79EE, 0x50CA, 0x71CE, 0x8B12, 0x69AC, 0x590A, 0x58A8, 0x58C8, 0x58C9, 0x58A8, 0x58C8, 0x60E9, 0x68C9, 0x5886, 0x920A, 0xAB2D, 0xBB6F, 0x5886, 0x4846, 0x4806, 0x89E9, 0xB30D, 0xD451, 0xFE17, 0xC4F2, 0x4085, 0x60A7, 0x9148, 0xC24A, 0xD2AB, 0xD2CC, 0xDAEC, 0xE34D, 0xE38E, 0xE3CF, 0xEC0F, 0xEC90, 0xECD1, 0xECF2, 0xECD1, 0xECB1, 0xEC70, 0xE3EF, 0xDB8D, 0xE34D, 0xDB4D, 0xD2CB, 0xE2AB, 0xDB2D, 0xE492, 0xFE79, 0xEDF7, 0xE470, 0xDC10, 0xE3AF, 0xE34D, 0xDAEC, 0xD2EC, 0xAA0A, 0x7086, 0x6087, 0x68E7, 0x7128, 0x5026, 0xC3D0, 0xD452, 0x81CA, 0x5045, 0x6928, 0x5885, 0x920A, 0xC38E, 0xC3CD, 0xDCB0, 0xD46F, 0xCC2E, 0xCC2F, 0xCC2F, 0xCC0F, 0xCC0E, 0xC40E, 0xC3EF, 0xC3EE, 0xC3EE, 0xC3CE, 0xC3CF, 0xBBAF, 0xB36D, 0xB38D, 0xDCF0, 0xF5D1, 0xF5CF, 0xEDB0, 0xEDD0, 0xEDD0, 0xEDF1, 0xEE12, 0xEE33, 0xEE33, 0xF633,
+	0x8968, 0x8949, 0x8949, 0x8168, 0x7928, 0x70C7, 0x78A6, 0xB22A, 0xDBAD, 0xEC4E, 0xF4CF, 0xECCE, 0xECEF, 0xF4CF, 0xF42E, 0xDB4A, 0xA1C8, 0x8927, 0xB26D, 0xA22B, 0xB26C, 0xCB71, 0xBB52, 0x798C, 0x79AD, 0xA312, 0x824F, 0x698D, 0x612B, 0x698D, 0x69EE, 0x9B75, 0x824F, 0x58E9, 0x692A, 0x58E8, 0x5067, 0x5087, 0x58A7, 0x798A, 0x68C8, 0x68A6, 0xB2ED, 0xA2AB, 0xAAED, 0xAB0F, 0x4804, 0x5887, 0xB2EC, 0xB30D, 0xF596, 0xF637, 0x61C8, 0x4866, 0x70E8, 0x8907, 0xBA29, 0xCA8B, 0xDACC, 0xDB0C, 0xE32D, 0xE38E, 0xEBCF, 0xEC0F, 0xE470, 0xEC91, 0xECB1, 0xECB1, 0xEC90, 0xEC50, 0xE3EF, 0xDB4D, 0xDB2C, 0xDB2C, 0xD2CB, 0xDAAB, 0xDB0D, 0xE451, 0xFE58, 0xF637, 0xDC70, 0xDC0F, 0xE3AF, 0xDB4D, 0xDAEC, 0xD2CC, 0x99A9, 0x6066, 0x68A7, 0x7948, 0x7948, 0x5006, 0xB34F, 0xD452, 0x924B, 0x5045, 0x60E8, 0x5885, 0xAAAC, 0xCBAE, 0xCBEE, 0xDC8F, 0xD44F, 0xD42E, 0xCC2F, 0xCC2F, 0xCC0F, 0xC40E, 0xC40F, 0xC3EF, 0xC3EE, 0xC3EE, 0xC3CE, 0xC3CF, 0xBBAE, 0xB36D, 0xCC2E, 0xED91, 0xF5D0, 0xF5CF, 0xEDCF, 0xEDD0, 0xEDF1, 0xF632, 0xFE53, 0xF654, 0xEE33, 0xEE13,
+	0x8988, 0x8969, 0x8969, 0x8148, 0x7928, 0x70C7, 0x7086, 0xAA29, 0xDB8D, 0xEC4E, 0xF4AF, 0xECCE, 0xECEF, 0xF4CF, 0xF42D, 0xDB2A, 0xA1A8, 0x8907, 0xAA4D, 0xBB0F, 0xC330, 0xBB30, 0x9A6F, 0x58C9, 0xA2F2, 0x8A70, 0x7A0E, 0x50EA, 0x7A0F, 0x8250, 0x82B1, 0x9354, 0x8AD1, 0x614B, 0x58C9, 0x58C8, 0x4846, 0x5066, 0x6928, 0x9A6D, 0x7908, 0x89CA, 0xCBF1, 0xDC73, 0x6927, 0x8A0B, 0x3803, 0x79A9, 0xBB2C, 0xCBF0, 0xFE99, 0x932C, 0x3804, 0x5887, 0x8128, 0x8907, 0xBA09, 0xCA8A, 0xD2CB, 0xDAEC, 0xE32D, 0xE36D, 0xEBAE, 0xEBEF, 0xEC2F, 0xE430, 0xEC70, 0xEC70, 0xEC70, 0xEC30, 0xE3AE, 0xDB4C, 0xDB0C, 0xD2EC, 0xD2AB, 0xD28B, 0xDAEC, 0xE410, 0xFDF7, 0xFEB9, 0xE470, 0xDBEF, 0xDB8F, 0xDB2D, 0xDAEC, 0xC2AC, 0x8148, 0x5866, 0x60C7, 0x7968, 0x7948, 0x5006, 0xAAED, 0xDC73, 0x9A8C, 0x5045, 0x58A7, 0x68E6, 0xC34D, 0xCBAD, 0xCC2E, 0xD48F, 0xD44F, 0xD42E, 0xCC2F, 0xCC2F, 0xCC0F, 0xCC0F, 0xC3EE, 0xC3EF, 0xC3EE, 0xC3EE, 0xC3AE, 0xBBAF, 0xBB6E, 0xBBAD, 0xE510, 0xF5D0, 0xF5CF, 0xEDCF, 0xEDD0, 0xEDF0, 0xF632, 0xF653, 0xF674, 0xF654, 0xEE54, 0xEE34,
+	0x8988, 0x8969, 0x8969, 0x8168, 0x7907, 0x68A7, 0x6845, 0xA9E9, 0xDB8D, 0xEC4E, 0xECAF, 0xECEF, 0xECEF, 0xF4CF, 0xF42D, 0xDB4A, 0xA1C8, 0x8927, 0x9169, 0xB2AE, 0xAA8D, 0xBB10, 0x9A6E, 0x714C, 0x8A2F, 0x820E, 0x71CD, 0x71CE, 0x8230, 0x7A2F, 0x722F, 0x9374, 0x8290, 0x592A, 0x4867, 0x58C8, 0x50A8, 0x5087, 0x7149, 0x8189, 0xA26B, 0xB2ED, 0x91EA, 0xA2AD, 0x58A6, 0x5065, 0x5064, 0x9AAC, 0xB32C, 0xED75, 0xC491, 0x4064, 0x4846, 0x6087, 0x9169, 0x9127, 0xB1E9, 0xCA8A, 0xDACB, 0xDAEC, 0xE30C, 0xE34D, 0xE38E, 0xEBAE, 0xEBCE, 0xE3EF, 0xEC2F, 0xEC50, 0xEC30, 0xE3EF, 0xDB8D, 0xD30C, 0xD2AB, 0xDAEC, 0xDACB, 0xD28B, 0xDAEC, 0xDBCF, 0xED95, 0xFEFA, 0xE491, 0xDBCE, 0xE3AF, 0xDB2D, 0xDAEC, 0xBA6B, 0x68C7, 0x5067, 0x60E8, 0x7968, 0x7128, 0x5005, 0x9A6B, 0xDC73, 0xAB2E, 0x58A6, 0x5066, 0x81A9, 0xCB8E, 0xCB8D, 0xD44E, 0xCC6F, 0xCC4F, 0xD40E, 0xCC2E, 0xCC2F, 0xCC0F, 0xCC0F, 0xC40F, 0xC40F, 0xC3EE, 0xC3EE, 0xBBAE, 0xBBAE, 0xB36D, 0xCC4E, 0xF591, 0xFDCF, 0xF5CF, 0xEDD0, 0xEDD0, 0xF632, 0xFE73, 0xF653, 0xEE53, 0xEE54, 0xF654, 0xF654,
+	0x91A9, 0x9189, 0x8969, 0x8148, 0x7927, 0x68A6, 0x6845, 0xA9E9, 0xDB8D, 0xEC4E, 0xECAF, 0xECEF, 0xF4EF, 0xF4EF, 0xF44D, 0xDB4B, 0xA9A8, 0x9948, 0xBA8D, 0xBAAE, 0xAA4C, 0xB2CE, 0x89AC, 0x794B, 0x820F, 0x8A70, 0x71AD, 0x616C, 0x8250, 0x594C, 0x7250, 0x8B13, 0x8290, 0x698C, 0x50A8, 0x6109, 0x58C8, 0x4866, 0x7149, 0x924C, 0x920A, 0xAACD, 0x81CA, 0x5886, 0x5046, 0x5085, 0xAB6F, 0xB38E, 0xB32D, 0xE512, 0x82AA, 0x3845, 0x5066, 0x68A7, 0x99AB, 0x8926, 0xBA08, 0xCA8A, 0xD2CB, 0xDACC, 0xE2EC, 0xE32D, 0xE36D, 0xE3AE, 0xE3AE, 0xEBCF, 0xE3EF, 0xE40F, 0xE40F, 0xE3CF, 0xE38D, 0xCA8A, 0xD28B, 0xE34E, 0xEB4E, 0xE30C, 0xD2CB, 0xDBAE, 0xF575, 0xFEF9, 0xDC90, 0xDB8E, 0xDB8E, 0xDB0D, 0xD2ED, 0xA1EA, 0x5865, 0x50A8, 0x68C8, 0x7968, 0x7107, 0x5006, 0x89C9, 0xDC93, 0xBBB0, 0x60E7, 0x4025, 0x9A6C, 0xD3CF, 0xCBCD, 0xD46F, 0xCC4F, 0xCC4F, 0xD40E, 0xCC0E, 0xCC0E, 0xCC0F, 0xCC0F, 0xCC0F, 0xC3EF, 0xC3EE, 0xC3EE, 0xC3CE, 0xB38D, 0xBB8D, 0xE510, 0xFDD1, 0xF5CF, 0xF5D0, 0xEDD0, 0xF612, 0xF653, 0xF653, 0xEE53, 0xEE34, 0xEE54, 0xF654, 0xEE54,
+	0x91A9, 0x9189, 0x9168, 0x8948, 0x7928, 0x70C6, 0x7084, 0xB22A, 0xD38D, 0xEC4E, 0xF4AF, 0xECCF, 0xF4EF, 0xFCF0, 0xEC4E, 0xDB2B, 0xB20A, 0xA1EA, 0xB20B, 0xA9EA, 0xB24B, 0xBAAE, 0x818B, 0x714C, 0x9AD1, 0x9290, 0x58EA, 0x71CD, 0x8A91, 0x50EA, 0x7A30, 0x8AF2, 0x8B12, 0x722E, 0x614A, 0x58C9, 0x6928, 0x5045, 0x58E7, 0x6149, 0x58E7, 0x8A8E, 0x58C8, 0x5026, 0x4804, 0x71C9, 0xE555, 0xDD12, 0xE554, 0xB3AE, 0x50C4, 0x4864, 0x5886, 0x60A7, 0x99EB, 0x9147, 0xBA08, 0xD28A, 0xD2AB, 0xDACB, 0xDAEC, 0xEB2D, 0xE34D, 0xE38E, 0xE3AF, 0xEBCF, 0xE3EF, 0xE40F, 0xE40F, 0xE3EF, 0xE38E, 0xCAAB, 0xDACC, 0xCACB, 0xB1E8, 0xD28B, 0xD28A, 0xDB0C, 0xF4D2, 0xF616, 0xD42F, 0xE38E, 0xE34D, 0xDAED, 0xC2CD, 0x7107, 0x5066, 0x58A8, 0x68E7, 0x7949, 0x7108, 0x5825, 0x7148, 0xDC93, 0xBBCF, 0x6908, 0x5045, 0xB30D, 0xD3CE, 0xD40D, 0xD46F, 0xCC4F, 0xCC2F, 0xCC0E, 0xCC0E, 0xCC0F, 0xCC0F, 0xC40F, 0xC3EF, 0xC3EF, 0xC3EE, 0xC3CE, 0xBBAF, 0xB36C, 0xCC0D, 0xF570, 0xFDCF, 0xF5CF, 0xEDD0, 0xF612, 0xF632, 0xEE53, 0xEE53, 0xEE53, 0xEE54, 0xEE54, 0xEE54, 0xEE54,
+	0x8989, 0x9168, 0x8968, 0x8968, 0x8128, 0x78E7, 0x8106, 0xBA8B, 0xDBCE, 0xEC4F, 0xF4AF, 0xECCF, 0xF4EF, 0xF4F0, 0xEC4E, 0xDB4C, 0xA9EA, 0x9127, 0x9988, 0xA9EA, 0xBA6C, 0xAA4D, 0x89AC, 0x79AD, 0x9270, 0x820E, 0x5088, 0x92D2, 0x79EE, 0x618D, 0x720F, 0x8AD2, 0xA394, 0x7A8F, 0x614A, 0x5086, 0x796A, 0x7128, 0x4024, 0x4867, 0x92AF, 0x820C, 0x4866, 0x58C7, 0x4844, 0xA2EE, 0xDCF3, 0xE594, 0xCC93, 0x4864, 0x5064, 0x5886, 0x5886, 0x68A7, 0xA22B, 0xA188, 0xC229, 0xD28A, 0xD2AB, 0xDACB, 0xDAEC, 0xE32D, 0xE36D, 0xE38E, 0xE3AE, 0xE3CF, 0xE3EF, 0xE40F, 0xE40F, 0xEBEF, 0xE3AE, 0xDB2C, 0xDAAB, 0xC249, 0xA9A7, 0xC229, 0xBA08, 0xC28A, 0xE450, 0xED33, 0xDC10, 0xE38E, 0xE32D, 0xDB2D, 0xA22B, 0x5886, 0x58A8, 0x58A8, 0x7108, 0x8149, 0x70E7, 0x6066, 0x60C7, 0xCC32, 0xC3F0, 0x7949, 0x7107, 0xCB8F, 0xD3CD, 0xD40E, 0xD44F, 0xCC2F, 0xCC2F, 0xCC0E, 0xCC0E, 0xCC0F, 0xCC0F, 0xC40F, 0xC3EE, 0xC3EE, 0xC3CE, 0xC3CE, 0xBBAF, 0xB36C, 0xD48E, 0xF5B1, 0xFDCF, 0xF5CF, 0xF5F1, 0xF633, 0xF633, 0xEE53, 0xEE53, 0xEE54, 0xEE74, 0xEE74, 0xEE55, 0xEE54,
+	0x9169, 0x9168, 0x8948, 0x8948, 0x8128, 0x8128, 0x9968, 0xCACC, 0xE3EE, 0xEC6F, 0xF48F, 0xECAF, 0xECEF, 0xF4F0, 0xF44E, 0xDB6B, 0xA9E9, 0x8927, 0xA1C9, 0xA9E9, 0xBA6C, 0xB28E, 0x7109, 0x716C, 0x71AD, 0x5088, 0x822F, 0x7A0E, 0x698D, 0x69AE, 0x8250, 0x8271, 0x9333, 0x9B73, 0x71CD, 0x4004, 0x81AB, 0xC3B2, 0x5066, 0x5087, 0x820D, 0x60C7, 0x79A9, 0x8AAD, 0xB390, 0xAA8C, 0xAB2D, 0xDD54, 0x6148, 0x4825, 0x6929, 0x60C9, 0x5066, 0x68C7, 0xAA6C, 0x99A7, 0xC229, 0xD28A, 0xD2AB, 0xDACB, 0xDAEC, 0xE30C, 0xE34D, 0xE36D, 0xE38E, 0xE3AE, 0xE3CF, 0xE3EF, 0xEC0F, 0xEC0F, 0xEBCF, 0xE38E, 0xDB0C, 0xDACC, 0xE32D, 0xD32D, 0xD30C, 0xEC71, 0xF534, 0xECB2, 0xDBEF, 0xDB8E, 0xDB2D, 0xCB0E, 0x7928, 0x5886, 0x50A8, 0x58C8, 0x7948, 0x898A, 0x7108, 0x6886, 0x5866, 0xC3D1, 0xC410, 0x818A, 0x8188, 0xD3EF, 0xCBCD, 0xDC4E, 0xD46F, 0xCC4F, 0xCC2F, 0xCC2E, 0xCC0F, 0xCC0F, 0xC40F, 0xC40F, 0xC3EE, 0xC3EE, 0xC3CE, 0xC3CE, 0xBB8E, 0xBB8C, 0xE4EF, 0xFDD1, 0xF5CF, 0xF5F0, 0xF631, 0xF653, 0xF653, 0xF653, 0xEE53, 0xEE74, 0xEE74, 0xEE74, 0xEE54, 0xEE54,
+	0x9169, 0x8948, 0x9168, 0x9168, 0x8127, 0x8107, 0xA1EA, 0xCB0D, 0xE3EE, 0xEC6F, 0xEC8F, 0xECAF, 0xECEF, 0xF4F0, 0xF44E, 0xE36B, 0xAA09, 0x9147, 0xA1C8, 0xA9E9, 0xB26C, 0xCB71, 0x7109, 0x692B, 0x716C, 0x824F, 0x820E, 0x48A8, 0x698C, 0x71CE, 0x8291, 0x8AB2, 0x7A71, 0xA394, 0x9312, 0x58E7, 0x7969, 0xAAEF, 0x7109, 0x60C9, 0x60C8, 0x9ACE, 0xA34F, 0xD4D4, 0xBB6F, 0x91E9, 0xE4D4, 0x9B2D, 0x4866, 0x60C9, 0x60E9, 0x68E9, 0x58A8, 0x68E8, 0xA26C, 0x99E8, 0xC249, 0xD2AB, 0xD2AB, 0xDAAB, 0xDAEB, 0xE32D, 0xE34D, 0xE34D, 0xE36E, 0xE38E, 0xE3CF, 0xEBEF, 0xEC0F, 0xEC0F, 0xE3CF, 0xE3CF, 0xDBAE, 0xE32D, 0xE38E, 0xF4D2, 0xE471, 0xF595, 0xF5B5, 0xEC92, 0xE3CF, 0xDB6E, 0xD34E, 0xAA6C, 0x60A6, 0x58A8, 0x50A8, 0x6109, 0x7969, 0x8989, 0x7907, 0x68C7, 0x5046, 0xAB4F, 0xCC10, 0x89C9, 0xA28A, 0xD3EE, 0xCBED, 0xD46E, 0xCC4E, 0xCC2F, 0xCC0F, 0xCC0F, 0xC40F, 0xC40F, 0xC40F, 0xC3EF, 0xC3EF, 0xC3EE, 0xC3CE, 0xBBCE, 0xBB6D, 0xBBCC, 0xE52F, 0xFDD0, 0xEDF0, 0xF610, 0xFE52, 0xF653, 0xF653, 0xEE53, 0xEE53, 0xEE74, 0xEE74, 0xEE74, 0xEE75, 0xF675,
+	0x8968, 0x8948, 0x8927, 0x8948, 0x8107, 0x78E6, 0xA1E9, 0xD32D, 0xE3EE, 0xEC6F, 0xF48F, 0xECAF, 0xECEF, 0xF4EF, 0xF46E, 0xDB6B, 0xA9E9, 0x9147, 0x99A8, 0xA9EA, 0xCB2F, 0xBAEF, 0x712A, 0x694C, 0x92B1, 0x79EE, 0x58EA, 0x50C9, 0x614C, 0x616C, 0x69AD, 0x8270, 0x720F, 0x8AF2, 0xA393, 0x79EC, 0x8A4C, 0x798A, 0x60C7, 0x5887, 0x924D, 0xC453, 0xD514, 0xDCD3, 0x89C7, 0xAB0D, 0xB3B0, 0x4043, 0x58A6, 0x58A6, 0x60C7, 0x7129, 0x60A7, 0x60A6, 0xA24C, 0xA20A, 0xC24A, 0xD28B, 0xD2CB, 0xDACB, 0xE2EB, 0xE32C, 0xE34D, 0xE34D, 0xE34D, 0xE36E, 0xE38E, 0xE3AF, 0xE3CF, 0xE3EF, 0xE3CE, 0xDBAE, 0xD3EE, 0xDBAE, 0xE450, 0xFDD5, 0xE533, 0xE5B4, 0xEDD5, 0xE471, 0xDB8E, 0xD36E, 0xCB4F, 0x7968, 0x5887, 0x58C8, 0x50A8, 0x6929, 0x8169, 0x8169, 0x7107, 0x68E7, 0x5026, 0xA2CD, 0xCC10, 0x9A2A, 0xC32C, 0xD3ED, 0xD40D, 0xD44E, 0xCC2E, 0xCC2F, 0xCC0F, 0xCC0F, 0xC40F, 0xC40F, 0xC3EE, 0xC3EE, 0xC3EE, 0xC3CE, 0xC3CE, 0xC3CE, 0xBB6D, 0xC3ED, 0xED70, 0xF5D0, 0xEDF0, 0xF652, 0xFE73, 0xF652, 0xF653, 0xEE53, 0xEE54, 0xEE54, 0xEE74, 0xEE75, 0xEE75, 0xF675,
+	0x8148, 0x8128, 0x8927, 0x8928, 0x7907, 0x8127, 0x99C9, 0xCB0D, 0xDBEE, 0xEC6F, 0xF48F, 0xECAF, 0xECEF, 0xF4EF, 0xF46E, 0xE36C, 0xA9E9, 0x9127, 0x9968, 0xBAAD, 0xBACE, 0xAA8E, 0x714A, 0x820F, 0x92B0, 0x5088, 0x694C, 0x616B, 0x614B, 0x698D, 0x614C, 0x79EE, 0x698D, 0x8251, 0xA374, 0x9B12, 0x928D, 0x4845, 0x7169, 0x8A2C, 0x9AAE, 0xC451, 0xED75, 0xA2CB, 0x9229, 0xBBD1, 0x50A5, 0x60A6, 0x68E7, 0x60A5, 0x60A6, 0x7149, 0x60A6, 0x5886, 0x9A2C, 0xA20A, 0xBA09, 0xD28B, 0xDAAB, 0xDACB, 0xE2CB, 0xEB0C, 0xEB2C, 0xE32D, 0xE32D, 0xE34D, 0xE34D, 0xEB8E, 0xE38E, 0xE38E, 0xE3AE, 0xDB8E, 0xD3EE, 0xE40F, 0xECB1, 0xFDF6, 0xED74, 0xF5D5, 0xF5D6, 0xE472, 0xDB4E, 0xD36F, 0xB2CD, 0x5886, 0x50C8, 0x58C8, 0x58C8, 0x6908, 0x8189, 0x8148, 0x7906, 0x68E7, 0x4826, 0x926C, 0xCC10, 0xA26A, 0xCB6C, 0xD3CD, 0xCC2D, 0xCC4E, 0xD42F, 0xD42F, 0xCC0F, 0xCC0F, 0xC3EF, 0xC3EF, 0xC3EE, 0xC3EE, 0xC3EF, 0xC3EF, 0xC3CE, 0xBBAE, 0xB34D, 0xCC0D, 0xF5B0, 0xEDF0, 0xF611, 0xF673, 0xF653, 0xF653, 0xF673, 0xF653, 0xEE54, 0xEE74, 0xEE75, 0xEE75, 0xEE75, 0xEE75,
+	0x8128, 0x78E7, 0x8107, 0x8108, 0x78E7, 0x8107, 0x91A8, 0xC30D, 0xDC0E, 0xEC6F, 0xF4AF, 0xECCF, 0xF50F, 0xFD10, 0xF48E, 0xE38C, 0xA9E9, 0x88E7, 0xAA2B, 0xBACE, 0xA20B, 0xB2AE, 0x68E9, 0x79AD, 0x822E, 0x58E9, 0x612B, 0x614B, 0x698C, 0x7A0E, 0x71AD, 0x698C, 0x79EE, 0x614C, 0x7A50, 0xABD5, 0x71CC, 0x50A6, 0xA30F, 0xCC95, 0xCCB3, 0xF596, 0xBB8E, 0x81E7, 0xC411, 0x71A9, 0x4004, 0x818B, 0x60C7, 0x6086, 0x68C7, 0x7949, 0x68C7, 0x5865, 0x91EB, 0x99EA, 0xB1A8, 0xCA6B, 0xDAAB, 0xDACB, 0xE2CB, 0xE30B, 0xE32C, 0xE34D, 0xDB2C, 0xE32C, 0xE32D, 0xDB0C, 0xE34D, 0xE36D, 0xE38D, 0xE38D, 0xEBAE, 0xE3CE, 0xE3CE, 0xEC50, 0xF4F2, 0xEC71, 0xEC31, 0xDBAF, 0xCACD, 0xDB90, 0x8189, 0x5086, 0x58E9, 0x58C8, 0x60C7, 0x7128, 0x8169, 0x8148, 0x8147, 0x70E7, 0x4806, 0x8A0B, 0xCC10, 0xAACC, 0xD38C, 0xCBCC, 0xCC2E, 0xCC4F, 0xCC2E, 0xD40E, 0xCC0E, 0xC40F, 0xC3EF, 0xC3EF, 0xC3EF, 0xC3CE, 0xC3EF, 0xC3CE, 0xC3CE, 0xBBAE, 0xB34D, 0xCC2D, 0xF5B0, 0xF610, 0xF652, 0xF674, 0xEE53, 0xEE73, 0xF673, 0xF653, 0xEE74, 0xEE75, 0xEE95, 0xEE95, 0xF675, 0xF676,
+	0x70E7, 0x70C7, 0x78E7, 0x8108, 0x78E7, 0x7907, 0x99C9, 0xC32D, 0xE40E, 0xEC6F, 0xF4AF, 0xECCF, 0xF50F, 0xF4EF, 0xF46E, 0xDB6C, 0xA1A9, 0x9969, 0xC2EF, 0x99A9, 0xBACE, 0xB2CF, 0x60A8, 0x694B, 0x696C, 0x612A, 0x696C, 0x58CA, 0x696C, 0x9AF2, 0x8A70, 0x7A0F, 0x698C, 0x7A2E, 0x7A30, 0x7A50, 0x7A2F, 0xA30F, 0xB370, 0xE536, 0xFE9A, 0xCC30, 0x89A7, 0xB36E, 0x9B2E, 0x4044, 0x5887, 0x68E8, 0x68C8, 0x6066, 0x68C7, 0x7929, 0x7108, 0x5865, 0x89CA, 0x91A9, 0xA167, 0xCA4A, 0xDAAB, 0xE2CB, 0xDAAA, 0xDAEB, 0xE30C, 0xEB4D, 0xE34C, 0xEB6D, 0xCA8A, 0xB1C7, 0xBA08, 0xCA8A, 0xCAAA, 0xCA89, 0xCA28, 0xBA28, 0xBA08, 0xCA6A, 0xCACB, 0xB1E8, 0xC22A, 0xBA4A, 0xDB2E, 0xC30E, 0x60A5, 0x50C7, 0x50C9, 0x58A8, 0x68E7, 0x7927, 0x8148, 0x8989, 0x7106, 0x7108, 0x5047, 0x7989, 0xCBF0, 0xBB2D, 0xDBAD, 0xD3CD, 0xCC2E, 0xCC4F, 0xCC2E, 0xD40E, 0xCC0F, 0xC40F, 0xC40F, 0xC3EF, 0xC3EF, 0xC3EF, 0xC3CE, 0xC3CE, 0xC3CE, 0xBB8E, 0xBB2D, 0xD44E, 0xF5D0, 0xF631, 0xF673, 0xF674, 0xF674, 0xEE74, 0xF653, 0xF673, 0xEE94, 0xEE95, 0xEE95, 0xF695, 0xF695, 0xFE76,
+	0x68C7, 0x70E7, 0x70E7, 0x7908, 0x78E7, 0x8948, 0xA20A, 0xC32E, 0xE40E, 0xEC8F, 0xECCF, 0xECEF, 0xF4EF, 0xF4F0, 0xEC6F, 0xD34D, 0xA22A, 0xC2EF, 0xA1CB, 0x99CA, 0xD391, 0x9A6E, 0x692A, 0x6129, 0x50A8, 0x610A, 0x694C, 0x614C, 0x618D, 0xA395, 0x7A2F, 0x8A71, 0x8250, 0x7A2D, 0x92D0, 0x696D, 0x69CD, 0xCB6F, 0xD30B, 0xED95, 0xF5D8, 0x9249, 0xA2EB, 0xCC52, 0x58C7, 0x58A8, 0x5886, 0x60C6, 0x68C7, 0x5886, 0x68E7, 0x7107, 0x7128, 0x6085, 0x8189, 0x89A9, 0xA187, 0xC229, 0xD28A, 0xDACA, 0xDAAA, 0xDACB, 0xDB0C, 0xE32C, 0xEB6D, 0xEB8E, 0xDAEC, 0xCA6A, 0xCA28, 0xC9E8, 0xD229, 0xDA6A, 0xD28B, 0xCAEC, 0xCB0D, 0xDB90, 0xE3D2, 0xDB0E, 0xD2ED, 0xDB4D, 0xDBB0, 0x8189, 0x5865, 0x58C8, 0x50A7, 0x58A6, 0x6908, 0x7108, 0x8168, 0x8988, 0x70E7, 0x7948, 0x5886, 0x710A, 0xCBD0, 0xCBAD, 0xDBCD, 0xD3CD, 0xCC4E, 0xCC4F, 0xCC2E, 0xCC2F, 0xCC2F, 0xCC2F, 0xC3EE, 0xC3EE, 0xC40F, 0xC3EE, 0xC3EE, 0xC3EE, 0xC3EE, 0xBB8D, 0xBB2C, 0xD48E, 0xF611, 0xF673, 0xF674, 0xF674, 0xF673, 0xEE74, 0xEE74, 0xEE74, 0xEE94, 0xF694, 0xF695, 0xF695, 0xF695, 0xF675,
+	0x68E7, 0x70C7, 0x70E8, 0x7908, 0x70C6, 0x8968, 0xA20A, 0xC32D, 0xDC0F, 0xEC6F, 0xF4CF, 0xECEF, 0xF50F, 0xF4F0, 0xEC6F, 0xD38D, 0xCB4F, 0xA1CB, 0x8108, 0xBAEE, 0xBAEE, 0x89ED, 0x716B, 0x7A0D, 0x50A8, 0x5088, 0x718D, 0x616C, 0x69EE, 0xAC17, 0x596C, 0x71EE, 0x8AB2, 0x7A4E, 0x612A, 0x8210, 0x9B53, 0xD3D1, 0xCACB, 0xDD13, 0xB38D, 0xA2EB, 0xDCD3, 0x79A9, 0x5087, 0x60E9, 0x5887, 0x58A6, 0x68C7, 0x60A6, 0x68E8, 0x7108, 0x7128, 0x60A6, 0x8148, 0x8189, 0x9147, 0xB1E9, 0xC24A, 0xD28A, 0xD28A, 0xD2AB, 0xDAEB, 0xDB0C, 0xE34D, 0xE38E, 0xEB6E, 0xE30C, 0xDACB, 0xE2AB, 0xE2AB, 0xE2AC, 0xF34F, 0xFC12, 0xFC73, 0xFC94, 0xFCB5, 0xE370, 0xDB6E, 0xE3CF, 0xAAAC, 0x5845, 0x5887, 0x58C8, 0x5086, 0x60C7, 0x68C7, 0x70E8, 0x89A9, 0x8968, 0x78E8, 0x8168, 0x60C6, 0x68E9, 0xCBF1, 0xD40D, 0xDBED, 0xD3ED, 0xD44F, 0xCC4F, 0xCC4F, 0xCC2F, 0xCC2F, 0xCC2F, 0xC40F, 0xC40F, 0xC40F, 0xC3EE, 0xC40F, 0xC3EF, 0xBBEE, 0xB38D, 0xB32D, 0xDCCF, 0xFE52, 0xFE94, 0xF674, 0xF674, 0xF674, 0xF675, 0xF674, 0xF694, 0xF695, 0xF694, 0xFE94, 0xF674, 0xF674, 0xF674,
+	0x68C7, 0x68C7, 0x70C7, 0x70C7, 0x70A6, 0x8968, 0x99E9, 0xC30D, 0xDC0E, 0xEC6F, 0xF4CF, 0xED0F, 0xF50F, 0xF4F0, 0xF490, 0xE3EE, 0xA20A, 0x78A6, 0xA20C, 0xC34F, 0xA28D, 0x798B, 0x79AC, 0x8A6E, 0x4867, 0x612A, 0x79CE, 0x616C, 0x82D1, 0xA3D5, 0x7250, 0x69EE, 0x69CE, 0x8AB1, 0x8AB1, 0x8A91, 0xB3D4, 0xCBD3, 0xD32F, 0xDCF3, 0xAB4A, 0xF554, 0x8A4B, 0x5086, 0x60E9, 0x60E9, 0x60C9, 0x60A8, 0x60C7, 0x60A7, 0x68E7, 0x6908, 0x7949, 0x68C6, 0x7948, 0x8169, 0x7928, 0x99C9, 0xBA4A, 0xCA49, 0xCA6A, 0xCA8B, 0xD2CC, 0xDB0C, 0xDB2D, 0xE34D, 0xEB6D, 0xE32D, 0xDAEC, 0xDAAB, 0xDAAB, 0xDA8B, 0xE2AC, 0xEAED, 0xEB4E, 0xDB0D, 0xDB0D, 0xDB6E, 0xDBAF, 0xCB6E, 0x7927, 0x5065, 0x58A7, 0x58C8, 0x58A7, 0x60C7, 0x68C7, 0x70E7, 0x89A9, 0x8988, 0x7928, 0x8168, 0x68E7, 0x68E9, 0xCBF1, 0xDC2E, 0xDBED, 0xD40D, 0xD44E, 0xCC6E, 0xCC4E, 0xCC4F, 0xCC2F, 0xCC2F, 0xC42F, 0xC40F, 0xC40F, 0xC3EF, 0xBBEE, 0xBBEE, 0xBBCE, 0xB36D, 0xB32D, 0xDCF0, 0xFE93, 0xFE94, 0xF694, 0xF674, 0xF694, 0xF695, 0xF695, 0xFE95, 0xF675, 0xF674, 0xF653, 0xF653, 0xEE53, 0xEE53,
+	0x60C7, 0x60A7, 0x68C7, 0x68A6, 0x70A6, 0x91A9, 0x99C9, 0xBACC, 0xDBCD, 0xEC4E, 0xECEF, 0xECEF, 0xF50F, 0xF510, 0xEC6F, 0xD36C, 0x99C9, 0x80E7, 0xBACF, 0xAA8D, 0x9A6D, 0x60C8, 0x822E, 0x822D, 0x4046, 0x696B, 0x696C, 0x50EA, 0x9BB5, 0x9374, 0x7290, 0x9B74, 0x69EE, 0x69AE, 0xA3B6, 0x92D1, 0x92CF, 0xB331, 0xCB71, 0xD4F2, 0xE552, 0xAB4D, 0x5086, 0x60C9, 0x60C8, 0x6108, 0x58C8, 0x58A8, 0x60C7, 0x60E7, 0x6908, 0x6908, 0x7128, 0x68C6, 0x7108, 0x8189, 0x7928, 0x8948, 0xB1E9, 0xBA08, 0xCA49, 0xCA6A, 0xD2AB, 0xD2EC, 0xDB0C, 0xDB2D, 0xE34D, 0xDB2D, 0xDB0C, 0xDAEC, 0xDACC, 0xDACB, 0xDA8B, 0xD28B, 0xD2AC, 0xCACC, 0xE36E, 0xDB8F, 0xDB8F, 0x9A0A, 0x60A6, 0x5886, 0x5087, 0x58C8, 0x6909, 0x68E7, 0x68A6, 0x7908, 0x89A9, 0x89A9, 0x7908, 0x7947, 0x6908, 0x68E9, 0xCBF0, 0xD44E, 0xD3ED, 0xD42D, 0xCC4E, 0xCC6E, 0xCC4E, 0xCC2F, 0xCC4F, 0xCC4F, 0xC44F, 0xC42F, 0xC40F, 0xBBEF, 0xBBEF, 0xBBEE, 0xBBAE, 0xB36D, 0xAB0C, 0xDCF0, 0xFEB3, 0xFEB4, 0xF695, 0xF694, 0xF694, 0xF695, 0xF695, 0xF695, 0xF654, 0xEE53, 0xEE53, 0xEE53, 0xF673, 0xF673,
+	0x60C7, 0x60C7, 0x60A7, 0x6086, 0x70C7, 0xA22B, 0xAA09, 0xC2EB, 0xDB8D, 0xE42E, 0xECCF, 0xECEF, 0xED0F, 0xF4F0, 0xF46F, 0xDB8D, 0xA1E9, 0x80E7, 0xB2AF, 0xAA8D, 0x89CB, 0x68E9, 0x820E, 0x614A, 0x4867, 0x698C, 0x614B, 0x48C9, 0xA3B5, 0x9BD5, 0x7AB1, 0xA3B4, 0x8AF1, 0x7A51, 0x8291, 0x9B11, 0x7A0B, 0x9AAF, 0xCBB2, 0xF617, 0xC430, 0x5085, 0x58A9, 0x58A9, 0x58C7, 0x6107, 0x58C6, 0x58C8, 0x60C7, 0x60C7, 0x60C7, 0x68E8, 0x6908, 0x68E7, 0x68C6, 0x7948, 0x7108, 0x8127, 0x9987, 0xB1E8, 0xC229, 0xCA6A, 0xD2AA, 0xDACB, 0xDB0C, 0xDB2D, 0xDB2D, 0xDB2D, 0xDB4D, 0xDB2C, 0xDB4D, 0xE36E, 0xE3AE, 0xE3CF, 0xE3CF, 0xE3EF, 0xE3CF, 0xDBAF, 0xBACD, 0x70C6, 0x58E8, 0x5087, 0x50A7, 0x60E8, 0x6909, 0x68C7, 0x6086, 0x7928, 0x89C9, 0x89A9, 0x8148, 0x8167, 0x7107, 0x60A8, 0xCBF0, 0xDC4F, 0xD3ED, 0xCC2E, 0xCC6F, 0xCC6F, 0xC44F, 0xCC4F, 0xCC4F, 0xC44F, 0xC44F, 0xC42F, 0xBC0F, 0xBC0F, 0xBBEF, 0xBBCE, 0xB3AE, 0xAB4D, 0xA30C, 0xDD10, 0xFEB4, 0xFEB5, 0xF695, 0xF694, 0xF694, 0xF695, 0xF695, 0xF674, 0xEE74, 0xF673, 0xF673, 0xF693, 0xFE73, 0xF673,
+	0x58A7, 0x60A7, 0x60A7, 0x6086, 0x7928, 0xAA4B, 0xB24A, 0xCAEB, 0xD38C, 0xEC4E, 0xF4CF, 0xECEF, 0xF4EF, 0xF4EF, 0xF46E, 0xD38C, 0xAA09, 0x80E8, 0xA20C, 0xAAAE, 0x81AA, 0x79AC, 0x79ED, 0x58E8, 0x4887, 0x71AC, 0x58EA, 0x58EA, 0x8AD2, 0x82F2, 0x82F2, 0x9B74, 0x9352, 0x7A71, 0x69EE, 0x9B10, 0xA2CF, 0x8A0D, 0xB371, 0xDD55, 0x6126, 0x58A7, 0x58AA, 0x58A9, 0x60C8, 0x6907, 0x58C6, 0x60C7, 0x60C7, 0x60A7, 0x58A7, 0x60E8, 0x68E8, 0x68E7, 0x60C6, 0x6907, 0x68E7, 0x78E7, 0x8106, 0x9946, 0xB1E9, 0xBA29, 0xCA8A, 0xDACB, 0xDB0C, 0xDB0D, 0xDB2D, 0xDB4D, 0xDB6D, 0xE3CF, 0xE3CF, 0xE3EF, 0xEC70, 0xECB2, 0xE451, 0xEC30, 0xDBCE, 0xE3F0, 0x9188, 0x6886, 0x58C9, 0x50A7, 0x58E8, 0x6909, 0x68E8, 0x68E8, 0x6086, 0x8169, 0x91EA, 0x8989, 0x8149, 0x8187, 0x7128, 0x60C8, 0xCBF0, 0xDC70, 0xCBCD, 0xD44E, 0xCC6F, 0xCC4F, 0xCC2F, 0xCC2F, 0xC42F, 0xC42F, 0xC44F, 0xC42F, 0xBC2F, 0xBBEF, 0xBBCF, 0xB3CF, 0xB3AE, 0xAB4D, 0xA30C, 0xE551, 0xFED4, 0xF6B4, 0xF6B5, 0xF694, 0xF694, 0xF694, 0xF695, 0xF694, 0xF694, 0xF693, 0xF673, 0xF653, 0xF653, 0xF653,
+	0x58A7, 0x58A8, 0x58A7, 0x5886, 0x7928, 0xA22A, 0xAA29, 0xCAEB, 0xDB8C, 0xEC4E, 0xF4CF, 0xECEF, 0xF4EF, 0xF4EF, 0xF46E, 0xDB8C, 0xA9E8, 0x8907, 0x99EC, 0x9A4D, 0x714A, 0x692B, 0x820E, 0x58E8, 0x50A8, 0x696C, 0x58CA, 0x590B, 0x8AD2, 0x722F, 0x514B, 0x82B1, 0x9BB5, 0x9B54, 0x7AB1, 0x9B11, 0xBB73, 0x8A2D, 0x926D, 0x8AAC, 0x6128, 0x58C8, 0x58C9, 0x58A8, 0x60C8, 0x6928, 0x58A7, 0x60C8, 0x60C7, 0x60C8, 0x58A7, 0x60A7, 0x68E8, 0x68E7, 0x68C7, 0x68E7, 0x70E7, 0x7108, 0x7907, 0x7085, 0x8907, 0xA1C9, 0xBA09, 0xD28B, 0xDAEC, 0xDB0D, 0xE34D, 0xDB8E, 0xDBAE, 0xE3EF, 0xF451, 0xEC51, 0xE470, 0xE471, 0xEC92, 0xEC51, 0xDBEE, 0xCB8E, 0x70C6, 0x68C9, 0x50C9, 0x50C8, 0x58E7, 0x6928, 0x60A7, 0x68C8, 0x6086, 0x81A9, 0x920B, 0x89A9, 0x8148, 0x8167, 0x7948, 0x68C8, 0xC3D0, 0xDC90, 0xCBEE, 0xCC4F, 0xCC6F, 0xCC6F, 0xC42F, 0xC42F, 0xC42F, 0xC42F, 0xC42F, 0xC42F, 0xBC0F, 0xBBEF, 0xB3CF, 0xB3CF, 0xB3AE, 0xA34D, 0xA32D, 0xEDD3, 0xFEF4, 0xFED4, 0xF674, 0xF673, 0xF693, 0xF694, 0xF694, 0xFE94, 0xF673, 0xF652, 0xF632, 0xFE33, 0xFE54, 0xFE13,
+	0x58A8, 0x58C8, 0x5887, 0x5886, 0x7107, 0x91C9, 0xB249, 0xD30B, 0xDB8D, 0xEC4E, 0xF4CF, 0xECCF, 0xECEF, 0xF4EF, 0xF46E, 0xDB8C, 0xA9E9, 0x78C6, 0x91CC, 0x81CB, 0x58A7, 0x692B, 0x822F, 0x5908, 0x590A, 0x694B, 0x58C9, 0x5089, 0x92F2, 0x92F3, 0x50EA, 0x69CE, 0x8AD2, 0x9334, 0x9BD6, 0x9B13, 0xC395, 0xA2F1, 0x79EB, 0x6169, 0x5908, 0x58E9, 0x58E8, 0x58C8, 0x60C8, 0x7129, 0x60A7, 0x68C9, 0x60C8, 0x60C8, 0x60C7, 0x60A7, 0x60C7, 0x68E7, 0x68E7, 0x68C7, 0x6908, 0x68E7, 0x7949, 0x68A7, 0x6065, 0x78C6, 0xA168, 0xBA09, 0xC26A, 0xCACC, 0xD30C, 0xDB4D, 0xDB8E, 0xDBAF, 0xE430, 0xEC71, 0xEC91, 0xEC51, 0xEC52, 0xE430, 0xDBCE, 0xBB0D, 0x60A6, 0x58E9, 0x590A, 0x5909, 0x58E7, 0x6928, 0x60C7, 0x60A7, 0x60A6, 0x89CA, 0x920A, 0x8988, 0x8968, 0x8988, 0x7968, 0x68E8, 0xC3D0, 0xDC90, 0xCBEE, 0xC3EE, 0xCC4F, 0xC42F, 0xC40F, 0xC430, 0xC430, 0xC430, 0xBC2F, 0xBC2F, 0xBC0F, 0xBBEF, 0xB3CE, 0xB3AE, 0xB38E, 0xA32D, 0xB38E, 0xF614, 0xFEF4, 0xF6B4, 0xF674, 0xF673, 0xF693, 0xF694, 0xF694, 0xF673, 0xF652, 0xFE32, 0xFE13, 0xF5B2, 0xDCAF, 0xAB2A,
+	0x5867, 0x5888, 0x50A8, 0x5087, 0x60A7, 0x89A9, 0xAA2A, 0xCACB, 0xDBAD, 0xEC4F, 0xF4CF, 0xECCF, 0xECEF, 0xF4EF, 0xEC6E, 0xD38C, 0x89A7, 0x7988, 0xB371, 0x926E, 0x58C8, 0x696B, 0x718B, 0x6109, 0x614A, 0x610A, 0x58A9, 0x4868, 0x7A90, 0xA3F6, 0x69EE, 0x698D, 0x7A50, 0x8AF3, 0x82D1, 0x8B33, 0xAC16, 0xA3D4, 0xABB3, 0x9B71, 0x40A7, 0x50A9, 0x50E9, 0x58C8, 0x7109, 0x8169, 0x5886, 0x68E8, 0x60C8, 0x60C8, 0x60C8, 0x60A7, 0x60A7, 0x60C7, 0x6908, 0x6908, 0x7108, 0x68E7, 0x7949, 0x7969, 0x70C5, 0x78C5, 0x8106, 0x8947, 0xA1A8, 0xAA09, 0xBA6A, 0xC2CC, 0xCB2D, 0xDB8E, 0xDBCF, 0xE410, 0xE471, 0xE410, 0xE3EF, 0xD38E, 0xCB6E, 0xA28B, 0x5085, 0x50E8, 0x512A, 0x590A, 0x60E8, 0x6928, 0x68E7, 0x60C7, 0x68A8, 0x89AC, 0x922B, 0x89C9, 0x8989, 0x89C9, 0x8169, 0x7148, 0xCBEF, 0xDC51, 0xBB4D, 0xB30C, 0xBB6E, 0xBBAE, 0xBBCE, 0xC3EF, 0xC410, 0xC42F, 0xC42F, 0xC40F, 0xBBEF, 0xBBCF, 0xB3CE, 0xB3AE, 0xB38E, 0x9AEC, 0xBC2F, 0xFE73, 0xFED3, 0xF693, 0xF674, 0xF673, 0xF693, 0xF674, 0xF673, 0xF632, 0xFDD1, 0xF550, 0xCBEE, 0x8A08, 0x60A6, 0x5066,
+	0x60A7, 0x60C8, 0x5087, 0x5066, 0x5886, 0x8168, 0x99A8, 0xBA8B, 0xDBAD, 0xEC4F, 0xF4AF, 0xECCF, 0xECCF, 0xF4CF, 0xF46E, 0xC30A, 0xA28B, 0xDCB4, 0x926D, 0x92AF, 0x5909, 0x6109, 0x718B, 0x6109, 0x614A, 0x58E9, 0x58A9, 0x4868, 0x7A6F, 0xA3F5, 0x9333, 0x614C, 0x614C, 0x7A90, 0x7A91, 0x8B12, 0x9B94, 0xAC15, 0x722D, 0xABB3, 0xA392, 0x50A8, 0x4887, 0x50C8, 0x7108, 0x8189, 0x5065, 0x6908, 0x58C7, 0x58A7, 0x60C8, 0x58A7, 0x60A7, 0x60A7, 0x6908, 0x68E8, 0x7107, 0x68C6, 0x68C7, 0x8989, 0x9188, 0xAA09, 0xBA8C, 0xC2CD, 0xCB0D, 0xD34D, 0xCB2D, 0xD34E, 0xD36E, 0xE3AF, 0xE3F0, 0xE3F0, 0xE430, 0xE450, 0xEC50, 0xE450, 0xECB2, 0xD452, 0x92CC, 0x6188, 0x48E7, 0x50E8, 0x58E9, 0x6109, 0x60C8, 0x58C7, 0x60C7, 0x81AA, 0x922B, 0x89E9, 0x8989, 0x89A9, 0x7969, 0x7968, 0xD430, 0xCBF0, 0xAACB, 0xA2AB, 0xA2AB, 0xB30C, 0xB32C, 0xB34D, 0xB36E, 0xBB8D, 0xC3EE, 0xC40F, 0xBBEF, 0xB3CF, 0xB3CE, 0xAB8E, 0xA34E, 0x9AEC, 0xCCD0, 0xFE94, 0xFEB2, 0xF673, 0xF673, 0xF673, 0xF652, 0xF653, 0xF632, 0xEDB1, 0xDCAF, 0x9A69, 0x6083, 0x5024, 0x5886, 0x6908,
+	0x6907, 0x6908, 0x60C7, 0x5866, 0x5866, 0x8128, 0x8947, 0xB26B, 0xDB8D, 0xEC4E, 0xF4AF, 0xECAF, 0xECCF, 0xF4D0, 0xE42E, 0xDBEE, 0xE473, 0x920B, 0x6928, 0x8A2D, 0x4867, 0x58E9, 0x79ED, 0x6109, 0x5909, 0x696B, 0x714B, 0x50A8, 0x720E, 0x9B73, 0x9B54, 0x8250, 0x50EA, 0x82B1, 0xAC16, 0x7270, 0x7270, 0x9B94, 0x7A4F, 0x69AB, 0xC496, 0xA352, 0x48C7, 0x50C8, 0x7149, 0x7969, 0x50A6, 0x7129, 0x60C8, 0x58A8, 0x60C8, 0x60C8, 0x58A7, 0x60C7, 0x60E8, 0x6908, 0x68E7, 0x68A6, 0x68A6, 0x8968, 0xA1E9, 0xC2AB, 0xD2EC, 0xCACC, 0xCAEC, 0xD32D, 0xD32D, 0xD32D, 0xDB4E, 0xE38E, 0xE3CF, 0xDBAE, 0xD3AF, 0xD3CE, 0xDC0F, 0xE4D1, 0xED73, 0xF5F6, 0xF617, 0xDD95, 0xA3CF, 0x69C9, 0x48C7, 0x50C9, 0x58E9, 0x58C7, 0x68E7, 0x89E9, 0x920A, 0x89A9, 0x8989, 0x91C9, 0x8169, 0x8189, 0xD450, 0xC38E, 0xB2EC, 0xB30C, 0xAACB, 0xAACB, 0xAACB, 0xAAAB, 0xAACB, 0xAACB, 0xAB0C, 0xAB4D, 0xB34E, 0xB36E, 0xB38E, 0xAB8E, 0xA32E, 0x9B0D, 0xE531, 0xFE93, 0xFE71, 0xF652, 0xF653, 0xF673, 0xFE52, 0xF612, 0xF5B1, 0xE531, 0xA2EC, 0x60A5, 0x6066, 0x68C7, 0x8168, 0x81A7,
+	0x928C, 0x81EA, 0x7148, 0x68C7, 0x68A6, 0x7907, 0x70C6, 0x91A9, 0xD30B, 0xEC2E, 0xF48F, 0xECAE, 0xECAF, 0xF4D0, 0xF4B0, 0xF491, 0x9209, 0x7106, 0xA2CF, 0x79CC, 0x4026, 0x48A7, 0x696B, 0x6129, 0x50C9, 0x694B, 0x8A0E, 0x612B, 0x50E9, 0x722F, 0x9B33, 0x824F, 0x8290, 0xABD5, 0x8B12, 0x61CE, 0x7A70, 0x8AD1, 0x7A50, 0x9B32, 0xA3B2, 0x92D0, 0x8ACE, 0x4886, 0x7129, 0x7949, 0x5086, 0x7149, 0x60C8, 0x58C8, 0x58A7, 0x60E8, 0x60C7, 0x60C7, 0x60A7, 0x6908, 0x68E7, 0x68E7, 0x60A6, 0x8148, 0xAA09, 0xCAAB, 0xD2CB, 0xD2CB, 0xCACC, 0xD2EC, 0xD32D, 0xD34D, 0xDB4D, 0xDB6E, 0xDB6D, 0xDB6D, 0xDB6E, 0xD3AE, 0xDC4F, 0xE4F1, 0xE572, 0xE5D4, 0xE5D4, 0xF616, 0xFE57, 0xEDD6, 0xB411, 0x61A9, 0x4086, 0x4886, 0x60C6, 0x89CA, 0x89EA, 0x8189, 0x8189, 0x89A8, 0x7949, 0x81A9, 0xDC50, 0xC38E, 0xBB4D, 0xC38E, 0xBB4D, 0xB30C, 0xB30C, 0xAACB, 0xA28B, 0xA26A, 0x9A6A, 0x9A6B, 0x9A8B, 0x9AAB, 0x9AAC, 0xA2EC, 0x9AAC, 0x928B, 0xE510, 0xFE72, 0xFE31, 0xF632, 0xF653, 0xFE52, 0xFE52, 0xF5F2, 0xE4F1, 0x9A89, 0x60A4, 0x6086, 0x70E9, 0x8149, 0x89A9, 0x91C8,
+	0xB3B0, 0xAB4F, 0x926C, 0x7989, 0x7928, 0x7908, 0x6885, 0x8147, 0xCAEB, 0xEC0E, 0xEC8F, 0xECAF, 0xECAF, 0xF4D0, 0xF4B1, 0xD36D, 0x89C8, 0xAB0E, 0xB371, 0x4846, 0x4887, 0x4887, 0x58E9, 0x822D, 0x4046, 0x50A8, 0x9290, 0x79ED, 0x616B, 0x3847, 0x8AD1, 0x92F1, 0x722E, 0x9312, 0x69CE, 0x82B1, 0x7A91, 0x8AF2, 0x9312, 0x9B53, 0xB3D3, 0x694A, 0x92EE, 0x69AA, 0x68C8, 0x7108, 0x5046, 0x7129, 0x60C8, 0x58A8, 0x58A7, 0x58E8, 0x6108, 0x58A7, 0x60C7, 0x68E8, 0x7129, 0x6908, 0x60A7, 0x7908, 0xA20A, 0xC28A, 0xCAAA, 0xD2AB, 0xD2EC, 0xD2EC, 0xD30C, 0xDB2D, 0xDB4D, 0xDB4D, 0xDB4D, 0xDB4D, 0xDB6E, 0xE3CE, 0xE470, 0xE512, 0xE592, 0xE5B2, 0xEDD3, 0xEDD4, 0xEDF4, 0xF615, 0xFE78, 0xEDF7, 0x932D, 0x3864, 0x5087, 0x81AC, 0x81EB, 0x7969, 0x8169, 0x8167, 0x7928, 0x89CA, 0xD450, 0xC38D, 0xC3AE, 0xBBAE, 0xBBAE, 0xBB6E, 0xBB6D, 0xB34D, 0xAB0C, 0xAAAB, 0xA28B, 0x9A4A, 0x922A, 0x9209, 0x9229, 0xAACB, 0x9A4A, 0x8187, 0xD4AE, 0xFE52, 0xFE31, 0xFE53, 0xFE53, 0xFE32, 0xFDF2, 0xED32, 0xA26A, 0x6063, 0x7107, 0x8169, 0x8169, 0x89AA, 0x91A9, 0x91A9,
+	0xA3B0, 0xB3D1, 0xAB90, 0x9ACD, 0x8A0B, 0x8169, 0x6065, 0x8127, 0xCAEB, 0xEC0E, 0xEC8F, 0xEC8E, 0xECCF, 0xECAF, 0xEC4F, 0xD36C, 0xC36F, 0xB390, 0x79AA, 0x5046, 0x5088, 0x4867, 0x696B, 0xA2F1, 0x718B, 0x820D, 0x8A6F, 0x71AC, 0x612B, 0x614A, 0x71ED, 0x69CD, 0x9B53, 0x720E, 0x616C, 0x7A2F, 0x9313, 0x9313, 0xABD5, 0x9352, 0x826F, 0x926F, 0x6188, 0x9B10, 0x68E9, 0x68E8, 0x5067, 0x796A, 0x68E9, 0x60C8, 0x58A8, 0x58E8, 0x6949, 0x60E8, 0x60C7, 0x68E8, 0x7128, 0x7969, 0x68C7, 0x7928, 0xA20A, 0xBA8B, 0xCA8B, 0xD2CB, 0xD2EC, 0xCACC, 0xDB2D, 0xDB6D, 0xDB6D, 0xDB4D, 0xD32D, 0xDB6D, 0xE3AE, 0xEBEF, 0xE470, 0xE4F1, 0xED72, 0xED92, 0xED92, 0xEDB2, 0xEDD4, 0xEDF4, 0xF614, 0xF676, 0xFEB8, 0xBC52, 0x50C7, 0x60E9, 0x81CA, 0x7148, 0x7929, 0x8188, 0x70E7, 0x920A, 0xD430, 0xC3AE, 0xCC0F, 0xC3EE, 0xC3EE, 0xBBAE, 0xBB8E, 0xBBAE, 0xBB8E, 0xB32D, 0xB30D, 0xAACC, 0xA28C, 0x9A2A, 0xA28A, 0xC34D, 0xAA6A, 0x89A7, 0xE50F, 0xFE72, 0xFE52, 0xFE74, 0xFE74, 0xFE32, 0xE4F0, 0x9208, 0x6044, 0x8148, 0x91C9, 0x8168, 0x89A9, 0x9A0A, 0x99C9, 0x9189,
+	0x9B90, 0xAC11, 0xB452, 0xB3D0, 0x9AED, 0x81C9, 0x60A5, 0x8127, 0xCAEB, 0xEC2E, 0xF4AF, 0xECAF, 0xECAE, 0xF4CF, 0xEC4E, 0xDBCD, 0xED36, 0x926C, 0x6948, 0x58A7, 0x5088, 0x5088, 0x6109, 0x692A, 0x822E, 0x822E, 0x612A, 0x614A, 0x79AD, 0x8A4F, 0x50C8, 0x828F, 0x69CC, 0x590A, 0x616C, 0x7A0F, 0x8250, 0x9B73, 0x9BB4, 0xB456, 0x69AC, 0x824E, 0x82AD, 0x8AAF, 0x81CD, 0x5887, 0x50A7, 0x7169, 0x60E9, 0x60E9, 0x58C8, 0x58E8, 0x6129, 0x58E8, 0x60C7, 0x7129, 0x7928, 0x91EB, 0x68C7, 0x70E7, 0xA20A, 0xBA8B, 0xCACB, 0xCAAB, 0xCAAB, 0xDB2D, 0xDB2D, 0xDB4D, 0xDB6D, 0xDB4D, 0xDB4D, 0xDB6D, 0xDBEE, 0xE42F, 0xE470, 0xE4B0, 0xED11, 0xE552, 0xED72, 0xF592, 0xEDD3, 0xF5D3, 0xF614, 0xF634, 0xF655, 0xFEDA, 0xC4B3, 0x58E6, 0x7169, 0x6907, 0x7929, 0x8989, 0x68A6, 0x920B, 0xDC4F, 0xCBAD, 0xCC0F, 0xC3EF, 0xC3EF, 0xC3EF, 0xBBCF, 0xBBAE, 0xBB8E, 0xB38E, 0xB36D, 0xAB2D, 0xAB2D, 0xA2CB, 0xAACA, 0xC36C, 0xB289, 0xB2A9, 0xF5B2, 0xFE93, 0xFE72, 0xFE93, 0xFE53, 0xFDF2, 0xB36C, 0x6044, 0x7928, 0x9A0B, 0x91A8, 0x91A8, 0xA229, 0xA22A, 0x99E9, 0x91C9,
+	0x930E, 0xA3D1, 0xB432, 0xB452, 0xB3F0, 0x9AAC, 0x68C5, 0x8107, 0xC2EB, 0xEC2F, 0xF4CF, 0xECCF, 0xECCF, 0xF4CF, 0xEC2D, 0xE40E, 0xD493, 0x9AEE, 0x58C7, 0x5087, 0x58C9, 0x58C9, 0x714B, 0x60C9, 0x58E9, 0x58E9, 0x614A, 0x612A, 0x58C9, 0x58E9, 0x48A8, 0x7A4E, 0x69AC, 0x592B, 0x696C, 0x79EF, 0x8250, 0x8290, 0xA3F5, 0x9BB3, 0x9332, 0x7A2E, 0xB433, 0x722C, 0x92B0, 0x5087, 0x50C8, 0x7169, 0x6909, 0x60E9, 0x58E8, 0x58E8, 0x6149, 0x6108, 0x60C8, 0x7129, 0x8147, 0xAA6C, 0x8148, 0x6885, 0xA20A, 0xCACC, 0xC28A, 0xCA8B, 0xD30C, 0xDB2D, 0xDB4D, 0xDB4D, 0xDB4D, 0xDB4D, 0xDB6D, 0xE3AE, 0xDC0E, 0xE44F, 0xE470, 0xE490, 0xE4F1, 0xE511, 0xED52, 0xED72, 0xED92, 0xF5D3, 0xF5F4, 0xF635, 0xF656, 0xF656, 0xFEFA, 0xBC51, 0x58C5, 0x60A6, 0x7908, 0x8168, 0x68A6, 0xA28D, 0xD42E, 0xCBAE, 0xCC0F, 0xC3EE, 0xC3CE, 0xC3CF, 0xC3CF, 0xBBCF, 0xBBAF, 0xBB8E, 0xAB8E, 0xAB6E, 0xAB4D, 0xAB2C, 0xB30A, 0xC36B, 0xBAE9, 0xD3AC, 0xFE34, 0xFE93, 0xFE93, 0xFE93, 0xFE32, 0xE50F, 0x9228, 0x70C7, 0x9A0A, 0x9A0A, 0x99C9, 0xA20A, 0xBA8B, 0xAA2A, 0x91C8, 0xA209,
+	0x6149, 0x92EF, 0xAC12, 0xBCB3, 0xBCB2, 0xA36E, 0x68E6, 0x8107, 0xCB0C, 0xEC2F, 0xF4D0, 0xECEF, 0xF4EF, 0xF4F0, 0xEC4E, 0xEC0E, 0xC3CF, 0x7189, 0x5087, 0x4888, 0x5087, 0x58E8, 0x6129, 0x6109, 0x50A8, 0x5088, 0x822E, 0x696B, 0x50A8, 0x5909, 0x698C, 0x4888, 0x824F, 0x612B, 0x616C, 0x616C, 0x7A50, 0x82B1, 0x9B73, 0x9352, 0xAC15, 0x9B30, 0x820D, 0x92F0, 0x9B91, 0x4927, 0x4866, 0x7129, 0x6907, 0x60C7, 0x5887, 0x60A8, 0x6949, 0x60E8, 0x5886, 0x68E8, 0x8947, 0xBAAB, 0x91C9, 0x6065, 0x99EA, 0xC28B, 0xCA8B, 0xD30C, 0xD30C, 0xDB2C, 0xDB4D, 0xDB4D, 0xDB4D, 0xDB6D, 0xDB6D, 0xDBAE, 0xE3EE, 0xE42E, 0xE44F, 0xE48F, 0xE4D0, 0xE4F1, 0xE511, 0xE552, 0xED72, 0xF5B3, 0xF5D3, 0xF614, 0xF635, 0xF656, 0xF677, 0xFEF9, 0x9B2D, 0x4845, 0x68E6, 0x70E8, 0x6066, 0xAB0C, 0xCC0E, 0xCBCE, 0xCBEE, 0xC3EE, 0xC3EE, 0xC3CE, 0xC3CE, 0xC3CF, 0xBBCF, 0xBB8F, 0xB38E, 0xB38E, 0xAB6E, 0xB34D, 0xC34B, 0xCB6B, 0xBB29, 0xE4AD, 0xFE74, 0xF6B3, 0xF6B2, 0xFE72, 0xFDD2, 0xC38C, 0x8146, 0x91A9, 0x9A0A, 0x99E9, 0xA22A, 0xB28B, 0xB26B, 0xA1E9, 0x9A0A, 0xA24B,
+	0x4846, 0x71CA, 0xABD1, 0xC4F4, 0xBCD2, 0xABEF, 0x7148, 0x70A6, 0xCB0B, 0xEC2F, 0xF4D0, 0xECEF, 0xED0F, 0xF4EF, 0xF44E, 0xE3CD, 0xCBF0, 0x820A, 0x4866, 0x48A8, 0x5087, 0x696A, 0x5908, 0x50C7, 0x58C8, 0x58C9, 0x8A6F, 0x612A, 0x6109, 0x4867, 0x71AC, 0x592A, 0x696C, 0x71AD, 0x71EE, 0x7A2F, 0x69CD, 0x7A70, 0x82B1, 0x9312, 0xAC35, 0xB414, 0x4887, 0x7A0D, 0xBC95, 0x5989, 0x4025, 0x7108, 0x6908, 0x68C7, 0x5887, 0x58A8, 0x6949, 0x6108, 0x60C7, 0x68C7, 0x9967, 0xCACB, 0x99EA, 0x6065, 0x91A8, 0xC28A, 0xDAEC, 0xDB0C, 0xD30C, 0xDB0C, 0xDB2C, 0xDB4D, 0xDB4D, 0xDB6D, 0xDB6D, 0xDBAE, 0xDBCE, 0xEC0E, 0xE42F, 0xE46F, 0xE490, 0xE4D1, 0xE511, 0xED31, 0xED72, 0xEDB2, 0xF5D3, 0xF614, 0xF635, 0xF656, 0xF677, 0xFED8, 0xF618, 0x6128, 0x58A5, 0x68A8, 0x6046, 0xB34C, 0xC3CD, 0xCBEE, 0xC3EE, 0xC3EE, 0xC3CE, 0xC3EE, 0xBBCE, 0xBBAE, 0xBBAF, 0xBBAE, 0xBBAE, 0xB38E, 0xAB6E, 0xB34D, 0xBB2B, 0xCBAB, 0xD40B, 0xED50, 0xFE94, 0xFEB3, 0xF691, 0xFE72, 0xF571, 0xA249, 0x8967, 0x99EA, 0x99E9, 0xA22A, 0xB26B, 0xB26B, 0xA1E9, 0xA1E9, 0xA24B, 0xA26B,
+	0x4826, 0x58C7, 0xA371, 0xCCF5, 0xC4F3, 0xB431, 0x6927, 0x6866, 0xC30B, 0xEC2E, 0xECCF, 0xECEF, 0xF50F, 0xF4EF, 0xF46E, 0xDB6B, 0xB32D, 0x8A2B, 0x4866, 0x4888, 0x58C8, 0x6109, 0x50A7, 0x58C9, 0x4888, 0x590A, 0x92B0, 0x58E9, 0x694A, 0x4846, 0x50A8, 0x79CC, 0x71CD, 0x612B, 0x71CE, 0x8A91, 0x8290, 0x69CD, 0x7A70, 0xA3D5, 0xAC56, 0x82CF, 0x48A8, 0x7A0E, 0xDD9A, 0x5989, 0x4025, 0x7108, 0x7149, 0x68C7, 0x5887, 0x58C8, 0x6129, 0x58C7, 0x60A7, 0x68C7, 0xA9E9, 0xC289, 0xA1C9, 0x6865, 0x91C8, 0xCACB, 0xD2CB, 0xD2EB, 0xDB0C, 0xD30C, 0xDB2C, 0xDB4D, 0xDB4D, 0xDB6D, 0xE38E, 0xDB8D, 0xDBCD, 0xE3EE, 0xE42E, 0xE44F, 0xDC8F, 0xE4D0, 0xE4F1, 0xE531, 0xED72, 0xED92, 0xF5D3, 0xF614, 0xF636, 0xF656, 0xF677, 0xF677, 0xFEFA, 0xABD0, 0x4843, 0x5867, 0x6046, 0xC38E, 0xCBCD, 0xCC0E, 0xCC0E, 0xC3EE, 0xC3EE, 0xC3CE, 0xBBCE, 0xBBAE, 0xBBAE, 0xBBAE, 0xBBAE, 0xB38E, 0xAB4E, 0xAB0B, 0xBB8B, 0xE4CF, 0xF590, 0xFE12, 0xFEB4, 0xFEB3, 0xFE92, 0xFE32, 0xD44D, 0x91C6, 0xA1E9, 0xA1CA, 0xA22A, 0xAA6A, 0xB28B, 0xA209, 0x99C8, 0xA22A, 0xA26B, 0x9A4B,
+	0x4826, 0x58C8, 0x9B2F, 0xC4D5, 0xC514, 0xB431, 0x6107, 0x6885, 0xC2EB, 0xEC2E, 0xF4EF, 0xECEF, 0xF50F, 0xF4EF, 0xFC8E, 0xE3AC, 0xC36E, 0x820B, 0x4887, 0x50A8, 0x58E9, 0x58C8, 0x50A7, 0x58C9, 0x4868, 0x71AC, 0x9B11, 0x4866, 0x612A, 0x58C8, 0x58E9, 0x60E9, 0x590A, 0x610A, 0x71AD, 0x8270, 0x7A50, 0x69EE, 0x722E, 0xA3D5, 0xA3F5, 0x9B93, 0x4088, 0x71CD, 0xCCF7, 0x40A6, 0x4866, 0x7949, 0x7969, 0x6907, 0x60A6, 0x60C8, 0x6929, 0x58A7, 0x60A6, 0x7907, 0xB209, 0xBA69, 0xAA0A, 0x6886, 0x99C8, 0xD2AA, 0xDAEC, 0xDAEB, 0xDB2C, 0xDB4C, 0xDB2C, 0xDB2C, 0xDB4C, 0xDB4C, 0xDB8D, 0xDB8D, 0xDBAD, 0xE3EE, 0xDC0E, 0xDC4F, 0xE490, 0xE4B0, 0xE4F1, 0xE531, 0xE552, 0xED72, 0xEDB3, 0xF5F5, 0xF636, 0xF656, 0xF677, 0xF677, 0xFED8, 0xEE17, 0x5905, 0x4805, 0x6887, 0xCBAF, 0xCBCE, 0xCC0E, 0xCC0E, 0xC40E, 0xC3EE, 0xC3EE, 0xBBCE, 0xBBAE, 0xBB8E, 0xB38E, 0xB38E, 0xB36E, 0xAB2C, 0xB36C, 0xE4F0, 0xFDF2, 0xF5F1, 0xFE52, 0xFEB4, 0xFEB3, 0xFE72, 0xF590, 0xB309, 0x99C7, 0xA1E9, 0xAA0A, 0xB26A, 0xBAAB, 0xB24A, 0x99C8, 0x9A09, 0xA26B, 0x9A4B, 0x9A6C,
+	0x4806, 0x4866, 0x8ACE, 0xBCD4, 0xC514, 0xB431, 0x6127, 0x6065, 0xC2EB, 0xEC4E, 0xF4EF, 0xED0E, 0xED0F, 0xFD0F, 0xF48E, 0xE3CD, 0xC3AF, 0x6107, 0x50A7, 0x58E9, 0x58C8, 0x5087, 0x50A7, 0x5088, 0x4047, 0x9AF1, 0x92B0, 0x4867, 0x58C8, 0x60E9, 0x60E9, 0x58C8, 0x50A8, 0x58C9, 0x614B, 0x71EE, 0x8AF2, 0x594C, 0x69ED, 0xA3D5, 0xA3D5, 0x9B72, 0x722E, 0x8290, 0xBC75, 0x7A6D, 0x4846, 0x796A, 0x7128, 0x68E7, 0x60C7, 0x58C7, 0x60E8, 0x60C8, 0x68A6, 0x8968, 0xBA4A, 0xD2EA, 0xBA4A, 0x70A6, 0xA1E9, 0xCAAA, 0xDAEB, 0xDB0B, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xE36D, 0xE38D, 0xDB8D, 0xE3CE, 0xE3EE, 0xE42F, 0xE46F, 0xE490, 0xECD1, 0xE511, 0xE551, 0xED93, 0xEDB3, 0xEDF5, 0xF636, 0xF656, 0xF677, 0xF677, 0xF697, 0xFF1A, 0x8AEB, 0x3803, 0x7108, 0xD3AF, 0xCBCE, 0xCC0E, 0xC40E, 0xC3EE, 0xC3EE, 0xBBCE, 0xBBAE, 0xBBAE, 0xB38E, 0xB38E, 0xB34E, 0xB34E, 0xAB0C, 0xC3ED, 0xFE33, 0xFE73, 0xF632, 0xFE73, 0xFEB3, 0xFE93, 0xFE32, 0xDC6D, 0xA247, 0xA1C7, 0xA1C9, 0xAA0A, 0xBA8A, 0xBAAB, 0xA209, 0x99C8, 0xA24A, 0xA26B, 0x9A4B, 0x9A6C,
+	0x4806, 0x4826, 0x826D, 0xBCD4, 0xC534, 0xB451, 0x6968, 0x5844, 0xC2EB, 0xEC4F, 0xECF0, 0xED0F, 0xED0F, 0xF50F, 0xF48E, 0xDBCD, 0xAAED, 0x60C7, 0x6109, 0x50A8, 0x5087, 0x5087, 0x5087, 0x4867, 0x71ED, 0x8A6F, 0x79ED, 0x4867, 0x50C8, 0x694A, 0x58C8, 0x4867, 0x58C8, 0x58C9, 0x590A, 0x614B, 0x92F2, 0x71EE, 0x724F, 0xABF5, 0xABF5, 0x9B71, 0x9B72, 0xBC56, 0x82AE, 0x698A, 0x58A8, 0x6908, 0x6908, 0x68E7, 0x60E7, 0x60E7, 0x58A7, 0x60A7, 0x7907, 0xAA0A, 0xD2CC, 0xD2CA, 0xB20A, 0x78C6, 0xA229, 0xCAAA, 0xDACB, 0xDB0C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB6C, 0xDB6D, 0xDB8D, 0xE3CE, 0xE3EE, 0xE42F, 0xDC4F, 0xDC8F, 0xE4B1, 0xE4F1, 0xE531, 0xED73, 0xEDB3, 0xEDF4, 0xF616, 0xF636, 0xF657, 0xFE77, 0xF677, 0xFEF9, 0xC4B2, 0x3803, 0x8168, 0xD3CE, 0xCBEE, 0xCC2E, 0xC3EE, 0xC3EE, 0xC3EE, 0xBBCE, 0xBBCE, 0xBBCE, 0xB38D, 0xB38D, 0xB34E, 0xB32D, 0xAAEB, 0xDC8F, 0xFE94, 0xFEB3, 0xF672, 0xF693, 0xFED3, 0xFE73, 0xFD90, 0xC329, 0xAA27, 0xAA08, 0xA1C8, 0xB22A, 0xBAAA, 0xAA49, 0x99E8, 0x9A0A, 0xA26B, 0x9A4B, 0x9A4B, 0x8A0A,
+	0x4826, 0x4046, 0x828D, 0xBCD4, 0xC534, 0xBC92, 0x79C9, 0x6044, 0xC2AA, 0xEC2F, 0xF4D0, 0xECEF, 0xECEF, 0xECEF, 0xEC8E, 0xDBCD, 0xB2EE, 0x7149, 0x58A8, 0x50A8, 0x50A7, 0x50A7, 0x58C8, 0x716B, 0x5909, 0x616A, 0x820D, 0x50C8, 0x58C8, 0x696B, 0x58A8, 0x5068, 0x60C9, 0x58C9, 0x696B, 0x612B, 0x592B, 0x8AD1, 0xA394, 0xA3B5, 0x8AF1, 0x7A6D, 0xABD3, 0xBC56, 0x8AAE, 0x71EB, 0x71AB, 0x6928, 0x60E8, 0x6928, 0x60E6, 0x68E7, 0x60A7, 0x68C7, 0x8947, 0xBA6A, 0xD2CC, 0xD2EA, 0xA9C8, 0x70C6, 0xAA4A, 0xD2CB, 0xDAEC, 0xDB0B, 0xDB4C, 0xE34C, 0xE32C, 0xDB2B, 0xDB2B, 0xDB2C, 0xDB4C, 0xDB6C, 0xDB8D, 0xDBAE, 0xE3CE, 0xE40F, 0xE44F, 0xDC70, 0xE4B0, 0xE4D1, 0xE531, 0xE572, 0xED93, 0xEDD5, 0xEE16, 0xEE36, 0xEE57, 0xF677, 0xF678, 0xFEB8, 0xEE18, 0x4885, 0x8187, 0xD3CE, 0xCBEF, 0xC42E, 0xC3EE, 0xBBEE, 0xBBCE, 0xBBCE, 0xBBCE, 0xBBCE, 0xB3AE, 0xB38D, 0xAB4D, 0xB32C, 0xB32B, 0xE4F0, 0xFE93, 0xF672, 0xF652, 0xFE94, 0xFEB3, 0xFE52, 0xE48D, 0xC2E9, 0xB269, 0xAA09, 0xAA09, 0xB24A, 0xBA8B, 0xAA29, 0x99E9, 0xA22A, 0xA26C, 0x9A2B, 0x920A, 0x89C9,
+	0x4826, 0x4045, 0x722B, 0xB493, 0xC534, 0xC4B2, 0x81E9, 0x6044, 0xC2AA, 0xEC4F, 0xF4D0, 0xECEF, 0xECEF, 0xECEF, 0xEC8E, 0xDBCD, 0xBB2F, 0x7129, 0x5088, 0x50A8, 0x50A7, 0x58C7, 0x58C8, 0x6109, 0x50A7, 0x696A, 0x79EC, 0x58E8, 0x58E9, 0x58E9, 0x58C9, 0x5088, 0x58C8, 0x58E9, 0x79CD, 0x590A, 0x4068, 0x720F, 0x9B94, 0x9333, 0x9B52, 0x69EB, 0x48C7, 0x69AB, 0x71EB, 0x822C, 0x8A2E, 0x926E, 0x9AAF, 0x81EB, 0x6907, 0x60C7, 0x60A7, 0x78E7, 0xA1A8, 0xC28A, 0xD2CB, 0xDB0B, 0xA1A8, 0x8108, 0xB28B, 0xD2EB, 0xDAEC, 0xDB0C, 0xDB4C, 0xE34C, 0xE34C, 0xDB2C, 0xDB0B, 0xDB2B, 0xDB4C, 0xE34C, 0xDB6D, 0xDB8E, 0xE3CE, 0xE3EE, 0xE42F, 0xDC4F, 0xE490, 0xE4B0, 0xE511, 0xE552, 0xED93, 0xEDD4, 0xEDF5, 0xEE16, 0xEE57, 0xF657, 0xF678, 0xF697, 0xFED9, 0x71E9, 0x89A7, 0xD3ED, 0xC3CE, 0xC42E, 0xBBEE, 0xBBCE, 0xBBCE, 0xBBCE, 0xBBAE, 0xBBCE, 0xBBAE, 0xB38E, 0xAB4D, 0xB32C, 0xBB4B, 0xED50, 0xFE93, 0xF651, 0xF653, 0xFEB4, 0xFEB3, 0xF5B1, 0xCB8A, 0xC2A8, 0xBA69, 0xAA09, 0xAA09, 0xB24A, 0xAA4A, 0x99E9, 0x99C9, 0xAA4B, 0xA24C, 0x920B, 0x920B, 0x91EA,
+	0x4846, 0x4025, 0x69AA, 0xB453, 0xC534, 0xBCD2, 0x820A, 0x6065, 0xBAAA, 0xEC2E, 0xECCF, 0xED0F, 0xED0F, 0xF50F, 0xEC8E, 0xDBEE, 0xB30E, 0x60C7, 0x58C8, 0x50A8, 0x5088, 0x5087, 0x58A8, 0x6129, 0x58C8, 0x6109, 0x614A, 0x58E9, 0x50A8, 0x58E9, 0x6129, 0x4866, 0x50C8, 0x58E9, 0x79EE, 0x58EA, 0x698D, 0x71EE, 0x82D1, 0x8B12, 0x8AD1, 0xA393, 0x616B, 0x614A, 0x4866, 0x5066, 0x68E8, 0x68E7, 0x7128, 0x81CB, 0x6929, 0x5887, 0x68A6, 0x8948, 0xA9E9, 0xCAAB, 0xD2CC, 0xD30C, 0x9167, 0x9168, 0xC2AC, 0xDB0A, 0xDB0B, 0xDB4D, 0xDB4C, 0xDB4C, 0xE34D, 0xDB2C, 0xDB0B, 0xDB2C, 0xDB4C, 0xE34C, 0xDB6C, 0xDB8D, 0xDBAE, 0xEBEE, 0xE40F, 0xDC4F, 0xE470, 0xE4B0, 0xDCF0, 0xE532, 0xED93, 0xEDB4, 0xEDF5, 0xEE36, 0xEE36, 0xF637, 0xF657, 0xF677, 0xFEF9, 0xA38D, 0x89E6, 0xD3EE, 0xCBEE, 0xBC2E, 0xC3CE, 0xC3CE, 0xBBCE, 0xBBCE, 0xBBCE, 0xBBCE, 0xBBAE, 0xB36E, 0xAB8D, 0xBB4E, 0xC34B, 0xE4ED, 0xFE70, 0xFE11, 0xFE33, 0xFEB4, 0xFE72, 0xED0F, 0xC2E9, 0xC289, 0xBA6A, 0xA228, 0xAA09, 0xB24A, 0x99A9, 0x91A9, 0xA24B, 0xA26B, 0x9A2A, 0x922B, 0x920B, 0x920B,
+	0x4867, 0x4046, 0x616A, 0xAC12, 0xC514, 0xBCD2, 0x8A6B, 0x68A6, 0xBA89, 0xEC2E, 0xECCF, 0xED0E, 0xED0E, 0xF50F, 0xEC8E, 0xE3ED, 0xCB70, 0x7129, 0x58C8, 0x4867, 0x5088, 0x6109, 0x718B, 0x6109, 0x50A7, 0x6109, 0x6129, 0x58E8, 0x58E9, 0x58C8, 0x6129, 0x50A8, 0x58E9, 0x614A, 0x696B, 0x71CD, 0x594B, 0x8AD2, 0x8B13, 0x9353, 0x69CD, 0x8270, 0x9B52, 0x71ED, 0x614A, 0x58C7, 0x68E8, 0x60C7, 0x68E7, 0x58A7, 0x60C8, 0x5886, 0x70C6, 0x99A8, 0xBA49, 0xCAAB, 0xD2CC, 0xC2CC, 0x7906, 0x99C9, 0xCACC, 0xDB0B, 0xE34C, 0xDB4D, 0xE34D, 0xE36D, 0xDB4C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB6D, 0xE38D, 0xDB8E, 0xE3CE, 0xE3EF, 0xDC2F, 0xE470, 0xE490, 0xDCD0, 0xE511, 0xED73, 0xEDB4, 0xEDD5, 0xEE16, 0xEE36, 0xF636, 0xFE57, 0xF677, 0xFED8, 0xDD33, 0xA2A9, 0xD3AE, 0xC3AE, 0xBBEE, 0xC3EE, 0xC3EE, 0xC40F, 0xBBEF, 0xBBEE, 0xBBCE, 0xB3AE, 0xB38D, 0xB38D, 0xC36E, 0xCB4C, 0xCBEA, 0xE4EC, 0xED4F, 0xFE33, 0xFEB3, 0xFE71, 0xE48D, 0xBAA9, 0xBA49, 0xAA29, 0x9A08, 0xAA2A, 0xA1C9, 0x8947, 0xA22A, 0xAA6B, 0x9A2A, 0x91EA, 0x920B, 0x922B, 0x922B,
+	0x4887, 0x4046, 0x5929, 0xABF2, 0xBCF4, 0xBCB2, 0x92ED, 0x70E6, 0xBA69, 0xEC0E, 0xF4AF, 0xECEE, 0xECEE, 0xECEF, 0xEC8E, 0xDBCD, 0xCB90, 0x81AA, 0x60E8, 0x4867, 0x58E9, 0x696A, 0x58E9, 0x5087, 0x50A7, 0x694A, 0x6109, 0x58E9, 0x612A, 0x6109, 0x6109, 0x58E8, 0x58E9, 0x71CD, 0x4888, 0x720E, 0x616C, 0x594B, 0x720E, 0x9312, 0x720D, 0x5129, 0x9311, 0xC476, 0x7A0C, 0x50A6, 0x58C7, 0x60E7, 0x60C7, 0x58A7, 0x5887, 0x5886, 0x7906, 0xA9E8, 0xC28A, 0xCAAA, 0xCAEC, 0xAA2A, 0x78E6, 0xB24A, 0xD30C, 0xDB0C, 0xE34D, 0xDB4D, 0xE36D, 0xEB6D, 0xDB4C, 0xE34C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB6D, 0xDB8D, 0xE3AD, 0xE3AE, 0xDBEE, 0xDC0E, 0xDC4F, 0xDC6F, 0xDCD0, 0xE511, 0xE552, 0xE593, 0xEDD5, 0xEDF6, 0xF636, 0xF657, 0xFE58, 0xF677, 0xF677, 0xFE37, 0xC3CE, 0xC34D, 0xAA8A, 0xAB0C, 0xB34C, 0xBBAE, 0xBBEE, 0xBC0E, 0xBC0E, 0xBBEE, 0xBBEE, 0xB3CD, 0xBBCC, 0xCBAE, 0xDBAE, 0xD3AB, 0xC389, 0xDC8D, 0xFE73, 0xFEB2, 0xFDF0, 0xD3EB, 0xBA69, 0xBA29, 0xA1C9, 0xA1E9, 0xA20A, 0x9167, 0x91A9, 0xAA6B, 0xA24A, 0x91E9, 0x91EA, 0x922B, 0x922B, 0x89AA,
+	0x4867, 0x4026, 0x5909, 0xA3B1, 0xBD13, 0xC4F2, 0x92EC, 0x68E6, 0xBA69, 0xEC0E, 0xF4AF, 0xF4CE, 0xECEE, 0xF4EF, 0xF4AE, 0xE3CD, 0xC32E, 0x89AA, 0x6108, 0x4887, 0x50C8, 0x50C8, 0x50A7, 0x50C8, 0x5909, 0x612A, 0x58E9, 0x694A, 0x612A, 0x50A7, 0x58E9, 0x4867, 0x5909, 0x612A, 0x48A9, 0x722E, 0x9312, 0x510A, 0x4067, 0x698C, 0x7A0E, 0x592A, 0x826F, 0x9B11, 0x50C7, 0x58C7, 0x5086, 0x60C7, 0x58A7, 0x5086, 0x5886, 0x70E6, 0x9147, 0xBA29, 0xCA8A, 0xCAAA, 0xCAEC, 0x8948, 0x8107, 0xC2CB, 0xDB2C, 0xDB0C, 0xDB2D, 0xDB6C, 0xE36D, 0xE36D, 0xDB4C, 0xE34C, 0xE34C, 0xDB4C, 0xDB2C, 0xDB4C, 0xDB6C, 0xE38D, 0xE3AD, 0xE3AD, 0xE3CE, 0xE40E, 0xE44F, 0xE46F, 0xDC8F, 0xE4D0, 0xE532, 0xE573, 0xEDB4, 0xEDD5, 0xEE16, 0xF657, 0xF657, 0xF677, 0xF697, 0xFE98, 0xDC91, 0x9208, 0x89A7, 0x89E8, 0x9249, 0xA2AA, 0xA2EC, 0xB36D, 0xB3AE, 0xBBAE, 0xBBCE, 0xBBEE, 0xC3EE, 0xD42E, 0xD3CD, 0xCB4B, 0xC38B, 0xED0F, 0xFEB4, 0xFEB2, 0xF56E, 0xCB49, 0xB249, 0xA9A9, 0xA1A9, 0xAA2B, 0x9187, 0x8967, 0xA22B, 0xA22B, 0x9A0A, 0x920A, 0x9A4B, 0x922B, 0x89EB, 0x7128,
+	0x4846, 0x4846, 0x50A7, 0x9B90, 0xCD55, 0xC533, 0xA34E, 0x6906, 0xB228, 0xE3EE, 0xEC8F, 0xECCE, 0xF4EE, 0xF4EF, 0xF4AE, 0xDBED, 0xB2CC, 0x91EB, 0x6929, 0x5067, 0x58E8, 0x50A7, 0x50A7, 0x5909, 0x610A, 0x6109, 0x58C8, 0x692A, 0x612A, 0x5087, 0x5087, 0x50A7, 0x50A8, 0x592A, 0x69AC, 0x7A6F, 0x9B53, 0x826F, 0x590A, 0x590A, 0x590A, 0x7A0D, 0x822D, 0x71AB, 0x58A7, 0x58A7, 0x5886, 0x58A7, 0x5087, 0x5066, 0x60A6, 0x8147, 0xA1C8, 0xCA8A, 0xCA8A, 0xCACB, 0xAA4A, 0x7085, 0xA1C9, 0xD30C, 0xDB2B, 0xDB0C, 0xE34D, 0xE36C, 0xE36D, 0xE34C, 0xE34C, 0xE34C, 0xE34C, 0xDB4C, 0xDB2B, 0xDB2B, 0xDB4C, 0xDB6C, 0xE38D, 0xE3AD, 0xDBAD, 0xE3EE, 0xE42E, 0xE44F, 0xE48F, 0xE4B0, 0xE4F1, 0xED73, 0xED93, 0xEDD5, 0xEE16, 0xF636, 0xF657, 0xF677, 0xF677, 0xFEB8, 0xDD13, 0x8186, 0x8988, 0x8167, 0x8167, 0x89A8, 0x89C8, 0x920A, 0x924A, 0x9AAB, 0xA2EC, 0xB36E, 0xC40E, 0xDC6E, 0xCBEC, 0xC36A, 0xCBCC, 0xF5D2, 0xFED3, 0xFE71, 0xE46C, 0xB2A8, 0xA1A7, 0x9128, 0x99CA, 0x99EA, 0x8147, 0x9A0A, 0xA24B, 0x9A0A, 0x920A, 0x922A, 0x9A6C, 0x922B, 0x8189, 0x68E7,
+	0x5065, 0x4805, 0x4886, 0x9B70, 0xCD34, 0xCD34, 0xB3D0, 0x7127, 0xAA08, 0xE3CE, 0xEC8F, 0xECEE, 0xECEE, 0xF4EE, 0xF4CF, 0xDBCD, 0xA26B, 0x922C, 0x6909, 0x5087, 0x50A8, 0x4886, 0x58C8, 0x614A, 0x50C8, 0x6129, 0x50A8, 0x612A, 0x6129, 0x6109, 0x50A7, 0x58C8, 0x58E9, 0x50E9, 0x48A8, 0x69CC, 0x8AD1, 0xABD5, 0x8290, 0x720E, 0x9290, 0x79CC, 0x5086, 0x58C7, 0x60C8, 0x5887, 0x58A7, 0x5066, 0x5067, 0x5886, 0x68E6, 0x9988, 0xBA49, 0xCAAA, 0xC28B, 0xC2AC, 0x78E5, 0x78E5, 0xC2AC, 0xDB2C, 0xDB2B, 0xDB2C, 0xDB4C, 0xDB6C, 0xE34C, 0xE34C, 0xE36C, 0xE34C, 0xE34C, 0xDB4C, 0xDB2B, 0xDB2B, 0xDB2C, 0xDB4C, 0xDB6C, 0xE38D, 0xE3AD, 0xE3ED, 0xDC0E, 0xDC2E, 0xE46F, 0xECAF, 0xE4F1, 0xE532, 0xE573, 0xEDD5, 0xEDF6, 0xEE16, 0xF637, 0xF677, 0xEE77, 0xFE98, 0xF5F6, 0x8A08, 0x9209, 0x9A0A, 0x91C9, 0x8988, 0x8168, 0x7927, 0x7127, 0x7147, 0x6928, 0x79C9, 0xA2CB, 0xBBAB, 0xDCCE, 0xE4AE, 0xDC8D, 0xFE32, 0xFED3, 0xF5B0, 0xC34B, 0x99A7, 0x80E5, 0x9148, 0x91A9, 0x8968, 0x91E9, 0xA26B, 0x99EA, 0x920A, 0x91EA, 0x924B, 0x9A4B, 0x8A0B, 0x7148, 0x60C6,
+	0x60A6, 0x68E8, 0x6108, 0x9B4F, 0xCD54, 0xD575, 0xBC31, 0x7167, 0xAA29, 0xE3EE, 0xEC8F, 0xF4EE, 0xECEE, 0xF50F, 0xFCEF, 0xD38B, 0xA24B, 0x89EB, 0x58A8, 0x50A8, 0x5088, 0x58C8, 0x58E8, 0x58E8, 0x58C7, 0x5909, 0x58C8, 0x694A, 0x6109, 0x6109, 0x58E9, 0x50A7, 0x50A7, 0x58E8, 0x58C9, 0x5088, 0x69CD, 0xA3B5, 0xA3D5, 0x82D0, 0x822E, 0x8A2E, 0x5086, 0x58C7, 0x50A6, 0x5887, 0x5887, 0x4866, 0x5066, 0x6086, 0x8147, 0xA9E8, 0xC269, 0xCA8A, 0xCAEC, 0x9147, 0x6044, 0xAA2A, 0xD30B, 0xE30C, 0xE32B, 0xDB4B, 0xDB4C, 0xDB4C, 0xDB4C, 0xDB6C, 0xE36C, 0xE34C, 0xE34C, 0xE34B, 0xDB2B, 0xDB2B, 0xDB2C, 0xDB4C, 0xDB4C, 0xDB6C, 0xE3AD, 0xDBCD, 0xE3EE, 0xDC0E, 0xE42F, 0xE48F, 0xE4D0, 0xE531, 0xE552, 0xEDB4, 0xEDF5, 0xEDF6, 0xF637, 0xF657, 0xEE77, 0xF697, 0xFEB8, 0xA32C, 0x8A09, 0xA26B, 0xA24A, 0x9A2A, 0x91C9, 0x8168, 0x7128, 0x60A6, 0x5086, 0x5065, 0x68E6, 0xC40D, 0xFE31, 0xE4ED, 0xE4ED, 0xFE92, 0xFE91, 0xE4CD, 0xA208, 0x78E6, 0x7907, 0x8989, 0x8147, 0x91A8, 0xA28C, 0x9A4B, 0x91CA, 0x89C9, 0x920A, 0x9A6C, 0x926C, 0x81A9, 0x6907, 0x60A6,
+	0x89CA, 0x89CB, 0x81CA, 0x9B4E, 0xC534, 0xD595, 0xBC72, 0x81C8, 0xAA28, 0xE3CD, 0xECAF, 0xF50F, 0xECEE, 0xF50F, 0xFCEF, 0xCB4B, 0xAAAD, 0x8A0C, 0x5067, 0x50C9, 0x6109, 0x60E9, 0x5087, 0x58C8, 0x58C8, 0x50C8, 0x6109, 0x6129, 0x614A, 0x6109, 0x58A8, 0x5087, 0x50A7, 0x50C8, 0x694A, 0x58EA, 0x4888, 0x71ED, 0x9BB4, 0x9BB4, 0x826E, 0x9AD0, 0x6109, 0x50A6, 0x5086, 0x5086, 0x4887, 0x4866, 0x5866, 0x7107, 0x9188, 0xBA49, 0xCA89, 0xD2EB, 0x99A8, 0x6023, 0x9168, 0xCAEC, 0xD30A, 0xDB0C, 0xDB2C, 0xDB4B, 0xDB4B, 0xDB4D, 0xDB4C, 0xDB4C, 0xE36C, 0xE36C, 0xEB6C, 0xE34C, 0xDB4C, 0xDB2B, 0xDB4C, 0xDB6C, 0xDB4C, 0xDB6C, 0xDB8C, 0xDBAC, 0xE3EE, 0xE40E, 0xDC2E, 0xE46F, 0xE4B0, 0xE4F1, 0xE552, 0xE5B4, 0xEDD5, 0xEDF6, 0xEE37, 0xF657, 0xF677, 0xF677, 0xFED9, 0xC470, 0x81C8, 0xA26B, 0xA28A, 0xA26A, 0x9A2A, 0x91EA, 0x8189, 0x6928, 0x58C7, 0x4845, 0x68A6, 0xE4F0, 0xFE50, 0xDCCB, 0xED6E, 0xFE92, 0xFDD0, 0xAAA7, 0x70A5, 0x78E7, 0x8168, 0x8148, 0x8167, 0xA24B, 0xA26B, 0x89C9, 0x89A9, 0x89A9, 0x922B, 0xA2AD, 0x924B, 0x81A9, 0x7148, 0x68E7,
+	0x8A0A, 0x8A2A, 0x928C, 0xA3B0, 0xC533, 0xD594, 0xC4B3, 0x8A4A, 0xAA29, 0xE3CD, 0xEC8E, 0xECEF, 0xED0F, 0xF52F, 0xFCEF, 0xCB4B, 0xA28D, 0x89EB, 0x50A7, 0x50A8, 0x58A7, 0x58A7, 0x50A7, 0x58E8, 0x58E9, 0x50C8, 0x58C8, 0x5909, 0x612A, 0x6109, 0x6109, 0x5087, 0x58E9, 0x5909, 0x6109, 0x6109, 0x612A, 0x614B, 0x69CD, 0x8AD0, 0x9B31, 0x71CC, 0x50A7, 0x58A7, 0x58A7, 0x5087, 0x5046, 0x5066, 0x68A7, 0x8927, 0xA9E8, 0xCAAA, 0xCACB, 0x9187, 0x6024, 0x8148, 0xC28A, 0xD2EB, 0xDAEB, 0xDB2C, 0xDB2C, 0xE34C, 0xDB4C, 0xDB2C, 0xDB4C, 0xE34C, 0xE36D, 0xE34C, 0xE36D, 0xDB4C, 0xDB4C, 0xDB4C, 0xDB2C, 0xDB4C, 0xDB4C, 0xDB4C, 0xE38D, 0xDBAD, 0xDBCD, 0xE3EE, 0xE42F, 0xE44F, 0xE48F, 0xE4D1, 0xE532, 0xE573, 0xE5D4, 0xEDF5, 0xEE17, 0xEE37, 0xF657, 0xEE57, 0xFEB8, 0xE594, 0x89E8, 0x9A2A, 0xA28B, 0xA28A, 0xA24A, 0x9209, 0x89EA, 0x79A9, 0x7127, 0x68C6, 0x7906, 0xD44F, 0xFE11, 0xF5AE, 0xFDAE, 0xF570, 0xB30B, 0x70C5, 0x6886, 0x8128, 0x7947, 0x8147, 0x922A, 0xA28C, 0x89EA, 0x8169, 0x8189, 0x89EA, 0xA28D, 0xA2AC, 0x8A0A, 0x81AA, 0x7128, 0x7108,
+	0x7188, 0x9A8C, 0x9AEE, 0xA3B0, 0xC514, 0xCD54, 0xC4B3, 0x8A6B, 0xAA29, 0xE3CD, 0xECAE, 0xECEF, 0xECEF, 0xF52E, 0xFD0F, 0xC34B, 0xA28D, 0x798A, 0x5087, 0x58C8, 0x58C8, 0x58C8, 0x58C8, 0x58E8, 0x58E9, 0x50A7, 0x50C8, 0x71AC, 0x6109, 0x614A, 0x71CC, 0x4887, 0x58C8, 0x79CD, 0x5909, 0x696A, 0x612A, 0x698C, 0x7A2E, 0x8AB0, 0x69AB, 0x71CB, 0x5086, 0x50A7, 0x50A7, 0x5066, 0x5046, 0x60A7, 0x8148, 0x9A09, 0xAA4B, 0x99CA, 0x78C5, 0x6864, 0x99A8, 0xBA6A, 0xD2AA, 0xD2EA, 0xDB0B, 0xDB2C, 0xDB2C, 0xDB2C, 0xE34C, 0xE34C, 0xDB4C, 0xE36C, 0xEB6D, 0xE36D, 0xE36D, 0xE36D, 0xE36C, 0xDB6C, 0xDB4C, 0xDB4C, 0xDB4C, 0xDB4C, 0xDB6C, 0xDB8D, 0xDBAD, 0xDBED, 0xDC2E, 0xE44F, 0xE46F, 0xE4B0, 0xDCF1, 0xE552, 0xE594, 0xE5D5, 0xEDF6, 0xEE17, 0xEE57, 0xEE57, 0xF677, 0xFE77, 0x9AAB, 0x91C9, 0xA26B, 0xA26A, 0xA24A, 0x922A, 0x922B, 0x81EA, 0x81A9, 0x81A9, 0x89A8, 0xDC4F, 0xFE52, 0xFE30, 0xDC6D, 0xA269, 0x7906, 0x70C5, 0x8148, 0x7928, 0x7947, 0x9A0A, 0xA28C, 0x920A, 0x8188, 0x8169, 0x89AA, 0x9A6C, 0xA2CD, 0x924B, 0x8A0B, 0x7168, 0x6928, 0x7149,
+	0x60E6, 0x8A2C, 0x926D, 0x932E, 0xBCD3, 0xCD54, 0xBCD2, 0x92AB, 0xAA29, 0xDBCD, 0xECAF, 0xECEF, 0xED0F, 0xF52F, 0xFD0F, 0xCB6C, 0x922B, 0x694A, 0x4867, 0x50C9, 0x58E8, 0x60E8, 0x58E8, 0x50C8, 0x612A, 0x50A8, 0x58E9, 0x79ED, 0x696B, 0x614B, 0x8A6F, 0x612A, 0x48A8, 0x69AC, 0x50A8, 0x71AC, 0x71CD, 0x590A, 0x720E, 0xABB5, 0x71CC, 0x5909, 0x50A7, 0x5086, 0x5087, 0x5086, 0x5086, 0x60C7, 0x7947, 0x7106, 0x70A5, 0x7086, 0x8928, 0xAA2A, 0xC2AA, 0xD2C9, 0xD2CA, 0xDB0B, 0xDB0B, 0xDB0B, 0xDB2C, 0xDB2C, 0xE32C, 0xE34C, 0xDB4C, 0xE34C, 0xE36C, 0xE36D, 0xE38D, 0xEB8D, 0xE38D, 0xDB6D, 0xDB6C, 0xDB4C, 0xDB4C, 0xDB4C, 0xDB6C, 0xDB8C, 0xDBAD, 0xDBCD, 0xDC0E, 0xE42F, 0xE44F, 0xECB0, 0xE4F1, 0xE532, 0xE573, 0xEDD5, 0xEDF6, 0xEE16, 0xEE57, 0xEE77, 0xEE77, 0xFEB8, 0xB38E, 0x81A8, 0x9A4B, 0x9A6A, 0xA26A, 0x9A6A, 0x926B, 0x922B, 0x924A, 0x9A4B, 0x9A09, 0xD40D, 0xFDD1, 0xD48D, 0x9228, 0x8148, 0x8128, 0x8167, 0x8168, 0x8148, 0x920A, 0xAAAC, 0x9A2A, 0x81A9, 0x7127, 0x7948, 0x922B, 0xA2AD, 0xA2AC, 0x926C, 0x79A9, 0x6927, 0x7169, 0x6928,
+	0x58A6, 0x7148, 0x81EB, 0x92CD, 0xB492, 0xCD54, 0xBCD2, 0x9B0C, 0xA22A, 0xD3AD, 0xECAE, 0xF50F, 0xF510, 0xF52F, 0xF4EF, 0xDBEE, 0x7969, 0x58C8, 0x50A7, 0x50C8, 0x50A7, 0x6109, 0x6109, 0x58E9, 0x696B, 0x50A8, 0x58E9, 0x71AC, 0x592A, 0x592A, 0x92F1, 0x7A2E, 0x4867, 0x71CD, 0x614A, 0x50C8, 0x824F, 0x614A, 0x7A2F, 0x9B32, 0x92F1, 0x614A, 0x48A7, 0x50A7, 0x58A7, 0x5886, 0x5865, 0x6086, 0x60C6, 0x7906, 0x9967, 0xB1E9, 0xC26B, 0xCAAB, 0xCACB, 0xD2EB, 0xD2EA, 0xD2EB, 0xD2EB, 0xDB0B, 0xDB0B, 0xDB2B, 0xDB2B, 0xDB2B, 0xDB4C, 0xDB4C, 0xDB6C, 0xE36D, 0xE38D, 0xE3AD, 0xE38D, 0xDB8D, 0xE38C, 0xDB6C, 0xDB6C, 0xDB6C, 0xDB6C, 0xDB8C, 0xDBAD, 0xDBCD, 0xDBEE, 0xE42E, 0xE44F, 0xEC90, 0xE4D1, 0xE532, 0xE573, 0xE5B4, 0xE5D5, 0xEE16, 0xEE57, 0xEE77, 0xEE77, 0xFEB8, 0xD4D3, 0x7987, 0x8A2A, 0x924A, 0x9A8B, 0x9AAB, 0x9A8B, 0x926B, 0xA2AC, 0xB2AC, 0xAA6A, 0xB2EA, 0xBB6B, 0x9A48, 0x8987, 0x918A, 0x91A9, 0x89A8, 0x8148, 0x89CA, 0xA28C, 0x9A4B, 0x81A9, 0x7927, 0x7107, 0x89EA, 0xA28D, 0xAAEE, 0xA2AD, 0x8A2B, 0x7169, 0x6908, 0x6928, 0x60E7,
+	0x58E7, 0x6908, 0x718A, 0x824C, 0xB472, 0xD595, 0xCD33, 0xA36D, 0xAA4A, 0xD38C, 0xECAE, 0xF510, 0xF50F, 0xF54F, 0xF50F, 0xCB8D, 0x7128, 0x60E9, 0x50A8, 0x50E9, 0x50A7, 0x6109, 0x692A, 0x58E9, 0x718C, 0x58C9, 0x50C8, 0x71ED, 0x48C8, 0x590A, 0x824F, 0x92B1, 0x4888, 0x698C, 0x92B0, 0x4066, 0x69AB, 0x7A0E, 0x616B, 0x8AF1, 0x7A2E, 0x698B, 0x4887, 0x50C7, 0x5066, 0x5865, 0x68A6, 0x8148, 0x99CA, 0xB22A, 0xC249, 0xCA88, 0xCAA9, 0xCACA, 0xCACB, 0xD2EC, 0xD2EB, 0xD2CA, 0xD2EA, 0xDB0B, 0xDB0B, 0xDB2B, 0xDB2B, 0xDB2B, 0xE34C, 0xDB4C, 0xDB6C, 0xDB6C, 0xE38D, 0xDB8D, 0xDB8D, 0xDB8D, 0xDB8D, 0xE38D, 0xDB6C, 0xDB6C, 0xDB6C, 0xDB8C, 0xDBAD, 0xDBAD, 0xDBEE, 0xDC0E, 0xE44E, 0xE490, 0xE4B0, 0xE511, 0xE532, 0xE573, 0xE5B4, 0xEDF5, 0xEE16, 0xEE57, 0xEE77, 0xF698, 0xEDD6, 0x81E8, 0x81E9, 0x924A, 0x9A8B, 0xA2AC, 0x9AAC, 0xA2CC, 0xB2EC, 0xB2CB, 0xBAAA, 0xB26A, 0xAA2A, 0xA1E9, 0xA209, 0xAA2A, 0x9A09, 0x8988, 0x89A9, 0x9A4B, 0x922B, 0x8189, 0x8188, 0x7947, 0x7968, 0x9A6C, 0xAAED, 0xAAED, 0x926C, 0x81CA, 0x6928, 0x6907, 0x60E7, 0x60C6,
+	0x58E7, 0x60E8, 0x6108, 0x71CA, 0xBCD3, 0xE637, 0xE616, 0xBC4F, 0xAA6A, 0xD3AC, 0xECAE, 0xECEF, 0xF530, 0xF52F, 0xF4F0, 0xB2AB, 0x68E8, 0x60E9, 0x50C9, 0x50A8, 0x50C8, 0x6109, 0x60E9, 0x610A, 0x612A, 0x612A, 0x48A8, 0x8A6F, 0x50A8, 0x612A, 0x7A0E, 0x8AB0, 0x7A2E, 0x48A8, 0x8A90, 0x5909, 0x4887, 0x8A6F, 0x612A, 0x71AC, 0x828F, 0x592A, 0x4887, 0x5066, 0x6086, 0x70A5, 0x8927, 0xA9C9, 0xC209, 0xCA69, 0xCA89, 0xCAA8, 0xCAC9, 0xCAEB, 0xD2CB, 0xDACA, 0xD2EA, 0xDAEA, 0xDAEB, 0xDB0B, 0xDB0B, 0xDB2B, 0xDB2B, 0xDB2B, 0xDB2C, 0xDB4C, 0xDB4C, 0xDB4C, 0xE36D, 0xE38D, 0xDB8D, 0xDB8D, 0xDB8D, 0xE38D, 0xDB8D, 0xE38D, 0xE38D, 0xDBAD, 0xDBAD, 0xE3CD, 0xDBED, 0xDBED, 0xE44F, 0xE46F, 0xE490, 0xECF1, 0xE512, 0xE553, 0xE594, 0xEDD5, 0xF5F6, 0xEE37, 0xEE77, 0xEE57, 0xFE78, 0x92AB, 0x7988, 0x924A, 0x9A8B, 0x9A8B, 0xA2CC, 0xB30D, 0xB2EB, 0xBAAA, 0xBA8A, 0xBA6B, 0xB24B, 0xB22B, 0xBA8A, 0xB28A, 0x9A09, 0x91C9, 0x922B, 0x922B, 0x8188, 0x7948, 0x7968, 0x7988, 0x922B, 0xAAEE, 0xAB2E, 0x9AAC, 0x8A0B, 0x7149, 0x68E7, 0x68E7, 0x60A6, 0x68E6,
+	0x58E7, 0x58C7, 0x58C7, 0x71CA, 0xD555, 0xE637, 0xE636, 0xD512, 0xB2AA, 0xD3AB, 0xECAE, 0xF4EF, 0xED0F, 0xF50F, 0xECD0, 0xC34E, 0x7149, 0x5887, 0x58C8, 0x58C8, 0x5908, 0x6109, 0x6109, 0x716B, 0x6109, 0x614A, 0x612A, 0x8A6F, 0x50A8, 0x698B, 0x822E, 0x71CD, 0x9B32, 0x4067, 0x71CC, 0x71EC, 0x50C8, 0x71AC, 0x698C, 0x590A, 0x7A2F, 0x8A90, 0x696B, 0x4825, 0x6886, 0x8927, 0xA9A8, 0xBA08, 0xCA28, 0xCA68, 0xCA89, 0xCAAA, 0xCACB, 0xD2EB, 0xD2CA, 0xDAC9, 0xDAEA, 0xDAEB, 0xDB0B, 0xDAEA, 0xDB0A, 0xE32B, 0xDB2B, 0xDB2B, 0xE34C, 0xE34C, 0xE34C, 0xE34C, 0xE36D, 0xEB8D, 0xE38D, 0xE38D, 0xDB8D, 0xDB8D, 0xE3AD, 0xE3AD, 0xE3AD, 0xDBAD, 0xDBAD, 0xE3CD, 0xE3EE, 0xE3EE, 0xE44E, 0xE46F, 0xE48F, 0xE4D1, 0xE512, 0xE553, 0xE594, 0xEDB5, 0xF5F6, 0xEE36, 0xEE57, 0xEE56, 0xFEB9, 0xB3CF, 0x7147, 0x922A, 0x924A, 0x9A8B, 0xA2CC, 0xB2EC, 0xBAEB, 0xC2CA, 0xC2AA, 0xBA8A, 0xC28A, 0xCACB, 0xCAEB, 0xBA69, 0xA209, 0x9A2B, 0x920B, 0x81CA, 0x81A9, 0x81A9, 0x7988, 0x8A0A, 0xAAED, 0xB32E, 0xA2ED, 0x8A4B, 0x7189, 0x60E7, 0x60C7, 0x68E7, 0x7907, 0x89A9,
+	0x50C7, 0x58C7, 0x58A7, 0x6969, 0xCD15, 0xE637, 0xDDF5, 0xCD11, 0xB2AA, 0xD3AC, 0xECAD, 0xF4EF, 0xF510, 0xF510, 0xECD1, 0xA28B, 0x7108, 0x58A8, 0x5087, 0x58E8, 0x60E8, 0x6929, 0x692A, 0x718B, 0x694A, 0x58E9, 0x8A4F, 0x7A0D, 0x50A8, 0x71AC, 0x7A0D, 0x612A, 0x826F, 0x71ED, 0x79ED, 0x822D, 0x4867, 0x694B, 0x698B, 0x50C9, 0x616C, 0x71ED, 0x8A8F, 0x7149, 0x8128, 0xA188, 0xB187, 0xC228, 0xBA89, 0xCA8A, 0xD2AA, 0xD2AA, 0xD2CB, 0xD2CB, 0xD2CA, 0xD2E9, 0xD2EA, 0xDAEB, 0xDB0B, 0xDAEA, 0xDB0B, 0xE32B, 0xE32B, 0xDB0B, 0xE32C, 0xE32C, 0xE34C, 0xEB4C, 0xE36D, 0xE38D, 0xE38D, 0xDB8D, 0xDB8D, 0xDB8D, 0xE3AD, 0xE3AD, 0xE3AD, 0xE3AD, 0xE3CD, 0xDBCD, 0xE40E, 0xE42E, 0xE42E, 0xEC6F, 0xE46F, 0xDCB0, 0xDCF1, 0xE532, 0xE573, 0xE595, 0xEDB6, 0xEE16, 0xEE56, 0xF657, 0xFE78, 0xDD14, 0x820A, 0x8A0A, 0x8A09, 0x926A, 0xA2AB, 0xB2CB, 0xC32C, 0xCB0A, 0xCACA, 0xCACA, 0xD32A, 0xD34A, 0xCACA, 0xAA09, 0x99C9, 0x89A9, 0x7969, 0x81CA, 0x8A0B, 0x81C9, 0x89C9, 0xA2AC, 0xB32E, 0xB34E, 0x92AC, 0x7188, 0x60E7, 0x5886, 0x60A6, 0x7908, 0x91CA, 0xA24B,
+};
+
+static const struct s_bitmap _lena_levels_128x128 =
+{
+	_lena_levels_128x128_data,
+	128,
+	128,
+	false,
+	BITMAP_BUFFER_16BPP,
+	NULL,
+};
+
+static const uint16_t _lena_levels_64x64_data[] =
+{
+	0xE44F, 0xE42E, 0xE42D, 0xDC0D, 0xE42D, 0xECAE, 0xF4AE, 0xD32C, 0xA1EA, 0xAA2B, 0xB24A, 0xB26A, 0xB24A, 0xBA8A, 0xC2CB, 0xCAEB, 0xCB2B, 0xCB2C, 0xCB2B, 0xCB2B, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD32C, 0xD34C, 0xCB2C, 0xCB0C, 0xCB2C, 0xCB2B, 0xD32B, 0xD32B, 0xD32C, 0xCB0C, 0xCB0B, 0xCB0B, 0xCB0C, 0xCB0C, 0xC2EC, 0xB28B, 0xBAAB, 0xDBEE, 0xE44E, 0xDBED, 0xDC0D, 0xE40D, 0xDBED, 0xE40C, 0xDC2D, 0xDC0D, 0xECEF, 0xFEF3, 0xEDB1, 0xAA4A, 0xBACB, 0xBAEB, 0xBAEB, 0xBAEB, 0xC2EB, 0xC2EB, 0xC2EC, 0xC2EB, 0xC2EC, 0xD38D,
+	0xE40E, 0xE40D, 0xE40D, 0xE3EC, 0xEC4D, 0xECAE, 0xEC6D, 0xCB0B, 0xA1C9, 0xAA0A, 0xB24A, 0xB24A, 0xB22A, 0xBA8A, 0xC2CB, 0xCAEB, 0xCB0B, 0xD30B, 0xD30C, 0xD30B, 0xD32C, 0xD32C, 0xD32C, 0xD30C, 0xD32C, 0xD32C, 0xD32C, 0xD30B, 0xCB0B, 0xCB0B, 0xD32C, 0xD32B, 0xCB2C, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0B, 0xCB0B, 0xC2EB, 0xB28B, 0xB26A, 0xD36D, 0xE42E, 0xE42D, 0xE42D, 0xE42D, 0xE40D, 0xE40D, 0xDC0D, 0xDBED, 0xDC0D, 0xFE11, 0xFED4, 0xC3AC, 0xAA69, 0xBAEB, 0xBAEB, 0xBAEB, 0xC2EB, 0xC2EB, 0xC2CB, 0xD32C, 0xAA69, 0x60A7,
+	0xE40D, 0xE42D, 0xE42D, 0xE40D, 0xEC6E, 0xEC6E, 0xEC4D, 0xD30B, 0xA1C9, 0xB20A, 0xB22A, 0xB22A, 0xB229, 0xBA6A, 0xC2CA, 0xCAEB, 0xD2EB, 0xD30B, 0xD30C, 0xD30B, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD30C, 0xD30B, 0xD30B, 0xD32C, 0xD32C, 0xD30C, 0xD30B, 0xCAEB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCAEC, 0xBAAB, 0xB24A, 0xC2EC, 0xE3EE, 0xEC4E, 0xE44D, 0xEC4D, 0xE42D, 0xE40D, 0xE40D, 0xDBED, 0xDBCC, 0xE4AE, 0xFED4, 0xF5F2, 0xAAA9, 0xB2AB, 0xBAEB, 0xC2EB, 0xC2EB, 0xC2EB, 0xD36C, 0xAA4A, 0x5868, 0x50A7,
+	0xE40D, 0xE42D, 0xE42D, 0xEC6E, 0xEC8E, 0xE44D, 0xEC2D, 0xD30B, 0xA1A8, 0xAA09, 0xB24A, 0xB22A, 0xB229, 0xBA6A, 0xC2AA, 0xCAEA, 0xCAEB, 0xCAEB, 0xCB0B, 0xD30B, 0xD30B, 0xD30B, 0xD30B, 0xD30B, 0xD32C, 0xD2EB, 0xCACA, 0xCAEB, 0xCAEB, 0xCAEB, 0xCB0B, 0xCB0C, 0xD30C, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xC2AB, 0xB26A, 0xC2AC, 0xDBCF, 0xE44F, 0xE44E, 0xE42E, 0xE42D, 0xE42D, 0xE40D, 0xDC0D, 0xE3ED, 0xD3CC, 0xF5D1, 0xFF34, 0xD46E, 0xAA49, 0xC2EB, 0xC2EB, 0xBACB, 0xD34D, 0xAA2A, 0x5886, 0x5087, 0x60C7,
+	0xEC2D, 0xE44E, 0xEC6E, 0xF48E, 0xEC6D, 0xE42D, 0xEC4D, 0xD30A, 0xA1A8, 0xAA09, 0xB249, 0xB229, 0xB229, 0xBA6A, 0xC2AA, 0xCACA, 0xCAEB, 0xD2EB, 0xCACB, 0xD2EB, 0xD2EB, 0xCAEB, 0xD30C, 0xD2EC, 0xD30B, 0xD2CB, 0xCAAA, 0xCAAA, 0xCAAA, 0xCAAA, 0xCAEB, 0xD30C, 0xCB2C, 0xCB0B, 0xCAEB, 0xCAEB, 0xCAEB, 0xCAEB, 0xCACB, 0xC2AB, 0xBA6B, 0xC2AC, 0xDB8E, 0xE40E, 0xE42E, 0xE42D, 0xE42D, 0xE40D, 0xE40D, 0xE40D, 0xE40D, 0xDBAC, 0xE42D, 0xFED3, 0xFEB5, 0xBB0B, 0xB26A, 0xC2CB, 0xD32C, 0xA22A, 0x5066, 0x58C8, 0x60C7, 0x60A7,
+	0xE44E, 0xEC4D, 0xEC8E, 0xEC2C, 0xEC2D, 0xE44D, 0xEC2D, 0xD30B, 0xA188, 0xAA09, 0xB229, 0xB229, 0xB229, 0xBA6A, 0xC2AA, 0xCACA, 0xCACB, 0xCAEB, 0xCACB, 0xD2EB, 0xD2EB, 0xCB0B, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2EB, 0xCB0B, 0xCB2C, 0xCB6D, 0xC34D, 0xC2EB, 0xC2AB, 0xCACB, 0xD2EC, 0xD30C, 0xCAEB, 0xCAEB, 0xCAEB, 0xCACB, 0xC2AB, 0xBA6B, 0xC28B, 0xD36D, 0xDBCD, 0xDC0E, 0xDC0D, 0xDC0D, 0xDC0D, 0xEC0D, 0xE3ED, 0xDBCD, 0xDBAC, 0xD38B, 0xF570, 0xFF55, 0xE530, 0xAA28, 0xC2EC, 0xA22A, 0x5866, 0x58A8, 0x6109, 0x58A7, 0x5886,
+	0xE42D, 0xEC8E, 0xEC2D, 0xDB6A, 0xE40C, 0xEC4D, 0xF44D, 0xD30B, 0xA188, 0xA9E9, 0xB22A, 0xB22A, 0xB229, 0xC26A, 0xCAAB, 0xCACB, 0xCAEB, 0xCACB, 0xD2EB, 0xDAEB, 0xD2CB, 0xD2EC, 0xD2EC, 0xD2EC, 0xCB8F, 0xCBAF, 0xCC30, 0xD4D3, 0xD554, 0xD533, 0xDD12, 0xD4B1, 0xCB8E, 0xBAAB, 0xCACC, 0xD30C, 0xCACB, 0xCACB, 0xCAAB, 0xC28B, 0xBA4A, 0xC28A, 0xDB6D, 0xDBAD, 0xDBCE, 0xE3EE, 0xE3ED, 0xE3ED, 0xE3CD, 0xDBAC, 0xDB8C, 0xDB8C, 0xD36C, 0xE3EC, 0xFE93, 0xFEF5, 0xCC0D, 0x99EA, 0x5066, 0x5088, 0x60C8, 0x60C8, 0x58A7, 0x5887,
+	0xEC4D, 0xF48E, 0xDB4A, 0xD2CA, 0xEC2D, 0xEC6D, 0xF44D, 0xD30B, 0x9968, 0xA1C9, 0xAA09, 0xB209, 0xB229, 0xC26A, 0xCA8A, 0xCAAA, 0xCACA, 0xCACB, 0xD2CB, 0xD2EB, 0xD30C, 0xCB6D, 0xC30D, 0xC34E, 0xC3AF, 0xC3CF, 0xCC30, 0xCC91, 0xD4D2, 0xD533, 0xD573, 0xDDD4, 0xE5F6, 0xD4B2, 0xBAEC, 0xC28B, 0xD2CB, 0xCAAB, 0xC28B, 0xBA6B, 0xB24A, 0xC28A, 0xDB6D, 0xDBAD, 0xDBAD, 0xDBCE, 0xE3CD, 0xDBAC, 0xDB8C, 0xDB8C, 0xDB8C, 0xDB6C, 0xDB6C, 0xD34A, 0xECCF, 0xFF76, 0xE5B2, 0x5845, 0x5088, 0x60E7, 0x60A7, 0x58A7, 0x58A7, 0x58A7,
+	0xF4AE, 0xEC0C, 0xB208, 0xC289, 0xEC4D, 0xEC6D, 0xF44D, 0xD2EA, 0x9147, 0x99A9, 0xAA09, 0xAA0A, 0xB209, 0xBA4A, 0xC26A, 0xC28A, 0xCAAB, 0xD2CB, 0xCACA, 0xD30B, 0xC2CB, 0xC2EB, 0xBAEC, 0xBB2D, 0xBB4D, 0xC36E, 0xC3AF, 0xCC50, 0xD4F2, 0xD533, 0xDD73, 0xDD94, 0xDDB4, 0xE636, 0xE595, 0xBB6E, 0xAA09, 0xC28A, 0xC28B, 0xBA6B, 0xB22A, 0xBA6B, 0xE38D, 0xE3CD, 0xDB8D, 0xDB8D, 0xE3AD, 0xDBAC, 0xDB6C, 0xDB8C, 0xDB8C, 0xDB8C, 0xDB8C, 0xDB8C, 0xDBCC, 0xFE13, 0x8A89, 0x4826, 0x60C8, 0x60C8, 0x60A8, 0x58A7, 0x58C7, 0x5067,
+	0xF46D, 0xD30B, 0x9147, 0xC2AA, 0xEC4D, 0xEC8D, 0xF44C, 0xD2EA, 0x9147, 0xA1C9, 0xAA0A, 0xAA0A, 0xAA09, 0xBA49, 0xC26A, 0xC28A, 0xCAAB, 0xCAAA, 0xD2EB, 0xCACB, 0xBA4A, 0xBAAB, 0xC2EC, 0xC30D, 0xC34D, 0xC34E, 0xC36E, 0xCBEF, 0xD4B1, 0xDD33, 0xDD73, 0xE5B4, 0xE5B5, 0xDDB5, 0xDE16, 0xE657, 0xCCD3, 0xA24A, 0xBA2A, 0xB24B, 0xAA2A, 0xBA6B, 0xE38D, 0xEC0E, 0xE3AD, 0xCAEB, 0xCAEB, 0xE38D, 0xE38C, 0xE38C, 0xDB8C, 0xDB8C, 0xDBAC, 0xE3AC, 0xEC0D, 0x91C9, 0x4806, 0x58A9, 0x60C7, 0x58A7, 0x58C8, 0x58C8, 0x58C7, 0x7988,
+	0xEBCC, 0xA9E9, 0x9168, 0xC2AA, 0xEC4D, 0xEC8E, 0xF44D, 0xD2CA, 0x9168, 0xA1C9, 0xAA0A, 0xAA0A, 0xAA29, 0xBA49, 0xC28A, 0xC2AA, 0xCAAB, 0xCACB, 0xCACB, 0xBA4A, 0xBA8B, 0xC2AC, 0xBACC, 0xBAEC, 0xC32D, 0xCB4D, 0xCB6E, 0xCBAF, 0xD471, 0xE553, 0xDD74, 0xD573, 0xDDB5, 0xE616, 0xEE57, 0xEE78, 0xFF3B, 0xCCF3, 0x9188, 0xAA2A, 0xA20A, 0xBA4B, 0xE38D, 0xE3ED, 0xEBEE, 0xC2AA, 0x9988, 0xD32C, 0xE3AD, 0xE38C, 0xDB6C, 0xE38C, 0xE36C, 0xF3EE, 0xAAAA, 0x5026, 0x60A7, 0x60C7, 0x58A6, 0x58A8, 0x58C7, 0x6109, 0x79A9, 0xCBEF,
+	0xC289, 0xA188, 0x99A8, 0xC2A9, 0xEC2D, 0xEC8E, 0xEC2D, 0xD2CA, 0x9968, 0xA1C9, 0xAA0A, 0xAA0A, 0xAA09, 0xB24A, 0xC28A, 0xC2AA, 0xCAAB, 0xCACB, 0xBA6A, 0xBA6A, 0xC2AB, 0xBAAB, 0xBAAB, 0xC30C, 0xCB4D, 0xCB6E, 0xCB8E, 0xCBAE, 0xDC70, 0xDCD2, 0xD512, 0xE5B5, 0xEE58, 0xE658, 0xE637, 0xEE37, 0xEE57, 0xF73A, 0xB3AF, 0x8927, 0xA1EA, 0xB24A, 0xE38D, 0xE3ED, 0xE3ED, 0xCAEC, 0x6886, 0xAA2A, 0xE3AD, 0xE38C, 0xDB6C, 0xE36C, 0xEBAD, 0xDB4C, 0x60A7, 0x5887, 0x60C8, 0x60A7, 0x60C8, 0x58A7, 0x60E9, 0x81EB, 0xC3AF, 0xD3EE,
+	0xA1A8, 0xA1C9, 0x99A8, 0xC28A, 0xEC2D, 0xEC6E, 0xEC4D, 0xD2EA, 0x9168, 0xA1C9, 0xAA0A, 0xAA0A, 0xB229, 0xBA49, 0xC28A, 0xC2AA, 0xCACB, 0xC28A, 0xBA6A, 0xBA8A, 0xBA8B, 0xBAAB, 0xC2EC, 0xCB4D, 0xCB6D, 0xCB8E, 0xCB8E, 0xCB6E, 0xCBEF, 0xD4D2, 0xE5D5, 0xEE17, 0xE5F7, 0xE5F6, 0xE617, 0xE637, 0xEE57, 0xE698, 0xF6D9, 0xB3F0, 0x8127, 0xB24A, 0xE38D, 0xE3ED, 0xE3ED, 0xD2EC, 0x60A6, 0x78E7, 0xD30C, 0xEBAD, 0xDB4C, 0xE38C, 0xEBEE, 0x8948, 0x4846, 0x68E8, 0x60A7, 0x5887, 0x60C7, 0x58C8, 0x714A, 0xBB8F, 0xCBEF, 0xD46F,
+	0x99C9, 0xA1C9, 0x99A9, 0xC2AA, 0xEC0D, 0xEC6E, 0xEC4E, 0xD2EB, 0x9968, 0xA1A9, 0xAA09, 0xAA2A, 0xAA2A, 0xBA4A, 0xC28A, 0xC28A, 0xD34C, 0xBA49, 0xBA6A, 0xBA6A, 0xC28B, 0xC2CC, 0xCB2D, 0xCB6D, 0xCB8D, 0xD36E, 0xC2EC, 0xC36E, 0xDCF2, 0xEDB5, 0xE5B5, 0xDD95, 0xDDD6, 0xE617, 0xE637, 0xE657, 0xE657, 0xE657, 0xEE78, 0xFF3A, 0x9AEC, 0xA188, 0xE3AD, 0xE3ED, 0xE3EE, 0xD2EB, 0x70E7, 0x5826, 0x9127, 0xD34C, 0xDBAC, 0xE3AE, 0xB26B, 0x5046, 0x60A8, 0x60C8, 0x58C7, 0x60C8, 0x58A8, 0x58C8, 0xAB2F, 0xCBCE, 0xD42F, 0xD4B0,
+	0x99C9, 0xA1C9, 0x9988, 0xC289, 0xEC0D, 0xEC6E, 0xEC4E, 0xD2EB, 0x9148, 0x99A8, 0xA9E9, 0xAA09, 0xAA2A, 0xBA4A, 0xBA4A, 0xC2EB, 0xD3ED, 0xB209, 0xBA6A, 0xC26A, 0xC28B, 0xCB0C, 0xCB4D, 0xCB4D, 0xD34D, 0xBACC, 0xC38E, 0xE513, 0xE574, 0xDD73, 0xDD53, 0xE5B5, 0xE5F6, 0xE5F6, 0xE617, 0xE637, 0xE637, 0xE637, 0xE657, 0xEEF9, 0xDDF7, 0x9188, 0xDB8D, 0xE3CD, 0xEBEE, 0xCB0C, 0x70E8, 0x4005, 0x71EA, 0xDD95, 0xEE57, 0xEDF7, 0x6928, 0x5087, 0x68C8, 0x60C8, 0x58C8, 0x60E8, 0x5867, 0x9A4C, 0xCBEF, 0xCC0E, 0xDC70, 0xD46F,
+	0x99C9, 0xA1C9, 0xA1A9, 0xC269, 0xEC0D, 0xEC6E, 0xEC4D, 0xD2EA, 0x9128, 0x9988, 0xA9E9, 0xAA09, 0xB209, 0xBA2A, 0xB229, 0xD3CE, 0xDBED, 0xA9C9, 0xBA6A, 0xC26B, 0xC2CC, 0xCAEC, 0xCAEC, 0xCB2C, 0xBAAB, 0xCBCF, 0xE513, 0xDCF1, 0xDCF2, 0xDD32, 0xE594, 0xDDB5, 0xDDB5, 0xDDB5, 0xE5F6, 0xE616, 0xE637, 0xE637, 0xE658, 0xE637, 0xF6FA, 0xB3AF, 0xCAEB, 0xEC0D, 0xF3ED, 0xC2CB, 0x5045, 0x8ACD, 0xE5F6, 0xEE98, 0xEE98, 0xFF5B, 0x82AD, 0x5046, 0x60E8, 0x6087, 0x58A7, 0x58A7, 0x796A, 0xCBF0, 0xCBEE, 0xDC70, 0xD44F, 0xD44F,
+	0xA9E9, 0xAA09, 0xA9C9, 0xC269, 0xEC0D, 0xEC8E, 0xEC6D, 0xD2EB, 0x9147, 0xA1A9, 0xB209, 0xB229, 0xB209, 0xC249, 0xB229, 0xE44F, 0xD36B, 0xA9C9, 0xB24A, 0xC28B, 0xC2CC, 0xC2CC, 0xCAEC, 0xBAAB, 0xD3CE, 0xE491, 0xD471, 0xDCD2, 0xE533, 0xE533, 0xE554, 0xDD33, 0xDD54, 0xE5B5, 0xE5D6, 0xE5F6, 0xE5D5, 0xDDB5, 0xE617, 0xEE17, 0xE658, 0xE658, 0xDC0F, 0xEBCC, 0xE3AC, 0xB2EB, 0xB431, 0xEE37, 0xEE56, 0xE657, 0xE617, 0xFF1A, 0x8AEE, 0x5047, 0x60C7, 0x5887, 0x60A7, 0x5087, 0xBB4F, 0xD40F, 0xD44F, 0xD44F, 0xD42F, 0xD42F,
+	0xAA09, 0xAA09, 0xA9E8, 0xCAA9, 0xEC0D, 0xEC8E, 0xF48E, 0xD30B, 0x9967, 0xA1C9, 0xB209, 0xB209, 0xB209, 0xBA49, 0xB229, 0xE4AF, 0xCB2B, 0xB1EA, 0xB22A, 0xBA4A, 0xCAAB, 0xC2CC, 0xBACB, 0xD38E, 0xDBEF, 0xCBCE, 0xDC71, 0xDCF2, 0xDCF2, 0xDD13, 0xD4F2, 0xDCF3, 0xE553, 0xDD53, 0xDD94, 0xE5B5, 0xDD54, 0xD594, 0xDDF6, 0xDDF6, 0xDDD6, 0xDE37, 0xE5D5, 0xDBED, 0xDCB0, 0xE5D5, 0xEE57, 0xE657, 0xE637, 0xE617, 0xEE57, 0xF6F9, 0x722B, 0x5868, 0x60C7, 0x58A7, 0x5888, 0x920B, 0xDC10, 0xD42F, 0xDC70, 0xD42F, 0xD42F, 0xD42F,
+	0xAA09, 0xAA09, 0xB1E9, 0xCAA9, 0xEC2D, 0xECCE, 0xF4AE, 0xD32B, 0x9167, 0xA1C9, 0xB209, 0xB1E9, 0xB209, 0xB229, 0xB229, 0xED50, 0xDB6B, 0xBA4A, 0xBA4A, 0xC26A, 0xC2AB, 0xC2AB, 0xD38E, 0xD3AF, 0xCB6D, 0xD3EF, 0xD450, 0xDCB2, 0xDCB2, 0xDCB1, 0xDCF2, 0xE512, 0xDCD2, 0xDD13, 0xE554, 0xDD33, 0xDD75, 0xDD95, 0xDD95, 0xD574, 0xD595, 0xD513, 0xD594, 0xE594, 0xEE16, 0xE636, 0xE636, 0xE616, 0xE637, 0xEDF6, 0xEE77, 0xEE98, 0x5928, 0x5888, 0x58A7, 0x5887, 0x794A, 0xD3B0, 0xD40F, 0xDC70, 0xD44F, 0xD42F, 0xD42F, 0xD42F,
+	0xAA09, 0xAA09, 0xA9E9, 0xC28A, 0xEC2D, 0xECCE, 0xF4AE, 0xD32B, 0x9967, 0xA1C9, 0xB209, 0xB1E9, 0xB209, 0xB209, 0xB26A, 0xF570, 0xEBEC, 0xD2EB, 0xBA29, 0xBA4A, 0xC28B, 0xD34D, 0xD36E, 0xC32D, 0xD3CF, 0xD3CF, 0xD3EF, 0xDC50, 0xDC91, 0xE4B1, 0xDCB1, 0xE4D2, 0xDCB1, 0xD4B1, 0xD4F2, 0xDD33, 0xDD54, 0xDD54, 0xDD34, 0xD4F3, 0xD4F2, 0xDD53, 0xE5D5, 0xE616, 0xE616, 0xE5F6, 0xE5F6, 0xE637, 0xE5F6, 0xD491, 0xE5B5, 0xC492, 0x4866, 0x60A8, 0x58A7, 0x58A7, 0xA2AD, 0xD410, 0xD450, 0xDC6F, 0xD44F, 0xD44F, 0xD44F, 0xD44F,
+	0xA9E9, 0xA9E9, 0xA9C9, 0xCAAA, 0xEC4D, 0xECAE, 0xF4AE, 0xD32B, 0x9968, 0xA1C9, 0xAA09, 0xAA09, 0xB209, 0xA9E8, 0xB269, 0xF56F, 0xEC2C, 0xDB2C, 0xBA49, 0xB24A, 0xD34D, 0xCB4D, 0xC30C, 0xD38E, 0xCB8E, 0xD3AE, 0xD3CF, 0xDC10, 0xDC71, 0xDC72, 0xD450, 0xDC70, 0xDC70, 0xD491, 0xDCB2, 0xE4D2, 0xDCD3, 0xD4B2, 0xCC92, 0xDCF2, 0xE573, 0xE5D5, 0xE5F6, 0xE5D5, 0xDDD5, 0xE617, 0xE617, 0xEE57, 0xDD53, 0xD3F0, 0xDD12, 0x8AAC, 0x5046, 0x60E8, 0x5887, 0x81AB, 0xD3F0, 0xD40F, 0xD470, 0xD44F, 0xD44F, 0xD44F, 0xD44F, 0xD44F,
+	0xAA09, 0xAA09, 0xB1E9, 0xCACA, 0xEC4D, 0xECAE, 0xF4AE, 0xDB4B, 0x9168, 0xA1C9, 0xA9E9, 0xA9E9, 0xB1E9, 0xA9C8, 0xB26A, 0xFDD1, 0xEC8D, 0xEBCC, 0xCACA, 0xCACC, 0xCB2D, 0xC2EC, 0xD36D, 0xCB4D, 0xCB2D, 0xD38E, 0xD3CF, 0xCB8F, 0xBB2F, 0xB330, 0xBBB0, 0xBBAF, 0xCC31, 0xD431, 0xDC52, 0xC3D1, 0xC3D1, 0xD450, 0xDCF2, 0xE5B4, 0xE5F5, 0xDDB4, 0xDDD5, 0xE5F6, 0xE616, 0xE657, 0xEEB8, 0xEE16, 0xBB6E, 0xAAEB, 0xDD54, 0x5908, 0x5886, 0x60C8, 0x60C8, 0xB30E, 0xD410, 0xD430, 0xD450, 0xD42F, 0xD44F, 0xD42F, 0xD42F, 0xD42F,
+	0xAA0A, 0xAA09, 0xB209, 0xD2CA, 0xF44D, 0xF4CE, 0xF4AE, 0xDB4B, 0x9147, 0xA1A9, 0xAA09, 0xB209, 0xB209, 0xB1C8, 0xAA29, 0xFDF2, 0xF50E, 0xDB8A, 0xCB0A, 0xC2AB, 0xBAAC, 0xD34D, 0xCB2D, 0xC30C, 0xCB2D, 0xD36F, 0xC34F, 0xB30F, 0xA26D, 0x81CC, 0xB393, 0x9AD1, 0x820E, 0x8A2E, 0x716A, 0x50C8, 0x9B0E, 0xE533, 0xE5B5, 0xE5F5, 0xE5D5, 0xDDD5, 0xDDF6, 0xE616, 0xEE77, 0xE5F6, 0xD492, 0xA2AA, 0x91C8, 0xDCD3, 0x9B2E, 0x4826, 0x60C7, 0x5087, 0x796A, 0xCBEF, 0xD42F, 0xDC70, 0xD450, 0xD430, 0xD42F, 0xD42F, 0xCC2F, 0xD42F,
+	0xB22A, 0xAA09, 0xB209, 0xD2EA, 0xEC4D, 0xECCE, 0xF4AE, 0xDB4B, 0x9168, 0x99A8, 0xAA09, 0xAA09, 0xB209, 0xB1E9, 0xA1C8, 0xED90, 0xFD6F, 0xD32A, 0xD30D, 0xB26A, 0xCB0D, 0xCB0D, 0xC2ED, 0xCB2D, 0xD34D, 0xC30E, 0xB2EF, 0x9A6E, 0x81AC, 0x692B, 0x8A2F, 0x79CE, 0x7A0F, 0x592C, 0x4887, 0x92AD, 0xD4D2, 0xE5B4, 0xE5D5, 0xDDB4, 0xDDB4, 0xDDD5, 0xEE37, 0xE5F6, 0xCCF3, 0xA28B, 0x99C8, 0xB2CB, 0xED13, 0xA32D, 0x5045, 0x60A7, 0x60A8, 0x58A7, 0xA2AD, 0xD40F, 0xD470, 0xD470, 0xD470, 0xD450, 0xD430, 0xD42F, 0xD42F, 0xCC2F,
+	0xB24A, 0xB229, 0xB209, 0xD2CA, 0xEC2D, 0xECAE, 0xF4AE, 0xDB4B, 0x9168, 0xA1A9, 0xA9E9, 0xAA09, 0xA9E9, 0xB229, 0xA1A7, 0xD44E, 0xFDF1, 0xE42D, 0xCAEC, 0xC2CC, 0xCB0C, 0xC2CC, 0xC2ED, 0xC2ED, 0xCB0D, 0xAA8D, 0x79AC, 0x692B, 0x5088, 0x718B, 0x798C, 0x79EE, 0x616C, 0x616C, 0xAB4E, 0xDD13, 0xE574, 0xDD53, 0xDD73, 0xDD73, 0xDDB4, 0xE5D5, 0xC492, 0x92CC, 0x9ACE, 0xD3AF, 0xEC6E, 0xFD93, 0xA30D, 0x4825, 0x68E8, 0x60A7, 0x5887, 0x7129, 0xCBAF, 0xD42F, 0xD4B0, 0xD490, 0xD470, 0xD450, 0xCC50, 0xCC30, 0xCC30, 0xCC2F,
+	0xB24A, 0xB229, 0xB1E9, 0xCAA9, 0xEC4D, 0xF4AE, 0xF4AE, 0xDB6B, 0x9147, 0x99A9, 0xA9E9, 0xA9E9, 0xA9E9, 0xB229, 0xB1E9, 0xB2AA, 0xF5F1, 0xECEE, 0xCAEB, 0xCAEC, 0xC2CD, 0xC2ED, 0xC2ED, 0xC2EE, 0x91CC, 0x798C, 0x610A, 0x694B, 0x60E9, 0x694A, 0x60EA, 0x71AE, 0x71EF, 0x92EF, 0xDD12, 0xE5D4, 0xD553, 0xD553, 0xD533, 0xD554, 0xE5B5, 0xDD13, 0x81A8, 0x8A4D, 0xA330, 0xD42F, 0xF511, 0x926A, 0x4845, 0x60C7, 0x68E7, 0x5887, 0x5887, 0x922C, 0xCBCF, 0xDC90, 0xD4B0, 0xD490, 0xD490, 0xD470, 0xD470, 0xCC50, 0xCC2F, 0xCC2F,
+	0xB24A, 0xB22A, 0xA9C9, 0xC289, 0xEC2D, 0xECCF, 0xF4AE, 0xDB6C, 0x9148, 0x9988, 0xA9E9, 0xA9E9, 0xB1E9, 0xB22A, 0xC26A, 0xA9A8, 0xDCCF, 0xFDD1, 0xCAEC, 0xBAAB, 0xC2CD, 0xC2EE, 0xC2EE, 0x920C, 0x712A, 0x81AD, 0x58C9, 0x718B, 0x692A, 0x58A8, 0x58E9, 0x692B, 0x8A90, 0xBC52, 0xE574, 0xD533, 0xCD13, 0xD513, 0xD513, 0xE595, 0xE594, 0xF5B5, 0xC30C, 0x818A, 0x928E, 0xCC11, 0x89E9, 0x4805, 0x60C8, 0x68E8, 0x60A7, 0x5887, 0x6909, 0xAAED, 0xC3EE, 0xE4D0, 0xD490, 0xD490, 0xD490, 0xD470, 0xD470, 0xD470, 0xCC4F, 0xCC2F,
+	0xB24A, 0xB24A, 0xA9C9, 0xBA69, 0xEC2D, 0xECAF, 0xF4AE, 0xDB6C, 0x9168, 0x9988, 0xAA0A, 0xB209, 0xB1E9, 0xB22A, 0xC28A, 0xB1E9, 0xDC90, 0xED4F, 0xBA2A, 0xC2AC, 0xC2AC, 0xCB0E, 0x91AA, 0x6909, 0x5888, 0x692A, 0x716B, 0x612B, 0x79EE, 0x5067, 0x58C7, 0xA2AE, 0xB3B2, 0xD534, 0xDD54, 0xCCD2, 0xD4F2, 0xD4B1, 0xED53, 0xF5D5, 0xF5D5, 0xFE16, 0xE40F, 0x70A6, 0x798A, 0xC3D1, 0x6908, 0x5887, 0x68E7, 0x6908, 0x58A8, 0x5866, 0x81CB, 0xC38E, 0xC40F, 0xD470, 0xDC90, 0xD490, 0xD490, 0xD490, 0xD470, 0xD450, 0xD44F, 0xCC2F,
+	0xB22A, 0xB22A, 0xA9E9, 0xBA6A, 0xEC2E, 0xECCF, 0xF4CE, 0xDB8C, 0x9168, 0x99A9, 0xB20A, 0xB20A, 0xB209, 0xBA4A, 0xCACB, 0xBA29, 0xCBAD, 0xDC4E, 0xBA29, 0xCAEC, 0xC2AD, 0x816A, 0x68E9, 0x6109, 0x58C8, 0x58C8, 0x610A, 0x71AD, 0x71CD, 0x5087, 0xB30D, 0xE4D3, 0xCC73, 0xCD14, 0xD554, 0xD471, 0xDC50, 0xECF2, 0xF595, 0xEDF5, 0xF616, 0xFE78, 0xF532, 0x8927, 0x5087, 0xBBB1, 0x7169, 0x58A7, 0x6908, 0x68E8, 0x58A7, 0x58A7, 0xA2CD, 0xCC0F, 0xD450, 0xCC0F, 0xCC0F, 0xCC2F, 0xD44F, 0xD470, 0xD470, 0xD450, 0xD42F, 0xD40F,
+	0xB22A, 0xAA09, 0xA9C8, 0xBA49, 0xEC2E, 0xECCF, 0xF4CE, 0xDB6C, 0x9189, 0xA1C9, 0xAA0A, 0xB22A, 0xB22A, 0xBA4A, 0xCA8A, 0xCA6A, 0xCACA, 0xD36D, 0xC2AC, 0xC34E, 0x898A, 0x60EA, 0x58A8, 0x692A, 0x6909, 0x58C8, 0x60EA, 0x692B, 0x612A, 0xA2AD, 0xDC30, 0xE533, 0xCCD3, 0xD514, 0xDCB2, 0xE430, 0xE491, 0xED12, 0xF594, 0xF5D5, 0xF616, 0xF657, 0xFDD5, 0xB22A, 0x4826, 0xAB0F, 0x81CA, 0x58A7, 0x6928, 0x60C8, 0x5887, 0x7149, 0xBB8F, 0xD44F, 0xD4B0, 0xCC70, 0xCC50, 0xCC2F, 0xC3EE, 0xC40F, 0xC40F, 0xCC0F, 0xD42F, 0xD40F,
+	0xB209, 0xAA09, 0xA9C9, 0xBA69, 0xEC2E, 0xECCF, 0xF4CE, 0xDB6C, 0x9168, 0x99A9, 0xB22A, 0xB22A, 0xB209, 0xC24A, 0xCA6A, 0xD2EB, 0xBAAA, 0x9A2A, 0xD36F, 0xA22C, 0x610A, 0x694C, 0x60E9, 0x692A, 0x58C8, 0x60C9, 0x694B, 0x58E9, 0x7989, 0xD430, 0xDC91, 0xD533, 0xDD94, 0xC36E, 0xCB2D, 0xDC10, 0xF4F3, 0xECF2, 0xF553, 0xF594, 0xEDB5, 0xFE56, 0xFDF6, 0xB22A, 0x4805, 0x9A8D, 0x926C, 0x60C8, 0x6929, 0x60C7, 0x5887, 0x922B, 0xC3CF, 0xD46F, 0xD48F, 0xCC8F, 0xD490, 0xD490, 0xCC50, 0xC40F, 0xC3EF, 0xBBCF, 0xC3CF, 0xC3CE,
+	0xB22A, 0xB22A, 0xA9C9, 0xBA49, 0xEC2E, 0xECCF, 0xF4EE, 0xDB8C, 0x9189, 0x99A9, 0xB22A, 0xB229, 0xB209, 0xB209, 0xC28A, 0xE3CD, 0xAA8B, 0x81CB, 0xAA8C, 0x792A, 0x696C, 0x69AD, 0x58E9, 0x6109, 0x60C8, 0x58A8, 0x694B, 0x6908, 0xCBCF, 0xE552, 0xDD33, 0xDD13, 0xCB6D, 0xCAEC, 0xBA8B, 0xA1C9, 0xC2EC, 0xEC70, 0xECF2, 0xED74, 0xFD94, 0xDC0F, 0xAAAB, 0xA1C9, 0x5846, 0x8A0C, 0xA2CD, 0x60C8, 0x6908, 0x58C7, 0x60C8, 0xAAED, 0xCBEF, 0xDC6F, 0xD44F, 0xD44F, 0xCC4F, 0xD46F, 0xCC4F, 0xCC4F, 0xCC50, 0xC430, 0xBBEF, 0xB38E,
+	0xAA09, 0xB20A, 0xA1A8, 0xB209, 0xEC2D, 0xF4EE, 0xF4CF, 0xE38C, 0x9968, 0x99A9, 0xB209, 0xB209, 0xA9C9, 0xC2EB, 0xD3AD, 0xE3CE, 0xD38E, 0x818A, 0x694A, 0x71CE, 0x7A0E, 0x610A, 0x692A, 0x58A8, 0x696B, 0x58E9, 0x5046, 0xAAED, 0xE4F2, 0xEDF5, 0xCCD1, 0x8988, 0x70A6, 0x78E7, 0x8169, 0x8948, 0xCAAC, 0xE34D, 0xEC91, 0xFE16, 0xBB4D, 0x7907, 0x70E7, 0x7908, 0x6066, 0x81CB, 0xAB0E, 0x68E7, 0x60E7, 0x58A7, 0x7129, 0xC38E, 0xD42F, 0xD44F, 0xD42F, 0xD42F, 0xD44F, 0xD44F, 0xCC2F, 0xCC4F, 0xCC30, 0xC40F, 0xBBEF, 0xB3B0,
+	0xAA09, 0xA9E9, 0x9168, 0xA9E8, 0xEC2D, 0xF4EF, 0xF4EF, 0xE38C, 0x9968, 0xA1C9, 0xB209, 0xB229, 0x9148, 0xB2ED, 0xED30, 0xC36D, 0x7108, 0x60EA, 0x696C, 0x614C, 0x8270, 0x50C9, 0x60E9, 0x6109, 0x58A7, 0x58A8, 0x716A, 0xD430, 0xE594, 0xE594, 0xB24B, 0x78A7, 0x8149, 0x79EB, 0xDD77, 0xAA4B, 0xCA4A, 0xDB0C, 0xF513, 0xE534, 0x70E8, 0x8A6D, 0xB2EF, 0x5844, 0x5866, 0x81CA, 0xAB2F, 0x7128, 0x60C7, 0x5087, 0x8A0B, 0xCBEF, 0xD44F, 0xD42F, 0xCC2E, 0xCC2E, 0xCC2E, 0xD42E, 0xCC0E, 0xCC0F, 0xC40F, 0xB3AF, 0xAB6E, 0xB3CF,
+	0xB22A, 0xAA09, 0x9168, 0xA9C8, 0xEC2E, 0xED0F, 0xF50F, 0xE3AC, 0xA1A8, 0xA9E9, 0xC28A, 0xA1E8, 0x91EA, 0xBBB1, 0xBC10, 0x694A, 0x71AE, 0x698D, 0x612B, 0x79EE, 0x92F2, 0x696B, 0x5067, 0x60C8, 0x5087, 0x5066, 0xAB4E, 0xE553, 0xDD74, 0xBAEC, 0xDB2D, 0xD2ED, 0xC26C, 0xC36F, 0xDCD3, 0xE3D0, 0xD28B, 0xD2AC, 0xF554, 0xE513, 0xBAED, 0xC390, 0xAA0B, 0x70A6, 0x5887, 0x79CA, 0xB370, 0x7128, 0x58A7, 0x60C7, 0xA2CD, 0xCC0F, 0xD44F, 0xCC2F, 0xCC2F, 0xD42F, 0xCC2F, 0xD42F, 0xCBEE, 0xC3CF, 0xB38F, 0xBBCE, 0xD4B0, 0xE571,
+	0xAA09, 0xA1E9, 0x8947, 0xA1A8, 0xEC0E, 0xED0F, 0xF52F, 0xE3CC, 0xA188, 0xB1E9, 0xBA49, 0xBACD, 0xC371, 0x924D, 0x58C9, 0x590B, 0x8AF1, 0x696C, 0x612A, 0x7A2F, 0x92F2, 0x71AC, 0x5067, 0x58A7, 0x4867, 0x89CA, 0xDCB1, 0xE594, 0xB26A, 0xDAAC, 0xE3CF, 0xE410, 0xE3CF, 0xDB8F, 0xDC10, 0xDC10, 0xD30D, 0xDAAC, 0xECD3, 0xF617, 0xDBF0, 0xCAEC, 0xB229, 0x9168, 0x6087, 0x798A, 0xBBB1, 0x6908, 0x5887, 0x6927, 0xBB6E, 0xD42F, 0xD42F, 0xCC0F, 0xCC0F, 0xCC0F, 0xCC0F, 0xCBEF, 0xC3CF, 0xB38E, 0xCC6F, 0xED91, 0xEDD0, 0xEDB0,
+	0x99C9, 0x9989, 0x8107, 0x9987, 0xE40D, 0xF50F, 0xF510, 0xE3CC, 0x9988, 0xA9C9, 0xC2AC, 0xBB31, 0x9AB0, 0x718C, 0x612B, 0x8291, 0x826F, 0x50A8, 0x58EA, 0x7A4F, 0x7A4E, 0x8A4D, 0x60C8, 0x4887, 0x6109, 0xC36D, 0xE5D5, 0x9A6A, 0xB9E9, 0xDB0D, 0xE3AF, 0xEC71, 0xF4D2, 0xECD2, 0xECD2, 0xE410, 0xDB6E, 0xDAAC, 0xE471, 0xF657, 0xE451, 0xDB6E, 0xDAEC, 0x99A9, 0x68A7, 0x7149, 0xC3D0, 0x68E7, 0x5866, 0x81AA, 0xCBCE, 0xD44F, 0xCC2F, 0xCC0F, 0xCC0F, 0xCC0F, 0xC3EE, 0xC3CE, 0xB38E, 0xCC6F, 0xF5F1, 0xF5D0, 0xED90, 0xEDB1,
+	0x9168, 0x8968, 0x7907, 0x9968, 0xE40E, 0xECEF, 0xF4EF, 0xE3AC, 0xA187, 0xA9C9, 0xBA8C, 0xA28E, 0x820E, 0x71CD, 0x696C, 0x8291, 0x69AC, 0x58A8, 0x50A8, 0x60E9, 0x5887, 0xA2AC, 0x81EA, 0x4006, 0x89EA, 0xED54, 0xA3CF, 0x6886, 0xCA8B, 0xDAEC, 0xE36E, 0xEC10, 0xECD1, 0xECF2, 0xECB1, 0xE3CE, 0xDB6D, 0xDAAB, 0xE430, 0xF637, 0xE450, 0xDB6E, 0xDAEC, 0x9169, 0x68A7, 0x6908, 0xC3B0, 0x7148, 0x5886, 0xA26B, 0xD44F, 0xD44F, 0xCC2F, 0xCC0F, 0xC40F, 0xC3EE, 0xC3EF, 0xBB8E, 0xC3EE, 0xF5B1, 0xF5D0, 0xEDD0, 0xF5F2, 0xEE33,
+	0x8968, 0x8168, 0x70C7, 0x9168, 0xE40E, 0xECCF, 0xF4CF, 0xE3AC, 0x9968, 0xAA2C, 0xC32F, 0x922E, 0x8A50, 0x79EE, 0x69AD, 0x8AD2, 0x71EE, 0x58C8, 0x5087, 0x7149, 0x8169, 0xBB4E, 0x8A2B, 0x5065, 0xC38F, 0xDD34, 0x50C6, 0x80E7, 0xC24A, 0xDAEC, 0xE34D, 0xEBCF, 0xEC50, 0xEC91, 0xEC70, 0xE38D, 0xDB0C, 0xD28A, 0xDBAF, 0xF637, 0xE470, 0xDB6E, 0xD2EC, 0x78E7, 0x68E7, 0x68C7, 0xBB90, 0x79A9, 0x5886, 0xBB2C, 0xD46F, 0xD44F, 0xCC2F, 0xCC0F, 0xC3EF, 0xC3EE, 0xC3CE, 0xB36D, 0xE510, 0xF5EF, 0xEDD0, 0xF632, 0xF654, 0xEE34,
+	0x9189, 0x8969, 0x68A6, 0x8907, 0xE3EE, 0xECCF, 0xF4EF, 0xEBAC, 0xA188, 0xAA4C, 0xB2CE, 0x81AC, 0x822F, 0x71AD, 0x71EF, 0x82D2, 0x720E, 0x50A8, 0x5087, 0x7989, 0xA28C, 0x89EB, 0x5065, 0x924A, 0xDCB2, 0x722A, 0x5026, 0x9168, 0xC229, 0xDACC, 0xE32D, 0xEB8E, 0xEBCF, 0xEC2F, 0xEC0F, 0xD30C, 0xD2CC, 0xDACC, 0xDB4D, 0xF637, 0xDC70, 0xDB4E, 0xBA8B, 0x5887, 0x7128, 0x6086, 0xB34F, 0x8A2B, 0x68E7, 0xD3CE, 0xD44F, 0xCC2E, 0xCC0E, 0xCC0F, 0xC40F, 0xC3EE, 0xBB8E, 0xCC2E, 0xFDD0, 0xF5CF, 0xF612, 0xF673, 0xEE54, 0xF654,
+	0x9189, 0x8968, 0x78E7, 0x9988, 0xE40E, 0xECAF, 0xF4EF, 0xE3CD, 0xA1C9, 0xA9EA, 0xB24C, 0x81AD, 0x820E, 0x71CD, 0x71CE, 0x7A70, 0x8AF1, 0x58E9, 0x68E8, 0x58C7, 0x79EC, 0x4846, 0x7148, 0xED74, 0xAB6D, 0x4844, 0x60C7, 0x99A9, 0xC249, 0xDACB, 0xE30C, 0xE38E, 0xE3AF, 0xE3EF, 0xEC0F, 0xDB4D, 0xCA8A, 0xC229, 0xD28B, 0xED12, 0xDC0F, 0xE32D, 0x89A9, 0x5067, 0x7949, 0x6066, 0xA2CD, 0x9AAD, 0x89CA, 0xDC2E, 0xCC4F, 0xCC2E, 0xCC0F, 0xCC0F, 0xC3EE, 0xC3CE, 0xB38D, 0xE4EF, 0xFDEF, 0xF5F1, 0xF653, 0xEE53, 0xEE74, 0xEE54,
+	0x9168, 0x9168, 0x8107, 0xB24B, 0xEC2F, 0xECAF, 0xF4EF, 0xEBED, 0x9988, 0xA1A8, 0xBA8D, 0x714B, 0x71AC, 0x71AC, 0x698D, 0x8271, 0x9B54, 0x698A, 0x920B, 0x60E9, 0x718A, 0xA32E, 0xB30E, 0xBBCF, 0x58E8, 0x60A8, 0x68E8, 0xA20A, 0xCA69, 0xDAAB, 0xE30C, 0xE34D, 0xE38E, 0xE3CF, 0xEC0F, 0xE3CF, 0xDB2D, 0xDB6E, 0xE471, 0xECF3, 0xDBAF, 0xCAED, 0x60C7, 0x58C8, 0x8189, 0x6886, 0x8A2B, 0xAAED, 0xAACB, 0xDC4E, 0xCC4F, 0xCC0F, 0xCC0F, 0xC40F, 0xC3EE, 0xC3CE, 0xBBAD, 0xED50, 0xF610, 0xF652, 0xF653, 0xEE74, 0xEE74, 0xF655,
+	0x8948, 0x8928, 0x78E7, 0xB26B, 0xEC2F, 0xECAF, 0xF4EF, 0xEBED, 0x9987, 0xA1EA, 0xB2AE, 0x79AD, 0x79EE, 0x590A, 0x614C, 0x71CD, 0x7A50, 0x9B32, 0x7189, 0x6908, 0xB391, 0xD491, 0xA2CC, 0x7188, 0x5885, 0x6908, 0x60C7, 0x9A0A, 0xCA6A, 0xDACB, 0xE30B, 0xE34D, 0xE34D, 0xEB8E, 0xEBCF, 0xE3CE, 0xDBEF, 0xFD33, 0xF616, 0xED33, 0xDB8F, 0x920B, 0x5087, 0x6109, 0x8189, 0x68A6, 0x798A, 0xBB4E, 0xC36C, 0xD44E, 0xCC2F, 0xCC0F, 0xC3EF, 0xC3EE, 0xC3EE, 0xC3AE, 0xC3CD, 0xEDB0, 0xF632, 0xF673, 0xF653, 0xEE74, 0xEE75, 0xEE75,
+	0x78E7, 0x8107, 0x78E7, 0xAA6B, 0xEC4F, 0xECCF, 0xF50F, 0xE3ED, 0xA1A9, 0xAA4C, 0xAA6D, 0x716B, 0x696B, 0x610A, 0x79EE, 0x7A0E, 0x71AD, 0x8AB1, 0x79EB, 0xC412, 0xDD35, 0xAAEC, 0x7A0A, 0x5886, 0x68C7, 0x70E7, 0x68C7, 0x89A9, 0xBA09, 0xDACB, 0xE2EB, 0xE32C, 0xE34D, 0xD2AA, 0xD2AB, 0xDB0B, 0xD2EB, 0xD34D, 0xDBAE, 0xD30D, 0xCB2E, 0x6107, 0x50A8, 0x6907, 0x8968, 0x70C7, 0x6929, 0xC38E, 0xD3AC, 0xCC4E, 0xD42E, 0xCC0F, 0xC3EF, 0xC3EF, 0xC3EE, 0xBB8E, 0xC3CD, 0xF5F0, 0xF673, 0xF674, 0xF673, 0xEE74, 0xF695, 0xF695,
+	0x68C7, 0x78E7, 0x8107, 0xB2AC, 0xEC4F, 0xECEF, 0xF510, 0xE40E, 0xAA4C, 0xAA0B, 0xAAAE, 0x694A, 0x58E9, 0x614C, 0x82B1, 0x8250, 0x824F, 0x71EE, 0xAAF0, 0xE451, 0xC42F, 0xA30C, 0x58C8, 0x60A7, 0x60A7, 0x68E8, 0x70E7, 0x8148, 0xA9C8, 0xD28A, 0xD2AA, 0xDB0C, 0xEB6D, 0xDAEB, 0xD249, 0xDA6A, 0xE2ED, 0xE3B0, 0xE350, 0xDB4E, 0x9A0A, 0x5066, 0x58A7, 0x70E8, 0x8968, 0x7907, 0x6909, 0xCBAF, 0xDBED, 0xCC4E, 0xCC2F, 0xCC2F, 0xC40F, 0xC3EF, 0xC3EE, 0xBB8D, 0xCC0D, 0xF652, 0xF694, 0xF674, 0xF694, 0xF694, 0xF694, 0xF674,
+	0x68C7, 0x68A7, 0x7907, 0xB26B, 0xE42E, 0xECEF, 0xF510, 0xE40E, 0x9169, 0xB28D, 0x89EC, 0x79CC, 0x58E9, 0x698C, 0x9353, 0x7A90, 0x7A2F, 0x8AD2, 0xB331, 0xD431, 0xCC4F, 0x6929, 0x58C8, 0x60C8, 0x60C7, 0x6908, 0x7107, 0x7928, 0x8969, 0xBA29, 0xCA6A, 0xD2CC, 0xDB2D, 0xE34D, 0xDAEC, 0xDAAB, 0xE2CC, 0xDB2E, 0xE38F, 0xCB2E, 0x60A6, 0x58A8, 0x60C8, 0x70E7, 0x8989, 0x7927, 0x7129, 0xCBEF, 0xD42D, 0xCC4E, 0xCC4F, 0xCC4F, 0xC42F, 0xC40F, 0xBBEF, 0xB36D, 0xC40E, 0xFEB4, 0xF694, 0xF695, 0xF695, 0xF674, 0xF653, 0xEE53,
+	0x60C7, 0x6086, 0x8989, 0xBA8B, 0xE3ED, 0xECEF, 0xF50F, 0xE3ED, 0x9988, 0xA24D, 0x81AC, 0x694B, 0x58E9, 0x614B, 0x8AF2, 0x9353, 0x82D1, 0x8290, 0x924D, 0xD493, 0x822A, 0x5048, 0x6107, 0x60C7, 0x60C7, 0x60C7, 0x68E7, 0x68E7, 0x7108, 0x9967, 0xC229, 0xDACB, 0xDB2D, 0xDB4D, 0xDB6D, 0xE3AE, 0xE3EF, 0xE3EF, 0xE3EF, 0x8989, 0x5087, 0x60E8, 0x68C8, 0x70E7, 0x91CA, 0x8148, 0x7128, 0xCBEF, 0xD42E, 0xCC6F, 0xCC4F, 0xCC4F, 0xC44F, 0xBC0F, 0xBBEF, 0xAB4D, 0xC42F, 0xFED5, 0xF694, 0xF694, 0xF695, 0xF673, 0xF673, 0xFEB4,
+	0x58A8, 0x5887, 0x8989, 0xC2AA, 0xE3ED, 0xECCF, 0xF4EF, 0xE40D, 0x9168, 0x89CB, 0x716B, 0x696B, 0x5909, 0x610B, 0x7A70, 0x69CE, 0x9354, 0x9333, 0xAB11, 0x822C, 0x50C8, 0x58C9, 0x68E8, 0x60C8, 0x60C8, 0x58A7, 0x68C7, 0x68E7, 0x7108, 0x70E7, 0x78E6, 0xB1E9, 0xCAAB, 0xDB2D, 0xDBAF, 0xEC50, 0xEC91, 0xEC71, 0xC34D, 0x60A7, 0x58E9, 0x6928, 0x60A7, 0x7928, 0x91EA, 0x8168, 0x7148, 0xCBF0, 0xCC2F, 0xCC4F, 0xCC2F, 0xC430, 0xC42F, 0xBBEF, 0xBBCF, 0xA32D, 0xCCB0, 0xFEF5, 0xF673, 0xF694, 0xF694, 0xFE73, 0xFE33, 0xDCCF,
+	0x5887, 0x5067, 0x7107, 0xBA6A, 0xE40E, 0xECCF, 0xF4EF, 0xDBCC, 0xAAAC, 0x926E, 0x612A, 0x696A, 0x612A, 0x5088, 0x9333, 0x7A2F, 0x720F, 0x8B33, 0xA3B4, 0x9310, 0x69AB, 0x50A8, 0x7128, 0x60E7, 0x60C8, 0x60A7, 0x60A7, 0x6908, 0x68E7, 0x7928, 0x8947, 0xA1EA, 0xBA8B, 0xCAEC, 0xDB6E, 0xE3F0, 0xE430, 0xE410, 0xCBAF, 0x69AA, 0x48C8, 0x58C8, 0x60C7, 0x7949, 0x920A, 0x8989, 0x8189, 0xCBEF, 0xB30C, 0xB32C, 0xBB8E, 0xBBCF, 0xC40F, 0xBBEF, 0xB3CE, 0xA32D, 0xDD71, 0xFED3, 0xF673, 0xF673, 0xFE53, 0xDCAF, 0x81A7, 0x60A6,
+	0x79AA, 0x60A7, 0x68A6, 0x9188, 0xE3CD, 0xECAF, 0xECCF, 0xEC4F, 0xA2AC, 0x81CB, 0x50C8, 0x694A, 0x610A, 0x694B, 0x722E, 0x8AD1, 0x8270, 0x82F2, 0x7A90, 0x8AD0, 0xA392, 0x6149, 0x6908, 0x60E8, 0x60C8, 0x58A7, 0x58A7, 0x68E8, 0x68C7, 0x70E7, 0xBA6A, 0xD2EC, 0xD30D, 0xD32D, 0xDB6E, 0xDB8E, 0xD38E, 0xDC90, 0xEDD4, 0xE5F6, 0xBC51, 0x71EB, 0x4046, 0x7968, 0x89EA, 0x8169, 0x89AA, 0xCBCE, 0xBB0C, 0xB2EC, 0xAACB, 0xA28B, 0xA2CB, 0xA30D, 0xA32D, 0x9ACD, 0xED91, 0xFE72, 0xF653, 0xFE73, 0xD48F, 0x6907, 0x6087, 0x89A8,
+	0xABB0, 0x9AAD, 0x7948, 0x70C6, 0xDB6C, 0xF4AF, 0xF4CF, 0xE3EE, 0xAAED, 0x718A, 0x4026, 0x71AB, 0x718B, 0x820E, 0x592A, 0x7A4F, 0x82B0, 0x720F, 0x8AF2, 0x9B74, 0x8A6E, 0x7A2C, 0x68E8, 0x60E8, 0x60E8, 0x58C8, 0x60E8, 0x60C7, 0x7128, 0x70E7, 0xB22A, 0xD2AB, 0xCACC, 0xDB2D, 0xDB4D, 0xDB4D, 0xE3AE, 0xE4B1, 0xED92, 0xEDD3, 0xFE55, 0xF676, 0x9B8E, 0x60E8, 0x81AA, 0x7948, 0x89A9, 0xCBCF, 0xC3EE, 0xC3AE, 0xBB6E, 0xB30D, 0xA2AB, 0x922A, 0xA2AB, 0x9A29, 0xE54F, 0xFE73, 0xFE73, 0xD46F, 0x7906, 0x7927, 0x91CA, 0x91C9,
+	0xA3B0, 0xBC52, 0x9ACC, 0x70E6, 0xDB8D, 0xF4CF, 0xECAE, 0xEC4F, 0xBBB0, 0x50A7, 0x58A8, 0x694A, 0x718C, 0x694A, 0x694B, 0x69AB, 0x618C, 0x698C, 0x8AD2, 0xA3D4, 0x828F, 0x930F, 0x694A, 0x58E8, 0x6909, 0x58E8, 0x6109, 0x68E8, 0x89A9, 0x7907, 0xB22A, 0xCAAB, 0xD30C, 0xDB4D, 0xDB4D, 0xDB6D, 0xE42F, 0xE490, 0xED11, 0xED72, 0xEDB3, 0xF614, 0xFEF8, 0xB431, 0x60C6, 0x7908, 0x89AA, 0xD3EF, 0xC3EE, 0xC3CE, 0xBBCF, 0xBBAF, 0xB36E, 0xAB0C, 0xBB0B, 0xC30A, 0xFE13, 0xFEB3, 0xF5F2, 0x89A8, 0x8969, 0xA209, 0xAA4A, 0x99E9,
+	0x698A, 0xBC93, 0xB430, 0x7907, 0xDB6D, 0xF510, 0xF4EF, 0xF44E, 0xA2AC, 0x4867, 0x58E8, 0x58E8, 0x58C8, 0x71AC, 0x50A8, 0x614B, 0x69AC, 0x69AD, 0x7A4F, 0x9353, 0x9B92, 0x8A6E, 0x7A8E, 0x5086, 0x6908, 0x58A8, 0x6108, 0x60A7, 0xAA0A, 0x8148, 0xA1E9, 0xDAEC, 0xDB0C, 0xDB4D, 0xDB4D, 0xDB8E, 0xE40E, 0xE44F, 0xE4D0, 0xE531, 0xED92, 0xF5F4, 0xF635, 0xFF19, 0x92CC, 0x5825, 0x91EA, 0xCC0E, 0xC3CE, 0xC3CE, 0xC3CE, 0xBBAF, 0xB3AE, 0xAB4D, 0xBB2A, 0xDC6D, 0xFE93, 0xFED3, 0xD42E, 0x8968, 0xA22A, 0xB26B, 0xAA0A, 0xA22A,
+	0x5066, 0xB432, 0xBCB2, 0x68E7, 0xD36C, 0xF50F, 0xF50F, 0xEC2E, 0x9A8B, 0x4887, 0x58E9, 0x5087, 0x612A, 0x79ED, 0x50A8, 0x610A, 0x614B, 0x7A2F, 0x720E, 0x8B12, 0x9373, 0x69AC, 0x9310, 0x5886, 0x7128, 0x60A7, 0x60E8, 0x68C7, 0xBA49, 0x8948, 0xAA09, 0xE30B, 0xDB0C, 0xDB2C, 0xDB4D, 0xDB8D, 0xE3CE, 0xE42F, 0xE490, 0xED11, 0xED72, 0xF5D4, 0xF636, 0xFEB8, 0xE5D6, 0x4825, 0x91EA, 0xD42E, 0xC3EE, 0xC3EE, 0xBBAE, 0xBBAE, 0xB38E, 0xAB2C, 0xDCAE, 0xFE12, 0xFEB3, 0xFE32, 0xB2C9, 0x99A9, 0xB28A, 0xAA29, 0x9A09, 0xA26B,
+	0x4826, 0xA3D1, 0xBCD3, 0x68E6, 0xD36C, 0xF50F, 0xF50F, 0xF44E, 0x920A, 0x50A8, 0x58A7, 0x5087, 0x79ED, 0x698B, 0x58C8, 0x58C8, 0x50A8, 0x698C, 0x7A2F, 0x8AF2, 0x9BB4, 0x9B73, 0x8AAE, 0x60C7, 0x6907, 0x60E7, 0x58A7, 0x8948, 0xD2CB, 0x9188, 0xB229, 0xE30C, 0xDB2C, 0xDB2C, 0xDB2C, 0xDB6D, 0xE3AD, 0xE40F, 0xE470, 0xE4F1, 0xED52, 0xEDD4, 0xF636, 0xF657, 0xFEF9, 0x71C9, 0x99EA, 0xD44F, 0xC3EE, 0xC3CE, 0xBBCE, 0xB38E, 0xAB2D, 0xC3AD, 0xFE73, 0xF673, 0xFED4, 0xE4CE, 0xA1E7, 0xAA09, 0xBA8A, 0xA1E9, 0xA24B, 0x924B,
+	0x4005, 0x9B90, 0xC513, 0x7127, 0xD32C, 0xF510, 0xECEF, 0xEC4E, 0x920B, 0x5088, 0x50A7, 0x58E8, 0x696A, 0x614A, 0x58E8, 0x50A8, 0x58E9, 0x612A, 0x69AD, 0x9B94, 0x8AAF, 0x828E, 0x7A0C, 0x79AB, 0x79AA, 0x68E7, 0x68A7, 0xAA09, 0xDB0B, 0x9168, 0xBA6A, 0xE30C, 0xE34C, 0xE32C, 0xDB2B, 0xDB4C, 0xDB8D, 0xE3EE, 0xDC4F, 0xE4B0, 0xE532, 0xEDB4, 0xEE16, 0xF637, 0xFEF9, 0xA3AF, 0x9A49, 0xD44F, 0xBBCE, 0xBBAE, 0xBBCE, 0xB3AE, 0xAB0C, 0xD44E, 0xFE93, 0xF693, 0xFE53, 0xD36A, 0xB228, 0xB24A, 0xAA29, 0x9A0A, 0xA24C, 0x89EA,
+	0x4025, 0x8AEE, 0xC514, 0x7988, 0xCB2B, 0xF50F, 0xED0F, 0xEC6F, 0x9A2C, 0x5087, 0x58C8, 0x6109, 0x58E8, 0x6109, 0x58E8, 0x58C8, 0x5909, 0x696B, 0x69AD, 0x8B33, 0x82B0, 0x71ED, 0x58E8, 0x6908, 0x7149, 0x58C7, 0x7907, 0xC28A, 0xCACB, 0x9188, 0xD2CB, 0xE34C, 0xE34D, 0xDB4C, 0xDB2C, 0xDB2C, 0xDB6D, 0xE3AE, 0xE42F, 0xDC70, 0xE511, 0xED93, 0xEDF6, 0xF636, 0xFEB8, 0xDD73, 0xB30B, 0xCC0F, 0xC3EE, 0xC3EF, 0xBBCE, 0xB3AD, 0xB34D, 0xD3EC, 0xF58F, 0xFE93, 0xF590, 0xC289, 0xAA29, 0xA209, 0x99C9, 0xA24B, 0x920A, 0x922B,
+	0x4026, 0x826D, 0xC534, 0x81E9, 0xCAEB, 0xF4EF, 0xF4EE, 0xEC4E, 0xA28C, 0x50A7, 0x58E9, 0x58C8, 0x58E9, 0x6129, 0x6109, 0x58C8, 0x5909, 0x69AD, 0x69CD, 0x698C, 0x69AC, 0x9B32, 0x6149, 0x58A6, 0x5887, 0x5886, 0x99A8, 0xD2CB, 0xAA2A, 0x99A9, 0xDB2C, 0xE34C, 0xE36D, 0xE34C, 0xDB4C, 0xDB2C, 0xDB6D, 0xE3AD, 0xDBEE, 0xE46F, 0xE4D0, 0xE553, 0xEDD5, 0xF636, 0xF677, 0xFE97, 0xC36D, 0x9A29, 0xA30B, 0xB38D, 0xBBEE, 0xBBEE, 0xCC0E, 0xCB6B, 0xD42C, 0xFED3, 0xE4CD, 0xB208, 0xA1E9, 0x91A8, 0xA20A, 0x9A2A, 0x922B, 0x89CA,
+	0x4004, 0x7A0B, 0xCD75, 0x8A4A, 0xC2CA, 0xF4EF, 0xF50E, 0xEC4E, 0xA24B, 0x58E8, 0x5087, 0x58E8, 0x5909, 0x6109, 0x6109, 0x50A7, 0x50C8, 0x69AC, 0x9312, 0x69AC, 0x71CC, 0x6929, 0x58A7, 0x5887, 0x5066, 0x7907, 0xC249, 0xCACB, 0x8127, 0xC28B, 0xE32C, 0xDB4C, 0xE36C, 0xE34C, 0xE34C, 0xDB2B, 0xDB4C, 0xE38D, 0xE3CD, 0xE42E, 0xE48F, 0xE511, 0xEDB4, 0xF616, 0xF657, 0xFED8, 0xBBAE, 0x8147, 0x89A8, 0x8188, 0x81C9, 0x924B, 0xBBCD, 0xD40C, 0xE50F, 0xFEB2, 0xBB09, 0x9127, 0x9189, 0x99E9, 0x9A2A, 0x920A, 0x924B, 0x7108,
+	0x7108, 0x8A6C, 0xD595, 0x9AED, 0xC2CA, 0xF4EF, 0xF50F, 0xE42D, 0x920B, 0x58A8, 0x58C8, 0x58C8, 0x58C8, 0x6109, 0x6129, 0x58A8, 0x58C8, 0x50A8, 0x720E, 0x9B94, 0x8A6E, 0x58A7, 0x5086, 0x5066, 0x5886, 0xA1E8, 0xD2EB, 0x8947, 0x9188, 0xE32C, 0xDB2B, 0xDB4C, 0xDB4C, 0xE36C, 0xE34C, 0xDB2B, 0xDB4C, 0xDB6C, 0xDBAD, 0xE40E, 0xE44F, 0xE4F0, 0xED93, 0xEDF6, 0xF637, 0xFEB8, 0xD513, 0x9209, 0xA26A, 0x89C9, 0x7108, 0x4805, 0xA2CA, 0xF5AE, 0xFE10, 0xE4EE, 0x80E6, 0x7927, 0x91C9, 0x9A4B, 0x89A9, 0x9A6B, 0x8A0B, 0x68E7,
+	0x8A0A, 0xA34E, 0xCD75, 0xA36E, 0xC2CA, 0xF4EF, 0xF52F, 0xE42D, 0x8A0B, 0x50A8, 0x58C8, 0x58C8, 0x50C8, 0x5909, 0x614A, 0x58E9, 0x5909, 0x692A, 0x592A, 0x826F, 0x7A2D, 0x50A7, 0x5086, 0x5066, 0x8148, 0xAA09, 0x9167, 0x8947, 0xD2CB, 0xDB0B, 0xDB2C, 0xE34C, 0xE34C, 0xEB6D, 0xE36D, 0xDB4C, 0xDB4C, 0xDB4C, 0xDB8C, 0xDBCD, 0xE42F, 0xE490, 0xE532, 0xEDD5, 0xEE17, 0xF677, 0xEE16, 0x9A4A, 0xA26A, 0x9A4A, 0x8A0A, 0x6907, 0xB30C, 0xFE71, 0xD46D, 0x8167, 0x70C7, 0x89A9, 0x9A4B, 0x8189, 0x89CA, 0xA2AD, 0x81CA, 0x7128,
+	0x7128, 0x92AD, 0xC514, 0xABAF, 0xBACA, 0xF4EF, 0xF52F, 0xE44E, 0x7969, 0x50A8, 0x58E8, 0x6109, 0x58E9, 0x612A, 0x698C, 0x71ED, 0x590A, 0x696B, 0x698C, 0x8AB0, 0x71EC, 0x4887, 0x5086, 0x5886, 0x7127, 0x8927, 0xA9E9, 0xD2EB, 0xD2EA, 0xDB0B, 0xDB2B, 0xE32B, 0xDB4C, 0xE36D, 0xE38D, 0xE38D, 0xDB6C, 0xDB4C, 0xDB6C, 0xDBAD, 0xE40E, 0xE46F, 0xE4F1, 0xE594, 0xEDF6, 0xEE57, 0xFEB8, 0xAB0C, 0x9209, 0x9A8B, 0x926B, 0x9A4B, 0xBB0B, 0xCC0C, 0x8988, 0x8148, 0x8989, 0xA26B, 0x81A9, 0x7948, 0xA2AD, 0x9A8C, 0x7168, 0x6908,
+	0x58C7, 0x71AA, 0xCD55, 0xC4B2, 0xBAEB, 0xECCF, 0xFD50, 0xDC0E, 0x68E8, 0x50C8, 0x58E8, 0x610A, 0x590A, 0x614A, 0x612A, 0x824F, 0x698C, 0x696B, 0x696B, 0x7A0E, 0x7A0D, 0x4886, 0x6085, 0x8927, 0xB209, 0xCA89, 0xD2EA, 0xD2CB, 0xD2EA, 0xDAEB, 0xDB2B, 0xDB2B, 0xDB4C, 0xDB4C, 0xE38D, 0xDB8D, 0xE38D, 0xE38C, 0xDB8D, 0xDBAD, 0xDBED, 0xE44F, 0xE4D1, 0xE553, 0xEDB5, 0xEE16, 0xFEB8, 0xBC30, 0x79A8, 0x9AAC, 0xA2EC, 0xB2CB, 0xB26A, 0xA1EA, 0xAA4A, 0x9A09, 0x920A, 0x89C9, 0x7147, 0x924B, 0xAB0E, 0x81EA, 0x68E7, 0x60C6,
+	0x50A7, 0x6949, 0xDDB6, 0xDD93, 0xC32B, 0xECCE, 0xF550, 0xCBCE, 0x60C8, 0x50C8, 0x6108, 0x694A, 0x612A, 0x79CC, 0x614B, 0x7A0D, 0x71ED, 0x69AB, 0x612A, 0x614B, 0x71ED, 0x694A, 0x80E6, 0xB9E8, 0xCA69, 0xD2AA, 0xD2CB, 0xDAC9, 0xDAEA, 0xDB0B, 0xDB0B, 0xE32B, 0xE32C, 0xE34C, 0xE36D, 0xE38D, 0xDB8D, 0xE3AD, 0xE3AD, 0xE3CD, 0xE40E, 0xE44E, 0xE4B0, 0xE512, 0xED94, 0xEDF6, 0xF697, 0xDD54, 0x81E9, 0x924A, 0xAAEC, 0xC2EB, 0xC2AA, 0xCB0B, 0xBA8A, 0x91E9, 0x89CA, 0x81A9, 0x8A0A, 0xB32E, 0x926B, 0x60E7, 0x68C7, 0x89A9,
+};
+
+static const struct s_bitmap _lena_levels_64x64 =
+{
+	_lena_levels_64x64_data,
+	64,
+	64,
+	false,
+	BITMAP_BUFFER_16BPP,
+	NULL,
+};
+
+static const uint16_t _lena_levels_32x32_data[] =
+{
+	0xE42E, 0xE3ED, 0xEC8E, 0xDBCD, 0xA9EA, 0xB24A, 0xB26A, 0xCACB, 0xD30B, 0xD30B, 0xD32C, 0xD32C, 0xD32C, 0xCB2C, 0xCB2B, 0xD32B, 0xCB0C, 0xCB0B, 0xCB0C, 0xBAAB, 0xC30C, 0xE42E, 0xE40D, 0xE40D, 0xDBCC, 0xF5B1, 0xDCCF, 0xB26A, 0xC2EB, 0xC2EB, 0xCB0C, 0xA24A,
+	0xE40D, 0xE42D, 0xEC8E, 0xDB8C, 0xA9E9, 0xB22A, 0xBA4A, 0xCACA, 0xD30B, 0xD30B, 0xD30B, 0xD30C, 0xD30B, 0xD2EB, 0xCAEB, 0xD30C, 0xD30C, 0xCAEB, 0xCAEB, 0xC2AB, 0xBA8B, 0xE40E, 0xEC4E, 0xE42D, 0xE3ED, 0xE42D, 0xFE52, 0xBB2B, 0xBAAA, 0xCB2C, 0x9A0A, 0x5087,
+	0xE44D, 0xEC6D, 0xEC6D, 0xDB8C, 0xA9C9, 0xB229, 0xBA49, 0xCACA, 0xCAEB, 0xD2EB, 0xD2EB, 0xD2EB, 0xD2EB, 0xCB0B, 0xCB2C, 0xCAEB, 0xCACB, 0xD2EB, 0xD2EB, 0xC2AB, 0xBA8B, 0xDBAE, 0xE42E, 0xE40D, 0xE40D, 0xDB8C, 0xED50, 0xE591, 0xBA8A, 0x9A0A, 0x5887, 0x60C7,
+	0xEC6D, 0xE38B, 0xEC4D, 0xE3AC, 0xA1A9, 0xB209, 0xBA4A, 0xCAAA, 0xCACB, 0xD2EB, 0xD30C, 0xCB0D, 0xCB8F, 0xCC71, 0xD513, 0xD532, 0xD430, 0xC2CB, 0xCAAA, 0xC2AB, 0xBA6A, 0xDB6D, 0xDBCE, 0xE3CD, 0xDBAC, 0xDB6C, 0xD36B, 0xFEB3, 0xAB2C, 0x5026, 0x60E8, 0x5887,
+	0xE3EC, 0xBA29, 0xF48D, 0xDB8B, 0x9988, 0xAA0A, 0xB229, 0xC28A, 0xCAAB, 0xCACB, 0xC2AB, 0xBB0D, 0xC34E, 0xCBCF, 0xD512, 0xDD94, 0xE615, 0xD554, 0xBAEC, 0xB22A, 0xBA6B, 0xE3AD, 0xDB6D, 0xDB6C, 0xE38C, 0xDB8C, 0xE38C, 0xD3ED, 0x6128, 0x5887, 0x58A7, 0x60E8,
+	0xBA49, 0xAA09, 0xF48E, 0xDB6B, 0x9988, 0xAA0A, 0xB229, 0xC28A, 0xCAAB, 0xC28A, 0xBA8B, 0xC2CC, 0xCB4D, 0xCB8E, 0xD491, 0xDD94, 0xE5F6, 0xEE98, 0xE657, 0xA24A, 0xA9EA, 0xEBEE, 0xCB2C, 0xA1EA, 0xEBAD, 0xE36C, 0xEBAD, 0x7108, 0x5867, 0x58C7, 0x6109, 0xB34D,
+	0x99A8, 0xB229, 0xF46E, 0xDB8C, 0x9988, 0xAA0A, 0xB22A, 0xC2AA, 0xC2AB, 0xBA6A, 0xC2AB, 0xCB4D, 0xCB6D, 0xCB4E, 0xDCD2, 0xE5D5, 0xE617, 0xE617, 0xEE98, 0xDDD6, 0xA209, 0xE3AD, 0xDB6D, 0x6866, 0xBA8A, 0xEBEE, 0x99C9, 0x5887, 0x60C8, 0x58A8, 0xA2ED, 0xDC70,
+	0x99A9, 0xB209, 0xF44E, 0xDB8C, 0x9968, 0xAA09, 0xB209, 0xC2EB, 0xC2EB, 0xBA4A, 0xCAEC, 0xCB2C, 0xC32D, 0xD491, 0xE573, 0xDD94, 0xE5D6, 0xE617, 0xE617, 0xEED9, 0xCC92, 0xDB4C, 0xD32C, 0x6908, 0xC4D3, 0xF678, 0x6969, 0x60A7, 0x5887, 0x8A0B, 0xDC50, 0xD46F,
+	0xA9E9, 0xBA49, 0xF46D, 0xDBAC, 0x9988, 0xB209, 0xB1E9, 0xCB6C, 0xC2CB, 0xBA2A, 0xC2CB, 0xC30C, 0xD3EF, 0xDCD2, 0xDD12, 0xDD13, 0xDD74, 0xE5B5, 0xDDB5, 0xE617, 0xDE38, 0xE46F, 0xD42F, 0xD5B5, 0xEE98, 0xEEB9, 0x71EB, 0x5046, 0x6909, 0xCBEF, 0xDC4F, 0xD42F,
+	0xA9E9, 0xBA49, 0xF48E, 0xDBCC, 0x9988, 0xB209, 0xA9C8, 0xD3CC, 0xD36B, 0xB209, 0xCACC, 0xD38E, 0xD3AE, 0xDC50, 0xDCD2, 0xE4D2, 0xDCD2, 0xDD33, 0xDD75, 0xD534, 0xD553, 0xDDB5, 0xE616, 0xE657, 0xE5D5, 0xD574, 0x60E8, 0x5867, 0xB2CD, 0xDC70, 0xD44F, 0xD42F,
+	0xA9E9, 0xBA49, 0xF4AE, 0xE3EC, 0x9988, 0xAA09, 0xA9A8, 0xD40D, 0xEC4D, 0xC26A, 0xCB2D, 0xCB4D, 0xD38E, 0xD3CF, 0xCBD0, 0xCC10, 0xD451, 0xCC31, 0xCC51, 0xDD13, 0xE5B4, 0xE5D6, 0xE657, 0xE5F6, 0xD450, 0xA34E, 0x4846, 0x818A, 0xD430, 0xD450, 0xD42F, 0xD44F,
+	0xAA09, 0xC269, 0xF4AE, 0xE3EC, 0x9988, 0xB229, 0xA9A8, 0xD40D, 0xECAD, 0xC2AB, 0xCB0C, 0xCB2D, 0xD34E, 0xB2CE, 0x89CD, 0x9290, 0x71CD, 0x718A, 0xCC92, 0xE5F5, 0xDDD5, 0xE616, 0xCCF2, 0xBB4D, 0xBB8E, 0x6949, 0x5067, 0xAAED, 0xDC90, 0xD450, 0xD42F, 0xD42F,
+	0xB22A, 0xC249, 0xF48E, 0xE3EC, 0x9988, 0xAA09, 0xA9C8, 0xBAEB, 0xED2F, 0xCAEC, 0xC2ED, 0xCB0D, 0xA24D, 0x692B, 0x610A, 0x696C, 0x71CD, 0xCCB1, 0xDD94, 0xD553, 0xDD74, 0xA30E, 0xB34E, 0xD40E, 0x7169, 0x5866, 0x7129, 0xD40F, 0xDCB0, 0xD470, 0xCC50, 0xCC2F,
+	0xB22A, 0xB229, 0xF48E, 0xE40D, 0x9988, 0xA9E9, 0xB209, 0xBA4A, 0xE4AF, 0xC2EB, 0xCACD, 0x91EB, 0x60EA, 0x696B, 0x60E9, 0x692A, 0xBC13, 0xDD74, 0xD4D2, 0xE574, 0xF5D5, 0x9A2B, 0xA2CE, 0x7148, 0x5887, 0x58A7, 0x924B, 0xD470, 0xD490, 0xD490, 0xD470, 0xCC4F,
+	0xAA09, 0xB229, 0xEC8E, 0xE40D, 0x9989, 0xAA0A, 0xBA4A, 0xC28A, 0xCB4C, 0xCAEC, 0x89AB, 0x60C9, 0x60C9, 0x612B, 0x716B, 0xCC30, 0xD554, 0xDCB2, 0xECD2, 0xF5B4, 0xFEB8, 0xC38E, 0x796A, 0x798A, 0x60C7, 0x60C8, 0xBB8E, 0xD490, 0xCC2F, 0xCC2F, 0xCC2F, 0xD40F,
+	0xAA09, 0xB209, 0xEC8E, 0xE42D, 0x9989, 0xB22A, 0xB209, 0xD2EB, 0xB2AB, 0xA22C, 0x614B, 0x610A, 0x60E9, 0x60E9, 0xBBAE, 0xE573, 0xC38E, 0xBA8B, 0xE430, 0xF574, 0xF594, 0xB2CC, 0x7949, 0x81EB, 0x5887, 0x79AA, 0xD44F, 0xD46F, 0xD46F, 0xCC2F, 0xC40F, 0xBBCF,
+	0xA9E9, 0xA9E9, 0xF48E, 0xE42D, 0xA1A8, 0xA9C8, 0xB26A, 0xDC2E, 0x81AA, 0x696C, 0x71AC, 0x60E9, 0x5088, 0x924B, 0xEDD4, 0xA26B, 0x8149, 0xA28C, 0xD2AB, 0xED13, 0x9A6C, 0x70E7, 0x7149, 0x8A2B, 0x5066, 0xA2AC, 0xDC6F, 0xCC2E, 0xD42E, 0xCC2F, 0xC3EF, 0xB3AF,
+	0xA9E9, 0xA188, 0xECAE, 0xEC6E, 0xA9A8, 0xBA6A, 0xAACE, 0x7A2D, 0x696C, 0x71CE, 0x7A2F, 0x5067, 0x60C7, 0xD4B1, 0xCBAE, 0xD30D, 0xCB8F, 0xDC51, 0xDAEC, 0xECF3, 0xCB8F, 0x9189, 0x7149, 0x924C, 0x58A7, 0xBB8E, 0xD44F, 0xCC0F, 0xCC0F, 0xBBAE, 0xCC4F, 0xE550,
+	0x9188, 0x9148, 0xEC8E, 0xEC4E, 0xA9A8, 0xBACE, 0x81EE, 0x71CE, 0x698C, 0x58EA, 0x8A4D, 0x58A7, 0xA30E, 0xB36E, 0xC22A, 0xEC30, 0xF4F2, 0xEC50, 0xDB0C, 0xED34, 0xEC51, 0xB1E9, 0x7949, 0x8A2B, 0x7128, 0xD44F, 0xCC2F, 0xCC0F, 0xBBAE, 0xCC6F, 0xF5F0, 0xF5F2,
+	0x8148, 0x8107, 0xEC6E, 0xEC2D, 0xA9EA, 0xA26E, 0x79CE, 0x7A70, 0x614B, 0x60C7, 0x89EA, 0x81C9, 0xAB8E, 0x70E7, 0xD28B, 0xE36E, 0xEC50, 0xE3CE, 0xD26A, 0xE491, 0xEC51, 0x9989, 0x6908, 0x924C, 0x922A, 0xDC8F, 0xCC0F, 0xC3EE, 0xC3CE, 0xED8F, 0xF632, 0xEE54,
+	0x8948, 0x9188, 0xEC8F, 0xEC4E, 0xA9C9, 0x9A0C, 0x718D, 0x7A2F, 0x824E, 0x6908, 0x718A, 0xAB6E, 0x7189, 0x7908, 0xD2AA, 0xE32D, 0xEBCF, 0xE3CF, 0xD2EC, 0xE471, 0xDBAF, 0x68E8, 0x68E8, 0x924C, 0xBB6D, 0xD44F, 0xCC0F, 0xC3AE, 0xD46E, 0xFE31, 0xF653, 0xEE74,
+	0x78E7, 0x99C9, 0xECAF, 0xEC4E, 0xAA0A, 0x920D, 0x614B, 0x71AD, 0x824F, 0x926D, 0xC411, 0x81C9, 0x5886, 0x8169, 0xD28A, 0xE32C, 0xE32D, 0xDB2C, 0xE3EF, 0xECB2, 0xA24B, 0x58C8, 0x7108, 0x924B, 0xD40E, 0xCC2F, 0xC3EF, 0xC38E, 0xDCCF, 0xFE73, 0xEE74, 0xF675,
+	0x68A6, 0x99C9, 0xECAF, 0xEC6E, 0xAA2C, 0x81CC, 0x614B, 0x82B1, 0x7A0F, 0xCBF1, 0xAB4D, 0x5087, 0x68E7, 0x7108, 0xB1E9, 0xDAEB, 0xE32C, 0xDA8A, 0xE30D, 0xDB4E, 0x6908, 0x68E7, 0x7907, 0x9A6B, 0xDC6E, 0xCC2F, 0xC40F, 0xBB8D, 0xDD30, 0xFED5, 0xF674, 0xF694,
+	0x5887, 0xA209, 0xEC8F, 0xEC4E, 0x99CA, 0x718B, 0x612A, 0x82B1, 0x8AF2, 0xA30F, 0x6129, 0x60C7, 0x60C7, 0x68E7, 0x7907, 0xB1C9, 0xDB0C, 0xE3CF, 0xF451, 0x9A2A, 0x4867, 0x7928, 0x8168, 0xA28C, 0xD46F, 0xC44F, 0xC44F, 0xAB6E, 0xE592, 0xFED5, 0xFEB4, 0xEDD1,
+	0x60C8, 0x8948, 0xEC6E, 0xEC6F, 0x922C, 0x612A, 0x612A, 0x7A4F, 0x82D2, 0x9312, 0x69AB, 0x68E7, 0x60C8, 0x60C7, 0x68E7, 0xAA09, 0xCAEC, 0xDB8E, 0xE450, 0xC450, 0x720B, 0x60E7, 0x89A9, 0xA2AC, 0xBB6D, 0xB32C, 0xB34D, 0xA32D, 0xEDD1, 0xFEB3, 0xC40D, 0x7127,
+	0xA390, 0x8188, 0xDBED, 0xF4D0, 0x8A0B, 0x58C9, 0x718B, 0x69AC, 0x720E, 0x9312, 0x8AAF, 0x6909, 0x60E8, 0x6108, 0x7928, 0xC26B, 0xDB2D, 0xDB4D, 0xE42F, 0xF5B3, 0xFE55, 0xABD0, 0x68C7, 0xAACC, 0xCBEF, 0xB34E, 0xA2CC, 0xAAAA, 0xFE32, 0xD4AF, 0x8127, 0x99C9,
+	0x930E, 0x9B0D, 0xDBCD, 0xFCEF, 0x79AA, 0x50A8, 0x694B, 0x5909, 0x698C, 0x82D1, 0x9331, 0x69AA, 0x60A7, 0x6908, 0x99A8, 0xBA6A, 0xE34C, 0xDB6D, 0xE40E, 0xE4D0, 0xEDB3, 0xFEF8, 0x8A4B, 0xA28B, 0xCC2F, 0xBBCF, 0xB36D, 0xDCAE, 0xFEB3, 0xAAAA, 0xA20A, 0xA24A,
+	0x7A2C, 0x9B2E, 0xD3CC, 0xF4EF, 0x7149, 0x50A8, 0x698B, 0x58C8, 0x590A, 0x82B1, 0x9331, 0x79CB, 0x60E8, 0x8148, 0xB229, 0xC28A, 0xE34C, 0xDB4C, 0xE3CE, 0xE490, 0xED73, 0xFEB8, 0xC4B2, 0xAAEB, 0xCC4F, 0xB36D, 0xBBAD, 0xFEB3, 0xED4F, 0xAA08, 0xAA4A, 0x9A2B,
+	0x69CB, 0xA34E, 0xD3AC, 0xF4EF, 0x796A, 0x50A8, 0x6109, 0x58E8, 0x612A, 0x722E, 0x7A2E, 0x6929, 0x58A7, 0xAA09, 0xB22A, 0xD2EC, 0xE36D, 0xDB2C, 0xE38D, 0xE42F, 0xE532, 0xF636, 0xF636, 0xB32C, 0xB36D, 0xBBEE, 0xC38C, 0xF5F1, 0xDC0C, 0xA1A8, 0x9A2A, 0x920A,
+	0x79EB, 0xABF0, 0xD3AC, 0xF4CF, 0x798A, 0x50A7, 0x6109, 0x58C8, 0x5909, 0x826F, 0x71AB, 0x5066, 0x7907, 0xB209, 0xB229, 0xE34C, 0xE34C, 0xE34C, 0xDB4C, 0xE3ED, 0xE4B0, 0xEDD5, 0xFEB8, 0xB32D, 0x89A8, 0x7168, 0xCC2D, 0xF58F, 0x91C8, 0x91A9, 0x9A2B, 0x81A9,
+	0x928C, 0xB431, 0xD3ED, 0xECCF, 0x6929, 0x50A8, 0x5909, 0x696B, 0x5909, 0x7A2E, 0x696A, 0x4845, 0x8968, 0xAA09, 0xD2EB, 0xE32C, 0xE36C, 0xE36D, 0xDB4C, 0xDB8D, 0xE44F, 0xE553, 0xF698, 0xCC91, 0x9229, 0x81C9, 0xCBEC, 0xA289, 0x8148, 0x89C9, 0x9A4C, 0x7169,
+	0x6969, 0xC4D2, 0xDC4D, 0xE48F, 0x60C8, 0x6109, 0x694B, 0x71CD, 0x71AC, 0x698C, 0x616B, 0x8107, 0xC269, 0xD2EA, 0xDAEB, 0xDB2B, 0xE34C, 0xE38D, 0xE38D, 0xE3AD, 0xE42E, 0xE4F1, 0xEE16, 0xDD74, 0x8A2A, 0xBB0C, 0xC28A, 0xA209, 0x81CA, 0x924B, 0x8A0B, 0x7107,
+};
+
+static const struct s_bitmap _lena_levels_32x32 =
+{
+	_lena_levels_32x32_data,
+	32,
+	32,
+	false,
+	BITMAP_BUFFER_16BPP,
+	NULL,
+};
+
+static const bitmap_t * const _lena_levels_list[] =
+{
+	&_lena_levels_128x128,
+	&_lena_levels_64x64,
+	&_lena_levels_32x32,
+};
+
+static const struct s_bitmap_levels _lena_levels =
+{
+	_lena_levels_list,
+	3,
+};
+
+const bitmap_levels_t *lena_levels = &_lena_levels;
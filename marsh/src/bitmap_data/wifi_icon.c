@@ -71,6 +71,7 @@ static const struct s_bitmap _wifi_icon =
 	39,
 	true,
 	BITMAP_BUFFER_8BPP,
+	NULL,
 };
 
 const bitmap_t *wifi_icon_bitmap = &_wifi_icon;
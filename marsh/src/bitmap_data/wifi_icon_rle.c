@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "bitmap_data.h"
+
+/* 1950 bytes as 8BPP alpha. */
+static const uint8_t _wifi_icon_rle_data[] =
+{
+	0x0F, 0x91, 0x04, 0x32, 0x65, 0x91, 0xB4, 0xD2, 0xE6, 0xF5, 0xFC, 0xFC, 0xF5, 0xE6, 0xD2, 0xB4, 0x91, 0x65, 0x32, 0x04, 0x0F,
+	0x0C, 0x83, 0x19, 0x6A, 0xB4, 0xF3, 0x4F, 0x83, 0xF3, 0xB4, 0x6A, 0x19, 0x0C,
+	0x09, 0x83, 0x05, 0x56, 0xBA, 0xFC, 0x55, 0x83, 0xFC, 0xBA, 0x56, 0x05, 0x09,
+	0x07, 0x82, 0x0A, 0x71, 0xE2, 0x5B, 0x82, 0xE2, 0x71, 0x0A, 0x07,
+	0x05, 0x82, 0x03, 0x63, 0xE5, 0x4C, 0x85, 0xFE, 0xF4, 0xEE, 0xEE, 0xF4, 0xFE, 0x4C, 0x82, 0xE5, 0x63, 0x03, 0x05,
+	0x04, 0x81, 0x30, 0xCA, 0x49, 0x86, 0xDA, 0x9F, 0x6C, 0x41, 0x20, 0x09, 0x02, 0x01, 0x86, 0x02, 0x09, 0x20, 0x41, 0x6C, 0x9F, 0xDA, 0x49, 0x81, 0xCA, 0x30, 0x04,
+	0x02, 0x82, 0x03, 0x7B, 0xFA, 0x47, 0x82, 0xC7, 0x6F, 0x21, 0x0F, 0x82, 0x21, 0x6F, 0xC7, 0x47, 0x82, 0xFA, 0x7B, 0x03, 0x02,
+	0x01, 0x81, 0x15, 0xBC, 0x46, 0x82, 0xF6, 0x98, 0x2B, 0x15, 0x82, 0x2B, 0x98, 0xF6, 0x46, 0x81, 0xBC, 0x15, 0x01,
+	0x00, 0x81, 0x2B, 0xDF, 0x45, 0x82, 0xFB, 0x95, 0x1A, 0x19, 0x82, 0x1A, 0x95, 0xFB, 0x45, 0x81, 0xDF, 0x2B, 0x00,
+	0x81, 0x3A, 0xEF, 0x45, 0x81, 0xC2, 0x2B, 0x0B, 0x85, 0x0A, 0x1C, 0x25, 0x25, 0x1C, 0x0A, 0x0B, 0x81, 0x2B, 0xC2, 0x45, 0x81, 0xEF, 0x3A,
+	0x80, 0xB2, 0x44, 0x82, 0xF7, 0x70, 0x02, 0x07, 0x85, 0x0F, 0x51, 0x8E, 0xC1, 0xE9, 0xFE, 0x43, 0x85, 0xFE, 0xE9, 0xC1, 0x8E, 0x51, 0x0F, 0x07, 0x82, 0x02, 0x71, 0xF7, 0x44, 0x80, 0xB2,
+	0x81, 0x0A, 0xBC, 0x42, 0x81, 0xE0, 0x34, 0x06, 0x83, 0x05, 0x53, 0xB3, 0xF8, 0x4D, 0x83, 0xF8, 0xB3, 0x53, 0x05, 0x06, 0x81, 0x34, 0xE0, 0x42, 0x81, 0xBC, 0x0A,
+	0x00, 0x81, 0x09, 0xBA, 0x40, 0x81, 0xCA, 0x18, 0x05, 0x82, 0x07, 0x6A, 0xE0, 0x53, 0x82, 0xE1, 0x6B, 0x07, 0x05, 0x81, 0x18, 0xCA, 0x40, 0x81, 0xBA, 0x09, 0x00,
+	0x01, 0x82, 0x09, 0x85, 0x0D, 0x05, 0x81, 0x4B, 0xDB, 0x57, 0x81, 0xDB, 0x4B, 0x05, 0x82, 0x0D, 0x85, 0x09, 0x01,
+	0x08, 0x81, 0x0E, 0xA2, 0x49, 0x87, 0xFE, 0xEA, 0xD2, 0xC5, 0xC5, 0xD2, 0xEA, 0xFE, 0x49, 0x81, 0xA2, 0x0E, 0x08,
+	0x07, 0x81, 0x29, 0xD9, 0x47, 0x83, 0xD1, 0x83, 0x43, 0x11, 0x05, 0x83, 0x11, 0x43, 0x83, 0xD1, 0x47, 0x81, 0xD9, 0x29, 0x07,
+	0x06, 0x81, 0x3D, 0xEF, 0x45, 0x82, 0xF8, 0x9B, 0x2F, 0x0D, 0x82, 0x2F, 0x9B, 0xF8, 0x45, 0x81, 0xEF, 0x3D, 0x06,
+	0x06, 0x80, 0xA5, 0x44, 0x82, 0xFE, 0xA7, 0x1F, 0x11, 0x82, 0x1F, 0xA7, 0xFE, 0x44, 0x80, 0xA5, 0x06,
+	0x06, 0x81, 0x05, 0xAD, 0x42, 0x81, 0xE8, 0x4B, 0x15, 0x81, 0x4B, 0xE8, 0x42, 0x81, 0xAD, 0x05, 0x06,
+	0x07, 0x81, 0x05, 0xAB, 0x40, 0x81, 0xCB, 0x1B, 0x07, 0x87, 0x01, 0x19, 0x3C, 0x4B, 0x4B, 0x3C, 0x19, 0x01, 0x07, 0x81, 0x1B, 0xCB, 0x40, 0x81, 0xAB, 0x05, 0x07,
+	0x08, 0x82, 0x04, 0x79, 0x0C, 0x05, 0x83, 0x04, 0x4C, 0xA4, 0xE6, 0x45, 0x83, 0xE6, 0xA4, 0x4C, 0x04, 0x05, 0x82, 0x0C, 0x79, 0x04, 0x08,
+	0x0F, 0x82, 0x02, 0x5F, 0xDC, 0x4B, 0x82, 0xDC, 0x5F, 0x02, 0x0F,
+	0x0E, 0x81, 0x1F, 0xC2, 0x4F, 0x81, 0xC2, 0x1F, 0x0E,
+	0x0D, 0x81, 0x3C, 0xED, 0x51, 0x81, 0xED, 0x3C, 0x0D,
+	0x0D, 0x80, 0x97, 0x46, 0x85, 0xE8, 0xB8, 0xA0, 0xA0, 0xB8, 0xE8, 0x46, 0x80, 0x97, 0x0D,
+	0x0D, 0x81, 0x02, 0x9D, 0x42, 0x83, 0xFB, 0xA0, 0x36, 0x01, 0x03, 0x83, 0x01, 0x36, 0xA0, 0xFB, 0x42, 0x81, 0x9D, 0x02, 0x0D,
+	0x0E, 0x81, 0x02, 0x9B, 0x40, 0x81, 0xD2, 0x30, 0x09, 0x81, 0x30, 0xD2, 0x40, 0x81, 0x9B, 0x02, 0x0E,
+	0x0F, 0x82, 0x02, 0x6E, 0x0C, 0x0B, 0x82, 0x0C, 0x6E, 0x02, 0x0F,
+	0x31,
+	0x31,
+	0x31,
+	0x15, 0x85, 0x18, 0x96, 0xDB, 0xDD, 0x9C, 0x1E, 0x15,
+	0x14, 0x81, 0x1B, 0xE3, 0x43, 0x81, 0xEA, 0x24, 0x14,
+	0x14, 0x80, 0xA0, 0x45, 0x80, 0xAF, 0x14,
+	0x14, 0x80, 0xE8, 0x45, 0x81, 0xF6, 0x01, 0x13,
+	0x14, 0x80, 0xEB, 0x45, 0x81, 0xF8, 0x01, 0x13,
+	0x14, 0x80, 0xA9, 0x45, 0x80, 0xB8, 0x14,
+	0x14, 0x81, 0x24, 0xED, 0x43, 0x81, 0xF2, 0x2E, 0x14,
+	0x15, 0x85, 0x25, 0xAB, 0xF0, 0xF2, 0xB1, 0x2B, 0x15,
+};
+
+static const struct s_bitmap _wifi_icon_rle =
+{
+	_wifi_icon_rle_data,
+	50,
+	39,
+	true,
+	BITMAP_BUFFER_8BPP_RLE,
+	NULL,
+};
+
+const bitmap_t *wifi_icon_rle_bitmap = &_wifi_icon_rle;
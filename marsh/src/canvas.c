@@ -28,9 +28,9 @@
 #include "helper/checks.h"
 #include "types.h"
 #include <math.h>
+#include <stddef.h>
 
 /* TODO: Add/fix the negative position or dimension on the canvas, drawing function and widget system.
- *       also, fix the out of canvas printing that happens when parent size is smaller than child's.
  *       1. Canvas should hide the scratch_pad from client, and manage if it uses the fb directly or a scratch pad.
  *       2. Clients writes (or use a writing function) to write to the canvas memory transparently.
  *       3. At the end, client inform canvas it has finished writing and canvas copies the scratch to the fb if necessary.
@@ -47,12 +47,29 @@
  */
 
 static pixel_t * scratch_pad = NULL;
+static size_t scratch_pad_size = 0;
+
+static void canvas_set_clip(canvas_t * canv, const area_t * canvas_area, const area_t * clip_area)
+{
+	area_t clip;
+
+	area_set_intersection(&clip, canvas_area, framebuffer_area());
+
+	if (clip_area)
+		area_set_intersection(&clip, &clip, clip_area);
+
+	canv->clip.x = clip.x - canvas_area->x;
+	canv->clip.y = clip.y - canvas_area->y;
+	canv->clip.width = clip.width;
+	canv->clip.height = clip.height;
+}
 
 void canvas_delete_scratchpad()
 {
 	if (scratch_pad)
 		free(scratch_pad);
 	scratch_pad = NULL;
+	scratch_pad_size = 0;
 }
 
 canvas_t * canvas_new_fullscreen()
@@ -61,34 +78,55 @@ canvas_t * canvas_new_fullscreen()
 	MEMORY_ALLOC_CHECK_RETURN(canv, NULL);
 
 	canv->tgt_memory_start = framebuffer_start();
-	canv->height = framebuffer_height();
-	canv->width = framebuffer_width();
-	canv->line_incrementation_width = framebuffer_width();
+	canv->height = (dim_t)framebuffer_height();
+	canv->width = (dim_t)framebuffer_width();
+	canv->line_incrementation_width = framebuffer_stride();
+	area_set(&canv->clip, 0, 0, framebuffer_width(), framebuffer_height());
 
 	return canv;
 }
 
 canvas_t * canvas_new(const area_t * area)
 {
-	canvas_t * canv = (canvas_t *)calloc(1, sizeof(struct s_canvas));
+	return canvas_new_clipped(area, NULL);
+}
+
+canvas_t * canvas_new_clipped(const area_t * area, const area_t * clip_area)
+{
+	canvas_t * canv;
+
+	PTR_CHECK_RETURN(area, "canvas", NULL);
+
+	canv = (canvas_t *)calloc(1, sizeof(struct s_canvas));
 	MEMORY_ALLOC_CHECK_RETURN(canv, NULL);
 
-	canv->tgt_memory_start = framebuffer_at(area->x, area->y);
+	/* The origin may lay outside the framebuffer, the clip keeps writes inside it. */
+	canv->tgt_memory_start = framebuffer_start() + area->x + (ptrdiff_t)area->y * (ptrdiff_t)framebuffer_stride();
 	canv->height = area->height;
 	canv->width = area->width;
-	canv->line_incrementation_width = framebuffer_width();
+	canv->line_incrementation_width = framebuffer_stride();
+	canvas_set_clip(canv, area, clip_area);
 
 	return canv;
 }
 
+/* The scratch pad has the framebuffer layout, it follows the framebuffer size. */
 canvas_t * canvas_new_scratchpad()
 {
+	size_t size = framebuffer_stride() * framebuffer_height();
 	canvas_t * canv = canvas_new_fullscreen();
 	PTR_CHECK_RETURN(canv, "canvas", NULL);
 
-	if (scratch_pad == NULL)
+	if (scratch_pad_size != size)
 	{
-		scratch_pad = (typeof(scratch_pad))malloc(framebuffer_width() * framebuffer_height() * sizeof(*scratch_pad));
+		canvas_delete_scratchpad();
+		scratch_pad = (typeof(scratch_pad))malloc(size * sizeof(*scratch_pad));
+		if (!scratch_pad)
+		{
+			canvas_delete(canv);
+			MEMORY_ALLOC_CHECK_RETURN(scratch_pad, NULL);
+		}
+		scratch_pad_size = size;
 	}
 
 	canv->tgt_memory_start = scratch_pad;
@@ -96,19 +134,25 @@ canvas_t * canvas_new_scratchpad()
 	return canv;
 }
 
-canvas_t * canvas_new_sub_canvas(canvas_t * canv, size_t x, size_t y, size_t width, size_t height)
+canvas_t * canvas_new_sub_canvas(canvas_t * canv, dim_t x, dim_t y, dim_t width, dim_t height)
 {
 	canvas_t *sub_canvas;
+	area_t sub_area;
 	PTR_CHECK_RETURN(canv, "canvas", NULL);
 
 	sub_canvas = (canvas_t *)calloc(1, sizeof(struct s_canvas));
 	MEMORY_ALLOC_CHECK_RETURN(sub_canvas, NULL);
 
-	sub_canvas->tgt_memory_start = canv->tgt_memory_start + x + y * canv->line_incrementation_width;
+	sub_canvas->tgt_memory_start = canv->tgt_memory_start + x + (ptrdiff_t)y * (ptrdiff_t)canv->line_incrementation_width;
 	sub_canvas->height = height;
 	sub_canvas->width = width;
 	sub_canvas->line_incrementation_width = canv->line_incrementation_width;
 
+	area_set(&sub_area, x, y, width, height);
+	area_set_intersection(&sub_canvas->clip, &sub_area, &canv->clip);
+	sub_canvas->clip.x -= x;
+	sub_canvas->clip.y -= y;
+
 	return sub_canvas;
 }
 
@@ -118,12 +162,18 @@ void canvas_delete(canvas_t *canv)
 	free(canv);
 }
 
-size_t canvas_get_width(const canvas_t *canv)
+dim_t canvas_get_width(const canvas_t *canv)
 {
 	PTR_CHECK_RETURN(canv, "canvas", 0);
 	return canv->width;
 }
 
+const area_t * canvas_clip(const canvas_t *canv)
+{
+	PTR_CHECK_RETURN(canv, "canvas", NULL);
+	return &canv->clip;
+}
+
 bool canvas_scratchpad(const canvas_t *canv)
 {
 	if (scratch_pad == NULL)
@@ -28,7 +28,13 @@ canvas_t * canvas_new_fullscreen(void);
 canvas_t * canvas_new_scratchpad(void);
 canvas_t * canvas_new(const area_t *);
 
-size_t canvas_get_width(const canvas_t *canv);
+/* Creates a canvas covering area, where only the part inside clip_area (framebuffer
+ * coordinates) is written by the drawing algorithms. A NULL clip_area clips only to
+ * the framebuffer. */
+canvas_t * canvas_new_clipped(const area_t * area, const area_t * clip_area);
+
+dim_t canvas_get_width(const canvas_t *canv);
+const area_t * canvas_clip(const canvas_t *canv);
 bool canvas_scratchpad(const canvas_t *canv);
 
 void canvas_delete(canvas_t *);
@@ -25,9 +25,14 @@
 struct s_canvas
 {
 	pixel_t *tgt_memory_start;
-	size_t height;
-	size_t width;
+	dim_t height;
+	dim_t width;
+	/* Pixels from a row to the next, the framebuffer stride. */
 	size_t line_incrementation_width;
+
+	/* Region of the canvas that may be written, relative to the canvas origin.
+	 * Drawing algorithms discard every pixel outside of it. */
+	area_t clip;
 };
 
 #endif /* CANVAS_PRIVATE_H_ */
@@ -0,0 +1,456 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "helper/checks.h"
+#include "helper/number.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "canvas.h"
+#include "chart.h"
+#include "color.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "render_thread.h"
+#include "sprite.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+
+struct s_chart_column
+{
+	int32_t min;
+	int32_t max;
+	int32_t last;
+};
+
+struct s_chart_series
+{
+	color_t color;
+	enum e_chart_style style;
+	/* Ring of the last capacity columns, column n is at n % capacity. */
+	struct s_chart_column * columns;
+	struct s_chart_column pending;
+};
+
+struct s_chart
+{
+	color_t background;
+	char background_html[COLOR_HTML_CODE_SIZE];
+	color_t grid;
+	dim_t grid_x;
+	dim_t grid_y;
+
+	int32_t range_min;
+	int32_t range_max;
+
+	uint32_t samples_per_column;
+	uint32_t pending_samples;
+	uint32_t column_count;
+	dim_t capacity;
+
+	struct s_chart_series series[CHART_MAX_SERIES];
+	size_t series_count;
+
+	widget_t * glyph;
+};
+
+static void reset_pending(struct s_chart_series * series)
+{
+	series->pending.min = INT32_MAX;
+	series->pending.max = INT32_MIN;
+}
+
+static dim_t value_y(const chart_t * obj, int32_t value)
+{
+	dim_t bottom = widget_area(obj->glyph)->height - 1;
+
+	if (obj->range_max <= obj->range_min)
+		return bottom;
+
+	value = get_bigger(value, obj->range_min);
+	value = get_smaller(value, obj->range_max);
+
+	return bottom - (dim_t)((int64_t)(value - obj->range_min) * bottom / ((int64_t)obj->range_max - obj->range_min));
+}
+
+/* Column shown at x, NULL where no data was pushed yet. */
+static const struct s_chart_column * column_at(const chart_t * obj, const struct s_chart_series * series, dim_t x)
+{
+	int64_t n = (int64_t)obj->column_count - widget_area(obj->glyph)->width + x;
+
+	if (n < 0 || n < (int64_t)obj->column_count - obj->capacity)
+		return NULL;
+
+	return &series->columns[n % obj->capacity];
+}
+
+static void draw_area_series(const chart_t * obj, const canvas_t * canv, const struct s_chart_series * series, dim_t from, dim_t to)
+{
+	pixel_t color = color_to_pixel(series->color);
+	const struct s_chart_column * column;
+	dim_t x, top;
+
+	for (x = from; x < to; x++)
+	{
+		column = column_at(obj, series, x);
+		if (!column)
+			continue;
+
+		top = value_y(obj, get_bigger(column->max, 0));
+		draw_fill_area(canv, color, x, top, 1, value_y(obj, get_smaller(column->min, 0)) - top + 1);
+	}
+}
+
+/* Each column spans its samples and joins the last sample of the previous one. */
+static void draw_line_series(const chart_t * obj, const canvas_t * canv, const struct s_chart_series * series, dim_t from, dim_t to)
+{
+	pixel_t color = color_to_pixel(series->color);
+	const struct s_chart_column * column;
+	const struct s_chart_column * previous;
+	int32_t min, max;
+	dim_t x, top;
+
+	for (x = from; x < to; x++)
+	{
+		column = column_at(obj, series, x);
+		if (!column)
+			continue;
+
+		min = column->min;
+		max = column->max;
+
+		previous = column_at(obj, series, x - 1);
+		if (previous)
+		{
+			min = get_smaller(min, previous->last);
+			max = get_bigger(max, previous->last);
+		}
+
+		top = value_y(obj, max);
+		draw_fill_area(canv, color, x, top, 1, value_y(obj, min) - top + 1);
+	}
+}
+
+static void draw_grid(const chart_t * obj, const canvas_t * canv, dim_t from, dim_t to)
+{
+	const area_t * area = widget_area(obj->glyph);
+	pixel_t color = color_to_pixel(obj->grid);
+	int64_t n;
+	dim_t x, y;
+
+	if (obj->grid_y > 0)
+		for (y = area->height - 1; y >= 0; y -= obj->grid_y)
+			draw_fill_area(canv, color, from, y, to - from, 1);
+
+	if (obj->grid_x > 0)
+	{
+		for (x = from; x < to; x++)
+		{
+			n = (int64_t)obj->column_count - area->width + x;
+			if (n >= 0 && n % obj->grid_x == 0)
+				draw_fill_area(canv, color, x, 0, 1, area->height);
+		}
+	}
+}
+
+static void draw(chart_t * obj, const area_t * limiting_canvas_area)
+{
+	const area_t * area;
+	canvas_t * canv;
+	dim_t from, to;
+	size_t i;
+
+	PTR_CHECK(obj, "chart");
+
+	area = widget_area(obj->glyph);
+	canv = canvas_new_clipped(area, limiting_canvas_area);
+
+	/* Only the columns inside the clip, typically the few new ones. */
+	from = canvas_clip(canv)->x;
+	to = from + canvas_clip(canv)->width;
+
+	draw_solid_rectangle(canv, color_to_pixel(obj->background));
+
+	for (i = 0; i < obj->series_count; i++)
+		if (obj->series[i].style == CHART_AREA)
+			draw_area_series(obj, canv, &obj->series[i], from, to);
+
+	draw_grid(obj, canv, from, to);
+
+	for (i = 0; i < obj->series_count; i++)
+		if (obj->series[i].style == CHART_LINE)
+			draw_line_series(obj, canv, &obj->series[i], from, to);
+
+	canvas_delete(canv);
+}
+
+/* Moves the plot on screen left by the new columns and draws them. */
+static void present(chart_t * obj, dim_t new_columns)
+{
+	widget_t * root = widget_root(obj->glyph);
+	area_t view, strip;
+	canvas_t * canv;
+
+	if (!new_columns || !widget_visible(obj->glyph) || !widget_tree_ancestors_visible(obj->glyph))
+		return;
+
+	/* Out of a transaction only counted, for display lists to record the change. */
+	widget_invalidate(obj->glyph);
+	if (widget_update_in_progress())
+		return;
+
+	view = widget_tree_ancestors_intersection_canvas_area(obj->glyph);
+	area_set_intersection(&view, &view, framebuffer_area());
+
+	if (!area_value(&view))
+		return;
+
+	/* Moving the plot would move the pixels of a widget over or under it too, or
+	 * pixels the render thread has not drawn yet. */
+	if (new_columns >= view.width || render_thread_running() || widget_tree_overlapped(obj->glyph, &view))
+	{
+		widget_redraw_area(root, &view);
+		return;
+	}
+
+	sprite_overlay_lift(&view);
+	canv = canvas_new(&view);
+	draw_move_region(canv, -new_columns, 0);
+	canvas_delete(canv);
+	sprite_overlay_drop();
+
+	area_set(&strip, view.x + view.width - new_columns, view.y, new_columns, view.height);
+	widget_redraw_area(root, &strip);
+
+	framebuffer_inform_written_area(view.x, view.y, view.width, view.height);
+}
+
+static bool resize_rings(chart_t * obj, dim_t capacity)
+{
+	struct s_chart_column * columns;
+	uint32_t n, kept;
+	size_t i;
+
+	kept = (uint32_t)get_smaller((int64_t)obj->column_count, (int64_t)get_smaller(capacity, obj->capacity));
+
+	for (i = 0; i < obj->series_count; i++)
+	{
+		columns = (struct s_chart_column *)malloc(capacity * sizeof(struct s_chart_column));
+		MEMORY_ALLOC_CHECK_RETURN(columns, false);
+
+		for (n = obj->column_count - kept; n < obj->column_count; n++)
+			columns[n % capacity] = obj->series[i].columns[n % obj->capacity];
+
+		free(obj->series[i].columns);
+		obj->series[i].columns = columns;
+	}
+
+	obj->capacity = capacity;
+
+	return true;
+}
+
+chart_t * chart_new(widget_t * parent)
+{
+	chart_t * obj = (chart_t *)calloc(1, sizeof(struct s_chart));
+	MEMORY_ALLOC_CHECK_RETURN(obj, NULL);
+
+	obj->glyph = widget_new(parent, obj, (void(*)(void *, const area_t *))draw, (void(*)(void *))chart_delete);
+	obj->background = color(0, 0, 0);
+	obj->grid = color(0x40, 0x40, 0x40);
+	obj->range_max = 1;
+	obj->samples_per_column = 1;
+	obj->capacity = 1;
+
+	return obj;
+}
+
+void chart_delete(chart_t * obj)
+{
+	size_t i;
+
+	PTR_CHECK(obj, "chart");
+
+	widget_delete_instance_only(obj->glyph);
+
+	for (i = 0; i < obj->series_count; i++)
+		free(obj->series[i].columns);
+
+	free(obj);
+}
+
+void chart_set_position(chart_t * obj, dim_t x, dim_t y)
+{
+	PTR_CHECK(obj, "chart");
+
+	widget_set_pos(obj->glyph, x, y);
+}
+
+void chart_set_size(chart_t * obj, dim_t width, dim_t height)
+{
+	PTR_CHECK(obj, "chart");
+
+	/* One more column than shown, the leftmost one joins its predecessor. */
+	if (!resize_rings(obj, get_bigger(width, 0) + 1))
+		return;
+
+	widget_set_dim(obj->glyph, width, height);
+}
+
+void chart_set_background_color_html(chart_t * obj, const char * html_color_code)
+{
+	PTR_CHECK(obj, "chart");
+
+	if (!color_html_cache_update(obj->background_html, html_color_code))
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	obj->background = color_html(html_color_code);
+}
+
+void chart_set_grid(chart_t * obj, const char * html_color_code, dim_t spacing_x, dim_t spacing_y)
+{
+	PTR_CHECK(obj, "chart");
+
+	widget_invalidate(obj->glyph);
+
+	obj->grid = color_html(html_color_code);
+	obj->grid_x = spacing_x;
+	obj->grid_y = spacing_y;
+}
+
+void chart_set_range(chart_t * obj, int32_t min, int32_t max)
+{
+	PTR_CHECK(obj, "chart");
+
+	if (obj->range_min == min && obj->range_max == max)
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	obj->range_min = min;
+	obj->range_max = max;
+}
+
+void chart_set_samples_per_column(chart_t * obj, uint32_t samples)
+{
+	PTR_CHECK(obj, "chart");
+
+	obj->samples_per_column = get_bigger(samples, 1u);
+}
+
+int chart_add_series(chart_t * obj, const char * html_color_code, enum e_chart_style style)
+{
+	struct s_chart_series * series;
+
+	PTR_CHECK_RETURN(obj, "chart", -1);
+
+	if (obj->series_count >= CHART_MAX_SERIES)
+	{
+		LOG_ERROR("chart", "too many series");
+		return -1;
+	}
+
+	series = &obj->series[obj->series_count];
+	series->columns = (struct s_chart_column *)malloc(obj->capacity * sizeof(struct s_chart_column));
+	MEMORY_ALLOC_CHECK_RETURN(series->columns, -1);
+
+	series->color = color_html(html_color_code);
+	series->style = style;
+	reset_pending(series);
+
+	/* Columns pushed before the series existed have no data for it. */
+	chart_clear(obj);
+
+	return (int)obj->series_count++;
+}
+
+void chart_push(chart_t * obj, const int32_t * frames, size_t frame_count)
+{
+	struct s_chart_series * series;
+	dim_t new_columns = 0;
+	size_t f, i;
+
+	PTR_CHECK(obj, "chart");
+
+	if (!obj->series_count)
+		return;
+
+	for (f = 0; f < frame_count; f++, frames += obj->series_count)
+	{
+		for (i = 0; i < obj->series_count; i++)
+		{
+			series = &obj->series[i];
+			series->pending.min = get_smaller(series->pending.min, frames[i]);
+			series->pending.max = get_bigger(series->pending.max, frames[i]);
+			series->pending.last = frames[i];
+		}
+
+		if (++obj->pending_samples < obj->samples_per_column)
+			continue;
+
+		for (i = 0; i < obj->series_count; i++)
+		{
+			series = &obj->series[i];
+			series->columns[obj->column_count % obj->capacity] = series->pending;
+			reset_pending(series);
+		}
+
+		obj->pending_samples = 0;
+		obj->column_count++;
+		new_columns++;
+	}
+
+	present(obj, new_columns);
+}
+
+void chart_clear(chart_t * obj)
+{
+	size_t i;
+
+	PTR_CHECK(obj, "chart");
+
+	for (i = 0; i < obj->series_count; i++)
+		reset_pending(&obj->series[i]);
+
+	obj->pending_samples = 0;
+	obj->column_count = 0;
+
+	widget_invalidate(obj->glyph);
+}
+
+uint32_t chart_column_count(const chart_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "chart", 0);
+
+	return obj->column_count;
+}
+
+widget_t * chart_get_widget(chart_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "chart", NULL);
+
+	return obj->glyph;
+}
@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CHART_H_
+#define CHART_H_
+
+#include "types.h"
+
+/*
+ * Strip chart plotting live series from right to left. Samples are decimated into
+ * pixel columns keeping the minimum, maximum and last sample of each column, so a
+ * column costs the same to draw whatever the input rate is. Each series keeps one
+ * column per pixel of width, plus one, in a ring buffer.
+ *
+ * Pushing samples moves the pixels already on screen to the left by the number of
+ * completed columns and draws only the new ones. The vertical grid lines travel with
+ * the data. Changing the range or the size redraws the whole chart, and so does a
+ * push while widgets not descending from the chart overlap it or while the render
+ * thread runs.
+ */
+
+#define CHART_MAX_SERIES 4
+
+chart_t * chart_new(widget_t * parent);
+void chart_delete(chart_t * obj);
+
+void chart_set_position(chart_t * obj, dim_t x, dim_t y);
+/* Keeps the most recent columns that still fit. */
+void chart_set_size(chart_t * obj, dim_t width, dim_t height);
+void chart_set_background_color_html(chart_t * obj, const char * html_color_code);
+/* A spacing of 0 disables the grid lines along that axis, horizontal lines start at the bottom. */
+void chart_set_grid(chart_t * obj, const char * html_color_code, dim_t spacing_x, dim_t spacing_y);
+void chart_set_range(chart_t * obj, int32_t min, int32_t max);
+void chart_set_samples_per_column(chart_t * obj, uint32_t samples);
+
+/* Returns the series index, or -1 when CHART_MAX_SERIES are in use. Area series
+ * are filled between the sample and 0, or the closest range bound. */
+int chart_add_series(chart_t * obj, const char * html_color_code, enum e_chart_style style);
+
+/* Frames hold one sample per series, in series order. */
+void chart_push(chart_t * obj, const int32_t * frames, size_t frame_count);
+void chart_clear(chart_t * obj);
+/* Completed columns since creation or clear. */
+uint32_t chart_column_count(const chart_t * obj);
+
+widget_t * chart_get_widget(chart_t * obj);
+
+#endif /* CHART_H_ */
@@ -23,10 +23,12 @@
 #include <ctype.h>
 
 #include "helper/log.h"
+#include "helper/checks.h"
 #include "helper/number.h"
 
 #include "color.h"
 #include "color_private.h"
+#include "pixel_format.h"
 
 const struct s_color invalid_color = {0, 0, 0, INVALID_COLOR_FLAG};
 
@@ -70,6 +72,23 @@ color_t color(uint8_t red, uint8_t green, uint8_t blue)
 	return *(color_t*)&return_color;
 }
 
+bool color_html_cache_update(char * cache, const char * html_color_code)
+{
+	PTR_CHECK_RETURN(cache, "color", true);
+	PTR_CHECK_RETURN(html_color_code, "color", true);
+
+	if (strncmp(cache, html_color_code, COLOR_HTML_CODE_SIZE) == 0)
+		return false;
+
+	/* Longer codes are invalid anyway, they are not cached so they never match. */
+	if (strlen(html_color_code) < COLOR_HTML_CODE_SIZE)
+		strcpy(cache, html_color_code);
+	else
+		cache[0] = '\0';
+
+	return true;
+}
+
 color_t color_html(const char* html_color_code)
 {
 	struct s_color return_color;
@@ -97,6 +116,23 @@ color_t color_html(const char* html_color_code)
 	return *(color_t*)&return_color;
 }
 
+void color_to_html(color_t color, char * html_color_code)
+{
+	static const char hex[] = "0123456789ABCDEF";
+	struct s_color * pColor = (struct s_color *)&color;
+
+	PTR_CHECK(html_color_code, "color");
+
+	html_color_code[0] = '#';
+	html_color_code[1] = hex[pColor->red >> 4];
+	html_color_code[2] = hex[pColor->red & 0xF];
+	html_color_code[3] = hex[pColor->green >> 4];
+	html_color_code[4] = hex[pColor->green & 0xF];
+	html_color_code[5] = hex[pColor->blue >> 4];
+	html_color_code[6] = hex[pColor->blue & 0xF];
+	html_color_code[7] = '\0';
+}
+
 pixel_t color_to_pixel(color_t color)
 {
 	struct s_color * pColor = (struct s_color *)&color;
@@ -110,31 +146,12 @@ pixel_t color_to_pixel(color_t color)
 		return 0x0;
 	}
 
-	return (((red>>3)<<11) | ((green>>2)<<5) | ((blue)>>3));
+	return PIXEL_PACK(red, green, blue);
 }
 
 color_t color_from_pixel(const pixel_t pixel_color)
 {
-	color_t ret_color = color(0,0,0);
-	struct s_color *p_ret_color = (struct s_color *)&ret_color;
-	uint8_t red;
-	uint8_t green;
-	uint8_t blue;
-
-	red = (pixel_color >> 8) & 0xF8;
-	red |= (red&0x08)?(0x7):(0x0);
-
-	green = (pixel_color >> 3) & 0xFC;
-	green |= (green&0x04)?(0x3):(0x0);
-
-	blue = (pixel_color << 3) & 0xF8;
-	blue |= (green&0x08)?(0x7):(0x0);
-
-	p_ret_color->red = red;
-	p_ret_color->green = green;
-	p_ret_color->blue = blue;
-
-	return ret_color;
+	return color(PIXEL_RED(pixel_color), PIXEL_GREEN(pixel_color), PIXEL_BLUE(pixel_color));
 }
 
 bool color_check(color_t color)
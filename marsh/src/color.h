@@ -33,7 +33,15 @@ pixel_t color_to_pixel(const color_t);
 color_t color_from_pixel(const pixel_t pixel_color);
 
 color_t color_alpha_blend(color_t color_to, color_t color_from, uint8_t intensity);
+void color_to_html(color_t color, char * html_color_code); // Writes "#RRGGBB", html_color_code must hold COLOR_HTML_CODE_SIZE chars.
 
 color_t color_null(void);
 
+/* Buffer size for a cached html color code, "#RRGGBB" and its terminator. */
+#define COLOR_HTML_CODE_SIZE 8
+
+/* Copies html_color_code to cache if it differs from it, returning true in this case.
+ * Setters use it to drop a repeated color before parsing it. */
+bool color_html_cache_update(char * cache, const char * html_color_code);
+
 #endif /* COLOR_H_ */
@@ -0,0 +1,485 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "command_queue.h"
+#include "framebuffer.h"
+
+struct s_command
+{
+	enum e_command_queue_op op;
+	pixel_t * dst;
+	size_t stride;
+	const void * src;
+	size_t src_offset;
+	size_t src_stride;
+	dim_t width;
+	dim_t height;
+	pixel_t color;
+	const pixel_t * palette;
+	uint8_t bits;
+	scale_t scale;
+
+	/* Written framebuffer area, empty when writing elsewhere. */
+	area_t target;
+	uint64_t submitted_ns;
+};
+
+/*
+ * Single producer, single consumer ring: the drawing thread only writes submitted and
+ * the slots past it, the worker only writes executed. The mutex and conditions are
+ * taken only to sleep, when the worker has nothing to do or a fence is not passed.
+ */
+static struct
+{
+	pthread_t worker;
+	pthread_mutex_t mutex;
+	pthread_cond_t submitted_cond;
+	pthread_cond_t executed_cond;
+	bool running;
+	bool worker_sleeping;
+	uint32_t waiters;
+
+	/* Command n is at n % COMMAND_QUEUE_SIZE, counters wrap. */
+	struct s_command ring[COMMAND_QUEUE_SIZE];
+	uint32_t submitted;
+	uint32_t executed;
+
+	/* Published by the worker when it caught up with the queue. */
+	command_queue_stats_t stats[COMMAND_QUEUE_OP_COUNT];
+} queue;
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void execute(const struct s_command * command)
+{
+	const framebuffer_ops_t * software = framebuffer_ops_software();
+
+	switch (command->op)
+	{
+	case COMMAND_QUEUE_FILL_RECT:
+		software->fill_rect(command->dst, command->stride, command->width, command->height, command->color);
+		break;
+	case COMMAND_QUEUE_COPY_RECT:
+		software->copy_rect(command->dst, (const pixel_t *)command->src, command->stride, command->width, command->height);
+		break;
+	case COMMAND_QUEUE_EXPAND_1BPP:
+		software->expand_1bpp(command->dst, command->stride, (const uint8_t *)command->src, command->src_offset, command->src_stride,
+				command->width, command->height, command->color);
+		break;
+	case COMMAND_QUEUE_BLEND_A8:
+		software->blend_a8(command->dst, command->stride, (const uint8_t *)command->src, command->src_stride, command->width,
+				command->height, command->color);
+		break;
+	case COMMAND_QUEUE_BLEND_A8_RLE:
+		software->blend_a8_rle(command->dst, command->stride, (const uint8_t *)command->src, command->src_offset,
+				command->src_stride, command->width, command->height, command->color);
+		break;
+	case COMMAND_QUEUE_EXPAND_INDEXED:
+		software->expand_indexed(command->dst, command->stride, (const uint8_t *)command->src, command->src_offset,
+				command->src_stride, command->bits, command->palette, command->width, command->height);
+		break;
+	case COMMAND_QUEUE_SCALE:
+		software->scale(command->dst, command->stride, &command->scale, command->width, command->height);
+		break;
+	case COMMAND_QUEUE_BLIT:
+	case COMMAND_QUEUE_OP_COUNT:
+	default:
+		software->blit(command->dst, command->stride, (const pixel_t *)command->src, command->src_stride, command->width,
+				command->height);
+		break;
+	}
+}
+
+static void account(command_queue_stats_t * stats, const struct s_command * command, uint64_t start_ns, uint64_t end_ns)
+{
+	stats += command->op;
+
+	stats->count++;
+	stats->busy_ns += end_ns - start_ns;
+	stats->latency_ns += start_ns - command->submitted_ns;
+	if (end_ns - start_ns > stats->max_ns)
+		stats->max_ns = end_ns - start_ns;
+}
+
+static void publish_stats(const command_queue_stats_t * stats)
+{
+	pthread_mutex_lock(&queue.mutex);
+	memcpy(queue.stats, stats, sizeof(queue.stats));
+	pthread_mutex_unlock(&queue.mutex);
+}
+
+/* Sleeps until a command is submitted, returns false once stopped and drained. */
+static bool worker_idle(uint32_t executed)
+{
+	bool drained;
+
+	pthread_mutex_lock(&queue.mutex);
+
+	__atomic_store_n(&queue.worker_sleeping, true, __ATOMIC_SEQ_CST);
+	while (queue.running && __atomic_load_n(&queue.submitted, __ATOMIC_SEQ_CST) == executed)
+		pthread_cond_wait(&queue.submitted_cond, &queue.mutex);
+	__atomic_store_n(&queue.worker_sleeping, false, __ATOMIC_SEQ_CST);
+
+	drained = !queue.running && __atomic_load_n(&queue.submitted, __ATOMIC_SEQ_CST) == executed;
+
+	pthread_mutex_unlock(&queue.mutex);
+
+	return !drained;
+}
+
+static void * worker(void * arg)
+{
+	command_queue_stats_t stats[COMMAND_QUEUE_OP_COUNT];
+	const struct s_command * command;
+	uint64_t start_ns, end_ns;
+	uint32_t executed = 0;
+
+	(void)arg;
+
+	memset(stats, 0, sizeof(stats));
+
+	for (;;)
+	{
+		if (__atomic_load_n(&queue.submitted, __ATOMIC_ACQUIRE) == executed)
+		{
+			if (!worker_idle(executed))
+				break;
+			continue;
+		}
+
+		/* The slot is not rewritten before executed moves past it. */
+		command = &queue.ring[executed % COMMAND_QUEUE_SIZE];
+
+		start_ns = now_ns();
+		execute(command);
+		end_ns = now_ns();
+		account(stats, command, start_ns, end_ns);
+
+		/* A fence on the last command finds the statistics up to date. */
+		if (__atomic_load_n(&queue.submitted, __ATOMIC_ACQUIRE) == executed + 1)
+			publish_stats(stats);
+
+		executed++;
+		__atomic_store_n(&queue.executed, executed, __ATOMIC_SEQ_CST);
+
+		if (__atomic_load_n(&queue.waiters, __ATOMIC_SEQ_CST))
+		{
+			pthread_mutex_lock(&queue.mutex);
+			pthread_cond_broadcast(&queue.executed_cond);
+			pthread_mutex_unlock(&queue.mutex);
+		}
+	}
+
+	return NULL;
+}
+
+static bool passed(uint32_t fence)
+{
+	/* Wrapping difference, the fence is passed once executed reached it. */
+	return (int32_t)(fence - __atomic_load_n(&queue.executed, __ATOMIC_SEQ_CST)) <= 0;
+}
+
+static void queued_wait(uint32_t fence)
+{
+	if (passed(fence))
+		return;
+
+	pthread_mutex_lock(&queue.mutex);
+
+	__atomic_add_fetch(&queue.waiters, 1, __ATOMIC_SEQ_CST);
+	while (!passed(fence))
+		pthread_cond_wait(&queue.executed_cond, &queue.mutex);
+	__atomic_sub_fetch(&queue.waiters, 1, __ATOMIC_SEQ_CST);
+
+	pthread_mutex_unlock(&queue.mutex);
+}
+
+/* Commands writing through the framebuffer layout get their area for the fences, a
+ * write with another stride inside the framebuffer is taken as touching all of it. */
+static void set_target(struct s_command * command)
+{
+	const pixel_t * start = framebuffer_start();
+	size_t stride = framebuffer_stride();
+	size_t offset;
+
+	area_clear(&command->target);
+
+	if (command->dst < start || command->dst >= start + stride * framebuffer_height())
+		return;
+
+	if (command->stride != stride)
+	{
+		command->target = *framebuffer_area();
+		return;
+	}
+
+	offset = (size_t)(command->dst - start);
+	area_set(&command->target, (dim_t)(offset % stride), (dim_t)(offset / stride), command->width, command->height);
+}
+
+/* A full ring blocks until half of it executed, not to wake up on every command. */
+static void submit(struct s_command * command)
+{
+	uint32_t submitted = queue.submitted;
+
+	set_target(command);
+	command->submitted_ns = now_ns();
+
+	if (submitted - __atomic_load_n(&queue.executed, __ATOMIC_ACQUIRE) >= COMMAND_QUEUE_SIZE)
+		queued_wait(submitted - COMMAND_QUEUE_SIZE / 2);
+
+	queue.ring[submitted % COMMAND_QUEUE_SIZE] = *command;
+	__atomic_store_n(&queue.submitted, submitted + 1, __ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n(&queue.worker_sleeping, __ATOMIC_SEQ_CST))
+	{
+		pthread_mutex_lock(&queue.mutex);
+		pthread_cond_signal(&queue.submitted_cond);
+		pthread_mutex_unlock(&queue.mutex);
+	}
+}
+
+static void command_init(struct s_command * command, enum e_command_queue_op op, pixel_t * dst, size_t stride, dim_t width, dim_t height)
+{
+	command->op = op;
+	command->dst = dst;
+	command->stride = stride;
+	command->src = NULL;
+	command->src_offset = 0;
+	command->src_stride = 0;
+	command->width = width;
+	command->height = height;
+	command->color = 0;
+	command->palette = NULL;
+	command->bits = 0;
+}
+
+static void queued_fill_rect(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color)
+{
+	struct s_command command;
+
+	command_init(&command, COMMAND_QUEUE_FILL_RECT, dst, stride, width, height);
+	command.color = color;
+	submit(&command);
+}
+
+static void queued_copy_rect(pixel_t * dst, const pixel_t * src, size_t stride, dim_t width, dim_t height)
+{
+	struct s_command command;
+
+	command_init(&command, COMMAND_QUEUE_COPY_RECT, dst, stride, width, height);
+	command.src = src;
+	submit(&command);
+}
+
+static void queued_expand_1bpp(pixel_t * dst, size_t stride, const uint8_t * bits, size_t bit_offset, size_t bit_stride, dim_t width, dim_t height, pixel_t color)
+{
+	struct s_command command;
+
+	command_init(&command, COMMAND_QUEUE_EXPAND_1BPP, dst, stride, width, height);
+	command.src = bits;
+	command.src_offset = bit_offset;
+	command.src_stride = bit_stride;
+	command.color = color;
+	submit(&command);
+}
+
+static void queued_blend_a8(pixel_t * dst, size_t stride, const uint8_t * alpha, size_t alpha_stride, dim_t width, dim_t height, pixel_t color)
+{
+	struct s_command command;
+
+	command_init(&command, COMMAND_QUEUE_BLEND_A8, dst, stride, width, height);
+	command.src = alpha;
+	command.src_stride = alpha_stride;
+	command.color = color;
+	submit(&command);
+}
+
+static void queued_blend_a8_rle(pixel_t * dst, size_t stride, const uint8_t * runs, size_t column, size_t runs_width, dim_t width, dim_t height, pixel_t color)
+{
+	struct s_command command;
+
+	command_init(&command, COMMAND_QUEUE_BLEND_A8_RLE, dst, stride, width, height);
+	command.src = runs;
+	command.src_offset = column;
+	command.src_stride = runs_width;
+	command.color = color;
+	submit(&command);
+}
+
+static void queued_expand_indexed(pixel_t * dst, size_t stride, const uint8_t * indices, size_t index_offset, size_t index_stride, uint8_t bits, const pixel_t * palette, dim_t width, dim_t height)
+{
+	struct s_command command;
+
+	command_init(&command, COMMAND_QUEUE_EXPAND_INDEXED, dst, stride, width, height);
+	command.src = indices;
+	command.src_offset = index_offset;
+	command.src_stride = index_stride;
+	command.bits = bits;
+	command.palette = palette;
+	submit(&command);
+}
+
+static void queued_scale(pixel_t * dst, size_t stride, const scale_t * scale, dim_t width, dim_t height)
+{
+	struct s_command command;
+
+	command_init(&command, COMMAND_QUEUE_SCALE, dst, stride, width, height);
+	command.scale = *scale;
+	submit(&command);
+}
+
+static void queued_blit(pixel_t * dst, size_t stride, const pixel_t * src, size_t src_stride, dim_t width, dim_t height)
+{
+	struct s_command command;
+
+	command_init(&command, COMMAND_QUEUE_BLIT, dst, stride, width, height);
+	command.src = src;
+	command.src_stride = src_stride;
+	submit(&command);
+}
+
+static uint32_t queued_fence(void)
+{
+	return queue.submitted;
+}
+
+/* Passed once the last pending command writing into area executed. Pending slots
+ * are only rewritten by the drawing thread, the one calling this. */
+static uint32_t queued_fence_area(const area_t * area)
+{
+	uint32_t executed = __atomic_load_n(&queue.executed, __ATOMIC_ACQUIRE);
+	uint32_t fence;
+
+	for (fence = queue.submitted; fence != executed; fence--)
+		if (area_intersects(&queue.ring[(fence - 1) % COMMAND_QUEUE_SIZE].target, area))
+			break;
+
+	return fence;
+}
+
+static const framebuffer_ops_t queued_ops =
+{
+	queued_fill_rect,
+	queued_copy_rect,
+	queued_expand_1bpp,
+	queued_blend_a8,
+	queued_blend_a8_rle,
+	queued_expand_indexed,
+	queued_scale,
+	queued_blit,
+	queued_fence,
+	queued_wait,
+	queued_fence_area
+};
+
+void command_queue_start(void)
+{
+	if (queue.running)
+		return;
+
+	pthread_mutex_init(&queue.mutex, NULL);
+	pthread_cond_init(&queue.submitted_cond, NULL);
+	pthread_cond_init(&queue.executed_cond, NULL);
+	queue.submitted = 0;
+	queue.executed = 0;
+	queue.waiters = 0;
+	queue.worker_sleeping = false;
+	memset(queue.stats, 0, sizeof(queue.stats));
+	queue.running = true;
+
+	if (pthread_create(&queue.worker, NULL, worker, NULL))
+	{
+		LOG_ERROR("command_queue", "can't start the worker thread");
+		queue.running = false;
+		return;
+	}
+
+	framebuffer_set_ops(&queued_ops);
+}
+
+void command_queue_stop(void)
+{
+	if (!queue.running)
+		return;
+
+	/* Syncs with the queue before switching back. */
+	framebuffer_set_ops(NULL);
+
+	pthread_mutex_lock(&queue.mutex);
+	queue.running = false;
+	pthread_cond_signal(&queue.submitted_cond);
+	pthread_mutex_unlock(&queue.mutex);
+
+	pthread_join(queue.worker, NULL);
+
+	pthread_cond_destroy(&queue.executed_cond);
+	pthread_cond_destroy(&queue.submitted_cond);
+	pthread_mutex_destroy(&queue.mutex);
+}
+
+bool command_queue_running(void)
+{
+	return queue.running;
+}
+
+uint32_t command_queue_executed(void)
+{
+	return __atomic_load_n(&queue.executed, __ATOMIC_ACQUIRE);
+}
+
+void command_queue_stats(enum e_command_queue_op op, command_queue_stats_t * tgt)
+{
+	PTR_CHECK(tgt, "command_queue");
+
+	if (op >= COMMAND_QUEUE_OP_COUNT)
+	{
+		LOG_ERROR("command_queue", "invalid operation");
+		return;
+	}
+
+	if (!queue.running)
+	{
+		*tgt = queue.stats[op];
+		return;
+	}
+
+	queued_wait(queue.submitted);
+
+	pthread_mutex_lock(&queue.mutex);
+	*tgt = queue.stats[op];
+	pthread_mutex_unlock(&queue.mutex);
+}
@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef COMMAND_QUEUE_H_
+#define COMMAND_QUEUE_H_
+
+#include "types.h"
+
+/*
+ * Runs the framebuffer operations on a rasterizer thread. The drawing thread, the only
+ * one allowed to draw while the queue runs, records fills, copies, 1bpp glyph
+ * expansions, A8 blends and blits into a preallocated ring of COMMAND_QUEUE_SIZE
+ * commands, blocking only when it is full, and goes on with the tree traversal while
+ * the worker executes them in order.
+ *
+ * Commands remember the framebuffer area they write, so presenting an area only
+ * waits for the commands touching it, see framebuffer_ops_sync_area.
+ *
+ * Start installs the queue as the framebuffer operations, stop drains it, joins the
+ * worker and installs the software operations back.
+ */
+
+#define COMMAND_QUEUE_SIZE 256
+
+void command_queue_start(void);
+void command_queue_stop(void);
+bool command_queue_running(void);
+
+/* Commands executed since start. */
+uint32_t command_queue_executed(void);
+
+/* Timing per operation since start, waits for the queue. */
+void command_queue_stats(enum e_command_queue_op op, command_queue_stats_t * tgt);
+
+#endif /* COMMAND_QUEUE_H_ */
@@ -0,0 +1,142 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "helper/checks.h"
+#include "area.h"
+#include "damage.h"
+
+struct s_damage
+{
+	area_t areas[DAMAGE_MAX_AREAS + 1]; // Spare slot for the incoming area before merging.
+	size_t count;
+};
+
+static void remove_area(damage_t * obj, size_t index)
+{
+	obj->count--;
+	obj->areas[index] = obj->areas[obj->count];
+}
+
+static dim_t union_growth(const area_t * first, const area_t * second)
+{
+	area_t merged;
+
+	area_set_union(&merged, first, second);
+
+	return area_value(&merged) - area_value(first) - area_value(second);
+}
+
+static void merge_cheapest_pair(damage_t * obj)
+{
+	size_t i, j;
+	size_t best_i = 0, best_j = 1;
+	dim_t best_growth = union_growth(&obj->areas[0], &obj->areas[1]);
+
+	for (i = 0; i < obj->count; i++)
+	{
+		for (j = i + 1; j < obj->count; j++)
+		{
+			dim_t growth = union_growth(&obj->areas[i], &obj->areas[j]);
+
+			if (growth < best_growth)
+			{
+				best_growth = growth;
+				best_i = i;
+				best_j = j;
+			}
+		}
+	}
+
+	area_set_union(&obj->areas[best_i], &obj->areas[best_i], &obj->areas[best_j]);
+	remove_area(obj, best_j);
+}
+
+damage_t * damage_new(void)
+{
+	damage_t * obj = (damage_t *)calloc(1, sizeof(struct s_damage));
+	MEMORY_ALLOC_CHECK_RETURN(obj, NULL);
+
+	return obj;
+}
+
+void damage_delete(damage_t * obj)
+{
+	PTR_CHECK(obj, "damage");
+
+	free(obj);
+}
+
+void damage_add(damage_t * obj, const area_t * area)
+{
+	area_t merged;
+	size_t i;
+
+	PTR_CHECK(obj, "damage");
+	PTR_CHECK(area, "damage");
+
+	if (!area_value(area))
+		return;
+
+	merged = *area;
+
+	/* Absorb every area the new one overlaps, growing it until nothing else overlaps. */
+	i = 0;
+	while (i < obj->count)
+	{
+		if (area_intersects(&merged, &obj->areas[i]))
+		{
+			area_set_union(&merged, &merged, &obj->areas[i]);
+			remove_area(obj, i);
+			i = 0;
+			continue;
+		}
+		i++;
+	}
+
+	obj->areas[obj->count++] = merged;
+
+	if (obj->count > DAMAGE_MAX_AREAS)
+		merge_cheapest_pair(obj);
+}
+
+void damage_clear(damage_t * obj)
+{
+	PTR_CHECK(obj, "damage");
+
+	obj->count = 0;
+}
+
+size_t damage_count(const damage_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "damage", 0);
+
+	return obj->count;
+}
+
+const area_t * damage_area(const damage_t * obj, size_t index)
+{
+	PTR_CHECK_RETURN(obj, "damage", NULL);
+
+	if (index >= obj->count)
+		return NULL;
+
+	return &obj->areas[index];
+}
@@ -0,0 +1,44 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef DAMAGE_H_
+#define DAMAGE_H_
+
+#include "types.h"
+
+/*
+ * Damage is the set of framebuffer areas that must be redrawn. It holds at most
+ * DAMAGE_MAX_AREAS rectangles: overlapping areas are merged on insertion, and when
+ * the set is full the two rectangles whose union grows the least are merged.
+ */
+
+#define DAMAGE_MAX_AREAS 8
+
+damage_t * damage_new(void);
+void damage_delete(damage_t * obj);
+
+void damage_add(damage_t * obj, const area_t * area);
+void damage_clear(damage_t * obj);
+
+size_t damage_count(const damage_t * obj);
+const area_t * damage_area(const damage_t * obj, size_t index);
+
+#endif /* DAMAGE_H_ */
@@ -0,0 +1,663 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "damage.h"
+#include "display_list.h"
+#include "framebuffer.h"
+#include "sprite.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+
+/* Smallest opaque command worth testing the others against. */
+#define OCCLUDER_MIN_PIXELS 256
+/* Longest run of disjoint commands sorted together. */
+#define SORT_RUN 32
+
+enum e_display_op
+{
+	DISPLAY_OP_FILL_RECT,
+	DISPLAY_OP_COPY_RECT,
+	DISPLAY_OP_EXPAND_1BPP,
+	DISPLAY_OP_BLEND_A8,
+	DISPLAY_OP_BLEND_A8_RLE,
+	DISPLAY_OP_EXPAND_INDEXED,
+	DISPLAY_OP_SCALE,
+	DISPLAY_OP_BLIT
+};
+
+struct s_display_command
+{
+	enum e_display_op op;
+	/* Destination in framebuffer coordinates, otherwise dst and stride are used and
+	 * the command is a barrier for the optimization. */
+	bool in_framebuffer;
+	dim_t x, y, width, height;
+	pixel_t * dst;
+	size_t stride;
+	pixel_t color;
+	const void * src;
+	/* Bit offset of a 1bpp source, index offset of an indexed one, arena offset of an
+	 * A8 or RLE one or of the scale_t of a scaled one. */
+	size_t src_offset;
+	size_t src_stride;
+	/* First column drawn of RLE runs. */
+	size_t src_column;
+	/* Of indexed sources, which like blit ones stay where they are. */
+	const pixel_t * palette;
+	uint8_t bits;
+};
+
+struct s_display_list
+{
+	struct s_display_command * commands;
+	size_t count;
+	size_t capacity;
+	size_t recorded;
+
+	uint8_t * arena;
+	size_t arena_size;
+	size_t arena_capacity;
+
+	/* Scratch of the optimization. */
+	size_t * occluders;
+	size_t occluders_capacity;
+
+	widget_t * root;
+	uint32_t generation;
+	bool valid;
+	bool failed;
+};
+
+/* The list the recording operations append to. */
+static display_list_t * recording = NULL;
+
+static struct s_display_command * command_append(void)
+{
+	struct s_display_command * grown;
+	size_t capacity;
+
+	if (recording->count == recording->capacity)
+	{
+		capacity = recording->capacity ? recording->capacity * 2 : 64;
+		grown = (struct s_display_command *)realloc(recording->commands, capacity * sizeof(struct s_display_command));
+		if (!grown)
+		{
+			recording->failed = true;
+			return NULL;
+		}
+		recording->commands = grown;
+		recording->capacity = capacity;
+	}
+
+	return &recording->commands[recording->count++];
+}
+
+static bool arena_append(const uint8_t * src, size_t src_stride, dim_t width, dim_t height, size_t * offset)
+{
+	uint8_t * grown;
+	size_t capacity;
+	dim_t i;
+
+	if (recording->arena_size + (size_t)width * height > recording->arena_capacity)
+	{
+		capacity = recording->arena_capacity ? recording->arena_capacity : 1024;
+		while (capacity < recording->arena_size + (size_t)width * height)
+			capacity *= 2;
+		grown = (uint8_t *)realloc(recording->arena, capacity);
+		if (!grown)
+		{
+			recording->failed = true;
+			return false;
+		}
+		recording->arena = grown;
+		recording->arena_capacity = capacity;
+	}
+
+	*offset = recording->arena_size;
+	for (i = 0; i < height; i++, src += src_stride, recording->arena_size += width)
+		memcpy(recording->arena + recording->arena_size, src, width);
+
+	return true;
+}
+
+static void command_set_destination(struct s_display_command * command, pixel_t * dst, size_t stride, dim_t width, dim_t height)
+{
+	const pixel_t * start = framebuffer_start();
+	size_t fb_stride = framebuffer_stride();
+	size_t offset;
+
+	command->dst = dst;
+	command->stride = stride;
+	command->width = width;
+	command->height = height;
+	command->in_framebuffer = false;
+	command->x = 0;
+	command->y = 0;
+
+	if (dst < start || dst >= start + fb_stride * framebuffer_height() || stride != fb_stride)
+		return;
+
+	offset = (size_t)(dst - start);
+	if (offset % fb_stride + (size_t)width > framebuffer_width())
+		return;
+
+	command->x = (dim_t)(offset % fb_stride);
+	command->y = (dim_t)(offset / fb_stride);
+	command->in_framebuffer = true;
+}
+
+static struct s_display_command * record(enum e_display_op op, pixel_t * dst, size_t stride, dim_t width, dim_t height)
+{
+	struct s_display_command * command;
+
+	if (!width || !height)
+		return NULL;
+
+	command = command_append();
+	if (!command)
+		return NULL;
+
+	command->op = op;
+	command_set_destination(command, dst, stride, width, height);
+	command->color = 0;
+	command->src = NULL;
+	command->src_offset = 0;
+	command->src_stride = 0;
+	command->src_column = 0;
+	command->palette = NULL;
+	command->bits = 0;
+
+	return command;
+}
+
+static void recorded_fill_rect(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color)
+{
+	struct s_display_command * command = record(DISPLAY_OP_FILL_RECT, dst, stride, width, height);
+
+	if (command)
+		command->color = color;
+}
+
+static void recorded_copy_rect(pixel_t * dst, const pixel_t * src, size_t stride, dim_t width, dim_t height)
+{
+	struct s_display_command * command = record(DISPLAY_OP_COPY_RECT, dst, stride, width, height);
+
+	if (command)
+	{
+		/* Reads the framebuffer, stays a barrier. */
+		command->in_framebuffer = false;
+		command->src = src;
+	}
+}
+
+static void recorded_expand_1bpp(pixel_t * dst, size_t stride, const uint8_t * bits, size_t bit_offset, size_t bit_stride, dim_t width, dim_t height, pixel_t color)
+{
+	struct s_display_command * command = record(DISPLAY_OP_EXPAND_1BPP, dst, stride, width, height);
+
+	if (command)
+	{
+		command->color = color;
+		command->src = bits;
+		command->src_offset = bit_offset;
+		command->src_stride = bit_stride;
+	}
+}
+
+static void recorded_blend_a8(pixel_t * dst, size_t stride, const uint8_t * alpha, size_t alpha_stride, dim_t width, dim_t height, pixel_t color)
+{
+	struct s_display_command * command = record(DISPLAY_OP_BLEND_A8, dst, stride, width, height);
+
+	if (!command)
+		return;
+
+	command->color = color;
+	command->src_stride = width;
+	if (!arena_append(alpha, alpha_stride, width, height, &command->src_offset))
+		recording->count--;
+}
+
+static void recorded_blend_a8_rle(pixel_t * dst, size_t stride, const uint8_t * runs, size_t column, size_t runs_width, dim_t width, dim_t height, pixel_t color)
+{
+	struct s_display_command * command = record(DISPLAY_OP_BLEND_A8_RLE, dst, stride, width, height);
+	size_t length = (size_t)(framebuffer_ops_rle_skip(runs, runs_width, height) - runs);
+
+	if (!command)
+		return;
+
+	command->color = color;
+	command->src_column = column;
+	command->src_stride = runs_width;
+	if (!arena_append(runs, length, (dim_t)length, 1, &command->src_offset))
+		recording->count--;
+}
+
+static void recorded_expand_indexed(pixel_t * dst, size_t stride, const uint8_t * indices, size_t index_offset, size_t index_stride, uint8_t bits, const pixel_t * palette, dim_t width, dim_t height)
+{
+	struct s_display_command * command = record(DISPLAY_OP_EXPAND_INDEXED, dst, stride, width, height);
+
+	if (command)
+	{
+		command->src = indices;
+		command->src_offset = index_offset;
+		command->src_stride = index_stride;
+		command->palette = palette;
+		command->bits = bits;
+	}
+}
+
+static void recorded_scale(pixel_t * dst, size_t stride, const scale_t * scale, dim_t width, dim_t height)
+{
+	struct s_display_command * command = record(DISPLAY_OP_SCALE, dst, stride, width, height);
+
+	if (!command)
+		return;
+
+	if (!arena_append((const uint8_t *)scale, sizeof(scale_t), sizeof(scale_t), 1, &command->src_offset))
+		recording->count--;
+}
+
+static void recorded_blit(pixel_t * dst, size_t stride, const pixel_t * src, size_t src_stride, dim_t width, dim_t height)
+{
+	struct s_display_command * command = record(DISPLAY_OP_BLIT, dst, stride, width, height);
+
+	if (command)
+	{
+		command->src = src;
+		command->src_stride = src_stride;
+	}
+}
+
+static const framebuffer_ops_t recording_ops =
+{
+	recorded_fill_rect,
+	recorded_copy_rect,
+	recorded_expand_1bpp,
+	recorded_blend_a8,
+	recorded_blend_a8_rle,
+	recorded_expand_indexed,
+	recorded_scale,
+	recorded_blit,
+	NULL,
+	NULL,
+	NULL
+};
+
+static bool reorderable(const struct s_display_command * command)
+{
+	return command->in_framebuffer && command->op != DISPLAY_OP_COPY_RECT;
+}
+
+static bool opaque(const struct s_display_command * command)
+{
+	return command->op == DISPLAY_OP_FILL_RECT || command->op == DISPLAY_OP_BLIT || command->op == DISPLAY_OP_EXPAND_INDEXED;
+}
+
+static bool contains(const struct s_display_command * outer, const struct s_display_command * inner)
+{
+	return outer->x <= inner->x && outer->y <= inner->y && outer->x + outer->width >= inner->x + inner->width
+			&& outer->y + outer->height >= inner->y + inner->height;
+}
+
+static bool overlaps(const struct s_display_command * a, const struct s_display_command * b)
+{
+	return a->x < b->x + b->width && b->x < a->x + a->width && a->y < b->y + b->height && b->y < a->y + a->height;
+}
+
+static bool before(const struct s_display_command * a, const struct s_display_command * b)
+{
+	return a->y < b->y || (a->y == b->y && a->x < b->x);
+}
+
+/* End of the run of reorderable commands starting at first. */
+static size_t segment_end(const display_list_t * obj, size_t first)
+{
+	while (first < obj->count && reorderable(&obj->commands[first]))
+		first++;
+
+	return first;
+}
+
+/* Drops the commands a later opaque command of the same segment covers entirely. */
+static bool occluder(const struct s_display_command * command)
+{
+	return opaque(command) && (size_t)command->width * command->height >= OCCLUDER_MIN_PIXELS;
+}
+
+static void drop_hidden(display_list_t * obj)
+{
+	struct s_display_command * commands = obj->commands;
+	size_t first, end, i, k, next, count, kept = 0;
+	size_t * grown;
+	bool hidden;
+
+	/* Only the occluders are tested against each command, they are few. */
+	if (obj->occluders_capacity < obj->count)
+	{
+		grown = (size_t *)realloc(obj->occluders, obj->count * sizeof(size_t));
+		if (!grown)
+			return;
+		obj->occluders = grown;
+		obj->occluders_capacity = obj->count;
+	}
+
+	for (first = 0; first < obj->count; first = end)
+	{
+		end = segment_end(obj, first);
+		if (end == first)
+		{
+			commands[kept++] = commands[end++];
+			continue;
+		}
+
+		for (count = 0, i = first; i < end; i++)
+			if (occluder(&commands[i]))
+				obj->occluders[count++] = i;
+
+		for (next = 0, i = first; i < end; i++)
+		{
+			while (next < count && obj->occluders[next] <= i)
+				next++;
+
+			hidden = false;
+			for (k = next; k < count && !hidden; k++)
+				hidden = contains(&commands[obj->occluders[k]], &commands[i]);
+
+			if (!hidden)
+				commands[kept++] = commands[i];
+		}
+	}
+
+	obj->count = kept;
+}
+
+/* Sorts runs of commands writing disjoint rectangles, their order does not matter. */
+static void sort_runs(display_list_t * obj)
+{
+	struct s_display_command * commands = obj->commands;
+	struct s_display_command command;
+	size_t first, end, i, j;
+	bool disjoint;
+
+	for (first = 0; first < obj->count; first = end)
+	{
+		end = first + 1;
+		if (!reorderable(&commands[first]))
+			continue;
+
+		for (; end < obj->count && end - first < SORT_RUN && reorderable(&commands[end]); end++)
+		{
+			disjoint = true;
+			for (i = first; i < end && disjoint; i++)
+				disjoint = !overlaps(&commands[i], &commands[end]);
+			if (!disjoint)
+				break;
+		}
+
+		for (i = first + 1; i < end; i++)
+		{
+			command = commands[i];
+			for (j = i; j > first && before(&command, &commands[j - 1]); j--)
+				commands[j] = commands[j - 1];
+			commands[j] = command;
+		}
+	}
+}
+
+/* Merges consecutive fills of one color that form a rectangle. */
+static void merge_fills(display_list_t * obj)
+{
+	struct s_display_command * commands = obj->commands;
+	struct s_display_command * last;
+	const struct s_display_command * next;
+	size_t i, kept = 0;
+
+	for (i = 0; i < obj->count; i++)
+	{
+		next = &commands[i];
+		last = kept ? &commands[kept - 1] : NULL;
+
+		if (last && reorderable(last) && reorderable(next) && last->op == DISPLAY_OP_FILL_RECT
+				&& next->op == DISPLAY_OP_FILL_RECT && last->color == next->color)
+		{
+			if (last->y == next->y && last->height == next->height && last->x + last->width == next->x)
+			{
+				last->width += next->width;
+				continue;
+			}
+
+			if (last->x == next->x && last->width == next->width && last->y + last->height == next->y)
+			{
+				last->height += next->height;
+				continue;
+			}
+		}
+
+		commands[kept++] = *next;
+	}
+
+	obj->count = kept;
+}
+
+static void execute(const display_list_t * obj, const struct s_display_command * command, const framebuffer_ops_t * ops)
+{
+	pixel_t * dst = command->dst;
+	size_t stride = command->stride;
+	scale_t scale;
+
+	if (command->in_framebuffer)
+	{
+		stride = framebuffer_stride();
+		dst = framebuffer_at(command->x, command->y);
+	}
+
+	switch (command->op)
+	{
+	case DISPLAY_OP_FILL_RECT:
+		ops->fill_rect(dst, stride, command->width, command->height, command->color);
+		break;
+	case DISPLAY_OP_COPY_RECT:
+		ops->copy_rect(dst, (const pixel_t *)command->src, stride, command->width, command->height);
+		break;
+	case DISPLAY_OP_EXPAND_1BPP:
+		ops->expand_1bpp(dst, stride, (const uint8_t *)command->src, command->src_offset, command->src_stride, command->width,
+				command->height, command->color);
+		break;
+	case DISPLAY_OP_BLEND_A8:
+		ops->blend_a8(dst, stride, obj->arena + command->src_offset, command->src_stride, command->width, command->height,
+				command->color);
+		break;
+	case DISPLAY_OP_BLEND_A8_RLE:
+		ops->blend_a8_rle(dst, stride, obj->arena + command->src_offset, command->src_column, command->src_stride,
+				command->width, command->height, command->color);
+		break;
+	case DISPLAY_OP_EXPAND_INDEXED:
+		ops->expand_indexed(dst, stride, (const uint8_t *)command->src, command->src_offset, command->src_stride, command->bits,
+				command->palette, command->width, command->height);
+		break;
+	case DISPLAY_OP_SCALE:
+		/* The arena keeps no alignment. */
+		memcpy(&scale, obj->arena + command->src_offset, sizeof(scale_t));
+		ops->scale(dst, stride, &scale, command->width, command->height);
+		break;
+	case DISPLAY_OP_BLIT:
+	default:
+		ops->blit(dst, stride, (const pixel_t *)command->src, command->src_stride, command->width, command->height);
+		break;
+	}
+}
+
+display_list_t * display_list_new(void)
+{
+	display_list_t * obj = (display_list_t *)calloc(1, sizeof(struct s_display_list));
+	MEMORY_ALLOC_CHECK_RETURN(obj, NULL);
+
+	return obj;
+}
+
+void display_list_delete(display_list_t * obj)
+{
+	PTR_CHECK(obj, "display_list");
+
+	free(obj->commands);
+	free(obj->arena);
+	free(obj->occluders);
+	free(obj);
+}
+
+static bool record_tree(display_list_t * obj, widget_t * root, const damage_t * damage)
+{
+	framebuffer_ops_t previous;
+	size_t i;
+
+	if (recording)
+	{
+		LOG_ERROR("display_list", "already recording");
+		return false;
+	}
+
+	obj->count = 0;
+	obj->arena_size = 0;
+	obj->failed = false;
+
+	previous = *framebuffer_ops();
+	recording = obj;
+	framebuffer_set_ops(&recording_ops);
+
+	if (damage)
+	{
+		for (i = 0; i < damage_count(damage); i++)
+			widget_tree_draw_widgets_area(root, damage_area(damage, i));
+	}
+	else
+	{
+		widget_tree_draw_widgets(root);
+	}
+
+	framebuffer_set_ops(&previous);
+	recording = NULL;
+
+	obj->recorded = obj->count;
+	obj->root = root;
+	obj->generation = widget_update_generation();
+
+	if (obj->failed)
+	{
+		LOG_ERROR("display_list", "Failed to alloc memory");
+		obj->count = 0;
+		return false;
+	}
+
+	drop_hidden(obj);
+	sort_runs(obj);
+	merge_fills(obj);
+
+	return true;
+}
+
+void display_list_record(display_list_t * obj, widget_t * root)
+{
+	PTR_CHECK(obj, "display_list");
+	PTR_CHECK(root, "display_list");
+
+	obj->valid = record_tree(obj, root, NULL);
+}
+
+bool display_list_record_damage(display_list_t * obj, widget_t * root, const damage_t * damage)
+{
+	PTR_CHECK_RETURN(obj, "display_list", false);
+	PTR_CHECK_RETURN(root, "display_list", false);
+	PTR_CHECK_RETURN(damage, "display_list", false);
+
+	/* Only part of the tree is in the list, display_list_draw records it again. */
+	obj->valid = false;
+
+	return record_tree(obj, root, damage);
+}
+
+void display_list_replay(const display_list_t * obj)
+{
+	size_t i;
+
+	PTR_CHECK(obj, "display_list");
+
+	sprite_overlay_lift(NULL);
+	for (i = 0; i < obj->count; i++)
+		execute(obj, &obj->commands[i], framebuffer_ops());
+	sprite_overlay_drop();
+
+	framebuffer_ops_sync();
+}
+
+void display_list_execute(const display_list_t * obj, const framebuffer_ops_t * ops)
+{
+	size_t i;
+
+	PTR_CHECK(obj, "display_list");
+	PTR_CHECK(ops, "display_list");
+
+	for (i = 0; i < obj->count; i++)
+		execute(obj, &obj->commands[i], ops);
+}
+
+void display_list_draw(display_list_t * obj, widget_t * root)
+{
+	PTR_CHECK(obj, "display_list");
+	PTR_CHECK(root, "display_list");
+
+	if (!obj->valid || obj->root != root || obj->generation != widget_update_generation())
+		display_list_record(obj, root);
+
+	/* A failed recording draws the tree directly. */
+	if (!obj->valid)
+	{
+		widget_tree_draw(root);
+		return;
+	}
+
+	display_list_replay(obj);
+}
+
+void display_list_invalidate(display_list_t * obj)
+{
+	PTR_CHECK(obj, "display_list");
+
+	obj->valid = false;
+}
+
+size_t display_list_recorded_length(const display_list_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "display_list", 0);
+
+	return obj->recorded;
+}
+
+size_t display_list_length(const display_list_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "display_list", 0);
+
+	return obj->count;
+}
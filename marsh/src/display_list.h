@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef DISPLAY_LIST_H_
+#define DISPLAY_LIST_H_
+
+#include "types.h"
+
+/*
+ * Recorded widget tree draws. Recording draws root's widgets through a framebuffer
+ * operations table that stores compact commands instead of writing pixels: the
+ * operation, its destination rectangle, already clipped, its color and its source.
+ * Sources are referenced, except the A8 coverage, copied since the path rasterizer
+ * reuses its buffers.
+ *
+ * The recorded list is then optimized: commands hidden under a later opaque fill or
+ * blit are dropped, runs of commands writing disjoint rectangles are sorted by
+ * destination and adjacent fills of the same color are merged. Region copies and
+ * writes out of the framebuffer stay in place and nothing moves across them.
+ *
+ * Replaying executes the list through the installed framebuffer operations, sprites
+ * and sync included like widget_tree_draw. display_list_draw replays the cached list
+ * while widget_update_generation tells nothing changed, changes the setters do not
+ * see, like editing a text string in place, need display_list_invalidate.
+ *
+ * display_list_record_damage records root's widgets clipped to each damaged area
+ * only, for a consumer redrawing just those, e.g. another thread executing the list
+ * through a given table with display_list_execute, without sprites nor sync.
+ */
+
+display_list_t * display_list_new(void);
+void display_list_delete(display_list_t * obj);
+
+void display_list_record(display_list_t * obj, widget_t * root);
+/* Returns false when the recording failed, the list is then empty. */
+bool display_list_record_damage(display_list_t * obj, widget_t * root, const damage_t * damage);
+void display_list_replay(const display_list_t * obj);
+void display_list_execute(const display_list_t * obj, const framebuffer_ops_t * ops);
+void display_list_draw(display_list_t * obj, widget_t * root);
+void display_list_invalidate(display_list_t * obj);
+
+/* Commands of the last recording, as recorded and after the optimization. */
+size_t display_list_recorded_length(const display_list_t * obj);
+size_t display_list_length(const display_list_t * obj);
+
+#endif /* DISPLAY_LIST_H_ */
@@ -0,0 +1,291 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "helper/checks.h"
+
+#include "area.h"
+#include "display_rotation.h"
+#include "framebuffer_geometry.h"
+
+#if defined(__GNUC__) && defined(__SSE2__) && MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
+#define DISPLAY_ROTATION_SSE2
+#include <emmintrin.h>
+#endif
+
+/* Source and destination tiles of 32x32 pixels stay in L1 while rotated, whichever
+ * direction the panel rows run in. */
+#define TILE 32
+
+static enum e_display_rotation current_rotation = DISPLAY_ROTATION_0;
+
+void display_rotation_set(enum e_display_rotation rotation)
+{
+	current_rotation = rotation;
+}
+
+enum e_display_rotation display_rotation(void)
+{
+	return current_rotation;
+}
+
+bool display_rotation_parse(const char * text, enum e_display_rotation * rotation)
+{
+	static const char * degrees[] = {"0", "90", "180", "270"};
+	size_t i;
+
+	PTR_CHECK_RETURN(text, "display_rotation", false);
+	PTR_CHECK_RETURN(rotation, "display_rotation", false);
+
+	for (i = 0; i < sizeof(degrees) / sizeof(degrees[0]); i++)
+	{
+		if (!strcmp(text, degrees[i]))
+		{
+			*rotation = (enum e_display_rotation)i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void display_rotation_panel_size(enum e_display_rotation rotation, size_t width, size_t height, size_t * panel_width,
+		size_t * panel_height)
+{
+	bool swapped = rotation == DISPLAY_ROTATION_90 || rotation == DISPLAY_ROTATION_270;
+
+	*panel_width = swapped ? height : width;
+	*panel_height = swapped ? width : height;
+}
+
+void display_rotation_area(enum e_display_rotation rotation, size_t width, size_t height, const area_t * logical,
+		area_t * panel)
+{
+	dim_t w = (dim_t)width, h = (dim_t)height;
+
+	switch (rotation)
+	{
+	case DISPLAY_ROTATION_90:
+		area_set(panel, h - logical->y - logical->height, logical->x, logical->height, logical->width);
+		break;
+	case DISPLAY_ROTATION_180:
+		area_set(panel, w - logical->x - logical->width, h - logical->y - logical->height, logical->width,
+				logical->height);
+		break;
+	case DISPLAY_ROTATION_270:
+		area_set(panel, logical->y, w - logical->x - logical->width, logical->height, logical->width);
+		break;
+	case DISPLAY_ROTATION_0:
+	default:
+		*panel = *logical;
+		break;
+	}
+}
+
+void display_rotation_point(enum e_display_rotation rotation, size_t width, size_t height, int * x, int * y)
+{
+	int panel_x = *x, panel_y = *y;
+
+	switch (rotation)
+	{
+	case DISPLAY_ROTATION_90:
+		*x = panel_y;
+		*y = (int)height - 1 - panel_x;
+		break;
+	case DISPLAY_ROTATION_180:
+		*x = (int)width - 1 - panel_x;
+		*y = (int)height - 1 - panel_y;
+		break;
+	case DISPLAY_ROTATION_270:
+		*x = (int)width - 1 - panel_y;
+		*y = panel_x;
+		break;
+	case DISPLAY_ROTATION_0:
+	default:
+		break;
+	}
+}
+
+/*
+ * Logical pixel (i, j) of a rectangle lands at dst + i * step_x + j * step_y, dst
+ * being where its first pixel lands.
+ */
+static void copy_scalar(pixel_t * dst, ptrdiff_t step_x, ptrdiff_t step_y, const pixel_t * src, size_t src_stride,
+		dim_t width, dim_t height)
+{
+	pixel_t * out;
+	dim_t i, j;
+
+	for (j = 0; j < height; j++, src += src_stride, dst += step_y)
+		for (i = 0, out = dst; i < width; i++, out += step_x)
+			*out = src[i];
+}
+
+#ifdef DISPLAY_ROTATION_SSE2
+
+static inline void transpose_8x8(__m128i * rows)
+{
+	__m128i a0, a1, a2, a3, a4, a5, a6, a7;
+	__m128i b0, b1, b2, b3, b4, b5, b6, b7;
+
+	a0 = _mm_unpacklo_epi16(rows[0], rows[1]);
+	a1 = _mm_unpackhi_epi16(rows[0], rows[1]);
+	a2 = _mm_unpacklo_epi16(rows[2], rows[3]);
+	a3 = _mm_unpackhi_epi16(rows[2], rows[3]);
+	a4 = _mm_unpacklo_epi16(rows[4], rows[5]);
+	a5 = _mm_unpackhi_epi16(rows[4], rows[5]);
+	a6 = _mm_unpacklo_epi16(rows[6], rows[7]);
+	a7 = _mm_unpackhi_epi16(rows[6], rows[7]);
+
+	b0 = _mm_unpacklo_epi32(a0, a2);
+	b1 = _mm_unpackhi_epi32(a0, a2);
+	b2 = _mm_unpacklo_epi32(a1, a3);
+	b3 = _mm_unpackhi_epi32(a1, a3);
+	b4 = _mm_unpacklo_epi32(a4, a6);
+	b5 = _mm_unpackhi_epi32(a4, a6);
+	b6 = _mm_unpacklo_epi32(a5, a7);
+	b7 = _mm_unpackhi_epi32(a5, a7);
+
+	rows[0] = _mm_unpacklo_epi64(b0, b4);
+	rows[1] = _mm_unpackhi_epi64(b0, b4);
+	rows[2] = _mm_unpacklo_epi64(b1, b5);
+	rows[3] = _mm_unpackhi_epi64(b1, b5);
+	rows[4] = _mm_unpacklo_epi64(b2, b6);
+	rows[5] = _mm_unpackhi_epi64(b2, b6);
+	rows[6] = _mm_unpacklo_epi64(b3, b7);
+	rows[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+static inline __m128i reverse_8(__m128i pixels)
+{
+	pixels = _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+	pixels = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(2, 3, 0, 1));
+
+	return _mm_shufflehi_epi16(pixels, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+/* At 90 degrees the source rows are loaded bottom up, so each transposed row is
+ * already in the right to left order the panel wants. */
+static void rotate_8x8(pixel_t * dst, ptrdiff_t step_x, ptrdiff_t step_y, const pixel_t * src, size_t src_stride)
+{
+	__m128i rows[8];
+	int k;
+
+	if (step_x == -1)
+	{
+		for (k = 0; k < 8; k++)
+			_mm_storeu_si128((__m128i *)(dst + k * step_y - 7),
+					reverse_8(_mm_loadu_si128((const __m128i *)(src + k * src_stride))));
+		return;
+	}
+
+	for (k = 0; k < 8; k++)
+		rows[step_y == 1 ? k : 7 - k] = _mm_loadu_si128((const __m128i *)(src + k * src_stride));
+
+	transpose_8x8(rows);
+
+	for (k = 0; k < 8; k++)
+		_mm_storeu_si128((__m128i *)(dst + k * step_x + (step_y == 1 ? 0 : -7)), rows[k]);
+}
+
+#endif
+
+static void rotate_tile(pixel_t * dst, ptrdiff_t step_x, ptrdiff_t step_y, const pixel_t * src, size_t src_stride,
+		dim_t width, dim_t height)
+{
+#ifdef DISPLAY_ROTATION_SSE2
+	dim_t blocks_width = width & ~7, blocks_height = height & ~7;
+	dim_t i, j;
+
+	for (j = 0; j < blocks_height; j += 8)
+		for (i = 0; i < blocks_width; i += 8)
+			rotate_8x8(dst + i * step_x + j * step_y, step_x, step_y, src + j * src_stride + i, src_stride);
+
+	copy_scalar(dst + blocks_width * step_x, step_x, step_y, src + blocks_width, src_stride, width - blocks_width,
+			blocks_height);
+	copy_scalar(dst + blocks_height * step_y, step_x, step_y, src + blocks_height * src_stride, src_stride, width,
+			height - blocks_height);
+#else
+	copy_scalar(dst, step_x, step_y, src, src_stride, width, height);
+#endif
+}
+
+void display_rotation_copy(enum e_display_rotation rotation, pixel_t * dst, size_t dst_stride, const pixel_t * src,
+		size_t src_stride, dim_t width, dim_t height)
+{
+	ptrdiff_t stride = (ptrdiff_t)dst_stride, step_x, step_y;
+	dim_t i, j;
+
+	PTR_CHECK(dst, "display_rotation");
+	PTR_CHECK(src, "display_rotation");
+
+	switch (rotation)
+	{
+	case DISPLAY_ROTATION_90:
+		step_x = stride;
+		step_y = -1;
+		dst += height - 1;
+		break;
+	case DISPLAY_ROTATION_180:
+		step_x = -1;
+		step_y = -stride;
+		dst += (height - 1) * stride + width - 1;
+		break;
+	case DISPLAY_ROTATION_270:
+		step_x = -stride;
+		step_y = 1;
+		dst += (width - 1) * stride;
+		break;
+	case DISPLAY_ROTATION_0:
+	default:
+		for (j = 0; j < height; j++)
+			memcpy(dst + j * dst_stride, src + j * src_stride, width * sizeof(pixel_t));
+		return;
+	}
+
+	for (j = 0; j < height; j += TILE)
+		for (i = 0; i < width; i += TILE)
+			rotate_tile(dst + i * step_x + j * step_y, step_x, step_y, src + j * src_stride + i, src_stride,
+					width - i < TILE ? width - i : TILE, height - j < TILE ? height - j : TILE);
+}
+
+bool display_rotation_present(enum e_display_rotation rotation, framebuffer_geometry_t * panel,
+		const framebuffer_geometry_t * logical, const area_t * written, area_t * presented)
+{
+	area_t clipped;
+
+	PTR_CHECK_RETURN(panel, "display_rotation", false);
+	PTR_CHECK_RETURN(logical, "display_rotation", false);
+	PTR_CHECK_RETURN(written, "display_rotation", false);
+	PTR_CHECK_RETURN(presented, "display_rotation", false);
+
+	area_set_intersection(&clipped, written, &logical->area);
+	if (clipped.width <= 0 || clipped.height <= 0)
+		return false;
+
+	display_rotation_area(rotation, logical->width, logical->height, &clipped, presented);
+	display_rotation_copy(rotation, framebuffer_geometry_at(panel, presented->x, presented->y), panel->stride,
+			framebuffer_geometry_at(logical, clipped.x, clipped.y), logical->stride, clipped.width, clipped.height);
+
+	return true;
+}
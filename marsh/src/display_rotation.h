@@ -0,0 +1,62 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef DISPLAY_ROTATION_H_
+#define DISPLAY_ROTATION_H_
+
+#include "types.h"
+
+/*
+ * Panels mounted in portrait, or upside down. The widget tree and framebuffer_at stay
+ * in the logical orientation, the backends keep a second buffer in the panel one and
+ * rotate into it the written areas only while presenting them. Interaction points
+ * given to widget_tree_press, widget_tree_release and widget_tree_click are in panel
+ * coordinates and turned back to logical ones there.
+ */
+
+/* Taken by the backends on framebuffer_init, DISPLAY_ROTATION_0 until set. */
+void display_rotation_set(enum e_display_rotation rotation);
+enum e_display_rotation display_rotation(void);
+/* Reads "0", "90", "180" or "270" degrees. */
+bool display_rotation_parse(const char * text, enum e_display_rotation * rotation);
+
+/* Panel size of a logical one, swapped at 90 and 270 degrees. */
+void display_rotation_panel_size(enum e_display_rotation rotation, size_t width, size_t height, size_t * panel_width,
+		size_t * panel_height);
+/* Panel area covering a logical one, inside a logical screen of width by height. */
+void display_rotation_area(enum e_display_rotation rotation, size_t width, size_t height, const area_t * logical,
+		area_t * panel);
+/* Panel point back to the logical screen of width by height. */
+void display_rotation_point(enum e_display_rotation rotation, size_t width, size_t height, int * x, int * y);
+
+/* Rotates a width by height rectangle of logical pixels, src pointing to its first
+ * one, into its panel area with dst pointing to that area's first pixel. Strides are
+ * in pixels. Goes through cache sized tiles, 16 bit pixels in 8x8 SSE2 blocks. */
+void display_rotation_copy(enum e_display_rotation rotation, pixel_t * dst, size_t dst_stride, const pixel_t * src,
+		size_t src_stride, dim_t width, dim_t height);
+
+/* Presents written, in logical coordinates, from the logical geometry into the panel
+ * one. Returns false when nothing of it is on the screen, else the panel area
+ * updated in presented. */
+bool display_rotation_present(enum e_display_rotation rotation, framebuffer_geometry_t * panel,
+		const framebuffer_geometry_t * logical, const area_t * written, area_t * presented);
+
+#endif /* DISPLAY_ROTATION_H_ */
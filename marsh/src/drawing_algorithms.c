@@ -26,14 +26,12 @@
 #include "types.h"
 #include "canvas_private.h"
 #include "color.h"
+#include "framebuffer.h"
+#include "pixel_format.h"
+#include "scale.h"
+#include "bitmap_data/bitmap_data.h"
 
-#define CANVAS_START_RECT(__canvas, __x, __y, __to) pixel_t *__to = __canvas->tgt_memory_start + __x + __y * __canvas->line_incrementation_width
-#define CANVAS_START_BITMAP(__canvas, __x, __y, __to) pixel_t *__to = __canvas->tgt_memory_start + __x + __y * __canvas->line_incrementation_width
-#define CANVAS_START_CIRC_CENTER_RADIUS(__canvas, __xc, __yc, __r, __to) \
-	pixel_t *__to = __canvas->tgt_memory_start + __xc-__r + (__yc-__r) * __canvas->width
 #define CANVAS_TO(__canvas, __x, __y) ((__canvas)->tgt_memory_start + (__x) + ((__y) * (__canvas)->line_incrementation_width))
-#define CANVAS_GO_DOWN(__canvas, __to, __amount) to += (__amount) * __canvas->line_incrementation_width
-#define CANVAS_GO_LEFT(__canvas, __to, __amount) to -= __amount
 
 enum circle_arcs
 {
@@ -58,64 +56,100 @@ enum circle_arcs
 };
 
 
-static __inline void dot(const pixel_t color, size_t x, size_t y, pixel_t *to, size_t line_incr_width)
+/*
+ * All coordinates below are relative to the canvas origin. The kernels clip every
+ * write against canvas->clip, so a shape may be partially or totally outside it.
+ */
+
+static __inline bool clip_span(const canvas_t *canv, dim_t *x, dim_t *width)
 {
-	*(to + x + y * line_incr_width) = color;
+	dim_t start = get_bigger(*x, canv->clip.x);
+	dim_t end = get_smaller(*x + *width, canv->clip.x + canv->clip.width);
+
+	if (end <= start)
+		return false;
+
+	*x = start;
+	*width = end - start;
+
+	return true;
 }
 
-static __inline void horizontal_line(const pixel_t color, size_t x, size_t y, int32_t width, pixel_t *to, size_t line_incr_width)
+static __inline bool clip_rect(const canvas_t *canv, dim_t *x, dim_t *y, dim_t *width, dim_t *height)
 {
-	size_t xi = (get_sig(width)==1)?(x):(x+width);
-	size_t length = (get_sig(width)==1)?(width):(-width);
+	if (!clip_span(canv, x, width))
+		return false;
 
-	to += xi + y * line_incr_width;
+	dim_t start = get_bigger(*y, canv->clip.y);
+	dim_t end = get_smaller(*y + *height, canv->clip.y + canv->clip.height);
 
-	while(length--)
-		*to++ = color;
+	if (end <= start)
+		return false;
+
+	*y = start;
+	*height = end - start;
+
+	return true;
 }
 
-static __inline void vertical_line(const pixel_t color, size_t x, size_t y, int32_t height, pixel_t *to, size_t line_incr_width)
+static void solid_rectangle(const canvas_t *canv, const pixel_t color, dim_t x, dim_t y, dim_t width, dim_t height)
 {
-	size_t yi = (get_sig(height)==1)?(y):(y+height);
-	size_t length = (get_sig(height)==1)?(height):(-height);
+	if (!clip_rect(canv, &x, &y, &width, &height))
+		return;
 
-	to += x + yi * line_incr_width;
+	framebuffer_ops()->fill_rect(CANVAS_TO(canv, x, y), canv->line_incrementation_width, width, height, color);
+}
 
-	while(length--) {
-		*to = color;
-		to += line_incr_width;
-	}
+static __inline void horizontal_line(const canvas_t *canv, const pixel_t color, dim_t x, dim_t y, dim_t width)
+{
+	dim_t xi = (get_sig(width)==1)?(x):(x+width);
+	dim_t length = (get_sig(width)==1)?(width):(-width);
+
+	solid_rectangle(canv, color, xi, y, length, 1);
+}
+
+static __inline void vertical_line(const canvas_t *canv, const pixel_t color, dim_t x, dim_t y, dim_t height)
+{
+	dim_t yi = (get_sig(height)==1)?(y):(y+height);
+	dim_t length = (get_sig(height)==1)?(height):(-height);
+
+	solid_rectangle(canv, color, x, yi, 1, length);
 }
 
-static __inline void circle_kernel(pixel_t* to, const pixel_t color, enum circle_arcs arc, int32_t x_center, int32_t x, int32_t y_center, int32_t y, int32_t line_incr_width)
+/* The points x0 to x1 of a same y, a span per octant instead of a dot per point. */
+static __inline void circle_kernel(const canvas_t *canv, const pixel_t color, enum circle_arcs arc, dim_t x_center, dim_t x0, dim_t x1, dim_t y_center, dim_t y)
 {
-	if (arc & CIRCLE_NEN) dot(color, (x_center + x), (y_center - y), to, line_incr_width); //NEN
-	if (arc & CIRCLE_NEE) dot(color, (x_center + y), (y_center - x), to, line_incr_width); //NEE
-	if (arc & CIRCLE_SEE) dot(color, (x_center + y), (y_center + x), to, line_incr_width); //SEE
-	if (arc & CIRCLE_SES) dot(color, (x_center + x), (y_center + y), to, line_incr_width); //SES
-	if (arc & CIRCLE_SWW) dot(color, (x_center - y), (y_center + x), to, line_incr_width); //SWW
-	if (arc & CIRCLE_SWS) dot(color, (x_center - x), (y_center + y), to, line_incr_width); //SWS
-	if (arc & CIRCLE_NWW) dot(color, (x_center - y), (y_center - x), to, line_incr_width); //NWW
-	if (arc & CIRCLE_NWN) dot(color, (x_center - x), (y_center - y), to, line_incr_width); //NWN
+	dim_t n = x1 - x0 + 1;
+
+	if (arc & CIRCLE_NEN) solid_rectangle(canv, color, (x_center + x0), (y_center - y), n, 1); //NEN
+	if (arc & CIRCLE_NEE) solid_rectangle(canv, color, (x_center + y), (y_center - x1), 1, n); //NEE
+	if (arc & CIRCLE_SEE) solid_rectangle(canv, color, (x_center + y), (y_center + x0), 1, n); //SEE
+	if (arc & CIRCLE_SES) solid_rectangle(canv, color, (x_center + x0), (y_center + y), n, 1); //SES
+	if (arc & CIRCLE_SWW) solid_rectangle(canv, color, (x_center - y), (y_center + x0), 1, n); //SWW
+	if (arc & CIRCLE_SWS) solid_rectangle(canv, color, (x_center - x1), (y_center + y), n, 1); //SWS
+	if (arc & CIRCLE_NWW) solid_rectangle(canv, color, (x_center - y), (y_center - x1), 1, n); //NWW
+	if (arc & CIRCLE_NWN) solid_rectangle(canv, color, (x_center - x1), (y_center - y), n, 1); //NWN
 }
 
-static __inline void solid_circle_kernel(pixel_t* to, const pixel_t color, enum circle_arcs arc, int32_t x_center, int32_t x, int32_t y_center, int32_t y, int32_t line_incr_width)
+static __inline void solid_circle_kernel(const canvas_t *canv, const pixel_t color, enum circle_arcs arc, dim_t x_center, dim_t x, dim_t y_center, dim_t y)
 {
-	if (arc & CIRCLE_NEN) horizontal_line(color, x_center, (y_center - y),  + x, to, line_incr_width); //NEN
-	if (arc & CIRCLE_NEE) horizontal_line(color, x_center, (y_center - x),  + y, to, line_incr_width); //NEE
-	if (arc & CIRCLE_SEE) horizontal_line(color, x_center, (y_center + x),  + y, to, line_incr_width); //SEE
-	if (arc & CIRCLE_SES) horizontal_line(color, x_center, (y_center + y),  + x, to, line_incr_width); //SES
-	if (arc & CIRCLE_SWW) horizontal_line(color, x_center, (y_center + x),  - y, to, line_incr_width); //SWW
-	if (arc & CIRCLE_SWS) horizontal_line(color, x_center, (y_center + y),  - x, to, line_incr_width); //SWS
-	if (arc & CIRCLE_NWW) horizontal_line(color, x_center, (y_center - x),  - y, to, line_incr_width); //NWW
-	if (arc & CIRCLE_NWN) horizontal_line(color, x_center, (y_center - y),  - x, to, line_incr_width); //NWN
+	if (arc & CIRCLE_NEN) horizontal_line(canv, color, x_center, (y_center - y),  + x); //NEN
+	if (arc & CIRCLE_NEE) horizontal_line(canv, color, x_center, (y_center - x),  + y); //NEE
+	if (arc & CIRCLE_SEE) horizontal_line(canv, color, x_center, (y_center + x),  + y); //SEE
+	if (arc & CIRCLE_SES) horizontal_line(canv, color, x_center, (y_center + y),  + x); //SES
+	if (arc & CIRCLE_SWW) horizontal_line(canv, color, x_center, (y_center + x),  - y); //SWW
+	if (arc & CIRCLE_SWS) horizontal_line(canv, color, x_center, (y_center + y),  - x); //SWS
+	if (arc & CIRCLE_NWW) horizontal_line(canv, color, x_center, (y_center - x),  - y); //NWW
+	if (arc & CIRCLE_NWN) horizontal_line(canv, color, x_center, (y_center - y),  - x); //NWN
 }
 
-static __inline void circle_loop(pixel_t* to, const pixel_t color, enum circle_arcs arc, size_t radius, size_t x_center, size_t y_center, size_t line_incrementation_width)
+static __inline void circle_loop(const canvas_t *canv, const pixel_t color, enum circle_arcs arc, dim_t radius, dim_t x_center, dim_t y_center)
 {
 	int32_t d1 = 3 - (2 * radius);
 	int32_t x = 0;
 	int32_t y = radius;
+	int32_t run_x = 0;
+	int32_t run_y = radius;
 	bool rov = true;
 	while (rov)
 	{
@@ -132,12 +166,18 @@ static __inline void circle_loop(pixel_t* to, const pixel_t color, enum circle_a
 			d1 = d1 + 4 * (x - y) + 10;
 			y = y - 1;
 		}
-		circle_kernel(to, color, arc, x_center, x, y_center, y, line_incrementation_width);
+		if (x > run_x && y != run_y)
+		{
+			circle_kernel(canv, color, arc, x_center, run_x, x - 1, y_center, run_y);
+			run_x = x;
+		}
+		run_y = y;
 		x++;
 	}
+	circle_kernel(canv, color, arc, x_center, run_x, x - 1, y_center, run_y);
 }
 
-static __inline void solid_circle_loop(pixel_t* to, const pixel_t color, enum circle_arcs arc, size_t radius, size_t x_center, size_t y_center, size_t line_increment_width)
+static __inline void solid_circle_loop(const canvas_t *canv, const pixel_t color, enum circle_arcs arc, dim_t radius, dim_t x_center, dim_t y_center)
 {
 	int32_t d1 = 3 - (2 * radius);
 	int32_t x = 0;
@@ -158,26 +198,11 @@ static __inline void solid_circle_loop(pixel_t* to, const pixel_t color, enum ci
 			d1 = d1 + 4 * (x - y) + 10;
 			y = y - 1;
 		}
-		solid_circle_kernel(to, color, arc, x_center, x, y_center, y, line_increment_width);
+		solid_circle_kernel(canv, color, arc, x_center, x, y_center, y);
 		x++;
 	}
 }
 
-static void solid_rectangle(pixel_t * to, pixel_t color, size_t width, size_t height, size_t line_increment_width)
-{
-	size_t i,j;
-
-	for(i=0; i<height; i++)
-	{
-		for(j=0; j<width; j++)
-		{
-			*to++ = color;
-		}
-		to += line_increment_width;
-		to -= width;
-	}
-}
-
 void draw_circle(const canvas_t *canv, pixel_t color)
 {
 	PTR_CHECK(canv, "draw_algorithms");
@@ -188,18 +213,19 @@ void draw_circle(const canvas_t *canv, pixel_t color)
 		return;
 	}
 
-	size_t radius = ((canv->width>canv->height)?(canv->width/2):(canv->height/2));
-	size_t x_center = canv->width/2;
-	size_t y_center = canv->height/2;
+	dim_t radius = ((canv->width>canv->height)?(canv->width/2):(canv->height/2));
+	dim_t x_center = canv->width/2;
+	dim_t y_center = canv->height/2;
 
-	CANVAS_START_CIRC_CENTER_RADIUS(canv, x_center, y_center, radius, to);
-	circle_loop(to, color, CIRCLE_ALL, radius, x_center, y_center,canv->line_incrementation_width);
+	circle_loop(canv, color, CIRCLE_ALL, radius, x_center, y_center);
 }
 
 void draw_solid_round_rectangle(const canvas_t *canv, pixel_t color, size_t round_radius)
 {
-	pixel_t *to;
-	size_t xi, yi;
+	dim_t xi, yi;
+	dim_t r = round_radius;
+	dim_t width = canv->width;
+	dim_t height = canv->height;
 
 	PTR_CHECK(canv, "draw_algorithms");
 
@@ -211,35 +237,32 @@ void draw_solid_round_rectangle(const canvas_t *canv, pixel_t color, size_t roun
 
 	xi = 0;
 	yi = 0;
-	to = CANVAS_TO(canv, xi, yi);
-	solid_circle_loop(to, color, CIRCLE_NW, round_radius, round_radius, round_radius, canv->line_incrementation_width);
+	solid_circle_loop(canv, color, CIRCLE_NW, r, xi + r, yi + r);
 
-	xi = canv->width - round_radius*2;
+	xi = width - r*2;
 	yi = 0;
-	to = CANVAS_TO(canv, xi, yi);
-	solid_circle_loop(to, color, CIRCLE_NE, round_radius, round_radius, round_radius, canv->line_incrementation_width);
+	solid_circle_loop(canv, color, CIRCLE_NE, r, xi + r, yi + r);
 
 	xi = 0;
-	yi = canv->height-1 - round_radius*2;
-	to = CANVAS_TO(canv, xi, yi);
-	solid_circle_loop(to, color, CIRCLE_SW, round_radius, round_radius, round_radius, canv->line_incrementation_width);
-
-	xi = canv->width - round_radius*2;
-	yi = canv->height-1 - round_radius*2;
-	to = CANVAS_TO(canv, xi, yi);
-	solid_circle_loop(to, color, CIRCLE_SE, round_radius, round_radius, round_radius, canv->line_incrementation_width);
+	yi = height-1 - r*2;
+	solid_circle_loop(canv, color, CIRCLE_SW, r, xi + r, yi + r);
 
-	solid_rectangle(CANVAS_TO(canv, round_radius, 0), color, canv->width - round_radius*2, round_radius+1, canv->line_incrementation_width);
-	solid_rectangle(CANVAS_TO(canv, round_radius, canv->height-1 - round_radius), color, canv->width - round_radius*2, round_radius+1, canv->line_incrementation_width);
-	solid_rectangle(CANVAS_TO(canv, 0, round_radius), color, canv->width, canv->height - round_radius*2, canv->line_incrementation_width);
+	xi = width - r*2;
+	yi = height-1 - r*2;
+	solid_circle_loop(canv, color, CIRCLE_SE, r, xi + r, yi + r);
 
+	solid_rectangle(canv, color, r, 0, width - r*2, r+1);
+	solid_rectangle(canv, color, r, height-1 - r, width - r*2, r+1);
+	solid_rectangle(canv, color, 0, r, width, height - r*2);
 }
 
 void draw_round_rectangle(const canvas_t *canv, pixel_t color, size_t line_width, size_t round_radius)
 {
-	pixel_t *to;
-	size_t xi, yi;
-	size_t i;
+	dim_t xi, yi;
+	dim_t i;
+	dim_t r = round_radius;
+	dim_t width = canv->width;
+	dim_t height = canv->height;
 
 	PTR_CHECK(canv, "draw_algorithms");
 
@@ -249,72 +272,63 @@ void draw_round_rectangle(const canvas_t *canv, pixel_t color, size_t line_width
 		return;
 	}
 
-	to = CANVAS_TO(canv, 0, 0);
-
-	for (i = 0; i < line_width; i++)
+	for (i = 0; i < (dim_t)line_width; i++)
 	{
-		horizontal_line(color, round_radius, i, canv->width-1 - round_radius*2, to, canv->line_incrementation_width);
-		horizontal_line(color, round_radius, canv->height-1 - i, canv->width - round_radius*2, to, canv->line_incrementation_width);
-		vertical_line(color, i, round_radius, canv->height-1 - round_radius*2, to, canv->line_incrementation_width);
-		vertical_line(color, canv->width-1 - i, round_radius, canv->height-1 - round_radius*2, to, canv->line_incrementation_width);
+		horizontal_line(canv, color, r, i, width-1 - r*2);
+		horizontal_line(canv, color, r, height-1 - i, width - r*2);
+		vertical_line(canv, color, i, r, height-1 - r*2);
+		vertical_line(canv, color, width-1 - i, r, height-1 - r*2);
 	}
 
 	xi = 0;
 	yi = 0;
-	to = CANVAS_TO(canv, xi, yi);
-	circle_loop(to, color, CIRCLE_NW, round_radius, round_radius, round_radius, canv->line_incrementation_width);
+	circle_loop(canv, color, CIRCLE_NW, r, xi + r, yi + r);
 
-	xi = canv->width-1 - round_radius*2;
+	xi = width-1 - r*2;
 	yi = 0;
-	to = CANVAS_TO(canv, xi, yi);
-	circle_loop(to, color, CIRCLE_NE, round_radius, round_radius, round_radius, canv->line_incrementation_width);
+	circle_loop(canv, color, CIRCLE_NE, r, xi + r, yi + r);
 
 	xi = 0;
-	yi = canv->height-1 - round_radius*2;
-	to = CANVAS_TO(canv, xi, yi);
-	circle_loop(to, color, CIRCLE_SW, round_radius, round_radius, round_radius, canv->line_incrementation_width);
+	yi = height-1 - r*2;
+	circle_loop(canv, color, CIRCLE_SW, r, xi + r, yi + r);
 
-	xi = canv->width-1 - round_radius*2;
-	yi = canv->height-1 - round_radius*2;
-	to = CANVAS_TO(canv, xi, yi);
-	circle_loop(to, color, CIRCLE_SE, round_radius, round_radius, round_radius, canv->line_incrementation_width);
+	xi = width-1 - r*2;
+	yi = height-1 - r*2;
+	circle_loop(canv, color, CIRCLE_SE, r, xi + r, yi + r);
 
-	for (i = 1; i < line_width; i++)
+	for (i = 1; i < (dim_t)line_width; i++)
 	{
 		xi = 0;
 		yi = 0;
-		to = CANVAS_TO(canv, xi, yi);
-		circle_loop(to, color, CIRCLE_NW, round_radius - i, round_radius, round_radius, canv->line_incrementation_width);
-		circle_loop(to, color, CIRCLE_NW, round_radius - i, round_radius - 1, round_radius, canv->line_incrementation_width);
-		circle_loop(to, color, CIRCLE_NW, round_radius - i, round_radius, round_radius - 1, canv->line_incrementation_width);
+		circle_loop(canv, color, CIRCLE_NW, r - i, xi + r, yi + r);
+		circle_loop(canv, color, CIRCLE_NW, r - i, xi + r - 1, yi + r);
+		circle_loop(canv, color, CIRCLE_NW, r - i, xi + r, yi + r - 1);
 
-		xi = canv->width-1 - round_radius * 2;
+		xi = width-1 - r * 2;
 		yi = 0;
-		to = CANVAS_TO(canv, xi, yi);
-		circle_loop(to, color, CIRCLE_NE, round_radius - i, round_radius, round_radius, canv->line_incrementation_width);
-		circle_loop(to, color, CIRCLE_NE, round_radius - i, round_radius + 1, round_radius, canv->line_incrementation_width);
-		circle_loop(to, color, CIRCLE_NE, round_radius - i, round_radius, round_radius - 1, canv->line_incrementation_width);
+		circle_loop(canv, color, CIRCLE_NE, r - i, xi + r, yi + r);
+		circle_loop(canv, color, CIRCLE_NE, r - i, xi + r + 1, yi + r);
+		circle_loop(canv, color, CIRCLE_NE, r - i, xi + r, yi + r - 1);
 
 		xi = 0;
-		yi = canv->height-1 - round_radius * 2;
-		to = CANVAS_TO(canv, xi, yi);
-		circle_loop(to, color, CIRCLE_SW, round_radius - i, round_radius, round_radius, canv->line_incrementation_width);
-		circle_loop(to, color, CIRCLE_SW, round_radius - i, round_radius - 1, round_radius, canv->line_incrementation_width);
-		circle_loop(to, color, CIRCLE_SW, round_radius - i, round_radius, round_radius + 1, canv->line_incrementation_width);
-
-		xi = canv->width-1 - round_radius * 2;
-		yi = canv->height-1 - round_radius * 2;
-		to = CANVAS_TO(canv, xi, yi);
-		circle_loop(to, color, CIRCLE_SE, round_radius - i, round_radius, round_radius, canv->line_incrementation_width);
-		circle_loop(to, color, CIRCLE_SE, round_radius - i, round_radius + 1, round_radius, canv->line_incrementation_width);
-		circle_loop(to, color, CIRCLE_SE, round_radius - i, round_radius, round_radius + 1, canv->line_incrementation_width);
+		yi = height-1 - r * 2;
+		circle_loop(canv, color, CIRCLE_SW, r - i, xi + r, yi + r);
+		circle_loop(canv, color, CIRCLE_SW, r - i, xi + r - 1, yi + r);
+		circle_loop(canv, color, CIRCLE_SW, r - i, xi + r, yi + r + 1);
+
+		xi = width-1 - r * 2;
+		yi = height-1 - r * 2;
+		circle_loop(canv, color, CIRCLE_SE, r - i, xi + r, yi + r);
+		circle_loop(canv, color, CIRCLE_SE, r - i, xi + r + 1, yi + r);
+		circle_loop(canv, color, CIRCLE_SE, r - i, xi + r, yi + r + 1);
 	}
 }
 
 void draw_rectangle(const canvas_t *canv, pixel_t color, size_t line_width)
 {
-	pixel_t *to;
-	size_t i;
+	dim_t i;
+	dim_t width = canv->width;
+	dim_t height = canv->height;
 
 	PTR_CHECK(canv, "draw_algorithms");
 
@@ -324,17 +338,22 @@ void draw_rectangle(const canvas_t *canv, pixel_t color, size_t line_width)
 		return;
 	}
 
-	to = CANVAS_TO(canv, 0, 0);
-
-	for (i = 0; i < line_width; i++)
+	for (i = 0; i < (dim_t)line_width; i++)
 	{
-		horizontal_line(color, 0, i, canv->width-1, to, canv->line_incrementation_width);
-		horizontal_line(color, 0, canv->height-1 - i, canv->width, to, canv->line_incrementation_width);
-		vertical_line(color, i, 0, canv->height-1, to, canv->line_incrementation_width);
-		vertical_line(color, canv->width-1 - i, 0, canv->height-1, to, canv->line_incrementation_width);
+		horizontal_line(canv, color, 0, i, width-1);
+		horizontal_line(canv, color, 0, height-1 - i, width);
+		vertical_line(canv, color, i, 0, height-1);
+		vertical_line(canv, color, width-1 - i, 0, height-1);
 	}
 }
 
+void draw_fill_area(const canvas_t *canv, pixel_t color, dim_t x, dim_t y, dim_t width, dim_t height)
+{
+	PTR_CHECK(canv, "draw_algorithms");
+
+	solid_rectangle(canv, color, x, y, width, height);
+}
+
 void draw_solid_rectangle(const canvas_t *canv, pixel_t color)
 {
 	PTR_CHECK(canv, "draw_algorithms");
@@ -345,105 +364,176 @@ void draw_solid_rectangle(const canvas_t *canv, pixel_t color)
 		return;
 	}
 
-	solid_rectangle(CANVAS_TO(canv, 0, 0), color, canv->width, canv->height, canv->line_incrementation_width);
+	solid_rectangle(canv, color, 0, 0, canv->width, canv->height);
 }
 
-static bool bitmap_bit(BUFFER_PTR_RDOLY bitmap, uint32_t bit_offset)
+void draw_bitmap_1bpp(const canvas_t* canv, pixel_t color, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height)
 {
-	uint32_t byte_offset = 0;
+	dim_t x0 = x, y0 = y, w = width, h = height;
 
-	while (bit_offset >= 8)
-	{
-		byte_offset ++;
-		bit_offset -= 8;
-	}
+	PTR_CHECK(canv, "draw_algorithms");
 
-	if (bitmap[byte_offset] & (1<<(7-bit_offset)))
-		return true;
+	if (!clip_rect(canv, &x0, &y0, &w, &h))
+		return;
 
-	return false;
+	framebuffer_ops()->expand_1bpp(CANVAS_TO(canv, x0, y0), canv->line_incrementation_width, bitmap,
+			(y0 - y) * width + (x0 - x), width, w, h, color);
 }
 
-static uint8_t bitmap_byte(BUFFER_PTR_RDOLY bitmap, uint32_t byte_offset)
+void draw_bitmap_native(const canvas_t *canv, const pixel_t *bitmap, size_t x, size_t y, size_t width, size_t height)
 {
-	return bitmap[byte_offset];
+	dim_t x0 = x, y0 = y, w = width, h = height;
+
+	PTR_CHECK(canv, "draw_algorithms");
+	PTR_CHECK(bitmap, "draw_algorithms");
+
+	if (!clip_rect(canv, &x0, &y0, &w, &h))
+		return;
+
+	framebuffer_ops()->blit(CANVAS_TO(canv, x0, y0), canv->line_incrementation_width,
+			bitmap + (y0 - y) * width + (x0 - x), width, w, h);
 }
 
-void draw_bitmap_1bpp(const canvas_t* canv, pixel_t color, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height)
+void draw_bitmap(const canvas_t *canv, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height)
+{
+	PTR_CHECK(bitmap, "draw_algorithms");
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
+	draw_bitmap_native(canv, (const pixel_t *)bitmap, x, y, width, height);
+#else
+	(void)canv;
+	(void)x;
+	(void)y;
+	(void)width;
+	(void)height;
+	LOG_ERROR("draw_algorithms", "RGB565 pixels, convert the bitmap with pixel_format_bitmap_new");
+#endif
+}
+
+void draw_alpha_bitmap_8bpp(const canvas_t *canv, pixel_t color, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height)
 {
-	size_t i,j;
+	dim_t x0 = x, y0 = y, w = width, h = height;
 
 	PTR_CHECK(canv, "draw_algorithms");
 
-	CANVAS_START_RECT(canv, x, y, to);
+	if (!clip_rect(canv, &x0, &y0, &w, &h))
+		return;
 
-	for(i=0; i<height; i++)
-	{
-		for(j=0; j<width; j++)
-		{
-			if (bitmap_bit(bitmap, i*width + j))
-				*to = color;
-			to++;
-		}
-		CANVAS_GO_DOWN(canv, to, 1);
-		CANVAS_GO_LEFT(canv, to, width);
-	}
+	framebuffer_ops()->blend_a8(CANVAS_TO(canv, x0, y0), canv->line_incrementation_width,
+			bitmap + (y0 - y) * width + (x0 - x), width, w, h, color);
 }
 
-void draw_bitmap(const canvas_t *canv, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height)
+void draw_alpha_bitmap_8bpp_rle(const canvas_t *canv, pixel_t color, BUFFER_PTR_RDOLY runs, size_t x, size_t y, size_t width, size_t height)
 {
-	size_t i,j;
-	pixel_t * from = (pixel_t *)bitmap;
+	dim_t x0 = x, y0 = y, w = width, h = height;
 
 	PTR_CHECK(canv, "draw_algorithms");
+	PTR_CHECK(runs, "draw_algorithms");
 
-	CANVAS_START_BITMAP(canv, x, y, to);
+	if (!clip_rect(canv, &x0, &y0, &w, &h))
+		return;
 
-	for(i=0; i<height; i++)
+	framebuffer_ops()->blend_a8_rle(CANVAS_TO(canv, x0, y0), canv->line_incrementation_width,
+			framebuffer_ops_rle_skip(runs, width, y0 - y), x0 - x, width, w, h, color);
+}
+
+void draw_bitmap_indexed(const canvas_t *canv, BUFFER_PTR_RDOLY indices, uint8_t bits, const pixel_t *palette, size_t x, size_t y, size_t width, size_t height)
+{
+	dim_t x0 = x, y0 = y, w = width, h = height;
+	/* INDEXED4 rows start on a byte. */
+	size_t index_stride = bits == 4 ? (width + 1) & ~(size_t)1 : width;
+
+	PTR_CHECK(canv, "draw_algorithms");
+	PTR_CHECK(indices, "draw_algorithms");
+	PTR_CHECK(palette, "draw_algorithms");
+
+	if (bits != 4 && bits != 8)
 	{
-		for(j=0; j<width; j++)
-		{
-			*to = *from;
-			to++;
-			from++;
-		}
-		CANVAS_GO_DOWN(canv, to, 1);
-		CANVAS_GO_LEFT(canv, to, width);
+		LOG_ERROR("draw_algorithms", "invalid index width");
+		return;
 	}
+
+	if (!clip_rect(canv, &x0, &y0, &w, &h))
+		return;
+
+	framebuffer_ops()->expand_indexed(CANVAS_TO(canv, x0, y0), canv->line_incrementation_width, indices,
+			(y0 - y) * index_stride + (x0 - x), index_stride, bits, palette, w, h);
 }
 
-void draw_alpha_bitmap_8bpp(const canvas_t *canv, pixel_t color, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height)
+void draw_bitmap_scaled(const canvas_t *canv, const bitmap_t *bitmap, pixel_t color, size_t x, size_t y, size_t width, size_t height, enum e_scale_filter filter)
 {
-	size_t i,j;
-	uint8_t alpha_intensity;
-	pixel_t existent_pixel_color;
-	pixel_t new_pixel_color;
-
+	dim_t x0 = x, y0 = y, w = width, h = height;
+	scale_t scale;
 
 	PTR_CHECK(canv, "draw_algorithms");
+	PTR_CHECK(bitmap, "draw_algorithms");
 
-	CANVAS_START_RECT(canv, x, y, to);
+	scale.filter = filter;
+	scale.pixels = bitmap->bitmap;
+	scale.stride = bitmap->width;
+	scale.width = (dim_t)bitmap->width;
+	scale.height = (dim_t)bitmap->height;
+	scale.palette = bitmap->palette;
+	scale.color = color;
 
-	for(i=0; i<height; i++)
+	switch (bitmap->bitmap_data_width)
 	{
-		for(j=0; j<width; j++)
-		{
-			alpha_intensity = bitmap_byte(bitmap, i*width + j);
-
-			if ( alpha_intensity == 0xFF)
-			{
-				*to = color;
-			}
-			else if (alpha_intensity > 0x00)
-			{
-				existent_pixel_color = *to;
-				new_pixel_color = color_to_pixel(color_alpha_blend(color_from_pixel(existent_pixel_color), color_from_pixel(color), alpha_intensity));
-				*to = new_pixel_color;
-			}
-
-			to++;
-		}
-		CANVAS_GO_DOWN(canv, to, 1);
-		CANVAS_GO_LEFT(canv, to, width);
+	case BITMAP_BUFFER_16BPP:
+#if MARSH_PIXEL_FORMAT != PIXEL_FORMAT_RGB565
+		LOG_ERROR("draw_algorithms", "RGB565 pixels, convert the bitmap with pixel_format_bitmap_new");
+		return;
+#endif
+		/* fall through */
+	case BITMAP_BUFFER_NATIVE:
+		scale.source = SCALE_SOURCE_NATIVE;
+		break;
+	case BITMAP_BUFFER_8BPP:
+		scale.source = SCALE_SOURCE_A8;
+		break;
+	case BITMAP_BUFFER_INDEXED4:
+		scale.source = SCALE_SOURCE_INDEXED4;
+		/* Rows start on a byte. */
+		scale.stride = (bitmap->width + 1) & ~(size_t)1;
+		break;
+	case BITMAP_BUFFER_INDEXED8:
+		scale.source = SCALE_SOURCE_INDEXED8;
+		break;
+	case BITMAP_BUFFER_1BPP:
+	case BITMAP_BUFFER_8BPP_RLE:
+	default:
+		LOG_ERROR("draw_algorithms", "bitmap can't be scaled");
+		return;
 	}
+
+	PTR_CHECK(scale.pixels, "draw_algorithms");
+
+	if (!clip_rect(canv, &x0, &y0, &w, &h))
+		return;
+
+	/* Steps of the whole destination, starting where the canvas clipped it. */
+	scale_fit(&scale, width, height);
+	scale_skip(&scale, x0 - x, y0 - y);
+
+	framebuffer_ops()->scale(CANVAS_TO(canv, x0, y0), canv->line_incrementation_width, &scale, w, h);
+}
+
+void draw_move_region(const canvas_t *canv, dim_t dx, dim_t dy)
+{
+	dim_t width, height;
+	dim_t src_x, src_y, dst_x, dst_y;
+
+	PTR_CHECK(canv, "draw_algorithms");
+
+	width = canv->clip.width - get_abs(dx);
+	height = canv->clip.height - get_abs(dy);
+
+	if (width <= 0 || height <= 0 || (dx == 0 && dy == 0))
+		return;
+
+	src_x = canv->clip.x + (dx < 0 ? -dx : 0);
+	dst_x = canv->clip.x + (dx > 0 ? dx : 0);
+	src_y = canv->clip.y + (dy < 0 ? -dy : 0);
+	dst_y = canv->clip.y + (dy > 0 ? dy : 0);
+
+	framebuffer_ops()->copy_rect(CANVAS_TO(canv, dst_x, dst_y), CANVAS_TO(canv, src_x, src_y), canv->line_incrementation_width, width, height);
 }
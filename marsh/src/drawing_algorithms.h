@@ -26,13 +26,32 @@
 #include "helper/helper_types.h"
 
 void draw_solid_rectangle(const canvas_t *canv, pixel_t color);
+/* Fills a rectangle given relative to the canvas origin, clipped to the canvas. */
+void draw_fill_area(const canvas_t *canv, pixel_t color, dim_t x, dim_t y, dim_t width, dim_t height);
 void draw_solid_round_rectangle(const canvas_t *canv, pixel_t color, size_t round_radius);
 void draw_round_rectangle(const canvas_t *canv, pixel_t color, size_t line_width, size_t round_radius);
 void draw_rectangle(const canvas_t *canv, pixel_t color, size_t line_width);
 void draw_circle(const canvas_t *canv, pixel_t color);
 void draw_bitmap_1bpp(const canvas_t *canv, pixel_t color, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height);
+/* RGB565 pixels, in the RGB565 format only, see pixel_format_bitmap_new. */
 void draw_bitmap(const canvas_t *canv, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height);
+/* Pixels in the framebuffer format. */
+void draw_bitmap_native(const canvas_t *canv, const pixel_t *bitmap, size_t x, size_t y, size_t width, size_t height);
 void draw_alpha_bitmap_8bpp(const canvas_t *canv, pixel_t color, BUFFER_PTR_RDOLY bitmap, size_t x, size_t y, size_t width, size_t height);
+/* BITMAP_BUFFER_8BPP_RLE alpha: transparent runs are skipped, opaque ones filled and
+ * only the partial ones blended. */
+void draw_alpha_bitmap_8bpp_rle(const canvas_t *canv, pixel_t color, BUFFER_PTR_RDOLY runs, size_t x, size_t y, size_t width, size_t height);
+/* BITMAP_BUFFER_INDEXED4 or INDEXED8 indices, bits being 4 or 8, through a palette in
+ * the framebuffer format. */
+void draw_bitmap_indexed(const canvas_t *canv, BUFFER_PTR_RDOLY indices, uint8_t bits, const pixel_t *palette, size_t x, size_t y, size_t width, size_t height);
+/* Bitmap stretched over width by height pixels: NATIVE and INDEXED ones, 16BPP ones
+ * in the RGB565 format, and 8BPP alpha blending color. The canvas clips the
+ * destination, see scale.h. */
+void draw_bitmap_scaled(const canvas_t *canv, const bitmap_t *bitmap, pixel_t color, size_t x, size_t y, size_t width, size_t height, enum e_scale_filter filter);
+
+/* Moves the pixels inside the canvas clip by dx, dy. Pixels moved out of the clip are
+ * dropped, the exposed ones are left untouched. Source and destination may overlap. */
+void draw_move_region(const canvas_t *canv, dim_t dx, dim_t dy);
 
 
 #endif /* DRAWING_ALGORITHMS_H_ */
@@ -25,17 +25,75 @@
 #include "types.h"
 
 
+/* Resolution taken by the next framebuffer_init, 800x480 until set. Backends driving
+ * a fixed panel may refuse other sizes. */
+bool framebuffer_configure(size_t width, size_t height);
 void framebuffer_init(void);
 void framebuffer_deinit(void);
 
 pixel_t *framebuffer_start(void);
-pixel_t *framebuffer_at(pixel_t x, pixel_t y);
+pixel_t *framebuffer_at(dim_t x, dim_t y);
 
 size_t framebuffer_width(void);
 size_t framebuffer_height(void);
+/* Pixels from a row to the next, at least the width, see framebuffer_geometry.h. */
+size_t framebuffer_stride(void);
 
 const area_t * framebuffer_area(void);
 
 void framebuffer_inform_written_area(size_t x, size_t y, size_t width, size_t height);
 
+/*
+ * 2D operations the drawing algorithms and the compositor go through. Strides are
+ * in pixels, or in bits for the 1bpp source. A backend with a blitter, or with kernels
+ * optimized for its CPU, installs its table with framebuffer_set_ops, entries left
+ * NULL fall back to the software ones.
+ *
+ * Operations may complete asynchronously but always in submission order. Their
+ * sources must stay unchanged until they complete, and the CPU must not access the
+ * pixels they write before: framebuffer_ops_sync waits for all of them, and backends
+ * call framebuffer_ops_sync_area before presenting an area.
+ */
+struct s_framebuffer_ops
+{
+	void (*fill_rect)(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color);
+	/* Source and destination may overlap. */
+	void (*copy_rect)(pixel_t * dst, const pixel_t * src, size_t stride, dim_t width, dim_t height);
+	/* Writes color where the source bit, msb first, is set. */
+	void (*expand_1bpp)(pixel_t * dst, size_t stride, const uint8_t * bits, size_t bit_offset, size_t bit_stride, dim_t width, dim_t height, pixel_t color);
+	void (*blend_a8)(pixel_t * dst, size_t stride, const uint8_t * alpha, size_t alpha_stride, dim_t width, dim_t height, pixel_t color);
+	/* Same from BITMAP_BUFFER_8BPP_RLE runs of runs_width columns, runs pointing to the
+	 * first row drawn and column being the first column drawn. */
+	void (*blend_a8_rle)(pixel_t * dst, size_t stride, const uint8_t * runs, size_t column, size_t runs_width, dim_t width, dim_t height, pixel_t color);
+	/* Writes the palette colors of 4 or 8 bit indices, as in BITMAP_BUFFER_INDEXED4 and
+	 * INDEXED8 bitmaps. Offset and stride count indices. */
+	void (*expand_indexed)(pixel_t * dst, size_t stride, const uint8_t * indices, size_t index_offset, size_t index_stride, uint8_t bits, const pixel_t * palette, dim_t width, dim_t height);
+	/* Draws the source of scale over width by height pixels, see scale.h. scale itself
+	 * is only read during the call. */
+	void (*scale)(pixel_t * dst, size_t stride, const scale_t * scale, dim_t width, dim_t height);
+	void (*blit)(pixel_t * dst, size_t stride, const pixel_t * src, size_t src_stride, dim_t width, dim_t height);
+
+	/* Returns a fence passed once every operation submitted so far completed. */
+	uint32_t (*fence)(void);
+	void (*wait)(uint32_t fence);
+	/* Same for the operations writing into area, in framebuffer coordinates. */
+	uint32_t (*fence_area)(const area_t * area);
+};
+
+/* The table is the calling thread's, the others keep theirs, the software one unless
+ * they install another. */
+void framebuffer_set_ops(const framebuffer_ops_t * ops);
+const framebuffer_ops_t * framebuffer_ops(void);
+const framebuffer_ops_t * framebuffer_ops_software(void);
+/* Only the software operations may be called from several threads at once. */
+bool framebuffer_ops_reentrant(void);
+
+/* Start of the row rows down BITMAP_BUFFER_8BPP_RLE runs of width columns. */
+const uint8_t * framebuffer_ops_rle_skip(const uint8_t * runs, size_t width, size_t rows);
+
+uint32_t framebuffer_ops_fence(void);
+void framebuffer_ops_wait(uint32_t fence);
+void framebuffer_ops_sync(void);
+void framebuffer_ops_sync_area(const area_t * area);
+
 #endif /* FRAMEBUFFER_H_ */
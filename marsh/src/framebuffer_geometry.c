@@ -0,0 +1,112 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "framebuffer_geometry.h"
+
+bool framebuffer_geometry_valid(size_t width, size_t height)
+{
+	return width && height && width <= FRAMEBUFFER_MAX_DIMENSION && height <= FRAMEBUFFER_MAX_DIMENSION;
+}
+
+size_t framebuffer_geometry_stride(size_t width)
+{
+	const size_t pixels_per_line = FRAMEBUFFER_ROW_ALIGNMENT / sizeof(pixel_t);
+
+	return (width + pixels_per_line - 1) / pixels_per_line * pixels_per_line;
+}
+
+/* Over-allocates by a line and aligns by hand rather than with posix_memalign, the
+ * unit tests account for every block going through malloc and free. */
+bool framebuffer_geometry_init(framebuffer_geometry_t * obj, size_t width, size_t height)
+{
+	size_t stride;
+	void * block;
+
+	PTR_CHECK_RETURN(obj, "framebuffer_geometry", false);
+
+	if (!framebuffer_geometry_valid(width, height))
+	{
+		LOG_ERROR("framebuffer_geometry", "Unsupported framebuffer size.");
+		return false;
+	}
+
+	stride = framebuffer_geometry_stride(width);
+
+	/* Same size again, canvases pointing into the pixels stay valid. */
+	if (obj->pixels && obj->width == width && obj->height == height)
+	{
+		memset(obj->pixels, 0, stride * height * sizeof(pixel_t));
+		return true;
+	}
+
+	block = calloc(stride * height * sizeof(pixel_t) + FRAMEBUFFER_ROW_ALIGNMENT, 1);
+	MEMORY_ALLOC_CHECK_RETURN(block, false);
+
+	framebuffer_geometry_deinit(obj);
+
+	obj->width = width;
+	obj->height = height;
+	obj->stride = stride;
+	area_set(&obj->area, 0, 0, (dim_t)width, (dim_t)height);
+	obj->block = block;
+	obj->pixels = (pixel_t *)(((uintptr_t)block + FRAMEBUFFER_ROW_ALIGNMENT - 1) & ~(uintptr_t)(FRAMEBUFFER_ROW_ALIGNMENT - 1));
+
+	return true;
+}
+
+void framebuffer_geometry_deinit(framebuffer_geometry_t * obj)
+{
+	PTR_CHECK(obj, "framebuffer_geometry");
+
+	free(obj->block);
+	memset(obj, 0, sizeof(*obj));
+}
+
+pixel_t * framebuffer_geometry_at(const framebuffer_geometry_t * obj, dim_t x, dim_t y)
+{
+	if (!obj->pixels)
+		return NULL;
+
+	return obj->pixels + (ptrdiff_t)y * (ptrdiff_t)obj->stride + x;
+}
+
+bool framebuffer_geometry_parse(const char * text, size_t * width, size_t * height)
+{
+	unsigned w, h;
+	char end;
+
+	PTR_CHECK_RETURN(text, "framebuffer_geometry", false);
+
+	if (sscanf(text, "%ux%u%c", &w, &h, &end) != 2 || !framebuffer_geometry_valid(w, h))
+		return false;
+
+	*width = w;
+	*height = h;
+
+	return true;
+}
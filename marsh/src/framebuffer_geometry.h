@@ -0,0 +1,54 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FRAMEBUFFER_GEOMETRY_H_
+#define FRAMEBUFFER_GEOMETRY_H_
+
+#include "types.h"
+
+/*
+ * Resolution and row layout shared by the framebuffer backends. Rows start on a
+ * cache line so the row loops of the drawing algorithms never split a line with the
+ * previous row, the stride is the width rounded up to that.
+ */
+
+#define FRAMEBUFFER_ROW_ALIGNMENT 64
+/* Keeps offsets and areas inside dim_t, 4K panels need 3840x2160. */
+#define FRAMEBUFFER_MAX_DIMENSION 8192
+
+#define FRAMEBUFFER_DEFAULT_WIDTH  800
+#define FRAMEBUFFER_DEFAULT_HEIGHT 480
+
+bool framebuffer_geometry_valid(size_t width, size_t height);
+size_t framebuffer_geometry_stride(size_t width);
+
+/* Allocates cleared pixels, releasing the previous ones, or only clears them when the
+ * size did not change. Returns false and keeps the geometry as it was on an invalid
+ * size or when out of memory. */
+bool framebuffer_geometry_init(framebuffer_geometry_t * obj, size_t width, size_t height);
+void framebuffer_geometry_deinit(framebuffer_geometry_t * obj);
+
+pixel_t * framebuffer_geometry_at(const framebuffer_geometry_t * obj, dim_t x, dim_t y);
+
+/* Reads "WxH" as found in the MARSH_FRAMEBUFFER variable of the simulators. */
+bool framebuffer_geometry_parse(const char * text, size_t * width, size_t * height);
+
+#endif /* FRAMEBUFFER_GEOMETRY_H_ */
@@ -0,0 +1,452 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "color.h"
+#include "framebuffer.h"
+#include "pixel_convert.h"
+#include "pixel_format.h"
+#include "scale.h"
+#include "bitmap_data/bitmap_data.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define FRAMEBUFFER_OPS_X86
+#include <immintrin.h>
+#endif
+
+/* The kernels are built for the one pixel format of the framebuffer, pixel_format.h
+ * resolves the packing at build time. */
+
+static void software_fill_rect(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color)
+{
+	dim_t i, j;
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_L8 || MARSH_PIXEL_FORMAT == PIXEL_FORMAT_INDEXED8
+	(void)j;
+	for (i = 0; i < height; i++, dst += stride)
+		memset(dst, color, (size_t)width);
+#else
+	for (i = 0; i < height; i++, dst += stride)
+		for (j = 0; j < width; j++)
+			dst[j] = color;
+#endif
+}
+
+/* Lines are visited against the move direction so no source line is overwritten
+ * before being read, memmove deals with the overlap inside a line. */
+static void software_copy_rect(pixel_t * dst, const pixel_t * src, size_t stride, dim_t width, dim_t height)
+{
+	dim_t line;
+
+	if (dst > src)
+	{
+		for (line = height - 1; line >= 0; line--)
+			memmove(dst + line * stride, src + line * stride, width * sizeof(pixel_t));
+	}
+	else
+	{
+		for (line = 0; line < height; line++)
+			memmove(dst + line * stride, src + line * stride, width * sizeof(pixel_t));
+	}
+}
+
+static void software_expand_1bpp(pixel_t * dst, size_t stride, const uint8_t * bits, size_t bit_offset, size_t bit_stride, dim_t width, dim_t height, pixel_t color)
+{
+	size_t bit;
+	dim_t i, j;
+
+	for (i = 0; i < height; i++, dst += stride, bit_offset += bit_stride)
+	{
+		for (j = 0, bit = bit_offset; j < width; j++, bit++)
+			if (bits[bit >> 3] & (1 << (7 - (bit & 0x7))))
+				dst[j] = color;
+	}
+}
+
+static void software_blend_a8(pixel_t * dst, size_t stride, const uint8_t * alpha, size_t alpha_stride, dim_t width, dim_t height, pixel_t color)
+{
+	const uint8_t red = PIXEL_RED(color), green = PIXEL_GREEN(color), blue = PIXEL_BLUE(color);
+	pixel_t pixel;
+	dim_t i, j;
+
+	for (i = 0; i < height; i++, dst += stride, alpha += alpha_stride)
+	{
+		for (j = 0; j < width; j++)
+		{
+			if (alpha[j] == 0xFF)
+				dst[j] = color;
+			else if (alpha[j] > 0x00)
+			{
+				pixel = dst[j];
+				dst[j] = PIXEL_PACK(PIXEL_BLEND_CHANNEL(PIXEL_RED(pixel), red, alpha[j]),
+						PIXEL_BLEND_CHANNEL(PIXEL_GREEN(pixel), green, alpha[j]),
+						PIXEL_BLEND_CHANNEL(PIXEL_BLUE(pixel), blue, alpha[j]));
+			}
+		}
+	}
+}
+
+static void software_blend_a8_rle(pixel_t * dst, size_t stride, const uint8_t * runs, size_t column, size_t runs_width, dim_t width, dim_t height, pixel_t color)
+{
+	const uint8_t red = PIXEL_RED(color), green = PIXEL_GREEN(color), blue = PIXEL_BLUE(color);
+	size_t start, length, from, to, i;
+	pixel_t pixel;
+	uint8_t kind;
+	dim_t row;
+
+	for (row = 0; row < height; row++, dst += stride)
+	{
+		for (start = 0; start < runs_width; start += length, runs++)
+		{
+			kind = BITMAP_RLE_KIND(*runs);
+			length = BITMAP_RLE_LENGTH(*runs);
+			from = start > column ? start : column;
+			to = start + length < column + width ? start + length : column + width;
+
+			/* Transparent runs are only stepped over, opaque ones need no blending. */
+			if (kind == BITMAP_RLE_OPAQUE)
+			{
+				for (i = from; i < to; i++)
+					dst[i - column] = color;
+			}
+			else if (kind == BITMAP_RLE_PARTIAL)
+			{
+				for (i = from; i < to; i++)
+				{
+					pixel = dst[i - column];
+					dst[i - column] = PIXEL_PACK(PIXEL_BLEND_CHANNEL(PIXEL_RED(pixel), red, runs[1 + i - start]),
+							PIXEL_BLEND_CHANNEL(PIXEL_GREEN(pixel), green, runs[1 + i - start]),
+							PIXEL_BLEND_CHANNEL(PIXEL_BLUE(pixel), blue, runs[1 + i - start]));
+				}
+				runs += length;
+			}
+		}
+	}
+}
+
+static void expand_4bpp_scalar(pixel_t * dst, const uint8_t * indices, size_t index, const pixel_t * palette, dim_t width)
+{
+	const uint8_t * pair;
+	dim_t j = 0;
+
+	if (index & 1)
+		dst[j++] = palette[BITMAP_INDEXED4_AT(indices, index)];
+
+	/* Two pixels a byte from there. */
+	for (pair = indices + ((index + j) >> 1); j + 2 <= width; j += 2, pair++)
+	{
+		dst[j] = palette[*pair >> 4];
+		dst[j + 1] = palette[*pair & 0x0F];
+	}
+
+	if (j < width)
+		dst[j] = palette[*pair >> 4];
+}
+
+#ifdef FRAMEBUFFER_OPS_X86
+
+/*
+ * The 16 colors of an INDEXED4 palette fit a register per byte of the pixel, so the
+ * expansion is a byte shuffle of each register by the indices, 16 pixels at a time,
+ * and an interleave of the results.
+ */
+__attribute__((target("ssse3")))
+static void expand_4bpp_ssse3(pixel_t * dst, const uint8_t * indices, size_t index, const pixel_t * palette, dim_t width)
+{
+	uint8_t planes[sizeof(pixel_t)][16];
+	__m128i plane[sizeof(pixel_t)], packed, nibbles, byte[sizeof(pixel_t)];
+	const __m128i low_nibble = _mm_set1_epi8(0x0F);
+	size_t i, k;
+	dim_t j = 0;
+
+	for (i = 0; i < 16; i++)
+		for (k = 0; k < sizeof(pixel_t); k++)
+			planes[k][i] = (uint8_t)(palette[i] >> (8 * k));
+	for (k = 0; k < sizeof(pixel_t); k++)
+		plane[k] = _mm_loadu_si128((const __m128i *)planes[k]);
+
+	/* A row starting on a low nibble begins one index late. */
+	if (index & 1)
+	{
+		dst[j++] = palette[BITMAP_INDEXED4_AT(indices, index)];
+		index++;
+	}
+
+	for (; j + 16 <= width; j += 16, index += 16)
+	{
+		packed = _mm_loadl_epi64((const __m128i *)(indices + (index >> 1)));
+		nibbles = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(packed, 4), low_nibble), _mm_and_si128(packed, low_nibble));
+
+		for (k = 0; k < sizeof(pixel_t); k++)
+			byte[k] = _mm_shuffle_epi8(plane[k], nibbles);
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
+		_mm_storeu_si128((__m128i *)(dst + j), _mm_unpacklo_epi8(byte[0], byte[1]));
+		_mm_storeu_si128((__m128i *)(dst + j + 8), _mm_unpackhi_epi8(byte[0], byte[1]));
+#elif MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB888 || MARSH_PIXEL_FORMAT == PIXEL_FORMAT_ARGB8888
+		{
+			const __m128i low01 = _mm_unpacklo_epi8(byte[0], byte[1]), high01 = _mm_unpackhi_epi8(byte[0], byte[1]);
+			const __m128i low23 = _mm_unpacklo_epi8(byte[2], byte[3]), high23 = _mm_unpackhi_epi8(byte[2], byte[3]);
+
+			_mm_storeu_si128((__m128i *)(dst + j), _mm_unpacklo_epi16(low01, low23));
+			_mm_storeu_si128((__m128i *)(dst + j + 4), _mm_unpackhi_epi16(low01, low23));
+			_mm_storeu_si128((__m128i *)(dst + j + 8), _mm_unpacklo_epi16(high01, high23));
+			_mm_storeu_si128((__m128i *)(dst + j + 12), _mm_unpackhi_epi16(high01, high23));
+		}
+#else
+		_mm_storeu_si128((__m128i *)(dst + j), byte[0]);
+#endif
+	}
+
+	if (j < width)
+		expand_4bpp_scalar(dst + j, indices, index, palette, width - j);
+}
+
+#endif /* FRAMEBUFFER_OPS_X86 */
+
+/* Each 8 bit index is a load from the palette, which a gather would not beat at
+ * these pixel sizes. */
+static void software_expand_indexed(pixel_t * dst, size_t stride, const uint8_t * indices, size_t index_offset, size_t index_stride, uint8_t bits, const pixel_t * palette, dim_t width, dim_t height)
+{
+	void (*expand_4bpp)(pixel_t *, const uint8_t *, size_t, const pixel_t *, dim_t) = expand_4bpp_scalar;
+	const uint8_t * row;
+	dim_t i, j;
+
+	if (bits == 8)
+	{
+		for (i = 0, row = indices + index_offset; i < height; i++, dst += stride, row += index_stride)
+			for (j = 0; j < width; j++)
+				dst[j] = palette[row[j]];
+		return;
+	}
+
+#ifdef FRAMEBUFFER_OPS_X86
+	if (width >= 16 && pixel_convert_isa() >= PIXEL_CONVERT_SSSE3)
+		expand_4bpp = expand_4bpp_ssse3;
+#endif
+
+	for (i = 0; i < height; i++, dst += stride, index_offset += index_stride)
+		expand_4bpp(dst, indices, index_offset, palette, width);
+}
+
+static void software_blit(pixel_t * dst, size_t stride, const pixel_t * src, size_t src_stride, dim_t width, dim_t height)
+{
+	dim_t i;
+
+	for (i = 0; i < height; i++, dst += stride, src += src_stride)
+		memcpy(dst, src, width * sizeof(pixel_t));
+}
+
+/* Fallbacks for asynchronous tables, run on the CPU once the queued operations completed. */
+static void synced_fill_rect(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color)
+{
+	framebuffer_ops_sync();
+	software_fill_rect(dst, stride, width, height, color);
+}
+
+static void synced_copy_rect(pixel_t * dst, const pixel_t * src, size_t stride, dim_t width, dim_t height)
+{
+	framebuffer_ops_sync();
+	software_copy_rect(dst, src, stride, width, height);
+}
+
+static void synced_expand_1bpp(pixel_t * dst, size_t stride, const uint8_t * bits, size_t bit_offset, size_t bit_stride, dim_t width, dim_t height, pixel_t color)
+{
+	framebuffer_ops_sync();
+	software_expand_1bpp(dst, stride, bits, bit_offset, bit_stride, width, height, color);
+}
+
+static void synced_blend_a8(pixel_t * dst, size_t stride, const uint8_t * alpha, size_t alpha_stride, dim_t width, dim_t height, pixel_t color)
+{
+	framebuffer_ops_sync();
+	software_blend_a8(dst, stride, alpha, alpha_stride, width, height, color);
+}
+
+static void synced_blend_a8_rle(pixel_t * dst, size_t stride, const uint8_t * runs, size_t column, size_t runs_width, dim_t width, dim_t height, pixel_t color)
+{
+	framebuffer_ops_sync();
+	software_blend_a8_rle(dst, stride, runs, column, runs_width, width, height, color);
+}
+
+static void synced_expand_indexed(pixel_t * dst, size_t stride, const uint8_t * indices, size_t index_offset, size_t index_stride, uint8_t bits, const pixel_t * palette, dim_t width, dim_t height)
+{
+	framebuffer_ops_sync();
+	software_expand_indexed(dst, stride, indices, index_offset, index_stride, bits, palette, width, height);
+}
+
+static void synced_scale(pixel_t * dst, size_t stride, const scale_t * scale, dim_t width, dim_t height)
+{
+	framebuffer_ops_sync();
+	scale_software(dst, stride, scale, width, height);
+}
+
+static void synced_blit(pixel_t * dst, size_t stride, const pixel_t * src, size_t src_stride, dim_t width, dim_t height)
+{
+	framebuffer_ops_sync();
+	software_blit(dst, stride, src, src_stride, width, height);
+}
+
+static const framebuffer_ops_t synced_ops =
+{
+	synced_fill_rect,
+	synced_copy_rect,
+	synced_expand_1bpp,
+	synced_blend_a8,
+	synced_blend_a8_rle,
+	synced_expand_indexed,
+	synced_scale,
+	synced_blit,
+	NULL,
+	NULL,
+	NULL
+};
+
+static const framebuffer_ops_t software_ops =
+{
+	software_fill_rect,
+	software_copy_rect,
+	software_expand_1bpp,
+	software_blend_a8,
+	software_blend_a8_rle,
+	software_expand_indexed,
+	scale_software,
+	software_blit,
+	NULL,
+	NULL,
+	NULL
+};
+
+/* Per thread, so that a display list recording on the UI thread does not swap the
+ * table a render or worker thread is reading. Other threads start on the software
+ * operations, the only ones they may run concurrently. */
+static __thread bool software_installed = true;
+
+static __thread framebuffer_ops_t installed_ops =
+{
+	software_fill_rect,
+	software_copy_rect,
+	software_expand_1bpp,
+	software_blend_a8,
+	software_blend_a8_rle,
+	software_expand_indexed,
+	scale_software,
+	software_blit,
+	NULL,
+	NULL,
+	NULL
+};
+
+void framebuffer_set_ops(const framebuffer_ops_t * ops)
+{
+	const framebuffer_ops_t * fallback;
+
+	/* What was queued on the previous table completes before switching. */
+	framebuffer_ops_sync();
+
+	if (!ops)
+		ops = &software_ops;
+
+	/* Next to asynchronous operations the software ones must wait for the queue. */
+	fallback = ops->fence ? &synced_ops : &software_ops;
+
+	installed_ops.fill_rect = ops->fill_rect ? ops->fill_rect : fallback->fill_rect;
+	installed_ops.copy_rect = ops->copy_rect ? ops->copy_rect : fallback->copy_rect;
+	installed_ops.expand_1bpp = ops->expand_1bpp ? ops->expand_1bpp : fallback->expand_1bpp;
+	installed_ops.blend_a8 = ops->blend_a8 ? ops->blend_a8 : fallback->blend_a8;
+	installed_ops.blend_a8_rle = ops->blend_a8_rle ? ops->blend_a8_rle : fallback->blend_a8_rle;
+	installed_ops.expand_indexed = ops->expand_indexed ? ops->expand_indexed : fallback->expand_indexed;
+	installed_ops.scale = ops->scale ? ops->scale : fallback->scale;
+	installed_ops.blit = ops->blit ? ops->blit : fallback->blit;
+	installed_ops.fence = ops->fence;
+	installed_ops.wait = ops->wait;
+	installed_ops.fence_area = ops->fence_area;
+
+	/* A copy of the installed table, as restored after a display list recording,
+	 * counts as the software one. */
+	software_installed = !memcmp(&installed_ops, &software_ops, sizeof(installed_ops));
+}
+
+const framebuffer_ops_t * framebuffer_ops(void)
+{
+	return &installed_ops;
+}
+
+const framebuffer_ops_t * framebuffer_ops_software(void)
+{
+	return &software_ops;
+}
+
+bool framebuffer_ops_reentrant(void)
+{
+	return software_installed;
+}
+
+const uint8_t * framebuffer_ops_rle_skip(const uint8_t * runs, size_t width, size_t rows)
+{
+	size_t column, length;
+
+	for (; rows; rows--)
+	{
+		for (column = 0; column < width; column += length)
+		{
+			length = BITMAP_RLE_LENGTH(*runs);
+			runs += BITMAP_RLE_KIND(*runs) == BITMAP_RLE_PARTIAL ? 1 + length : 1;
+		}
+	}
+
+	return runs;
+}
+
+uint32_t framebuffer_ops_fence(void)
+{
+	if (!installed_ops.fence)
+		return 0;
+
+	return installed_ops.fence();
+}
+
+void framebuffer_ops_wait(uint32_t fence)
+{
+	if (installed_ops.wait)
+		installed_ops.wait(fence);
+}
+
+void framebuffer_ops_sync(void)
+{
+	if (installed_ops.fence && installed_ops.wait)
+		installed_ops.wait(installed_ops.fence());
+}
+
+void framebuffer_ops_sync_area(const area_t * area)
+{
+	if (!installed_ops.fence_area)
+	{
+		framebuffer_ops_sync();
+		return;
+	}
+
+	if (installed_ops.wait)
+		installed_ops.wait(installed_ops.fence_area(area));
+}
@@ -0,0 +1,271 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "helper/checks.h"
+#include "helper/number.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "canvas.h"
+#include "color.h"
+#include "framebuffer.h"
+#include "gauge.h"
+#include "path_rasterizer.h"
+#include "render_thread.h"
+#include "sprite.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+
+struct s_gauge
+{
+	color_t track_color;
+	char track_color_html[COLOR_HTML_CODE_SIZE];
+	color_t value_color;
+	char value_color_html[COLOR_HTML_CODE_SIZE];
+	dim_t thickness;
+
+	int32_t start_angle;
+	int32_t sweep_angle;
+
+	int32_t min;
+	int32_t max;
+	int32_t value;
+
+	widget_t * glyph;
+};
+
+/* Ring geometry relative to the widget origin. */
+static fixed_point_t center(const gauge_t * obj)
+{
+	const area_t * area = widget_area(obj->glyph);
+	fixed_point_t point;
+
+	point.x = PATH_FIXED(area->width) / 2;
+	point.y = PATH_FIXED(area->height) / 2;
+
+	return point;
+}
+
+static int32_t radius(const gauge_t * obj)
+{
+	const area_t * area = widget_area(obj->glyph);
+
+	return PATH_FIXED(get_smaller(area->width, area->height)) / 2;
+}
+
+static int32_t value_sweep(const gauge_t * obj, int32_t value)
+{
+	if (obj->max <= obj->min)
+		return 0;
+
+	value = get_bigger(value, obj->min);
+	value = get_smaller(value, obj->max);
+
+	return (int32_t)((int64_t)obj->sweep_angle * (value - obj->min) / ((int64_t)obj->max - obj->min));
+}
+
+static void draw(gauge_t * obj, const area_t * limiting_canvas_area)
+{
+	canvas_t * canv;
+	int32_t sweep;
+
+	PTR_CHECK(obj, "gauge");
+
+	canv = canvas_new_clipped(widget_area(obj->glyph), limiting_canvas_area);
+	sweep = value_sweep(obj, obj->value);
+
+	draw_arc(canv, color_to_pixel(obj->value_color), center(obj), radius(obj), PATH_FIXED(obj->thickness), obj->start_angle, sweep);
+	draw_arc(canv, color_to_pixel(obj->track_color), center(obj), radius(obj), PATH_FIXED(obj->thickness), obj->start_angle + sweep,
+			obj->sweep_angle - sweep);
+
+	canvas_delete(canv);
+}
+
+/* Draws the arcs in the bounds of the sector between two value sweeps. The arcs are
+ * opaque, only their spans there are rasterized, without the widgets under them. */
+static void redraw_sector(gauge_t * obj, int32_t from, int32_t to)
+{
+	const area_t * area = widget_area(obj->glyph);
+	area_t sector, view;
+
+	arc_bounds(&sector, center(obj), radius(obj), PATH_FIXED(obj->thickness), obj->start_angle + get_smaller(from, to), get_abs(to - from));
+	sector.x += area->x;
+	sector.y += area->y;
+
+	/* Out of a transaction only counted, for display lists to record the change. */
+	widget_invalidate_area(obj->glyph, &sector);
+	if (widget_update_in_progress())
+		return;
+
+	if (!widget_visible(obj->glyph) || !widget_tree_ancestors_visible(obj->glyph))
+		return;
+
+	view = widget_tree_ancestors_intersection_canvas_area(obj->glyph);
+	area_set_intersection(&view, &view, &sector);
+	area_set_intersection(&view, &view, framebuffer_area());
+
+	if (!area_value(&view))
+		return;
+
+	/* Drawing over other widgets, or under a frame the render thread is drawing. */
+	if (render_thread_running() || widget_tree_overlapped(obj->glyph, &view))
+	{
+		widget_redraw_area(widget_root(obj->glyph), &view);
+		return;
+	}
+
+	/* Both arcs, the rays where they meet belong to the track, as in a full draw. */
+	sprite_overlay_lift(&view);
+	draw(obj, &view);
+	sprite_overlay_drop();
+
+	framebuffer_inform_written_area(view.x, view.y, view.width, view.height);
+}
+
+gauge_t * gauge_new(widget_t * parent)
+{
+	gauge_t * obj = (gauge_t *)calloc(1, sizeof(struct s_gauge));
+	MEMORY_ALLOC_CHECK_RETURN(obj, NULL);
+
+	obj->glyph = widget_new(parent, obj, (void(*)(void *, const area_t *))draw, (void(*)(void *))gauge_delete);
+	obj->track_color = color(0x40, 0x40, 0x40);
+	obj->value_color = color(0xFF, 0xFF, 0xFF);
+	obj->thickness = 1;
+	obj->start_angle = PATH_DEGREES(135);
+	obj->sweep_angle = PATH_DEGREES(270);
+	obj->max = 100;
+
+	return obj;
+}
+
+void gauge_delete(gauge_t * obj)
+{
+	PTR_CHECK(obj, "gauge");
+
+	widget_delete_instance_only(obj->glyph);
+
+	free(obj);
+}
+
+void gauge_set_position(gauge_t * obj, dim_t x, dim_t y)
+{
+	PTR_CHECK(obj, "gauge");
+
+	widget_set_pos(obj->glyph, x, y);
+}
+
+void gauge_set_size(gauge_t * obj, dim_t width, dim_t height)
+{
+	PTR_CHECK(obj, "gauge");
+
+	widget_set_dim(obj->glyph, width, height);
+}
+
+void gauge_set_thickness(gauge_t * obj, dim_t thickness)
+{
+	PTR_CHECK(obj, "gauge");
+
+	if (obj->thickness == thickness)
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	obj->thickness = thickness;
+}
+
+void gauge_set_angles(gauge_t * obj, int32_t start_angle, int32_t sweep_angle)
+{
+	PTR_CHECK(obj, "gauge");
+
+	if (obj->start_angle == start_angle && obj->sweep_angle == sweep_angle)
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	obj->start_angle = start_angle;
+	obj->sweep_angle = sweep_angle;
+}
+
+void gauge_set_track_color_html(gauge_t * obj, const char * html_color_code)
+{
+	PTR_CHECK(obj, "gauge");
+
+	if (!color_html_cache_update(obj->track_color_html, html_color_code))
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	obj->track_color = color_html(html_color_code);
+}
+
+void gauge_set_value_color_html(gauge_t * obj, const char * html_color_code)
+{
+	PTR_CHECK(obj, "gauge");
+
+	if (!color_html_cache_update(obj->value_color_html, html_color_code))
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	obj->value_color = color_html(html_color_code);
+}
+
+void gauge_set_range(gauge_t * obj, int32_t min, int32_t max)
+{
+	PTR_CHECK(obj, "gauge");
+
+	if (obj->min == min && obj->max == max)
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	obj->min = min;
+	obj->max = max;
+}
+
+void gauge_set_value(gauge_t * obj, int32_t value)
+{
+	int32_t from, to;
+
+	PTR_CHECK(obj, "gauge");
+
+	from = value_sweep(obj, obj->value);
+	to = value_sweep(obj, value);
+	obj->value = value;
+
+	if (from != to)
+		redraw_sector(obj, from, to);
+}
+
+int32_t gauge_value(const gauge_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "gauge", 0);
+
+	return obj->value;
+}
+
+widget_t * gauge_get_widget(gauge_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "gauge", NULL);
+
+	return obj->glyph;
+}
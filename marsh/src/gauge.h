@@ -0,0 +1,54 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef GAUGE_H_
+#define GAUGE_H_
+
+#include "types.h"
+
+/*
+ * Round gauge drawn as an arc track filled up to the current value. The arc is the
+ * largest ring fitting the widget area, swept clockwise from the start angle. Angles
+ * are in tenths of a degree, see path_rasterizer.h.
+ *
+ * A value change out of a transaction draws right away only the arc spans in the
+ * bounds of the sector between the old and the new value, without the widgets under
+ * the gauge. Inside a transaction, or while other widgets overlap the sector, the
+ * tree is redrawn in the sector bounds.
+ */
+
+gauge_t * gauge_new(widget_t * parent);
+void gauge_delete(gauge_t * obj);
+
+void gauge_set_position(gauge_t * obj, dim_t x, dim_t y);
+void gauge_set_size(gauge_t * obj, dim_t width, dim_t height);
+void gauge_set_thickness(gauge_t * obj, dim_t thickness);
+void gauge_set_angles(gauge_t * obj, int32_t start_angle, int32_t sweep_angle);
+void gauge_set_track_color_html(gauge_t * obj, const char * html_color_code);
+void gauge_set_value_color_html(gauge_t * obj, const char * html_color_code);
+
+void gauge_set_range(gauge_t * obj, int32_t min, int32_t max);
+void gauge_set_value(gauge_t * obj, int32_t value);
+int32_t gauge_value(const gauge_t * obj);
+
+widget_t * gauge_get_widget(gauge_t * obj);
+
+#endif /* GAUGE_H_ */
@@ -23,6 +23,7 @@
 #define HELPER_TYPES_H_
 
 typedef struct s_stack my_stack_t;
+typedef struct s_thread_pool thread_pool_t;
 #define BUFFER_PTR_RDOLY const uint8_t *
 #define BUFFER_PTR uint8_t *
 
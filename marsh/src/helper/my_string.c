@@ -19,6 +19,8 @@
  *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "my_string.h"
 #include "checks.h"
 #include "signalslot.h"
@@ -109,6 +111,10 @@ size_t my_string_set(my_string_t *obj, const char* str)
 
 	PTR_CHECK_RETURN(obj, "my_string", 0);
 
+	/* Setting the current content again is not an update. */
+	if (len == obj->str_len && memcmp(obj->str_data, str, len) == 0)
+		return obj->str_len;
+
 	if ((len+1) > obj->mem_size)
 	{
 		_clear(obj);
@@ -0,0 +1,184 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "checks.h"
+#include "log.h"
+#include "thread_pool.h"
+
+struct s_thread_pool
+{
+	pthread_t * workers;
+	size_t threads;
+
+	pthread_mutex_t mutex;
+	pthread_cond_t start_cond;
+	pthread_cond_t done_cond;
+	uint32_t generation;
+	size_t busy;
+	bool quit;
+
+	void (*job)(void * context, size_t thread);
+	void * context;
+};
+
+struct s_worker_start
+{
+	thread_pool_t * pool;
+	size_t thread;
+};
+
+static void * worker(void * arg)
+{
+	thread_pool_t * obj = ((struct s_worker_start *)arg)->pool;
+	size_t thread = ((struct s_worker_start *)arg)->thread;
+	/* Started at generation 0, a job may be posted before the thread runs. */
+	uint32_t generation = 0;
+
+	free(arg);
+
+	pthread_mutex_lock(&obj->mutex);
+
+	for (;;)
+	{
+		while (!obj->quit && obj->generation == generation)
+			pthread_cond_wait(&obj->start_cond, &obj->mutex);
+
+		if (obj->quit)
+			break;
+
+		generation = obj->generation;
+		pthread_mutex_unlock(&obj->mutex);
+
+		obj->job(obj->context, thread);
+
+		pthread_mutex_lock(&obj->mutex);
+		if (!--obj->busy)
+			pthread_cond_signal(&obj->done_cond);
+	}
+
+	pthread_mutex_unlock(&obj->mutex);
+
+	return NULL;
+}
+
+thread_pool_t * thread_pool_new(size_t threads)
+{
+	struct s_worker_start * start;
+	thread_pool_t * obj;
+
+	obj = (thread_pool_t *)calloc(1, sizeof(struct s_thread_pool));
+	MEMORY_ALLOC_CHECK_RETURN(obj, NULL);
+
+	if (!threads)
+		threads = 1;
+
+	obj->workers = (pthread_t *)calloc(threads, sizeof(pthread_t));
+	if (!obj->workers)
+	{
+		free(obj);
+		LOG_ERROR("thread_pool", "Failed to alloc memory");
+		return NULL;
+	}
+
+	pthread_mutex_init(&obj->mutex, NULL);
+	pthread_cond_init(&obj->start_cond, NULL);
+	pthread_cond_init(&obj->done_cond, NULL);
+
+	/* Threads that can't start leave a smaller pool. */
+	for (obj->threads = 1; obj->threads < threads; obj->threads++)
+	{
+		start = (struct s_worker_start *)malloc(sizeof(struct s_worker_start));
+		if (!start)
+			break;
+
+		start->pool = obj;
+		start->thread = obj->threads;
+
+		if (pthread_create(&obj->workers[obj->threads], NULL, worker, start))
+		{
+			free(start);
+			LOG_ERROR("thread_pool", "can't start a worker thread");
+			break;
+		}
+	}
+
+	return obj;
+}
+
+void thread_pool_delete(thread_pool_t * obj)
+{
+	size_t i;
+
+	PTR_CHECK(obj, "thread_pool");
+
+	pthread_mutex_lock(&obj->mutex);
+	obj->quit = true;
+	pthread_cond_broadcast(&obj->start_cond);
+	pthread_mutex_unlock(&obj->mutex);
+
+	for (i = 1; i < obj->threads; i++)
+		pthread_join(obj->workers[i], NULL);
+
+	pthread_cond_destroy(&obj->done_cond);
+	pthread_cond_destroy(&obj->start_cond);
+	pthread_mutex_destroy(&obj->mutex);
+
+	free(obj->workers);
+	free(obj);
+}
+
+size_t thread_pool_threads(const thread_pool_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "thread_pool", 0);
+
+	return obj->threads;
+}
+
+void thread_pool_run(thread_pool_t * obj, void (*job)(void * context, size_t thread), void * context)
+{
+	PTR_CHECK(obj, "thread_pool");
+	PTR_CHECK(job, "thread_pool");
+
+	if (obj->threads > 1)
+	{
+		pthread_mutex_lock(&obj->mutex);
+		obj->job = job;
+		obj->context = context;
+		obj->generation++;
+		obj->busy = obj->threads - 1;
+		pthread_cond_broadcast(&obj->start_cond);
+		pthread_mutex_unlock(&obj->mutex);
+	}
+
+	job(context, 0);
+
+	if (obj->threads > 1)
+	{
+		pthread_mutex_lock(&obj->mutex);
+		while (obj->busy)
+			pthread_cond_wait(&obj->done_cond, &obj->mutex);
+		pthread_mutex_unlock(&obj->mutex);
+	}
+}
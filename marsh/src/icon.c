@@ -27,14 +27,20 @@
 #include "canvas.h"
 #include "drawing_algorithms.h"
 #include "widget.h"
+#include "widget_update.h"
 #include "icon.h"
+#include "scale.h"
 #include "bitmap_data/bitmap_data.h"
 
 
 struct s_icon_instance
 {
 	color_t color;
+	char color_html[COLOR_HTML_CODE_SIZE];
 	bitmap_t *bitmap;
+	bitmap_levels_t *levels;
+	bool scaled;
+	enum e_scale_filter filter;
 
 	my_log_t * log;
 	widget_t *glyph;
@@ -62,13 +68,22 @@ static void draw(icon_t * obj, const area_t * limiting_canvas_area)
 		return;
 	}
 
-	area_t canvas_area = widget_compute_canvas_area(obj->glyph, limiting_canvas_area);
-	canvas_t *canv = canvas_new(&canvas_area);
+	const area_t *area = widget_area(obj->glyph);
+	canvas_t *canv = canvas_new_clipped(area, limiting_canvas_area);
 
-	if (obj->bitmap->bitmap_data_width == BITMAP_BUFFER_8BPP)
+	/* A level of the drawn size is blended as it is. */
+	if (obj->scaled && ((uint32_t)area->width != obj->bitmap->width || (uint32_t)area->height != obj->bitmap->height))
+	{
+		draw_bitmap_scaled(canv, obj->bitmap, color_to_pixel(obj->color), 0, 0, area->width, area->height, obj->filter);
+	}
+	else if (obj->bitmap->bitmap_data_width == BITMAP_BUFFER_8BPP)
 	{
 		draw_alpha_bitmap_8bpp(canv, color_to_pixel(obj->color), (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 0, 0, obj->bitmap->width, obj->bitmap->height);
 	}
+	else if (obj->bitmap->bitmap_data_width == BITMAP_BUFFER_8BPP_RLE)
+	{
+		draw_alpha_bitmap_8bpp_rle(canv, color_to_pixel(obj->color), (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 0, 0, obj->bitmap->width, obj->bitmap->height);
+	}
 	else
 	{
 		my_log(ERROR, __FILE__, __LINE__, "Bad bitmap_data_width", obj->log);
@@ -85,7 +100,11 @@ icon_t * icon_new(widget_t * parent)
 	obj->log = my_log_new("Icon", MESSAGE);
 	obj->glyph = widget_new(parent, obj, (void(*)(void *, const area_t *))draw, (void(*)(void *))icon_delete);
 	obj->color = color(255,255,255);
+	obj->color_html[0] = '\0';
 	obj->bitmap = NULL;
+	obj->levels = NULL;
+	obj->scaled = false;
+	obj->filter = SCALE_NEAREST;
 
 	return obj;
 }
@@ -112,12 +131,19 @@ static bool is_bitmap_icon(bitmap_t* bitmap)
 	if (!bitmap->single_channel)
 		return false;
 
-	if (bitmap->bitmap_data_width != BITMAP_BUFFER_8BPP && bitmap->bitmap_data_width != BITMAP_BUFFER_1BPP)
+	if (bitmap->bitmap_data_width != BITMAP_BUFFER_8BPP && bitmap->bitmap_data_width != BITMAP_BUFFER_8BPP_RLE
+			&& bitmap->bitmap_data_width != BITMAP_BUFFER_1BPP)
 		return false;
 
 	return true;
 }
 
+/* draw_bitmap_scaled blends 8BPP alpha, neither runs nor bits. */
+static bool is_scalable_icon(bitmap_t* bitmap)
+{
+	return bitmap->bitmap_data_width == BITMAP_BUFFER_8BPP;
+}
+
 void icon_set_bitmap(icon_t * obj, bitmap_t * bitmap)
 {
 	PTR_CHECK(obj, "icon");
@@ -128,8 +154,80 @@ void icon_set_bitmap(icon_t * obj, bitmap_t * bitmap)
 		return;
 	}
 
+	if (obj->scaled && !is_scalable_icon(bitmap))
+	{
+		LOG_ERROR("icon", "Only 8BPP icons can be resized");
+		return;
+	}
+
+	obj->levels = NULL;
+	if (obj->bitmap == bitmap)
+		return;
+
+	widget_invalidate(obj->glyph);
+
 	obj->bitmap = bitmap;
-	set_size(obj, bitmap->width, bitmap->height);
+	if (!obj->scaled)
+		set_size(obj, bitmap->width, bitmap->height);
+}
+
+void icon_set_size(icon_t * obj, dim_t width, dim_t height, enum e_scale_filter filter)
+{
+	PTR_CHECK(obj, "icon");
+
+	if (obj->bitmap && !is_scalable_icon(obj->bitmap))
+	{
+		LOG_ERROR("icon", "Only 8BPP icons can be resized");
+		return;
+	}
+
+	/* Resizing invalidates on its own. */
+	if (!obj->scaled || obj->filter != filter)
+		widget_invalidate(obj->glyph);
+
+	obj->scaled = true;
+	obj->filter = filter;
+	if (obj->levels)
+	{
+		bitmap_levels_t *levels = obj->levels;
+
+		icon_set_bitmap(obj, scale_pick_level(levels, width, height));
+		obj->levels = levels;
+	}
+	set_size(obj, width, height);
+}
+
+void icon_set_levels(icon_t * obj, bitmap_levels_t * levels)
+{
+	bitmap_t *bitmap;
+	uint32_t i;
+
+	PTR_CHECK(obj, "icon");
+	PTR_CHECK(levels, "icon");
+
+	if (levels->count == 0 || !is_bitmap_icon(levels->levels[0]))
+	{
+		LOG_ERROR("icon", "Selected levels are not an icon");
+		return;
+	}
+
+	/* Any of them may be stretched. */
+	for (i = 0; i < levels->count; i++)
+	{
+		if (!is_scalable_icon(levels->levels[i]))
+		{
+			LOG_ERROR("icon", "Only 8BPP icons can be resized");
+			return;
+		}
+	}
+
+	if (obj->scaled)
+		bitmap = scale_pick_level(levels, widget_area(obj->glyph)->width, widget_area(obj->glyph)->height);
+	else
+		bitmap = levels->levels[0];
+
+	icon_set_bitmap(obj, bitmap);
+	obj->levels = levels;
 }
 
 void icon_set_position(icon_t * obj, dim_t x, dim_t y)
@@ -143,6 +241,11 @@ void icon_set_color_html(icon_t * obj, const char *html_color_code)
 {
 	PTR_CHECK(obj, "icon");
 
+	if (!color_html_cache_update(obj->color_html, html_color_code))
+		return;
+
+	widget_invalidate(obj->glyph);
+
 	obj->color = color_html(html_color_code);
 }
 
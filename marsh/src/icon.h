@@ -30,6 +30,12 @@ void icon_delete(icon_t * const obj);
 void icon_set_position(icon_t * obj, dim_t x, dim_t y);
 void icon_set_color_html(icon_t * obj, const char *html_color_code);
 void icon_set_bitmap(icon_t * obj, bitmap_t * bitmap);
+/* Stretches the icon over width by height instead of drawing it at its own size,
+ * 8BPP ones only. */
+void icon_set_size(icon_t * obj, dim_t width, dim_t height, enum e_scale_filter filter);
+/* Draws the level icon_set_size picks, see scale_pick_level, at the size of the
+ * largest one until then. Every level must be 8BPP. */
+void icon_set_levels(icon_t * obj, bitmap_levels_t * levels);
 widget_t *icon_get_widget(const icon_t * obj);
 
 #endif /* ICON_H_ */
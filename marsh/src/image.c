@@ -24,17 +24,27 @@
 #include "helper/log.h"
 #include "color.h"
 #include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "pixel_format.h"
+#include "render_thread.h"
 #include "area.h"
 #include "canvas.h"
 #include "canvas.h"
 #include "widget.h"
+#include "widget_update.h"
 #include "image.h"
+#include "scale.h"
 #include "bitmap_data/bitmap_data.h"
 
 
 struct s_image_instance
 {
 	bitmap_t *bitmap;
+	/* The bitmap in the framebuffer format, see pixel_format_bitmap_new. */
+	bitmap_t *native;
+	bitmap_levels_t *levels;
+	bool scaled;
+	enum e_scale_filter filter;
 
 	my_log_t * log;
 	widget_t *glyph;
@@ -45,7 +55,7 @@ static bool ready_to_draw(image_t * obj)
 	if (!area_value(widget_area(obj->glyph)))
 		return false;
 
-	if (obj->bitmap == NULL)
+	if (obj->native == NULL)
 		return false;
 
 	return true;
@@ -61,13 +71,27 @@ static void draw(image_t * obj, const area_t * limiting_canvas_area)
 		return;
 	}
 
-	area_t canvas_area = widget_compute_canvas_area(obj->glyph, limiting_canvas_area);
-	canvas_t *canv = canvas_new(&canvas_area);
+	const area_t *area = widget_area(obj->glyph);
+	canvas_t *canv = canvas_new_clipped(area, limiting_canvas_area);
 
 
-	if (obj->bitmap->bitmap_data_width == BITMAP_BUFFER_16BPP)
+	/* A level of the drawn size is blitted. */
+	if (obj->scaled && ((uint32_t)area->width != obj->native->width || (uint32_t)area->height != obj->native->height))
 	{
-		draw_bitmap(canv, (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 0, 0, obj->bitmap->width, obj->bitmap->height);
+		draw_bitmap_scaled(canv, obj->native, 0, 0, 0, area->width, area->height, obj->filter);
+	}
+	else if (obj->native->bitmap_data_width == BITMAP_BUFFER_16BPP)
+	{
+		draw_bitmap(canv, (BUFFER_PTR_RDOLY)obj->native->bitmap, 0, 0, obj->native->width, obj->native->height);
+	}
+	else if (obj->native->bitmap_data_width == BITMAP_BUFFER_NATIVE)
+	{
+		draw_bitmap_native(canv, (const pixel_t *)obj->native->bitmap, 0, 0, obj->native->width, obj->native->height);
+	}
+	else if (obj->native->bitmap_data_width == BITMAP_BUFFER_INDEXED4 || obj->native->bitmap_data_width == BITMAP_BUFFER_INDEXED8)
+	{
+		draw_bitmap_indexed(canv, (BUFFER_PTR_RDOLY)obj->native->bitmap, obj->native->bitmap_data_width == BITMAP_BUFFER_INDEXED4 ? 4 : 8,
+				obj->native->palette, 0, 0, obj->native->width, obj->native->height);
 	}
 	else
 	{
@@ -85,14 +109,32 @@ image_t * image_new(widget_t * parent)
 	obj->log = my_log_new("image", MESSAGE);
 	obj->glyph = widget_new(parent, obj, (void(*)(void *, const area_t *))draw, (void(*)(void *))image_delete);
 	obj->bitmap = NULL;
+	obj->native = NULL;
+	obj->levels = NULL;
+	obj->scaled = false;
+	obj->filter = SCALE_NEAREST;
 
 	return obj;
 }
 
+/* Queued operations and frames the render thread has yet to draw may still read a
+ * converted copy. */
+static void release_native(image_t * obj)
+{
+	if (obj->native == obj->bitmap)
+		return;
+
+	if (render_thread_running())
+		render_thread_flush();
+	framebuffer_ops_sync();
+	pixel_format_bitmap_delete(obj->bitmap, obj->native);
+}
+
 void image_delete(image_t * const obj)
 {
 	PTR_CHECK(obj, "image");
 
+	release_native(obj);
 	my_log_delete(obj->log);
 	widget_delete_instance_only(obj->glyph);
 
@@ -124,8 +166,59 @@ void image_set_bitmap(image_t * obj, bitmap_t * bitmap)
 		return;
 	}
 
+	obj->levels = NULL;
+	if (obj->bitmap == bitmap)
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	release_native(obj);
 	obj->bitmap = bitmap;
-	set_size(obj, bitmap->width, bitmap->height);
+	obj->native = pixel_format_bitmap_new(bitmap);
+	if (!obj->scaled)
+		set_size(obj, bitmap->width, bitmap->height);
+}
+
+void image_set_levels(image_t * obj, bitmap_levels_t * levels)
+{
+	bitmap_t *bitmap;
+
+	PTR_CHECK(obj, "image");
+	PTR_CHECK(levels, "image");
+
+	if (levels->count == 0 || !is_bitmap_image(levels->levels[0]))
+	{
+		LOG_ERROR("image", "Selected levels are not an image");
+		return;
+	}
+
+	if (obj->scaled)
+		bitmap = scale_pick_level(levels, widget_area(obj->glyph)->width, widget_area(obj->glyph)->height);
+	else
+		bitmap = levels->levels[0];
+
+	image_set_bitmap(obj, bitmap);
+	obj->levels = levels;
+}
+
+void image_set_size(image_t * obj, dim_t width, dim_t height, enum e_scale_filter filter)
+{
+	PTR_CHECK(obj, "image");
+
+	/* Resizing invalidates on its own. */
+	if (!obj->scaled || obj->filter != filter)
+		widget_invalidate(obj->glyph);
+
+	obj->scaled = true;
+	obj->filter = filter;
+	if (obj->levels)
+	{
+		bitmap_levels_t *levels = obj->levels;
+
+		image_set_bitmap(obj, scale_pick_level(levels, width, height));
+		obj->levels = levels;
+	}
+	set_size(obj, width, height);
 }
 
 void image_set_position(image_t * obj, dim_t x, dim_t y)
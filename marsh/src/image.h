@@ -29,6 +29,12 @@ image_t * image_new(widget_t * parent);
 void image_delete(image_t * const obj);
 void image_set_position(image_t * obj, dim_t x, dim_t y);
 void image_set_bitmap(image_t * obj, bitmap_t * bitmap);
+/* Stretches the bitmap over width by height, thumbnails or zooms, instead of drawing
+ * it at its own size. */
+void image_set_size(image_t * obj, dim_t width, dim_t height, enum e_scale_filter filter);
+/* Draws the level image_set_size picks, see scale_pick_level, at the size of the
+ * largest one until then. */
+void image_set_levels(image_t * obj, bitmap_levels_t * levels);
 widget_t *image_get_widget(image_t * const obj);
 
 #endif /* IMAGE_H_ */
@@ -0,0 +1,451 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "helper/checks.h"
+#include "helper/number.h"
+#include "helper/log.h"
+
+#include "list_view.h"
+#include "scroll_view.h"
+#include "signalslot.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+
+struct s_list_row
+{
+	widget_t * widget;
+	size_t index;
+	bool bound;
+};
+
+struct s_list_view
+{
+	void * user;
+	list_view_create_row_f create_row;
+	list_view_bind_row_f bind_row;
+	list_view_row_height_f row_height_f;
+	dim_t row_height;
+
+	size_t item_count;
+	dim_t content_height;
+	/* Offset of every LIST_VIEW_OFFSET_STRIDE-th item, variable height only. */
+	dim_t * offsets;
+
+	struct s_list_row * rows;
+	size_t row_count;
+
+	scroll_view_t * scroll;
+	slot_t * scroll_slot;
+	widget_t * glyph;
+};
+
+static bool ready(const list_view_t * obj)
+{
+	if (!obj->item_count || !obj->create_row || !obj->bind_row)
+		return false;
+
+	return obj->row_height_f || obj->row_height > 0;
+}
+
+static dim_t item_height(const list_view_t * obj, size_t index)
+{
+	if (obj->row_height_f)
+		return obj->row_height_f(obj->user, index);
+
+	return obj->row_height;
+}
+
+static void build_offsets(list_view_t * obj)
+{
+	dim_t offset = 0;
+	size_t i;
+
+	free(obj->offsets);
+	obj->offsets = NULL;
+
+	if (!obj->row_height_f)
+	{
+		obj->content_height = (dim_t)obj->item_count * obj->row_height;
+		return;
+	}
+
+	obj->offsets = (dim_t *)malloc((obj->item_count / LIST_VIEW_OFFSET_STRIDE + 1) * sizeof(dim_t));
+	MEMORY_ALLOC_CHECK(obj->offsets);
+
+	for (i = 0; i <= obj->item_count; i++)
+	{
+		if (i % LIST_VIEW_OFFSET_STRIDE == 0)
+			obj->offsets[i / LIST_VIEW_OFFSET_STRIDE] = offset;
+		if (i < obj->item_count)
+			offset += obj->row_height_f(obj->user, i);
+	}
+
+	obj->content_height = offset;
+}
+
+static void release_rows(list_view_t * obj, size_t first, size_t last)
+{
+	size_t i;
+
+	for (i = 0; i < obj->row_count; i++)
+	{
+		if (obj->rows[i].bound && (obj->rows[i].index < first || obj->rows[i].index > last))
+		{
+			obj->rows[i].bound = false;
+			widget_hide(obj->rows[i].widget);
+		}
+	}
+}
+
+static void release_all_rows(list_view_t * obj)
+{
+	size_t i;
+
+	for (i = 0; i < obj->row_count; i++)
+	{
+		if (obj->rows[i].bound)
+		{
+			obj->rows[i].bound = false;
+			widget_hide(obj->rows[i].widget);
+		}
+	}
+}
+
+static struct s_list_row * take_row(list_view_t * obj)
+{
+	struct s_list_row * rows;
+	widget_t * widget;
+	size_t i;
+
+	for (i = 0; i < obj->row_count; i++)
+		if (!obj->rows[i].bound)
+			return &obj->rows[i];
+
+	rows = (struct s_list_row *)realloc(obj->rows, (obj->row_count + 1) * sizeof(struct s_list_row));
+	MEMORY_ALLOC_CHECK_RETURN(rows, NULL);
+	obj->rows = rows;
+
+	widget = obj->create_row(obj->user, scroll_view_get_widget(obj->scroll));
+	if (!widget)
+	{
+		LOG_ERROR("list_view", "create row callback returned no widget");
+		return NULL;
+	}
+
+	obj->rows[obj->row_count].widget = widget;
+	obj->rows[obj->row_count].bound = false;
+
+	return &obj->rows[obj->row_count++];
+}
+
+/* Moves the row with its contents to the item place, then lets the client fill it. */
+static void bind(list_view_t * obj, struct s_list_row * row, size_t index)
+{
+	const area_t * view = widget_area(obj->glyph);
+	const area_t * area = widget_area(row->widget);
+	dim_t x = view->x;
+	dim_t y = view->y + list_view_item_offset(obj, index) - list_view_offset(obj);
+
+	widget_tree_translate_children(row->widget, x - area->x, y - area->y);
+	widget_set_area(row->widget, x, y, view->width, item_height(obj, index));
+	widget_show(row->widget);
+
+	row->index = index;
+	row->bound = true;
+
+	obj->bind_row(obj->user, row->widget, index);
+}
+
+static void layout(list_view_t * obj)
+{
+	dim_t offset = list_view_offset(obj);
+	size_t first, last, i;
+	struct s_list_row * row;
+
+	if (!ready(obj))
+	{
+		release_all_rows(obj);
+		return;
+	}
+
+	first = list_view_item_at(obj, offset);
+	last = list_view_item_at(obj, offset + get_bigger(widget_area(obj->glyph)->height, 1) - 1);
+
+	first = first > LIST_VIEW_MARGIN_ROWS ? first - LIST_VIEW_MARGIN_ROWS : 0;
+	last = last + LIST_VIEW_MARGIN_ROWS < obj->item_count ? last + LIST_VIEW_MARGIN_ROWS : obj->item_count - 1;
+
+	release_rows(obj, first, last);
+
+	for (i = first; i <= last; i++)
+	{
+		if (list_view_item_row(obj, i))
+			continue;
+
+		row = take_row(obj);
+		if (!row)
+			return;
+
+		bind(obj, row, i);
+	}
+}
+
+static void rebuild(list_view_t * obj)
+{
+	build_offsets(obj);
+	release_all_rows(obj);
+	/* May scroll back into the content, which lays out through the scroll signal. */
+	scroll_view_set_content_size(obj->scroll, widget_area(obj->glyph)->width, obj->content_height);
+	layout(obj);
+	widget_invalidate(obj->glyph);
+}
+
+list_view_t * list_view_new(widget_t * parent)
+{
+	list_view_t * obj = (list_view_t *)calloc(1, sizeof(struct s_list_view));
+	MEMORY_ALLOC_CHECK_RETURN(obj, NULL);
+
+	obj->glyph = widget_new(parent, obj, NULL, (void(*)(void *))list_view_delete);
+	obj->scroll = scroll_view_new(obj->glyph);
+
+	obj->scroll_slot = slot_new();
+	slot_set(obj->scroll_slot, (slot_func)layout, obj);
+	slot_connect(obj->scroll_slot, scroll_view_scroll_signal(obj->scroll));
+
+	return obj;
+}
+
+/* As any widget, rows and the inner scroll view are deleted with widget_tree_delete. */
+void list_view_delete(list_view_t * obj)
+{
+	PTR_CHECK(obj, "list_view");
+
+	widget_delete_instance_only(obj->glyph);
+	slot_delete(obj->scroll_slot);
+	free(obj->offsets);
+	free(obj->rows);
+
+	free(obj);
+}
+
+void list_view_set_position(list_view_t * obj, dim_t x, dim_t y)
+{
+	PTR_CHECK(obj, "list_view");
+
+	/* Moves the rows along. */
+	scroll_view_set_position(obj->scroll, x, y);
+	widget_set_pos(obj->glyph, x, y);
+}
+
+void list_view_set_size(list_view_t * obj, dim_t width, dim_t height)
+{
+	PTR_CHECK(obj, "list_view");
+
+	widget_set_dim(obj->glyph, width, height);
+	scroll_view_set_size(obj->scroll, width, height);
+	rebuild(obj);
+}
+
+void list_view_set_background_color_html(list_view_t * obj, const char * html_color_code)
+{
+	PTR_CHECK(obj, "list_view");
+
+	scroll_view_set_background_color_html(obj->scroll, html_color_code);
+}
+
+void list_view_set_adapter(list_view_t * obj, void * user, list_view_create_row_f create_row, list_view_bind_row_f bind_row)
+{
+	PTR_CHECK(obj, "list_view");
+
+	if (obj->row_count && create_row != obj->create_row)
+	{
+		LOG_ERROR("list_view", "row factory can't change once rows exist");
+		return;
+	}
+
+	obj->user = user;
+	obj->create_row = create_row;
+	obj->bind_row = bind_row;
+	rebuild(obj);
+}
+
+void list_view_set_row_height(list_view_t * obj, dim_t height)
+{
+	PTR_CHECK(obj, "list_view");
+
+	obj->row_height_f = NULL;
+	obj->row_height = height;
+	rebuild(obj);
+}
+
+void list_view_set_variable_row_height(list_view_t * obj, list_view_row_height_f row_height)
+{
+	PTR_CHECK(obj, "list_view");
+
+	obj->row_height_f = row_height;
+	rebuild(obj);
+}
+
+void list_view_set_item_count(list_view_t * obj, size_t count)
+{
+	PTR_CHECK(obj, "list_view");
+
+	obj->item_count = count;
+	rebuild(obj);
+}
+
+size_t list_view_item_count(const list_view_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "list_view", 0);
+
+	return obj->item_count;
+}
+
+void list_view_refresh_item(list_view_t * obj, size_t index)
+{
+	widget_t * row;
+
+	PTR_CHECK(obj, "list_view");
+
+	row = list_view_item_row(obj, index);
+	if (row)
+		obj->bind_row(obj->user, row, index);
+}
+
+void list_view_scroll_to(list_view_t * obj, dim_t y)
+{
+	PTR_CHECK(obj, "list_view");
+
+	scroll_view_scroll_to(obj->scroll, 0, y);
+}
+
+void list_view_scroll_by(list_view_t * obj, dim_t dy)
+{
+	PTR_CHECK(obj, "list_view");
+
+	scroll_view_scroll_by(obj->scroll, 0, dy);
+}
+
+void list_view_scroll_to_item(list_view_t * obj, size_t index)
+{
+	PTR_CHECK(obj, "list_view");
+
+	scroll_view_scroll_to(obj->scroll, 0, list_view_item_offset(obj, index));
+}
+
+void list_view_fling(list_view_t * obj, int32_t velocity)
+{
+	PTR_CHECK(obj, "list_view");
+
+	scroll_view_fling(obj->scroll, 0, velocity);
+}
+
+dim_t list_view_offset(const list_view_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "list_view", 0);
+
+	return scroll_view_offset(obj->scroll).y;
+}
+
+dim_t list_view_item_offset(const list_view_t * obj, size_t index)
+{
+	dim_t offset;
+	size_t i;
+
+	PTR_CHECK_RETURN(obj, "list_view", 0);
+
+	if (index >= obj->item_count)
+		return obj->content_height;
+
+	if (!obj->row_height_f)
+		return (dim_t)index * obj->row_height;
+
+	offset = obj->offsets[index / LIST_VIEW_OFFSET_STRIDE];
+	for (i = index - index % LIST_VIEW_OFFSET_STRIDE; i < index; i++)
+		offset += obj->row_height_f(obj->user, i);
+
+	return offset;
+}
+
+size_t list_view_item_at(const list_view_t * obj, dim_t y)
+{
+	size_t low, high, middle, index;
+	dim_t offset, height;
+
+	PTR_CHECK_RETURN(obj, "list_view", 0);
+
+	if (!ready(obj) || y <= 0)
+		return 0;
+
+	if (!obj->row_height_f)
+		return get_smaller((size_t)(y / obj->row_height), obj->item_count - 1);
+
+	/* Last indexed offset at or before y, then walk its stride. */
+	low = 0;
+	high = (obj->item_count - 1) / LIST_VIEW_OFFSET_STRIDE;
+	while (low < high)
+	{
+		middle = (low + high + 1) / 2;
+		if (obj->offsets[middle] <= y)
+			low = middle;
+		else
+			high = middle - 1;
+	}
+
+	index = low * LIST_VIEW_OFFSET_STRIDE;
+	offset = obj->offsets[low];
+	for (; index + 1 < obj->item_count; index++)
+	{
+		height = obj->row_height_f(obj->user, index);
+		if (offset + height > y)
+			break;
+		offset += height;
+	}
+
+	return index;
+}
+
+widget_t * list_view_item_row(const list_view_t * obj, size_t index)
+{
+	size_t i;
+
+	PTR_CHECK_RETURN(obj, "list_view", NULL);
+
+	for (i = 0; i < obj->row_count; i++)
+		if (obj->rows[i].bound && obj->rows[i].index == index)
+			return obj->rows[i].widget;
+
+	return NULL;
+}
+
+size_t list_view_row_count(const list_view_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "list_view", 0);
+
+	return obj->row_count;
+}
+
+widget_t * list_view_get_widget(list_view_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "list_view", NULL);
+
+	return obj->glyph;
+}
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef LIST_VIEW_H_
+#define LIST_VIEW_H_
+
+#include "types.h"
+
+/*
+ * List view shows a scrollable list of items, instantiating row widgets only for the
+ * items in its viewport plus a few rows of margin on each side. Rows scrolled out are
+ * recycled: the bind callback refills them with the data of their new item, so the
+ * widget count, memory and draw cost do not depend on the number of items.
+ *
+ * Rows are created by the create callback as children of the given parent, and are
+ * placed by the list view before being bound. The bind callback lays out the row
+ * contents relative to widget_area(row).
+ *
+ * Rows are either of a fixed height, or of a height given per item. In the latter
+ * case the list keeps an index of the offset of every LIST_VIEW_OFFSET_STRIDE-th
+ * item, rebuilt by list_view_set_item_count.
+ */
+
+#define LIST_VIEW_MARGIN_ROWS   2
+#define LIST_VIEW_OFFSET_STRIDE 64
+
+typedef widget_t * (*list_view_create_row_f)(void * user, widget_t * parent);
+typedef void (*list_view_bind_row_f)(void * user, widget_t * row, size_t index);
+typedef dim_t (*list_view_row_height_f)(void * user, size_t index);
+
+list_view_t * list_view_new(widget_t * parent);
+void list_view_delete(list_view_t * obj);
+
+void list_view_set_position(list_view_t * obj, dim_t x, dim_t y);
+void list_view_set_size(list_view_t * obj, dim_t width, dim_t height);
+void list_view_set_background_color_html(list_view_t * obj, const char * html_color_code);
+
+void list_view_set_adapter(list_view_t * obj, void * user, list_view_create_row_f create_row, list_view_bind_row_f bind_row);
+void list_view_set_row_height(list_view_t * obj, dim_t height);
+void list_view_set_variable_row_height(list_view_t * obj, list_view_row_height_f row_height);
+
+/* Items are assumed to have all changed, visible rows are bound again. */
+void list_view_set_item_count(list_view_t * obj, size_t count);
+size_t list_view_item_count(const list_view_t * obj);
+/* Binds the item again if it has a row, its height must not have changed. */
+void list_view_refresh_item(list_view_t * obj, size_t index);
+
+void list_view_scroll_to(list_view_t * obj, dim_t y);
+void list_view_scroll_by(list_view_t * obj, dim_t dy);
+void list_view_scroll_to_item(list_view_t * obj, size_t index);
+void list_view_fling(list_view_t * obj, int32_t velocity);
+dim_t list_view_offset(const list_view_t * obj);
+
+dim_t list_view_item_offset(const list_view_t * obj, size_t index);
+size_t list_view_item_at(const list_view_t * obj, dim_t y);
+/* Row bound to the item, or NULL if it is out of the viewport and margin. */
+widget_t * list_view_item_row(const list_view_t * obj, size_t index);
+size_t list_view_row_count(const list_view_t * obj);
+
+widget_t * list_view_get_widget(list_view_t * obj);
+
+#endif /* LIST_VIEW_H_ */
@@ -0,0 +1,294 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "helper/checks.h"
+#include "helper/log.h"
+#include "helper/thread_pool.h"
+
+#include "area.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "parallel_draw.h"
+#include "widget.h"
+#include "widget_private.h"
+#include "widget_tree.h"
+
+static struct
+{
+	thread_pool_t * pool;
+	/* A section is being drawn, nested levels go serially. */
+	bool drawing;
+
+	/* Sibling level being split, sized for the widest so far. */
+	widget_t ** children;
+	area_t * areas;
+	size_t * roots;
+	size_t * batch_of;
+	size_t * members;
+	size_t * batch_start;
+	size_t capacity;
+
+	size_t batch_count;
+	size_t next_batch;
+	int (*commit)(widget_t *, event_t *, int);
+	event_t * event;
+	int propagation_mask;
+	uint64_t busy_ns;
+
+	parallel_draw_stats_t stats;
+} parallel;
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static bool reserve(size_t count)
+{
+	size_t capacity = parallel.capacity ? parallel.capacity : 8;
+	widget_t ** children;
+	area_t * areas;
+	size_t * roots, * batch_of, * members, * batch_start;
+
+	if (count <= parallel.capacity)
+		return true;
+
+	while (capacity < count)
+		capacity *= 2;
+
+	children = (widget_t **)realloc(parallel.children, capacity * sizeof(widget_t *));
+	if (children)
+		parallel.children = children;
+	areas = (area_t *)realloc(parallel.areas, capacity * sizeof(area_t));
+	if (areas)
+		parallel.areas = areas;
+	roots = (size_t *)realloc(parallel.roots, capacity * sizeof(size_t));
+	if (roots)
+		parallel.roots = roots;
+	batch_of = (size_t *)realloc(parallel.batch_of, capacity * sizeof(size_t));
+	if (batch_of)
+		parallel.batch_of = batch_of;
+	members = (size_t *)realloc(parallel.members, capacity * sizeof(size_t));
+	if (members)
+		parallel.members = members;
+	batch_start = (size_t *)realloc(parallel.batch_start, (capacity + 1) * sizeof(size_t));
+	if (batch_start)
+		parallel.batch_start = batch_start;
+
+	MEMORY_ALLOC_CHECK_RETURN(children && areas && roots && batch_of && members && batch_start, false);
+	parallel.capacity = capacity;
+
+	return true;
+}
+
+static size_t find(size_t i)
+{
+	while (parallel.roots[i] != i)
+	{
+		parallel.roots[i] = parallel.roots[parallel.roots[i]];
+		i = parallel.roots[i];
+	}
+
+	return i;
+}
+
+/* Groups the children overlapping directly or through others into batches, keeping
+ * sibling order inside each. Returns the batches with something to draw. */
+static size_t split(size_t count)
+{
+	size_t i, j, drawing = 0;
+
+	for (i = 0; i < count; i++)
+		parallel.roots[i] = i;
+
+	for (i = 0; i < count; i++)
+		for (j = i + 1; j < count; j++)
+			if (area_intersects(&parallel.areas[i], &parallel.areas[j]) && find(i) != find(j))
+				parallel.roots[find(j)] = find(i);
+
+	parallel.batch_count = 0;
+	for (i = 0; i < count; i++)
+	{
+		if (find(i) != i)
+			continue;
+
+		parallel.batch_of[i] = parallel.batch_count++;
+		if (area_value(&parallel.areas[i]))
+			drawing++;
+	}
+
+	memset(parallel.batch_start, 0, (parallel.batch_count + 1) * sizeof(size_t));
+	for (i = 0; i < count; i++)
+	{
+		parallel.batch_of[i] = parallel.batch_of[find(i)];
+		parallel.batch_start[parallel.batch_of[i] + 1]++;
+	}
+	for (i = 0; i < parallel.batch_count; i++)
+		parallel.batch_start[i + 1] += parallel.batch_start[i];
+
+	/* Done with the roots, they become the fill cursor of each batch. */
+	for (i = 0; i < parallel.batch_count; i++)
+		parallel.roots[i] = parallel.batch_start[i];
+	for (i = 0; i < count; i++)
+		parallel.members[parallel.roots[parallel.batch_of[i]]++] = i;
+
+	return drawing;
+}
+
+static void draw_batches(void * context, size_t thread)
+{
+	size_t batch, i;
+	uint64_t start;
+
+	(void)context;
+	(void)thread;
+
+	while ((batch = __atomic_fetch_add(&parallel.next_batch, 1, __ATOMIC_RELAXED)) < parallel.batch_count)
+	{
+		start = now_ns();
+
+		for (i = parallel.batch_start[batch]; i < parallel.batch_start[batch + 1]; i++)
+			parallel.commit(parallel.children[parallel.members[i]], parallel.event, parallel.propagation_mask);
+
+		__atomic_add_fetch(&parallel.busy_ns, now_ns() - start, __ATOMIC_RELAXED);
+	}
+}
+
+bool parallel_draw_children(widget_t * parent, int (*commit)(widget_t *, event_t *, int), event_t * event, int propagation_mask)
+{
+	const area_t * clip;
+	widget_t * child;
+	size_t count, drawing;
+	uint64_t start;
+
+	if (!parallel.pool || parallel.drawing || !framebuffer_ops_reentrant())
+		return false;
+
+	if (!(propagation_mask & event_prop_persistent) || (propagation_mask & (event_prop_bottom_up | event_prop_right_to_left)))
+		return false;
+
+	count = widget_num_of_children(parent);
+	if (count < 2 || !reserve(count))
+		return false;
+
+	clip = (const area_t *)event_data(event);
+
+	for (count = 0, child = widget_child(parent); child; child = widget_right_sibling(child), count++)
+	{
+		parallel.children[count] = child;
+
+		if (!widget_visible(child))
+		{
+			area_clear(&parallel.areas[count]);
+			continue;
+		}
+
+		parallel.areas[count] = widget_compute_canvas_area(child, &parent->tmp_canvas_area);
+		if (clip)
+			area_set_intersection(&parallel.areas[count], &parallel.areas[count], clip);
+	}
+
+	drawing = split(count);
+	if (drawing < 2)
+		return false;
+
+	parallel.commit = commit;
+	parallel.event = event;
+	parallel.propagation_mask = propagation_mask;
+	parallel.next_batch = 0;
+	parallel.busy_ns = 0;
+	parallel.drawing = true;
+
+	start = now_ns();
+	thread_pool_run(parallel.pool, draw_batches, NULL);
+
+	parallel.drawing = false;
+	parallel.stats.wall_ns += now_ns() - start;
+	parallel.stats.busy_ns += parallel.busy_ns;
+	parallel.stats.sections++;
+	parallel.stats.batches += (uint32_t)drawing;
+	if (drawing > parallel.stats.widest)
+		parallel.stats.widest = (uint32_t)drawing;
+
+	return true;
+}
+
+void parallel_draw_start(size_t threads)
+{
+	if (parallel.pool)
+		return;
+
+	parallel.pool = thread_pool_new(threads);
+	memset(&parallel.stats, 0, sizeof(parallel.stats));
+}
+
+void parallel_draw_stop(void)
+{
+	if (!parallel.pool)
+		return;
+
+	thread_pool_delete(parallel.pool);
+	parallel.pool = NULL;
+
+	free(parallel.children);
+	free(parallel.areas);
+	free(parallel.roots);
+	free(parallel.batch_of);
+	free(parallel.members);
+	free(parallel.batch_start);
+	parallel.children = NULL;
+	parallel.areas = NULL;
+	parallel.roots = NULL;
+	parallel.batch_of = NULL;
+	parallel.members = NULL;
+	parallel.batch_start = NULL;
+	parallel.capacity = 0;
+}
+
+bool parallel_draw_running(void)
+{
+	return parallel.pool != NULL;
+}
+
+size_t parallel_draw_threads(void)
+{
+	return parallel.pool ? thread_pool_threads(parallel.pool) : 0;
+}
+
+void parallel_draw_stats(parallel_draw_stats_t * tgt)
+{
+	PTR_CHECK(tgt, "parallel_draw");
+
+	*tgt = parallel.stats;
+}
+
+void parallel_draw_reset_stats(void)
+{
+	memset(&parallel.stats, 0, sizeof(parallel.stats));
+}
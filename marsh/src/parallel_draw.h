@@ -0,0 +1,54 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PARALLEL_DRAW_H_
+#define PARALLEL_DRAW_H_
+
+#include "types.h"
+
+/*
+ * Opt-in concurrent drawing of sibling subtrees. While running, a draw event reaching
+ * a widget splits its children by their clipped canvas areas: siblings overlapping
+ * each other, directly or through others, form a batch drawn serially in sibling
+ * order, and batches, which never overlap, are drawn concurrently by the thread pool.
+ * The first level with two batches or more is split, deeper levels of a batch are
+ * drawn serially. The result is the one of the painter's order.
+ *
+ * Widget draws must only write inside their canvas, and the software framebuffer
+ * operations must be installed, the other tables are not reentrant: with them,
+ * children are drawn serially.
+ */
+
+void parallel_draw_start(size_t threads);
+void parallel_draw_stop(void);
+bool parallel_draw_running(void);
+size_t parallel_draw_threads(void);
+
+/* Accumulated since start or the last reset, reset it each frame to get per frame
+ * figures. */
+void parallel_draw_stats(parallel_draw_stats_t * tgt);
+void parallel_draw_reset_stats(void);
+
+/* For widget_event: draws parent's children through commit, returns false when they
+ * are to be drawn serially instead. */
+bool parallel_draw_children(widget_t * parent, int (*commit)(widget_t *, event_t *, int), event_t * event, int propagation_mask);
+
+#endif /* PARALLEL_DRAW_H_ */
@@ -0,0 +1,764 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "helper/checks.h"
+#include "helper/number.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "canvas.h"
+#include "color.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "path_rasterizer.h"
+
+#define FIXED_HALF (PATH_FIXED_ONE / 2)
+
+/* Rows of blended coverage queued before the first is written again. */
+#define COVERAGE_ROWS 32
+
+#define SPAN_MIN (INT32_MIN / 4)
+#define SPAN_MAX (INT32_MAX / 4)
+
+struct s_edge
+{
+	int32_t x0;
+	int32_t y0;
+	int32_t y1;
+	int64_t slope; // Q16 x increment per fixed point y.
+	int32_t dir;
+};
+
+/* Pixel columns [lo, hi). */
+struct s_interval
+{
+	dim_t lo;
+	dim_t hi;
+};
+
+struct s_crossing
+{
+	int32_t x;
+	int32_t dir;
+};
+
+/* Clip in fixed point. */
+struct s_bounds
+{
+	int32_t left, top, right, bottom;
+};
+
+struct s_scan
+{
+	const canvas_t *canv;
+	pixel_t color;
+	struct s_bounds bounds;
+
+	/* Anti-aliasing coverage of the current row, indexed from the clip left, and
+	 * COVERAGE_ROWS alpha rows the queued blends read. */
+	uint16_t *coverage;
+	uint8_t *alpha;
+	dim_t width;
+	dim_t alpha_row;
+	dim_t touched_min;
+	dim_t touched_max;
+};
+
+static int edge_compare(const void *first, const void *second)
+{
+	const struct s_edge *a = (const struct s_edge *)first;
+	const struct s_edge *b = (const struct s_edge *)second;
+
+	return (a->y0 > b->y0) - (a->y0 < b->y0);
+}
+
+static size_t add_edge(struct s_edge *edges, size_t count, const struct s_bounds *bounds, fixed_point_t a, fixed_point_t b)
+{
+	fixed_point_t swap;
+	int32_t dir = 1;
+
+	if (a.y == b.y)
+		return count;
+
+	if (a.y > b.y)
+	{
+		swap = a;
+		a = b;
+		b = swap;
+		dir = -1;
+	}
+
+	if (b.y <= bounds->top || a.y >= bounds->bottom)
+		return count;
+
+	/* Outside the clip only the winding matters, a span may end there. */
+	if (a.x < bounds->left && b.x < bounds->left)
+	{
+		a.x = bounds->left;
+		b.x = bounds->left;
+	}
+	else if (a.x >= bounds->right && b.x >= bounds->right)
+	{
+		a.x = bounds->right;
+		b.x = bounds->right;
+	}
+
+	edges[count].x0 = a.x;
+	edges[count].y0 = a.y;
+	edges[count].y1 = b.y;
+	edges[count].slope = ((int64_t)(b.x - a.x) << 16) / (b.y - a.y);
+	edges[count].dir = dir;
+
+	return count + 1;
+}
+
+static void solid_span(struct s_scan *scan, dim_t y, int32_t xa, int32_t xb)
+{
+	/* Pixels whose centers are in [xa, xb). */
+	dim_t start = (xa - FIXED_HALF + PATH_FIXED_ONE - 1) >> PATH_FIXED_SHIFT;
+	dim_t end = (xb - FIXED_HALF + PATH_FIXED_ONE - 1) >> PATH_FIXED_SHIFT;
+
+	if (end > start)
+		draw_fill_area(scan->canv, scan->color, start, y, end - start, 1);
+}
+
+/* Adds the exact coverage of [xa, xb) on one sample line, PATH_FIXED_ONE per full pixel. */
+static void coverage_span(struct s_scan *scan, int32_t xa, int32_t xb)
+{
+	dim_t left = scan->bounds.left >> PATH_FIXED_SHIFT;
+	dim_t first = (xa >> PATH_FIXED_SHIFT) - left;
+	dim_t last = ((xb - 1) >> PATH_FIXED_SHIFT) - left;
+	dim_t i;
+
+	if (xb <= xa)
+		return;
+
+	scan->touched_min = get_smaller(scan->touched_min, first);
+	scan->touched_max = get_bigger(scan->touched_max, last);
+
+	if (first == last)
+	{
+		scan->coverage[first] += xb - xa;
+		return;
+	}
+
+	scan->coverage[first] += PATH_FIXED_ONE - (xa & (PATH_FIXED_ONE - 1));
+	for (i = first + 1; i < last; i++)
+		scan->coverage[i] += PATH_FIXED_ONE;
+	scan->coverage[last] += xb - ((last + left) << PATH_FIXED_SHIFT);
+}
+
+/* Writes the row through the blend kernel, full coverage is written as is. */
+static void flush_coverage(struct s_scan *scan, dim_t y)
+{
+	dim_t left = scan->bounds.left >> PATH_FIXED_SHIFT;
+	uint8_t *alpha;
+	dim_t i;
+
+	if (scan->touched_min > scan->touched_max)
+		return;
+
+	/* Queued blends may still read the rows about to be reused. */
+	if (scan->alpha_row == COVERAGE_ROWS)
+	{
+		framebuffer_ops_sync();
+		scan->alpha_row = 0;
+	}
+	alpha = scan->alpha + scan->alpha_row++ * scan->width;
+
+	for (i = scan->touched_min; i <= scan->touched_max; i++)
+	{
+		alpha[i] = (uint8_t)((scan->coverage[i] * 0xFF) / (PATH_FIXED_ONE * PATH_SUBSAMPLES));
+		scan->coverage[i] = 0;
+	}
+
+	draw_alpha_bitmap_8bpp(scan->canv, scan->color, alpha + scan->touched_min, left + scan->touched_min, y,
+			scan->touched_max - scan->touched_min + 1, 1);
+
+	scan->touched_min = INT32_MAX;
+	scan->touched_max = INT32_MIN;
+}
+
+static bool inside(enum e_fill_rule rule, int32_t winding)
+{
+	switch (rule)
+	{
+	case FILL_EVEN_ODD:
+		return winding & 1;
+	case FILL_NONZERO:
+	default:
+		return winding != 0;
+	}
+}
+
+static void rasterize(struct s_scan *scan, struct s_edge *edges, size_t edge_count, enum e_fill_rule rule, bool anti_alias)
+{
+	struct s_crossing *crossings;
+	struct s_crossing crossing;
+	struct s_edge **active;
+	size_t active_count = 0, next = 0, i, j;
+	int32_t top, bottom, sy, winding, span_start;
+	bool was_inside;
+	uint32_t samples = anti_alias ? PATH_SUBSAMPLES : 1;
+	uint32_t s;
+	dim_t y;
+
+	if (!edge_count)
+		return;
+
+	qsort(edges, edge_count, sizeof(struct s_edge), edge_compare);
+
+	top = get_bigger(scan->bounds.top, edges[0].y0);
+	bottom = scan->bounds.top;
+	for (i = 0; i < edge_count; i++)
+		bottom = get_bigger(bottom, edges[i].y1);
+	bottom = get_smaller(bottom, scan->bounds.bottom);
+
+	active = (struct s_edge **)malloc(edge_count * sizeof(struct s_edge *));
+	crossings = (struct s_crossing *)malloc(edge_count * sizeof(struct s_crossing));
+	if (!active || !crossings)
+	{
+		LOG_ERROR("path_rasterizer", "no memory for the edge table");
+		free(active);
+		free(crossings);
+		return;
+	}
+
+	for (y = top >> PATH_FIXED_SHIFT; (y << PATH_FIXED_SHIFT) < bottom; y++)
+	{
+		for (s = 0; s < samples; s++)
+		{
+			sy = (y << PATH_FIXED_SHIFT) + (int32_t)((2 * s + 1) * PATH_FIXED_ONE / (2 * samples));
+
+			while (next < edge_count && edges[next].y0 <= sy)
+				active[active_count++] = &edges[next++];
+
+			for (i = 0, j = 0; i < active_count; i++)
+				if (active[i]->y1 > sy)
+					active[j++] = active[i];
+			active_count = j;
+
+			/* Crossings stay almost sorted from a line to the next, insertion sort them. */
+			for (i = 0; i < active_count; i++)
+			{
+				crossing.x = active[i]->x0 + (int32_t)(((int64_t)(sy - active[i]->y0) * active[i]->slope) >> 16);
+				crossing.x = get_bigger(crossing.x, scan->bounds.left);
+				crossing.x = get_smaller(crossing.x, scan->bounds.right);
+				crossing.dir = active[i]->dir;
+
+				for (j = i; j > 0 && crossings[j - 1].x > crossing.x; j--)
+					crossings[j] = crossings[j - 1];
+				crossings[j] = crossing;
+			}
+
+			winding = 0;
+			span_start = 0;
+			for (i = 0; i < active_count; i++)
+			{
+				was_inside = inside(rule, winding);
+				winding += crossings[i].dir;
+
+				if (!was_inside && inside(rule, winding))
+					span_start = crossings[i].x;
+				else if (was_inside && !inside(rule, winding))
+				{
+					if (anti_alias)
+						coverage_span(scan, span_start, crossings[i].x);
+					else
+						solid_span(scan, y, span_start, crossings[i].x);
+				}
+			}
+		}
+
+		if (anti_alias)
+			flush_coverage(scan, y);
+	}
+
+	free(active);
+	free(crossings);
+}
+
+static bool scan_init(struct s_scan *scan, const canvas_t *canv, pixel_t color, bool anti_alias)
+{
+	const area_t *clip = canvas_clip(canv);
+
+	scan->canv = canv;
+	scan->color = color;
+	scan->bounds.left = clip->x << PATH_FIXED_SHIFT;
+	scan->bounds.top = clip->y << PATH_FIXED_SHIFT;
+	scan->bounds.right = (clip->x + clip->width) << PATH_FIXED_SHIFT;
+	scan->bounds.bottom = (clip->y + clip->height) << PATH_FIXED_SHIFT;
+	scan->coverage = NULL;
+	scan->alpha = NULL;
+	scan->width = clip->width;
+	scan->alpha_row = 0;
+	scan->touched_min = INT32_MAX;
+	scan->touched_max = INT32_MIN;
+
+	if (!area_value(clip))
+		return false;
+
+	if (!anti_alias)
+		return true;
+
+	scan->coverage = (uint16_t *)calloc(clip->width, sizeof(uint16_t));
+	scan->alpha = (uint8_t *)malloc(clip->width * COVERAGE_ROWS);
+	if (!scan->coverage || !scan->alpha)
+	{
+		LOG_ERROR("path_rasterizer", "no memory for the coverage row");
+		free(scan->coverage);
+		free(scan->alpha);
+		return false;
+	}
+
+	return true;
+}
+
+static void scan_deinit(struct s_scan *scan)
+{
+	/* Once per path, before the alpha rows queued blends read are freed. */
+	if (scan->alpha)
+		framebuffer_ops_sync();
+	free(scan->coverage);
+	free(scan->alpha);
+}
+
+void draw_path(const canvas_t *canv, pixel_t color, const fixed_point_t *points, const size_t *contour_lengths, size_t contour_count, enum e_fill_rule rule, bool anti_alias)
+{
+	struct s_scan scan;
+	struct s_edge *edges;
+	size_t edge_count = 0, total = 0, c, i;
+
+	PTR_CHECK(canv, "path_rasterizer");
+	PTR_CHECK(points, "path_rasterizer");
+	PTR_CHECK(contour_lengths, "path_rasterizer");
+
+	for (c = 0; c < contour_count; c++)
+		total += contour_lengths[c];
+
+	if (!total || !scan_init(&scan, canv, color, anti_alias))
+		return;
+
+	edges = (struct s_edge *)malloc(total * sizeof(struct s_edge));
+	if (!edges)
+	{
+		LOG_ERROR("path_rasterizer", "no memory for the edges");
+		scan_deinit(&scan);
+		return;
+	}
+
+	for (c = 0; c < contour_count; points += contour_lengths[c], c++)
+		for (i = 0; i < contour_lengths[c]; i++)
+			edge_count = add_edge(edges, edge_count, &scan.bounds, points[i], points[(i + 1) % contour_lengths[c]]);
+
+	rasterize(&scan, edges, edge_count, rule, anti_alias);
+
+	free(edges);
+	scan_deinit(&scan);
+}
+
+void draw_polygon(const canvas_t *canv, pixel_t color, const fixed_point_t *points, size_t count, enum e_fill_rule rule, bool anti_alias)
+{
+	draw_path(canv, color, points, &count, 1, rule, anti_alias);
+}
+
+static uint32_t isqrt64(uint64_t value)
+{
+	uint64_t root = 0, bit = (uint64_t)1 << 62;
+
+	while (bit > value)
+		bit >>= 2;
+
+	while (bit)
+	{
+		if (value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+			root >>= 1;
+		bit >>= 2;
+	}
+
+	return (uint32_t)root;
+}
+
+static fixed_point_t offset_point(fixed_point_t point, fixed_point_t normal, int32_t sign)
+{
+	point.x += sign * normal.x;
+	point.y += sign * normal.y;
+
+	return point;
+}
+
+/* Appends the contour with a positive orientation, so nonzero fill merges all of them. */
+static size_t add_contour(fixed_point_t *points, size_t count, const fixed_point_t *contour, size_t length)
+{
+	int64_t area = 0;
+	size_t i;
+
+	for (i = 0; i < length; i++)
+		area += (int64_t)contour[i].x * contour[(i + 1) % length].y - (int64_t)contour[(i + 1) % length].x * contour[i].y;
+
+	for (i = 0; i < length; i++)
+		points[count + i] = contour[area >= 0 ? i : length - 1 - i];
+
+	return count + length;
+}
+
+void draw_polyline(const canvas_t *canv, pixel_t color, const fixed_point_t *points, size_t count, int32_t width, bool anti_alias)
+{
+	fixed_point_t *outline;
+	size_t *lengths;
+	fixed_point_t normal, previous_normal, quad[4], bevel[3];
+	size_t outline_count = 0, contour_count = 0, i;
+	int64_t dx, dy;
+	uint32_t length;
+	bool has_previous = false;
+
+	PTR_CHECK(canv, "path_rasterizer");
+	PTR_CHECK(points, "path_rasterizer");
+
+	if (count < 2 || width <= 0)
+		return;
+
+	/* A quad per segment and two bevel triangles per joint. */
+	outline = (fixed_point_t *)malloc((count - 1) * 10 * sizeof(fixed_point_t));
+	lengths = (size_t *)malloc((count - 1) * 3 * sizeof(size_t));
+	if (!outline || !lengths)
+	{
+		LOG_ERROR("path_rasterizer", "no memory for the stroke outline");
+		free(outline);
+		free(lengths);
+		return;
+	}
+
+	previous_normal.x = previous_normal.y = 0;
+
+	for (i = 0; i + 1 < count; i++)
+	{
+		dx = points[i + 1].x - points[i].x;
+		dy = points[i + 1].y - points[i].y;
+		length = isqrt64((uint64_t)(dx * dx + dy * dy));
+		if (!length)
+			continue;
+
+		normal.x = (int32_t)(-dy * width / (2 * (int64_t)length));
+		normal.y = (int32_t)(dx * width / (2 * (int64_t)length));
+
+		if (has_previous)
+		{
+			bevel[0] = points[i];
+			bevel[1] = offset_point(points[i], previous_normal, 1);
+			bevel[2] = offset_point(points[i], normal, 1);
+			outline_count = add_contour(outline, outline_count, bevel, 3);
+			lengths[contour_count++] = 3;
+
+			bevel[1] = offset_point(points[i], previous_normal, -1);
+			bevel[2] = offset_point(points[i], normal, -1);
+			outline_count = add_contour(outline, outline_count, bevel, 3);
+			lengths[contour_count++] = 3;
+		}
+
+		quad[0] = offset_point(points[i], normal, 1);
+		quad[1] = offset_point(points[i + 1], normal, 1);
+		quad[2] = offset_point(points[i + 1], normal, -1);
+		quad[3] = offset_point(points[i], normal, -1);
+		outline_count = add_contour(outline, outline_count, quad, 4);
+		lengths[contour_count++] = 4;
+
+		previous_normal = normal;
+		has_previous = true;
+	}
+
+	draw_path(canv, color, outline, lengths, contour_count, FILL_NONZERO, anti_alias);
+
+	free(outline);
+	free(lengths);
+}
+
+/* sin(d) in Q14 for each degree of the first quadrant. */
+static const int16_t quarter_sine[91] =
+{
+	0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+	2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+	5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+	8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+	10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+	12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+	14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+	15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+	16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+	16384
+};
+
+static int32_t normalize_angle(int32_t angle)
+{
+	angle %= PATH_FULL_TURN;
+
+	return angle < 0 ? angle + PATH_FULL_TURN : angle;
+}
+
+static int32_t sine(int32_t angle)
+{
+	int32_t sign = 1, index, fraction;
+
+	angle = normalize_angle(angle);
+
+	if (angle >= PATH_DEGREES(180))
+	{
+		angle -= PATH_DEGREES(180);
+		sign = -1;
+	}
+	if (angle > PATH_DEGREES(90))
+		angle = PATH_DEGREES(180) - angle;
+
+	index = angle / PATH_DEGREES(1);
+	fraction = angle % PATH_DEGREES(1);
+
+	if (!fraction)
+		return sign * quarter_sine[index];
+
+	return sign * (quarter_sine[index] + (quarter_sine[index + 1] - quarter_sine[index]) * fraction / PATH_DEGREES(1));
+}
+
+static int32_t cosine(int32_t angle)
+{
+	return sine(angle + PATH_DEGREES(90));
+}
+
+/* First pixel whose center is at or after the fixed point coordinate. */
+static dim_t center_at_or_after(int64_t v)
+{
+	v = get_bigger(v, (int64_t)SPAN_MIN);
+	v = get_smaller(v, (int64_t)SPAN_MAX);
+
+	return (dim_t)((v - FIXED_HALF + PATH_FIXED_ONE - 1) >> PATH_FIXED_SHIFT);
+}
+
+/* First pixel whose center is after the fixed point coordinate. */
+static dim_t center_after(int64_t v)
+{
+	v = get_bigger(v, (int64_t)SPAN_MIN);
+	v = get_smaller(v, (int64_t)SPAN_MAX);
+
+	return (dim_t)(((v - FIXED_HALF) >> PATH_FIXED_SHIFT) + 1);
+}
+
+static int64_t floor_div(int64_t num, int64_t den)
+{
+	return num >= 0 ? num / den : -((-num + den - 1) / den);
+}
+
+/* Pixels of the row whose center P, relative to the arc center, is clockwise from
+ * direction (ax, ay), or counterclockwise when clockwise is false. */
+static struct s_interval half_plane(int32_t xc, int32_t dy, int32_t ax, int32_t ay, bool clockwise)
+{
+	struct s_interval interval = {SPAN_MIN, SPAN_MAX};
+	int64_t sign = clockwise ? 1 : -1;
+	int64_t num = sign * ax * dy;
+	int64_t den = sign * ay;
+
+	/* cross(A, P) = ax * dy - ay * dx must be >= 0 once signed. */
+	if (den > 0)
+		interval.hi = center_after(xc + floor_div(num, den));
+	else if (den < 0)
+		interval.lo = center_at_or_after(xc - floor_div(num, -den));
+	else if (num < 0)
+		interval.hi = interval.lo;
+
+	return interval;
+}
+
+static size_t ring_row(struct s_interval *ring, int32_t xc, int64_t dy2, int64_t outer2, int64_t inner2)
+{
+	int32_t w;
+
+	if (outer2 - dy2 <= 0)
+		return 0;
+
+	/* Integer dx satisfies dx * dx < s exactly when |dx| <= isqrt(s - 1). */
+	w = (int32_t)isqrt64((uint64_t)(outer2 - dy2 - 1));
+	ring[0].lo = center_at_or_after(xc - w);
+	ring[0].hi = center_after(xc + w);
+
+	if (inner2 - dy2 <= 0)
+		return 1;
+
+	w = (int32_t)isqrt64((uint64_t)(inner2 - dy2 - 1));
+	ring[1].lo = center_after(xc + w);
+	ring[1].hi = ring[0].hi;
+	ring[0].hi = center_at_or_after(xc - w);
+
+	return 2;
+}
+
+static bool angle_in_sweep(int32_t angle, int32_t start_angle, int32_t sweep_angle)
+{
+	return normalize_angle(angle - start_angle) <= sweep_angle;
+}
+
+static void normalize_sweep(int32_t *start_angle, int32_t *sweep_angle)
+{
+	if (*sweep_angle < 0)
+	{
+		*start_angle += *sweep_angle;
+		*sweep_angle = -*sweep_angle;
+	}
+
+	*start_angle = normalize_angle(*start_angle);
+	*sweep_angle = get_smaller(*sweep_angle, PATH_FULL_TURN);
+}
+
+void arc_bounds(area_t *tgt, fixed_point_t center, int32_t radius, int32_t thickness, int32_t start_angle, int32_t sweep_angle)
+{
+	int32_t inner = get_bigger(radius - thickness, 0);
+	int32_t radii[2];
+	int32_t angles[2];
+	int64_t left, top, right, bottom, x, y;
+	int32_t angle;
+	size_t r, a;
+
+	PTR_CHECK(tgt, "path_rasterizer");
+
+	normalize_sweep(&start_angle, &sweep_angle);
+
+	/* Extremes of the outer circle inside the sweep... */
+	left = angle_in_sweep(PATH_DEGREES(180), start_angle, sweep_angle) ? center.x - radius : INT32_MAX;
+	right = angle_in_sweep(0, start_angle, sweep_angle) ? center.x + radius : INT32_MIN;
+	top = angle_in_sweep(PATH_DEGREES(270), start_angle, sweep_angle) ? center.y - radius : INT32_MAX;
+	bottom = angle_in_sweep(PATH_DEGREES(90), start_angle, sweep_angle) ? center.y + radius : INT32_MIN;
+
+	/* ...and the corners of the sector. */
+	radii[0] = radius;
+	radii[1] = inner;
+	angles[0] = start_angle;
+	angles[1] = start_angle + sweep_angle;
+
+	for (a = 0; a < 2; a++)
+	{
+		angle = angles[a];
+		for (r = 0; r < 2; r++)
+		{
+			x = center.x + (((int64_t)radii[r] * cosine(angle)) >> 14);
+			y = center.y + (((int64_t)radii[r] * sine(angle)) >> 14);
+			left = get_smaller(left, x);
+			right = get_bigger(right, x);
+			top = get_smaller(top, y);
+			bottom = get_bigger(bottom, y);
+		}
+	}
+
+	/* One pixel of slack for the table rounding. */
+	tgt->x = (dim_t)(left >> PATH_FIXED_SHIFT) - 1;
+	tgt->y = (dim_t)(top >> PATH_FIXED_SHIFT) - 1;
+	tgt->width = (dim_t)((right + PATH_FIXED_ONE - 1) >> PATH_FIXED_SHIFT) + 1 - tgt->x;
+	tgt->height = (dim_t)((bottom + PATH_FIXED_ONE - 1) >> PATH_FIXED_SHIFT) + 1 - tgt->y;
+}
+
+void draw_arc(const canvas_t *canv, pixel_t color, fixed_point_t center, int32_t radius, int32_t thickness, int32_t start_angle, int32_t sweep_angle)
+{
+	const area_t *clip;
+	struct s_interval ring[2], sector[2];
+	size_t ring_count, sector_count, r, s;
+	int64_t outer2, inner2, dy;
+	int32_t start_x, start_y, end_x, end_y;
+	area_t bounds;
+	dim_t y, y_end, lo, hi;
+
+	PTR_CHECK(canv, "path_rasterizer");
+
+	if (radius <= 0 || thickness <= 0 || !sweep_angle)
+		return;
+
+	normalize_sweep(&start_angle, &sweep_angle);
+
+	/* Rows of the sector bounds inside the clip. */
+	clip = canvas_clip(canv);
+	arc_bounds(&bounds, center, radius, thickness, start_angle, sweep_angle);
+	area_set_intersection(&bounds, &bounds, clip);
+	if (!area_value(&bounds))
+		return;
+
+	outer2 = (int64_t)radius * radius;
+	inner2 = (int64_t)get_bigger(radius - thickness, 0) * get_bigger(radius - thickness, 0);
+
+	start_x = cosine(start_angle);
+	start_y = sine(start_angle);
+	end_x = cosine(start_angle + sweep_angle);
+	end_y = sine(start_angle + sweep_angle);
+
+	y_end = bounds.y + bounds.height;
+	for (y = bounds.y; y < y_end; y++)
+	{
+		dy = ((int64_t)y << PATH_FIXED_SHIFT) + FIXED_HALF - center.y;
+
+		ring_count = ring_row(ring, center.x, dy * dy, outer2, inner2);
+		if (!ring_count)
+			continue;
+
+		/* Up to a half turn the sector is the intersection of two half planes,
+		 * beyond it their union. */
+		if (sweep_angle >= PATH_FULL_TURN)
+		{
+			sector[0].lo = SPAN_MIN;
+			sector[0].hi = SPAN_MAX;
+			sector_count = 1;
+		}
+		else if (sweep_angle <= PATH_DEGREES(180))
+		{
+			sector[0] = half_plane(center.x, (int32_t)dy, start_x, start_y, true);
+			sector[1] = half_plane(center.x, (int32_t)dy, end_x, end_y, false);
+			sector[0].lo = get_bigger(sector[0].lo, sector[1].lo);
+			sector[0].hi = get_smaller(sector[0].hi, sector[1].hi);
+			sector_count = 1;
+		}
+		else
+		{
+			sector[0] = half_plane(center.x, (int32_t)dy, start_x, start_y, true);
+			sector[1] = half_plane(center.x, (int32_t)dy, end_x, end_y, false);
+			if (sector[1].lo < sector[0].hi && sector[0].lo < sector[1].hi)
+			{
+				sector[0].lo = get_smaller(sector[0].lo, sector[1].lo);
+				sector[0].hi = get_bigger(sector[0].hi, sector[1].hi);
+				sector_count = 1;
+			}
+			else
+				sector_count = 2;
+		}
+
+		for (r = 0; r < ring_count; r++)
+		{
+			for (s = 0; s < sector_count; s++)
+			{
+				lo = get_bigger(get_bigger(ring[r].lo, sector[s].lo), bounds.x);
+				hi = get_smaller(get_smaller(ring[r].hi, sector[s].hi), bounds.x + bounds.width);
+
+				if (hi > lo)
+					draw_fill_area(canv, color, lo, y, hi - lo, 1);
+			}
+		}
+	}
+}
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PATH_RASTERIZER_H_
+#define PATH_RASTERIZER_H_
+
+#include "types.h"
+
+/*
+ * Scanline rasterizer for polygons and stroked polylines. Coordinates are relative to
+ * the canvas origin, in 24.8 fixed point. Edges outside the canvas clip are dropped
+ * or flattened before the scan, so shapes may extend far out of it.
+ *
+ * Without anti-aliasing a pixel is filled when its center is inside the shape. With
+ * it, each pixel row is sampled on PATH_SUBSAMPLES lines and the horizontal coverage
+ * of every line is computed exactly, partially covered pixels are blended.
+ *
+ * Arcs are rings sectors, computed as spans per pixel row. Angles are in tenths of a
+ * degree, 0 points right and angles grow clockwise on screen.
+ */
+
+#define PATH_FIXED_SHIFT 8
+#define PATH_FIXED_ONE   (1 << PATH_FIXED_SHIFT)
+#define PATH_FIXED(__v)  ((int32_t)((__v) * PATH_FIXED_ONE))
+
+#define PATH_SUBSAMPLES  4
+
+#define PATH_DEGREES(__d) ((int32_t)((__d) * 10))
+#define PATH_FULL_TURN    PATH_DEGREES(360)
+
+/* Each contour is closed, contour_lengths holds the point count of each. */
+void draw_path(const canvas_t *canv, pixel_t color, const fixed_point_t *points, const size_t *contour_lengths, size_t contour_count, enum e_fill_rule rule, bool anti_alias);
+void draw_polygon(const canvas_t *canv, pixel_t color, const fixed_point_t *points, size_t count, enum e_fill_rule rule, bool anti_alias);
+/* Strokes the open polyline with bevel joins and butt caps, width in 24.8 fixed point. */
+void draw_polyline(const canvas_t *canv, pixel_t color, const fixed_point_t *points, size_t count, int32_t width, bool anti_alias);
+
+/* Fills the pixels whose center is in the ring sector of outer radius and thickness,
+ * swept from start_angle. A sweep of PATH_FULL_TURN or more is the full ring. */
+void draw_arc(const canvas_t *canv, pixel_t color, fixed_point_t center, int32_t radius, int32_t thickness, int32_t start_angle, int32_t sweep_angle);
+/* Smallest pixel area containing the arc, in the coordinates of center. */
+void arc_bounds(area_t *tgt, fixed_point_t center, int32_t radius, int32_t thickness, int32_t start_angle, int32_t sweep_angle);
+
+#endif /* PATH_RASTERIZER_H_ */
@@ -0,0 +1,350 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "helper/checks.h"
+
+#include "pixel_convert.h"
+#include "pixel_format.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define PIXEL_CONVERT_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*row_888_t)(uint8_t * dst, const uint16_t * src, size_t count);
+typedef void (*row_x888_t)(uint32_t * dst, const uint16_t * src, size_t count);
+
+static struct
+{
+	bool selected;
+	enum e_pixel_convert_isa isa;
+	row_888_t row_888;
+	row_x888_t row_x888;
+} convert;
+
+static inline uint8_t red(uint16_t pixel)
+{
+	return (uint8_t)(((pixel >> 8) & 0xF8) | 0x07);
+}
+
+static inline uint8_t green(uint16_t pixel)
+{
+	return (uint8_t)(((pixel >> 3) & 0xFC) | 0x03);
+}
+
+static inline uint8_t blue(uint16_t pixel)
+{
+	return (uint8_t)(((pixel << 3) & 0xF8) | 0x07);
+}
+
+static void row_888_scalar(uint8_t * dst, const uint16_t * src, size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		*dst++ = red(src[i]);
+		*dst++ = green(src[i]);
+		*dst++ = blue(src[i]);
+	}
+}
+
+static void row_x888_scalar(uint32_t * dst, const uint16_t * src, size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++)
+		dst[i] = (uint32_t)red(src[i]) << 16 | (uint32_t)green(src[i]) << 8 | blue(src[i]);
+}
+
+#ifdef PIXEL_CONVERT_X86
+
+/* Eight pixels to 16 bit lanes holding red in the low byte and green in the high
+ * one, and lanes holding blue alone. */
+static inline void channels_128(__m128i pixels, __m128i * red_green, __m128i * blue_only)
+{
+	const __m128i red_mask = _mm_set1_epi16(0xF8), green_mask = _mm_set1_epi16(0xFC);
+	__m128i r, g;
+
+	r = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(pixels, 8), red_mask), _mm_set1_epi16(0x07));
+	g = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(pixels, 3), green_mask), _mm_set1_epi16(0x03));
+	*blue_only = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(pixels, 3), red_mask), _mm_set1_epi16(0x07));
+	*red_green = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+}
+
+__attribute__((target("avx2")))
+static inline void channels_256(__m256i pixels, __m256i * red_green, __m256i * blue_only)
+{
+	const __m256i red_mask = _mm256_set1_epi16(0xF8), green_mask = _mm256_set1_epi16(0xFC);
+	__m256i r, g;
+
+	r = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(pixels, 8), red_mask), _mm256_set1_epi16(0x07));
+	g = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(pixels, 3), green_mask), _mm256_set1_epi16(0x03));
+	*blue_only = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(pixels, 3), red_mask), _mm256_set1_epi16(0x07));
+	*red_green = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+}
+
+/* The 24 bytes of eight pixels: the first 16 and the last 8, each gathered from the
+ * red green lanes and the blue ones, -1 zeroing a byte. */
+#define SHUFFLE_888_HEAD_RG 0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10
+#define SHUFFLE_888_HEAD_B -1, -1, 0, -1, -1, 2, -1, -1, 4, -1, -1, 6, -1, -1, 8, -1
+#define SHUFFLE_888_TAIL_RG 11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1
+#define SHUFFLE_888_TAIL_B -1, 10, -1, -1, 12, -1, -1, 14, -1, -1, -1, -1, -1, -1, -1, -1
+
+__attribute__((target("ssse3")))
+static void row_888_ssse3(uint8_t * dst, const uint16_t * src, size_t count)
+{
+	const __m128i head_rg = _mm_setr_epi8(SHUFFLE_888_HEAD_RG), head_b = _mm_setr_epi8(SHUFFLE_888_HEAD_B);
+	const __m128i tail_rg = _mm_setr_epi8(SHUFFLE_888_TAIL_RG), tail_b = _mm_setr_epi8(SHUFFLE_888_TAIL_B);
+	__m128i rg, b;
+	size_t i;
+
+	for (i = 0; i + 8 <= count; i += 8, dst += 24)
+	{
+		channels_128(_mm_loadu_si128((const __m128i *)(src + i)), &rg, &b);
+		_mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_shuffle_epi8(rg, head_rg), _mm_shuffle_epi8(b, head_b)));
+		_mm_storel_epi64((__m128i *)(dst + 16), _mm_or_si128(_mm_shuffle_epi8(rg, tail_rg), _mm_shuffle_epi8(b, tail_b)));
+	}
+
+	row_888_scalar(dst, src + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void row_888_avx2(uint8_t * dst, const uint16_t * src, size_t count)
+{
+	/* The shuffle stays in each 128 bit lane, the lanes convert 8 pixels each. */
+	const __m256i head_rg = _mm256_setr_epi8(SHUFFLE_888_HEAD_RG, SHUFFLE_888_HEAD_RG);
+	const __m256i head_b = _mm256_setr_epi8(SHUFFLE_888_HEAD_B, SHUFFLE_888_HEAD_B);
+	const __m256i tail_rg = _mm256_setr_epi8(SHUFFLE_888_TAIL_RG, SHUFFLE_888_TAIL_RG);
+	const __m256i tail_b = _mm256_setr_epi8(SHUFFLE_888_TAIL_B, SHUFFLE_888_TAIL_B);
+	__m256i rg, b, head, tail;
+	size_t i;
+
+	for (i = 0; i + 16 <= count; i += 16, dst += 48)
+	{
+		channels_256(_mm256_loadu_si256((const __m256i *)(src + i)), &rg, &b);
+		head = _mm256_or_si256(_mm256_shuffle_epi8(rg, head_rg), _mm256_shuffle_epi8(b, head_b));
+		tail = _mm256_or_si256(_mm256_shuffle_epi8(rg, tail_rg), _mm256_shuffle_epi8(b, tail_b));
+
+		_mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(head));
+		_mm_storel_epi64((__m128i *)(dst + 16), _mm256_castsi256_si128(tail));
+		_mm_storeu_si128((__m128i *)(dst + 24), _mm256_extracti128_si256(head, 1));
+		_mm_storel_epi64((__m128i *)(dst + 40), _mm256_extracti128_si256(tail, 1));
+	}
+
+	row_888_scalar(dst, src + i, count - i);
+}
+
+/* Only SSE2 is needed, the x86-64 baseline, it stands at the SSSE3 level. */
+static void row_x888_sse2(uint32_t * dst, const uint16_t * src, size_t count)
+{
+	__m128i rg, b, gb, r;
+	size_t i;
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		channels_128(_mm_loadu_si128((const __m128i *)(src + i)), &rg, &b);
+		r = _mm_and_si128(rg, _mm_set1_epi16(0xFF));
+		gb = _mm_or_si128(b, _mm_slli_epi16(_mm_srli_epi16(rg, 8), 8));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi16(gb, r));
+		_mm_storeu_si128((__m128i *)(dst + i + 4), _mm_unpackhi_epi16(gb, r));
+	}
+
+	row_x888_scalar(dst + i, src + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void row_x888_avx2(uint32_t * dst, const uint16_t * src, size_t count)
+{
+	__m256i rg, b, gb, r, low, high;
+	size_t i;
+
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		channels_256(_mm256_loadu_si256((const __m256i *)(src + i)), &rg, &b);
+		r = _mm256_and_si256(rg, _mm256_set1_epi16(0xFF));
+		gb = _mm256_or_si256(b, _mm256_slli_epi16(_mm256_srli_epi16(rg, 8), 8));
+
+		/* Unpacking stays in each lane, pixels 0-3 and 8-11 low, 4-7 and 12-15 high. */
+		low = _mm256_unpacklo_epi16(gb, r);
+		high = _mm256_unpackhi_epi16(gb, r);
+		_mm256_storeu_si256((__m256i *)(dst + i), _mm256_permute2x128_si256(low, high, 0x20));
+		_mm256_storeu_si256((__m256i *)(dst + i + 8), _mm256_permute2x128_si256(low, high, 0x31));
+	}
+
+	row_x888_scalar(dst + i, src + i, count - i);
+}
+
+#endif /* PIXEL_CONVERT_X86 */
+
+static enum e_pixel_convert_isa supported_isa(void)
+{
+#ifdef PIXEL_CONVERT_X86
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+		return PIXEL_CONVERT_AVX2;
+	if (__builtin_cpu_supports("ssse3"))
+		return PIXEL_CONVERT_SSSE3;
+#endif
+
+	return PIXEL_CONVERT_SCALAR;
+}
+
+enum e_pixel_convert_isa pixel_convert_set_isa(enum e_pixel_convert_isa isa)
+{
+	enum e_pixel_convert_isa supported = supported_isa();
+
+	if (isa > supported)
+		isa = supported;
+
+	convert.row_888 = row_888_scalar;
+	convert.row_x888 = row_x888_scalar;
+
+#ifdef PIXEL_CONVERT_X86
+	if (isa == PIXEL_CONVERT_AVX2)
+	{
+		convert.row_888 = row_888_avx2;
+		convert.row_x888 = row_x888_avx2;
+	}
+	else if (isa == PIXEL_CONVERT_SSSE3)
+	{
+		convert.row_888 = row_888_ssse3;
+		convert.row_x888 = row_x888_sse2;
+	}
+#endif
+
+	convert.isa = isa;
+	convert.selected = true;
+
+	return isa;
+}
+
+enum e_pixel_convert_isa pixel_convert_isa(void)
+{
+	if (!convert.selected)
+		pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+
+	return convert.isa;
+}
+
+const char * pixel_convert_isa_name(enum e_pixel_convert_isa isa)
+{
+	switch (isa)
+	{
+	case PIXEL_CONVERT_AVX2:
+		return "avx2";
+	case PIXEL_CONVERT_SSSE3:
+		return "ssse3";
+	case PIXEL_CONVERT_SCALAR:
+	default:
+		return "scalar";
+	}
+}
+
+void pixel_convert_565_to_888(uint8_t * dst, size_t dst_stride, const uint16_t * src, size_t src_stride, dim_t width,
+		dim_t height)
+{
+	dim_t y;
+
+	PTR_CHECK(dst, "pixel_convert");
+	PTR_CHECK(src, "pixel_convert");
+
+	if (width <= 0)
+		return;
+
+	if (!convert.selected)
+		pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+
+	for (y = 0; y < height; y++)
+		convert.row_888(dst + y * dst_stride, src + y * src_stride, (size_t)width);
+}
+
+void pixel_convert_565_to_x888(uint32_t * dst, size_t dst_stride, const uint16_t * src, size_t src_stride, dim_t width,
+		dim_t height)
+{
+	dim_t y;
+
+	PTR_CHECK(dst, "pixel_convert");
+	PTR_CHECK(src, "pixel_convert");
+
+	if (width <= 0)
+		return;
+
+	if (!convert.selected)
+		pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+
+	for (y = 0; y < height; y++)
+		convert.row_x888((uint32_t *)((uint8_t *)dst + y * dst_stride), src + y * src_stride, (size_t)width);
+}
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
+
+void pixel_convert_to_888(uint8_t * dst, size_t dst_stride, const pixel_t * src, size_t src_stride, dim_t width,
+		dim_t height)
+{
+	pixel_convert_565_to_888(dst, dst_stride, src, src_stride, width, height);
+}
+
+void pixel_convert_to_x888(uint32_t * dst, size_t dst_stride, const pixel_t * src, size_t src_stride, dim_t width,
+		dim_t height)
+{
+	pixel_convert_565_to_x888(dst, dst_stride, src, src_stride, width, height);
+}
+
+#else
+
+void pixel_convert_to_888(uint8_t * dst, size_t dst_stride, const pixel_t * src, size_t src_stride, dim_t width,
+		dim_t height)
+{
+	uint8_t * out;
+	dim_t x, y;
+
+	PTR_CHECK(dst, "pixel_convert");
+	PTR_CHECK(src, "pixel_convert");
+
+	for (y = 0; y < height; y++, dst += dst_stride, src += src_stride)
+	{
+		for (x = 0, out = dst; x < width; x++, out += 3)
+		{
+			out[0] = PIXEL_RED(src[x]);
+			out[1] = PIXEL_GREEN(src[x]);
+			out[2] = PIXEL_BLUE(src[x]);
+		}
+	}
+}
+
+void pixel_convert_to_x888(uint32_t * dst, size_t dst_stride, const pixel_t * src, size_t src_stride, dim_t width,
+		dim_t height)
+{
+	dim_t x, y;
+
+	PTR_CHECK(dst, "pixel_convert");
+	PTR_CHECK(src, "pixel_convert");
+
+	for (y = 0; y < height; y++, dst = (uint32_t *)((uint8_t *)dst + dst_stride), src += src_stride)
+		for (x = 0; x < width; x++)
+			dst[x] = (uint32_t)PIXEL_RED(src[x]) << 16 | (uint32_t)PIXEL_GREEN(src[x]) << 8 | PIXEL_BLUE(src[x]);
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PIXEL_CONVERT_H_
+#define PIXEL_CONVERT_H_
+
+#include "types.h"
+
+/*
+ * Conversion of framebuffer rectangles to the formats displays and image files take,
+ * for presenting only the written area. Every channel keeps the 565 bits on top, the
+ * red and blue low bits set and the green ones to 3, as the simulator always did.
+ *
+ * The kernels use the widest instruction set the CPU has, AVX2, SSSE3, or plain C
+ * elsewhere, picked on the first call. pixel_convert_set_isa forces a lower one.
+ */
+
+/* Packed R, G, B bytes. dst_stride is in bytes, src_stride in pixels. */
+void pixel_convert_565_to_888(uint8_t * dst, size_t dst_stride, const uint16_t * src, size_t src_stride, dim_t width,
+		dim_t height);
+/* 32 bit 0x00RRGGBB words in native order, e.g. a cairo RGB24 surface. dst_stride is
+ * in bytes, src_stride in pixels. */
+void pixel_convert_565_to_x888(uint32_t * dst, size_t dst_stride, const uint16_t * src, size_t src_stride, dim_t width,
+		dim_t height);
+
+/* Same from framebuffer pixels, whatever MARSH_PIXEL_FORMAT they are in. RGB565 goes
+ * through the kernels above, the other formats convert in plain C. */
+void pixel_convert_to_888(uint8_t * dst, size_t dst_stride, const pixel_t * src, size_t src_stride, dim_t width,
+		dim_t height);
+void pixel_convert_to_x888(uint32_t * dst, size_t dst_stride, const pixel_t * src, size_t src_stride, dim_t width,
+		dim_t height);
+
+/* Returns the set used from now on, isa or the widest supported below it. */
+enum e_pixel_convert_isa pixel_convert_set_isa(enum e_pixel_convert_isa isa);
+enum e_pixel_convert_isa pixel_convert_isa(void);
+const char * pixel_convert_isa_name(enum e_pixel_convert_isa isa);
+
+#endif /* PIXEL_CONVERT_H_ */
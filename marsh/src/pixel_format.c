@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "helper/checks.h"
+
+#include "pixel_format.h"
+#include "bitmap_data/bitmap_data.h"
+
+const char * pixel_format_name(void)
+{
+	return PIXEL_FORMAT_NAME;
+}
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
+
+bitmap_t * pixel_format_bitmap_new(bitmap_t * bitmap)
+{
+	return bitmap;
+}
+
+void pixel_format_bitmap_delete(bitmap_t * bitmap, bitmap_t * converted)
+{
+	(void)bitmap;
+	(void)converted;
+}
+
+#else
+
+/* The bitmap and its pixels in one allocation, the pixels following it. */
+bitmap_t * pixel_format_bitmap_new(bitmap_t * bitmap)
+{
+	struct s_bitmap * converted;
+	const uint16_t * src;
+	pixel_t * dst;
+	size_t count, i;
+
+	PTR_CHECK_RETURN(bitmap, "pixel_format", NULL);
+
+	if (bitmap->bitmap_data_width != BITMAP_BUFFER_16BPP)
+		return bitmap;
+
+	count = (size_t)bitmap->width * bitmap->height;
+	converted = (struct s_bitmap *)malloc(sizeof(struct s_bitmap) + count * sizeof(pixel_t));
+	MEMORY_ALLOC_CHECK_RETURN(converted, NULL);
+
+	src = (const uint16_t *)bitmap->bitmap;
+	dst = (pixel_t *)(converted + 1);
+	for (i = 0; i < count; i++)
+		dst[i] = PIXEL_FROM_565(src[i]);
+
+	{
+		const struct s_bitmap native = {dst, bitmap->width, bitmap->height, bitmap->single_channel,
+				BITMAP_BUFFER_NATIVE, NULL};
+
+		memcpy(converted, &native, sizeof(native));
+	}
+
+	return converted;
+}
+
+void pixel_format_bitmap_delete(bitmap_t * bitmap, bitmap_t * converted)
+{
+	if (converted != bitmap)
+		free((void *)converted);
+}
+
+#endif
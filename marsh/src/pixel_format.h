@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PIXEL_FORMAT_H_
+#define PIXEL_FORMAT_H_
+
+#include "types.h"
+
+/*
+ * Packing of the framebuffer pixel format MARSH_PIXEL_FORMAT selects, resolved at
+ * build time so no kernel tests the format per pixel. PIXEL_PACK takes 8 bit
+ * channels, PIXEL_RED, PIXEL_GREEN and PIXEL_BLUE give them back on 8 bits.
+ *
+ * RGB565 widens its channels the way color_from_pixel always did, the low bits set
+ * when the lowest channel bit is, blue following the lowest green bit.
+ */
+
+#define RGB565_RED(p)   ((uint8_t)(((p) >> 8 & 0xF8) | ((p) & 0x0800 ? 0x07 : 0)))
+#define RGB565_GREEN(p) ((uint8_t)(((p) >> 3 & 0xFC) | ((p) & 0x0020 ? 0x03 : 0)))
+#define RGB565_BLUE(p)  ((uint8_t)(((p) << 3 & 0xF8) | ((p) & 0x0040 ? 0x07 : 0)))
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
+
+#define PIXEL_FORMAT_NAME "RGB565"
+#define PIXEL_PACK(r, g, b) ((pixel_t)(((uint32_t)(r) >> 3) << 11 | ((uint32_t)(g) >> 2) << 5 | (uint32_t)(b) >> 3))
+#define PIXEL_RED(p)   RGB565_RED(p)
+#define PIXEL_GREEN(p) RGB565_GREEN(p)
+#define PIXEL_BLUE(p)  RGB565_BLUE(p)
+
+#elif MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB888 || MARSH_PIXEL_FORMAT == PIXEL_FORMAT_ARGB8888
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB888
+#define PIXEL_FORMAT_NAME "RGB888"
+#define PIXEL_OPAQUE 0u
+#else
+#define PIXEL_FORMAT_NAME "ARGB8888"
+#define PIXEL_OPAQUE 0xFF000000u
+#endif
+#define PIXEL_PACK(r, g, b) ((pixel_t)(PIXEL_OPAQUE | (uint32_t)(r) << 16 | (uint32_t)(g) << 8 | (uint32_t)(b)))
+#define PIXEL_RED(p)   ((uint8_t)((p) >> 16))
+#define PIXEL_GREEN(p) ((uint8_t)((p) >> 8))
+#define PIXEL_BLUE(p)  ((uint8_t)(p))
+
+#elif MARSH_PIXEL_FORMAT == PIXEL_FORMAT_L8
+
+#define PIXEL_FORMAT_NAME "L8"
+/* BT.601 weights summing to 256, grey stays the same. */
+#define PIXEL_PACK(r, g, b) ((pixel_t)(((uint32_t)(r) * 77 + (uint32_t)(g) * 150 + (uint32_t)(b) * 29) >> 8))
+#define PIXEL_RED(p)   ((uint8_t)(p))
+#define PIXEL_GREEN(p) ((uint8_t)(p))
+#define PIXEL_BLUE(p)  ((uint8_t)(p))
+
+#elif MARSH_PIXEL_FORMAT == PIXEL_FORMAT_INDEXED8
+
+/* The backend loads its color table with the palette these macros read back. */
+#define PIXEL_FORMAT_NAME "indexed8 (RGB332 palette)"
+#define PIXEL_PACK(r, g, b) ((pixel_t)(((uint32_t)(r) & 0xE0) | ((uint32_t)(g) >> 3 & 0x1C) | (uint32_t)(b) >> 6))
+#define PIXEL_RED(p)   ((uint8_t)(((p) & 0xE0) | ((p) & 0xE0) >> 3 | ((p) & 0xE0) >> 6))
+#define PIXEL_GREEN(p) ((uint8_t)(((p) & 0x1C) << 3 | ((p) & 0x1C) | ((p) & 0x1C) >> 3))
+#define PIXEL_BLUE(p)  ((uint8_t)(((p) & 0x03) * 0x55))
+
+#endif
+
+/* Channel mixed alpha / 255 of the way from to, the rounding of color_alpha_blend. */
+#define PIXEL_BLEND_CHANNEL(to, from, alpha) \
+	((uint32_t)(to) * (255 - (uint32_t)(alpha)) / 255 + (uint32_t)(from) * (uint32_t)(alpha) / 255)
+
+#define PIXEL_FROM_565(p) PIXEL_PACK(RGB565_RED(p), RGB565_GREEN(p), RGB565_BLUE(p))
+
+const char * pixel_format_name(void);
+
+/* The bitmap to draw for a BITMAP_BUFFER_16BPP one: in the other formats, a
+ * BITMAP_BUFFER_NATIVE copy of its pixels converted, NULL when out of memory. Other
+ * bitmaps, and all of them in the RGB565 format, are returned as they are. Images and
+ * sprites convert the bitmap they are given and keep the result, whoever converts
+ * frees it with pixel_format_bitmap_delete once nothing draws it. */
+bitmap_t * pixel_format_bitmap_new(bitmap_t * bitmap);
+void pixel_format_bitmap_delete(bitmap_t * bitmap, bitmap_t * converted);
+
+#endif /* PIXEL_FORMAT_H_ */
@@ -26,6 +26,7 @@
 #include "area.h"
 #include "canvas.h"
 #include "widget.h"
+#include "widget_update.h"
 #include "rectangle.h"
 #include "drawing_algorithms.h"
 
@@ -33,8 +34,10 @@
 struct s_rectangle_instance
 {
 	color_t fill_color;
+	char fill_color_html[COLOR_HTML_CODE_SIZE];
 	bool is_filled;
 	color_t border_color;
+	char border_color_html[COLOR_HTML_CODE_SIZE];
 	dim_t border_tickness;
 	bool has_border;
 	dim_t corner_radius;
@@ -71,8 +74,7 @@ static void abstract_delete(void * obj)
 
 static void decode_and_draw(rectangle_t* obj, const area_t * limiting_canvas_area)
 {
-	area_t canvas_area = widget_compute_canvas_area(obj->glyph, limiting_canvas_area);
-	canvas_t *canv = canvas_new(&canvas_area);
+	canvas_t *canv = canvas_new_clipped(widget_area(obj->glyph), limiting_canvas_area);
 
 	if (obj->corner_radius)
 	{
@@ -164,6 +166,11 @@ void rectangle_set_fill_color_html(rectangle_t * const obj, const char *html_col
 {
 	PTR_CHECK(obj, "rectangle");
 
+	if (!color_html_cache_update(obj->fill_color_html, html_color_code) && obj->is_filled)
+		return;
+
+	widget_invalidate(obj->glyph);
+
 	obj->fill_color = color_html(html_color_code);
 	obj->is_filled = true;
 }
@@ -179,6 +186,11 @@ void rectangle_set_border_tickness(rectangle_t * const obj, dim_t tickness)
 {
 	PTR_CHECK(obj, "rectangle");
 
+	if (obj->border_tickness == tickness && obj->has_border)
+		return;
+
+	widget_invalidate(obj->glyph);
+
 	obj->border_tickness = tickness;
 	obj->has_border = true;
 }
@@ -187,6 +199,11 @@ void rectangle_set_border_color_html(rectangle_t * const obj, const char* html_c
 {
 	PTR_CHECK(obj, "rectangle");
 
+	if (!color_html_cache_update(obj->border_color_html, html_color_code) && obj->has_border)
+		return;
+
+	widget_invalidate(obj->glyph);
+
 	obj->border_color = color_html(html_color_code);
 	obj->has_border = true;
 }
@@ -195,5 +212,10 @@ void rectangle_set_rounded_corner_radius(rectangle_t * const obj, dim_t radius)
 {
 	PTR_CHECK(obj, "rectangle");
 
+	if (obj->corner_radius == radius)
+		return;
+
+	widget_invalidate(obj->glyph);
+
 	obj->corner_radius = radius;
 }
@@ -0,0 +1,367 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "damage.h"
+#include "display_list.h"
+#include "framebuffer.h"
+#include "render_thread.h"
+#include "sprite.h"
+
+#define RENDER_FRAMES 3
+
+struct s_render_frame
+{
+	display_list_t * list;
+	damage_t * damage;
+	/* Earliest input the frame answers, 0 for none. */
+	uint64_t input_ns;
+};
+
+static struct
+{
+	bool running;
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t published_cond;
+	pthread_cond_t presented_cond;
+
+	struct s_render_frame frames[RENDER_FRAMES];
+	/* Owned by the UI thread, shared under the mutex and owned by the render thread. */
+	struct s_render_frame * building;
+	struct s_render_frame * ready;
+	struct s_render_frame * presenting;
+	bool ready_fresh;
+	bool rendering;
+	bool stopping;
+
+	/* The frame being built, UI thread only. */
+	damage_t * damage;
+	widget_t * root;
+	uint64_t input_ns;
+
+	render_thread_stats_t stats;
+} render;
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void present(const struct s_render_frame * frame)
+{
+	const area_t * area;
+	size_t i;
+
+	/* The UI thread waits for the frame before touching the sprites. */
+	for (i = 0; i < damage_count(frame->damage); i++)
+		sprite_overlay_lift(damage_area(frame->damage, i));
+	display_list_execute(frame->list, framebuffer_ops_software());
+	sprite_overlay_drop();
+
+	for (i = 0; i < damage_count(frame->damage); i++)
+	{
+		area = damage_area(frame->damage, i);
+		framebuffer_inform_written_area(area->x, area->y, area->width, area->height);
+	}
+}
+
+static void * render_loop(void * arg)
+{
+	struct s_render_frame * frame;
+	uint64_t start, end;
+
+	(void)arg;
+
+	pthread_mutex_lock(&render.mutex);
+
+	for (;;)
+	{
+		while (!render.ready_fresh && !render.stopping)
+			pthread_cond_wait(&render.published_cond, &render.mutex);
+
+		/* Stopping leaves once the last published frame is presented. */
+		if (!render.ready_fresh)
+			break;
+
+		frame = render.ready;
+		render.ready = render.presenting;
+		render.presenting = frame;
+		render.ready_fresh = false;
+		render.rendering = true;
+
+		pthread_mutex_unlock(&render.mutex);
+
+		start = now_ns();
+		present(frame);
+		end = now_ns();
+
+		pthread_mutex_lock(&render.mutex);
+
+		render.rendering = false;
+		render.stats.presented++;
+		render.stats.render_ns += end - start;
+		if (frame->input_ns)
+		{
+			render.stats.inputs++;
+			render.stats.latency_ns += end - frame->input_ns;
+			if (end - frame->input_ns > render.stats.max_latency_ns)
+				render.stats.max_latency_ns = end - frame->input_ns;
+		}
+
+		pthread_cond_broadcast(&render.presented_cond);
+	}
+
+	pthread_mutex_unlock(&render.mutex);
+
+	return NULL;
+}
+
+static void release(void)
+{
+	size_t i;
+
+	for (i = 0; i < RENDER_FRAMES; i++)
+	{
+		if (render.frames[i].list)
+			display_list_delete(render.frames[i].list);
+		if (render.frames[i].damage)
+			damage_delete(render.frames[i].damage);
+	}
+
+	if (render.damage)
+		damage_delete(render.damage);
+
+	memset(&render, 0, sizeof(render));
+}
+
+void render_thread_start(void)
+{
+	size_t i;
+
+	if (render.running)
+		return;
+
+	/* The render thread executes the software operations concurrently with the UI
+	 * thread recording, the other tables have a single producer. */
+	if (!framebuffer_ops_reentrant())
+	{
+		LOG_ERROR("render_thread", "Needs the software framebuffer operations installed.");
+		return;
+	}
+
+	memset(&render, 0, sizeof(render));
+
+	for (i = 0; i < RENDER_FRAMES; i++)
+	{
+		render.frames[i].list = display_list_new();
+		render.frames[i].damage = damage_new();
+
+		if (!render.frames[i].list || !render.frames[i].damage)
+		{
+			release();
+			return;
+		}
+	}
+
+	render.damage = damage_new();
+	if (!render.damage)
+	{
+		release();
+		return;
+	}
+
+	render.building = &render.frames[0];
+	render.ready = &render.frames[1];
+	render.presenting = &render.frames[2];
+
+	pthread_mutex_init(&render.mutex, NULL);
+	pthread_cond_init(&render.published_cond, NULL);
+	pthread_cond_init(&render.presented_cond, NULL);
+
+	if (pthread_create(&render.thread, NULL, render_loop, NULL))
+	{
+		LOG_ERROR("render_thread", "Failed to create the thread.");
+		pthread_cond_destroy(&render.presented_cond);
+		pthread_cond_destroy(&render.published_cond);
+		pthread_mutex_destroy(&render.mutex);
+		release();
+		return;
+	}
+
+	render.running = true;
+}
+
+void render_thread_stop(void)
+{
+	if (!render.running)
+		return;
+
+	render_thread_publish();
+
+	pthread_mutex_lock(&render.mutex);
+	render.stopping = true;
+	pthread_cond_signal(&render.published_cond);
+	pthread_mutex_unlock(&render.mutex);
+
+	pthread_join(render.thread, NULL);
+
+	pthread_cond_destroy(&render.presented_cond);
+	pthread_cond_destroy(&render.published_cond);
+	pthread_mutex_destroy(&render.mutex);
+	release();
+}
+
+bool render_thread_running(void)
+{
+	return render.running;
+}
+
+void render_thread_damage(widget_t * root, const area_t * area)
+{
+	PTR_CHECK(root, "render_thread");
+	PTR_CHECK(area, "render_thread");
+
+	if (!render.running)
+		return;
+
+	render.root = root;
+	damage_add(render.damage, area);
+}
+
+void render_thread_mark_input(uint64_t stamp_ns)
+{
+	if (!render.running)
+		return;
+
+	if (!render.input_ns || stamp_ns < render.input_ns)
+		render.input_ns = stamp_ns;
+}
+
+bool render_thread_publish(void)
+{
+	struct s_render_frame * frame;
+	bool reclaimed;
+	uint64_t start;
+	size_t i;
+
+	if (!render.running || !render.root || !damage_count(render.damage))
+		return false;
+
+	start = now_ns();
+
+	/* A published frame the render thread did not take yet is taken back, the new
+	 * one redraws its damage too. */
+	pthread_mutex_lock(&render.mutex);
+	reclaimed = render.ready_fresh;
+	if (reclaimed)
+	{
+		frame = render.ready;
+		render.ready = render.building;
+		render.building = frame;
+		render.ready_fresh = false;
+		render.stats.reclaimed++;
+	}
+	pthread_mutex_unlock(&render.mutex);
+
+	frame = render.building;
+
+	if (reclaimed)
+	{
+		for (i = 0; i < damage_count(frame->damage); i++)
+			damage_add(render.damage, damage_area(frame->damage, i));
+		if (frame->input_ns && (!render.input_ns || frame->input_ns < render.input_ns))
+			render.input_ns = frame->input_ns;
+	}
+
+	damage_clear(frame->damage);
+	frame->input_ns = 0;
+
+	/* The damage is kept for the next frame when recording fails. */
+	if (!display_list_record_damage(frame->list, render.root, render.damage))
+		return false;
+
+	for (i = 0; i < damage_count(render.damage); i++)
+		damage_add(frame->damage, damage_area(render.damage, i));
+	frame->input_ns = render.input_ns;
+
+	damage_clear(render.damage);
+	render.input_ns = 0;
+
+	pthread_mutex_lock(&render.mutex);
+	render.building = render.ready;
+	render.ready = frame;
+	render.ready_fresh = true;
+	render.stats.published++;
+	render.stats.record_ns += now_ns() - start;
+	pthread_cond_signal(&render.published_cond);
+	pthread_mutex_unlock(&render.mutex);
+
+	return true;
+}
+
+void render_thread_flush(void)
+{
+	if (!render.running)
+		return;
+
+	pthread_mutex_lock(&render.mutex);
+	while (render.ready_fresh || render.rendering)
+		pthread_cond_wait(&render.presented_cond, &render.mutex);
+	pthread_mutex_unlock(&render.mutex);
+}
+
+void render_thread_stats(render_thread_stats_t * tgt)
+{
+	PTR_CHECK(tgt, "render_thread");
+
+	if (!render.running)
+	{
+		memset(tgt, 0, sizeof(*tgt));
+		return;
+	}
+
+	pthread_mutex_lock(&render.mutex);
+	*tgt = render.stats;
+	pthread_mutex_unlock(&render.mutex);
+}
+
+void render_thread_reset_stats(void)
+{
+	if (!render.running)
+		return;
+
+	pthread_mutex_lock(&render.mutex);
+	memset(&render.stats, 0, sizeof(render.stats));
+	pthread_mutex_unlock(&render.mutex);
+}
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef RENDER_THREAD_H_
+#define RENDER_THREAD_H_
+
+#include "types.h"
+
+/*
+ * Rasterization pipelined on its own thread. While running, the thread using the
+ * widgets, the UI thread, no longer draws: widget_redraw_area and widget_tree_draw
+ * only add their area to the damage of the frame being built. render_thread_publish
+ * ends that frame, recording the widgets under its damage into a display list, the
+ * immutable snapshot of the frame with resolved geometry, colors and sources, and
+ * hands it to the render thread, which executes it through the software operations
+ * and informs the framebuffer of each damaged area. The UI thread goes on with the
+ * next frame meanwhile.
+ *
+ * Frames change hands through three slots, one being built, one published and one
+ * being presented, so neither thread waits for the other's work. A frame still
+ * unpresented when the next one is published is taken back and its damage merged
+ * into the new one, nothing is lost and the render thread always gets the latest.
+ *
+ * Drawing sources, bitmaps and fonts, are referenced by the snapshot and must
+ * outlive it. The render thread lifts the sprites under the damage before a frame
+ * and drops them after, sprite changes wait for the frames in flight first.
+ */
+
+void render_thread_start(void);
+/* Publishes the pending damage and returns once the render thread presented it. */
+void render_thread_stop(void);
+bool render_thread_running(void);
+
+/* From the UI thread. The last root given draws the whole frame's damage. */
+void render_thread_damage(widget_t * root, const area_t * area);
+/* The frame being built answers an input received at stamp_ns, on CLOCK_MONOTONIC,
+ * the input to present latency is measured from the earliest stamp of a frame. */
+void render_thread_mark_input(uint64_t stamp_ns);
+/* Returns false when there was nothing to publish. */
+bool render_thread_publish(void);
+/* Waits until every published frame is presented. */
+void render_thread_flush(void);
+
+void render_thread_stats(render_thread_stats_t * tgt);
+void render_thread_reset_stats(void);
+
+#endif /* RENDER_THREAD_H_ */
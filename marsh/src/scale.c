@@ -0,0 +1,370 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "helper/checks.h"
+
+#include "framebuffer.h"
+#include "pixel_convert.h"
+#include "pixel_format.h"
+#include "scale.h"
+#include "bitmap_data/bitmap_data.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SCALE_X86
+#include <emmintrin.h>
+#endif
+
+/* Destination columns of a pass, and most source columns its bilinear rows read. */
+#define PASS_COLUMNS        256
+#define PASS_SOURCE_COLUMNS 512
+
+/* a to b by weight 256ths. */
+#define MIX(a, b, weight) ((uint16_t)(((uint32_t)(a) * (256 - (uint32_t)(weight)) + (uint32_t)(b) * (uint32_t)(weight)) >> 8))
+
+void scale_fit(scale_t * scale, dim_t width, dim_t height)
+{
+	PTR_CHECK(scale, "scale");
+
+	if (width <= 0 || height <= 0)
+		return;
+
+	scale->step_x = (int32_t)(((uint32_t)scale->width << SCALE_FIXED_SHIFT) / (uint32_t)width);
+	scale->step_y = (int32_t)(((uint32_t)scale->height << SCALE_FIXED_SHIFT) / (uint32_t)height);
+
+	/* Destination pixel centers, bilinear weights counting from source pixel centers. */
+	scale->x = scale->step_x / 2;
+	scale->y = scale->step_y / 2;
+	if (scale->filter == SCALE_BILINEAR)
+	{
+		scale->x -= SCALE_FIXED_ONE / 2;
+		scale->y -= SCALE_FIXED_ONE / 2;
+	}
+}
+
+void scale_skip(scale_t * scale, dim_t columns, dim_t rows)
+{
+	PTR_CHECK(scale, "scale");
+
+	scale->x = (int32_t)((int64_t)scale->x + (int64_t)columns * scale->step_x);
+	scale->y = (int32_t)((int64_t)scale->y + (int64_t)rows * scale->step_y);
+}
+
+bitmap_t * scale_pick_level(bitmap_levels_t * levels, dim_t width, dim_t height)
+{
+	bitmap_t * picked;
+	uint32_t i;
+
+	PTR_CHECK_RETURN(levels, "scale", NULL);
+
+	if (levels->count == 0)
+		return NULL;
+
+	picked = levels->levels[0];
+	for (i = 1; i < levels->count; i++)
+	{
+		if ((dim_t)levels->levels[i]->width < width || (dim_t)levels->levels[i]->height < height)
+			break;
+		picked = levels->levels[i];
+	}
+
+	return picked;
+}
+
+static inline dim_t nearest_of(int64_t position, dim_t size)
+{
+	int64_t pixel = position < 0 ? 0 : position >> SCALE_FIXED_SHIFT;
+
+	return pixel >= size ? size - 1 : (dim_t)pixel;
+}
+
+/* First of the two source pixels blended and the weight of the second. */
+static inline void bilinear_of(int64_t position, dim_t size, dim_t * first, uint16_t * weight)
+{
+	*first = position < 0 ? 0 : (dim_t)(position >> SCALE_FIXED_SHIFT);
+	*weight = position < 0 ? 0 : (uint16_t)(position >> 8 & 0xFF);
+
+	if (*first >= size - 1)
+	{
+		*first = size - 1;
+		*weight = 0;
+	}
+}
+
+static void nearest_rows(pixel_t * dst, size_t stride, const scale_t * scale, const dim_t * columns, dim_t count, dim_t height)
+{
+	const uint8_t red = PIXEL_RED(scale->color), green = PIXEL_GREEN(scale->color), blue = PIXEL_BLUE(scale->color);
+	const uint8_t * bytes = (const uint8_t *)scale->pixels;
+	const pixel_t * pixels = (const pixel_t *)scale->pixels;
+	pixel_t pixel;
+	uint8_t alpha;
+	size_t row;
+	dim_t i, j;
+
+	for (i = 0; i < height; i++, dst += stride)
+	{
+		row = (size_t)nearest_of((int64_t)scale->y + (int64_t)i * scale->step_y, scale->height) * scale->stride;
+
+		switch (scale->source)
+		{
+		case SCALE_SOURCE_A8:
+			for (j = 0; j < count; j++)
+			{
+				alpha = bytes[row + columns[j]];
+				if (alpha == 0xFF)
+					dst[j] = scale->color;
+				else if (alpha > 0x00)
+				{
+					pixel = dst[j];
+					dst[j] = PIXEL_PACK(PIXEL_BLEND_CHANNEL(PIXEL_RED(pixel), red, alpha),
+							PIXEL_BLEND_CHANNEL(PIXEL_GREEN(pixel), green, alpha),
+							PIXEL_BLEND_CHANNEL(PIXEL_BLUE(pixel), blue, alpha));
+				}
+			}
+			break;
+		case SCALE_SOURCE_INDEXED4:
+			for (j = 0; j < count; j++)
+				dst[j] = scale->palette[BITMAP_INDEXED4_AT(bytes, row + columns[j])];
+			break;
+		case SCALE_SOURCE_INDEXED8:
+			for (j = 0; j < count; j++)
+				dst[j] = scale->palette[bytes[row + columns[j]]];
+			break;
+		case SCALE_SOURCE_NATIVE:
+		default:
+			for (j = 0; j < count; j++)
+				dst[j] = pixels[row + columns[j]];
+			break;
+		}
+	}
+}
+
+#ifdef SCALE_X86
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
+
+/* 5 or 6 bit channel at shift widened as RGB565_RED and the others do, its low bits
+ * copying the source bit at low_bit. */
+#define WIDEN_565(pixels, channel, low_bit, fill) \
+	_mm_or_si128(channel, _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(pixels, low_bit), _mm_set1_epi16(1)), _mm_set1_epi16(fill)))
+
+/* Eight pixels a step, returns the pixels done. */
+static dim_t vertical_565_sse2(const pixel_t * top, const pixel_t * bottom, uint16_t weight, dim_t count, uint16_t (*channels)[PASS_SOURCE_COLUMNS + 1])
+{
+	const __m128i top_weight = _mm_set1_epi16((short)(256 - weight)), bottom_weight = _mm_set1_epi16((short)weight);
+	__m128i t, b, ct, cb;
+	dim_t k;
+
+	for (k = 0; k + 8 <= count; k += 8)
+	{
+		t = _mm_loadu_si128((const __m128i *)(top + k));
+		b = _mm_loadu_si128((const __m128i *)(bottom + k));
+
+		ct = WIDEN_565(t, _mm_and_si128(_mm_srli_epi16(t, 8), _mm_set1_epi16(0xF8)), 11, 0x07);
+		cb = WIDEN_565(b, _mm_and_si128(_mm_srli_epi16(b, 8), _mm_set1_epi16(0xF8)), 11, 0x07);
+		_mm_storeu_si128((__m128i *)(channels[0] + k),
+				_mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(ct, top_weight), _mm_mullo_epi16(cb, bottom_weight)), 8));
+
+		ct = WIDEN_565(t, _mm_and_si128(_mm_srli_epi16(t, 3), _mm_set1_epi16(0xFC)), 5, 0x03);
+		cb = WIDEN_565(b, _mm_and_si128(_mm_srli_epi16(b, 3), _mm_set1_epi16(0xFC)), 5, 0x03);
+		_mm_storeu_si128((__m128i *)(channels[1] + k),
+				_mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(ct, top_weight), _mm_mullo_epi16(cb, bottom_weight)), 8));
+
+		ct = WIDEN_565(t, _mm_and_si128(_mm_slli_epi16(t, 3), _mm_set1_epi16(0xF8)), 6, 0x07);
+		cb = WIDEN_565(b, _mm_and_si128(_mm_slli_epi16(b, 3), _mm_set1_epi16(0xF8)), 6, 0x07);
+		_mm_storeu_si128((__m128i *)(channels[2] + k),
+				_mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(ct, top_weight), _mm_mullo_epi16(cb, bottom_weight)), 8));
+	}
+
+	return k;
+}
+
+#endif
+
+/* Sixteen alphas a step, returns the alphas done. */
+static dim_t vertical_a8_sse2(const uint8_t * top, const uint8_t * bottom, uint16_t weight, dim_t count, uint16_t * alpha)
+{
+	const __m128i top_weight = _mm_set1_epi16((short)(256 - weight)), bottom_weight = _mm_set1_epi16((short)weight);
+	const __m128i zero = _mm_setzero_si128();
+	__m128i t, b;
+	dim_t k;
+
+	for (k = 0; k + 16 <= count; k += 16)
+	{
+		t = _mm_loadu_si128((const __m128i *)(top + k));
+		b = _mm_loadu_si128((const __m128i *)(bottom + k));
+
+		_mm_storeu_si128((__m128i *)(alpha + k), _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(t, zero), top_weight),
+				_mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), bottom_weight)), 8));
+		_mm_storeu_si128((__m128i *)(alpha + k + 8), _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(t, zero), top_weight),
+				_mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), bottom_weight)), 8));
+	}
+
+	return k;
+}
+
+#endif /* SCALE_X86 */
+
+/* Source row span as pixels, indexed ones expanded into scratch. */
+static const pixel_t * span_pixels(const scale_t * scale, dim_t row, dim_t first, dim_t count, pixel_t * scratch)
+{
+	size_t index = (size_t)row * scale->stride + first;
+
+	if (scale->source == SCALE_SOURCE_NATIVE)
+		return (const pixel_t *)scale->pixels + index;
+
+	framebuffer_ops_software()->expand_indexed(scratch, 0, (const uint8_t *)scale->pixels, index, scale->stride,
+			scale->source == SCALE_SOURCE_INDEXED4 ? 4 : 8, scale->palette, count, 1);
+
+	return scratch;
+}
+
+/* Blends the source rows top and bottom over the span into 8 bit channels, A8 sources
+ * into the first one, then each destination pixel from the two channel columns around
+ * its sample. A span one past the source edge repeats its last column. */
+static void bilinear_rows(pixel_t * dst, size_t stride, const scale_t * scale, const dim_t * columns, const uint16_t * weights,
+		dim_t count, dim_t height, bool simd)
+{
+	const uint8_t red = PIXEL_RED(scale->color), green = PIXEL_GREEN(scale->color), blue = PIXEL_BLUE(scale->color);
+	uint16_t channels[3][PASS_SOURCE_COLUMNS + 1];
+	pixel_t top_scratch[PASS_SOURCE_COLUMNS], bottom_scratch[PASS_SOURCE_COLUMNS];
+	const dim_t first = columns[0];
+	dim_t span = columns[count - 1] + 2 - first;
+	dim_t top, bottom, last_top = -1, i, j, k, c;
+	uint16_t weight, last_weight = 0, alpha;
+	const uint8_t * top_alpha, * bottom_alpha;
+	const pixel_t * top_pixels, * bottom_pixels;
+	pixel_t pixel;
+
+	if (first + span > scale->width)
+		span = scale->width - first;
+
+	for (i = 0; i < height; i++, dst += stride)
+	{
+		bilinear_of((int64_t)scale->y + (int64_t)i * scale->step_y, scale->height, &top, &weight);
+		bottom = top + 1 < scale->height ? top + 1 : top;
+
+		/* Rows magnified from the same source rows share their vertical pass. */
+		if (top != last_top || weight != last_weight)
+		{
+			k = 0;
+
+			if (scale->source == SCALE_SOURCE_A8)
+			{
+				top_alpha = (const uint8_t *)scale->pixels + (size_t)top * scale->stride + first;
+				bottom_alpha = (const uint8_t *)scale->pixels + (size_t)bottom * scale->stride + first;
+#ifdef SCALE_X86
+				if (simd)
+					k = vertical_a8_sse2(top_alpha, bottom_alpha, weight, span, channels[0]);
+#endif
+				for (; k < span; k++)
+					channels[0][k] = MIX(top_alpha[k], bottom_alpha[k], weight);
+				channels[0][span] = channels[0][span - 1];
+			}
+			else
+			{
+				top_pixels = span_pixels(scale, top, first, span, top_scratch);
+				bottom_pixels = span_pixels(scale, bottom, first, span, bottom_scratch);
+#if defined(SCALE_X86) && MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
+				if (simd)
+					k = vertical_565_sse2(top_pixels, bottom_pixels, weight, span, channels);
+#endif
+				for (; k < span; k++)
+				{
+					channels[0][k] = MIX(PIXEL_RED(top_pixels[k]), PIXEL_RED(bottom_pixels[k]), weight);
+					channels[1][k] = MIX(PIXEL_GREEN(top_pixels[k]), PIXEL_GREEN(bottom_pixels[k]), weight);
+					channels[2][k] = MIX(PIXEL_BLUE(top_pixels[k]), PIXEL_BLUE(bottom_pixels[k]), weight);
+				}
+				for (c = 0; c < 3; c++)
+					channels[c][span] = channels[c][span - 1];
+			}
+
+			last_top = top;
+			last_weight = weight;
+		}
+
+		if (scale->source == SCALE_SOURCE_A8)
+		{
+			for (j = 0; j < count; j++)
+			{
+				k = columns[j] - first;
+				alpha = MIX(channels[0][k], channels[0][k + 1], weights[j]);
+				if (alpha == 0xFF)
+					dst[j] = scale->color;
+				else if (alpha > 0x00)
+				{
+					pixel = dst[j];
+					dst[j] = PIXEL_PACK(PIXEL_BLEND_CHANNEL(PIXEL_RED(pixel), red, alpha),
+							PIXEL_BLEND_CHANNEL(PIXEL_GREEN(pixel), green, alpha),
+							PIXEL_BLEND_CHANNEL(PIXEL_BLUE(pixel), blue, alpha));
+				}
+			}
+		}
+		else
+		{
+			for (j = 0; j < count; j++)
+			{
+				k = columns[j] - first;
+				dst[j] = PIXEL_PACK(MIX(channels[0][k], channels[0][k + 1], weights[j]),
+						MIX(channels[1][k], channels[1][k + 1], weights[j]),
+						MIX(channels[2][k], channels[2][k + 1], weights[j]));
+			}
+		}
+	}
+}
+
+void scale_software(pixel_t * dst, size_t stride, const scale_t * scale, dim_t width, dim_t height)
+{
+	dim_t columns[PASS_COLUMNS];
+	uint16_t weights[PASS_COLUMNS];
+	bool simd = false;
+	dim_t done, count;
+
+	PTR_CHECK(scale, "scale");
+
+	if (scale->width <= 0 || scale->height <= 0)
+		return;
+
+#ifdef SCALE_X86
+	simd = pixel_convert_isa() >= PIXEL_CONVERT_SSSE3;
+#endif
+
+	for (done = 0; done < width; done += count)
+	{
+		if (scale->filter == SCALE_NEAREST)
+		{
+			for (count = 0; count < PASS_COLUMNS && done + count < width; count++)
+				columns[count] = nearest_of((int64_t)scale->x + (int64_t)(done + count) * scale->step_x, scale->width);
+
+			nearest_rows(dst + done, stride, scale, columns, count, height);
+			continue;
+		}
+
+		/* As many columns as the span of the source keeps. */
+		for (count = 0; count < PASS_COLUMNS && done + count < width; count++)
+		{
+			bilinear_of((int64_t)scale->x + (int64_t)(done + count) * scale->step_x, scale->width, &columns[count], &weights[count]);
+			if (count && columns[count] + 2 - columns[0] > PASS_SOURCE_COLUMNS)
+				break;
+		}
+
+		bilinear_rows(dst + done, stride, scale, columns, weights, count, height, simd);
+	}
+}
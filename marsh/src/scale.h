@@ -0,0 +1,54 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef SCALE_H_
+#define SCALE_H_
+
+#include "types.h"
+
+/*
+ * Bitmaps drawn at another size. A scale_t names the source and where destination
+ * pixels sample it: the first one at x, y and each next one step_x or step_y further,
+ * in 16.16 fixed point source pixels. SCALE_NEAREST takes the source pixel under the
+ * sample, SCALE_BILINEAR weighs the four around it with 8 bit weights, the edge pixels
+ * repeating outward. A8 sources blend their color over the destination, the others
+ * replace it.
+ */
+
+#define SCALE_FIXED_SHIFT 16
+#define SCALE_FIXED_ONE   (1 << SCALE_FIXED_SHIFT)
+
+/* Samples the pixel centers of the source stretched over width by height pixels, the
+ * source and filter being already set. */
+void scale_fit(scale_t * scale, dim_t width, dim_t height);
+/* Moves the first sample columns and rows of destination pixels further, for a
+ * destination clipped on its top left. */
+void scale_skip(scale_t * scale, dim_t columns, dim_t rows);
+
+/* Smallest level covering width by height, drawn as it is when the same size and
+ * shrunk otherwise, the largest one when none covers it. */
+bitmap_t * scale_pick_level(bitmap_levels_t * levels, dim_t width, dim_t height);
+
+/* The software kernel. Column positions are computed once per pass and shared by its
+ * rows, the bilinear vertical pass is done in SSE2 for RGB565 and A8 sources. */
+void scale_software(pixel_t * dst, size_t stride, const scale_t * scale, dim_t width, dim_t height);
+
+#endif /* SCALE_H_ */
@@ -0,0 +1,331 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "helper/checks.h"
+#include "helper/number.h"
+#include "helper/log.h"
+
+#include "animation.h"
+#include "area.h"
+#include "canvas.h"
+#include "color.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "render_thread.h"
+#include "scroll_view.h"
+#include "signalslot.h"
+#include "sprite.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+
+#define FLING_FRICTION_PER_SECOND 4   // Velocity loses FRICTION times itself per second.
+#define FLING_STOP_VELOCITY       20  // Pixels per second.
+
+struct s_scroll_view
+{
+	color_t background;
+	char background_html[COLOR_HTML_CODE_SIZE];
+	bool has_background;
+
+	dim_t content_width;
+	dim_t content_height;
+	point_t offset;
+
+	/* Fling state, velocities in pixels per second and position in Q16 pixels. */
+	bool flinging;
+	int32_t velocity_x;
+	int32_t velocity_y;
+	int64_t fling_x;
+	int64_t fling_y;
+
+	signal_t * scroll_signal;
+	widget_t * glyph;
+};
+
+static void draw(scroll_view_t * obj, const area_t * limiting_canvas_area)
+{
+	canvas_t * canv;
+
+	PTR_CHECK(obj, "scroll_view");
+
+	if (!obj->has_background)
+		return;
+
+	canv = canvas_new_clipped(widget_area(obj->glyph), limiting_canvas_area);
+	draw_solid_rectangle(canv, color_to_pixel(obj->background));
+	canvas_delete(canv);
+}
+
+static dim_t clamp(dim_t value, dim_t content, dim_t view)
+{
+	dim_t max = get_bigger(content - view, 0);
+
+	if (value < 0)
+		return 0;
+	if (value > max)
+		return max;
+
+	return value;
+}
+
+static void redraw_strip(widget_t * root, dim_t x, dim_t y, dim_t width, dim_t height)
+{
+	area_t strip;
+
+	area_set(&strip, x, y, width, height);
+	widget_redraw_area(root, &strip);
+}
+
+/* Content moved by dx, dy: move what is on screen and draw what was exposed. */
+static void scroll_pixels(scroll_view_t * obj, dim_t dx, dim_t dy)
+{
+	widget_t * root = widget_root(obj->glyph);
+	area_t view;
+	canvas_t * canv;
+
+	if (!widget_visible(obj->glyph) || !widget_tree_ancestors_visible(obj->glyph))
+		return;
+
+	/* Pixels on screen may not match the widgets until the commit, let it redraw.
+	 * Out of a transaction only counted, for display lists to record the change. */
+	widget_invalidate(obj->glyph);
+	if (widget_update_in_progress())
+		return;
+
+	view = widget_tree_ancestors_intersection_canvas_area(obj->glyph);
+	area_set_intersection(&view, &view, framebuffer_area());
+
+	if (!area_value(&view))
+		return;
+
+	/* Moving the view would move the pixels of a widget over or under it too, of an
+	 * ancestor showing through a view without background, or pixels the render thread
+	 * has not drawn yet. */
+	if (get_abs(dx) >= view.width || get_abs(dy) >= view.height || !obj->has_background || render_thread_running()
+			|| widget_tree_overlapped(obj->glyph, &view))
+	{
+		widget_redraw_area(root, &view);
+		return;
+	}
+
+	sprite_overlay_lift(&view);
+	canv = canvas_new(&view);
+	draw_move_region(canv, dx, dy);
+	canvas_delete(canv);
+	sprite_overlay_drop();
+
+	if (dy > 0)
+		redraw_strip(root, view.x, view.y, view.width, dy);
+	else if (dy < 0)
+		redraw_strip(root, view.x, view.y + view.height + dy, view.width, -dy);
+
+	/* Vertical strip, without the lines already drawn by the horizontal one. */
+	if (dx > 0)
+		redraw_strip(root, view.x, view.y + get_bigger(dy, 0), dx, view.height - get_abs(dy));
+	else if (dx < 0)
+		redraw_strip(root, view.x + view.width + dx, view.y + get_bigger(dy, 0), -dx, view.height - get_abs(dy));
+
+	framebuffer_inform_written_area(view.x, view.y, view.width, view.height);
+}
+
+static void scroll(scroll_view_t * obj, dim_t x, dim_t y)
+{
+	dim_t dx, dy;
+
+	x = clamp(x, obj->content_width, widget_area(obj->glyph)->width);
+	y = clamp(y, obj->content_height, widget_area(obj->glyph)->height);
+
+	if (x == obj->offset.x && y == obj->offset.y)
+		return;
+
+	dx = obj->offset.x - x;
+	dy = obj->offset.y - y;
+	point_set(&obj->offset, x, y);
+
+	widget_tree_translate_children(obj->glyph, dx, dy);
+	signal_emit(obj->scroll_signal);
+	scroll_pixels(obj, dx, dy);
+}
+
+static int32_t decay(int32_t velocity, uint32_t elapsed_ms)
+{
+	if (elapsed_ms * FLING_FRICTION_PER_SECOND >= 1000)
+		return 0;
+
+	velocity -= (int32_t)((int64_t)velocity * elapsed_ms * FLING_FRICTION_PER_SECOND / 1000);
+
+	if (get_abs(velocity) < FLING_STOP_VELOCITY)
+		return 0;
+
+	return velocity;
+}
+
+static bool fling_step(scroll_view_t * obj, uint32_t elapsed_ms)
+{
+	if (!obj->flinging)
+		return false;
+
+	obj->fling_x += ((int64_t)obj->velocity_x << 16) * elapsed_ms / 1000;
+	obj->fling_y += ((int64_t)obj->velocity_y << 16) * elapsed_ms / 1000;
+
+	scroll(obj, (dim_t)(obj->fling_x >> 16), (dim_t)(obj->fling_y >> 16));
+
+	/* An edge stops the motion along its axis. */
+	if ((obj->fling_x >> 16) != obj->offset.x)
+		obj->velocity_x = 0;
+	if ((obj->fling_y >> 16) != obj->offset.y)
+		obj->velocity_y = 0;
+
+	obj->velocity_x = decay(obj->velocity_x, elapsed_ms);
+	obj->velocity_y = decay(obj->velocity_y, elapsed_ms);
+
+	if (!obj->velocity_x && !obj->velocity_y)
+		obj->flinging = false;
+
+	return obj->flinging;
+}
+
+scroll_view_t * scroll_view_new(widget_t * parent)
+{
+	scroll_view_t * obj = (scroll_view_t *)calloc(1, sizeof(struct s_scroll_view));
+	MEMORY_ALLOC_CHECK_RETURN(obj, NULL);
+
+	obj->glyph = widget_new(parent, obj, (void(*)(void *, const area_t *))draw, (void(*)(void *))scroll_view_delete);
+	obj->background = color_null();
+	obj->scroll_signal = signal_new();
+
+	return obj;
+}
+
+void scroll_view_delete(scroll_view_t * obj)
+{
+	PTR_CHECK(obj, "scroll_view");
+
+	widget_delete_instance_only(obj->glyph);
+	signal_delete(obj->scroll_signal);
+
+	free(obj);
+}
+
+void scroll_view_set_position(scroll_view_t * obj, dim_t x, dim_t y)
+{
+	const area_t * area;
+
+	PTR_CHECK(obj, "scroll_view");
+
+	area = widget_area(obj->glyph);
+	widget_tree_translate_children(obj->glyph, x - area->x, y - area->y);
+	widget_set_pos(obj->glyph, x, y);
+}
+
+void scroll_view_set_size(scroll_view_t * obj, dim_t width, dim_t height)
+{
+	PTR_CHECK(obj, "scroll_view");
+
+	widget_set_dim(obj->glyph, width, height);
+	scroll(obj, obj->offset.x, obj->offset.y);
+}
+
+void scroll_view_set_content_size(scroll_view_t * obj, dim_t width, dim_t height)
+{
+	PTR_CHECK(obj, "scroll_view");
+
+	obj->content_width = width;
+	obj->content_height = height;
+	scroll(obj, obj->offset.x, obj->offset.y);
+}
+
+void scroll_view_set_background_color_html(scroll_view_t * obj, const char * html_color_code)
+{
+	PTR_CHECK(obj, "scroll_view");
+
+	if (!color_html_cache_update(obj->background_html, html_color_code) && obj->has_background)
+		return;
+
+	widget_invalidate(obj->glyph);
+
+	obj->background = color_html(html_color_code);
+	obj->has_background = true;
+}
+
+void scroll_view_scroll_to(scroll_view_t * obj, dim_t x, dim_t y)
+{
+	PTR_CHECK(obj, "scroll_view");
+
+	obj->flinging = false;
+	scroll(obj, x, y);
+}
+
+void scroll_view_scroll_by(scroll_view_t * obj, dim_t dx, dim_t dy)
+{
+	PTR_CHECK(obj, "scroll_view");
+
+	scroll_view_scroll_to(obj, obj->offset.x + dx, obj->offset.y + dy);
+}
+
+point_t scroll_view_offset(const scroll_view_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "scroll_view", ((point_t){0, 0}));
+
+	return obj->offset;
+}
+
+void scroll_view_fling(scroll_view_t * obj, int32_t velocity_x, int32_t velocity_y)
+{
+	PTR_CHECK(obj, "scroll_view");
+
+	obj->velocity_x = velocity_x;
+	obj->velocity_y = velocity_y;
+	obj->fling_x = (int64_t)obj->offset.x << 16;
+	obj->fling_y = (int64_t)obj->offset.y << 16;
+	obj->flinging = true;
+
+	animation_frame(obj->glyph, obj, (animation_frame_f)fling_step);
+}
+
+void scroll_view_stop(scroll_view_t * obj)
+{
+	PTR_CHECK(obj, "scroll_view");
+
+	obj->flinging = false;
+}
+
+bool scroll_view_flinging(const scroll_view_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "scroll_view", false);
+
+	return obj->flinging;
+}
+
+signal_t * scroll_view_scroll_signal(scroll_view_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "scroll_view", NULL);
+
+	return obj->scroll_signal;
+}
+
+widget_t * scroll_view_get_widget(scroll_view_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "scroll_view", NULL);
+
+	return obj->glyph;
+}
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef SCROLL_VIEW_H_
+#define SCROLL_VIEW_H_
+
+#include "types.h"
+
+/*
+ * Scroll view clips its children to its area and scrolls them over a content of a
+ * given size. Children are placed in framebuffer coordinates as usual, for a scroll
+ * offset of 0, 0.
+ *
+ * Scrolling moves the pixels already rendered inside the view and redraws only the
+ * exposed strips, so it costs proportionally to the scrolled distance rather than to
+ * the view size. While widgets not descending from the view overlap it, or while
+ * the render thread runs, scrolling redraws the whole view instead. So does it
+ * without a background color, the ancestors under the view showing through. Sprites
+ * are kept on top of the moved pixels.
+ *
+ * A fling keeps scrolling with decaying velocity, stepped by animation_tick.
+ */
+
+scroll_view_t * scroll_view_new(widget_t * parent);
+void scroll_view_delete(scroll_view_t * obj);
+
+void scroll_view_set_position(scroll_view_t * obj, dim_t x, dim_t y);
+void scroll_view_set_size(scroll_view_t * obj, dim_t width, dim_t height);
+void scroll_view_set_content_size(scroll_view_t * obj, dim_t width, dim_t height);
+void scroll_view_set_background_color_html(scroll_view_t * obj, const char * html_color_code);
+
+void scroll_view_scroll_to(scroll_view_t * obj, dim_t x, dim_t y);
+void scroll_view_scroll_by(scroll_view_t * obj, dim_t dx, dim_t dy);
+point_t scroll_view_offset(const scroll_view_t * obj);
+
+/* Velocities in pixels per second, in content direction (positive scrolls forward). */
+void scroll_view_fling(scroll_view_t * obj, int32_t velocity_x, int32_t velocity_y);
+void scroll_view_stop(scroll_view_t * obj);
+bool scroll_view_flinging(const scroll_view_t * obj);
+
+/* Emitted when the offset changes, after the children are moved and before the
+ * exposed strips are drawn, so they can be updated (e.g. recycled list rows). */
+signal_t * scroll_view_scroll_signal(scroll_view_t * obj);
+
+widget_t * scroll_view_get_widget(scroll_view_t * obj);
+
+#endif /* SCROLL_VIEW_H_ */
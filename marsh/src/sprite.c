@@ -0,0 +1,347 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "canvas.h"
+#include "color.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "pixel_format.h"
+#include "render_thread.h"
+#include "sprite.h"
+#include "bitmap_data/bitmap_data.h"
+
+struct s_sprite
+{
+	/* As given, and in the framebuffer format, see pixel_format_bitmap_new. */
+	bitmap_t * source;
+	bitmap_t * bitmap;
+	color_t color;
+	char color_html[COLOR_HTML_CODE_SIZE];
+
+	area_t area;
+	bool visible;
+
+	/* Framebuffer pixels under the sprite, valid while it is dropped. */
+	bool dropped;
+	area_t saved_area;
+	pixel_t * save_under;
+
+	sprite_t * next; // Next sprite above this one.
+};
+
+static sprite_t * sprite_list = NULL; // Bottom of the plane.
+
+static void blit(sprite_t * obj)
+{
+	canvas_t * canv = canvas_new(&obj->area);
+	PTR_CHECK(canv, "sprite");
+
+	switch (obj->bitmap->bitmap_data_width)
+	{
+	case BITMAP_BUFFER_1BPP:
+		draw_bitmap_1bpp(canv, color_to_pixel(obj->color), (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 0, 0, obj->bitmap->width, obj->bitmap->height);
+		break;
+	case BITMAP_BUFFER_8BPP:
+		draw_alpha_bitmap_8bpp(canv, color_to_pixel(obj->color), (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 0, 0, obj->bitmap->width, obj->bitmap->height);
+		break;
+	case BITMAP_BUFFER_8BPP_RLE:
+		draw_alpha_bitmap_8bpp_rle(canv, color_to_pixel(obj->color), (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 0, 0, obj->bitmap->width, obj->bitmap->height);
+		break;
+	case BITMAP_BUFFER_NATIVE:
+		draw_bitmap_native(canv, (const pixel_t *)obj->bitmap->bitmap, 0, 0, obj->bitmap->width, obj->bitmap->height);
+		break;
+	case BITMAP_BUFFER_INDEXED4:
+		draw_bitmap_indexed(canv, (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 4, obj->bitmap->palette, 0, 0, obj->bitmap->width, obj->bitmap->height);
+		break;
+	case BITMAP_BUFFER_INDEXED8:
+		draw_bitmap_indexed(canv, (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 8, obj->bitmap->palette, 0, 0, obj->bitmap->width, obj->bitmap->height);
+		break;
+	case BITMAP_BUFFER_16BPP:
+	default:
+		draw_bitmap(canv, (BUFFER_PTR_RDOLY)obj->bitmap->bitmap, 0, 0, obj->bitmap->width, obj->bitmap->height);
+		break;
+	}
+
+	canvas_delete(canv);
+}
+
+static void drop(sprite_t * obj)
+{
+	if (!obj->visible || obj->dropped)
+		return;
+
+	area_set_intersection(&obj->saved_area, &obj->area, framebuffer_area());
+
+	if (area_value(&obj->saved_area))
+		framebuffer_ops()->blit(obj->save_under, obj->saved_area.width, framebuffer_at(obj->saved_area.x, obj->saved_area.y),
+				framebuffer_stride(), obj->saved_area.width, obj->saved_area.height);
+
+	blit(obj);
+	obj->dropped = true;
+}
+
+static void lift(sprite_t * obj)
+{
+	if (!obj->dropped)
+		return;
+
+	if (area_value(&obj->saved_area))
+		framebuffer_ops()->blit(framebuffer_at(obj->saved_area.x, obj->saved_area.y), framebuffer_stride(), obj->save_under,
+				obj->saved_area.width, obj->saved_area.width, obj->saved_area.height);
+
+	obj->dropped = false;
+}
+
+/* Lifts obj and every sprite above it, top first, so each restore sees the pixels it saved. */
+static void lift_from(sprite_t * obj)
+{
+	if (!obj)
+		return;
+
+	lift_from(obj->next);
+	lift(obj);
+}
+
+static void inform_changed(const area_t * old_area, const area_t * new_area)
+{
+	area_t written;
+
+	if (area_intersects(old_area, new_area))
+	{
+		area_set_union(&written, old_area, new_area);
+		framebuffer_inform_written_area(written.x, written.y, written.width, written.height);
+		return;
+	}
+
+	if (area_value(old_area))
+		framebuffer_inform_written_area(old_area->x, old_area->y, old_area->width, old_area->height);
+
+	if (area_value(new_area))
+		framebuffer_inform_written_area(new_area->x, new_area->y, new_area->width, new_area->height);
+}
+
+/* Removes obj and what is above it from the framebuffer, lets change modify it, and composes everything back. */
+static void restack(sprite_t * obj, void (*change)(sprite_t *, const void *), const void * arg)
+{
+	area_t old_area;
+
+	/* The render thread lifts and drops the sprites around its frames. */
+	render_thread_flush();
+
+	area_clear(&old_area);
+	if (obj->dropped)
+		old_area = obj->saved_area;
+
+	lift_from(obj);
+	change(obj, arg);
+	sprite_overlay_drop();
+
+	if (!obj->dropped)
+		area_clear(&obj->saved_area);
+
+	inform_changed(&old_area, &obj->saved_area);
+}
+
+sprite_t * sprite_new(bitmap_t * bitmap)
+{
+	sprite_t * obj;
+	sprite_t * last;
+
+	PTR_CHECK_RETURN(bitmap, "sprite", NULL);
+
+	obj = (sprite_t *)calloc(1, sizeof(struct s_sprite));
+	MEMORY_ALLOC_CHECK_RETURN(obj, NULL);
+
+	obj->save_under = (pixel_t *)malloc(bitmap->width * bitmap->height * sizeof(pixel_t));
+	if (!obj->save_under)
+	{
+		free(obj);
+		LOG_ERROR("sprite", "No memory for the save under buffer.");
+		return NULL;
+	}
+
+	obj->source = bitmap;
+	obj->bitmap = pixel_format_bitmap_new(bitmap);
+	if (!obj->bitmap)
+	{
+		free(obj->save_under);
+		free(obj);
+		return NULL;
+	}
+
+	obj->color = color(255, 255, 255);
+	area_set(&obj->area, 0, 0, bitmap->width, bitmap->height);
+
+	if (!sprite_list)
+	{
+		sprite_list = obj;
+	}
+	else
+	{
+		for (last = sprite_list; last->next; last = last->next);
+		last->next = obj;
+	}
+
+	return obj;
+}
+
+static void set_hidden(sprite_t * obj, const void * arg)
+{
+	(void)arg;
+	obj->visible = false;
+}
+
+void sprite_delete(sprite_t * obj)
+{
+	sprite_t ** iterator;
+
+	PTR_CHECK(obj, "sprite");
+
+	restack(obj, set_hidden, NULL);
+
+	for (iterator = &sprite_list; *iterator; iterator = &(*iterator)->next)
+	{
+		if (*iterator == obj)
+		{
+			*iterator = obj->next;
+			break;
+		}
+	}
+
+	/* The restore from the save under may still be queued. */
+	framebuffer_ops_sync();
+	pixel_format_bitmap_delete(obj->source, obj->bitmap);
+	free(obj->save_under);
+	free(obj);
+}
+
+static void set_position(sprite_t * obj, const void * arg)
+{
+	const point_t * position = (const point_t *)arg;
+
+	area_set_start_xy(&obj->area, position->x, position->y);
+}
+
+void sprite_set_position(sprite_t * obj, dim_t x, dim_t y)
+{
+	point_t position;
+
+	PTR_CHECK(obj, "sprite");
+
+	if (obj->area.x == x && obj->area.y == y)
+		return;
+
+	if (!obj->visible)
+	{
+		area_set_start_xy(&obj->area, x, y);
+		return;
+	}
+
+	point_set(&position, x, y);
+	restack(obj, set_position, &position);
+}
+
+static void set_color(sprite_t * obj, const void * arg)
+{
+	obj->color = color_html((const char *)arg);
+}
+
+void sprite_set_color_html(sprite_t * obj, const char * html_color_code)
+{
+	PTR_CHECK(obj, "sprite");
+
+	if (!color_html_cache_update(obj->color_html, html_color_code))
+		return;
+
+	if (!obj->visible)
+	{
+		obj->color = color_html(html_color_code);
+		return;
+	}
+
+	restack(obj, set_color, html_color_code);
+}
+
+static void set_visible(sprite_t * obj, const void * arg)
+{
+	(void)arg;
+	obj->visible = true;
+}
+
+void sprite_show(sprite_t * obj)
+{
+	PTR_CHECK(obj, "sprite");
+
+	if (obj->visible)
+		return;
+
+	restack(obj, set_visible, NULL);
+}
+
+void sprite_hide(sprite_t * obj)
+{
+	PTR_CHECK(obj, "sprite");
+
+	if (!obj->visible)
+		return;
+
+	restack(obj, set_hidden, NULL);
+}
+
+const area_t * sprite_area(const sprite_t * obj)
+{
+	PTR_CHECK_RETURN(obj, "sprite", NULL);
+
+	return &obj->area;
+}
+
+void sprite_overlay_lift(const area_t * area)
+{
+	sprite_t * obj;
+
+	if (!area)
+	{
+		lift_from(sprite_list);
+		return;
+	}
+
+	/* Sprites may overlap each other, if any is touched the whole plane is lifted. */
+	for (obj = sprite_list; obj; obj = obj->next)
+	{
+		if (obj->dropped && area_intersects(&obj->saved_area, area))
+		{
+			lift_from(sprite_list);
+			return;
+		}
+	}
+}
+
+void sprite_overlay_drop(void)
+{
+	sprite_t * obj;
+
+	for (obj = sprite_list; obj; obj = obj->next)
+		drop(obj);
+}
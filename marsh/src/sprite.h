@@ -0,0 +1,58 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef SPRITE_H_
+#define SPRITE_H_
+
+#include "types.h"
+
+/*
+ * Sprites live in an overlay plane above the widget tree, meant for elements that
+ * move every frame such as cursors, drag handles and floating indicators.
+ *
+ * Each sprite saves the framebuffer pixels under itself before being blitted. Moving,
+ * recoloring or hiding it restores the saved pixels and blits it again, the widget
+ * tree is not traversed. Sprites are stacked in creation order, the last one on top.
+ *
+ * Sources are icon bitmaps (1bpp and 8bpp alpha, drawn with the sprite color) or
+ * 16bpp images. A sprite is created hidden.
+ */
+
+sprite_t * sprite_new(bitmap_t * bitmap);
+void sprite_delete(sprite_t * obj);
+
+void sprite_set_position(sprite_t * obj, dim_t x, dim_t y);
+void sprite_set_color_html(sprite_t * obj, const char * html_color_code);
+void sprite_show(sprite_t * obj);
+void sprite_hide(sprite_t * obj);
+const area_t * sprite_area(const sprite_t * obj);
+
+/*
+ * The widget tree draws straight to the framebuffer, so any tree redraw must be
+ * enclosed by these calls: lift restores the pixels under the sprites when one of
+ * them overlaps area (NULL meaning the whole framebuffer), and drop saves and blits
+ * the sprites again after the redraw. The render thread does so around each frame,
+ * and sprite changes wait for it with render_thread_flush.
+ */
+void sprite_overlay_lift(const area_t * area);
+void sprite_overlay_drop(void);
+
+#endif /* SPRITE_H_ */
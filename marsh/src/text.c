@@ -28,6 +28,7 @@
 #include "color.h"
 #include "area.h"
 #include "widget.h"
+#include "widget_update.h"
 #include "signalslot.h"
 #include "canvas.h"
 #include "framebuffer.h"
@@ -37,6 +38,7 @@ struct s_text
 	my_string_t *string;
 	font_t *font;
 	color_t color;
+	char color_html[COLOR_HTML_CODE_SIZE];
 	enum e_text_justification just;
 	dim_t ref_x, ref_y;
 	bool ref_is_set;
@@ -111,9 +113,18 @@ static void update_position_and_size(text_t *obj)
 	widget_set_pos(obj->glyph, x, y);
 }
 
+/* Within a transaction the layout is computed once, by the commit. */
+static void request_layout(text_t *obj)
+{
+	if (widget_update_in_progress())
+		widget_invalidate_dim(obj->glyph);
+	else
+		update_position_and_size(obj);
+}
+
 static void string_changed(text_t* obj)
 {
-	update_position_and_size(obj);
+	request_layout(obj);
 }
 
 static bool ready_to_draw(text_t * obj)
@@ -135,8 +146,7 @@ static void text_draw(text_t * obj, const area_t * limiting_canvas_area)
 		return;
 	}
 
-	area_t canvas_area = widget_compute_canvas_area(obj->glyph, limiting_canvas_area);
-	canvas_t *canv = canvas_new(&canvas_area);
+	canvas_t *canv = canvas_new_clipped(widget_area(obj->glyph), limiting_canvas_area);
 
 	if (obj->just == TEXT_LEFT_JUST)
 		font_draw_left_just(obj->font, obj->string, color_to_pixel(obj->color), canv);
@@ -161,6 +171,7 @@ text_t* text_new(widget_t * parent)
 	slot_connect(obj->string_update_slot, my_string_get_update_signal(obj->string));
 
 	obj->glyph = widget_new(parent, obj, (void(*)(void *, const area_t *))text_draw, (void(*)(void *))text_delete);
+	widget_set_creator_refresh_dim(obj->glyph, (void(*)(void *))update_position_and_size);
 
 	obj->just = TEXT_LEFT_JUST;
 
@@ -193,25 +204,36 @@ void text_set_font(text_t* obj, font_t *font)
 {
 	PTR_CHECK(obj, "text");
 
+	if (obj->font == font)
+		return;
+
 	obj->font = font;
-	update_position_and_size(obj);
+	request_layout(obj);
 }
 
 void text_set_reference_position(text_t* obj, dim_t x, dim_t y)
 {
 	PTR_CHECK(obj, "text");
 
+	if (obj->ref_is_set && obj->ref_x == x && obj->ref_y == y)
+		return;
+
 	obj->ref_is_set = true;
 	obj->ref_x = x;
 	obj->ref_y = y;
 
-	update_position_and_size(obj);
+	request_layout(obj);
 }
 
 void text_set_color_html(text_t* obj, const char* html_color_code)
 {
 	PTR_CHECK(obj, "text");
 
+	if (!color_html_cache_update(obj->color_html, html_color_code))
+		return;
+
+	widget_invalidate(obj->glyph);
+
 	obj->color = color_html(html_color_code);
 }
 
@@ -219,8 +241,11 @@ void text_set_justification(text_t * obj, enum e_text_justification just)
 {
 	PTR_CHECK(obj, "text");
 
+	if (obj->just == just)
+		return;
+
 	obj->just = just;
-	update_position_and_size(obj);
+	request_layout(obj);
 }
 
 widget_t* text_get_widget(text_t* const obj)
@@ -0,0 +1,534 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+
+#include "helper/checks.h"
+#include "helper/log.h"
+#include "helper/thread_pool.h"
+
+#include "framebuffer.h"
+#include "scale.h"
+#include "tile_renderer.h"
+
+enum e_tile_op
+{
+	TILE_OP_FILL_RECT,
+	TILE_OP_EXPAND_1BPP,
+	TILE_OP_BLEND_A8,
+	TILE_OP_BLEND_A8_RLE,
+	TILE_OP_EXPAND_INDEXED,
+	TILE_OP_SCALE,
+	TILE_OP_BLIT
+};
+
+/* Recorded operation, in framebuffer coordinates. */
+struct s_tile_op
+{
+	enum e_tile_op op;
+	dim_t x, y, width, height;
+	const void * src;
+	size_t src_offset;
+	size_t src_stride;
+	pixel_t color;
+	const pixel_t * palette;
+	uint8_t bits;
+};
+
+struct s_tile
+{
+	uint32_t * ops;
+	size_t count;
+	size_t capacity;
+
+	/* Bounds of the recorded operations inside the tile, what gets loaded and stored. */
+	dim_t x0, y0, x1, y1;
+};
+
+/* Share of the dirty tiles of one thread, the others steal from it through next. */
+struct s_tile_range
+{
+	size_t next;
+	size_t end;
+	char padding[64 - 2 * sizeof(size_t)];
+};
+
+static struct
+{
+	bool running;
+	size_t threads;
+	thread_pool_t * pool;
+
+	struct s_tile_op * ops;
+	size_t op_count;
+	size_t op_capacity;
+
+	/* Of the TILE_OP_SCALE operations, their src_offset. */
+	scale_t * scales;
+	size_t scale_count;
+	size_t scale_capacity;
+
+	struct s_tile * tiles;
+	size_t columns;
+	size_t rows;
+
+	/* Tiles with recorded operations. */
+	uint32_t * dirty;
+	size_t dirty_count;
+
+	struct s_tile_range ranges[TILE_RENDERER_MAX_THREADS];
+} renderer;
+
+static void render_tile(uint32_t index)
+{
+	const framebuffer_ops_t * software = framebuffer_ops_software();
+	const struct s_tile * tile = &renderer.tiles[index];
+	pixel_t local[TILE_RENDERER_TILE_WIDTH * TILE_RENDERER_TILE_HEIGHT];
+	size_t fb_stride = framebuffer_stride();
+	pixel_t * fb = framebuffer_at(tile->x0, tile->y0);
+	dim_t tile_x = (dim_t)(index % renderer.columns) * TILE_RENDERER_TILE_WIDTH;
+	dim_t tile_y = (dim_t)(index / renderer.columns) * TILE_RENDERER_TILE_HEIGHT;
+	const struct s_tile_op * op;
+	scale_t scale;
+	dim_t x0, y0, x1, y1, dx, dy;
+	pixel_t * dst;
+	size_t i;
+
+	/* local holds the tile bounds at stride TILE_RENDERER_TILE_WIDTH. */
+	software->blit(local, TILE_RENDERER_TILE_WIDTH, fb, fb_stride, tile->x1 - tile->x0, tile->y1 - tile->y0);
+
+	for (i = 0; i < tile->count; i++)
+	{
+		op = &renderer.ops[tile->ops[i]];
+
+		x0 = op->x > tile_x ? op->x : tile_x;
+		y0 = op->y > tile_y ? op->y : tile_y;
+		x1 = op->x + op->width < tile_x + TILE_RENDERER_TILE_WIDTH ? op->x + op->width : tile_x + TILE_RENDERER_TILE_WIDTH;
+		y1 = op->y + op->height < tile_y + TILE_RENDERER_TILE_HEIGHT ? op->y + op->height : tile_y + TILE_RENDERER_TILE_HEIGHT;
+		dx = x0 - op->x;
+		dy = y0 - op->y;
+		dst = local + (y0 - tile->y0) * TILE_RENDERER_TILE_WIDTH + (x0 - tile->x0);
+
+		switch (op->op)
+		{
+		case TILE_OP_FILL_RECT:
+			software->fill_rect(dst, TILE_RENDERER_TILE_WIDTH, x1 - x0, y1 - y0, op->color);
+			break;
+		case TILE_OP_EXPAND_1BPP:
+			software->expand_1bpp(dst, TILE_RENDERER_TILE_WIDTH, (const uint8_t *)op->src,
+					op->src_offset + dy * op->src_stride + dx, op->src_stride, x1 - x0, y1 - y0, op->color);
+			break;
+		case TILE_OP_BLEND_A8:
+			software->blend_a8(dst, TILE_RENDERER_TILE_WIDTH, (const uint8_t *)op->src + dy * op->src_stride + dx,
+					op->src_stride, x1 - x0, y1 - y0, op->color);
+			break;
+		case TILE_OP_BLEND_A8_RLE:
+			software->blend_a8_rle(dst, TILE_RENDERER_TILE_WIDTH, framebuffer_ops_rle_skip((const uint8_t *)op->src, op->src_stride, dy),
+					op->src_offset + dx, op->src_stride, x1 - x0, y1 - y0, op->color);
+			break;
+		case TILE_OP_EXPAND_INDEXED:
+			software->expand_indexed(dst, TILE_RENDERER_TILE_WIDTH, (const uint8_t *)op->src, op->src_offset + dy * op->src_stride + dx,
+					op->src_stride, op->bits, op->palette, x1 - x0, y1 - y0);
+			break;
+		case TILE_OP_SCALE:
+			scale = renderer.scales[op->src_offset];
+			scale_skip(&scale, dx, dy);
+			software->scale(dst, TILE_RENDERER_TILE_WIDTH, &scale, x1 - x0, y1 - y0);
+			break;
+		case TILE_OP_BLIT:
+		default:
+			software->blit(dst, TILE_RENDERER_TILE_WIDTH, (const pixel_t *)op->src + dy * op->src_stride + dx,
+					op->src_stride, x1 - x0, y1 - y0);
+			break;
+		}
+	}
+
+	software->blit(fb, fb_stride, local, TILE_RENDERER_TILE_WIDTH, tile->x1 - tile->x0, tile->y1 - tile->y0);
+}
+
+/* Own share first, then the tiles the other threads did not reach yet. */
+static void render_tiles(void * context, size_t self)
+{
+	struct s_tile_range * range;
+	size_t k, i;
+
+	(void)context;
+
+	for (k = 0; k < renderer.threads; k++)
+	{
+		range = &renderer.ranges[(self + k) % renderer.threads];
+
+		while ((i = __atomic_fetch_add(&range->next, 1, __ATOMIC_RELAXED)) < range->end)
+			render_tile(renderer.dirty[i]);
+	}
+}
+
+/* Renders the recorded operations, the drawing thread taking its share. */
+static void flush(void)
+{
+	size_t k;
+
+	if (!renderer.dirty_count)
+		return;
+
+	for (k = 0; k < renderer.threads; k++)
+	{
+		renderer.ranges[k].next = renderer.dirty_count * k / renderer.threads;
+		renderer.ranges[k].end = renderer.dirty_count * (k + 1) / renderer.threads;
+	}
+
+	thread_pool_run(renderer.pool, render_tiles, NULL);
+
+	for (k = 0; k < renderer.dirty_count; k++)
+		renderer.tiles[renderer.dirty[k]].count = 0;
+	renderer.dirty_count = 0;
+	renderer.op_count = 0;
+	renderer.scale_count = 0;
+}
+
+static bool tile_reserve(struct s_tile * tile)
+{
+	uint32_t * grown;
+	size_t capacity;
+
+	if (tile->count < tile->capacity)
+		return true;
+
+	capacity = tile->capacity ? tile->capacity * 2 : 16;
+	grown = (uint32_t *)realloc(tile->ops, capacity * sizeof(uint32_t));
+	MEMORY_ALLOC_CHECK_RETURN(grown, false);
+	tile->ops = grown;
+	tile->capacity = capacity;
+
+	return true;
+}
+
+static bool ops_reserve(void)
+{
+	struct s_tile_op * grown;
+	size_t capacity;
+
+	if (renderer.op_count < renderer.op_capacity)
+		return true;
+
+	capacity = renderer.op_capacity ? renderer.op_capacity * 2 : 256;
+	grown = (struct s_tile_op *)realloc(renderer.ops, capacity * sizeof(struct s_tile_op));
+	MEMORY_ALLOC_CHECK_RETURN(grown, false);
+	renderer.ops = grown;
+	renderer.op_capacity = capacity;
+
+	return true;
+}
+
+static bool scales_reserve(void)
+{
+	scale_t * grown;
+	size_t capacity;
+
+	if (renderer.scale_count < renderer.scale_capacity)
+		return true;
+
+	capacity = renderer.scale_capacity ? renderer.scale_capacity * 2 : 16;
+	grown = (scale_t *)realloc(renderer.scales, capacity * sizeof(scale_t));
+	MEMORY_ALLOC_CHECK_RETURN(grown, false);
+	renderer.scales = grown;
+	renderer.scale_capacity = capacity;
+
+	return true;
+}
+
+/* Writes laid out like the framebuffer and inside it, from a source outside it. */
+static bool binnable(const pixel_t * dst, size_t stride, const void * src, dim_t width, dim_t height)
+{
+	const pixel_t * start = framebuffer_start();
+	const pixel_t * end = start + framebuffer_stride() * framebuffer_height();
+	size_t offset;
+
+	if (dst < start || dst >= end || stride != framebuffer_stride())
+		return false;
+
+	if ((const pixel_t *)src >= start && (const pixel_t *)src < end)
+		return false;
+
+	offset = (size_t)(dst - start);
+
+	return offset % stride + width <= framebuffer_width() && offset / stride + height <= framebuffer_height();
+}
+
+static void tile_add(size_t index, const struct s_tile_op * op)
+{
+	struct s_tile * tile = &renderer.tiles[index];
+	dim_t tile_x = (dim_t)(index % renderer.columns) * TILE_RENDERER_TILE_WIDTH;
+	dim_t tile_y = (dim_t)(index / renderer.columns) * TILE_RENDERER_TILE_HEIGHT;
+	dim_t x0, y0, x1, y1;
+
+	x0 = op->x > tile_x ? op->x : tile_x;
+	y0 = op->y > tile_y ? op->y : tile_y;
+	x1 = op->x + op->width < tile_x + TILE_RENDERER_TILE_WIDTH ? op->x + op->width : tile_x + TILE_RENDERER_TILE_WIDTH;
+	y1 = op->y + op->height < tile_y + TILE_RENDERER_TILE_HEIGHT ? op->y + op->height : tile_y + TILE_RENDERER_TILE_HEIGHT;
+
+	if (!tile->count)
+	{
+		renderer.dirty[renderer.dirty_count++] = (uint32_t)index;
+		tile->x0 = x0;
+		tile->y0 = y0;
+		tile->x1 = x1;
+		tile->y1 = y1;
+	}
+	else
+	{
+		tile->x0 = x0 < tile->x0 ? x0 : tile->x0;
+		tile->y0 = y0 < tile->y0 ? y0 : tile->y0;
+		tile->x1 = x1 > tile->x1 ? x1 : tile->x1;
+		tile->y1 = y1 > tile->y1 ? y1 : tile->y1;
+	}
+
+	tile->ops[tile->count++] = (uint32_t)(op - renderer.ops);
+}
+
+static bool tiles_reserve(size_t first_column, size_t last_column, size_t first_row, size_t last_row)
+{
+	size_t column, row;
+
+	for (row = first_row; row <= last_row; row++)
+		for (column = first_column; column <= last_column; column++)
+			if (!tile_reserve(&renderer.tiles[row * renderer.columns + column]))
+				return false;
+
+	return true;
+}
+
+/* Returns false when the operation must run directly, after the recorded ones. */
+static bool record(enum e_tile_op code, pixel_t * dst, size_t stride, const void * src, size_t src_offset, size_t src_stride,
+		dim_t width, dim_t height, pixel_t color)
+{
+	struct s_tile_op * op;
+	size_t offset, column, row, first_column, last_column, first_row, last_row;
+
+	if (!width || !height)
+		return true;
+
+	if (!binnable(dst, stride, src, width, height))
+	{
+		flush();
+		return false;
+	}
+
+	offset = (size_t)(dst - framebuffer_start());
+	first_column = offset % stride / TILE_RENDERER_TILE_WIDTH;
+	last_column = (offset % stride + width - 1) / TILE_RENDERER_TILE_WIDTH;
+	first_row = offset / stride / TILE_RENDERER_TILE_HEIGHT;
+	last_row = (offset / stride + height - 1) / TILE_RENDERER_TILE_HEIGHT;
+
+	/* Nothing is appended before all the storage is there. */
+	if (!tiles_reserve(first_column, last_column, first_row, last_row) || !ops_reserve())
+	{
+		flush();
+		return false;
+	}
+
+	op = &renderer.ops[renderer.op_count++];
+	op->op = code;
+	op->x = (dim_t)(offset % stride);
+	op->y = (dim_t)(offset / stride);
+	op->width = width;
+	op->height = height;
+	op->src = src;
+	op->src_offset = src_offset;
+	op->src_stride = src_stride;
+	op->color = color;
+	op->palette = NULL;
+	op->bits = 0;
+
+	for (row = first_row; row <= last_row; row++)
+		for (column = first_column; column <= last_column; column++)
+			tile_add(row * renderer.columns + column, op);
+
+	return true;
+}
+
+static void binned_fill_rect(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color)
+{
+	if (!record(TILE_OP_FILL_RECT, dst, stride, NULL, 0, 0, width, height, color))
+		framebuffer_ops_software()->fill_rect(dst, stride, width, height, color);
+}
+
+/* Reads pixels other tiles may still have to write. */
+static void binned_copy_rect(pixel_t * dst, const pixel_t * src, size_t stride, dim_t width, dim_t height)
+{
+	flush();
+	framebuffer_ops_software()->copy_rect(dst, src, stride, width, height);
+}
+
+static void binned_expand_1bpp(pixel_t * dst, size_t stride, const uint8_t * bits, size_t bit_offset, size_t bit_stride, dim_t width, dim_t height, pixel_t color)
+{
+	if (!record(TILE_OP_EXPAND_1BPP, dst, stride, bits, bit_offset, bit_stride, width, height, color))
+		framebuffer_ops_software()->expand_1bpp(dst, stride, bits, bit_offset, bit_stride, width, height, color);
+}
+
+static void binned_blend_a8(pixel_t * dst, size_t stride, const uint8_t * alpha, size_t alpha_stride, dim_t width, dim_t height, pixel_t color)
+{
+	if (!record(TILE_OP_BLEND_A8, dst, stride, alpha, 0, alpha_stride, width, height, color))
+		framebuffer_ops_software()->blend_a8(dst, stride, alpha, alpha_stride, width, height, color);
+}
+
+static void binned_blend_a8_rle(pixel_t * dst, size_t stride, const uint8_t * runs, size_t column, size_t runs_width, dim_t width, dim_t height, pixel_t color)
+{
+	if (!record(TILE_OP_BLEND_A8_RLE, dst, stride, runs, column, runs_width, width, height, color))
+		framebuffer_ops_software()->blend_a8_rle(dst, stride, runs, column, runs_width, width, height, color);
+}
+
+static void binned_expand_indexed(pixel_t * dst, size_t stride, const uint8_t * indices, size_t index_offset, size_t index_stride, uint8_t bits, const pixel_t * palette, dim_t width, dim_t height)
+{
+	struct s_tile_op * op;
+
+	if (!record(TILE_OP_EXPAND_INDEXED, dst, stride, indices, index_offset, index_stride, width, height, 0))
+	{
+		framebuffer_ops_software()->expand_indexed(dst, stride, indices, index_offset, index_stride, bits, palette, width, height);
+		return;
+	}
+
+	op = &renderer.ops[renderer.op_count - 1];
+	op->palette = palette;
+	op->bits = bits;
+}
+
+static void binned_scale(pixel_t * dst, size_t stride, const scale_t * scale, dim_t width, dim_t height)
+{
+	if (!scales_reserve() || !record(TILE_OP_SCALE, dst, stride, scale->pixels, renderer.scale_count, 0, width, height, 0))
+	{
+		flush();
+		framebuffer_ops_software()->scale(dst, stride, scale, width, height);
+		return;
+	}
+
+	renderer.scales[renderer.scale_count++] = *scale;
+}
+
+static void binned_blit(pixel_t * dst, size_t stride, const pixel_t * src, size_t src_stride, dim_t width, dim_t height)
+{
+	if (!record(TILE_OP_BLIT, dst, stride, src, 0, src_stride, width, height, 0))
+		framebuffer_ops_software()->blit(dst, stride, src, src_stride, width, height);
+}
+
+/* Recorded operations complete on the sync, the fence itself renders them. */
+static uint32_t binned_fence(void)
+{
+	flush();
+
+	return 0;
+}
+
+static void binned_wait(uint32_t fence)
+{
+	(void)fence;
+}
+
+static const framebuffer_ops_t binned_ops =
+{
+	binned_fill_rect,
+	binned_copy_rect,
+	binned_expand_1bpp,
+	binned_blend_a8,
+	binned_blend_a8_rle,
+	binned_expand_indexed,
+	binned_scale,
+	binned_blit,
+	binned_fence,
+	binned_wait,
+	NULL
+};
+
+static void release(void)
+{
+	size_t i;
+
+	for (i = 0; renderer.tiles && i < renderer.columns * renderer.rows; i++)
+		free(renderer.tiles[i].ops);
+
+	if (renderer.pool)
+		thread_pool_delete(renderer.pool);
+
+	free(renderer.tiles);
+	free(renderer.dirty);
+	free(renderer.ops);
+	free(renderer.scales);
+	renderer.pool = NULL;
+	renderer.tiles = NULL;
+	renderer.dirty = NULL;
+	renderer.ops = NULL;
+	renderer.op_capacity = 0;
+	renderer.scales = NULL;
+	renderer.scale_capacity = 0;
+}
+
+void tile_renderer_start(size_t threads)
+{
+	if (renderer.running)
+		return;
+
+	if (!threads)
+		threads = 1;
+	if (threads > TILE_RENDERER_MAX_THREADS)
+		threads = TILE_RENDERER_MAX_THREADS;
+
+	renderer.columns = (framebuffer_width() + TILE_RENDERER_TILE_WIDTH - 1) / TILE_RENDERER_TILE_WIDTH;
+	renderer.rows = (framebuffer_height() + TILE_RENDERER_TILE_HEIGHT - 1) / TILE_RENDERER_TILE_HEIGHT;
+	renderer.tiles = (struct s_tile *)calloc(renderer.columns * renderer.rows, sizeof(struct s_tile));
+	renderer.dirty = (uint32_t *)malloc(renderer.columns * renderer.rows * sizeof(uint32_t));
+	/* The drawing thread is the first one. */
+	renderer.pool = thread_pool_new(threads);
+	if (!renderer.tiles || !renderer.dirty || !renderer.pool)
+	{
+		release();
+		LOG_ERROR("tile_renderer", "Failed to alloc memory");
+		return;
+	}
+
+	renderer.op_count = 0;
+	renderer.scale_count = 0;
+	renderer.dirty_count = 0;
+	renderer.threads = thread_pool_threads(renderer.pool);
+	renderer.running = true;
+	framebuffer_set_ops(&binned_ops);
+}
+
+void tile_renderer_stop(void)
+{
+	if (!renderer.running)
+		return;
+
+	/* Renders what is recorded before switching back. */
+	framebuffer_set_ops(NULL);
+
+	release();
+	renderer.running = false;
+}
+
+bool tile_renderer_running(void)
+{
+	return renderer.running;
+}
+
+size_t tile_renderer_threads(void)
+{
+	return renderer.running ? renderer.threads : 0;
+}
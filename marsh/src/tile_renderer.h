@@ -0,0 +1,52 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef TILE_RENDERER_H_
+#define TILE_RENDERER_H_
+
+#include "types.h"
+
+/*
+ * Tile binned rendering. While running, the framebuffer operations of a frame are
+ * recorded and binned into the TILE_RENDERER_TILE_WIDTH x TILE_RENDERER_TILE_HEIGHT
+ * screen tiles they touch. A sync, at the latest when the frame is presented,
+ * rasterizes the touched tiles in parallel: each tile is loaded once into a local
+ * buffer small enough to stay in cache, gets its operations in recording order and is
+ * written back once. The output is the same as the software operations give.
+ *
+ * Operations that can't be split into tiles, a region copy, a write outside the
+ * framebuffer or a source read from it, first render what was recorded and then run
+ * directly.
+ *
+ * The threads, up to TILE_RENDERER_MAX_THREADS counting the drawing one, steal tiles
+ * from each other once their own share is done.
+ */
+
+#define TILE_RENDERER_TILE_WIDTH  64
+#define TILE_RENDERER_TILE_HEIGHT 32
+#define TILE_RENDERER_MAX_THREADS 16
+
+void tile_renderer_start(size_t threads);
+void tile_renderer_stop(void);
+bool tile_renderer_running(void);
+size_t tile_renderer_threads(void);
+
+#endif /* TILE_RENDERER_H_ */
@@ -34,7 +34,28 @@ extern int (*marshmallow_terminal_output)(const char * str);
 #include <stdbool.h>
 
 typedef int32_t dim_t;
+
+/* Framebuffer pixel formats. The library is built for one of them, the one the
+ * backend scans out, given by MARSH_PIXEL_FORMAT. See pixel_format.h. */
+#define PIXEL_FORMAT_RGB565   0
+#define PIXEL_FORMAT_RGB888   1 /* 0x00RRGGBB words. */
+#define PIXEL_FORMAT_ARGB8888 2 /* 0xAARRGGBB words, always opaque. */
+#define PIXEL_FORMAT_L8       3 /* Luminance bytes. */
+#define PIXEL_FORMAT_INDEXED8 4 /* Bytes indexing the RGB332 palette. */
+
+#ifndef MARSH_PIXEL_FORMAT
+#define MARSH_PIXEL_FORMAT PIXEL_FORMAT_RGB565
+#endif
+
+#if MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB565
 typedef uint16_t pixel_t;
+#elif MARSH_PIXEL_FORMAT == PIXEL_FORMAT_RGB888 || MARSH_PIXEL_FORMAT == PIXEL_FORMAT_ARGB8888
+typedef uint32_t pixel_t;
+#elif MARSH_PIXEL_FORMAT == PIXEL_FORMAT_L8 || MARSH_PIXEL_FORMAT == PIXEL_FORMAT_INDEXED8
+typedef uint8_t pixel_t;
+#else
+#error "Unknown MARSH_PIXEL_FORMAT"
+#endif
 
 typedef struct s_signal signal_t;
 typedef struct s_slot slot_t;
@@ -52,7 +73,113 @@ typedef struct s_area {
 	dim_t x, y, width, height;
 } area_t;
 
+/* Point in 24.8 fixed point, see path_rasterizer.h. */
+typedef struct s_fixed_point {
+	int32_t x, y;
+} fixed_point_t;
+
+enum e_fill_rule
+{
+	FILL_NONZERO,
+	FILL_EVEN_ODD
+};
+
+enum e_scale_filter
+{
+	SCALE_NEAREST,
+	SCALE_BILINEAR
+};
+
+enum e_scale_source
+{
+	SCALE_SOURCE_NATIVE,
+	SCALE_SOURCE_A8,
+	SCALE_SOURCE_INDEXED4,
+	SCALE_SOURCE_INDEXED8
+};
+
+/* Source of a scaled draw and where the destination pixels sample it, see scale.h. */
+typedef struct s_scale {
+	enum e_scale_source source;
+	enum e_scale_filter filter;
+	const void * pixels;
+	size_t stride;            /* Pixels, or indices, from a source row to the next. */
+	dim_t width, height;      /* Of the source. */
+	const pixel_t * palette;  /* Of the indexed sources. */
+	pixel_t color;            /* Of the A8 sources. */
+	int32_t x, y;             /* Sampled for the first pixel, 16.16 source pixels. */
+	int32_t step_x, step_y;   /* From a destination pixel to the next. */
+} scale_t;
+
 typedef struct s_canvas canvas_t;
+typedef struct s_framebuffer_ops framebuffer_ops_t;
+typedef struct s_display_list display_list_t;
+
+/* Pixels of a framebuffer, see framebuffer_geometry.h. */
+typedef struct s_framebuffer_geometry {
+	size_t width;
+	size_t height;
+	size_t stride;    /* Pixels from a row to the next, rows start on a cache line. */
+	area_t area;
+	pixel_t * pixels; /* NULL until framebuffer_geometry_init. */
+	void * block;     /* What pixels were carved out of. */
+} framebuffer_geometry_t;
+
+typedef struct s_parallel_draw_stats {
+	uint32_t sections; /* Sibling levels drawn concurrently. */
+	uint32_t batches;  /* Batches of overlapping siblings drawing in them. */
+	uint32_t widest;   /* Most batches in one section. */
+	uint64_t busy_ns;  /* Spent in batches, summed over the threads. */
+	uint64_t wall_ns;  /* Spent in sections, busy_ns / wall_ns is the parallelism. */
+} parallel_draw_stats_t;
+
+typedef struct s_render_thread_stats {
+	uint32_t published;       /* Frames published by the UI thread. */
+	uint32_t reclaimed;       /* Published frames taken back unpresented, merged into the next. */
+	uint32_t presented;       /* Frames presented by the render thread. */
+	uint32_t inputs;          /* Presented frames answering an input. */
+	uint64_t record_ns;       /* Spent recording on the UI thread. */
+	uint64_t render_ns;       /* Spent executing and presenting on the render thread. */
+	uint64_t latency_ns;      /* Input to present, summed over the inputs. */
+	uint64_t max_latency_ns;
+} render_thread_stats_t;
+
+/* Instruction sets of the pixel conversion kernels, each level implies the previous. */
+enum e_pixel_convert_isa
+{
+	PIXEL_CONVERT_SCALAR,
+	PIXEL_CONVERT_SSSE3,
+	PIXEL_CONVERT_AVX2
+};
+
+/* Clockwise turn from the logical orientation the widget tree draws in to the panel. */
+enum e_display_rotation
+{
+	DISPLAY_ROTATION_0,
+	DISPLAY_ROTATION_90,
+	DISPLAY_ROTATION_180,
+	DISPLAY_ROTATION_270
+};
+
+enum e_command_queue_op
+{
+	COMMAND_QUEUE_FILL_RECT,
+	COMMAND_QUEUE_COPY_RECT,
+	COMMAND_QUEUE_EXPAND_1BPP,
+	COMMAND_QUEUE_BLEND_A8,
+	COMMAND_QUEUE_BLEND_A8_RLE,
+	COMMAND_QUEUE_EXPAND_INDEXED,
+	COMMAND_QUEUE_SCALE,
+	COMMAND_QUEUE_BLIT,
+	COMMAND_QUEUE_OP_COUNT
+};
+
+typedef struct s_command_queue_stats {
+	uint32_t count;
+	uint64_t busy_ns;    /* Executing. */
+	uint64_t max_ns;     /* Longest single command. */
+	uint64_t latency_ns; /* From submission to the start of execution. */
+} command_queue_stats_t;
 typedef struct s_virtual_canvas virtual_canvas_t;
 
 typedef struct s_my_string my_string_t;
@@ -60,9 +187,22 @@ typedef struct s_my_string my_string_t;
 typedef uint32_t color_t;
 typedef const struct s_font font_t;
 typedef const struct s_bitmap bitmap_t;
+typedef const struct s_bitmap_levels bitmap_levels_t;
+typedef struct s_asset_pack asset_pack_t;
 typedef struct s_rectangle_instance rectangle_t;
 typedef struct s_icon_instance icon_t;
 typedef struct s_image_instance image_t;
+typedef struct s_sprite sprite_t;
+typedef struct s_scroll_view scroll_view_t;
+typedef struct s_list_view list_view_t;
+
+enum e_chart_style
+{
+	CHART_LINE,
+	CHART_AREA
+};
+typedef struct s_chart chart_t;
+typedef struct s_gauge gauge_t;
 
 enum e_text_justification
 {
@@ -73,6 +213,7 @@ enum e_text_justification
 typedef struct s_text text_t;
 
 typedef struct s_widget widget_t;
+typedef struct s_damage damage_t;
 typedef struct s_button_engine button_engine_t;
 
 enum e_event_default_codes
@@ -24,12 +24,15 @@
 #include "helper/log.h"
 #include "helper/checks.h"
 
+#include "animation.h"
 #include "framebuffer.h"
+#include "area.h"
 #include "signalslot.h"
 #include "widget_private.h"
 #include "widget.h"
 #include "widget_tree.h"
 #include "widget_event.h"
+#include "widget_update.h"
 
 widget_t * widget_new(widget_t * parent, void * report_instance, void (*report_draw)(void *, const area_t *), void (*report_delete)(void *))
 {
@@ -65,6 +68,8 @@ void widget_delete_instance_only(widget_t * obj)
 {
 	PTR_CHECK(obj, "widget");
 
+	widget_update_forget(obj);
+	animation_stop(obj);
 	widget_event_deinit(&obj->event_handler_list);
 	widget_tree_unregister(obj);
 
@@ -113,6 +118,11 @@ void widget_set_dim(widget_t *obj, dim_t width, dim_t height)
 {
 	PTR_CHECK(obj, "widget");
 
+	if (obj->area.width == width && obj->area.height == height)
+		return;
+
+	widget_invalidate(obj);
+
 	obj->area.width = width;
 	obj->area.height = height;
 }
@@ -121,20 +131,51 @@ void widget_set_pos(widget_t *obj, dim_t x, dim_t y)
 {
 	PTR_CHECK(obj, "widget");
 
+	if (obj->area.x == x && obj->area.y == y)
+		return;
+
+	widget_invalidate(obj);
+
 	obj->area.x = x;
 	obj->area.y = y;
 }
 
 void widget_set_area(widget_t *obj, dim_t x, dim_t y, dim_t width, dim_t height)
 {
+	area_t new_area;
+
 	PTR_CHECK(obj, "widget");
 
+	area_set(&new_area, x, y, width, height);
+
+	if (area_same(&obj->area, &new_area))
+		return;
+
+	widget_invalidate(obj);
+
 	obj->area.x = x;
 	obj->area.y = y;
 	obj->area.width = width;
 	obj->area.height = height;
 }
 
+void widget_set_creator_refresh_dim(widget_t * obj, void (*creator_refresh_dim)(void *))
+{
+	PTR_CHECK(obj, "widget");
+
+	obj->creator_refresh_dim = creator_refresh_dim;
+}
+
+void widget_refresh_dim(widget_t * obj)
+{
+	PTR_CHECK(obj, "widget");
+
+	if (obj->creator_refresh_dim && obj->creator_instance)
+	{
+		obj->creator_refresh_dim(obj->creator_instance);
+	}
+}
+
 void widget_click(widget_t * obj)
 {
 	PTR_CHECK(obj, "widget");
@@ -212,6 +253,11 @@ void widget_hide(widget_t * obj)
 {
 	PTR_CHECK(obj, "widget");
 
+	if (!obj->visible)
+		return;
+
+	widget_invalidate(obj);
+
 	obj->visible = false;
 }
 
@@ -219,6 +265,11 @@ void widget_show(widget_t * obj)
 {
 	PTR_CHECK(obj, "widget");
 
+	if (obj->visible)
+		return;
+
+	widget_invalidate(obj);
+
 	obj->visible = true;
 }
 
@@ -67,6 +67,10 @@ const area_t * widget_area(const widget_t *);
 
 area_t widget_compute_canvas_area(const widget_t *obj, const area_t * limiting_canvas_area);
 
+/* Creators whose dimension depends on their content (e.g. text) install a refresh_dim
+ * callback, widget_refresh_dim calls it. It is called by widget_commit_update for the
+ * widgets invalidated with widget_invalidate_dim. */
+void widget_set_creator_refresh_dim(widget_t * obj, void (*creator_refresh_dim)(void *));
 void widget_refresh_dim(widget_t * obj);
 
 void widget_click(widget_t * obj);
@@ -23,6 +23,7 @@
 #include "widget_tree.h"
 #include "widget_private.h"
 #include "event.h"
+#include "parallel_draw.h"
 #include "types.h"
 
 #include "helper/linked_list.h"
@@ -123,9 +124,13 @@ static int __attribute__((noinline)) widget_event_commit_internal(widget_t * sel
 				return widget_event_consumed;
 	}
 
-	/* Route to children */
+	/* Route to children, a draw may split them into batches drawn concurrently */
 	child = widget_child(self);
 
+	if (event_code(event) == event_code_draw
+			&& parallel_draw_children(self, widget_event_commit_internal, event, propagation_mask))
+		child = NULL;
+
 	if (propagation_mask & event_prop_right_to_left)
 		child = widget_last(child);
 
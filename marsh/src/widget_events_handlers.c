@@ -141,7 +141,8 @@ default_draw_event_handler(widget_t * widget, event_t * event)
 	PTR_CHECK_RETURN(widget, __FUNCTION__, widget_event_not_consumed);
 	PTR_CHECK_RETURN(event, __FUNCTION__, widget_event_not_consumed);
 
-	area_t * limiting_area;
+	const area_t * clip_area;
+	area_t limiting_area;
 
 	if (event_code(event) != event_code_draw)
 	{
@@ -149,17 +150,30 @@ default_draw_event_handler(widget_t * widget, event_t * event)
 		return widget_event_not_consumed;
 	}
 
+	/* Hidden widgets leave an empty visible area, so their children are skipped as well. */
 	if (!widget_visible(widget))
+	{
+		area_clear(&widget->tmp_canvas_area);
 		return widget_event_consumed;
+	}
 
 	if (widget_parent(widget))
-		limiting_area = &widget_parent(widget)->tmp_canvas_area;
+		widget->tmp_canvas_area = widget_compute_canvas_area(widget, &widget_parent(widget)->tmp_canvas_area);
+	else
+		widget->tmp_canvas_area = widget_compute_canvas_area(widget, NULL);
+
+	/* A draw event may carry a clip area (e.g. a damaged area), nothing outside it is touched. */
+	clip_area = (const area_t *)event_data(event);
+
+	if (clip_area)
+		area_set_intersection(&limiting_area, &widget->tmp_canvas_area, clip_area);
 	else
-		limiting_area = NULL;
+		limiting_area = widget->tmp_canvas_area;
 
-	widget_draw(widget, limiting_area);
+	if (!area_value(&limiting_area))
+		return widget_event_consumed;
 
-	widget->tmp_canvas_area = widget_compute_canvas_area(widget, limiting_area);
+	widget_draw(widget, &limiting_area);
 
 	return widget_event_consumed;
 }
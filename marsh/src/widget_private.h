@@ -61,6 +61,7 @@ struct s_widget
 	void * creator_instance;
 	void (*creator_draw)(void *, const area_t *);
 	void (*creator_delete)(void *);
+	void (*creator_refresh_dim)(void *);
 
 	/* Tree and event */
 	struct s_widget_tree tree;
@@ -69,11 +70,18 @@ struct s_widget
 	/* Visual state */
 	bool pressed;
 	bool visible;
+
+	/* Batched update, see widget_update.h */
+	bool update_pending;
+	bool update_refresh_dim;
+	widget_t * update_next;
 };
 
 void widget_event_init(widget_event_handler_t ** widget_event_lists_root_ptr);
 void widget_event_deinit(widget_event_handler_t ** widget_event_lists_root_ptr);
 
+void widget_update_forget(widget_t * obj);
+
 void widget_tree_register(widget_t * self, widget_t * parent);
 void widget_tree_unregister(widget_t * self);
 
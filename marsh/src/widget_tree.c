@@ -21,7 +21,11 @@
 
 #include "widget_private.h"
 #include "widget_tree.h"
+#include "display_rotation.h"
 #include "event.h"
+#include "framebuffer.h"
+#include "render_thread.h"
+#include "sprite.h"
 
 /*
  * TODO Add the non recursive widget_tree traversal system, to override
@@ -155,6 +159,22 @@ void widget_tree_delete(widget_t * obj)
 	widget_event_emit(obj, deletion_event);
 }
 
+void widget_tree_translate_children(widget_t * obj, dim_t dx, dim_t dy)
+{
+	widget_t * child;
+
+	PTR_CHECK(obj, "widget_tree");
+
+	for (child = widget_child(obj); child; child = widget_right_sibling(child))
+	{
+		child->area.x += dx;
+		child->area.y += dy;
+
+		// XXX recursiveness
+		widget_tree_translate_children(child, dx, dy);
+	}
+}
+
 bool widget_tree_ancestors_visible(widget_t * obj)
 {
 	PTR_CHECK_RETURN(obj, "widget_tree", false);
@@ -183,14 +203,60 @@ area_t widget_tree_ancestors_intersection_canvas_area(widget_t * obj)
 
 	while (parent)
 	{
-		ancestors_area = widget_compute_canvas_area(obj, &ancestors_area);
+		ancestors_area = widget_compute_canvas_area(parent, &ancestors_area);
 		parent = widget_parent(parent);
 	}
 
 	return ancestors_area;
 }
 
-void widget_tree_draw(widget_t * obj)
+static bool ancestor(const widget_t * candidate, widget_t * obj)
+{
+	for (obj = widget_parent(obj); obj; obj = widget_parent(obj))
+		if (obj == candidate)
+			return true;
+
+	return false;
+}
+
+static bool overlaps(widget_t * node, widget_t * obj, const area_t * area, const area_t * limiting_canvas_area)
+{
+	widget_t * child;
+	area_t canvas;
+
+	if (node == obj || !widget_visible(node))
+		return false;
+
+	canvas = widget_compute_canvas_area(node, limiting_canvas_area);
+
+	if (!area_intersects(&canvas, area))
+		return false;
+
+	if (!ancestor(node, obj))
+		return true;
+
+	// XXX recursiveness
+	for (child = widget_child(node); child; child = widget_right_sibling(child))
+		if (overlaps(child, obj, area, &canvas))
+			return true;
+
+	return false;
+}
+
+bool widget_tree_overlapped(widget_t * obj, const area_t * area)
+{
+	PTR_CHECK_RETURN(obj, "widget_tree", true);
+	PTR_CHECK_RETURN(area, "widget_tree", true);
+
+	return overlaps(widget_root(obj), obj, area, NULL);
+}
+
+void widget_tree_draw_widgets(widget_t * obj)
+{
+	widget_tree_draw_widgets_area(obj, NULL);
+}
+
+void widget_tree_draw_widgets_area(widget_t * obj, const area_t * clip)
 {
 	event_t * draw_event;
 
@@ -199,17 +265,41 @@ void widget_tree_draw(widget_t * obj)
 	if (!widget_tree_ancestors_visible(obj))
 		return;
 
-	draw_event = event_new(event_code_draw, NULL, NULL);
+	draw_event = event_new(event_code_draw, (void *)clip, NULL);
 	PTR_CHECK(draw_event, "widget_tree");
 
 	widget_event_emit(obj, draw_event);
 }
 
+void widget_tree_draw(widget_t * obj)
+{
+	PTR_CHECK(obj, "widget_tree");
+
+	if (!widget_tree_ancestors_visible(obj))
+		return;
+
+	if (render_thread_running())
+	{
+		render_thread_damage(obj, framebuffer_area());
+		return;
+	}
+
+	sprite_overlay_lift(NULL);
+	widget_tree_draw_widgets(obj);
+	sprite_overlay_drop();
+
+	/* Drawn pixels may still be queued, they are in place once the tree is drawn. */
+	framebuffer_ops_sync();
+}
+
 void widget_tree_click(widget_t * obj, int x, int y)
 {
 	event_t * interaction_event;
 	interaction_event_data_t data;
 
+	/* Panel coordinates, the tree is in the logical orientation. */
+	display_rotation_point(display_rotation(), framebuffer_width(), framebuffer_height(), &x, &y);
+
 	data.interaction_point.x = x;
 	data.interaction_point.y = y;
 
@@ -226,6 +316,9 @@ void widget_tree_press(widget_t * obj, int x, int y)
 	event_t * interaction_event;
 	interaction_event_data_t data;
 
+	/* Panel coordinates, the tree is in the logical orientation. */
+	display_rotation_point(display_rotation(), framebuffer_width(), framebuffer_height(), &x, &y);
+
 	data.interaction_point.x = x;
 	data.interaction_point.y = y;
 
@@ -242,6 +335,9 @@ void widget_tree_release(widget_t * obj, int x, int y)
 	event_t * interaction_event;
 	interaction_event_data_t data;
 
+	/* Panel coordinates, the tree is in the logical orientation. */
+	display_rotation_point(display_rotation(), framebuffer_width(), framebuffer_height(), &x, &y);
+
 	data.interaction_point.x = x;
 	data.interaction_point.y = y;
 
@@ -39,14 +39,28 @@ size_t widget_num_of_children(const widget_t * parent);
  * children calling widget_delete for each. */
 void widget_tree_delete(widget_t * obj);
 
+/* With the render thread running, damages the whole framebuffer for the next
+ * published frame instead. */
 void widget_tree_draw(widget_t *);
+/* Only the widgets, without the sprite overlay and the final sync of widget_tree_draw. */
+void widget_tree_draw_widgets(widget_t *);
+/* Same, nothing outside clip is touched. */
+void widget_tree_draw_widgets_area(widget_t *, const area_t * clip);
+/* Points on the panel, turned back to the logical orientation, see display_rotation.h. */
 void widget_tree_press(widget_t *, int x, int y);
 void widget_tree_release(widget_t *, int x, int y);
 void widget_tree_click(widget_t *, int x, int y);
 void widget_tree_refresh_dimension(widget_t *);
 
+/* Moves every descendant of obj by dx, dy. Nothing is invalidated, the caller is
+ * responsible for the pixels (e.g. a scroll view moving its rendered content). */
+void widget_tree_translate_children(widget_t * obj, dim_t dx, dim_t dy);
+
 bool widget_tree_ancestors_visible(widget_t * obj);
 area_t widget_tree_ancestors_intersection_canvas_area(widget_t * obj);
+/* Whether a visible widget other than obj, its descendants and its ancestors draws in
+ * area, so pixels moved there by obj would also move some of that widget's. */
+bool widget_tree_overlapped(widget_t * obj, const area_t * area);
 
 
 #endif
@@ -0,0 +1,265 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "helper/checks.h"
+#include "helper/log.h"
+
+#include "area.h"
+#include "damage.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "render_thread.h"
+#include "sprite.h"
+#include "widget.h"
+#include "widget_event.h"
+#include "widget_private.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+
+static unsigned int depth = 0;
+static widget_t * update_root = NULL;
+static widget_t * pending_list = NULL;
+static damage_t * damage = NULL;
+static uint32_t generation = 0;
+
+static area_t visible_area(widget_t * obj)
+{
+	area_t area;
+
+	if (!widget_visible(obj) || !widget_tree_ancestors_visible(obj))
+	{
+		area_clear(&area);
+		return area;
+	}
+
+	return widget_tree_ancestors_intersection_canvas_area(obj);
+}
+
+/* Both the area last drawn and the one the widget occupies now are damaged, the
+ * widget may have been changed out of a transaction since it was drawn. */
+static void damage_current_area(widget_t * obj)
+{
+	area_t area = visible_area(obj);
+
+	damage_add(damage, &obj->tmp_canvas_area);
+	damage_add(damage, &area);
+}
+
+static void refresh_pending_dimensions(void)
+{
+	widget_t * obj;
+	bool refreshed;
+
+	/* A refresh may invalidate other widgets, loop until none is left behind. */
+	do
+	{
+		refreshed = false;
+
+		for (obj = pending_list; obj; obj = obj->update_next)
+		{
+			if (!obj->update_refresh_dim)
+				continue;
+
+			obj->update_refresh_dim = false;
+			widget_refresh_dim(obj);
+			refreshed = true;
+		}
+	} while (refreshed);
+}
+
+void widget_redraw_area(widget_t * root, const area_t * damaged_area)
+{
+	event_t * draw_event;
+	area_t clip;
+
+	PTR_CHECK(root, "widget_update");
+	PTR_CHECK(damaged_area, "widget_update");
+
+	area_set_intersection(&clip, damaged_area, framebuffer_area());
+
+	if (!area_value(&clip))
+		return;
+
+	if (render_thread_running())
+	{
+		render_thread_damage(root, &clip);
+		return;
+	}
+
+	draw_event = event_new(event_code_draw, &clip, NULL);
+	PTR_CHECK(draw_event, "widget_update");
+
+	sprite_overlay_lift(&clip);
+	widget_event_emit(root, draw_event);
+	sprite_overlay_drop();
+
+	framebuffer_inform_written_area(clip.x, clip.y, clip.width, clip.height);
+}
+
+void widget_begin_update(widget_t * root)
+{
+	PTR_CHECK(root, "widget_update");
+
+	if (depth == 0)
+	{
+		damage = damage_new();
+		PTR_CHECK(damage, "widget_update");
+		update_root = root;
+	}
+	else if (root != update_root)
+	{
+		LOG_ERROR("widget_update", "Nested update started on a different root, the outermost root is kept.");
+	}
+
+	depth++;
+}
+
+void widget_commit_update(widget_t * root)
+{
+	widget_t * obj;
+	area_t area;
+	size_t i;
+
+	PTR_CHECK(root, "widget_update");
+
+	if (depth == 0)
+	{
+		LOG_ERROR("widget_update", "Commit without a matching begin.");
+		return;
+	}
+
+	if (depth > 1)
+	{
+		depth--;
+		return;
+	}
+
+	refresh_pending_dimensions();
+
+	depth = 0;
+
+	while (pending_list)
+	{
+		obj = pending_list;
+		pending_list = obj->update_next;
+
+		obj->update_pending = false;
+		obj->update_next = NULL;
+
+		area = visible_area(obj);
+		damage_add(damage, &area);
+	}
+
+	if (update_root)
+	{
+		for (i = 0; i < damage_count(damage); i++)
+			widget_redraw_area(update_root, damage_area(damage, i));
+	}
+
+	damage_delete(damage);
+	damage = NULL;
+	update_root = NULL;
+}
+
+bool widget_update_in_progress(void)
+{
+	return depth > 0;
+}
+
+void widget_invalidate(widget_t * obj)
+{
+	PTR_CHECK(obj, "widget_update");
+
+	generation++;
+
+	if (depth == 0 || obj->update_pending)
+		return;
+
+	damage_current_area(obj);
+
+	obj->update_pending = true;
+	obj->update_next = pending_list;
+	pending_list = obj;
+}
+
+void widget_invalidate_dim(widget_t * obj)
+{
+	PTR_CHECK(obj, "widget_update");
+
+	if (depth == 0)
+		return;
+
+	widget_invalidate(obj);
+	obj->update_refresh_dim = true;
+}
+
+void widget_invalidate_area(widget_t * obj, const area_t * area)
+{
+	area_t damaged;
+
+	PTR_CHECK(obj, "widget_update");
+	PTR_CHECK(area, "widget_update");
+
+	generation++;
+
+	if (depth == 0 || obj->update_pending)
+		return;
+
+	damaged = visible_area(obj);
+	area_set_intersection(&damaged, &damaged, area);
+	damage_add(damage, &damaged);
+}
+
+void widget_update_forget(widget_t * obj)
+{
+	widget_t ** iterator;
+
+	PTR_CHECK(obj, "widget_update");
+
+	generation++;
+
+	if (depth == 0)
+		return;
+
+	if (obj->update_pending)
+	{
+		for (iterator = &pending_list; *iterator; iterator = &(*iterator)->update_next)
+		{
+			if (*iterator == obj)
+			{
+				*iterator = obj->update_next;
+				break;
+			}
+		}
+	}
+	else
+	{
+		damage_current_area(obj);
+	}
+
+	if (obj == update_root)
+		update_root = NULL;
+}
+
+uint32_t widget_update_generation(void)
+{
+	return generation;
+}
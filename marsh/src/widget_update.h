@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef WIDGET_UPDATE_H_
+#define WIDGET_UPDATE_H_
+
+#include "types.h"
+
+/*
+ * Batched widget updates.
+ *
+ * Between widget_begin_update and widget_commit_update widget setters only record
+ * real changes, a setter receiving the value it already holds returns right after
+ * the comparison. The outermost commit recomputes the dimension of the widgets that
+ * asked for it, merges the old and new areas of every changed widget into a damage
+ * set, redraws root's tree clipped to each damaged area and informs the framebuffer
+ * of the written areas.
+ *
+ * Transactions may be nested, only the outermost commit redraws. Out of a transaction
+ * setters keep their immediate behavior and nothing is redrawn automatically.
+ */
+
+void widget_begin_update(widget_t * root);
+void widget_commit_update(widget_t * root);
+bool widget_update_in_progress(void);
+
+/* Redraws root's tree clipped to area, keeping sprites on top, and informs the
+ * framebuffer of the written area. With the render thread running the area is
+ * damaged for the next published frame instead. */
+void widget_redraw_area(widget_t * root, const area_t * area);
+
+/* Called by widget setters after detecting a real change and before applying it.
+ * widget_invalidate_dim also schedules widget_refresh_dim for the commit. Out of a
+ * transaction they only count the change in widget_update_generation, so widgets
+ * drawing a change right away call them too. */
+void widget_invalidate(widget_t * obj);
+void widget_invalidate_dim(widget_t * obj);
+/* Damages only the given part of the widget, in framebuffer coordinates, for widgets
+ * able to tell which part of them a change affects. */
+void widget_invalidate_area(widget_t * obj, const area_t * area);
+
+/* Counts the invalidations and widget deletions, in and out of transactions, what
+ * changed since a frame was drawn as far as setters can tell. */
+uint32_t widget_update_generation(void);
+
+#endif /* WIDGET_UPDATE_H_ */
@@ -0,0 +1,165 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "animation.h"
+#include "area.h"
+#include "color.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "widget.h"
+#include "widget_tree.h"
+}
+
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+static int draws = 0;
+static void count_draw(void *, const area_t *)
+{
+	draws++;
+}
+
+static char last_html[COLOR_HTML_CODE_SIZE];
+static void store_html(void *, const char * html_color_code)
+{
+	strcpy(last_html, html_color_code);
+}
+
+static int32_t last_value = 0;
+static void store_value(void *, int32_t value)
+{
+	last_value = value;
+}
+
+TEST_GROUP(animation)
+{
+	widget_t * root;
+	widget_t * child;
+
+	void setup()
+	{
+		marshmallow_terminal_output = output_intercepter;
+		framebuffer_init();
+		event_pool_init();
+
+		root = widget_new(NULL, this, count_draw, NULL);
+		child = widget_new(root, this, count_draw, NULL);
+		widget_set_area(root, 0, 0, 800, 480);
+		widget_set_area(child, 0, 0, 10, 10);
+		draws = 0;
+	}
+
+	void teardown()
+	{
+		animation_stop_all();
+		widget_tree_delete(root);
+		event_pool_deinit();
+		framebuffer_deinit();
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+};
+
+TEST(animation, easing_endpoints)
+{
+	int easing;
+
+	for (easing = ANIMATION_EASE_LINEAR; easing <= ANIMATION_EASE_IN_OUT_CUBIC; easing++)
+	{
+		CHECK_EQUAL(0, animation_ease((enum e_animation_easing)easing, 0));
+		CHECK_EQUAL(ANIMATION_Q16_ONE, animation_ease((enum e_animation_easing)easing, ANIMATION_Q16_ONE));
+	}
+
+	CHECK_EQUAL(ANIMATION_Q16_ONE / 2, animation_ease(ANIMATION_EASE_LINEAR, ANIMATION_Q16_ONE / 2));
+	CHECK_EQUAL(ANIMATION_Q16_ONE / 4, animation_ease(ANIMATION_EASE_IN_QUAD, ANIMATION_Q16_ONE / 2));
+	CHECK_EQUAL(ANIMATION_Q16_ONE / 2, animation_ease(ANIMATION_EASE_IN_OUT_CUBIC, ANIMATION_Q16_ONE / 2));
+}
+
+TEST(animation, move_interpolates_and_ends_on_target)
+{
+	CHECK_TRUE(animation_move(child, 100, 50, 100, ANIMATION_EASE_LINEAR));
+	CHECK_EQUAL(1, animation_count());
+
+	animation_tick(root, 50);
+	CHECK_EQUAL(50, widget_area(child)->x);
+	CHECK_EQUAL(25, widget_area(child)->y);
+	/* Old and new bounds are disjoint: root is drawn in both, child in the new one. */
+	CHECK_EQUAL(3, draws);
+
+	animation_tick(root, 60);
+	CHECK_EQUAL(100, widget_area(child)->x);
+	CHECK_EQUAL(50, widget_area(child)->y);
+	CHECK_EQUAL(0, animation_count());
+}
+
+TEST(animation, unchanged_frames_do_not_draw)
+{
+	animation_resize(child, 11, 10, 1000, ANIMATION_EASE_LINEAR);
+
+	animation_tick(root, 16);
+	CHECK_EQUAL(10, widget_area(child)->width);
+	CHECK_EQUAL(0, draws);
+
+	animation_tick(root, 1000);
+	CHECK_EQUAL(11, widget_area(child)->width);
+	CHECK_EQUAL(2, draws);
+}
+
+TEST(animation, restart_replaces_running_animation)
+{
+	animation_move(child, 100, 0, 100, ANIMATION_EASE_LINEAR);
+	animation_tick(root, 50);
+	animation_move(child, 0, 0, 100, ANIMATION_EASE_LINEAR);
+
+	CHECK_EQUAL(1, animation_count());
+
+	animation_tick(root, 50);
+	CHECK_EQUAL(25, widget_area(child)->x);
+}
+
+TEST(animation, color_and_value)
+{
+	animation_color(child, NULL, store_html, color(0, 0, 0), color(0xFF, 0x80, 0x00), 10, ANIMATION_EASE_LINEAR);
+	animation_opacity(child, this, store_html, color(0xFF, 0xFF, 0xFF), color(0, 0, 0), 0, 255, 10, ANIMATION_EASE_LINEAR);
+	animation_value(child, NULL, store_value, -10, 10, 10, ANIMATION_EASE_LINEAR);
+	CHECK_EQUAL(3, animation_count());
+
+	animation_tick(root, 5);
+	CHECK_EQUAL(0, last_value);
+
+	animation_tick(root, 5);
+	CHECK_EQUAL(10, last_value);
+	STRCMP_EQUAL("#FFFFFF", last_html);
+	CHECK_EQUAL(0, animation_count());
+}
+
+TEST(animation, deleted_widget_stops_its_animations)
+{
+	animation_move(child, 100, 0, 100, ANIMATION_EASE_LINEAR);
+	widget_delete(child);
+
+	CHECK_EQUAL(0, animation_count());
+	animation_tick(root, 50);
+}
@@ -135,3 +135,26 @@ TEST(area, intersects)
 }
 
 
+
+TEST(area, union)
+{
+	area_t a, b, u;
+
+	area_set(&a, 10, 10, 20, 20);
+	area_set(&b, 40, 5, 10, 10);
+	area_set_union(&u, &a, &b);
+
+	CHECK_EQUAL(10, u.x);
+	CHECK_EQUAL(5, u.y);
+	CHECK_EQUAL(40, u.width);
+	CHECK_EQUAL(25, u.height);
+
+	area_clear(&b);
+	area_set_union(&u, &a, &b);
+
+	CHECK_TRUE(area_same(&a, &u));
+
+	area_set_union(&a, &b, &a);
+
+	CHECK_TRUE(area_same(&a, &u));
+}
@@ -0,0 +1,379 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+extern "C" {
+#include "asset_pack.h"
+#include "font.h"
+#include "bitmap_data/bitmap_data.h"
+#include "bitmap_data/bitmaps.h"
+#include "font_data/font_data.h"
+#include "font_data/fonts.h"
+}
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+/* Lays a pack out as image_processor -pack does, in a 16 byte aligned buffer. */
+struct pack_builder
+{
+	struct item
+	{
+		std::string name;
+		struct s_asset_pack_entry entry;
+		std::vector<uint8_t> data, table, widths;
+	};
+
+	std::vector<item> items;
+
+	static bool by_hash(const item & a, const item & b)
+	{
+		return a.entry.hash < b.entry.hash;
+	}
+
+	item & add(const char * name, enum e_asset_pack_kind kind, uint16_t layout, const void * data, size_t size)
+	{
+		item added;
+
+		memset(&added.entry, 0, sizeof(added.entry));
+		added.name = name;
+		added.entry.hash = asset_pack_hash(name);
+		added.entry.kind = (uint16_t)kind;
+		added.entry.layout = layout;
+		added.entry.pixel_format = ASSET_PACK_ANY_FORMAT;
+		added.data.assign((const uint8_t *)data, (const uint8_t *)data + size);
+		items.push_back(added);
+
+		return items.back();
+	}
+
+	void add_bitmap(const char * name, bitmap_t * bitmap, size_t size)
+	{
+		item & added = add(name, ASSET_PACK_BITMAP, (uint16_t)bitmap->bitmap_data_width, bitmap->bitmap, size);
+
+		added.entry.width = bitmap->width;
+		added.entry.height = bitmap->height;
+		added.entry.flags = bitmap->single_channel ? ASSET_PACK_SINGLE_CHANNEL : 0;
+	}
+
+	void add_font(const char * name, font_t * font)
+	{
+		size_t glyphs = 0, c;
+
+		for (c = 0; c < 256; c++)
+			glyphs = std::max(glyphs, (size_t)font->index[c] + 1);
+
+		item & added = add(name, ASSET_PACK_FONT, (uint16_t)font->bitmap_data_width, font->bitmap, glyphs * 2 * font->height);
+		added.entry.height = font->height;
+		added.table.assign((const uint8_t *)font->index, (const uint8_t *)(font->index + 256));
+		added.widths.assign(font->width, font->width + glyphs);
+	}
+
+	static uint32_t place(std::vector<uint8_t> & pack, const std::vector<uint8_t> & payload)
+	{
+		uint32_t offset;
+
+		pack.resize((pack.size() + ASSET_PACK_ALIGN - 1) / ASSET_PACK_ALIGN * ASSET_PACK_ALIGN);
+		offset = (uint32_t)pack.size();
+		pack.insert(pack.end(), payload.begin(), payload.end());
+
+		return offset;
+	}
+
+	/* Malloced, the caller frees it. */
+	uint8_t * build(size_t * size)
+	{
+		struct s_asset_pack_header header;
+		std::vector<uint8_t> pack(sizeof(header) + items.size() * sizeof(struct s_asset_pack_entry));
+		std::vector<struct s_asset_pack_entry> entries;
+		uint8_t * copy;
+		size_t i;
+
+		std::stable_sort(items.begin(), items.end(), by_hash);
+
+		memcpy(header.magic, ASSET_PACK_MAGIC, 4);
+		header.byte_order = ASSET_PACK_BYTE_ORDER;
+		header.version = ASSET_PACK_VERSION;
+		header.entry_size = sizeof(struct s_asset_pack_entry);
+		header.entry_count = (uint32_t)items.size();
+		header.entries = sizeof(header);
+		header.names = (uint32_t)pack.size();
+		header.reserved = 0;
+
+		for (i = 0; i < items.size(); i++)
+		{
+			entries.push_back(items[i].entry);
+			entries[i].name = (uint32_t)pack.size();
+			pack.insert(pack.end(), items[i].name.c_str(), items[i].name.c_str() + items[i].name.size() + 1);
+		}
+		for (i = 0; i < items.size(); i++)
+		{
+			entries[i].data = place(pack, items[i].data);
+			entries[i].data_size = (uint32_t)items[i].data.size();
+			if (!items[i].table.empty())
+			{
+				entries[i].table = place(pack, items[i].table);
+				entries[i].table_size = (uint32_t)items[i].table.size();
+			}
+			if (!items[i].widths.empty())
+			{
+				entries[i].widths = place(pack, items[i].widths);
+				entries[i].widths_size = (uint32_t)items[i].widths.size();
+			}
+		}
+
+		header.size = (uint32_t)pack.size();
+		memcpy(&pack[0], &header, sizeof(header));
+		if (!entries.empty())
+			memcpy(&pack[sizeof(header)], &entries[0], entries.size() * sizeof(entries[0]));
+
+		copy = (uint8_t *)malloc(pack.size());
+		memcpy(copy, &pack[0], pack.size());
+		*size = pack.size();
+
+		return copy;
+	}
+};
+
+static struct s_asset_pack_entry * entry_of(uint8_t * pack, const char * name)
+{
+	struct s_asset_pack_header * header = (struct s_asset_pack_header *)pack;
+	struct s_asset_pack_entry * entries = (struct s_asset_pack_entry *)(pack + header->entries);
+	uint32_t i;
+
+	for (i = 0; i < header->entry_count; i++)
+		if (!strcmp((const char *)pack + entries[i].name, name))
+			return &entries[i];
+
+	return NULL;
+}
+
+/* Bytes the runs of an 8BPP_RLE bitmap take. */
+static size_t rle_size(const bitmap_t * bitmap)
+{
+	const uint8_t * runs = (const uint8_t *)bitmap->bitmap;
+	size_t used = 0, column, row;
+
+	for (row = 0; row < bitmap->height; row++)
+		for (column = 0; column < bitmap->width; column += BITMAP_RLE_LENGTH(runs[used]), used += 1
+				+ (BITMAP_RLE_KIND(runs[used]) == BITMAP_RLE_PARTIAL ? BITMAP_RLE_LENGTH(runs[used]) : 0))
+			;
+
+	return used;
+}
+
+TEST_GROUP(asset_pack)
+{
+	pack_builder builder;
+	uint8_t * data;
+	size_t size;
+
+	void setup()
+	{
+		marshmallow_terminal_output = output_intercepter;
+
+		builder.add_bitmap("lena", lena_bitmap, lena_bitmap->width * lena_bitmap->height * 2);
+		builder.add_bitmap("wifi", wifi_icon_bitmap, wifi_icon_bitmap->width * wifi_icon_bitmap->height);
+		builder.add_font("ubuntu_monospace_16", ubuntu_monospace_16);
+		data = builder.build(&size);
+	}
+
+	void teardown()
+	{
+		free(data);
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+
+	bool inside(const void * pointer)
+	{
+		return (const uint8_t *)pointer >= data && (const uint8_t *)pointer < data + size;
+	}
+};
+
+TEST(asset_pack, assets_point_into_the_pack)
+{
+	asset_pack_t * pack = asset_pack_from_memory(data, size);
+	bitmap_t * lena, * wifi;
+	font_t * font;
+	int c;
+
+	CHECK(pack != NULL);
+
+	lena = asset_pack_bitmap(pack, "lena");
+	CHECK(lena != NULL);
+	CHECK(inside(lena->bitmap));
+	CHECK_EQUAL(256u, lena->width);
+	CHECK_EQUAL(256u, lena->height);
+	CHECK(!lena->single_channel);
+	CHECK_EQUAL(BITMAP_BUFFER_16BPP, lena->bitmap_data_width);
+	POINTERS_EQUAL(NULL, lena->palette);
+	CHECK_EQUAL(0, memcmp(lena->bitmap, lena_bitmap->bitmap, 256 * 256 * 2));
+	POINTERS_EQUAL(lena, asset_pack_bitmap(pack, "lena"));
+
+	wifi = asset_pack_bitmap(pack, "wifi");
+	CHECK(wifi != NULL);
+	CHECK(wifi->single_channel);
+	CHECK_EQUAL(BITMAP_BUFFER_8BPP, wifi->bitmap_data_width);
+	CHECK_EQUAL(0, memcmp(wifi->bitmap, wifi_icon_bitmap->bitmap, wifi->width * wifi->height));
+
+	font = asset_pack_font(pack, "ubuntu_monospace_16");
+	CHECK(font != NULL);
+	CHECK(inside(font->bitmap) && inside(font->index) && inside(font->width));
+	CHECK_EQUAL(16, font->height);
+	CHECK_EQUAL(FONT_BUFFER_16BITS, font->bitmap_data_width);
+	for (c = 1; c < 128; c++)
+	{
+		CHECK_EQUAL(font_char_width(ubuntu_monospace_16, (char)c), font_char_width(font, (char)c));
+		CHECK_EQUAL(0, memcmp((const uint8_t *)font->bitmap + font->index[c] * 32,
+				(const uint8_t *)ubuntu_monospace_16->bitmap + ubuntu_monospace_16->index[c] * 32, 32));
+	}
+
+	asset_pack_close(pack);
+}
+
+TEST(asset_pack, lookups_match_names_and_kinds)
+{
+	asset_pack_t * pack;
+
+	/* Another entry under the hash of lena. */
+	builder.add_bitmap("not lena", wifi_icon_bitmap, wifi_icon_bitmap->width * wifi_icon_bitmap->height);
+	builder.items.back().entry.hash = asset_pack_hash("lena");
+	free(data);
+	data = builder.build(&size);
+	pack = asset_pack_from_memory(data, size);
+
+	CHECK_EQUAL(256u, asset_pack_bitmap(pack, "lena")->width);
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, "lena2"));
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, ""));
+	POINTERS_EQUAL(NULL, asset_pack_font(pack, "lena"));
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, "ubuntu_monospace_16"));
+	STRCMP_CONTAINS("No such", intercepted_output[0]);
+
+	asset_pack_close(pack);
+}
+
+TEST(asset_pack, bad_packs_and_entries_are_refused)
+{
+	asset_pack_t * pack;
+	uint8_t * copy;
+
+	copy = (uint8_t *)malloc(size + ASSET_PACK_ALIGN);
+	memcpy(copy + 1, data, size);
+	POINTERS_EQUAL(NULL, asset_pack_from_memory(copy + 1, size));
+	free(copy);
+
+	POINTERS_EQUAL(NULL, asset_pack_from_memory(data, size - 1));
+	POINTERS_EQUAL(NULL, asset_pack_from_memory(data, sizeof(struct s_asset_pack_header) - 1));
+
+	data[0] = 'X';
+	POINTERS_EQUAL(NULL, asset_pack_from_memory(data, size));
+	data[0] = ASSET_PACK_MAGIC[0];
+
+	((struct s_asset_pack_header *)data)->version++;
+	POINTERS_EQUAL(NULL, asset_pack_from_memory(data, size));
+	((struct s_asset_pack_header *)data)->version--;
+
+	/* Past the end, not the pixel format, a font glyph missing. */
+	entry_of(data, "lena")->data_size = size;
+	entry_of(data, "wifi")->layout = BITMAP_BUFFER_NATIVE;
+	entry_of(data, "wifi")->pixel_format = MARSH_PIXEL_FORMAT + 1;
+	entry_of(data, "ubuntu_monospace_16")->widths_size = 10;
+	pack = asset_pack_from_memory(data, size);
+	CHECK(pack != NULL);
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, "lena"));
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, "wifi"));
+	POINTERS_EQUAL(NULL, asset_pack_font(pack, "ubuntu_monospace_16"));
+	asset_pack_close(pack);
+}
+
+TEST(asset_pack, open_maps_the_file)
+{
+	char path[] = "/tmp/asset_pack_testXXXXXX";
+	asset_pack_t * pack;
+	bitmap_t * lena;
+	FILE * file;
+	int fd;
+
+	fd = mkstemp(path);
+	CHECK(fd >= 0);
+	file = fdopen(fd, "wb");
+	CHECK_EQUAL(size, fwrite(data, 1, size, file));
+	fclose(file);
+
+	pack = asset_pack_open(path);
+	unlink(path);
+	CHECK(pack != NULL);
+
+	lena = asset_pack_bitmap(pack, "lena");
+	CHECK(lena != NULL);
+	CHECK(!inside(lena->bitmap));
+	CHECK_EQUAL(0, memcmp(lena->bitmap, lena_bitmap->bitmap, 256 * 256 * 2));
+	CHECK(asset_pack_font(pack, "ubuntu_monospace_16") != NULL);
+
+	asset_pack_close(pack);
+
+	POINTERS_EQUAL(NULL, asset_pack_open("/nonexistent/assets.pack"));
+}
+
+TEST(asset_pack, rle_runs_are_checked_at_the_first_lookup)
+{
+	const size_t runs = rle_size(wifi_icon_rle_bitmap);
+	asset_pack_t * pack;
+	bitmap_t * wifi;
+
+	builder.add_bitmap("wifi rle", wifi_icon_rle_bitmap, runs);
+	builder.add_bitmap("cut", wifi_icon_rle_bitmap, runs - 1);
+	builder.add_bitmap("past its row", wifi_icon_rle_bitmap, runs);
+	builder.add_bitmap("no kind", wifi_icon_rle_bitmap, runs);
+	free(data);
+	data = builder.build(&size);
+	data[entry_of(data, "past its row")->data] = BITMAP_RLE_OPAQUE | (BITMAP_RLE_MAX_LENGTH - 1);
+	data[entry_of(data, "no kind")->data] = 0xC0;
+
+	/* Bad runs refuse the bitmap, not the pack. */
+	pack = asset_pack_from_memory(data, size);
+	CHECK(pack != NULL);
+	wifi = asset_pack_bitmap(pack, "wifi rle");
+	CHECK(wifi != NULL);
+	CHECK_EQUAL(BITMAP_BUFFER_8BPP_RLE, wifi->bitmap_data_width);
+	CHECK_EQUAL(0, memcmp(wifi->bitmap, wifi_icon_rle_bitmap->bitmap, runs));
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, "cut"));
+	STRCMP_CONTAINS("Bad bitmap", intercepted_output[0]);
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, "past its row"));
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, "no kind"));
+	CHECK(asset_pack_bitmap(pack, "lena") != NULL);
+
+	/* The result of the first lookup is kept, the runs aren't walked again. */
+	data[entry_of(data, "no kind")->data] = *(const uint8_t *)wifi_icon_rle_bitmap->bitmap;
+	POINTERS_EQUAL(NULL, asset_pack_bitmap(pack, "no kind"));
+	data[entry_of(data, "wifi rle")->data] = 0xC0;
+	POINTERS_EQUAL(wifi, asset_pack_bitmap(pack, "wifi rle"));
+	asset_pack_close(pack);
+}
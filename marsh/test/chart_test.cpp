@@ -0,0 +1,195 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "chart.h"
+#include "color.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "widget.h"
+#include "widget_tree.h"
+}
+
+#include "mocks/draw_probe.h"
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+TEST_GROUP(chart)
+{
+	widget_t * root;
+	chart_t * cut;
+	struct probe probe;
+	int line;
+	int area;
+
+	void setup()
+	{
+		marshmallow_terminal_output = output_intercepter;
+		framebuffer_init();
+		event_pool_init();
+
+		root = widget_new(NULL, NULL, NULL, NULL);
+		widget_set_area(root, 0, 0, 800, 480);
+
+		cut = chart_new(root);
+		chart_set_position(cut, 10, 20);
+		chart_set_size(cut, 100, 51);
+		chart_set_range(cut, -50, 50);
+		chart_set_grid(cut, "#808080", 16, 10);
+		area = chart_add_series(cut, "#0000FF", CHART_AREA);
+		line = chart_add_series(cut, "#FF0000", CHART_LINE);
+
+		memset(&probe, 0, sizeof(probe));
+		widget_set_area(widget_new(chart_get_widget(cut), &probe, probe_draw, NULL), 10, 20, 100, 51);
+
+		widget_tree_draw(root);
+		probe.draws = 0;
+	}
+
+	void teardown()
+	{
+		widget_tree_delete(root);
+		event_pool_deinit();
+		framebuffer_deinit();
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+
+	void push(int32_t area_value, int32_t line_value)
+	{
+		int32_t frame[2];
+
+		frame[area] = area_value;
+		frame[line] = line_value;
+		chart_push(cut, frame, 1);
+	}
+
+	pixel_t pixel(dim_t x, dim_t y)
+	{
+		return framebuffer_start()[10 + x + (20 + y) * framebuffer_stride()];
+	}
+};
+
+TEST(chart, push_draws_new_columns_only)
+{
+	push(10, -20);
+	push(20, 30);
+	push(-10, 0);
+
+	CHECK_EQUAL(3, (int)chart_column_count(cut));
+	CHECK_EQUAL(3, probe.draws);
+	CHECK_EQUAL(109, probe.limit.x);
+	CHECK_EQUAL(1, probe.limit.width);
+	CHECK_EQUAL(51, probe.limit.height);
+	CHECK_TRUE(matches_full_redraw(root));
+}
+
+TEST(chart, shifted_frames_match_full_redraw)
+{
+	int32_t frames[2 * 37];
+	int i, n;
+
+	for (n = 0; n < 300; n += 37)
+	{
+		for (i = 0; i < 37; i++)
+		{
+			frames[2 * i + area] = ((n + i) * 7) % 101 - 50;
+			frames[2 * i + line] = ((n + i) * 13) % 91 - 45;
+		}
+		chart_push(cut, frames, 37);
+		CHECK_TRUE(matches_full_redraw(root));
+	}
+
+	CHECK_EQUAL(333, (int)chart_column_count(cut));
+}
+
+TEST(chart, decimation_keeps_column_extremes)
+{
+	int i;
+	pixel_t red = color_to_pixel(color_html("#FF0000"));
+
+	chart_set_samples_per_column(cut, 1000);
+
+	for (i = 0; i < 999; i++)
+		push(0, 0);
+	CHECK_EQUAL(0, (int)chart_column_count(cut));
+
+	push(0, 50);
+	CHECK_EQUAL(1, (int)chart_column_count(cut));
+	CHECK_EQUAL(1, probe.draws);
+
+	/* The single column spans from the spike to the rest value. */
+	CHECK_EQUAL(red, pixel(99, 0));
+	CHECK_EQUAL(red, pixel(99, 25));
+	CHECK_TRUE(red != pixel(99, 26));
+}
+
+TEST(chart, area_fills_to_zero)
+{
+	pixel_t blue = color_to_pixel(color_html("#0000FF"));
+
+	/* Second column, off the vertical grid line. */
+	push(0, 50);
+	push(-30, 50);
+
+	CHECK_EQUAL(blue, pixel(99, 25));
+	CHECK_EQUAL(blue, pixel(99, 39));
+	CHECK_TRUE(blue != pixel(99, 41));
+	CHECK_TRUE(blue != pixel(99, 24));
+}
+
+TEST(chart, resize_keeps_recent_columns)
+{
+	int i;
+
+	for (i = 0; i < 150; i++)
+		push(i % 40, -(i % 30));
+
+	chart_set_size(cut, 40, 51);
+	widget_tree_draw(root);
+	chart_set_size(cut, 100, 51);
+	widget_tree_draw(root);
+
+	push(0, 0);
+	CHECK_TRUE(matches_full_redraw(root));
+	CHECK_EQUAL(151, (int)chart_column_count(cut));
+}
+
+TEST(chart, overlapping_sibling_is_not_moved)
+{
+	widget_t * overlay = widget_new(root, NULL, overlay_draw, NULL);
+
+	widget_set_area(overlay, 80, 30, 60, 20);
+	push(10, -20);
+	widget_tree_draw(root);
+	probe.draws = 0;
+
+	push(20, 30);
+
+	CHECK_EQUAL(1, probe.draws);
+	CHECK_EQUAL(10, probe.limit.x);
+	CHECK_EQUAL(100, probe.limit.width);
+	CHECK_TRUE(matches_full_redraw(root));
+}
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+extern "C" {
+#include "area.h"
+#include "damage.h"
+}
+
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+TEST_GROUP(damage)
+{
+	damage_t * cut;
+
+	void setup()
+	{
+		marshmallow_terminal_output = output_intercepter;
+		cut = damage_new();
+	}
+
+	void teardown()
+	{
+		damage_delete(cut);
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+};
+
+TEST(damage, empty_areas_are_ignored)
+{
+	area_t a;
+
+	area_set(&a, 10, 10, 0, 20);
+	damage_add(cut, &a);
+
+	CHECK_EQUAL(0, damage_count(cut));
+	CHECK_EQUAL((const area_t *)NULL, damage_area(cut, 0));
+}
+
+TEST(damage, disjoint_areas_are_kept)
+{
+	area_t a, b;
+
+	area_set(&a, 0, 0, 10, 10);
+	area_set(&b, 100, 100, 10, 10);
+	damage_add(cut, &a);
+	damage_add(cut, &b);
+
+	CHECK_EQUAL(2, damage_count(cut));
+}
+
+TEST(damage, overlapping_areas_are_merged)
+{
+	area_t a, b, c;
+
+	area_set(&a, 0, 0, 10, 10);
+	area_set(&b, 20, 0, 10, 10);
+	area_set(&c, 5, 5, 20, 2);
+	damage_add(cut, &a);
+	damage_add(cut, &b);
+	damage_add(cut, &c);
+
+	CHECK_EQUAL(1, damage_count(cut));
+	CHECK_EQUAL(0, damage_area(cut, 0)->x);
+	CHECK_EQUAL(0, damage_area(cut, 0)->y);
+	CHECK_EQUAL(30, damage_area(cut, 0)->width);
+	CHECK_EQUAL(10, damage_area(cut, 0)->height);
+}
+
+TEST(damage, overflow_merges_closest_areas)
+{
+	area_t a;
+	int i;
+
+	for (i = 0; i < DAMAGE_MAX_AREAS; i++)
+	{
+		area_set(&a, i * 100, 0, 10, 10);
+		damage_add(cut, &a);
+	}
+
+	area_set(&a, 0, 300, 10, 10);
+	damage_add(cut, &a);
+
+	CHECK_EQUAL(DAMAGE_MAX_AREAS, damage_count(cut));
+
+	damage_clear(cut);
+	CHECK_EQUAL(0, damage_count(cut));
+}
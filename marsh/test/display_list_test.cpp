@@ -0,0 +1,282 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "canvas.h"
+#include "chart.h"
+#include "display_list.h"
+#include "drawing_algorithms.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "gauge.h"
+#include "icon.h"
+#include "image.h"
+#include "rectangle.h"
+#include "scroll_view.h"
+#include "text.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+#include "bitmap_data/bitmaps.h"
+#include "font_data/fonts.h"
+#include "helper/my_string.h"
+}
+
+#include "mocks/reference_frame.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+static int stripes_draws;
+
+/* Two horizontally adjacent fills of one color, then one under the next widget. */
+static void stripes_draw(void * instance, const area_t * limiting_canvas_area)
+{
+	canvas_t * canv = canvas_new(limiting_canvas_area);
+
+	(*(int *)instance)++;
+	draw_fill_area(canv, 0x07E0, 0, 0, 20, 10);
+	draw_fill_area(canv, 0x07E0, 20, 0, 30, 10);
+	draw_fill_area(canv, 0xF800, 0, 20, 10, 10);
+	canvas_delete(canv);
+}
+
+TEST_GROUP(display_list)
+{
+	widget_t * screen;
+	rectangle_t * background;
+	rectangle_t * squares[3];
+	rectangle_t * rounded;
+	widget_t * stripes;
+	rectangle_t * cover;
+	icon_t * icon;
+	icon_t * rle_icon;
+	image_t * image;
+	image_t * scaled;
+	text_t * text;
+	display_list_t * cut;
+	struct reference_frame reference;
+
+	void setup()
+	{
+		int i;
+
+		framebuffer_init();
+		event_pool_init();
+		reference_frame_init(&reference);
+		stripes_draws = 0;
+
+		screen = widget_new(NULL, NULL, NULL, NULL);
+		widget_set_area(screen, 0, 0, (dim_t)framebuffer_width(), (dim_t)framebuffer_height());
+
+		background = rectangle_new(screen);
+		rectangle_set_fill_color_html(background, "#004000");
+		rectangle_set_position(background, 5, 5);
+		rectangle_set_size(background, 790, 470);
+
+		for (i = 0; i < 3; i++)
+		{
+			squares[i] = rectangle_new(rectangle_get_widget(background));
+			rectangle_set_position(squares[i], (dim_t)(i * 50), (dim_t)(i * 50));
+			rectangle_set_size(squares[i], 100, 100);
+			rectangle_set_fill_color_html(squares[i], i == 1 ? "#008000" : "#800000");
+		}
+
+		rounded = rectangle_new(rectangle_get_widget(background));
+		rectangle_set_position(rounded, 430, 50);
+		rectangle_set_size(rounded, 100, 100);
+		rectangle_set_fill_color_html(rounded, "#808080");
+		rectangle_set_border_color_html(rounded, "#c0c0c0");
+		rectangle_set_rounded_corner_radius(rounded, 13);
+
+		stripes = widget_new(screen, &stripes_draws, stripes_draw, NULL);
+		widget_set_area(stripes, 600, 300, 60, 40);
+
+		/* Hides the red square of the stripes. */
+		cover = rectangle_new(screen);
+		rectangle_set_position(cover, 590, 315);
+		rectangle_set_size(cover, 30, 30);
+		rectangle_set_fill_color_html(cover, "#0000FF");
+
+		icon = icon_new(screen);
+		icon_set_color_html(icon, "#00FFFF");
+		icon_set_position(icon, 20, 310);
+		icon_set_bitmap(icon, wifi_icon_bitmap);
+
+		rle_icon = icon_new(screen);
+		icon_set_color_html(rle_icon, "#FFFF00");
+		icon_set_position(rle_icon, 660, 200);
+		icon_set_bitmap(rle_icon, wifi_icon_rle_bitmap);
+
+		image = image_new(screen);
+		image_set_bitmap(image, lena_bitmap);
+		image_set_position(image, 120, 205);
+
+		scaled = image_new(screen);
+		image_set_bitmap(scaled, lena_bitmap);
+		image_set_position(scaled, 500, 230);
+		image_set_size(scaled, 173, 97, SCALE_BILINEAR);
+
+		text = text_new(screen);
+		text_set_color_html(text, "#E0E0E0");
+		text_set_font(text, ubuntu_monospace_16);
+		text_set_reference_position(text, 10, 400);
+		my_string_set(text_get_string(text), "Hello World!\nHow beautiful is it?");
+
+		cut = display_list_new();
+	}
+
+	void teardown()
+	{
+		int i;
+
+		display_list_delete(cut);
+		text_delete(text);
+		image_delete(scaled);
+		image_delete(image);
+		icon_delete(rle_icon);
+		icon_delete(icon);
+		rectangle_delete(cover);
+		widget_delete(stripes);
+		rectangle_delete(rounded);
+		for (i = 0; i < 3; i++)
+			rectangle_delete(squares[i]);
+		rectangle_delete(background);
+		widget_delete(screen);
+		reference_frame_deinit(&reference);
+		event_pool_deinit();
+		framebuffer_deinit();
+	}
+
+};
+
+TEST(display_list, recording_draws_nothing)
+{
+	memset(framebuffer_start(), 0, reference.size);
+	memset(reference.pixels, 0, reference.size);
+
+	display_list_record(cut, screen);
+
+	CHECK(display_list_recorded_length(cut) > 0);
+	CHECK(reference_frame_matches(&reference));
+}
+
+TEST(display_list, replay_matches_direct_draw)
+{
+	reference_frame_draw(&reference, screen);
+
+	display_list_record(cut, screen);
+	display_list_replay(cut);
+
+	CHECK(reference_frame_matches(&reference));
+}
+
+TEST(display_list, optimization_drops_hidden_and_merges_fills)
+{
+	display_list_record(cut, screen);
+
+	/* At least the background under the squares and lena, the merged stripe and the
+	 * red square under the cover. */
+	CHECK(display_list_length(cut) + 3 <= display_list_recorded_length(cut));
+}
+
+TEST(display_list, unchanged_tree_is_replayed_without_traversal)
+{
+	display_list_draw(cut, screen);
+	display_list_draw(cut, screen);
+	CHECK_EQUAL(1, stripes_draws);
+
+	display_list_invalidate(cut);
+	display_list_draw(cut, screen);
+	CHECK_EQUAL(2, stripes_draws);
+}
+
+TEST(display_list, setter_change_records_again)
+{
+	display_list_draw(cut, screen);
+
+	rectangle_set_fill_color_html(rounded, "#FF00FF");
+	reference_frame_draw(&reference, screen);
+	display_list_draw(cut, screen);
+
+	CHECK_EQUAL(3, stripes_draws);
+	CHECK(reference_frame_matches(&reference));
+}
+
+TEST(display_list, widgets_drawing_their_changes_record_again)
+{
+	widget_t * parent = rectangle_get_widget(background);
+	const int32_t samples[] = {10, 90, 30, 70, 50};
+	gauge_t * gauge = gauge_new(parent);
+	scroll_view_t * view = scroll_view_new(parent);
+	rectangle_t * content[2];
+	chart_t * chart = chart_new(parent);
+	int i;
+
+	/* Children of the background, out of the other widgets, drawing their changes
+	 * without redrawing the tree. */
+	gauge_set_position(gauge, 300, 20);
+	gauge_set_size(gauge, 100, 100);
+	gauge_set_thickness(gauge, 12);
+	gauge_set_value(gauge, 10);
+
+	scroll_view_set_position(view, 400, 200);
+	scroll_view_set_size(view, 90, 60);
+	scroll_view_set_content_size(view, 90, 120);
+	scroll_view_set_background_color_html(view, "#202020");
+	for (i = 0; i < 2; i++)
+	{
+		content[i] = rectangle_new(scroll_view_get_widget(view));
+		rectangle_set_position(content[i], 410, (dim_t)(205 + i * 60));
+		rectangle_set_size(content[i], 70, 20);
+		rectangle_set_fill_color_html(content[i], i ? "#FF8000" : "#0080FF");
+	}
+
+	chart_set_position(chart, 400, 300);
+	chart_set_size(chart, 90, 60);
+	chart_set_range(chart, 0, 100);
+	chart_add_series(chart, "#FFFF00", CHART_LINE);
+
+	display_list_draw(cut, screen);
+	gauge_set_value(gauge, 90);
+	reference_frame_draw(&reference, screen);
+	display_list_draw(cut, screen);
+	CHECK(reference_frame_matches(&reference));
+
+	scroll_view_scroll_by(view, 0, 30);
+	reference_frame_draw(&reference, screen);
+	display_list_draw(cut, screen);
+	CHECK(reference_frame_matches(&reference));
+
+	chart_push(chart, samples, sizeof(samples) / sizeof(samples[0]));
+	reference_frame_draw(&reference, screen);
+	display_list_draw(cut, screen);
+	CHECK(reference_frame_matches(&reference));
+
+	chart_delete(chart);
+	for (i = 0; i < 2; i++)
+		rectangle_delete(content[i]);
+	scroll_view_delete(view);
+	gauge_delete(gauge);
+}
@@ -0,0 +1,253 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "display_rotation.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "framebuffer_geometry.h"
+#include "widget.h"
+#include "widget_event.h"
+#include "widget_tree.h"
+}
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+/* Over a 32 pixel tile and off the 8x8 blocks both ways. */
+#define WIDTH 77
+#define HEIGHT 43
+
+static const enum e_display_rotation rotations[] = {DISPLAY_ROTATION_0, DISPLAY_ROTATION_90, DISPLAY_ROTATION_180,
+		DISPLAY_ROTATION_270};
+
+TEST_GROUP(display_rotation)
+{
+	framebuffer_geometry_t logical;
+	framebuffer_geometry_t panel;
+
+	void setup()
+	{
+		size_t x, y;
+
+		memset(&logical, 0, sizeof(logical));
+		memset(&panel, 0, sizeof(panel));
+
+		framebuffer_geometry_init(&logical, WIDTH, HEIGHT);
+		for (y = 0; y < HEIGHT; y++)
+			for (x = 0; x < WIDTH; x++)
+				*framebuffer_geometry_at(&logical, x, y) = (pixel_t)((y * WIDTH + x) * 40503u + 1);
+	}
+
+	void teardown()
+	{
+		framebuffer_geometry_deinit(&panel);
+		framebuffer_geometry_deinit(&logical);
+	}
+
+	void init_panel(enum e_display_rotation rotation)
+	{
+		size_t width, height;
+
+		display_rotation_panel_size(rotation, WIDTH, HEIGHT, &width, &height);
+		framebuffer_geometry_init(&panel, width, height);
+	}
+
+	/* Where the logical pixel x, y shows on the panel. */
+	pixel_t panel_pixel(enum e_display_rotation rotation, dim_t x, dim_t y)
+	{
+		switch (rotation)
+		{
+		case DISPLAY_ROTATION_90:
+			return *framebuffer_geometry_at(&panel, HEIGHT - 1 - y, x);
+		case DISPLAY_ROTATION_180:
+			return *framebuffer_geometry_at(&panel, WIDTH - 1 - x, HEIGHT - 1 - y);
+		case DISPLAY_ROTATION_270:
+			return *framebuffer_geometry_at(&panel, y, WIDTH - 1 - x);
+		case DISPLAY_ROTATION_0:
+		default:
+			return *framebuffer_geometry_at(&panel, x, y);
+		}
+	}
+};
+
+TEST(display_rotation, whole_screen_lands_where_the_panel_shows_it)
+{
+	area_t presented;
+	size_t i;
+	dim_t x, y;
+
+	for (i = 0; i < sizeof(rotations) / sizeof(rotations[0]); i++)
+	{
+		init_panel(rotations[i]);
+
+		CHECK(display_rotation_present(rotations[i], &panel, &logical, &logical.area, &presented));
+		CHECK(area_same(&panel.area, &presented));
+
+		for (y = 0; y < HEIGHT; y++)
+			for (x = 0; x < WIDTH; x++)
+				CHECK_EQUAL(*framebuffer_geometry_at(&logical, x, y), panel_pixel(rotations[i], x, y));
+	}
+}
+
+TEST(display_rotation, only_the_written_area_is_touched)
+{
+	area_t written, presented, logical_presented;
+	size_t i;
+	dim_t x, y;
+
+	area_set(&written, 5, 3, 41, 19);
+
+	for (i = 0; i < sizeof(rotations) / sizeof(rotations[0]); i++)
+	{
+		init_panel(rotations[i]);
+
+		CHECK(display_rotation_present(rotations[i], &panel, &logical, &written, &presented));
+		CHECK_EQUAL(written.width * written.height, presented.width * presented.height);
+
+		for (y = 0; y < HEIGHT; y++)
+		{
+			for (x = 0; x < WIDTH; x++)
+			{
+				point_t point = {x, y};
+				pixel_t expected = area_contains_point(&written, point) ? *framebuffer_geometry_at(&logical, x, y) : 0;
+
+				CHECK_EQUAL(expected, panel_pixel(rotations[i], x, y));
+			}
+		}
+
+		/* The panel area goes back to the logical one. */
+		display_rotation_area((enum e_display_rotation)((4 - rotations[i]) % 4), panel.width, panel.height,
+				&presented, &logical_presented);
+		CHECK(area_same(&written, &logical_presented));
+	}
+}
+
+TEST(display_rotation, written_areas_are_clipped_to_the_screen)
+{
+	area_t written, presented;
+
+	init_panel(DISPLAY_ROTATION_90);
+
+	area_set(&written, WIDTH - 10, -5, 20, 15);
+	CHECK(display_rotation_present(DISPLAY_ROTATION_90, &panel, &logical, &written, &presented));
+	CHECK_EQUAL(HEIGHT - 10, presented.x);
+	CHECK_EQUAL(WIDTH - 10, presented.y);
+	CHECK_EQUAL(10, presented.width);
+	CHECK_EQUAL(10, presented.height);
+
+	area_set(&written, WIDTH, 0, 20, 15);
+	CHECK_FALSE(display_rotation_present(DISPLAY_ROTATION_90, &panel, &logical, &written, &presented));
+}
+
+TEST(display_rotation, panel_points_turn_back_to_logical_ones)
+{
+	area_t pixel, on_panel;
+	size_t i;
+	int x, y;
+
+	area_set(&pixel, 12, 30, 1, 1);
+
+	for (i = 0; i < sizeof(rotations) / sizeof(rotations[0]); i++)
+	{
+		display_rotation_area(rotations[i], WIDTH, HEIGHT, &pixel, &on_panel);
+		x = on_panel.x;
+		y = on_panel.y;
+
+		display_rotation_point(rotations[i], WIDTH, HEIGHT, &x, &y);
+		CHECK_EQUAL(12, x);
+		CHECK_EQUAL(30, y);
+	}
+}
+
+static widget_t * interacted;
+
+static enum e_widget_event_handler_result record_interaction(widget_t * widget, event_t * event)
+{
+	const interaction_event_data_t * data = (const interaction_event_data_t *)event_data(event);
+
+	if (!area_contains_point(widget_area(widget), data->interaction_point))
+		return widget_event_not_consumed;
+
+	interacted = widget;
+	return widget_event_consumed;
+}
+
+TEST(display_rotation, interactions_reach_the_widget_under_the_panel_point)
+{
+	widget_t * root, * left, * right;
+	area_t pixel, on_panel;
+	size_t i;
+
+	framebuffer_init();
+	event_pool_init();
+
+	root = widget_new(NULL, NULL, NULL, NULL);
+	left = widget_new(root, NULL, NULL, NULL);
+	right = widget_new(root, NULL, NULL, NULL);
+	widget_set_area(root, 0, 0, framebuffer_width(), framebuffer_height());
+	widget_set_area(left, 0, 0, framebuffer_width() / 2, framebuffer_height());
+	widget_set_area(right, framebuffer_width() / 2, 0, framebuffer_width() / 2, framebuffer_height());
+	widget_event_install_handler(left, event_code_interaction_press, record_interaction);
+	widget_event_install_handler(left, event_code_interaction_release, record_interaction);
+	widget_event_install_handler(left, event_code_interaction_click, record_interaction);
+	widget_event_install_handler(right, event_code_interaction_press, record_interaction);
+	widget_event_install_handler(right, event_code_interaction_release, record_interaction);
+	widget_event_install_handler(right, event_code_interaction_click, record_interaction);
+
+	/* A pixel near the top left corner of the logical screen. */
+	area_set(&pixel, 20, 10, 1, 1);
+
+	for (i = 0; i < sizeof(rotations) / sizeof(rotations[0]); i++)
+	{
+		display_rotation_set(rotations[i]);
+		display_rotation_area(rotations[i], framebuffer_width(), framebuffer_height(), &pixel, &on_panel);
+
+		interacted = NULL;
+		widget_tree_press(root, on_panel.x, on_panel.y);
+		POINTERS_EQUAL(left, interacted);
+		interacted = NULL;
+		widget_tree_release(root, on_panel.x, on_panel.y);
+		POINTERS_EQUAL(left, interacted);
+		interacted = NULL;
+		widget_tree_click(root, on_panel.x, on_panel.y);
+		POINTERS_EQUAL(left, interacted);
+	}
+
+	display_rotation_set(DISPLAY_ROTATION_0);
+	widget_tree_delete(root);
+	event_pool_deinit();
+	framebuffer_deinit();
+}
+
+TEST(display_rotation, parses_degrees)
+{
+	enum e_display_rotation rotation = DISPLAY_ROTATION_0;
+
+	CHECK(display_rotation_parse("270", &rotation));
+	CHECK_EQUAL(DISPLAY_ROTATION_270, rotation);
+	CHECK_FALSE(display_rotation_parse("45", &rotation));
+	CHECK_EQUAL(DISPLAY_ROTATION_270, rotation);
+}
@@ -20,8 +20,19 @@
  */
 
 extern "C" {
+#include "area.h"
+#include "bitmap_data/bitmap_data.h"
+#include "bitmap_data/bitmaps.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "helper/number.h"
+#include "pixel_convert.h"
 }
 
+#include <cstdlib>
+#include <cstring>
+
 #include "mocks/terminal_intercepter.h"
 
 #include "CppUTest/TestHarness.h"
@@ -31,10 +42,26 @@ TEST_GROUP(drawing_algorithms)
 {
 	void setup()
 	{
+		framebuffer_init();
 	}
 
 	void teardown()
 	{
+		framebuffer_deinit();
+	}
+
+	pixel_t * line(dim_t y)
+	{
+		return framebuffer_start() + y * framebuffer_stride();
+	}
+
+	void fill_pattern(void)
+	{
+		size_t x, y;
+
+		for (y = 0; y < framebuffer_height(); y++)
+			for (x = 0; x < framebuffer_width(); x++)
+				line(y)[x] = (pixel_t)(y * 16 + x);
 	}
 };
 
@@ -43,3 +70,204 @@ TEST(drawing_algorithms, test_all_against_zero_area_canvas)
 	// TODO: test_all_against_zero_area_canvas
 }
 
+
+TEST(drawing_algorithms, clipped_canvas_keeps_writes_inside_clip)
+{
+	area_t area, clip;
+	canvas_t * canv;
+
+	area_set(&area, 10, 10, 20, 20);
+	area_set(&clip, 15, 15, 5, 5);
+	canv = canvas_new_clipped(&area, &clip);
+	draw_solid_rectangle(canv, 0xFFFF);
+	canvas_delete(canv);
+
+	CHECK_EQUAL(0x0000, line(14)[15]);
+	CHECK_EQUAL(0xFFFF, line(15)[15]);
+	CHECK_EQUAL(0xFFFF, line(19)[19]);
+	CHECK_EQUAL(0x0000, line(19)[20]);
+	CHECK_EQUAL(0x0000, line(20)[19]);
+}
+
+TEST(drawing_algorithms, move_region_overlapping)
+{
+	area_t area;
+	canvas_t * canv;
+
+	fill_pattern();
+	area_set(&area, 10, 10, 8, 8);
+	canv = canvas_new(&area);
+
+	draw_move_region(canv, 2, 3);
+	CHECK_EQUAL((pixel_t)(10 * 16 + 10), line(13)[12]);
+	CHECK_EQUAL((pixel_t)(14 * 16 + 15), line(17)[17]);
+	CHECK_EQUAL((pixel_t)(10 * 16 + 10), line(10)[10]); // Exposed pixels are untouched.
+	CHECK_EQUAL((pixel_t)(18 * 16 + 18), line(18)[18]); // Out of the region.
+
+	fill_pattern();
+	draw_move_region(canv, -3, -2);
+	CHECK_EQUAL((pixel_t)(12 * 16 + 13), line(10)[10]);
+	CHECK_EQUAL((pixel_t)(17 * 16 + 17), line(15)[14]);
+	CHECK_EQUAL((pixel_t)(9 * 16 + 10), line(9)[10]);
+
+	canvas_delete(canv);
+}
+
+TEST(drawing_algorithms, rle_icon_draws_as_its_alpha)
+{
+	/* Whole, then clipped on each side and inside. */
+	static const dim_t clips[][4] = {{0, 0, 50, 39}, {13, 0, 37, 39}, {0, 0, 21, 39}, {0, 9, 50, 30},
+			{0, 0, 50, 17}, {7, 11, 29, 5}};
+	size_t size = framebuffer_stride() * framebuffer_height() * sizeof(pixel_t);
+	pixel_t * expected = (pixel_t *)malloc(size);
+	area_t area, clip;
+	canvas_t * canv;
+	size_t i;
+
+	LONGS_EQUAL(BITMAP_BUFFER_8BPP_RLE, wifi_icon_rle_bitmap->bitmap_data_width);
+	LONGS_EQUAL(wifi_icon_bitmap->width, wifi_icon_rle_bitmap->width);
+	LONGS_EQUAL(wifi_icon_bitmap->height, wifi_icon_rle_bitmap->height);
+
+	area_set(&area, 100, 50, 50, 39);
+
+	for (i = 0; i < sizeof(clips) / sizeof(clips[0]); i++)
+	{
+		area_set(&clip, 100 + clips[i][0], 50 + clips[i][1], clips[i][2], clips[i][3]);
+
+		fill_pattern();
+		canv = canvas_new_clipped(&area, &clip);
+		draw_alpha_bitmap_8bpp(canv, 0xF81F, (BUFFER_PTR_RDOLY)wifi_icon_bitmap->bitmap, 0, 0, 50, 39);
+		canvas_delete(canv);
+		memcpy(expected, framebuffer_start(), size);
+
+		fill_pattern();
+		canv = canvas_new_clipped(&area, &clip);
+		draw_alpha_bitmap_8bpp_rle(canv, 0xF81F, (BUFFER_PTR_RDOLY)wifi_icon_rle_bitmap->bitmap, 0, 0, 50, 39);
+		canvas_delete(canv);
+
+		CHECK(memcmp(expected, framebuffer_start(), size) == 0);
+
+		/* In the opaque run of the second row. */
+		if (i == 0)
+			CHECK_EQUAL(0xF81F, line(51)[120]);
+	}
+
+	free(expected);
+}
+
+TEST(drawing_algorithms, indexed_bitmaps_expand_through_palette)
+{
+	/* Starting on odd and even indices, the 4 bit rows being padded to 38. */
+	static const dim_t clips[][4] = {{0, 0, 37, 5}, {1, 0, 36, 5}, {3, 1, 20, 3}, {0, 0, 18, 5}, {16, 2, 17, 2}};
+	static const enum e_pixel_convert_isa isas[] = {PIXEL_CONVERT_SCALAR, PIXEL_CONVERT_AVX2};
+	static uint8_t indices4[38 / 2 * 5], indices8[37 * 5];
+	pixel_t palette[256];
+	area_t area, clip;
+	canvas_t * canv;
+	size_t i, n, b, x, y, index;
+	bool inside;
+
+	for (i = 0; i < 256; i++)
+		palette[i] = (pixel_t)(0x8000 | i * 7);
+	for (i = 0; i < sizeof(indices4); i++)
+		indices4[i] = (uint8_t)(i * 37 + 11);
+	for (i = 0; i < sizeof(indices8); i++)
+		indices8[i] = (uint8_t)(i * 101 + 3);
+
+	area_set(&area, 100, 50, 37, 5);
+
+	for (n = 0; n < sizeof(isas) / sizeof(isas[0]); n++)
+	{
+		pixel_convert_set_isa(isas[n]);
+
+		for (b = 0; b < 2; b++)
+		{
+			for (i = 0; i < sizeof(clips) / sizeof(clips[0]); i++)
+			{
+				area_set(&clip, 100 + clips[i][0], 50 + clips[i][1], clips[i][2], clips[i][3]);
+
+				fill_pattern();
+				canv = canvas_new_clipped(&area, &clip);
+				if (b == 0)
+					draw_bitmap_indexed(canv, indices4, 4, palette, 0, 0, 37, 5);
+				else
+					draw_bitmap_indexed(canv, indices8, 8, palette, 0, 0, 37, 5);
+				canvas_delete(canv);
+
+				for (y = 48; y < 57; y++)
+				{
+					for (x = 98; x < 139; x++)
+					{
+						inside = x >= (size_t)clip.x && x < (size_t)(clip.x + clip.width) && y >= (size_t)clip.y && y < (size_t)(clip.y + clip.height);
+						if (!inside)
+						{
+							CHECK_EQUAL((pixel_t)(y * 16 + x), line(y)[x]);
+							continue;
+						}
+						index = b == 0 ? (indices4[(y - 50) * 19 + (x - 100) / 2] >> ((x - 100) & 1 ? 0 : 4)) & 0x0F
+								: indices8[(y - 50) * 37 + x - 100];
+						CHECK_EQUAL(palette[index], line(y)[x]);
+					}
+				}
+			}
+		}
+	}
+
+	pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+}
+
+/* The points of the midpoint circle of circle_loop, a pixel each, those off the
+ * 2 * radius + 1 square of the canvas dropped. */
+static void reference_circle(pixel_t * buffer, size_t stride, dim_t radius, dim_t xc, dim_t yc, pixel_t color)
+{
+	int32_t d1 = 3 - 2 * radius, x = 0, y = radius;
+	bool last = false;
+	int octant;
+
+	while (!last)
+	{
+		last = x >= y;
+		if (d1 < 0)
+			d1 += 4 * x + 6;
+		else
+		{
+			d1 += 4 * (x - y) + 10;
+			y--;
+		}
+		for (octant = 0; octant < 8; octant++)
+		{
+			int32_t px = octant & 1 ? y : x, py = octant & 1 ? x : y;
+			px = octant & 2 ? -px : px;
+			py = octant & 4 ? -py : py;
+			if (get_abs(px) <= radius && get_abs(py) <= radius)
+				buffer[xc + px + (yc + py) * stride] = color;
+		}
+		x++;
+	}
+}
+
+TEST(drawing_algorithms, circle_outline_matches_points)
+{
+	const size_t size = framebuffer_stride() * framebuffer_height() * sizeof(pixel_t);
+	const dim_t radii[] = {0, 1, 2, 7, 40, 111};
+	pixel_t * reference = (pixel_t *)calloc(1, size);
+	area_t area;
+	canvas_t * canv;
+	size_t i;
+
+	for (i = 0; i < sizeof(radii) / sizeof(radii[0]); i++)
+	{
+		memset(framebuffer_start(), 0, size);
+		memset(reference, 0, size);
+
+		area_set(&area, 300, 200, 2 * radii[i] + 1, 2 * radii[i] + 1);
+		canv = canvas_new(&area);
+		draw_circle(canv, 0xFFFF);
+		canvas_delete(canv);
+
+		reference_circle(reference, framebuffer_stride(), area.width / 2, 300 + area.width / 2, 200 + area.height / 2, 0xFFFF);
+		CHECK_TRUE(memcmp(reference, framebuffer_start(), size) == 0);
+	}
+
+	free(reference);
+}
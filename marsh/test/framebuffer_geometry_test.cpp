@@ -0,0 +1,154 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "framebuffer_geometry.h"
+}
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+/* Not a multiple of the row alignment, rows get padded. */
+#define WIDTH 803
+#define HEIGHT 60
+
+TEST_GROUP(framebuffer_geometry)
+{
+	framebuffer_geometry_t geometry;
+
+	void setup()
+	{
+		memset(&geometry, 0, sizeof(geometry));
+	}
+
+	void teardown()
+	{
+		framebuffer_geometry_deinit(&geometry);
+		canvas_delete_scratchpad();
+		framebuffer_configure(FRAMEBUFFER_DEFAULT_WIDTH, FRAMEBUFFER_DEFAULT_HEIGHT);
+		framebuffer_deinit();
+	}
+};
+
+TEST(framebuffer_geometry, rows_start_on_cache_lines)
+{
+	size_t y;
+
+	CHECK_EQUAL(800, framebuffer_geometry_stride(800));
+	CHECK_EQUAL(832, framebuffer_geometry_stride(WIDTH));
+	CHECK_EQUAL(32, framebuffer_geometry_stride(1));
+
+	CHECK_TRUE(framebuffer_geometry_init(&geometry, WIDTH, HEIGHT));
+	CHECK_EQUAL(832, geometry.stride);
+	for (y = 0; y < HEIGHT; y++)
+		CHECK_EQUAL(0, (uintptr_t)framebuffer_geometry_at(&geometry, 0, (dim_t)y) % FRAMEBUFFER_ROW_ALIGNMENT);
+	POINTERS_EQUAL(geometry.pixels + 5 * 832 + 7, framebuffer_geometry_at(&geometry, 7, 5));
+	CHECK_EQUAL(WIDTH, geometry.area.width);
+	CHECK_EQUAL(HEIGHT, geometry.area.height);
+}
+
+TEST(framebuffer_geometry, same_size_keeps_pixels)
+{
+	pixel_t * pixels;
+
+	CHECK_TRUE(framebuffer_geometry_init(&geometry, WIDTH, HEIGHT));
+	pixels = geometry.pixels;
+	pixels[42] = 0xFFFF;
+
+	CHECK_TRUE(framebuffer_geometry_init(&geometry, WIDTH, HEIGHT));
+	POINTERS_EQUAL(pixels, geometry.pixels);
+	CHECK_EQUAL(0, pixels[42]);
+
+	CHECK_TRUE(framebuffer_geometry_init(&geometry, 1920, 1080));
+	CHECK_EQUAL(1920, geometry.stride);
+}
+
+TEST(framebuffer_geometry, rejects_unsupported_sizes)
+{
+	size_t width = 0, height = 0;
+
+	CHECK_TRUE(framebuffer_geometry_init(&geometry, WIDTH, HEIGHT));
+	CHECK_FALSE(framebuffer_geometry_init(&geometry, 0, HEIGHT));
+	CHECK_FALSE(framebuffer_geometry_init(&geometry, FRAMEBUFFER_MAX_DIMENSION + 1, HEIGHT));
+	CHECK_EQUAL(WIDTH, geometry.width);
+	CHECK_FALSE(framebuffer_configure(WIDTH, 0));
+
+	CHECK_TRUE(framebuffer_geometry_parse("3840x2160", &width, &height));
+	CHECK_EQUAL(3840, width);
+	CHECK_EQUAL(2160, height);
+	CHECK_FALSE(framebuffer_geometry_parse("3840", &width, &height));
+	CHECK_FALSE(framebuffer_geometry_parse("3840x2160x2", &width, &height));
+	CHECK_FALSE(framebuffer_geometry_parse("0x10", &width, &height));
+}
+
+TEST(framebuffer_geometry, canvases_follow_the_stride)
+{
+	canvas_t * canv;
+	area_t area;
+	size_t x, y, drawn = 0;
+
+	CHECK_TRUE(framebuffer_configure(WIDTH, HEIGHT));
+	framebuffer_init();
+	CHECK_EQUAL(832, framebuffer_stride());
+	POINTERS_EQUAL(framebuffer_start() + 10 * 832 + 790, framebuffer_at(790, 10));
+
+	/* Crosses the right edge, the padding must stay untouched. */
+	area_set(&area, 790, 10, 40, 20);
+	canv = canvas_new(&area);
+	draw_solid_rectangle(canv, 0xFFFF);
+	canvas_delete(canv);
+
+	for (y = 0; y < HEIGHT; y++)
+		for (x = 0; x < framebuffer_stride(); x++)
+			if (framebuffer_start()[y * framebuffer_stride() + x])
+			{
+				CHECK_TRUE(x >= 790 && x < WIDTH && y >= 10 && y < 30);
+				drawn++;
+			}
+	CHECK_EQUAL((WIDTH - 790) * 20, drawn);
+}
+
+TEST(framebuffer_geometry, scratch_pad_follows_the_framebuffer)
+{
+	canvas_t * canv;
+
+	CHECK_TRUE(framebuffer_configure(WIDTH, HEIGHT));
+	framebuffer_init();
+	canv = canvas_new_scratchpad();
+	CHECK_TRUE(canvas_scratchpad(canv));
+	CHECK_EQUAL(WIDTH, canvas_get_width(canv));
+	draw_solid_rectangle(canv, 0x1234);
+	canvas_delete(canv);
+
+	CHECK_TRUE(framebuffer_configure(1920, 1080));
+	framebuffer_init();
+	canv = canvas_new_scratchpad();
+	CHECK_EQUAL(1920, canvas_get_width(canv));
+	draw_solid_rectangle(canv, 0x1234);
+	canvas_delete(canv);
+}
@@ -0,0 +1,297 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+#include <pthread.h>
+
+extern "C" {
+#include "area.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "framebuffer.h"
+#include "path_rasterizer.h"
+#include "command_queue.h"
+}
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+static int counted_fills;
+
+static void counting_fill_rect(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color)
+{
+	counted_fills++;
+	framebuffer_ops_software()->fill_rect(dst, stride, width, height, color);
+}
+
+static int counted_fences;
+
+/* The fill_rect another thread sees, into the pointer given. */
+static void * read_fill_rect(void * seen)
+{
+	*(const void **)seen = (const void *)framebuffer_ops()->fill_rect;
+
+	return NULL;
+}
+
+static uint32_t counting_fence(void)
+{
+	return ++counted_fences;
+}
+
+static void counting_wait(uint32_t fence)
+{
+	(void)fence;
+}
+
+static void draw_scene(void)
+{
+	static const uint8_t glyph[] = { 0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81 };
+	static const fixed_point_t star[] = {
+		{ PATH_FIXED(100), PATH_FIXED(10) }, { PATH_FIXED(130), PATH_FIXED(90) },
+		{ PATH_FIXED(60), PATH_FIXED(40) }, { PATH_FIXED(140), PATH_FIXED(40) },
+		{ PATH_FIXED(70), PATH_FIXED(90) } };
+	uint8_t alpha[16 * 16];
+	pixel_t image[12 * 12];
+	area_t area = { 5, 5, 300, 200 };
+	canvas_t * canv;
+	size_t i;
+
+	for (i = 0; i < sizeof(alpha); i++)
+		alpha[i] = (uint8_t)(i * 7);
+	for (i = 0; i < sizeof(image) / sizeof(image[0]); i++)
+		image[i] = (pixel_t)(i * 0x0421);
+
+	canv = canvas_new(&area);
+	draw_solid_rectangle(canv, 0x1234);
+	draw_fill_area(canv, 0xF800, 10, 10, 50, 30);
+	draw_bitmap_1bpp(canv, 0x07E0, glyph, 70, 10, 8, 8);
+	draw_alpha_bitmap_8bpp(canv, 0x001F, alpha, 90, 10, 16, 16);
+	draw_bitmap(canv, (const uint8_t *)image, 120, 10, 12, 12);
+	draw_polygon(canv, 0xFFE0, star, 5, FILL_EVEN_ODD, true);
+	draw_move_region(canv, 7, -3);
+	draw_round_rectangle(canv, 0xFFFF, 2, 8);
+	draw_circle(canv, 0x8410);
+	canvas_delete(canv);
+}
+
+TEST_GROUP(framebuffer_ops)
+{
+	pixel_t * reference;
+	size_t size;
+
+	void setup()
+	{
+		framebuffer_init();
+		size = framebuffer_stride() * framebuffer_height() * sizeof(pixel_t);
+		reference = (pixel_t *)malloc(size);
+	}
+
+	void teardown()
+	{
+		command_queue_stop();
+		framebuffer_set_ops(NULL);
+		free(reference);
+		framebuffer_deinit();
+	}
+};
+
+TEST(framebuffer_ops, software_ops_installed_by_default)
+{
+	CHECK(framebuffer_ops()->fill_rect == framebuffer_ops_software()->fill_rect);
+	CHECK(framebuffer_ops()->fence == NULL);
+	framebuffer_ops_sync();
+}
+
+TEST(framebuffer_ops, missing_entries_fall_back_to_software)
+{
+	framebuffer_ops_t partial;
+	area_t area = { 0, 0, 20, 20 };
+	canvas_t * canv;
+
+	memset(&partial, 0, sizeof(partial));
+	partial.fill_rect = counting_fill_rect;
+	counted_fills = 0;
+
+	framebuffer_set_ops(&partial);
+	CHECK(framebuffer_ops()->copy_rect != NULL);
+	CHECK(framebuffer_ops()->blend_a8 != NULL);
+
+	canv = canvas_new(&area);
+	draw_solid_rectangle(canv, 0xABCD);
+	draw_move_region(canv, 1, 1);
+	canvas_delete(canv);
+
+	CHECK_EQUAL(1, counted_fills);
+	CHECK_EQUAL(0xABCD, framebuffer_start()[framebuffer_stride() * 19 + 19]);
+}
+
+TEST(framebuffer_ops, installed_table_is_per_thread)
+{
+	framebuffer_ops_t partial = *framebuffer_ops_software();
+	const void * seen = NULL;
+	pthread_t other;
+
+	partial.fill_rect = counting_fill_rect;
+	framebuffer_set_ops(&partial);
+
+	CHECK_EQUAL(0, pthread_create(&other, NULL, read_fill_rect, &seen));
+	pthread_join(other, NULL);
+
+	CHECK(framebuffer_ops()->fill_rect == counting_fill_rect);
+	CHECK(seen == (const void *)framebuffer_ops_software()->fill_rect);
+}
+
+TEST(framebuffer_ops, queue_matches_software)
+{
+	memset(framebuffer_start(), 0, size);
+	draw_scene();
+	memcpy(reference, framebuffer_start(), size);
+
+	memset(framebuffer_start(), 0, size);
+	command_queue_start();
+	CHECK(command_queue_running());
+	draw_scene();
+	framebuffer_ops_sync();
+
+	CHECK(command_queue_executed() > 0);
+	CHECK(memcmp(reference, framebuffer_start(), size) == 0);
+
+	command_queue_stop();
+	CHECK(!command_queue_running());
+	CHECK(framebuffer_ops()->blit == framebuffer_ops_software()->blit);
+	CHECK(framebuffer_ops()->fence == NULL);
+}
+
+TEST(framebuffer_ops, fence_waits_for_submitted_operations)
+{
+	area_t area = { 0, 0, 1, 1 };
+	canvas_t * canv;
+	uint32_t fence;
+	int i;
+
+	command_queue_start();
+	canv = canvas_new(&area);
+
+	/* More than the queue holds, submit blocks until the worker frees a slot. */
+	for (i = 0; i < 3 * COMMAND_QUEUE_SIZE; i++)
+		draw_solid_rectangle(canv, (pixel_t)i);
+
+	fence = framebuffer_ops_fence();
+	framebuffer_ops_wait(fence);
+	CHECK_EQUAL(3 * COMMAND_QUEUE_SIZE, command_queue_executed());
+	CHECK_EQUAL(3 * COMMAND_QUEUE_SIZE - 1, framebuffer_start()[0]);
+
+	canvas_delete(canv);
+}
+
+TEST(framebuffer_ops, area_fence_waits_for_commands_writing_the_area)
+{
+	area_t busy = { 0, 0, 400, 400 };
+	area_t other = { 500, 10, 4, 4 };
+	canvas_t * canv;
+	int i;
+
+	command_queue_start();
+
+	canv = canvas_new(&busy);
+	for (i = 0; i < 20; i++)
+		draw_solid_rectangle(canv, (pixel_t)i);
+	canvas_delete(canv);
+
+	canv = canvas_new(&other);
+	draw_solid_rectangle(canv, 0xBEEF);
+	canvas_delete(canv);
+
+	framebuffer_ops_sync_area(&other);
+	CHECK_EQUAL(0xBEEF, framebuffer_start()[framebuffer_stride() * 13 + 503]);
+
+	framebuffer_ops_sync_area(&busy);
+	CHECK_EQUAL(19, framebuffer_start()[framebuffer_stride() * 399 + 399]);
+}
+
+TEST(framebuffer_ops, queue_times_each_operation)
+{
+	command_queue_stats_t stats;
+
+	command_queue_start();
+	draw_scene();
+	framebuffer_ops_sync();
+
+	command_queue_stats(COMMAND_QUEUE_FILL_RECT, &stats);
+	CHECK(stats.count > 0);
+	CHECK(stats.max_ns <= stats.busy_ns);
+	command_queue_stats(COMMAND_QUEUE_EXPAND_1BPP, &stats);
+	CHECK_EQUAL(1, stats.count);
+	command_queue_stats(COMMAND_QUEUE_BLIT, &stats);
+	CHECK_EQUAL(1, stats.count);
+
+	command_queue_stop();
+	command_queue_stats(COMMAND_QUEUE_BLIT, &stats);
+	CHECK_EQUAL(1, stats.count);
+}
+
+TEST(framebuffer_ops, circle_outline_fills_runs)
+{
+	framebuffer_ops_t partial;
+	area_t area = { 100, 100, 201, 201 };
+	canvas_t * canv;
+
+	memset(&partial, 0, sizeof(partial));
+	partial.fill_rect = counting_fill_rect;
+	counted_fills = 0;
+	framebuffer_set_ops(&partial);
+
+	canv = canvas_new(&area);
+	draw_circle(canv, 0xFFFF);
+	canvas_delete(canv);
+
+	/* 72 points an octant, in fewer runs. */
+	CHECK_TRUE(counted_fills > 0);
+	CHECK_TRUE(counted_fills < 8 * 50);
+}
+
+TEST(framebuffer_ops, anti_aliased_path_syncs_when_reusing_rows)
+{
+	static const fixed_point_t square[] = {
+		{ PATH_FIXED(10.5), PATH_FIXED(10.5) }, { PATH_FIXED(200.5), PATH_FIXED(10.5) },
+		{ PATH_FIXED(200.5), PATH_FIXED(210.5) }, { PATH_FIXED(10.5), PATH_FIXED(210.5) } };
+	framebuffer_ops_t partial;
+	area_t area = { 0, 0, 400, 400 };
+	canvas_t * canv;
+
+	/* Software kernels behind fences, counting the syncs. */
+	partial = *framebuffer_ops_software();
+	partial.fence = counting_fence;
+	partial.wait = counting_wait;
+	counted_fences = 0;
+	framebuffer_set_ops(&partial);
+
+	canv = canvas_new(&area);
+	draw_polygon(canv, 0xFFFF, square, 4, FILL_NONZERO, true);
+	CHECK_TRUE(counted_fences > 0);
+	CHECK_TRUE(counted_fences <= 201 / 32 + 1);
+
+	counted_fences = 0;
+	draw_polygon(canv, 0xFFFF, square, 4, FILL_NONZERO, false);
+	CHECK_EQUAL(0, counted_fences);
+	canvas_delete(canv);
+}
@@ -0,0 +1,156 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "color.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "gauge.h"
+#include "path_rasterizer.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+}
+
+#include "mocks/draw_probe.h"
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+TEST_GROUP(gauge)
+{
+	widget_t * root;
+	gauge_t * cut;
+	struct probe probe;
+
+	void setup()
+	{
+		marshmallow_terminal_output = output_intercepter;
+		framebuffer_init();
+		event_pool_init();
+
+		memset(&probe, 0, sizeof(probe));
+		root = widget_new(NULL, &probe, probe_draw, NULL);
+		widget_set_area(root, 0, 0, 800, 480);
+
+		cut = gauge_new(root);
+		gauge_set_position(cut, 100, 100);
+		gauge_set_size(cut, 101, 101);
+		gauge_set_thickness(cut, 12);
+		gauge_set_track_color_html(cut, "#404040");
+		gauge_set_value_color_html(cut, "#FFFFFF");
+		gauge_set_range(cut, 0, 1000);
+
+		widget_tree_draw(root);
+		probe.draws = 0;
+	}
+
+	void teardown()
+	{
+		widget_tree_delete(root);
+		event_pool_deinit();
+		framebuffer_deinit();
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+};
+
+TEST(gauge, value_change_draws_sector_spans_only)
+{
+	gauge_set_value(cut, 10);
+
+	CHECK_EQUAL(0, probe.draws);
+	CHECK_TRUE(matches_full_redraw(root));
+
+	gauge_set_value(cut, 600);
+	gauge_set_value(cut, 400);
+
+	CHECK_EQUAL(1, probe.draws);
+	CHECK_TRUE(matches_full_redraw(root));
+}
+
+TEST(gauge, counterclockwise_sweep_matches_full_redraw)
+{
+	const int32_t values[] = {500, 730, 200, 1000, 0};
+	size_t i;
+
+	gauge_set_angles(cut, PATH_DEGREES(45), PATH_DEGREES(-270));
+	widget_tree_draw(root);
+
+	for (i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+	{
+		gauge_set_value(cut, values[i]);
+		CHECK_TRUE(matches_full_redraw(root));
+	}
+}
+
+TEST(gauge, overlapping_sibling_redraws_sector_bounds)
+{
+	widget_t * overlay = widget_new(root, NULL, overlay_draw, NULL);
+
+	widget_set_area(overlay, 90, 90, 40, 120);
+	widget_tree_draw(root);
+	probe.draws = 0;
+
+	gauge_set_value(cut, 10);
+
+	CHECK_EQUAL(1, probe.draws);
+	CHECK_TRUE(area_value(&probe.limit) > 0);
+	CHECK_TRUE(area_value(&probe.limit) < 15 * 15);
+	CHECK_TRUE(matches_full_redraw(root));
+}
+
+TEST(gauge, increasing_and_decreasing_match_full_redraw)
+{
+	const int32_t values[] = {500, 730, 731, 200, 999, 1000, 0, 1500, -20};
+	size_t i;
+
+	for (i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+	{
+		gauge_set_value(cut, values[i]);
+		CHECK_TRUE(matches_full_redraw(root));
+	}
+}
+
+TEST(gauge, same_sweep_does_not_redraw)
+{
+	gauge_set_value(cut, 1000);
+	probe.draws = 0;
+
+	gauge_set_value(cut, 2000);
+	CHECK_EQUAL(0, probe.draws);
+	CHECK_EQUAL(2000, gauge_value(cut));
+}
+
+TEST(gauge, transaction_damages_sector_only)
+{
+	widget_begin_update(root);
+	gauge_set_value(cut, 250);
+	gauge_set_value(cut, 260);
+	widget_commit_update(root);
+
+	CHECK_TRUE(probe.draws >= 1);
+	CHECK_TRUE(area_value(&probe.limit) < 101 * 101 / 2);
+	CHECK_TRUE(matches_full_redraw(root));
+}
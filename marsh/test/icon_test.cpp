@@ -32,6 +32,8 @@ extern "C" {
 #include "icon.c"
 }
 
+#include <cstring>
+
 #include "mocks/terminal_intercepter.h"
 
 #include "CppUTest/TestHarness.h"
@@ -87,3 +89,62 @@ TEST(icon, Draw)
 	CHECK_EQUAL(0xFFFF, *framebuffer_at(1, 10));
 }
 
+
+TEST(icon, SizeVariants)
+{
+	static uint8_t half_data[10 * 10];
+	const struct s_bitmap half = {half_data, 10, 10, true, BITMAP_BUFFER_8BPP, NULL};
+	const bitmap_t * const list[] = {wifi_icon_bitmap, &half};
+	const struct s_bitmap_levels levels = {list, 2};
+
+	memset(half_data, 0xFF, sizeof(half_data));
+	icon_set_position(cut, 0, 0);
+	icon_set_levels(cut, &levels);
+	POINTERS_EQUAL(wifi_icon_bitmap, cut->bitmap);
+	CHECK_EQUAL(wifi_icon_bitmap->width, (uint32_t)widget_area(cut->glyph)->width);
+
+	/* Covered by the small level, drawn as it is. */
+	icon_set_size(cut, 10, 10, SCALE_BILINEAR);
+	POINTERS_EQUAL(&half, cut->bitmap);
+	widget_tree_draw(icon_get_widget(cut));
+	CHECK_EQUAL(0xFFFF, *framebuffer_at(0, 0));
+	CHECK_EQUAL(0xFFFF, *framebuffer_at(9, 9));
+	CHECK_EQUAL(0x0000, *framebuffer_at(10, 10));
+
+	icon_set_size(cut, 9, 7, SCALE_BILINEAR);
+	POINTERS_EQUAL(&half, cut->bitmap);
+	icon_set_size(cut, 11, 7, SCALE_BILINEAR);
+	POINTERS_EQUAL(wifi_icon_bitmap, cut->bitmap);
+
+	/* Past the largest one. */
+	icon_set_size(cut, 2 * wifi_icon_bitmap->width, 2 * wifi_icon_bitmap->height, SCALE_NEAREST);
+	POINTERS_EQUAL(wifi_icon_bitmap, cut->bitmap);
+
+	/* A plain bitmap drops the levels. */
+	icon_set_bitmap(cut, wifi_icon_bitmap);
+	icon_set_size(cut, 10, 10, SCALE_NEAREST);
+	POINTERS_EQUAL(wifi_icon_bitmap, cut->bitmap);
+	POINTERS_EQUAL(NULL, cut->levels);
+}
+
+TEST(icon, OnlyAlphaIconsAreResized)
+{
+	const bitmap_t * const list[] = {wifi_icon_bitmap, wifi_icon_rle_bitmap};
+	const struct s_bitmap_levels levels = {list, 2};
+
+	icon_set_levels(cut, &levels);
+	STRCMP_CONTAINS("Only 8BPP icons can be resized", intercepted_output[0]);
+	POINTERS_EQUAL(NULL, cut->bitmap);
+	POINTERS_EQUAL(NULL, cut->levels);
+
+	/* Run-length encoded ones are drawn at their own size only. */
+	icon_set_bitmap(cut, wifi_icon_rle_bitmap);
+	icon_set_size(cut, 10, 10, SCALE_NEAREST);
+	CHECK_FALSE(cut->scaled);
+	CHECK_EQUAL(wifi_icon_rle_bitmap->width, (uint32_t)widget_area(cut->glyph)->width);
+
+	icon_set_bitmap(cut, wifi_icon_bitmap);
+	icon_set_size(cut, 10, 10, SCALE_NEAREST);
+	icon_set_bitmap(cut, wifi_icon_rle_bitmap);
+	POINTERS_EQUAL(wifi_icon_bitmap, cut->bitmap);
+}
@@ -0,0 +1,206 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "list_view.h"
+#include "widget.h"
+#include "widget_tree.h"
+}
+
+#include "mocks/draw_probe.h"
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+#define ITEMS 100000
+
+struct row
+{
+	widget_t * glyph;
+	size_t index;
+};
+
+static struct row * rows[32];
+static int binds;
+static int created;
+
+/* Each pixel encodes the item and the line within it, so a scrolled frame can be compared to a full redraw. */
+static void row_draw(void * instance, const area_t * limiting_canvas_area)
+{
+	struct row * r = (struct row *)instance;
+	dim_t x, y;
+
+	for (y = limiting_canvas_area->y; y < limiting_canvas_area->y + limiting_canvas_area->height; y++)
+		for (x = limiting_canvas_area->x; x < limiting_canvas_area->x + limiting_canvas_area->width; x++)
+			framebuffer_start()[x + y * framebuffer_stride()] = (pixel_t)(r->index * 31 + (y - widget_area(r->glyph)->y));
+}
+
+static void row_delete(void * instance)
+{
+	struct row * r = (struct row *)instance;
+
+	widget_delete_instance_only(r->glyph);
+	free(r);
+}
+
+static widget_t * create_row(void * user, widget_t * parent)
+{
+	struct row * r = (struct row *)malloc(sizeof(struct row));
+
+	(void)user;
+	rows[created++] = r;
+	r->glyph = widget_new(parent, r, row_draw, row_delete);
+
+	return r->glyph;
+}
+
+static void bind_row(void * user, widget_t * glyph, size_t index)
+{
+	int i;
+
+	(void)user;
+	binds++;
+	for (i = 0; i < created; i++)
+		if (rows[i]->glyph == glyph)
+			rows[i]->index = index;
+}
+
+static dim_t variable_height(void * user, size_t index)
+{
+	(void)user;
+	return (dim_t)(10 + index % 7 * 5);
+}
+
+TEST_GROUP(list_view)
+{
+	widget_t * root;
+	list_view_t * cut;
+
+	void setup()
+	{
+		marshmallow_terminal_output = output_intercepter;
+		framebuffer_init();
+		event_pool_init();
+
+		root = widget_new(NULL, NULL, NULL, NULL);
+		widget_set_area(root, 0, 0, 800, 480);
+
+		binds = 0;
+		created = 0;
+
+		cut = list_view_new(root);
+		list_view_set_position(cut, 10, 20);
+		list_view_set_size(cut, 100, 100);
+		list_view_set_adapter(cut, NULL, create_row, bind_row);
+		list_view_set_row_height(cut, 20);
+		list_view_set_item_count(cut, ITEMS);
+
+		widget_tree_draw(root);
+	}
+
+	void teardown()
+	{
+		widget_tree_delete(root);
+		event_pool_deinit();
+		framebuffer_deinit();
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+};
+
+TEST(list_view, instantiates_viewport_and_margin_only)
+{
+	CHECK_EQUAL(5 + LIST_VIEW_MARGIN_ROWS, list_view_row_count(cut));
+	CHECK_EQUAL(20, widget_area(list_view_item_row(cut, 0))->y);
+	CHECK_EQUAL(100, widget_area(list_view_item_row(cut, 4))->y);
+	POINTERS_EQUAL(NULL, list_view_item_row(cut, 7));
+}
+
+TEST(list_view, recycles_rows_while_scrolling)
+{
+	int i;
+
+	for (i = 0; i < 200; i++)
+	{
+		list_view_scroll_by(cut, 7);
+		CHECK_TRUE(matches_full_redraw(root));
+	}
+
+	CHECK_EQUAL(1400, list_view_offset(cut));
+	CHECK_EQUAL(5 + 2 * LIST_VIEW_MARGIN_ROWS + 1, created);
+	CHECK_EQUAL(20 + 70 * 20 - 1400, widget_area(list_view_item_row(cut, 70))->y);
+
+	list_view_scroll_to_item(cut, ITEMS - 1);
+	CHECK_EQUAL(ITEMS * 20 - 100, list_view_offset(cut));
+	CHECK_TRUE(list_view_item_row(cut, ITEMS - 1) != NULL);
+	CHECK_EQUAL(5 + 2 * LIST_VIEW_MARGIN_ROWS + 1, created);
+	CHECK_TRUE(matches_full_redraw(root));
+}
+
+TEST(list_view, refresh_binds_visible_item_only)
+{
+	binds = 0;
+
+	list_view_refresh_item(cut, 3);
+	list_view_refresh_item(cut, 500);
+
+	CHECK_EQUAL(1, binds);
+}
+
+TEST(list_view, variable_heights_use_offset_index)
+{
+	size_t i;
+	dim_t offset = 0;
+
+	list_view_set_variable_row_height(cut, variable_height);
+
+	for (i = 0; i < 1000; i++)
+	{
+		CHECK_EQUAL(offset, list_view_item_offset(cut, i));
+		CHECK_EQUAL(i, list_view_item_at(cut, offset));
+		CHECK_EQUAL(i, list_view_item_at(cut, offset + variable_height(NULL, i) - 1));
+		offset += variable_height(NULL, i);
+	}
+
+	list_view_scroll_to_item(cut, 5000);
+	CHECK_EQUAL(list_view_item_offset(cut, 5000), list_view_offset(cut));
+	CHECK_EQUAL(20, widget_area(list_view_item_row(cut, 5000))->y);
+	CHECK_EQUAL(variable_height(NULL, 5000), widget_area(list_view_item_row(cut, 5000))->height);
+	CHECK_TRUE(matches_full_redraw(root));
+
+	list_view_scroll_by(cut, -33);
+	CHECK_TRUE(matches_full_redraw(root));
+}
+
+TEST(list_view, shrinking_count_clamps_and_rebinds)
+{
+	list_view_scroll_to(cut, 5000);
+	list_view_set_item_count(cut, 3);
+
+	CHECK_EQUAL(0, list_view_offset(cut));
+	CHECK_TRUE(list_view_item_row(cut, 2) != NULL);
+	POINTERS_EQUAL(NULL, list_view_item_row(cut, 3));
+}
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+extern "C" {
+#include "framebuffer.h"
+#include "widget_tree.h"
+}
+
+#include "draw_probe.h"
+
+void probe_draw(void * instance, const area_t * limiting_canvas_area)
+{
+	struct probe * p = (struct probe *)instance;
+
+	p->draws++;
+	p->limit = *limiting_canvas_area;
+}
+
+void overlay_draw(void * instance, const area_t * limiting_canvas_area)
+{
+	dim_t x, y;
+
+	(void)instance;
+
+	for (y = limiting_canvas_area->y; y < limiting_canvas_area->y + limiting_canvas_area->height; y++)
+		for (x = limiting_canvas_area->x; x < limiting_canvas_area->x + limiting_canvas_area->width; x++)
+			framebuffer_start()[x + y * framebuffer_stride()] = (pixel_t)0x1234;
+}
+
+bool matches_full_redraw(widget_t * root)
+{
+	size_t size = framebuffer_stride() * framebuffer_height() * sizeof(pixel_t);
+	pixel_t * incremental = (pixel_t *)malloc(size);
+	bool same;
+
+	memcpy(incremental, framebuffer_start(), size);
+	widget_tree_draw(root);
+	same = memcmp(incremental, framebuffer_start(), size) == 0;
+
+	free(incremental);
+
+	return same;
+}
@@ -0,0 +1,45 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef DRAW_PROBE_H_
+#define DRAW_PROBE_H_
+
+extern "C" {
+#include "types.h"
+}
+
+/* Widget draw callback counting its calls and keeping the last limiting area, with a
+ * struct probe as creator instance. */
+struct probe
+{
+	int draws;
+	area_t limit;
+};
+
+void probe_draw(void * instance, const area_t * limiting_canvas_area);
+/* Widget draw callback filling its area with one value, e.g. for an overlapping popup. */
+void overlay_draw(void * instance, const area_t * limiting_canvas_area);
+
+/* Whether the framebuffer holds what a full redraw of root draws, which it then does.
+ * Incremental updates (scrolls, shifts, partial redraws) are checked against it. */
+bool matches_full_redraw(widget_t * root);
+
+#endif /* DRAW_PROBE_H_ */
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+extern "C" {
+#include "framebuffer.h"
+#include "widget_tree.h"
+}
+
+#include "reference_frame.h"
+
+void reference_frame_init(struct reference_frame * frame)
+{
+	frame->size = framebuffer_stride() * framebuffer_height() * sizeof(pixel_t);
+	frame->pixels = (pixel_t *)malloc(frame->size);
+}
+
+void reference_frame_deinit(struct reference_frame * frame)
+{
+	free(frame->pixels);
+	frame->pixels = NULL;
+}
+
+void reference_frame_keep(struct reference_frame * frame)
+{
+	memcpy(frame->pixels, framebuffer_start(), frame->size);
+	memset(framebuffer_start(), 0, frame->size);
+}
+
+void reference_frame_draw(struct reference_frame * frame, widget_t * root)
+{
+	memset(framebuffer_start(), 0, frame->size);
+	widget_tree_draw(root);
+	reference_frame_keep(frame);
+}
+
+bool reference_frame_matches(const struct reference_frame * frame)
+{
+	return memcmp(frame->pixels, framebuffer_start(), frame->size) == 0;
+}
+
+void wrapped_fill_rect(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color)
+{
+	framebuffer_ops_software()->fill_rect(dst, stride, width, height, color);
+}
@@ -0,0 +1,51 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef REFERENCE_FRAME_H_
+#define REFERENCE_FRAME_H_
+
+#include <cstddef>
+
+extern "C" {
+#include "types.h"
+}
+
+/* A framebuffer sized copy the drawing of a test is compared to, for the renderers
+ * that must draw what a direct widget_tree_draw draws. */
+struct reference_frame
+{
+	pixel_t * pixels;
+	size_t size;
+};
+
+void reference_frame_init(struct reference_frame * frame);
+void reference_frame_deinit(struct reference_frame * frame);
+/* Copies the framebuffer to the reference, then clears the framebuffer. */
+void reference_frame_keep(struct reference_frame * frame);
+/* Keeps what a direct draw of root gives on a cleared framebuffer. */
+void reference_frame_draw(struct reference_frame * frame, widget_t * root);
+bool reference_frame_matches(const struct reference_frame * frame);
+
+/* The software fill_rect behind a function of its own, so that an ops table holding
+ * it is not the software table. */
+void wrapped_fill_rect(pixel_t * dst, size_t stride, dim_t width, dim_t height, pixel_t color);
+
+#endif /* REFERENCE_FRAME_H_ */
@@ -28,6 +28,7 @@ extern "C" {
 
 #include "helper/my_string.h"
 #include "helper/my_string.c"
+#include "signalslot.h"
 }
 
 TEST_GROUP(my_string)
@@ -56,3 +57,28 @@ TEST(my_string, instance)
 	my_string_set(cut, "tweedledee tweedledee tweedledee tweedledee tweedledee tweedledee tweedledee tweedledee");
 	STRCMP_EQUAL("tweedledee tweedledee tweedledee tweedledee tweedledee tweedledee tweedledee tweedledee", my_string_get(cut));
 }
+
+static int update_count = 0;
+static void count_update(void *)
+{
+	update_count++;
+}
+
+TEST(my_string, same_content_is_not_an_update)
+{
+	slot_t * slot = slot_new();
+
+	update_count = 0;
+	slot_set(slot, count_update, NULL);
+	slot_connect(slot, my_string_get_update_signal(cut));
+
+	my_string_set(cut, "tweedledee");
+	my_string_set(cut, "tweedledee");
+	CHECK_EQUAL(1, update_count);
+
+	my_string_set(cut, "tweedledum");
+	CHECK_EQUAL(2, update_count);
+	STRCMP_EQUAL("tweedledum", my_string_get(cut));
+
+	slot_delete(slot);
+}
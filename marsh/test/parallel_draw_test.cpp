@@ -0,0 +1,228 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "parallel_draw.h"
+#include "rectangle.h"
+#include "text.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+#include "font_data/fonts.h"
+#include "helper/my_string.h"
+}
+
+#include "mocks/reference_frame.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+#define PANELS 6
+
+TEST_GROUP(parallel_draw)
+{
+	widget_t * screen;
+	rectangle_t * background;
+	rectangle_t * panels[PANELS];
+	rectangle_t * bars[PANELS];
+	text_t * labels[PANELS];
+	struct reference_frame reference;
+
+	void setup()
+	{
+		int i;
+
+		framebuffer_init();
+		event_pool_init();
+		reference_frame_init(&reference);
+
+		screen = widget_new(NULL, NULL, NULL, NULL);
+		widget_set_area(screen, 0, 0, (dim_t)framebuffer_width(), (dim_t)framebuffer_height());
+
+		/* Everything overlaps the background, its children are the first split level. */
+		background = rectangle_new(screen);
+		rectangle_set_fill_color_html(background, "#202020");
+		rectangle_set_size(background, (dim_t)framebuffer_width(), (dim_t)framebuffer_height());
+
+		for (i = 0; i < PANELS; i++)
+		{
+			panels[i] = rectangle_new(rectangle_get_widget(background));
+			rectangle_set_position(panels[i], (dim_t)(10 + (i % 3) * 260), (dim_t)(10 + (i / 3) * 230));
+			rectangle_set_size(panels[i], 250, 220);
+			rectangle_set_fill_color_html(panels[i], "#404080");
+			rectangle_set_border_color_html(panels[i], "#C0C0C0");
+			rectangle_set_rounded_corner_radius(panels[i], 9);
+
+			bars[i] = rectangle_new(rectangle_get_widget(panels[i]));
+			rectangle_set_position(bars[i], 10, 150);
+			rectangle_set_size(bars[i], (dim_t)(40 + i * 30), 40);
+			rectangle_set_fill_color_html(bars[i], "#00C000");
+
+			labels[i] = text_new(rectangle_get_widget(panels[i]));
+			text_set_color_html(labels[i], "#FFFFFF");
+			text_set_font(labels[i], ubuntu_monospace_16);
+			text_set_reference_position(labels[i], 10, 20);
+			my_string_set(text_get_string(labels[i]), "Panel\nvalue 42");
+		}
+	}
+
+	void teardown()
+	{
+		int i;
+
+		parallel_draw_stop();
+		for (i = 0; i < PANELS; i++)
+		{
+			text_delete(labels[i]);
+			rectangle_delete(bars[i]);
+			rectangle_delete(panels[i]);
+		}
+		rectangle_delete(background);
+		widget_delete(screen);
+		reference_frame_deinit(&reference);
+		event_pool_deinit();
+		framebuffer_deinit();
+	}
+
+	parallel_draw_stats_t stats()
+	{
+		parallel_draw_stats_t stats;
+
+		parallel_draw_stats(&stats);
+		return stats;
+	}
+};
+
+TEST(parallel_draw, not_running_draws_serially)
+{
+	CHECK_FALSE(parallel_draw_running());
+	LONGS_EQUAL(0, parallel_draw_threads());
+
+	parallel_draw_start(4);
+
+	CHECK(parallel_draw_running());
+	LONGS_EQUAL(4, parallel_draw_threads());
+	LONGS_EQUAL(0, stats().sections);
+
+	parallel_draw_stop();
+	CHECK_FALSE(parallel_draw_running());
+}
+
+TEST(parallel_draw, matches_serial_draw)
+{
+	reference_frame_draw(&reference, screen);
+	parallel_draw_start(4);
+
+	widget_tree_draw(screen);
+
+	CHECK(reference_frame_matches(&reference));
+	LONGS_EQUAL(1, stats().sections);
+	LONGS_EQUAL(PANELS, stats().batches);
+	LONGS_EQUAL(PANELS, stats().widest);
+}
+
+TEST(parallel_draw, overlapping_siblings_share_a_batch)
+{
+	rectangle_set_position(panels[1], 290, 10);
+	rectangle_set_position(panels[4], 290, 240);
+	reference_frame_draw(&reference, screen);
+	parallel_draw_start(3);
+
+	widget_tree_draw(screen);
+
+	CHECK(reference_frame_matches(&reference));
+	LONGS_EQUAL(PANELS - 2, stats().batches);
+}
+
+TEST(parallel_draw, clipped_redraw_only_counts_drawing_batches)
+{
+	area_t area;
+
+	area_set(&area, 100, 100, 300, 50);
+	memset(framebuffer_start(), 0, reference.size);
+	widget_redraw_area(screen, &area);
+	reference_frame_keep(&reference);
+	parallel_draw_start(2);
+
+	widget_redraw_area(screen, &area);
+
+	CHECK(reference_frame_matches(&reference));
+	LONGS_EQUAL(2, stats().batches);
+}
+
+TEST(parallel_draw, single_batch_is_drawn_serially)
+{
+	area_t area;
+
+	parallel_draw_start(2);
+	area_set(&area, 20, 20, 50, 50);
+
+	widget_redraw_area(screen, &area);
+
+	LONGS_EQUAL(0, stats().sections);
+}
+
+TEST(parallel_draw, other_ops_tables_draw_serially)
+{
+	framebuffer_ops_t ops = *framebuffer_ops_software();
+
+	ops.fill_rect = wrapped_fill_rect;
+	reference_frame_draw(&reference, screen);
+	parallel_draw_start(4);
+	framebuffer_set_ops(&ops);
+
+	widget_tree_draw(screen);
+
+	framebuffer_set_ops(NULL);
+	CHECK(reference_frame_matches(&reference));
+	LONGS_EQUAL(0, stats().sections);
+}
+
+TEST(parallel_draw, restored_software_table_draws_concurrently)
+{
+	framebuffer_ops_t ops = *framebuffer_ops();
+
+	parallel_draw_start(4);
+	framebuffer_set_ops(&ops);
+
+	widget_tree_draw(screen);
+
+	LONGS_EQUAL(1, stats().sections);
+}
+
+TEST(parallel_draw, reset_stats)
+{
+	parallel_draw_start(4);
+	widget_tree_draw(screen);
+	CHECK(stats().sections > 0);
+	CHECK(stats().wall_ns > 0);
+
+	parallel_draw_reset_stats();
+
+	LONGS_EQUAL(0, stats().sections);
+	LONGS_EQUAL(0, stats().batches);
+	LONGS_EQUAL(0, stats().busy_ns);
+}
@@ -0,0 +1,310 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "canvas.h"
+#include "framebuffer.h"
+#include "path_rasterizer.h"
+}
+
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+#define WHITE 0xFFFF
+
+TEST_GROUP(path_rasterizer)
+{
+	canvas_t * canv;
+
+	void setup()
+	{
+		area_t area;
+
+		framebuffer_init();
+		area_set(&area, 100, 100, 200, 200);
+		canv = canvas_new(&area);
+	}
+
+	void teardown()
+	{
+		canvas_delete(canv);
+		framebuffer_deinit();
+	}
+
+	pixel_t pixel(dim_t x, dim_t y)
+	{
+		return framebuffer_start()[100 + x + (100 + y) * framebuffer_stride()];
+	}
+
+	size_t count(pixel_t color)
+	{
+		size_t x, y, n = 0;
+
+		for (y = 0; y < framebuffer_height(); y++)
+			for (x = 0; x < framebuffer_width(); x++)
+				n += framebuffer_start()[x + y * framebuffer_stride()] == color;
+
+		return n;
+	}
+
+	void set(fixed_point_t * point, double x, double y)
+	{
+		point->x = PATH_FIXED(x);
+		point->y = PATH_FIXED(y);
+	}
+
+	/* Two nested squares of the same orientation. */
+	void nested_squares(fixed_point_t * points)
+	{
+		set(&points[0], 10, 10);
+		set(&points[1], 50, 10);
+		set(&points[2], 50, 50);
+		set(&points[3], 10, 50);
+		set(&points[4], 20, 20);
+		set(&points[5], 40, 20);
+		set(&points[6], 40, 40);
+		set(&points[7], 20, 40);
+	}
+};
+
+TEST(path_rasterizer, rectangle_fills_pixel_centers_inside)
+{
+	fixed_point_t points[4];
+
+	set(&points[0], 10, 20);
+	set(&points[1], 30, 20);
+	set(&points[2], 30, 25);
+	set(&points[3], 10, 25);
+	draw_polygon(canv, WHITE, points, 4, FILL_NONZERO, false);
+
+	CHECK_EQUAL(20 * 5, count(WHITE));
+	CHECK_EQUAL(WHITE, pixel(10, 20));
+	CHECK_EQUAL(WHITE, pixel(29, 24));
+	CHECK_EQUAL(0, pixel(30, 24));
+	CHECK_EQUAL(0, pixel(10, 25));
+}
+
+TEST(path_rasterizer, triangle_covers_half)
+{
+	fixed_point_t points[3];
+
+	set(&points[0], 0, 0);
+	set(&points[1], 100, 0);
+	set(&points[2], 0, 100);
+	draw_polygon(canv, WHITE, points, 3, FILL_EVEN_ODD, false);
+
+	CHECK_TRUE(count(WHITE) > 4900 && count(WHITE) < 5100);
+	CHECK_EQUAL(WHITE, pixel(0, 98));
+	CHECK_EQUAL(0, pixel(99, 99));
+}
+
+TEST(path_rasterizer, fill_rules)
+{
+	fixed_point_t points[8];
+	size_t lengths[2] = {4, 4};
+
+	nested_squares(points);
+
+	draw_path(canv, WHITE, points, lengths, 2, FILL_NONZERO, false);
+	CHECK_EQUAL(40 * 40, count(WHITE));
+
+	framebuffer_init();
+	draw_path(canv, WHITE, points, lengths, 2, FILL_EVEN_ODD, false);
+	CHECK_EQUAL(40 * 40 - 20 * 20, count(WHITE));
+	CHECK_EQUAL(0, pixel(30, 30));
+}
+
+TEST(path_rasterizer, writes_stay_inside_clip)
+{
+	fixed_point_t points[3];
+	area_t area, clip;
+	canvas_t * clipped;
+
+	area_set(&area, 100, 100, 200, 200);
+	area_set(&clip, 150, 150, 10, 10);
+	clipped = canvas_new_clipped(&area, &clip);
+
+	set(&points[0], -10000, -10000);
+	set(&points[1], 20000, -500);
+	set(&points[2], -300, 30000);
+	draw_polygon(clipped, WHITE, points, 3, FILL_NONZERO, true);
+	canvas_delete(clipped);
+
+	CHECK_EQUAL(100, count(WHITE));
+	CHECK_EQUAL(WHITE, pixel(50, 50));
+	CHECK_EQUAL(WHITE, pixel(59, 59));
+}
+
+TEST(path_rasterizer, shape_past_right_side_fills_to_clip)
+{
+	fixed_point_t points[4];
+	bool anti_alias;
+
+	for (anti_alias = false; ; anti_alias = true)
+	{
+		memset(framebuffer_start(), 0, framebuffer_stride() * framebuffer_height() * sizeof(pixel_t));
+		set(&points[0], 10, 20);
+		set(&points[1], 1000, 20);
+		set(&points[2], 1000, 30);
+		set(&points[3], 10, 30);
+		draw_polygon(canv, WHITE, points, 4, FILL_NONZERO, anti_alias);
+
+		CHECK_EQUAL(190 * 10, count(WHITE));
+		CHECK_EQUAL(WHITE, pixel(199, 29));
+
+		if (anti_alias)
+			break;
+	}
+}
+
+TEST(path_rasterizer, shape_past_bottom_side_fills_to_clip)
+{
+	fixed_point_t points[4];
+	bool anti_alias;
+
+	for (anti_alias = false; ; anti_alias = true)
+	{
+		memset(framebuffer_start(), 0, framebuffer_stride() * framebuffer_height() * sizeof(pixel_t));
+		set(&points[0], 10, 150);
+		set(&points[1], 30, 150);
+		set(&points[2], 30, 1000);
+		set(&points[3], 10, 1000);
+		draw_polygon(canv, WHITE, points, 4, FILL_NONZERO, anti_alias);
+
+		CHECK_EQUAL(20 * 50, count(WHITE));
+		CHECK_EQUAL(WHITE, pixel(29, 199));
+
+		if (anti_alias)
+			break;
+	}
+}
+
+TEST(path_rasterizer, anti_aliasing_blends_partial_pixels)
+{
+	fixed_point_t points[4];
+
+	set(&points[0], 10.5, 10);
+	set(&points[1], 20.5, 10);
+	set(&points[2], 20.5, 12);
+	set(&points[3], 10.5, 12);
+	draw_polygon(canv, WHITE, points, 4, FILL_NONZERO, true);
+
+	CHECK_EQUAL(9 * 2, count(WHITE));
+	CHECK_TRUE(pixel(10, 10) != 0 && pixel(10, 10) != WHITE);
+	CHECK_TRUE(pixel(20, 11) != 0 && pixel(20, 11) != WHITE);
+	CHECK_EQUAL(0, pixel(21, 10));
+	CHECK_EQUAL(0, pixel(15, 12));
+}
+
+TEST(path_rasterizer, polyline_stroke_has_width)
+{
+	fixed_point_t points[3];
+
+	set(&points[0], 10, 10.5);
+	set(&points[1], 50, 10.5);
+	set(&points[2], 50, 60);
+	draw_polyline(canv, WHITE, points, 3, PATH_FIXED(3), false);
+
+	CHECK_EQUAL(0, pixel(30, 8));
+	CHECK_EQUAL(WHITE, pixel(30, 9));
+	CHECK_EQUAL(WHITE, pixel(30, 11));
+	CHECK_EQUAL(0, pixel(30, 12));
+	CHECK_EQUAL(WHITE, pixel(48, 30));
+	CHECK_EQUAL(WHITE, pixel(50, 30));
+	CHECK_EQUAL(0, pixel(51, 30));
+	CHECK_EQUAL(0, pixel(50, 9));
+
+	/* Outer corner partially covered by the bevel. */
+	draw_polyline(canv, WHITE, points, 3, PATH_FIXED(3), true);
+	CHECK_TRUE(pixel(50, 9) != 0);
+	CHECK_EQUAL(0, pixel(51, 9));
+}
+
+static bool in_arc(double px, double py, double cx, double cy, double radius, double thickness, double start, double sweep)
+{
+	double dx = px - cx, dy = py - cy;
+	double d2 = dx * dx + dy * dy;
+	double angle = atan2(dy, dx) * 180 / M_PI - start;
+
+	while (angle < 0)
+		angle += 360;
+
+	return d2 < radius * radius && d2 >= (radius - thickness) * (radius - thickness) && angle <= sweep;
+}
+
+TEST(path_rasterizer, arcs_match_exact_sectors)
+{
+	const double sweeps[] = {30, 90, 180, 200, 359, 360};
+	fixed_point_t center;
+	area_t bounds;
+	size_t i, mismatches, inside;
+	dim_t x, y;
+	bool drawn;
+
+	set(&center, 60.5, 70);
+
+	for (i = 0; i < sizeof(sweeps) / sizeof(sweeps[0]); i++)
+	{
+		framebuffer_init();
+		draw_arc(canv, WHITE, center, PATH_FIXED(50), PATH_FIXED(12), PATH_DEGREES(100), PATH_DEGREES(sweeps[i]));
+		arc_bounds(&bounds, center, PATH_FIXED(50), PATH_FIXED(12), PATH_DEGREES(100), PATH_DEGREES(sweeps[i]));
+
+		mismatches = inside = 0;
+		for (y = 0; y < 200; y++)
+		{
+			for (x = 0; x < 200; x++)
+			{
+				drawn = pixel(x, y) == WHITE;
+				inside += drawn;
+				mismatches += drawn != in_arc(x + 0.5, y + 0.5, 60.5, 70, 50, 12, 100, sweeps[i]);
+
+				if (drawn)
+				{
+					point_t point = {x, y};
+					CHECK_TRUE(area_contains_point(&bounds, point));
+				}
+			}
+		}
+
+		/* Only pixels on the sector rays may differ, from the sine table rounding. */
+		CHECK_TRUE(inside > 0);
+		CHECK_TRUE(mismatches <= 4);
+	}
+}
+
+TEST(path_rasterizer, arc_sweep_may_be_negative)
+{
+	fixed_point_t center;
+
+	set(&center, 50, 50);
+	draw_arc(canv, WHITE, center, PATH_FIXED(40), PATH_FIXED(5), PATH_DEGREES(90), PATH_DEGREES(-90));
+
+	CHECK_EQUAL(WHITE, pixel(85, 50));
+	CHECK_EQUAL(WHITE, pixel(50, 85));
+	CHECK_EQUAL(0, pixel(14, 50));
+	CHECK_EQUAL(0, pixel(50, 14));
+}
@@ -0,0 +1,159 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+extern "C" {
+#include "pixel_convert.h"
+}
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+#define WIDTH 53
+#define HEIGHT 7
+#define SRC_STRIDE 64
+#define DST_STRIDE (WIDTH * 4 + 12)
+
+static const enum e_pixel_convert_isa isas[] = {PIXEL_CONVERT_SCALAR, PIXEL_CONVERT_SSSE3, PIXEL_CONVERT_AVX2};
+
+TEST_GROUP(pixel_convert)
+{
+	uint16_t * all;
+	uint16_t * src;
+	uint8_t * dst;
+
+	void setup()
+	{
+		size_t i;
+
+		all = (uint16_t *)malloc(65536 * sizeof(uint16_t));
+		for (i = 0; i < 65536; i++)
+			all[i] = (uint16_t)i;
+
+		src = (uint16_t *)malloc(SRC_STRIDE * HEIGHT * sizeof(uint16_t));
+		for (i = 0; i < SRC_STRIDE * HEIGHT; i++)
+			src[i] = (uint16_t)(i * 40503u);
+
+		dst = (uint8_t *)malloc(65536 * 4);
+	}
+
+	void teardown()
+	{
+		pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+		free(dst);
+		free(src);
+		free(all);
+	}
+
+	static uint8_t red(uint16_t pixel)
+	{
+		return (uint8_t)((pixel >> 11) << 3 | 0x07);
+	}
+
+	static uint8_t green(uint16_t pixel)
+	{
+		return (uint8_t)(((pixel >> 5) & 0x3F) << 2 | 0x03);
+	}
+
+	static uint8_t blue(uint16_t pixel)
+	{
+		return (uint8_t)((pixel & 0x1F) << 3 | 0x07);
+	}
+};
+
+TEST(pixel_convert, every_value_to_888)
+{
+	size_t i, n;
+
+	for (n = 0; n < sizeof(isas) / sizeof(isas[0]); n++)
+	{
+		pixel_convert_set_isa(isas[n]);
+		memset(dst, 0, 65536 * 3);
+
+		pixel_convert_565_to_888(dst, 0, all, 0, 65536, 1);
+
+		for (i = 0; i < 65536; i++)
+		{
+			BYTES_EQUAL(red(all[i]), dst[i * 3]);
+			BYTES_EQUAL(green(all[i]), dst[i * 3 + 1]);
+			BYTES_EQUAL(blue(all[i]), dst[i * 3 + 2]);
+		}
+	}
+}
+
+TEST(pixel_convert, every_value_to_x888)
+{
+	uint32_t * words = (uint32_t *)dst;
+	size_t i, n;
+
+	for (n = 0; n < sizeof(isas) / sizeof(isas[0]); n++)
+	{
+		pixel_convert_set_isa(isas[n]);
+		memset(dst, 0, 65536 * 4);
+
+		pixel_convert_565_to_x888(words, 0, all, 0, 65536, 1);
+
+		for (i = 0; i < 65536; i++)
+			LONGS_EQUAL((uint32_t)red(all[i]) << 16 | (uint32_t)green(all[i]) << 8 | blue(all[i]), words[i]);
+	}
+}
+
+TEST(pixel_convert, rectangle_leaves_the_rest_untouched)
+{
+	uint8_t * expected = (uint8_t *)malloc(DST_STRIDE * HEIGHT);
+	size_t n;
+	int x, y;
+
+	memset(expected, 0xAA, DST_STRIDE * HEIGHT);
+	for (y = 0; y < HEIGHT; y++)
+	{
+		for (x = 0; x < WIDTH; x++)
+		{
+			expected[y * DST_STRIDE + x * 3] = red(src[y * SRC_STRIDE + x + 3]);
+			expected[y * DST_STRIDE + x * 3 + 1] = green(src[y * SRC_STRIDE + x + 3]);
+			expected[y * DST_STRIDE + x * 3 + 2] = blue(src[y * SRC_STRIDE + x + 3]);
+		}
+	}
+
+	for (n = 0; n < sizeof(isas) / sizeof(isas[0]); n++)
+	{
+		pixel_convert_set_isa(isas[n]);
+		memset(dst, 0xAA, DST_STRIDE * HEIGHT);
+
+		pixel_convert_565_to_888(dst, DST_STRIDE, src + 3, SRC_STRIDE, WIDTH, HEIGHT);
+
+		CHECK(memcmp(expected, dst, DST_STRIDE * HEIGHT) == 0);
+	}
+
+	free(expected);
+}
+
+TEST(pixel_convert, isa_is_limited_to_the_supported)
+{
+	enum e_pixel_convert_isa widest = pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+
+	LONGS_EQUAL(widest, pixel_convert_isa());
+	LONGS_EQUAL(PIXEL_CONVERT_SCALAR, pixel_convert_set_isa(PIXEL_CONVERT_SCALAR));
+	LONGS_EQUAL(PIXEL_CONVERT_SCALAR, pixel_convert_isa());
+	STRCMP_EQUAL("scalar", pixel_convert_isa_name(PIXEL_CONVERT_SCALAR));
+}
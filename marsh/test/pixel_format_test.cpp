@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "color.h"
+#include "framebuffer.h"
+#include "pixel_format.h"
+#include "bitmap_data/bitmaps.h"
+}
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+/* The tests build the library for RGB565, the other formats are covered by the
+ * headless backend built with PIXEL_FORMAT set. */
+TEST_GROUP(pixel_format)
+{
+	/* How color_to_pixel and color_from_pixel packed RGB565 before the formats. */
+	static pixel_t legacy_pack(uint8_t red, uint8_t green, uint8_t blue)
+	{
+		return (pixel_t)(((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3));
+	}
+
+	static void legacy_unpack(pixel_t pixel, uint8_t * red, uint8_t * green, uint8_t * blue)
+	{
+		*red = (pixel >> 8) & 0xF8;
+		*red |= (*red & 0x08) ? 0x7 : 0x0;
+		*green = (pixel >> 3) & 0xFC;
+		*green |= (*green & 0x04) ? 0x3 : 0x0;
+		*blue = (pixel << 3) & 0xF8;
+		*blue |= (*green & 0x08) ? 0x7 : 0x0;
+	}
+};
+
+TEST(pixel_format, rgb565_packing_is_unchanged)
+{
+	uint8_t red, green, blue;
+	uint32_t i;
+
+	STRCMP_EQUAL("RGB565", pixel_format_name());
+
+	for (i = 0; i < 0x10000; i++)
+	{
+		legacy_unpack((pixel_t)i, &red, &green, &blue);
+		CHECK_EQUAL(red, PIXEL_RED(i));
+		CHECK_EQUAL(green, PIXEL_GREEN(i));
+		CHECK_EQUAL(blue, PIXEL_BLUE(i));
+		CHECK_EQUAL(i, PIXEL_FROM_565(i));
+		CHECK_EQUAL(color(red, green, blue), color_from_pixel((pixel_t)i));
+	}
+
+	for (i = 0; i < 256; i++)
+	{
+		CHECK_EQUAL(legacy_pack((uint8_t)i, (uint8_t)(255 - i), (uint8_t)(i * 7)),
+				PIXEL_PACK(i, 255 - i, (uint8_t)(i * 7)));
+		CHECK_EQUAL(PIXEL_PACK(i, 0, 255 - i), color_to_pixel(color((uint8_t)i, 0, (uint8_t)(255 - i))));
+	}
+}
+
+TEST(pixel_format, blend_matches_color_blending)
+{
+	const pixel_t under[] = {0x0000, 0xFFFF, 0x1234, 0x8410, 0xF81F, 0x07E0};
+	const pixel_t color = 0x5AEB;
+	pixel_t pixels[sizeof(under) / sizeof(under[0])];
+	uint8_t alpha[sizeof(under) / sizeof(under[0])];
+	size_t i;
+	int a;
+
+	for (a = 0; a < 256; a++)
+	{
+		memcpy(pixels, under, sizeof(pixels));
+		memset(alpha, a, sizeof(alpha));
+		framebuffer_ops_software()->blend_a8(pixels, 0, alpha, 0, (dim_t)(sizeof(pixels) / sizeof(pixels[0])), 1, color);
+
+		for (i = 0; i < sizeof(pixels) / sizeof(pixels[0]); i++)
+		{
+			pixel_t expected = under[i];
+
+			if (a == 255)
+				expected = color;
+			else if (a)
+				expected = color_to_pixel(color_alpha_blend(color_from_pixel(under[i]), color_from_pixel(color), (uint8_t)a));
+			CHECK_EQUAL(expected, pixels[i]);
+		}
+	}
+}
+
+TEST(pixel_format, rgb565_bitmaps_are_used_as_they_are)
+{
+	bitmap_t * converted = pixel_format_bitmap_new(lena_bitmap);
+
+	POINTERS_EQUAL(lena_bitmap, converted);
+	pixel_format_bitmap_delete(lena_bitmap, converted);
+}
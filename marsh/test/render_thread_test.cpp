@@ -0,0 +1,339 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+#include <time.h>
+
+extern "C" {
+#include "area.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "rectangle.h"
+#include "render_thread.h"
+#include "scroll_view.h"
+#include "sprite.h"
+#include "text.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+#include "bitmap_data/bitmaps.h"
+#include "font_data/fonts.h"
+#include "helper/my_string.h"
+}
+
+#include "mocks/reference_frame.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+#define PANELS 4
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+TEST_GROUP(render_thread)
+{
+	widget_t * screen;
+	rectangle_t * background;
+	rectangle_t * panels[PANELS];
+	text_t * label;
+	struct reference_frame reference;
+
+	void setup()
+	{
+		int i;
+
+		framebuffer_init();
+		event_pool_init();
+		reference_frame_init(&reference);
+
+		screen = widget_new(NULL, NULL, NULL, NULL);
+		widget_set_area(screen, 0, 0, (dim_t)framebuffer_width(), (dim_t)framebuffer_height());
+
+		background = rectangle_new(screen);
+		rectangle_set_fill_color_html(background, "#202020");
+		rectangle_set_size(background, (dim_t)framebuffer_width(), (dim_t)framebuffer_height());
+
+		for (i = 0; i < PANELS; i++)
+		{
+			panels[i] = rectangle_new(rectangle_get_widget(background));
+			rectangle_set_position(panels[i], (dim_t)(10 + i * 190), 10);
+			rectangle_set_size(panels[i], 180, 200);
+			rectangle_set_fill_color_html(panels[i], "#404080");
+			rectangle_set_border_color_html(panels[i], "#C0C0C0");
+			rectangle_set_rounded_corner_radius(panels[i], 9);
+		}
+
+		label = text_new(rectangle_get_widget(panels[0]));
+		text_set_color_html(label, "#FFFFFF");
+		text_set_font(label, ubuntu_monospace_16);
+		text_set_reference_position(label, 20, 30);
+		my_string_set(text_get_string(label), "Pipelined");
+
+		memset(framebuffer_start(), 0, reference.size);
+	}
+
+	void teardown()
+	{
+		int i;
+
+		render_thread_stop();
+		text_delete(label);
+		for (i = 0; i < PANELS; i++)
+			rectangle_delete(panels[i]);
+		rectangle_delete(background);
+		widget_delete(screen);
+		reference_frame_deinit(&reference);
+		event_pool_deinit();
+		framebuffer_deinit();
+	}
+
+	void change_panels(const char * color)
+	{
+		int i;
+
+		widget_begin_update(screen);
+		for (i = 0; i < PANELS; i++)
+			rectangle_set_fill_color_html(panels[i], color);
+		widget_commit_update(screen);
+	}
+
+	bool framebuffer_blank()
+	{
+		size_t i;
+
+		for (i = 0; i < framebuffer_stride() * framebuffer_height(); i++)
+			if (framebuffer_start()[i])
+				return false;
+
+		return true;
+	}
+
+	render_thread_stats_t stats()
+	{
+		render_thread_stats_t stats;
+
+		render_thread_stats(&stats);
+		return stats;
+	}
+};
+
+TEST(render_thread, start_and_stop)
+{
+	CHECK_FALSE(render_thread_running());
+
+	render_thread_start();
+	CHECK(render_thread_running());
+
+	render_thread_stop();
+	CHECK_FALSE(render_thread_running());
+}
+
+TEST(render_thread, draws_are_deferred_to_the_published_frame)
+{
+	widget_tree_draw(screen);
+	reference_frame_keep(&reference);
+	render_thread_start();
+
+	widget_tree_draw(screen);
+
+	CHECK(framebuffer_blank());
+
+	CHECK(render_thread_publish());
+	render_thread_flush();
+
+	CHECK(reference_frame_matches(&reference));
+	LONGS_EQUAL(1, stats().published);
+	LONGS_EQUAL(1, stats().presented);
+}
+
+TEST(render_thread, damaged_areas_match_serial_redraw)
+{
+	widget_tree_draw(screen);
+	change_panels("#800000");
+	reference_frame_keep(&reference);
+	render_thread_start();
+
+	widget_tree_draw(screen);
+	render_thread_publish();
+	render_thread_flush();
+	change_panels("#800000");
+	render_thread_publish();
+	render_thread_flush();
+
+	CHECK(reference_frame_matches(&reference));
+}
+
+TEST(render_thread, frames_taken_back_are_merged)
+{
+	static const char * colors[] = {"#800000", "#008000", "#000080", "#808000"};
+	render_thread_stats_t result;
+	int i;
+
+	widget_tree_draw(screen);
+	for (i = 0; i < PANELS; i++)
+	{
+		widget_begin_update(screen);
+		rectangle_set_fill_color_html(panels[i], colors[i]);
+		widget_commit_update(screen);
+	}
+	reference_frame_keep(&reference);
+
+	for (i = 0; i < PANELS; i++)
+		rectangle_set_fill_color_html(panels[i], "#404080");
+	render_thread_start();
+
+	widget_tree_draw(screen);
+	render_thread_publish();
+	for (i = 0; i < PANELS; i++)
+	{
+		widget_begin_update(screen);
+		rectangle_set_fill_color_html(panels[i], colors[i]);
+		widget_commit_update(screen);
+		render_thread_publish();
+	}
+	render_thread_flush();
+
+	result = stats();
+	CHECK(reference_frame_matches(&reference));
+	LONGS_EQUAL(PANELS + 1, result.published);
+	LONGS_EQUAL(result.published, result.presented + result.reclaimed);
+}
+
+TEST(render_thread, nothing_to_publish)
+{
+	render_thread_start();
+
+	CHECK_FALSE(render_thread_publish());
+	LONGS_EQUAL(0, stats().published);
+}
+
+TEST(render_thread, input_latency_is_measured_to_present)
+{
+	uint64_t stamp;
+
+	render_thread_start();
+
+	stamp = now_ns();
+	render_thread_mark_input(stamp);
+	render_thread_mark_input(stamp + 1000);
+	widget_tree_draw(screen);
+	render_thread_publish();
+	render_thread_flush();
+
+	LONGS_EQUAL(1, stats().inputs);
+	CHECK(stats().latency_ns > 0);
+	CHECK(stats().latency_ns <= now_ns() - stamp);
+	CHECK(stats().max_latency_ns == stats().latency_ns);
+
+	render_thread_reset_stats();
+	LONGS_EQUAL(0, stats().inputs);
+}
+
+/* A scroll moving pixels the render thread has not drawn yet would show stale ones. */
+TEST(render_thread, scroll_under_a_frame_in_flight_matches_serial_draw)
+{
+	static const char * colors[] = {"#800000", "#008000", "#000080", "#808000"};
+	scroll_view_t * view = scroll_view_new(rectangle_get_widget(background));
+	rectangle_t * stripes[4];
+	int i;
+
+	scroll_view_set_position(view, 100, 250);
+	scroll_view_set_size(view, 300, 150);
+	scroll_view_set_content_size(view, 300, 400);
+	for (i = 0; i < 4; i++)
+	{
+		stripes[i] = rectangle_new(scroll_view_get_widget(view));
+		rectangle_set_position(stripes[i], 100, (dim_t)(250 + i * 100));
+		rectangle_set_size(stripes[i], 300, 100);
+		rectangle_set_fill_color_html(stripes[i], colors[i]);
+	}
+	scroll_view_scroll_to(view, 0, 60);
+	rectangle_set_fill_color_html(stripes[1], "#C0C0C0");
+	widget_tree_draw(screen);
+	reference_frame_keep(&reference);
+
+	scroll_view_scroll_to(view, 0, 100);
+	rectangle_set_fill_color_html(stripes[1], colors[1]);
+	widget_tree_draw(screen);
+	render_thread_start();
+
+	rectangle_set_fill_color_html(stripes[1], "#FFFFFF");
+	render_thread_publish();
+	rectangle_set_fill_color_html(stripes[1], "#C0C0C0");
+	scroll_view_scroll_by(view, 0, -40);
+	render_thread_publish();
+	render_thread_flush();
+
+	CHECK(reference_frame_matches(&reference));
+
+	render_thread_stop();
+	for (i = 0; i < 4; i++)
+		rectangle_delete(stripes[i]);
+	scroll_view_delete(view);
+}
+
+TEST(render_thread, sprites_stay_on_top_of_frames_in_flight)
+{
+	sprite_t * cursor = sprite_new(wifi_icon_bitmap);
+
+	sprite_set_color_html(cursor, "#FFFF00");
+	sprite_set_position(cursor, 240, 60);
+	sprite_show(cursor);
+	change_panels("#800000");
+	widget_tree_draw(screen);
+	reference_frame_keep(&reference);
+	render_thread_start();
+
+	widget_tree_draw(screen);
+	render_thread_publish();
+	sprite_set_position(cursor, 50, 60);
+	change_panels("#008000");
+	render_thread_publish();
+	sprite_set_position(cursor, 240, 60);
+	change_panels("#800000");
+	render_thread_publish();
+	render_thread_flush();
+
+	CHECK(reference_frame_matches(&reference));
+
+	render_thread_stop();
+	sprite_delete(cursor);
+}
+
+TEST(render_thread, needs_the_software_operations)
+{
+	framebuffer_ops_t ops = *framebuffer_ops_software();
+
+	ops.fill_rect = wrapped_fill_rect;
+	framebuffer_set_ops(&ops);
+
+	render_thread_start();
+
+	framebuffer_set_ops(NULL);
+	CHECK_FALSE(render_thread_running());
+}
@@ -0,0 +1,282 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+extern "C" {
+#include "area.h"
+#include "bitmap_data/bitmap_data.h"
+#include "bitmap_data/bitmaps.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "image.h"
+#include "pixel_convert.h"
+#include "pixel_format.h"
+#include "scale.h"
+#include "widget_tree.h"
+}
+
+#include <cstdlib>
+#include <cstring>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+TEST_GROUP(scale)
+{
+	canvas_t * canv;
+
+	void setup()
+	{
+		framebuffer_init();
+		canv = canvas_new_fullscreen();
+		clear();
+	}
+
+	void teardown()
+	{
+		canvas_delete(canv);
+		pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+		framebuffer_deinit();
+	}
+
+	pixel_t * line(dim_t y)
+	{
+		return framebuffer_start() + y * framebuffer_stride();
+	}
+
+	void clear(void)
+	{
+		memset(framebuffer_start(), 0, framebuffer_stride() * framebuffer_height() * sizeof(pixel_t));
+	}
+
+	/* A copy of width by height framebuffer pixels at x, y. */
+	pixel_t * save(dim_t x, dim_t y, dim_t width, dim_t height)
+	{
+		pixel_t * copy = (pixel_t *)malloc(width * height * sizeof(pixel_t));
+		dim_t i;
+
+		for (i = 0; i < height; i++)
+			memcpy(copy + i * width, line(y + i) + x, width * sizeof(pixel_t));
+
+		return copy;
+	}
+
+	void check_equal(const pixel_t * expected, dim_t x, dim_t y, dim_t width, dim_t height)
+	{
+		dim_t i, j;
+
+		for (i = 0; i < height; i++)
+			for (j = 0; j < width; j++)
+				CHECK_EQUAL(expected[i * width + j], line(y + i)[x + j]);
+	}
+};
+
+TEST(scale, same_size_copies_the_bitmap)
+{
+	static const enum e_scale_filter filters[] = {SCALE_NEAREST, SCALE_BILINEAR};
+	bitmap_t * native = pixel_format_bitmap_new(lena_bitmap);
+	const pixel_t * pixels = (const pixel_t *)native->bitmap;
+	pixel_t * expected = (pixel_t *)malloc(256 * 256 * sizeof(pixel_t));
+	size_t i;
+
+	memcpy(expected, pixels, 256 * 256 * sizeof(pixel_t));
+
+	for (i = 0; i < sizeof(filters) / sizeof(filters[0]); i++)
+	{
+		clear();
+		draw_bitmap_scaled(canv, lena_bitmap, 0, 10, 20, 256, 256, filters[i]);
+		check_equal(expected, 10, 20, 256, 256);
+	}
+
+	free(expected);
+	pixel_format_bitmap_delete(lena_bitmap, native);
+}
+
+TEST(scale, nearest_doubling_repeats_each_pixel)
+{
+	static const pixel_t source[3 * 4] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+	pixel_t dst[6 * 8];
+	scale_t scale;
+	dim_t x, y;
+
+	memset(&scale, 0, sizeof(scale));
+	scale.source = SCALE_SOURCE_NATIVE;
+	scale.filter = SCALE_NEAREST;
+	scale.pixels = source;
+	scale.stride = 4;
+	scale.width = 4;
+	scale.height = 3;
+	scale_fit(&scale, 8, 6);
+	scale_software(dst, 8, &scale, 8, 6);
+
+	for (y = 0; y < 6; y++)
+		for (x = 0; x < 8; x++)
+			CHECK_EQUAL(source[y / 2 * 4 + x / 2], dst[y * 8 + x]);
+}
+
+TEST(scale, bilinear_weighs_the_pixels_around_each_sample)
+{
+	const pixel_t source[2] = {PIXEL_PACK(0x00, 0x00, 0x00), PIXEL_PACK(0xFF, 0xFF, 0xFF)};
+	pixel_t dst[4];
+	scale_t scale;
+
+	memset(&scale, 0, sizeof(scale));
+	scale.source = SCALE_SOURCE_NATIVE;
+	scale.filter = SCALE_BILINEAR;
+	scale.pixels = source;
+	scale.stride = 2;
+	scale.width = 2;
+	scale.height = 1;
+	scale_fit(&scale, 4, 1);
+	scale_software(dst, 4, &scale, 4, 1);
+
+	/* Samples at -0.25, 0.25, 0.75 and 1.25, the outer ones repeating the edges. */
+	CHECK_EQUAL(source[0], dst[0]);
+	CHECK_EQUAL(PIXEL_PACK(0x3F, 0x3F, 0x3F), dst[1]);
+	CHECK_EQUAL(PIXEL_PACK(0xBF, 0xBF, 0xBF), dst[2]);
+	CHECK_EQUAL(source[1], dst[3]);
+}
+
+TEST(scale, same_size_alpha_and_indexed_match_their_unscaled_draws)
+{
+	static const enum e_scale_filter filters[] = {SCALE_NEAREST, SCALE_BILINEAR};
+	const pixel_t color = PIXEL_PACK(0x00, 0xFF, 0xFF);
+	const bitmap_t * icon = wifi_icon_bitmap, * indexed = lena_indexed4_bitmap;
+	pixel_t * expected;
+	size_t i;
+
+	draw_fill_area(canv, PIXEL_PACK(0x40, 0x20, 0x10), 0, 0, 400, 300);
+	draw_alpha_bitmap_8bpp(canv, color, (const uint8_t *)icon->bitmap, 30, 40, icon->width, icon->height);
+	draw_bitmap_indexed(canv, (const uint8_t *)indexed->bitmap, 4, indexed->palette, 100, 10, indexed->width, indexed->height);
+	expected = save(0, 0, 400, 300);
+
+	for (i = 0; i < sizeof(filters) / sizeof(filters[0]); i++)
+	{
+		draw_fill_area(canv, PIXEL_PACK(0x40, 0x20, 0x10), 0, 0, 400, 300);
+		draw_bitmap_scaled(canv, icon, color, 30, 40, icon->width, icon->height, filters[i]);
+		draw_bitmap_scaled(canv, indexed, 0, 100, 10, indexed->width, indexed->height, filters[i]);
+		check_equal(expected, 0, 0, 400, 300);
+	}
+
+	free(expected);
+}
+
+TEST(scale, clipped_draws_match_the_whole_draw)
+{
+	static const enum e_scale_filter filters[] = {SCALE_NEAREST, SCALE_BILINEAR};
+	static const dim_t clips[][4] = {{0, 0, 173, 97}, {1, 1, 100, 50}, {57, 33, 116, 64}, {172, 96, 1, 1}};
+	area_t area, clip;
+	canvas_t * clipped;
+	pixel_t * expected;
+	size_t i, j;
+
+	for (i = 0; i < sizeof(filters) / sizeof(filters[0]); i++)
+	{
+		clear();
+		draw_bitmap_scaled(canv, lena_bitmap, 0, 200, 100, 173, 97, filters[i]);
+		expected = save(200, 100, 173, 97);
+
+		for (j = 0; j < sizeof(clips) / sizeof(clips[0]); j++)
+		{
+			clear();
+			area_set(&area, 200, 100, 173, 97);
+			area_set(&clip, 200 + clips[j][0], 100 + clips[j][1], clips[j][2], clips[j][3]);
+			clipped = canvas_new_clipped(&area, &clip);
+			draw_bitmap_scaled(clipped, lena_bitmap, 0, 0, 0, 173, 97, filters[i]);
+			canvas_delete(clipped);
+
+			CHECK_EQUAL(expected[clips[j][1] * 173 + clips[j][0]], line(clip.y)[clip.x]);
+			CHECK_EQUAL(expected[(clips[j][1] + clips[j][3] - 1) * 173 + clips[j][0] + clips[j][2] - 1],
+					line(clip.y + clip.height - 1)[clip.x + clip.width - 1]);
+			CHECK_EQUAL(0, line(clip.y + clip.height)[clip.x]);
+		}
+
+		free(expected);
+	}
+}
+
+TEST(scale, simd_bilinear_matches_scalar)
+{
+	static const dim_t sizes[][2] = {{600, 450}, {97, 173}, {31, 7}};
+	const pixel_t color = PIXEL_PACK(0xFF, 0x80, 0x00);
+	pixel_t * expected;
+	size_t i;
+
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+	{
+		pixel_convert_set_isa(PIXEL_CONVERT_SCALAR);
+		clear();
+		draw_bitmap_scaled(canv, lena_bitmap, 0, 0, 0, sizes[i][0], sizes[i][1], SCALE_BILINEAR);
+		draw_bitmap_scaled(canv, wifi_icon_bitmap, color, 3, 5, sizes[i][1], sizes[i][0] / 2, SCALE_BILINEAR);
+		expected = save(0, 0, 700, 470);
+
+		pixel_convert_set_isa(PIXEL_CONVERT_AVX2);
+		clear();
+		draw_bitmap_scaled(canv, lena_bitmap, 0, 0, 0, sizes[i][0], sizes[i][1], SCALE_BILINEAR);
+		draw_bitmap_scaled(canv, wifi_icon_bitmap, color, 3, 5, sizes[i][1], sizes[i][0] / 2, SCALE_BILINEAR);
+		check_equal(expected, 0, 0, 700, 470);
+
+		free(expected);
+	}
+}
+
+TEST(scale, levels_pick_the_smallest_covering_the_size)
+{
+	static const dim_t sizes[][3] = {{300, 200, 128}, {128, 128, 128}, {100, 20, 128}, {64, 64, 64}, {40, 33, 64},
+			{32, 32, 32}, {1, 1, 32}, {64, 65, 128}};
+	size_t i;
+
+	CHECK_EQUAL(3u, lena_levels->count);
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+		CHECK_EQUAL((uint32_t)sizes[i][2], scale_pick_level(lena_levels, sizes[i][0], sizes[i][1])->width);
+}
+
+TEST(scale, image_levels_blit_a_level_of_the_drawn_size)
+{
+	const bitmap_t * level = lena_levels->levels[1];
+	image_t * image;
+	pixel_t * expected;
+
+	draw_bitmap(canv, (BUFFER_PTR_RDOLY)level->bitmap, 10, 10, level->width, level->height);
+	expected = save(10, 10, 64, 64);
+	clear();
+
+	event_pool_init();
+	image = image_new(NULL);
+	image_set_position(image, 10, 10);
+	image_set_size(image, 64, 64, SCALE_BILINEAR);
+	image_set_levels(image, lena_levels);
+	widget_tree_draw(image_get_widget(image));
+	check_equal(expected, 10, 10, 64, 64);
+	CHECK_EQUAL(0, line(74)[10]);
+
+	/* Shrunk from the 64 pixel level. */
+	clear();
+	image_set_size(image, 40, 40, SCALE_BILINEAR);
+	widget_tree_draw(image_get_widget(image));
+	CHECK(line(10)[10] != 0);
+	CHECK_EQUAL(0, line(50)[10]);
+
+	image_delete(image);
+	event_pool_deinit();
+	free(expected);
+}
@@ -0,0 +1,224 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "animation.h"
+#include "area.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "scroll_view.h"
+#include "widget.h"
+#include "widget_tree.h"
+}
+
+#include "mocks/draw_probe.h"
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+struct content
+{
+	widget_t * glyph;
+	int draws;
+	area_t limit;
+};
+
+/* Each pixel encodes its content coordinate, so a scrolled frame can be compared to a full redraw. */
+static void content_draw(void * instance, const area_t * limiting_canvas_area)
+{
+	struct content * c = (struct content *)instance;
+	const area_t * area = widget_area(c->glyph);
+	dim_t x, y;
+
+	c->draws++;
+	c->limit = *limiting_canvas_area;
+
+	for (y = limiting_canvas_area->y; y < limiting_canvas_area->y + limiting_canvas_area->height; y++)
+		for (x = limiting_canvas_area->x; x < limiting_canvas_area->x + limiting_canvas_area->width; x++)
+			framebuffer_start()[x + y * framebuffer_stride()] = (pixel_t)((y - area->y) * 97 + (x - area->x));
+}
+
+TEST_GROUP(scroll_view)
+{
+	widget_t * root;
+	scroll_view_t * cut;
+	struct content content;
+
+	void setup()
+	{
+		marshmallow_terminal_output = output_intercepter;
+		framebuffer_init();
+		event_pool_init();
+
+		root = widget_new(NULL, NULL, NULL, NULL);
+		widget_set_area(root, 0, 0, 800, 480);
+
+		cut = scroll_view_new(root);
+		scroll_view_set_position(cut, 10, 20);
+		scroll_view_set_size(cut, 100, 100);
+		scroll_view_set_content_size(cut, 200, 300);
+		/* Opaque, the scrolls move the pixels. */
+		scroll_view_set_background_color_html(cut, "#000000");
+
+		memset(&content, 0, sizeof(content));
+		content.glyph = widget_new(scroll_view_get_widget(cut), &content, content_draw, NULL);
+		widget_set_area(content.glyph, 10, 20, 200, 300);
+
+		widget_tree_draw(root);
+		content.draws = 0;
+	}
+
+	void teardown()
+	{
+		animation_stop_all();
+		widget_tree_delete(root);
+		event_pool_deinit();
+		framebuffer_deinit();
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+};
+
+/* A checkerboard of 8 pixel squares over the widget area. */
+static void pattern_draw(void * instance, const area_t * limiting_canvas_area)
+{
+	dim_t x, y;
+
+	(void)instance;
+
+	for (y = limiting_canvas_area->y; y < limiting_canvas_area->y + limiting_canvas_area->height; y++)
+		for (x = limiting_canvas_area->x; x < limiting_canvas_area->x + limiting_canvas_area->width; x++)
+			framebuffer_start()[x + y * framebuffer_stride()] = (pixel_t)(((x / 8 + y / 8) % 2) ? 0xFFFF : 0x1234);
+}
+
+TEST(scroll_view, scroll_draws_exposed_strip_only)
+{
+	scroll_view_scroll_by(cut, 0, 10);
+
+	CHECK_EQUAL(10, scroll_view_offset(cut).y);
+	CHECK_EQUAL(10, widget_area(content.glyph)->y);
+	CHECK_EQUAL(1, content.draws);
+	CHECK_EQUAL(110, content.limit.y);
+	CHECK_EQUAL(10, content.limit.height);
+	CHECK_EQUAL(100, content.limit.width);
+
+	CHECK_TRUE(matches_full_redraw(root));
+}
+
+TEST(scroll_view, diagonal_scrolls_match_full_redraw)
+{
+	scroll_view_scroll_by(cut, 7, 13);
+	CHECK_TRUE(matches_full_redraw(root));
+
+	scroll_view_scroll_by(cut, -3, -5);
+	CHECK_TRUE(matches_full_redraw(root));
+
+	scroll_view_scroll_by(cut, 0, 150);
+	CHECK_TRUE(matches_full_redraw(root));
+}
+
+TEST(scroll_view, offset_is_clamped_to_content)
+{
+	scroll_view_scroll_to(cut, 1000, -10);
+
+	CHECK_EQUAL(100, scroll_view_offset(cut).x);
+	CHECK_EQUAL(0, scroll_view_offset(cut).y);
+	CHECK_EQUAL(-90, widget_area(content.glyph)->x);
+}
+
+TEST(scroll_view, fling_decays_and_stops_at_edge)
+{
+	int frames = 0;
+
+	scroll_view_fling(cut, 0, 600);
+	CHECK_TRUE(scroll_view_flinging(cut));
+
+	animation_tick(root, 16);
+	CHECK_EQUAL(9, scroll_view_offset(cut).y);
+
+	while (scroll_view_flinging(cut) && frames++ < 1000)
+		animation_tick(root, 16);
+
+	CHECK_FALSE(scroll_view_flinging(cut));
+	CHECK_EQUAL(0, animation_count());
+	CHECK_TRUE(scroll_view_offset(cut).y > 100);
+	CHECK_TRUE(scroll_view_offset(cut).y <= 200);
+	CHECK_TRUE(matches_full_redraw(root));
+
+	scroll_view_fling(cut, 0, 100000);
+	while (scroll_view_flinging(cut) && frames++ < 2000)
+		animation_tick(root, 16);
+
+	CHECK_EQUAL(200, scroll_view_offset(cut).y);
+}
+
+TEST(scroll_view, overlapping_sibling_is_not_moved)
+{
+	widget_t * overlay = widget_new(root, NULL, overlay_draw, NULL);
+
+	widget_set_area(overlay, 60, 60, 80, 30);
+	widget_tree_draw(root);
+	content.draws = 0;
+
+	scroll_view_scroll_by(cut, 0, 10);
+
+	CHECK_EQUAL(1, content.draws);
+	CHECK_EQUAL(20, content.limit.y);
+	CHECK_EQUAL(100, content.limit.height);
+	CHECK_TRUE(matches_full_redraw(root));
+
+	widget_hide(overlay);
+	widget_tree_draw(root);
+	content.draws = 0;
+
+	scroll_view_scroll_by(cut, 0, 10);
+
+	CHECK_EQUAL(110, content.limit.y);
+	CHECK_TRUE(matches_full_redraw(root));
+}
+
+TEST(scroll_view, view_without_background_does_not_move_its_parent)
+{
+	struct content sparse;
+	/* Widgets without an instance are not drawn. */
+	widget_t * parent = widget_new(root, &sparse, pattern_draw, NULL);
+	scroll_view_t * view = scroll_view_new(parent);
+
+	widget_set_area(parent, 300, 20, 200, 200);
+	scroll_view_set_position(view, 320, 40);
+	scroll_view_set_size(view, 100, 100);
+	scroll_view_set_content_size(view, 100, 300);
+
+	/* Leaves the parent showing through most of the view. */
+	memset(&sparse, 0, sizeof(sparse));
+	sparse.glyph = widget_new(scroll_view_get_widget(view), &sparse, content_draw, NULL);
+	widget_set_area(sparse.glyph, 340, 60, 30, 20);
+
+	widget_tree_draw(root);
+
+	scroll_view_scroll_by(view, 0, 10);
+	CHECK_TRUE(matches_full_redraw(root));
+
+	scroll_view_scroll_by(view, 0, -5);
+	CHECK_TRUE(matches_full_redraw(root));
+}
@@ -0,0 +1,193 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+extern "C" {
+#include "area.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "sprite.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_update.h"
+#include "bitmap_data/bitmap_data.h"
+}
+
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+static const pixel_t image_pixels[] = { 0x1111, 0x2222, 0x3333, 0x4444 };
+static const struct s_bitmap image_2x2 = { image_pixels, 2, 2, false, BITMAP_BUFFER_16BPP, NULL };
+
+static const uint8_t mask_bits[] = { 0xA0, 0x00 }; // 2x2, top line "10" and "10".
+static const struct s_bitmap mask_2x2 = { mask_bits, 2, 2, true, BITMAP_BUFFER_1BPP, NULL };
+
+static const uint8_t alpha_pixels[] = { 0xFF, 0x00, 0x00, 0xFF };
+static const struct s_bitmap alpha_2x2 = { alpha_pixels, 2, 2, true, BITMAP_BUFFER_8BPP, NULL };
+
+static pixel_t widget_color = 0x0F0F;
+static void fill_draw(void *, const area_t * limiting_canvas_area)
+{
+	canvas_t * canv = canvas_new(limiting_canvas_area);
+	draw_solid_rectangle(canv, widget_color);
+	canvas_delete(canv);
+}
+
+static pixel_t fb(dim_t x, dim_t y)
+{
+	return framebuffer_start()[x + y * framebuffer_stride()];
+}
+
+TEST_GROUP(sprite)
+{
+	void setup()
+	{
+		size_t i;
+
+		marshmallow_terminal_output = output_intercepter;
+		framebuffer_init();
+		event_pool_init();
+
+		for (i = 0; i < framebuffer_stride() * framebuffer_height(); i++)
+			framebuffer_start()[i] = 0x0001;
+	}
+
+	void teardown()
+	{
+		event_pool_deinit();
+		framebuffer_deinit();
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+};
+
+TEST(sprite, show_blits_and_hide_restores)
+{
+	sprite_t * cut = sprite_new(&image_2x2);
+
+	sprite_set_position(cut, 10, 20);
+	CHECK_EQUAL(0x0001, fb(10, 20));
+
+	sprite_show(cut);
+	CHECK_EQUAL(0x1111, fb(10, 20));
+	CHECK_EQUAL(0x4444, fb(11, 21));
+
+	sprite_hide(cut);
+	CHECK_EQUAL(0x0001, fb(10, 20));
+	CHECK_EQUAL(0x0001, fb(11, 21));
+
+	sprite_delete(cut);
+}
+
+TEST(sprite, move_restores_old_area)
+{
+	sprite_t * cut = sprite_new(&image_2x2);
+
+	sprite_show(cut);
+	sprite_set_position(cut, 1, 1);
+
+	CHECK_EQUAL(0x0001, fb(0, 0));
+	CHECK_EQUAL(0x1111, fb(1, 1));
+	CHECK_EQUAL(0x4444, fb(2, 2));
+
+	sprite_set_position(cut, -1, 799);
+	CHECK_EQUAL(0x0001, fb(1, 1));
+	CHECK_EQUAL(0x0001, fb(2, 2));
+
+	sprite_delete(cut);
+	CHECK_EQUAL(0x0001, fb(0, 0));
+}
+
+TEST(sprite, icon_sources_use_sprite_color)
+{
+	sprite_t * mask = sprite_new(&mask_2x2);
+	sprite_t * alpha = sprite_new(&alpha_2x2);
+
+	sprite_set_color_html(mask, "#FFFFFF");
+	sprite_set_color_html(alpha, "#000000");
+	sprite_set_position(alpha, 10, 0);
+	sprite_show(mask);
+	sprite_show(alpha);
+
+	CHECK_EQUAL(0xFFFF, fb(0, 0));
+	CHECK_EQUAL(0x0001, fb(1, 0));
+	CHECK_EQUAL(0xFFFF, fb(0, 1));
+	CHECK_EQUAL(0x0000, fb(10, 0));
+	CHECK_EQUAL(0x0001, fb(11, 0));
+	CHECK_EQUAL(0x0000, fb(11, 1));
+
+	sprite_set_color_html(mask, "#000000");
+	CHECK_EQUAL(0x0000, fb(0, 0));
+
+	sprite_delete(mask);
+	sprite_delete(alpha);
+	CHECK_EQUAL(0x0001, fb(0, 0));
+	CHECK_EQUAL(0x0001, fb(10, 0));
+}
+
+TEST(sprite, lower_sprite_moves_under_upper)
+{
+	sprite_t * lower = sprite_new(&image_2x2);
+	sprite_t * upper = sprite_new(&alpha_2x2);
+
+	sprite_set_color_html(upper, "#000000");
+	sprite_set_position(upper, 1, 0);
+	sprite_show(lower);
+	sprite_show(upper);
+
+	sprite_set_position(lower, 1, 0);
+	CHECK_EQUAL(0x0000, fb(1, 0));
+	CHECK_EQUAL(0x2222, fb(2, 0));
+	CHECK_EQUAL(0x0001, fb(0, 0));
+
+	sprite_delete(upper);
+	CHECK_EQUAL(0x1111, fb(1, 0));
+
+	sprite_delete(lower);
+	CHECK_EQUAL(0x0001, fb(1, 0));
+}
+
+TEST(sprite, tree_redraw_stays_under_sprites)
+{
+	widget_t * root = widget_new(NULL, this, fill_draw, NULL);
+	sprite_t * cut = sprite_new(&image_2x2);
+
+	widget_set_area(root, 0, 0, 800, 480);
+	widget_tree_draw(root);
+	sprite_show(cut);
+
+	widget_color = 0x0707;
+	widget_begin_update(root);
+	widget_set_dim(root, 800, 479);
+	widget_commit_update(root);
+
+	CHECK_EQUAL(0x1111, fb(0, 0));
+	CHECK_EQUAL(0x0707, fb(5, 5));
+
+	sprite_hide(cut);
+	CHECK_EQUAL(0x0707, fb(0, 0));
+
+	sprite_delete(cut);
+	widget_tree_delete(root);
+	widget_color = 0x0F0F;
+}
@@ -0,0 +1,229 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "canvas.h"
+#include "drawing_algorithms.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "icon.h"
+#include "image.h"
+#include "path_rasterizer.h"
+#include "rectangle.h"
+#include "sprite.h"
+#include "text.h"
+#include "tile_renderer.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "bitmap_data/bitmap_data.h"
+#include "bitmap_data/bitmaps.h"
+#include "font_data/fonts.h"
+#include "helper/my_string.h"
+}
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+static const uint8_t arrow_bits[] = { 0x18, 0x3C, 0x7E, 0xFF, 0x18, 0x18, 0x18, 0x18 };
+static const struct s_bitmap arrow = { arrow_bits, 8, 8, true, BITMAP_BUFFER_1BPP, NULL };
+
+TEST_GROUP(tile_renderer)
+{
+	widget_t * screen;
+	rectangle_t * background;
+	rectangle_t * rounded;
+	rectangle_t * frame;
+	icon_t * icon;
+	icon_t * rle_icon;
+	image_t * image;
+	image_t * scaled;
+	text_t * text;
+	sprite_t * sprite;
+	pixel_t * reference;
+	size_t size;
+
+	void setup()
+	{
+		framebuffer_init();
+		event_pool_init();
+		size = framebuffer_stride() * framebuffer_height() * sizeof(pixel_t);
+		reference = (pixel_t *)malloc(size);
+
+		screen = widget_new(NULL, NULL, NULL, NULL);
+		widget_set_area(screen, 0, 0, (dim_t)framebuffer_width(), (dim_t)framebuffer_height());
+
+		background = rectangle_new(screen);
+		rectangle_set_fill_color_html(background, "#004000");
+		rectangle_set_position(background, 5, 5);
+		rectangle_set_size(background, 790, 470);
+
+		rounded = rectangle_new(rectangle_get_widget(background));
+		rectangle_set_position(rounded, 50, 20);
+		rectangle_set_size(rounded, 101, 77);
+		rectangle_set_fill_color_html(rounded, "#808080");
+		rectangle_set_border_color_html(rounded, "#c0c0c0");
+		rectangle_set_rounded_corner_radius(rounded, 13);
+
+		frame = rectangle_new(rectangle_get_widget(background));
+		rectangle_set_position(frame, 300, 60);
+		rectangle_set_size(frame, 130, 70);
+		rectangle_set_border_color_html(frame, "#c0c0c0");
+		rectangle_set_border_tickness(frame, 5);
+
+		icon = icon_new(screen);
+		icon_set_color_html(icon, "#00FFFF");
+		icon_set_position(icon, 60, 250);
+		icon_set_bitmap(icon, wifi_icon_bitmap);
+
+		/* Across four tiles. */
+		rle_icon = icon_new(screen);
+		icon_set_color_html(rle_icon, "#FFFF00");
+		icon_set_position(rle_icon, 230, 100);
+		icon_set_bitmap(rle_icon, wifi_icon_rle_bitmap);
+
+		image = image_new(screen);
+		image_set_bitmap(image, lena_bitmap);
+		image_set_position(image, 120, 205);
+
+		scaled = image_new(screen);
+		image_set_bitmap(scaled, lena_bitmap);
+		image_set_position(scaled, 500, 230);
+		image_set_size(scaled, 173, 97, SCALE_BILINEAR);
+
+		text = text_new(screen);
+		text_set_color_html(text, "#E0E0E0");
+		text_set_font(text, ubuntu_monospace_16);
+		text_set_reference_position(text, 10, 400);
+		my_string_set(text_get_string(text), "Hello World!\nHow beautiful is it?");
+
+		sprite = sprite_new(&arrow);
+		sprite_set_color_html(sprite, "#FF0000");
+		sprite_set_position(sprite, 60, 30);
+	}
+
+	void teardown()
+	{
+		tile_renderer_stop();
+		sprite_delete(sprite);
+		text_delete(text);
+		image_delete(scaled);
+		image_delete(image);
+		icon_delete(rle_icon);
+		icon_delete(icon);
+		rectangle_delete(frame);
+		rectangle_delete(rounded);
+		rectangle_delete(background);
+		widget_delete(screen);
+		free(reference);
+		event_pool_deinit();
+		framebuffer_deinit();
+	}
+
+	/* Widgets, a sprite over them, an anti-aliased path across tiles and a region move. */
+	void render()
+	{
+		static const fixed_point_t needle[] = {
+			{ PATH_FIXED(500), PATH_FIXED(300) }, { PATH_FIXED(700), PATH_FIXED(250) }, { PATH_FIXED(690), PATH_FIXED(420) } };
+		area_t moved = { 600, 10, 150, 150 };
+		canvas_t * canv;
+
+		memset(framebuffer_start(), 0, size);
+
+		widget_tree_draw(screen);
+		sprite_show(sprite);
+
+		canv = canvas_new_fullscreen();
+		draw_polygon(canv, 0xFFE0, needle, 3, FILL_NONZERO, true);
+		canvas_delete(canv);
+
+		canv = canvas_new(&moved);
+		draw_move_region(canv, -40, 17);
+		canvas_delete(canv);
+
+		sprite_set_position(sprite, 95, 52);
+		sprite_hide(sprite);
+
+		framebuffer_inform_written_area(0, 0, framebuffer_width(), framebuffer_height());
+	}
+
+	void check_threads(size_t threads)
+	{
+		render();
+		memcpy(reference, framebuffer_start(), size);
+
+		tile_renderer_start(threads);
+		CHECK_EQUAL(threads, tile_renderer_threads());
+		render();
+		tile_renderer_stop();
+
+		CHECK(memcmp(reference, framebuffer_start(), size) == 0);
+	}
+};
+
+TEST(tile_renderer, start_and_stop)
+{
+	CHECK(!tile_renderer_running());
+	tile_renderer_start(0);
+	CHECK(tile_renderer_running());
+	CHECK_EQUAL(1, tile_renderer_threads());
+	tile_renderer_stop();
+	CHECK(!tile_renderer_running());
+	CHECK(framebuffer_ops()->fence == NULL);
+}
+
+TEST(tile_renderer, threads_are_limited)
+{
+	tile_renderer_start(TILE_RENDERER_MAX_THREADS + 10);
+	CHECK_EQUAL(TILE_RENDERER_MAX_THREADS, tile_renderer_threads());
+}
+
+TEST(tile_renderer, operations_wait_for_the_sync)
+{
+	area_t area = { 10, 10, 100, 50 };
+	canvas_t * canv;
+
+	memset(framebuffer_start(), 0, size);
+	tile_renderer_start(1);
+
+	canv = canvas_new(&area);
+	draw_solid_rectangle(canv, 0x1234);
+	canvas_delete(canv);
+
+	CHECK_EQUAL(0, framebuffer_start()[framebuffer_stride() * 10 + 10]);
+	framebuffer_ops_sync();
+	CHECK_EQUAL(0x1234, framebuffer_start()[framebuffer_stride() * 10 + 10]);
+	CHECK_EQUAL(0x1234, framebuffer_start()[framebuffer_stride() * 59 + 109]);
+	CHECK_EQUAL(0, framebuffer_start()[framebuffer_stride() * 60 + 110]);
+}
+
+TEST(tile_renderer, single_thread_matches_software)
+{
+	check_threads(1);
+}
+
+TEST(tile_renderer, threads_match_software)
+{
+	check_threads(3);
+}
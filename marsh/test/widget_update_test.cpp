@@ -0,0 +1,154 @@
+/*
+ *  Copyright (C) 2013 to 2014 by Felipe Lavratti
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of
+ *  this software and associated documentation files (the "Software"), to deal in the
+ *  Software without restriction, including without limitation the rights to use,
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+ *  Software, and to permit persons to whom the Software is furnished to do so,
+ *  subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ *  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ *  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ *  AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstring>
+
+extern "C" {
+#include "area.h"
+#include "event.h"
+#include "framebuffer.h"
+#include "widget.h"
+#include "widget_tree.h"
+#include "widget_private.h"
+#include "widget_update.h"
+}
+
+#include "mocks/draw_probe.h"
+#include "mocks/terminal_intercepter.h"
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/MemoryLeakDetector.h"
+
+TEST_GROUP(widget_update)
+{
+	struct probe root_probe, child_probe;
+	widget_t * root;
+	widget_t * child;
+
+	void setup()
+	{
+		marshmallow_terminal_output = output_intercepter;
+		framebuffer_init();
+		event_pool_init();
+
+		root = widget_new(NULL, &root_probe, probe_draw, NULL);
+		child = widget_new(root, &child_probe, probe_draw, NULL);
+		widget_set_area(root, 0, 0, 800, 480);
+		widget_set_area(child, 10, 10, 20, 20);
+
+		widget_tree_draw(root);
+		memset(&root_probe, 0, sizeof(root_probe));
+		memset(&child_probe, 0, sizeof(child_probe));
+	}
+
+	void teardown()
+	{
+		widget_tree_delete(root);
+		event_pool_deinit();
+		framebuffer_deinit();
+		marshmallow_terminal_output = _stdout_output_impl;
+	}
+
+	void check_area(dim_t x, dim_t y, dim_t width, dim_t height, const area_t * area)
+	{
+		CHECK_EQUAL(x, area->x);
+		CHECK_EQUAL(y, area->y);
+		CHECK_EQUAL(width, area->width);
+		CHECK_EQUAL(height, area->height);
+	}
+};
+
+TEST(widget_update, redundant_updates_draw_nothing)
+{
+	widget_begin_update(root);
+	widget_set_pos(child, 10, 10);
+	widget_set_dim(child, 20, 20);
+	widget_set_area(child, 10, 10, 20, 20);
+	widget_show(child);
+	CHECK_FALSE(child->update_pending);
+	widget_commit_update(root);
+
+	CHECK_EQUAL(0, root_probe.draws);
+	CHECK_EQUAL(0, child_probe.draws);
+}
+
+TEST(widget_update, changes_are_drawn_once_inside_damage)
+{
+	widget_begin_update(root);
+	widget_set_pos(child, 12, 10);
+	widget_set_pos(child, 15, 10);
+	widget_set_dim(child, 20, 25);
+	widget_commit_update(root);
+
+	CHECK_EQUAL(1, root_probe.draws);
+	check_area(10, 10, 25, 25, &root_probe.limit);
+	CHECK_EQUAL(1, child_probe.draws);
+	check_area(15, 10, 20, 25, &child_probe.limit);
+}
+
+TEST(widget_update, disjoint_changes_draw_each_area)
+{
+	widget_begin_update(root);
+	widget_set_pos(child, 100, 100);
+	widget_commit_update(root);
+
+	CHECK_EQUAL(2, root_probe.draws);
+	CHECK_EQUAL(1, child_probe.draws);
+	check_area(100, 100, 20, 20, &child_probe.limit);
+}
+
+TEST(widget_update, nested_transactions_draw_on_outermost_commit)
+{
+	widget_begin_update(root);
+	widget_begin_update(root);
+	widget_hide(child);
+	widget_commit_update(root);
+
+	CHECK_TRUE(widget_update_in_progress());
+	CHECK_EQUAL(0, root_probe.draws);
+
+	widget_commit_update(root);
+
+	CHECK_FALSE(widget_update_in_progress());
+	CHECK_EQUAL(1, root_probe.draws);
+	check_area(10, 10, 20, 20, &root_probe.limit);
+	CHECK_EQUAL(0, child_probe.draws);
+}
+
+TEST(widget_update, setters_do_not_draw_out_of_transaction)
+{
+	widget_set_pos(child, 100, 100);
+	widget_hide(child);
+
+	CHECK_FALSE(child->update_pending);
+	CHECK_EQUAL(0, root_probe.draws);
+}
+
+TEST(widget_update, deleted_widget_area_is_redrawn)
+{
+	widget_begin_update(root);
+	widget_set_pos(child, 11, 10);
+	widget_delete(child);
+	widget_commit_update(root);
+
+	CHECK_EQUAL(1, root_probe.draws);
+	check_area(10, 10, 20, 20, &root_probe.limit);
+}